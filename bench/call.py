@@ -0,0 +1,23 @@
+# Call-bound: recursive fib and a loop of method calls.
+
+def fib(n):
+    if n < 2:
+        return n
+    return fib(n - 1) + fib(n - 2)
+
+class Counter:
+    def __init__(self):
+        self.n = 0
+    def add(self, v):
+        self.n = self.n + v
+        return self.n
+
+def calls(n):
+    c = Counter()
+    i = 0
+    while i < n:
+        c.add(i)
+        i = i + 1
+    return c.n
+
+print(fib(20), calls(50000))
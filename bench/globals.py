@@ -0,0 +1,14 @@
+# Global and builtin loads: a module constant and len() per iteration.
+
+N = 3
+items = [1, 2, 3]
+
+def loop(n):
+    i = 0
+    s = 0
+    while i < n:
+        s = s + len(items) + N
+        i = i + 1
+    return s
+
+print(loop(300000))
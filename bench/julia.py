@@ -0,0 +1,31 @@
+# The julia set kernel of examples/julia.py, without pygame.
+# Renders a few frames and prints a checksum of the palette values.
+
+SW,SH = 120,120
+
+def julia(ca,cb):
+    pal = [((min(255,v)),(min(255,v*3/2)),(min(255,v*2))) for v in range(0,256)]
+    total = 0
+    for y in range(0,SH):
+        for x in range(0,SW):
+            i=0
+            a=((float(x)/SW) * 4.0 - 2.0)
+            b=((float(y)/SH) * 4.0 - 2.0)
+            while i < 15 and (a*a)+(b*b)<4.0:
+                na=(a*a)-(b*b)+ca
+                nb=(2.0*a*b)+cb
+                a=na
+                b=nb
+                i = i +1
+            total = total + pal[i*16][2]
+    return total
+
+def main():
+    total = 0
+    for frame in range(0, 2):
+        ca = (float(frame) / 8) * 2.0 - 1.0
+        cb = 0.25 - (float(frame) / 8)
+        total = total + julia(ca, cb)
+    print(total)
+
+main()
@@ -0,0 +1,11 @@
+# Dispatch-bound loop: a counter, an accumulator and a compare per iteration.
+
+def loop(n):
+    i = 0
+    s = 0
+    while i < n:
+        s = s + i
+        i = i + 1
+    return s
+
+print(loop(500000))
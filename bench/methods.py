@@ -0,0 +1,29 @@
+# Attribute and method lookup: inherited methods on two classes.
+
+class Shape:
+    def __init__(self, w):
+        self.w = w
+    def area(self):
+        return self.w * self.w
+    def grow(self):
+        self.w = self.w + 1
+
+class Square(Shape):
+    pass
+
+class Circle(Shape):
+    def area(self):
+        return self.w * self.w * 3
+
+def loop(n):
+    shapes = [Square(1), Circle(1)]
+    i = 0
+    s = 0
+    while i < n:
+        o = shapes[i % 2]
+        s = s + o.area()
+        o.grow()
+        i = i + 1
+    return s
+
+print(loop(100000))
@@ -0,0 +1,9 @@
+# for-range loop: the loop counter lives in registers, no list is built.
+
+def loop(n):
+    s = 0
+    for i in range(n):
+        s = s + i
+    return s
+
+print(loop(500000))
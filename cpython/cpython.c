@@ -52,7 +52,7 @@ Tinypy_init(TinypyObject *self, PyObject *args, PyObject *kwds)
         kwlist, &time, &mem)) {
         return -1;
     }
-    tp_sandbox(self->vm, time, mem);
+    tp_sandbox(self->vm, time, mem, TP_NO_LIMIT);
 
     return 0;
 }
@@ -78,8 +78,6 @@ Tinypy_exec(TinypyObject *self, PyObject *args, PyObject *kwds)
         return NULL;
     }
 
-    tp->time_elapsed = 0;
-    tp->mem_exceeded = 0;
     if(!(TinypyModule = PyImport_ImportModule("tinypy"))) {
         return NULL;
     }
@@ -91,7 +89,7 @@ Tinypy_exec(TinypyObject *self, PyObject *args, PyObject *kwds)
         PyErr_SetObject(TinypyError, Tinypy_ConvertObj(tp->ex));
         return NULL;
     }
-    tp->clocks = clock();
+    tp_sandbox(tp, tp->time_limit, tp->mem_limit, tp->insn_limit);
     obj = tp_eval(tp, code, tp->builtins);
     ret = Tinypy_ConvertObj(obj);
     return ret;
@@ -0,0 +1,9 @@
+#include <tinypy/tp.h>
+void math_init(TP);
+void random_init(TP);
+void re_init(TP);
+void _tp_import_modules(TP) {
+math_init(tp);
+random_init(tp);
+re_init(tp);
+}
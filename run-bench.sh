@@ -0,0 +1,77 @@
+BACKENDS=()
+REPEAT=3
+
+# Call getopt to validate the provided input. 
+OPT=$(getopt -or:B: -l repeat:,backend: -- "$@")
+
+if [[ $? -ne 0 ]] ; then
+    echo "Incorrect options provided"
+    exit 1
+fi
+
+eval set -- "$OPT"
+
+while true; do
+    case "$1" in
+    -r | --repeat)
+        shift;
+        REPEAT=$1
+        ;;
+    -B | --backend)
+        shift; # The arg is next in position args
+        if [[ ! $1 =~ tpvm|tpvm-dbg|tpvm-switch ]]; then
+            echo "Incorrect options provided. Use tpvm, tpvm-dbg or tpvm-switch"
+            exit 1
+        fi
+        BACKENDS+=($1)
+        ;;
+    --)
+        shift
+        break
+        ;;
+    esac
+    shift
+done
+
+if [[ ${#BACKENDS[@]} -eq 0 ]]; then
+    BACKENDS=(tpvm)
+fi
+
+BENCHES=$@
+
+TPC=./tpc
+
+# best wall time of REPEAT runs, in milliseconds.
+function timeit {
+    best=
+    for ((n=0; n<REPEAT; n++)); do
+        t0=$(date +%s%N)
+        "./$1" $2 > /dev/null || return 1
+        t1=$(date +%s%N)
+        t=$(( (t1 - t0) / 1000000 ))
+        if [[ -z "${best}" || ${t} -lt ${best} ]]; then
+            best=${t}
+        fi
+    done
+    echo ${best}
+}
+
+printf "%-24s" "benchmark (ms)"
+for b in ${BACKENDS[@]}; do
+    printf "%14s" "${b}"
+done
+printf "\n"
+
+st=0
+for i in ${BENCHES[@]}; do
+    tpc=${i//.py/.tpc}
+    "${TPC}" -o ${tpc} ${i} || exit 1
+    printf "%-24s" "${i}"
+    for b in ${BACKENDS[@]}; do
+        t=$(timeit ${b} ${tpc}) || { t=FAIL; st=1; }
+        printf "%14s" "${t}"
+    done
+    printf "\n"
+done
+
+exit ${st}
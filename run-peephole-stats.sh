@@ -0,0 +1,34 @@
+TPC=./tpc
+TPVM=./tpvm
+
+# instructions of the code (static) and instructions run (dynamic), without
+# and with the peephole pass; the runs are counted by TP_PROFILE=1.
+
+# the number of instructions run by tpvm on $1.
+function dynamic {
+    TP_PROFILE=1 "${TPVM}" $1 2>&1 >/dev/null |
+        awk 'NR > 1 && NF == 0 { exit } NR > 1 { n += $2 } END { print n }'
+}
+
+# the number of instructions in the code of $@; tpc -d prints them.
+function static {
+    "${TPC}" -d -o /dev/null $@ | grep -c '^[0-9]'
+}
+
+printf "%-28s%22s%24s\n" "peephole" "static" "dynamic"
+s0=0; s1=0; d0=0; d1=0
+st=0
+for i in $@; do
+    tpc=${i//.py/.tpc}
+    a=$(static -P ${i}) || { st=1; continue; }
+    b=$(static ${i}) || { st=1; continue; }
+    "${TPC}" -P -o ${tpc} ${i} && c=$(dynamic ${tpc}) || { st=1; continue; }
+    "${TPC}" -o ${tpc} ${i} && d=$(dynamic ${tpc}) || { st=1; continue; }
+    printf "%-28s%22s%24s\n" "${i}" "${a} -> ${b}" "${c} -> ${d}"
+    s0=$((s0 + a)); s1=$((s1 + b)); d0=$((d0 + c)); d1=$((d1 + d))
+done
+printf "%-28s%22s%24s\n" "total" "${s0} -> ${s1}" "${d0} -> ${d1}"
+printf "%-28s%21s%%%23s%%\n" "removed" \
+    $(( (s0 - s1) * 100 / (s0 > 0 ? s0 : 1) )) $(( (d0 - d1) * 100 / (d0 > 0 ? d0 : 1) ))
+
+exit ${st}
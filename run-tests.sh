@@ -23,8 +23,8 @@ while true; do
     -B | --backend)
         shift; # The arg is next in position args
         BACKEND=$1
-        if [[ ! ${BACKEND} =~ tpy|tpy-dbg|tpvm|tpvm-dbg|tpy-shared ]]; then
-            echo "Incorrect options provided. Use tpy, tpy-dbg, tpvm, tpvm-dbg, or tpy-shared"
+        if [[ ! ${BACKEND} =~ tpy|tpy-dbg|tpvm|tpvm-dbg|tpvm-switch|tpy-shared ]]; then
+            echo "Incorrect options provided. Use tpy, tpy-dbg, tpvm, tpvm-dbg, tpvm-switch, or tpy-shared"
             exit 1
         fi
         ;;
@@ -60,6 +60,16 @@ function run {
     fi
 }
 
+# an uncaught error must abort with the traceback of where it was raised.
+function run_uncaught {
+    src=tests/exc/uncaught.py
+    out=$(run "${src}" 2>&1) && return 1
+    echo "${out}"
+    for want in 'line 7, in ?' 'line 5, in g' 'line 2, in f' 'boom'; do
+        [[ "${out}" == *"${want}"* ]] || return 1
+    done
+}
+
 st=0
 for i in ${TESTS[@]}; do
     if ! run "${i}"; then
@@ -71,6 +81,11 @@ for i in ${TESTS[@]}; do
     fi
 done
 
+if ! run_uncaught; then
+    echo ==== uncaught
+    st=1
+fi
+
 if [ "${st}" -ne 0 ]; then
     echo Some tests failed.
     exit 255
@@ -0,0 +1,7 @@
+def f():
+    raise "boom"
+
+def g():
+    f()
+
+g()
@@ -0,0 +1,56 @@
+import sys
+from tinypy.runtime.testing import UnitTest
+
+# tinypy.runtime.types and tinypy.runtime.testing are compiled to C with
+# tpc -a; this module is not.
+
+def ok(self):
+    self.calls = self.calls + 1
+
+def boom(self):
+    x = [1][2]
+
+class MyTest(UnitTest):
+    def test_compiled(self):
+        assert sys.conf.aot > 0
+
+    def test_call_interpreted(self):
+        self.calls = 0
+        r = self.runone('ok', ok)
+        assert r.passed
+        assert self.calls == 1
+
+    def test_traceback_through_compiled(self):
+        r = self.runone('boom', boom)
+        assert not r.passed
+        # the frame of the compiled runone has its line, between the two.
+        assert "in runone" in r.stack
+        assert "testfunc(self)" in r.stack
+        assert r.stack.find("in runone") < r.stack.find("in boom")
+
+    def test_raise_in_compiled(self):
+        try:
+            "{x}".format({})
+            assert False
+        except:
+            exc, stack = sys.get_exc()
+        assert "KeyError" in exc
+        assert "in format" in stack
+        assert "foo = d[spec]" in stack
+
+    def test_loop_in_compiled(self):
+        d = {}
+        for i in range(50):
+            d[str(i)] = i
+        assert "{7}-{42}".format(d) == "7-42"
+
+    def test_profiled(self):
+        # the profiler sees every instruction, so the C is not run.
+        sys.conf.profile = 1
+        r = "{a}{b}".format({'a': 1, 'b': 'x'})
+        sys.conf.profile = 0
+        assert r == "1x"
+
+t = MyTest()
+
+t.run()
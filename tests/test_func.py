@@ -1,5 +1,18 @@
+import sys
 from tinypy.runtime.testing import UnitTest
 
+def down(n):
+    return down(n + 1)
+
+def fail(n):
+    if n == 0:
+        raise "fail"
+    return fail(n - 1)
+
+class Failing:
+    def __init__(self):
+        fail(3)
+
 class FuncTest(UnitTest):
 
     def test_attrs(self):
@@ -10,11 +23,61 @@ class FuncTest(UnitTest):
         assert func.__varargs__ == 'args'
         assert func.__varkw__ == 'kwargs'
 
+    def test_recursion_limit(self):
+        try:
+            down(0)
+            assert False
+        except:
+            exc, stack = sys.get_exc()
+            assert "RuntimeError" in exc
+
+    def test_raise_unwinds_frames(self):
+        i = 0
+        # the registers of the unwound frames are given back every time.
+        while i < 100:
+            try:
+                fail(10)
+            except:
+                assert sys.get_exc()[0] == "fail"
+            i = i + 1
+
+    def test_raise_through_native_call(self):
+        i = 0
+        # __init__ is called from C; the handler is in this frame.
+        while i < 3:
+            try:
+                Failing()
+                assert False
+            except:
+                assert sys.get_exc()[0] == "fail"
+            i = i + 1
+
     def test_pos(self):
         def func(a, b):
             return a, b
         assert func(1, 2) == (1, 2)
 
+    def test_pos_method(self):
+        class C:
+            def __init__(self, a):
+                self.a = a
+            def get(self, b, c=9):
+                return self.a, b, c
+        o = C(1)
+        assert o.get(2) == (1, 2, 9)
+        assert o.get(2, 3) == (1, 2, 3)
+        f = o.get
+        assert f(4) == (1, 4, 9)
+
+    def test_pos_too_few(self):
+        def func(a, b):
+            return a, b
+        try:
+            func(1)
+            assert False
+        except:
+            pass
+
     def test_pos_args(self):
         def func(a, b, *c):
             return a, b, c
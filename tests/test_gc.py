@@ -0,0 +1,75 @@
+import sys
+from tinypy.runtime.testing import UnitTest
+
+# young objects stored in old ones must outlive the minor cycles that
+# follow; see tinypy/tp_gc.c.
+
+def churn():
+    # allocate garbage until a minor cycle has run, then reuse what it
+    # freed.
+    n = sys.conf.gcminor
+    i = 0
+    while sys.conf.gcminor == n:
+        x = str(i) + "x"
+        i = i + 1
+    x = [fresh(-1) for i in range(100)]
+
+def fresh(i):
+    return [str(i) + "!"]
+
+def greeter():
+    class B:
+        def hello(self):
+            return "hi"
+    return B
+
+class Slow:
+    def __init__(self, n):
+        # self is young, and tpy_object_new is below.
+        churn()
+        self.items = fresh(n)
+
+class MyTest(UnitTest):
+    def test_minor_cycles(self):
+        minor = sys.conf.gcminor
+        for i in range(3):
+            churn()
+        assert sys.conf.gcminor >= minor + 3
+
+    def test_list_store_into_old(self):
+        old = [None, None]
+        churn()
+        old[0] = fresh(1)
+        old.append(fresh(2))
+        churn()
+        assert old[0][0] == "1!"
+        assert old[2][0] == "2!"
+
+    def test_dict_store_into_old(self):
+        old = {}
+        churn()
+        old["a"] = fresh(1)
+        old[str(5) + "k"] = fresh(2)
+        churn()
+        assert old["a"][0] == "1!"
+        assert old["5k"][0] == "2!"
+
+    def test_attr_and_meta_of_old(self):
+        class A:
+            pass
+        a = A()
+        churn()
+        a.x = fresh(3)
+        setmeta(a, greeter())
+        churn()
+        assert a.x[0] == "3!"
+        assert a.hello() == "hi"
+
+    def test_minor_in_init(self):
+        s = Slow(7)
+        churn()
+        assert s.items[0] == "7!"
+
+t = MyTest()
+
+t.run()
@@ -1,6 +1,17 @@
 from tinypy.runtime.testing import UnitTest
 
 foo = 3
+
+def get_foo():
+    return foo
+
+def get_len():
+    return len
+
+def set_len(v):
+    global len
+    len = v
+
 class MyTest(UnitTest):
     def setup(self, testname):
         print('setup', testname)
@@ -12,6 +23,23 @@ class MyTest(UnitTest):
         assert 'foo' in globals()
         assert 'bar' not in globals()
 
+    def test_rebind(self):
+        global foo
+        i = 0
+        # the same GGET sees every new binding.
+        while i < 3:
+            foo = i
+            assert get_foo() == i
+            i = i + 1
+        foo = 3
+
+    def test_shadow_builtin(self):
+        l = get_len()
+        set_len(5)
+        assert get_len() == 5
+        del globals()['len']
+        assert get_len() == l
+
 t = MyTest()
 
 t.run()
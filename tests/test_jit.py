@@ -0,0 +1,125 @@
+import sys
+from tinypy.runtime.testing import UnitTest
+
+# code shapes the templates of the JIT handle; make test-jit runs every
+# test with every body compiled. See tp_jit.c.
+
+def count(n):
+    i = 0
+    s = 0
+    while i < n:
+        s = s + i
+        i = i + 1
+    return s
+
+def mixed(xs):
+    # ints inline, the rest through the helpers.
+    t = 0
+    for x in xs:
+        t = t + x * 2 - 1
+    return t
+
+def compare(a, b):
+    r = []
+    if a < b: r.append("lt")
+    if a <= b: r.append("le")
+    if a > b: r.append("gt")
+    if a >= b: r.append("ge")
+    if a == b: r.append("eq")
+    if a != b: r.append("ne")
+    return r
+
+def catch(xs):
+    # a handler in the middle of a loop.
+    d = {1: 10, 2: 5}
+    n = 0
+    for x in xs:
+        try:
+            n = n + d[x]
+        except:
+            n = n + 1000
+    return n
+
+def fail(d, k):
+    return d[k] + 1
+
+def calls(n):
+    t = 0
+    for i in range(n):
+        t = t + count(i)
+    return t
+
+def word(i, a, b, c):
+    return chr(i) + chr(a) + chr(b) + chr(c)
+
+class MyTest(UnitTest):
+    def test_loop(self):
+        assert count(0) == 0
+        assert count(1000) == 499500
+        assert count(10) == 45
+
+    def test_types(self):
+        assert mixed([1, 2, 3]) == 9
+        assert mixed([0.5, 1.5]) == 2.0
+        assert mixed([1, 0.5]) == 1.0
+        assert mixed([]) == 0
+
+    def test_compare(self):
+        assert compare(1, 2) == ["lt", "le", "ne"]
+        assert compare(2, 2) == ["le", "ge", "eq"]
+        assert compare(3, 2) == ["gt", "ge", "ne"]
+        assert compare(1.5, 2) == ["lt", "le", "ne"]
+        assert compare("b", "a") == ["gt", "ge", "ne"]
+        assert compare(-1, -1) == ["le", "ge", "eq"]
+
+    def test_truth(self):
+        r = []
+        for v in [0, 1, -1, 0.0, "", "x", [], [0], None]:
+            if v:
+                r.append(1)
+            else:
+                r.append(0)
+        assert r == [0, 1, 1, 0, 0, 1, 0, 1, 0]
+
+    def test_handler(self):
+        assert catch([1, 0, 2, 0]) == 2015
+        try:
+            fail({}, "x")
+            assert False
+        except:
+            pass
+        assert fail({"x": 1}, "x") == 2
+
+    def test_calls(self):
+        assert calls(5) == 10
+
+    def test_overflow(self):
+        # ints wrap as in the VM.
+        big = 4611686018427387904
+        assert big + big < 0
+
+    def test_code_freed(self):
+        # native code goes with its code string, whose memory new code
+        # may get.
+        for i in range(300):
+            # REGS, no caches, NUMBER-free MOVE and EOF.
+            c = word(45, 3, 0, 0) + word(0, 0, 0, 0) + word(16, 1, 0, 0) + word(0, 0, 0, 0)
+            exec(c, {})
+            garbage = [str(i)] * 100
+
+    def test_branches(self):
+        # IF is the template with the most jumps; a body of nothing else.
+        c = word(45, 2, 0, 0) + word(0, 0, 0, 0)
+        for i in range(64):
+            c = c + word(22, 0, 0, 0)
+        exec(c + word(16, 1, 0, 0) + word(0, 0, 0, 0), {})
+
+    def test_compiled(self):
+        if sys.conf.jit:
+            assert sys.conf.jitted > 0
+        else:
+            assert sys.conf.jitted == 0
+
+t = MyTest()
+
+t.run()
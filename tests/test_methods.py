@@ -14,6 +14,30 @@ class MyClass:
         return k
     s = staticmethod(f)
 
+class Base:
+    def who(self):
+        return "base"
+
+class Derived(Base):
+    pass
+
+class Other:
+    def who(self):
+        return "other"
+
+def who_all(objs):
+    r = []
+    for o in objs:
+        # one site sees several classes.
+        r.append(o.who())
+    return r
+
+def other_who(self):
+    return "patched"
+
+def own_who():
+    return "own"
+
 class MyTest(UnitTest):
 
     def test_method(self):
@@ -32,6 +56,41 @@ class MyTest(UnitTest):
         assert MyClass.f(3) == 3
         assert obj.s(3) == 3
 
+    def test_polymorphic_site(self):
+        objs = [Base(), Derived(), Other(), Derived()]
+        assert who_all(objs) == ["base", "base", "other", "base"]
+        assert who_all(objs) == ["base", "base", "other", "base"]
+
+    def test_site_sees_changes(self):
+        objs = [Base(), Derived(), Other()]
+        assert who_all(objs) == ["base", "base", "other"]
+        old = Other.who
+        Other.who = other_who
+        assert who_all(objs) == ["base", "base", "patched"]
+        Other.who = old
+        # an attribute of the object itself comes first.
+        objs[0].who = own_who
+        assert who_all(objs) == ["own", "base", "other"]
+        setmeta(Derived, Other)
+        assert who_all(objs) == ["own", "other", "other"]
+        setmeta(Derived, Base)
+
+    def test_method_call_forms(self):
+        obj = MyClass()
+        # a function of the object itself gets no receiver.
+        obj.g = own_who
+        assert obj.g() == "own"
+        # neither does a static method, nor a function through the class.
+        assert obj.s(4) == 4
+        assert MyClass.b(obj, 4) == 4
+        # nor an object with __call__.
+        obj.c = MyClass()
+        assert obj.c(5) == 5
+        l = [3]
+        l.append(4)
+        assert l.index(4) == 1
+        assert ",".join(["a", "b"]) == "a,b"
+
     def test_call(self):
         obj = MyClass()
         assert obj(3) == 3
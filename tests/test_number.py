@@ -50,6 +50,34 @@ class NumberUnitTests(UnitTest):
         assert abs("3.0") == 3.0
         assert abs("-3.0") == 3.0
 
+    def test_compare(self):
+        assert 1 < 2 and 2 > 1
+        assert 1 <= 1 and 1 >= 1
+        assert 1.5 < 2.5 and 2.5 > 1.5
+        assert 1 < 1.5 and 1.5 > 1
+        assert 2 >= 2.0 and 2.0 <= 2
+        assert not (2 < 1) and not (1 > 2)
+        assert not (2.0 <= 1.0) and not (1 >= 2.0)
+
+    def test_compare_order(self):
+        def f(order, v):
+            order.append(v)
+            return v
+        order = []
+        assert f(order, 2) > f(order, 1)
+        assert f(order, 3) >= f(order, 3)
+        assert order == [2, 1, 3, 3]
+
+    def test_arith_mixed(self):
+        assert 1 + 2 == 3
+        assert 1 + 0.5 == 1.5
+        assert 0.5 * 4 == 2
+        assert 3 - 0.5 == 2.5
+        assert 7 / 2 == 3
+        assert 7.0 / 2 == 3.5
+        assert "a" + "b" == "ab"
+        assert [1] + [2] == [1, 2]
+
     def test_round(self):
         # these depend on the fpu flags I think.
         assert round(3.0) == 3.0
@@ -37,6 +37,14 @@ class MyTest(UnitTest):
         obj = Create.create_with_b(3)
         assert obj.b == 3
 
+    def test_missing_key(self):
+        obj = Create.create_with_a(3)
+        try:
+            obj[5]
+            assert False
+        except:
+            pass
+
 t = MyTest()
 
 t.run()
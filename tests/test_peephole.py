@@ -0,0 +1,74 @@
+from tinypy.runtime.testing import UnitTest
+
+# code shapes the peephole pass of the compiler rewrites; see peephole.py.
+
+def first_true(items):
+    for x in items:
+        if not x:
+            continue
+        return x
+    return None
+
+class MyTest(UnitTest):
+    def test_not_if(self):
+        a = 0
+        if not a:
+            a = 1
+        assert a == 1
+        while not a:
+            a = 2
+        assert a == 1
+
+    def test_not_value_kept(self):
+        a = 0
+        b = (not a) and 5
+        assert b == 5
+        c = (not b) or 7
+        assert c == 7
+        d = not a
+        if d:
+            d = d + 1
+        assert d == 2
+
+    def test_move_into_local(self):
+        a = 2
+        b = a * 3
+        a = a + b
+        assert a == 8
+        assert b == 6
+
+    def test_handler_sees_locals(self):
+        x = 1
+        try:
+            x = x + 1
+            raise "oops"
+        except:
+            x = x * 10
+        assert x == 20
+
+    def test_jumps(self):
+        n = 0
+        for i in range(5):
+            for j in range(5):
+                if j == 2:
+                    break
+                n = n + 1
+            if i == 3:
+                continue
+        assert n == 10
+        assert first_true([0, 0, 3, 4]) == 3
+        assert first_true([0]) is None
+
+    def test_dead_code(self):
+        def f(x):
+            if x:
+                return 1
+            else:
+                return 2
+            return 3
+        assert f(1) == 1
+        assert f(0) == 2
+
+t = MyTest()
+
+t.run()
@@ -0,0 +1,109 @@
+import sys
+from tinypy.runtime.testing import UnitTest
+
+# GET, ADD and ITER are rewritten for the types they see; see tp_quicken.c.
+# tp_step does the rewriting, so the counts are of code it runs, not of
+# native code.
+sys.conf.jit = 0
+
+def add(a, b):
+    return a + b
+
+def get(o, k):
+    return o[k]
+
+def total(xs):
+    t = 0
+    for x in xs:
+        t = t + x
+    return t
+
+def sites(op):
+    # the sites rewritten to op and those that failed its guard so far.
+    for line in sys.quicken().split("\n"):
+        words = []
+        for w in line.split(" "):
+            if w != "":
+                words.append(w)
+        if len(words) == 3 and words[0] == op:
+            return [int(words[1]), int(words[2])]
+    return [0, 0]
+
+class Counter:
+    def __init__(self):
+        self.n = 1
+    def inc(self):
+        return self.n + 1
+
+class MyTest(UnitTest):
+    def test_guard_fails(self):
+        before = sites("ADD_INT")
+        assert add(1, 2) == 3
+        assert add(3, 4) == 7
+        after = sites("ADD_INT")
+        assert after[0] == before[0] + 1
+        # the site takes anything once its guard fails.
+        assert add(1.5, 1) == 2.5
+        assert add("a", "b") == "ab"
+        assert add(1, 2) == 3
+        assert sites("ADD_INT")[1] == before[1] + 1
+
+    def test_floats(self):
+        def f(a, b):
+            return a + b
+        assert f(0.5, 0.25) == 0.75
+        assert f(1, 2) == 3
+
+    def test_get(self):
+        xs = [1, 2, 3]
+        assert get(xs, 0) == 1
+        assert get(xs, -1) == 3
+        try:
+            get(xs, 3)
+            assert False
+        except:
+            pass
+        try:
+            get(xs, -4)
+            assert False
+        except:
+            pass
+        assert get({"a": 1}, "a") == 1
+        assert get("abc", 1) == "b"
+        assert get(xs, 1) == 2
+
+    def test_get_dict(self):
+        def f(d, k):
+            return d[k]
+        c = Counter()
+        assert f({1: 2}, 1) == 2
+        try:
+            f({1: 2}, 3)
+            assert False
+        except:
+            pass
+        # a miss on an object still finds the method.
+        assert f(c, "inc")() == 2
+        assert f(c, "n") == 1
+
+    def test_iter(self):
+        assert total([1, 2, 3]) == 6
+        assert total([]) == 0
+        assert total(range(4)) == 6
+        assert total([4]) == 4
+        assert total("") == 0
+
+    def test_off(self):
+        sys.conf.quicken = 0
+        assert sys.conf.quicken == 0
+        def f(a, b):
+            return a + b
+        before = sites("ADD_ANY")
+        assert f(1, 2) == 3
+        assert f("x", "y") == "xy"
+        sys.conf.quicken = 1
+        assert sites("ADD_ANY")[0] == before[0]
+
+t = MyTest()
+
+t.run()
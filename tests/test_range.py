@@ -0,0 +1,85 @@
+import sys
+from tinypy.runtime.testing import UnitTest
+
+def count(n):
+    before = sys.conf.gctracked
+    s = 0
+    for i in range(n):
+        s = s + i
+    return sys.conf.gctracked - before
+
+def not_range(n):
+    return ["x"]
+
+class MyTest(UnitTest):
+
+    def test_len(self):
+        assert len(range(4)) == 4
+        assert len(range(-4)) == 0
+        assert len(range(0, 5, 3)) == 2
+        assert len(range(5, 0, -3)) == 2
+        assert len(range(-4, -8, -1)) == 4
+        assert len(range(1, 2, 0)) == 0
+
+    def test_get(self):
+        assert range(4)[0] == 0
+        assert range(4)[-1] == 3
+        assert range(5, 0, -3)[1] == 2
+        assert range(-8, -4)[-1] == -5
+        assert range(10)[2:5] == [2, 3, 4]
+
+    def test_in(self):
+        assert 3 in range(0, 10, 3)
+        assert 4 not in range(0, 10, 3)
+        assert 10 not in range(10)
+
+    def test_compare(self):
+        assert [range(3)] <= [range(3)]
+        try:
+            range(3) < range(4)
+            assert False
+        except:
+            exc, stack = sys.get_exc()
+            assert "TypeError" in exc
+
+    def test_unpack(self):
+        a, b, c = range(3)
+        assert (a, b, c) == (0, 1, 2)
+
+    def test_iter(self):
+        r = range(10, 0, -3)
+        l = []
+        for i in r:
+            l.append(i)
+        assert l == [10, 7, 4, 1]
+        assert [i for i in range(3)] == [0, 1, 2]
+
+    def test_for_range(self):
+        l = []
+        for i in range(3):
+            for j in range(0, 10, 4):
+                if j == 4:
+                    continue
+                l.append(i * 10 + j)
+            if i == 1:
+                break
+        assert l == [0, 8, 10, 18]
+
+    def test_for_range_rebound(self):
+        global range
+        old = range
+        range = not_range
+        l = []
+        for i in range(3):
+            l.append(i)
+        range = old
+        assert l == ["x"]
+
+    def test_for_range_does_not_allocate(self):
+        # the first call decodes the literals into the constant pool.
+        count(1)
+        assert count(10) == count(1000)
+
+t = MyTest()
+
+t.run()
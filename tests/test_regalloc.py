@@ -0,0 +1,108 @@
+from tinypy.runtime.testing import UnitTest
+
+# code shapes the register allocator of the compiler renumbers; see
+# regalloc.py.
+
+def chain(n):
+    # locals that are never live together share a register, so the frame
+    # is small enough for this to recurse 200 deep in the VM stack.
+    if n == 0:
+        return 0
+    a = n + 1
+    b = a * 2
+    c = b - a
+    d = c + 1
+    e = d - 1
+    f = e * 1
+    g = f + 0
+    h = g - n
+    i = h + 1
+    j = i - 1
+    k = j * 3
+    l = k / 3
+    m = l + 0
+    o = m - 0
+    p = o * 1
+    q = p + 0
+    r = q - 0
+    s = r + 0
+    return s + chain(n - 1)
+
+def args(x, y, z=3, w=4):
+    # parameters stay where the call put them, read or not.
+    t = x + y
+    return t + z
+
+class Point:
+    def __init__(self, x, y):
+        self.x = x
+        self.y = y
+    def add(self, other):
+        return Point(self.x + other.x, self.y + other.y)
+
+class Scale:
+    def __init__(self, k):
+        self.k = k
+    def by(self, x):
+        return x * self.k
+
+def twice():
+    # g is where the calls find their callee, and the calls leave it there.
+    o = Scale(10)
+    g = o.by
+    a = g(1)
+    b = g(2)
+    return [a, b]
+
+class MyTest(UnitTest):
+    def test_deep_recursion(self):
+        assert chain(200) == 200
+
+    def test_params(self):
+        assert args(1, 2) == 6
+        assert args(1, 2, 4, 5) == 7
+        assert args(y=1, x=2) == 6
+
+    def test_loops(self):
+        n = 0
+        for i in range(3):
+            for j in [1, 2]:
+                k = i * j
+                n = n + k
+        assert n == 9
+        for x in range(2):
+            pass
+        assert x == 1
+
+    def test_method_calls(self):
+        p = Point(1, 2).add(Point(3, 4))
+        q = p.add(p)
+        assert q.x == 8
+        assert q.y == 12
+
+    def test_bound_method_in_a_local(self):
+        assert twice() == [10, 20]
+
+    def test_handler_sees_locals(self):
+        a = 1
+        b = 2
+        try:
+            a = a + b
+            c = a * 10
+            raise "oops"
+        except:
+            b = a + c
+        assert a == 3
+        assert b == 33
+
+    def test_nested_def(self):
+        base = 10
+        def add(v, w=base):
+            return v + w
+        base = 20
+        assert add(1) == 11
+        assert add(1, base) == 21
+
+t = MyTest()
+
+t.run()
@@ -0,0 +1,42 @@
+import sys
+from tinypy.runtime.testing import UnitTest
+
+# object headers come from the slab; see tinypy/tp_slab.c. Under the
+# sandbox and AddressSanitizer they do not, and the counts stay 0.
+
+def churn(n):
+    # run n minor cycles over garbage of a few sizes.
+    minor = sys.conf.gcminor + n
+    i = 0
+    while sys.conf.gcminor < minor:
+        x = [str(i), {}]
+        i = i + 1
+
+class MyTest(UnitTest):
+    def test_table(self):
+        s = sys.slab()
+        for k in ["pages", "empty", "bytes", "allocs", "frees", "live"]:
+            assert k in s
+        assert s["allocs"] >= s["frees"]
+
+    def test_blocks_are_reused(self):
+        churn(1)
+        before = sys.slab()
+        churn(10)
+        after = sys.slab()
+        if before["allocs"] == 0:
+            return
+        assert after["frees"] > before["frees"]
+        # what a cycle frees, the next one allocates again.
+        assert after["pages"] <= before["pages"] + 4
+
+    def test_madvise(self):
+        old = sys.conf.slabmadvise
+        sys.conf.slabmadvise = 1
+        churn(2)
+        assert sys.conf.slabmadvise == 1
+        sys.conf.slabmadvise = old
+
+t = MyTest()
+
+t.run()
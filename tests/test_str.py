@@ -56,6 +56,17 @@ class StringUnitTests(UnitTest):
     def test_join(self):
         j = ' '.join(['abc', 'def'])
         assert j == 'abc def'
+        assert ','.join([1, 'b', None]) == '1,b,None'
+        assert ''.join([]) == ''
+
+    def test_long(self):
+        # past the stack buffer of str() and join, and past the slab.
+        a = 'x' * 300
+        assert len(str(a)) == 300
+        j = '-'.join([a, a])
+        assert len(j) == 601
+        assert j[300] == '-'
+        assert len(repr([a])) == 304
 
     def test_slice(self):
         assert '0123'[1, 2] == '1'
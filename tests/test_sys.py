@@ -12,16 +12,90 @@ class MyTest(UnitTest):
             exc, stack = sys.get_exc()
             assert exc == "Hello"
             assert "test_str_exc" in stack
+            assert 'raise "Hello"' in stack
 
     def test_sys_argv(self):
         assert len(sys.argv) > 0
 
     def test_sys_conf(self):
-        assert sys.conf.gcmax >= 0
-        old = sys.conf.gcmax
-        sys.conf.gcmax = 16383
-        assert sys.conf.gcmax == 16383
-        sys.conf.gcmax = old
+        assert sys.conf.gcgrowth >= 1
+        old = sys.conf.gcgrowth
+        sys.conf.gcgrowth = 3
+        assert sys.conf.gcgrowth == 3.0
+        sys.conf.gcgrowth = old
+
+    def test_sys_conf_bad_gcgrowth(self):
+        try:
+            sys.conf.gcgrowth = 0.5
+            assert False
+        except:
+            exc, stack = sys.get_exc()
+            assert "ValueError" in exc
+
+    def test_literals_do_not_allocate(self):
+        def loop(n):
+            before = sys.conf.gctracked
+            i = 0
+            while i < n:
+                x = 1.5
+                s = "abc"
+                i = i + 1
+            return sys.conf.gctracked - before
+        # the first call decodes the literals into the constant pool.
+        loop(1)
+        assert loop(10) == loop(1000)
+
+    def test_profile(self):
+        def loop(n):
+            i = 0
+            while i < n:
+                i = i + 1
+            return i
+        def run(f, n):
+            # the mode takes effect at the next call or return.
+            sys.conf.profile = 1
+            f(n)
+            sys.conf.profile = 0
+            return 0
+        run(loop, 100)
+        assert sys.conf.profile == 0
+        table = sys.profile()
+        assert "JUMP" in table
+        assert "pair" in table
+        # functions run from the code of their module.
+        most = 0
+        for n in sys.profile(__code__):
+            if n > most:
+                most = n
+        assert most >= 100
+
+    def test_sample(self):
+        def spin(n):
+            i = 0
+            while i < n:
+                i = i + 1
+            return i
+        # the timer ticks in cpu time, as coarsely as the kernel does;
+        # spin longer until it has ticked.
+        text = ""
+        n = 10000
+        while text == "" and n < 100000000:
+            sys.sample_start(0.5)
+            spin(n)
+            text = sys.sample_stop()
+            n = n * 2
+        assert "test_sample (tests/test_sys.py);spin (tests/test_sys.py) " in text
+        for line in text.split("\n"):
+            if line != "":
+                assert int(line.split(" ")[-1]) > 0
+
+    def test_sample_bad_interval(self):
+        try:
+            sys.sample_start(0)
+            assert False
+        except:
+            exc, stack = sys.get_exc()
+            assert "ValueError" in exc
 
 t = MyTest()
 
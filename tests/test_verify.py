@@ -0,0 +1,74 @@
+import sys
+from tinypy.runtime.testing import UnitTest
+
+# exec runs code only after tp_verify has passed it.
+
+REGS = 45
+MOVE = 16
+JUMP = 19
+ADD_INT = 63
+NUMBER = 12
+LINE = 31
+EOF = 0
+
+def word(i, a, b, c):
+    return chr(i) + chr(a) + chr(b) + chr(c)
+
+def code(body, cregs):
+    # the preamble: REGS and the number of caches, none.
+    return word(REGS, cregs, 0, 0) + word(0, 0, 0, 0) + body + word(EOF, 0, 0, 0)
+
+def rejected(c):
+    try:
+        exec(c, {})
+    except:
+        exc, stack = sys.get_exc()
+        return exc
+    return None
+
+class MyTest(UnitTest):
+    def test_good_code(self):
+        assert rejected(code(word(MOVE, 2, 1, 0), 3)) is None
+        # run twice; the second time it is already verified.
+        c = code(word(MOVE, 1, 0, 0), 2)
+        assert rejected(c) is None
+        assert rejected(c) is None
+
+    def test_register_out_of_range(self):
+        exc = rejected(code(word(MOVE, 3, 0, 0), 3))
+        assert "register out of range" in exc
+        exc = rejected(code(word(MOVE, 0, 200, 0), 3))
+        assert "register out of range" in exc
+        # rewritten instructions are checked as what they were.
+        exc = rejected(code(word(ADD_INT, 0, 1, 5), 3))
+        assert "register out of range" in exc
+
+    def test_too_few_registers(self):
+        assert "too few registers" in rejected(code("", 1))
+
+    def test_bad_jump(self):
+        exc = rejected(code(word(JUMP, 0, 0, 40), 2))
+        assert "jump out of the code" in exc
+
+    def test_bad_number(self):
+        # one constant slot; the header word has the format and the size.
+        def number(f, n):
+            return word(REGS, 2, 0, 1) + word(0, 0, 0, 0) + word(NUMBER, 0, 0, 0) \
+                + word(0, 0, ord(f), n) + "\0\0\0\0\0\0\0\0" + word(EOF, 0, 0, 0)
+        assert rejected(number("q", 8)) is None
+        assert "bad number" in rejected(number("x", 8))
+        assert "bad number" in rejected(number("i", 8))
+
+    def test_bad_line(self):
+        assert rejected(code(word(LINE, 1, 0, 1) + "x=1\0", 2)) is None
+        assert "bad line" in rejected(code(word(LINE, 1, 0, 1) + "x=12", 2))
+        assert "bad line" in rejected(code(word(LINE, 1, 0, 1) + ";x\0\0", 2))
+        assert "bad line" in rejected(code(word(LINE, 0, 0, 1), 2))
+
+    def test_truncated(self):
+        assert "bad code length" in rejected(code("", 2) + "x")
+        assert "no EOF" in rejected(word(REGS, 2, 0, 0) + word(0, 0, 0, 0) + word(MOVE, 0, 1, 0))
+
+t = MyTest()
+
+t.run()
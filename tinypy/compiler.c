@@ -1,17 +1,22 @@
 #include "tp.h"
 
 #include "compiler/boot.c"
+#include "compiler/peephole.c"
+#include "compiler/regalloc.c"
 #include "compiler/encode.c"
 #include "compiler/opcodes.c"
 #include "compiler/parse.c"
 #include "compiler/tokenize.c"
 #include "compiler/py2bc.c"
 
+/* compiled to C with tpc -a, see tp_aot.c. */
 void tp_module_compiler_init(TP) {
-    tp_import_from_buffer(tp, 0, "tinypy.compiler.boot", _tp_boot_tpc,  sizeof(_tp_boot_tpc));
-    tp_import_from_buffer(tp, 0, "tinypy.compiler.opcodes", _tp_opcodes_tpc,  sizeof(_tp_opcodes_tpc));
-    tp_import_from_buffer(tp, 0, "tinypy.compiler.tokenize", _tp_tokenize_tpc,  sizeof(_tp_tokenize_tpc));
-    tp_import_from_buffer(tp, 0, "tinypy.compiler.parse", _tp_parse_tpc, sizeof(_tp_parse_tpc));
-    tp_import_from_buffer(tp, 0, "tinypy.compiler.encode", _tp_encode_tpc, sizeof(_tp_encode_tpc));
-    tp_import_from_buffer(tp, 0, "tinypy.compiler.py2bc", _tp_py2bc_tpc, sizeof(_tp_py2bc_tpc));
+    tinypy_compiler_boot_init(tp);
+    tinypy_compiler_opcodes_init(tp);
+    tinypy_compiler_tokenize_init(tp);
+    tinypy_compiler_parse_init(tp);
+    tinypy_compiler_peephole_init(tp);
+    tinypy_compiler_regalloc_init(tp);
+    tinypy_compiler_encode_init(tp);
+    tinypy_compiler_py2bc_init(tp);
 }
@@ -1,7 +1,10 @@
 from tinypy.compiler import py2bc
 from tinypy.compiler.boot import *
 from tinypy.compiler import disasm
+from tinypy.compiler import aot
 from tinypy.compiler import opcodes
+from tinypy.compiler import peephole
+from tinypy.compiler import regalloc
 
 def do_shorts(opts, optstring, shortopts, args):
     while optstring != '':
@@ -50,7 +53,7 @@ def main(args=None):
     posargs = []
     options = {} 
 
-    opts, args = getopt(args[1:], 'cn:o:dx')
+    opts, args = getopt(args[1:], 'can:o:dxp:Ps')
     opts = dict(opts)
     if len(args) == 1:
         src = args[0]
@@ -58,13 +61,13 @@ def main(args=None):
     elif '-x' in opts and len(args) == 0:
         out = do_opcodes(opts)
     else:
-        print('Usage tinypyc [-c] [-n variable] [-o output_file_name] [-d] src.py')
+        print('Usage tinypyc [-c | -a] [-n name] [-o output_file_name] [-d [-p sites]] [-P] [-s] src.py')
         return 
 
     if '-o' in opts:
         dest = opts['-o']
     else:
-        if '-c' in opts:
+        if '-c' in opts or '-a' in opts:
             dest = basename(src, False) + '.c'
         else:
             dest = basename(src, False) + '.tpc'
@@ -79,9 +82,29 @@ def do_opcodes(opts):
 
 def do_compile(src, opts):
     s = read(src)
-    data = py2bc.compile(s, src)
+    # -P leaves out the peephole pass and the register allocator; -s tells
+    # what they saved.
+    data = py2bc.compile(s, src, '-P' not in opts)
+    if '-s' in opts:
+        st = peephole.stats
+        print('peephole: ' + str(st['before'] - st['after']) + ' of '
+            + str(st['before']) + ' instructions removed')
+        st = regalloc.stats
+        print('regalloc: ' + str(st['before']) + ' -> ' + str(st['after'])
+            + ' registers')
     if '-d' in opts:
-        out = disasm.disassemble(data).encode()
+        counts = None
+        if '-p' in opts:
+            # one count per word, as saved by tpvm with TP_PROFILE_SITES.
+            counts = []
+            for n in read(opts['-p']).split('\n'):
+                if n != '':
+                    counts.append(int(n))
+        out = disasm.disassemble(data, counts).encode()
+    elif '-a' in opts:
+        # -n is the name the module is imported as.
+        name = opts.get('-n', basename(src))
+        out = aot.compile(data, name, src).encode()
     elif '-c' in opts:
         out = []
         cols = 16
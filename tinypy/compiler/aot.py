@@ -0,0 +1,217 @@
+from tinypy.compiler.boot import *
+from tinypy.compiler import opcodes
+
+# tpc -a: a module as C. The bytecode goes in as with tpc -c, and every
+# body in it -- the module's and each function's -- becomes a C function
+# with a block per instruction; see tinypy/tp_aot.c for how the VM runs
+# them. Instructions the C does not do itself go through tp_aot_op, and
+# the calls, returns, RAISE and the EOF go back to tp_step.
+
+BINARY = {
+    opcodes.DIV: 'tp_div', opcodes.POW: 'tp_pow', opcodes.MOD: 'tp_mod',
+    opcodes.LSH: 'tp_lsh', opcodes.RSH: 'tp_rsh',
+    opcodes.BITAND: 'tp_bitwise_and', opcodes.BITOR: 'tp_bitwise_or',
+    opcodes.BITXOR: 'tp_bitwise_xor',
+}
+ARITH = {opcodes.ADD: '+', opcodes.SUB: '-', opcodes.MUL: '*'}
+COMPARE = {
+    opcodes.EQ: '==', opcodes.NE: '!=', opcodes.LT: '<',
+    opcodes.LE: '<=', opcodes.GT: '>', opcodes.GE: '>=',
+}
+HELPER = [
+    opcodes.MGET, opcodes.METHOD, opcodes.GGET, opcodes.NUMBER,
+    opcodes.STRING, opcodes.LIST, opcodes.DICT, opcodes.UPDATE,
+    opcodes.RANGE, opcodes.DEF,
+]
+
+def ord_or_int(x):
+    try:
+        return ord(x)
+    except:
+        return int(x)
+
+def word(bc, k):
+    return bc[k * 4:k * 4 + 4]
+
+def signed(v):
+    if v >= 32768:
+        return v - 65536
+    return v
+
+def size(bc, k):
+    # words of the instruction at word k, as tp_verify_size counts them.
+    i, a, b, c = word(bc, k)
+    if i == opcodes.LINE:
+        return a + 1
+    if i == opcodes.VAR:
+        return int((b * 256 + c) / 4) + 2
+    if i == opcodes.DEF:
+        return signed(b * 256 + c)
+    if i == opcodes.REGS or i == opcodes.MGET or i == opcodes.METHOD:
+        return 2
+    if i == opcodes.NUMBER:
+        return int(word(bc, k + 1)[3] / 4) + 2
+    if i == opcodes.STRING or i == opcodes.GGET:
+        h = word(bc, k + 1)
+        return int((h[2] * 256 + h[3]) / 4) + 3
+    return 1
+
+def reg(r):
+    return 'regs[' + str(r) + ']'
+
+def goto(r):
+    return 'goto L' + str(r) + ';'
+
+def truth(r):
+    v = reg(r)
+    return 'TP_IS_INT(' + v + ') ? ' + v + '.nint != 0 : tp_true(tp, ' + v + ')'
+
+def block(bc, k, r):
+    # the C of the instruction at word k, word r of its body.
+    i, a, b, c = word(bc, k)
+    A, B, C = reg(a), reg(b), reg(c)
+    here = 'code + ' + str(r)
+    if i in ARITH or i in COMPARE:
+        # ints inline, the rest as tp_step does them.
+        if i in ARITH:
+            v = 'tp_int(' + B + '.nint ' + ARITH[i] + ' ' + C + '.nint)'
+        else:
+            v = 'tp_bool(' + B + '.nint ' + COMPARE[i] + ' ' + C + '.nint)'
+        return ['if (TP_BOTH(' + B + ', ' + C + ', TP_NUMBER_INT)) {',
+            '    ' + A + ' = ' + v + ';',
+            '} else {',
+            '    tp_aot_op(tp, f, ' + here + ');',
+            '}']
+    if i in BINARY:
+        return [A + ' = ' + BINARY[i] + '(tp, ' + B + ', ' + C + ');']
+    if i == opcodes.BITNOT:
+        return [A + ' = tp_bitwise_not(tp, ' + B + ');']
+    if i == opcodes.NOT:
+        return [A + ' = tp_bool(!tp_true(tp, ' + B + '));']
+    if i == opcodes.GET:
+        return [A + ' = tp_get(tp, ' + B + ', ' + C + ');', 'tp_grey(tp, ' + A + ');']
+    if i == opcodes.SET:
+        return ['tp_set(tp, ' + A + ', ' + B + ', ' + C + ');']
+    if i == opcodes.GSET:
+        return ['tp_set(tp, f->globals, ' + A + ', ' + B + ');']
+    if i == opcodes.IN:
+        return [A + ' = tp_has(tp, ' + C + ', ' + B + ');']
+    if i == opcodes.NOTIN:
+        return [A + ' = tp_bool(!tp_true(tp, tp_has(tp, ' + C + ', ' + B + ')));']
+    if i == opcodes.IGET:
+        return ['tp_iget(tp, &' + A + ', ' + B + ', ' + C + ');']
+    if i == opcodes.DEL:
+        return ['tp_del(tp, ' + A + ', ' + B + ');']
+    if i == opcodes.LEN:
+        return [A + ' = tp_len(tp, ' + B + ');']
+    if i == opcodes.ASSERT:
+        return ['tp_assert(tp, ' + A + ', ' + B + ', ' + C + ');']
+    if i == opcodes.CLASS:
+        return [A + ' = tp_class(tp);']
+    if i == opcodes.MOVE:
+        return [A + ' = ' + B + ';']
+    if i == opcodes.NONE:
+        return [A + ' = tp_None;']
+    if i == opcodes.FILE:
+        return ['f->fname = ' + A + ';']
+    if i == opcodes.NAME:
+        return ['f->name = ' + A + ';']
+    if i == opcodes.PASS or i == opcodes.VAR:
+        return []
+    if i == opcodes.LINE:
+        return ['f->line = ' + here + ';', 'f->lineno = ' + str(b * 256 + c) + ';']
+    if i == opcodes.SETJMP:
+        if b * 256 + c == 0:
+            return ['f->jmp = 0;']
+        return ['f->jmp = code + ' + str(r + signed(b * 256 + c)) + ';']
+    if i == opcodes.JUMP:
+        n = signed(b * 256 + c)
+        if n < 0:
+            # a back-edge is a safepoint.
+            return ['tp_aot_safepoint(tp, ' + str(-n) + ');', goto(r + n)]
+        return [goto(r + n)]
+    if i == opcodes.IF:
+        # skip the next instruction if a is true (IF) or false (IFN).
+        return ['if (' + truth(a) + ') {', '    ' + goto(r + 2), '}']
+    if i == opcodes.IFN:
+        return ['if (!(' + truth(a) + ')) {', '    ' + goto(r + 2), '}']
+    if i == opcodes.ITER:
+        return ['if (tp_iter_next(tp, &' + A + ', ' + B + ', &' + C + ')) {',
+            '    ' + goto(r + 2), '}']
+    if i == opcodes.FOR:
+        # b, b + 1, b + 2: a counter -- next, stop, step -- or an iterator.
+        s0, s1, s2 = reg(b), reg(b + 1), reg(b + 2)
+        return ['if (' + s1 + '.type.typeid == TP_NUMBER) {',
+            '    if (' + s2 + '.nint > 0 ? ' + s0 + '.nint < ' + s1 + '.nint : '
+                + s0 + '.nint > ' + s1 + '.nint) {',
+            '        ' + A + ' = ' + s0 + ';',
+            '        ' + s0 + '.nint += ' + s2 + '.nint;',
+            '        ' + goto(r + 2),
+            '    }',
+            '} else if (tp_iter_next(tp, &' + A + ', ' + s0 + ', &' + s2 + ')) {',
+            '    ' + goto(r + 2),
+            '}']
+    if i in HELPER:
+        return ['tp_aot_op(tp, f, ' + here + ');']
+    # CALL, CALLP, CALLM, RETURN, RAISE and EOF: back to tp_step.
+    return ['return ' + here + ';']
+
+def body(bc, prefix, start, end, nested):
+    # the C function of the body [start, end); appends the starts of the
+    # bodies of the functions it defines to nested.
+    labels = []
+    cases = []
+    k = start + 2
+    while k < end:
+        i = word(bc, k)[0]
+        r = k - start
+        cases.append('        case ' + str(r) + ': ' + goto(r))
+        labels.append('L' + str(r) + ': /* ' + opcodes.names[i] + ' */')
+        for line in block(bc, k, r):
+            labels.append('    ' + line)
+        if i == opcodes.DEF:
+            nested.append([k + 1, k + size(bc, k)])
+        k += size(bc, k)
+    out = ['static tpd_code * ' + prefix + '_' + str(start)
+        + '(TP, tpd_frame * f, tpd_code * cur) {',
+        '    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);']
+    # a body of only calls and returns reads no register.
+    for line in labels:
+        if 'regs[' in line:
+            out.append('    tp_obj * regs = f->regs;')
+            break
+    out.append('    switch (cur - code) {')
+    out = out + cases + ['    }', '    return cur;'] + labels + ['}', '']
+    return out
+
+def compile(data, name, src):
+    bc = [ord_or_int(data[i:i + 1]) for i in range(len(data))]
+    ident = name.replace('.', '_')
+    prefix = '_tp_' + ident
+    out = ['/* Generated from ' + src + ' with tpc -a. Do not modify. */',
+        '#include <tinypy/tp.h>', '',
+        'static unsigned char ' + prefix + '_tpc[] = {']
+    cols = 16
+    for n in range(0, len(bc), cols):
+        out.append(','.join(['0x' + hex2(v) for v in bc[n:n + cols]]) + ',')
+    out = out + ['};', '']
+    starts = []
+    todo = [[0, int(len(bc) / 4)]]
+    while todo:
+        start, end = todo.pop(0)
+        starts.append(start)
+        out = out + body(bc, prefix, start, end, todo)
+    out.append('static const tpd_aot ' + prefix + '_aot[] = {')
+    for start in starts:
+        out.append('    {' + str(start) + ', ' + prefix + '_' + str(start) + '},')
+    out = out + ['};', '',
+        'void ' + ident + '_init(TP) {',
+        '    tp_aot_import(tp, "' + name + '", ' + prefix + '_tpc, sizeof('
+            + prefix + '_tpc),',
+        '        ' + prefix + '_aot, ' + str(len(starts)) + ');',
+        '}', '']
+    return '\n'.join(out)
+
+def hex2(v):
+    digits = '0123456789abcdef'
+    return digits[int(v / 16)] + digits[v % 16]
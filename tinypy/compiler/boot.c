@@ -0,0 +1,2208 @@
+/* Generated from tinypy/compiler/boot.py with tpc -a. Do not modify. */
+#include <tinypy/tp.h>
+
+static unsigned char _tp_tinypy_compiler_boot_tpc[] = {
+0x2d,0x12,0x00,0x21,0x00,0x00,0x00,0x04,0x1f,0x03,0x00,0x01,0x69,0x6d,0x70,0x6f,
+0x72,0x74,0x20,0x73,0x79,0x73,0x00,0x00,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x17,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x62,0x6f,0x6f,0x74,0x2e,0x70,0x79,0x00,0x22,0x00,0x00,0x00,0x0d,0x00,0x00,0x01,
+0x00,0x00,0x00,0x01,0x3f,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x0e,0x01,0x00,0x02,
+0x00,0x00,0x00,0x0a,0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,0x5f,0x5f,0x00,0x00,
+0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x73,0x79,0x73,0x00,0x1d,0x03,0x00,0x00,
+0x37,0x00,0x01,0x03,0x0d,0x01,0x00,0x03,0x00,0x00,0x00,0x03,0x73,0x79,0x73,0x00,
+0x0f,0x01,0x00,0x00,0x1f,0x08,0x00,0x03,0x69,0x66,0x20,0x6e,0x6f,0x74,0x20,0x22,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x22,0x20,0x69,0x6e,0x20,0x73,0x79,0x73,0x2e,0x76,
+0x65,0x72,0x73,0x69,0x6f,0x6e,0x3a,0x00,0x0d,0x01,0x00,0x04,0x00,0x00,0x00,0x06,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x00,0x00,0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x03,
+0x73,0x79,0x73,0x00,0x0d,0x03,0x00,0x05,0x00,0x00,0x00,0x07,0x76,0x65,0x72,0x73,
+0x69,0x6f,0x6e,0x00,0x09,0x02,0x02,0x03,0x00,0x00,0x00,0x00,0x25,0x01,0x01,0x02,
+0x30,0x00,0x01,0x00,0x16,0x00,0x00,0x00,0x13,0x00,0x05,0x2d,0x1f,0x05,0x00,0x04,
+0x20,0x20,0x20,0x20,0x69,0x6d,0x70,0x6f,0x72,0x74,0x20,0x73,0x74,0x72,0x75,0x63,
+0x74,0x00,0x00,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x0a,0x5f,0x5f,0x69,0x6d,
+0x70,0x6f,0x72,0x74,0x5f,0x5f,0x00,0x00,0x0d,0x02,0x00,0x06,0x00,0x00,0x00,0x06,
+0x73,0x74,0x72,0x75,0x63,0x74,0x00,0x00,0x1d,0x03,0x00,0x00,0x37,0x00,0x01,0x03,
+0x0d,0x01,0x00,0x06,0x00,0x00,0x00,0x06,0x73,0x74,0x72,0x75,0x63,0x74,0x00,0x00,
+0x0f,0x01,0x00,0x00,0x1f,0x05,0x00,0x05,0x20,0x20,0x20,0x20,0x5f,0x62,0x79,0x74,
+0x65,0x73,0x20,0x3d,0x20,0x62,0x79,0x74,0x65,0x73,0x00,0x00,0x0d,0x00,0x00,0x07,
+0x00,0x00,0x00,0x06,0x5f,0x62,0x79,0x74,0x65,0x73,0x00,0x00,0x0e,0x01,0x00,0x08,
+0x00,0x00,0x00,0x05,0x62,0x79,0x74,0x65,0x73,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,
+0x1f,0x05,0x00,0x07,0x20,0x20,0x20,0x20,0x41,0x52,0x47,0x56,0x20,0x3d,0x20,0x73,
+0x79,0x73,0x2e,0x61,0x72,0x67,0x76,0x00,0x0d,0x00,0x00,0x09,0x00,0x00,0x00,0x04,
+0x41,0x52,0x47,0x56,0x00,0x00,0x00,0x00,0x0e,0x01,0x00,0x03,0x00,0x00,0x00,0x03,
+0x73,0x79,0x73,0x00,0x0d,0x02,0x00,0x0a,0x00,0x00,0x00,0x04,0x61,0x72,0x67,0x76,
+0x00,0x00,0x00,0x00,0x09,0x01,0x01,0x02,0x00,0x00,0x00,0x01,0x0f,0x00,0x01,0x00,
+0x1f,0x05,0x00,0x09,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x6a,0x6f,0x69,0x6e,
+0x28,0x76,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x04,0x2a,0x24,0x32,0x31,
+0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x0b,0x00,0x00,0x00,0x01,0x76,0x00,0x00,0x00,
+0x1c,0x01,0x05,0x01,0x1c,0x02,0x00,0x00,0x1d,0x03,0x00,0x00,0x1d,0x04,0x00,0x00,
+0x11,0x00,0x00,0x67,0x2d,0x07,0x00,0x07,0x00,0x00,0x00,0x01,0x1f,0x05,0x00,0x09,
+0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x6a,0x6f,0x69,0x6e,0x28,0x76,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x76,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x17,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x62,0x6f,0x6f,0x74,0x2e,0x70,0x79,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x04,0x6a,0x6f,0x69,0x6e,0x00,0x00,0x00,0x00,
+0x23,0x01,0x00,0x00,0x1f,0x05,0x00,0x0b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6f,0x75,0x74,0x20,0x3d,0x20,0x62,0x27,0x27,0x00,0x00,0x00,0x33,0x01,0x00,0x03,
+0x6f,0x75,0x74,0x00,0x0d,0x02,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x10,0x01,0x02,0x00,0x1f,0x06,0x00,0x0c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x66,0x6f,0x72,0x20,0x65,0x6c,0x20,0x69,0x6e,0x20,0x76,0x3a,0x00,0x00,0x00,0x00,
+0x0c,0x03,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x02,0x00,0x03,
+0x13,0x00,0x00,0x2f,0x33,0x02,0x00,0x02,0x65,0x6c,0x00,0x00,0x1f,0x0b,0x00,0x0e,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,
+0x6f,0x74,0x20,0x69,0x73,0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x28,0x65,0x6c,
+0x2c,0x20,0x5f,0x62,0x79,0x74,0x65,0x73,0x29,0x3a,0x00,0x00,0x0e,0x04,0x00,0x04,
+0x00,0x00,0x00,0x0a,0x69,0x73,0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x00,0x00,
+0x10,0x05,0x02,0x00,0x0e,0x06,0x00,0x05,0x00,0x00,0x00,0x06,0x5f,0x62,0x79,0x74,
+0x65,0x73,0x00,0x00,0x37,0x04,0x04,0x03,0x2f,0x04,0x00,0x00,0x13,0x00,0x00,0x0a,
+0x1f,0x06,0x00,0x0f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x00,0x1d,0x02,0x00,0x00,
+0x26,0x02,0x00,0x00,0x1f,0x06,0x00,0x11,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x20,0x2b,0x3d,0x20,0x65,0x6c,0x00,0x00,0x00,
+0x01,0x02,0x01,0x02,0x10,0x01,0x02,0x00,0x13,0x00,0xff,0xd1,0x1f,0x05,0x00,0x12,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,
+0x75,0x74,0x00,0x00,0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x0c,
+0x00,0x00,0x00,0x04,0x6a,0x6f,0x69,0x6e,0x00,0x00,0x00,0x00,0x0f,0x01,0x00,0x00,
+0x1f,0x05,0x00,0x14,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x6d,0x65,0x72,0x67,
+0x65,0x28,0x61,0x2c,0x62,0x29,0x3a,0x00,0x33,0x01,0x00,0x04,0x2a,0x24,0x32,0x38,
+0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x0d,0x00,0x00,0x00,0x01,0x61,0x00,0x00,0x00,
+0x0d,0x07,0x00,0x0e,0x00,0x00,0x00,0x01,0x62,0x00,0x00,0x00,0x1c,0x02,0x06,0x02,
+0x1c,0x03,0x00,0x00,0x1d,0x04,0x00,0x00,0x1d,0x05,0x00,0x00,0x11,0x01,0x00,0x62,
+0x2d,0x09,0x00,0x06,0x00,0x00,0x00,0x00,0x1f,0x05,0x00,0x14,0x20,0x20,0x20,0x20,
+0x64,0x65,0x66,0x20,0x6d,0x65,0x72,0x67,0x65,0x28,0x61,0x2c,0x62,0x29,0x3a,0x00,
+0x33,0x00,0x00,0x01,0x61,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x62,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x17,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x62,0x6f,0x6f,0x74,0x2e,0x70,0x79,0x00,
+0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x05,0x6d,0x65,0x72,0x67,
+0x65,0x00,0x00,0x00,0x23,0x02,0x00,0x00,0x1f,0x08,0x00,0x15,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,0x73,0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,
+0x65,0x28,0x61,0x2c,0x20,0x64,0x69,0x63,0x74,0x29,0x3a,0x00,0x0e,0x03,0x00,0x02,
+0x00,0x00,0x00,0x0a,0x69,0x73,0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x00,0x00,
+0x10,0x04,0x00,0x00,0x0e,0x05,0x00,0x03,0x00,0x00,0x00,0x04,0x64,0x69,0x63,0x74,
+0x00,0x00,0x00,0x00,0x37,0x02,0x03,0x03,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x16,
+0x1f,0x09,0x00,0x16,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x66,0x6f,0x72,0x20,0x6b,0x20,0x69,0x6e,0x20,0x62,0x3a,0x20,0x61,0x5b,0x6b,0x5d,
+0x20,0x3d,0x20,0x62,0x5b,0x6b,0x5d,0x00,0x0c,0x03,0x00,0x04,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x2b,0x02,0x01,0x03,0x13,0x00,0x00,0x22,0x33,0x04,0x00,0x01,
+0x6b,0x00,0x00,0x00,0x10,0x04,0x02,0x00,0x0a,0x02,0x01,0x04,0x0b,0x00,0x04,0x02,
+0x13,0x00,0xff,0xf9,0x1f,0x0b,0x00,0x18,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x6b,0x20,0x69,0x6e,0x20,0x62,0x3a,0x20,
+0x73,0x65,0x74,0x61,0x74,0x74,0x72,0x28,0x61,0x2c,0x6b,0x2c,0x62,0x5b,0x6b,0x5d,
+0x29,0x00,0x00,0x00,0x0c,0x03,0x00,0x04,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x2b,0x02,0x01,0x03,0x13,0x00,0x00,0x0b,0x10,0x04,0x02,0x00,0x0e,0x05,0x00,0x05,
+0x00,0x00,0x00,0x07,0x73,0x65,0x74,0x61,0x74,0x74,0x72,0x00,0x10,0x06,0x00,0x00,
+0x10,0x07,0x04,0x00,0x0a,0x08,0x01,0x04,0x37,0x02,0x05,0x04,0x13,0x00,0xff,0xf5,
+0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x0f,0x00,0x00,0x00,0x05,0x6d,0x65,0x72,0x67,
+0x65,0x00,0x00,0x00,0x0f,0x02,0x01,0x00,0x1f,0x05,0x00,0x1a,0x20,0x20,0x20,0x20,
+0x64,0x65,0x66,0x20,0x6e,0x75,0x6d,0x62,0x65,0x72,0x28,0x76,0x29,0x3a,0x00,0x00,
+0x33,0x02,0x00,0x04,0x2a,0x24,0x33,0x36,0x00,0x00,0x00,0x00,0x0d,0x07,0x00,0x0b,
+0x00,0x00,0x00,0x01,0x76,0x00,0x00,0x00,0x1c,0x03,0x07,0x01,0x1c,0x04,0x00,0x00,
+0x1d,0x05,0x00,0x00,0x1d,0x06,0x00,0x00,0x11,0x02,0x00,0x99,0x2d,0x06,0x00,0x0b,
+0x00,0x00,0x00,0x00,0x1f,0x05,0x00,0x1a,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,
+0x6e,0x75,0x6d,0x62,0x65,0x72,0x28,0x76,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x01,
+0x76,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x17,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x62,0x6f,0x6f,0x74,
+0x2e,0x70,0x79,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x06,
+0x6e,0x75,0x6d,0x62,0x65,0x72,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x0a,0x00,0x1b,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,0x6f,0x74,0x20,0x69,
+0x73,0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x28,0x76,0x2c,0x20,0x5f,0x62,0x79,
+0x74,0x65,0x73,0x29,0x3a,0x00,0x00,0x00,0x0e,0x03,0x00,0x02,0x00,0x00,0x00,0x0a,
+0x69,0x73,0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x00,0x00,0x10,0x04,0x00,0x00,
+0x0e,0x05,0x00,0x03,0x00,0x00,0x00,0x06,0x5f,0x62,0x79,0x74,0x65,0x73,0x00,0x00,
+0x37,0x02,0x03,0x03,0x2f,0x02,0x00,0x00,0x13,0x00,0x00,0x09,0x1f,0x05,0x00,0x1c,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x61,0x69,0x73,
+0x65,0x00,0x00,0x00,0x1d,0x01,0x00,0x00,0x26,0x01,0x00,0x00,0x1f,0x06,0x00,0x1d,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x62,0x27,0x2e,0x27,0x20,
+0x69,0x6e,0x20,0x76,0x3a,0x00,0x00,0x00,0x0d,0x01,0x00,0x04,0x00,0x00,0x00,0x01,
+0x2e,0x00,0x00,0x00,0x25,0x01,0x01,0x00,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x10,
+0x1f,0x07,0x00,0x1e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x76,0x29,0x00,
+0x0e,0x02,0x00,0x05,0x00,0x00,0x00,0x05,0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,0x00,
+0x10,0x03,0x00,0x00,0x37,0x01,0x02,0x02,0x15,0x01,0x00,0x00,0x1f,0x04,0x00,0x1f,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x3a,0x00,0x00,0x00,
+0x1f,0x08,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x76,0x5b,0x30,0x3a,0x32,0x5d,0x20,0x3d,0x3d,0x20,0x62,0x27,0x30,
+0x78,0x27,0x3a,0x00,0x0c,0x03,0x00,0x06,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0c,0x04,0x00,0x07,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x1c,0x02,0x03,0x02,
+0x0a,0x01,0x00,0x02,0x0d,0x02,0x00,0x08,0x00,0x00,0x00,0x02,0x30,0x78,0x00,0x00,
+0x18,0x01,0x01,0x02,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x1a,0x1f,0x0a,0x00,0x21,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x69,0x6e,0x74,0x28,0x76,0x5b,0x32,0x3a,0x5d,
+0x2c,0x31,0x36,0x29,0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x09,0x00,0x00,0x00,0x03,
+0x69,0x6e,0x74,0x00,0x0c,0x03,0x00,0x07,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,
+0x1d,0x04,0x00,0x00,0x1c,0x05,0x03,0x02,0x0a,0x03,0x00,0x05,0x0c,0x04,0x00,0x0a,
+0x00,0x00,0x69,0x04,0x10,0x00,0x00,0x00,0x37,0x01,0x02,0x03,0x15,0x01,0x00,0x00,
+0x1f,0x07,0x00,0x22,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x69,0x6e,0x74,0x28,0x76,0x29,0x00,0x00,0x00,
+0x0e,0x02,0x00,0x09,0x00,0x00,0x00,0x03,0x69,0x6e,0x74,0x00,0x10,0x03,0x00,0x00,
+0x37,0x01,0x02,0x02,0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x10,
+0x00,0x00,0x00,0x06,0x6e,0x75,0x6d,0x62,0x65,0x72,0x00,0x00,0x0f,0x03,0x02,0x00,
+0x1f,0x06,0x00,0x24,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x69,0x73,0x74,0x79,
+0x70,0x65,0x28,0x76,0x2c,0x74,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x03,0x00,0x04,
+0x2a,0x24,0x34,0x33,0x00,0x00,0x00,0x00,0x0d,0x08,0x00,0x0b,0x00,0x00,0x00,0x01,
+0x76,0x00,0x00,0x00,0x0d,0x09,0x00,0x11,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x1c,0x04,0x08,0x02,0x1c,0x05,0x00,0x00,0x1d,0x06,0x00,0x00,0x1d,0x07,0x00,0x00,
+0x11,0x03,0x00,0xd1,0x2d,0x05,0x00,0x0c,0x00,0x00,0x00,0x00,0x1f,0x06,0x00,0x24,
+0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x69,0x73,0x74,0x79,0x70,0x65,0x28,0x76,
+0x2c,0x74,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x76,0x00,0x00,0x00,
+0x33,0x01,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x17,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x62,0x6f,0x6f,0x74,0x2e,0x70,0x79,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,
+0x00,0x00,0x00,0x06,0x69,0x73,0x74,0x79,0x70,0x65,0x00,0x00,0x23,0x02,0x00,0x00,
+0x1f,0x0d,0x00,0x25,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,
+0x20,0x3d,0x3d,0x20,0x27,0x73,0x74,0x72,0x69,0x6e,0x67,0x27,0x3a,0x20,0x72,0x65,
+0x74,0x75,0x72,0x6e,0x20,0x69,0x73,0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x28,
+0x76,0x2c,0x73,0x74,0x72,0x29,0x00,0x00,0x0d,0x02,0x00,0x02,0x00,0x00,0x00,0x06,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x18,0x02,0x01,0x02,0x16,0x02,0x00,0x00,
+0x13,0x00,0x00,0x0c,0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x0a,0x69,0x73,0x69,0x6e,
+0x73,0x74,0x61,0x6e,0x63,0x65,0x00,0x00,0x10,0x03,0x00,0x00,0x0e,0x04,0x00,0x04,
+0x00,0x00,0x00,0x03,0x73,0x74,0x72,0x00,0x37,0x02,0x02,0x03,0x15,0x02,0x00,0x00,
+0x1f,0x14,0x00,0x26,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,
+0x20,0x74,0x20,0x3d,0x3d,0x20,0x27,0x6c,0x69,0x73,0x74,0x27,0x3a,0x20,0x72,0x65,
+0x74,0x75,0x72,0x6e,0x20,0x28,0x69,0x73,0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,
+0x28,0x76,0x2c,0x6c,0x69,0x73,0x74,0x29,0x20,0x6f,0x72,0x20,0x69,0x73,0x69,0x6e,
+0x73,0x74,0x61,0x6e,0x63,0x65,0x28,0x76,0x2c,0x74,0x75,0x70,0x6c,0x65,0x29,0x29,
+0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x05,0x00,0x00,0x00,0x04,0x6c,0x69,0x73,0x74,
+0x00,0x00,0x00,0x00,0x18,0x02,0x01,0x02,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x1a,
+0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x0a,0x69,0x73,0x69,0x6e,0x73,0x74,0x61,0x6e,
+0x63,0x65,0x00,0x00,0x10,0x03,0x00,0x00,0x0e,0x04,0x00,0x05,0x00,0x00,0x00,0x04,
+0x6c,0x69,0x73,0x74,0x00,0x00,0x00,0x00,0x37,0x02,0x02,0x03,0x2f,0x02,0x00,0x00,
+0x13,0x00,0x00,0x0c,0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x0a,0x69,0x73,0x69,0x6e,
+0x73,0x74,0x61,0x6e,0x63,0x65,0x00,0x00,0x10,0x03,0x00,0x00,0x0e,0x04,0x00,0x06,
+0x00,0x00,0x00,0x05,0x74,0x75,0x70,0x6c,0x65,0x00,0x00,0x00,0x37,0x02,0x02,0x03,
+0x15,0x02,0x00,0x00,0x1f,0x0d,0x00,0x27,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x65,0x6c,0x69,0x66,0x20,0x74,0x20,0x3d,0x3d,0x20,0x27,0x64,0x69,0x63,0x74,0x27,
+0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x69,0x73,0x69,0x6e,0x73,0x74,0x61,
+0x6e,0x63,0x65,0x28,0x76,0x2c,0x64,0x69,0x63,0x74,0x29,0x00,0x0d,0x02,0x00,0x07,
+0x00,0x00,0x00,0x04,0x64,0x69,0x63,0x74,0x00,0x00,0x00,0x00,0x18,0x02,0x01,0x02,
+0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x0d,0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x0a,
+0x69,0x73,0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x00,0x00,0x10,0x03,0x00,0x00,
+0x0e,0x04,0x00,0x07,0x00,0x00,0x00,0x04,0x64,0x69,0x63,0x74,0x00,0x00,0x00,0x00,
+0x37,0x02,0x02,0x03,0x15,0x02,0x00,0x00,0x1f,0x14,0x00,0x28,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x74,0x20,0x3d,0x3d,0x20,0x27,0x6e,
+0x75,0x6d,0x62,0x65,0x72,0x27,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,
+0x69,0x73,0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x28,0x76,0x2c,0x66,0x6c,0x6f,
+0x61,0x74,0x29,0x20,0x6f,0x72,0x20,0x69,0x73,0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,
+0x65,0x28,0x76,0x2c,0x69,0x6e,0x74,0x29,0x29,0x00,0x00,0x00,0x0d,0x02,0x00,0x08,
+0x00,0x00,0x00,0x06,0x6e,0x75,0x6d,0x62,0x65,0x72,0x00,0x00,0x18,0x02,0x01,0x02,
+0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x19,0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x0a,
+0x69,0x73,0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x00,0x00,0x10,0x03,0x00,0x00,
+0x0e,0x04,0x00,0x09,0x00,0x00,0x00,0x05,0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,0x00,
+0x37,0x02,0x02,0x03,0x2f,0x02,0x00,0x00,0x13,0x00,0x00,0x0b,0x0e,0x02,0x00,0x03,
+0x00,0x00,0x00,0x0a,0x69,0x73,0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x00,0x00,
+0x10,0x03,0x00,0x00,0x0e,0x04,0x00,0x0a,0x00,0x00,0x00,0x03,0x69,0x6e,0x74,0x00,
+0x37,0x02,0x02,0x03,0x15,0x02,0x00,0x00,0x1f,0x05,0x00,0x29,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x61,0x69,0x73,0x65,0x20,0x27,0x3f,0x27,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x0b,0x00,0x00,0x00,0x01,0x3f,0x00,0x00,0x00,0x26,0x02,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x12,0x00,0x00,0x00,0x06,0x69,0x73,0x74,0x79,
+0x70,0x65,0x00,0x00,0x0f,0x04,0x03,0x00,0x1f,0x07,0x00,0x2b,0x20,0x20,0x20,0x20,
+0x64,0x65,0x66,0x20,0x70,0x61,0x63,0x6b,0x28,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,
+0x20,0x76,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x04,0x00,0x04,0x2a,0x24,0x35,0x31,
+0x00,0x00,0x00,0x00,0x0d,0x09,0x00,0x13,0x00,0x00,0x00,0x06,0x66,0x6f,0x72,0x6d,
+0x61,0x74,0x00,0x00,0x0d,0x0a,0x00,0x0b,0x00,0x00,0x00,0x01,0x76,0x00,0x00,0x00,
+0x1c,0x05,0x09,0x02,0x1c,0x06,0x00,0x00,0x1d,0x07,0x00,0x00,0x1d,0x08,0x00,0x00,
+0x11,0x04,0x00,0x38,0x2d,0x08,0x00,0x03,0x00,0x00,0x00,0x01,0x1f,0x07,0x00,0x2b,
+0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x70,0x61,0x63,0x6b,0x28,0x66,0x6f,0x72,
+0x6d,0x61,0x74,0x2c,0x20,0x76,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x06,
+0x66,0x6f,0x72,0x6d,0x61,0x74,0x00,0x00,0x33,0x01,0x00,0x01,0x76,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x17,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x62,0x6f,0x6f,0x74,0x2e,0x70,0x79,0x00,
+0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x04,0x70,0x61,0x63,0x6b,
+0x00,0x00,0x00,0x00,0x23,0x02,0x00,0x00,0x1f,0x0a,0x00,0x2c,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x72,0x75,0x63,
+0x74,0x2e,0x70,0x61,0x63,0x6b,0x28,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,0x76,
+0x29,0x00,0x00,0x00,0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x06,0x73,0x74,0x72,0x75,
+0x63,0x74,0x00,0x00,0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x04,0x70,0x61,0x63,0x6b,
+0x00,0x00,0x00,0x00,0x38,0x04,0x02,0x03,0x00,0x00,0x00,0x00,0x10,0x06,0x00,0x00,
+0x10,0x07,0x01,0x00,0x39,0x02,0x04,0x04,0x15,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x05,0x00,0x14,0x00,0x00,0x00,0x04,0x70,0x61,0x63,0x6b,0x00,0x00,0x00,0x00,
+0x0f,0x05,0x04,0x00,0x1f,0x07,0x00,0x2e,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,
+0x75,0x6e,0x70,0x61,0x63,0x6b,0x28,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,0x76,
+0x29,0x3a,0x00,0x00,0x33,0x05,0x00,0x04,0x2a,0x24,0x35,0x39,0x00,0x00,0x00,0x00,
+0x0d,0x0a,0x00,0x13,0x00,0x00,0x00,0x06,0x66,0x6f,0x72,0x6d,0x61,0x74,0x00,0x00,
+0x0d,0x0b,0x00,0x0b,0x00,0x00,0x00,0x01,0x76,0x00,0x00,0x00,0x1c,0x06,0x0a,0x02,
+0x1c,0x07,0x00,0x00,0x1d,0x08,0x00,0x00,0x1d,0x09,0x00,0x00,0x11,0x05,0x00,0x3d,
+0x2d,0x08,0x00,0x04,0x00,0x00,0x00,0x01,0x1f,0x07,0x00,0x2e,0x20,0x20,0x20,0x20,
+0x64,0x65,0x66,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x28,0x66,0x6f,0x72,0x6d,0x61,
+0x74,0x2c,0x20,0x76,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x06,0x66,0x6f,0x72,0x6d,
+0x61,0x74,0x00,0x00,0x33,0x01,0x00,0x01,0x76,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,
+0x00,0x00,0x00,0x17,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x62,0x6f,0x6f,0x74,0x2e,0x70,0x79,0x00,0x22,0x02,0x00,0x00,
+0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x06,0x75,0x6e,0x70,0x61,0x63,0x6b,0x00,0x00,
+0x23,0x02,0x00,0x00,0x1f,0x0b,0x00,0x2f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x2e,0x75,0x6e,
+0x70,0x61,0x63,0x6b,0x28,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,0x76,0x29,0x5b,
+0x30,0x5d,0x00,0x00,0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x06,0x73,0x74,0x72,0x75,
+0x63,0x74,0x00,0x00,0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x06,0x75,0x6e,0x70,0x61,
+0x63,0x6b,0x00,0x00,0x38,0x04,0x02,0x03,0x00,0x00,0x00,0x00,0x10,0x06,0x00,0x00,
+0x10,0x07,0x01,0x00,0x39,0x02,0x04,0x04,0x0c,0x04,0x00,0x03,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x02,0x02,0x04,0x15,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x06,0x00,0x15,0x00,0x00,0x00,0x06,0x75,0x6e,0x70,0x61,0x63,0x6b,0x00,0x00,
+0x0f,0x06,0x05,0x00,0x1f,0x06,0x00,0x31,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,
+0x6c,0x6f,0x61,0x64,0x28,0x66,0x6e,0x61,0x6d,0x65,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x06,0x00,0x04,0x2a,0x24,0x36,0x37,0x00,0x00,0x00,0x00,0x0d,0x0b,0x00,0x16,
+0x00,0x00,0x00,0x05,0x66,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x1c,0x07,0x0b,0x01,
+0x1c,0x08,0x00,0x00,0x1d,0x09,0x00,0x00,0x1d,0x0a,0x00,0x00,0x11,0x06,0x00,0x5d,
+0x2d,0x06,0x00,0x07,0x00,0x00,0x00,0x03,0x1f,0x06,0x00,0x31,0x20,0x20,0x20,0x20,
+0x64,0x65,0x66,0x20,0x6c,0x6f,0x61,0x64,0x28,0x66,0x6e,0x61,0x6d,0x65,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x05,0x66,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x17,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x62,0x6f,0x6f,0x74,0x2e,0x70,0x79,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x04,0x6c,0x6f,0x61,0x64,
+0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x08,0x00,0x32,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x66,0x20,0x3d,0x20,0x6f,0x70,0x65,0x6e,0x28,0x66,0x6e,0x61,
+0x6d,0x65,0x2c,0x27,0x72,0x62,0x27,0x29,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x01,
+0x66,0x00,0x00,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x04,0x6f,0x70,0x65,0x6e,
+0x00,0x00,0x00,0x00,0x10,0x02,0x00,0x00,0x0d,0x03,0x00,0x03,0x00,0x00,0x00,0x02,
+0x72,0x62,0x00,0x00,0x37,0x01,0x01,0x03,0x1f,0x08,0x00,0x33,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x66,0x2e,0x72,0x65,0x61,0x64,0x28,0x29,
+0x2e,0x64,0x65,0x63,0x6f,0x64,0x65,0x28,0x29,0x00,0x00,0x00,0x33,0x04,0x00,0x01,
+0x72,0x00,0x00,0x00,0x0d,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x72,0x65,0x61,0x64,
+0x00,0x00,0x00,0x00,0x38,0x04,0x01,0x00,0x00,0x00,0x00,0x00,0x39,0x00,0x04,0x02,
+0x0d,0x04,0x00,0x05,0x00,0x00,0x00,0x06,0x64,0x65,0x63,0x6f,0x64,0x65,0x00,0x00,
+0x38,0x02,0x00,0x04,0x00,0x00,0x00,0x01,0x39,0x04,0x02,0x02,0x1f,0x05,0x00,0x34,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x2e,0x63,0x6c,0x6f,0x73,0x65,0x28,
+0x29,0x00,0x00,0x00,0x0d,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x63,0x6c,0x6f,0x73,
+0x65,0x00,0x00,0x00,0x38,0x02,0x01,0x00,0x00,0x00,0x00,0x02,0x39,0x01,0x02,0x02,
+0x1f,0x05,0x00,0x35,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,0x15,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x07,0x00,0x17,0x00,0x00,0x00,0x04,0x6c,0x6f,0x61,0x64,0x00,0x00,0x00,0x00,
+0x0f,0x07,0x06,0x00,0x1f,0x06,0x00,0x37,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,
+0x72,0x65,0x61,0x64,0x28,0x66,0x6e,0x61,0x6d,0x65,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x07,0x00,0x04,0x2a,0x24,0x37,0x34,0x00,0x00,0x00,0x00,0x0d,0x0c,0x00,0x16,
+0x00,0x00,0x00,0x05,0x66,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x1c,0x08,0x0c,0x01,
+0x1c,0x09,0x00,0x00,0x1d,0x0a,0x00,0x00,0x1d,0x0b,0x00,0x00,0x11,0x07,0x00,0x5d,
+0x2d,0x06,0x00,0x06,0x00,0x00,0x00,0x03,0x1f,0x06,0x00,0x37,0x20,0x20,0x20,0x20,
+0x64,0x65,0x66,0x20,0x72,0x65,0x61,0x64,0x28,0x66,0x6e,0x61,0x6d,0x65,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x05,0x66,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x17,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x62,0x6f,0x6f,0x74,0x2e,0x70,0x79,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x04,0x72,0x65,0x61,0x64,
+0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x08,0x00,0x38,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x66,0x20,0x3d,0x20,0x6f,0x70,0x65,0x6e,0x28,0x66,0x6e,0x61,
+0x6d,0x65,0x2c,0x27,0x72,0x62,0x27,0x29,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x01,
+0x66,0x00,0x00,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x04,0x6f,0x70,0x65,0x6e,
+0x00,0x00,0x00,0x00,0x10,0x02,0x00,0x00,0x0d,0x03,0x00,0x03,0x00,0x00,0x00,0x02,
+0x72,0x62,0x00,0x00,0x37,0x01,0x01,0x03,0x1f,0x08,0x00,0x39,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x66,0x2e,0x72,0x65,0x61,0x64,0x28,0x29,
+0x2e,0x64,0x65,0x63,0x6f,0x64,0x65,0x28,0x29,0x00,0x00,0x00,0x33,0x04,0x00,0x01,
+0x72,0x00,0x00,0x00,0x0d,0x00,0x00,0x01,0x00,0x00,0x00,0x04,0x72,0x65,0x61,0x64,
+0x00,0x00,0x00,0x00,0x38,0x04,0x01,0x00,0x00,0x00,0x00,0x00,0x39,0x00,0x04,0x02,
+0x0d,0x04,0x00,0x04,0x00,0x00,0x00,0x06,0x64,0x65,0x63,0x6f,0x64,0x65,0x00,0x00,
+0x38,0x02,0x00,0x04,0x00,0x00,0x00,0x01,0x39,0x04,0x02,0x02,0x1f,0x05,0x00,0x3a,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x2e,0x63,0x6c,0x6f,0x73,0x65,0x28,
+0x29,0x00,0x00,0x00,0x0d,0x00,0x00,0x05,0x00,0x00,0x00,0x05,0x63,0x6c,0x6f,0x73,
+0x65,0x00,0x00,0x00,0x38,0x02,0x01,0x00,0x00,0x00,0x00,0x02,0x39,0x01,0x02,0x02,
+0x1f,0x05,0x00,0x3b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,0x15,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x08,0x00,0x18,0x00,0x00,0x00,0x04,0x72,0x65,0x61,0x64,0x00,0x00,0x00,0x00,
+0x0f,0x08,0x07,0x00,0x1f,0x09,0x00,0x3d,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x73,
+0x79,0x73,0x2e,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x5f,0x69,0x6e,0x66,0x6f,0x2e,
+0x6d,0x61,0x6a,0x6f,0x72,0x20,0x3d,0x3d,0x20,0x32,0x3a,0x00,0x0e,0x08,0x00,0x03,
+0x00,0x00,0x00,0x03,0x73,0x79,0x73,0x00,0x0d,0x09,0x00,0x19,0x00,0x00,0x00,0x0c,
+0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x5f,0x69,0x6e,0x66,0x6f,0x00,0x00,0x00,0x00,
+0x09,0x08,0x08,0x09,0x00,0x00,0x00,0x02,0x0d,0x09,0x00,0x1a,0x00,0x00,0x00,0x05,
+0x6d,0x61,0x6a,0x6f,0x72,0x00,0x00,0x00,0x09,0x08,0x08,0x09,0x00,0x00,0x00,0x03,
+0x0c,0x09,0x00,0x1b,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x18,0x08,0x08,0x09,
+0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x4a,0x1f,0x06,0x00,0x3e,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x62,0x79,0x74,0x65,0x73,0x28,0x76,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x08,0x00,0x04,0x2a,0x24,0x38,0x35,0x00,0x00,0x00,0x00,
+0x0d,0x0d,0x00,0x0b,0x00,0x00,0x00,0x01,0x76,0x00,0x00,0x00,0x1c,0x09,0x0d,0x01,
+0x1c,0x0a,0x00,0x00,0x1d,0x0b,0x00,0x00,0x1d,0x0c,0x00,0x00,0x11,0x08,0x00,0x33,
+0x2d,0x04,0x00,0x04,0x00,0x00,0x00,0x00,0x1f,0x06,0x00,0x3e,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x62,0x79,0x74,0x65,0x73,0x28,0x76,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x76,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x17,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x62,0x6f,0x6f,0x74,0x2e,0x70,0x79,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x05,0x62,0x79,0x74,0x65,0x73,0x00,0x00,0x00,
+0x23,0x01,0x00,0x00,0x1f,0x0a,0x00,0x3f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x62,0x79,0x74,0x65,
+0x73,0x28,0x62,0x79,0x74,0x65,0x61,0x72,0x72,0x61,0x79,0x28,0x76,0x29,0x29,0x00,
+0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x06,0x5f,0x62,0x79,0x74,0x65,0x73,0x00,0x00,
+0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x09,0x62,0x79,0x74,0x65,0x61,0x72,0x72,0x61,
+0x79,0x00,0x00,0x00,0x10,0x03,0x00,0x00,0x37,0x02,0x02,0x02,0x37,0x01,0x01,0x02,
+0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x09,0x00,0x08,0x00,0x00,0x00,0x05,
+0x62,0x79,0x74,0x65,0x73,0x00,0x00,0x00,0x0f,0x09,0x08,0x00,0x1f,0x06,0x00,0x41,
+0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x73,0x61,0x76,0x65,0x28,0x66,0x6e,0x61,
+0x6d,0x65,0x2c,0x76,0x29,0x3a,0x00,0x00,0x33,0x09,0x00,0x04,0x2a,0x24,0x39,0x32,
+0x00,0x00,0x00,0x00,0x0d,0x0e,0x00,0x16,0x00,0x00,0x00,0x05,0x66,0x6e,0x61,0x6d,
+0x65,0x00,0x00,0x00,0x0d,0x0f,0x00,0x0b,0x00,0x00,0x00,0x01,0x76,0x00,0x00,0x00,
+0x1c,0x0a,0x0e,0x02,0x1c,0x0b,0x00,0x00,0x1d,0x0c,0x00,0x00,0x1d,0x0d,0x00,0x00,
+0x11,0x09,0x00,0x4d,0x2d,0x06,0x00,0x06,0x00,0x00,0x00,0x02,0x1f,0x06,0x00,0x41,
+0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x73,0x61,0x76,0x65,0x28,0x66,0x6e,0x61,
+0x6d,0x65,0x2c,0x76,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x05,0x66,0x6e,0x61,0x6d,
+0x65,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x76,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,
+0x00,0x00,0x00,0x17,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x62,0x6f,0x6f,0x74,0x2e,0x70,0x79,0x00,0x22,0x02,0x00,0x00,
+0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x04,0x73,0x61,0x76,0x65,0x00,0x00,0x00,0x00,
+0x23,0x02,0x00,0x00,0x1f,0x08,0x00,0x42,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x66,0x20,0x3d,0x20,0x6f,0x70,0x65,0x6e,0x28,0x66,0x6e,0x61,0x6d,0x65,0x2c,0x27,
+0x77,0x62,0x27,0x29,0x00,0x00,0x00,0x00,0x33,0x02,0x00,0x01,0x66,0x00,0x00,0x00,
+0x0e,0x03,0x00,0x02,0x00,0x00,0x00,0x04,0x6f,0x70,0x65,0x6e,0x00,0x00,0x00,0x00,
+0x10,0x04,0x00,0x00,0x0d,0x05,0x00,0x03,0x00,0x00,0x00,0x02,0x77,0x62,0x00,0x00,
+0x37,0x02,0x03,0x03,0x1f,0x05,0x00,0x43,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x66,0x2e,0x77,0x72,0x69,0x74,0x65,0x28,0x76,0x29,0x00,0x00,0x0d,0x05,0x00,0x04,
+0x00,0x00,0x00,0x05,0x77,0x72,0x69,0x74,0x65,0x00,0x00,0x00,0x38,0x03,0x02,0x05,
+0x00,0x00,0x00,0x00,0x10,0x05,0x01,0x00,0x39,0x01,0x03,0x03,0x1f,0x05,0x00,0x44,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x2e,0x63,0x6c,0x6f,0x73,0x65,0x28,
+0x29,0x00,0x00,0x00,0x0d,0x05,0x00,0x05,0x00,0x00,0x00,0x05,0x63,0x6c,0x6f,0x73,
+0x65,0x00,0x00,0x00,0x38,0x03,0x02,0x05,0x00,0x00,0x00,0x01,0x39,0x01,0x03,0x02,
+0x00,0x00,0x00,0x00,0x0d,0x0a,0x00,0x1c,0x00,0x00,0x00,0x04,0x73,0x61,0x76,0x65,
+0x00,0x00,0x00,0x00,0x0f,0x0a,0x09,0x00,0x13,0x00,0x00,0xd4,0x1f,0x02,0x00,0x45,
+0x65,0x6c,0x73,0x65,0x3a,0x00,0x00,0x00,0x1f,0x0b,0x00,0x46,0x20,0x20,0x20,0x20,
+0x66,0x72,0x6f,0x6d,0x20,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x72,0x75,0x6e,0x74,
+0x69,0x6d,0x65,0x2e,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,0x73,0x20,0x69,0x6d,0x70,
+0x6f,0x72,0x74,0x20,0x2a,0x00,0x00,0x00,0x0e,0x0b,0x00,0x02,0x00,0x00,0x00,0x0a,
+0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,0x5f,0x5f,0x00,0x00,0x0d,0x0c,0x00,0x1d,
+0x00,0x00,0x00,0x17,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x72,0x75,0x6e,0x74,0x69,
+0x6d,0x65,0x2e,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,0x73,0x00,0x0d,0x0d,0x00,0x1e,
+0x00,0x00,0x00,0x01,0x2a,0x00,0x00,0x00,0x37,0x0a,0x0b,0x03,0x0e,0x0b,0x00,0x1f,
+0x00,0x00,0x00,0x08,0x5f,0x5f,0x64,0x69,0x63,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,
+0x32,0x0b,0x0a,0x00,0x1f,0x09,0x00,0x47,0x20,0x20,0x20,0x20,0x66,0x72,0x6f,0x6d,
+0x20,0x6f,0x73,0x20,0x69,0x6d,0x70,0x6f,0x72,0x74,0x20,0x6c,0x6f,0x61,0x64,0x2c,
+0x20,0x72,0x65,0x61,0x64,0x2c,0x20,0x73,0x61,0x76,0x65,0x00,0x0e,0x0b,0x00,0x02,
+0x00,0x00,0x00,0x0a,0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,0x5f,0x5f,0x00,0x00,
+0x0d,0x0c,0x00,0x20,0x00,0x00,0x00,0x02,0x6f,0x73,0x00,0x00,0x0d,0x0e,0x00,0x17,
+0x00,0x00,0x00,0x04,0x6c,0x6f,0x61,0x64,0x00,0x00,0x00,0x00,0x0d,0x0f,0x00,0x18,
+0x00,0x00,0x00,0x04,0x72,0x65,0x61,0x64,0x00,0x00,0x00,0x00,0x0d,0x10,0x00,0x1c,
+0x00,0x00,0x00,0x04,0x73,0x61,0x76,0x65,0x00,0x00,0x00,0x00,0x1c,0x0d,0x0e,0x03,
+0x37,0x0a,0x0b,0x03,0x0e,0x0b,0x00,0x1f,0x00,0x00,0x00,0x08,0x5f,0x5f,0x64,0x69,
+0x63,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,0x32,0x0b,0x0a,0x00,0x1f,0x05,0x00,0x49,
+0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x6a,0x6f,0x69,0x6e,0x28,0x76,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x0a,0x00,0x05,0x2a,0x24,0x31,0x31,0x33,0x00,0x00,0x00,
+0x0d,0x0f,0x00,0x0b,0x00,0x00,0x00,0x01,0x76,0x00,0x00,0x00,0x1c,0x0b,0x0f,0x01,
+0x1c,0x0c,0x00,0x00,0x1d,0x0d,0x00,0x00,0x1d,0x0e,0x00,0x00,0x11,0x0a,0x00,0x2e,
+0x2d,0x06,0x00,0x03,0x00,0x00,0x00,0x01,0x1f,0x05,0x00,0x49,0x20,0x20,0x20,0x20,
+0x64,0x65,0x66,0x20,0x6a,0x6f,0x69,0x6e,0x28,0x76,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x76,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x17,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x62,0x6f,0x6f,0x74,0x2e,0x70,0x79,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,
+0x00,0x00,0x00,0x04,0x6a,0x6f,0x69,0x6e,0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,
+0x1f,0x07,0x00,0x4a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x27,0x27,0x2e,0x6a,0x6f,0x69,0x6e,0x28,0x76,0x29,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x01,
+0x00,0x00,0x00,0x04,0x6a,0x6f,0x69,0x6e,0x00,0x00,0x00,0x00,0x38,0x03,0x01,0x02,
+0x00,0x00,0x00,0x00,0x10,0x05,0x00,0x00,0x39,0x01,0x03,0x03,0x15,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x0b,0x00,0x0c,0x00,0x00,0x00,0x04,0x6a,0x6f,0x69,0x6e,
+0x00,0x00,0x00,0x00,0x0f,0x0b,0x0a,0x00,0x1f,0x06,0x00,0x4c,0x20,0x20,0x20,0x20,
+0x64,0x65,0x66,0x20,0x6d,0x65,0x72,0x67,0x65,0x28,0x61,0x2c,0x20,0x62,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x0b,0x00,0x05,0x2a,0x24,0x31,0x32,0x30,0x00,0x00,0x00,
+0x0d,0x10,0x00,0x0d,0x00,0x00,0x00,0x01,0x61,0x00,0x00,0x00,0x0d,0x11,0x00,0x0e,
+0x00,0x00,0x00,0x01,0x62,0x00,0x00,0x00,0x1c,0x0c,0x10,0x02,0x1c,0x0d,0x00,0x00,
+0x1d,0x0e,0x00,0x00,0x1d,0x0f,0x00,0x00,0x11,0x0b,0x00,0x2b,0x2d,0x06,0x00,0x03,
+0x00,0x00,0x00,0x01,0x1f,0x06,0x00,0x4c,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,
+0x6d,0x65,0x72,0x67,0x65,0x28,0x61,0x2c,0x20,0x62,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x61,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x62,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x17,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x62,0x6f,0x6f,0x74,0x2e,0x70,0x79,0x00,
+0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x05,0x6d,0x65,0x72,0x67,
+0x65,0x00,0x00,0x00,0x23,0x02,0x00,0x00,0x1f,0x05,0x00,0x4d,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x61,0x2e,0x75,0x70,0x64,0x61,0x74,0x65,0x28,0x62,0x29,0x00,
+0x0d,0x02,0x00,0x02,0x00,0x00,0x00,0x06,0x75,0x70,0x64,0x61,0x74,0x65,0x00,0x00,
+0x38,0x03,0x00,0x02,0x00,0x00,0x00,0x00,0x10,0x05,0x01,0x00,0x39,0x02,0x03,0x03,
+0x00,0x00,0x00,0x00,0x0d,0x0c,0x00,0x0f,0x00,0x00,0x00,0x05,0x6d,0x65,0x72,0x67,
+0x65,0x00,0x00,0x00,0x0f,0x0c,0x0b,0x00,0x00,0x00,0x00,0x00,
+};
+
+static tpd_code * _tp_tinypy_compiler_boot_0(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 6: goto L6;
+        case 14: goto L14;
+        case 15: goto L15;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 24: goto L24;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 29: goto L29;
+        case 32: goto L32;
+        case 33: goto L33;
+        case 42: goto L42;
+        case 46: goto L46;
+        case 49: goto L49;
+        case 53: goto L53;
+        case 55: goto L55;
+        case 56: goto L56;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 65: goto L65;
+        case 70: goto L70;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 87: goto L87;
+        case 91: goto L91;
+        case 95: goto L95;
+        case 96: goto L96;
+        case 102: goto L102;
+        case 106: goto L106;
+        case 109: goto L109;
+        case 113: goto L113;
+        case 115: goto L115;
+        case 116: goto L116;
+        case 122: goto L122;
+        case 125: goto L125;
+        case 128: goto L128;
+        case 129: goto L129;
+        case 130: goto L130;
+        case 131: goto L131;
+        case 132: goto L132;
+        case 235: goto L235;
+        case 239: goto L239;
+        case 240: goto L240;
+        case 246: goto L246;
+        case 249: goto L249;
+        case 252: goto L252;
+        case 255: goto L255;
+        case 256: goto L256;
+        case 257: goto L257;
+        case 258: goto L258;
+        case 259: goto L259;
+        case 357: goto L357;
+        case 361: goto L361;
+        case 362: goto L362;
+        case 368: goto L368;
+        case 371: goto L371;
+        case 374: goto L374;
+        case 375: goto L375;
+        case 376: goto L376;
+        case 377: goto L377;
+        case 378: goto L378;
+        case 531: goto L531;
+        case 535: goto L535;
+        case 536: goto L536;
+        case 543: goto L543;
+        case 546: goto L546;
+        case 549: goto L549;
+        case 552: goto L552;
+        case 553: goto L553;
+        case 554: goto L554;
+        case 555: goto L555;
+        case 556: goto L556;
+        case 765: goto L765;
+        case 769: goto L769;
+        case 770: goto L770;
+        case 778: goto L778;
+        case 781: goto L781;
+        case 785: goto L785;
+        case 788: goto L788;
+        case 789: goto L789;
+        case 790: goto L790;
+        case 791: goto L791;
+        case 792: goto L792;
+        case 848: goto L848;
+        case 852: goto L852;
+        case 853: goto L853;
+        case 861: goto L861;
+        case 864: goto L864;
+        case 868: goto L868;
+        case 871: goto L871;
+        case 872: goto L872;
+        case 873: goto L873;
+        case 874: goto L874;
+        case 875: goto L875;
+        case 936: goto L936;
+        case 940: goto L940;
+        case 941: goto L941;
+        case 948: goto L948;
+        case 951: goto L951;
+        case 955: goto L955;
+        case 956: goto L956;
+        case 957: goto L957;
+        case 958: goto L958;
+        case 959: goto L959;
+        case 1052: goto L1052;
+        case 1056: goto L1056;
+        case 1057: goto L1057;
+        case 1064: goto L1064;
+        case 1067: goto L1067;
+        case 1071: goto L1071;
+        case 1072: goto L1072;
+        case 1073: goto L1073;
+        case 1074: goto L1074;
+        case 1075: goto L1075;
+        case 1168: goto L1168;
+        case 1172: goto L1172;
+        case 1173: goto L1173;
+        case 1183: goto L1183;
+        case 1186: goto L1186;
+        case 1192: goto L1192;
+        case 1194: goto L1194;
+        case 1198: goto L1198;
+        case 1200: goto L1200;
+        case 1203: goto L1203;
+        case 1204: goto L1204;
+        case 1205: goto L1205;
+        case 1206: goto L1206;
+        case 1213: goto L1213;
+        case 1216: goto L1216;
+        case 1219: goto L1219;
+        case 1220: goto L1220;
+        case 1221: goto L1221;
+        case 1222: goto L1222;
+        case 1223: goto L1223;
+        case 1274: goto L1274;
+        case 1278: goto L1278;
+        case 1279: goto L1279;
+        case 1286: goto L1286;
+        case 1289: goto L1289;
+        case 1293: goto L1293;
+        case 1296: goto L1296;
+        case 1297: goto L1297;
+        case 1298: goto L1298;
+        case 1299: goto L1299;
+        case 1300: goto L1300;
+        case 1377: goto L1377;
+        case 1381: goto L1381;
+        case 1382: goto L1382;
+        case 1383: goto L1383;
+        case 1386: goto L1386;
+        case 1398: goto L1398;
+        case 1403: goto L1403;
+        case 1411: goto L1411;
+        case 1414: goto L1414;
+        case 1415: goto L1415;
+        case 1420: goto L1420;
+        case 1421: goto L1421;
+        case 1431: goto L1431;
+        case 1436: goto L1436;
+        case 1439: goto L1439;
+        case 1443: goto L1443;
+        case 1447: goto L1447;
+        case 1451: goto L1451;
+        case 1452: goto L1452;
+        case 1453: goto L1453;
+        case 1458: goto L1458;
+        case 1459: goto L1459;
+        case 1465: goto L1465;
+        case 1468: goto L1468;
+        case 1471: goto L1471;
+        case 1472: goto L1472;
+        case 1473: goto L1473;
+        case 1474: goto L1474;
+        case 1475: goto L1475;
+        case 1521: goto L1521;
+        case 1525: goto L1525;
+        case 1526: goto L1526;
+        case 1533: goto L1533;
+        case 1536: goto L1536;
+        case 1539: goto L1539;
+        case 1542: goto L1542;
+        case 1543: goto L1543;
+        case 1544: goto L1544;
+        case 1545: goto L1545;
+        case 1546: goto L1546;
+        case 1589: goto L1589;
+        case 1593: goto L1593;
+        case 1594: goto L1594;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 1;
+L6: /* STRING */
+    tp_aot_op(tp, f, code + 6);
+L14: /* FILE */
+    f->fname = regs[0];
+L15: /* STRING */
+    tp_aot_op(tp, f, code + 15);
+L18: /* NAME */
+    f->name = regs[0];
+L19: /* GGET */
+    tp_aot_op(tp, f, code + 19);
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L27: /* NONE */
+    regs[3] = tp_None;
+L28: /* CALLP */
+    return code + 28;
+L29: /* STRING */
+    tp_aot_op(tp, f, code + 29);
+L32: /* GSET */
+    tp_set(tp, f->globals, regs[1], regs[0]);
+L33: /* LINE */
+    f->line = code + 33;
+    f->lineno = 3;
+L42: /* STRING */
+    tp_aot_op(tp, f, code + 42);
+L46: /* GGET */
+    tp_aot_op(tp, f, code + 46);
+L49: /* STRING */
+    tp_aot_op(tp, f, code + 49);
+L53: /* MGET */
+    tp_aot_op(tp, f, code + 53);
+L55: /* IN */
+    regs[1] = tp_has(tp, regs[2], regs[1]);
+L56: /* NOT */
+    regs[0] = tp_bool(!tp_true(tp, regs[1]));
+L57: /* IF */
+    if (TP_IS_INT(regs[0]) ? regs[0].nint != 0 : tp_true(tp, regs[0])) {
+        goto L59;
+    }
+L58: /* JUMP */
+    goto L1383;
+L59: /* LINE */
+    f->line = code + 59;
+    f->lineno = 4;
+L65: /* GGET */
+    tp_aot_op(tp, f, code + 65);
+L70: /* STRING */
+    tp_aot_op(tp, f, code + 70);
+L74: /* NONE */
+    regs[3] = tp_None;
+L75: /* CALLP */
+    return code + 75;
+L76: /* STRING */
+    tp_aot_op(tp, f, code + 76);
+L80: /* GSET */
+    tp_set(tp, f->globals, regs[1], regs[0]);
+L81: /* LINE */
+    f->line = code + 81;
+    f->lineno = 5;
+L87: /* STRING */
+    tp_aot_op(tp, f, code + 87);
+L91: /* GGET */
+    tp_aot_op(tp, f, code + 91);
+L95: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L96: /* LINE */
+    f->line = code + 96;
+    f->lineno = 7;
+L102: /* STRING */
+    tp_aot_op(tp, f, code + 102);
+L106: /* GGET */
+    tp_aot_op(tp, f, code + 106);
+L109: /* STRING */
+    tp_aot_op(tp, f, code + 109);
+L113: /* MGET */
+    tp_aot_op(tp, f, code + 113);
+L115: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L116: /* LINE */
+    f->line = code + 116;
+    f->lineno = 9;
+L122: /* VAR */
+L125: /* STRING */
+    tp_aot_op(tp, f, code + 125);
+L128: /* LIST */
+    tp_aot_op(tp, f, code + 128);
+L129: /* LIST */
+    tp_aot_op(tp, f, code + 129);
+L130: /* NONE */
+    regs[3] = tp_None;
+L131: /* NONE */
+    regs[4] = tp_None;
+L132: /* DEF */
+    tp_aot_op(tp, f, code + 132);
+L235: /* STRING */
+    tp_aot_op(tp, f, code + 235);
+L239: /* GSET */
+    tp_set(tp, f->globals, regs[1], regs[0]);
+L240: /* LINE */
+    f->line = code + 240;
+    f->lineno = 20;
+L246: /* VAR */
+L249: /* STRING */
+    tp_aot_op(tp, f, code + 249);
+L252: /* STRING */
+    tp_aot_op(tp, f, code + 252);
+L255: /* LIST */
+    tp_aot_op(tp, f, code + 255);
+L256: /* LIST */
+    tp_aot_op(tp, f, code + 256);
+L257: /* NONE */
+    regs[4] = tp_None;
+L258: /* NONE */
+    regs[5] = tp_None;
+L259: /* DEF */
+    tp_aot_op(tp, f, code + 259);
+L357: /* STRING */
+    tp_aot_op(tp, f, code + 357);
+L361: /* GSET */
+    tp_set(tp, f->globals, regs[2], regs[1]);
+L362: /* LINE */
+    f->line = code + 362;
+    f->lineno = 26;
+L368: /* VAR */
+L371: /* STRING */
+    tp_aot_op(tp, f, code + 371);
+L374: /* LIST */
+    tp_aot_op(tp, f, code + 374);
+L375: /* LIST */
+    tp_aot_op(tp, f, code + 375);
+L376: /* NONE */
+    regs[5] = tp_None;
+L377: /* NONE */
+    regs[6] = tp_None;
+L378: /* DEF */
+    tp_aot_op(tp, f, code + 378);
+L531: /* STRING */
+    tp_aot_op(tp, f, code + 531);
+L535: /* GSET */
+    tp_set(tp, f->globals, regs[3], regs[2]);
+L536: /* LINE */
+    f->line = code + 536;
+    f->lineno = 36;
+L543: /* VAR */
+L546: /* STRING */
+    tp_aot_op(tp, f, code + 546);
+L549: /* STRING */
+    tp_aot_op(tp, f, code + 549);
+L552: /* LIST */
+    tp_aot_op(tp, f, code + 552);
+L553: /* LIST */
+    tp_aot_op(tp, f, code + 553);
+L554: /* NONE */
+    regs[6] = tp_None;
+L555: /* NONE */
+    regs[7] = tp_None;
+L556: /* DEF */
+    tp_aot_op(tp, f, code + 556);
+L765: /* STRING */
+    tp_aot_op(tp, f, code + 765);
+L769: /* GSET */
+    tp_set(tp, f->globals, regs[4], regs[3]);
+L770: /* LINE */
+    f->line = code + 770;
+    f->lineno = 43;
+L778: /* VAR */
+L781: /* STRING */
+    tp_aot_op(tp, f, code + 781);
+L785: /* STRING */
+    tp_aot_op(tp, f, code + 785);
+L788: /* LIST */
+    tp_aot_op(tp, f, code + 788);
+L789: /* LIST */
+    tp_aot_op(tp, f, code + 789);
+L790: /* NONE */
+    regs[7] = tp_None;
+L791: /* NONE */
+    regs[8] = tp_None;
+L792: /* DEF */
+    tp_aot_op(tp, f, code + 792);
+L848: /* STRING */
+    tp_aot_op(tp, f, code + 848);
+L852: /* GSET */
+    tp_set(tp, f->globals, regs[5], regs[4]);
+L853: /* LINE */
+    f->line = code + 853;
+    f->lineno = 46;
+L861: /* VAR */
+L864: /* STRING */
+    tp_aot_op(tp, f, code + 864);
+L868: /* STRING */
+    tp_aot_op(tp, f, code + 868);
+L871: /* LIST */
+    tp_aot_op(tp, f, code + 871);
+L872: /* LIST */
+    tp_aot_op(tp, f, code + 872);
+L873: /* NONE */
+    regs[8] = tp_None;
+L874: /* NONE */
+    regs[9] = tp_None;
+L875: /* DEF */
+    tp_aot_op(tp, f, code + 875);
+L936: /* STRING */
+    tp_aot_op(tp, f, code + 936);
+L940: /* GSET */
+    tp_set(tp, f->globals, regs[6], regs[5]);
+L941: /* LINE */
+    f->line = code + 941;
+    f->lineno = 49;
+L948: /* VAR */
+L951: /* STRING */
+    tp_aot_op(tp, f, code + 951);
+L955: /* LIST */
+    tp_aot_op(tp, f, code + 955);
+L956: /* LIST */
+    tp_aot_op(tp, f, code + 956);
+L957: /* NONE */
+    regs[9] = tp_None;
+L958: /* NONE */
+    regs[10] = tp_None;
+L959: /* DEF */
+    tp_aot_op(tp, f, code + 959);
+L1052: /* STRING */
+    tp_aot_op(tp, f, code + 1052);
+L1056: /* GSET */
+    tp_set(tp, f->globals, regs[7], regs[6]);
+L1057: /* LINE */
+    f->line = code + 1057;
+    f->lineno = 55;
+L1064: /* VAR */
+L1067: /* STRING */
+    tp_aot_op(tp, f, code + 1067);
+L1071: /* LIST */
+    tp_aot_op(tp, f, code + 1071);
+L1072: /* LIST */
+    tp_aot_op(tp, f, code + 1072);
+L1073: /* NONE */
+    regs[10] = tp_None;
+L1074: /* NONE */
+    regs[11] = tp_None;
+L1075: /* DEF */
+    tp_aot_op(tp, f, code + 1075);
+L1168: /* STRING */
+    tp_aot_op(tp, f, code + 1168);
+L1172: /* GSET */
+    tp_set(tp, f->globals, regs[8], regs[7]);
+L1173: /* LINE */
+    f->line = code + 1173;
+    f->lineno = 61;
+L1183: /* GGET */
+    tp_aot_op(tp, f, code + 1183);
+L1186: /* STRING */
+    tp_aot_op(tp, f, code + 1186);
+L1192: /* MGET */
+    tp_aot_op(tp, f, code + 1192);
+L1194: /* STRING */
+    tp_aot_op(tp, f, code + 1194);
+L1198: /* MGET */
+    tp_aot_op(tp, f, code + 1198);
+L1200: /* NUMBER */
+    tp_aot_op(tp, f, code + 1200);
+L1203: /* EQ */
+    if (TP_BOTH(regs[8], regs[9], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[8].nint == regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 1203);
+    }
+L1204: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L1206;
+    }
+L1205: /* JUMP */
+    goto L1279;
+L1206: /* LINE */
+    f->line = code + 1206;
+    f->lineno = 62;
+L1213: /* VAR */
+L1216: /* STRING */
+    tp_aot_op(tp, f, code + 1216);
+L1219: /* LIST */
+    tp_aot_op(tp, f, code + 1219);
+L1220: /* LIST */
+    tp_aot_op(tp, f, code + 1220);
+L1221: /* NONE */
+    regs[11] = tp_None;
+L1222: /* NONE */
+    regs[12] = tp_None;
+L1223: /* DEF */
+    tp_aot_op(tp, f, code + 1223);
+L1274: /* STRING */
+    tp_aot_op(tp, f, code + 1274);
+L1278: /* GSET */
+    tp_set(tp, f->globals, regs[9], regs[8]);
+L1279: /* LINE */
+    f->line = code + 1279;
+    f->lineno = 65;
+L1286: /* VAR */
+L1289: /* STRING */
+    tp_aot_op(tp, f, code + 1289);
+L1293: /* STRING */
+    tp_aot_op(tp, f, code + 1293);
+L1296: /* LIST */
+    tp_aot_op(tp, f, code + 1296);
+L1297: /* LIST */
+    tp_aot_op(tp, f, code + 1297);
+L1298: /* NONE */
+    regs[12] = tp_None;
+L1299: /* NONE */
+    regs[13] = tp_None;
+L1300: /* DEF */
+    tp_aot_op(tp, f, code + 1300);
+L1377: /* STRING */
+    tp_aot_op(tp, f, code + 1377);
+L1381: /* GSET */
+    tp_set(tp, f->globals, regs[10], regs[9]);
+L1382: /* JUMP */
+    goto L1594;
+L1383: /* LINE */
+    f->line = code + 1383;
+    f->lineno = 69;
+L1386: /* LINE */
+    f->line = code + 1386;
+    f->lineno = 70;
+L1398: /* GGET */
+    tp_aot_op(tp, f, code + 1398);
+L1403: /* STRING */
+    tp_aot_op(tp, f, code + 1403);
+L1411: /* STRING */
+    tp_aot_op(tp, f, code + 1411);
+L1414: /* CALLP */
+    return code + 1414;
+L1415: /* GGET */
+    tp_aot_op(tp, f, code + 1415);
+L1420: /* UPDATE */
+    tp_aot_op(tp, f, code + 1420);
+L1421: /* LINE */
+    f->line = code + 1421;
+    f->lineno = 71;
+L1431: /* GGET */
+    tp_aot_op(tp, f, code + 1431);
+L1436: /* STRING */
+    tp_aot_op(tp, f, code + 1436);
+L1439: /* STRING */
+    tp_aot_op(tp, f, code + 1439);
+L1443: /* STRING */
+    tp_aot_op(tp, f, code + 1443);
+L1447: /* STRING */
+    tp_aot_op(tp, f, code + 1447);
+L1451: /* LIST */
+    tp_aot_op(tp, f, code + 1451);
+L1452: /* CALLP */
+    return code + 1452;
+L1453: /* GGET */
+    tp_aot_op(tp, f, code + 1453);
+L1458: /* UPDATE */
+    tp_aot_op(tp, f, code + 1458);
+L1459: /* LINE */
+    f->line = code + 1459;
+    f->lineno = 73;
+L1465: /* VAR */
+L1468: /* STRING */
+    tp_aot_op(tp, f, code + 1468);
+L1471: /* LIST */
+    tp_aot_op(tp, f, code + 1471);
+L1472: /* LIST */
+    tp_aot_op(tp, f, code + 1472);
+L1473: /* NONE */
+    regs[13] = tp_None;
+L1474: /* NONE */
+    regs[14] = tp_None;
+L1475: /* DEF */
+    tp_aot_op(tp, f, code + 1475);
+L1521: /* STRING */
+    tp_aot_op(tp, f, code + 1521);
+L1525: /* GSET */
+    tp_set(tp, f->globals, regs[11], regs[10]);
+L1526: /* LINE */
+    f->line = code + 1526;
+    f->lineno = 76;
+L1533: /* VAR */
+L1536: /* STRING */
+    tp_aot_op(tp, f, code + 1536);
+L1539: /* STRING */
+    tp_aot_op(tp, f, code + 1539);
+L1542: /* LIST */
+    tp_aot_op(tp, f, code + 1542);
+L1543: /* LIST */
+    tp_aot_op(tp, f, code + 1543);
+L1544: /* NONE */
+    regs[14] = tp_None;
+L1545: /* NONE */
+    regs[15] = tp_None;
+L1546: /* DEF */
+    tp_aot_op(tp, f, code + 1546);
+L1589: /* STRING */
+    tp_aot_op(tp, f, code + 1589);
+L1593: /* GSET */
+    tp_set(tp, f->globals, regs[12], regs[11]);
+L1594: /* EOF */
+    return code + 1594;
+}
+
+static tpd_code * _tp_tinypy_compiler_boot_133(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 30: goto L30;
+        case 32: goto L32;
+        case 35: goto L35;
+        case 36: goto L36;
+        case 43: goto L43;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 50: goto L50;
+        case 62: goto L62;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 72: goto L72;
+        case 73: goto L73;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 91: goto L91;
+        case 92: goto L92;
+        case 93: goto L93;
+        case 94: goto L94;
+        case 100: goto L100;
+        case 101: goto L101;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 9;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 11;
+L30: /* VAR */
+L32: /* STRING */
+    tp_aot_op(tp, f, code + 32);
+L35: /* MOVE */
+    regs[1] = regs[2];
+L36: /* LINE */
+    f->line = code + 36;
+    f->lineno = 12;
+L43: /* NUMBER */
+    tp_aot_op(tp, f, code + 43);
+L46: /* ITER */
+    if (tp_iter_next(tp, &regs[2], regs[0], &regs[3])) {
+        goto L48;
+    }
+L47: /* JUMP */
+    goto L94;
+L48: /* VAR */
+L50: /* LINE */
+    f->line = code + 50;
+    f->lineno = 14;
+L62: /* GGET */
+    tp_aot_op(tp, f, code + 62);
+L67: /* MOVE */
+    regs[5] = regs[2];
+L68: /* GGET */
+    tp_aot_op(tp, f, code + 68);
+L72: /* CALLP */
+    return code + 72;
+L73: /* IFN */
+    if (!(TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4]))) {
+        goto L75;
+    }
+L74: /* JUMP */
+    goto L84;
+L75: /* LINE */
+    f->line = code + 75;
+    f->lineno = 15;
+L82: /* NONE */
+    regs[2] = tp_None;
+L83: /* RAISE */
+    return code + 83;
+L84: /* LINE */
+    f->line = code + 84;
+    f->lineno = 17;
+L91: /* ADD */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[2] = tp_int(regs[1].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 91);
+    }
+L92: /* MOVE */
+    regs[1] = regs[2];
+L93: /* JUMP */
+    tp_aot_safepoint(tp, 47);
+    goto L46;
+L94: /* LINE */
+    f->line = code + 94;
+    f->lineno = 18;
+L100: /* RETURN */
+    return code + 100;
+L101: /* EOF */
+    return code + 101;
+}
+
+static tpd_code * _tp_tinypy_compiler_boot_260(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 12: goto L12;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 35: goto L35;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 58: goto L58;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 65: goto L65;
+        case 66: goto L66;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 81: goto L81;
+        case 84: goto L84;
+        case 85: goto L85;
+        case 86: goto L86;
+        case 87: goto L87;
+        case 91: goto L91;
+        case 92: goto L92;
+        case 93: goto L93;
+        case 94: goto L94;
+        case 95: goto L95;
+        case 96: goto L96;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 20;
+L8: /* VAR */
+L10: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L20: /* FILE */
+    f->fname = regs[2];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L25: /* NAME */
+    f->name = regs[2];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 21;
+L35: /* GGET */
+    tp_aot_op(tp, f, code + 35);
+L40: /* MOVE */
+    regs[4] = regs[0];
+L41: /* GGET */
+    tp_aot_op(tp, f, code + 41);
+L45: /* CALLP */
+    return code + 45;
+L46: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L48;
+    }
+L47: /* JUMP */
+    goto L69;
+L48: /* LINE */
+    f->line = code + 48;
+    f->lineno = 22;
+L58: /* NUMBER */
+    tp_aot_op(tp, f, code + 58);
+L61: /* ITER */
+    if (tp_iter_next(tp, &regs[2], regs[1], &regs[3])) {
+        goto L63;
+    }
+L62: /* JUMP */
+    goto L96;
+L63: /* VAR */
+L65: /* MOVE */
+    regs[4] = regs[2];
+L66: /* GET */
+    regs[2] = tp_get(tp, regs[1], regs[4]);
+    tp_grey(tp, regs[2]);
+L67: /* SET */
+    tp_set(tp, regs[0], regs[4], regs[2]);
+L68: /* JUMP */
+    tp_aot_safepoint(tp, 7);
+    goto L61;
+L69: /* LINE */
+    f->line = code + 69;
+    f->lineno = 24;
+L81: /* NUMBER */
+    tp_aot_op(tp, f, code + 81);
+L84: /* ITER */
+    if (tp_iter_next(tp, &regs[2], regs[1], &regs[3])) {
+        goto L86;
+    }
+L85: /* JUMP */
+    goto L96;
+L86: /* MOVE */
+    regs[4] = regs[2];
+L87: /* GGET */
+    tp_aot_op(tp, f, code + 87);
+L91: /* MOVE */
+    regs[6] = regs[0];
+L92: /* MOVE */
+    regs[7] = regs[4];
+L93: /* GET */
+    regs[8] = tp_get(tp, regs[1], regs[4]);
+    tp_grey(tp, regs[8]);
+L94: /* CALLP */
+    return code + 94;
+L95: /* JUMP */
+    tp_aot_safepoint(tp, 11);
+    goto L84;
+L96: /* EOF */
+    return code + 96;
+}
+
+static tpd_code * _tp_tinypy_compiler_boot_379(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 35: goto L35;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 54: goto L54;
+        case 55: goto L55;
+        case 56: goto L56;
+        case 63: goto L63;
+        case 66: goto L66;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 77: goto L77;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 89: goto L89;
+        case 98: goto L98;
+        case 101: goto L101;
+        case 104: goto L104;
+        case 105: goto L105;
+        case 106: goto L106;
+        case 109: goto L109;
+        case 110: goto L110;
+        case 111: goto L111;
+        case 112: goto L112;
+        case 123: goto L123;
+        case 126: goto L126;
+        case 129: goto L129;
+        case 130: goto L130;
+        case 131: goto L131;
+        case 132: goto L132;
+        case 135: goto L135;
+        case 136: goto L136;
+        case 137: goto L137;
+        case 145: goto L145;
+        case 148: goto L148;
+        case 149: goto L149;
+        case 150: goto L150;
+        case 151: goto L151;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 26;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 27;
+L35: /* GGET */
+    tp_aot_op(tp, f, code + 35);
+L40: /* MOVE */
+    regs[4] = regs[0];
+L41: /* GGET */
+    tp_aot_op(tp, f, code + 41);
+L45: /* CALLP */
+    return code + 45;
+L46: /* IFN */
+    if (!(TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2]))) {
+        goto L48;
+    }
+L47: /* JUMP */
+    goto L56;
+L48: /* LINE */
+    f->line = code + 48;
+    f->lineno = 28;
+L54: /* NONE */
+    regs[1] = tp_None;
+L55: /* RAISE */
+    return code + 55;
+L56: /* LINE */
+    f->line = code + 56;
+    f->lineno = 29;
+L63: /* STRING */
+    tp_aot_op(tp, f, code + 63);
+L66: /* IN */
+    regs[1] = tp_has(tp, regs[0], regs[1]);
+L67: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L69;
+    }
+L68: /* JUMP */
+    goto L84;
+L69: /* LINE */
+    f->line = code + 69;
+    f->lineno = 30;
+L77: /* GGET */
+    tp_aot_op(tp, f, code + 77);
+L81: /* MOVE */
+    regs[3] = regs[0];
+L82: /* CALLP */
+    return code + 82;
+L83: /* RETURN */
+    return code + 83;
+L84: /* LINE */
+    f->line = code + 84;
+    f->lineno = 31;
+L89: /* LINE */
+    f->line = code + 89;
+    f->lineno = 32;
+L98: /* NUMBER */
+    tp_aot_op(tp, f, code + 98);
+L101: /* NUMBER */
+    tp_aot_op(tp, f, code + 101);
+L104: /* LIST */
+    tp_aot_op(tp, f, code + 104);
+L105: /* GET */
+    regs[1] = tp_get(tp, regs[0], regs[2]);
+    tp_grey(tp, regs[1]);
+L106: /* STRING */
+    tp_aot_op(tp, f, code + 106);
+L109: /* EQ */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[1].nint == regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 109);
+    }
+L110: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L112;
+    }
+L111: /* JUMP */
+    goto L137;
+L112: /* LINE */
+    f->line = code + 112;
+    f->lineno = 33;
+L123: /* GGET */
+    tp_aot_op(tp, f, code + 123);
+L126: /* NUMBER */
+    tp_aot_op(tp, f, code + 126);
+L129: /* NONE */
+    regs[4] = tp_None;
+L130: /* LIST */
+    tp_aot_op(tp, f, code + 130);
+L131: /* GET */
+    regs[3] = tp_get(tp, regs[0], regs[5]);
+    tp_grey(tp, regs[3]);
+L132: /* NUMBER */
+    tp_aot_op(tp, f, code + 132);
+L135: /* CALLP */
+    return code + 135;
+L136: /* RETURN */
+    return code + 136;
+L137: /* LINE */
+    f->line = code + 137;
+    f->lineno = 34;
+L145: /* GGET */
+    tp_aot_op(tp, f, code + 145);
+L148: /* MOVE */
+    regs[3] = regs[0];
+L149: /* CALLP */
+    return code + 149;
+L150: /* RETURN */
+    return code + 150;
+L151: /* EOF */
+    return code + 151;
+}
+
+static tpd_code * _tp_tinypy_compiler_boot_557(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 26: goto L26;
+        case 27: goto L27;
+        case 41: goto L41;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 80: goto L80;
+        case 84: goto L84;
+        case 85: goto L85;
+        case 86: goto L86;
+        case 87: goto L87;
+        case 92: goto L92;
+        case 93: goto L93;
+        case 97: goto L97;
+        case 98: goto L98;
+        case 99: goto L99;
+        case 100: goto L100;
+        case 105: goto L105;
+        case 106: goto L106;
+        case 110: goto L110;
+        case 111: goto L111;
+        case 112: goto L112;
+        case 126: goto L126;
+        case 130: goto L130;
+        case 131: goto L131;
+        case 132: goto L132;
+        case 133: goto L133;
+        case 138: goto L138;
+        case 139: goto L139;
+        case 143: goto L143;
+        case 144: goto L144;
+        case 145: goto L145;
+        case 166: goto L166;
+        case 170: goto L170;
+        case 171: goto L171;
+        case 172: goto L172;
+        case 173: goto L173;
+        case 178: goto L178;
+        case 179: goto L179;
+        case 183: goto L183;
+        case 184: goto L184;
+        case 185: goto L185;
+        case 186: goto L186;
+        case 191: goto L191;
+        case 192: goto L192;
+        case 195: goto L195;
+        case 196: goto L196;
+        case 197: goto L197;
+        case 203: goto L203;
+        case 206: goto L206;
+        case 207: goto L207;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 36;
+L9: /* VAR */
+L11: /* VAR */
+L13: /* STRING */
+    tp_aot_op(tp, f, code + 13);
+L21: /* FILE */
+    f->fname = regs[2];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L26: /* NAME */
+    f->name = regs[2];
+L27: /* LINE */
+    f->line = code + 27;
+    f->lineno = 37;
+L41: /* STRING */
+    tp_aot_op(tp, f, code + 41);
+L45: /* EQ */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[1].nint == regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 45);
+    }
+L46: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L48;
+    }
+L47: /* JUMP */
+    goto L59;
+L48: /* GGET */
+    tp_aot_op(tp, f, code + 48);
+L53: /* MOVE */
+    regs[3] = regs[0];
+L54: /* GGET */
+    tp_aot_op(tp, f, code + 54);
+L57: /* CALLP */
+    return code + 57;
+L58: /* RETURN */
+    return code + 58;
+L59: /* LINE */
+    f->line = code + 59;
+    f->lineno = 38;
+L80: /* STRING */
+    tp_aot_op(tp, f, code + 80);
+L84: /* EQ */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[1].nint == regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 84);
+    }
+L85: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L87;
+    }
+L86: /* JUMP */
+    goto L112;
+L87: /* GGET */
+    tp_aot_op(tp, f, code + 87);
+L92: /* MOVE */
+    regs[3] = regs[0];
+L93: /* GGET */
+    tp_aot_op(tp, f, code + 93);
+L97: /* CALLP */
+    return code + 97;
+L98: /* IFN */
+    if (!(TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2]))) {
+        goto L100;
+    }
+L99: /* JUMP */
+    goto L111;
+L100: /* GGET */
+    tp_aot_op(tp, f, code + 100);
+L105: /* MOVE */
+    regs[3] = regs[0];
+L106: /* GGET */
+    tp_aot_op(tp, f, code + 106);
+L110: /* CALLP */
+    return code + 110;
+L111: /* RETURN */
+    return code + 111;
+L112: /* LINE */
+    f->line = code + 112;
+    f->lineno = 39;
+L126: /* STRING */
+    tp_aot_op(tp, f, code + 126);
+L130: /* EQ */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[1].nint == regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 130);
+    }
+L131: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L133;
+    }
+L132: /* JUMP */
+    goto L145;
+L133: /* GGET */
+    tp_aot_op(tp, f, code + 133);
+L138: /* MOVE */
+    regs[3] = regs[0];
+L139: /* GGET */
+    tp_aot_op(tp, f, code + 139);
+L143: /* CALLP */
+    return code + 143;
+L144: /* RETURN */
+    return code + 144;
+L145: /* LINE */
+    f->line = code + 145;
+    f->lineno = 40;
+L166: /* STRING */
+    tp_aot_op(tp, f, code + 166);
+L170: /* EQ */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[1].nint == regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 170);
+    }
+L171: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L173;
+    }
+L172: /* JUMP */
+    goto L197;
+L173: /* GGET */
+    tp_aot_op(tp, f, code + 173);
+L178: /* MOVE */
+    regs[3] = regs[0];
+L179: /* GGET */
+    tp_aot_op(tp, f, code + 179);
+L183: /* CALLP */
+    return code + 183;
+L184: /* IFN */
+    if (!(TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2]))) {
+        goto L186;
+    }
+L185: /* JUMP */
+    goto L196;
+L186: /* GGET */
+    tp_aot_op(tp, f, code + 186);
+L191: /* MOVE */
+    regs[3] = regs[0];
+L192: /* GGET */
+    tp_aot_op(tp, f, code + 192);
+L195: /* CALLP */
+    return code + 195;
+L196: /* RETURN */
+    return code + 196;
+L197: /* LINE */
+    f->line = code + 197;
+    f->lineno = 41;
+L203: /* STRING */
+    tp_aot_op(tp, f, code + 203);
+L206: /* RAISE */
+    return code + 206;
+L207: /* EOF */
+    return code + 207;
+}
+
+static tpd_code * _tp_tinypy_compiler_boot_793(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 10: goto L10;
+        case 13: goto L13;
+        case 15: goto L15;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 28: goto L28;
+        case 29: goto L29;
+        case 40: goto L40;
+        case 44: goto L44;
+        case 48: goto L48;
+        case 50: goto L50;
+        case 51: goto L51;
+        case 52: goto L52;
+        case 53: goto L53;
+        case 54: goto L54;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 43;
+L10: /* VAR */
+L13: /* VAR */
+L15: /* STRING */
+    tp_aot_op(tp, f, code + 15);
+L23: /* FILE */
+    f->fname = regs[2];
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L28: /* NAME */
+    f->name = regs[2];
+L29: /* LINE */
+    f->line = code + 29;
+    f->lineno = 44;
+L40: /* GGET */
+    tp_aot_op(tp, f, code + 40);
+L44: /* STRING */
+    tp_aot_op(tp, f, code + 44);
+L48: /* METHOD */
+    tp_aot_op(tp, f, code + 48);
+L50: /* MOVE */
+    regs[6] = regs[0];
+L51: /* MOVE */
+    regs[7] = regs[1];
+L52: /* CALLM */
+    return code + 52;
+L53: /* RETURN */
+    return code + 53;
+L54: /* EOF */
+    return code + 54;
+}
+
+static tpd_code * _tp_tinypy_compiler_boot_876(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 10: goto L10;
+        case 13: goto L13;
+        case 15: goto L15;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 28: goto L28;
+        case 29: goto L29;
+        case 41: goto L41;
+        case 45: goto L45;
+        case 49: goto L49;
+        case 51: goto L51;
+        case 52: goto L52;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 59: goto L59;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 46;
+L10: /* VAR */
+L13: /* VAR */
+L15: /* STRING */
+    tp_aot_op(tp, f, code + 15);
+L23: /* FILE */
+    f->fname = regs[2];
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L28: /* NAME */
+    f->name = regs[2];
+L29: /* LINE */
+    f->line = code + 29;
+    f->lineno = 47;
+L41: /* GGET */
+    tp_aot_op(tp, f, code + 41);
+L45: /* STRING */
+    tp_aot_op(tp, f, code + 45);
+L49: /* METHOD */
+    tp_aot_op(tp, f, code + 49);
+L51: /* MOVE */
+    regs[6] = regs[0];
+L52: /* MOVE */
+    regs[7] = regs[1];
+L53: /* CALLM */
+    return code + 53;
+L54: /* NUMBER */
+    tp_aot_op(tp, f, code + 54);
+L57: /* GET */
+    regs[2] = tp_get(tp, regs[2], regs[4]);
+    tp_grey(tp, regs[2]);
+L58: /* RETURN */
+    return code + 58;
+L59: /* EOF */
+    return code + 59;
+}
+
+static tpd_code * _tp_tinypy_compiler_boot_960(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 12: goto L12;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 35: goto L35;
+        case 37: goto L37;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 55: goto L55;
+        case 57: goto L57;
+        case 61: goto L61;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 68: goto L68;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 77: goto L77;
+        case 81: goto L81;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 90: goto L90;
+        case 91: goto L91;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 49;
+L9: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L20: /* FILE */
+    f->fname = regs[1];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 50;
+L35: /* VAR */
+L37: /* GGET */
+    tp_aot_op(tp, f, code + 37);
+L41: /* MOVE */
+    regs[2] = regs[0];
+L42: /* STRING */
+    tp_aot_op(tp, f, code + 42);
+L45: /* CALLP */
+    return code + 45;
+L46: /* LINE */
+    f->line = code + 46;
+    f->lineno = 51;
+L55: /* VAR */
+L57: /* STRING */
+    tp_aot_op(tp, f, code + 57);
+L61: /* METHOD */
+    tp_aot_op(tp, f, code + 61);
+L63: /* CALLM */
+    return code + 63;
+L64: /* STRING */
+    tp_aot_op(tp, f, code + 64);
+L68: /* METHOD */
+    tp_aot_op(tp, f, code + 68);
+L70: /* CALLM */
+    return code + 70;
+L71: /* LINE */
+    f->line = code + 71;
+    f->lineno = 52;
+L77: /* STRING */
+    tp_aot_op(tp, f, code + 77);
+L81: /* METHOD */
+    tp_aot_op(tp, f, code + 81);
+L83: /* CALLM */
+    return code + 83;
+L84: /* LINE */
+    f->line = code + 84;
+    f->lineno = 53;
+L90: /* RETURN */
+    return code + 90;
+L91: /* EOF */
+    return code + 91;
+}
+
+static tpd_code * _tp_tinypy_compiler_boot_1076(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 12: goto L12;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 35: goto L35;
+        case 37: goto L37;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 55: goto L55;
+        case 57: goto L57;
+        case 61: goto L61;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 68: goto L68;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 77: goto L77;
+        case 81: goto L81;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 90: goto L90;
+        case 91: goto L91;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 55;
+L9: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L20: /* FILE */
+    f->fname = regs[1];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 56;
+L35: /* VAR */
+L37: /* GGET */
+    tp_aot_op(tp, f, code + 37);
+L41: /* MOVE */
+    regs[2] = regs[0];
+L42: /* STRING */
+    tp_aot_op(tp, f, code + 42);
+L45: /* CALLP */
+    return code + 45;
+L46: /* LINE */
+    f->line = code + 46;
+    f->lineno = 57;
+L55: /* VAR */
+L57: /* STRING */
+    tp_aot_op(tp, f, code + 57);
+L61: /* METHOD */
+    tp_aot_op(tp, f, code + 61);
+L63: /* CALLM */
+    return code + 63;
+L64: /* STRING */
+    tp_aot_op(tp, f, code + 64);
+L68: /* METHOD */
+    tp_aot_op(tp, f, code + 68);
+L70: /* CALLM */
+    return code + 70;
+L71: /* LINE */
+    f->line = code + 71;
+    f->lineno = 58;
+L77: /* STRING */
+    tp_aot_op(tp, f, code + 77);
+L81: /* METHOD */
+    tp_aot_op(tp, f, code + 81);
+L83: /* CALLM */
+    return code + 83;
+L84: /* LINE */
+    f->line = code + 84;
+    f->lineno = 59;
+L90: /* RETURN */
+    return code + 90;
+L91: /* EOF */
+    return code + 91;
+}
+
+static tpd_code * _tp_tinypy_compiler_boot_1224(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 24: goto L24;
+        case 25: goto L25;
+        case 36: goto L36;
+        case 40: goto L40;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 49: goto L49;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 62;
+L9: /* VAR */
+L11: /* STRING */
+    tp_aot_op(tp, f, code + 11);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L24: /* NAME */
+    f->name = regs[1];
+L25: /* LINE */
+    f->line = code + 25;
+    f->lineno = 63;
+L36: /* GGET */
+    tp_aot_op(tp, f, code + 36);
+L40: /* GGET */
+    tp_aot_op(tp, f, code + 40);
+L45: /* MOVE */
+    regs[3] = regs[0];
+L46: /* CALLP */
+    return code + 46;
+L47: /* CALLP */
+    return code + 47;
+L48: /* RETURN */
+    return code + 48;
+L49: /* EOF */
+    return code + 49;
+}
+
+static tpd_code * _tp_tinypy_compiler_boot_1301(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 12: goto L12;
+        case 14: goto L14;
+        case 22: goto L22;
+        case 23: goto L23;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 37: goto L37;
+        case 39: goto L39;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 54: goto L54;
+        case 58: goto L58;
+        case 60: goto L60;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 68: goto L68;
+        case 72: goto L72;
+        case 74: goto L74;
+        case 75: goto L75;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 65;
+L9: /* VAR */
+L12: /* VAR */
+L14: /* STRING */
+    tp_aot_op(tp, f, code + 14);
+L22: /* FILE */
+    f->fname = regs[2];
+L23: /* STRING */
+    tp_aot_op(tp, f, code + 23);
+L27: /* NAME */
+    f->name = regs[2];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 66;
+L37: /* VAR */
+L39: /* GGET */
+    tp_aot_op(tp, f, code + 39);
+L43: /* MOVE */
+    regs[4] = regs[0];
+L44: /* STRING */
+    tp_aot_op(tp, f, code + 44);
+L47: /* CALLP */
+    return code + 47;
+L48: /* LINE */
+    f->line = code + 48;
+    f->lineno = 67;
+L54: /* STRING */
+    tp_aot_op(tp, f, code + 54);
+L58: /* METHOD */
+    tp_aot_op(tp, f, code + 58);
+L60: /* MOVE */
+    regs[5] = regs[1];
+L61: /* CALLM */
+    return code + 61;
+L62: /* LINE */
+    f->line = code + 62;
+    f->lineno = 68;
+L68: /* STRING */
+    tp_aot_op(tp, f, code + 68);
+L72: /* METHOD */
+    tp_aot_op(tp, f, code + 72);
+L74: /* CALLM */
+    return code + 74;
+L75: /* EOF */
+    return code + 75;
+}
+
+static tpd_code * _tp_tinypy_compiler_boot_1476(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 32: goto L32;
+        case 35: goto L35;
+        case 39: goto L39;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 44: goto L44;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 73;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 74;
+L32: /* STRING */
+    tp_aot_op(tp, f, code + 32);
+L35: /* STRING */
+    tp_aot_op(tp, f, code + 35);
+L39: /* METHOD */
+    tp_aot_op(tp, f, code + 39);
+L41: /* MOVE */
+    regs[5] = regs[0];
+L42: /* CALLM */
+    return code + 42;
+L43: /* RETURN */
+    return code + 43;
+L44: /* EOF */
+    return code + 44;
+}
+
+static tpd_code * _tp_tinypy_compiler_boot_1547(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 26: goto L26;
+        case 27: goto L27;
+        case 33: goto L33;
+        case 37: goto L37;
+        case 39: goto L39;
+        case 40: goto L40;
+        case 41: goto L41;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 76;
+L9: /* VAR */
+L11: /* VAR */
+L13: /* STRING */
+    tp_aot_op(tp, f, code + 13);
+L21: /* FILE */
+    f->fname = regs[2];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L26: /* NAME */
+    f->name = regs[2];
+L27: /* LINE */
+    f->line = code + 27;
+    f->lineno = 77;
+L33: /* STRING */
+    tp_aot_op(tp, f, code + 33);
+L37: /* METHOD */
+    tp_aot_op(tp, f, code + 37);
+L39: /* MOVE */
+    regs[5] = regs[1];
+L40: /* CALLM */
+    return code + 40;
+L41: /* EOF */
+    return code + 41;
+}
+
+static const tpd_aot _tp_tinypy_compiler_boot_aot[] = {
+    {0, _tp_tinypy_compiler_boot_0},
+    {133, _tp_tinypy_compiler_boot_133},
+    {260, _tp_tinypy_compiler_boot_260},
+    {379, _tp_tinypy_compiler_boot_379},
+    {557, _tp_tinypy_compiler_boot_557},
+    {793, _tp_tinypy_compiler_boot_793},
+    {876, _tp_tinypy_compiler_boot_876},
+    {960, _tp_tinypy_compiler_boot_960},
+    {1076, _tp_tinypy_compiler_boot_1076},
+    {1224, _tp_tinypy_compiler_boot_1224},
+    {1301, _tp_tinypy_compiler_boot_1301},
+    {1476, _tp_tinypy_compiler_boot_1476},
+    {1547, _tp_tinypy_compiler_boot_1547},
+};
+
+void tinypy_compiler_boot_init(TP) {
+    tp_aot_import(tp, "tinypy.compiler.boot", _tp_tinypy_compiler_boot_tpc, sizeof(_tp_tinypy_compiler_boot_tpc),
+        _tp_tinypy_compiler_boot_aot, 13);
+}
@@ -30,7 +30,9 @@ def ord_or_int(x):
     except:
         return int(x)
 
-def disassemble(bc):
+def disassemble(bc, counts=None):
+    # counts, if given, has the number of runs of each word of bc; they go
+    # in front of the instructions.
     bc = [ord_or_int(x) for x in bc]
     asmc = []
     ip = 0
@@ -38,6 +40,8 @@ def disassemble(bc):
     while ip < len(bc):
         i, a, b, c = bc[ip:ip + 4]
         line = ""
+        if counts is not None:
+            line += pad(str(counts[int(ip / 4)]), -10) + " "
         line += pad(str(ip), 4) + ":" 
         line += pad(names[i], 10) + ":" 
         line += " " + pad(str(a), -3)
@@ -54,15 +58,25 @@ def disassemble(bc):
             line += " " + str(a) + ": " + str(text(n,ip,bc))
             line = trim(line)
             ip += (int(n / 4) + 1) * 4
-        elif i == opcodes.STRING:
-            n = b * 256 + c
+        elif i == opcodes.REGS or i == opcodes.MGET or i == opcodes.METHOD:
+            # the next word is the number of MGET caches, or the cache.
+            n = bc[ip + 2] * 256 + bc[ip + 3]
+            line += " " + str(n)
+            ip += 4
+        elif i == opcodes.STRING or i == opcodes.GGET:
+            # b, c is the constant slot; the length follows.
+            n = bc[ip + 2] * 256 + bc[ip + 3]
+            ip += 4
             line += " " + str(text(n,ip,bc))
             line = trim(line)
             ip += (int(n / 4) + 1) * 4
         elif i == opcodes.NUMBER:
-            f = unpack('=' + chr(b), text(c,ip,bc))
+            # b, c is the constant slot; format and size follow.
+            fmt, n = bc[ip + 2], bc[ip + 3]
+            ip += 4
+            f = unpack('=' + chr(fmt), text(n,ip,bc))
             line += " " + str(f)
-            ip += c
+            ip += n
         asmc.append(line)
         print(line)
     asmc = "\n".join(asmc)
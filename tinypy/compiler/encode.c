@@ -0,0 +1,25803 @@
+/* Generated from tinypy/compiler/encode.py with tpc -a. Do not modify. */
+#include <tinypy/tp.h>
+
+static unsigned char _tp_tinypy_compiler_encode_tpc[] = {
+0x2d,0x72,0x00,0x9d,0x00,0x00,0x00,0x00,0x1f,0x0b,0x00,0x01,0x69,0x6d,0x70,0x6f,
+0x72,0x74,0x20,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,
+0x65,0x72,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x20,0x61,0x73,0x20,0x74,
+0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x00,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x00,0x00,0x00,
+0x0d,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x3f,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
+0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x0a,0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,
+0x5f,0x5f,0x00,0x00,0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2e,0x74,0x6f,0x6b,0x65,
+0x6e,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x1d,0x03,0x00,0x00,0x37,0x00,0x01,0x03,
+0x0d,0x01,0x00,0x04,0x00,0x00,0x00,0x08,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,
+0x00,0x00,0x00,0x00,0x0f,0x01,0x00,0x00,0x1f,0x0b,0x00,0x02,0x66,0x72,0x6f,0x6d,
+0x20,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,
+0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x20,0x69,0x6d,0x70,0x6f,0x72,0x74,
+0x20,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x0a,
+0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,0x5f,0x5f,0x00,0x00,0x0d,0x02,0x00,0x03,
+0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,
+0x0d,0x04,0x00,0x05,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x1c,0x03,0x04,0x01,0x37,0x00,0x01,0x03,0x0e,0x01,0x00,0x06,0x00,0x00,0x00,0x08,
+0x5f,0x5f,0x64,0x69,0x63,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,0x32,0x01,0x00,0x00,
+0x1f,0x09,0x00,0x03,0x66,0x72,0x6f,0x6d,0x20,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,
+0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2e,0x62,0x6f,0x6f,0x74,0x20,0x69,0x6d,
+0x70,0x6f,0x72,0x74,0x20,0x2a,0x00,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x0a,
+0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,0x5f,0x5f,0x00,0x00,0x0d,0x02,0x00,0x07,
+0x00,0x00,0x00,0x14,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2e,0x62,0x6f,0x6f,0x74,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x08,
+0x00,0x00,0x00,0x01,0x2a,0x00,0x00,0x00,0x37,0x00,0x01,0x03,0x0e,0x01,0x00,0x06,
+0x00,0x00,0x00,0x08,0x5f,0x5f,0x64,0x69,0x63,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,
+0x32,0x01,0x00,0x00,0x1f,0x0a,0x00,0x04,0x66,0x72,0x6f,0x6d,0x20,0x74,0x69,0x6e,
+0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2e,0x6f,0x70,0x63,
+0x6f,0x64,0x65,0x73,0x20,0x69,0x6d,0x70,0x6f,0x72,0x74,0x20,0x2a,0x00,0x00,0x00,
+0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x0a,0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,
+0x5f,0x5f,0x00,0x00,0x0d,0x02,0x00,0x09,0x00,0x00,0x00,0x17,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2e,0x6f,0x70,0x63,0x6f,
+0x64,0x65,0x73,0x00,0x0d,0x03,0x00,0x08,0x00,0x00,0x00,0x01,0x2a,0x00,0x00,0x00,
+0x37,0x00,0x01,0x03,0x0e,0x01,0x00,0x06,0x00,0x00,0x00,0x08,0x5f,0x5f,0x64,0x69,
+0x63,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,0x32,0x01,0x00,0x00,0x1f,0x0b,0x00,0x05,
+0x69,0x6d,0x70,0x6f,0x72,0x74,0x20,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,
+0x6d,0x70,0x69,0x6c,0x65,0x72,0x2e,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x20,
+0x61,0x73,0x20,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x00,0x0e,0x01,0x00,0x02,
+0x00,0x00,0x00,0x0a,0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,0x5f,0x5f,0x00,0x00,
+0x0d,0x02,0x00,0x0a,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2e,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,
+0x00,0x00,0x00,0x00,0x1d,0x03,0x00,0x00,0x37,0x00,0x01,0x03,0x0d,0x01,0x00,0x0b,
+0x00,0x00,0x00,0x08,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x00,0x00,0x00,0x00,
+0x0f,0x01,0x00,0x00,0x1f,0x0b,0x00,0x06,0x69,0x6d,0x70,0x6f,0x72,0x74,0x20,0x74,
+0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2e,0x72,
+0x65,0x67,0x61,0x6c,0x6c,0x6f,0x63,0x20,0x61,0x73,0x20,0x72,0x65,0x67,0x61,0x6c,
+0x6c,0x6f,0x63,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x0a,0x5f,0x5f,0x69,0x6d,
+0x70,0x6f,0x72,0x74,0x5f,0x5f,0x00,0x00,0x0d,0x02,0x00,0x0c,0x00,0x00,0x00,0x18,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2e,
+0x72,0x65,0x67,0x61,0x6c,0x6c,0x6f,0x63,0x00,0x00,0x00,0x00,0x1d,0x03,0x00,0x00,
+0x37,0x00,0x01,0x03,0x0d,0x01,0x00,0x0d,0x00,0x00,0x00,0x08,0x72,0x65,0x67,0x61,
+0x6c,0x6c,0x6f,0x63,0x00,0x00,0x00,0x00,0x0f,0x01,0x00,0x00,0x1f,0x04,0x00,0x08,
+0x63,0x6c,0x61,0x73,0x73,0x20,0x44,0x53,0x74,0x61,0x74,0x65,0x3a,0x00,0x00,0x00,
+0x34,0x00,0x00,0x00,0x33,0x00,0x00,0x04,0x2a,0x24,0x33,0x33,0x00,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x0e,0x00,0x00,0x00,0x06,0x44,0x53,0x74,0x61,0x74,0x65,0x00,0x00,
+0x0f,0x01,0x00,0x00,0x0e,0x02,0x00,0x0f,0x00,0x00,0x00,0x07,0x73,0x65,0x74,0x6d,
+0x65,0x74,0x61,0x00,0x10,0x03,0x00,0x00,0x0e,0x04,0x00,0x10,0x00,0x00,0x00,0x06,
+0x6f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x37,0x01,0x02,0x03,0x33,0x00,0x00,0x04,
+0x2a,0x24,0x33,0x39,0x00,0x00,0x00,0x00,0x1c,0x01,0x00,0x00,0x1c,0x02,0x00,0x00,
+0x1d,0x03,0x00,0x00,0x1d,0x04,0x00,0x00,0x11,0x00,0x04,0xca,0x2d,0x09,0x00,0x0b,
+0x00,0x00,0x00,0x00,0x1f,0x04,0x00,0x08,0x63,0x6c,0x61,0x73,0x73,0x20,0x44,0x53,
+0x74,0x61,0x74,0x65,0x3a,0x00,0x00,0x00,0x1f,0x09,0x00,0x09,0x20,0x20,0x20,0x20,
+0x64,0x65,0x66,0x20,0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,0x28,0x73,0x65,0x6c,
+0x66,0x2c,0x63,0x6f,0x64,0x65,0x2c,0x66,0x6e,0x61,0x6d,0x65,0x29,0x3a,0x00,0x00,
+0x33,0x00,0x00,0x03,0x2a,0x24,0x30,0x00,0x0d,0x05,0x00,0x00,0x00,0x00,0x00,0x04,
+0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x01,0x00,0x00,0x00,0x04,
+0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0d,0x07,0x00,0x02,0x00,0x00,0x00,0x05,
+0x66,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x1c,0x01,0x05,0x03,0x1c,0x02,0x00,0x00,
+0x1d,0x03,0x00,0x00,0x1d,0x04,0x00,0x00,0x11,0x00,0x00,0xca,0x2d,0x08,0x00,0x12,
+0x00,0x00,0x00,0x02,0x1f,0x09,0x00,0x09,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,
+0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,0x28,0x73,0x65,0x6c,0x66,0x2c,0x63,0x6f,
+0x64,0x65,0x2c,0x66,0x6e,0x61,0x6d,0x65,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x04,
+0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x04,0x63,0x6f,0x64,0x65,
+0x00,0x00,0x00,0x00,0x33,0x02,0x00,0x05,0x66,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x03,0x00,0x00,0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x08,
+0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,0x23,0x03,0x00,0x00,
+0x1f,0x07,0x00,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,
+0x2e,0x6e,0x6f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x46,0x61,0x6c,0x73,0x65,0x00,0x00,
+0x0c,0x03,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x03,
+0x00,0x00,0x00,0x05,0x6e,0x6f,0x70,0x6f,0x73,0x00,0x00,0x00,0x0b,0x00,0x04,0x03,
+0x1f,0x0b,0x00,0x0b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,
+0x2e,0x63,0x6f,0x64,0x65,0x2c,0x20,0x73,0x65,0x6c,0x66,0x2e,0x66,0x6e,0x61,0x6d,
+0x65,0x20,0x3d,0x20,0x63,0x6f,0x64,0x65,0x2c,0x66,0x6e,0x61,0x6d,0x65,0x00,0x00,
+0x10,0x03,0x01,0x00,0x10,0x04,0x02,0x00,0x0d,0x05,0x00,0x04,0x00,0x00,0x00,0x04,
+0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0b,0x00,0x05,0x03,0x0d,0x03,0x00,0x05,
+0x00,0x00,0x00,0x05,0x66,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x0b,0x00,0x03,0x04,
+0x1f,0x0b,0x00,0x0c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,
+0x2e,0x6c,0x69,0x6e,0x65,0x73,0x20,0x3d,0x20,0x73,0x65,0x6c,0x66,0x2e,0x63,0x6f,
+0x64,0x65,0x2e,0x73,0x70,0x6c,0x69,0x74,0x28,0x27,0x5c,0x6e,0x27,0x29,0x00,0x00,
+0x0d,0x02,0x00,0x04,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,
+0x09,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x06,0x00,0x00,0x00,0x05,
+0x73,0x70,0x6c,0x69,0x74,0x00,0x00,0x00,0x38,0x04,0x01,0x02,0x00,0x00,0x00,0x01,
+0x0d,0x06,0x00,0x07,0x00,0x00,0x00,0x01,0x0a,0x00,0x00,0x00,0x39,0x03,0x04,0x03,
+0x0d,0x04,0x00,0x08,0x00,0x00,0x00,0x05,0x6c,0x69,0x6e,0x65,0x73,0x00,0x00,0x00,
+0x0b,0x00,0x04,0x03,0x1f,0x1b,0x00,0x0e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x73,0x65,0x6c,0x66,0x2e,0x73,0x74,0x61,0x63,0x6b,0x2c,0x73,0x65,0x6c,0x66,0x2e,
+0x6f,0x75,0x74,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x5f,0x73,0x63,0x6f,0x70,0x65,0x69,
+0x2c,0x73,0x65,0x6c,0x66,0x2e,0x74,0x73,0x74,0x61,0x63,0x6b,0x2c,0x73,0x65,0x6c,
+0x66,0x2e,0x5f,0x74,0x61,0x67,0x69,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x64,0x61,0x74,
+0x61,0x20,0x3d,0x20,0x5b,0x5d,0x2c,0x5b,0x28,0x27,0x74,0x61,0x67,0x27,0x2c,0x27,
+0x45,0x4f,0x46,0x27,0x29,0x5d,0x2c,0x30,0x2c,0x5b,0x5d,0x2c,0x30,0x2c,0x7b,0x7d,
+0x00,0x00,0x00,0x00,0x1c,0x03,0x00,0x00,0x0d,0x01,0x00,0x09,0x00,0x00,0x00,0x03,
+0x74,0x61,0x67,0x00,0x0d,0x02,0x00,0x0a,0x00,0x00,0x00,0x03,0x45,0x4f,0x46,0x00,
+0x1c,0x06,0x01,0x02,0x1c,0x04,0x06,0x01,0x0c,0x05,0x00,0x02,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x1c,0x06,0x00,0x00,0x0c,0x01,0x00,0x02,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x1b,0x02,0x00,0x00,0x0d,0x07,0x00,0x0b,0x00,0x00,0x00,0x05,
+0x73,0x74,0x61,0x63,0x6b,0x00,0x00,0x00,0x0b,0x00,0x07,0x03,0x0d,0x03,0x00,0x0c,
+0x00,0x00,0x00,0x03,0x6f,0x75,0x74,0x00,0x0b,0x00,0x03,0x04,0x0d,0x03,0x00,0x0d,
+0x00,0x00,0x00,0x07,0x5f,0x73,0x63,0x6f,0x70,0x65,0x69,0x00,0x0b,0x00,0x03,0x05,
+0x0d,0x03,0x00,0x0e,0x00,0x00,0x00,0x06,0x74,0x73,0x74,0x61,0x63,0x6b,0x00,0x00,
+0x0b,0x00,0x03,0x06,0x0d,0x03,0x00,0x0f,0x00,0x00,0x00,0x05,0x5f,0x74,0x61,0x67,
+0x69,0x00,0x00,0x00,0x0b,0x00,0x03,0x01,0x0d,0x03,0x00,0x10,0x00,0x00,0x00,0x04,
+0x64,0x61,0x74,0x61,0x00,0x00,0x00,0x00,0x0b,0x00,0x03,0x02,0x1f,0x07,0x00,0x0f,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,0x2e,0x65,0x72,0x72,
+0x6f,0x72,0x20,0x3d,0x20,0x46,0x61,0x6c,0x73,0x65,0x00,0x00,0x0c,0x03,0x00,0x02,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x11,0x00,0x00,0x00,0x05,
+0x65,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x0b,0x00,0x04,0x03,0x00,0x00,0x00,0x00,
+0x33,0x01,0x00,0x08,0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,
+0x10,0x01,0x00,0x00,0x1f,0x08,0x00,0x10,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,
+0x62,0x65,0x67,0x69,0x6e,0x28,0x73,0x65,0x6c,0x66,0x2c,0x67,0x62,0x6c,0x3d,0x46,
+0x61,0x6c,0x73,0x65,0x29,0x3a,0x00,0x00,0x33,0x02,0x00,0x03,0x2a,0x24,0x38,0x00,
+0x0d,0x07,0x00,0x00,0x00,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,
+0x0d,0x08,0x00,0x03,0x00,0x00,0x00,0x03,0x67,0x62,0x6c,0x00,0x1c,0x03,0x07,0x02,
+0x0c,0x07,0x00,0x04,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x1c,0x04,0x07,0x01,
+0x1d,0x05,0x00,0x00,0x1d,0x06,0x00,0x00,0x11,0x02,0x01,0xad,0x2d,0x14,0x00,0x1a,
+0x00,0x00,0x00,0x16,0x1f,0x08,0x00,0x10,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,
+0x62,0x65,0x67,0x69,0x6e,0x28,0x73,0x65,0x6c,0x66,0x2c,0x67,0x62,0x6c,0x3d,0x46,
+0x61,0x6c,0x73,0x65,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,
+0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x03,0x67,0x62,0x6c,0x00,0x0d,0x02,0x00,0x00,
+0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,
+0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x05,0x62,0x65,0x67,0x69,
+0x6e,0x00,0x00,0x00,0x23,0x02,0x00,0x00,0x1f,0x34,0x00,0x11,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6c,0x65,0x6e,0x28,0x73,0x65,0x6c,0x66,0x2e,
+0x73,0x74,0x61,0x63,0x6b,0x29,0x3a,0x20,0x73,0x65,0x6c,0x66,0x2e,0x73,0x74,0x61,
+0x63,0x6b,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x28,0x73,0x65,0x6c,0x66,0x2e,
+0x76,0x61,0x72,0x73,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x72,0x32,0x6e,0x2c,0x73,0x65,
+0x6c,0x66,0x2e,0x6e,0x32,0x72,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x5f,0x74,0x6d,0x70,
+0x69,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x6d,0x72,0x65,0x67,0x2c,0x73,0x65,0x6c,0x66,
+0x2e,0x73,0x6e,0x75,0x6d,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x5f,0x67,0x6c,0x6f,0x62,
+0x61,0x6c,0x73,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x6c,0x69,0x6e,0x65,0x6e,0x6f,0x2c,
+0x73,0x65,0x6c,0x66,0x2e,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x2c,0x73,0x65,0x6c,
+0x66,0x2e,0x72,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x2c,0x73,0x65,0x6c,0x66,0x2e,
+0x63,0x72,0x65,0x67,0x73,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x74,0x6d,0x70,0x63,0x2c,
+0x73,0x65,0x6c,0x66,0x2e,0x63,0x6f,0x6e,0x73,0x74,0x73,0x2c,0x73,0x65,0x6c,0x66,
+0x2e,0x6d,0x63,0x61,0x63,0x68,0x65,0x73,0x29,0x29,0x00,0x00,0x0e,0x03,0x00,0x02,
+0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x0d,0x05,0x00,0x03,0x00,0x00,0x00,0x05,
+0x73,0x74,0x61,0x63,0x6b,0x00,0x00,0x00,0x09,0x04,0x00,0x05,0x00,0x00,0x00,0x00,
+0x37,0x02,0x03,0x02,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x64,0x0d,0x07,0x00,0x03,
+0x00,0x00,0x00,0x05,0x73,0x74,0x61,0x63,0x6b,0x00,0x00,0x00,0x09,0x06,0x00,0x07,
+0x00,0x00,0x00,0x01,0x0d,0x07,0x00,0x04,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x03,0x06,0x07,0x00,0x00,0x00,0x02,0x0d,0x02,0x00,0x05,
+0x00,0x00,0x00,0x04,0x76,0x61,0x72,0x73,0x00,0x00,0x00,0x00,0x09,0x06,0x00,0x02,
+0x00,0x00,0x00,0x03,0x0d,0x02,0x00,0x06,0x00,0x00,0x00,0x03,0x72,0x32,0x6e,0x00,
+0x09,0x07,0x00,0x02,0x00,0x00,0x00,0x04,0x0d,0x02,0x00,0x07,0x00,0x00,0x00,0x03,
+0x6e,0x32,0x72,0x00,0x09,0x08,0x00,0x02,0x00,0x00,0x00,0x05,0x0d,0x02,0x00,0x08,
+0x00,0x00,0x00,0x05,0x5f,0x74,0x6d,0x70,0x69,0x00,0x00,0x00,0x09,0x09,0x00,0x02,
+0x00,0x00,0x00,0x06,0x0d,0x02,0x00,0x09,0x00,0x00,0x00,0x04,0x6d,0x72,0x65,0x67,
+0x00,0x00,0x00,0x00,0x09,0x0a,0x00,0x02,0x00,0x00,0x00,0x07,0x0d,0x02,0x00,0x0a,
+0x00,0x00,0x00,0x04,0x73,0x6e,0x75,0x6d,0x00,0x00,0x00,0x00,0x09,0x0b,0x00,0x02,
+0x00,0x00,0x00,0x08,0x0d,0x02,0x00,0x0b,0x00,0x00,0x00,0x08,0x5f,0x67,0x6c,0x6f,
+0x62,0x61,0x6c,0x73,0x00,0x00,0x00,0x00,0x09,0x0c,0x00,0x02,0x00,0x00,0x00,0x09,
+0x0d,0x02,0x00,0x0c,0x00,0x00,0x00,0x06,0x6c,0x69,0x6e,0x65,0x6e,0x6f,0x00,0x00,
+0x09,0x0d,0x00,0x02,0x00,0x00,0x00,0x0a,0x0d,0x02,0x00,0x0d,0x00,0x00,0x00,0x07,
+0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x00,0x09,0x0e,0x00,0x02,0x00,0x00,0x00,0x0b,
+0x0d,0x02,0x00,0x0e,0x00,0x00,0x00,0x08,0x72,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,
+0x00,0x00,0x00,0x00,0x09,0x0f,0x00,0x02,0x00,0x00,0x00,0x0c,0x0d,0x02,0x00,0x0f,
+0x00,0x00,0x00,0x05,0x63,0x72,0x65,0x67,0x73,0x00,0x00,0x00,0x09,0x10,0x00,0x02,
+0x00,0x00,0x00,0x0d,0x0d,0x02,0x00,0x10,0x00,0x00,0x00,0x04,0x74,0x6d,0x70,0x63,
+0x00,0x00,0x00,0x00,0x09,0x11,0x00,0x02,0x00,0x00,0x00,0x0e,0x0d,0x02,0x00,0x11,
+0x00,0x00,0x00,0x06,0x63,0x6f,0x6e,0x73,0x74,0x73,0x00,0x00,0x09,0x12,0x00,0x02,
+0x00,0x00,0x00,0x0f,0x0d,0x02,0x00,0x12,0x00,0x00,0x00,0x07,0x6d,0x63,0x61,0x63,
+0x68,0x65,0x73,0x00,0x09,0x13,0x00,0x02,0x00,0x00,0x00,0x10,0x1c,0x05,0x06,0x0e,
+0x39,0x02,0x03,0x03,0x13,0x00,0x00,0x1a,0x1f,0x0a,0x00,0x12,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x3a,0x20,0x73,0x65,0x6c,0x66,0x2e,0x73,
+0x74,0x61,0x63,0x6b,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x4e,0x6f,0x6e,0x65,
+0x29,0x00,0x00,0x00,0x0d,0x07,0x00,0x03,0x00,0x00,0x00,0x05,0x73,0x74,0x61,0x63,
+0x6b,0x00,0x00,0x00,0x09,0x06,0x00,0x07,0x00,0x00,0x00,0x11,0x0d,0x07,0x00,0x04,
+0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x03,0x06,0x07,
+0x00,0x00,0x00,0x12,0x1d,0x05,0x00,0x00,0x39,0x02,0x03,0x03,0x1f,0x39,0x00,0x13,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,0x2e,0x76,0x61,0x72,
+0x73,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x72,0x32,0x6e,0x2c,0x73,0x65,0x6c,0x66,0x2e,
+0x6e,0x32,0x72,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x5f,0x74,0x6d,0x70,0x69,0x2c,0x73,
+0x65,0x6c,0x66,0x2e,0x6d,0x72,0x65,0x67,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x73,0x6e,
+0x75,0x6d,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x5f,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,
+0x2c,0x73,0x65,0x6c,0x66,0x2e,0x6c,0x69,0x6e,0x65,0x6e,0x6f,0x2c,0x73,0x65,0x6c,
+0x66,0x2e,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x72,
+0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x63,0x72,0x65,
+0x67,0x73,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x74,0x6d,0x70,0x63,0x2c,0x73,0x65,0x6c,
+0x66,0x2e,0x63,0x6f,0x6e,0x73,0x74,0x73,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x6d,0x63,
+0x61,0x63,0x68,0x65,0x73,0x20,0x3d,0x20,0x5b,0x5d,0x2c,0x7b,0x7d,0x2c,0x7b,0x7d,
+0x2c,0x30,0x2c,0x30,0x2c,0x73,0x74,0x72,0x28,0x73,0x65,0x6c,0x66,0x2e,0x5f,0x73,
+0x63,0x6f,0x70,0x65,0x69,0x29,0x2c,0x67,0x62,0x6c,0x2c,0x2d,0x31,0x2c,0x5b,0x5d,
+0x2c,0x5b,0x5d,0x2c,0x5b,0x27,0x72,0x65,0x67,0x73,0x27,0x5d,0x2c,0x30,0x2c,0x7b,
+0x7d,0x2c,0x30,0x00,0x1c,0x02,0x00,0x00,0x1b,0x03,0x00,0x00,0x1b,0x04,0x00,0x00,
+0x0c,0x05,0x00,0x13,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0c,0x06,0x00,0x13,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0e,0x09,0x00,0x14,0x00,0x00,0x00,0x03,
+0x73,0x74,0x72,0x00,0x0d,0x0b,0x00,0x15,0x00,0x00,0x00,0x07,0x5f,0x73,0x63,0x6f,
+0x70,0x65,0x69,0x00,0x09,0x0a,0x00,0x0b,0x00,0x00,0x00,0x13,0x37,0x07,0x09,0x02,
+0x10,0x08,0x01,0x00,0x0c,0x09,0x00,0x16,0x00,0x00,0x69,0x04,0xff,0xff,0xff,0xff,
+0x1c,0x0a,0x00,0x00,0x1c,0x0b,0x00,0x00,0x0d,0x0e,0x00,0x17,0x00,0x00,0x00,0x04,
+0x72,0x65,0x67,0x73,0x00,0x00,0x00,0x00,0x1c,0x0c,0x0e,0x01,0x0c,0x0d,0x00,0x13,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x1b,0x0e,0x00,0x00,0x0c,0x0f,0x00,0x13,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0d,0x10,0x00,0x05,0x00,0x00,0x00,0x04,
+0x76,0x61,0x72,0x73,0x00,0x00,0x00,0x00,0x0b,0x00,0x10,0x02,0x0d,0x02,0x00,0x06,
+0x00,0x00,0x00,0x03,0x72,0x32,0x6e,0x00,0x0b,0x00,0x02,0x03,0x0d,0x02,0x00,0x07,
+0x00,0x00,0x00,0x03,0x6e,0x32,0x72,0x00,0x0b,0x00,0x02,0x04,0x0d,0x02,0x00,0x08,
+0x00,0x00,0x00,0x05,0x5f,0x74,0x6d,0x70,0x69,0x00,0x00,0x00,0x0b,0x00,0x02,0x05,
+0x0d,0x02,0x00,0x09,0x00,0x00,0x00,0x04,0x6d,0x72,0x65,0x67,0x00,0x00,0x00,0x00,
+0x0b,0x00,0x02,0x06,0x0d,0x02,0x00,0x0a,0x00,0x00,0x00,0x04,0x73,0x6e,0x75,0x6d,
+0x00,0x00,0x00,0x00,0x0b,0x00,0x02,0x07,0x0d,0x02,0x00,0x0b,0x00,0x00,0x00,0x08,
+0x5f,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x00,0x00,0x00,0x00,0x0b,0x00,0x02,0x08,
+0x0d,0x02,0x00,0x0c,0x00,0x00,0x00,0x06,0x6c,0x69,0x6e,0x65,0x6e,0x6f,0x00,0x00,
+0x0b,0x00,0x02,0x09,0x0d,0x02,0x00,0x0d,0x00,0x00,0x00,0x07,0x67,0x6c,0x6f,0x62,
+0x61,0x6c,0x73,0x00,0x0b,0x00,0x02,0x0a,0x0d,0x02,0x00,0x0e,0x00,0x00,0x00,0x08,
+0x72,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x00,0x00,0x00,0x00,0x0b,0x00,0x02,0x0b,
+0x0d,0x02,0x00,0x0f,0x00,0x00,0x00,0x05,0x63,0x72,0x65,0x67,0x73,0x00,0x00,0x00,
+0x0b,0x00,0x02,0x0c,0x0d,0x02,0x00,0x10,0x00,0x00,0x00,0x04,0x74,0x6d,0x70,0x63,
+0x00,0x00,0x00,0x00,0x0b,0x00,0x02,0x0d,0x0d,0x02,0x00,0x11,0x00,0x00,0x00,0x06,
+0x63,0x6f,0x6e,0x73,0x74,0x73,0x00,0x00,0x0b,0x00,0x02,0x0e,0x0d,0x02,0x00,0x12,
+0x00,0x00,0x00,0x07,0x6d,0x63,0x61,0x63,0x68,0x65,0x73,0x00,0x0b,0x00,0x02,0x0f,
+0x1f,0x07,0x00,0x14,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,
+0x2e,0x5f,0x73,0x63,0x6f,0x70,0x65,0x69,0x20,0x2b,0x3d,0x20,0x31,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x15,0x00,0x00,0x00,0x07,0x5f,0x73,0x63,0x6f,0x70,0x65,0x69,0x00,
+0x09,0x02,0x00,0x03,0x00,0x00,0x00,0x14,0x0c,0x03,0x00,0x18,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x01,0x02,0x02,0x03,0x0d,0x03,0x00,0x15,0x00,0x00,0x00,0x07,
+0x5f,0x73,0x63,0x6f,0x70,0x65,0x69,0x00,0x0b,0x00,0x03,0x02,0x1f,0x07,0x00,0x15,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x73,0x65,0x72,0x74,0x28,0x73,
+0x65,0x6c,0x66,0x2e,0x63,0x72,0x65,0x67,0x73,0x29,0x00,0x00,0x0e,0x03,0x00,0x19,
+0x00,0x00,0x00,0x06,0x69,0x6e,0x73,0x65,0x72,0x74,0x00,0x00,0x0d,0x05,0x00,0x0f,
+0x00,0x00,0x00,0x05,0x63,0x72,0x65,0x67,0x73,0x00,0x00,0x00,0x09,0x04,0x00,0x05,
+0x00,0x00,0x00,0x15,0x37,0x02,0x03,0x02,0x00,0x00,0x00,0x00,0x33,0x03,0x00,0x05,
+0x62,0x65,0x67,0x69,0x6e,0x00,0x00,0x00,0x10,0x03,0x02,0x00,0x1f,0x08,0x00,0x16,
+0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x65,0x6e,0x64,0x28,0x73,0x65,0x6c,0x66,
+0x2c,0x20,0x65,0x6f,0x66,0x3d,0x54,0x72,0x75,0x65,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x04,0x00,0x04,0x2a,0x24,0x31,0x36,0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x00,
+0x00,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x05,
+0x00,0x00,0x00,0x03,0x65,0x6f,0x66,0x00,0x1c,0x05,0x04,0x02,0x0c,0x04,0x00,0x06,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x1c,0x06,0x04,0x01,0x1d,0x07,0x00,0x00,
+0x1d,0x08,0x00,0x00,0x11,0x04,0x01,0xd9,0x2d,0x08,0x00,0x27,0x00,0x00,0x00,0x10,
+0x1f,0x08,0x00,0x16,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x65,0x6e,0x64,0x28,
+0x73,0x65,0x6c,0x66,0x2c,0x20,0x65,0x6f,0x66,0x3d,0x54,0x72,0x75,0x65,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,
+0x33,0x01,0x00,0x03,0x65,0x6f,0x66,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x02,0x00,0x00,
+0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x03,0x65,0x6e,0x64,0x00,0x23,0x02,0x00,0x00,
+0x1f,0x0c,0x00,0x19,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,
+0x2e,0x63,0x72,0x65,0x67,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x6d,0x61,
+0x78,0x28,0x73,0x65,0x6c,0x66,0x2e,0x6d,0x72,0x65,0x67,0x2c,0x20,0x32,0x29,0x29,
+0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x02,0x00,0x00,0x00,0x05,0x63,0x72,0x65,0x67,
+0x73,0x00,0x00,0x00,0x09,0x02,0x00,0x03,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x03,
+0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x05,0x02,0x03,
+0x00,0x00,0x00,0x01,0x0e,0x02,0x00,0x04,0x00,0x00,0x00,0x03,0x6d,0x61,0x78,0x00,
+0x0d,0x03,0x00,0x05,0x00,0x00,0x00,0x04,0x6d,0x72,0x65,0x67,0x00,0x00,0x00,0x00,
+0x09,0x03,0x00,0x03,0x00,0x00,0x00,0x02,0x0c,0x04,0x00,0x06,0x00,0x00,0x69,0x04,
+0x02,0x00,0x00,0x00,0x37,0x07,0x02,0x03,0x39,0x02,0x05,0x03,0x1f,0x0b,0x00,0x1a,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,0x2e,0x63,0x72,0x65,
+0x67,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x6c,0x65,0x6e,0x28,0x73,0x65,
+0x6c,0x66,0x2e,0x63,0x6f,0x6e,0x73,0x74,0x73,0x29,0x29,0x00,0x0d,0x03,0x00,0x02,
+0x00,0x00,0x00,0x05,0x63,0x72,0x65,0x67,0x73,0x00,0x00,0x00,0x09,0x02,0x00,0x03,
+0x00,0x00,0x00,0x03,0x0d,0x03,0x00,0x03,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x05,0x02,0x03,0x00,0x00,0x00,0x04,0x0e,0x02,0x00,0x07,
+0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x0d,0x04,0x00,0x08,0x00,0x00,0x00,0x06,
+0x63,0x6f,0x6e,0x73,0x74,0x73,0x00,0x00,0x09,0x03,0x00,0x04,0x00,0x00,0x00,0x05,
+0x37,0x07,0x02,0x02,0x39,0x02,0x05,0x03,0x1f,0x0a,0x00,0x1b,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,0x2e,0x63,0x72,0x65,0x67,0x73,0x2e,0x61,
+0x70,0x70,0x65,0x6e,0x64,0x28,0x73,0x65,0x6c,0x66,0x2e,0x6d,0x63,0x61,0x63,0x68,
+0x65,0x73,0x29,0x00,0x0d,0x03,0x00,0x02,0x00,0x00,0x00,0x05,0x63,0x72,0x65,0x67,
+0x73,0x00,0x00,0x00,0x09,0x02,0x00,0x03,0x00,0x00,0x00,0x06,0x0d,0x03,0x00,0x03,
+0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x05,0x02,0x03,
+0x00,0x00,0x00,0x07,0x0d,0x02,0x00,0x09,0x00,0x00,0x00,0x07,0x6d,0x63,0x61,0x63,
+0x68,0x65,0x73,0x00,0x09,0x07,0x00,0x02,0x00,0x00,0x00,0x08,0x39,0x02,0x05,0x03,
+0x1f,0x04,0x00,0x1c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x65,
+0x6f,0x66,0x3a,0x00,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x10,0x1f,0x06,0x00,0x1d,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,
+0x28,0x45,0x4f,0x46,0x29,0x00,0x00,0x00,0x0e,0x05,0x00,0x0a,0x00,0x00,0x00,0x04,
+0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x0b,0x00,0x00,0x00,0x03,
+0x45,0x4f,0x46,0x00,0x37,0x02,0x05,0x02,0x1f,0x07,0x00,0x1f,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x73,0x65,0x6c,0x66,0x2e,0x74,0x6d,0x70,0x63,
+0x20,0x21,0x3d,0x20,0x30,0x3a,0x00,0x00,0x0d,0x05,0x00,0x0c,0x00,0x00,0x00,0x04,
+0x74,0x6d,0x70,0x63,0x00,0x00,0x00,0x00,0x09,0x02,0x00,0x05,0x00,0x00,0x00,0x09,
+0x0c,0x05,0x00,0x0d,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x24,0x02,0x02,0x05,
+0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x26,0x1f,0x11,0x00,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x69,0x6e,0x74,0x28,0x22,0x57,
+0x61,0x72,0x6e,0x69,0x6e,0x67,0x3a,0x5c,0x6e,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,
+0x70,0x79,0x20,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x73,0x20,0x61,0x20,0x72,0x65,
+0x67,0x69,0x73,0x74,0x65,0x72,0x20,0x6c,0x65,0x61,0x6b,0x5c,0x6e,0x22,0x29,0x00,
+0x0e,0x05,0x00,0x0e,0x00,0x00,0x00,0x05,0x70,0x72,0x69,0x6e,0x74,0x00,0x00,0x00,
+0x0d,0x06,0x00,0x0f,0x00,0x00,0x00,0x2c,0x57,0x61,0x72,0x6e,0x69,0x6e,0x67,0x3a,
+0x0a,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x20,0x63,0x6f,0x6e,0x74,0x61,
+0x69,0x6e,0x73,0x20,0x61,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x20,0x6c,
+0x65,0x61,0x6b,0x0a,0x00,0x00,0x00,0x00,0x37,0x02,0x05,0x02,0x1f,0x09,0x00,0x24,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x73,0x73,0x65,0x72,0x74,0x28,0x73,
+0x65,0x6c,0x66,0x2e,0x74,0x6d,0x70,0x63,0x20,0x3d,0x3d,0x20,0x30,0x29,0x20,0x23,
+0x52,0x45,0x47,0x00,0x0d,0x06,0x00,0x0c,0x00,0x00,0x00,0x04,0x74,0x6d,0x70,0x63,
+0x00,0x00,0x00,0x00,0x09,0x05,0x00,0x06,0x00,0x00,0x00,0x0a,0x0c,0x06,0x00,0x0d,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x18,0x02,0x05,0x06,0x17,0x02,0x05,0x06,
+0x1f,0x08,0x00,0x26,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6c,
+0x65,0x6e,0x28,0x73,0x65,0x6c,0x66,0x2e,0x73,0x74,0x61,0x63,0x6b,0x29,0x20,0x3e,
+0x20,0x31,0x3a,0x00,0x0e,0x05,0x00,0x07,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,
+0x0d,0x07,0x00,0x10,0x00,0x00,0x00,0x05,0x73,0x74,0x61,0x63,0x6b,0x00,0x00,0x00,
+0x09,0x06,0x00,0x07,0x00,0x00,0x00,0x0b,0x37,0x02,0x05,0x02,0x0c,0x05,0x00,0x11,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x36,0x02,0x02,0x05,0x16,0x02,0x00,0x00,
+0x13,0x00,0x00,0xc0,0x1f,0x30,0x00,0x27,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,0x2e,0x76,0x61,0x72,0x73,0x2c,0x73,0x65,
+0x6c,0x66,0x2e,0x72,0x32,0x6e,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x6e,0x32,0x72,0x2c,
+0x73,0x65,0x6c,0x66,0x2e,0x5f,0x74,0x6d,0x70,0x69,0x2c,0x73,0x65,0x6c,0x66,0x2e,
+0x6d,0x72,0x65,0x67,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x73,0x6e,0x75,0x6d,0x2c,0x73,
+0x65,0x6c,0x66,0x2e,0x5f,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x2c,0x73,0x65,0x6c,
+0x66,0x2e,0x6c,0x69,0x6e,0x65,0x6e,0x6f,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x67,0x6c,
+0x6f,0x62,0x61,0x6c,0x73,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x72,0x67,0x6c,0x6f,0x62,
+0x61,0x6c,0x73,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x63,0x72,0x65,0x67,0x73,0x2c,0x73,
+0x65,0x6c,0x66,0x2e,0x74,0x6d,0x70,0x63,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x63,0x6f,
+0x6e,0x73,0x74,0x73,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x6d,0x63,0x61,0x63,0x68,0x65,
+0x73,0x20,0x3d,0x20,0x73,0x65,0x6c,0x66,0x2e,0x73,0x74,0x61,0x63,0x6b,0x2e,0x70,
+0x6f,0x70,0x28,0x29,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x10,0x00,0x00,0x00,0x05,
+0x73,0x74,0x61,0x63,0x6b,0x00,0x00,0x00,0x09,0x07,0x00,0x02,0x00,0x00,0x00,0x0c,
+0x0d,0x02,0x00,0x12,0x00,0x00,0x00,0x03,0x70,0x6f,0x70,0x00,0x38,0x05,0x07,0x02,
+0x00,0x00,0x00,0x0d,0x39,0x02,0x05,0x02,0x33,0x02,0x00,0x04,0x2a,0x24,0x34,0x39,
+0x00,0x00,0x00,0x00,0x0c,0x06,0x00,0x0d,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x05,0x02,0x06,0x0d,0x06,0x00,0x13,0x00,0x00,0x00,0x04,0x76,0x61,0x72,0x73,
+0x00,0x00,0x00,0x00,0x0b,0x00,0x06,0x05,0x0c,0x06,0x00,0x11,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x05,0x02,0x06,0x0d,0x06,0x00,0x14,0x00,0x00,0x00,0x03,
+0x72,0x32,0x6e,0x00,0x0b,0x00,0x06,0x05,0x0c,0x06,0x00,0x06,0x00,0x00,0x69,0x04,
+0x02,0x00,0x00,0x00,0x0a,0x05,0x02,0x06,0x0d,0x06,0x00,0x15,0x00,0x00,0x00,0x03,
+0x6e,0x32,0x72,0x00,0x0b,0x00,0x06,0x05,0x0c,0x06,0x00,0x16,0x00,0x00,0x69,0x04,
+0x03,0x00,0x00,0x00,0x0a,0x05,0x02,0x06,0x0d,0x06,0x00,0x17,0x00,0x00,0x00,0x05,
+0x5f,0x74,0x6d,0x70,0x69,0x00,0x00,0x00,0x0b,0x00,0x06,0x05,0x0c,0x06,0x00,0x18,
+0x00,0x00,0x69,0x04,0x04,0x00,0x00,0x00,0x0a,0x05,0x02,0x06,0x0d,0x06,0x00,0x05,
+0x00,0x00,0x00,0x04,0x6d,0x72,0x65,0x67,0x00,0x00,0x00,0x00,0x0b,0x00,0x06,0x05,
+0x0c,0x06,0x00,0x19,0x00,0x00,0x69,0x04,0x05,0x00,0x00,0x00,0x0a,0x05,0x02,0x06,
+0x0d,0x06,0x00,0x1a,0x00,0x00,0x00,0x04,0x73,0x6e,0x75,0x6d,0x00,0x00,0x00,0x00,
+0x0b,0x00,0x06,0x05,0x0c,0x06,0x00,0x1b,0x00,0x00,0x69,0x04,0x06,0x00,0x00,0x00,
+0x0a,0x05,0x02,0x06,0x0d,0x06,0x00,0x1c,0x00,0x00,0x00,0x08,0x5f,0x67,0x6c,0x6f,
+0x62,0x61,0x6c,0x73,0x00,0x00,0x00,0x00,0x0b,0x00,0x06,0x05,0x0c,0x06,0x00,0x1d,
+0x00,0x00,0x69,0x04,0x07,0x00,0x00,0x00,0x0a,0x05,0x02,0x06,0x0d,0x06,0x00,0x1e,
+0x00,0x00,0x00,0x06,0x6c,0x69,0x6e,0x65,0x6e,0x6f,0x00,0x00,0x0b,0x00,0x06,0x05,
+0x0c,0x06,0x00,0x1f,0x00,0x00,0x69,0x04,0x08,0x00,0x00,0x00,0x0a,0x05,0x02,0x06,
+0x0d,0x06,0x00,0x20,0x00,0x00,0x00,0x07,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x00,
+0x0b,0x00,0x06,0x05,0x0c,0x06,0x00,0x21,0x00,0x00,0x69,0x04,0x09,0x00,0x00,0x00,
+0x0a,0x05,0x02,0x06,0x0d,0x06,0x00,0x22,0x00,0x00,0x00,0x08,0x72,0x67,0x6c,0x6f,
+0x62,0x61,0x6c,0x73,0x00,0x00,0x00,0x00,0x0b,0x00,0x06,0x05,0x0c,0x06,0x00,0x23,
+0x00,0x00,0x69,0x04,0x0a,0x00,0x00,0x00,0x0a,0x05,0x02,0x06,0x0d,0x06,0x00,0x02,
+0x00,0x00,0x00,0x05,0x63,0x72,0x65,0x67,0x73,0x00,0x00,0x00,0x0b,0x00,0x06,0x05,
+0x0c,0x06,0x00,0x24,0x00,0x00,0x69,0x04,0x0b,0x00,0x00,0x00,0x0a,0x05,0x02,0x06,
+0x0d,0x06,0x00,0x0c,0x00,0x00,0x00,0x04,0x74,0x6d,0x70,0x63,0x00,0x00,0x00,0x00,
+0x0b,0x00,0x06,0x05,0x0c,0x06,0x00,0x25,0x00,0x00,0x69,0x04,0x0c,0x00,0x00,0x00,
+0x0a,0x05,0x02,0x06,0x0d,0x06,0x00,0x08,0x00,0x00,0x00,0x06,0x63,0x6f,0x6e,0x73,
+0x74,0x73,0x00,0x00,0x0b,0x00,0x06,0x05,0x0c,0x06,0x00,0x26,0x00,0x00,0x69,0x04,
+0x0d,0x00,0x00,0x00,0x0a,0x05,0x02,0x06,0x0d,0x06,0x00,0x09,0x00,0x00,0x00,0x07,
+0x6d,0x63,0x61,0x63,0x68,0x65,0x73,0x00,0x0b,0x00,0x06,0x05,0x13,0x00,0x00,0x16,
+0x1f,0x08,0x00,0x28,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,
+0x3a,0x20,0x73,0x65,0x6c,0x66,0x2e,0x73,0x74,0x61,0x63,0x6b,0x2e,0x70,0x6f,0x70,
+0x28,0x29,0x00,0x00,0x0d,0x02,0x00,0x10,0x00,0x00,0x00,0x05,0x73,0x74,0x61,0x63,
+0x6b,0x00,0x00,0x00,0x09,0x07,0x00,0x02,0x00,0x00,0x00,0x0e,0x0d,0x02,0x00,0x12,
+0x00,0x00,0x00,0x03,0x70,0x6f,0x70,0x00,0x38,0x05,0x07,0x02,0x00,0x00,0x00,0x0f,
+0x39,0x02,0x05,0x02,0x00,0x00,0x00,0x00,0x33,0x05,0x00,0x03,0x65,0x6e,0x64,0x00,
+0x10,0x05,0x04,0x00,0x0e,0x06,0x00,0x07,0x00,0x00,0x00,0x06,0x44,0x53,0x74,0x61,
+0x74,0x65,0x00,0x00,0x33,0x06,0x00,0x04,0x2a,0x24,0x32,0x34,0x00,0x00,0x00,0x00,
+0x0d,0x07,0x00,0x08,0x00,0x00,0x00,0x08,0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,
+0x00,0x00,0x00,0x00,0x0b,0x06,0x07,0x01,0x0d,0x07,0x00,0x09,0x00,0x00,0x00,0x05,
+0x62,0x65,0x67,0x69,0x6e,0x00,0x00,0x00,0x0b,0x06,0x07,0x03,0x0d,0x07,0x00,0x0a,
+0x00,0x00,0x00,0x03,0x65,0x6e,0x64,0x00,0x0b,0x06,0x07,0x05,0x00,0x00,0x00,0x00,
+0x1d,0x02,0x00,0x00,0x1d,0x03,0x00,0x00,0x14,0x01,0x00,0x02,0x1f,0x08,0x00,0x2b,
+0x64,0x65,0x66,0x20,0x69,0x6e,0x73,0x65,0x72,0x74,0x28,0x76,0x29,0x3a,0x20,0x44,
+0x2e,0x6f,0x75,0x74,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x76,0x29,0x00,0x00,
+0x33,0x01,0x00,0x04,0x2a,0x24,0x34,0x37,0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x11,
+0x00,0x00,0x00,0x01,0x76,0x00,0x00,0x00,0x1c,0x02,0x06,0x01,0x1c,0x03,0x00,0x00,
+0x1d,0x04,0x00,0x00,0x1d,0x05,0x00,0x00,0x11,0x01,0x00,0x2e,0x2d,0x06,0x00,0x05,
+0x00,0x00,0x00,0x02,0x1f,0x08,0x00,0x2b,0x64,0x65,0x66,0x20,0x69,0x6e,0x73,0x65,
+0x72,0x74,0x28,0x76,0x29,0x3a,0x20,0x44,0x2e,0x6f,0x75,0x74,0x2e,0x61,0x70,0x70,
+0x65,0x6e,0x64,0x28,0x76,0x29,0x00,0x00,0x33,0x00,0x00,0x01,0x76,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x06,
+0x69,0x6e,0x73,0x65,0x72,0x74,0x00,0x00,0x23,0x01,0x00,0x00,0x0e,0x01,0x00,0x02,
+0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x03,
+0x6f,0x75,0x74,0x00,0x09,0x01,0x01,0x02,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x04,
+0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x03,0x01,0x02,
+0x00,0x00,0x00,0x01,0x10,0x05,0x00,0x00,0x39,0x01,0x03,0x03,0x00,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x12,0x00,0x00,0x00,0x06,0x69,0x6e,0x73,0x65,0x72,0x74,0x00,0x00,
+0x0f,0x02,0x01,0x00,0x1f,0x04,0x00,0x2c,0x64,0x65,0x66,0x20,0x77,0x72,0x69,0x74,
+0x65,0x28,0x76,0x29,0x3a,0x00,0x00,0x00,0x33,0x02,0x00,0x04,0x2a,0x24,0x35,0x34,
+0x00,0x00,0x00,0x00,0x0d,0x07,0x00,0x11,0x00,0x00,0x00,0x01,0x76,0x00,0x00,0x00,
+0x1c,0x03,0x07,0x01,0x1c,0x04,0x00,0x00,0x1d,0x05,0x00,0x00,0x1d,0x06,0x00,0x00,
+0x11,0x02,0x00,0x7b,0x2d,0x0b,0x00,0x0a,0x00,0x00,0x00,0x00,0x1f,0x04,0x00,0x2c,
+0x64,0x65,0x66,0x20,0x77,0x72,0x69,0x74,0x65,0x28,0x76,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x76,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x05,0x77,0x72,0x69,0x74,0x65,0x00,0x00,0x00,
+0x23,0x01,0x00,0x00,0x1f,0x07,0x00,0x2d,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,
+0x73,0x74,0x79,0x70,0x65,0x28,0x76,0x2c,0x27,0x6c,0x69,0x73,0x74,0x27,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x06,0x69,0x73,0x74,0x79,
+0x70,0x65,0x00,0x00,0x10,0x03,0x00,0x00,0x0d,0x04,0x00,0x03,0x00,0x00,0x00,0x04,
+0x6c,0x69,0x73,0x74,0x00,0x00,0x00,0x00,0x37,0x01,0x02,0x03,0x16,0x01,0x00,0x00,
+0x13,0x00,0x00,0x14,0x1f,0x05,0x00,0x2e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x6e,0x73,0x65,0x72,0x74,0x28,0x76,0x29,0x00,0x00,0x00,0x0e,0x02,0x00,0x04,
+0x00,0x00,0x00,0x06,0x69,0x6e,0x73,0x65,0x72,0x74,0x00,0x00,0x10,0x03,0x00,0x00,
+0x37,0x01,0x02,0x02,0x1f,0x04,0x00,0x2f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x00,0x00,0x1d,0x01,0x00,0x00,0x15,0x01,0x00,0x00,
+0x1f,0x08,0x00,0x30,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x6e,0x20,0x69,0x6e,
+0x20,0x72,0x61,0x6e,0x67,0x65,0x28,0x30,0x2c,0x6c,0x65,0x6e,0x28,0x76,0x29,0x2c,
+0x34,0x29,0x3a,0x00,0x0e,0x05,0x00,0x05,0x00,0x00,0x00,0x05,0x72,0x61,0x6e,0x67,
+0x65,0x00,0x00,0x00,0x0c,0x06,0x00,0x06,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0e,0x09,0x00,0x07,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x10,0x0a,0x00,0x00,
+0x37,0x07,0x09,0x02,0x0c,0x08,0x00,0x08,0x00,0x00,0x69,0x04,0x04,0x00,0x00,0x00,
+0x3a,0x02,0x05,0x04,0x3b,0x01,0x02,0x00,0x13,0x00,0x00,0x20,0x33,0x05,0x00,0x01,
+0x6e,0x00,0x00,0x00,0x10,0x05,0x01,0x00,0x1f,0x09,0x00,0x31,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x6e,0x73,0x65,0x72,0x74,0x28,0x28,0x27,0x64,0x61,0x74,
+0x61,0x27,0x2c,0x76,0x5b,0x6e,0x3a,0x6e,0x2b,0x34,0x5d,0x29,0x29,0x00,0x00,0x00,
+0x0e,0x06,0x00,0x04,0x00,0x00,0x00,0x06,0x69,0x6e,0x73,0x65,0x72,0x74,0x00,0x00,
+0x0d,0x08,0x00,0x09,0x00,0x00,0x00,0x04,0x64,0x61,0x74,0x61,0x00,0x00,0x00,0x00,
+0x10,0x09,0x05,0x00,0x0c,0x01,0x00,0x08,0x00,0x00,0x69,0x04,0x04,0x00,0x00,0x00,
+0x01,0x0a,0x05,0x01,0x1c,0x0a,0x09,0x02,0x0a,0x09,0x00,0x0a,0x1c,0x07,0x08,0x02,
+0x37,0x01,0x06,0x02,0x13,0x00,0xff,0xe0,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x13,
+0x00,0x00,0x00,0x05,0x77,0x72,0x69,0x74,0x65,0x00,0x00,0x00,0x0f,0x03,0x02,0x00,
+0x1f,0x04,0x00,0x32,0x64,0x65,0x66,0x20,0x73,0x65,0x74,0x70,0x6f,0x73,0x28,0x76,
+0x29,0x3a,0x00,0x00,0x33,0x03,0x00,0x04,0x2a,0x24,0x36,0x31,0x00,0x00,0x00,0x00,
+0x0d,0x08,0x00,0x11,0x00,0x00,0x00,0x01,0x76,0x00,0x00,0x00,0x1c,0x04,0x08,0x01,
+0x1c,0x05,0x00,0x00,0x1d,0x06,0x00,0x00,0x1d,0x07,0x00,0x00,0x11,0x03,0x00,0xd5,
+0x2d,0x0a,0x00,0x10,0x00,0x00,0x00,0x04,0x1f,0x04,0x00,0x32,0x64,0x65,0x66,0x20,
+0x73,0x65,0x74,0x70,0x6f,0x73,0x28,0x76,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x01,
+0x76,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,
+0x00,0x00,0x00,0x06,0x73,0x65,0x74,0x70,0x6f,0x73,0x00,0x00,0x23,0x01,0x00,0x00,
+0x1f,0x06,0x00,0x33,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x44,0x2e,0x6e,0x6f,0x70,
+0x6f,0x73,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x00,0x00,0x0e,0x01,0x00,0x02,
+0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x05,
+0x6e,0x6f,0x70,0x6f,0x73,0x00,0x00,0x00,0x09,0x01,0x01,0x02,0x00,0x00,0x00,0x00,
+0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x03,0x1d,0x01,0x00,0x00,0x15,0x01,0x00,0x00,
+0x1f,0x04,0x00,0x34,0x20,0x20,0x20,0x20,0x6c,0x69,0x6e,0x65,0x2c,0x78,0x20,0x3d,
+0x20,0x76,0x00,0x00,0x33,0x00,0x00,0x02,0x2a,0x76,0x00,0x00,0x33,0x01,0x00,0x04,
+0x6c,0x69,0x6e,0x65,0x00,0x00,0x00,0x00,0x0c,0x02,0x00,0x04,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x01,0x00,0x02,0x33,0x02,0x00,0x01,0x78,0x00,0x00,0x00,
+0x0c,0x03,0x00,0x05,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x02,0x00,0x03,
+0x1f,0x08,0x00,0x35,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6c,0x69,0x6e,0x65,0x20,
+0x3d,0x3d,0x20,0x44,0x2e,0x6c,0x69,0x6e,0x65,0x6e,0x6f,0x3a,0x20,0x72,0x65,0x74,
+0x75,0x72,0x6e,0x00,0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x06,0x00,0x00,0x00,0x06,0x6c,0x69,0x6e,0x65,0x6e,0x6f,0x00,0x00,
+0x09,0x02,0x02,0x03,0x00,0x00,0x00,0x01,0x18,0x00,0x01,0x02,0x16,0x00,0x00,0x00,
+0x13,0x00,0x00,0x03,0x1d,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x1f,0x07,0x00,0x36,
+0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x44,0x2e,0x6c,0x69,0x6e,
+0x65,0x73,0x5b,0x6c,0x69,0x6e,0x65,0x2d,0x31,0x5d,0x00,0x00,0x33,0x00,0x00,0x04,
+0x74,0x65,0x78,0x74,0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x01,
+0x44,0x00,0x00,0x00,0x0d,0x03,0x00,0x07,0x00,0x00,0x00,0x05,0x6c,0x69,0x6e,0x65,
+0x73,0x00,0x00,0x00,0x09,0x02,0x02,0x03,0x00,0x00,0x00,0x02,0x0c,0x04,0x00,0x05,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x02,0x03,0x01,0x04,0x0a,0x00,0x02,0x03,
+0x1f,0x05,0x00,0x37,0x20,0x20,0x20,0x20,0x44,0x2e,0x6c,0x69,0x6e,0x65,0x6e,0x6f,
+0x20,0x3d,0x20,0x6c,0x69,0x6e,0x65,0x00,0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x01,
+0x44,0x00,0x00,0x00,0x0d,0x03,0x00,0x06,0x00,0x00,0x00,0x06,0x6c,0x69,0x6e,0x65,
+0x6e,0x6f,0x00,0x00,0x0b,0x02,0x03,0x01,0x1f,0x0c,0x00,0x38,0x20,0x20,0x20,0x20,
+0x76,0x61,0x6c,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x2e,0x65,0x6e,0x63,0x6f,0x64,
+0x65,0x28,0x29,0x20,0x2b,0x20,0x62,0x22,0x5c,0x30,0x22,0x2a,0x28,0x34,0x2d,0x6c,
+0x65,0x6e,0x28,0x74,0x65,0x78,0x74,0x29,0x25,0x34,0x29,0x00,0x33,0x02,0x00,0x03,
+0x76,0x61,0x6c,0x00,0x0d,0x06,0x00,0x08,0x00,0x00,0x00,0x06,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x00,0x00,0x38,0x04,0x00,0x06,0x00,0x00,0x00,0x03,0x39,0x03,0x04,0x02,
+0x0d,0x04,0x00,0x09,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x0c,0x05,0x00,0x0a,
+0x00,0x00,0x69,0x04,0x04,0x00,0x00,0x00,0x0e,0x07,0x00,0x0b,0x00,0x00,0x00,0x03,
+0x6c,0x65,0x6e,0x00,0x10,0x08,0x00,0x00,0x37,0x06,0x07,0x02,0x0c,0x07,0x00,0x0a,
+0x00,0x00,0x69,0x04,0x04,0x00,0x00,0x00,0x28,0x06,0x06,0x07,0x02,0x05,0x05,0x06,
+0x03,0x04,0x04,0x05,0x01,0x02,0x03,0x04,0x1f,0x0a,0x00,0x39,0x20,0x20,0x20,0x20,
+0x63,0x6f,0x64,0x65,0x5f,0x31,0x36,0x28,0x4c,0x49,0x4e,0x45,0x2c,0x69,0x6e,0x74,
+0x28,0x6c,0x65,0x6e,0x28,0x76,0x61,0x6c,0x29,0x2f,0x34,0x29,0x2c,0x6c,0x69,0x6e,
+0x65,0x29,0x00,0x00,0x0e,0x04,0x00,0x0c,0x00,0x00,0x00,0x07,0x63,0x6f,0x64,0x65,
+0x5f,0x31,0x36,0x00,0x0e,0x05,0x00,0x0d,0x00,0x00,0x00,0x04,0x4c,0x49,0x4e,0x45,
+0x00,0x00,0x00,0x00,0x0e,0x08,0x00,0x0e,0x00,0x00,0x00,0x03,0x69,0x6e,0x74,0x00,
+0x0e,0x06,0x00,0x0b,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x10,0x07,0x02,0x00,
+0x37,0x09,0x06,0x02,0x0c,0x06,0x00,0x0a,0x00,0x00,0x69,0x04,0x04,0x00,0x00,0x00,
+0x04,0x09,0x09,0x06,0x37,0x06,0x08,0x02,0x10,0x07,0x01,0x00,0x37,0x03,0x04,0x04,
+0x1f,0x04,0x00,0x3a,0x20,0x20,0x20,0x20,0x77,0x72,0x69,0x74,0x65,0x28,0x76,0x61,
+0x6c,0x29,0x00,0x00,0x0e,0x04,0x00,0x0f,0x00,0x00,0x00,0x05,0x77,0x72,0x69,0x74,
+0x65,0x00,0x00,0x00,0x10,0x05,0x02,0x00,0x37,0x03,0x04,0x02,0x00,0x00,0x00,0x00,
+0x0d,0x04,0x00,0x14,0x00,0x00,0x00,0x06,0x73,0x65,0x74,0x70,0x6f,0x73,0x00,0x00,
+0x0f,0x04,0x03,0x00,0x1f,0x07,0x00,0x3b,0x64,0x65,0x66,0x20,0x63,0x6f,0x64,0x65,
+0x28,0x69,0x2c,0x61,0x3d,0x30,0x2c,0x62,0x3d,0x30,0x2c,0x63,0x3d,0x30,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x04,0x00,0x04,0x2a,0x24,0x36,0x38,0x00,0x00,0x00,0x00,
+0x0d,0x09,0x00,0x15,0x00,0x00,0x00,0x01,0x69,0x00,0x00,0x00,0x0d,0x0a,0x00,0x16,
+0x00,0x00,0x00,0x01,0x61,0x00,0x00,0x00,0x0d,0x0b,0x00,0x17,0x00,0x00,0x00,0x01,
+0x62,0x00,0x00,0x00,0x0d,0x0c,0x00,0x18,0x00,0x00,0x00,0x01,0x63,0x00,0x00,0x00,
+0x1c,0x05,0x09,0x04,0x0c,0x09,0x00,0x19,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0c,0x0a,0x00,0x19,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0c,0x0b,0x00,0x19,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x1c,0x06,0x09,0x03,0x1d,0x07,0x00,0x00,
+0x1d,0x08,0x00,0x00,0x11,0x04,0x00,0x9d,0x2d,0x0b,0x00,0x05,0x00,0x00,0x00,0x00,
+0x1f,0x07,0x00,0x3b,0x64,0x65,0x66,0x20,0x63,0x6f,0x64,0x65,0x28,0x69,0x2c,0x61,
+0x3d,0x30,0x2c,0x62,0x3d,0x30,0x2c,0x63,0x3d,0x30,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x69,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x61,0x00,0x00,0x00,
+0x33,0x02,0x00,0x01,0x62,0x00,0x00,0x00,0x33,0x03,0x00,0x01,0x63,0x00,0x00,0x00,
+0x0d,0x04,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x04,0x00,0x00,0x0d,0x04,0x00,0x01,0x00,0x00,0x00,0x04,
+0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x23,0x04,0x00,0x00,0x1f,0x0a,0x00,0x3c,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,0x6f,0x74,0x20,0x69,0x73,0x74,0x79,0x70,
+0x65,0x28,0x69,0x2c,0x27,0x6e,0x75,0x6d,0x62,0x65,0x72,0x27,0x29,0x3a,0x20,0x72,
+0x61,0x69,0x73,0x65,0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x02,0x00,0x00,0x00,0x06,
+0x69,0x73,0x74,0x79,0x70,0x65,0x00,0x00,0x10,0x06,0x00,0x00,0x0d,0x07,0x00,0x03,
+0x00,0x00,0x00,0x06,0x6e,0x75,0x6d,0x62,0x65,0x72,0x00,0x00,0x37,0x04,0x05,0x03,
+0x2f,0x04,0x00,0x00,0x13,0x00,0x00,0x03,0x1d,0x04,0x00,0x00,0x26,0x04,0x00,0x00,
+0x1f,0x0a,0x00,0x3d,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,0x6f,0x74,0x20,0x69,
+0x73,0x74,0x79,0x70,0x65,0x28,0x61,0x2c,0x27,0x6e,0x75,0x6d,0x62,0x65,0x72,0x27,
+0x29,0x3a,0x20,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x02,
+0x00,0x00,0x00,0x06,0x69,0x73,0x74,0x79,0x70,0x65,0x00,0x00,0x10,0x06,0x01,0x00,
+0x0d,0x07,0x00,0x03,0x00,0x00,0x00,0x06,0x6e,0x75,0x6d,0x62,0x65,0x72,0x00,0x00,
+0x37,0x04,0x05,0x03,0x2f,0x04,0x00,0x00,0x13,0x00,0x00,0x03,0x1d,0x04,0x00,0x00,
+0x26,0x04,0x00,0x00,0x1f,0x0a,0x00,0x3e,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,
+0x6f,0x74,0x20,0x69,0x73,0x74,0x79,0x70,0x65,0x28,0x62,0x2c,0x27,0x6e,0x75,0x6d,
+0x62,0x65,0x72,0x27,0x29,0x3a,0x20,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x00,0x00,
+0x0e,0x05,0x00,0x02,0x00,0x00,0x00,0x06,0x69,0x73,0x74,0x79,0x70,0x65,0x00,0x00,
+0x10,0x06,0x02,0x00,0x0d,0x07,0x00,0x03,0x00,0x00,0x00,0x06,0x6e,0x75,0x6d,0x62,
+0x65,0x72,0x00,0x00,0x37,0x04,0x05,0x03,0x2f,0x04,0x00,0x00,0x13,0x00,0x00,0x03,
+0x1d,0x04,0x00,0x00,0x26,0x04,0x00,0x00,0x1f,0x0a,0x00,0x3f,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x6e,0x6f,0x74,0x20,0x69,0x73,0x74,0x79,0x70,0x65,0x28,0x63,0x2c,
+0x27,0x6e,0x75,0x6d,0x62,0x65,0x72,0x27,0x29,0x3a,0x20,0x72,0x61,0x69,0x73,0x65,
+0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x02,0x00,0x00,0x00,0x06,0x69,0x73,0x74,0x79,
+0x70,0x65,0x00,0x00,0x10,0x06,0x03,0x00,0x0d,0x07,0x00,0x03,0x00,0x00,0x00,0x06,
+0x6e,0x75,0x6d,0x62,0x65,0x72,0x00,0x00,0x37,0x04,0x05,0x03,0x2f,0x04,0x00,0x00,
+0x13,0x00,0x00,0x03,0x1d,0x04,0x00,0x00,0x26,0x04,0x00,0x00,0x1f,0x07,0x00,0x40,
+0x20,0x20,0x20,0x20,0x77,0x72,0x69,0x74,0x65,0x28,0x28,0x27,0x63,0x6f,0x64,0x65,
+0x27,0x2c,0x69,0x2c,0x61,0x2c,0x62,0x2c,0x63,0x29,0x29,0x00,0x0e,0x04,0x00,0x04,
+0x00,0x00,0x00,0x05,0x77,0x72,0x69,0x74,0x65,0x00,0x00,0x00,0x0d,0x06,0x00,0x01,
+0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x10,0x07,0x00,0x00,
+0x10,0x08,0x01,0x00,0x10,0x09,0x02,0x00,0x10,0x0a,0x03,0x00,0x1c,0x05,0x06,0x05,
+0x37,0x04,0x04,0x02,0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x1a,0x00,0x00,0x00,0x04,
+0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0f,0x05,0x04,0x00,0x1f,0x05,0x00,0x41,
+0x64,0x65,0x66,0x20,0x63,0x6f,0x64,0x65,0x5f,0x31,0x36,0x28,0x69,0x2c,0x61,0x2c,
+0x62,0x29,0x3a,0x00,0x33,0x05,0x00,0x04,0x2a,0x24,0x38,0x31,0x00,0x00,0x00,0x00,
+0x0d,0x0a,0x00,0x15,0x00,0x00,0x00,0x01,0x69,0x00,0x00,0x00,0x0d,0x0b,0x00,0x16,
+0x00,0x00,0x00,0x01,0x61,0x00,0x00,0x00,0x0d,0x0c,0x00,0x17,0x00,0x00,0x00,0x01,
+0x62,0x00,0x00,0x00,0x1c,0x06,0x0a,0x03,0x1c,0x07,0x00,0x00,0x1d,0x08,0x00,0x00,
+0x1d,0x09,0x00,0x00,0x11,0x05,0x00,0x53,0x2d,0x08,0x00,0x08,0x00,0x00,0x00,0x00,
+0x1f,0x05,0x00,0x41,0x64,0x65,0x66,0x20,0x63,0x6f,0x64,0x65,0x5f,0x31,0x36,0x28,
+0x69,0x2c,0x61,0x2c,0x62,0x29,0x3a,0x00,0x33,0x00,0x00,0x01,0x69,0x00,0x00,0x00,
+0x33,0x01,0x00,0x01,0x61,0x00,0x00,0x00,0x33,0x02,0x00,0x01,0x62,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x03,0x00,0x00,0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x07,
+0x63,0x6f,0x64,0x65,0x5f,0x31,0x36,0x00,0x23,0x03,0x00,0x00,0x1f,0x07,0x00,0x42,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x62,0x20,0x3c,0x20,0x30,0x3a,0x20,0x62,0x20,
+0x2b,0x3d,0x20,0x30,0x78,0x38,0x30,0x30,0x30,0x00,0x00,0x00,0x0c,0x03,0x00,0x02,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x1a,0x03,0x02,0x03,0x16,0x03,0x00,0x00,
+0x13,0x00,0x00,0x05,0x0c,0x03,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x80,0x00,0x00,
+0x01,0x02,0x02,0x03,0x1f,0x0a,0x00,0x43,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,
+0x28,0x69,0x2c,0x61,0x2c,0x28,0x62,0x26,0x30,0x78,0x66,0x66,0x30,0x30,0x29,0x3e,
+0x3e,0x38,0x2c,0x28,0x62,0x26,0x30,0x78,0x66,0x66,0x29,0x3e,0x3e,0x30,0x29,0x00,
+0x0e,0x03,0x00,0x04,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,
+0x10,0x04,0x00,0x00,0x10,0x05,0x01,0x00,0x0c,0x01,0x00,0x05,0x00,0x00,0x69,0x04,
+0x00,0xff,0x00,0x00,0x06,0x06,0x02,0x01,0x0c,0x01,0x00,0x06,0x00,0x00,0x69,0x04,
+0x08,0x00,0x00,0x00,0x2a,0x06,0x06,0x01,0x0c,0x01,0x00,0x07,0x00,0x00,0x69,0x04,
+0xff,0x00,0x00,0x00,0x06,0x07,0x02,0x01,0x0c,0x01,0x00,0x02,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x2a,0x07,0x07,0x01,0x37,0x03,0x03,0x05,0x00,0x00,0x00,0x00,
+0x0d,0x06,0x00,0x1b,0x00,0x00,0x00,0x07,0x63,0x6f,0x64,0x65,0x5f,0x31,0x36,0x00,
+0x0f,0x06,0x05,0x00,0x1f,0x06,0x00,0x44,0x64,0x65,0x66,0x20,0x67,0x65,0x74,0x5f,
+0x63,0x6f,0x64,0x65,0x31,0x36,0x28,0x69,0x2c,0x61,0x2c,0x62,0x29,0x3a,0x00,0x00,
+0x33,0x06,0x00,0x04,0x2a,0x24,0x39,0x30,0x00,0x00,0x00,0x00,0x0d,0x0b,0x00,0x15,
+0x00,0x00,0x00,0x01,0x69,0x00,0x00,0x00,0x0d,0x0c,0x00,0x16,0x00,0x00,0x00,0x01,
+0x61,0x00,0x00,0x00,0x0d,0x0d,0x00,0x17,0x00,0x00,0x00,0x01,0x62,0x00,0x00,0x00,
+0x1c,0x07,0x0b,0x03,0x1c,0x08,0x00,0x00,0x1d,0x09,0x00,0x00,0x1d,0x0a,0x00,0x00,
+0x11,0x06,0x00,0x47,0x2d,0x08,0x00,0x07,0x00,0x00,0x00,0x00,0x1f,0x06,0x00,0x44,
+0x64,0x65,0x66,0x20,0x67,0x65,0x74,0x5f,0x63,0x6f,0x64,0x65,0x31,0x36,0x28,0x69,
+0x2c,0x61,0x2c,0x62,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x01,0x69,0x00,0x00,0x00,
+0x33,0x01,0x00,0x01,0x61,0x00,0x00,0x00,0x33,0x02,0x00,0x01,0x62,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x03,0x00,0x00,0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x0a,
+0x67,0x65,0x74,0x5f,0x63,0x6f,0x64,0x65,0x31,0x36,0x00,0x00,0x23,0x03,0x00,0x00,
+0x1f,0x0d,0x00,0x45,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,
+0x27,0x63,0x6f,0x64,0x65,0x27,0x2c,0x69,0x2c,0x61,0x2c,0x28,0x62,0x26,0x30,0x78,
+0x66,0x66,0x30,0x30,0x29,0x3e,0x3e,0x38,0x2c,0x28,0x62,0x26,0x30,0x78,0x66,0x66,
+0x29,0x3e,0x3e,0x30,0x29,0x00,0x00,0x00,0x0d,0x03,0x00,0x02,0x00,0x00,0x00,0x04,
+0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x10,0x04,0x00,0x00,0x10,0x05,0x01,0x00,
+0x0c,0x00,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0xff,0x00,0x00,0x06,0x06,0x02,0x00,
+0x0c,0x00,0x00,0x04,0x00,0x00,0x69,0x04,0x08,0x00,0x00,0x00,0x2a,0x06,0x06,0x00,
+0x0c,0x00,0x00,0x05,0x00,0x00,0x69,0x04,0xff,0x00,0x00,0x00,0x06,0x07,0x02,0x00,
+0x0c,0x00,0x00,0x06,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2a,0x07,0x07,0x00,
+0x1c,0x03,0x03,0x05,0x15,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x07,0x00,0x1c,
+0x00,0x00,0x00,0x0a,0x67,0x65,0x74,0x5f,0x63,0x6f,0x64,0x65,0x31,0x36,0x00,0x00,
+0x0f,0x07,0x06,0x00,0x1f,0x06,0x00,0x47,0x64,0x65,0x66,0x20,0x63,0x6f,0x6e,0x73,
+0x74,0x5f,0x73,0x6c,0x6f,0x74,0x28,0x6b,0x65,0x79,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x07,0x00,0x04,0x2a,0x24,0x39,0x39,0x00,0x00,0x00,0x00,0x0d,0x0c,0x00,0x1d,
+0x00,0x00,0x00,0x03,0x6b,0x65,0x79,0x00,0x1c,0x08,0x0c,0x01,0x1c,0x09,0x00,0x00,
+0x1d,0x0a,0x00,0x00,0x1d,0x0b,0x00,0x00,0x11,0x07,0x00,0x66,0x2d,0x05,0x00,0x05,
+0x00,0x00,0x00,0x04,0x1f,0x06,0x00,0x47,0x64,0x65,0x66,0x20,0x63,0x6f,0x6e,0x73,
+0x74,0x5f,0x73,0x6c,0x6f,0x74,0x28,0x6b,0x65,0x79,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x00,0x00,0x03,0x6b,0x65,0x79,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x5f,0x73,0x6c,
+0x6f,0x74,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x07,0x00,0x4a,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x6b,0x65,0x79,0x20,0x6e,0x6f,0x74,0x20,0x69,0x6e,0x20,0x44,0x2e,
+0x63,0x6f,0x6e,0x73,0x74,0x73,0x3a,0x00,0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x01,
+0x44,0x00,0x00,0x00,0x0d,0x03,0x00,0x03,0x00,0x00,0x00,0x06,0x63,0x6f,0x6e,0x73,
+0x74,0x73,0x00,0x00,0x09,0x02,0x02,0x03,0x00,0x00,0x00,0x00,0x08,0x01,0x00,0x02,
+0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x23,0x1f,0x0a,0x00,0x4b,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x44,0x2e,0x63,0x6f,0x6e,0x73,0x74,0x73,0x5b,0x6b,0x65,0x79,
+0x5d,0x20,0x3d,0x20,0x6c,0x65,0x6e,0x28,0x44,0x2e,0x63,0x6f,0x6e,0x73,0x74,0x73,
+0x29,0x00,0x00,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x06,0x63,0x6f,0x6e,0x73,0x74,0x73,0x00,0x00,
+0x09,0x01,0x01,0x02,0x00,0x00,0x00,0x01,0x0e,0x03,0x00,0x04,0x00,0x00,0x00,0x03,
+0x6c,0x65,0x6e,0x00,0x0e,0x04,0x00,0x02,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x06,0x63,0x6f,0x6e,0x73,0x74,0x73,0x00,0x00,
+0x09,0x04,0x04,0x02,0x00,0x00,0x00,0x02,0x37,0x02,0x03,0x02,0x0b,0x01,0x00,0x02,
+0x1f,0x07,0x00,0x4c,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x44,
+0x2e,0x63,0x6f,0x6e,0x73,0x74,0x73,0x5b,0x6b,0x65,0x79,0x5d,0x00,0x00,0x00,0x00,
+0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x02,0x00,0x03,
+0x00,0x00,0x00,0x06,0x63,0x6f,0x6e,0x73,0x74,0x73,0x00,0x00,0x09,0x01,0x01,0x02,
+0x00,0x00,0x00,0x03,0x0a,0x01,0x01,0x00,0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x08,0x00,0x1e,0x00,0x00,0x00,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x5f,0x73,0x6c,
+0x6f,0x74,0x00,0x00,0x0f,0x08,0x07,0x00,0x1f,0x07,0x00,0x4e,0x64,0x65,0x66,0x20,
+0x5f,0x64,0x6f,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x28,0x76,0x2c,0x72,0x3d,0x4e,
+0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x00,0x33,0x08,0x00,0x05,0x2a,0x24,0x31,0x30,
+0x36,0x00,0x00,0x00,0x0d,0x0d,0x00,0x11,0x00,0x00,0x00,0x01,0x76,0x00,0x00,0x00,
+0x0d,0x0e,0x00,0x1f,0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,0x1c,0x09,0x0d,0x02,
+0x1d,0x0d,0x00,0x00,0x1c,0x0a,0x0d,0x01,0x1d,0x0b,0x00,0x00,0x1d,0x0c,0x00,0x00,
+0x11,0x08,0x00,0x92,0x2d,0x0a,0x00,0x0c,0x00,0x00,0x00,0x00,0x1f,0x07,0x00,0x4e,
+0x64,0x65,0x66,0x20,0x5f,0x64,0x6f,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x28,0x76,
+0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x01,
+0x76,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x72,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,
+0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,
+0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x0a,0x5f,0x64,0x6f,0x5f,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x23,0x02,0x00,0x00,0x1f,0x05,0x00,0x4f,
+0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x28,
+0x72,0x29,0x00,0x00,0x0e,0x03,0x00,0x02,0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,
+0x74,0x6d,0x70,0x00,0x10,0x04,0x01,0x00,0x37,0x01,0x03,0x02,0x1f,0x09,0x00,0x50,
+0x20,0x20,0x20,0x20,0x76,0x61,0x6c,0x20,0x3d,0x20,0x76,0x20,0x2b,0x20,0x62,0x22,
+0x5c,0x30,0x22,0x2a,0x28,0x34,0x2d,0x6c,0x65,0x6e,0x28,0x76,0x29,0x25,0x34,0x29,
+0x00,0x00,0x00,0x00,0x33,0x02,0x00,0x03,0x76,0x61,0x6c,0x00,0x0d,0x04,0x00,0x03,
+0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x0c,0x05,0x00,0x04,0x00,0x00,0x69,0x04,
+0x04,0x00,0x00,0x00,0x0e,0x07,0x00,0x05,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,
+0x10,0x08,0x00,0x00,0x37,0x06,0x07,0x02,0x0c,0x07,0x00,0x04,0x00,0x00,0x69,0x04,
+0x04,0x00,0x00,0x00,0x28,0x06,0x06,0x07,0x02,0x05,0x05,0x06,0x03,0x04,0x04,0x05,
+0x01,0x02,0x00,0x04,0x1f,0x0b,0x00,0x51,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,
+0x5f,0x31,0x36,0x28,0x53,0x54,0x52,0x49,0x4e,0x47,0x2c,0x72,0x2c,0x63,0x6f,0x6e,
+0x73,0x74,0x5f,0x73,0x6c,0x6f,0x74,0x28,0x62,0x27,0x73,0x27,0x2b,0x76,0x29,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x04,0x00,0x06,0x00,0x00,0x00,0x07,0x63,0x6f,0x64,0x65,
+0x5f,0x31,0x36,0x00,0x0e,0x05,0x00,0x07,0x00,0x00,0x00,0x06,0x53,0x54,0x52,0x49,
+0x4e,0x47,0x00,0x00,0x10,0x06,0x01,0x00,0x0e,0x08,0x00,0x08,0x00,0x00,0x00,0x0a,
+0x63,0x6f,0x6e,0x73,0x74,0x5f,0x73,0x6c,0x6f,0x74,0x00,0x00,0x0d,0x09,0x00,0x09,
+0x00,0x00,0x00,0x01,0x73,0x00,0x00,0x00,0x01,0x09,0x09,0x00,0x37,0x07,0x08,0x02,
+0x37,0x03,0x04,0x04,0x1f,0x06,0x00,0x52,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,
+0x5f,0x31,0x36,0x28,0x30,0x2c,0x30,0x2c,0x6c,0x65,0x6e,0x28,0x76,0x29,0x29,0x00,
+0x0e,0x04,0x00,0x06,0x00,0x00,0x00,0x07,0x63,0x6f,0x64,0x65,0x5f,0x31,0x36,0x00,
+0x0c,0x05,0x00,0x0a,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0c,0x06,0x00,0x0a,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0e,0x08,0x00,0x05,0x00,0x00,0x00,0x03,
+0x6c,0x65,0x6e,0x00,0x10,0x09,0x00,0x00,0x37,0x07,0x08,0x02,0x37,0x03,0x04,0x04,
+0x1f,0x04,0x00,0x53,0x20,0x20,0x20,0x20,0x77,0x72,0x69,0x74,0x65,0x28,0x76,0x61,
+0x6c,0x29,0x00,0x00,0x0e,0x04,0x00,0x0b,0x00,0x00,0x00,0x05,0x77,0x72,0x69,0x74,
+0x65,0x00,0x00,0x00,0x10,0x05,0x02,0x00,0x37,0x03,0x04,0x02,0x1f,0x04,0x00,0x54,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,
+0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x09,0x00,0x20,0x00,0x00,0x00,0x0a,
+0x5f,0x64,0x6f,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x0f,0x09,0x08,0x00,
+0x1f,0x07,0x00,0x55,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x28,0x74,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x09,0x00,0x05,0x2a,0x24,0x31,0x31,0x35,0x00,0x00,0x00,0x0d,0x0e,0x00,0x21,
+0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x0f,0x00,0x1f,0x00,0x00,0x00,0x01,
+0x72,0x00,0x00,0x00,0x1c,0x0a,0x0e,0x02,0x1d,0x0e,0x00,0x00,0x1c,0x0b,0x0e,0x01,
+0x1d,0x0c,0x00,0x00,0x1d,0x0d,0x00,0x00,0x11,0x09,0x00,0x36,0x2d,0x05,0x00,0x04,
+0x00,0x00,0x00,0x01,0x1f,0x07,0x00,0x55,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x28,0x74,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x33,0x01,0x00,0x01,
+0x72,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,
+0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,
+0x23,0x02,0x00,0x00,0x1f,0x08,0x00,0x56,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x5f,0x64,0x6f,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x28,0x74,0x2e,
+0x76,0x61,0x6c,0x2c,0x72,0x29,0x00,0x00,0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x0a,
+0x5f,0x64,0x6f,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x0d,0x03,0x00,0x03,
+0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x09,0x03,0x00,0x03,0x00,0x00,0x00,0x00,
+0x10,0x04,0x01,0x00,0x37,0x02,0x02,0x03,0x15,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x0a,0x00,0x22,0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x00,0x00,0x00,0x0f,0x0a,0x09,0x00,0x1f,0x06,0x00,0x58,0x64,0x65,0x66,0x20,
+0x5f,0x64,0x6f,0x5f,0x67,0x67,0x65,0x74,0x28,0x76,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,
+0x65,0x29,0x3a,0x00,0x33,0x0a,0x00,0x05,0x2a,0x24,0x31,0x32,0x34,0x00,0x00,0x00,
+0x0d,0x0f,0x00,0x11,0x00,0x00,0x00,0x01,0x76,0x00,0x00,0x00,0x0d,0x10,0x00,0x1f,
+0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,0x1c,0x0b,0x0f,0x02,0x1d,0x0f,0x00,0x00,
+0x1c,0x0c,0x0f,0x01,0x1d,0x0d,0x00,0x00,0x1d,0x0e,0x00,0x00,0x11,0x0a,0x00,0x90,
+0x2d,0x0a,0x00,0x0c,0x00,0x00,0x00,0x00,0x1f,0x06,0x00,0x58,0x64,0x65,0x66,0x20,
+0x5f,0x64,0x6f,0x5f,0x67,0x67,0x65,0x74,0x28,0x76,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,
+0x65,0x29,0x3a,0x00,0x33,0x00,0x00,0x01,0x76,0x00,0x00,0x00,0x33,0x01,0x00,0x01,
+0x72,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,
+0x00,0x00,0x00,0x08,0x5f,0x64,0x6f,0x5f,0x67,0x67,0x65,0x74,0x00,0x00,0x00,0x00,
+0x23,0x02,0x00,0x00,0x1f,0x05,0x00,0x5a,0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,
+0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x28,0x72,0x29,0x00,0x00,0x0e,0x03,0x00,0x02,
+0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x00,0x10,0x04,0x01,0x00,
+0x37,0x01,0x03,0x02,0x1f,0x09,0x00,0x5b,0x20,0x20,0x20,0x20,0x76,0x61,0x6c,0x20,
+0x3d,0x20,0x76,0x20,0x2b,0x20,0x62,0x22,0x5c,0x30,0x22,0x2a,0x28,0x34,0x2d,0x6c,
+0x65,0x6e,0x28,0x76,0x29,0x25,0x34,0x29,0x00,0x00,0x00,0x00,0x33,0x02,0x00,0x03,
+0x76,0x61,0x6c,0x00,0x0d,0x04,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+0x0c,0x05,0x00,0x04,0x00,0x00,0x69,0x04,0x04,0x00,0x00,0x00,0x0e,0x07,0x00,0x05,
+0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x10,0x08,0x00,0x00,0x37,0x06,0x07,0x02,
+0x0c,0x07,0x00,0x04,0x00,0x00,0x69,0x04,0x04,0x00,0x00,0x00,0x28,0x06,0x06,0x07,
+0x02,0x05,0x05,0x06,0x03,0x04,0x04,0x05,0x01,0x02,0x00,0x04,0x1f,0x0a,0x00,0x5c,
+0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x5f,0x31,0x36,0x28,0x47,0x47,0x45,0x54,
+0x2c,0x72,0x2c,0x63,0x6f,0x6e,0x73,0x74,0x5f,0x73,0x6c,0x6f,0x74,0x28,0x62,0x27,
+0x73,0x27,0x2b,0x76,0x29,0x29,0x00,0x00,0x0e,0x04,0x00,0x06,0x00,0x00,0x00,0x07,
+0x63,0x6f,0x64,0x65,0x5f,0x31,0x36,0x00,0x0e,0x05,0x00,0x07,0x00,0x00,0x00,0x04,
+0x47,0x47,0x45,0x54,0x00,0x00,0x00,0x00,0x10,0x06,0x01,0x00,0x0e,0x08,0x00,0x08,
+0x00,0x00,0x00,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x5f,0x73,0x6c,0x6f,0x74,0x00,0x00,
+0x0d,0x09,0x00,0x09,0x00,0x00,0x00,0x01,0x73,0x00,0x00,0x00,0x01,0x09,0x09,0x00,
+0x37,0x07,0x08,0x02,0x37,0x03,0x04,0x04,0x1f,0x06,0x00,0x5d,0x20,0x20,0x20,0x20,
+0x63,0x6f,0x64,0x65,0x5f,0x31,0x36,0x28,0x30,0x2c,0x30,0x2c,0x6c,0x65,0x6e,0x28,
+0x76,0x29,0x29,0x00,0x0e,0x04,0x00,0x06,0x00,0x00,0x00,0x07,0x63,0x6f,0x64,0x65,
+0x5f,0x31,0x36,0x00,0x0c,0x05,0x00,0x0a,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0c,0x06,0x00,0x0a,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0e,0x08,0x00,0x05,
+0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x10,0x09,0x00,0x00,0x37,0x07,0x08,0x02,
+0x37,0x03,0x04,0x04,0x1f,0x04,0x00,0x5e,0x20,0x20,0x20,0x20,0x77,0x72,0x69,0x74,
+0x65,0x28,0x76,0x61,0x6c,0x29,0x00,0x00,0x0e,0x04,0x00,0x0b,0x00,0x00,0x00,0x05,
+0x77,0x72,0x69,0x74,0x65,0x00,0x00,0x00,0x10,0x05,0x02,0x00,0x37,0x03,0x04,0x02,
+0x1f,0x04,0x00,0x5f,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,
+0x00,0x00,0x00,0x00,0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x0b,0x00,0x23,
+0x00,0x00,0x00,0x08,0x5f,0x64,0x6f,0x5f,0x67,0x67,0x65,0x74,0x00,0x00,0x00,0x00,
+0x0f,0x0b,0x0a,0x00,0x1f,0x07,0x00,0x61,0x64,0x65,0x66,0x20,0x5f,0x64,0x6f,0x5f,
+0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x28,0x69,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,
+0x29,0x3a,0x00,0x00,0x33,0x0b,0x00,0x05,0x2a,0x24,0x31,0x33,0x33,0x00,0x00,0x00,
+0x0d,0x10,0x00,0x15,0x00,0x00,0x00,0x01,0x69,0x00,0x00,0x00,0x0d,0x11,0x00,0x1f,
+0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,0x1c,0x0c,0x10,0x02,0x1d,0x10,0x00,0x00,
+0x1c,0x0d,0x10,0x01,0x1d,0x0e,0x00,0x00,0x1d,0x0f,0x00,0x00,0x11,0x0b,0x00,0xa8,
+0x2d,0x06,0x00,0x0a,0x00,0x00,0x00,0x00,0x1f,0x07,0x00,0x61,0x64,0x65,0x66,0x20,
+0x5f,0x64,0x6f,0x5f,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x28,0x69,0x2c,0x72,0x3d,
+0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x01,0x69,0x00,0x00,0x00,
+0x33,0x01,0x00,0x01,0x72,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x02,0x00,0x00,
+0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x0b,0x5f,0x64,0x6f,0x5f,0x69,0x6e,0x74,0x65,
+0x67,0x65,0x72,0x00,0x23,0x02,0x00,0x00,0x1f,0x06,0x00,0x62,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x69,0x20,0x3c,0x3d,0x20,0x30,0x78,0x37,0x66,0x66,0x66,0x66,0x66,
+0x66,0x66,0x3a,0x00,0x0c,0x02,0x00,0x02,0x00,0x00,0x69,0x04,0xff,0xff,0xff,0x7f,
+0x19,0x02,0x00,0x02,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x18,0x1f,0x0a,0x00,0x63,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,
+0x64,0x6f,0x5f,0x6e,0x75,0x6d,0x62,0x65,0x72,0x28,0x27,0x3d,0x69,0x27,0x2c,0x20,
+0x69,0x2c,0x20,0x72,0x29,0x00,0x00,0x00,0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x0a,
+0x5f,0x64,0x6f,0x5f,0x6e,0x75,0x6d,0x62,0x65,0x72,0x00,0x00,0x0d,0x03,0x00,0x04,
+0x00,0x00,0x00,0x02,0x3d,0x69,0x00,0x00,0x10,0x04,0x00,0x00,0x10,0x05,0x01,0x00,
+0x37,0x02,0x02,0x04,0x15,0x02,0x00,0x00,0x1f,0x07,0x00,0x64,0x20,0x20,0x20,0x20,
+0x65,0x6c,0x69,0x66,0x20,0x69,0x20,0x3c,0x3d,0x20,0x30,0x78,0x66,0x66,0x66,0x66,
+0x66,0x66,0x66,0x66,0x3a,0x00,0x00,0x00,0x0c,0x02,0x00,0x05,0x00,0x00,0x49,0x04,
+0xff,0xff,0xff,0xff,0x19,0x02,0x00,0x02,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x18,
+0x1f,0x0a,0x00,0x65,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x5f,0x64,0x6f,0x5f,0x6e,0x75,0x6d,0x62,0x65,0x72,0x28,0x27,0x3d,
+0x49,0x27,0x2c,0x20,0x69,0x2c,0x20,0x72,0x29,0x00,0x00,0x00,0x0e,0x02,0x00,0x03,
+0x00,0x00,0x00,0x0a,0x5f,0x64,0x6f,0x5f,0x6e,0x75,0x6d,0x62,0x65,0x72,0x00,0x00,
+0x0d,0x03,0x00,0x06,0x00,0x00,0x00,0x02,0x3d,0x49,0x00,0x00,0x10,0x04,0x00,0x00,
+0x10,0x05,0x01,0x00,0x37,0x02,0x02,0x04,0x15,0x02,0x00,0x00,0x1f,0x09,0x00,0x66,
+0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x69,0x20,0x3c,0x3d,0x20,0x30,0x78,
+0x37,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,
+0x3a,0x00,0x00,0x00,0x0c,0x02,0x00,0x07,0x00,0x00,0x71,0x08,0xff,0xff,0xff,0xff,
+0xff,0xff,0xff,0x7f,0x19,0x02,0x00,0x02,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x18,
+0x1f,0x0a,0x00,0x67,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x5f,0x64,0x6f,0x5f,0x6e,0x75,0x6d,0x62,0x65,0x72,0x28,0x27,0x3d,
+0x71,0x27,0x2c,0x20,0x69,0x2c,0x20,0x72,0x29,0x00,0x00,0x00,0x0e,0x02,0x00,0x03,
+0x00,0x00,0x00,0x0a,0x5f,0x64,0x6f,0x5f,0x6e,0x75,0x6d,0x62,0x65,0x72,0x00,0x00,
+0x0d,0x03,0x00,0x08,0x00,0x00,0x00,0x02,0x3d,0x71,0x00,0x00,0x10,0x04,0x00,0x00,
+0x10,0x05,0x01,0x00,0x37,0x02,0x02,0x04,0x15,0x02,0x00,0x00,0x1f,0x0a,0x00,0x69,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,
+0x64,0x6f,0x5f,0x6e,0x75,0x6d,0x62,0x65,0x72,0x28,0x27,0x3d,0x51,0x27,0x2c,0x20,
+0x69,0x2c,0x20,0x72,0x29,0x00,0x00,0x00,0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x0a,
+0x5f,0x64,0x6f,0x5f,0x6e,0x75,0x6d,0x62,0x65,0x72,0x00,0x00,0x0d,0x03,0x00,0x09,
+0x00,0x00,0x00,0x02,0x3d,0x51,0x00,0x00,0x10,0x04,0x00,0x00,0x10,0x05,0x01,0x00,
+0x37,0x02,0x02,0x04,0x15,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x0c,0x00,0x24,
+0x00,0x00,0x00,0x0b,0x5f,0x64,0x6f,0x5f,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x00,
+0x0f,0x0c,0x0b,0x00,0x1f,0x09,0x00,0x6b,0x64,0x65,0x66,0x20,0x5f,0x64,0x6f,0x5f,
+0x6e,0x75,0x6d,0x62,0x65,0x72,0x28,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,0x69,
+0x2c,0x20,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x33,0x0c,0x00,0x05,
+0x2a,0x24,0x31,0x34,0x32,0x00,0x00,0x00,0x0d,0x11,0x00,0x25,0x00,0x00,0x00,0x06,
+0x66,0x6f,0x72,0x6d,0x61,0x74,0x00,0x00,0x0d,0x12,0x00,0x15,0x00,0x00,0x00,0x01,
+0x69,0x00,0x00,0x00,0x0d,0x13,0x00,0x1f,0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,
+0x1c,0x0d,0x11,0x03,0x1d,0x11,0x00,0x00,0x1c,0x0e,0x11,0x01,0x1d,0x0f,0x00,0x00,
+0x1d,0x10,0x00,0x00,0x11,0x0c,0x00,0x9d,0x2d,0x0d,0x00,0x0e,0x00,0x00,0x00,0x01,
+0x1f,0x09,0x00,0x6b,0x64,0x65,0x66,0x20,0x5f,0x64,0x6f,0x5f,0x6e,0x75,0x6d,0x62,
+0x65,0x72,0x28,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,0x69,0x2c,0x20,0x72,0x3d,
+0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x06,0x66,0x6f,0x72,0x6d,
+0x61,0x74,0x00,0x00,0x33,0x01,0x00,0x01,0x69,0x00,0x00,0x00,0x33,0x02,0x00,0x01,
+0x72,0x00,0x00,0x00,0x0d,0x03,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x03,0x00,0x00,0x0d,0x03,0x00,0x01,
+0x00,0x00,0x00,0x0a,0x5f,0x64,0x6f,0x5f,0x6e,0x75,0x6d,0x62,0x65,0x72,0x00,0x00,
+0x23,0x03,0x00,0x00,0x1f,0x05,0x00,0x6c,0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,
+0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x28,0x72,0x29,0x00,0x00,0x0e,0x04,0x00,0x02,
+0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x00,0x10,0x05,0x02,0x00,
+0x37,0x02,0x04,0x02,0x1f,0x07,0x00,0x6d,0x20,0x20,0x20,0x20,0x62,0x75,0x66,0x20,
+0x3d,0x20,0x70,0x61,0x63,0x6b,0x28,0x66,0x6f,0x72,0x6d,0x61,0x74,0x2c,0x20,0x69,
+0x29,0x00,0x00,0x00,0x33,0x03,0x00,0x03,0x62,0x75,0x66,0x00,0x0e,0x05,0x00,0x03,
+0x00,0x00,0x00,0x04,0x70,0x61,0x63,0x6b,0x00,0x00,0x00,0x00,0x10,0x06,0x00,0x00,
+0x10,0x07,0x01,0x00,0x37,0x03,0x05,0x03,0x1f,0x0e,0x00,0x6e,0x20,0x20,0x20,0x20,
+0x63,0x6f,0x64,0x65,0x5f,0x31,0x36,0x28,0x4e,0x55,0x4d,0x42,0x45,0x52,0x2c,0x72,
+0x2c,0x63,0x6f,0x6e,0x73,0x74,0x5f,0x73,0x6c,0x6f,0x74,0x28,0x66,0x6f,0x72,0x6d,
+0x61,0x74,0x2e,0x65,0x6e,0x63,0x6f,0x64,0x65,0x28,0x29,0x2b,0x62,0x75,0x66,0x29,
+0x29,0x00,0x00,0x00,0x0e,0x05,0x00,0x04,0x00,0x00,0x00,0x07,0x63,0x6f,0x64,0x65,
+0x5f,0x31,0x36,0x00,0x0e,0x06,0x00,0x05,0x00,0x00,0x00,0x06,0x4e,0x55,0x4d,0x42,
+0x45,0x52,0x00,0x00,0x10,0x07,0x02,0x00,0x0e,0x09,0x00,0x06,0x00,0x00,0x00,0x0a,
+0x63,0x6f,0x6e,0x73,0x74,0x5f,0x73,0x6c,0x6f,0x74,0x00,0x00,0x0d,0x01,0x00,0x07,
+0x00,0x00,0x00,0x06,0x65,0x6e,0x63,0x6f,0x64,0x65,0x00,0x00,0x38,0x0b,0x00,0x01,
+0x00,0x00,0x00,0x00,0x39,0x0a,0x0b,0x02,0x01,0x0a,0x0a,0x03,0x37,0x08,0x09,0x02,
+0x37,0x04,0x05,0x04,0x1f,0x0a,0x00,0x6f,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,
+0x28,0x30,0x2c,0x30,0x2c,0x6f,0x72,0x64,0x28,0x66,0x6f,0x72,0x6d,0x61,0x74,0x5b,
+0x31,0x5d,0x29,0x2c,0x6c,0x65,0x6e,0x28,0x62,0x75,0x66,0x29,0x29,0x00,0x00,0x00,
+0x0e,0x05,0x00,0x08,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,
+0x0c,0x06,0x00,0x09,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0c,0x07,0x00,0x09,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0e,0x0a,0x00,0x0a,0x00,0x00,0x00,0x03,
+0x6f,0x72,0x64,0x00,0x0c,0x0c,0x00,0x0b,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x0b,0x00,0x0c,0x37,0x08,0x0a,0x02,0x0e,0x0a,0x00,0x0c,0x00,0x00,0x00,0x03,
+0x6c,0x65,0x6e,0x00,0x10,0x0b,0x03,0x00,0x37,0x09,0x0a,0x02,0x37,0x04,0x05,0x05,
+0x1f,0x04,0x00,0x70,0x20,0x20,0x20,0x20,0x77,0x72,0x69,0x74,0x65,0x28,0x62,0x75,
+0x66,0x29,0x00,0x00,0x0e,0x05,0x00,0x0d,0x00,0x00,0x00,0x05,0x77,0x72,0x69,0x74,
+0x65,0x00,0x00,0x00,0x10,0x06,0x03,0x00,0x37,0x04,0x05,0x02,0x1f,0x04,0x00,0x71,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,
+0x15,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x0d,0x00,0x26,0x00,0x00,0x00,0x0a,
+0x5f,0x64,0x6f,0x5f,0x6e,0x75,0x6d,0x62,0x65,0x72,0x00,0x00,0x0f,0x0d,0x0c,0x00,
+0x1f,0x06,0x00,0x73,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x66,0x6c,0x6f,0x61,0x74,
+0x28,0x74,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x33,0x0d,0x00,0x05,
+0x2a,0x24,0x31,0x35,0x32,0x00,0x00,0x00,0x0d,0x12,0x00,0x21,0x00,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x0d,0x13,0x00,0x1f,0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,
+0x1c,0x0e,0x12,0x02,0x1d,0x12,0x00,0x00,0x1c,0x0f,0x12,0x01,0x1d,0x10,0x00,0x00,
+0x1d,0x11,0x00,0x00,0x11,0x0d,0x00,0x50,0x2d,0x08,0x00,0x07,0x00,0x00,0x00,0x02,
+0x1f,0x06,0x00,0x73,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x66,0x6c,0x6f,0x61,0x74,
+0x28,0x74,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x33,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x72,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,
+0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,
+0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x08,0x64,0x6f,0x5f,0x66,
+0x6c,0x6f,0x61,0x74,0x00,0x00,0x00,0x00,0x23,0x02,0x00,0x00,0x1f,0x04,0x00,0x74,
+0x20,0x20,0x20,0x20,0x73,0x20,0x3d,0x20,0x74,0x2e,0x76,0x61,0x6c,0x00,0x00,0x00,
+0x33,0x02,0x00,0x01,0x73,0x00,0x00,0x00,0x0d,0x03,0x00,0x02,0x00,0x00,0x00,0x03,
+0x76,0x61,0x6c,0x00,0x09,0x02,0x00,0x03,0x00,0x00,0x00,0x00,0x1f,0x0d,0x00,0x75,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x64,0x6f,0x5f,0x6e,
+0x75,0x6d,0x62,0x65,0x72,0x28,0x27,0x3d,0x64,0x27,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+0x74,0x28,0x73,0x2e,0x65,0x6e,0x63,0x6f,0x64,0x65,0x28,0x29,0x29,0x2c,0x72,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x03,0x00,0x00,0x00,0x0a,0x5f,0x64,0x6f,0x5f,
+0x6e,0x75,0x6d,0x62,0x65,0x72,0x00,0x00,0x0d,0x04,0x00,0x04,0x00,0x00,0x00,0x02,
+0x3d,0x64,0x00,0x00,0x0e,0x05,0x00,0x05,0x00,0x00,0x00,0x05,0x66,0x6c,0x6f,0x61,
+0x74,0x00,0x00,0x00,0x0d,0x00,0x00,0x06,0x00,0x00,0x00,0x06,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x00,0x00,0x38,0x06,0x02,0x00,0x00,0x00,0x00,0x01,0x39,0x06,0x06,0x02,
+0x37,0x05,0x05,0x02,0x10,0x06,0x01,0x00,0x37,0x00,0x03,0x04,0x15,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x0e,0x00,0x27,0x00,0x00,0x00,0x08,0x64,0x6f,0x5f,0x66,
+0x6c,0x6f,0x61,0x74,0x00,0x00,0x00,0x00,0x0f,0x0e,0x0d,0x00,0x1f,0x07,0x00,0x77,
+0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x28,0x74,
+0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x00,0x33,0x0e,0x00,0x05,
+0x2a,0x24,0x31,0x36,0x31,0x00,0x00,0x00,0x0d,0x13,0x00,0x21,0x00,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x0d,0x14,0x00,0x1f,0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,
+0x1c,0x0f,0x13,0x02,0x1d,0x13,0x00,0x00,0x1c,0x10,0x13,0x01,0x1d,0x11,0x00,0x00,
+0x1d,0x12,0x00,0x00,0x11,0x0e,0x00,0x85,0x2d,0x09,0x00,0x0a,0x00,0x00,0x00,0x04,
+0x1f,0x07,0x00,0x77,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x69,0x6e,0x74,0x65,0x67,
+0x65,0x72,0x28,0x74,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x72,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x0a,
+0x64,0x6f,0x5f,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x00,0x00,0x23,0x02,0x00,0x00,
+0x1f,0x04,0x00,0x78,0x20,0x20,0x20,0x20,0x73,0x20,0x3d,0x20,0x74,0x2e,0x76,0x61,
+0x6c,0x00,0x00,0x00,0x33,0x02,0x00,0x01,0x73,0x00,0x00,0x00,0x0d,0x03,0x00,0x02,
+0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x09,0x02,0x00,0x03,0x00,0x00,0x00,0x00,
+0x1f,0x07,0x00,0x79,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x73,0x2e,0x73,0x74,0x61,
+0x72,0x74,0x73,0x77,0x69,0x74,0x68,0x28,0x27,0x30,0x78,0x27,0x29,0x3a,0x00,0x00,
+0x0d,0x06,0x00,0x03,0x00,0x00,0x00,0x0a,0x73,0x74,0x61,0x72,0x74,0x73,0x77,0x69,
+0x74,0x68,0x00,0x00,0x38,0x03,0x02,0x06,0x00,0x00,0x00,0x01,0x0d,0x05,0x00,0x04,
+0x00,0x00,0x00,0x02,0x30,0x78,0x00,0x00,0x39,0x05,0x03,0x03,0x16,0x05,0x00,0x00,
+0x13,0x00,0x00,0x22,0x1f,0x09,0x00,0x7a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x76,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x5b,0x32,0x3a,0x5d,0x2e,0x65,0x6e,
+0x63,0x6f,0x64,0x65,0x28,0x29,0x2c,0x20,0x31,0x36,0x29,0x00,0x33,0x05,0x00,0x01,
+0x76,0x00,0x00,0x00,0x0e,0x04,0x00,0x05,0x00,0x00,0x00,0x03,0x69,0x6e,0x74,0x00,
+0x0c,0x05,0x00,0x06,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x1d,0x06,0x00,0x00,
+0x1c,0x00,0x05,0x02,0x0a,0x02,0x02,0x00,0x0d,0x00,0x00,0x07,0x00,0x00,0x00,0x06,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x00,0x00,0x38,0x07,0x02,0x00,0x00,0x00,0x00,0x02,
+0x39,0x05,0x07,0x02,0x0c,0x06,0x00,0x08,0x00,0x00,0x69,0x04,0x10,0x00,0x00,0x00,
+0x37,0x05,0x04,0x03,0x13,0x00,0x00,0x14,0x1f,0x07,0x00,0x7c,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x76,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x2e,0x65,0x6e,
+0x63,0x6f,0x64,0x65,0x28,0x29,0x29,0x00,0x0e,0x04,0x00,0x05,0x00,0x00,0x00,0x03,
+0x69,0x6e,0x74,0x00,0x0d,0x08,0x00,0x07,0x00,0x00,0x00,0x06,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x00,0x00,0x38,0x06,0x02,0x08,0x00,0x00,0x00,0x03,0x39,0x05,0x06,0x02,
+0x37,0x05,0x04,0x02,0x1f,0x07,0x00,0x7d,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x5f,0x64,0x6f,0x5f,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x28,0x76,
+0x2c,0x72,0x29,0x00,0x0e,0x04,0x00,0x09,0x00,0x00,0x00,0x0b,0x5f,0x64,0x6f,0x5f,
+0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x00,0x10,0x06,0x01,0x00,0x37,0x03,0x04,0x03,
+0x15,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x0f,0x00,0x28,0x00,0x00,0x00,0x0a,
+0x64,0x6f,0x5f,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x00,0x00,0x0f,0x0f,0x0e,0x00,
+0x1f,0x04,0x00,0x7f,0x64,0x65,0x66,0x20,0x67,0x65,0x74,0x5f,0x74,0x61,0x67,0x28,
+0x29,0x3a,0x00,0x00,0x33,0x0f,0x00,0x05,0x2a,0x24,0x31,0x37,0x30,0x00,0x00,0x00,
+0x1c,0x10,0x00,0x00,0x1c,0x11,0x00,0x00,0x1d,0x12,0x00,0x00,0x1d,0x13,0x00,0x00,
+0x11,0x0f,0x00,0x53,0x2d,0x04,0x00,0x06,0x00,0x00,0x00,0x02,0x1f,0x04,0x00,0x7f,
+0x64,0x65,0x66,0x20,0x67,0x65,0x74,0x5f,0x74,0x61,0x67,0x28,0x29,0x3a,0x00,0x00,
+0x33,0x00,0x00,0x0b,0x5f,0x5f,0x76,0x61,0x72,0x61,0x72,0x67,0x73,0x5f,0x5f,0x00,
+0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x0d,0x00,0x00,0x01,0x00,0x00,0x00,0x07,
+0x67,0x65,0x74,0x5f,0x74,0x61,0x67,0x00,0x23,0x00,0x00,0x00,0x1f,0x06,0x00,0x80,
+0x20,0x20,0x20,0x20,0x6b,0x20,0x3d,0x20,0x73,0x74,0x72,0x28,0x44,0x2e,0x5f,0x74,
+0x61,0x67,0x69,0x29,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x6b,0x00,0x00,0x00,
+0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x03,0x73,0x74,0x72,0x00,0x0e,0x02,0x00,0x03,
+0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x00,0x00,0x04,0x00,0x00,0x00,0x05,
+0x5f,0x74,0x61,0x67,0x69,0x00,0x00,0x00,0x09,0x02,0x02,0x00,0x00,0x00,0x00,0x00,
+0x37,0x00,0x01,0x02,0x1f,0x05,0x00,0x81,0x20,0x20,0x20,0x20,0x44,0x2e,0x5f,0x74,
+0x61,0x67,0x69,0x20,0x2b,0x3d,0x20,0x31,0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x03,
+0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0e,0x01,0x00,0x03,0x00,0x00,0x00,0x01,
+0x44,0x00,0x00,0x00,0x0d,0x02,0x00,0x04,0x00,0x00,0x00,0x05,0x5f,0x74,0x61,0x67,
+0x69,0x00,0x00,0x00,0x09,0x01,0x01,0x02,0x00,0x00,0x00,0x01,0x0c,0x02,0x00,0x05,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x02,0x0d,0x02,0x00,0x04,
+0x00,0x00,0x00,0x05,0x5f,0x74,0x61,0x67,0x69,0x00,0x00,0x00,0x0b,0x03,0x02,0x01,
+0x1f,0x04,0x00,0x82,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6b,
+0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x10,0x00,0x29,
+0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,0x74,0x61,0x67,0x00,0x0f,0x10,0x0f,0x00,
+0x1f,0x05,0x00,0x83,0x64,0x65,0x66,0x20,0x73,0x74,0x61,0x63,0x6b,0x5f,0x74,0x61,
+0x67,0x28,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x10,0x00,0x05,0x2a,0x24,0x31,0x37,
+0x36,0x00,0x00,0x00,0x1c,0x11,0x00,0x00,0x1c,0x12,0x00,0x00,0x1d,0x13,0x00,0x00,
+0x1d,0x14,0x00,0x00,0x11,0x10,0x00,0x49,0x2d,0x05,0x00,0x06,0x00,0x00,0x00,0x02,
+0x1f,0x05,0x00,0x83,0x64,0x65,0x66,0x20,0x73,0x74,0x61,0x63,0x6b,0x5f,0x74,0x61,
+0x67,0x28,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x0b,0x5f,0x5f,0x76,0x61,
+0x72,0x61,0x72,0x67,0x73,0x5f,0x5f,0x00,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x00,0x00,0x00,
+0x0d,0x00,0x00,0x01,0x00,0x00,0x00,0x09,0x73,0x74,0x61,0x63,0x6b,0x5f,0x74,0x61,
+0x67,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x1f,0x05,0x00,0x84,0x20,0x20,0x20,0x20,
+0x6b,0x20,0x3d,0x20,0x67,0x65,0x74,0x5f,0x74,0x61,0x67,0x28,0x29,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x6b,0x00,0x00,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x07,
+0x67,0x65,0x74,0x5f,0x74,0x61,0x67,0x00,0x37,0x00,0x01,0x01,0x1f,0x06,0x00,0x85,
+0x20,0x20,0x20,0x20,0x44,0x2e,0x74,0x73,0x74,0x61,0x63,0x6b,0x2e,0x61,0x70,0x70,
+0x65,0x6e,0x64,0x28,0x6b,0x29,0x00,0x00,0x0e,0x03,0x00,0x03,0x00,0x00,0x00,0x01,
+0x44,0x00,0x00,0x00,0x0d,0x04,0x00,0x04,0x00,0x00,0x00,0x06,0x74,0x73,0x74,0x61,
+0x63,0x6b,0x00,0x00,0x09,0x03,0x03,0x04,0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x05,
+0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x01,0x03,0x04,
+0x00,0x00,0x00,0x01,0x10,0x03,0x00,0x00,0x39,0x01,0x01,0x03,0x1f,0x04,0x00,0x86,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6b,0x00,0x00,0x00,0x00,
+0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x11,0x00,0x2a,0x00,0x00,0x00,0x09,
+0x73,0x74,0x61,0x63,0x6b,0x5f,0x74,0x61,0x67,0x00,0x00,0x00,0x0f,0x11,0x10,0x00,
+0x1f,0x04,0x00,0x87,0x64,0x65,0x66,0x20,0x70,0x6f,0x70,0x5f,0x74,0x61,0x67,0x28,
+0x29,0x3a,0x00,0x00,0x33,0x11,0x00,0x05,0x2a,0x24,0x31,0x38,0x32,0x00,0x00,0x00,
+0x1c,0x12,0x00,0x00,0x1c,0x13,0x00,0x00,0x1d,0x14,0x00,0x00,0x1d,0x15,0x00,0x00,
+0x11,0x11,0x00,0x31,0x2d,0x05,0x00,0x05,0x00,0x00,0x00,0x02,0x1f,0x04,0x00,0x87,
+0x64,0x65,0x66,0x20,0x70,0x6f,0x70,0x5f,0x74,0x61,0x67,0x28,0x29,0x3a,0x00,0x00,
+0x33,0x00,0x00,0x0b,0x5f,0x5f,0x76,0x61,0x72,0x61,0x72,0x67,0x73,0x5f,0x5f,0x00,
+0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x07,
+0x70,0x6f,0x70,0x5f,0x74,0x61,0x67,0x00,0x23,0x01,0x00,0x00,0x1f,0x05,0x00,0x88,
+0x20,0x20,0x20,0x20,0x44,0x2e,0x74,0x73,0x74,0x61,0x63,0x6b,0x2e,0x70,0x6f,0x70,
+0x28,0x29,0x00,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x06,0x74,0x73,0x74,0x61,0x63,0x6b,0x00,0x00,
+0x09,0x01,0x01,0x02,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x04,0x00,0x00,0x00,0x03,
+0x70,0x6f,0x70,0x00,0x38,0x03,0x01,0x02,0x00,0x00,0x00,0x01,0x39,0x01,0x03,0x02,
+0x00,0x00,0x00,0x00,0x0d,0x12,0x00,0x2b,0x00,0x00,0x00,0x07,0x70,0x6f,0x70,0x5f,
+0x74,0x61,0x67,0x00,0x0f,0x12,0x11,0x00,0x1f,0x04,0x00,0x8a,0x64,0x65,0x66,0x20,
+0x74,0x61,0x67,0x28,0x2a,0x74,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x12,0x00,0x05,
+0x2a,0x24,0x31,0x38,0x38,0x00,0x00,0x00,0x1c,0x13,0x00,0x00,0x1c,0x14,0x00,0x00,
+0x0d,0x15,0x00,0x21,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x1d,0x16,0x00,0x00,
+0x11,0x12,0x00,0x63,0x2d,0x09,0x00,0x09,0x00,0x00,0x00,0x02,0x1f,0x04,0x00,0x8a,
+0x64,0x65,0x66,0x20,0x74,0x61,0x67,0x28,0x2a,0x74,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,0x23,0x01,0x00,0x00,
+0x1f,0x0d,0x00,0x8b,0x20,0x20,0x20,0x20,0x74,0x20,0x3d,0x20,0x44,0x2e,0x73,0x6e,
+0x75,0x6d,0x2b,0x27,0x3a,0x27,0x2b,0x27,0x3a,0x27,0x2e,0x6a,0x6f,0x69,0x6e,0x28,
+0x5b,0x73,0x74,0x72,0x28,0x76,0x29,0x20,0x66,0x6f,0x72,0x20,0x76,0x20,0x69,0x6e,
+0x20,0x74,0x5d,0x29,0x00,0x00,0x00,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x01,
+0x44,0x00,0x00,0x00,0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x04,0x73,0x6e,0x75,0x6d,
+0x00,0x00,0x00,0x00,0x09,0x01,0x01,0x02,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x04,
+0x00,0x00,0x00,0x01,0x3a,0x00,0x00,0x00,0x01,0x01,0x01,0x02,0x0d,0x05,0x00,0x04,
+0x00,0x00,0x00,0x01,0x3a,0x00,0x00,0x00,0x0d,0x02,0x00,0x05,0x00,0x00,0x00,0x04,
+0x6a,0x6f,0x69,0x6e,0x00,0x00,0x00,0x00,0x38,0x03,0x05,0x02,0x00,0x00,0x00,0x01,
+0x33,0x05,0x00,0x07,0x63,0x6f,0x6d,0x70,0x3a,0x33,0x38,0x00,0x1c,0x05,0x00,0x00,
+0x0c,0x06,0x00,0x06,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x02,0x00,0x06,
+0x13,0x00,0x00,0x0b,0x33,0x02,0x00,0x01,0x76,0x00,0x00,0x00,0x0e,0x07,0x00,0x07,
+0x00,0x00,0x00,0x03,0x73,0x74,0x72,0x00,0x10,0x08,0x02,0x00,0x37,0x02,0x07,0x02,
+0x1d,0x07,0x00,0x00,0x0b,0x05,0x07,0x02,0x13,0x00,0xff,0xf5,0x39,0x02,0x03,0x03,
+0x01,0x00,0x01,0x02,0x1f,0x06,0x00,0x8c,0x20,0x20,0x20,0x20,0x69,0x6e,0x73,0x65,
+0x72,0x74,0x28,0x28,0x27,0x74,0x61,0x67,0x27,0x2c,0x74,0x29,0x29,0x00,0x00,0x00,
+0x0e,0x02,0x00,0x08,0x00,0x00,0x00,0x06,0x69,0x6e,0x73,0x65,0x72,0x74,0x00,0x00,
+0x0d,0x04,0x00,0x01,0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,0x10,0x05,0x00,0x00,
+0x1c,0x03,0x04,0x02,0x37,0x01,0x02,0x02,0x00,0x00,0x00,0x00,0x0d,0x13,0x00,0x2c,
+0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,0x0f,0x13,0x12,0x00,0x1f,0x04,0x00,0x8d,
+0x64,0x65,0x66,0x20,0x6a,0x75,0x6d,0x70,0x28,0x2a,0x74,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x13,0x00,0x05,0x2a,0x24,0x31,0x39,0x34,0x00,0x00,0x00,0x1c,0x14,0x00,0x00,
+0x1c,0x15,0x00,0x00,0x0d,0x16,0x00,0x21,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x1d,0x17,0x00,0x00,0x11,0x13,0x00,0x65,0x2d,0x09,0x00,0x09,0x00,0x00,0x00,0x02,
+0x1f,0x04,0x00,0x8d,0x64,0x65,0x66,0x20,0x6a,0x75,0x6d,0x70,0x28,0x2a,0x74,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x04,0x6a,0x75,0x6d,0x70,
+0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x0d,0x00,0x8e,0x20,0x20,0x20,0x20,
+0x74,0x20,0x3d,0x20,0x44,0x2e,0x73,0x6e,0x75,0x6d,0x2b,0x27,0x3a,0x27,0x2b,0x27,
+0x3a,0x27,0x2e,0x6a,0x6f,0x69,0x6e,0x28,0x5b,0x73,0x74,0x72,0x28,0x76,0x29,0x20,
+0x66,0x6f,0x72,0x20,0x76,0x20,0x69,0x6e,0x20,0x74,0x5d,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x02,0x00,0x03,
+0x00,0x00,0x00,0x04,0x73,0x6e,0x75,0x6d,0x00,0x00,0x00,0x00,0x09,0x01,0x01,0x02,
+0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x04,0x00,0x00,0x00,0x01,0x3a,0x00,0x00,0x00,
+0x01,0x01,0x01,0x02,0x0d,0x05,0x00,0x04,0x00,0x00,0x00,0x01,0x3a,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x05,0x00,0x00,0x00,0x04,0x6a,0x6f,0x69,0x6e,0x00,0x00,0x00,0x00,
+0x38,0x03,0x05,0x02,0x00,0x00,0x00,0x01,0x33,0x05,0x00,0x07,0x63,0x6f,0x6d,0x70,
+0x3a,0x34,0x31,0x00,0x1c,0x05,0x00,0x00,0x0c,0x06,0x00,0x06,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x2b,0x02,0x00,0x06,0x13,0x00,0x00,0x0b,0x33,0x02,0x00,0x01,
+0x76,0x00,0x00,0x00,0x0e,0x07,0x00,0x07,0x00,0x00,0x00,0x03,0x73,0x74,0x72,0x00,
+0x10,0x08,0x02,0x00,0x37,0x02,0x07,0x02,0x1d,0x07,0x00,0x00,0x0b,0x05,0x07,0x02,
+0x13,0x00,0xff,0xf5,0x39,0x02,0x03,0x03,0x01,0x00,0x01,0x02,0x1f,0x06,0x00,0x8f,
+0x20,0x20,0x20,0x20,0x69,0x6e,0x73,0x65,0x72,0x74,0x28,0x28,0x27,0x6a,0x75,0x6d,
+0x70,0x27,0x2c,0x74,0x29,0x29,0x00,0x00,0x0e,0x02,0x00,0x08,0x00,0x00,0x00,0x06,
+0x69,0x6e,0x73,0x65,0x72,0x74,0x00,0x00,0x0d,0x04,0x00,0x01,0x00,0x00,0x00,0x04,
+0x6a,0x75,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x05,0x00,0x00,0x1c,0x03,0x04,0x02,
+0x37,0x01,0x02,0x02,0x00,0x00,0x00,0x00,0x0d,0x14,0x00,0x2d,0x00,0x00,0x00,0x04,
+0x6a,0x75,0x6d,0x70,0x00,0x00,0x00,0x00,0x0f,0x14,0x13,0x00,0x1f,0x04,0x00,0x90,
+0x64,0x65,0x66,0x20,0x73,0x65,0x74,0x6a,0x6d,0x70,0x28,0x2a,0x74,0x29,0x3a,0x00,
+0x33,0x14,0x00,0x05,0x2a,0x24,0x32,0x30,0x30,0x00,0x00,0x00,0x1c,0x15,0x00,0x00,
+0x1c,0x16,0x00,0x00,0x0d,0x17,0x00,0x21,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x1d,0x18,0x00,0x00,0x11,0x14,0x00,0x66,0x2d,0x09,0x00,0x09,0x00,0x00,0x00,0x02,
+0x1f,0x04,0x00,0x90,0x64,0x65,0x66,0x20,0x73,0x65,0x74,0x6a,0x6d,0x70,0x28,0x2a,
+0x74,0x29,0x3a,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x06,0x73,0x65,0x74,0x6a,
+0x6d,0x70,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x0d,0x00,0x91,0x20,0x20,0x20,0x20,
+0x74,0x20,0x3d,0x20,0x44,0x2e,0x73,0x6e,0x75,0x6d,0x2b,0x27,0x3a,0x27,0x2b,0x27,
+0x3a,0x27,0x2e,0x6a,0x6f,0x69,0x6e,0x28,0x5b,0x73,0x74,0x72,0x28,0x76,0x29,0x20,
+0x66,0x6f,0x72,0x20,0x76,0x20,0x69,0x6e,0x20,0x74,0x5d,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x02,0x00,0x03,
+0x00,0x00,0x00,0x04,0x73,0x6e,0x75,0x6d,0x00,0x00,0x00,0x00,0x09,0x01,0x01,0x02,
+0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x04,0x00,0x00,0x00,0x01,0x3a,0x00,0x00,0x00,
+0x01,0x01,0x01,0x02,0x0d,0x05,0x00,0x04,0x00,0x00,0x00,0x01,0x3a,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x05,0x00,0x00,0x00,0x04,0x6a,0x6f,0x69,0x6e,0x00,0x00,0x00,0x00,
+0x38,0x03,0x05,0x02,0x00,0x00,0x00,0x01,0x33,0x05,0x00,0x07,0x63,0x6f,0x6d,0x70,
+0x3a,0x34,0x34,0x00,0x1c,0x05,0x00,0x00,0x0c,0x06,0x00,0x06,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x2b,0x02,0x00,0x06,0x13,0x00,0x00,0x0b,0x33,0x02,0x00,0x01,
+0x76,0x00,0x00,0x00,0x0e,0x07,0x00,0x07,0x00,0x00,0x00,0x03,0x73,0x74,0x72,0x00,
+0x10,0x08,0x02,0x00,0x37,0x02,0x07,0x02,0x1d,0x07,0x00,0x00,0x0b,0x05,0x07,0x02,
+0x13,0x00,0xff,0xf5,0x39,0x02,0x03,0x03,0x01,0x00,0x01,0x02,0x1f,0x07,0x00,0x92,
+0x20,0x20,0x20,0x20,0x69,0x6e,0x73,0x65,0x72,0x74,0x28,0x28,0x27,0x73,0x65,0x74,
+0x6a,0x6d,0x70,0x27,0x2c,0x74,0x29,0x29,0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x08,
+0x00,0x00,0x00,0x06,0x69,0x6e,0x73,0x65,0x72,0x74,0x00,0x00,0x0d,0x04,0x00,0x01,
+0x00,0x00,0x00,0x06,0x73,0x65,0x74,0x6a,0x6d,0x70,0x00,0x00,0x10,0x05,0x00,0x00,
+0x1c,0x03,0x04,0x02,0x37,0x01,0x02,0x02,0x00,0x00,0x00,0x00,0x0d,0x15,0x00,0x2e,
+0x00,0x00,0x00,0x06,0x73,0x65,0x74,0x6a,0x6d,0x70,0x00,0x00,0x0f,0x15,0x14,0x00,
+0x1f,0x08,0x00,0x93,0x64,0x65,0x66,0x20,0x64,0x65,0x66,0x66,0x6e,0x63,0x28,0x74,
+0x6f,0x6b,0x2c,0x20,0x69,0x74,0x65,0x6d,0x73,0x2c,0x20,0x65,0x6e,0x64,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x15,0x00,0x05,0x2a,0x24,0x32,0x30,0x36,0x00,0x00,0x00,
+0x0d,0x1a,0x00,0x2f,0x00,0x00,0x00,0x03,0x74,0x6f,0x6b,0x00,0x0d,0x1b,0x00,0x30,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x0d,0x1c,0x00,0x31,
+0x00,0x00,0x00,0x03,0x65,0x6e,0x64,0x00,0x1c,0x16,0x1a,0x03,0x1c,0x17,0x00,0x00,
+0x1d,0x18,0x00,0x00,0x1d,0x19,0x00,0x00,0x11,0x15,0x02,0x75,0x2d,0x18,0x00,0x1c,
+0x00,0x00,0x00,0x0c,0x1f,0x08,0x00,0x93,0x64,0x65,0x66,0x20,0x64,0x65,0x66,0x66,
+0x6e,0x63,0x28,0x74,0x6f,0x6b,0x2c,0x20,0x69,0x74,0x65,0x6d,0x73,0x2c,0x20,0x65,
+0x6e,0x64,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x03,0x74,0x6f,0x6b,0x00,
+0x33,0x01,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x33,0x02,0x00,0x03,
+0x65,0x6e,0x64,0x00,0x0d,0x03,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x03,0x00,0x00,0x0d,0x03,0x00,0x01,
+0x00,0x00,0x00,0x06,0x64,0x65,0x66,0x66,0x6e,0x63,0x00,0x00,0x23,0x03,0x00,0x00,
+0x1f,0x08,0x00,0x94,0x20,0x20,0x20,0x20,0x70,0x2c,0x6e,0x2c,0x6c,0x2c,0x64,0x20,
+0x3d,0x20,0x70,0x5f,0x66,0x69,0x6c,0x74,0x65,0x72,0x28,0x69,0x74,0x65,0x6d,0x73,
+0x29,0x00,0x00,0x00,0x0e,0x04,0x00,0x02,0x00,0x00,0x00,0x08,0x70,0x5f,0x66,0x69,
+0x6c,0x74,0x65,0x72,0x00,0x00,0x00,0x00,0x10,0x05,0x01,0x00,0x37,0x03,0x04,0x02,
+0x33,0x03,0x00,0x03,0x2a,0x24,0x32,0x00,0x33,0x04,0x00,0x01,0x70,0x00,0x00,0x00,
+0x0c,0x01,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x04,0x03,0x01,
+0x33,0x05,0x00,0x01,0x6e,0x00,0x00,0x00,0x0c,0x06,0x00,0x04,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x05,0x03,0x06,0x33,0x01,0x00,0x01,0x6c,0x00,0x00,0x00,
+0x0c,0x07,0x00,0x05,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x0a,0x01,0x03,0x07,
+0x33,0x06,0x00,0x01,0x64,0x00,0x00,0x00,0x0c,0x08,0x00,0x06,0x00,0x00,0x69,0x04,
+0x03,0x00,0x00,0x00,0x0a,0x06,0x03,0x08,0x1f,0x0a,0x00,0x96,0x20,0x20,0x20,0x20,
+0x61,0x72,0x67,0x73,0x20,0x3d,0x20,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x6f,0x6b,
+0x2e,0x70,0x6f,0x73,0x2c,0x20,0x27,0x6c,0x69,0x73,0x74,0x27,0x2c,0x20,0x30,0x2c,
+0x00,0x00,0x00,0x00,0x33,0x03,0x00,0x04,0x61,0x72,0x67,0x73,0x00,0x00,0x00,0x00,
+0x0e,0x08,0x00,0x07,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x08,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x09,0x00,0x03,
+0x00,0x00,0x00,0x00,0x0d,0x0a,0x00,0x09,0x00,0x00,0x00,0x04,0x6c,0x69,0x73,0x74,
+0x00,0x00,0x00,0x00,0x0c,0x0b,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x1f,0x0c,0x00,0x98,0x20,0x20,0x20,0x20,0x20,0x20,0x2b,0x20,0x5b,0x20,0x69,0x2e,
+0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x61,0x73,0x5f,0x73,0x74,0x72,0x69,
+0x6e,0x67,0x28,0x29,0x20,0x66,0x6f,0x72,0x20,0x69,0x20,0x69,0x6e,0x20,0x6e,0x5d,
+0x00,0x00,0x00,0x00,0x1f,0x09,0x00,0x97,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x5b,0x20,0x69,0x2e,0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x28,0x29,0x20,
+0x66,0x6f,0x72,0x20,0x69,0x20,0x69,0x6e,0x20,0x70,0x5d,0x00,0x33,0x03,0x00,0x07,
+0x63,0x6f,0x6d,0x70,0x3a,0x34,0x37,0x00,0x1c,0x03,0x00,0x00,0x0c,0x0d,0x00,0x03,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x11,0x04,0x0d,0x13,0x00,0x00,0x0f,
+0x33,0x07,0x00,0x01,0x69,0x00,0x00,0x00,0x10,0x07,0x11,0x00,0x0d,0x14,0x00,0x0a,
+0x00,0x00,0x00,0x09,0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,
+0x38,0x12,0x07,0x14,0x00,0x00,0x00,0x01,0x39,0x11,0x12,0x02,0x1d,0x12,0x00,0x00,
+0x0b,0x03,0x12,0x11,0x13,0x00,0xff,0xf1,0x1f,0x0c,0x00,0x98,0x20,0x20,0x20,0x20,
+0x20,0x20,0x2b,0x20,0x5b,0x20,0x69,0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,
+0x2e,0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x28,0x29,0x20,0x66,0x6f,0x72,
+0x20,0x69,0x20,0x69,0x6e,0x20,0x6e,0x5d,0x00,0x00,0x00,0x00,0x33,0x11,0x00,0x07,
+0x63,0x6f,0x6d,0x70,0x3a,0x34,0x39,0x00,0x1c,0x11,0x00,0x00,0x0c,0x12,0x00,0x03,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x0d,0x05,0x12,0x13,0x00,0x00,0x17,
+0x10,0x07,0x0d,0x00,0x0d,0x16,0x00,0x0b,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x09,0x15,0x07,0x16,0x00,0x00,0x00,0x02,0x0c,0x16,0x00,0x03,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x15,0x15,0x16,0x0d,0x16,0x00,0x0a,
+0x00,0x00,0x00,0x09,0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,
+0x38,0x13,0x15,0x16,0x00,0x00,0x00,0x03,0x39,0x0d,0x13,0x02,0x1d,0x13,0x00,0x00,
+0x0b,0x11,0x13,0x0d,0x13,0x00,0xff,0xe9,0x01,0x0c,0x03,0x11,0x37,0x03,0x08,0x05,
+0x1f,0x11,0x00,0x9b,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x73,
+0x20,0x3d,0x20,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x6f,0x6b,0x2e,0x70,0x6f,0x73,
+0x2c,0x20,0x27,0x6c,0x69,0x73,0x74,0x27,0x2c,0x20,0x30,0x2c,0x20,0x5b,0x20,0x69,
+0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,0x31,0x5d,0x20,0x66,0x6f,0x72,0x20,0x69,0x20,
+0x69,0x6e,0x20,0x6e,0x5d,0x29,0x00,0x00,0x33,0x07,0x00,0x08,0x64,0x65,0x66,0x61,
+0x75,0x6c,0x74,0x73,0x00,0x00,0x00,0x00,0x0e,0x12,0x00,0x07,0x00,0x00,0x00,0x05,
+0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0d,0x09,0x00,0x08,0x00,0x00,0x00,0x03,
+0x70,0x6f,0x73,0x00,0x09,0x13,0x00,0x09,0x00,0x00,0x00,0x04,0x0d,0x14,0x00,0x09,
+0x00,0x00,0x00,0x04,0x6c,0x69,0x73,0x74,0x00,0x00,0x00,0x00,0x0c,0x15,0x00,0x03,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x33,0x09,0x00,0x07,0x63,0x6f,0x6d,0x70,
+0x3a,0x35,0x31,0x00,0x1c,0x09,0x00,0x00,0x0c,0x0b,0x00,0x03,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x2b,0x0a,0x05,0x0b,0x13,0x00,0x00,0x0f,0x10,0x07,0x0a,0x00,
+0x0d,0x0c,0x00,0x0b,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x09,0x0a,0x07,0x0c,0x00,0x00,0x00,0x05,0x0c,0x0c,0x00,0x04,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x0a,0x0a,0x0c,0x1d,0x0c,0x00,0x00,0x0b,0x09,0x0c,0x0a,
+0x13,0x00,0xff,0xf1,0x10,0x16,0x09,0x00,0x37,0x07,0x12,0x05,0x1f,0x0e,0x00,0x9e,
+0x20,0x20,0x20,0x20,0x72,0x66,0x2c,0x20,0x72,0x61,0x72,0x67,0x73,0x2c,0x72,0x64,
+0x65,0x66,0x61,0x75,0x6c,0x74,0x73,0x2c,0x72,0x76,0x61,0x72,0x61,0x72,0x67,0x73,
+0x2c,0x72,0x76,0x61,0x72,0x6b,0x77,0x20,0x3d,0x20,0x67,0x65,0x74,0x5f,0x74,0x6d,
+0x70,0x73,0x28,0x35,0x29,0x00,0x00,0x00,0x0e,0x0a,0x00,0x0c,0x00,0x00,0x00,0x08,
+0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x73,0x00,0x00,0x00,0x00,0x0c,0x0b,0x00,0x0d,
+0x00,0x00,0x69,0x04,0x05,0x00,0x00,0x00,0x37,0x08,0x0a,0x02,0x33,0x08,0x00,0x04,
+0x2a,0x24,0x35,0x30,0x00,0x00,0x00,0x00,0x33,0x0a,0x00,0x02,0x72,0x66,0x00,0x00,
+0x0c,0x0c,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x0a,0x08,0x0c,
+0x33,0x0b,0x00,0x05,0x72,0x61,0x72,0x67,0x73,0x00,0x00,0x00,0x0c,0x0d,0x00,0x04,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x0b,0x08,0x0d,0x33,0x0c,0x00,0x09,
+0x72,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x73,0x00,0x00,0x00,0x0c,0x12,0x00,0x05,
+0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x0a,0x0c,0x08,0x12,0x33,0x0d,0x00,0x08,
+0x72,0x76,0x61,0x72,0x61,0x72,0x67,0x73,0x00,0x00,0x00,0x00,0x0c,0x13,0x00,0x06,
+0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,0x0a,0x0d,0x08,0x13,0x33,0x12,0x00,0x06,
+0x72,0x76,0x61,0x72,0x6b,0x77,0x00,0x00,0x0c,0x14,0x00,0x0e,0x00,0x00,0x69,0x04,
+0x04,0x00,0x00,0x00,0x0a,0x12,0x08,0x14,0x1f,0x04,0x00,0x9f,0x20,0x20,0x20,0x20,
+0x75,0x6e,0x5f,0x74,0x6d,0x70,0x28,0x72,0x66,0x29,0x00,0x00,0x0e,0x13,0x00,0x0f,
+0x00,0x00,0x00,0x06,0x75,0x6e,0x5f,0x74,0x6d,0x70,0x00,0x00,0x10,0x14,0x0a,0x00,
+0x37,0x08,0x13,0x02,0x1f,0x07,0x00,0xa0,0x20,0x20,0x20,0x20,0x64,0x6f,0x5f,0x6c,
+0x69,0x73,0x74,0x28,0x61,0x72,0x67,0x73,0x2c,0x20,0x72,0x61,0x72,0x67,0x73,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x13,0x00,0x10,0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x6c,
+0x69,0x73,0x74,0x00,0x10,0x14,0x03,0x00,0x10,0x15,0x0b,0x00,0x37,0x08,0x13,0x03,
+0x1f,0x09,0x00,0xa1,0x20,0x20,0x20,0x20,0x64,0x6f,0x5f,0x6c,0x69,0x73,0x74,0x28,
+0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x73,0x2c,0x20,0x72,0x64,0x65,0x66,0x61,0x75,
+0x6c,0x74,0x73,0x29,0x00,0x00,0x00,0x00,0x0e,0x13,0x00,0x10,0x00,0x00,0x00,0x07,
+0x64,0x6f,0x5f,0x6c,0x69,0x73,0x74,0x00,0x10,0x14,0x07,0x00,0x10,0x15,0x0c,0x00,
+0x37,0x08,0x13,0x03,0x1f,0x05,0x00,0xa2,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6c,
+0x20,0x21,0x3d,0x20,0x4e,0x6f,0x6e,0x65,0x3a,0x00,0x00,0x00,0x1d,0x13,0x00,0x00,
+0x24,0x08,0x01,0x13,0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x29,0x1f,0x0d,0x00,0xa3,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x6f,0x5f,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x28,0x6c,0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x61,0x73,0x5f,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x28,0x29,0x2c,0x20,0x72,0x76,0x61,0x72,0x61,0x72,
+0x67,0x73,0x29,0x00,0x0e,0x13,0x00,0x11,0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,0x0d,0x00,0x00,0x0b,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x01,0x01,0x00,0x00,0x00,0x00,0x06,
+0x0c,0x00,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x01,0x01,0x00,
+0x0d,0x00,0x00,0x0a,0x00,0x00,0x00,0x09,0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x00,0x00,0x00,0x38,0x16,0x01,0x00,0x00,0x00,0x00,0x07,0x39,0x14,0x16,0x02,
+0x10,0x15,0x0d,0x00,0x37,0x08,0x13,0x03,0x13,0x00,0x00,0x10,0x1f,0x07,0x00,0xa5,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x64,0x6f,0x5f,0x6e,0x6f,0x6e,0x65,
+0x28,0x72,0x76,0x61,0x72,0x61,0x72,0x67,0x73,0x29,0x00,0x00,0x0e,0x13,0x00,0x12,
+0x00,0x00,0x00,0x08,0x5f,0x64,0x6f,0x5f,0x6e,0x6f,0x6e,0x65,0x00,0x00,0x00,0x00,
+0x10,0x14,0x0d,0x00,0x37,0x08,0x13,0x02,0x1f,0x05,0x00,0xa6,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x64,0x20,0x21,0x3d,0x20,0x4e,0x6f,0x6e,0x65,0x3a,0x00,0x00,0x00,
+0x1d,0x13,0x00,0x00,0x24,0x08,0x06,0x13,0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x29,
+0x1f,0x0d,0x00,0xa7,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x6f,0x5f,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x28,0x64,0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,
+0x2e,0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x28,0x29,0x2c,0x20,0x72,0x76,
+0x61,0x72,0x6b,0x77,0x29,0x00,0x00,0x00,0x0e,0x13,0x00,0x11,0x00,0x00,0x00,0x09,
+0x64,0x6f,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,0x0d,0x00,0x00,0x0b,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x01,0x06,0x00,
+0x00,0x00,0x00,0x08,0x0c,0x00,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x01,0x01,0x00,0x0d,0x00,0x00,0x0a,0x00,0x00,0x00,0x09,0x61,0x73,0x5f,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,0x38,0x16,0x01,0x00,0x00,0x00,0x00,0x09,
+0x39,0x14,0x16,0x02,0x10,0x15,0x12,0x00,0x37,0x08,0x13,0x03,0x13,0x00,0x00,0x10,
+0x1f,0x07,0x00,0xa9,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x64,0x6f,0x5f,
+0x6e,0x6f,0x6e,0x65,0x28,0x72,0x76,0x61,0x72,0x6b,0x77,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x13,0x00,0x12,0x00,0x00,0x00,0x08,0x5f,0x64,0x6f,0x5f,0x6e,0x6f,0x6e,0x65,
+0x00,0x00,0x00,0x00,0x10,0x14,0x12,0x00,0x37,0x08,0x13,0x02,0x1f,0x07,0x00,0xab,
+0x20,0x20,0x20,0x20,0x74,0x20,0x3d,0x20,0x5b,0x67,0x65,0x74,0x5f,0x74,0x61,0x67,
+0x28,0x29,0x2c,0x20,0x65,0x6e,0x64,0x5d,0x00,0x00,0x00,0x00,0x33,0x08,0x00,0x01,
+0x74,0x00,0x00,0x00,0x0e,0x16,0x00,0x13,0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,
+0x74,0x61,0x67,0x00,0x37,0x14,0x16,0x01,0x10,0x15,0x02,0x00,0x1c,0x08,0x14,0x02,
+0x1f,0x0d,0x00,0xac,0x20,0x20,0x20,0x20,0x6e,0x20,0x3d,0x20,0x44,0x2e,0x73,0x6e,
+0x75,0x6d,0x2b,0x27,0x3a,0x27,0x2b,0x27,0x3a,0x27,0x2e,0x6a,0x6f,0x69,0x6e,0x28,
+0x5b,0x73,0x74,0x72,0x28,0x76,0x29,0x20,0x66,0x6f,0x72,0x20,0x76,0x20,0x69,0x6e,
+0x20,0x74,0x5d,0x29,0x00,0x00,0x00,0x00,0x0e,0x13,0x00,0x14,0x00,0x00,0x00,0x01,
+0x44,0x00,0x00,0x00,0x0d,0x14,0x00,0x15,0x00,0x00,0x00,0x04,0x73,0x6e,0x75,0x6d,
+0x00,0x00,0x00,0x00,0x09,0x13,0x13,0x14,0x00,0x00,0x00,0x0a,0x0d,0x14,0x00,0x16,
+0x00,0x00,0x00,0x01,0x3a,0x00,0x00,0x00,0x01,0x13,0x13,0x14,0x0d,0x01,0x00,0x16,
+0x00,0x00,0x00,0x01,0x3a,0x00,0x00,0x00,0x0d,0x00,0x00,0x17,0x00,0x00,0x00,0x04,
+0x6a,0x6f,0x69,0x6e,0x00,0x00,0x00,0x00,0x38,0x15,0x01,0x00,0x00,0x00,0x00,0x0b,
+0x33,0x01,0x00,0x07,0x63,0x6f,0x6d,0x70,0x3a,0x35,0x35,0x00,0x1c,0x01,0x00,0x00,
+0x0c,0x02,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x00,0x08,0x02,
+0x13,0x00,0x00,0x0b,0x33,0x00,0x00,0x01,0x76,0x00,0x00,0x00,0x0e,0x03,0x00,0x18,
+0x00,0x00,0x00,0x03,0x73,0x74,0x72,0x00,0x10,0x04,0x00,0x00,0x37,0x00,0x03,0x02,
+0x1d,0x03,0x00,0x00,0x0b,0x01,0x03,0x00,0x13,0x00,0xff,0xf5,0x10,0x17,0x01,0x00,
+0x39,0x14,0x15,0x03,0x01,0x05,0x13,0x14,0x1f,0x07,0x00,0xae,0x20,0x20,0x20,0x20,
+0x69,0x6e,0x73,0x65,0x72,0x74,0x28,0x28,0x27,0x66,0x6e,0x63,0x27,0x2c,0x72,0x66,
+0x2c,0x6e,0x29,0x29,0x00,0x00,0x00,0x00,0x0e,0x14,0x00,0x19,0x00,0x00,0x00,0x06,
+0x69,0x6e,0x73,0x65,0x72,0x74,0x00,0x00,0x0d,0x03,0x00,0x1a,0x00,0x00,0x00,0x03,
+0x66,0x6e,0x63,0x00,0x10,0x04,0x0a,0x00,0x1c,0x15,0x03,0x03,0x37,0x13,0x14,0x02,
+0x1f,0x0d,0x00,0xaf,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x73,0x28,0x5b,0x72,0x61,0x72,0x67,0x73,0x2c,0x20,0x72,0x64,0x65,0x66,0x61,0x75,
+0x6c,0x74,0x73,0x2c,0x20,0x72,0x76,0x61,0x72,0x61,0x72,0x67,0x73,0x2c,0x20,0x72,
+0x76,0x61,0x72,0x6b,0x77,0x5d,0x29,0x00,0x0e,0x14,0x00,0x1b,0x00,0x00,0x00,0x09,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x73,0x00,0x00,0x00,0x10,0x03,0x0b,0x00,
+0x10,0x04,0x0c,0x00,0x10,0x05,0x0d,0x00,0x10,0x06,0x12,0x00,0x1c,0x15,0x03,0x04,
+0x37,0x13,0x14,0x02,0x1f,0x05,0x00,0xb0,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x72,0x66,0x2c,0x20,0x74,0x5b,0x30,0x5d,0x00,0x10,0x14,0x0a,0x00,
+0x0c,0x16,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x15,0x08,0x16,
+0x1c,0x13,0x14,0x02,0x15,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x16,0x00,0x32,
+0x00,0x00,0x00,0x06,0x64,0x65,0x66,0x66,0x6e,0x63,0x00,0x00,0x0f,0x16,0x15,0x00,
+0x1f,0x04,0x00,0xb2,0x64,0x65,0x66,0x20,0x6d,0x61,0x70,0x5f,0x74,0x61,0x67,0x73,
+0x28,0x29,0x3a,0x00,0x33,0x16,0x00,0x05,0x2a,0x24,0x32,0x31,0x35,0x00,0x00,0x00,
+0x1c,0x17,0x00,0x00,0x1c,0x18,0x00,0x00,0x1d,0x19,0x00,0x00,0x1d,0x1a,0x00,0x00,
+0x11,0x16,0x03,0x07,0x2d,0x13,0x00,0x1d,0x00,0x00,0x00,0x04,0x1f,0x04,0x00,0xb2,
+0x64,0x65,0x66,0x20,0x6d,0x61,0x70,0x5f,0x74,0x61,0x67,0x73,0x28,0x29,0x3a,0x00,
+0x33,0x00,0x00,0x0b,0x5f,0x5f,0x76,0x61,0x72,0x61,0x72,0x67,0x73,0x5f,0x5f,0x00,
+0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x08,
+0x6d,0x61,0x70,0x5f,0x74,0x61,0x67,0x73,0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,
+0x1f,0x04,0x00,0xb3,0x20,0x20,0x20,0x20,0x74,0x61,0x67,0x73,0x20,0x3d,0x20,0x7b,
+0x7d,0x00,0x00,0x00,0x33,0x01,0x00,0x04,0x74,0x61,0x67,0x73,0x00,0x00,0x00,0x00,
+0x1b,0x01,0x00,0x00,0x1f,0x04,0x00,0xb4,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x20,
+0x3d,0x20,0x5b,0x5d,0x00,0x00,0x00,0x00,0x33,0x02,0x00,0x03,0x6f,0x75,0x74,0x00,
+0x1c,0x02,0x00,0x00,0x1f,0x03,0x00,0xb5,0x20,0x20,0x20,0x20,0x6e,0x20,0x3d,0x20,
+0x30,0x00,0x00,0x00,0x33,0x04,0x00,0x01,0x6e,0x00,0x00,0x00,0x0c,0x03,0x00,0x02,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x10,0x04,0x03,0x00,0x1f,0x06,0x00,0xb6,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x69,0x74,0x65,0x6d,0x20,0x69,0x6e,0x20,
+0x44,0x2e,0x6f,0x75,0x74,0x3a,0x00,0x00,0x0e,0x05,0x00,0x03,0x00,0x00,0x00,0x01,
+0x44,0x00,0x00,0x00,0x0d,0x06,0x00,0x04,0x00,0x00,0x00,0x03,0x6f,0x75,0x74,0x00,
+0x09,0x05,0x05,0x06,0x00,0x00,0x00,0x00,0x0c,0x06,0x00,0x02,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x2b,0x03,0x05,0x06,0x13,0x00,0x00,0xbd,0x33,0x07,0x00,0x04,
+0x69,0x74,0x65,0x6d,0x00,0x00,0x00,0x00,0x10,0x07,0x03,0x00,0x1f,0x08,0x00,0xb7,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,0x74,0x65,0x6d,0x5b,
+0x30,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x74,0x61,0x67,0x27,0x3a,0x00,0x00,0x00,0x00,
+0x0c,0x08,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x03,0x07,0x08,
+0x0d,0x08,0x00,0x05,0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,0x18,0x03,0x03,0x08,
+0x16,0x03,0x00,0x00,0x13,0x00,0x00,0x17,0x1f,0x08,0x00,0xb8,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x61,0x67,0x73,0x5b,0x69,0x74,0x65,
+0x6d,0x5b,0x31,0x5d,0x5d,0x20,0x3d,0x20,0x6e,0x00,0x00,0x00,0x0c,0x08,0x00,0x06,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x03,0x07,0x08,0x0b,0x01,0x03,0x04,
+0x1f,0x06,0x00,0xb9,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x00,0x00,0x00,0x00,0x13,0x00,0xff,0xd2,
+0x1f,0x08,0x00,0xba,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,
+0x74,0x65,0x6d,0x5b,0x30,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x72,0x65,0x67,0x73,0x27,
+0x3a,0x00,0x00,0x00,0x0c,0x08,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x03,0x07,0x08,0x0d,0x08,0x00,0x07,0x00,0x00,0x00,0x04,0x72,0x65,0x67,0x73,
+0x00,0x00,0x00,0x00,0x18,0x03,0x03,0x08,0x16,0x03,0x00,0x00,0x13,0x00,0x00,0x61,
+0x1f,0x0f,0x00,0xbb,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6f,0x75,0x74,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x67,0x65,0x74,0x5f,0x63,
+0x6f,0x64,0x65,0x31,0x36,0x28,0x52,0x45,0x47,0x53,0x2c,0x69,0x74,0x65,0x6d,0x5b,
+0x31,0x5d,0x2c,0x69,0x74,0x65,0x6d,0x5b,0x32,0x5d,0x29,0x29,0x00,0x00,0x00,0x00,
+0x0d,0x0b,0x00,0x08,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x08,0x02,0x0b,0x00,0x00,0x00,0x01,0x0e,0x0b,0x00,0x09,0x00,0x00,0x00,0x0a,
+0x67,0x65,0x74,0x5f,0x63,0x6f,0x64,0x65,0x31,0x36,0x00,0x00,0x0e,0x0c,0x00,0x0a,
+0x00,0x00,0x00,0x04,0x52,0x45,0x47,0x53,0x00,0x00,0x00,0x00,0x0c,0x0f,0x00,0x06,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x0d,0x07,0x0f,0x0c,0x0f,0x00,0x0b,
+0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x0a,0x0e,0x07,0x0f,0x37,0x0a,0x0b,0x04,
+0x39,0x03,0x08,0x03,0x1f,0x0c,0x00,0xbc,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x67,
+0x65,0x74,0x5f,0x63,0x6f,0x64,0x65,0x31,0x36,0x28,0x30,0x2c,0x30,0x2c,0x69,0x74,
+0x65,0x6d,0x5b,0x33,0x5d,0x29,0x29,0x00,0x0d,0x0b,0x00,0x08,0x00,0x00,0x00,0x06,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x08,0x02,0x0b,0x00,0x00,0x00,0x02,
+0x0e,0x0b,0x00,0x09,0x00,0x00,0x00,0x0a,0x67,0x65,0x74,0x5f,0x63,0x6f,0x64,0x65,
+0x31,0x36,0x00,0x00,0x0c,0x0c,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0c,0x0d,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0c,0x0f,0x00,0x0c,
+0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,0x0a,0x0e,0x07,0x0f,0x37,0x0a,0x0b,0x04,
+0x39,0x03,0x08,0x03,0x1f,0x05,0x00,0xbd,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6e,0x20,0x2b,0x3d,0x20,0x32,0x00,0x00,0x0c,0x08,0x00,0x0b,
+0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x01,0x03,0x04,0x08,0x10,0x04,0x03,0x00,
+0x1f,0x06,0x00,0xbe,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x00,0x00,0x00,0x00,0x13,0x00,0xff,0x5e,
+0x1f,0x07,0x00,0xbf,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x69,0x74,0x65,0x6d,0x29,0x00,0x00,0x00,0x00,
+0x0d,0x0b,0x00,0x08,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x08,0x02,0x0b,0x00,0x00,0x00,0x03,0x10,0x0a,0x07,0x00,0x39,0x03,0x08,0x03,
+0x1f,0x04,0x00,0xc0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x20,0x2b,0x3d,
+0x20,0x31,0x00,0x00,0x0c,0x08,0x00,0x06,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x01,0x03,0x04,0x08,0x10,0x04,0x03,0x00,0x13,0x00,0xff,0x43,0x1f,0x08,0x00,0xc1,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x6e,0x20,0x69,0x6e,0x20,0x72,0x61,0x6e,
+0x67,0x65,0x28,0x30,0x2c,0x6c,0x65,0x6e,0x28,0x6f,0x75,0x74,0x29,0x29,0x3a,0x00,
+0x0e,0x0b,0x00,0x0d,0x00,0x00,0x00,0x05,0x72,0x61,0x6e,0x67,0x65,0x00,0x00,0x00,
+0x0c,0x0c,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x0e,
+0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x10,0x06,0x02,0x00,0x37,0x0d,0x05,0x02,
+0x3a,0x08,0x0b,0x03,0x3b,0x03,0x08,0x00,0x13,0x00,0x00,0xb5,0x10,0x04,0x03,0x00,
+0x1f,0x06,0x00,0xc2,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,
+0x20,0x3d,0x20,0x6f,0x75,0x74,0x5b,0x6e,0x5d,0x00,0x00,0x00,0x0a,0x07,0x02,0x04,
+0x1f,0x08,0x00,0xc3,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,
+0x74,0x65,0x6d,0x5b,0x30,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x6a,0x75,0x6d,0x70,0x27,
+0x3a,0x00,0x00,0x00,0x0c,0x05,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x03,0x07,0x05,0x0d,0x05,0x00,0x0f,0x00,0x00,0x00,0x04,0x6a,0x75,0x6d,0x70,
+0x00,0x00,0x00,0x00,0x18,0x03,0x03,0x05,0x16,0x03,0x00,0x00,0x13,0x00,0x00,0x25,
+0x1f,0x0e,0x00,0xc4,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6f,0x75,0x74,0x5b,0x6e,0x5d,0x20,0x3d,0x20,0x67,0x65,0x74,0x5f,0x63,0x6f,0x64,
+0x65,0x31,0x36,0x28,0x4a,0x55,0x4d,0x50,0x2c,0x30,0x2c,0x74,0x61,0x67,0x73,0x5b,
+0x69,0x74,0x65,0x6d,0x5b,0x31,0x5d,0x5d,0x2d,0x6e,0x29,0x00,0x0e,0x0b,0x00,0x09,
+0x00,0x00,0x00,0x0a,0x67,0x65,0x74,0x5f,0x63,0x6f,0x64,0x65,0x31,0x36,0x00,0x00,
+0x0e,0x0c,0x00,0x10,0x00,0x00,0x00,0x04,0x4a,0x55,0x4d,0x50,0x00,0x00,0x00,0x00,
+0x0c,0x0d,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0c,0x06,0x00,0x06,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x05,0x07,0x06,0x0a,0x0e,0x01,0x05,
+0x02,0x0e,0x0e,0x04,0x37,0x03,0x0b,0x04,0x0b,0x02,0x04,0x03,0x13,0x00,0xff,0xbe,
+0x1f,0x09,0x00,0xc5,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,
+0x20,0x69,0x74,0x65,0x6d,0x5b,0x30,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x73,0x65,0x74,
+0x6a,0x6d,0x70,0x27,0x3a,0x00,0x00,0x00,0x0c,0x05,0x00,0x02,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x03,0x07,0x05,0x0d,0x05,0x00,0x11,0x00,0x00,0x00,0x06,
+0x73,0x65,0x74,0x6a,0x6d,0x70,0x00,0x00,0x18,0x03,0x03,0x05,0x16,0x03,0x00,0x00,
+0x13,0x00,0x00,0x26,0x1f,0x0f,0x00,0xc6,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x5b,0x6e,0x5d,0x20,0x3d,0x20,0x67,0x65,0x74,
+0x5f,0x63,0x6f,0x64,0x65,0x31,0x36,0x28,0x53,0x45,0x54,0x4a,0x4d,0x50,0x2c,0x30,
+0x2c,0x74,0x61,0x67,0x73,0x5b,0x69,0x74,0x65,0x6d,0x5b,0x31,0x5d,0x5d,0x2d,0x6e,
+0x29,0x00,0x00,0x00,0x0e,0x0b,0x00,0x09,0x00,0x00,0x00,0x0a,0x67,0x65,0x74,0x5f,
+0x63,0x6f,0x64,0x65,0x31,0x36,0x00,0x00,0x0e,0x0c,0x00,0x12,0x00,0x00,0x00,0x06,
+0x53,0x45,0x54,0x4a,0x4d,0x50,0x00,0x00,0x0c,0x0d,0x00,0x02,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0c,0x06,0x00,0x06,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x05,0x07,0x06,0x0a,0x0e,0x01,0x05,0x02,0x0e,0x0e,0x04,0x37,0x03,0x0b,0x04,
+0x0b,0x02,0x04,0x03,0x13,0x00,0xff,0x84,0x1f,0x08,0x00,0xc7,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x69,0x74,0x65,0x6d,0x5b,0x30,0x5d,
+0x20,0x3d,0x3d,0x20,0x27,0x66,0x6e,0x63,0x27,0x3a,0x00,0x00,0x0c,0x05,0x00,0x02,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x03,0x07,0x05,0x0d,0x05,0x00,0x13,
+0x00,0x00,0x00,0x03,0x66,0x6e,0x63,0x00,0x18,0x03,0x03,0x05,0x16,0x03,0x00,0x00,
+0x13,0x00,0xff,0x71,0x1f,0x10,0x00,0xc8,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x5b,0x6e,0x5d,0x20,0x3d,0x20,0x67,0x65,0x74,
+0x5f,0x63,0x6f,0x64,0x65,0x31,0x36,0x28,0x44,0x45,0x46,0x2c,0x69,0x74,0x65,0x6d,
+0x5b,0x31,0x5d,0x2c,0x74,0x61,0x67,0x73,0x5b,0x69,0x74,0x65,0x6d,0x5b,0x32,0x5d,
+0x5d,0x2d,0x6e,0x29,0x00,0x00,0x00,0x00,0x0e,0x0b,0x00,0x09,0x00,0x00,0x00,0x0a,
+0x67,0x65,0x74,0x5f,0x63,0x6f,0x64,0x65,0x31,0x36,0x00,0x00,0x0e,0x0c,0x00,0x14,
+0x00,0x00,0x00,0x03,0x44,0x45,0x46,0x00,0x0c,0x05,0x00,0x06,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x0d,0x07,0x05,0x0c,0x06,0x00,0x0b,0x00,0x00,0x69,0x04,
+0x02,0x00,0x00,0x00,0x0a,0x05,0x07,0x06,0x0a,0x0e,0x01,0x05,0x02,0x0e,0x0e,0x04,
+0x37,0x03,0x0b,0x04,0x0b,0x02,0x04,0x03,0x13,0x00,0xff,0x4b,0x1f,0x08,0x00,0xc9,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x6e,0x20,0x69,0x6e,0x20,0x72,0x61,0x6e,
+0x67,0x65,0x28,0x30,0x2c,0x6c,0x65,0x6e,0x28,0x6f,0x75,0x74,0x29,0x29,0x3a,0x00,
+0x0e,0x0b,0x00,0x0d,0x00,0x00,0x00,0x05,0x72,0x61,0x6e,0x67,0x65,0x00,0x00,0x00,
+0x0c,0x0c,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x0e,
+0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x10,0x06,0x02,0x00,0x37,0x0d,0x05,0x02,
+0x3a,0x08,0x0b,0x03,0x3b,0x03,0x08,0x00,0x13,0x00,0x01,0x10,0x10,0x04,0x03,0x00,
+0x1f,0x06,0x00,0xca,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,
+0x20,0x3d,0x20,0x6f,0x75,0x74,0x5b,0x6e,0x5d,0x00,0x00,0x00,0x0a,0x07,0x02,0x04,
+0x1f,0x08,0x00,0xcb,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,
+0x74,0x65,0x6d,0x5b,0x30,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x64,0x61,0x74,0x61,0x27,
+0x3a,0x00,0x00,0x00,0x0c,0x05,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x03,0x07,0x05,0x0d,0x05,0x00,0x15,0x00,0x00,0x00,0x04,0x64,0x61,0x74,0x61,
+0x00,0x00,0x00,0x00,0x18,0x03,0x03,0x05,0x16,0x03,0x00,0x00,0x13,0x00,0x00,0x24,
+0x1f,0x08,0x00,0xcc,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6f,0x75,0x74,0x5b,0x6e,0x5d,0x20,0x3d,0x20,0x69,0x74,0x65,0x6d,0x5b,0x31,0x5d,
+0x00,0x00,0x00,0x00,0x0c,0x05,0x00,0x06,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x03,0x07,0x05,0x0b,0x02,0x04,0x03,0x1f,0x09,0x00,0xcd,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x73,0x73,0x65,0x72,0x74,0x20,0x6c,
+0x65,0x6e,0x28,0x6f,0x75,0x74,0x5b,0x6e,0x5d,0x29,0x20,0x3d,0x3d,0x20,0x34,0x00,
+0x0e,0x0b,0x00,0x0e,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x0a,0x0c,0x02,0x04,
+0x37,0x05,0x0b,0x02,0x0c,0x06,0x00,0x16,0x00,0x00,0x69,0x04,0x04,0x00,0x00,0x00,
+0x18,0x03,0x05,0x06,0x17,0x03,0x05,0x06,0x13,0x00,0x00,0x8c,0x1f,0x08,0x00,0xce,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x69,0x74,0x65,
+0x6d,0x5b,0x30,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x63,0x6f,0x64,0x65,0x27,0x3a,0x00,
+0x0c,0x05,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x03,0x07,0x05,
+0x0d,0x05,0x00,0x17,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,
+0x18,0x03,0x03,0x05,0x16,0x03,0x00,0x00,0x13,0x00,0x00,0x62,0x1f,0x08,0x00,0xcf,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x2c,0x61,0x2c,
+0x62,0x2c,0x63,0x20,0x3d,0x20,0x69,0x74,0x65,0x6d,0x5b,0x31,0x3a,0x5d,0x00,0x00,
+0x0c,0x0b,0x00,0x06,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x1d,0x0c,0x00,0x00,
+0x1c,0x05,0x0b,0x02,0x0a,0x03,0x07,0x05,0x33,0x03,0x00,0x05,0x2a,0x24,0x31,0x31,
+0x31,0x00,0x00,0x00,0x33,0x05,0x00,0x01,0x69,0x00,0x00,0x00,0x0c,0x0b,0x00,0x02,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x05,0x03,0x0b,0x33,0x06,0x00,0x01,
+0x61,0x00,0x00,0x00,0x0c,0x0c,0x00,0x06,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x06,0x03,0x0c,0x33,0x0b,0x00,0x01,0x62,0x00,0x00,0x00,0x0c,0x0d,0x00,0x0b,
+0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x0a,0x0b,0x03,0x0d,0x33,0x0c,0x00,0x01,
+0x63,0x00,0x00,0x00,0x0c,0x0e,0x00,0x0c,0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,
+0x0a,0x0c,0x03,0x0e,0x1f,0x0a,0x00,0xd0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x5b,0x6e,0x5d,0x20,0x3d,0x20,0x62,0x79,0x74,
+0x65,0x73,0x28,0x5b,0x69,0x2c,0x61,0x2c,0x62,0x2c,0x63,0x5d,0x29,0x00,0x00,0x00,
+0x0e,0x0d,0x00,0x18,0x00,0x00,0x00,0x05,0x62,0x79,0x74,0x65,0x73,0x00,0x00,0x00,
+0x10,0x0f,0x05,0x00,0x10,0x10,0x06,0x00,0x10,0x11,0x0b,0x00,0x10,0x12,0x0c,0x00,
+0x1c,0x0e,0x0f,0x04,0x37,0x03,0x0d,0x02,0x0b,0x02,0x04,0x03,0x1f,0x0d,0x00,0xd1,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x73,0x73,0x65,
+0x72,0x74,0x20,0x6c,0x65,0x6e,0x28,0x6f,0x75,0x74,0x5b,0x6e,0x5d,0x29,0x20,0x3d,
+0x3d,0x20,0x34,0x2c,0x20,0x6c,0x65,0x6e,0x28,0x6f,0x75,0x74,0x5b,0x6e,0x5d,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x0f,0x00,0x0e,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,
+0x0a,0x10,0x02,0x04,0x37,0x0d,0x0f,0x02,0x0c,0x0f,0x00,0x16,0x00,0x00,0x69,0x04,
+0x04,0x00,0x00,0x00,0x18,0x0d,0x0d,0x0f,0x0e,0x0f,0x00,0x0e,0x00,0x00,0x00,0x03,
+0x6c,0x65,0x6e,0x00,0x0a,0x10,0x02,0x04,0x37,0x0e,0x0f,0x02,0x1c,0x03,0x0d,0x02,
+0x1d,0x0d,0x00,0x00,0x1d,0x0e,0x00,0x00,0x17,0x03,0x0d,0x0e,0x13,0x00,0x00,0x17,
+0x1f,0x0a,0x00,0xd3,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x72,0x61,0x69,0x73,0x65,0x20,0x73,0x74,0x72,0x28,0x28,0x27,0x68,0x75,0x68,0x3f,
+0x27,0x2c,0x69,0x74,0x65,0x6d,0x29,0x29,0x00,0x00,0x00,0x00,0x0e,0x0d,0x00,0x19,
+0x00,0x00,0x00,0x03,0x73,0x74,0x72,0x00,0x0d,0x0f,0x00,0x1a,0x00,0x00,0x00,0x04,
+0x68,0x75,0x68,0x3f,0x00,0x00,0x00,0x00,0x10,0x10,0x07,0x00,0x1c,0x0e,0x0f,0x02,
+0x37,0x03,0x0d,0x02,0x26,0x03,0x00,0x00,0x1f,0x08,0x00,0xd4,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6c,0x65,0x6e,0x28,0x6f,0x75,0x74,0x5b,0x6e,
+0x5d,0x29,0x20,0x21,0x3d,0x20,0x34,0x3a,0x00,0x00,0x00,0x00,0x0e,0x0d,0x00,0x0e,
+0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x0a,0x0e,0x02,0x04,0x37,0x03,0x0d,0x02,
+0x0c,0x0d,0x00,0x16,0x00,0x00,0x69,0x04,0x04,0x00,0x00,0x00,0x24,0x03,0x03,0x0d,
+0x16,0x03,0x00,0x00,0x13,0x00,0xff,0x20,0x1f,0x12,0x00,0xd5,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x61,0x69,0x73,0x65,0x20,0x28,0x27,
+0x63,0x6f,0x64,0x65,0x20,0x27,0x2b,0x73,0x74,0x72,0x28,0x6e,0x29,0x2b,0x27,0x20,
+0x69,0x73,0x20,0x77,0x72,0x6f,0x6e,0x67,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x20,
+0x27,0x2b,0x73,0x74,0x72,0x28,0x6c,0x65,0x6e,0x28,0x6f,0x75,0x74,0x5b,0x6e,0x5d,
+0x29,0x29,0x29,0x00,0x0d,0x03,0x00,0x1b,0x00,0x00,0x00,0x05,0x63,0x6f,0x64,0x65,
+0x20,0x00,0x00,0x00,0x0e,0x0e,0x00,0x19,0x00,0x00,0x00,0x03,0x73,0x74,0x72,0x00,
+0x10,0x0f,0x04,0x00,0x37,0x0d,0x0e,0x02,0x01,0x03,0x03,0x0d,0x0d,0x0d,0x00,0x1c,
+0x00,0x00,0x00,0x11,0x20,0x69,0x73,0x20,0x77,0x72,0x6f,0x6e,0x67,0x20,0x6c,0x65,
+0x6e,0x67,0x74,0x68,0x20,0x00,0x00,0x00,0x01,0x03,0x03,0x0d,0x0e,0x0e,0x00,0x19,
+0x00,0x00,0x00,0x03,0x73,0x74,0x72,0x00,0x0e,0x10,0x00,0x0e,0x00,0x00,0x00,0x03,
+0x6c,0x65,0x6e,0x00,0x0a,0x11,0x02,0x04,0x37,0x0f,0x10,0x02,0x37,0x0d,0x0e,0x02,
+0x01,0x03,0x03,0x0d,0x26,0x03,0x00,0x00,0x1f,0x04,0x00,0xd6,0x20,0x20,0x20,0x20,
+0x44,0x2e,0x6f,0x75,0x74,0x20,0x3d,0x20,0x6f,0x75,0x74,0x00,0x0e,0x03,0x00,0x03,
+0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x08,0x00,0x04,0x00,0x00,0x00,0x03,
+0x6f,0x75,0x74,0x00,0x0b,0x03,0x08,0x02,0x00,0x00,0x00,0x00,0x0d,0x17,0x00,0x33,
+0x00,0x00,0x00,0x08,0x6d,0x61,0x70,0x5f,0x74,0x61,0x67,0x73,0x00,0x00,0x00,0x00,
+0x0f,0x17,0x16,0x00,0x1f,0x06,0x00,0xd8,0x64,0x65,0x66,0x20,0x67,0x65,0x74,0x5f,
+0x74,0x6d,0x70,0x28,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x17,0x00,0x05,0x2a,0x24,0x32,0x32,0x31,0x00,0x00,0x00,0x0d,0x1c,0x00,0x1f,
+0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,0x1c,0x18,0x1c,0x01,0x1d,0x1c,0x00,0x00,
+0x1c,0x19,0x1c,0x01,0x1d,0x1a,0x00,0x00,0x1d,0x1b,0x00,0x00,0x11,0x17,0x00,0x3f,
+0x2d,0x04,0x00,0x05,0x00,0x00,0x00,0x00,0x1f,0x06,0x00,0xd8,0x64,0x65,0x66,0x20,
+0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x28,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x72,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,
+0x74,0x6d,0x70,0x00,0x23,0x01,0x00,0x00,0x1f,0x07,0x00,0xd9,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x72,0x20,0x21,0x3d,0x20,0x4e,0x6f,0x6e,0x65,0x3a,0x20,0x72,0x65,
+0x74,0x75,0x72,0x6e,0x20,0x72,0x00,0x00,0x1d,0x02,0x00,0x00,0x24,0x01,0x00,0x02,
+0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x02,0x15,0x00,0x00,0x00,0x1f,0x07,0x00,0xda,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x67,0x65,0x74,0x5f,0x74,
+0x6d,0x70,0x73,0x28,0x31,0x29,0x5b,0x30,0x5d,0x00,0x00,0x00,0x0e,0x02,0x00,0x02,
+0x00,0x00,0x00,0x08,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x73,0x00,0x00,0x00,0x00,
+0x0c,0x03,0x00,0x03,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x37,0x01,0x02,0x02,
+0x0c,0x02,0x00,0x04,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x01,0x01,0x02,
+0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x18,0x00,0x34,0x00,0x00,0x00,0x07,
+0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x00,0x0f,0x18,0x17,0x00,0x1f,0x05,0x00,0xdb,
+0x64,0x65,0x66,0x20,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x73,0x28,0x63,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x18,0x00,0x05,0x2a,0x24,0x32,0x32,0x39,0x00,0x00,0x00,
+0x0d,0x1d,0x00,0x18,0x00,0x00,0x00,0x01,0x63,0x00,0x00,0x00,0x1c,0x19,0x1d,0x01,
+0x1c,0x1a,0x00,0x00,0x1d,0x1b,0x00,0x00,0x1d,0x1c,0x00,0x00,0x11,0x18,0x00,0xa8,
+0x2d,0x0a,0x00,0x0c,0x00,0x00,0x00,0x03,0x1f,0x05,0x00,0xdb,0x64,0x65,0x66,0x20,
+0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x73,0x28,0x63,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x63,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x08,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x73,
+0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x05,0x00,0xdc,0x20,0x20,0x20,0x20,
+0x72,0x73,0x20,0x3d,0x20,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x63,0x29,0x00,0x00,0x00,
+0x33,0x01,0x00,0x02,0x72,0x73,0x00,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x05,
+0x61,0x6c,0x6c,0x6f,0x63,0x00,0x00,0x00,0x10,0x02,0x00,0x00,0x37,0x01,0x01,0x02,
+0x1f,0x07,0x00,0xdd,0x20,0x20,0x20,0x20,0x72,0x65,0x67,0x73,0x20,0x3d,0x20,0x72,
+0x61,0x6e,0x67,0x65,0x28,0x72,0x73,0x2c,0x72,0x73,0x2b,0x63,0x29,0x00,0x00,0x00,
+0x33,0x07,0x00,0x04,0x72,0x65,0x67,0x73,0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x03,
+0x00,0x00,0x00,0x05,0x72,0x61,0x6e,0x67,0x65,0x00,0x00,0x00,0x10,0x03,0x01,0x00,
+0x01,0x04,0x01,0x00,0x37,0x01,0x02,0x03,0x10,0x07,0x01,0x00,0x1f,0x05,0x00,0xde,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x72,0x20,0x69,0x6e,0x20,0x72,0x65,0x67,
+0x73,0x3a,0x00,0x00,0x0c,0x02,0x00,0x04,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x2b,0x01,0x07,0x02,0x13,0x00,0x00,0x42,0x33,0x03,0x00,0x01,0x72,0x00,0x00,0x00,
+0x10,0x03,0x01,0x00,0x1f,0x09,0x00,0xdf,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x73,0x65,0x74,0x5f,0x72,0x65,0x67,0x28,0x72,0x2c,0x22,0x24,0x22,0x2b,0x73,0x74,
+0x72,0x28,0x44,0x2e,0x5f,0x74,0x6d,0x70,0x69,0x29,0x29,0x00,0x0e,0x04,0x00,0x05,
+0x00,0x00,0x00,0x07,0x73,0x65,0x74,0x5f,0x72,0x65,0x67,0x00,0x10,0x05,0x03,0x00,
+0x0d,0x06,0x00,0x06,0x00,0x00,0x00,0x01,0x24,0x00,0x00,0x00,0x0e,0x08,0x00,0x07,
+0x00,0x00,0x00,0x03,0x73,0x74,0x72,0x00,0x0e,0x09,0x00,0x08,0x00,0x00,0x00,0x01,
+0x44,0x00,0x00,0x00,0x0d,0x01,0x00,0x09,0x00,0x00,0x00,0x05,0x5f,0x74,0x6d,0x70,
+0x69,0x00,0x00,0x00,0x09,0x09,0x09,0x01,0x00,0x00,0x00,0x00,0x37,0x01,0x08,0x02,
+0x01,0x06,0x06,0x01,0x37,0x01,0x04,0x03,0x1f,0x06,0x00,0xe0,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x44,0x2e,0x5f,0x74,0x6d,0x70,0x69,0x20,0x2b,0x3d,0x20,0x31,
+0x00,0x00,0x00,0x00,0x0e,0x01,0x00,0x08,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,
+0x0e,0x04,0x00,0x08,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x05,0x00,0x09,
+0x00,0x00,0x00,0x05,0x5f,0x74,0x6d,0x70,0x69,0x00,0x00,0x00,0x09,0x04,0x04,0x05,
+0x00,0x00,0x00,0x01,0x0c,0x05,0x00,0x0a,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x01,0x04,0x04,0x05,0x0d,0x05,0x00,0x09,0x00,0x00,0x00,0x05,0x5f,0x74,0x6d,0x70,
+0x69,0x00,0x00,0x00,0x0b,0x01,0x05,0x04,0x13,0x00,0xff,0xbe,0x1f,0x06,0x00,0xe1,
+0x20,0x20,0x20,0x20,0x44,0x2e,0x74,0x6d,0x70,0x63,0x20,0x2b,0x3d,0x20,0x63,0x20,
+0x23,0x52,0x45,0x47,0x00,0x00,0x00,0x00,0x0e,0x01,0x00,0x08,0x00,0x00,0x00,0x01,
+0x44,0x00,0x00,0x00,0x0e,0x02,0x00,0x08,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,
+0x0d,0x04,0x00,0x0b,0x00,0x00,0x00,0x04,0x74,0x6d,0x70,0x63,0x00,0x00,0x00,0x00,
+0x09,0x02,0x02,0x04,0x00,0x00,0x00,0x02,0x01,0x02,0x02,0x00,0x0d,0x04,0x00,0x0b,
+0x00,0x00,0x00,0x04,0x74,0x6d,0x70,0x63,0x00,0x00,0x00,0x00,0x0b,0x01,0x04,0x02,
+0x1f,0x04,0x00,0xe2,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,
+0x65,0x67,0x73,0x00,0x15,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x19,0x00,0x35,
+0x00,0x00,0x00,0x08,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x73,0x00,0x00,0x00,0x00,
+0x0f,0x19,0x18,0x00,0x1f,0x04,0x00,0xe3,0x64,0x65,0x66,0x20,0x61,0x6c,0x6c,0x6f,
+0x63,0x28,0x63,0x29,0x3a,0x00,0x00,0x00,0x33,0x19,0x00,0x05,0x2a,0x24,0x32,0x33,
+0x36,0x00,0x00,0x00,0x0d,0x1e,0x00,0x18,0x00,0x00,0x00,0x01,0x63,0x00,0x00,0x00,
+0x1c,0x1a,0x1e,0x01,0x1c,0x1b,0x00,0x00,0x1d,0x1c,0x00,0x00,0x1d,0x1d,0x00,0x00,
+0x11,0x19,0x00,0x80,0x2d,0x0c,0x00,0x0e,0x00,0x00,0x00,0x04,0x1f,0x04,0x00,0xe3,
+0x64,0x65,0x66,0x20,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x63,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x63,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x05,0x61,0x6c,0x6c,0x6f,0x63,0x00,0x00,0x00,
+0x23,0x01,0x00,0x00,0x1f,0x12,0x00,0xe4,0x20,0x20,0x20,0x20,0x73,0x20,0x3d,0x20,
+0x27,0x27,0x2e,0x6a,0x6f,0x69,0x6e,0x28,0x5b,0x22,0x30,0x31,0x22,0x5b,0x72,0x20,
+0x69,0x6e,0x20,0x44,0x2e,0x72,0x32,0x6e,0x5d,0x20,0x66,0x6f,0x72,0x20,0x72,0x20,
+0x69,0x6e,0x20,0x72,0x61,0x6e,0x67,0x65,0x28,0x30,0x2c,0x6d,0x69,0x6e,0x28,0x32,
+0x35,0x36,0x2c,0x44,0x2e,0x6d,0x72,0x65,0x67,0x2b,0x63,0x29,0x29,0x5d,0x29,0x00,
+0x33,0x01,0x00,0x01,0x73,0x00,0x00,0x00,0x0d,0x01,0x00,0x02,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x04,0x6a,0x6f,0x69,0x6e,
+0x00,0x00,0x00,0x00,0x38,0x03,0x01,0x02,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x07,
+0x63,0x6f,0x6d,0x70,0x3a,0x37,0x31,0x00,0x1c,0x01,0x00,0x00,0x0e,0x05,0x00,0x04,
+0x00,0x00,0x00,0x05,0x72,0x61,0x6e,0x67,0x65,0x00,0x00,0x00,0x0c,0x06,0x00,0x05,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0e,0x08,0x00,0x06,0x00,0x00,0x00,0x03,
+0x6d,0x69,0x6e,0x00,0x0c,0x09,0x00,0x07,0x00,0x00,0x69,0x04,0x00,0x01,0x00,0x00,
+0x0e,0x0a,0x00,0x08,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x07,0x00,0x09,
+0x00,0x00,0x00,0x04,0x6d,0x72,0x65,0x67,0x00,0x00,0x00,0x00,0x09,0x0a,0x0a,0x07,
+0x00,0x00,0x00,0x01,0x01,0x0a,0x0a,0x00,0x37,0x07,0x08,0x03,0x3a,0x09,0x05,0x03,
+0x3b,0x02,0x09,0x00,0x13,0x00,0x00,0x14,0x33,0x05,0x00,0x01,0x72,0x00,0x00,0x00,
+0x10,0x05,0x02,0x00,0x0d,0x02,0x00,0x0a,0x00,0x00,0x00,0x02,0x30,0x31,0x00,0x00,
+0x0e,0x07,0x00,0x08,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x08,0x00,0x0b,
+0x00,0x00,0x00,0x03,0x72,0x32,0x6e,0x00,0x09,0x07,0x07,0x08,0x00,0x00,0x00,0x02,
+0x25,0x06,0x05,0x07,0x0a,0x02,0x02,0x06,0x1d,0x06,0x00,0x00,0x0b,0x01,0x06,0x02,
+0x13,0x00,0xff,0xec,0x10,0x05,0x01,0x00,0x39,0x01,0x03,0x03,0x1f,0x07,0x00,0xe5,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x2e,0x69,0x6e,0x64,
+0x65,0x78,0x28,0x27,0x30,0x27,0x2a,0x63,0x29,0x00,0x00,0x00,0x0d,0x02,0x00,0x0c,
+0x00,0x00,0x00,0x05,0x69,0x6e,0x64,0x65,0x78,0x00,0x00,0x00,0x38,0x03,0x01,0x02,
+0x00,0x00,0x00,0x03,0x0d,0x05,0x00,0x0d,0x00,0x00,0x00,0x01,0x30,0x00,0x00,0x00,
+0x03,0x05,0x05,0x00,0x39,0x00,0x03,0x03,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x1a,0x00,0x36,0x00,0x00,0x00,0x05,0x61,0x6c,0x6c,0x6f,0x63,0x00,0x00,0x00,
+0x0f,0x1a,0x19,0x00,0x1f,0x04,0x00,0xe6,0x64,0x65,0x66,0x20,0x69,0x73,0x5f,0x74,
+0x6d,0x70,0x28,0x72,0x29,0x3a,0x00,0x00,0x33,0x1a,0x00,0x05,0x2a,0x24,0x32,0x34,
+0x33,0x00,0x00,0x00,0x0d,0x1f,0x00,0x1f,0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,
+0x1c,0x1b,0x1f,0x01,0x1c,0x1c,0x00,0x00,0x1d,0x1d,0x00,0x00,0x1d,0x1e,0x00,0x00,
+0x11,0x1a,0x00,0x46,0x2d,0x03,0x00,0x06,0x00,0x00,0x00,0x01,0x1f,0x04,0x00,0xe6,
+0x64,0x65,0x66,0x20,0x69,0x73,0x5f,0x74,0x6d,0x70,0x28,0x72,0x29,0x3a,0x00,0x00,
+0x33,0x00,0x00,0x01,0x72,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x06,0x69,0x73,0x5f,0x74,0x6d,0x70,0x00,0x00,
+0x23,0x01,0x00,0x00,0x1f,0x08,0x00,0xe7,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x72,
+0x20,0x69,0x73,0x20,0x4e,0x6f,0x6e,0x65,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+0x20,0x46,0x61,0x6c,0x73,0x65,0x00,0x00,0x1d,0x02,0x00,0x00,0x18,0x01,0x00,0x02,
+0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x05,0x0c,0x01,0x00,0x02,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x15,0x01,0x00,0x00,0x1f,0x08,0x00,0xe8,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x44,0x2e,0x72,0x32,0x6e,0x5b,0x72,0x5d,
+0x5b,0x30,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x24,0x27,0x29,0x00,0x0e,0x01,0x00,0x03,
+0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x02,0x00,0x04,0x00,0x00,0x00,0x03,
+0x72,0x32,0x6e,0x00,0x09,0x01,0x01,0x02,0x00,0x00,0x00,0x00,0x0a,0x01,0x01,0x00,
+0x0c,0x02,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x01,0x01,0x02,
+0x0d,0x02,0x00,0x05,0x00,0x00,0x00,0x01,0x24,0x00,0x00,0x00,0x18,0x01,0x01,0x02,
+0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x1b,0x00,0x37,0x00,0x00,0x00,0x06,
+0x69,0x73,0x5f,0x74,0x6d,0x70,0x00,0x00,0x0f,0x1b,0x1a,0x00,0x1f,0x04,0x00,0xe9,
+0x64,0x65,0x66,0x20,0x75,0x6e,0x5f,0x74,0x6d,0x70,0x28,0x72,0x29,0x3a,0x00,0x00,
+0x33,0x1b,0x00,0x05,0x2a,0x24,0x32,0x35,0x30,0x00,0x00,0x00,0x0d,0x20,0x00,0x1f,
+0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,0x1c,0x1c,0x20,0x01,0x1c,0x1d,0x00,0x00,
+0x1d,0x1e,0x00,0x00,0x1d,0x1f,0x00,0x00,0x11,0x1b,0x00,0x48,0x2d,0x06,0x00,0x07,
+0x00,0x00,0x00,0x01,0x1f,0x04,0x00,0xe9,0x64,0x65,0x66,0x20,0x75,0x6e,0x5f,0x74,
+0x6d,0x70,0x28,0x72,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x01,0x72,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x06,
+0x75,0x6e,0x5f,0x74,0x6d,0x70,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x05,0x00,0xea,
+0x20,0x20,0x20,0x20,0x6e,0x20,0x3d,0x20,0x44,0x2e,0x72,0x32,0x6e,0x5b,0x72,0x5d,
+0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x6e,0x00,0x00,0x00,0x0e,0x02,0x00,0x02,
+0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x03,0x00,0x03,0x00,0x00,0x00,0x03,
+0x72,0x32,0x6e,0x00,0x09,0x02,0x02,0x03,0x00,0x00,0x00,0x00,0x0a,0x01,0x02,0x00,
+0x1f,0x04,0x00,0xeb,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x72,0x65,0x67,
+0x28,0x72,0x29,0x00,0x0e,0x03,0x00,0x04,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,
+0x5f,0x72,0x65,0x67,0x00,0x00,0x00,0x00,0x10,0x04,0x00,0x00,0x37,0x02,0x03,0x02,
+0x1f,0x06,0x00,0xec,0x20,0x20,0x20,0x20,0x73,0x65,0x74,0x5f,0x72,0x65,0x67,0x28,
+0x72,0x2c,0x27,0x2a,0x27,0x2b,0x6e,0x29,0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x05,
+0x00,0x00,0x00,0x07,0x73,0x65,0x74,0x5f,0x72,0x65,0x67,0x00,0x10,0x04,0x00,0x00,
+0x0d,0x05,0x00,0x06,0x00,0x00,0x00,0x01,0x2a,0x00,0x00,0x00,0x01,0x05,0x05,0x01,
+0x37,0x02,0x03,0x03,0x00,0x00,0x00,0x00,0x0d,0x1c,0x00,0x38,0x00,0x00,0x00,0x06,
+0x75,0x6e,0x5f,0x74,0x6d,0x70,0x00,0x00,0x0f,0x1c,0x1b,0x00,0x1f,0x05,0x00,0xed,
+0x64,0x65,0x66,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x72,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x1c,0x00,0x05,0x2a,0x24,0x32,0x35,0x37,0x00,0x00,0x00,
+0x0d,0x21,0x00,0x1f,0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,0x1c,0x1d,0x21,0x01,
+0x1c,0x1e,0x00,0x00,0x1d,0x1f,0x00,0x00,0x1d,0x20,0x00,0x00,0x11,0x1c,0x00,0x3a,
+0x2d,0x03,0x00,0x04,0x00,0x00,0x00,0x00,0x1f,0x05,0x00,0xed,0x64,0x65,0x66,0x20,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x72,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x72,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x08,0x00,0xee,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x69,0x73,0x5f,0x74,0x6d,0x70,0x28,0x72,0x29,0x3a,0x20,0x66,0x72,
+0x65,0x65,0x5f,0x72,0x65,0x67,0x28,0x72,0x29,0x00,0x00,0x00,0x0e,0x01,0x00,0x02,
+0x00,0x00,0x00,0x06,0x69,0x73,0x5f,0x74,0x6d,0x70,0x00,0x00,0x10,0x02,0x00,0x00,
+0x37,0x01,0x01,0x02,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x08,0x0e,0x01,0x00,0x03,
+0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x72,0x65,0x67,0x00,0x00,0x00,0x00,
+0x10,0x02,0x00,0x00,0x37,0x01,0x01,0x02,0x1f,0x04,0x00,0xef,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x1d,0x00,0x39,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x0f,0x1d,0x1c,0x00,0x1f,0x05,0x00,0xf0,
+0x64,0x65,0x66,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x73,0x28,0x72,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x1d,0x00,0x05,0x2a,0x24,0x32,0x36,0x34,0x00,0x00,0x00,
+0x0d,0x22,0x00,0x1f,0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,0x1c,0x1e,0x22,0x01,
+0x1c,0x1f,0x00,0x00,0x1d,0x20,0x00,0x00,0x1d,0x21,0x00,0x00,0x11,0x1d,0x00,0x33,
+0x2d,0x05,0x00,0x04,0x00,0x00,0x00,0x00,0x1f,0x05,0x00,0xf0,0x64,0x65,0x66,0x20,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x73,0x28,0x72,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x72,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x09,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x73,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x07,0x00,0xf1,0x20,0x20,0x20,0x20,
+0x66,0x6f,0x72,0x20,0x6b,0x20,0x69,0x6e,0x20,0x72,0x3a,0x20,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x28,0x6b,0x29,0x00,0x0c,0x02,0x00,0x02,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x2b,0x01,0x00,0x02,0x13,0x00,0x00,0x0b,0x33,0x01,0x00,0x01,
+0x6b,0x00,0x00,0x00,0x0e,0x03,0x00,0x03,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x04,0x01,0x00,0x37,0x01,0x03,0x02,
+0x13,0x00,0xff,0xf5,0x00,0x00,0x00,0x00,0x0d,0x1e,0x00,0x3a,0x00,0x00,0x00,0x09,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x73,0x00,0x00,0x00,0x0f,0x1e,0x1d,0x00,
+0x1f,0x04,0x00,0xf2,0x64,0x65,0x66,0x20,0x67,0x65,0x74,0x5f,0x72,0x65,0x67,0x28,
+0x6e,0x29,0x3a,0x00,0x33,0x1e,0x00,0x05,0x2a,0x24,0x32,0x37,0x31,0x00,0x00,0x00,
+0x0d,0x23,0x00,0x3b,0x00,0x00,0x00,0x01,0x6e,0x00,0x00,0x00,0x1c,0x1f,0x23,0x01,
+0x1c,0x20,0x00,0x00,0x1d,0x21,0x00,0x00,0x1d,0x22,0x00,0x00,0x11,0x1e,0x00,0x52,
+0x2d,0x05,0x00,0x07,0x00,0x00,0x00,0x02,0x1f,0x04,0x00,0xf2,0x64,0x65,0x66,0x20,
+0x67,0x65,0x74,0x5f,0x72,0x65,0x67,0x28,0x6e,0x29,0x3a,0x00,0x33,0x00,0x00,0x01,
+0x6e,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,
+0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,0x72,0x65,0x67,0x00,0x23,0x01,0x00,0x00,
+0x1f,0x06,0x00,0xf3,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,0x20,0x6e,0x6f,0x74,
+0x20,0x69,0x6e,0x20,0x44,0x2e,0x6e,0x32,0x72,0x3a,0x00,0x00,0x0e,0x02,0x00,0x02,
+0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x03,0x00,0x03,0x00,0x00,0x00,0x03,
+0x6e,0x32,0x72,0x00,0x09,0x02,0x02,0x03,0x00,0x00,0x00,0x00,0x08,0x01,0x00,0x02,
+0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x17,0x1f,0x07,0x00,0xf4,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x73,0x65,0x74,0x5f,0x72,0x65,0x67,0x28,0x61,0x6c,0x6c,0x6f,
+0x63,0x28,0x31,0x29,0x2c,0x6e,0x29,0x00,0x0e,0x02,0x00,0x04,0x00,0x00,0x00,0x07,
+0x73,0x65,0x74,0x5f,0x72,0x65,0x67,0x00,0x0e,0x03,0x00,0x05,0x00,0x00,0x00,0x05,
+0x61,0x6c,0x6c,0x6f,0x63,0x00,0x00,0x00,0x0c,0x04,0x00,0x06,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x37,0x03,0x03,0x02,0x10,0x04,0x00,0x00,0x37,0x01,0x02,0x03,
+0x1f,0x05,0x00,0xf5,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x44,
+0x2e,0x6e,0x32,0x72,0x5b,0x6e,0x5d,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x01,
+0x44,0x00,0x00,0x00,0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x6e,0x32,0x72,0x00,
+0x09,0x01,0x01,0x02,0x00,0x00,0x00,0x01,0x0a,0x01,0x01,0x00,0x15,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x1f,0x00,0x3c,0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,
+0x72,0x65,0x67,0x00,0x0f,0x1f,0x1e,0x00,0x1f,0x05,0x00,0xf6,0x64,0x65,0x66,0x20,
+0x73,0x65,0x74,0x5f,0x72,0x65,0x67,0x28,0x72,0x2c,0x6e,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x1f,0x00,0x05,0x2a,0x24,0x32,0x37,0x38,0x00,0x00,0x00,0x0d,0x24,0x00,0x1f,
+0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,0x0d,0x25,0x00,0x3b,0x00,0x00,0x00,0x01,
+0x6e,0x00,0x00,0x00,0x1c,0x20,0x24,0x02,0x1c,0x21,0x00,0x00,0x1d,0x22,0x00,0x00,
+0x1d,0x23,0x00,0x00,0x11,0x1f,0x00,0xb9,0x2d,0x0a,0x00,0x10,0x00,0x00,0x00,0x04,
+0x1f,0x05,0x00,0xf6,0x64,0x65,0x66,0x20,0x73,0x65,0x74,0x5f,0x72,0x65,0x67,0x28,
+0x72,0x2c,0x6e,0x29,0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x72,0x00,0x00,0x00,
+0x33,0x01,0x00,0x01,0x6e,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x02,0x00,0x00,
+0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x07,0x73,0x65,0x74,0x5f,0x72,0x65,0x67,0x00,
+0x23,0x02,0x00,0x00,0x1f,0x08,0x00,0xf7,0x20,0x20,0x20,0x20,0x44,0x2e,0x6e,0x32,
+0x72,0x5b,0x6e,0x5d,0x20,0x3d,0x20,0x72,0x3b,0x20,0x44,0x2e,0x72,0x32,0x6e,0x5b,
+0x72,0x5d,0x20,0x3d,0x20,0x6e,0x00,0x00,0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x01,
+0x44,0x00,0x00,0x00,0x0d,0x03,0x00,0x03,0x00,0x00,0x00,0x03,0x6e,0x32,0x72,0x00,
+0x09,0x02,0x02,0x03,0x00,0x00,0x00,0x00,0x0b,0x02,0x01,0x00,0x0e,0x02,0x00,0x02,
+0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x03,0x00,0x04,0x00,0x00,0x00,0x03,
+0x72,0x32,0x6e,0x00,0x09,0x02,0x02,0x03,0x00,0x00,0x00,0x01,0x0b,0x02,0x00,0x01,
+0x1f,0x08,0x00,0xf8,0x20,0x20,0x20,0x20,0x44,0x2e,0x6d,0x72,0x65,0x67,0x20,0x3d,
+0x20,0x6d,0x61,0x78,0x28,0x44,0x2e,0x6d,0x72,0x65,0x67,0x2c,0x72,0x2b,0x31,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,
+0x0e,0x04,0x00,0x05,0x00,0x00,0x00,0x03,0x6d,0x61,0x78,0x00,0x0e,0x05,0x00,0x02,
+0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x07,0x00,0x06,0x00,0x00,0x00,0x04,
+0x6d,0x72,0x65,0x67,0x00,0x00,0x00,0x00,0x09,0x05,0x05,0x07,0x00,0x00,0x00,0x02,
+0x0c,0x07,0x00,0x07,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x06,0x00,0x07,
+0x37,0x03,0x04,0x03,0x0d,0x04,0x00,0x06,0x00,0x00,0x00,0x04,0x6d,0x72,0x65,0x67,
+0x00,0x00,0x00,0x00,0x0b,0x02,0x04,0x03,0x1f,0x06,0x00,0xf9,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x6e,0x6f,0x74,0x20,0x69,0x73,0x5f,0x74,0x6d,0x70,0x28,0x72,0x29,
+0x3a,0x00,0x00,0x00,0x0e,0x04,0x00,0x08,0x00,0x00,0x00,0x06,0x69,0x73,0x5f,0x74,
+0x6d,0x70,0x00,0x00,0x10,0x05,0x00,0x00,0x37,0x03,0x04,0x02,0x2f,0x03,0x00,0x00,
+0x13,0x00,0x00,0x4b,0x1f,0x0b,0x00,0xfa,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x61,
+0x6c,0x20,0x3d,0x20,0x6e,0x2e,0x65,0x6e,0x63,0x6f,0x64,0x65,0x28,0x29,0x20,0x2b,
+0x20,0x62,0x22,0x5c,0x30,0x22,0x2a,0x28,0x34,0x2d,0x6c,0x65,0x6e,0x28,0x6e,0x29,
+0x25,0x34,0x29,0x00,0x33,0x02,0x00,0x03,0x76,0x61,0x6c,0x00,0x0d,0x06,0x00,0x09,
+0x00,0x00,0x00,0x06,0x65,0x6e,0x63,0x6f,0x64,0x65,0x00,0x00,0x38,0x04,0x01,0x06,
+0x00,0x00,0x00,0x03,0x39,0x03,0x04,0x02,0x0d,0x04,0x00,0x0a,0x00,0x00,0x00,0x01,
+0x00,0x00,0x00,0x00,0x0c,0x05,0x00,0x0b,0x00,0x00,0x69,0x04,0x04,0x00,0x00,0x00,
+0x0e,0x07,0x00,0x0c,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x10,0x08,0x01,0x00,
+0x37,0x06,0x07,0x02,0x0c,0x07,0x00,0x0b,0x00,0x00,0x69,0x04,0x04,0x00,0x00,0x00,
+0x28,0x06,0x06,0x07,0x02,0x05,0x05,0x06,0x03,0x04,0x04,0x05,0x01,0x02,0x03,0x04,
+0x1f,0x08,0x00,0xfb,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x5f,0x31,
+0x36,0x28,0x56,0x41,0x52,0x2c,0x20,0x72,0x2c,0x20,0x6c,0x65,0x6e,0x28,0x6e,0x29,
+0x29,0x00,0x00,0x00,0x0e,0x04,0x00,0x0d,0x00,0x00,0x00,0x07,0x63,0x6f,0x64,0x65,
+0x5f,0x31,0x36,0x00,0x0e,0x05,0x00,0x0e,0x00,0x00,0x00,0x03,0x56,0x41,0x52,0x00,
+0x10,0x06,0x00,0x00,0x0e,0x08,0x00,0x0c,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,
+0x10,0x09,0x01,0x00,0x37,0x07,0x08,0x02,0x37,0x03,0x04,0x04,0x1f,0x05,0x00,0xfc,
+0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x72,0x69,0x74,0x65,0x28,0x76,0x61,0x6c,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x04,0x00,0x0f,0x00,0x00,0x00,0x05,0x77,0x72,0x69,0x74,
+0x65,0x00,0x00,0x00,0x10,0x05,0x02,0x00,0x37,0x03,0x04,0x02,0x1f,0x04,0x00,0xfd,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,
+0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x20,0x00,0x3d,0x00,0x00,0x00,0x07,
+0x73,0x65,0x74,0x5f,0x72,0x65,0x67,0x00,0x0f,0x20,0x1f,0x00,0x1f,0x05,0x00,0xff,
+0x64,0x65,0x66,0x20,0x66,0x72,0x65,0x65,0x5f,0x72,0x65,0x67,0x28,0x72,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x20,0x00,0x05,0x2a,0x24,0x32,0x38,0x36,0x00,0x00,0x00,
+0x0d,0x25,0x00,0x1f,0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,0x1c,0x21,0x25,0x01,
+0x1c,0x22,0x00,0x00,0x1d,0x23,0x00,0x00,0x1d,0x24,0x00,0x00,0x11,0x20,0x00,0x6c,
+0x2d,0x04,0x00,0x08,0x00,0x00,0x00,0x04,0x1f,0x05,0x00,0xff,0x64,0x65,0x66,0x20,
+0x66,0x72,0x65,0x65,0x5f,0x72,0x65,0x67,0x28,0x72,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x72,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x72,0x65,0x67,
+0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x08,0x01,0x00,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x69,0x73,0x5f,0x74,0x6d,0x70,0x28,0x72,0x29,0x3a,0x20,0x44,0x2e,
+0x74,0x6d,0x70,0x63,0x20,0x2d,0x3d,0x20,0x31,0x00,0x00,0x00,0x0e,0x02,0x00,0x02,
+0x00,0x00,0x00,0x06,0x69,0x73,0x5f,0x74,0x6d,0x70,0x00,0x00,0x10,0x03,0x00,0x00,
+0x37,0x01,0x02,0x02,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x16,0x0e,0x01,0x00,0x03,
+0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x01,
+0x44,0x00,0x00,0x00,0x0d,0x03,0x00,0x04,0x00,0x00,0x00,0x04,0x74,0x6d,0x70,0x63,
+0x00,0x00,0x00,0x00,0x09,0x02,0x02,0x03,0x00,0x00,0x00,0x00,0x0c,0x03,0x00,0x05,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x02,0x02,0x02,0x03,0x0d,0x03,0x00,0x04,
+0x00,0x00,0x00,0x04,0x74,0x6d,0x70,0x63,0x00,0x00,0x00,0x00,0x0b,0x01,0x03,0x02,
+0x1f,0x0c,0x01,0x01,0x20,0x20,0x20,0x20,0x6e,0x20,0x3d,0x20,0x44,0x2e,0x72,0x32,
+0x6e,0x5b,0x72,0x5d,0x3b,0x20,0x64,0x65,0x6c,0x20,0x44,0x2e,0x72,0x32,0x6e,0x5b,
+0x72,0x5d,0x3b,0x20,0x64,0x65,0x6c,0x20,0x44,0x2e,0x6e,0x32,0x72,0x5b,0x6e,0x5d,
+0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x6e,0x00,0x00,0x00,0x0e,0x02,0x00,0x03,
+0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x03,0x00,0x06,0x00,0x00,0x00,0x03,
+0x72,0x32,0x6e,0x00,0x09,0x02,0x02,0x03,0x00,0x00,0x00,0x01,0x0a,0x01,0x02,0x00,
+0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x03,0x00,0x06,
+0x00,0x00,0x00,0x03,0x72,0x32,0x6e,0x00,0x09,0x02,0x02,0x03,0x00,0x00,0x00,0x02,
+0x2c,0x02,0x00,0x00,0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x07,0x00,0x00,0x00,0x03,0x6e,0x32,0x72,0x00,0x09,0x02,0x02,0x03,
+0x00,0x00,0x00,0x03,0x2c,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x0d,0x21,0x00,0x3e,
+0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x72,0x65,0x67,0x00,0x00,0x00,0x00,
+0x0f,0x21,0x20,0x00,0x1f,0x06,0x01,0x03,0x64,0x65,0x66,0x20,0x69,0x6d,0x61,0x6e,
+0x61,0x67,0x65,0x28,0x6f,0x72,0x69,0x67,0x2c,0x66,0x6e,0x63,0x29,0x3a,0x00,0x00,
+0x33,0x21,0x00,0x05,0x2a,0x24,0x32,0x39,0x33,0x00,0x00,0x00,0x0d,0x26,0x00,0x3f,
+0x00,0x00,0x00,0x04,0x6f,0x72,0x69,0x67,0x00,0x00,0x00,0x00,0x0d,0x27,0x00,0x40,
+0x00,0x00,0x00,0x03,0x66,0x6e,0x63,0x00,0x1c,0x22,0x26,0x02,0x1c,0x23,0x00,0x00,
+0x1d,0x24,0x00,0x00,0x1d,0x25,0x00,0x00,0x11,0x21,0x00,0x79,0x2d,0x0a,0x00,0x0a,
+0x00,0x00,0x00,0x03,0x1f,0x06,0x01,0x03,0x64,0x65,0x66,0x20,0x69,0x6d,0x61,0x6e,
+0x61,0x67,0x65,0x28,0x6f,0x72,0x69,0x67,0x2c,0x66,0x6e,0x63,0x29,0x3a,0x00,0x00,
+0x33,0x00,0x00,0x04,0x6f,0x72,0x69,0x67,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x03,
+0x66,0x6e,0x63,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,
+0x00,0x00,0x00,0x07,0x69,0x6d,0x61,0x6e,0x61,0x67,0x65,0x00,0x23,0x02,0x00,0x00,
+0x1f,0x06,0x01,0x04,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,0x73,0x20,0x3d,0x20,
+0x6f,0x72,0x69,0x67,0x2e,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x33,0x02,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x0d,0x03,0x00,0x02,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x02,0x00,0x03,0x00,0x00,0x00,0x00,
+0x1f,0x08,0x01,0x05,0x20,0x20,0x20,0x20,0x6f,0x72,0x69,0x67,0x2e,0x76,0x61,0x6c,
+0x20,0x3d,0x20,0x6f,0x72,0x69,0x67,0x2e,0x76,0x61,0x6c,0x5b,0x3a,0x2d,0x31,0x5d,
+0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x03,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,
+0x09,0x04,0x00,0x03,0x00,0x00,0x00,0x01,0x1d,0x05,0x00,0x00,0x0c,0x06,0x00,0x04,
+0x00,0x00,0x69,0x04,0xff,0xff,0xff,0xff,0x1c,0x03,0x05,0x02,0x0a,0x04,0x04,0x03,
+0x0d,0x03,0x00,0x03,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x0b,0x00,0x03,0x04,
+0x1f,0x0e,0x01,0x06,0x20,0x20,0x20,0x20,0x74,0x20,0x3d,0x20,0x54,0x6f,0x6b,0x65,
+0x6e,0x28,0x6f,0x72,0x69,0x67,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x73,0x79,0x6d,0x62,
+0x6f,0x6c,0x27,0x2c,0x27,0x3d,0x27,0x2c,0x5b,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,
+0x5d,0x2c,0x6f,0x72,0x69,0x67,0x5d,0x29,0x00,0x00,0x00,0x00,0x33,0x04,0x00,0x01,
+0x74,0x00,0x00,0x00,0x0e,0x05,0x00,0x05,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x0d,0x03,0x00,0x06,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,
+0x09,0x06,0x00,0x03,0x00,0x00,0x00,0x02,0x0d,0x07,0x00,0x07,0x00,0x00,0x00,0x06,
+0x73,0x79,0x6d,0x62,0x6f,0x6c,0x00,0x00,0x0d,0x08,0x00,0x08,0x00,0x00,0x00,0x01,
+0x3d,0x00,0x00,0x00,0x0c,0x03,0x00,0x09,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x03,0x02,0x03,0x10,0x04,0x00,0x00,0x1c,0x09,0x03,0x02,0x37,0x04,0x05,0x05,
+0x1f,0x05,0x01,0x07,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,
+0x6e,0x63,0x28,0x74,0x29,0x00,0x00,0x00,0x10,0x05,0x01,0x00,0x10,0x06,0x04,0x00,
+0x37,0x03,0x05,0x02,0x15,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x22,0x00,0x41,
+0x00,0x00,0x00,0x07,0x69,0x6d,0x61,0x6e,0x61,0x67,0x65,0x00,0x0f,0x22,0x21,0x00,
+0x1f,0x06,0x01,0x09,0x64,0x65,0x66,0x20,0x75,0x6e,0x61,0x72,0x79,0x28,0x69,0x2c,
+0x74,0x62,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x33,0x22,0x00,0x05,
+0x2a,0x24,0x33,0x30,0x31,0x00,0x00,0x00,0x0d,0x27,0x00,0x15,0x00,0x00,0x00,0x01,
+0x69,0x00,0x00,0x00,0x0d,0x28,0x00,0x42,0x00,0x00,0x00,0x02,0x74,0x62,0x00,0x00,
+0x0d,0x29,0x00,0x1f,0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,0x1c,0x23,0x27,0x03,
+0x1d,0x27,0x00,0x00,0x1c,0x24,0x27,0x01,0x1d,0x25,0x00,0x00,0x1d,0x26,0x00,0x00,
+0x11,0x22,0x00,0x5d,0x2d,0x09,0x00,0x06,0x00,0x00,0x00,0x00,0x1f,0x06,0x01,0x09,
+0x64,0x65,0x66,0x20,0x75,0x6e,0x61,0x72,0x79,0x28,0x69,0x2c,0x74,0x62,0x2c,0x72,
+0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x33,0x00,0x00,0x01,0x69,0x00,0x00,0x00,
+0x33,0x01,0x00,0x02,0x74,0x62,0x00,0x00,0x33,0x02,0x00,0x01,0x72,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x03,0x00,0x00,0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x05,
+0x75,0x6e,0x61,0x72,0x79,0x00,0x00,0x00,0x23,0x03,0x00,0x00,0x1f,0x05,0x01,0x0a,
+0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x28,
+0x72,0x29,0x00,0x00,0x0e,0x04,0x00,0x02,0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,
+0x74,0x6d,0x70,0x00,0x10,0x05,0x02,0x00,0x37,0x02,0x04,0x02,0x1f,0x04,0x01,0x0b,
+0x20,0x20,0x20,0x20,0x62,0x20,0x3d,0x20,0x64,0x6f,0x28,0x74,0x62,0x29,0x00,0x00,
+0x33,0x03,0x00,0x01,0x62,0x00,0x00,0x00,0x0e,0x05,0x00,0x03,0x00,0x00,0x00,0x02,
+0x64,0x6f,0x00,0x00,0x10,0x06,0x01,0x00,0x37,0x03,0x05,0x02,0x1f,0x04,0x01,0x0c,
+0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x28,0x69,0x2c,0x72,0x2c,0x62,0x29,0x00,
+0x0e,0x05,0x00,0x04,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,
+0x10,0x06,0x00,0x00,0x10,0x07,0x02,0x00,0x10,0x08,0x03,0x00,0x37,0x04,0x05,0x04,
+0x1f,0x07,0x01,0x0d,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x72,0x20,0x21,0x3d,0x20,
+0x62,0x3a,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x62,0x29,0x00,0x00,
+0x24,0x04,0x02,0x03,0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x08,0x0e,0x05,0x00,0x05,
+0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x10,0x06,0x03,0x00,0x37,0x04,0x05,0x02,0x1f,0x04,0x01,0x0e,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,0x15,0x02,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x23,0x00,0x43,0x00,0x00,0x00,0x05,0x75,0x6e,0x61,0x72,
+0x79,0x00,0x00,0x00,0x0f,0x23,0x22,0x00,0x1f,0x07,0x01,0x10,0x64,0x65,0x66,0x20,
+0x69,0x6e,0x66,0x69,0x78,0x28,0x69,0x2c,0x74,0x62,0x2c,0x74,0x63,0x2c,0x72,0x3d,
+0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x33,0x23,0x00,0x05,0x2a,0x24,0x33,0x31,
+0x31,0x00,0x00,0x00,0x0d,0x28,0x00,0x15,0x00,0x00,0x00,0x01,0x69,0x00,0x00,0x00,
+0x0d,0x29,0x00,0x42,0x00,0x00,0x00,0x02,0x74,0x62,0x00,0x00,0x0d,0x2a,0x00,0x44,
+0x00,0x00,0x00,0x02,0x74,0x63,0x00,0x00,0x0d,0x2b,0x00,0x1f,0x00,0x00,0x00,0x01,
+0x72,0x00,0x00,0x00,0x1c,0x24,0x28,0x04,0x1d,0x28,0x00,0x00,0x1c,0x25,0x28,0x01,
+0x1d,0x26,0x00,0x00,0x1d,0x27,0x00,0x00,0x11,0x23,0x00,0x7b,0x2d,0x0c,0x00,0x06,
+0x00,0x00,0x00,0x00,0x1f,0x07,0x01,0x10,0x64,0x65,0x66,0x20,0x69,0x6e,0x66,0x69,
+0x78,0x28,0x69,0x2c,0x74,0x62,0x2c,0x74,0x63,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,
+0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x01,0x69,0x00,0x00,0x00,0x33,0x01,0x00,0x02,
+0x74,0x62,0x00,0x00,0x33,0x02,0x00,0x02,0x74,0x63,0x00,0x00,0x33,0x03,0x00,0x01,
+0x72,0x00,0x00,0x00,0x0d,0x04,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x04,0x00,0x00,0x0d,0x04,0x00,0x01,
+0x00,0x00,0x00,0x05,0x69,0x6e,0x66,0x69,0x78,0x00,0x00,0x00,0x23,0x04,0x00,0x00,
+0x1f,0x05,0x01,0x11,0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x67,0x65,0x74,0x5f,
+0x74,0x6d,0x70,0x28,0x72,0x29,0x00,0x00,0x0e,0x05,0x00,0x02,0x00,0x00,0x00,0x07,
+0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x00,0x10,0x06,0x03,0x00,0x37,0x03,0x05,0x02,
+0x1f,0x07,0x01,0x12,0x20,0x20,0x20,0x20,0x62,0x2c,0x63,0x20,0x3d,0x20,0x64,0x6f,
+0x28,0x74,0x62,0x2c,0x72,0x29,0x2c,0x64,0x6f,0x28,0x74,0x63,0x29,0x00,0x00,0x00,
+0x0e,0x06,0x00,0x03,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x10,0x07,0x01,0x00,
+0x10,0x08,0x03,0x00,0x37,0x04,0x06,0x03,0x0e,0x07,0x00,0x03,0x00,0x00,0x00,0x02,
+0x64,0x6f,0x00,0x00,0x10,0x08,0x02,0x00,0x37,0x05,0x07,0x02,0x33,0x06,0x00,0x01,
+0x62,0x00,0x00,0x00,0x10,0x06,0x04,0x00,0x33,0x04,0x00,0x01,0x63,0x00,0x00,0x00,
+0x10,0x04,0x05,0x00,0x1f,0x05,0x01,0x13,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,
+0x28,0x69,0x2c,0x72,0x2c,0x62,0x2c,0x63,0x29,0x00,0x00,0x00,0x0e,0x07,0x00,0x04,
+0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x10,0x08,0x00,0x00,
+0x10,0x09,0x03,0x00,0x10,0x0a,0x06,0x00,0x10,0x0b,0x04,0x00,0x37,0x05,0x07,0x05,
+0x1f,0x07,0x01,0x15,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x72,0x20,0x21,0x3d,0x20,
+0x62,0x3a,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x62,0x29,0x00,0x00,
+0x24,0x05,0x03,0x06,0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x08,0x0e,0x07,0x00,0x05,
+0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x10,0x08,0x06,0x00,0x37,0x05,0x07,0x02,0x1f,0x04,0x01,0x16,0x20,0x20,0x20,0x20,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x63,0x29,0x00,0x0e,0x07,0x00,0x05,
+0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x10,0x08,0x04,0x00,0x37,0x05,0x07,0x02,0x1f,0x04,0x01,0x17,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,0x15,0x03,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x24,0x00,0x45,0x00,0x00,0x00,0x05,0x69,0x6e,0x66,0x69,
+0x78,0x00,0x00,0x00,0x0f,0x24,0x23,0x00,0x1f,0x09,0x01,0x19,0x64,0x65,0x66,0x20,
+0x69,0x6e,0x66,0x69,0x78,0x5f,0x74,0x72,0x61,0x63,0x65,0x64,0x28,0x69,0x2c,0x74,
+0x62,0x2c,0x74,0x63,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x24,0x00,0x05,0x2a,0x24,0x33,0x32,0x32,0x00,0x00,0x00,0x0d,0x29,0x00,0x15,
+0x00,0x00,0x00,0x01,0x69,0x00,0x00,0x00,0x0d,0x2a,0x00,0x42,0x00,0x00,0x00,0x02,
+0x74,0x62,0x00,0x00,0x0d,0x2b,0x00,0x44,0x00,0x00,0x00,0x02,0x74,0x63,0x00,0x00,
+0x0d,0x2c,0x00,0x1f,0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,0x1c,0x25,0x29,0x04,
+0x1d,0x29,0x00,0x00,0x1c,0x26,0x29,0x01,0x1d,0x27,0x00,0x00,0x1d,0x28,0x00,0x00,
+0x11,0x24,0x00,0x64,0x2d,0x0c,0x00,0x05,0x00,0x00,0x00,0x00,0x1f,0x09,0x01,0x19,
+0x64,0x65,0x66,0x20,0x69,0x6e,0x66,0x69,0x78,0x5f,0x74,0x72,0x61,0x63,0x65,0x64,
+0x28,0x69,0x2c,0x74,0x62,0x2c,0x74,0x63,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x69,0x00,0x00,0x00,0x33,0x01,0x00,0x02,
+0x74,0x62,0x00,0x00,0x33,0x02,0x00,0x02,0x74,0x63,0x00,0x00,0x33,0x03,0x00,0x01,
+0x72,0x00,0x00,0x00,0x0d,0x04,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x04,0x00,0x00,0x0d,0x04,0x00,0x01,
+0x00,0x00,0x00,0x0c,0x69,0x6e,0x66,0x69,0x78,0x5f,0x74,0x72,0x61,0x63,0x65,0x64,
+0x00,0x00,0x00,0x00,0x23,0x04,0x00,0x00,0x1f,0x05,0x01,0x1a,0x20,0x20,0x20,0x20,
+0x72,0x20,0x3d,0x20,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x28,0x72,0x29,0x00,0x00,
+0x0e,0x05,0x00,0x02,0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x00,
+0x10,0x06,0x03,0x00,0x37,0x03,0x05,0x02,0x1f,0x06,0x01,0x1b,0x20,0x20,0x20,0x20,
+0x62,0x2c,0x63,0x20,0x3d,0x20,0x64,0x6f,0x28,0x74,0x62,0x29,0x2c,0x64,0x6f,0x28,
+0x74,0x63,0x29,0x00,0x0e,0x06,0x00,0x03,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,
+0x10,0x07,0x01,0x00,0x37,0x04,0x06,0x02,0x0e,0x07,0x00,0x03,0x00,0x00,0x00,0x02,
+0x64,0x6f,0x00,0x00,0x10,0x08,0x02,0x00,0x37,0x05,0x07,0x02,0x33,0x06,0x00,0x01,
+0x62,0x00,0x00,0x00,0x10,0x06,0x04,0x00,0x33,0x04,0x00,0x01,0x63,0x00,0x00,0x00,
+0x10,0x04,0x05,0x00,0x1f,0x05,0x01,0x1c,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,
+0x28,0x69,0x2c,0x72,0x2c,0x62,0x2c,0x63,0x29,0x00,0x00,0x00,0x0e,0x07,0x00,0x04,
+0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x10,0x08,0x00,0x00,
+0x10,0x09,0x03,0x00,0x10,0x0a,0x06,0x00,0x10,0x0b,0x04,0x00,0x37,0x05,0x07,0x05,
+0x1f,0x05,0x01,0x1e,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,
+0x2c,0x20,0x62,0x2c,0x20,0x63,0x00,0x00,0x10,0x07,0x03,0x00,0x10,0x08,0x06,0x00,
+0x10,0x09,0x04,0x00,0x1c,0x05,0x07,0x03,0x15,0x05,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x25,0x00,0x46,0x00,0x00,0x00,0x0c,0x69,0x6e,0x66,0x69,0x78,0x5f,0x74,0x72,
+0x61,0x63,0x65,0x64,0x00,0x00,0x00,0x00,0x0f,0x25,0x24,0x00,0x1f,0x0a,0x01,0x20,
+0x64,0x65,0x66,0x20,0x6c,0x6f,0x67,0x69,0x63,0x5f,0x69,0x6e,0x66,0x69,0x78,0x28,
+0x6f,0x70,0x2c,0x20,0x74,0x62,0x2c,0x20,0x74,0x63,0x2c,0x20,0x5f,0x72,0x3d,0x4e,
+0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x00,0x33,0x25,0x00,0x05,0x2a,0x24,0x33,0x33,
+0x33,0x00,0x00,0x00,0x0d,0x2a,0x00,0x47,0x00,0x00,0x00,0x02,0x6f,0x70,0x00,0x00,
+0x0d,0x2b,0x00,0x42,0x00,0x00,0x00,0x02,0x74,0x62,0x00,0x00,0x0d,0x2c,0x00,0x44,
+0x00,0x00,0x00,0x02,0x74,0x63,0x00,0x00,0x0d,0x2d,0x00,0x48,0x00,0x00,0x00,0x02,
+0x5f,0x72,0x00,0x00,0x1c,0x26,0x2a,0x04,0x1d,0x2a,0x00,0x00,0x1c,0x27,0x2a,0x01,
+0x1d,0x28,0x00,0x00,0x1d,0x29,0x00,0x00,0x11,0x25,0x00,0xd1,0x2d,0x08,0x00,0x0d,
+0x00,0x00,0x00,0x00,0x1f,0x0a,0x01,0x20,0x64,0x65,0x66,0x20,0x6c,0x6f,0x67,0x69,
+0x63,0x5f,0x69,0x6e,0x66,0x69,0x78,0x28,0x6f,0x70,0x2c,0x20,0x74,0x62,0x2c,0x20,
+0x74,0x63,0x2c,0x20,0x5f,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x00,0x00,0x02,0x6f,0x70,0x00,0x00,0x33,0x01,0x00,0x02,0x74,0x62,0x00,0x00,
+0x33,0x02,0x00,0x02,0x74,0x63,0x00,0x00,0x33,0x03,0x00,0x02,0x5f,0x72,0x00,0x00,
+0x0d,0x04,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x04,0x00,0x00,0x0d,0x04,0x00,0x01,0x00,0x00,0x00,0x0b,
+0x6c,0x6f,0x67,0x69,0x63,0x5f,0x69,0x6e,0x66,0x69,0x78,0x00,0x23,0x04,0x00,0x00,
+0x1f,0x05,0x01,0x21,0x20,0x20,0x20,0x20,0x74,0x20,0x3d,0x20,0x67,0x65,0x74,0x5f,
+0x74,0x61,0x67,0x28,0x29,0x20,0x00,0x00,0x33,0x04,0x00,0x01,0x74,0x00,0x00,0x00,
+0x0e,0x05,0x00,0x02,0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,0x74,0x61,0x67,0x00,
+0x37,0x04,0x05,0x01,0x1f,0x05,0x01,0x22,0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,
+0x64,0x6f,0x28,0x74,0x62,0x2c,0x20,0x5f,0x72,0x29,0x00,0x00,0x33,0x01,0x00,0x01,
+0x72,0x00,0x00,0x00,0x0e,0x05,0x00,0x03,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,
+0x10,0x06,0x01,0x00,0x10,0x07,0x03,0x00,0x37,0x01,0x05,0x03,0x1f,0x09,0x01,0x23,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x5f,0x72,0x20,0x21,0x3d,0x20,0x72,0x3a,0x20,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x5f,0x72,0x29,0x20,0x23,0x52,0x45,
+0x47,0x00,0x00,0x00,0x24,0x05,0x03,0x01,0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x08,
+0x0e,0x05,0x00,0x04,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x00,0x00,0x00,0x00,0x10,0x06,0x03,0x00,0x37,0x05,0x05,0x02,0x1f,0x09,0x01,0x24,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x27,0x61,0x6e,
+0x64,0x27,0x3a,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x28,0x49,0x46,0x2c,0x20,0x72,
+0x29,0x00,0x00,0x00,0x0d,0x05,0x00,0x05,0x00,0x00,0x00,0x03,0x61,0x6e,0x64,0x00,
+0x18,0x05,0x00,0x05,0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x0b,0x0e,0x05,0x00,0x06,
+0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x07,
+0x00,0x00,0x00,0x02,0x49,0x46,0x00,0x00,0x10,0x07,0x01,0x00,0x37,0x05,0x05,0x03,
+0x13,0x00,0x00,0x1a,0x1f,0x09,0x01,0x25,0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,
+0x20,0x6f,0x70,0x20,0x3d,0x3d,0x20,0x27,0x6f,0x72,0x27,0x3a,0x20,0x20,0x63,0x6f,
+0x64,0x65,0x28,0x49,0x46,0x4e,0x2c,0x20,0x72,0x29,0x00,0x00,0x0d,0x05,0x00,0x08,
+0x00,0x00,0x00,0x02,0x6f,0x72,0x00,0x00,0x18,0x05,0x00,0x05,0x16,0x05,0x00,0x00,
+0x13,0x00,0x00,0x0a,0x0e,0x05,0x00,0x06,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,
+0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x09,0x00,0x00,0x00,0x03,0x49,0x46,0x4e,0x00,
+0x10,0x07,0x01,0x00,0x37,0x05,0x05,0x03,0x1f,0x05,0x01,0x26,0x20,0x20,0x20,0x20,
+0x6a,0x75,0x6d,0x70,0x28,0x74,0x2c,0x20,0x27,0x65,0x6e,0x64,0x27,0x29,0x00,0x00,
+0x0e,0x05,0x00,0x0a,0x00,0x00,0x00,0x04,0x6a,0x75,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x10,0x06,0x04,0x00,0x0d,0x07,0x00,0x0b,0x00,0x00,0x00,0x03,0x65,0x6e,0x64,0x00,
+0x37,0x05,0x05,0x03,0x1f,0x03,0x01,0x27,0x20,0x20,0x20,0x20,0x5f,0x72,0x20,0x3d,
+0x20,0x72,0x00,0x00,0x10,0x03,0x01,0x00,0x1f,0x05,0x01,0x28,0x20,0x20,0x20,0x20,
+0x72,0x20,0x3d,0x20,0x64,0x6f,0x28,0x74,0x63,0x2c,0x20,0x5f,0x72,0x29,0x00,0x00,
+0x0e,0x05,0x00,0x03,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x10,0x06,0x02,0x00,
+0x10,0x07,0x03,0x00,0x37,0x01,0x05,0x03,0x1f,0x09,0x01,0x29,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x5f,0x72,0x20,0x21,0x3d,0x20,0x72,0x3a,0x20,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x28,0x5f,0x72,0x29,0x20,0x23,0x52,0x45,0x47,0x00,0x00,0x00,
+0x24,0x05,0x03,0x01,0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x08,0x0e,0x05,0x00,0x04,
+0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x10,0x06,0x03,0x00,0x37,0x05,0x05,0x02,0x1f,0x05,0x01,0x2a,0x20,0x20,0x20,0x20,
+0x74,0x61,0x67,0x28,0x74,0x2c,0x20,0x27,0x65,0x6e,0x64,0x27,0x29,0x00,0x00,0x00,
+0x0e,0x05,0x00,0x0c,0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,0x10,0x06,0x04,0x00,
+0x0d,0x07,0x00,0x0b,0x00,0x00,0x00,0x03,0x65,0x6e,0x64,0x00,0x37,0x05,0x05,0x03,
+0x1f,0x04,0x01,0x2b,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,
+0x00,0x00,0x00,0x00,0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x26,0x00,0x49,
+0x00,0x00,0x00,0x0b,0x6c,0x6f,0x67,0x69,0x63,0x5f,0x69,0x6e,0x66,0x69,0x78,0x00,
+0x0f,0x26,0x25,0x00,0x1f,0x06,0x01,0x2d,0x64,0x65,0x66,0x20,0x5f,0x64,0x6f,0x5f,
+0x6e,0x6f,0x6e,0x65,0x28,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x26,0x00,0x05,0x2a,0x24,0x33,0x34,0x34,0x00,0x00,0x00,0x0d,0x2b,0x00,0x1f,
+0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,0x1c,0x27,0x2b,0x01,0x1d,0x2b,0x00,0x00,
+0x1c,0x28,0x2b,0x01,0x1d,0x29,0x00,0x00,0x1d,0x2a,0x00,0x00,0x11,0x26,0x00,0x3f,
+0x2d,0x04,0x00,0x05,0x00,0x00,0x00,0x00,0x1f,0x06,0x01,0x2d,0x64,0x65,0x66,0x20,
+0x5f,0x64,0x6f,0x5f,0x6e,0x6f,0x6e,0x65,0x28,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x72,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x08,0x5f,0x64,0x6f,0x5f,
+0x6e,0x6f,0x6e,0x65,0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x05,0x01,0x2e,
+0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x28,
+0x72,0x29,0x00,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,
+0x74,0x6d,0x70,0x00,0x10,0x02,0x00,0x00,0x37,0x00,0x01,0x02,0x1f,0x05,0x01,0x2f,
+0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x28,0x4e,0x4f,0x4e,0x45,0x2c,0x72,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x01,0x00,0x03,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,
+0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x04,0x00,0x00,0x00,0x04,0x4e,0x4f,0x4e,0x45,
+0x00,0x00,0x00,0x00,0x10,0x03,0x00,0x00,0x37,0x01,0x01,0x03,0x1f,0x04,0x01,0x30,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,
+0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x27,0x00,0x4a,0x00,0x00,0x00,0x08,
+0x5f,0x64,0x6f,0x5f,0x6e,0x6f,0x6e,0x65,0x00,0x00,0x00,0x00,0x0f,0x27,0x26,0x00,
+0x1f,0x08,0x01,0x32,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x63,0x6d,0x70,0x28,0x74,
+0x2c,0x20,0x74,0x72,0x61,0x63,0x65,0x2c,0x20,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x27,0x00,0x05,0x2a,0x24,0x33,0x35,0x32,0x00,0x00,0x00,
+0x0d,0x2c,0x00,0x21,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x2d,0x00,0x4b,
+0x00,0x00,0x00,0x05,0x74,0x72,0x61,0x63,0x65,0x00,0x00,0x00,0x0d,0x2e,0x00,0x1f,
+0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,0x1c,0x28,0x2c,0x03,0x1d,0x2c,0x00,0x00,
+0x1c,0x29,0x2c,0x01,0x1d,0x2a,0x00,0x00,0x1d,0x2b,0x00,0x00,0x11,0x27,0x01,0x33,
+0x2d,0x0c,0x00,0x19,0x00,0x00,0x00,0x02,0x1f,0x08,0x01,0x32,0x64,0x65,0x66,0x20,
+0x64,0x6f,0x5f,0x63,0x6d,0x70,0x28,0x74,0x2c,0x20,0x74,0x72,0x61,0x63,0x65,0x2c,
+0x20,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x33,0x01,0x00,0x05,0x74,0x72,0x61,0x63,0x65,0x00,0x00,0x00,
+0x33,0x02,0x00,0x01,0x72,0x00,0x00,0x00,0x0d,0x03,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x03,0x00,0x00,
+0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x06,0x64,0x6f,0x5f,0x63,0x6d,0x70,0x00,0x00,
+0x23,0x03,0x00,0x00,0x1f,0x05,0x01,0x33,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,
+0x73,0x20,0x3d,0x20,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x00,0x33,0x03,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x0d,0x03,0x00,0x02,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x03,0x00,0x03,0x00,0x00,0x00,0x00,
+0x1f,0x07,0x01,0x34,0x20,0x20,0x20,0x20,0x62,0x2c,0x63,0x20,0x3d,0x20,0x69,0x74,
+0x65,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x69,0x74,0x65,0x6d,0x73,0x5b,0x31,0x5d,0x00,
+0x0c,0x04,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x05,0x03,0x04,
+0x0c,0x06,0x00,0x04,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x03,0x03,0x06,
+0x33,0x04,0x00,0x01,0x62,0x00,0x00,0x00,0x10,0x04,0x05,0x00,0x33,0x05,0x00,0x01,
+0x63,0x00,0x00,0x00,0x10,0x05,0x03,0x00,0x1f,0x04,0x01,0x35,0x20,0x20,0x20,0x20,
+0x76,0x20,0x3d,0x20,0x74,0x2e,0x76,0x61,0x6c,0x00,0x00,0x00,0x33,0x03,0x00,0x01,
+0x76,0x00,0x00,0x00,0x0d,0x07,0x00,0x05,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,
+0x09,0x03,0x00,0x07,0x00,0x00,0x00,0x01,0x1f,0x03,0x01,0x36,0x20,0x20,0x20,0x20,
+0x63,0x64,0x20,0x3d,0x20,0x45,0x51,0x00,0x33,0x06,0x00,0x02,0x63,0x64,0x00,0x00,
+0x0e,0x06,0x00,0x06,0x00,0x00,0x00,0x02,0x45,0x51,0x00,0x00,0x1f,0x07,0x01,0x37,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x76,0x20,0x3d,0x3d,0x20,0x27,0x3c,0x27,0x3a,
+0x20,0x63,0x64,0x20,0x3d,0x20,0x4c,0x54,0x00,0x00,0x00,0x00,0x0d,0x07,0x00,0x07,
+0x00,0x00,0x00,0x01,0x3c,0x00,0x00,0x00,0x18,0x07,0x03,0x07,0x16,0x07,0x00,0x00,
+0x13,0x00,0x00,0x04,0x0e,0x06,0x00,0x08,0x00,0x00,0x00,0x02,0x4c,0x54,0x00,0x00,
+0x1f,0x07,0x01,0x38,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x76,0x20,0x3d,0x3d,0x20,
+0x27,0x3c,0x3d,0x27,0x3a,0x20,0x63,0x64,0x20,0x3d,0x20,0x4c,0x45,0x00,0x00,0x00,
+0x0d,0x07,0x00,0x09,0x00,0x00,0x00,0x02,0x3c,0x3d,0x00,0x00,0x18,0x07,0x03,0x07,
+0x16,0x07,0x00,0x00,0x13,0x00,0x00,0x04,0x0e,0x06,0x00,0x0a,0x00,0x00,0x00,0x02,
+0x4c,0x45,0x00,0x00,0x1f,0x07,0x01,0x39,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x76,
+0x20,0x3d,0x3d,0x20,0x27,0x3e,0x27,0x3a,0x20,0x63,0x64,0x20,0x3d,0x20,0x47,0x54,
+0x00,0x00,0x00,0x00,0x0d,0x07,0x00,0x0b,0x00,0x00,0x00,0x01,0x3e,0x00,0x00,0x00,
+0x18,0x07,0x03,0x07,0x16,0x07,0x00,0x00,0x13,0x00,0x00,0x04,0x0e,0x06,0x00,0x0c,
+0x00,0x00,0x00,0x02,0x47,0x54,0x00,0x00,0x1f,0x07,0x01,0x3a,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x76,0x20,0x3d,0x3d,0x20,0x27,0x3e,0x3d,0x27,0x3a,0x20,0x63,0x64,
+0x20,0x3d,0x20,0x47,0x45,0x00,0x00,0x00,0x0d,0x07,0x00,0x0d,0x00,0x00,0x00,0x02,
+0x3e,0x3d,0x00,0x00,0x18,0x07,0x03,0x07,0x16,0x07,0x00,0x00,0x13,0x00,0x00,0x04,
+0x0e,0x06,0x00,0x0e,0x00,0x00,0x00,0x02,0x47,0x45,0x00,0x00,0x1f,0x07,0x01,0x3b,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x76,0x20,0x3d,0x3d,0x20,0x27,0x21,0x3d,0x27,
+0x3a,0x20,0x63,0x64,0x20,0x3d,0x20,0x4e,0x45,0x00,0x00,0x00,0x0d,0x07,0x00,0x0f,
+0x00,0x00,0x00,0x02,0x21,0x3d,0x00,0x00,0x18,0x07,0x03,0x07,0x16,0x07,0x00,0x00,
+0x13,0x00,0x00,0x04,0x0e,0x06,0x00,0x10,0x00,0x00,0x00,0x02,0x4e,0x45,0x00,0x00,
+0x1f,0x07,0x01,0x3c,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x76,0x20,0x3d,0x3d,0x20,
+0x27,0x69,0x73,0x27,0x3a,0x20,0x63,0x64,0x20,0x3d,0x20,0x45,0x51,0x00,0x00,0x00,
+0x0d,0x07,0x00,0x11,0x00,0x00,0x00,0x02,0x69,0x73,0x00,0x00,0x18,0x07,0x03,0x07,
+0x16,0x07,0x00,0x00,0x13,0x00,0x00,0x04,0x0e,0x06,0x00,0x06,0x00,0x00,0x00,0x02,
+0x45,0x51,0x00,0x00,0x1f,0x08,0x01,0x3d,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x76,
+0x20,0x3d,0x3d,0x20,0x27,0x69,0x73,0x6e,0x6f,0x74,0x27,0x3a,0x20,0x63,0x64,0x20,
+0x3d,0x20,0x4e,0x45,0x00,0x00,0x00,0x00,0x0d,0x07,0x00,0x12,0x00,0x00,0x00,0x05,
+0x69,0x73,0x6e,0x6f,0x74,0x00,0x00,0x00,0x18,0x07,0x03,0x07,0x16,0x07,0x00,0x00,
+0x13,0x00,0x00,0x04,0x0e,0x06,0x00,0x10,0x00,0x00,0x00,0x02,0x4e,0x45,0x00,0x00,
+0x1f,0x05,0x01,0x3e,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x76,0x20,0x3d,0x3d,0x20,
+0x27,0x69,0x6e,0x27,0x3a,0x00,0x00,0x00,0x0d,0x07,0x00,0x13,0x00,0x00,0x00,0x02,
+0x69,0x6e,0x00,0x00,0x18,0x07,0x03,0x07,0x16,0x07,0x00,0x00,0x13,0x00,0x00,0x09,
+0x1f,0x04,0x01,0x3f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x64,0x20,0x3d,
+0x20,0x49,0x4e,0x00,0x0e,0x06,0x00,0x14,0x00,0x00,0x00,0x02,0x49,0x4e,0x00,0x00,
+0x1f,0x06,0x01,0x40,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x76,0x20,0x3d,0x3d,0x20,
+0x27,0x6e,0x6f,0x74,0x69,0x6e,0x27,0x3a,0x00,0x00,0x00,0x00,0x0d,0x07,0x00,0x15,
+0x00,0x00,0x00,0x05,0x6e,0x6f,0x74,0x69,0x6e,0x00,0x00,0x00,0x18,0x07,0x03,0x07,
+0x16,0x07,0x00,0x00,0x13,0x00,0x00,0x0b,0x1f,0x05,0x01,0x41,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x63,0x64,0x20,0x3d,0x20,0x4e,0x4f,0x54,0x49,0x4e,0x00,0x00,
+0x0e,0x06,0x00,0x16,0x00,0x00,0x00,0x05,0x4e,0x4f,0x54,0x49,0x4e,0x00,0x00,0x00,
+0x1f,0x04,0x01,0x42,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,0x72,0x61,0x63,0x65,
+0x3a,0x00,0x00,0x00,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x18,0x1f,0x0a,0x01,0x43,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x69,
+0x6e,0x66,0x69,0x78,0x5f,0x74,0x72,0x61,0x63,0x65,0x64,0x28,0x63,0x64,0x2c,0x62,
+0x2c,0x63,0x2c,0x72,0x29,0x00,0x00,0x00,0x0e,0x07,0x00,0x17,0x00,0x00,0x00,0x0c,
+0x69,0x6e,0x66,0x69,0x78,0x5f,0x74,0x72,0x61,0x63,0x65,0x64,0x00,0x00,0x00,0x00,
+0x10,0x08,0x06,0x00,0x10,0x09,0x04,0x00,0x10,0x0a,0x05,0x00,0x10,0x0b,0x02,0x00,
+0x37,0x07,0x07,0x05,0x15,0x07,0x00,0x00,0x1f,0x08,0x01,0x45,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x69,0x6e,0x66,0x69,0x78,
+0x28,0x63,0x64,0x2c,0x62,0x2c,0x63,0x2c,0x72,0x29,0x00,0x00,0x0e,0x07,0x00,0x18,
+0x00,0x00,0x00,0x05,0x69,0x6e,0x66,0x69,0x78,0x00,0x00,0x00,0x10,0x08,0x06,0x00,
+0x10,0x09,0x04,0x00,0x10,0x0a,0x05,0x00,0x10,0x0b,0x02,0x00,0x37,0x07,0x07,0x05,
+0x15,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x28,0x00,0x4c,0x00,0x00,0x00,0x06,
+0x64,0x6f,0x5f,0x63,0x6d,0x70,0x00,0x00,0x0f,0x28,0x27,0x00,0x1f,0x07,0x01,0x47,
+0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x28,0x74,0x2c,
+0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x28,0x00,0x05,
+0x2a,0x24,0x33,0x36,0x32,0x00,0x00,0x00,0x0d,0x2d,0x00,0x21,0x00,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x0d,0x2e,0x00,0x1f,0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,
+0x1c,0x29,0x2d,0x02,0x1d,0x2d,0x00,0x00,0x1c,0x2a,0x2d,0x01,0x1d,0x2b,0x00,0x00,
+0x1d,0x2c,0x00,0x00,0x11,0x28,0x02,0x7f,0x2d,0x1d,0x00,0x3d,0x00,0x00,0x00,0x0b,
+0x1f,0x07,0x01,0x47,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x73,0x79,0x6d,0x62,0x6f,
+0x6c,0x28,0x74,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x72,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x09,
+0x64,0x6f,0x5f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x00,0x00,0x00,0x23,0x02,0x00,0x00,
+0x1f,0x05,0x01,0x48,0x20,0x20,0x20,0x20,0x73,0x65,0x74,0x73,0x20,0x3d,0x20,0x5b,
+0x27,0x3d,0x27,0x5d,0x00,0x00,0x00,0x00,0x33,0x02,0x00,0x04,0x73,0x65,0x74,0x73,
+0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x02,0x00,0x00,0x00,0x01,0x3d,0x00,0x00,0x00,
+0x1c,0x02,0x03,0x01,0x1f,0x0d,0x01,0x49,0x20,0x20,0x20,0x20,0x69,0x73,0x65,0x74,
+0x73,0x20,0x3d,0x20,0x5b,0x27,0x2b,0x3d,0x27,0x2c,0x27,0x2d,0x3d,0x27,0x2c,0x27,
+0x2a,0x3d,0x27,0x2c,0x27,0x2f,0x3d,0x27,0x2c,0x20,0x27,0x7c,0x3d,0x27,0x2c,0x20,
+0x27,0x26,0x3d,0x27,0x2c,0x20,0x27,0x5e,0x3d,0x27,0x5d,0x00,0x33,0x1c,0x00,0x05,
+0x69,0x73,0x65,0x74,0x73,0x00,0x00,0x00,0x0d,0x04,0x00,0x03,0x00,0x00,0x00,0x02,
+0x2b,0x3d,0x00,0x00,0x0d,0x05,0x00,0x04,0x00,0x00,0x00,0x02,0x2d,0x3d,0x00,0x00,
+0x0d,0x06,0x00,0x05,0x00,0x00,0x00,0x02,0x2a,0x3d,0x00,0x00,0x0d,0x07,0x00,0x06,
+0x00,0x00,0x00,0x02,0x2f,0x3d,0x00,0x00,0x0d,0x08,0x00,0x07,0x00,0x00,0x00,0x02,
+0x7c,0x3d,0x00,0x00,0x0d,0x09,0x00,0x08,0x00,0x00,0x00,0x02,0x26,0x3d,0x00,0x00,
+0x0d,0x0a,0x00,0x09,0x00,0x00,0x00,0x02,0x5e,0x3d,0x00,0x00,0x1c,0x1c,0x04,0x07,
+0x1f,0x12,0x01,0x4a,0x20,0x20,0x20,0x20,0x63,0x6d,0x70,0x73,0x20,0x3d,0x20,0x5b,
+0x27,0x3c,0x27,0x2c,0x27,0x3e,0x27,0x2c,0x27,0x3c,0x3d,0x27,0x2c,0x27,0x3e,0x3d,
+0x27,0x2c,0x27,0x3d,0x3d,0x27,0x2c,0x27,0x21,0x3d,0x27,0x2c,0x20,0x27,0x69,0x6e,
+0x27,0x2c,0x20,0x27,0x69,0x73,0x27,0x2c,0x20,0x27,0x69,0x73,0x6e,0x6f,0x74,0x27,
+0x2c,0x20,0x27,0x6e,0x6f,0x74,0x69,0x6e,0x27,0x5d,0x00,0x00,0x33,0x03,0x00,0x04,
+0x63,0x6d,0x70,0x73,0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x0a,0x00,0x00,0x00,0x01,
+0x3c,0x00,0x00,0x00,0x0d,0x06,0x00,0x0b,0x00,0x00,0x00,0x01,0x3e,0x00,0x00,0x00,
+0x0d,0x07,0x00,0x0c,0x00,0x00,0x00,0x02,0x3c,0x3d,0x00,0x00,0x0d,0x08,0x00,0x0d,
+0x00,0x00,0x00,0x02,0x3e,0x3d,0x00,0x00,0x0d,0x09,0x00,0x0e,0x00,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x0d,0x0a,0x00,0x0f,0x00,0x00,0x00,0x02,0x21,0x3d,0x00,0x00,
+0x0d,0x0b,0x00,0x10,0x00,0x00,0x00,0x02,0x69,0x6e,0x00,0x00,0x0d,0x0c,0x00,0x11,
+0x00,0x00,0x00,0x02,0x69,0x73,0x00,0x00,0x0d,0x0d,0x00,0x12,0x00,0x00,0x00,0x05,
+0x69,0x73,0x6e,0x6f,0x74,0x00,0x00,0x00,0x0d,0x0e,0x00,0x13,0x00,0x00,0x00,0x05,
+0x6e,0x6f,0x74,0x69,0x6e,0x00,0x00,0x00,0x1c,0x03,0x05,0x0a,0x1f,0x04,0x01,0x4b,
+0x20,0x20,0x20,0x20,0x6d,0x65,0x74,0x61,0x73,0x20,0x3d,0x20,0x7b,0x00,0x00,0x00,
+0x33,0x04,0x00,0x05,0x6d,0x65,0x74,0x61,0x73,0x00,0x00,0x00,0x1f,0x0b,0x01,0x4c,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x27,0x2b,0x27,0x3a,0x41,0x44,0x44,0x2c,
+0x27,0x2a,0x27,0x3a,0x4d,0x55,0x4c,0x2c,0x27,0x2f,0x27,0x3a,0x44,0x49,0x56,0x2c,
+0x27,0x2a,0x2a,0x27,0x3a,0x50,0x4f,0x57,0x2c,0x00,0x00,0x00,0x0d,0x06,0x00,0x14,
+0x00,0x00,0x00,0x01,0x2b,0x00,0x00,0x00,0x0e,0x07,0x00,0x15,0x00,0x00,0x00,0x03,
+0x41,0x44,0x44,0x00,0x0d,0x08,0x00,0x16,0x00,0x00,0x00,0x01,0x2a,0x00,0x00,0x00,
+0x0e,0x09,0x00,0x17,0x00,0x00,0x00,0x03,0x4d,0x55,0x4c,0x00,0x0d,0x0a,0x00,0x18,
+0x00,0x00,0x00,0x01,0x2f,0x00,0x00,0x00,0x0e,0x0b,0x00,0x19,0x00,0x00,0x00,0x03,
+0x44,0x49,0x56,0x00,0x0d,0x0c,0x00,0x1a,0x00,0x00,0x00,0x02,0x2a,0x2a,0x00,0x00,
+0x0e,0x0d,0x00,0x1b,0x00,0x00,0x00,0x03,0x50,0x4f,0x57,0x00,0x1f,0x05,0x01,0x4d,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x27,0x2d,0x27,0x3a,0x53,0x55,0x42,0x2c,
+0x00,0x00,0x00,0x00,0x0d,0x0e,0x00,0x1c,0x00,0x00,0x00,0x01,0x2d,0x00,0x00,0x00,
+0x0e,0x0f,0x00,0x1d,0x00,0x00,0x00,0x03,0x53,0x55,0x42,0x00,0x1f,0x09,0x01,0x4e,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x27,0x25,0x27,0x3a,0x4d,0x4f,0x44,0x2c,
+0x27,0x3e,0x3e,0x27,0x3a,0x52,0x53,0x48,0x2c,0x27,0x3c,0x3c,0x27,0x3a,0x4c,0x53,
+0x48,0x2c,0x00,0x00,0x0d,0x10,0x00,0x1e,0x00,0x00,0x00,0x01,0x25,0x00,0x00,0x00,
+0x0e,0x11,0x00,0x1f,0x00,0x00,0x00,0x03,0x4d,0x4f,0x44,0x00,0x0d,0x12,0x00,0x20,
+0x00,0x00,0x00,0x02,0x3e,0x3e,0x00,0x00,0x0e,0x13,0x00,0x21,0x00,0x00,0x00,0x03,
+0x52,0x53,0x48,0x00,0x0d,0x14,0x00,0x22,0x00,0x00,0x00,0x02,0x3c,0x3c,0x00,0x00,
+0x0e,0x15,0x00,0x23,0x00,0x00,0x00,0x03,0x4c,0x53,0x48,0x00,0x1f,0x0b,0x01,0x4f,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x27,0x26,0x27,0x3a,0x42,0x49,0x54,0x41,
+0x4e,0x44,0x2c,0x27,0x7c,0x27,0x3a,0x42,0x49,0x54,0x4f,0x52,0x2c,0x27,0x5e,0x27,
+0x3a,0x42,0x49,0x54,0x58,0x4f,0x52,0x2c,0x00,0x00,0x00,0x00,0x0d,0x16,0x00,0x24,
+0x00,0x00,0x00,0x01,0x26,0x00,0x00,0x00,0x0e,0x17,0x00,0x25,0x00,0x00,0x00,0x06,
+0x42,0x49,0x54,0x41,0x4e,0x44,0x00,0x00,0x0d,0x18,0x00,0x26,0x00,0x00,0x00,0x01,
+0x7c,0x00,0x00,0x00,0x0e,0x19,0x00,0x27,0x00,0x00,0x00,0x05,0x42,0x49,0x54,0x4f,
+0x52,0x00,0x00,0x00,0x0d,0x1a,0x00,0x28,0x00,0x00,0x00,0x01,0x5e,0x00,0x00,0x00,
+0x0e,0x1b,0x00,0x29,0x00,0x00,0x00,0x06,0x42,0x49,0x54,0x58,0x4f,0x52,0x00,0x00,
+0x1b,0x04,0x06,0x16,0x1f,0x0b,0x01,0x51,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,
+0x2e,0x76,0x61,0x6c,0x20,0x3d,0x3d,0x20,0x27,0x4e,0x6f,0x6e,0x65,0x27,0x3a,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x64,0x6f,0x5f,0x6e,0x6f,0x6e,0x65,0x28,
+0x72,0x29,0x00,0x00,0x0d,0x06,0x00,0x2a,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,
+0x09,0x05,0x00,0x06,0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x2b,0x00,0x00,0x00,0x04,
+0x4e,0x6f,0x6e,0x65,0x00,0x00,0x00,0x00,0x18,0x05,0x05,0x06,0x16,0x05,0x00,0x00,
+0x13,0x00,0x00,0x09,0x0e,0x06,0x00,0x2c,0x00,0x00,0x00,0x08,0x5f,0x64,0x6f,0x5f,
+0x6e,0x6f,0x6e,0x65,0x00,0x00,0x00,0x00,0x10,0x07,0x01,0x00,0x37,0x05,0x06,0x02,
+0x15,0x05,0x00,0x00,0x1f,0x06,0x01,0x52,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,
+0x2e,0x76,0x61,0x6c,0x20,0x3d,0x3d,0x20,0x27,0x54,0x72,0x75,0x65,0x27,0x3a,0x00,
+0x0d,0x06,0x00,0x2a,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x09,0x05,0x00,0x06,
+0x00,0x00,0x00,0x01,0x0d,0x06,0x00,0x2d,0x00,0x00,0x00,0x04,0x54,0x72,0x75,0x65,
+0x00,0x00,0x00,0x00,0x18,0x05,0x05,0x06,0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x15,
+0x1f,0x08,0x01,0x53,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x5f,0x64,0x6f,0x5f,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x28,0x31,
+0x2c,0x72,0x29,0x00,0x0e,0x06,0x00,0x2e,0x00,0x00,0x00,0x0b,0x5f,0x64,0x6f,0x5f,
+0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x00,0x0c,0x07,0x00,0x2f,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x10,0x08,0x01,0x00,0x37,0x05,0x06,0x03,0x15,0x05,0x00,0x00,
+0x1f,0x07,0x01,0x54,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,0x2e,0x76,0x61,0x6c,
+0x20,0x3d,0x3d,0x20,0x27,0x46,0x61,0x6c,0x73,0x65,0x27,0x3a,0x00,0x00,0x00,0x00,
+0x0d,0x06,0x00,0x2a,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x09,0x05,0x00,0x06,
+0x00,0x00,0x00,0x02,0x0d,0x06,0x00,0x30,0x00,0x00,0x00,0x05,0x46,0x61,0x6c,0x73,
+0x65,0x00,0x00,0x00,0x18,0x05,0x05,0x06,0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x15,
+0x1f,0x08,0x01,0x55,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x5f,0x64,0x6f,0x5f,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x28,0x30,
+0x2c,0x72,0x29,0x00,0x0e,0x06,0x00,0x2e,0x00,0x00,0x00,0x0b,0x5f,0x64,0x6f,0x5f,
+0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x00,0x0c,0x07,0x00,0x31,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x10,0x08,0x01,0x00,0x37,0x05,0x06,0x03,0x15,0x05,0x00,0x00,
+0x1f,0x05,0x01,0x56,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,0x73,0x20,0x3d,0x20,
+0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x00,0x33,0x05,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x0d,0x07,0x00,0x32,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x09,0x05,0x00,0x07,0x00,0x00,0x00,0x03,0x1f,0x08,0x01,0x58,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,0x2e,0x76,0x61,0x6c,0x20,0x69,0x6e,0x20,
+0x5b,0x27,0x61,0x6e,0x64,0x27,0x2c,0x27,0x6f,0x72,0x27,0x5d,0x3a,0x00,0x00,0x00,
+0x0d,0x07,0x00,0x2a,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x09,0x06,0x00,0x07,
+0x00,0x00,0x00,0x04,0x0d,0x08,0x00,0x33,0x00,0x00,0x00,0x03,0x61,0x6e,0x64,0x00,
+0x0d,0x09,0x00,0x34,0x00,0x00,0x00,0x02,0x6f,0x72,0x00,0x00,0x1c,0x07,0x08,0x02,
+0x25,0x06,0x06,0x07,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x26,0x1f,0x0f,0x01,0x59,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6c,
+0x6f,0x67,0x69,0x63,0x5f,0x69,0x6e,0x66,0x69,0x78,0x28,0x74,0x2e,0x76,0x61,0x6c,
+0x2c,0x20,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x20,0x69,0x74,0x65,0x6d,
+0x73,0x5b,0x31,0x5d,0x2c,0x20,0x72,0x29,0x00,0x00,0x00,0x00,0x0e,0x07,0x00,0x35,
+0x00,0x00,0x00,0x0b,0x6c,0x6f,0x67,0x69,0x63,0x5f,0x69,0x6e,0x66,0x69,0x78,0x00,
+0x0d,0x0c,0x00,0x2a,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x09,0x08,0x00,0x0c,
+0x00,0x00,0x00,0x05,0x0c,0x0c,0x00,0x31,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x09,0x05,0x0c,0x0c,0x0c,0x00,0x2f,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x0a,0x05,0x0c,0x10,0x0b,0x01,0x00,0x37,0x06,0x07,0x05,0x15,0x06,0x00,0x00,
+0x1f,0x06,0x01,0x5a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,0x2e,0x76,0x61,0x6c,
+0x20,0x69,0x6e,0x20,0x69,0x73,0x65,0x74,0x73,0x3a,0x00,0x00,0x0d,0x07,0x00,0x2a,
+0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x09,0x06,0x00,0x07,0x00,0x00,0x00,0x06,
+0x25,0x06,0x06,0x1c,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x17,0x1f,0x09,0x01,0x5b,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x69,
+0x6d,0x61,0x6e,0x61,0x67,0x65,0x28,0x74,0x2c,0x64,0x6f,0x5f,0x73,0x79,0x6d,0x62,
+0x6f,0x6c,0x29,0x00,0x0e,0x07,0x00,0x36,0x00,0x00,0x00,0x07,0x69,0x6d,0x61,0x6e,
+0x61,0x67,0x65,0x00,0x10,0x08,0x00,0x00,0x0e,0x09,0x00,0x01,0x00,0x00,0x00,0x09,
+0x64,0x6f,0x5f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x00,0x00,0x00,0x37,0x06,0x07,0x03,
+0x15,0x06,0x00,0x00,0x1f,0x06,0x01,0x5c,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,
+0x2e,0x76,0x61,0x6c,0x20,0x3d,0x3d,0x20,0x27,0x6e,0x6f,0x74,0x27,0x3a,0x00,0x00,
+0x0d,0x07,0x00,0x2a,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x09,0x06,0x00,0x07,
+0x00,0x00,0x00,0x07,0x0d,0x07,0x00,0x37,0x00,0x00,0x00,0x03,0x6e,0x6f,0x74,0x00,
+0x18,0x06,0x06,0x07,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x1a,0x1f,0x0a,0x01,0x5d,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x75,
+0x6e,0x61,0x72,0x79,0x28,0x4e,0x4f,0x54,0x2c,0x20,0x69,0x74,0x65,0x6d,0x73,0x5b,
+0x30,0x5d,0x2c,0x20,0x72,0x29,0x00,0x00,0x0e,0x07,0x00,0x38,0x00,0x00,0x00,0x05,
+0x75,0x6e,0x61,0x72,0x79,0x00,0x00,0x00,0x0e,0x08,0x00,0x39,0x00,0x00,0x00,0x03,
+0x4e,0x4f,0x54,0x00,0x0c,0x0b,0x00,0x31,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x09,0x05,0x0b,0x10,0x0a,0x01,0x00,0x37,0x06,0x07,0x04,0x15,0x06,0x00,0x00,
+0x1f,0x06,0x01,0x5e,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,0x2e,0x76,0x61,0x6c,
+0x20,0x69,0x6e,0x20,0x73,0x65,0x74,0x73,0x3a,0x00,0x00,0x00,0x0d,0x07,0x00,0x2a,
+0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x09,0x06,0x00,0x07,0x00,0x00,0x00,0x08,
+0x25,0x06,0x06,0x02,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x1d,0x1f,0x0c,0x01,0x5f,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x64,
+0x6f,0x5f,0x73,0x65,0x74,0x5f,0x63,0x74,0x78,0x28,0x69,0x74,0x65,0x6d,0x73,0x5b,
+0x30,0x5d,0x2c,0x69,0x74,0x65,0x6d,0x73,0x5b,0x31,0x5d,0x29,0x3b,0x00,0x00,0x00,
+0x0e,0x07,0x00,0x3a,0x00,0x00,0x00,0x0a,0x64,0x6f,0x5f,0x73,0x65,0x74,0x5f,0x63,
+0x74,0x78,0x00,0x00,0x0c,0x0a,0x00,0x31,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x08,0x05,0x0a,0x0c,0x0a,0x00,0x2f,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x09,0x05,0x0a,0x37,0x06,0x07,0x03,0x15,0x06,0x00,0x00,0x1f,0x06,0x01,0x60,
+0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x74,0x2e,0x76,0x61,0x6c,0x20,0x69,
+0x6e,0x20,0x63,0x6d,0x70,0x73,0x3a,0x00,0x0d,0x07,0x00,0x2a,0x00,0x00,0x00,0x03,
+0x76,0x61,0x6c,0x00,0x09,0x06,0x00,0x07,0x00,0x00,0x00,0x09,0x25,0x06,0x06,0x03,
+0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x16,0x1f,0x09,0x01,0x61,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x64,0x6f,0x5f,0x63,0x6d,
+0x70,0x28,0x74,0x2c,0x20,0x46,0x61,0x6c,0x73,0x65,0x2c,0x20,0x72,0x29,0x00,0x00,
+0x0e,0x07,0x00,0x3b,0x00,0x00,0x00,0x06,0x64,0x6f,0x5f,0x63,0x6d,0x70,0x00,0x00,
+0x10,0x08,0x00,0x00,0x0c,0x09,0x00,0x31,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x10,0x0a,0x01,0x00,0x37,0x06,0x07,0x04,0x15,0x06,0x00,0x00,0x1f,0x0e,0x01,0x63,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x69,
+0x6e,0x66,0x69,0x78,0x28,0x6d,0x65,0x74,0x61,0x73,0x5b,0x74,0x2e,0x76,0x61,0x6c,
+0x5d,0x2c,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x69,0x74,0x65,0x6d,0x73,
+0x5b,0x31,0x5d,0x2c,0x72,0x29,0x00,0x00,0x0e,0x07,0x00,0x3c,0x00,0x00,0x00,0x05,
+0x69,0x6e,0x66,0x69,0x78,0x00,0x00,0x00,0x0d,0x0d,0x00,0x2a,0x00,0x00,0x00,0x03,
+0x76,0x61,0x6c,0x00,0x09,0x0c,0x00,0x0d,0x00,0x00,0x00,0x0a,0x0a,0x08,0x04,0x0c,
+0x0c,0x0c,0x00,0x31,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x09,0x05,0x0c,
+0x0c,0x0c,0x00,0x2f,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x0a,0x05,0x0c,
+0x10,0x0b,0x01,0x00,0x37,0x06,0x07,0x05,0x15,0x06,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x29,0x00,0x4d,0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x73,0x79,0x6d,0x62,0x6f,
+0x6c,0x00,0x00,0x00,0x0f,0x29,0x28,0x00,0x1f,0x06,0x01,0x65,0x64,0x65,0x66,0x20,
+0x64,0x6f,0x5f,0x73,0x65,0x74,0x5f,0x63,0x74,0x78,0x28,0x6b,0x2c,0x76,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x29,0x00,0x05,0x2a,0x24,0x33,0x37,0x31,0x00,0x00,0x00,
+0x0d,0x2e,0x00,0x4e,0x00,0x00,0x00,0x01,0x6b,0x00,0x00,0x00,0x0d,0x2f,0x00,0x11,
+0x00,0x00,0x00,0x01,0x76,0x00,0x00,0x00,0x1c,0x2a,0x2e,0x02,0x1c,0x2b,0x00,0x00,
+0x1d,0x2c,0x00,0x00,0x1d,0x2d,0x00,0x00,0x11,0x29,0x03,0x87,0x2d,0x19,0x00,0x21,
+0x00,0x00,0x00,0x15,0x1f,0x06,0x01,0x65,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x73,
+0x65,0x74,0x5f,0x63,0x74,0x78,0x28,0x6b,0x2c,0x76,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x6b,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x76,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x0a,
+0x64,0x6f,0x5f,0x73,0x65,0x74,0x5f,0x63,0x74,0x78,0x00,0x00,0x23,0x02,0x00,0x00,
+0x1f,0x07,0x01,0x66,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6b,0x2e,0x74,0x79,0x70,
+0x65,0x20,0x3d,0x3d,0x20,0x27,0x6e,0x61,0x6d,0x65,0x27,0x3a,0x00,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x02,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,
+0x09,0x02,0x00,0x03,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x03,0x00,0x00,0x00,0x04,
+0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,0x18,0x02,0x02,0x03,0x16,0x02,0x00,0x00,
+0x13,0x00,0x00,0xe5,0x1f,0x13,0x01,0x67,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x28,0x44,0x2e,0x5f,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x20,0x61,
+0x6e,0x64,0x20,0x6b,0x2e,0x76,0x61,0x6c,0x20,0x6e,0x6f,0x74,0x20,0x69,0x6e,0x20,
+0x44,0x2e,0x76,0x61,0x72,0x73,0x29,0x20,0x6f,0x72,0x20,0x28,0x6b,0x2e,0x76,0x61,
+0x6c,0x20,0x69,0x6e,0x20,0x44,0x2e,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x04,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x05,0x00,0x00,0x00,0x08,0x5f,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,
+0x00,0x00,0x00,0x00,0x09,0x02,0x02,0x03,0x00,0x00,0x00,0x01,0x16,0x02,0x00,0x00,
+0x13,0x00,0x00,0x10,0x0d,0x03,0x00,0x06,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,
+0x09,0x02,0x00,0x03,0x00,0x00,0x00,0x02,0x0e,0x03,0x00,0x04,0x00,0x00,0x00,0x01,
+0x44,0x00,0x00,0x00,0x0d,0x04,0x00,0x07,0x00,0x00,0x00,0x04,0x76,0x61,0x72,0x73,
+0x00,0x00,0x00,0x00,0x09,0x03,0x03,0x04,0x00,0x00,0x00,0x03,0x08,0x02,0x02,0x03,
+0x2f,0x02,0x00,0x00,0x13,0x00,0x00,0x10,0x0d,0x03,0x00,0x06,0x00,0x00,0x00,0x03,
+0x76,0x61,0x6c,0x00,0x09,0x02,0x00,0x03,0x00,0x00,0x00,0x04,0x0e,0x03,0x00,0x04,
+0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x04,0x00,0x08,0x00,0x00,0x00,0x07,
+0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x00,0x09,0x03,0x03,0x04,0x00,0x00,0x00,0x05,
+0x25,0x02,0x02,0x03,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x62,0x1f,0x0b,0x01,0x68,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,
+0x64,0x6f,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x28,0x6b,0x2e,0x61,0x73,0x5f,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x28,0x29,0x29,0x00,0x00,0x00,0x00,0x33,0x02,0x00,0x01,
+0x63,0x00,0x00,0x00,0x0e,0x04,0x00,0x09,0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,0x0d,0x08,0x00,0x0a,0x00,0x00,0x00,0x09,
+0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,0x38,0x06,0x00,0x08,
+0x00,0x00,0x00,0x06,0x39,0x05,0x06,0x02,0x37,0x02,0x04,0x02,0x1f,0x06,0x01,0x69,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x20,0x3d,0x20,
+0x64,0x6f,0x28,0x76,0x29,0x00,0x00,0x00,0x33,0x03,0x00,0x01,0x62,0x00,0x00,0x00,
+0x0e,0x05,0x00,0x0b,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x10,0x06,0x01,0x00,
+0x37,0x03,0x05,0x02,0x1f,0x07,0x01,0x6a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x28,0x47,0x53,0x45,0x54,0x2c,0x63,0x2c,
+0x62,0x29,0x00,0x00,0x0e,0x05,0x00,0x0c,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,
+0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x0d,0x00,0x00,0x00,0x04,0x47,0x53,0x45,0x54,
+0x00,0x00,0x00,0x00,0x10,0x07,0x02,0x00,0x10,0x08,0x03,0x00,0x37,0x04,0x05,0x04,
+0x1f,0x06,0x01,0x6b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x63,0x29,0x00,0x0e,0x05,0x00,0x0e,
+0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x10,0x06,0x02,0x00,0x37,0x04,0x05,0x02,0x1f,0x06,0x01,0x6c,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x28,0x62,0x29,0x00,0x0e,0x05,0x00,0x0e,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x06,0x03,0x00,0x37,0x04,0x05,0x02,
+0x1f,0x05,0x01,0x6d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x00,0x00,0x1d,0x04,0x00,0x00,0x15,0x04,0x00,0x00,
+0x1f,0x06,0x01,0x6e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x20,0x3d,0x20,
+0x64,0x6f,0x5f,0x6c,0x6f,0x63,0x61,0x6c,0x28,0x6b,0x29,0x00,0x33,0x04,0x00,0x01,
+0x61,0x00,0x00,0x00,0x0e,0x06,0x00,0x0f,0x00,0x00,0x00,0x08,0x64,0x6f,0x5f,0x6c,
+0x6f,0x63,0x61,0x6c,0x00,0x00,0x00,0x00,0x10,0x07,0x00,0x00,0x37,0x04,0x06,0x02,
+0x1f,0x05,0x01,0x6f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x20,0x3d,0x20,
+0x64,0x6f,0x28,0x76,0x29,0x00,0x00,0x00,0x0e,0x06,0x00,0x0b,0x00,0x00,0x00,0x02,
+0x64,0x6f,0x00,0x00,0x10,0x07,0x01,0x00,0x37,0x03,0x06,0x02,0x1f,0x06,0x01,0x70,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x28,0x4d,0x4f,0x56,
+0x45,0x2c,0x61,0x2c,0x62,0x29,0x00,0x00,0x0e,0x06,0x00,0x0c,0x00,0x00,0x00,0x04,
+0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0e,0x07,0x00,0x10,0x00,0x00,0x00,0x04,
+0x4d,0x4f,0x56,0x45,0x00,0x00,0x00,0x00,0x10,0x08,0x04,0x00,0x10,0x09,0x03,0x00,
+0x37,0x05,0x06,0x04,0x1f,0x05,0x01,0x71,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x62,0x29,0x00,0x0e,0x06,0x00,0x0e,
+0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x10,0x07,0x03,0x00,0x37,0x05,0x06,0x02,0x1f,0x05,0x01,0x72,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x00,0x00,0x00,0x00,
+0x15,0x04,0x00,0x00,0x1f,0x0a,0x01,0x73,0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,
+0x20,0x6b,0x2e,0x74,0x79,0x70,0x65,0x20,0x69,0x6e,0x20,0x28,0x27,0x74,0x75,0x70,
+0x6c,0x65,0x27,0x2c,0x27,0x6c,0x69,0x73,0x74,0x27,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x0d,0x06,0x00,0x02,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,
+0x09,0x05,0x00,0x06,0x00,0x00,0x00,0x07,0x0d,0x07,0x00,0x11,0x00,0x00,0x00,0x05,
+0x74,0x75,0x70,0x6c,0x65,0x00,0x00,0x00,0x0d,0x08,0x00,0x12,0x00,0x00,0x00,0x04,
+0x6c,0x69,0x73,0x74,0x00,0x00,0x00,0x00,0x1c,0x06,0x07,0x02,0x25,0x05,0x05,0x06,
+0x16,0x05,0x00,0x00,0x13,0x00,0x01,0xe8,0x1f,0x0a,0x01,0x74,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x76,0x2e,0x74,0x79,0x70,0x65,0x20,0x69,0x6e,
+0x20,0x28,0x27,0x74,0x75,0x70,0x6c,0x65,0x27,0x2c,0x27,0x6c,0x69,0x73,0x74,0x27,
+0x29,0x3a,0x00,0x00,0x0d,0x06,0x00,0x02,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,
+0x00,0x00,0x00,0x00,0x09,0x05,0x01,0x06,0x00,0x00,0x00,0x08,0x0d,0x07,0x00,0x11,
+0x00,0x00,0x00,0x05,0x74,0x75,0x70,0x6c,0x65,0x00,0x00,0x00,0x0d,0x08,0x00,0x12,
+0x00,0x00,0x00,0x04,0x6c,0x69,0x73,0x74,0x00,0x00,0x00,0x00,0x1c,0x06,0x07,0x02,
+0x25,0x05,0x05,0x06,0x16,0x05,0x00,0x00,0x13,0x00,0x01,0x17,0x1f,0x07,0x01,0x75,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x2c,0x74,0x6d,
+0x70,0x73,0x20,0x3d,0x20,0x30,0x2c,0x5b,0x5d,0x00,0x00,0x00,0x0c,0x05,0x00,0x13,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x1c,0x06,0x00,0x00,0x33,0x07,0x00,0x01,
+0x6e,0x00,0x00,0x00,0x10,0x07,0x05,0x00,0x33,0x05,0x00,0x04,0x74,0x6d,0x70,0x73,
+0x00,0x00,0x00,0x00,0x10,0x05,0x06,0x00,0x1f,0x08,0x01,0x76,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x6b,0x6b,0x20,0x69,
+0x6e,0x20,0x6b,0x2e,0x69,0x74,0x65,0x6d,0x73,0x3a,0x00,0x00,0x0d,0x09,0x00,0x14,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x08,0x00,0x09,
+0x00,0x00,0x00,0x09,0x0c,0x09,0x00,0x13,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x2b,0x06,0x08,0x09,0x13,0x00,0x00,0x74,0x33,0x02,0x00,0x02,0x6b,0x6b,0x00,0x00,
+0x10,0x02,0x06,0x00,0x1f,0x08,0x01,0x77,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x76,0x20,0x3d,0x20,0x76,0x2e,0x69,
+0x74,0x65,0x6d,0x73,0x5b,0x6e,0x5d,0x00,0x33,0x06,0x00,0x02,0x76,0x76,0x00,0x00,
+0x0d,0x02,0x00,0x14,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x09,0x03,0x01,0x02,0x00,0x00,0x00,0x0a,0x0a,0x06,0x03,0x07,0x1f,0x0d,0x01,0x78,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x74,0x6d,0x70,0x20,0x3d,0x20,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x28,0x29,0x3b,
+0x20,0x74,0x6d,0x70,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x74,0x6d,0x70,
+0x29,0x00,0x00,0x00,0x33,0x03,0x00,0x03,0x74,0x6d,0x70,0x00,0x0e,0x0a,0x00,0x15,
+0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x00,0x37,0x03,0x0a,0x01,
+0x0d,0x0d,0x00,0x16,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x0a,0x05,0x0d,0x00,0x00,0x00,0x0b,0x10,0x0c,0x03,0x00,0x39,0x02,0x0a,0x03,
+0x1f,0x07,0x01,0x79,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x64,0x6f,0x28,0x76,0x76,0x29,0x00,0x00,
+0x33,0x02,0x00,0x01,0x72,0x00,0x00,0x00,0x0e,0x0b,0x00,0x0b,0x00,0x00,0x00,0x02,
+0x64,0x6f,0x00,0x00,0x10,0x0c,0x06,0x00,0x37,0x02,0x0b,0x02,0x1f,0x09,0x01,0x7a,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x63,0x6f,0x64,0x65,0x28,0x4d,0x4f,0x56,0x45,0x2c,0x74,0x6d,0x70,0x2c,0x72,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x0b,0x00,0x0c,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,
+0x00,0x00,0x00,0x00,0x0e,0x0c,0x00,0x10,0x00,0x00,0x00,0x04,0x4d,0x4f,0x56,0x45,
+0x00,0x00,0x00,0x00,0x10,0x0d,0x03,0x00,0x10,0x0e,0x02,0x00,0x37,0x0a,0x0b,0x04,
+0x1f,0x09,0x01,0x7b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x72,0x29,0x20,
+0x23,0x52,0x45,0x47,0x00,0x00,0x00,0x00,0x0e,0x0b,0x00,0x0e,0x00,0x00,0x00,0x08,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x0c,0x02,0x00,
+0x37,0x0a,0x0b,0x02,0x1f,0x06,0x01,0x7c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x2b,0x3d,0x31,0x00,0x00,0x00,0x00,
+0x0c,0x0b,0x00,0x17,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x07,0x07,0x0b,
+0x13,0x00,0xff,0x8c,0x1f,0x05,0x01,0x7d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6e,0x20,0x3d,0x20,0x30,0x00,0x00,0x00,0x0c,0x08,0x00,0x13,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x10,0x07,0x08,0x00,0x1f,0x08,0x01,0x7e,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,
+0x6b,0x6b,0x20,0x69,0x6e,0x20,0x6b,0x2e,0x69,0x74,0x65,0x6d,0x73,0x3a,0x00,0x00,
+0x0d,0x0a,0x00,0x14,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x09,0x09,0x00,0x0a,0x00,0x00,0x00,0x0c,0x0c,0x0a,0x00,0x13,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x2b,0x08,0x09,0x0a,0x13,0x00,0x00,0x57,0x10,0x02,0x08,0x00,
+0x1f,0x08,0x01,0x7f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x76,0x76,0x20,0x3d,0x20,0x76,0x2e,0x69,0x74,0x65,0x6d,0x73,
+0x5b,0x6e,0x5d,0x00,0x0d,0x0b,0x00,0x14,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x09,0x08,0x01,0x0b,0x00,0x00,0x00,0x0d,0x0a,0x06,0x08,0x07,
+0x1f,0x08,0x01,0x80,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x74,0x6d,0x70,0x20,0x3d,0x20,0x74,0x6d,0x70,0x73,0x5b,0x6e,
+0x5d,0x00,0x00,0x00,0x0a,0x03,0x05,0x07,0x1f,0x12,0x01,0x81,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x28,0x64,0x6f,0x5f,0x73,0x65,0x74,0x5f,0x63,0x74,0x78,0x28,
+0x6b,0x6b,0x2c,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x76,0x76,0x2e,0x70,0x6f,0x73,0x2c,
+0x27,0x72,0x65,0x67,0x27,0x2c,0x74,0x6d,0x70,0x29,0x29,0x29,0x20,0x23,0x52,0x45,
+0x47,0x00,0x00,0x00,0x0e,0x0b,0x00,0x0e,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x0e,0x0d,0x00,0x01,0x00,0x00,0x00,0x0a,
+0x64,0x6f,0x5f,0x73,0x65,0x74,0x5f,0x63,0x74,0x78,0x00,0x00,0x10,0x0e,0x02,0x00,
+0x0e,0x10,0x00,0x18,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x0d,0x14,0x00,0x19,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x11,0x06,0x14,
+0x00,0x00,0x00,0x0e,0x0d,0x12,0x00,0x1a,0x00,0x00,0x00,0x03,0x72,0x65,0x67,0x00,
+0x10,0x13,0x03,0x00,0x37,0x0f,0x10,0x04,0x37,0x0c,0x0d,0x03,0x37,0x08,0x0b,0x02,
+0x1f,0x06,0x01,0x82,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6e,0x20,0x2b,0x3d,0x20,0x31,0x00,0x00,0x0c,0x0b,0x00,0x17,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x08,0x07,0x0b,0x10,0x07,0x08,0x00,
+0x13,0x00,0xff,0xa9,0x1f,0x05,0x01,0x83,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x00,0x00,0x1d,0x08,0x00,0x00,
+0x15,0x08,0x00,0x00,0x1f,0x08,0x01,0x85,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x72,0x20,0x3d,0x20,0x64,0x6f,0x28,0x76,0x29,0x3b,0x20,0x75,0x6e,0x5f,0x74,0x6d,
+0x70,0x28,0x72,0x29,0x00,0x00,0x00,0x00,0x0e,0x0a,0x00,0x0b,0x00,0x00,0x00,0x02,
+0x64,0x6f,0x00,0x00,0x10,0x0b,0x01,0x00,0x37,0x02,0x0a,0x02,0x0e,0x0a,0x00,0x1b,
+0x00,0x00,0x00,0x06,0x75,0x6e,0x5f,0x74,0x6d,0x70,0x00,0x00,0x10,0x0b,0x02,0x00,
+0x37,0x08,0x0a,0x02,0x1f,0x0b,0x01,0x86,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6e,0x2c,0x20,0x74,0x6d,0x70,0x20,0x3d,0x20,0x30,0x2c,0x20,0x54,0x6f,0x6b,0x65,
+0x6e,0x28,0x76,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x72,0x65,0x67,0x27,0x2c,0x72,0x29,
+0x00,0x00,0x00,0x00,0x0c,0x08,0x00,0x13,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0e,0x0b,0x00,0x18,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x0d,0x0f,0x00,0x19,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x0c,0x01,0x0f,
+0x00,0x00,0x00,0x0f,0x0d,0x0d,0x00,0x1a,0x00,0x00,0x00,0x03,0x72,0x65,0x67,0x00,
+0x10,0x0e,0x02,0x00,0x37,0x09,0x0b,0x04,0x10,0x07,0x08,0x00,0x10,0x03,0x09,0x00,
+0x1f,0x07,0x01,0x87,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,
+0x74,0x74,0x20,0x69,0x6e,0x20,0x6b,0x2e,0x69,0x74,0x65,0x6d,0x73,0x3a,0x00,0x00,
+0x0d,0x0a,0x00,0x14,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x09,0x09,0x00,0x0a,0x00,0x00,0x00,0x10,0x0c,0x0a,0x00,0x13,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x2b,0x08,0x09,0x0a,0x13,0x00,0x00,0x5b,0x33,0x0b,0x00,0x02,
+0x74,0x74,0x00,0x00,0x10,0x0b,0x08,0x00,0x1f,0x1b,0x01,0x88,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x28,0x64,0x6f,0x5f,0x73,0x65,0x74,0x5f,0x63,0x74,0x78,0x28,0x74,0x74,0x2c,0x54,
+0x6f,0x6b,0x65,0x6e,0x28,0x74,0x6d,0x70,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x67,0x65,
+0x74,0x27,0x2c,0x4e,0x6f,0x6e,0x65,0x2c,0x5b,0x74,0x6d,0x70,0x2c,0x54,0x6f,0x6b,
+0x65,0x6e,0x28,0x74,0x6d,0x70,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x69,0x6e,0x74,0x65,
+0x67,0x65,0x72,0x27,0x2c,0x73,0x74,0x72,0x28,0x6e,0x29,0x29,0x5d,0x29,0x29,0x29,
+0x20,0x23,0x52,0x45,0x47,0x00,0x00,0x00,0x0e,0x0c,0x00,0x0e,0x00,0x00,0x00,0x08,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x0e,0x0e,0x00,0x01,
+0x00,0x00,0x00,0x0a,0x64,0x6f,0x5f,0x73,0x65,0x74,0x5f,0x63,0x74,0x78,0x00,0x00,
+0x10,0x0f,0x0b,0x00,0x0e,0x11,0x00,0x18,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x0d,0x00,0x00,0x19,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,
+0x09,0x12,0x03,0x00,0x00,0x00,0x00,0x11,0x0d,0x13,0x00,0x1c,0x00,0x00,0x00,0x03,
+0x67,0x65,0x74,0x00,0x1d,0x14,0x00,0x00,0x10,0x00,0x03,0x00,0x0e,0x15,0x00,0x18,
+0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0d,0x06,0x00,0x19,
+0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x16,0x03,0x06,0x00,0x00,0x00,0x12,
+0x0d,0x17,0x00,0x1d,0x00,0x00,0x00,0x07,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x00,
+0x0e,0x06,0x00,0x1e,0x00,0x00,0x00,0x03,0x73,0x74,0x72,0x00,0x37,0x18,0x06,0x02,
+0x37,0x01,0x15,0x04,0x1c,0x15,0x00,0x02,0x37,0x10,0x11,0x05,0x37,0x0d,0x0e,0x03,
+0x37,0x08,0x0c,0x02,0x1f,0x05,0x01,0x89,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6e,0x20,0x2b,0x3d,0x20,0x31,0x00,0x00,0x0c,0x0c,0x00,0x17,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x08,0x07,0x0c,0x10,0x07,0x08,0x00,
+0x13,0x00,0xff,0xa5,0x1f,0x05,0x01,0x8a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x66,0x72,0x65,0x65,0x5f,0x72,0x65,0x67,0x28,0x72,0x29,0x00,0x0e,0x0c,0x00,0x1f,
+0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x72,0x65,0x67,0x00,0x00,0x00,0x00,
+0x10,0x0d,0x02,0x00,0x37,0x08,0x0c,0x02,0x1f,0x04,0x01,0x8b,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x00,0x00,0x1d,0x08,0x00,0x00,
+0x15,0x08,0x00,0x00,0x1f,0x06,0x01,0x8d,0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,
+0x64,0x6f,0x28,0x6b,0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x29,0x00,0x00,
+0x0e,0x0c,0x00,0x0b,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x0d,0x09,0x00,0x14,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x0d,0x00,0x09,
+0x00,0x00,0x00,0x13,0x0c,0x09,0x00,0x13,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x0d,0x0d,0x09,0x37,0x02,0x0c,0x02,0x1f,0x04,0x01,0x8e,0x20,0x20,0x20,0x20,
+0x72,0x72,0x20,0x3d,0x20,0x64,0x6f,0x28,0x76,0x29,0x00,0x00,0x33,0x08,0x00,0x02,
+0x72,0x72,0x00,0x00,0x0e,0x0c,0x00,0x0b,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,
+0x10,0x0d,0x01,0x00,0x37,0x08,0x0c,0x02,0x1f,0x07,0x01,0x8f,0x20,0x20,0x20,0x20,
+0x74,0x6d,0x70,0x20,0x3d,0x20,0x64,0x6f,0x28,0x6b,0x2e,0x69,0x74,0x65,0x6d,0x73,
+0x5b,0x31,0x5d,0x29,0x00,0x00,0x00,0x00,0x0e,0x0c,0x00,0x0b,0x00,0x00,0x00,0x02,
+0x64,0x6f,0x00,0x00,0x0d,0x0a,0x00,0x14,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x09,0x0d,0x00,0x0a,0x00,0x00,0x00,0x14,0x0c,0x0a,0x00,0x17,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x0d,0x0d,0x0a,0x37,0x03,0x0c,0x02,
+0x1f,0x06,0x01,0x90,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x28,0x53,0x45,0x54,
+0x2c,0x72,0x2c,0x74,0x6d,0x70,0x2c,0x72,0x72,0x29,0x00,0x00,0x0e,0x0c,0x00,0x0c,
+0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0e,0x0d,0x00,0x20,
+0x00,0x00,0x00,0x03,0x53,0x45,0x54,0x00,0x10,0x0e,0x02,0x00,0x10,0x0f,0x03,0x00,
+0x10,0x10,0x08,0x00,0x37,0x09,0x0c,0x05,0x1f,0x06,0x01,0x91,0x20,0x20,0x20,0x20,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x72,0x29,0x20,0x23,0x52,0x45,0x47,
+0x00,0x00,0x00,0x00,0x0e,0x0c,0x00,0x0e,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x0d,0x02,0x00,0x37,0x09,0x0c,0x02,
+0x1f,0x06,0x01,0x92,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x28,0x74,0x6d,0x70,0x29,0x20,0x23,0x52,0x45,0x47,0x00,0x00,0x0e,0x0c,0x00,0x0e,
+0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x10,0x0d,0x03,0x00,0x37,0x09,0x0c,0x02,0x1f,0x04,0x01,0x93,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x72,0x00,0x00,0x00,0x15,0x08,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x2a,0x00,0x4f,0x00,0x00,0x00,0x0a,0x64,0x6f,0x5f,0x73,
+0x65,0x74,0x5f,0x63,0x74,0x78,0x00,0x00,0x0f,0x2a,0x29,0x00,0x1f,0x09,0x01,0x95,
+0x64,0x65,0x66,0x20,0x6d,0x61,0x6e,0x61,0x67,0x65,0x5f,0x73,0x65,0x71,0x28,0x69,
+0x2c,0x61,0x2c,0x69,0x74,0x65,0x6d,0x73,0x2c,0x73,0x61,0x76,0x3d,0x30,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x2a,0x00,0x05,0x2a,0x24,0x33,0x37,0x39,0x00,0x00,0x00,
+0x0d,0x2f,0x00,0x15,0x00,0x00,0x00,0x01,0x69,0x00,0x00,0x00,0x0d,0x30,0x00,0x16,
+0x00,0x00,0x00,0x01,0x61,0x00,0x00,0x00,0x0d,0x31,0x00,0x30,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x0d,0x32,0x00,0x50,0x00,0x00,0x00,0x03,
+0x73,0x61,0x76,0x00,0x1c,0x2b,0x2f,0x04,0x0c,0x2f,0x00,0x19,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x1c,0x2c,0x2f,0x01,0x1d,0x2d,0x00,0x00,0x1d,0x2e,0x00,0x00,
+0x11,0x2a,0x01,0x11,0x2d,0x0f,0x00,0x0c,0x00,0x00,0x00,0x00,0x1f,0x09,0x01,0x95,
+0x64,0x65,0x66,0x20,0x6d,0x61,0x6e,0x61,0x67,0x65,0x5f,0x73,0x65,0x71,0x28,0x69,
+0x2c,0x61,0x2c,0x69,0x74,0x65,0x6d,0x73,0x2c,0x73,0x61,0x76,0x3d,0x30,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x69,0x00,0x00,0x00,0x33,0x01,0x00,0x01,
+0x61,0x00,0x00,0x00,0x33,0x02,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x33,0x03,0x00,0x03,0x73,0x61,0x76,0x00,0x0d,0x04,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x04,0x00,0x00,
+0x0d,0x04,0x00,0x01,0x00,0x00,0x00,0x0a,0x6d,0x61,0x6e,0x61,0x67,0x65,0x5f,0x73,
+0x65,0x71,0x00,0x00,0x23,0x04,0x00,0x00,0x1f,0x07,0x01,0x96,0x20,0x20,0x20,0x20,
+0x6c,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x73,0x61,0x76,0x2c,0x6c,0x65,0x6e,0x28,
+0x69,0x74,0x65,0x6d,0x73,0x29,0x29,0x00,0x33,0x04,0x00,0x01,0x6c,0x00,0x00,0x00,
+0x0e,0x04,0x00,0x02,0x00,0x00,0x00,0x03,0x6d,0x61,0x78,0x00,0x10,0x05,0x03,0x00,
+0x0e,0x07,0x00,0x03,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x10,0x08,0x02,0x00,
+0x37,0x06,0x07,0x02,0x37,0x04,0x04,0x03,0x1f,0x07,0x01,0x97,0x20,0x20,0x20,0x20,
+0x6e,0x2c,0x74,0x6d,0x70,0x73,0x20,0x3d,0x20,0x30,0x2c,0x67,0x65,0x74,0x5f,0x74,
+0x6d,0x70,0x73,0x28,0x6c,0x29,0x00,0x00,0x0c,0x09,0x00,0x04,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x05,0x00,0x00,0x00,0x08,0x67,0x65,0x74,0x5f,
+0x74,0x6d,0x70,0x73,0x00,0x00,0x00,0x00,0x10,0x07,0x04,0x00,0x37,0x04,0x06,0x02,
+0x33,0x05,0x00,0x01,0x6e,0x00,0x00,0x00,0x10,0x05,0x09,0x00,0x33,0x09,0x00,0x04,
+0x74,0x6d,0x70,0x73,0x00,0x00,0x00,0x00,0x10,0x09,0x04,0x00,0x1f,0x06,0x01,0x98,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x74,0x74,0x20,0x69,0x6e,0x20,0x69,0x74,
+0x65,0x6d,0x73,0x3a,0x00,0x00,0x00,0x00,0x0c,0x06,0x00,0x04,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x2b,0x04,0x02,0x06,0x13,0x00,0x00,0x50,0x33,0x07,0x00,0x02,
+0x74,0x74,0x00,0x00,0x10,0x07,0x04,0x00,0x1f,0x05,0x01,0x99,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x74,0x6d,0x70,0x73,0x5b,0x6e,0x5d,0x00,
+0x33,0x04,0x00,0x01,0x72,0x00,0x00,0x00,0x0a,0x04,0x09,0x05,0x1f,0x06,0x01,0x9a,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x20,0x3d,0x20,0x64,0x6f,0x28,0x74,
+0x74,0x2c,0x72,0x29,0x00,0x00,0x00,0x00,0x33,0x08,0x00,0x01,0x62,0x00,0x00,0x00,
+0x0e,0x0b,0x00,0x06,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x10,0x0c,0x07,0x00,
+0x10,0x0d,0x04,0x00,0x37,0x08,0x0b,0x03,0x1f,0x05,0x01,0x9b,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x72,0x20,0x21,0x3d,0x20,0x62,0x3a,0x00,0x00,
+0x24,0x0a,0x04,0x08,0x16,0x0a,0x00,0x00,0x13,0x00,0x00,0x22,0x1f,0x07,0x01,0x9c,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,
+0x28,0x4d,0x4f,0x56,0x45,0x2c,0x72,0x2c,0x62,0x29,0x00,0x00,0x0e,0x0b,0x00,0x07,
+0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0e,0x0c,0x00,0x08,
+0x00,0x00,0x00,0x04,0x4d,0x4f,0x56,0x45,0x00,0x00,0x00,0x00,0x10,0x0d,0x04,0x00,
+0x10,0x0e,0x08,0x00,0x37,0x0a,0x0b,0x04,0x1f,0x06,0x01,0x9d,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x28,0x62,0x29,0x00,0x0e,0x0b,0x00,0x09,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x0c,0x08,0x00,0x37,0x0a,0x0b,0x02,
+0x1f,0x04,0x01,0x9e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x20,0x2b,0x3d,
+0x31,0x00,0x00,0x00,0x0c,0x0b,0x00,0x0a,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x01,0x05,0x05,0x0b,0x13,0x00,0xff,0xb0,0x1f,0x06,0x01,0x9f,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x6e,0x6f,0x74,0x20,0x6c,0x65,0x6e,0x28,0x74,0x6d,0x70,0x73,0x29,
+0x3a,0x00,0x00,0x00,0x0e,0x0b,0x00,0x03,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,
+0x10,0x0c,0x09,0x00,0x37,0x0a,0x0b,0x02,0x2f,0x0a,0x00,0x00,0x13,0x00,0x00,0x1f,
+0x1f,0x06,0x01,0xa0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,
+0x28,0x69,0x2c,0x61,0x2c,0x30,0x2c,0x30,0x29,0x00,0x00,0x00,0x0e,0x0a,0x00,0x07,
+0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x10,0x0b,0x00,0x00,
+0x10,0x0c,0x01,0x00,0x0c,0x0d,0x00,0x04,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0c,0x0e,0x00,0x04,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x37,0x06,0x0a,0x05,
+0x1f,0x05,0x01,0xa1,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x30,0x00,0x00,0x00,0x00,0x0c,0x06,0x00,0x04,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x15,0x06,0x00,0x00,0x1f,0x09,0x01,0xa2,0x20,0x20,0x20,0x20,
+0x63,0x6f,0x64,0x65,0x28,0x69,0x2c,0x61,0x2c,0x74,0x6d,0x70,0x73,0x5b,0x30,0x5d,
+0x2c,0x6c,0x65,0x6e,0x28,0x69,0x74,0x65,0x6d,0x73,0x29,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x0a,0x00,0x07,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,
+0x10,0x0b,0x00,0x00,0x10,0x0c,0x01,0x00,0x0c,0x01,0x00,0x04,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x0d,0x09,0x01,0x0e,0x01,0x00,0x03,0x00,0x00,0x00,0x03,
+0x6c,0x65,0x6e,0x00,0x37,0x0e,0x01,0x02,0x37,0x06,0x0a,0x05,0x1f,0x07,0x01,0xa3,
+0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x73,0x28,0x74,0x6d,
+0x70,0x73,0x5b,0x73,0x61,0x76,0x3a,0x5d,0x29,0x00,0x00,0x00,0x0e,0x0a,0x00,0x0b,
+0x00,0x00,0x00,0x09,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x73,0x00,0x00,0x00,
+0x10,0x0d,0x03,0x00,0x1d,0x0e,0x00,0x00,0x1c,0x0c,0x0d,0x02,0x0a,0x0b,0x09,0x0c,
+0x37,0x06,0x0a,0x02,0x1f,0x05,0x01,0xa4,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x74,0x6d,0x70,0x73,0x5b,0x30,0x5d,0x00,0x00,0x0c,0x0a,0x00,0x04,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x06,0x09,0x0a,0x15,0x06,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x2b,0x00,0x51,0x00,0x00,0x00,0x0a,0x6d,0x61,0x6e,0x61,
+0x67,0x65,0x5f,0x73,0x65,0x71,0x00,0x00,0x0f,0x2b,0x2a,0x00,0x1f,0x06,0x01,0xa6,
+0x64,0x65,0x66,0x20,0x70,0x5f,0x66,0x69,0x6c,0x74,0x65,0x72,0x28,0x69,0x74,0x65,
+0x6d,0x73,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x2b,0x00,0x05,0x2a,0x24,0x33,0x39,
+0x30,0x00,0x00,0x00,0x0d,0x30,0x00,0x30,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x1c,0x2c,0x30,0x01,0x1c,0x2d,0x00,0x00,0x1d,0x2e,0x00,0x00,
+0x1d,0x2f,0x00,0x00,0x11,0x2b,0x01,0x07,0x2d,0x0c,0x00,0x0b,0x00,0x00,0x00,0x06,
+0x1f,0x06,0x01,0xa6,0x64,0x65,0x66,0x20,0x70,0x5f,0x66,0x69,0x6c,0x74,0x65,0x72,
+0x28,0x69,0x74,0x65,0x6d,0x73,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x08,0x70,0x5f,0x66,0x69,0x6c,0x74,0x65,0x72,
+0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x09,0x01,0xa7,0x20,0x20,0x20,0x20,
+0x22,0x22,0x22,0x20,0x73,0x70,0x6c,0x69,0x74,0x20,0x69,0x74,0x65,0x6d,0x73,0x20,
+0x74,0x6f,0x20,0x70,0x2c,0x20,0x6e,0x2c,0x20,0x6c,0x2c,0x20,0x64,0x2e,0x00,0x00,
+0x0d,0x01,0x00,0x02,0x00,0x00,0x00,0xce,0x20,0x73,0x70,0x6c,0x69,0x74,0x20,0x69,
+0x74,0x65,0x6d,0x73,0x20,0x74,0x6f,0x20,0x70,0x2c,0x20,0x6e,0x2c,0x20,0x6c,0x2c,
+0x20,0x64,0x2e,0x0a,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x65,0x78,0x61,
+0x6d,0x70,0x6c,0x65,0x3a,0x20,0x28,0x31,0x2c,0x20,0x61,0x3d,0x31,0x2c,0x20,0x2a,
+0x61,0x72,0x67,0x73,0x2c,0x20,0x2a,0x2a,0x6b,0x77,0x61,0x72,0x67,0x73,0x29,0x0a,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x3a,0x20,0x5b,0x31,0x5d,0x20,0x20,
+0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x61,0x6c,0x29,0x0a,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x6e,0x3a,0x20,0x5b,0x61,0x3d,0x31,0x5d,0x20,0x28,0x6e,
+0x61,0x6d,0x65,0x64,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x3a,
+0x20,0x61,0x72,0x67,0x73,0x20,0x20,0x20,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+0x6e,0x61,0x6c,0x2c,0x20,0x62,0x79,0x20,0x6c,0x69,0x73,0x74,0x29,0x0a,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x3a,0x20,0x6b,0x77,0x61,0x72,0x67,0x73,0x20,
+0x20,0x28,0x6e,0x61,0x6d,0x65,0x64,0x2c,0x20,0x62,0x79,0x20,0x64,0x69,0x63,0x74,
+0x29,0x0a,0x20,0x20,0x20,0x20,0x00,0x00,0x1f,0x08,0x01,0xaf,0x20,0x20,0x20,0x20,
+0x70,0x2c,0x6e,0x2c,0x6c,0x2c,0x64,0x20,0x3d,0x20,0x5b,0x5d,0x2c,0x5b,0x5d,0x2c,
+0x4e,0x6f,0x6e,0x65,0x2c,0x4e,0x6f,0x6e,0x65,0x00,0x00,0x00,0x1c,0x01,0x00,0x00,
+0x1c,0x02,0x00,0x00,0x1d,0x03,0x00,0x00,0x1d,0x04,0x00,0x00,0x33,0x05,0x00,0x01,
+0x70,0x00,0x00,0x00,0x10,0x05,0x01,0x00,0x33,0x01,0x00,0x01,0x6e,0x00,0x00,0x00,
+0x10,0x01,0x02,0x00,0x33,0x02,0x00,0x01,0x6c,0x00,0x00,0x00,0x10,0x02,0x03,0x00,
+0x33,0x03,0x00,0x01,0x64,0x00,0x00,0x00,0x10,0x03,0x04,0x00,0x1f,0x05,0x01,0xb0,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x74,0x20,0x69,0x6e,0x20,0x69,0x74,0x65,
+0x6d,0x73,0x3a,0x00,0x0c,0x06,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x2b,0x04,0x00,0x06,0x13,0x00,0x00,0x7a,0x33,0x07,0x00,0x01,0x74,0x00,0x00,0x00,
+0x10,0x07,0x04,0x00,0x1f,0x0f,0x01,0xb1,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x74,0x2e,0x74,0x79,0x70,0x65,0x20,0x3d,0x3d,0x20,0x27,0x73,0x79,
+0x6d,0x62,0x6f,0x6c,0x27,0x20,0x61,0x6e,0x64,0x20,0x74,0x2e,0x76,0x61,0x6c,0x20,
+0x3d,0x3d,0x20,0x27,0x3d,0x27,0x3a,0x20,0x6e,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,
+0x28,0x74,0x29,0x00,0x0d,0x08,0x00,0x04,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,
+0x00,0x00,0x00,0x00,0x09,0x04,0x07,0x08,0x00,0x00,0x00,0x00,0x0d,0x08,0x00,0x05,
+0x00,0x00,0x00,0x06,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x00,0x00,0x18,0x04,0x04,0x08,
+0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x0a,0x0d,0x08,0x00,0x06,0x00,0x00,0x00,0x03,
+0x76,0x61,0x6c,0x00,0x09,0x04,0x07,0x08,0x00,0x00,0x00,0x01,0x0d,0x08,0x00,0x07,
+0x00,0x00,0x00,0x01,0x3d,0x00,0x00,0x00,0x18,0x04,0x04,0x08,0x16,0x04,0x00,0x00,
+0x13,0x00,0x00,0x0a,0x0d,0x0b,0x00,0x08,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x08,0x01,0x0b,0x00,0x00,0x00,0x02,0x10,0x0a,0x07,0x00,
+0x39,0x04,0x08,0x03,0x13,0x00,0xff,0xcb,0x1f,0x0a,0x01,0xb2,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x74,0x2e,0x74,0x79,0x70,0x65,0x20,
+0x3d,0x3d,0x20,0x27,0x6c,0x61,0x72,0x67,0x73,0x27,0x3a,0x20,0x6c,0x20,0x3d,0x20,
+0x74,0x00,0x00,0x00,0x0d,0x08,0x00,0x04,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,
+0x00,0x00,0x00,0x00,0x09,0x04,0x07,0x08,0x00,0x00,0x00,0x03,0x0d,0x08,0x00,0x09,
+0x00,0x00,0x00,0x05,0x6c,0x61,0x72,0x67,0x73,0x00,0x00,0x00,0x18,0x04,0x04,0x08,
+0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x03,0x10,0x02,0x07,0x00,0x13,0x00,0xff,0xb1,
+0x1f,0x0a,0x01,0xb3,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,
+0x20,0x74,0x2e,0x74,0x79,0x70,0x65,0x20,0x3d,0x3d,0x20,0x27,0x64,0x61,0x72,0x67,
+0x73,0x27,0x3a,0x20,0x64,0x20,0x3d,0x20,0x74,0x00,0x00,0x00,0x0d,0x08,0x00,0x04,
+0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x09,0x04,0x07,0x08,
+0x00,0x00,0x00,0x04,0x0d,0x08,0x00,0x0a,0x00,0x00,0x00,0x05,0x64,0x61,0x72,0x67,
+0x73,0x00,0x00,0x00,0x18,0x04,0x04,0x08,0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x03,
+0x10,0x03,0x07,0x00,0x13,0x00,0xff,0x97,0x1f,0x07,0x01,0xb4,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x3a,0x20,0x70,0x2e,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x28,0x74,0x29,0x00,0x00,0x00,0x0d,0x0b,0x00,0x08,0x00,0x00,0x00,0x06,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x08,0x05,0x0b,0x00,0x00,0x00,0x05,
+0x10,0x0a,0x07,0x00,0x39,0x04,0x08,0x03,0x13,0x00,0xff,0x86,0x1f,0x05,0x01,0xb5,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x70,0x2c,0x6e,0x2c,0x6c,
+0x2c,0x64,0x00,0x00,0x10,0x08,0x05,0x00,0x10,0x09,0x01,0x00,0x10,0x0a,0x02,0x00,
+0x10,0x0b,0x03,0x00,0x1c,0x04,0x08,0x04,0x15,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x2c,0x00,0x52,0x00,0x00,0x00,0x08,0x70,0x5f,0x66,0x69,0x6c,0x74,0x65,0x72,
+0x00,0x00,0x00,0x00,0x0f,0x2c,0x2b,0x00,0x1f,0x05,0x01,0xb7,0x64,0x65,0x66,0x20,
+0x64,0x6f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,0x28,0x74,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x2c,0x00,0x05,0x2a,0x24,0x33,0x39,0x37,0x00,0x00,0x00,0x0d,0x31,0x00,0x21,
+0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x1c,0x2d,0x31,0x01,0x1c,0x2e,0x00,0x00,
+0x1d,0x2f,0x00,0x00,0x1d,0x30,0x00,0x00,0x11,0x2c,0x01,0x11,0x2d,0x10,0x00,0x12,
+0x00,0x00,0x00,0x09,0x1f,0x05,0x01,0xb7,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x69,
+0x6d,0x70,0x6f,0x72,0x74,0x28,0x74,0x29,0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,
+0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,0x00,0x00,0x00,
+0x23,0x01,0x00,0x00,0x1f,0x07,0x01,0xb8,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6c,
+0x65,0x6e,0x28,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x29,0x20,0x3d,0x3d,0x20,0x31,
+0x3a,0x00,0x00,0x00,0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,
+0x0d,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x09,0x03,0x00,0x01,0x00,0x00,0x00,0x00,0x37,0x01,0x02,0x02,0x0c,0x02,0x00,0x04,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x18,0x01,0x01,0x02,0x16,0x01,0x00,0x00,
+0x13,0x00,0x00,0x20,0x1f,0x07,0x01,0xb9,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6d,0x6f,0x64,0x20,0x3d,0x20,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,
+0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x03,0x6d,0x6f,0x64,0x00,0x0d,0x03,0x00,0x03,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x02,0x00,0x03,
+0x00,0x00,0x00,0x01,0x0c,0x03,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x01,0x02,0x03,0x1f,0x05,0x01,0xba,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x6d,0x6f,0x64,0x00,0x00,0x33,0x02,0x00,0x04,
+0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,0x10,0x02,0x01,0x00,0x13,0x00,0x00,0x1a,
+0x1f,0x07,0x01,0xbc,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x6f,0x64,0x2c,
+0x20,0x6e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x00,
+0x0d,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x09,0x03,0x00,0x01,0x00,0x00,0x00,0x02,0x33,0x03,0x00,0x04,0x2a,0x24,0x31,0x30,
+0x00,0x00,0x00,0x00,0x0c,0x04,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x01,0x03,0x04,0x0c,0x04,0x00,0x04,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x02,0x03,0x04,0x1f,0x0b,0x01,0xbe,0x20,0x20,0x20,0x20,0x76,0x20,0x3d,0x20,
+0x64,0x6f,0x5f,0x63,0x61,0x6c,0x6c,0x28,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x2e,
+0x70,0x6f,0x73,0x2c,0x27,0x63,0x61,0x6c,0x6c,0x27,0x2c,0x4e,0x6f,0x6e,0x65,0x2c,
+0x5b,0x00,0x00,0x00,0x33,0x03,0x00,0x01,0x76,0x00,0x00,0x00,0x0e,0x04,0x00,0x06,
+0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x63,0x61,0x6c,0x6c,0x00,0x0e,0x06,0x00,0x07,
+0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0d,0x0a,0x00,0x08,
+0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x07,0x00,0x0a,0x00,0x00,0x00,0x03,
+0x0d,0x08,0x00,0x09,0x00,0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,
+0x1d,0x09,0x00,0x00,0x1f,0x0b,0x01,0xbf,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x6e,0x61,0x6d,
+0x65,0x27,0x2c,0x27,0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,0x5f,0x5f,0x27,0x29,
+0x2c,0x00,0x00,0x00,0x0e,0x0c,0x00,0x07,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x0d,0x03,0x00,0x08,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,
+0x09,0x0d,0x00,0x03,0x00,0x00,0x00,0x04,0x0d,0x0e,0x00,0x0a,0x00,0x00,0x00,0x04,
+0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,0x0d,0x0f,0x00,0x0b,0x00,0x00,0x00,0x0a,
+0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,0x5f,0x5f,0x00,0x00,0x37,0x0a,0x0c,0x04,
+0x1f,0x07,0x01,0xc0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x6f,0x64,0x2e,
+0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x28,0x29,0x2c,0x00,0x00,0x00,0x00,
+0x0d,0x0e,0x00,0x0c,0x00,0x00,0x00,0x09,0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x00,0x00,0x00,0x38,0x0c,0x01,0x0e,0x00,0x00,0x00,0x05,0x39,0x0b,0x0c,0x02,
+0x1f,0x0a,0x01,0xc1,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x54,0x6f,0x6b,0x65,
+0x6e,0x28,0x74,0x2e,0x70,0x6f,0x73,0x2c,0x20,0x27,0x73,0x79,0x6d,0x62,0x6f,0x6c,
+0x27,0x2c,0x20,0x27,0x4e,0x6f,0x6e,0x65,0x27,0x29,0x5d,0x00,0x0e,0x0c,0x00,0x07,
+0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0d,0x03,0x00,0x08,
+0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x0d,0x00,0x03,0x00,0x00,0x00,0x06,
+0x0d,0x0e,0x00,0x0d,0x00,0x00,0x00,0x06,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x00,0x00,
+0x0d,0x0f,0x00,0x0e,0x00,0x00,0x00,0x04,0x4e,0x6f,0x6e,0x65,0x00,0x00,0x00,0x00,
+0x37,0x0c,0x0c,0x04,0x1c,0x0a,0x0a,0x03,0x37,0x05,0x06,0x05,0x37,0x03,0x04,0x02,
+0x1f,0x08,0x01,0xc4,0x20,0x20,0x20,0x20,0x61,0x73,0x73,0x65,0x72,0x74,0x20,0x6e,
+0x61,0x6d,0x65,0x2e,0x74,0x79,0x70,0x65,0x20,0x3d,0x3d,0x20,0x27,0x6e,0x61,0x6d,
+0x65,0x27,0x00,0x00,0x0d,0x05,0x00,0x0f,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,
+0x00,0x00,0x00,0x00,0x09,0x04,0x02,0x05,0x00,0x00,0x00,0x07,0x0d,0x05,0x00,0x0a,
+0x00,0x00,0x00,0x04,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,0x18,0x01,0x04,0x05,
+0x17,0x01,0x04,0x05,0x1f,0x0b,0x01,0xc5,0x20,0x20,0x20,0x20,0x64,0x6f,0x5f,0x73,
+0x65,0x74,0x5f,0x63,0x74,0x78,0x28,0x6e,0x61,0x6d,0x65,0x2c,0x54,0x6f,0x6b,0x65,
+0x6e,0x28,0x74,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x72,0x65,0x67,0x27,0x2c,0x76,0x29,
+0x29,0x00,0x00,0x00,0x0e,0x04,0x00,0x10,0x00,0x00,0x00,0x0a,0x64,0x6f,0x5f,0x73,
+0x65,0x74,0x5f,0x63,0x74,0x78,0x00,0x00,0x10,0x05,0x02,0x00,0x0e,0x07,0x00,0x07,
+0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0d,0x0a,0x00,0x08,
+0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x08,0x00,0x0a,0x00,0x00,0x00,0x08,
+0x0d,0x09,0x00,0x11,0x00,0x00,0x00,0x03,0x72,0x65,0x67,0x00,0x10,0x0a,0x03,0x00,
+0x37,0x06,0x07,0x04,0x37,0x01,0x04,0x03,0x00,0x00,0x00,0x00,0x0d,0x2d,0x00,0x53,
+0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,0x00,0x00,0x00,
+0x0f,0x2d,0x2c,0x00,0x1f,0x04,0x01,0xc7,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x66,
+0x72,0x6f,0x6d,0x28,0x74,0x29,0x3a,0x00,0x33,0x2d,0x00,0x05,0x2a,0x24,0x34,0x30,
+0x34,0x00,0x00,0x00,0x0d,0x32,0x00,0x21,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x1c,0x2e,0x32,0x01,0x1c,0x2f,0x00,0x00,0x1d,0x30,0x00,0x00,0x1d,0x31,0x00,0x00,
+0x11,0x2d,0x02,0x25,0x2d,0x14,0x00,0x19,0x00,0x00,0x00,0x13,0x1f,0x04,0x01,0xc7,
+0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x66,0x72,0x6f,0x6d,0x28,0x74,0x29,0x3a,0x00,
+0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x66,0x72,0x6f,0x6d,0x00,
+0x23,0x01,0x00,0x00,0x1f,0x06,0x01,0xc8,0x20,0x20,0x20,0x20,0x6d,0x6f,0x64,0x20,
+0x3d,0x20,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x00,0x00,0x00,0x00,
+0x33,0x01,0x00,0x03,0x6d,0x6f,0x64,0x00,0x0d,0x02,0x00,0x02,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x03,0x00,0x02,0x00,0x00,0x00,0x00,
+0x0c,0x02,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x01,0x03,0x02,
+0x1f,0x06,0x01,0xc9,0x20,0x20,0x20,0x20,0x6e,0x61,0x6d,0x65,0x73,0x20,0x3d,0x20,
+0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,0x31,0x5d,0x00,0x00,0x33,0x03,0x00,0x05,
+0x6e,0x61,0x6d,0x65,0x73,0x00,0x00,0x00,0x0d,0x04,0x00,0x02,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x02,0x00,0x04,0x00,0x00,0x00,0x01,
+0x0c,0x04,0x00,0x04,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x03,0x02,0x04,
+0x1f,0x07,0x01,0xca,0x20,0x20,0x20,0x20,0x6d,0x6f,0x64,0x20,0x3d,0x20,0x6d,0x6f,
+0x64,0x2e,0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x28,0x29,0x00,0x00,0x00,
+0x0d,0x06,0x00,0x05,0x00,0x00,0x00,0x09,0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x00,0x00,0x00,0x38,0x04,0x01,0x06,0x00,0x00,0x00,0x02,0x39,0x01,0x04,0x02,
+0x1f,0x08,0x01,0xcc,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,0x61,0x6d,0x65,0x73,
+0x2e,0x74,0x79,0x70,0x65,0x20,0x3d,0x3d,0x20,0x27,0x6c,0x61,0x72,0x67,0x73,0x27,
+0x3a,0x00,0x00,0x00,0x0d,0x04,0x00,0x06,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,
+0x00,0x00,0x00,0x00,0x09,0x02,0x03,0x04,0x00,0x00,0x00,0x03,0x0d,0x04,0x00,0x07,
+0x00,0x00,0x00,0x05,0x6c,0x61,0x72,0x67,0x73,0x00,0x00,0x00,0x18,0x02,0x02,0x04,
+0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x29,0x1f,0x08,0x01,0xce,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,0x61,0x6d,0x65,0x73,0x2e,0x76,0x61,0x6c,
+0x20,0x3d,0x3d,0x20,0x27,0x2a,0x27,0x3a,0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x08,
+0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x09,0x02,0x03,0x04,0x00,0x00,0x00,0x04,
+0x0d,0x04,0x00,0x09,0x00,0x00,0x00,0x01,0x2a,0x00,0x00,0x00,0x18,0x02,0x02,0x04,
+0x16,0x02,0x00,0x00,0x13,0x00,0x01,0x0f,0x1f,0x0a,0x01,0xcf,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x61,0x6d,0x65,0x73,0x20,0x3d,0x20,
+0x6e,0x61,0x6d,0x65,0x73,0x2e,0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x28,
+0x29,0x00,0x00,0x00,0x0d,0x06,0x00,0x05,0x00,0x00,0x00,0x09,0x61,0x73,0x5f,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,0x38,0x04,0x03,0x06,0x00,0x00,0x00,0x05,
+0x39,0x03,0x04,0x02,0x13,0x00,0x00,0xfb,0x1f,0x08,0x01,0xd0,0x20,0x20,0x20,0x20,
+0x65,0x6c,0x69,0x66,0x20,0x6e,0x61,0x6d,0x65,0x73,0x2e,0x74,0x79,0x70,0x65,0x20,
+0x3d,0x3d,0x20,0x27,0x6e,0x61,0x6d,0x65,0x27,0x3a,0x00,0x00,0x0d,0x04,0x00,0x06,
+0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x09,0x02,0x03,0x04,
+0x00,0x00,0x00,0x06,0x0d,0x04,0x00,0x0a,0x00,0x00,0x00,0x04,0x6e,0x61,0x6d,0x65,
+0x00,0x00,0x00,0x00,0x18,0x02,0x02,0x04,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x2d,
+0x1f,0x12,0x01,0xd1,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x61,0x6d,0x65,
+0x73,0x20,0x3d,0x20,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x6e,0x61,0x6d,0x65,0x73,0x2e,
+0x70,0x6f,0x73,0x2c,0x20,0x27,0x74,0x75,0x70,0x6c,0x65,0x27,0x2c,0x20,0x4e,0x6f,
+0x6e,0x65,0x2c,0x20,0x5b,0x6e,0x61,0x6d,0x65,0x73,0x2e,0x61,0x73,0x5f,0x73,0x74,
+0x72,0x69,0x6e,0x67,0x28,0x29,0x5d,0x29,0x00,0x00,0x00,0x00,0x0e,0x04,0x00,0x0b,
+0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0d,0x08,0x00,0x0c,
+0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x05,0x03,0x08,0x00,0x00,0x00,0x07,
+0x0d,0x06,0x00,0x0d,0x00,0x00,0x00,0x05,0x74,0x75,0x70,0x6c,0x65,0x00,0x00,0x00,
+0x1d,0x07,0x00,0x00,0x0d,0x0e,0x00,0x05,0x00,0x00,0x00,0x09,0x61,0x73,0x5f,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,0x38,0x0c,0x03,0x0e,0x00,0x00,0x00,0x08,
+0x39,0x08,0x0c,0x02,0x1c,0x08,0x08,0x01,0x37,0x03,0x04,0x05,0x13,0x00,0x00,0xb9,
+0x1f,0x09,0x01,0xd2,0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x6e,0x61,0x6d,
+0x65,0x73,0x2e,0x74,0x79,0x70,0x65,0x20,0x3d,0x3d,0x20,0x20,0x27,0x74,0x75,0x70,
+0x6c,0x65,0x27,0x3a,0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x06,0x00,0x00,0x00,0x04,
+0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x09,0x02,0x03,0x04,0x00,0x00,0x00,0x09,
+0x0d,0x04,0x00,0x0d,0x00,0x00,0x00,0x05,0x74,0x75,0x70,0x6c,0x65,0x00,0x00,0x00,
+0x18,0x02,0x02,0x04,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x74,0x1f,0x0d,0x01,0xd3,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x61,0x6d,0x65,0x73,0x20,0x3d,0x20,
+0x54,0x6f,0x6b,0x65,0x6e,0x28,0x6e,0x61,0x6d,0x65,0x73,0x2e,0x70,0x6f,0x73,0x2c,
+0x20,0x27,0x74,0x75,0x70,0x6c,0x65,0x27,0x2c,0x20,0x4e,0x6f,0x6e,0x65,0x2c,0x20,
+0x5b,0x00,0x00,0x00,0x0e,0x04,0x00,0x0b,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x0d,0x08,0x00,0x0c,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,
+0x09,0x05,0x03,0x08,0x00,0x00,0x00,0x0a,0x0d,0x06,0x00,0x0d,0x00,0x00,0x00,0x05,
+0x74,0x75,0x70,0x6c,0x65,0x00,0x00,0x00,0x1d,0x07,0x00,0x00,0x33,0x08,0x00,0x08,
+0x63,0x6f,0x6d,0x70,0x3a,0x31,0x33,0x38,0x00,0x00,0x00,0x00,0x1c,0x08,0x00,0x00,
+0x1f,0x0d,0x01,0xd4,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x2e,0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x28,0x29,0x20,0x66,0x6f,
+0x72,0x20,0x69,0x20,0x69,0x6e,0x20,0x6e,0x61,0x6d,0x65,0x73,0x2e,0x69,0x74,0x65,
+0x6d,0x73,0x5d,0x29,0x00,0x00,0x00,0x00,0x0d,0x0e,0x00,0x02,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x0d,0x03,0x0e,0x00,0x00,0x00,0x0b,
+0x0c,0x0e,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x0c,0x0d,0x0e,
+0x13,0x00,0x00,0x38,0x33,0x0c,0x00,0x01,0x69,0x00,0x00,0x00,0x1f,0x0d,0x01,0xd3,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x61,0x6d,0x65,0x73,0x20,0x3d,0x20,
+0x54,0x6f,0x6b,0x65,0x6e,0x28,0x6e,0x61,0x6d,0x65,0x73,0x2e,0x70,0x6f,0x73,0x2c,
+0x20,0x27,0x74,0x75,0x70,0x6c,0x65,0x27,0x2c,0x20,0x4e,0x6f,0x6e,0x65,0x2c,0x20,
+0x5b,0x00,0x00,0x00,0x1f,0x0d,0x01,0xd4,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x2e,0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x28,
+0x29,0x20,0x66,0x6f,0x72,0x20,0x69,0x20,0x69,0x6e,0x20,0x6e,0x61,0x6d,0x65,0x73,
+0x2e,0x69,0x74,0x65,0x6d,0x73,0x5d,0x29,0x00,0x00,0x00,0x00,0x0d,0x11,0x00,0x05,
+0x00,0x00,0x00,0x09,0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,
+0x38,0x0f,0x0c,0x11,0x00,0x00,0x00,0x0c,0x39,0x0c,0x0f,0x02,0x1f,0x0d,0x01,0xd3,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x61,0x6d,0x65,0x73,0x20,0x3d,0x20,
+0x54,0x6f,0x6b,0x65,0x6e,0x28,0x6e,0x61,0x6d,0x65,0x73,0x2e,0x70,0x6f,0x73,0x2c,
+0x20,0x27,0x74,0x75,0x70,0x6c,0x65,0x27,0x2c,0x20,0x4e,0x6f,0x6e,0x65,0x2c,0x20,
+0x5b,0x00,0x00,0x00,0x1d,0x0f,0x00,0x00,0x0b,0x08,0x0f,0x0c,0x13,0x00,0xff,0xc8,
+0x37,0x03,0x04,0x05,0x13,0x00,0x00,0x2f,0x1f,0x0e,0x01,0xd6,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x2e,0x75,0x5f,0x65,
+0x72,0x72,0x6f,0x72,0x28,0x27,0x53,0x79,0x6e,0x74,0x61,0x78,0x45,0x72,0x72,0x6f,
+0x72,0x27,0x2c,0x20,0x44,0x2e,0x63,0x6f,0x64,0x65,0x2c,0x20,0x74,0x2e,0x70,0x6f,
+0x73,0x29,0x00,0x00,0x0e,0x0c,0x00,0x0e,0x00,0x00,0x00,0x08,0x74,0x6f,0x6b,0x65,
+0x6e,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x0d,0x0d,0x00,0x0f,0x00,0x00,0x00,0x07,
+0x75,0x5f,0x65,0x72,0x72,0x6f,0x72,0x00,0x38,0x04,0x0c,0x0d,0x00,0x00,0x00,0x0d,
+0x0d,0x06,0x00,0x10,0x00,0x00,0x00,0x0b,0x53,0x79,0x6e,0x74,0x61,0x78,0x45,0x72,
+0x72,0x6f,0x72,0x00,0x0e,0x07,0x00,0x11,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,
+0x0d,0x0c,0x00,0x12,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,
+0x09,0x07,0x07,0x0c,0x00,0x00,0x00,0x0e,0x0d,0x0c,0x00,0x0c,0x00,0x00,0x00,0x03,
+0x70,0x6f,0x73,0x00,0x09,0x08,0x00,0x0c,0x00,0x00,0x00,0x0f,0x39,0x02,0x04,0x05,
+0x1f,0x0a,0x01,0xd8,0x20,0x20,0x20,0x20,0x76,0x20,0x3d,0x20,0x64,0x6f,0x28,0x54,
+0x6f,0x6b,0x65,0x6e,0x28,0x74,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x63,0x61,0x6c,0x6c,
+0x27,0x2c,0x4e,0x6f,0x6e,0x65,0x2c,0x5b,0x00,0x00,0x00,0x00,0x33,0x02,0x00,0x01,
+0x76,0x00,0x00,0x00,0x0e,0x05,0x00,0x13,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,
+0x0e,0x0f,0x00,0x0b,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x0d,0x07,0x00,0x0c,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x10,0x00,0x07,
+0x00,0x00,0x00,0x10,0x0d,0x11,0x00,0x14,0x00,0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,
+0x00,0x00,0x00,0x00,0x1d,0x12,0x00,0x00,0x1f,0x0b,0x01,0xd9,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x2e,0x70,0x6f,0x73,0x2c,
+0x27,0x6e,0x61,0x6d,0x65,0x27,0x2c,0x27,0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,
+0x5f,0x5f,0x27,0x29,0x2c,0x00,0x00,0x00,0x0e,0x06,0x00,0x0b,0x00,0x00,0x00,0x05,
+0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0d,0x07,0x00,0x0c,0x00,0x00,0x00,0x03,
+0x70,0x6f,0x73,0x00,0x09,0x07,0x00,0x07,0x00,0x00,0x00,0x11,0x0d,0x08,0x00,0x0a,
+0x00,0x00,0x00,0x04,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,0x0d,0x09,0x00,0x15,
+0x00,0x00,0x00,0x0a,0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,0x5f,0x5f,0x00,0x00,
+0x37,0x0c,0x06,0x04,0x1f,0x04,0x01,0xda,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6d,0x6f,0x64,0x2c,0x00,0x00,0x00,0x00,0x10,0x0d,0x01,0x00,0x1f,0x04,0x01,0xdb,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x61,0x6d,0x65,0x73,0x2c,0x00,0x00,
+0x10,0x0e,0x03,0x00,0x1c,0x13,0x0c,0x03,0x37,0x06,0x0f,0x05,0x37,0x02,0x05,0x02,
+0x1f,0x0c,0x01,0xde,0x20,0x20,0x20,0x20,0x67,0x20,0x3d,0x20,0x64,0x6f,0x28,0x54,
+0x6f,0x6b,0x65,0x6e,0x28,0x74,0x2e,0x70,0x6f,0x73,0x2c,0x20,0x27,0x6e,0x61,0x6d,
+0x65,0x27,0x2c,0x20,0x27,0x5f,0x5f,0x64,0x69,0x63,0x74,0x5f,0x5f,0x27,0x29,0x29,
+0x00,0x00,0x00,0x00,0x33,0x04,0x00,0x01,0x67,0x00,0x00,0x00,0x0e,0x06,0x00,0x13,
+0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x0e,0x0f,0x00,0x0b,0x00,0x00,0x00,0x05,
+0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0d,0x08,0x00,0x0c,0x00,0x00,0x00,0x03,
+0x70,0x6f,0x73,0x00,0x09,0x10,0x00,0x08,0x00,0x00,0x00,0x12,0x0d,0x11,0x00,0x0a,
+0x00,0x00,0x00,0x04,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,0x0d,0x12,0x00,0x16,
+0x00,0x00,0x00,0x08,0x5f,0x5f,0x64,0x69,0x63,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,
+0x37,0x07,0x0f,0x04,0x37,0x04,0x06,0x02,0x1f,0x06,0x01,0xdf,0x20,0x20,0x20,0x20,
+0x63,0x6f,0x64,0x65,0x28,0x55,0x50,0x44,0x41,0x54,0x45,0x2c,0x20,0x67,0x2c,0x20,
+0x76,0x29,0x3b,0x00,0x0e,0x0f,0x00,0x12,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,
+0x00,0x00,0x00,0x00,0x0e,0x10,0x00,0x17,0x00,0x00,0x00,0x06,0x55,0x50,0x44,0x41,
+0x54,0x45,0x00,0x00,0x10,0x11,0x04,0x00,0x10,0x12,0x02,0x00,0x37,0x05,0x0f,0x04,
+0x1f,0x04,0x01,0xe0,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x28,0x67,0x29,0x00,0x0e,0x06,0x00,0x18,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x07,0x04,0x00,0x37,0x05,0x06,0x02,
+0x1f,0x04,0x01,0xe1,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x28,0x76,0x29,0x00,0x0e,0x06,0x00,0x18,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x07,0x02,0x00,0x37,0x05,0x06,0x02,
+0x00,0x00,0x00,0x00,0x0d,0x2e,0x00,0x54,0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x66,
+0x72,0x6f,0x6d,0x00,0x0f,0x2e,0x2d,0x00,0x1f,0x05,0x01,0xe3,0x64,0x65,0x66,0x20,
+0x64,0x6f,0x5f,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x28,0x74,0x29,0x3a,0x00,0x00,
+0x33,0x2e,0x00,0x05,0x2a,0x24,0x34,0x31,0x31,0x00,0x00,0x00,0x0d,0x33,0x00,0x21,
+0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x1c,0x2f,0x33,0x01,0x1c,0x30,0x00,0x00,
+0x1d,0x31,0x00,0x00,0x1d,0x32,0x00,0x00,0x11,0x2e,0x00,0x6a,0x2d,0x07,0x00,0x08,
+0x00,0x00,0x00,0x06,0x1f,0x05,0x01,0xe3,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x67,
+0x6c,0x6f,0x62,0x61,0x6c,0x73,0x28,0x74,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,
+0x00,0x00,0x00,0x0a,0x64,0x6f,0x5f,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x00,0x00,
+0x23,0x01,0x00,0x00,0x1f,0x06,0x01,0xe4,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,
+0x74,0x20,0x69,0x6e,0x20,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x3a,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x02,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x09,0x03,0x00,0x02,0x00,0x00,0x00,0x00,0x0c,0x02,0x00,0x03,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x2b,0x01,0x03,0x02,0x13,0x00,0x00,0x3d,0x10,0x00,0x01,0x00,
+0x1f,0x09,0x01,0xe5,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,
+0x2e,0x76,0x61,0x6c,0x20,0x6e,0x6f,0x74,0x20,0x69,0x6e,0x20,0x44,0x2e,0x67,0x6c,
+0x6f,0x62,0x61,0x6c,0x73,0x3a,0x00,0x00,0x0d,0x04,0x00,0x04,0x00,0x00,0x00,0x03,
+0x76,0x61,0x6c,0x00,0x09,0x01,0x00,0x04,0x00,0x00,0x00,0x01,0x0e,0x04,0x00,0x05,
+0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x05,0x00,0x06,0x00,0x00,0x00,0x07,
+0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x00,0x09,0x04,0x04,0x05,0x00,0x00,0x00,0x02,
+0x08,0x01,0x01,0x04,0x16,0x01,0x00,0x00,0x13,0x00,0xff,0xe3,0x1f,0x09,0x01,0xe6,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x44,0x2e,0x67,0x6c,
+0x6f,0x62,0x61,0x6c,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x74,0x2e,0x76,
+0x61,0x6c,0x29,0x00,0x0e,0x01,0x00,0x05,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,
+0x0d,0x06,0x00,0x06,0x00,0x00,0x00,0x07,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x00,
+0x09,0x01,0x01,0x06,0x00,0x00,0x00,0x03,0x0d,0x06,0x00,0x07,0x00,0x00,0x00,0x06,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x04,0x01,0x06,0x00,0x00,0x00,0x04,
+0x0d,0x01,0x00,0x04,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x09,0x06,0x00,0x01,
+0x00,0x00,0x00,0x05,0x39,0x01,0x04,0x03,0x13,0x00,0xff,0xc3,0x00,0x00,0x00,0x00,
+0x0d,0x2f,0x00,0x55,0x00,0x00,0x00,0x0a,0x64,0x6f,0x5f,0x67,0x6c,0x6f,0x62,0x61,
+0x6c,0x73,0x00,0x00,0x0f,0x2f,0x2e,0x00,0x1f,0x04,0x01,0xe7,0x64,0x65,0x66,0x20,
+0x64,0x6f,0x5f,0x64,0x65,0x6c,0x28,0x74,0x74,0x29,0x3a,0x00,0x33,0x2f,0x00,0x05,
+0x2a,0x24,0x34,0x31,0x38,0x00,0x00,0x00,0x0d,0x34,0x00,0x56,0x00,0x00,0x00,0x02,
+0x74,0x74,0x00,0x00,0x1c,0x30,0x34,0x01,0x1c,0x31,0x00,0x00,0x1d,0x32,0x00,0x00,
+0x1d,0x33,0x00,0x00,0x11,0x2f,0x00,0x89,0x2d,0x0a,0x00,0x09,0x00,0x00,0x00,0x03,
+0x1f,0x04,0x01,0xe7,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x64,0x65,0x6c,0x28,0x74,
+0x74,0x29,0x3a,0x00,0x33,0x00,0x00,0x02,0x74,0x74,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x06,0x64,0x6f,0x5f,0x64,
+0x65,0x6c,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x06,0x01,0xe8,0x20,0x20,0x20,0x20,
+0x66,0x6f,0x72,0x20,0x74,0x20,0x69,0x6e,0x20,0x74,0x74,0x2e,0x69,0x74,0x65,0x6d,
+0x73,0x3a,0x00,0x00,0x0d,0x02,0x00,0x02,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x09,0x03,0x00,0x02,0x00,0x00,0x00,0x00,0x0c,0x02,0x00,0x03,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x01,0x03,0x02,0x13,0x00,0x00,0x5e,
+0x33,0x04,0x00,0x01,0x74,0x00,0x00,0x00,0x10,0x04,0x01,0x00,0x1f,0x07,0x01,0xe9,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x64,0x6f,0x28,0x74,
+0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x29,0x00,0x00,0x33,0x01,0x00,0x01,
+0x72,0x00,0x00,0x00,0x0e,0x05,0x00,0x04,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,
+0x0d,0x07,0x00,0x02,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x09,0x06,0x04,0x07,0x00,0x00,0x00,0x01,0x0c,0x07,0x00,0x03,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x06,0x06,0x07,0x37,0x01,0x05,0x02,0x1f,0x07,0x01,0xea,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x32,0x20,0x3d,0x20,0x64,0x6f,0x28,
+0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,0x31,0x5d,0x29,0x00,0x33,0x09,0x00,0x02,
+0x72,0x32,0x00,0x00,0x0e,0x06,0x00,0x04,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,
+0x0d,0x08,0x00,0x02,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x09,0x07,0x04,0x08,0x00,0x00,0x00,0x02,0x0c,0x08,0x00,0x05,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x07,0x07,0x08,0x37,0x09,0x06,0x02,0x1f,0x06,0x01,0xeb,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x28,0x44,0x45,0x4c,
+0x2c,0x72,0x2c,0x72,0x32,0x29,0x00,0x00,0x0e,0x06,0x00,0x06,0x00,0x00,0x00,0x04,
+0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0e,0x07,0x00,0x07,0x00,0x00,0x00,0x03,
+0x44,0x45,0x4c,0x00,0x10,0x08,0x01,0x00,0x37,0x05,0x06,0x04,0x1f,0x0a,0x01,0xec,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x28,0x72,0x29,0x3b,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x72,0x32,
+0x29,0x20,0x23,0x52,0x45,0x47,0x00,0x00,0x0e,0x06,0x00,0x08,0x00,0x00,0x00,0x08,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x07,0x01,0x00,
+0x37,0x05,0x06,0x02,0x0e,0x06,0x00,0x08,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x07,0x09,0x00,0x37,0x05,0x06,0x02,
+0x13,0x00,0xff,0xa2,0x00,0x00,0x00,0x00,0x0d,0x30,0x00,0x57,0x00,0x00,0x00,0x06,
+0x64,0x6f,0x5f,0x64,0x65,0x6c,0x00,0x00,0x0f,0x30,0x2f,0x00,0x1f,0x08,0x01,0xee,
+0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x63,0x61,0x6c,0x6c,0x5f,0x6d,0x65,0x74,0x68,
+0x6f,0x64,0x28,0x66,0x6e,0x63,0x2c,0x70,0x2c,0x72,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x30,0x00,0x05,0x2a,0x24,0x34,0x32,0x35,0x00,0x00,0x00,0x0d,0x35,0x00,0x40,
+0x00,0x00,0x00,0x03,0x66,0x6e,0x63,0x00,0x0d,0x36,0x00,0x58,0x00,0x00,0x00,0x01,
+0x70,0x00,0x00,0x00,0x0d,0x37,0x00,0x1f,0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,
+0x1c,0x31,0x35,0x03,0x1c,0x32,0x00,0x00,0x1d,0x33,0x00,0x00,0x1d,0x34,0x00,0x00,
+0x11,0x30,0x01,0x46,0x2d,0x0e,0x00,0x11,0x00,0x00,0x00,0x02,0x1f,0x08,0x01,0xee,
+0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x63,0x61,0x6c,0x6c,0x5f,0x6d,0x65,0x74,0x68,
+0x6f,0x64,0x28,0x66,0x6e,0x63,0x2c,0x70,0x2c,0x72,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x00,0x00,0x03,0x66,0x6e,0x63,0x00,0x33,0x01,0x00,0x01,0x70,0x00,0x00,0x00,
+0x33,0x02,0x00,0x01,0x72,0x00,0x00,0x00,0x0d,0x03,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x03,0x00,0x00,
+0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x0e,0x64,0x6f,0x5f,0x63,0x61,0x6c,0x6c,0x5f,
+0x6d,0x65,0x74,0x68,0x6f,0x64,0x00,0x00,0x23,0x03,0x00,0x00,0x1f,0x08,0x01,0xf2,
+0x20,0x20,0x20,0x20,0x74,0x6d,0x70,0x73,0x20,0x3d,0x20,0x67,0x65,0x74,0x5f,0x74,
+0x6d,0x70,0x73,0x28,0x32,0x2b,0x6c,0x65,0x6e,0x28,0x70,0x29,0x29,0x00,0x00,0x00,
+0x33,0x03,0x00,0x04,0x74,0x6d,0x70,0x73,0x00,0x00,0x00,0x00,0x0e,0x04,0x00,0x02,
+0x00,0x00,0x00,0x08,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x73,0x00,0x00,0x00,0x00,
+0x0c,0x05,0x00,0x03,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x0e,0x07,0x00,0x04,
+0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x10,0x08,0x01,0x00,0x37,0x06,0x07,0x02,
+0x01,0x05,0x05,0x06,0x37,0x03,0x04,0x02,0x1f,0x0b,0x01,0xf3,0x20,0x20,0x20,0x20,
+0x62,0x2c,0x63,0x20,0x3d,0x20,0x64,0x6f,0x28,0x66,0x6e,0x63,0x2e,0x69,0x74,0x65,
+0x6d,0x73,0x5b,0x30,0x5d,0x29,0x2c,0x64,0x6f,0x28,0x66,0x6e,0x63,0x2e,0x69,0x74,
+0x65,0x6d,0x73,0x5b,0x31,0x5d,0x29,0x00,0x0e,0x05,0x00,0x05,0x00,0x00,0x00,0x02,
+0x64,0x6f,0x00,0x00,0x0d,0x07,0x00,0x06,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x09,0x06,0x00,0x07,0x00,0x00,0x00,0x00,0x0c,0x07,0x00,0x07,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x06,0x06,0x07,0x37,0x0c,0x05,0x02,
+0x0e,0x06,0x00,0x05,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x0d,0x08,0x00,0x06,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x07,0x00,0x08,
+0x00,0x00,0x00,0x01,0x0c,0x08,0x00,0x08,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x07,0x07,0x08,0x37,0x04,0x06,0x02,0x33,0x05,0x00,0x01,0x62,0x00,0x00,0x00,
+0x10,0x05,0x0c,0x00,0x33,0x0c,0x00,0x01,0x63,0x00,0x00,0x00,0x10,0x0c,0x04,0x00,
+0x1f,0x08,0x01,0xf4,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x28,0x4d,0x45,0x54,
+0x48,0x4f,0x44,0x2c,0x74,0x6d,0x70,0x73,0x5b,0x30,0x5d,0x2c,0x62,0x2c,0x63,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x09,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,
+0x00,0x00,0x00,0x00,0x0e,0x07,0x00,0x0a,0x00,0x00,0x00,0x06,0x4d,0x45,0x54,0x48,
+0x4f,0x44,0x00,0x00,0x0c,0x0b,0x00,0x07,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x08,0x03,0x0b,0x10,0x09,0x05,0x00,0x10,0x0a,0x0c,0x00,0x37,0x04,0x06,0x05,
+0x1f,0x08,0x01,0xf5,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x5f,0x31,0x36,0x28,
+0x30,0x2c,0x30,0x2c,0x6d,0x63,0x61,0x63,0x68,0x65,0x5f,0x73,0x6c,0x6f,0x74,0x28,
+0x29,0x29,0x00,0x00,0x0e,0x06,0x00,0x0b,0x00,0x00,0x00,0x07,0x63,0x6f,0x64,0x65,
+0x5f,0x31,0x36,0x00,0x0c,0x07,0x00,0x07,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0c,0x08,0x00,0x07,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0e,0x0a,0x00,0x0c,
+0x00,0x00,0x00,0x0b,0x6d,0x63,0x61,0x63,0x68,0x65,0x5f,0x73,0x6c,0x6f,0x74,0x00,
+0x37,0x09,0x0a,0x01,0x37,0x04,0x06,0x04,0x1f,0x08,0x01,0xf6,0x20,0x20,0x20,0x20,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x62,0x29,0x3b,0x20,0x66,0x72,0x65,
+0x65,0x5f,0x74,0x6d,0x70,0x28,0x63,0x29,0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x0d,
+0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x10,0x07,0x05,0x00,0x37,0x04,0x06,0x02,0x0e,0x06,0x00,0x0d,0x00,0x00,0x00,0x08,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x07,0x0c,0x00,
+0x37,0x04,0x06,0x02,0x1f,0x03,0x01,0xf7,0x20,0x20,0x20,0x20,0x6e,0x20,0x3d,0x20,
+0x32,0x00,0x00,0x00,0x33,0x04,0x00,0x01,0x6e,0x00,0x00,0x00,0x0c,0x06,0x00,0x03,
+0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x10,0x04,0x06,0x00,0x1f,0x05,0x01,0xf8,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x74,0x74,0x20,0x69,0x6e,0x20,0x70,0x3a,
+0x00,0x00,0x00,0x00,0x0c,0x07,0x00,0x07,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x2b,0x06,0x01,0x07,0x13,0x00,0x00,0x4c,0x33,0x08,0x00,0x02,0x74,0x74,0x00,0x00,
+0x10,0x08,0x06,0x00,0x1f,0x07,0x01,0xf9,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x62,0x20,0x3d,0x20,0x64,0x6f,0x28,0x74,0x74,0x2c,0x74,0x6d,0x70,0x73,0x5b,0x6e,
+0x5d,0x29,0x00,0x00,0x0e,0x09,0x00,0x05,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,
+0x10,0x0a,0x08,0x00,0x0a,0x0b,0x03,0x04,0x37,0x05,0x09,0x03,0x1f,0x07,0x01,0xfa,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x62,0x20,0x21,0x3d,0x20,
+0x74,0x6d,0x70,0x73,0x5b,0x6e,0x5d,0x3a,0x00,0x00,0x00,0x00,0x0a,0x09,0x03,0x04,
+0x24,0x06,0x05,0x09,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x24,0x1f,0x09,0x01,0xfb,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,
+0x28,0x4d,0x4f,0x56,0x45,0x2c,0x74,0x6d,0x70,0x73,0x5b,0x6e,0x5d,0x2c,0x62,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x09,0x00,0x09,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,
+0x00,0x00,0x00,0x00,0x0e,0x0a,0x00,0x0e,0x00,0x00,0x00,0x04,0x4d,0x4f,0x56,0x45,
+0x00,0x00,0x00,0x00,0x0a,0x0b,0x03,0x04,0x10,0x0c,0x05,0x00,0x37,0x06,0x09,0x04,
+0x1f,0x06,0x01,0xfc,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x62,0x29,0x00,0x0e,0x09,0x00,0x0d,
+0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x10,0x0a,0x05,0x00,0x37,0x06,0x09,0x02,0x1f,0x04,0x01,0xfd,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6e,0x20,0x2b,0x3d,0x20,0x31,0x00,0x00,0x0c,0x09,0x00,0x08,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x06,0x04,0x09,0x10,0x04,0x06,0x00,
+0x13,0x00,0xff,0xb4,0x1f,0x09,0x01,0xfe,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,
+0x28,0x43,0x41,0x4c,0x4c,0x4d,0x2c,0x72,0x2c,0x74,0x6d,0x70,0x73,0x5b,0x30,0x5d,
+0x2c,0x6c,0x65,0x6e,0x28,0x74,0x6d,0x70,0x73,0x29,0x29,0x00,0x0e,0x09,0x00,0x09,
+0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0e,0x0a,0x00,0x0f,
+0x00,0x00,0x00,0x05,0x43,0x41,0x4c,0x4c,0x4d,0x00,0x00,0x00,0x10,0x0b,0x02,0x00,
+0x0c,0x07,0x00,0x07,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x0c,0x03,0x07,
+0x0e,0x00,0x00,0x04,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x10,0x01,0x03,0x00,
+0x37,0x0d,0x00,0x02,0x37,0x06,0x09,0x05,0x1f,0x05,0x01,0xff,0x20,0x20,0x20,0x20,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x73,0x28,0x74,0x6d,0x70,0x73,0x29,0x00,
+0x0e,0x09,0x00,0x10,0x00,0x00,0x00,0x09,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x73,0x00,0x00,0x00,0x10,0x0a,0x03,0x00,0x37,0x06,0x09,0x02,0x1f,0x04,0x02,0x00,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,
+0x15,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x31,0x00,0x59,0x00,0x00,0x00,0x0e,
+0x64,0x6f,0x5f,0x63,0x61,0x6c,0x6c,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x00,0x00,
+0x0f,0x31,0x30,0x00,0x1f,0x06,0x02,0x02,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x63,
+0x61,0x6c,0x6c,0x28,0x74,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,
+0x33,0x31,0x00,0x05,0x2a,0x24,0x34,0x33,0x34,0x00,0x00,0x00,0x0d,0x36,0x00,0x21,
+0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x37,0x00,0x1f,0x00,0x00,0x00,0x01,
+0x72,0x00,0x00,0x00,0x1c,0x32,0x36,0x02,0x1d,0x36,0x00,0x00,0x1c,0x33,0x36,0x01,
+0x1d,0x34,0x00,0x00,0x1d,0x35,0x00,0x00,0x11,0x31,0x02,0xfb,0x2d,0x17,0x00,0x20,
+0x00,0x00,0x00,0x08,0x1f,0x06,0x02,0x02,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x63,
+0x61,0x6c,0x6c,0x28,0x74,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,
+0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x72,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x07,
+0x64,0x6f,0x5f,0x63,0x61,0x6c,0x6c,0x00,0x23,0x02,0x00,0x00,0x1f,0x05,0x02,0x03,
+0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,0x73,0x20,0x3d,0x20,0x74,0x2e,0x69,0x74,
+0x65,0x6d,0x73,0x00,0x33,0x02,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x02,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x09,0x02,0x00,0x03,0x00,0x00,0x00,0x00,0x1f,0x09,0x02,0x04,0x20,0x20,0x20,0x20,
+0x70,0x2c,0x6e,0x2c,0x6c,0x2c,0x64,0x20,0x3d,0x20,0x70,0x5f,0x66,0x69,0x6c,0x74,
+0x65,0x72,0x28,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,0x31,0x3a,0x5d,0x29,0x00,
+0x0e,0x03,0x00,0x03,0x00,0x00,0x00,0x08,0x70,0x5f,0x66,0x69,0x6c,0x74,0x65,0x72,
+0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x02,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x09,0x04,0x00,0x05,0x00,0x00,0x00,0x01,0x0c,0x06,0x00,0x04,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x1d,0x07,0x00,0x00,0x1c,0x05,0x06,0x02,
+0x0a,0x04,0x04,0x05,0x37,0x0b,0x03,0x02,0x33,0x0b,0x00,0x03,0x2a,0x24,0x34,0x00,
+0x33,0x03,0x00,0x01,0x70,0x00,0x00,0x00,0x0c,0x05,0x00,0x05,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x03,0x0b,0x05,0x33,0x04,0x00,0x01,0x6e,0x00,0x00,0x00,
+0x0c,0x06,0x00,0x04,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x04,0x0b,0x06,
+0x33,0x05,0x00,0x01,0x6c,0x00,0x00,0x00,0x0c,0x07,0x00,0x06,0x00,0x00,0x69,0x04,
+0x02,0x00,0x00,0x00,0x0a,0x05,0x0b,0x07,0x33,0x06,0x00,0x01,0x64,0x00,0x00,0x00,
+0x0c,0x08,0x00,0x07,0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,0x0a,0x06,0x0b,0x08,
+0x1f,0x0c,0x02,0x05,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6c,0x65,0x6e,0x28,0x6e,
+0x29,0x20,0x3d,0x3d,0x20,0x30,0x20,0x61,0x6e,0x64,0x20,0x6c,0x20,0x3d,0x3d,0x20,
+0x4e,0x6f,0x6e,0x65,0x20,0x61,0x6e,0x64,0x20,0x64,0x20,0x3d,0x3d,0x20,0x4e,0x6f,
+0x6e,0x65,0x3a,0x00,0x0e,0x07,0x00,0x08,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,
+0x10,0x08,0x04,0x00,0x37,0x0b,0x07,0x02,0x0c,0x07,0x00,0x05,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x18,0x0b,0x0b,0x07,0x16,0x0b,0x00,0x00,0x13,0x00,0x00,0x03,
+0x1d,0x07,0x00,0x00,0x18,0x0b,0x05,0x07,0x16,0x0b,0x00,0x00,0x13,0x00,0x00,0x03,
+0x1d,0x07,0x00,0x00,0x18,0x0b,0x06,0x07,0x16,0x0b,0x00,0x00,0x13,0x00,0x00,0x68,
+0x1f,0x06,0x02,0x08,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,
+0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x28,0x72,0x29,0x00,0x00,0x0e,0x07,0x00,0x09,
+0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x00,0x10,0x08,0x01,0x00,
+0x37,0x01,0x07,0x02,0x1f,0x09,0x02,0x09,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x74,0x79,0x70,0x65,
+0x20,0x3d,0x3d,0x20,0x27,0x6d,0x67,0x65,0x74,0x27,0x3a,0x00,0x0c,0x07,0x00,0x05,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x0b,0x02,0x07,0x0d,0x07,0x00,0x0a,
+0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x09,0x0b,0x0b,0x07,
+0x00,0x00,0x00,0x02,0x0d,0x07,0x00,0x0b,0x00,0x00,0x00,0x04,0x6d,0x67,0x65,0x74,
+0x00,0x00,0x00,0x00,0x18,0x0b,0x0b,0x07,0x16,0x0b,0x00,0x00,0x13,0x00,0x00,0x1c,
+0x1f,0x0c,0x02,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x64,0x6f,0x5f,0x63,0x61,0x6c,0x6c,0x5f,0x6d,
+0x65,0x74,0x68,0x6f,0x64,0x28,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x70,
+0x2c,0x72,0x29,0x00,0x0e,0x07,0x00,0x0c,0x00,0x00,0x00,0x0e,0x64,0x6f,0x5f,0x63,
+0x61,0x6c,0x6c,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x00,0x00,0x0c,0x0c,0x00,0x05,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x08,0x02,0x0c,0x10,0x09,0x03,0x00,
+0x10,0x0a,0x01,0x00,0x37,0x0b,0x07,0x04,0x15,0x0b,0x00,0x00,0x1f,0x0b,0x02,0x0b,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x61,0x6e,0x61,0x67,0x65,0x5f,0x73,
+0x65,0x71,0x28,0x43,0x41,0x4c,0x4c,0x50,0x2c,0x72,0x2c,0x5b,0x69,0x74,0x65,0x6d,
+0x73,0x5b,0x30,0x5d,0x5d,0x2b,0x70,0x29,0x00,0x00,0x00,0x00,0x0e,0x07,0x00,0x0d,
+0x00,0x00,0x00,0x0a,0x6d,0x61,0x6e,0x61,0x67,0x65,0x5f,0x73,0x65,0x71,0x00,0x00,
+0x0e,0x08,0x00,0x0e,0x00,0x00,0x00,0x05,0x43,0x41,0x4c,0x4c,0x50,0x00,0x00,0x00,
+0x10,0x09,0x01,0x00,0x0c,0x0d,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x0c,0x02,0x0d,0x1c,0x0a,0x0c,0x01,0x01,0x0a,0x0a,0x03,0x37,0x0b,0x07,0x04,
+0x1f,0x05,0x02,0x0c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,0x15,0x01,0x00,0x00,0x1f,0x06,0x02,0x0d,
+0x20,0x20,0x20,0x20,0x66,0x6e,0x63,0x20,0x3d,0x20,0x64,0x6f,0x28,0x69,0x74,0x65,
+0x6d,0x73,0x5b,0x30,0x5d,0x29,0x00,0x00,0x33,0x0b,0x00,0x03,0x66,0x6e,0x63,0x00,
+0x0e,0x08,0x00,0x0f,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x0c,0x0a,0x00,0x05,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x09,0x02,0x0a,0x37,0x0b,0x08,0x02,
+0x1f,0x04,0x02,0x0e,0x20,0x20,0x20,0x20,0x65,0x20,0x3d,0x20,0x4e,0x6f,0x6e,0x65,
+0x00,0x00,0x00,0x00,0x33,0x07,0x00,0x01,0x65,0x00,0x00,0x00,0x1d,0x07,0x00,0x00,
+0x1f,0x09,0x02,0x0f,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6c,0x65,0x6e,0x28,0x6e,
+0x29,0x20,0x21,0x3d,0x20,0x30,0x20,0x6f,0x72,0x20,0x64,0x20,0x21,0x3d,0x20,0x4e,
+0x6f,0x6e,0x65,0x3a,0x00,0x00,0x00,0x00,0x0e,0x09,0x00,0x08,0x00,0x00,0x00,0x03,
+0x6c,0x65,0x6e,0x00,0x10,0x0a,0x04,0x00,0x37,0x08,0x09,0x02,0x0c,0x09,0x00,0x05,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x24,0x08,0x08,0x09,0x2f,0x08,0x00,0x00,
+0x13,0x00,0x00,0x03,0x1d,0x09,0x00,0x00,0x24,0x08,0x06,0x09,0x16,0x08,0x00,0x00,
+0x13,0x00,0x00,0xea,0x1f,0x0e,0x02,0x10,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x65,0x20,0x3d,0x20,0x64,0x6f,0x28,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x2e,0x70,
+0x6f,0x73,0x2c,0x27,0x64,0x69,0x63,0x74,0x27,0x2c,0x4e,0x6f,0x6e,0x65,0x2c,0x5b,
+0x5d,0x29,0x29,0x3b,0x20,0x75,0x6e,0x5f,0x74,0x6d,0x70,0x28,0x65,0x29,0x3b,0x00,
+0x0e,0x09,0x00,0x0f,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x0e,0x0c,0x00,0x10,
+0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0d,0x11,0x00,0x11,
+0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x0d,0x00,0x11,0x00,0x00,0x00,0x03,
+0x0d,0x0e,0x00,0x12,0x00,0x00,0x00,0x04,0x64,0x69,0x63,0x74,0x00,0x00,0x00,0x00,
+0x1d,0x0f,0x00,0x00,0x1c,0x10,0x00,0x00,0x37,0x0a,0x0c,0x05,0x37,0x07,0x09,0x02,
+0x0e,0x09,0x00,0x13,0x00,0x00,0x00,0x06,0x75,0x6e,0x5f,0x74,0x6d,0x70,0x00,0x00,
+0x10,0x0a,0x07,0x00,0x37,0x08,0x09,0x02,0x1f,0x05,0x02,0x11,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x69,0x20,0x69,0x6e,0x20,0x6e,0x3a,0x00,
+0x0c,0x09,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x08,0x04,0x09,
+0x13,0x00,0x00,0x75,0x33,0x0a,0x00,0x01,0x69,0x00,0x00,0x00,0x10,0x0a,0x08,0x00,
+0x1f,0x08,0x02,0x12,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x31,0x2c,0x20,0x69,0x32,0x20,0x3d,0x20,0x69,0x2e,0x69,0x74,0x65,0x6d,0x73,
+0x00,0x00,0x00,0x00,0x0d,0x0c,0x00,0x02,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x09,0x08,0x0a,0x0c,0x00,0x00,0x00,0x04,0x33,0x08,0x00,0x04,
+0x2a,0x24,0x36,0x39,0x00,0x00,0x00,0x00,0x33,0x0c,0x00,0x02,0x69,0x31,0x00,0x00,
+0x0c,0x0e,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x0c,0x08,0x0e,
+0x33,0x0d,0x00,0x02,0x69,0x32,0x00,0x00,0x0c,0x0f,0x00,0x04,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x0d,0x08,0x0f,0x1f,0x0c,0x02,0x13,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x31,0x2c,0x20,0x74,0x32,0x20,0x3d,
+0x20,0x64,0x6f,0x28,0x69,0x31,0x2e,0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,
+0x28,0x29,0x29,0x2c,0x20,0x64,0x6f,0x28,0x69,0x32,0x29,0x00,0x0e,0x0f,0x00,0x0f,
+0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x0d,0x13,0x00,0x14,0x00,0x00,0x00,0x09,
+0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,0x38,0x11,0x0c,0x13,
+0x00,0x00,0x00,0x05,0x39,0x10,0x11,0x02,0x37,0x08,0x0f,0x02,0x0e,0x10,0x00,0x0f,
+0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x10,0x11,0x0d,0x00,0x37,0x0e,0x10,0x02,
+0x33,0x0f,0x00,0x02,0x74,0x31,0x00,0x00,0x10,0x0f,0x08,0x00,0x33,0x08,0x00,0x02,
+0x74,0x32,0x00,0x00,0x10,0x08,0x0e,0x00,0x1f,0x08,0x02,0x14,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x28,0x53,0x45,0x54,
+0x2c,0x65,0x2c,0x74,0x31,0x2c,0x74,0x32,0x29,0x00,0x00,0x00,0x0e,0x10,0x00,0x15,
+0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0e,0x11,0x00,0x16,
+0x00,0x00,0x00,0x03,0x53,0x45,0x54,0x00,0x10,0x12,0x07,0x00,0x10,0x13,0x0f,0x00,
+0x10,0x14,0x08,0x00,0x37,0x0e,0x10,0x05,0x1f,0x0b,0x02,0x15,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x28,0x74,0x31,0x29,0x3b,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x74,
+0x32,0x29,0x20,0x23,0x52,0x45,0x47,0x00,0x0e,0x10,0x00,0x17,0x00,0x00,0x00,0x08,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x11,0x0f,0x00,
+0x37,0x0e,0x10,0x02,0x0e,0x10,0x00,0x17,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x11,0x08,0x00,0x37,0x0e,0x10,0x02,
+0x13,0x00,0xff,0x8b,0x1f,0x04,0x02,0x16,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x64,0x3a,0x20,0x00,0x00,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x3b,
+0x1f,0x08,0x02,0x17,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x66,0x20,0x3d,0x20,0x64,0x6f,0x28,0x64,0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,
+0x5d,0x29,0x00,0x00,0x33,0x09,0x00,0x01,0x66,0x00,0x00,0x00,0x0e,0x10,0x00,0x0f,
+0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x0d,0x12,0x00,0x02,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x11,0x06,0x12,0x00,0x00,0x00,0x06,
+0x0c,0x12,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x11,0x11,0x12,
+0x37,0x09,0x10,0x02,0x1f,0x06,0x02,0x18,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x75,0x6e,0x5f,0x74,0x6d,0x70,0x28,0x66,0x29,0x00,0x00,0x00,
+0x0e,0x10,0x00,0x13,0x00,0x00,0x00,0x06,0x75,0x6e,0x5f,0x74,0x6d,0x70,0x00,0x00,
+0x10,0x11,0x09,0x00,0x37,0x0e,0x10,0x02,0x1f,0x08,0x02,0x19,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x28,0x55,0x50,0x44,
+0x41,0x54,0x45,0x2c,0x65,0x2c,0x66,0x29,0x00,0x00,0x00,0x00,0x0e,0x10,0x00,0x15,
+0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0e,0x11,0x00,0x18,
+0x00,0x00,0x00,0x06,0x55,0x50,0x44,0x41,0x54,0x45,0x00,0x00,0x10,0x12,0x07,0x00,
+0x10,0x13,0x09,0x00,0x37,0x0e,0x10,0x04,0x1f,0x09,0x02,0x1b,0x20,0x20,0x20,0x20,
+0x6c,0x70,0x61,0x72,0x61,0x6d,0x73,0x2c,0x20,0x64,0x70,0x61,0x72,0x61,0x6d,0x73,
+0x20,0x3d,0x20,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x73,0x28,0x32,0x29,0x00,0x00,
+0x0e,0x10,0x00,0x19,0x00,0x00,0x00,0x08,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x73,
+0x00,0x00,0x00,0x00,0x0c,0x11,0x00,0x06,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,
+0x37,0x0e,0x10,0x02,0x33,0x0e,0x00,0x05,0x2a,0x24,0x31,0x31,0x31,0x00,0x00,0x00,
+0x33,0x10,0x00,0x07,0x6c,0x70,0x61,0x72,0x61,0x6d,0x73,0x00,0x0c,0x12,0x00,0x05,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x10,0x0e,0x12,0x33,0x11,0x00,0x07,
+0x64,0x70,0x61,0x72,0x61,0x6d,0x73,0x00,0x0c,0x13,0x00,0x04,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x11,0x0e,0x13,0x1f,0x09,0x02,0x1f,0x20,0x20,0x20,0x20,
+0x6d,0x61,0x6e,0x61,0x67,0x65,0x5f,0x73,0x65,0x71,0x28,0x4c,0x49,0x53,0x54,0x2c,
+0x20,0x6c,0x70,0x61,0x72,0x61,0x6d,0x73,0x2c,0x20,0x70,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x12,0x00,0x0d,0x00,0x00,0x00,0x0a,0x6d,0x61,0x6e,0x61,0x67,0x65,0x5f,0x73,
+0x65,0x71,0x00,0x00,0x0e,0x13,0x00,0x1a,0x00,0x00,0x00,0x04,0x4c,0x49,0x53,0x54,
+0x00,0x00,0x00,0x00,0x10,0x14,0x10,0x00,0x10,0x15,0x03,0x00,0x37,0x0e,0x12,0x04,
+0x1f,0x05,0x02,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6c,0x20,0x21,0x3d,0x20,
+0x4e,0x6f,0x6e,0x65,0x3a,0x00,0x00,0x00,0x1d,0x12,0x00,0x00,0x24,0x0e,0x05,0x12,
+0x16,0x0e,0x00,0x00,0x13,0x00,0x00,0x3c,0x1f,0x07,0x02,0x21,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x74,0x32,0x20,0x3d,0x20,0x64,0x6f,0x28,0x6c,0x2e,0x69,0x74,
+0x65,0x6d,0x73,0x5b,0x30,0x5d,0x29,0x00,0x0e,0x12,0x00,0x0f,0x00,0x00,0x00,0x02,
+0x64,0x6f,0x00,0x00,0x0d,0x14,0x00,0x02,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x09,0x13,0x05,0x14,0x00,0x00,0x00,0x07,0x0c,0x14,0x00,0x05,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x13,0x13,0x14,0x37,0x08,0x12,0x02,
+0x1f,0x0a,0x02,0x22,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,
+0x28,0x41,0x44,0x44,0x2c,0x20,0x6c,0x70,0x61,0x72,0x61,0x6d,0x73,0x2c,0x20,0x6c,
+0x70,0x61,0x72,0x61,0x6d,0x73,0x2c,0x20,0x74,0x32,0x29,0x00,0x0e,0x12,0x00,0x15,
+0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0e,0x13,0x00,0x1b,
+0x00,0x00,0x00,0x03,0x41,0x44,0x44,0x00,0x10,0x14,0x10,0x00,0x10,0x15,0x10,0x00,
+0x10,0x16,0x08,0x00,0x37,0x0e,0x12,0x05,0x1f,0x07,0x02,0x23,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x74,0x32,0x29,
+0x20,0x23,0x52,0x45,0x47,0x00,0x00,0x00,0x0e,0x12,0x00,0x17,0x00,0x00,0x00,0x08,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x13,0x08,0x00,
+0x37,0x0e,0x12,0x02,0x1f,0x05,0x02,0x24,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x65,
+0x20,0x21,0x3d,0x20,0x4e,0x6f,0x6e,0x65,0x3a,0x00,0x00,0x00,0x1d,0x12,0x00,0x00,
+0x24,0x0e,0x07,0x12,0x16,0x0e,0x00,0x00,0x13,0x00,0x00,0x16,0x1f,0x08,0x02,0x25,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x28,0x4d,0x4f,0x56,
+0x45,0x2c,0x20,0x64,0x70,0x61,0x72,0x61,0x6d,0x73,0x2c,0x20,0x65,0x29,0x00,0x00,
+0x0e,0x12,0x00,0x15,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,
+0x0e,0x13,0x00,0x1c,0x00,0x00,0x00,0x04,0x4d,0x4f,0x56,0x45,0x00,0x00,0x00,0x00,
+0x10,0x14,0x11,0x00,0x10,0x15,0x07,0x00,0x37,0x0e,0x12,0x04,0x13,0x00,0x00,0x10,
+0x1f,0x07,0x02,0x27,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x64,0x6f,0x5f,
+0x6e,0x6f,0x6e,0x65,0x28,0x64,0x70,0x61,0x72,0x61,0x6d,0x73,0x29,0x00,0x00,0x00,
+0x0e,0x12,0x00,0x1d,0x00,0x00,0x00,0x08,0x5f,0x64,0x6f,0x5f,0x6e,0x6f,0x6e,0x65,
+0x00,0x00,0x00,0x00,0x10,0x13,0x11,0x00,0x37,0x0e,0x12,0x02,0x1f,0x05,0x02,0x29,
+0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x28,
+0x72,0x29,0x00,0x00,0x0e,0x12,0x00,0x09,0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,
+0x74,0x6d,0x70,0x00,0x10,0x13,0x01,0x00,0x37,0x01,0x12,0x02,0x1f,0x08,0x02,0x2b,
+0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x28,0x43,0x41,0x4c,0x4c,0x2c,0x20,0x72,
+0x2c,0x20,0x66,0x6e,0x63,0x2c,0x20,0x6c,0x70,0x61,0x72,0x61,0x6d,0x73,0x29,0x00,
+0x0e,0x12,0x00,0x15,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,
+0x0e,0x13,0x00,0x1e,0x00,0x00,0x00,0x04,0x43,0x41,0x4c,0x4c,0x00,0x00,0x00,0x00,
+0x10,0x14,0x01,0x00,0x10,0x15,0x0b,0x00,0x10,0x16,0x10,0x00,0x37,0x0e,0x12,0x05,
+0x1f,0x06,0x02,0x2c,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x28,0x66,0x6e,0x63,0x29,0x20,0x23,0x52,0x45,0x47,0x00,0x00,0x0e,0x12,0x00,0x17,
+0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x10,0x13,0x0b,0x00,0x37,0x0e,0x12,0x02,0x1f,0x0a,0x02,0x2d,0x20,0x20,0x20,0x20,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x73,0x28,0x5b,0x6c,0x70,0x61,0x72,0x61,
+0x6d,0x73,0x2c,0x20,0x64,0x70,0x61,0x72,0x61,0x6d,0x73,0x5d,0x29,0x20,0x23,0x52,
+0x45,0x47,0x00,0x00,0x0e,0x12,0x00,0x1f,0x00,0x00,0x00,0x09,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x73,0x00,0x00,0x00,0x10,0x14,0x10,0x00,0x10,0x15,0x11,0x00,
+0x1c,0x13,0x14,0x02,0x37,0x0e,0x12,0x02,0x1f,0x04,0x02,0x2e,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,0x15,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x32,0x00,0x5a,0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x63,
+0x61,0x6c,0x6c,0x00,0x0f,0x32,0x31,0x00,0x1f,0x06,0x02,0x30,0x64,0x65,0x66,0x20,
+0x64,0x6f,0x5f,0x6e,0x61,0x6d,0x65,0x28,0x74,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,
+0x29,0x3a,0x00,0x00,0x33,0x32,0x00,0x05,0x2a,0x24,0x34,0x34,0x33,0x00,0x00,0x00,
+0x0d,0x37,0x00,0x21,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x38,0x00,0x1f,
+0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,0x1c,0x33,0x37,0x02,0x1d,0x37,0x00,0x00,
+0x1c,0x34,0x37,0x01,0x1d,0x35,0x00,0x00,0x1d,0x36,0x00,0x00,0x11,0x32,0x00,0xa4,
+0x2d,0x07,0x00,0x0a,0x00,0x00,0x00,0x09,0x1f,0x06,0x02,0x30,0x64,0x65,0x66,0x20,
+0x64,0x6f,0x5f,0x6e,0x61,0x6d,0x65,0x28,0x74,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,
+0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x33,0x01,0x00,0x01,
+0x72,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,
+0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x6e,0x61,0x6d,0x65,0x00,0x23,0x02,0x00,0x00,
+0x1f,0x06,0x02,0x31,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,0x2e,0x76,0x61,0x6c,
+0x20,0x69,0x6e,0x20,0x44,0x2e,0x76,0x61,0x72,0x73,0x3a,0x00,0x0d,0x03,0x00,0x02,
+0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x09,0x02,0x00,0x03,0x00,0x00,0x00,0x00,
+0x0e,0x03,0x00,0x03,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x04,0x00,0x04,
+0x00,0x00,0x00,0x04,0x76,0x61,0x72,0x73,0x00,0x00,0x00,0x00,0x09,0x03,0x03,0x04,
+0x00,0x00,0x00,0x01,0x25,0x02,0x02,0x03,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x13,
+0x1f,0x08,0x02,0x32,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x64,0x6f,0x5f,0x6c,0x6f,0x63,0x61,0x6c,0x28,0x74,0x2c,0x72,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x05,0x00,0x00,0x00,0x08,0x64,0x6f,0x5f,0x6c,
+0x6f,0x63,0x61,0x6c,0x00,0x00,0x00,0x00,0x10,0x04,0x00,0x00,0x10,0x05,0x01,0x00,
+0x37,0x02,0x03,0x03,0x15,0x02,0x00,0x00,0x1f,0x08,0x02,0x33,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x74,0x2e,0x76,0x61,0x6c,0x20,0x6e,0x6f,0x74,0x20,0x69,0x6e,0x20,
+0x44,0x2e,0x72,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x3a,0x00,0x0d,0x03,0x00,0x02,
+0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x09,0x02,0x00,0x03,0x00,0x00,0x00,0x02,
+0x0e,0x03,0x00,0x03,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x04,0x00,0x06,
+0x00,0x00,0x00,0x08,0x72,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x00,0x00,0x00,0x00,
+0x09,0x03,0x03,0x04,0x00,0x00,0x00,0x03,0x08,0x02,0x02,0x03,0x16,0x02,0x00,0x00,
+0x13,0x00,0x00,0x21,0x1f,0x09,0x02,0x34,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x44,0x2e,0x72,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,
+0x64,0x28,0x74,0x2e,0x76,0x61,0x6c,0x29,0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x03,
+0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x06,0x00,0x06,0x00,0x00,0x00,0x08,
+0x72,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x00,0x00,0x00,0x00,0x09,0x05,0x05,0x06,
+0x00,0x00,0x00,0x04,0x0d,0x06,0x00,0x07,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x03,0x05,0x06,0x00,0x00,0x00,0x05,0x0d,0x05,0x00,0x02,
+0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x09,0x05,0x00,0x05,0x00,0x00,0x00,0x06,
+0x39,0x02,0x03,0x03,0x1f,0x0b,0x02,0x35,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x5f,0x64,0x6f,0x5f,0x67,0x67,0x65,0x74,0x28,0x74,0x2e,0x61,0x73,
+0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x28,0x29,0x2e,0x76,0x61,0x6c,0x2c,0x72,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x08,0x00,0x00,0x00,0x08,0x5f,0x64,0x6f,0x5f,
+0x67,0x67,0x65,0x74,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x09,0x00,0x00,0x00,0x09,
+0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,0x38,0x05,0x00,0x02,
+0x00,0x00,0x00,0x07,0x39,0x04,0x05,0x02,0x0d,0x05,0x00,0x02,0x00,0x00,0x00,0x03,
+0x76,0x61,0x6c,0x00,0x09,0x04,0x04,0x05,0x00,0x00,0x00,0x08,0x10,0x05,0x01,0x00,
+0x37,0x02,0x03,0x03,0x15,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x33,0x00,0x5b,
+0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x6e,0x61,0x6d,0x65,0x00,0x0f,0x33,0x32,0x00,
+0x1f,0x06,0x02,0x37,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x6c,0x6f,0x63,0x61,0x6c,
+0x28,0x74,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x33,0x33,0x00,0x05,
+0x2a,0x24,0x34,0x35,0x32,0x00,0x00,0x00,0x0d,0x38,0x00,0x21,0x00,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x0d,0x39,0x00,0x1f,0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,
+0x1c,0x34,0x38,0x02,0x1d,0x38,0x00,0x00,0x1c,0x35,0x38,0x01,0x1d,0x36,0x00,0x00,
+0x1d,0x37,0x00,0x00,0x11,0x33,0x00,0xc4,0x2d,0x07,0x00,0x0f,0x00,0x00,0x00,0x0b,
+0x1f,0x06,0x02,0x37,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x6c,0x6f,0x63,0x61,0x6c,
+0x28,0x74,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x33,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,
+0x00,0x00,0x00,0x08,0x64,0x6f,0x5f,0x6c,0x6f,0x63,0x61,0x6c,0x00,0x00,0x00,0x00,
+0x23,0x01,0x00,0x00,0x1f,0x07,0x02,0x38,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,
+0x2e,0x76,0x61,0x6c,0x20,0x69,0x6e,0x20,0x44,0x2e,0x72,0x67,0x6c,0x6f,0x62,0x61,
+0x6c,0x73,0x3a,0x00,0x0d,0x02,0x00,0x02,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,
+0x09,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x01,
+0x44,0x00,0x00,0x00,0x0d,0x03,0x00,0x04,0x00,0x00,0x00,0x08,0x72,0x67,0x6c,0x6f,
+0x62,0x61,0x6c,0x73,0x00,0x00,0x00,0x00,0x09,0x02,0x02,0x03,0x00,0x00,0x00,0x01,
+0x25,0x01,0x01,0x02,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x44,0x1f,0x06,0x02,0x39,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x44,0x2e,0x65,0x72,0x72,0x6f,0x72,0x20,
+0x3d,0x20,0x54,0x72,0x75,0x65,0x00,0x00,0x0e,0x01,0x00,0x03,0x00,0x00,0x00,0x01,
+0x44,0x00,0x00,0x00,0x0c,0x02,0x00,0x05,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x06,0x00,0x00,0x00,0x05,0x65,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,
+0x0b,0x01,0x03,0x02,0x1f,0x0f,0x02,0x3a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x2e,0x75,0x5f,0x65,0x72,0x72,0x6f,0x72,
+0x28,0x27,0x55,0x6e,0x62,0x6f,0x75,0x6e,0x64,0x4c,0x6f,0x63,0x61,0x6c,0x45,0x72,
+0x72,0x6f,0x72,0x27,0x2c,0x44,0x2e,0x63,0x6f,0x64,0x65,0x2c,0x74,0x2e,0x70,0x6f,
+0x73,0x29,0x00,0x00,0x0e,0x01,0x00,0x07,0x00,0x00,0x00,0x08,0x74,0x6f,0x6b,0x65,
+0x6e,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x08,0x00,0x00,0x00,0x07,
+0x75,0x5f,0x65,0x72,0x72,0x6f,0x72,0x00,0x38,0x02,0x01,0x04,0x00,0x00,0x00,0x02,
+0x0d,0x04,0x00,0x09,0x00,0x00,0x00,0x11,0x55,0x6e,0x62,0x6f,0x75,0x6e,0x64,0x4c,
+0x6f,0x63,0x61,0x6c,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x0e,0x05,0x00,0x03,
+0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x01,0x00,0x0a,0x00,0x00,0x00,0x04,
+0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x09,0x05,0x05,0x01,0x00,0x00,0x00,0x03,
+0x0d,0x01,0x00,0x0b,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x06,0x00,0x01,
+0x00,0x00,0x00,0x04,0x39,0x01,0x02,0x05,0x1f,0x07,0x02,0x3b,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x74,0x2e,0x76,0x61,0x6c,0x20,0x6e,0x6f,0x74,0x20,0x69,0x6e,0x20,
+0x44,0x2e,0x76,0x61,0x72,0x73,0x3a,0x00,0x0d,0x02,0x00,0x02,0x00,0x00,0x00,0x03,
+0x76,0x61,0x6c,0x00,0x09,0x01,0x00,0x02,0x00,0x00,0x00,0x05,0x0e,0x02,0x00,0x03,
+0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x03,0x00,0x0c,0x00,0x00,0x00,0x04,
+0x76,0x61,0x72,0x73,0x00,0x00,0x00,0x00,0x09,0x02,0x02,0x03,0x00,0x00,0x00,0x06,
+0x08,0x01,0x01,0x02,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x1f,0x1f,0x08,0x02,0x3c,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x44,0x2e,0x76,0x61,0x72,0x73,0x2e,0x61,
+0x70,0x70,0x65,0x6e,0x64,0x28,0x74,0x2e,0x76,0x61,0x6c,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x05,0x00,0x03,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x06,0x00,0x0c,
+0x00,0x00,0x00,0x04,0x76,0x61,0x72,0x73,0x00,0x00,0x00,0x00,0x09,0x05,0x05,0x06,
+0x00,0x00,0x00,0x07,0x0d,0x06,0x00,0x0d,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x02,0x05,0x06,0x00,0x00,0x00,0x08,0x0d,0x05,0x00,0x02,
+0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x09,0x04,0x00,0x05,0x00,0x00,0x00,0x09,
+0x39,0x01,0x02,0x03,0x1f,0x07,0x02,0x3d,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x67,0x65,0x74,0x5f,0x72,0x65,0x67,0x28,0x74,0x2e,0x76,0x61,0x6c,
+0x29,0x00,0x00,0x00,0x0e,0x02,0x00,0x0e,0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,
+0x72,0x65,0x67,0x00,0x0d,0x04,0x00,0x02,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,
+0x09,0x03,0x00,0x04,0x00,0x00,0x00,0x0a,0x37,0x01,0x02,0x02,0x15,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x34,0x00,0x5c,0x00,0x00,0x00,0x08,0x64,0x6f,0x5f,0x6c,
+0x6f,0x63,0x61,0x6c,0x00,0x00,0x00,0x00,0x0f,0x34,0x33,0x00,0x1f,0x05,0x02,0x3f,
+0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x64,0x65,0x66,0x28,0x74,0x6f,0x6b,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x34,0x00,0x05,0x2a,0x24,0x34,0x36,0x31,0x00,0x00,0x00,
+0x0d,0x39,0x00,0x2f,0x00,0x00,0x00,0x03,0x74,0x6f,0x6b,0x00,0x1c,0x35,0x39,0x01,
+0x1c,0x36,0x00,0x00,0x1d,0x37,0x00,0x00,0x1d,0x38,0x00,0x00,0x11,0x34,0x02,0x7e,
+0x2d,0x15,0x00,0x20,0x00,0x00,0x00,0x12,0x1f,0x05,0x02,0x3f,0x64,0x65,0x66,0x20,
+0x64,0x6f,0x5f,0x64,0x65,0x66,0x28,0x74,0x6f,0x6b,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x00,0x00,0x03,0x74,0x6f,0x6b,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x06,0x64,0x6f,0x5f,0x64,0x65,0x66,0x00,0x00,
+0x23,0x01,0x00,0x00,0x1f,0x06,0x02,0x40,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,
+0x73,0x20,0x3d,0x20,0x74,0x6f,0x6b,0x2e,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x33,0x01,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x0d,0x02,0x00,0x02,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x01,0x00,0x02,
+0x00,0x00,0x00,0x00,0x1f,0x0c,0x02,0x42,0x20,0x20,0x20,0x20,0x72,0x66,0x2c,0x20,
+0x74,0x20,0x3d,0x20,0x64,0x65,0x66,0x66,0x6e,0x63,0x28,0x74,0x6f,0x6b,0x2c,0x20,
+0x69,0x74,0x65,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x69,0x74,0x65,0x6d,0x73,0x2c,0x20,
+0x27,0x65,0x6e,0x64,0x27,0x29,0x00,0x00,0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x06,
+0x64,0x65,0x66,0x66,0x6e,0x63,0x00,0x00,0x10,0x03,0x00,0x00,0x0c,0x06,0x00,0x04,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x04,0x01,0x06,0x0d,0x06,0x00,0x02,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x04,0x04,0x06,
+0x00,0x00,0x00,0x01,0x0d,0x05,0x00,0x05,0x00,0x00,0x00,0x03,0x65,0x6e,0x64,0x00,
+0x37,0x07,0x02,0x04,0x33,0x07,0x00,0x03,0x2a,0x24,0x34,0x00,0x33,0x02,0x00,0x02,
+0x72,0x66,0x00,0x00,0x0c,0x04,0x00,0x06,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x02,0x07,0x04,0x33,0x03,0x00,0x01,0x74,0x00,0x00,0x00,0x0c,0x05,0x00,0x04,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x03,0x07,0x05,0x1f,0x04,0x02,0x44,
+0x20,0x20,0x20,0x20,0x44,0x2e,0x62,0x65,0x67,0x69,0x6e,0x28,0x29,0x00,0x00,0x00,
+0x0e,0x06,0x00,0x07,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x08,0x00,0x08,
+0x00,0x00,0x00,0x05,0x62,0x65,0x67,0x69,0x6e,0x00,0x00,0x00,0x38,0x04,0x06,0x08,
+0x00,0x00,0x00,0x02,0x39,0x07,0x04,0x02,0x1f,0x05,0x02,0x45,0x20,0x20,0x20,0x20,
+0x73,0x65,0x74,0x70,0x6f,0x73,0x28,0x74,0x6f,0x6b,0x2e,0x70,0x6f,0x73,0x29,0x00,
+0x0e,0x04,0x00,0x09,0x00,0x00,0x00,0x06,0x73,0x65,0x74,0x70,0x6f,0x73,0x00,0x00,
+0x0d,0x06,0x00,0x0a,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x05,0x00,0x06,
+0x00,0x00,0x00,0x03,0x37,0x07,0x04,0x02,0x1f,0x0a,0x02,0x46,0x20,0x20,0x20,0x20,
+0x70,0x2c,0x6e,0x2c,0x6c,0x2c,0x64,0x20,0x3d,0x20,0x70,0x5f,0x66,0x69,0x6c,0x74,
+0x65,0x72,0x28,0x69,0x74,0x65,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x69,0x74,0x65,0x6d,
+0x73,0x29,0x00,0x00,0x0e,0x04,0x00,0x0b,0x00,0x00,0x00,0x08,0x70,0x5f,0x66,0x69,
+0x6c,0x74,0x65,0x72,0x00,0x00,0x00,0x00,0x0c,0x06,0x00,0x04,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x05,0x01,0x06,0x0d,0x06,0x00,0x02,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x05,0x05,0x06,0x00,0x00,0x00,0x04,
+0x37,0x07,0x04,0x02,0x33,0x07,0x00,0x04,0x2a,0x24,0x32,0x34,0x00,0x00,0x00,0x00,
+0x33,0x04,0x00,0x01,0x70,0x00,0x00,0x00,0x0c,0x06,0x00,0x06,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x04,0x07,0x06,0x33,0x05,0x00,0x01,0x6e,0x00,0x00,0x00,
+0x0c,0x08,0x00,0x04,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x05,0x07,0x08,
+0x33,0x06,0x00,0x01,0x6c,0x00,0x00,0x00,0x0c,0x09,0x00,0x0c,0x00,0x00,0x69,0x04,
+0x02,0x00,0x00,0x00,0x0a,0x06,0x07,0x09,0x33,0x08,0x00,0x01,0x64,0x00,0x00,0x00,
+0x0c,0x0a,0x00,0x0d,0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,0x0a,0x08,0x07,0x0a,
+0x1f,0x04,0x02,0x48,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x69,0x20,0x69,0x6e,
+0x20,0x70,0x3a,0x00,0x0c,0x09,0x00,0x06,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x2b,0x07,0x04,0x09,0x13,0x00,0x00,0x12,0x33,0x0a,0x00,0x01,0x69,0x00,0x00,0x00,
+0x10,0x0a,0x07,0x00,0x1f,0x05,0x02,0x4a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x64,0x6f,0x5f,0x6c,0x6f,0x63,0x61,0x6c,0x28,0x69,0x29,0x00,0x0e,0x0b,0x00,0x0e,
+0x00,0x00,0x00,0x08,0x64,0x6f,0x5f,0x6c,0x6f,0x63,0x61,0x6c,0x00,0x00,0x00,0x00,
+0x10,0x0c,0x0a,0x00,0x37,0x07,0x0b,0x02,0x13,0x00,0xff,0xee,0x1f,0x04,0x02,0x4b,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x69,0x20,0x69,0x6e,0x20,0x6e,0x3a,0x00,
+0x0c,0x09,0x00,0x06,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x07,0x05,0x09,
+0x13,0x00,0x00,0x1c,0x10,0x0a,0x07,0x00,0x1f,0x08,0x02,0x4d,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x64,0x6f,0x5f,0x6c,0x6f,0x63,0x61,0x6c,0x28,0x69,0x2e,0x69,
+0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x29,0x00,0x00,0x00,0x00,0x0e,0x0b,0x00,0x0e,
+0x00,0x00,0x00,0x08,0x64,0x6f,0x5f,0x6c,0x6f,0x63,0x61,0x6c,0x00,0x00,0x00,0x00,
+0x0d,0x0d,0x00,0x02,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x09,0x0c,0x0a,0x0d,0x00,0x00,0x00,0x05,0x0c,0x0d,0x00,0x06,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x0c,0x0c,0x0d,0x37,0x07,0x0b,0x02,0x13,0x00,0xff,0xe4,
+0x1f,0x05,0x02,0x4e,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6c,0x20,0x21,0x3d,0x20,
+0x4e,0x6f,0x6e,0x65,0x3a,0x00,0x00,0x00,0x1d,0x09,0x00,0x00,0x24,0x07,0x06,0x09,
+0x16,0x07,0x00,0x00,0x13,0x00,0x00,0x1b,0x1f,0x08,0x02,0x50,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x64,0x6f,0x5f,0x6c,0x6f,0x63,0x61,0x6c,0x28,0x6c,0x2e,0x69,
+0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x29,0x00,0x00,0x00,0x00,0x0e,0x0b,0x00,0x0e,
+0x00,0x00,0x00,0x08,0x64,0x6f,0x5f,0x6c,0x6f,0x63,0x61,0x6c,0x00,0x00,0x00,0x00,
+0x0d,0x09,0x00,0x02,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x09,0x0c,0x06,0x09,0x00,0x00,0x00,0x06,0x0c,0x09,0x00,0x06,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x0c,0x0c,0x09,0x37,0x07,0x0b,0x02,0x13,0x00,0x00,0x29,
+0x1f,0x0e,0x02,0x52,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x6f,0x5f,0x6c,
+0x6f,0x63,0x61,0x6c,0x28,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x6f,0x6b,0x2e,0x70,
+0x6f,0x73,0x2c,0x20,0x27,0x6e,0x61,0x6d,0x65,0x27,0x2c,0x20,0x27,0x5f,0x5f,0x76,
+0x61,0x72,0x61,0x72,0x67,0x73,0x5f,0x5f,0x27,0x29,0x29,0x00,0x0e,0x0b,0x00,0x0e,
+0x00,0x00,0x00,0x08,0x64,0x6f,0x5f,0x6c,0x6f,0x63,0x61,0x6c,0x00,0x00,0x00,0x00,
+0x0e,0x0d,0x00,0x0f,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x0d,0x09,0x00,0x0a,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x0e,0x00,0x09,
+0x00,0x00,0x00,0x07,0x0d,0x0f,0x00,0x10,0x00,0x00,0x00,0x04,0x6e,0x61,0x6d,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x10,0x00,0x11,0x00,0x00,0x00,0x0b,0x5f,0x5f,0x76,0x61,
+0x72,0x61,0x72,0x67,0x73,0x5f,0x5f,0x00,0x37,0x0c,0x0d,0x04,0x37,0x07,0x0b,0x02,
+0x1f,0x05,0x02,0x53,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x64,0x20,0x21,0x3d,0x20,
+0x4e,0x6f,0x6e,0x65,0x3a,0x00,0x00,0x00,0x1d,0x09,0x00,0x00,0x24,0x07,0x08,0x09,
+0x16,0x07,0x00,0x00,0x13,0x00,0x00,0x1b,0x1f,0x08,0x02,0x55,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x64,0x6f,0x5f,0x6c,0x6f,0x63,0x61,0x6c,0x28,0x64,0x2e,0x69,
+0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x29,0x00,0x00,0x00,0x00,0x0e,0x0b,0x00,0x0e,
+0x00,0x00,0x00,0x08,0x64,0x6f,0x5f,0x6c,0x6f,0x63,0x61,0x6c,0x00,0x00,0x00,0x00,
+0x0d,0x09,0x00,0x02,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x09,0x0c,0x08,0x09,0x00,0x00,0x00,0x08,0x0c,0x09,0x00,0x06,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x0c,0x0c,0x09,0x37,0x07,0x0b,0x02,0x13,0x00,0x00,0x29,
+0x1f,0x0e,0x02,0x57,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x6f,0x5f,0x6c,
+0x6f,0x63,0x61,0x6c,0x28,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x6f,0x6b,0x2e,0x70,
+0x6f,0x73,0x2c,0x20,0x27,0x6e,0x61,0x6d,0x65,0x27,0x2c,0x20,0x27,0x5f,0x5f,0x6b,
+0x77,0x61,0x72,0x67,0x73,0x5f,0x5f,0x27,0x29,0x29,0x00,0x00,0x0e,0x0b,0x00,0x0e,
+0x00,0x00,0x00,0x08,0x64,0x6f,0x5f,0x6c,0x6f,0x63,0x61,0x6c,0x00,0x00,0x00,0x00,
+0x0e,0x0d,0x00,0x0f,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x0d,0x09,0x00,0x0a,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x0e,0x00,0x09,
+0x00,0x00,0x00,0x09,0x0d,0x0f,0x00,0x10,0x00,0x00,0x00,0x04,0x6e,0x61,0x6d,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x10,0x00,0x12,0x00,0x00,0x00,0x0a,0x5f,0x5f,0x6b,0x77,
+0x61,0x72,0x67,0x73,0x5f,0x5f,0x00,0x00,0x37,0x0c,0x0d,0x04,0x37,0x07,0x0b,0x02,
+0x1f,0x07,0x02,0x58,0x20,0x20,0x20,0x20,0x6e,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,
+0x3d,0x20,0x6c,0x65,0x6e,0x28,0x44,0x2e,0x76,0x61,0x72,0x73,0x29,0x00,0x00,0x00,
+0x33,0x07,0x00,0x07,0x6e,0x70,0x61,0x72,0x61,0x6d,0x73,0x00,0x0e,0x0b,0x00,0x13,
+0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x0e,0x0c,0x00,0x07,0x00,0x00,0x00,0x01,
+0x44,0x00,0x00,0x00,0x0d,0x0d,0x00,0x14,0x00,0x00,0x00,0x04,0x76,0x61,0x72,0x73,
+0x00,0x00,0x00,0x00,0x09,0x0c,0x0c,0x0d,0x00,0x00,0x00,0x0a,0x37,0x07,0x0b,0x02,
+0x1f,0x07,0x02,0x5a,0x20,0x20,0x20,0x20,0x64,0x6f,0x5f,0x69,0x6e,0x66,0x6f,0x28,
+0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x76,0x61,0x6c,0x29,0x00,0x00,0x00,
+0x0e,0x0b,0x00,0x15,0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x69,0x6e,0x66,0x6f,0x00,
+0x0c,0x0d,0x00,0x06,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x0c,0x01,0x0d,
+0x0d,0x0d,0x00,0x16,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x09,0x0c,0x0c,0x0d,
+0x00,0x00,0x00,0x0b,0x37,0x09,0x0b,0x02,0x1f,0x08,0x02,0x5c,0x20,0x20,0x20,0x20,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x64,0x6f,0x28,0x69,0x74,0x65,0x6d,
+0x73,0x5b,0x32,0x5d,0x29,0x29,0x20,0x23,0x52,0x45,0x47,0x00,0x0e,0x0b,0x00,0x17,
+0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x0e,0x0d,0x00,0x18,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x0c,0x0f,0x00,0x0c,
+0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x0a,0x0e,0x01,0x0f,0x37,0x0c,0x0d,0x02,
+0x37,0x09,0x0b,0x02,0x1f,0x05,0x02,0x5d,0x20,0x20,0x20,0x20,0x72,0x65,0x67,0x73,
+0x20,0x3d,0x20,0x44,0x2e,0x63,0x72,0x65,0x67,0x73,0x00,0x00,0x33,0x09,0x00,0x04,
+0x72,0x65,0x67,0x73,0x00,0x00,0x00,0x00,0x0e,0x0b,0x00,0x07,0x00,0x00,0x00,0x01,
+0x44,0x00,0x00,0x00,0x0d,0x0c,0x00,0x19,0x00,0x00,0x00,0x05,0x63,0x72,0x65,0x67,
+0x73,0x00,0x00,0x00,0x09,0x09,0x0b,0x0c,0x00,0x00,0x00,0x0c,0x1f,0x03,0x02,0x5e,
+0x20,0x20,0x20,0x20,0x44,0x2e,0x65,0x6e,0x64,0x28,0x29,0x00,0x0e,0x0e,0x00,0x07,
+0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x0f,0x00,0x05,0x00,0x00,0x00,0x03,
+0x65,0x6e,0x64,0x00,0x38,0x0c,0x0e,0x0f,0x00,0x00,0x00,0x0d,0x39,0x0b,0x0c,0x02,
+0x1f,0x07,0x02,0x60,0x20,0x20,0x20,0x20,0x72,0x65,0x67,0x73,0x2e,0x61,0x70,0x70,
+0x65,0x6e,0x64,0x28,0x6e,0x70,0x61,0x72,0x61,0x6d,0x73,0x29,0x00,0x00,0x00,0x00,
+0x0d,0x0f,0x00,0x1a,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x0c,0x09,0x0f,0x00,0x00,0x00,0x0e,0x10,0x0e,0x07,0x00,0x39,0x0b,0x0c,0x03,
+0x1f,0x05,0x02,0x61,0x20,0x20,0x20,0x20,0x74,0x61,0x67,0x28,0x74,0x2c,0x20,0x27,
+0x65,0x6e,0x64,0x27,0x29,0x00,0x00,0x00,0x0e,0x0c,0x00,0x1b,0x00,0x00,0x00,0x03,
+0x74,0x61,0x67,0x00,0x10,0x0d,0x03,0x00,0x0d,0x0e,0x00,0x05,0x00,0x00,0x00,0x03,
+0x65,0x6e,0x64,0x00,0x37,0x0b,0x0c,0x03,0x1f,0x05,0x02,0x63,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x44,0x2e,0x5f,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x3a,0x00,0x00,
+0x0e,0x0b,0x00,0x07,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x0c,0x00,0x1c,
+0x00,0x00,0x00,0x08,0x5f,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x00,0x00,0x00,0x00,
+0x09,0x0b,0x0b,0x0c,0x00,0x00,0x00,0x0f,0x16,0x0b,0x00,0x00,0x13,0x00,0x00,0x2a,
+0x1f,0x0d,0x02,0x64,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x6f,0x5f,0x67,
+0x6c,0x6f,0x62,0x61,0x6c,0x73,0x28,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x6f,0x6b,
+0x2e,0x70,0x6f,0x73,0x2c,0x30,0x2c,0x30,0x2c,0x5b,0x69,0x74,0x65,0x6d,0x73,0x5b,
+0x30,0x5d,0x5d,0x29,0x29,0x00,0x00,0x00,0x0e,0x0c,0x00,0x1d,0x00,0x00,0x00,0x0a,
+0x64,0x6f,0x5f,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x00,0x00,0x0e,0x0e,0x00,0x0f,
+0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0d,0x13,0x00,0x0a,
+0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x0f,0x00,0x13,0x00,0x00,0x00,0x10,
+0x0c,0x10,0x00,0x06,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0c,0x11,0x00,0x06,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0c,0x14,0x00,0x06,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x13,0x01,0x14,0x1c,0x12,0x13,0x01,0x37,0x0d,0x0e,0x05,
+0x37,0x0b,0x0c,0x02,0x1f,0x0f,0x02,0x65,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x28,0x64,0x6f,0x5f,0x73,0x65,0x74,0x5f,0x63,0x74,0x78,0x28,
+0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,
+0x6f,0x6b,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x72,0x65,0x67,0x27,0x2c,0x72,0x66,0x29,
+0x29,0x29,0x00,0x00,0x0e,0x0c,0x00,0x17,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x0e,0x0e,0x00,0x1e,0x00,0x00,0x00,0x0a,
+0x64,0x6f,0x5f,0x73,0x65,0x74,0x5f,0x63,0x74,0x78,0x00,0x00,0x0c,0x11,0x00,0x06,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x0f,0x01,0x11,0x0e,0x11,0x00,0x0f,
+0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0d,0x01,0x00,0x0a,
+0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x12,0x00,0x01,0x00,0x00,0x00,0x11,
+0x0d,0x13,0x00,0x1f,0x00,0x00,0x00,0x03,0x72,0x65,0x67,0x00,0x10,0x14,0x02,0x00,
+0x37,0x10,0x11,0x04,0x37,0x0d,0x0e,0x03,0x37,0x0b,0x0c,0x02,0x1f,0x05,0x02,0x67,
+0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x72,0x66,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x0c,0x00,0x17,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x0d,0x02,0x00,0x37,0x0b,0x0c,0x02,
+0x00,0x00,0x00,0x00,0x0d,0x35,0x00,0x5d,0x00,0x00,0x00,0x06,0x64,0x6f,0x5f,0x64,
+0x65,0x66,0x00,0x00,0x0f,0x35,0x34,0x00,0x1f,0x05,0x02,0x69,0x64,0x65,0x66,0x20,
+0x64,0x6f,0x5f,0x63,0x6c,0x61,0x73,0x73,0x28,0x74,0x6f,0x6b,0x29,0x3a,0x00,0x00,
+0x33,0x35,0x00,0x05,0x2a,0x24,0x34,0x36,0x38,0x00,0x00,0x00,0x0d,0x3a,0x00,0x2f,
+0x00,0x00,0x00,0x03,0x74,0x6f,0x6b,0x00,0x1c,0x36,0x3a,0x01,0x1c,0x37,0x00,0x00,
+0x1d,0x38,0x00,0x00,0x1d,0x39,0x00,0x00,0x11,0x35,0x03,0x43,0x2d,0x17,0x00,0x27,
+0x00,0x00,0x00,0x11,0x1f,0x05,0x02,0x69,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x63,
+0x6c,0x61,0x73,0x73,0x28,0x74,0x6f,0x6b,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x03,
+0x74,0x6f,0x6b,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,
+0x00,0x00,0x00,0x08,0x64,0x6f,0x5f,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,
+0x23,0x01,0x00,0x00,0x1f,0x06,0x02,0x6a,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,
+0x73,0x20,0x3d,0x20,0x74,0x6f,0x6b,0x2e,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x33,0x01,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x0d,0x02,0x00,0x02,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x01,0x00,0x02,
+0x00,0x00,0x00,0x00,0x1f,0x05,0x02,0x6b,0x20,0x20,0x20,0x20,0x70,0x61,0x72,0x65,
+0x6e,0x74,0x20,0x3d,0x20,0x4e,0x6f,0x6e,0x65,0x00,0x00,0x00,0x33,0x03,0x00,0x06,
+0x70,0x61,0x72,0x65,0x6e,0x74,0x00,0x00,0x1d,0x03,0x00,0x00,0x1f,0x08,0x02,0x6c,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x2e,
+0x74,0x79,0x70,0x65,0x20,0x3d,0x3d,0x20,0x27,0x6e,0x61,0x6d,0x65,0x27,0x3a,0x00,
+0x0c,0x04,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x02,0x01,0x04,
+0x0d,0x04,0x00,0x04,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,
+0x09,0x02,0x02,0x04,0x00,0x00,0x00,0x01,0x0d,0x04,0x00,0x05,0x00,0x00,0x00,0x04,
+0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,0x18,0x02,0x02,0x04,0x16,0x02,0x00,0x00,
+0x13,0x00,0x00,0x2f,0x1f,0x06,0x02,0x6d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x00,
+0x33,0x02,0x00,0x04,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,0x0c,0x05,0x00,0x03,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x02,0x01,0x05,0x1f,0x0c,0x02,0x6e,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x61,0x72,0x65,0x6e,0x74,0x20,0x3d,
+0x20,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x6f,0x6b,0x2e,0x70,0x6f,0x73,0x2c,0x27,
+0x6e,0x61,0x6d,0x65,0x27,0x2c,0x27,0x6f,0x62,0x6a,0x65,0x63,0x74,0x27,0x29,0x00,
+0x0e,0x05,0x00,0x06,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x0d,0x09,0x00,0x07,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x06,0x00,0x09,
+0x00,0x00,0x00,0x02,0x0d,0x07,0x00,0x05,0x00,0x00,0x00,0x04,0x6e,0x61,0x6d,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x08,0x00,0x08,0x00,0x00,0x00,0x06,0x6f,0x62,0x6a,0x65,
+0x63,0x74,0x00,0x00,0x37,0x03,0x05,0x04,0x13,0x00,0x00,0x35,0x1f,0x03,0x02,0x6f,
+0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x3a,0x00,0x00,0x00,0x1f,0x09,0x02,0x70,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x69,
+0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,
+0x00,0x00,0x00,0x00,0x0c,0x05,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x04,0x01,0x05,0x0d,0x05,0x00,0x02,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x09,0x04,0x04,0x05,0x00,0x00,0x00,0x03,0x0c,0x05,0x00,0x03,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x02,0x04,0x05,0x1f,0x09,0x02,0x71,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x61,0x72,0x65,0x6e,0x74,0x20,0x3d,
+0x20,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,
+0x31,0x5d,0x00,0x00,0x0c,0x05,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x04,0x01,0x05,0x0d,0x05,0x00,0x02,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x09,0x04,0x04,0x05,0x00,0x00,0x00,0x04,0x0c,0x05,0x00,0x09,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x03,0x04,0x05,0x1f,0x05,0x02,0x73,
+0x20,0x20,0x20,0x20,0x6b,0x6c,0x73,0x20,0x3d,0x20,0x67,0x65,0x74,0x5f,0x74,0x6d,
+0x70,0x28,0x29,0x00,0x33,0x04,0x00,0x03,0x6b,0x6c,0x73,0x00,0x0e,0x06,0x00,0x0a,
+0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x00,0x37,0x04,0x06,0x01,
+0x1f,0x06,0x02,0x74,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x28,0x43,0x4c,0x41,
+0x53,0x53,0x2c,0x20,0x6b,0x6c,0x73,0x29,0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x0b,
+0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0e,0x07,0x00,0x0c,
+0x00,0x00,0x00,0x05,0x43,0x4c,0x41,0x53,0x53,0x00,0x00,0x00,0x10,0x08,0x04,0x00,
+0x37,0x05,0x06,0x03,0x1f,0x04,0x02,0x75,0x20,0x20,0x20,0x20,0x75,0x6e,0x5f,0x74,
+0x6d,0x70,0x28,0x6b,0x6c,0x73,0x29,0x00,0x0e,0x06,0x00,0x0d,0x00,0x00,0x00,0x06,
+0x75,0x6e,0x5f,0x74,0x6d,0x70,0x00,0x00,0x10,0x07,0x04,0x00,0x37,0x05,0x06,0x02,
+0x1f,0x0a,0x02,0x76,0x20,0x20,0x20,0x20,0x74,0x73,0x20,0x3d,0x20,0x64,0x6f,0x5f,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x28,0x6e,0x61,0x6d,0x65,0x2e,0x61,0x73,0x5f,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x28,0x29,0x29,0x00,0x00,0x00,0x00,0x33,0x05,0x00,0x02,
+0x74,0x73,0x00,0x00,0x0e,0x07,0x00,0x0e,0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,0x0d,0x0b,0x00,0x0f,0x00,0x00,0x00,0x09,
+0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,0x38,0x09,0x02,0x0b,
+0x00,0x00,0x00,0x05,0x39,0x08,0x09,0x02,0x37,0x05,0x07,0x02,0x1f,0x06,0x02,0x77,
+0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x28,0x47,0x53,0x45,0x54,0x2c,0x74,0x73,
+0x2c,0x6b,0x6c,0x73,0x29,0x00,0x00,0x00,0x0e,0x07,0x00,0x0b,0x00,0x00,0x00,0x04,
+0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0e,0x08,0x00,0x10,0x00,0x00,0x00,0x04,
+0x47,0x53,0x45,0x54,0x00,0x00,0x00,0x00,0x10,0x09,0x05,0x00,0x10,0x0a,0x04,0x00,
+0x37,0x06,0x07,0x04,0x1f,0x06,0x02,0x78,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x28,0x74,0x73,0x29,0x20,0x23,0x52,0x45,0x47,0x00,0x00,0x00,
+0x0e,0x07,0x00,0x11,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x00,0x00,0x00,0x00,0x10,0x08,0x05,0x00,0x37,0x06,0x07,0x02,0x1f,0x0b,0x02,0x7a,
+0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x64,0x6f,0x28,
+0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x6f,0x6b,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x63,
+0x61,0x6c,0x6c,0x27,0x2c,0x4e,0x6f,0x6e,0x65,0x2c,0x5b,0x00,0x0e,0x07,0x00,0x11,
+0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x0e,0x09,0x00,0x12,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x0e,0x0b,0x00,0x06,
+0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0d,0x10,0x00,0x07,
+0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x0c,0x00,0x10,0x00,0x00,0x00,0x06,
+0x0d,0x0d,0x00,0x13,0x00,0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,
+0x1d,0x0e,0x00,0x00,0x1f,0x0b,0x02,0x7b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x6f,0x6b,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x6e,
+0x61,0x6d,0x65,0x27,0x2c,0x27,0x73,0x65,0x74,0x6d,0x65,0x74,0x61,0x27,0x29,0x2c,
+0x00,0x00,0x00,0x00,0x0e,0x13,0x00,0x06,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x0d,0x05,0x00,0x07,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,
+0x09,0x14,0x00,0x05,0x00,0x00,0x00,0x07,0x0d,0x15,0x00,0x05,0x00,0x00,0x00,0x04,
+0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,0x0d,0x16,0x00,0x14,0x00,0x00,0x00,0x07,
+0x73,0x65,0x74,0x6d,0x65,0x74,0x61,0x00,0x37,0x10,0x13,0x04,0x1f,0x09,0x02,0x7c,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x6f,
+0x6b,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x72,0x65,0x67,0x27,0x2c,0x6b,0x6c,0x73,0x29,
+0x2c,0x00,0x00,0x00,0x0e,0x13,0x00,0x06,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x0d,0x05,0x00,0x07,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,
+0x09,0x14,0x00,0x05,0x00,0x00,0x00,0x08,0x0d,0x15,0x00,0x15,0x00,0x00,0x00,0x03,
+0x72,0x65,0x67,0x00,0x10,0x16,0x04,0x00,0x37,0x11,0x13,0x04,0x1f,0x05,0x02,0x7d,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x61,0x72,0x65,0x6e,0x74,0x5d,0x29,
+0x29,0x29,0x00,0x00,0x10,0x12,0x03,0x00,0x1c,0x0f,0x10,0x03,0x37,0x0a,0x0b,0x05,
+0x37,0x08,0x09,0x02,0x37,0x06,0x07,0x02,0x1f,0x06,0x02,0x7e,0x20,0x20,0x20,0x20,
+0x66,0x72,0x65,0x65,0x5f,0x72,0x65,0x67,0x28,0x6b,0x6c,0x73,0x29,0x20,0x23,0x52,
+0x45,0x47,0x00,0x00,0x0e,0x07,0x00,0x16,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,
+0x5f,0x72,0x65,0x67,0x00,0x00,0x00,0x00,0x10,0x08,0x04,0x00,0x37,0x06,0x07,0x02,
+0x1f,0x09,0x02,0x81,0x20,0x20,0x20,0x20,0x72,0x66,0x2c,0x20,0x74,0x20,0x3d,0x20,
+0x64,0x65,0x66,0x66,0x6e,0x63,0x28,0x74,0x6f,0x6b,0x2c,0x20,0x5b,0x5d,0x2c,0x20,
+0x27,0x65,0x6e,0x64,0x27,0x29,0x00,0x00,0x0e,0x07,0x00,0x17,0x00,0x00,0x00,0x06,
+0x64,0x65,0x66,0x66,0x6e,0x63,0x00,0x00,0x10,0x08,0x00,0x00,0x1c,0x09,0x00,0x00,
+0x0d,0x0a,0x00,0x18,0x00,0x00,0x00,0x03,0x65,0x6e,0x64,0x00,0x37,0x06,0x07,0x04,
+0x33,0x06,0x00,0x04,0x2a,0x24,0x37,0x35,0x00,0x00,0x00,0x00,0x33,0x07,0x00,0x02,
+0x72,0x66,0x00,0x00,0x0c,0x09,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x07,0x06,0x09,0x33,0x08,0x00,0x01,0x74,0x00,0x00,0x00,0x0c,0x0a,0x00,0x09,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x08,0x06,0x0a,0x1f,0x04,0x02,0x83,
+0x20,0x20,0x20,0x20,0x44,0x2e,0x62,0x65,0x67,0x69,0x6e,0x28,0x29,0x00,0x00,0x00,
+0x0e,0x0b,0x00,0x19,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x0c,0x00,0x1a,
+0x00,0x00,0x00,0x05,0x62,0x65,0x67,0x69,0x6e,0x00,0x00,0x00,0x38,0x09,0x0b,0x0c,
+0x00,0x00,0x00,0x09,0x39,0x06,0x09,0x02,0x1f,0x05,0x02,0x84,0x20,0x20,0x20,0x20,
+0x73,0x65,0x74,0x70,0x6f,0x73,0x28,0x74,0x6f,0x6b,0x2e,0x70,0x6f,0x73,0x29,0x00,
+0x0e,0x09,0x00,0x1b,0x00,0x00,0x00,0x06,0x73,0x65,0x74,0x70,0x6f,0x73,0x00,0x00,
+0x0d,0x0b,0x00,0x07,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x0a,0x00,0x0b,
+0x00,0x00,0x00,0x0a,0x37,0x06,0x09,0x02,0x1f,0x08,0x02,0x86,0x20,0x20,0x20,0x20,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x64,0x6f,0x28,0x69,0x74,0x65,0x6d,
+0x73,0x5b,0x31,0x5d,0x29,0x29,0x20,0x23,0x52,0x45,0x47,0x00,0x0e,0x09,0x00,0x11,
+0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x0e,0x0b,0x00,0x12,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x0c,0x0d,0x00,0x09,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x0c,0x01,0x0d,0x37,0x0a,0x0b,0x02,
+0x37,0x06,0x09,0x02,0x1f,0x0b,0x02,0x8b,0x20,0x20,0x20,0x20,0x6b,0x6c,0x73,0x20,
+0x3d,0x20,0x5f,0x64,0x6f,0x5f,0x67,0x67,0x65,0x74,0x28,0x6e,0x61,0x6d,0x65,0x2e,
+0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x28,0x29,0x2e,0x76,0x61,0x6c,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x09,0x00,0x1c,0x00,0x00,0x00,0x08,0x5f,0x64,0x6f,0x5f,
+0x67,0x67,0x65,0x74,0x00,0x00,0x00,0x00,0x0d,0x0d,0x00,0x0f,0x00,0x00,0x00,0x09,
+0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,0x38,0x0b,0x02,0x0d,
+0x00,0x00,0x00,0x0b,0x39,0x0a,0x0b,0x02,0x0d,0x0b,0x00,0x1d,0x00,0x00,0x00,0x03,
+0x76,0x61,0x6c,0x00,0x09,0x0a,0x0a,0x0b,0x00,0x00,0x00,0x0c,0x37,0x04,0x09,0x02,
+0x1f,0x04,0x02,0x8c,0x20,0x20,0x20,0x20,0x75,0x6e,0x5f,0x74,0x6d,0x70,0x28,0x6b,
+0x6c,0x73,0x29,0x00,0x0e,0x09,0x00,0x0d,0x00,0x00,0x00,0x06,0x75,0x6e,0x5f,0x74,
+0x6d,0x70,0x00,0x00,0x10,0x0a,0x04,0x00,0x37,0x06,0x09,0x02,0x1f,0x06,0x02,0x8d,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x76,0x61,0x6c,0x20,0x69,0x6e,0x20,0x44,
+0x2e,0x76,0x61,0x72,0x73,0x3a,0x00,0x00,0x0e,0x09,0x00,0x19,0x00,0x00,0x00,0x01,
+0x44,0x00,0x00,0x00,0x0d,0x0a,0x00,0x1e,0x00,0x00,0x00,0x04,0x76,0x61,0x72,0x73,
+0x00,0x00,0x00,0x00,0x09,0x09,0x09,0x0a,0x00,0x00,0x00,0x0d,0x0c,0x0a,0x00,0x03,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x06,0x09,0x0a,0x13,0x00,0x00,0x6a,
+0x33,0x0b,0x00,0x03,0x76,0x61,0x6c,0x00,0x10,0x0b,0x06,0x00,0x1f,0x0c,0x02,0x8e,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x61,0x6c,0x5f,0x6e,0x61,0x6d,0x65,
+0x20,0x3d,0x20,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x6f,0x6b,0x2e,0x70,0x6f,0x73,
+0x2c,0x27,0x6e,0x61,0x6d,0x65,0x27,0x2c,0x76,0x61,0x6c,0x29,0x00,0x00,0x00,0x00,
+0x33,0x06,0x00,0x08,0x76,0x61,0x6c,0x5f,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,
+0x0e,0x0d,0x00,0x06,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x0d,0x11,0x00,0x07,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x0e,0x00,0x11,
+0x00,0x00,0x00,0x0e,0x0d,0x0f,0x00,0x05,0x00,0x00,0x00,0x04,0x6e,0x61,0x6d,0x65,
+0x00,0x00,0x00,0x00,0x10,0x10,0x0b,0x00,0x37,0x06,0x0d,0x04,0x1f,0x0c,0x02,0x8f,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x73,0x20,0x3d,0x20,0x64,0x6f,0x5f,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x28,0x76,0x61,0x6c,0x5f,0x6e,0x61,0x6d,0x65,0x2e,
+0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x28,0x29,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x0d,0x00,0x0e,0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x00,0x00,0x00,0x0d,0x11,0x00,0x0f,0x00,0x00,0x00,0x09,0x61,0x73,0x5f,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,0x38,0x0f,0x06,0x11,0x00,0x00,0x00,0x0f,
+0x39,0x0e,0x0f,0x02,0x37,0x05,0x0d,0x02,0x1f,0x0a,0x02,0x90,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x28,0x53,0x45,0x54,0x2c,0x6b,0x6c,0x73,
+0x2c,0x20,0x74,0x73,0x2c,0x20,0x67,0x65,0x74,0x5f,0x72,0x65,0x67,0x28,0x76,0x61,
+0x6c,0x29,0x29,0x00,0x0e,0x0d,0x00,0x0b,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,
+0x00,0x00,0x00,0x00,0x0e,0x0e,0x00,0x1f,0x00,0x00,0x00,0x03,0x53,0x45,0x54,0x00,
+0x10,0x0f,0x04,0x00,0x10,0x10,0x05,0x00,0x0e,0x12,0x00,0x20,0x00,0x00,0x00,0x07,
+0x67,0x65,0x74,0x5f,0x72,0x65,0x67,0x00,0x10,0x13,0x0b,0x00,0x37,0x11,0x12,0x02,
+0x37,0x0c,0x0d,0x05,0x1f,0x07,0x02,0x91,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x74,0x73,0x29,0x20,0x23,0x52,0x45,
+0x47,0x00,0x00,0x00,0x0e,0x0d,0x00,0x11,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x0e,0x05,0x00,0x37,0x0c,0x0d,0x02,
+0x13,0x00,0xff,0x96,0x1f,0x05,0x02,0x92,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,
+0x5f,0x72,0x65,0x67,0x28,0x6b,0x6c,0x73,0x29,0x00,0x00,0x00,0x0e,0x0c,0x00,0x16,
+0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x72,0x65,0x67,0x00,0x00,0x00,0x00,
+0x10,0x0d,0x04,0x00,0x37,0x09,0x0c,0x02,0x1f,0x03,0x02,0x93,0x20,0x20,0x20,0x20,
+0x44,0x2e,0x65,0x6e,0x64,0x28,0x29,0x00,0x0e,0x0a,0x00,0x19,0x00,0x00,0x00,0x01,
+0x44,0x00,0x00,0x00,0x0d,0x0e,0x00,0x18,0x00,0x00,0x00,0x03,0x65,0x6e,0x64,0x00,
+0x38,0x0c,0x0a,0x0e,0x00,0x00,0x00,0x10,0x39,0x09,0x0c,0x02,0x1f,0x05,0x02,0x95,
+0x20,0x20,0x20,0x20,0x74,0x61,0x67,0x28,0x74,0x2c,0x27,0x65,0x6e,0x64,0x27,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x0c,0x00,0x21,0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,
+0x10,0x0d,0x08,0x00,0x0d,0x0e,0x00,0x18,0x00,0x00,0x00,0x03,0x65,0x6e,0x64,0x00,
+0x37,0x09,0x0c,0x03,0x1f,0x0a,0x02,0x97,0x20,0x20,0x20,0x20,0x74,0x6d,0x70,0x2c,
+0x20,0x6c,0x70,0x61,0x72,0x61,0x6d,0x73,0x2c,0x20,0x64,0x70,0x61,0x72,0x61,0x6d,
+0x73,0x20,0x3d,0x20,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x73,0x28,0x33,0x29,0x00,
+0x0e,0x0c,0x00,0x22,0x00,0x00,0x00,0x08,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x73,
+0x00,0x00,0x00,0x00,0x0c,0x0d,0x00,0x23,0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,
+0x37,0x09,0x0c,0x02,0x33,0x09,0x00,0x05,0x2a,0x24,0x31,0x34,0x38,0x00,0x00,0x00,
+0x33,0x0a,0x00,0x03,0x74,0x6d,0x70,0x00,0x0c,0x0d,0x00,0x03,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x0a,0x09,0x0d,0x33,0x0c,0x00,0x07,0x6c,0x70,0x61,0x72,
+0x61,0x6d,0x73,0x00,0x0c,0x0e,0x00,0x09,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x0c,0x09,0x0e,0x33,0x0d,0x00,0x07,0x64,0x70,0x61,0x72,0x61,0x6d,0x73,0x00,
+0x0c,0x0f,0x00,0x24,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x0a,0x0d,0x09,0x0f,
+0x1f,0x06,0x02,0x98,0x20,0x20,0x20,0x20,0x5f,0x64,0x6f,0x5f,0x6e,0x6f,0x6e,0x65,
+0x28,0x6c,0x70,0x61,0x72,0x61,0x6d,0x73,0x29,0x00,0x00,0x00,0x0e,0x0e,0x00,0x25,
+0x00,0x00,0x00,0x08,0x5f,0x64,0x6f,0x5f,0x6e,0x6f,0x6e,0x65,0x00,0x00,0x00,0x00,
+0x10,0x0f,0x0c,0x00,0x37,0x09,0x0e,0x02,0x1f,0x06,0x02,0x99,0x20,0x20,0x20,0x20,
+0x5f,0x64,0x6f,0x5f,0x6e,0x6f,0x6e,0x65,0x28,0x64,0x70,0x61,0x72,0x61,0x6d,0x73,
+0x29,0x00,0x00,0x00,0x0e,0x0e,0x00,0x25,0x00,0x00,0x00,0x08,0x5f,0x64,0x6f,0x5f,
+0x6e,0x6f,0x6e,0x65,0x00,0x00,0x00,0x00,0x10,0x0f,0x0d,0x00,0x37,0x09,0x0e,0x02,
+0x1f,0x09,0x02,0x9a,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x28,0x43,0x41,0x4c,
+0x4c,0x2c,0x20,0x74,0x6d,0x70,0x2c,0x20,0x72,0x66,0x2c,0x20,0x6c,0x70,0x61,0x72,
+0x61,0x6d,0x73,0x29,0x00,0x00,0x00,0x00,0x0e,0x0e,0x00,0x0b,0x00,0x00,0x00,0x04,
+0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0e,0x0f,0x00,0x26,0x00,0x00,0x00,0x04,
+0x43,0x41,0x4c,0x4c,0x00,0x00,0x00,0x00,0x10,0x10,0x0a,0x00,0x10,0x11,0x07,0x00,
+0x10,0x12,0x0c,0x00,0x37,0x09,0x0e,0x05,0x1f,0x05,0x02,0x9b,0x20,0x20,0x20,0x20,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x72,0x66,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x0e,0x00,0x11,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x00,0x00,0x00,0x00,0x10,0x0f,0x07,0x00,0x37,0x09,0x0e,0x02,0x1f,0x05,0x02,0x9c,
+0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x74,0x6d,0x70,
+0x29,0x00,0x00,0x00,0x0e,0x0e,0x00,0x11,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x0f,0x0a,0x00,0x37,0x09,0x0e,0x02,
+0x1f,0x06,0x02,0x9d,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x28,0x6c,0x70,0x61,0x72,0x61,0x6d,0x73,0x29,0x00,0x00,0x00,0x0e,0x0e,0x00,0x11,
+0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x10,0x0f,0x0c,0x00,0x37,0x09,0x0e,0x02,0x1f,0x06,0x02,0x9e,0x20,0x20,0x20,0x20,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x64,0x70,0x61,0x72,0x61,0x6d,0x73,
+0x29,0x00,0x00,0x00,0x0e,0x0e,0x00,0x11,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x0f,0x0d,0x00,0x37,0x09,0x0e,0x02,
+0x00,0x00,0x00,0x00,0x0d,0x36,0x00,0x5e,0x00,0x00,0x00,0x08,0x64,0x6f,0x5f,0x63,
+0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x0f,0x36,0x35,0x00,0x1f,0x05,0x02,0xa0,
+0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x77,0x68,0x69,0x6c,0x65,0x28,0x74,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x36,0x00,0x05,0x2a,0x24,0x34,0x37,0x35,0x00,0x00,0x00,
+0x0d,0x3b,0x00,0x21,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x1c,0x37,0x3b,0x01,
+0x1c,0x38,0x00,0x00,0x1d,0x39,0x00,0x00,0x1d,0x3a,0x00,0x00,0x11,0x36,0x00,0xe0,
+0x2d,0x07,0x00,0x11,0x00,0x00,0x00,0x01,0x1f,0x05,0x02,0xa0,0x64,0x65,0x66,0x20,
+0x64,0x6f,0x5f,0x77,0x68,0x69,0x6c,0x65,0x28,0x74,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x08,0x64,0x6f,0x5f,0x77,0x68,0x69,0x6c,0x65,
+0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x05,0x02,0xa1,0x20,0x20,0x20,0x20,
+0x69,0x74,0x65,0x6d,0x73,0x20,0x3d,0x20,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x00,
+0x33,0x01,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x0d,0x02,0x00,0x02,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x01,0x00,0x02,
+0x00,0x00,0x00,0x00,0x1f,0x05,0x02,0xa2,0x20,0x20,0x20,0x20,0x74,0x20,0x3d,0x20,
+0x73,0x74,0x61,0x63,0x6b,0x5f,0x74,0x61,0x67,0x28,0x29,0x00,0x0e,0x02,0x00,0x03,
+0x00,0x00,0x00,0x09,0x73,0x74,0x61,0x63,0x6b,0x5f,0x74,0x61,0x67,0x00,0x00,0x00,
+0x37,0x00,0x02,0x01,0x1f,0x05,0x02,0xa3,0x20,0x20,0x20,0x20,0x74,0x61,0x67,0x28,
+0x74,0x2c,0x27,0x62,0x65,0x67,0x69,0x6e,0x27,0x29,0x00,0x00,0x0e,0x02,0x00,0x04,
+0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,0x10,0x03,0x00,0x00,0x0d,0x04,0x00,0x05,
+0x00,0x00,0x00,0x05,0x62,0x65,0x67,0x69,0x6e,0x00,0x00,0x00,0x37,0x05,0x02,0x03,
+0x1f,0x06,0x02,0xa4,0x20,0x20,0x20,0x20,0x74,0x61,0x67,0x28,0x74,0x2c,0x27,0x63,
+0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x27,0x29,0x00,0x00,0x00,0x0e,0x02,0x00,0x04,
+0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,0x10,0x03,0x00,0x00,0x0d,0x04,0x00,0x06,
+0x00,0x00,0x00,0x08,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x00,0x00,0x00,0x00,
+0x37,0x05,0x02,0x03,0x1f,0x06,0x02,0xa5,0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,
+0x64,0x6f,0x28,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x29,0x00,0x00,0x00,0x00,
+0x33,0x05,0x00,0x01,0x72,0x00,0x00,0x00,0x0e,0x03,0x00,0x07,0x00,0x00,0x00,0x02,
+0x64,0x6f,0x00,0x00,0x0c,0x05,0x00,0x08,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x04,0x01,0x05,0x37,0x05,0x03,0x02,0x1f,0x04,0x02,0xa6,0x20,0x20,0x20,0x20,
+0x63,0x6f,0x64,0x65,0x28,0x49,0x46,0x2c,0x72,0x29,0x00,0x00,0x0e,0x03,0x00,0x09,
+0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0e,0x04,0x00,0x0a,
+0x00,0x00,0x00,0x02,0x49,0x46,0x00,0x00,0x37,0x02,0x03,0x03,0x1f,0x06,0x02,0xa7,
+0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x72,0x29,0x20,
+0x23,0x52,0x45,0x47,0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x0b,0x00,0x00,0x00,0x08,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x04,0x05,0x00,
+0x37,0x02,0x03,0x02,0x1f,0x05,0x02,0xa8,0x20,0x20,0x20,0x20,0x6a,0x75,0x6d,0x70,
+0x28,0x74,0x2c,0x27,0x65,0x6e,0x64,0x27,0x29,0x00,0x00,0x00,0x0e,0x03,0x00,0x0c,
+0x00,0x00,0x00,0x04,0x6a,0x75,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x04,0x00,0x00,
+0x0d,0x05,0x00,0x0d,0x00,0x00,0x00,0x03,0x65,0x6e,0x64,0x00,0x37,0x02,0x03,0x03,
+0x1f,0x08,0x02,0xa9,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x28,0x64,0x6f,0x28,0x69,0x74,0x65,0x6d,0x73,0x5b,0x31,0x5d,0x29,0x29,0x20,0x23,
+0x52,0x45,0x47,0x00,0x0e,0x03,0x00,0x0b,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x07,0x00,0x00,0x00,0x02,
+0x64,0x6f,0x00,0x00,0x0c,0x02,0x00,0x0e,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x06,0x01,0x02,0x37,0x04,0x05,0x02,0x37,0x02,0x03,0x02,0x1f,0x05,0x02,0xaa,
+0x20,0x20,0x20,0x20,0x6a,0x75,0x6d,0x70,0x28,0x74,0x2c,0x27,0x62,0x65,0x67,0x69,
+0x6e,0x27,0x29,0x00,0x0e,0x03,0x00,0x0c,0x00,0x00,0x00,0x04,0x6a,0x75,0x6d,0x70,
+0x00,0x00,0x00,0x00,0x10,0x04,0x00,0x00,0x0d,0x05,0x00,0x05,0x00,0x00,0x00,0x05,
+0x62,0x65,0x67,0x69,0x6e,0x00,0x00,0x00,0x37,0x02,0x03,0x03,0x1f,0x05,0x02,0xab,
+0x20,0x20,0x20,0x20,0x74,0x61,0x67,0x28,0x74,0x2c,0x27,0x62,0x72,0x65,0x61,0x6b,
+0x27,0x29,0x00,0x00,0x0e,0x03,0x00,0x04,0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,
+0x10,0x04,0x00,0x00,0x0d,0x05,0x00,0x0f,0x00,0x00,0x00,0x05,0x62,0x72,0x65,0x61,
+0x6b,0x00,0x00,0x00,0x37,0x02,0x03,0x03,0x1f,0x05,0x02,0xac,0x20,0x20,0x20,0x20,
+0x74,0x61,0x67,0x28,0x74,0x2c,0x27,0x65,0x6e,0x64,0x27,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x03,0x00,0x04,0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,0x10,0x04,0x00,0x00,
+0x0d,0x05,0x00,0x0d,0x00,0x00,0x00,0x03,0x65,0x6e,0x64,0x00,0x37,0x02,0x03,0x03,
+0x1f,0x04,0x02,0xad,0x20,0x20,0x20,0x20,0x70,0x6f,0x70,0x5f,0x74,0x61,0x67,0x28,
+0x29,0x00,0x00,0x00,0x0e,0x03,0x00,0x10,0x00,0x00,0x00,0x07,0x70,0x6f,0x70,0x5f,
+0x74,0x61,0x67,0x00,0x37,0x02,0x03,0x01,0x00,0x00,0x00,0x00,0x0d,0x37,0x00,0x5f,
+0x00,0x00,0x00,0x08,0x64,0x6f,0x5f,0x77,0x68,0x69,0x6c,0x65,0x00,0x00,0x00,0x00,
+0x0f,0x37,0x36,0x00,0x1f,0x06,0x02,0xaf,0x64,0x65,0x66,0x20,0x69,0x73,0x5f,0x72,
+0x61,0x6e,0x67,0x65,0x5f,0x63,0x61,0x6c,0x6c,0x28,0x74,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x37,0x00,0x05,0x2a,0x24,0x34,0x38,0x32,0x00,0x00,0x00,0x0d,0x3c,0x00,0x21,
+0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x1c,0x38,0x3c,0x01,0x1c,0x39,0x00,0x00,
+0x1d,0x3a,0x00,0x00,0x1d,0x3b,0x00,0x00,0x11,0x37,0x00,0xf8,0x2d,0x08,0x00,0x10,
+0x00,0x00,0x00,0x09,0x1f,0x06,0x02,0xaf,0x64,0x65,0x66,0x20,0x69,0x73,0x5f,0x72,
+0x61,0x6e,0x67,0x65,0x5f,0x63,0x61,0x6c,0x6c,0x28,0x74,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x0d,0x69,0x73,0x5f,0x72,0x61,0x6e,0x67,0x65,
+0x5f,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x11,0x02,0xb1,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,0x2e,0x74,0x79,0x70,0x65,0x20,0x21,0x3d,
+0x20,0x27,0x63,0x61,0x6c,0x6c,0x27,0x20,0x6f,0x72,0x20,0x74,0x2e,0x69,0x74,0x65,
+0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x74,0x79,0x70,0x65,0x20,0x21,0x3d,0x20,0x27,0x6e,
+0x61,0x6d,0x65,0x27,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x46,0x61,0x6c,
+0x73,0x65,0x00,0x00,0x0d,0x02,0x00,0x02,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,
+0x00,0x00,0x00,0x00,0x09,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x03,
+0x00,0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x24,0x01,0x01,0x02,
+0x2f,0x01,0x00,0x00,0x13,0x00,0x00,0x16,0x0d,0x02,0x00,0x04,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x01,0x00,0x02,0x00,0x00,0x00,0x01,
+0x0c,0x02,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x01,0x01,0x02,
+0x0d,0x02,0x00,0x02,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,
+0x09,0x01,0x01,0x02,0x00,0x00,0x00,0x02,0x0d,0x02,0x00,0x06,0x00,0x00,0x00,0x04,
+0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,0x24,0x01,0x01,0x02,0x16,0x01,0x00,0x00,
+0x13,0x00,0x00,0x05,0x0c,0x01,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x15,0x01,0x00,0x00,0x1f,0x13,0x02,0xb2,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,
+0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x76,0x61,0x6c,0x20,0x21,0x3d,
+0x20,0x27,0x72,0x61,0x6e,0x67,0x65,0x27,0x20,0x6f,0x72,0x20,0x74,0x2e,0x69,0x74,
+0x65,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x76,0x61,0x6c,0x20,0x69,0x6e,0x20,0x44,0x2e,
+0x76,0x61,0x72,0x73,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x46,0x61,0x6c,
+0x73,0x65,0x00,0x00,0x0d,0x02,0x00,0x04,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x09,0x01,0x00,0x02,0x00,0x00,0x00,0x03,0x0c,0x02,0x00,0x05,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x01,0x01,0x02,0x0d,0x02,0x00,0x07,
+0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x09,0x01,0x01,0x02,0x00,0x00,0x00,0x04,
+0x0d,0x02,0x00,0x08,0x00,0x00,0x00,0x05,0x72,0x61,0x6e,0x67,0x65,0x00,0x00,0x00,
+0x24,0x01,0x01,0x02,0x2f,0x01,0x00,0x00,0x13,0x00,0x00,0x1a,0x0d,0x02,0x00,0x04,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x01,0x00,0x02,
+0x00,0x00,0x00,0x05,0x0c,0x02,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x01,0x01,0x02,0x0d,0x02,0x00,0x07,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,
+0x09,0x01,0x01,0x02,0x00,0x00,0x00,0x06,0x0e,0x02,0x00,0x09,0x00,0x00,0x00,0x01,
+0x44,0x00,0x00,0x00,0x0d,0x03,0x00,0x0a,0x00,0x00,0x00,0x04,0x76,0x61,0x72,0x73,
+0x00,0x00,0x00,0x00,0x09,0x02,0x02,0x03,0x00,0x00,0x00,0x07,0x25,0x01,0x01,0x02,
+0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x05,0x0c,0x01,0x00,0x05,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x15,0x01,0x00,0x00,0x1f,0x09,0x02,0xb3,0x20,0x20,0x20,0x20,
+0x70,0x2c,0x6e,0x2c,0x6c,0x2c,0x64,0x20,0x3d,0x20,0x70,0x5f,0x66,0x69,0x6c,0x74,
+0x65,0x72,0x28,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,0x31,0x3a,0x5d,0x29,0x00,
+0x0e,0x02,0x00,0x0b,0x00,0x00,0x00,0x08,0x70,0x5f,0x66,0x69,0x6c,0x74,0x65,0x72,
+0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x04,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x09,0x03,0x00,0x04,0x00,0x00,0x00,0x08,0x0c,0x05,0x00,0x0c,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x1d,0x06,0x00,0x00,0x1c,0x04,0x05,0x02,
+0x0a,0x03,0x03,0x04,0x37,0x01,0x02,0x02,0x33,0x01,0x00,0x04,0x2a,0x24,0x32,0x31,
+0x00,0x00,0x00,0x00,0x33,0x02,0x00,0x01,0x70,0x00,0x00,0x00,0x0c,0x04,0x00,0x05,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x02,0x01,0x04,0x33,0x03,0x00,0x01,
+0x6e,0x00,0x00,0x00,0x0c,0x05,0x00,0x0c,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x03,0x01,0x05,0x33,0x04,0x00,0x01,0x6c,0x00,0x00,0x00,0x0c,0x06,0x00,0x0d,
+0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x0a,0x04,0x01,0x06,0x33,0x05,0x00,0x01,
+0x64,0x00,0x00,0x00,0x0c,0x07,0x00,0x0e,0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,
+0x0a,0x05,0x01,0x07,0x1f,0x0d,0x02,0xb4,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x6c,0x65,0x6e,0x28,0x6e,0x29,0x20,0x3d,0x3d,0x20,0x30,0x20,0x61,
+0x6e,0x64,0x20,0x6c,0x20,0x3d,0x3d,0x20,0x4e,0x6f,0x6e,0x65,0x20,0x61,0x6e,0x64,
+0x20,0x64,0x20,0x3d,0x3d,0x20,0x4e,0x6f,0x6e,0x65,0x00,0x00,0x0e,0x06,0x00,0x0f,
+0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x10,0x07,0x03,0x00,0x37,0x01,0x06,0x02,
+0x0c,0x06,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x18,0x01,0x01,0x06,
+0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x03,0x1d,0x06,0x00,0x00,0x18,0x01,0x04,0x06,
+0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x03,0x1d,0x06,0x00,0x00,0x18,0x01,0x05,0x06,
+0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x38,0x00,0x60,0x00,0x00,0x00,0x0d,
+0x69,0x73,0x5f,0x72,0x61,0x6e,0x67,0x65,0x5f,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,
+0x0f,0x38,0x37,0x00,0x1f,0x06,0x02,0xb6,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x66,
+0x6f,0x72,0x5f,0x72,0x61,0x6e,0x67,0x65,0x28,0x74,0x6f,0x6b,0x29,0x3a,0x00,0x00,
+0x33,0x38,0x00,0x05,0x2a,0x24,0x34,0x38,0x39,0x00,0x00,0x00,0x0d,0x3d,0x00,0x2f,
+0x00,0x00,0x00,0x03,0x74,0x6f,0x6b,0x00,0x1c,0x39,0x3d,0x01,0x1c,0x3a,0x00,0x00,
+0x1d,0x3b,0x00,0x00,0x1d,0x3c,0x00,0x00,0x11,0x38,0x01,0x41,0x2d,0x0e,0x00,0x1c,
+0x00,0x00,0x00,0x03,0x1f,0x06,0x02,0xb6,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x66,
+0x6f,0x72,0x5f,0x72,0x61,0x6e,0x67,0x65,0x28,0x74,0x6f,0x6b,0x29,0x3a,0x00,0x00,
+0x33,0x00,0x00,0x03,0x74,0x6f,0x6b,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x0c,0x64,0x6f,0x5f,0x66,0x6f,0x72,0x5f,0x72,
+0x61,0x6e,0x67,0x65,0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x06,0x02,0xb9,
+0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,0x73,0x20,0x3d,0x20,0x74,0x6f,0x6b,0x2e,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x33,0x01,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x0d,0x02,0x00,0x02,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x09,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x1f,0x05,0x02,0xba,
+0x20,0x20,0x20,0x20,0x72,0x65,0x67,0x20,0x3d,0x20,0x67,0x65,0x74,0x5f,0x74,0x6d,
+0x70,0x28,0x29,0x00,0x33,0x04,0x00,0x03,0x72,0x65,0x67,0x00,0x0e,0x03,0x00,0x03,
+0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x00,0x37,0x04,0x03,0x01,
+0x1f,0x05,0x02,0xbb,0x20,0x20,0x20,0x20,0x73,0x20,0x3d,0x20,0x67,0x65,0x74,0x5f,
+0x74,0x6d,0x70,0x73,0x28,0x33,0x29,0x00,0x33,0x02,0x00,0x01,0x73,0x00,0x00,0x00,
+0x0e,0x05,0x00,0x04,0x00,0x00,0x00,0x08,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x73,
+0x00,0x00,0x00,0x00,0x0c,0x06,0x00,0x05,0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,
+0x37,0x02,0x05,0x02,0x1f,0x0b,0x02,0xbc,0x20,0x20,0x20,0x20,0x6d,0x61,0x6e,0x61,
+0x67,0x65,0x5f,0x73,0x65,0x71,0x28,0x52,0x41,0x4e,0x47,0x45,0x2c,0x73,0x5b,0x30,
+0x5d,0x2c,0x69,0x74,0x65,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x69,0x74,0x65,0x6d,0x73,
+0x29,0x00,0x00,0x00,0x0e,0x05,0x00,0x06,0x00,0x00,0x00,0x0a,0x6d,0x61,0x6e,0x61,
+0x67,0x65,0x5f,0x73,0x65,0x71,0x00,0x00,0x0e,0x06,0x00,0x07,0x00,0x00,0x00,0x05,
+0x52,0x41,0x4e,0x47,0x45,0x00,0x00,0x00,0x0c,0x09,0x00,0x08,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x07,0x02,0x09,0x0c,0x09,0x00,0x09,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x08,0x01,0x09,0x0d,0x09,0x00,0x02,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x08,0x08,0x09,0x00,0x00,0x00,0x01,
+0x37,0x03,0x05,0x04,0x1f,0x0e,0x02,0xbe,0x20,0x20,0x20,0x20,0x74,0x20,0x3d,0x20,
+0x73,0x74,0x61,0x63,0x6b,0x5f,0x74,0x61,0x67,0x28,0x29,0x3b,0x20,0x74,0x61,0x67,
+0x28,0x74,0x2c,0x27,0x6c,0x6f,0x6f,0x70,0x27,0x29,0x3b,0x20,0x74,0x61,0x67,0x28,
+0x74,0x2c,0x27,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x27,0x29,0x00,0x00,0x00,
+0x33,0x03,0x00,0x01,0x74,0x00,0x00,0x00,0x0e,0x06,0x00,0x0a,0x00,0x00,0x00,0x09,
+0x73,0x74,0x61,0x63,0x6b,0x5f,0x74,0x61,0x67,0x00,0x00,0x00,0x37,0x03,0x06,0x01,
+0x0e,0x06,0x00,0x0b,0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,0x10,0x07,0x03,0x00,
+0x0d,0x08,0x00,0x0c,0x00,0x00,0x00,0x04,0x6c,0x6f,0x6f,0x70,0x00,0x00,0x00,0x00,
+0x37,0x05,0x06,0x03,0x0e,0x06,0x00,0x0b,0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,
+0x10,0x07,0x03,0x00,0x0d,0x08,0x00,0x0d,0x00,0x00,0x00,0x08,0x63,0x6f,0x6e,0x74,
+0x69,0x6e,0x75,0x65,0x00,0x00,0x00,0x00,0x37,0x05,0x06,0x03,0x1f,0x0a,0x02,0xbf,
+0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x28,0x46,0x4f,0x52,0x2c,0x72,0x65,0x67,
+0x2c,0x73,0x5b,0x30,0x5d,0x29,0x3b,0x20,0x6a,0x75,0x6d,0x70,0x28,0x74,0x2c,0x27,
+0x65,0x6e,0x64,0x27,0x29,0x00,0x00,0x00,0x0e,0x06,0x00,0x0e,0x00,0x00,0x00,0x04,
+0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0e,0x07,0x00,0x0f,0x00,0x00,0x00,0x03,
+0x46,0x4f,0x52,0x00,0x10,0x08,0x04,0x00,0x0c,0x0a,0x00,0x08,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x09,0x02,0x0a,0x37,0x05,0x06,0x04,0x0e,0x06,0x00,0x10,
+0x00,0x00,0x00,0x04,0x6a,0x75,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x07,0x03,0x00,
+0x0d,0x08,0x00,0x11,0x00,0x00,0x00,0x03,0x65,0x6e,0x64,0x00,0x37,0x05,0x06,0x03,
+0x1f,0x10,0x02,0xc0,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x28,0x64,0x6f,0x5f,0x73,0x65,0x74,0x5f,0x63,0x74,0x78,0x28,0x69,0x74,0x65,0x6d,
+0x73,0x5b,0x30,0x5d,0x2c,0x20,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x6f,0x6b,0x2e,
+0x70,0x6f,0x73,0x2c,0x20,0x27,0x72,0x65,0x67,0x27,0x2c,0x20,0x72,0x65,0x67,0x29,
+0x29,0x29,0x00,0x00,0x0e,0x06,0x00,0x12,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x0e,0x08,0x00,0x13,0x00,0x00,0x00,0x0a,
+0x64,0x6f,0x5f,0x73,0x65,0x74,0x5f,0x63,0x74,0x78,0x00,0x00,0x0c,0x0a,0x00,0x08,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x09,0x01,0x0a,0x0e,0x0a,0x00,0x14,
+0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0d,0x05,0x00,0x15,
+0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x0b,0x00,0x05,0x00,0x00,0x00,0x02,
+0x0d,0x0c,0x00,0x16,0x00,0x00,0x00,0x03,0x72,0x65,0x67,0x00,0x10,0x0d,0x04,0x00,
+0x37,0x0a,0x0a,0x04,0x37,0x07,0x08,0x03,0x37,0x05,0x06,0x02,0x1f,0x08,0x02,0xc1,
+0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x64,0x6f,0x28,
+0x69,0x74,0x65,0x6d,0x73,0x5b,0x32,0x5d,0x29,0x29,0x20,0x23,0x52,0x45,0x47,0x00,
+0x0e,0x06,0x00,0x12,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x00,0x00,0x00,0x00,0x0e,0x08,0x00,0x17,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,
+0x0c,0x0a,0x00,0x18,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x0a,0x09,0x01,0x0a,
+0x37,0x07,0x08,0x02,0x37,0x05,0x06,0x02,0x1f,0x05,0x02,0xc2,0x20,0x20,0x20,0x20,
+0x6a,0x75,0x6d,0x70,0x28,0x74,0x2c,0x27,0x6c,0x6f,0x6f,0x70,0x27,0x29,0x00,0x00,
+0x0e,0x06,0x00,0x10,0x00,0x00,0x00,0x04,0x6a,0x75,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x10,0x07,0x03,0x00,0x0d,0x08,0x00,0x0c,0x00,0x00,0x00,0x04,0x6c,0x6f,0x6f,0x70,
+0x00,0x00,0x00,0x00,0x37,0x05,0x06,0x03,0x1f,0x0b,0x02,0xc3,0x20,0x20,0x20,0x20,
+0x74,0x61,0x67,0x28,0x74,0x2c,0x27,0x62,0x72,0x65,0x61,0x6b,0x27,0x29,0x3b,0x20,
+0x74,0x61,0x67,0x28,0x74,0x2c,0x27,0x65,0x6e,0x64,0x27,0x29,0x3b,0x20,0x70,0x6f,
+0x70,0x5f,0x74,0x61,0x67,0x28,0x29,0x00,0x0e,0x06,0x00,0x0b,0x00,0x00,0x00,0x03,
+0x74,0x61,0x67,0x00,0x10,0x07,0x03,0x00,0x0d,0x08,0x00,0x19,0x00,0x00,0x00,0x05,
+0x62,0x72,0x65,0x61,0x6b,0x00,0x00,0x00,0x37,0x05,0x06,0x03,0x0e,0x06,0x00,0x0b,
+0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,0x10,0x07,0x03,0x00,0x0d,0x08,0x00,0x11,
+0x00,0x00,0x00,0x03,0x65,0x6e,0x64,0x00,0x37,0x05,0x06,0x03,0x0e,0x06,0x00,0x1a,
+0x00,0x00,0x00,0x07,0x70,0x6f,0x70,0x5f,0x74,0x61,0x67,0x00,0x37,0x05,0x06,0x01,
+0x1f,0x06,0x02,0xc5,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x73,0x28,0x73,0x29,0x20,0x23,0x52,0x45,0x47,0x00,0x00,0x00,0x0e,0x06,0x00,0x1b,
+0x00,0x00,0x00,0x09,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x73,0x00,0x00,0x00,
+0x10,0x07,0x02,0x00,0x37,0x05,0x06,0x02,0x00,0x00,0x00,0x00,0x0d,0x39,0x00,0x61,
+0x00,0x00,0x00,0x0c,0x64,0x6f,0x5f,0x66,0x6f,0x72,0x5f,0x72,0x61,0x6e,0x67,0x65,
+0x00,0x00,0x00,0x00,0x0f,0x39,0x38,0x00,0x1f,0x05,0x02,0xc7,0x64,0x65,0x66,0x20,
+0x64,0x6f,0x5f,0x66,0x6f,0x72,0x28,0x74,0x6f,0x6b,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x39,0x00,0x05,0x2a,0x24,0x34,0x39,0x36,0x00,0x00,0x00,0x0d,0x3e,0x00,0x2f,
+0x00,0x00,0x00,0x03,0x74,0x6f,0x6b,0x00,0x1c,0x3a,0x3e,0x01,0x1c,0x3b,0x00,0x00,
+0x1d,0x3c,0x00,0x00,0x1d,0x3d,0x00,0x00,0x11,0x39,0x01,0x60,0x2d,0x10,0x00,0x1a,
+0x00,0x00,0x00,0x02,0x1f,0x05,0x02,0xc7,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x66,
+0x6f,0x72,0x28,0x74,0x6f,0x6b,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x03,
+0x74,0x6f,0x6b,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,
+0x00,0x00,0x00,0x06,0x64,0x6f,0x5f,0x66,0x6f,0x72,0x00,0x00,0x23,0x01,0x00,0x00,
+0x1f,0x06,0x02,0xc8,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,0x73,0x20,0x3d,0x20,
+0x74,0x6f,0x6b,0x2e,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x33,0x01,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x0d,0x02,0x00,0x02,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x01,0x00,0x02,0x00,0x00,0x00,0x00,
+0x1f,0x08,0x02,0xc9,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,0x73,0x5f,0x72,0x61,
+0x6e,0x67,0x65,0x5f,0x63,0x61,0x6c,0x6c,0x28,0x69,0x74,0x65,0x6d,0x73,0x5b,0x31,
+0x5d,0x29,0x3a,0x00,0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x0d,0x69,0x73,0x5f,0x72,
+0x61,0x6e,0x67,0x65,0x5f,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x0c,0x04,0x00,0x04,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x03,0x01,0x04,0x37,0x0b,0x02,0x02,
+0x16,0x0b,0x00,0x00,0x13,0x00,0x00,0x14,0x1f,0x09,0x02,0xca,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x64,0x6f,0x5f,0x66,0x6f,
+0x72,0x5f,0x72,0x61,0x6e,0x67,0x65,0x28,0x74,0x6f,0x6b,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x02,0x00,0x05,0x00,0x00,0x00,0x0c,0x64,0x6f,0x5f,0x66,0x6f,0x72,0x5f,0x72,
+0x61,0x6e,0x67,0x65,0x00,0x00,0x00,0x00,0x10,0x03,0x00,0x00,0x37,0x0b,0x02,0x02,
+0x15,0x0b,0x00,0x00,0x1f,0x05,0x02,0xcc,0x20,0x20,0x20,0x20,0x72,0x65,0x67,0x20,
+0x3d,0x20,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x28,0x29,0x00,0x33,0x0b,0x00,0x03,
+0x72,0x65,0x67,0x00,0x0e,0x03,0x00,0x06,0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,
+0x74,0x6d,0x70,0x00,0x37,0x0b,0x03,0x01,0x1f,0x06,0x02,0xcd,0x20,0x20,0x20,0x20,
+0x69,0x74,0x72,0x20,0x3d,0x20,0x64,0x6f,0x28,0x69,0x74,0x65,0x6d,0x73,0x5b,0x31,
+0x5d,0x29,0x00,0x00,0x33,0x02,0x00,0x03,0x69,0x74,0x72,0x00,0x0e,0x04,0x00,0x07,
+0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x0c,0x06,0x00,0x04,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x05,0x01,0x06,0x37,0x02,0x04,0x02,0x1f,0x06,0x02,0xce,
+0x20,0x20,0x20,0x20,0x69,0x20,0x3d,0x20,0x5f,0x64,0x6f,0x5f,0x69,0x6e,0x74,0x65,
+0x67,0x65,0x72,0x28,0x30,0x29,0x00,0x00,0x33,0x03,0x00,0x01,0x69,0x00,0x00,0x00,
+0x0e,0x05,0x00,0x08,0x00,0x00,0x00,0x0b,0x5f,0x64,0x6f,0x5f,0x69,0x6e,0x74,0x65,
+0x67,0x65,0x72,0x00,0x0c,0x06,0x00,0x09,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x37,0x03,0x05,0x02,0x1f,0x0e,0x02,0xd0,0x20,0x20,0x20,0x20,0x74,0x20,0x3d,0x20,
+0x73,0x74,0x61,0x63,0x6b,0x5f,0x74,0x61,0x67,0x28,0x29,0x3b,0x20,0x74,0x61,0x67,
+0x28,0x74,0x2c,0x27,0x6c,0x6f,0x6f,0x70,0x27,0x29,0x3b,0x20,0x74,0x61,0x67,0x28,
+0x74,0x2c,0x27,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x27,0x29,0x00,0x00,0x00,
+0x33,0x04,0x00,0x01,0x74,0x00,0x00,0x00,0x0e,0x06,0x00,0x0a,0x00,0x00,0x00,0x09,
+0x73,0x74,0x61,0x63,0x6b,0x5f,0x74,0x61,0x67,0x00,0x00,0x00,0x37,0x04,0x06,0x01,
+0x0e,0x06,0x00,0x0b,0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,0x10,0x07,0x04,0x00,
+0x0d,0x08,0x00,0x0c,0x00,0x00,0x00,0x04,0x6c,0x6f,0x6f,0x70,0x00,0x00,0x00,0x00,
+0x37,0x05,0x06,0x03,0x0e,0x06,0x00,0x0b,0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,
+0x10,0x07,0x04,0x00,0x0d,0x08,0x00,0x0d,0x00,0x00,0x00,0x08,0x63,0x6f,0x6e,0x74,
+0x69,0x6e,0x75,0x65,0x00,0x00,0x00,0x00,0x37,0x05,0x06,0x03,0x1f,0x0a,0x02,0xd1,
+0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x28,0x49,0x54,0x45,0x52,0x2c,0x72,0x65,
+0x67,0x2c,0x69,0x74,0x72,0x2c,0x69,0x29,0x3b,0x20,0x6a,0x75,0x6d,0x70,0x28,0x74,
+0x2c,0x27,0x65,0x6e,0x64,0x27,0x29,0x00,0x0e,0x06,0x00,0x0e,0x00,0x00,0x00,0x04,
+0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0e,0x07,0x00,0x0f,0x00,0x00,0x00,0x04,
+0x49,0x54,0x45,0x52,0x00,0x00,0x00,0x00,0x10,0x08,0x0b,0x00,0x10,0x09,0x02,0x00,
+0x10,0x0a,0x03,0x00,0x37,0x05,0x06,0x05,0x0e,0x06,0x00,0x10,0x00,0x00,0x00,0x04,
+0x6a,0x75,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x07,0x04,0x00,0x0d,0x08,0x00,0x11,
+0x00,0x00,0x00,0x03,0x65,0x6e,0x64,0x00,0x37,0x05,0x06,0x03,0x1f,0x10,0x02,0xd2,
+0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x64,0x6f,0x5f,
+0x73,0x65,0x74,0x5f,0x63,0x74,0x78,0x28,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,
+0x2c,0x20,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x6f,0x6b,0x2e,0x70,0x6f,0x73,0x2c,
+0x20,0x27,0x72,0x65,0x67,0x27,0x2c,0x20,0x72,0x65,0x67,0x29,0x29,0x29,0x00,0x00,
+0x0e,0x06,0x00,0x12,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x00,0x00,0x00,0x00,0x0e,0x08,0x00,0x13,0x00,0x00,0x00,0x0a,0x64,0x6f,0x5f,0x73,
+0x65,0x74,0x5f,0x63,0x74,0x78,0x00,0x00,0x0c,0x0c,0x00,0x09,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x09,0x01,0x0c,0x0e,0x0c,0x00,0x14,0x00,0x00,0x00,0x05,
+0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0d,0x05,0x00,0x15,0x00,0x00,0x00,0x03,
+0x70,0x6f,0x73,0x00,0x09,0x0d,0x00,0x05,0x00,0x00,0x00,0x01,0x0d,0x0e,0x00,0x16,
+0x00,0x00,0x00,0x03,0x72,0x65,0x67,0x00,0x10,0x0f,0x0b,0x00,0x37,0x0a,0x0c,0x04,
+0x37,0x07,0x08,0x03,0x37,0x05,0x06,0x02,0x1f,0x08,0x02,0xd3,0x20,0x20,0x20,0x20,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x64,0x6f,0x28,0x69,0x74,0x65,0x6d,
+0x73,0x5b,0x32,0x5d,0x29,0x29,0x20,0x23,0x52,0x45,0x47,0x00,0x0e,0x06,0x00,0x12,
+0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x0e,0x08,0x00,0x07,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x0c,0x0a,0x00,0x17,
+0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x0a,0x09,0x01,0x0a,0x37,0x07,0x08,0x02,
+0x37,0x05,0x06,0x02,0x1f,0x05,0x02,0xd4,0x20,0x20,0x20,0x20,0x6a,0x75,0x6d,0x70,
+0x28,0x74,0x2c,0x27,0x6c,0x6f,0x6f,0x70,0x27,0x29,0x00,0x00,0x0e,0x06,0x00,0x10,
+0x00,0x00,0x00,0x04,0x6a,0x75,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x07,0x04,0x00,
+0x0d,0x08,0x00,0x0c,0x00,0x00,0x00,0x04,0x6c,0x6f,0x6f,0x70,0x00,0x00,0x00,0x00,
+0x37,0x05,0x06,0x03,0x1f,0x0b,0x02,0xd5,0x20,0x20,0x20,0x20,0x74,0x61,0x67,0x28,
+0x74,0x2c,0x27,0x62,0x72,0x65,0x61,0x6b,0x27,0x29,0x3b,0x20,0x74,0x61,0x67,0x28,
+0x74,0x2c,0x27,0x65,0x6e,0x64,0x27,0x29,0x3b,0x20,0x70,0x6f,0x70,0x5f,0x74,0x61,
+0x67,0x28,0x29,0x00,0x0e,0x06,0x00,0x0b,0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,
+0x10,0x07,0x04,0x00,0x0d,0x08,0x00,0x18,0x00,0x00,0x00,0x05,0x62,0x72,0x65,0x61,
+0x6b,0x00,0x00,0x00,0x37,0x05,0x06,0x03,0x0e,0x06,0x00,0x0b,0x00,0x00,0x00,0x03,
+0x74,0x61,0x67,0x00,0x10,0x07,0x04,0x00,0x0d,0x08,0x00,0x11,0x00,0x00,0x00,0x03,
+0x65,0x6e,0x64,0x00,0x37,0x05,0x06,0x03,0x0e,0x06,0x00,0x19,0x00,0x00,0x00,0x07,
+0x70,0x6f,0x70,0x5f,0x74,0x61,0x67,0x00,0x37,0x05,0x06,0x01,0x1f,0x06,0x02,0xd7,
+0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x69,0x74,0x72,
+0x29,0x20,0x23,0x52,0x45,0x47,0x00,0x00,0x0e,0x06,0x00,0x12,0x00,0x00,0x00,0x08,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x07,0x02,0x00,
+0x37,0x05,0x06,0x02,0x1f,0x04,0x02,0xd8,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x28,0x69,0x29,0x00,0x0e,0x06,0x00,0x12,0x00,0x00,0x00,0x08,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x07,0x03,0x00,
+0x37,0x05,0x06,0x02,0x00,0x00,0x00,0x00,0x0d,0x3a,0x00,0x62,0x00,0x00,0x00,0x06,
+0x64,0x6f,0x5f,0x66,0x6f,0x72,0x00,0x00,0x0f,0x3a,0x39,0x00,0x1f,0x06,0x02,0xda,
+0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x63,0x6f,0x6d,0x70,0x28,0x74,0x2c,0x72,0x3d,
+0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x33,0x3a,0x00,0x05,0x2a,0x24,0x35,0x30,
+0x33,0x00,0x00,0x00,0x0d,0x3f,0x00,0x21,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x0d,0x40,0x00,0x1f,0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,0x1c,0x3b,0x3f,0x02,
+0x1d,0x3f,0x00,0x00,0x1c,0x3c,0x3f,0x01,0x1d,0x3d,0x00,0x00,0x1d,0x3e,0x00,0x00,
+0x11,0x3a,0x01,0x28,0x2d,0x0f,0x00,0x15,0x00,0x00,0x00,0x09,0x1f,0x06,0x02,0xda,
+0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x63,0x6f,0x6d,0x70,0x28,0x74,0x2c,0x72,0x3d,
+0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x33,0x0e,0x00,0x01,0x72,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x63,0x6f,0x6d,0x70,0x00,
+0x23,0x01,0x00,0x00,0x1f,0x08,0x02,0xdb,0x20,0x20,0x20,0x20,0x6e,0x61,0x6d,0x65,
+0x20,0x3d,0x20,0x27,0x63,0x6f,0x6d,0x70,0x3a,0x27,0x2b,0x67,0x65,0x74,0x5f,0x74,
+0x61,0x67,0x28,0x29,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x04,0x6e,0x61,0x6d,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x02,0x00,0x00,0x00,0x05,0x63,0x6f,0x6d,0x70,
+0x3a,0x00,0x00,0x00,0x0e,0x03,0x00,0x03,0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,
+0x74,0x61,0x67,0x00,0x37,0x02,0x03,0x01,0x01,0x01,0x01,0x02,0x1f,0x0b,0x02,0xdc,
+0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x64,0x6f,0x5f,0x6c,0x6f,0x63,0x61,0x6c,
+0x28,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x6e,0x61,
+0x6d,0x65,0x27,0x2c,0x6e,0x61,0x6d,0x65,0x29,0x29,0x00,0x00,0x0e,0x02,0x00,0x04,
+0x00,0x00,0x00,0x08,0x64,0x6f,0x5f,0x6c,0x6f,0x63,0x61,0x6c,0x00,0x00,0x00,0x00,
+0x0e,0x04,0x00,0x05,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x0d,0x08,0x00,0x06,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x05,0x00,0x08,
+0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x07,0x00,0x00,0x00,0x04,0x6e,0x61,0x6d,0x65,
+0x00,0x00,0x00,0x00,0x10,0x07,0x01,0x00,0x37,0x03,0x04,0x04,0x37,0x0e,0x02,0x02,
+0x1f,0x06,0x02,0xdd,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x28,0x4c,0x49,0x53,
+0x54,0x2c,0x72,0x2c,0x30,0x2c,0x30,0x29,0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x08,
+0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x09,
+0x00,0x00,0x00,0x04,0x4c,0x49,0x53,0x54,0x00,0x00,0x00,0x00,0x10,0x04,0x0e,0x00,
+0x0c,0x05,0x00,0x0a,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0c,0x06,0x00,0x0a,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x37,0x01,0x02,0x05,0x1f,0x09,0x02,0xde,
+0x20,0x20,0x20,0x20,0x6b,0x65,0x79,0x20,0x3d,0x20,0x54,0x6f,0x6b,0x65,0x6e,0x28,
+0x74,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x67,0x65,0x74,0x27,0x2c,0x4e,0x6f,0x6e,0x65,
+0x2c,0x5b,0x00,0x00,0x33,0x01,0x00,0x03,0x6b,0x65,0x79,0x00,0x0e,0x03,0x00,0x05,
+0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0d,0x08,0x00,0x06,
+0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x04,0x00,0x08,0x00,0x00,0x00,0x01,
+0x0d,0x05,0x00,0x0b,0x00,0x00,0x00,0x03,0x67,0x65,0x74,0x00,0x1d,0x06,0x00,0x00,
+0x1f,0x09,0x02,0xdf,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x72,0x65,0x67,
+0x27,0x2c,0x72,0x29,0x2c,0x00,0x00,0x00,0x0e,0x0a,0x00,0x05,0x00,0x00,0x00,0x05,
+0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0d,0x01,0x00,0x06,0x00,0x00,0x00,0x03,
+0x70,0x6f,0x73,0x00,0x09,0x0b,0x00,0x01,0x00,0x00,0x00,0x02,0x0d,0x0c,0x00,0x0c,
+0x00,0x00,0x00,0x03,0x72,0x65,0x67,0x00,0x10,0x0d,0x0e,0x00,0x37,0x08,0x0a,0x04,
+0x1f,0x0b,0x02,0xe0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x73,0x79,0x6d,
+0x62,0x6f,0x6c,0x27,0x2c,0x27,0x4e,0x6f,0x6e,0x65,0x27,0x29,0x5d,0x29,0x00,0x00,
+0x0e,0x0a,0x00,0x05,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x06,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x0b,0x00,0x01,
+0x00,0x00,0x00,0x03,0x0d,0x0c,0x00,0x0d,0x00,0x00,0x00,0x06,0x73,0x79,0x6d,0x62,
+0x6f,0x6c,0x00,0x00,0x0d,0x0d,0x00,0x0e,0x00,0x00,0x00,0x04,0x4e,0x6f,0x6e,0x65,
+0x00,0x00,0x00,0x00,0x37,0x09,0x0a,0x04,0x1c,0x07,0x08,0x02,0x37,0x01,0x03,0x05,
+0x1f,0x0d,0x02,0xe1,0x20,0x20,0x20,0x20,0x61,0x70,0x20,0x3d,0x20,0x54,0x6f,0x6b,
+0x65,0x6e,0x28,0x74,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x73,0x79,0x6d,0x62,0x6f,0x6c,
+0x27,0x2c,0x27,0x3d,0x27,0x2c,0x5b,0x6b,0x65,0x79,0x2c,0x74,0x2e,0x69,0x74,0x65,
+0x6d,0x73,0x5b,0x30,0x5d,0x5d,0x29,0x00,0x33,0x02,0x00,0x02,0x61,0x70,0x00,0x00,
+0x0e,0x04,0x00,0x05,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x0d,0x09,0x00,0x06,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x05,0x00,0x09,
+0x00,0x00,0x00,0x04,0x0d,0x06,0x00,0x0d,0x00,0x00,0x00,0x06,0x73,0x79,0x6d,0x62,
+0x6f,0x6c,0x00,0x00,0x0d,0x07,0x00,0x0f,0x00,0x00,0x00,0x01,0x3d,0x00,0x00,0x00,
+0x10,0x09,0x01,0x00,0x0d,0x0b,0x00,0x10,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x09,0x0a,0x00,0x0b,0x00,0x00,0x00,0x05,0x0c,0x0b,0x00,0x0a,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x0a,0x0a,0x0b,0x1c,0x08,0x09,0x02,
+0x37,0x02,0x04,0x05,0x1f,0x0f,0x02,0xe2,0x20,0x20,0x20,0x20,0x64,0x6f,0x28,0x54,
+0x6f,0x6b,0x65,0x6e,0x28,0x74,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x66,0x6f,0x72,0x27,
+0x2c,0x4e,0x6f,0x6e,0x65,0x2c,0x5b,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,0x31,
+0x5d,0x2c,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,0x32,0x5d,0x2c,0x61,0x70,0x5d,
+0x29,0x29,0x00,0x00,0x0e,0x04,0x00,0x11,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,
+0x0e,0x06,0x00,0x05,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x0d,0x0b,0x00,0x06,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x07,0x00,0x0b,
+0x00,0x00,0x00,0x06,0x0d,0x08,0x00,0x12,0x00,0x00,0x00,0x03,0x66,0x6f,0x72,0x00,
+0x1d,0x09,0x00,0x00,0x0d,0x01,0x00,0x10,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x09,0x0b,0x00,0x01,0x00,0x00,0x00,0x07,0x0c,0x01,0x00,0x13,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x0b,0x0b,0x01,0x0d,0x01,0x00,0x10,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x0c,0x00,0x01,
+0x00,0x00,0x00,0x08,0x0c,0x01,0x00,0x14,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,
+0x0a,0x0c,0x0c,0x01,0x10,0x0d,0x02,0x00,0x1c,0x0a,0x0b,0x03,0x37,0x05,0x06,0x05,
+0x37,0x03,0x04,0x02,0x1f,0x04,0x02,0xe3,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,0x15,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x3b,0x00,0x63,0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x63,0x6f,0x6d,0x70,0x00,
+0x0f,0x3b,0x3a,0x00,0x1f,0x04,0x02,0xe5,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x69,
+0x66,0x28,0x74,0x29,0x3a,0x00,0x00,0x00,0x33,0x3b,0x00,0x05,0x2a,0x24,0x35,0x31,
+0x32,0x00,0x00,0x00,0x0d,0x40,0x00,0x21,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x1c,0x3c,0x40,0x01,0x1c,0x3d,0x00,0x00,0x1d,0x3e,0x00,0x00,0x1d,0x3f,0x00,0x00,
+0x11,0x3b,0x01,0x43,0x2d,0x0b,0x00,0x10,0x00,0x00,0x00,0x06,0x1f,0x04,0x02,0xe5,
+0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x69,0x66,0x28,0x74,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x05,0x64,0x6f,0x5f,0x69,0x66,0x00,0x00,0x00,
+0x23,0x01,0x00,0x00,0x1f,0x05,0x02,0xe6,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,
+0x73,0x20,0x3d,0x20,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x00,0x33,0x01,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x0d,0x02,0x00,0x02,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x01,0x00,0x02,0x00,0x00,0x00,0x00,
+0x1f,0x05,0x02,0xe7,0x20,0x20,0x20,0x20,0x74,0x20,0x3d,0x20,0x67,0x65,0x74,0x5f,
+0x74,0x61,0x67,0x28,0x29,0x00,0x00,0x00,0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x07,
+0x67,0x65,0x74,0x5f,0x74,0x61,0x67,0x00,0x37,0x00,0x02,0x01,0x1f,0x03,0x02,0xe8,
+0x20,0x20,0x20,0x20,0x6e,0x20,0x3d,0x20,0x30,0x00,0x00,0x00,0x33,0x03,0x00,0x01,
+0x6e,0x00,0x00,0x00,0x0c,0x02,0x00,0x04,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x10,0x03,0x02,0x00,0x1f,0x06,0x02,0xe9,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,
+0x74,0x74,0x20,0x69,0x6e,0x20,0x69,0x74,0x65,0x6d,0x73,0x3a,0x00,0x00,0x00,0x00,
+0x0c,0x04,0x00,0x04,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x02,0x01,0x04,
+0x13,0x00,0x00,0xe1,0x33,0x05,0x00,0x02,0x74,0x74,0x00,0x00,0x10,0x05,0x02,0x00,
+0x1f,0x05,0x02,0xea,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x61,0x67,0x28,
+0x74,0x2c,0x6e,0x29,0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x05,0x00,0x00,0x00,0x03,
+0x74,0x61,0x67,0x00,0x10,0x07,0x00,0x00,0x10,0x08,0x03,0x00,0x37,0x02,0x06,0x03,
+0x1f,0x08,0x02,0xeb,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,
+0x74,0x2e,0x74,0x79,0x70,0x65,0x20,0x3d,0x3d,0x20,0x27,0x65,0x6c,0x69,0x66,0x27,
+0x3a,0x00,0x00,0x00,0x0d,0x06,0x00,0x06,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,
+0x00,0x00,0x00,0x00,0x09,0x02,0x05,0x06,0x00,0x00,0x00,0x01,0x0d,0x06,0x00,0x07,
+0x00,0x00,0x00,0x04,0x65,0x6c,0x69,0x66,0x00,0x00,0x00,0x00,0x18,0x02,0x02,0x06,
+0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x63,0x1f,0x0f,0x02,0xec,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x20,0x3d,0x20,0x64,0x6f,0x28,0x74,
+0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x29,0x3b,0x20,0x63,0x6f,0x64,
+0x65,0x28,0x49,0x46,0x2c,0x61,0x29,0x3b,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,
+0x70,0x28,0x61,0x29,0x3b,0x00,0x00,0x00,0x33,0x02,0x00,0x01,0x61,0x00,0x00,0x00,
+0x0e,0x07,0x00,0x08,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x0d,0x09,0x00,0x02,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x08,0x05,0x09,
+0x00,0x00,0x00,0x02,0x0c,0x09,0x00,0x04,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x08,0x08,0x09,0x37,0x02,0x07,0x02,0x0e,0x07,0x00,0x09,0x00,0x00,0x00,0x04,
+0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0e,0x08,0x00,0x0a,0x00,0x00,0x00,0x02,
+0x49,0x46,0x00,0x00,0x10,0x09,0x02,0x00,0x37,0x06,0x07,0x03,0x0e,0x07,0x00,0x0b,
+0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x10,0x08,0x02,0x00,0x37,0x06,0x07,0x02,0x1f,0x06,0x02,0xed,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6a,0x75,0x6d,0x70,0x28,0x74,0x2c,0x6e,
+0x2b,0x31,0x29,0x00,0x0e,0x07,0x00,0x0c,0x00,0x00,0x00,0x04,0x6a,0x75,0x6d,0x70,
+0x00,0x00,0x00,0x00,0x10,0x08,0x00,0x00,0x0c,0x0a,0x00,0x0d,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x01,0x09,0x03,0x0a,0x37,0x06,0x07,0x03,0x1f,0x0b,0x02,0xee,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x28,0x64,0x6f,0x28,0x74,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,
+0x5b,0x31,0x5d,0x29,0x29,0x20,0x23,0x52,0x45,0x47,0x00,0x00,0x0e,0x07,0x00,0x0b,
+0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x0e,0x09,0x00,0x08,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x0d,0x06,0x00,0x02,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x0a,0x05,0x06,
+0x00,0x00,0x00,0x03,0x0c,0x06,0x00,0x0d,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x0a,0x0a,0x06,0x37,0x08,0x09,0x02,0x37,0x06,0x07,0x02,0x13,0x00,0x00,0x40,
+0x1f,0x08,0x02,0xef,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,
+0x20,0x74,0x74,0x2e,0x74,0x79,0x70,0x65,0x20,0x3d,0x3d,0x20,0x27,0x65,0x6c,0x73,
+0x65,0x27,0x3a,0x00,0x0d,0x07,0x00,0x06,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,
+0x00,0x00,0x00,0x00,0x09,0x06,0x05,0x07,0x00,0x00,0x00,0x04,0x0d,0x07,0x00,0x0e,
+0x00,0x00,0x00,0x04,0x65,0x6c,0x73,0x65,0x00,0x00,0x00,0x00,0x18,0x06,0x06,0x07,
+0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x22,0x1f,0x0b,0x02,0xf0,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x28,0x64,0x6f,0x28,0x74,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x29,
+0x29,0x20,0x23,0x52,0x45,0x47,0x00,0x00,0x0e,0x07,0x00,0x0b,0x00,0x00,0x00,0x08,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x0e,0x09,0x00,0x08,
+0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x0d,0x06,0x00,0x02,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x0a,0x05,0x06,0x00,0x00,0x00,0x05,
+0x0c,0x06,0x00,0x04,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x0a,0x0a,0x06,
+0x37,0x08,0x09,0x02,0x37,0x06,0x07,0x02,0x13,0x00,0x00,0x09,0x1f,0x05,0x02,0xf2,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x61,0x69,0x73,
+0x65,0x00,0x00,0x00,0x1d,0x06,0x00,0x00,0x26,0x06,0x00,0x00,0x1f,0x06,0x02,0xf3,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6a,0x75,0x6d,0x70,0x28,0x74,0x2c,0x27,
+0x65,0x6e,0x64,0x27,0x29,0x00,0x00,0x00,0x0e,0x07,0x00,0x0c,0x00,0x00,0x00,0x04,
+0x6a,0x75,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x08,0x00,0x00,0x0d,0x09,0x00,0x0f,
+0x00,0x00,0x00,0x03,0x65,0x6e,0x64,0x00,0x37,0x06,0x07,0x03,0x1f,0x04,0x02,0xf4,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x20,0x2b,0x3d,0x20,0x31,0x00,0x00,
+0x0c,0x07,0x00,0x0d,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x03,0x03,0x07,
+0x13,0x00,0xff,0x1f,0x1f,0x04,0x02,0xf5,0x20,0x20,0x20,0x20,0x74,0x61,0x67,0x28,
+0x74,0x2c,0x6e,0x29,0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x05,0x00,0x00,0x00,0x03,
+0x74,0x61,0x67,0x00,0x10,0x07,0x00,0x00,0x10,0x08,0x03,0x00,0x37,0x04,0x06,0x03,
+0x1f,0x05,0x02,0xf6,0x20,0x20,0x20,0x20,0x74,0x61,0x67,0x28,0x74,0x2c,0x27,0x65,
+0x6e,0x64,0x27,0x29,0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x05,0x00,0x00,0x00,0x03,
+0x74,0x61,0x67,0x00,0x10,0x07,0x00,0x00,0x0d,0x08,0x00,0x0f,0x00,0x00,0x00,0x03,
+0x65,0x6e,0x64,0x00,0x37,0x04,0x06,0x03,0x00,0x00,0x00,0x00,0x0d,0x3c,0x00,0x64,
+0x00,0x00,0x00,0x05,0x64,0x6f,0x5f,0x69,0x66,0x00,0x00,0x00,0x0f,0x3c,0x3b,0x00,
+0x1f,0x04,0x02,0xf8,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x74,0x72,0x79,0x28,0x74,
+0x29,0x3a,0x00,0x00,0x33,0x3c,0x00,0x05,0x2a,0x24,0x35,0x31,0x39,0x00,0x00,0x00,
+0x0d,0x41,0x00,0x21,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x1c,0x3d,0x41,0x01,
+0x1c,0x3e,0x00,0x00,0x1d,0x3f,0x00,0x00,0x1d,0x40,0x00,0x00,0x11,0x3c,0x00,0xbe,
+0x2d,0x06,0x00,0x0f,0x00,0x00,0x00,0x02,0x1f,0x04,0x02,0xf8,0x64,0x65,0x66,0x20,
+0x64,0x6f,0x5f,0x74,0x72,0x79,0x28,0x74,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,
+0x00,0x00,0x00,0x06,0x64,0x6f,0x5f,0x74,0x72,0x79,0x00,0x00,0x23,0x01,0x00,0x00,
+0x1f,0x05,0x02,0xf9,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,0x73,0x20,0x3d,0x20,
+0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x00,0x33,0x01,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x0d,0x02,0x00,0x02,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x09,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x1f,0x05,0x02,0xfa,
+0x20,0x20,0x20,0x20,0x74,0x20,0x3d,0x20,0x67,0x65,0x74,0x5f,0x74,0x61,0x67,0x28,
+0x29,0x00,0x00,0x00,0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,
+0x74,0x61,0x67,0x00,0x37,0x00,0x02,0x01,0x1f,0x06,0x02,0xfb,0x20,0x20,0x20,0x20,
+0x73,0x65,0x74,0x6a,0x6d,0x70,0x28,0x74,0x2c,0x27,0x65,0x78,0x63,0x65,0x70,0x74,
+0x27,0x29,0x00,0x00,0x0e,0x02,0x00,0x04,0x00,0x00,0x00,0x06,0x73,0x65,0x74,0x6a,
+0x6d,0x70,0x00,0x00,0x10,0x03,0x00,0x00,0x0d,0x04,0x00,0x05,0x00,0x00,0x00,0x06,
+0x65,0x78,0x63,0x65,0x70,0x74,0x00,0x00,0x37,0x02,0x02,0x03,0x1f,0x08,0x02,0xfc,
+0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x64,0x6f,0x28,
+0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x29,0x29,0x20,0x23,0x52,0x45,0x47,0x00,
+0x0e,0x02,0x00,0x06,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x00,0x00,0x00,0x00,0x0e,0x04,0x00,0x07,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,
+0x0c,0x03,0x00,0x08,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x05,0x01,0x03,
+0x37,0x03,0x04,0x02,0x37,0x02,0x02,0x02,0x1f,0x05,0x02,0xfd,0x20,0x20,0x20,0x20,
+0x63,0x6f,0x64,0x65,0x28,0x53,0x45,0x54,0x4a,0x4d,0x50,0x2c,0x30,0x29,0x00,0x00,
+0x0e,0x02,0x00,0x09,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,
+0x0e,0x03,0x00,0x0a,0x00,0x00,0x00,0x06,0x53,0x45,0x54,0x4a,0x4d,0x50,0x00,0x00,
+0x0c,0x04,0x00,0x08,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x37,0x02,0x02,0x03,
+0x1f,0x05,0x02,0xfe,0x20,0x20,0x20,0x20,0x6a,0x75,0x6d,0x70,0x28,0x74,0x2c,0x27,
+0x65,0x6e,0x64,0x27,0x29,0x00,0x00,0x00,0x0e,0x02,0x00,0x0b,0x00,0x00,0x00,0x04,
+0x6a,0x75,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x03,0x00,0x00,0x0d,0x04,0x00,0x0c,
+0x00,0x00,0x00,0x03,0x65,0x6e,0x64,0x00,0x37,0x02,0x02,0x03,0x1f,0x05,0x02,0xff,
+0x20,0x20,0x20,0x20,0x74,0x61,0x67,0x28,0x74,0x2c,0x27,0x65,0x78,0x63,0x65,0x70,
+0x74,0x27,0x29,0x00,0x0e,0x02,0x00,0x0d,0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,
+0x10,0x03,0x00,0x00,0x0d,0x04,0x00,0x05,0x00,0x00,0x00,0x06,0x65,0x78,0x63,0x65,
+0x70,0x74,0x00,0x00,0x37,0x02,0x02,0x03,0x1f,0x0b,0x03,0x00,0x20,0x20,0x20,0x20,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x64,0x6f,0x28,0x69,0x74,0x65,0x6d,
+0x73,0x5b,0x31,0x5d,0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,0x31,0x5d,0x29,0x29,0x20,
+0x23,0x52,0x45,0x47,0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x06,0x00,0x00,0x00,0x08,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x0e,0x04,0x00,0x07,
+0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x0c,0x03,0x00,0x0e,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x05,0x01,0x03,0x0d,0x03,0x00,0x02,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x05,0x05,0x03,0x00,0x00,0x00,0x01,
+0x0c,0x03,0x00,0x0e,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x05,0x05,0x03,
+0x37,0x03,0x04,0x02,0x37,0x02,0x02,0x02,0x1f,0x05,0x03,0x01,0x20,0x20,0x20,0x20,
+0x74,0x61,0x67,0x28,0x74,0x2c,0x27,0x65,0x6e,0x64,0x27,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x02,0x00,0x0d,0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,0x10,0x03,0x00,0x00,
+0x0d,0x04,0x00,0x0c,0x00,0x00,0x00,0x03,0x65,0x6e,0x64,0x00,0x37,0x02,0x02,0x03,
+0x00,0x00,0x00,0x00,0x0d,0x3d,0x00,0x65,0x00,0x00,0x00,0x06,0x64,0x6f,0x5f,0x74,
+0x72,0x79,0x00,0x00,0x0f,0x3d,0x3c,0x00,0x1f,0x05,0x03,0x03,0x64,0x65,0x66,0x20,
+0x64,0x6f,0x5f,0x72,0x65,0x74,0x75,0x72,0x6e,0x28,0x74,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x3d,0x00,0x05,0x2a,0x24,0x35,0x32,0x36,0x00,0x00,0x00,0x0d,0x42,0x00,0x21,
+0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x1c,0x3e,0x42,0x01,0x1c,0x3f,0x00,0x00,
+0x1d,0x40,0x00,0x00,0x1d,0x41,0x00,0x00,0x11,0x3d,0x00,0x6f,0x2d,0x05,0x00,0x09,
+0x00,0x00,0x00,0x02,0x1f,0x05,0x03,0x03,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x72,
+0x65,0x74,0x75,0x72,0x6e,0x28,0x74,0x29,0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,
+0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x72,0x65,0x74,0x75,0x72,0x6e,0x00,0x00,0x00,
+0x23,0x01,0x00,0x00,0x1f,0x09,0x03,0x04,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,
+0x2e,0x69,0x74,0x65,0x6d,0x73,0x3a,0x20,0x72,0x20,0x3d,0x20,0x64,0x6f,0x28,0x74,
+0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x29,0x00,0x00,0x0d,0x02,0x00,0x02,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x01,0x00,0x02,
+0x00,0x00,0x00,0x00,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x12,0x33,0x01,0x00,0x01,
+0x72,0x00,0x00,0x00,0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,
+0x0d,0x04,0x00,0x02,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x09,0x03,0x00,0x04,0x00,0x00,0x00,0x01,0x0c,0x04,0x00,0x04,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x03,0x03,0x04,0x37,0x01,0x02,0x02,0x13,0x00,0x00,0x0f,
+0x1f,0x07,0x03,0x05,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x3a,0x20,0x72,0x20,
+0x3d,0x20,0x5f,0x64,0x6f,0x5f,0x6e,0x6f,0x6e,0x65,0x28,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x02,0x00,0x05,0x00,0x00,0x00,0x08,0x5f,0x64,0x6f,0x5f,0x6e,0x6f,0x6e,0x65,
+0x00,0x00,0x00,0x00,0x37,0x01,0x02,0x01,0x1f,0x05,0x03,0x06,0x20,0x20,0x20,0x20,
+0x63,0x6f,0x64,0x65,0x28,0x52,0x45,0x54,0x55,0x52,0x4e,0x2c,0x72,0x29,0x00,0x00,
+0x0e,0x02,0x00,0x06,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,
+0x0e,0x03,0x00,0x07,0x00,0x00,0x00,0x06,0x52,0x45,0x54,0x55,0x52,0x4e,0x00,0x00,
+0x10,0x04,0x01,0x00,0x37,0x02,0x02,0x03,0x1f,0x04,0x03,0x07,0x20,0x20,0x20,0x20,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x72,0x29,0x00,0x0e,0x02,0x00,0x08,
+0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x10,0x03,0x01,0x00,0x37,0x02,0x02,0x02,0x1f,0x03,0x03,0x08,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x00,0x00,0x1d,0x02,0x00,0x00,0x15,0x02,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x3e,0x00,0x66,0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x72,
+0x65,0x74,0x75,0x72,0x6e,0x00,0x00,0x00,0x0f,0x3e,0x3d,0x00,0x1f,0x05,0x03,0x0a,
+0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x61,0x73,0x73,0x65,0x72,0x74,0x28,0x74,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x3e,0x00,0x05,0x2a,0x24,0x35,0x33,0x33,0x00,0x00,0x00,
+0x0d,0x43,0x00,0x21,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x1c,0x3f,0x43,0x01,
+0x1c,0x40,0x00,0x00,0x1d,0x41,0x00,0x00,0x1d,0x42,0x00,0x00,0x11,0x3e,0x01,0x55,
+0x2d,0x0c,0x00,0x19,0x00,0x00,0x00,0x04,0x1f,0x05,0x03,0x0a,0x64,0x65,0x66,0x20,
+0x64,0x6f,0x5f,0x61,0x73,0x73,0x65,0x72,0x74,0x28,0x74,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x61,0x73,0x73,0x65,0x72,
+0x74,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x12,0x03,0x0b,0x20,0x20,0x20,0x20,
+0x63,0x6d,0x70,0x73,0x20,0x3d,0x20,0x5b,0x27,0x3c,0x27,0x2c,0x27,0x3e,0x27,0x2c,
+0x27,0x3c,0x3d,0x27,0x2c,0x27,0x3e,0x3d,0x27,0x2c,0x27,0x3d,0x3d,0x27,0x2c,0x27,
+0x21,0x3d,0x27,0x2c,0x20,0x27,0x69,0x6e,0x27,0x2c,0x20,0x27,0x69,0x73,0x27,0x2c,
+0x20,0x27,0x69,0x73,0x6e,0x6f,0x74,0x27,0x2c,0x20,0x27,0x6e,0x6f,0x74,0x69,0x6e,
+0x27,0x5d,0x00,0x00,0x33,0x01,0x00,0x04,0x63,0x6d,0x70,0x73,0x00,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x02,0x00,0x00,0x00,0x01,0x3c,0x00,0x00,0x00,0x0d,0x03,0x00,0x03,
+0x00,0x00,0x00,0x01,0x3e,0x00,0x00,0x00,0x0d,0x04,0x00,0x04,0x00,0x00,0x00,0x02,
+0x3c,0x3d,0x00,0x00,0x0d,0x05,0x00,0x05,0x00,0x00,0x00,0x02,0x3e,0x3d,0x00,0x00,
+0x0d,0x06,0x00,0x06,0x00,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x0d,0x07,0x00,0x07,
+0x00,0x00,0x00,0x02,0x21,0x3d,0x00,0x00,0x0d,0x08,0x00,0x08,0x00,0x00,0x00,0x02,
+0x69,0x6e,0x00,0x00,0x0d,0x09,0x00,0x09,0x00,0x00,0x00,0x02,0x69,0x73,0x00,0x00,
+0x0d,0x0a,0x00,0x0a,0x00,0x00,0x00,0x05,0x69,0x73,0x6e,0x6f,0x74,0x00,0x00,0x00,
+0x0d,0x0b,0x00,0x0b,0x00,0x00,0x00,0x05,0x6e,0x6f,0x74,0x69,0x6e,0x00,0x00,0x00,
+0x1c,0x01,0x02,0x0a,0x1f,0x04,0x03,0x0c,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,
+0x2e,0x69,0x74,0x65,0x6d,0x73,0x3a,0x00,0x0d,0x02,0x00,0x0c,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x04,0x00,0x02,0x00,0x00,0x00,0x00,
+0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x8e,0x1f,0x06,0x03,0x0d,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x65,0x20,0x3d,0x20,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,
+0x30,0x5d,0x00,0x00,0x33,0x04,0x00,0x01,0x65,0x00,0x00,0x00,0x0d,0x03,0x00,0x0c,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x02,0x00,0x03,
+0x00,0x00,0x00,0x01,0x0c,0x03,0x00,0x0d,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x04,0x02,0x03,0x1f,0x0d,0x03,0x0e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x65,0x2e,0x74,0x79,0x70,0x65,0x20,0x3d,0x3d,0x20,0x27,0x73,0x79,
+0x6d,0x62,0x6f,0x6c,0x27,0x20,0x61,0x6e,0x64,0x20,0x65,0x2e,0x76,0x61,0x6c,0x20,
+0x69,0x6e,0x20,0x63,0x6d,0x70,0x73,0x3a,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x0e,
+0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x09,0x02,0x04,0x03,
+0x00,0x00,0x00,0x02,0x0d,0x03,0x00,0x0f,0x00,0x00,0x00,0x06,0x73,0x79,0x6d,0x62,
+0x6f,0x6c,0x00,0x00,0x18,0x02,0x02,0x03,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x07,
+0x0d,0x03,0x00,0x10,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x09,0x02,0x04,0x03,
+0x00,0x00,0x00,0x03,0x25,0x02,0x02,0x01,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x2a,
+0x1f,0x0a,0x03,0x0f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x72,0x2c,0x20,0x62,0x2c,0x20,0x63,0x20,0x3d,0x20,0x64,0x6f,0x5f,0x63,0x6d,0x70,
+0x28,0x65,0x2c,0x20,0x54,0x72,0x75,0x65,0x29,0x00,0x00,0x00,0x0e,0x03,0x00,0x11,
+0x00,0x00,0x00,0x06,0x64,0x6f,0x5f,0x63,0x6d,0x70,0x00,0x00,0x0c,0x05,0x00,0x12,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x37,0x02,0x03,0x03,0x33,0x02,0x00,0x04,
+0x2a,0x24,0x32,0x32,0x00,0x00,0x00,0x00,0x33,0x03,0x00,0x01,0x72,0x00,0x00,0x00,
+0x0c,0x05,0x00,0x0d,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x03,0x02,0x05,
+0x33,0x04,0x00,0x01,0x62,0x00,0x00,0x00,0x0c,0x06,0x00,0x12,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x04,0x02,0x06,0x33,0x05,0x00,0x01,0x63,0x00,0x00,0x00,
+0x0c,0x07,0x00,0x13,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x0a,0x05,0x02,0x07,
+0x13,0x00,0x00,0x5a,0x1f,0x04,0x03,0x10,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x65,0x6c,0x73,0x65,0x3a,0x00,0x00,0x00,0x1f,0x06,0x03,0x11,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x64,0x6f,0x28,0x65,
+0x29,0x00,0x00,0x00,0x0e,0x06,0x00,0x14,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,
+0x10,0x07,0x04,0x00,0x37,0x03,0x06,0x02,0x1f,0x07,0x03,0x12,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x20,0x3d,0x20,0x5f,0x64,0x6f,0x5f,
+0x6e,0x6f,0x6e,0x65,0x28,0x29,0x00,0x00,0x0e,0x06,0x00,0x15,0x00,0x00,0x00,0x08,
+0x5f,0x64,0x6f,0x5f,0x6e,0x6f,0x6e,0x65,0x00,0x00,0x00,0x00,0x37,0x04,0x06,0x01,
+0x1f,0x07,0x03,0x13,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x63,0x20,0x3d,0x20,0x5f,0x64,0x6f,0x5f,0x6e,0x6f,0x6e,0x65,0x28,0x29,0x00,0x00,
+0x0e,0x06,0x00,0x15,0x00,0x00,0x00,0x08,0x5f,0x64,0x6f,0x5f,0x6e,0x6f,0x6e,0x65,
+0x00,0x00,0x00,0x00,0x37,0x05,0x06,0x01,0x13,0x00,0x00,0x2c,0x1f,0x03,0x03,0x14,
+0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x3a,0x00,0x00,0x00,0x1f,0x06,0x03,0x15,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x5f,0x64,0x6f,0x5f,
+0x6e,0x6f,0x6e,0x65,0x28,0x29,0x00,0x00,0x0e,0x06,0x00,0x15,0x00,0x00,0x00,0x08,
+0x5f,0x64,0x6f,0x5f,0x6e,0x6f,0x6e,0x65,0x00,0x00,0x00,0x00,0x37,0x03,0x06,0x01,
+0x1f,0x06,0x03,0x16,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x20,0x3d,0x20,
+0x5f,0x64,0x6f,0x5f,0x6e,0x6f,0x6e,0x65,0x28,0x29,0x00,0x00,0x0e,0x06,0x00,0x15,
+0x00,0x00,0x00,0x08,0x5f,0x64,0x6f,0x5f,0x6e,0x6f,0x6e,0x65,0x00,0x00,0x00,0x00,
+0x37,0x04,0x06,0x01,0x1f,0x06,0x03,0x17,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x63,0x20,0x3d,0x20,0x5f,0x64,0x6f,0x5f,0x6e,0x6f,0x6e,0x65,0x28,0x29,0x00,0x00,
+0x0e,0x06,0x00,0x15,0x00,0x00,0x00,0x08,0x5f,0x64,0x6f,0x5f,0x6e,0x6f,0x6e,0x65,
+0x00,0x00,0x00,0x00,0x37,0x05,0x06,0x01,0x1f,0x06,0x03,0x18,0x20,0x20,0x20,0x20,
+0x63,0x6f,0x64,0x65,0x28,0x41,0x53,0x53,0x45,0x52,0x54,0x2c,0x72,0x2c,0x62,0x2c,
+0x63,0x29,0x3b,0x00,0x0e,0x06,0x00,0x16,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,
+0x00,0x00,0x00,0x00,0x0e,0x07,0x00,0x17,0x00,0x00,0x00,0x06,0x41,0x53,0x53,0x45,
+0x52,0x54,0x00,0x00,0x10,0x08,0x03,0x00,0x10,0x09,0x04,0x00,0x10,0x0a,0x05,0x00,
+0x37,0x02,0x06,0x05,0x1f,0x04,0x03,0x19,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x28,0x72,0x29,0x00,0x0e,0x06,0x00,0x18,0x00,0x00,0x00,0x08,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x07,0x03,0x00,
+0x37,0x02,0x06,0x02,0x1f,0x04,0x03,0x1a,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x28,0x62,0x29,0x00,0x0e,0x06,0x00,0x18,0x00,0x00,0x00,0x08,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x07,0x04,0x00,
+0x37,0x02,0x06,0x02,0x1f,0x04,0x03,0x1b,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x28,0x63,0x29,0x00,0x0e,0x06,0x00,0x18,0x00,0x00,0x00,0x08,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x10,0x07,0x05,0x00,
+0x37,0x02,0x06,0x02,0x1f,0x03,0x03,0x1c,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x00,0x00,0x1d,0x02,0x00,0x00,0x15,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x3f,0x00,0x67,0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x61,0x73,0x73,0x65,0x72,
+0x74,0x00,0x00,0x00,0x0f,0x3f,0x3e,0x00,0x1f,0x05,0x03,0x1e,0x64,0x65,0x66,0x20,
+0x64,0x6f,0x5f,0x72,0x61,0x69,0x73,0x65,0x28,0x74,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x3f,0x00,0x05,0x2a,0x24,0x35,0x34,0x30,0x00,0x00,0x00,0x0d,0x44,0x00,0x21,
+0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x1c,0x40,0x44,0x01,0x1c,0x41,0x00,0x00,
+0x1d,0x42,0x00,0x00,0x1d,0x43,0x00,0x00,0x11,0x3f,0x00,0x6f,0x2d,0x05,0x00,0x09,
+0x00,0x00,0x00,0x02,0x1f,0x05,0x03,0x1e,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x72,
+0x61,0x69,0x73,0x65,0x28,0x74,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,
+0x00,0x00,0x00,0x08,0x64,0x6f,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x00,0x00,
+0x23,0x01,0x00,0x00,0x1f,0x09,0x03,0x1f,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,
+0x2e,0x69,0x74,0x65,0x6d,0x73,0x3a,0x20,0x72,0x20,0x3d,0x20,0x64,0x6f,0x28,0x74,
+0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x29,0x00,0x00,0x0d,0x02,0x00,0x02,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x01,0x00,0x02,
+0x00,0x00,0x00,0x00,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x12,0x33,0x01,0x00,0x01,
+0x72,0x00,0x00,0x00,0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,
+0x0d,0x04,0x00,0x02,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x09,0x03,0x00,0x04,0x00,0x00,0x00,0x01,0x0c,0x04,0x00,0x04,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x03,0x03,0x04,0x37,0x01,0x02,0x02,0x13,0x00,0x00,0x0f,
+0x1f,0x07,0x03,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x3a,0x20,0x72,0x20,
+0x3d,0x20,0x5f,0x64,0x6f,0x5f,0x6e,0x6f,0x6e,0x65,0x28,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x02,0x00,0x05,0x00,0x00,0x00,0x08,0x5f,0x64,0x6f,0x5f,0x6e,0x6f,0x6e,0x65,
+0x00,0x00,0x00,0x00,0x37,0x01,0x02,0x01,0x1f,0x05,0x03,0x21,0x20,0x20,0x20,0x20,
+0x63,0x6f,0x64,0x65,0x28,0x52,0x41,0x49,0x53,0x45,0x2c,0x72,0x29,0x00,0x00,0x00,
+0x0e,0x02,0x00,0x06,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,
+0x0e,0x03,0x00,0x07,0x00,0x00,0x00,0x05,0x52,0x41,0x49,0x53,0x45,0x00,0x00,0x00,
+0x10,0x04,0x01,0x00,0x37,0x02,0x02,0x03,0x1f,0x04,0x03,0x22,0x20,0x20,0x20,0x20,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x72,0x29,0x00,0x0e,0x02,0x00,0x08,
+0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x10,0x03,0x01,0x00,0x37,0x02,0x02,0x02,0x1f,0x03,0x03,0x23,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x00,0x00,0x1d,0x02,0x00,0x00,0x15,0x02,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x40,0x00,0x68,0x00,0x00,0x00,0x08,0x64,0x6f,0x5f,0x72,
+0x61,0x69,0x73,0x65,0x00,0x00,0x00,0x00,0x0f,0x40,0x3f,0x00,0x1f,0x06,0x03,0x25,
+0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,
+0x73,0x28,0x74,0x29,0x3a,0x00,0x00,0x00,0x33,0x40,0x00,0x05,0x2a,0x24,0x35,0x34,
+0x37,0x00,0x00,0x00,0x0d,0x45,0x00,0x21,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x1c,0x41,0x45,0x01,0x1c,0x42,0x00,0x00,0x1d,0x43,0x00,0x00,0x1d,0x44,0x00,0x00,
+0x11,0x40,0x00,0x42,0x2d,0x07,0x00,0x06,0x00,0x00,0x00,0x01,0x1f,0x06,0x03,0x25,
+0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,
+0x73,0x28,0x74,0x29,0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x0d,
+0x64,0x6f,0x5f,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x73,0x00,0x00,0x00,
+0x23,0x01,0x00,0x00,0x1f,0x0a,0x03,0x26,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,
+0x74,0x74,0x20,0x69,0x6e,0x20,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x3a,0x20,0x66,
+0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x64,0x6f,0x28,0x74,0x74,0x29,0x29,0x00,
+0x0d,0x02,0x00,0x02,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x09,0x03,0x00,0x02,0x00,0x00,0x00,0x00,0x0c,0x02,0x00,0x03,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x2b,0x01,0x03,0x02,0x13,0x00,0x00,0x0f,0x33,0x01,0x00,0x02,
+0x74,0x74,0x00,0x00,0x0e,0x04,0x00,0x04,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x05,0x00,0x00,0x00,0x02,
+0x64,0x6f,0x00,0x00,0x10,0x06,0x01,0x00,0x37,0x05,0x05,0x02,0x37,0x01,0x04,0x02,
+0x13,0x00,0xff,0xf1,0x00,0x00,0x00,0x00,0x0d,0x41,0x00,0x69,0x00,0x00,0x00,0x0d,
+0x64,0x6f,0x5f,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x73,0x00,0x00,0x00,
+0x0f,0x41,0x40,0x00,0x1f,0x06,0x03,0x28,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x6c,
+0x69,0x73,0x74,0x28,0x74,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,
+0x33,0x41,0x00,0x05,0x2a,0x24,0x35,0x35,0x34,0x00,0x00,0x00,0x0d,0x46,0x00,0x21,
+0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x47,0x00,0x1f,0x00,0x00,0x00,0x01,
+0x72,0x00,0x00,0x00,0x1c,0x42,0x46,0x02,0x1d,0x46,0x00,0x00,0x1c,0x43,0x46,0x01,
+0x1d,0x44,0x00,0x00,0x1d,0x45,0x00,0x00,0x11,0x41,0x00,0x4a,0x2d,0x06,0x00,0x06,
+0x00,0x00,0x00,0x01,0x1f,0x06,0x03,0x28,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x6c,
+0x69,0x73,0x74,0x28,0x74,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,
+0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x72,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x07,
+0x64,0x6f,0x5f,0x6c,0x69,0x73,0x74,0x00,0x23,0x02,0x00,0x00,0x1f,0x05,0x03,0x29,
+0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x28,
+0x72,0x29,0x00,0x00,0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,
+0x74,0x6d,0x70,0x00,0x10,0x03,0x01,0x00,0x37,0x01,0x02,0x02,0x1f,0x08,0x03,0x2a,
+0x20,0x20,0x20,0x20,0x6d,0x61,0x6e,0x61,0x67,0x65,0x5f,0x73,0x65,0x71,0x28,0x4c,
+0x49,0x53,0x54,0x2c,0x72,0x2c,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x29,0x00,0x00,
+0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x0a,0x6d,0x61,0x6e,0x61,0x67,0x65,0x5f,0x73,
+0x65,0x71,0x00,0x00,0x0e,0x03,0x00,0x04,0x00,0x00,0x00,0x04,0x4c,0x49,0x53,0x54,
+0x00,0x00,0x00,0x00,0x10,0x04,0x01,0x00,0x0d,0x05,0x00,0x05,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x05,0x00,0x05,0x00,0x00,0x00,0x00,
+0x37,0x02,0x02,0x04,0x1f,0x04,0x03,0x2b,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x42,0x00,0x6a,0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x6c,0x69,0x73,0x74,0x00,
+0x0f,0x42,0x41,0x00,0x1f,0x06,0x03,0x2d,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x64,
+0x69,0x63,0x74,0x28,0x74,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,
+0x33,0x42,0x00,0x05,0x2a,0x24,0x35,0x36,0x33,0x00,0x00,0x00,0x0d,0x47,0x00,0x21,
+0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x48,0x00,0x1f,0x00,0x00,0x00,0x01,
+0x72,0x00,0x00,0x00,0x1c,0x43,0x47,0x02,0x1d,0x47,0x00,0x00,0x1c,0x44,0x47,0x01,
+0x1d,0x45,0x00,0x00,0x1d,0x46,0x00,0x00,0x11,0x42,0x00,0x4a,0x2d,0x06,0x00,0x06,
+0x00,0x00,0x00,0x01,0x1f,0x06,0x03,0x2d,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x64,
+0x69,0x63,0x74,0x28,0x74,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,
+0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x72,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x07,
+0x64,0x6f,0x5f,0x64,0x69,0x63,0x74,0x00,0x23,0x02,0x00,0x00,0x1f,0x05,0x03,0x2e,
+0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x67,0x65,0x74,0x5f,0x74,0x6d,0x70,0x28,
+0x72,0x29,0x00,0x00,0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,
+0x74,0x6d,0x70,0x00,0x10,0x03,0x01,0x00,0x37,0x01,0x02,0x02,0x1f,0x08,0x03,0x2f,
+0x20,0x20,0x20,0x20,0x6d,0x61,0x6e,0x61,0x67,0x65,0x5f,0x73,0x65,0x71,0x28,0x44,
+0x49,0x43,0x54,0x2c,0x72,0x2c,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x29,0x00,0x00,
+0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x0a,0x6d,0x61,0x6e,0x61,0x67,0x65,0x5f,0x73,
+0x65,0x71,0x00,0x00,0x0e,0x03,0x00,0x04,0x00,0x00,0x00,0x04,0x44,0x49,0x43,0x54,
+0x00,0x00,0x00,0x00,0x10,0x04,0x01,0x00,0x0d,0x05,0x00,0x05,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x05,0x00,0x05,0x00,0x00,0x00,0x00,
+0x37,0x02,0x02,0x04,0x1f,0x04,0x03,0x30,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x43,0x00,0x6b,0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x64,0x69,0x63,0x74,0x00,
+0x0f,0x43,0x42,0x00,0x1f,0x06,0x03,0x32,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x67,
+0x65,0x74,0x28,0x74,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x43,0x00,0x05,0x2a,0x24,0x35,0x37,0x32,0x00,0x00,0x00,0x0d,0x48,0x00,0x21,
+0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x49,0x00,0x1f,0x00,0x00,0x00,0x01,
+0x72,0x00,0x00,0x00,0x1c,0x44,0x48,0x02,0x1d,0x48,0x00,0x00,0x1c,0x45,0x48,0x01,
+0x1d,0x46,0x00,0x00,0x1d,0x47,0x00,0x00,0x11,0x43,0x00,0x4b,0x2d,0x08,0x00,0x07,
+0x00,0x00,0x00,0x01,0x1f,0x06,0x03,0x32,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x67,
+0x65,0x74,0x28,0x74,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x72,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x06,
+0x64,0x6f,0x5f,0x67,0x65,0x74,0x00,0x00,0x23,0x02,0x00,0x00,0x1f,0x05,0x03,0x33,
+0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,0x73,0x20,0x3d,0x20,0x74,0x2e,0x69,0x74,
+0x65,0x6d,0x73,0x00,0x33,0x02,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x02,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x09,0x02,0x00,0x03,0x00,0x00,0x00,0x00,0x1f,0x0b,0x03,0x34,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x69,0x6e,0x66,0x69,0x78,0x28,0x47,0x45,0x54,
+0x2c,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x2c,0x69,0x74,0x65,0x6d,0x73,0x5b,
+0x31,0x5d,0x2c,0x72,0x29,0x00,0x00,0x00,0x0e,0x03,0x00,0x03,0x00,0x00,0x00,0x05,
+0x69,0x6e,0x66,0x69,0x78,0x00,0x00,0x00,0x0e,0x04,0x00,0x04,0x00,0x00,0x00,0x03,
+0x47,0x45,0x54,0x00,0x0c,0x00,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x05,0x02,0x00,0x0c,0x00,0x00,0x06,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x06,0x02,0x00,0x10,0x07,0x01,0x00,0x37,0x00,0x03,0x05,0x15,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x44,0x00,0x6c,0x00,0x00,0x00,0x06,0x64,0x6f,0x5f,0x67,
+0x65,0x74,0x00,0x00,0x0f,0x44,0x43,0x00,0x1f,0x05,0x03,0x36,0x64,0x65,0x66,0x20,
+0x6d,0x63,0x61,0x63,0x68,0x65,0x5f,0x73,0x6c,0x6f,0x74,0x28,0x29,0x3a,0x00,0x00,
+0x33,0x44,0x00,0x05,0x2a,0x24,0x35,0x38,0x31,0x00,0x00,0x00,0x1c,0x45,0x00,0x00,
+0x1c,0x46,0x00,0x00,0x1d,0x47,0x00,0x00,0x1d,0x48,0x00,0x00,0x11,0x44,0x00,0x4f,
+0x2d,0x03,0x00,0x05,0x00,0x00,0x00,0x02,0x1f,0x05,0x03,0x36,0x64,0x65,0x66,0x20,
+0x6d,0x63,0x61,0x63,0x68,0x65,0x5f,0x73,0x6c,0x6f,0x74,0x28,0x29,0x3a,0x00,0x00,
+0x33,0x00,0x00,0x0b,0x5f,0x5f,0x76,0x61,0x72,0x61,0x72,0x67,0x73,0x5f,0x5f,0x00,
+0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x0d,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,
+0x6d,0x63,0x61,0x63,0x68,0x65,0x5f,0x73,0x6c,0x6f,0x74,0x00,0x23,0x00,0x00,0x00,
+0x1f,0x05,0x03,0x38,0x20,0x20,0x20,0x20,0x44,0x2e,0x6d,0x63,0x61,0x63,0x68,0x65,
+0x73,0x20,0x2b,0x3d,0x20,0x31,0x00,0x00,0x0e,0x00,0x00,0x02,0x00,0x00,0x00,0x01,
+0x44,0x00,0x00,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x07,0x6d,0x63,0x61,0x63,0x68,0x65,0x73,0x00,
+0x09,0x01,0x01,0x02,0x00,0x00,0x00,0x00,0x0c,0x02,0x00,0x04,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x02,0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x07,
+0x6d,0x63,0x61,0x63,0x68,0x65,0x73,0x00,0x0b,0x00,0x02,0x01,0x1f,0x07,0x03,0x39,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x44,0x2e,0x6d,0x63,0x61,
+0x63,0x68,0x65,0x73,0x20,0x2d,0x20,0x31,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x02,
+0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x01,0x00,0x03,0x00,0x00,0x00,0x07,
+0x6d,0x63,0x61,0x63,0x68,0x65,0x73,0x00,0x09,0x00,0x00,0x01,0x00,0x00,0x00,0x01,
+0x0c,0x01,0x00,0x04,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x02,0x00,0x00,0x01,
+0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x45,0x00,0x6d,0x00,0x00,0x00,0x0b,
+0x6d,0x63,0x61,0x63,0x68,0x65,0x5f,0x73,0x6c,0x6f,0x74,0x00,0x0f,0x45,0x44,0x00,
+0x1f,0x06,0x03,0x3b,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x6d,0x67,0x65,0x74,0x28,
+0x74,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x33,0x45,0x00,0x05,
+0x2a,0x24,0x35,0x38,0x37,0x00,0x00,0x00,0x0d,0x4a,0x00,0x21,0x00,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x0d,0x4b,0x00,0x1f,0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,
+0x1c,0x46,0x4a,0x02,0x1d,0x4a,0x00,0x00,0x1c,0x47,0x4a,0x01,0x1d,0x48,0x00,0x00,
+0x1d,0x49,0x00,0x00,0x11,0x45,0x00,0x6a,0x2d,0x08,0x00,0x09,0x00,0x00,0x00,0x01,
+0x1f,0x06,0x03,0x3b,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x6d,0x67,0x65,0x74,0x28,
+0x74,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x72,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,
+0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,
+0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x6d,
+0x67,0x65,0x74,0x00,0x23,0x02,0x00,0x00,0x1f,0x05,0x03,0x3c,0x20,0x20,0x20,0x20,
+0x69,0x74,0x65,0x6d,0x73,0x20,0x3d,0x20,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x00,
+0x33,0x02,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x0d,0x03,0x00,0x02,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x02,0x00,0x03,
+0x00,0x00,0x00,0x00,0x1f,0x0a,0x03,0x3d,0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,
+0x69,0x6e,0x66,0x69,0x78,0x28,0x4d,0x47,0x45,0x54,0x2c,0x69,0x74,0x65,0x6d,0x73,
+0x5b,0x30,0x5d,0x2c,0x69,0x74,0x65,0x6d,0x73,0x5b,0x31,0x5d,0x2c,0x72,0x29,0x00,
+0x0e,0x03,0x00,0x03,0x00,0x00,0x00,0x05,0x69,0x6e,0x66,0x69,0x78,0x00,0x00,0x00,
+0x0e,0x04,0x00,0x04,0x00,0x00,0x00,0x04,0x4d,0x47,0x45,0x54,0x00,0x00,0x00,0x00,
+0x0c,0x00,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x05,0x02,0x00,
+0x0c,0x00,0x00,0x06,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x06,0x02,0x00,
+0x10,0x07,0x01,0x00,0x37,0x01,0x03,0x05,0x1f,0x08,0x03,0x3e,0x20,0x20,0x20,0x20,
+0x63,0x6f,0x64,0x65,0x5f,0x31,0x36,0x28,0x30,0x2c,0x30,0x2c,0x6d,0x63,0x61,0x63,
+0x68,0x65,0x5f,0x73,0x6c,0x6f,0x74,0x28,0x29,0x29,0x00,0x00,0x0e,0x03,0x00,0x07,
+0x00,0x00,0x00,0x07,0x63,0x6f,0x64,0x65,0x5f,0x31,0x36,0x00,0x0c,0x04,0x00,0x05,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0c,0x05,0x00,0x05,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0e,0x07,0x00,0x08,0x00,0x00,0x00,0x0b,0x6d,0x63,0x61,0x63,
+0x68,0x65,0x5f,0x73,0x6c,0x6f,0x74,0x00,0x37,0x06,0x07,0x01,0x37,0x00,0x03,0x04,
+0x1f,0x04,0x03,0x3f,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,
+0x00,0x00,0x00,0x00,0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x46,0x00,0x6e,
+0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x6d,0x67,0x65,0x74,0x00,0x0f,0x46,0x45,0x00,
+0x1f,0x0b,0x03,0x41,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x62,0x72,0x65,0x61,0x6b,
+0x28,0x74,0x29,0x3a,0x20,0x6a,0x75,0x6d,0x70,0x28,0x44,0x2e,0x74,0x73,0x74,0x61,
+0x63,0x6b,0x5b,0x2d,0x31,0x5d,0x2c,0x27,0x62,0x72,0x65,0x61,0x6b,0x27,0x29,0x00,
+0x33,0x46,0x00,0x05,0x2a,0x24,0x35,0x39,0x36,0x00,0x00,0x00,0x0d,0x4b,0x00,0x21,
+0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x1c,0x47,0x4b,0x01,0x1c,0x48,0x00,0x00,
+0x1d,0x49,0x00,0x00,0x1d,0x4a,0x00,0x00,0x11,0x46,0x00,0x38,0x2d,0x04,0x00,0x07,
+0x00,0x00,0x00,0x01,0x1f,0x0b,0x03,0x41,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x62,
+0x72,0x65,0x61,0x6b,0x28,0x74,0x29,0x3a,0x20,0x6a,0x75,0x6d,0x70,0x28,0x44,0x2e,
+0x74,0x73,0x74,0x61,0x63,0x6b,0x5b,0x2d,0x31,0x5d,0x2c,0x27,0x62,0x72,0x65,0x61,
+0x6b,0x27,0x29,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x08,0x64,0x6f,0x5f,0x62,
+0x72,0x65,0x61,0x6b,0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x0e,0x01,0x00,0x02,
+0x00,0x00,0x00,0x04,0x6a,0x75,0x6d,0x70,0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x03,
+0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x03,0x00,0x04,0x00,0x00,0x00,0x06,
+0x74,0x73,0x74,0x61,0x63,0x6b,0x00,0x00,0x09,0x02,0x02,0x03,0x00,0x00,0x00,0x00,
+0x0c,0x03,0x00,0x05,0x00,0x00,0x69,0x04,0xff,0xff,0xff,0xff,0x0a,0x02,0x02,0x03,
+0x0d,0x03,0x00,0x06,0x00,0x00,0x00,0x05,0x62,0x72,0x65,0x61,0x6b,0x00,0x00,0x00,
+0x37,0x01,0x01,0x03,0x00,0x00,0x00,0x00,0x0d,0x47,0x00,0x6f,0x00,0x00,0x00,0x08,
+0x64,0x6f,0x5f,0x62,0x72,0x65,0x61,0x6b,0x00,0x00,0x00,0x00,0x0f,0x47,0x46,0x00,
+0x1f,0x0d,0x03,0x42,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x63,0x6f,0x6e,0x74,0x69,
+0x6e,0x75,0x65,0x28,0x74,0x29,0x3a,0x20,0x6a,0x75,0x6d,0x70,0x28,0x44,0x2e,0x74,
+0x73,0x74,0x61,0x63,0x6b,0x5b,0x2d,0x31,0x5d,0x2c,0x27,0x63,0x6f,0x6e,0x74,0x69,
+0x6e,0x75,0x65,0x27,0x29,0x00,0x00,0x00,0x33,0x47,0x00,0x05,0x2a,0x24,0x36,0x30,
+0x33,0x00,0x00,0x00,0x0d,0x4c,0x00,0x21,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x1c,0x48,0x4c,0x01,0x1c,0x49,0x00,0x00,0x1d,0x4a,0x00,0x00,0x1d,0x4b,0x00,0x00,
+0x11,0x47,0x00,0x3b,0x2d,0x04,0x00,0x07,0x00,0x00,0x00,0x01,0x1f,0x0d,0x03,0x42,
+0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x28,
+0x74,0x29,0x3a,0x20,0x6a,0x75,0x6d,0x70,0x28,0x44,0x2e,0x74,0x73,0x74,0x61,0x63,
+0x6b,0x5b,0x2d,0x31,0x5d,0x2c,0x27,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x27,
+0x29,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x0b,0x64,0x6f,0x5f,0x63,
+0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x00,0x23,0x01,0x00,0x00,0x0e,0x01,0x00,0x02,
+0x00,0x00,0x00,0x04,0x6a,0x75,0x6d,0x70,0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x03,
+0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x03,0x00,0x04,0x00,0x00,0x00,0x06,
+0x74,0x73,0x74,0x61,0x63,0x6b,0x00,0x00,0x09,0x02,0x02,0x03,0x00,0x00,0x00,0x00,
+0x0c,0x03,0x00,0x05,0x00,0x00,0x69,0x04,0xff,0xff,0xff,0xff,0x0a,0x02,0x02,0x03,
+0x0d,0x03,0x00,0x06,0x00,0x00,0x00,0x08,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,
+0x00,0x00,0x00,0x00,0x37,0x01,0x01,0x03,0x00,0x00,0x00,0x00,0x0d,0x48,0x00,0x70,
+0x00,0x00,0x00,0x0b,0x64,0x6f,0x5f,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x00,
+0x0f,0x48,0x47,0x00,0x1f,0x07,0x03,0x43,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x70,
+0x61,0x73,0x73,0x28,0x74,0x29,0x3a,0x20,0x63,0x6f,0x64,0x65,0x28,0x50,0x41,0x53,
+0x53,0x29,0x00,0x00,0x33,0x48,0x00,0x05,0x2a,0x24,0x36,0x31,0x30,0x00,0x00,0x00,
+0x0d,0x4d,0x00,0x21,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x1c,0x49,0x4d,0x01,
+0x1c,0x4a,0x00,0x00,0x1d,0x4b,0x00,0x00,0x1d,0x4c,0x00,0x00,0x11,0x48,0x00,0x26,
+0x2d,0x03,0x00,0x04,0x00,0x00,0x00,0x00,0x1f,0x07,0x03,0x43,0x64,0x65,0x66,0x20,
+0x64,0x6f,0x5f,0x70,0x61,0x73,0x73,0x28,0x74,0x29,0x3a,0x20,0x63,0x6f,0x64,0x65,
+0x28,0x50,0x41,0x53,0x53,0x29,0x00,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x07,
+0x64,0x6f,0x5f,0x70,0x61,0x73,0x73,0x00,0x23,0x01,0x00,0x00,0x0e,0x01,0x00,0x02,
+0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x03,
+0x00,0x00,0x00,0x04,0x50,0x41,0x53,0x53,0x00,0x00,0x00,0x00,0x37,0x01,0x01,0x02,
+0x00,0x00,0x00,0x00,0x0d,0x49,0x00,0x71,0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x70,
+0x61,0x73,0x73,0x00,0x0f,0x49,0x48,0x00,0x1f,0x06,0x03,0x45,0x64,0x65,0x66,0x20,
+0x64,0x6f,0x5f,0x69,0x6e,0x66,0x6f,0x28,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x3f,0x27,
+0x29,0x3a,0x00,0x00,0x33,0x49,0x00,0x05,0x2a,0x24,0x36,0x31,0x37,0x00,0x00,0x00,
+0x0d,0x4e,0x00,0x72,0x00,0x00,0x00,0x04,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,
+0x1c,0x4a,0x4e,0x01,0x0d,0x4e,0x00,0x01,0x00,0x00,0x00,0x01,0x3f,0x00,0x00,0x00,
+0x1c,0x4b,0x4e,0x01,0x1d,0x4c,0x00,0x00,0x1d,0x4d,0x00,0x00,0x11,0x49,0x00,0x8f,
+0x2d,0x09,0x00,0x0b,0x00,0x00,0x00,0x04,0x1f,0x06,0x03,0x45,0x64,0x65,0x66,0x20,
+0x64,0x6f,0x5f,0x69,0x6e,0x66,0x6f,0x28,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x3f,0x27,
+0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x04,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x07,
+0x64,0x6f,0x5f,0x69,0x6e,0x66,0x6f,0x00,0x23,0x01,0x00,0x00,0x1f,0x06,0x03,0x46,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x44,0x2e,0x6e,0x6f,0x70,0x6f,0x73,0x3a,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x00,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x01,
+0x44,0x00,0x00,0x00,0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x05,0x6e,0x6f,0x70,0x6f,
+0x73,0x00,0x00,0x00,0x09,0x01,0x01,0x02,0x00,0x00,0x00,0x00,0x16,0x01,0x00,0x00,
+0x13,0x00,0x00,0x03,0x1d,0x01,0x00,0x00,0x15,0x01,0x00,0x00,0x1f,0x0e,0x03,0x47,
+0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x28,0x46,0x49,0x4c,0x45,0x2c,0x66,0x72,
+0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x5f,0x64,0x6f,0x5f,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x28,0x44,0x2e,0x66,0x6e,0x61,0x6d,0x65,0x2e,0x65,0x6e,0x63,0x6f,0x64,0x65,
+0x28,0x29,0x29,0x29,0x29,0x00,0x00,0x00,0x0e,0x02,0x00,0x04,0x00,0x00,0x00,0x04,
+0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x05,0x00,0x00,0x00,0x04,
+0x46,0x49,0x4c,0x45,0x00,0x00,0x00,0x00,0x0e,0x04,0x00,0x06,0x00,0x00,0x00,0x08,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x07,
+0x00,0x00,0x00,0x0a,0x5f,0x64,0x6f,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,
+0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x06,0x00,0x08,
+0x00,0x00,0x00,0x05,0x66,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x09,0x01,0x01,0x06,
+0x00,0x00,0x00,0x01,0x0d,0x06,0x00,0x09,0x00,0x00,0x00,0x06,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x00,0x00,0x38,0x07,0x01,0x06,0x00,0x00,0x00,0x02,0x39,0x06,0x07,0x02,
+0x37,0x05,0x05,0x02,0x37,0x04,0x04,0x02,0x37,0x01,0x02,0x03,0x1f,0x0d,0x03,0x48,
+0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x28,0x4e,0x41,0x4d,0x45,0x2c,0x66,0x72,
+0x65,0x65,0x5f,0x74,0x6d,0x70,0x28,0x5f,0x64,0x6f,0x5f,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x28,0x6e,0x61,0x6d,0x65,0x2e,0x65,0x6e,0x63,0x6f,0x64,0x65,0x28,0x29,0x29,
+0x29,0x29,0x00,0x00,0x0e,0x02,0x00,0x04,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,
+0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x0a,0x00,0x00,0x00,0x04,0x4e,0x41,0x4d,0x45,
+0x00,0x00,0x00,0x00,0x0e,0x04,0x00,0x06,0x00,0x00,0x00,0x08,0x66,0x72,0x65,0x65,
+0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x07,0x00,0x00,0x00,0x0a,
+0x5f,0x64,0x6f,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x0d,0x01,0x00,0x09,
+0x00,0x00,0x00,0x06,0x65,0x6e,0x63,0x6f,0x64,0x65,0x00,0x00,0x38,0x07,0x00,0x01,
+0x00,0x00,0x00,0x03,0x39,0x06,0x07,0x02,0x37,0x05,0x05,0x02,0x37,0x04,0x04,0x02,
+0x37,0x01,0x02,0x03,0x00,0x00,0x00,0x00,0x0d,0x4a,0x00,0x73,0x00,0x00,0x00,0x07,
+0x64,0x6f,0x5f,0x69,0x6e,0x66,0x6f,0x00,0x0f,0x4a,0x49,0x00,0x1f,0x05,0x03,0x49,
+0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x28,0x74,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x4a,0x00,0x05,0x2a,0x24,0x36,0x32,0x35,0x00,0x00,0x00,
+0x0d,0x4f,0x00,0x21,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x1c,0x4b,0x4f,0x01,
+0x1c,0x4c,0x00,0x00,0x1d,0x4d,0x00,0x00,0x1d,0x4e,0x00,0x00,0x11,0x4a,0x00,0x44,
+0x2d,0x05,0x00,0x07,0x00,0x00,0x00,0x01,0x1f,0x05,0x03,0x49,0x64,0x65,0x66,0x20,
+0x64,0x6f,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x28,0x74,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x6d,0x6f,0x64,0x75,0x6c,
+0x65,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x04,0x03,0x4a,0x20,0x20,0x20,0x20,
+0x64,0x6f,0x5f,0x69,0x6e,0x66,0x6f,0x28,0x29,0x00,0x00,0x00,0x0e,0x01,0x00,0x02,
+0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x69,0x6e,0x66,0x6f,0x00,0x37,0x01,0x01,0x01,
+0x1f,0x09,0x03,0x4b,0x20,0x20,0x20,0x20,0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,
+0x28,0x64,0x6f,0x28,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x5b,0x30,0x5d,0x29,0x29,
+0x20,0x23,0x52,0x45,0x47,0x00,0x00,0x00,0x0e,0x01,0x00,0x03,0x00,0x00,0x00,0x08,
+0x66,0x72,0x65,0x65,0x5f,0x74,0x6d,0x70,0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x04,
+0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x0d,0x04,0x00,0x05,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x03,0x00,0x04,0x00,0x00,0x00,0x00,
+0x0c,0x04,0x00,0x06,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x03,0x03,0x04,
+0x37,0x02,0x02,0x02,0x37,0x01,0x01,0x02,0x00,0x00,0x00,0x00,0x0d,0x4b,0x00,0x74,
+0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x00,0x00,0x00,
+0x0f,0x4b,0x4a,0x00,0x1f,0x09,0x03,0x4c,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x72,
+0x65,0x67,0x28,0x74,0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x20,0x72,0x65,
+0x74,0x75,0x72,0x6e,0x20,0x74,0x2e,0x76,0x61,0x6c,0x00,0x00,0x33,0x4b,0x00,0x05,
+0x2a,0x24,0x36,0x33,0x32,0x00,0x00,0x00,0x0d,0x50,0x00,0x21,0x00,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x0d,0x51,0x00,0x1f,0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,
+0x1c,0x4c,0x50,0x02,0x1d,0x50,0x00,0x00,0x1c,0x4d,0x50,0x01,0x1d,0x4e,0x00,0x00,
+0x1d,0x4f,0x00,0x00,0x11,0x4b,0x00,0x25,0x2d,0x04,0x00,0x03,0x00,0x00,0x00,0x01,
+0x1f,0x09,0x03,0x4c,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x72,0x65,0x67,0x28,0x74,
+0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+0x20,0x74,0x2e,0x76,0x61,0x6c,0x00,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x06,
+0x64,0x6f,0x5f,0x72,0x65,0x67,0x00,0x00,0x23,0x01,0x00,0x00,0x0d,0x01,0x00,0x02,
+0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x09,0x01,0x00,0x01,0x00,0x00,0x00,0x00,
+0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x4c,0x00,0x75,0x00,0x00,0x00,0x06,
+0x64,0x6f,0x5f,0x72,0x65,0x67,0x00,0x00,0x0f,0x4c,0x4b,0x00,0x1f,0x03,0x03,0x4e,
+0x66,0x6d,0x61,0x70,0x20,0x3d,0x20,0x7b,0x00,0x00,0x00,0x00,0x0d,0x4c,0x00,0x76,
+0x00,0x00,0x00,0x04,0x66,0x6d,0x61,0x70,0x00,0x00,0x00,0x00,0x1f,0x10,0x03,0x4f,
+0x20,0x20,0x20,0x20,0x27,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x27,0x3a,0x64,0x6f,0x5f,
+0x6d,0x6f,0x64,0x75,0x6c,0x65,0x2c,0x27,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,
+0x74,0x73,0x27,0x3a,0x64,0x6f,0x5f,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,
+0x73,0x2c,0x27,0x64,0x65,0x66,0x27,0x3a,0x64,0x6f,0x5f,0x64,0x65,0x66,0x2c,0x00,
+0x0d,0x4e,0x00,0x77,0x00,0x00,0x00,0x06,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x00,0x00,
+0x0e,0x4f,0x00,0x74,0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x6d,0x6f,0x64,0x75,0x6c,
+0x65,0x00,0x00,0x00,0x0d,0x50,0x00,0x78,0x00,0x00,0x00,0x0a,0x73,0x74,0x61,0x74,
+0x65,0x6d,0x65,0x6e,0x74,0x73,0x00,0x00,0x0e,0x51,0x00,0x69,0x00,0x00,0x00,0x0d,
+0x64,0x6f,0x5f,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x73,0x00,0x00,0x00,
+0x0d,0x52,0x00,0x79,0x00,0x00,0x00,0x03,0x64,0x65,0x66,0x00,0x0e,0x53,0x00,0x5d,
+0x00,0x00,0x00,0x06,0x64,0x6f,0x5f,0x64,0x65,0x66,0x00,0x00,0x1f,0x13,0x03,0x50,
+0x20,0x20,0x20,0x20,0x27,0x72,0x65,0x74,0x75,0x72,0x6e,0x27,0x3a,0x64,0x6f,0x5f,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x2c,0x20,0x27,0x61,0x73,0x73,0x65,0x72,0x74,0x27,
+0x3a,0x64,0x6f,0x5f,0x61,0x73,0x73,0x65,0x72,0x74,0x2c,0x20,0x27,0x77,0x68,0x69,
+0x6c,0x65,0x27,0x3a,0x64,0x6f,0x5f,0x77,0x68,0x69,0x6c,0x65,0x2c,0x27,0x69,0x66,
+0x27,0x3a,0x64,0x6f,0x5f,0x69,0x66,0x2c,0x00,0x00,0x00,0x00,0x0d,0x54,0x00,0x7a,
+0x00,0x00,0x00,0x06,0x72,0x65,0x74,0x75,0x72,0x6e,0x00,0x00,0x0e,0x55,0x00,0x66,
+0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x72,0x65,0x74,0x75,0x72,0x6e,0x00,0x00,0x00,
+0x0d,0x56,0x00,0x7b,0x00,0x00,0x00,0x06,0x61,0x73,0x73,0x65,0x72,0x74,0x00,0x00,
+0x0e,0x57,0x00,0x67,0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x61,0x73,0x73,0x65,0x72,
+0x74,0x00,0x00,0x00,0x0d,0x58,0x00,0x7c,0x00,0x00,0x00,0x05,0x77,0x68,0x69,0x6c,
+0x65,0x00,0x00,0x00,0x0e,0x59,0x00,0x5f,0x00,0x00,0x00,0x08,0x64,0x6f,0x5f,0x77,
+0x68,0x69,0x6c,0x65,0x00,0x00,0x00,0x00,0x0d,0x5a,0x00,0x7d,0x00,0x00,0x00,0x02,
+0x69,0x66,0x00,0x00,0x0e,0x5b,0x00,0x64,0x00,0x00,0x00,0x05,0x64,0x6f,0x5f,0x69,
+0x66,0x00,0x00,0x00,0x1f,0x13,0x03,0x51,0x20,0x20,0x20,0x20,0x27,0x62,0x72,0x65,
+0x61,0x6b,0x27,0x3a,0x64,0x6f,0x5f,0x62,0x72,0x65,0x61,0x6b,0x2c,0x27,0x70,0x61,
+0x73,0x73,0x27,0x3a,0x64,0x6f,0x5f,0x70,0x61,0x73,0x73,0x2c,0x27,0x63,0x6f,0x6e,
+0x74,0x69,0x6e,0x75,0x65,0x27,0x3a,0x64,0x6f,0x5f,0x63,0x6f,0x6e,0x74,0x69,0x6e,
+0x75,0x65,0x2c,0x27,0x66,0x6f,0x72,0x27,0x3a,0x64,0x6f,0x5f,0x66,0x6f,0x72,0x2c,
+0x00,0x00,0x00,0x00,0x0d,0x5c,0x00,0x7e,0x00,0x00,0x00,0x05,0x62,0x72,0x65,0x61,
+0x6b,0x00,0x00,0x00,0x0e,0x5d,0x00,0x6f,0x00,0x00,0x00,0x08,0x64,0x6f,0x5f,0x62,
+0x72,0x65,0x61,0x6b,0x00,0x00,0x00,0x00,0x0d,0x5e,0x00,0x7f,0x00,0x00,0x00,0x04,
+0x70,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x0e,0x5f,0x00,0x71,0x00,0x00,0x00,0x07,
+0x64,0x6f,0x5f,0x70,0x61,0x73,0x73,0x00,0x0d,0x60,0x00,0x80,0x00,0x00,0x00,0x08,
+0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x00,0x00,0x00,0x00,0x0e,0x61,0x00,0x70,
+0x00,0x00,0x00,0x0b,0x64,0x6f,0x5f,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x00,
+0x0d,0x62,0x00,0x81,0x00,0x00,0x00,0x03,0x66,0x6f,0x72,0x00,0x0e,0x63,0x00,0x62,
+0x00,0x00,0x00,0x06,0x64,0x6f,0x5f,0x66,0x6f,0x72,0x00,0x00,0x1f,0x12,0x03,0x52,
+0x20,0x20,0x20,0x20,0x27,0x63,0x6c,0x61,0x73,0x73,0x27,0x3a,0x64,0x6f,0x5f,0x63,
+0x6c,0x61,0x73,0x73,0x2c,0x27,0x72,0x61,0x69,0x73,0x65,0x27,0x3a,0x64,0x6f,0x5f,
+0x72,0x61,0x69,0x73,0x65,0x2c,0x27,0x74,0x72,0x79,0x27,0x3a,0x64,0x6f,0x5f,0x74,
+0x72,0x79,0x2c,0x27,0x69,0x6d,0x70,0x6f,0x72,0x74,0x27,0x3a,0x64,0x6f,0x5f,0x69,
+0x6d,0x70,0x6f,0x72,0x74,0x2c,0x00,0x00,0x0d,0x64,0x00,0x82,0x00,0x00,0x00,0x05,
+0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x0e,0x65,0x00,0x5e,0x00,0x00,0x00,0x08,
+0x64,0x6f,0x5f,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x0d,0x66,0x00,0x83,
+0x00,0x00,0x00,0x05,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x00,0x0e,0x67,0x00,0x68,
+0x00,0x00,0x00,0x08,0x64,0x6f,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x00,0x00,
+0x0d,0x68,0x00,0x84,0x00,0x00,0x00,0x03,0x74,0x72,0x79,0x00,0x0e,0x69,0x00,0x65,
+0x00,0x00,0x00,0x06,0x64,0x6f,0x5f,0x74,0x72,0x79,0x00,0x00,0x0d,0x6a,0x00,0x85,
+0x00,0x00,0x00,0x06,0x69,0x6d,0x70,0x6f,0x72,0x74,0x00,0x00,0x0e,0x6b,0x00,0x53,
+0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,0x00,0x00,0x00,
+0x1f,0x0e,0x03,0x53,0x20,0x20,0x20,0x20,0x27,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,
+0x27,0x3a,0x64,0x6f,0x5f,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x2c,0x27,0x64,0x65,
+0x6c,0x27,0x3a,0x64,0x6f,0x5f,0x64,0x65,0x6c,0x2c,0x27,0x66,0x72,0x6f,0x6d,0x27,
+0x3a,0x64,0x6f,0x5f,0x66,0x72,0x6f,0x6d,0x2c,0x00,0x00,0x00,0x0d,0x6c,0x00,0x86,
+0x00,0x00,0x00,0x07,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x00,0x0e,0x6d,0x00,0x55,
+0x00,0x00,0x00,0x0a,0x64,0x6f,0x5f,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x00,0x00,
+0x0d,0x6e,0x00,0x87,0x00,0x00,0x00,0x03,0x64,0x65,0x6c,0x00,0x0e,0x6f,0x00,0x57,
+0x00,0x00,0x00,0x06,0x64,0x6f,0x5f,0x64,0x65,0x6c,0x00,0x00,0x0d,0x70,0x00,0x88,
+0x00,0x00,0x00,0x04,0x66,0x72,0x6f,0x6d,0x00,0x00,0x00,0x00,0x0e,0x71,0x00,0x54,
+0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x66,0x72,0x6f,0x6d,0x00,0x1b,0x4d,0x4e,0x24,
+0x0f,0x4c,0x4d,0x00,0x1f,0x03,0x03,0x55,0x72,0x6d,0x61,0x70,0x20,0x3d,0x20,0x7b,
+0x00,0x00,0x00,0x00,0x0d,0x4c,0x00,0x89,0x00,0x00,0x00,0x04,0x72,0x6d,0x61,0x70,
+0x00,0x00,0x00,0x00,0x1f,0x12,0x03,0x56,0x20,0x20,0x20,0x20,0x27,0x6c,0x69,0x73,
+0x74,0x27,0x3a,0x64,0x6f,0x5f,0x6c,0x69,0x73,0x74,0x2c,0x20,0x27,0x74,0x75,0x70,
+0x6c,0x65,0x27,0x3a,0x64,0x6f,0x5f,0x6c,0x69,0x73,0x74,0x2c,0x20,0x27,0x64,0x69,
+0x63,0x74,0x27,0x3a,0x64,0x6f,0x5f,0x64,0x69,0x63,0x74,0x2c,0x20,0x27,0x73,0x6c,
+0x69,0x63,0x65,0x27,0x3a,0x64,0x6f,0x5f,0x6c,0x69,0x73,0x74,0x2c,0x00,0x00,0x00,
+0x0d,0x4e,0x00,0x8a,0x00,0x00,0x00,0x04,0x6c,0x69,0x73,0x74,0x00,0x00,0x00,0x00,
+0x0e,0x4f,0x00,0x6a,0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x6c,0x69,0x73,0x74,0x00,
+0x0d,0x50,0x00,0x8b,0x00,0x00,0x00,0x05,0x74,0x75,0x70,0x6c,0x65,0x00,0x00,0x00,
+0x0e,0x51,0x00,0x6a,0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x6c,0x69,0x73,0x74,0x00,
+0x0d,0x52,0x00,0x8c,0x00,0x00,0x00,0x04,0x64,0x69,0x63,0x74,0x00,0x00,0x00,0x00,
+0x0e,0x53,0x00,0x6b,0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x64,0x69,0x63,0x74,0x00,
+0x0d,0x54,0x00,0x8d,0x00,0x00,0x00,0x05,0x73,0x6c,0x69,0x63,0x65,0x00,0x00,0x00,
+0x0e,0x55,0x00,0x6a,0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x6c,0x69,0x73,0x74,0x00,
+0x1f,0x0e,0x03,0x57,0x20,0x20,0x20,0x20,0x27,0x63,0x6f,0x6d,0x70,0x27,0x3a,0x64,
+0x6f,0x5f,0x63,0x6f,0x6d,0x70,0x2c,0x20,0x27,0x6e,0x61,0x6d,0x65,0x27,0x3a,0x64,
+0x6f,0x5f,0x6e,0x61,0x6d,0x65,0x2c,0x27,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x27,0x3a,
+0x64,0x6f,0x5f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x2c,0x00,0x00,0x0d,0x56,0x00,0x8e,
+0x00,0x00,0x00,0x04,0x63,0x6f,0x6d,0x70,0x00,0x00,0x00,0x00,0x0e,0x57,0x00,0x63,
+0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x63,0x6f,0x6d,0x70,0x00,0x0d,0x58,0x00,0x72,
+0x00,0x00,0x00,0x04,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,0x0e,0x59,0x00,0x5b,
+0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x6e,0x61,0x6d,0x65,0x00,0x0d,0x5a,0x00,0x8f,
+0x00,0x00,0x00,0x06,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x00,0x00,0x0e,0x5b,0x00,0x4d,
+0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x00,0x00,0x00,
+0x1f,0x0b,0x03,0x58,0x20,0x20,0x20,0x20,0x27,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,
+0x27,0x3a,0x64,0x6f,0x5f,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x2c,0x20,0x27,0x66,
+0x6c,0x6f,0x61,0x74,0x27,0x3a,0x64,0x6f,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x2c,0x00,
+0x0d,0x5c,0x00,0x90,0x00,0x00,0x00,0x07,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x00,
+0x0e,0x5d,0x00,0x28,0x00,0x00,0x00,0x0a,0x64,0x6f,0x5f,0x69,0x6e,0x74,0x65,0x67,
+0x65,0x72,0x00,0x00,0x0d,0x5e,0x00,0x91,0x00,0x00,0x00,0x05,0x66,0x6c,0x6f,0x61,
+0x74,0x00,0x00,0x00,0x0e,0x5f,0x00,0x27,0x00,0x00,0x00,0x08,0x64,0x6f,0x5f,0x66,
+0x6c,0x6f,0x61,0x74,0x00,0x00,0x00,0x00,0x1f,0x15,0x03,0x59,0x20,0x20,0x20,0x20,
+0x27,0x73,0x74,0x72,0x69,0x6e,0x67,0x27,0x3a,0x64,0x6f,0x5f,0x73,0x74,0x72,0x69,
+0x6e,0x67,0x2c,0x27,0x67,0x65,0x74,0x27,0x3a,0x64,0x6f,0x5f,0x67,0x65,0x74,0x2c,
+0x20,0x27,0x6d,0x67,0x65,0x74,0x27,0x3a,0x64,0x6f,0x5f,0x6d,0x67,0x65,0x74,0x2c,
+0x20,0x27,0x63,0x61,0x6c,0x6c,0x27,0x3a,0x64,0x6f,0x5f,0x63,0x61,0x6c,0x6c,0x2c,
+0x20,0x27,0x72,0x65,0x67,0x27,0x3a,0x64,0x6f,0x5f,0x72,0x65,0x67,0x2c,0x00,0x00,
+0x0d,0x60,0x00,0x92,0x00,0x00,0x00,0x06,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,
+0x0e,0x61,0x00,0x22,0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x00,0x00,0x00,0x0d,0x62,0x00,0x93,0x00,0x00,0x00,0x03,0x67,0x65,0x74,0x00,
+0x0e,0x63,0x00,0x6c,0x00,0x00,0x00,0x06,0x64,0x6f,0x5f,0x67,0x65,0x74,0x00,0x00,
+0x0d,0x64,0x00,0x94,0x00,0x00,0x00,0x04,0x6d,0x67,0x65,0x74,0x00,0x00,0x00,0x00,
+0x0e,0x65,0x00,0x6e,0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x6d,0x67,0x65,0x74,0x00,
+0x0d,0x66,0x00,0x95,0x00,0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,
+0x0e,0x67,0x00,0x5a,0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x63,0x61,0x6c,0x6c,0x00,
+0x0d,0x68,0x00,0x96,0x00,0x00,0x00,0x03,0x72,0x65,0x67,0x00,0x0e,0x69,0x00,0x75,
+0x00,0x00,0x00,0x06,0x64,0x6f,0x5f,0x72,0x65,0x67,0x00,0x00,0x1b,0x4d,0x4e,0x1c,
+0x0f,0x4c,0x4d,0x00,0x1f,0x05,0x03,0x5c,0x64,0x65,0x66,0x20,0x64,0x6f,0x28,0x74,
+0x2c,0x72,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x00,0x33,0x4c,0x00,0x05,
+0x2a,0x24,0x37,0x30,0x39,0x00,0x00,0x00,0x0d,0x51,0x00,0x21,0x00,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x0d,0x52,0x00,0x1f,0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,
+0x1c,0x4d,0x51,0x02,0x1d,0x51,0x00,0x00,0x1c,0x4e,0x51,0x01,0x1d,0x4f,0x00,0x00,
+0x1d,0x50,0x00,0x00,0x11,0x4c,0x00,0x84,0x2d,0x06,0x00,0x08,0x00,0x00,0x00,0x05,
+0x1f,0x05,0x03,0x5c,0x64,0x65,0x66,0x20,0x64,0x6f,0x28,0x74,0x2c,0x72,0x3d,0x4e,
+0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x33,0x01,0x00,0x01,0x72,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x02,0x00,0x00,
+0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x23,0x02,0x00,0x00,
+0x1f,0x07,0x03,0x5d,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,0x2e,0x70,0x6f,0x73,
+0x3a,0x20,0x73,0x65,0x74,0x70,0x6f,0x73,0x28,0x74,0x2e,0x70,0x6f,0x73,0x29,0x00,
+0x0d,0x03,0x00,0x02,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x02,0x00,0x03,
+0x00,0x00,0x00,0x00,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x0b,0x0e,0x03,0x00,0x03,
+0x00,0x00,0x00,0x06,0x73,0x65,0x74,0x70,0x6f,0x73,0x00,0x00,0x0d,0x05,0x00,0x02,
+0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x04,0x00,0x05,0x00,0x00,0x00,0x01,
+0x37,0x02,0x03,0x02,0x1f,0x03,0x03,0x5f,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x31,
+0x3a,0x00,0x00,0x00,0x0c,0x02,0x00,0x04,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x47,0x1f,0x07,0x03,0x60,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,0x2e,0x74,0x79,0x70,0x65,0x20,0x69,0x6e,
+0x20,0x72,0x6d,0x61,0x70,0x3a,0x00,0x00,0x0d,0x03,0x00,0x05,0x00,0x00,0x00,0x04,
+0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x09,0x02,0x00,0x03,0x00,0x00,0x00,0x02,
+0x0e,0x03,0x00,0x06,0x00,0x00,0x00,0x04,0x72,0x6d,0x61,0x70,0x00,0x00,0x00,0x00,
+0x25,0x02,0x02,0x03,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x1b,0x1f,0x0a,0x03,0x61,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x72,0x6d,0x61,0x70,0x5b,0x74,0x2e,0x74,0x79,0x70,0x65,0x5d,0x28,
+0x74,0x2c,0x72,0x29,0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x06,0x00,0x00,0x00,0x04,
+0x72,0x6d,0x61,0x70,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x05,0x00,0x00,0x00,0x04,
+0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x09,0x02,0x00,0x02,0x00,0x00,0x00,0x03,
+0x0a,0x03,0x03,0x02,0x10,0x04,0x00,0x00,0x10,0x05,0x01,0x00,0x37,0x02,0x03,0x03,
+0x15,0x02,0x00,0x00,0x1f,0x08,0x03,0x63,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6d,0x61,0x70,0x5b,0x74,0x2e,0x74,0x79,
+0x70,0x65,0x5d,0x28,0x74,0x29,0x00,0x00,0x0e,0x03,0x00,0x07,0x00,0x00,0x00,0x04,
+0x66,0x6d,0x61,0x70,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x05,0x00,0x00,0x00,0x04,
+0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x09,0x05,0x00,0x02,0x00,0x00,0x00,0x04,
+0x0a,0x03,0x03,0x05,0x10,0x04,0x00,0x00,0x37,0x02,0x03,0x02,0x15,0x02,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x4d,0x00,0x97,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,
+0x0f,0x4d,0x4c,0x00,0x1f,0x0a,0x03,0x6a,0x64,0x65,0x66,0x20,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x28,0x66,0x6e,0x61,0x6d,0x65,0x2c,0x73,0x2c,0x74,0x2c,0x6f,0x70,0x74,
+0x69,0x6d,0x69,0x7a,0x65,0x3d,0x54,0x72,0x75,0x65,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x4d,0x00,0x05,0x2a,0x24,0x37,0x31,0x38,0x00,0x00,0x00,0x0d,0x52,0x00,0x98,
+0x00,0x00,0x00,0x05,0x66,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x0d,0x53,0x00,0x99,
+0x00,0x00,0x00,0x01,0x73,0x00,0x00,0x00,0x0d,0x54,0x00,0x21,0x00,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x0d,0x55,0x00,0x9a,0x00,0x00,0x00,0x08,0x6f,0x70,0x74,0x69,
+0x6d,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x1c,0x4e,0x52,0x04,0x0c,0x52,0x00,0x9b,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x1c,0x4f,0x52,0x01,0x1d,0x50,0x00,0x00,
+0x1d,0x51,0x00,0x00,0x11,0x4d,0x01,0x28,0x2d,0x0c,0x00,0x11,0x00,0x00,0x00,0x08,
+0x1f,0x0a,0x03,0x6a,0x64,0x65,0x66,0x20,0x65,0x6e,0x63,0x6f,0x64,0x65,0x28,0x66,
+0x6e,0x61,0x6d,0x65,0x2c,0x73,0x2c,0x74,0x2c,0x6f,0x70,0x74,0x69,0x6d,0x69,0x7a,
+0x65,0x3d,0x54,0x72,0x75,0x65,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x05,
+0x66,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x73,0x00,0x00,0x00,
+0x33,0x02,0x00,0x01,0x74,0x00,0x00,0x00,0x33,0x03,0x00,0x08,0x6f,0x70,0x74,0x69,
+0x6d,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x04,0x00,0x00,
+0x0d,0x04,0x00,0x01,0x00,0x00,0x00,0x06,0x65,0x6e,0x63,0x6f,0x64,0x65,0x00,0x00,
+0x23,0x04,0x00,0x00,0x1f,0x0b,0x03,0x6b,0x20,0x20,0x20,0x20,0x74,0x20,0x3d,0x20,
+0x54,0x6f,0x6b,0x65,0x6e,0x28,0x28,0x31,0x2c,0x31,0x29,0x2c,0x27,0x6d,0x6f,0x64,
+0x75,0x6c,0x65,0x27,0x2c,0x27,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x27,0x2c,0x5b,0x74,
+0x5d,0x29,0x00,0x00,0x0e,0x05,0x00,0x02,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x0c,0x0a,0x00,0x03,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0c,0x0b,0x00,0x03,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x1c,0x06,0x0a,0x02,
+0x0d,0x07,0x00,0x04,0x00,0x00,0x00,0x06,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x00,0x00,
+0x0d,0x08,0x00,0x04,0x00,0x00,0x00,0x06,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x00,0x00,
+0x10,0x0a,0x02,0x00,0x1c,0x09,0x0a,0x01,0x37,0x02,0x05,0x05,0x1f,0x04,0x03,0x6c,
+0x20,0x20,0x20,0x20,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x20,0x44,0x00,0x00,0x00,0x00,
+0x1f,0x07,0x03,0x6d,0x20,0x20,0x20,0x20,0x73,0x20,0x3d,0x20,0x74,0x6f,0x6b,0x65,
+0x6e,0x69,0x7a,0x65,0x2e,0x63,0x6c,0x65,0x61,0x6e,0x28,0x73,0x29,0x00,0x00,0x00,
+0x0e,0x08,0x00,0x05,0x00,0x00,0x00,0x08,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x09,0x00,0x06,0x00,0x00,0x00,0x05,0x63,0x6c,0x65,0x61,
+0x6e,0x00,0x00,0x00,0x38,0x05,0x08,0x09,0x00,0x00,0x00,0x00,0x10,0x07,0x01,0x00,
+0x39,0x01,0x05,0x03,0x1f,0x06,0x03,0x6e,0x20,0x20,0x20,0x20,0x44,0x20,0x3d,0x20,
+0x44,0x53,0x74,0x61,0x74,0x65,0x28,0x73,0x2c,0x66,0x6e,0x61,0x6d,0x65,0x29,0x00,
+0x0d,0x04,0x00,0x07,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0e,0x06,0x00,0x08,
+0x00,0x00,0x00,0x06,0x44,0x53,0x74,0x61,0x74,0x65,0x00,0x00,0x10,0x07,0x01,0x00,
+0x10,0x08,0x00,0x00,0x37,0x05,0x06,0x03,0x0f,0x04,0x05,0x00,0x1f,0x05,0x03,0x6f,
+0x20,0x20,0x20,0x20,0x44,0x2e,0x62,0x65,0x67,0x69,0x6e,0x28,0x54,0x72,0x75,0x65,
+0x29,0x00,0x00,0x00,0x0e,0x08,0x00,0x07,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,
+0x0d,0x09,0x00,0x09,0x00,0x00,0x00,0x05,0x62,0x65,0x67,0x69,0x6e,0x00,0x00,0x00,
+0x38,0x05,0x08,0x09,0x00,0x00,0x00,0x01,0x0c,0x07,0x00,0x03,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x39,0x04,0x05,0x03,0x1f,0x03,0x03,0x70,0x20,0x20,0x20,0x20,
+0x64,0x6f,0x28,0x74,0x29,0x00,0x00,0x00,0x0e,0x05,0x00,0x0a,0x00,0x00,0x00,0x02,
+0x64,0x6f,0x00,0x00,0x10,0x06,0x02,0x00,0x37,0x04,0x05,0x02,0x1f,0x03,0x03,0x71,
+0x20,0x20,0x20,0x20,0x44,0x2e,0x65,0x6e,0x64,0x28,0x29,0x00,0x0e,0x07,0x00,0x07,
+0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x08,0x00,0x0b,0x00,0x00,0x00,0x03,
+0x65,0x6e,0x64,0x00,0x38,0x05,0x07,0x08,0x00,0x00,0x00,0x02,0x39,0x04,0x05,0x02,
+0x1f,0x05,0x03,0x72,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6f,0x70,0x74,0x69,0x6d,
+0x69,0x7a,0x65,0x3a,0x00,0x00,0x00,0x00,0x16,0x03,0x00,0x00,0x13,0x00,0x00,0x51,
+0x1f,0x0b,0x03,0x73,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x44,0x2e,0x6f,0x75,
+0x74,0x20,0x3d,0x20,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x2e,0x70,0x65,0x65,
+0x70,0x68,0x6f,0x6c,0x65,0x28,0x44,0x2e,0x6f,0x75,0x74,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x04,0x00,0x07,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0e,0x09,0x00,0x0c,
+0x00,0x00,0x00,0x08,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x00,0x00,0x00,0x00,
+0x0d,0x0a,0x00,0x0c,0x00,0x00,0x00,0x08,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,
+0x00,0x00,0x00,0x00,0x38,0x06,0x09,0x0a,0x00,0x00,0x00,0x03,0x0e,0x08,0x00,0x07,
+0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x09,0x00,0x0d,0x00,0x00,0x00,0x03,
+0x6f,0x75,0x74,0x00,0x09,0x08,0x08,0x09,0x00,0x00,0x00,0x04,0x39,0x05,0x06,0x03,
+0x0d,0x06,0x00,0x0d,0x00,0x00,0x00,0x03,0x6f,0x75,0x74,0x00,0x0b,0x04,0x06,0x05,
+0x1f,0x0b,0x03,0x74,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x44,0x2e,0x6f,0x75,
+0x74,0x20,0x3d,0x20,0x72,0x65,0x67,0x61,0x6c,0x6c,0x6f,0x63,0x2e,0x72,0x65,0x67,
+0x61,0x6c,0x6c,0x6f,0x63,0x28,0x44,0x2e,0x6f,0x75,0x74,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x04,0x00,0x07,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0e,0x09,0x00,0x0e,
+0x00,0x00,0x00,0x08,0x72,0x65,0x67,0x61,0x6c,0x6c,0x6f,0x63,0x00,0x00,0x00,0x00,
+0x0d,0x0a,0x00,0x0e,0x00,0x00,0x00,0x08,0x72,0x65,0x67,0x61,0x6c,0x6c,0x6f,0x63,
+0x00,0x00,0x00,0x00,0x38,0x06,0x09,0x0a,0x00,0x00,0x00,0x05,0x0e,0x08,0x00,0x07,
+0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,0x0d,0x09,0x00,0x0d,0x00,0x00,0x00,0x03,
+0x6f,0x75,0x74,0x00,0x09,0x08,0x08,0x09,0x00,0x00,0x00,0x06,0x39,0x05,0x06,0x03,
+0x0d,0x06,0x00,0x0d,0x00,0x00,0x00,0x03,0x6f,0x75,0x74,0x00,0x0b,0x04,0x06,0x05,
+0x1f,0x04,0x03,0x75,0x20,0x20,0x20,0x20,0x6d,0x61,0x70,0x5f,0x74,0x61,0x67,0x73,
+0x28,0x29,0x00,0x00,0x0e,0x05,0x00,0x0f,0x00,0x00,0x00,0x08,0x6d,0x61,0x70,0x5f,
+0x74,0x61,0x67,0x73,0x00,0x00,0x00,0x00,0x37,0x04,0x05,0x01,0x1f,0x07,0x03,0x76,
+0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x44,0x2e,0x6f,0x75,0x74,0x3b,
+0x20,0x44,0x20,0x3d,0x20,0x4e,0x6f,0x6e,0x65,0x00,0x00,0x00,0x33,0x04,0x00,0x03,
+0x6f,0x75,0x74,0x00,0x0e,0x05,0x00,0x07,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,
+0x0d,0x06,0x00,0x0d,0x00,0x00,0x00,0x03,0x6f,0x75,0x74,0x00,0x09,0x04,0x05,0x06,
+0x00,0x00,0x00,0x07,0x0d,0x05,0x00,0x07,0x00,0x00,0x00,0x01,0x44,0x00,0x00,0x00,
+0x1d,0x06,0x00,0x00,0x0f,0x05,0x06,0x00,0x1f,0x06,0x03,0x79,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6a,0x6f,0x69,0x6e,0x28,0x6f,0x75,0x74,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x10,0x00,0x00,0x00,0x04,0x6a,0x6f,0x69,0x6e,
+0x00,0x00,0x00,0x00,0x10,0x07,0x04,0x00,0x37,0x05,0x06,0x02,0x15,0x05,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x4e,0x00,0x9c,0x00,0x00,0x00,0x06,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x00,0x00,0x0f,0x4e,0x4d,0x00,0x00,0x00,0x00,0x00,
+};
+
+static tpd_code * _tp_tinypy_compiler_encode_0(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 14: goto L14;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 33: goto L33;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 62: goto L62;
+        case 67: goto L67;
+        case 76: goto L76;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 87: goto L87;
+        case 88: goto L88;
+        case 98: goto L98;
+        case 103: goto L103;
+        case 111: goto L111;
+        case 114: goto L114;
+        case 115: goto L115;
+        case 120: goto L120;
+        case 121: goto L121;
+        case 132: goto L132;
+        case 137: goto L137;
+        case 145: goto L145;
+        case 148: goto L148;
+        case 149: goto L149;
+        case 154: goto L154;
+        case 155: goto L155;
+        case 167: goto L167;
+        case 172: goto L172;
+        case 181: goto L181;
+        case 182: goto L182;
+        case 183: goto L183;
+        case 188: goto L188;
+        case 189: goto L189;
+        case 201: goto L201;
+        case 206: goto L206;
+        case 215: goto L215;
+        case 216: goto L216;
+        case 217: goto L217;
+        case 222: goto L222;
+        case 223: goto L223;
+        case 228: goto L228;
+        case 229: goto L229;
+        case 232: goto L232;
+        case 236: goto L236;
+        case 237: goto L237;
+        case 241: goto L241;
+        case 242: goto L242;
+        case 246: goto L246;
+        case 247: goto L247;
+        case 250: goto L250;
+        case 251: goto L251;
+        case 252: goto L252;
+        case 253: goto L253;
+        case 254: goto L254;
+        case 1480: goto L1480;
+        case 1481: goto L1481;
+        case 1482: goto L1482;
+        case 1483: goto L1483;
+        case 1492: goto L1492;
+        case 1495: goto L1495;
+        case 1498: goto L1498;
+        case 1499: goto L1499;
+        case 1500: goto L1500;
+        case 1501: goto L1501;
+        case 1502: goto L1502;
+        case 1548: goto L1548;
+        case 1552: goto L1552;
+        case 1553: goto L1553;
+        case 1558: goto L1558;
+        case 1561: goto L1561;
+        case 1564: goto L1564;
+        case 1565: goto L1565;
+        case 1566: goto L1566;
+        case 1567: goto L1567;
+        case 1568: goto L1568;
+        case 1691: goto L1691;
+        case 1695: goto L1695;
+        case 1696: goto L1696;
+        case 1701: goto L1701;
+        case 1704: goto L1704;
+        case 1707: goto L1707;
+        case 1708: goto L1708;
+        case 1709: goto L1709;
+        case 1710: goto L1710;
+        case 1711: goto L1711;
+        case 1924: goto L1924;
+        case 1928: goto L1928;
+        case 1929: goto L1929;
+        case 1937: goto L1937;
+        case 1940: goto L1940;
+        case 1943: goto L1943;
+        case 1946: goto L1946;
+        case 1949: goto L1949;
+        case 1952: goto L1952;
+        case 1953: goto L1953;
+        case 1956: goto L1956;
+        case 1959: goto L1959;
+        case 1962: goto L1962;
+        case 1963: goto L1963;
+        case 1964: goto L1964;
+        case 1965: goto L1965;
+        case 2122: goto L2122;
+        case 2126: goto L2126;
+        case 2127: goto L2127;
+        case 2133: goto L2133;
+        case 2136: goto L2136;
+        case 2139: goto L2139;
+        case 2142: goto L2142;
+        case 2145: goto L2145;
+        case 2146: goto L2146;
+        case 2147: goto L2147;
+        case 2148: goto L2148;
+        case 2149: goto L2149;
+        case 2232: goto L2232;
+        case 2236: goto L2236;
+        case 2237: goto L2237;
+        case 2244: goto L2244;
+        case 2247: goto L2247;
+        case 2250: goto L2250;
+        case 2253: goto L2253;
+        case 2256: goto L2256;
+        case 2257: goto L2257;
+        case 2258: goto L2258;
+        case 2259: goto L2259;
+        case 2260: goto L2260;
+        case 2331: goto L2331;
+        case 2336: goto L2336;
+        case 2337: goto L2337;
+        case 2344: goto L2344;
+        case 2347: goto L2347;
+        case 2350: goto L2350;
+        case 2351: goto L2351;
+        case 2352: goto L2352;
+        case 2353: goto L2353;
+        case 2354: goto L2354;
+        case 2456: goto L2456;
+        case 2461: goto L2461;
+        case 2462: goto L2462;
+        case 2470: goto L2470;
+        case 2473: goto L2473;
+        case 2476: goto L2476;
+        case 2479: goto L2479;
+        case 2480: goto L2480;
+        case 2481: goto L2481;
+        case 2482: goto L2482;
+        case 2483: goto L2483;
+        case 2484: goto L2484;
+        case 2630: goto L2630;
+        case 2635: goto L2635;
+        case 2636: goto L2636;
+        case 2644: goto L2644;
+        case 2647: goto L2647;
+        case 2650: goto L2650;
+        case 2653: goto L2653;
+        case 2654: goto L2654;
+        case 2655: goto L2655;
+        case 2656: goto L2656;
+        case 2657: goto L2657;
+        case 2658: goto L2658;
+        case 2712: goto L2712;
+        case 2717: goto L2717;
+        case 2718: goto L2718;
+        case 2725: goto L2725;
+        case 2728: goto L2728;
+        case 2731: goto L2731;
+        case 2734: goto L2734;
+        case 2735: goto L2735;
+        case 2736: goto L2736;
+        case 2737: goto L2737;
+        case 2738: goto L2738;
+        case 2739: goto L2739;
+        case 2883: goto L2883;
+        case 2888: goto L2888;
+        case 2889: goto L2889;
+        case 2897: goto L2897;
+        case 2900: goto L2900;
+        case 2903: goto L2903;
+        case 2906: goto L2906;
+        case 2907: goto L2907;
+        case 2908: goto L2908;
+        case 2909: goto L2909;
+        case 2910: goto L2910;
+        case 2911: goto L2911;
+        case 3079: goto L3079;
+        case 3084: goto L3084;
+        case 3085: goto L3085;
+        case 3095: goto L3095;
+        case 3098: goto L3098;
+        case 3102: goto L3102;
+        case 3105: goto L3105;
+        case 3108: goto L3108;
+        case 3109: goto L3109;
+        case 3110: goto L3110;
+        case 3111: goto L3111;
+        case 3112: goto L3112;
+        case 3113: goto L3113;
+        case 3270: goto L3270;
+        case 3275: goto L3275;
+        case 3276: goto L3276;
+        case 3283: goto L3283;
+        case 3286: goto L3286;
+        case 3289: goto L3289;
+        case 3292: goto L3292;
+        case 3293: goto L3293;
+        case 3294: goto L3294;
+        case 3295: goto L3295;
+        case 3296: goto L3296;
+        case 3297: goto L3297;
+        case 3377: goto L3377;
+        case 3382: goto L3382;
+        case 3383: goto L3383;
+        case 3391: goto L3391;
+        case 3394: goto L3394;
+        case 3397: goto L3397;
+        case 3400: goto L3400;
+        case 3401: goto L3401;
+        case 3402: goto L3402;
+        case 3403: goto L3403;
+        case 3404: goto L3404;
+        case 3405: goto L3405;
+        case 3538: goto L3538;
+        case 3543: goto L3543;
+        case 3544: goto L3544;
+        case 3549: goto L3549;
+        case 3552: goto L3552;
+        case 3553: goto L3553;
+        case 3554: goto L3554;
+        case 3555: goto L3555;
+        case 3556: goto L3556;
+        case 3639: goto L3639;
+        case 3643: goto L3643;
+        case 3644: goto L3644;
+        case 3650: goto L3650;
+        case 3653: goto L3653;
+        case 3654: goto L3654;
+        case 3655: goto L3655;
+        case 3656: goto L3656;
+        case 3657: goto L3657;
+        case 3730: goto L3730;
+        case 3735: goto L3735;
+        case 3736: goto L3736;
+        case 3741: goto L3741;
+        case 3744: goto L3744;
+        case 3745: goto L3745;
+        case 3746: goto L3746;
+        case 3747: goto L3747;
+        case 3748: goto L3748;
+        case 3797: goto L3797;
+        case 3801: goto L3801;
+        case 3802: goto L3802;
+        case 3807: goto L3807;
+        case 3810: goto L3810;
+        case 3811: goto L3811;
+        case 3812: goto L3812;
+        case 3815: goto L3815;
+        case 3816: goto L3816;
+        case 3915: goto L3915;
+        case 3918: goto L3918;
+        case 3919: goto L3919;
+        case 3924: goto L3924;
+        case 3927: goto L3927;
+        case 3928: goto L3928;
+        case 3929: goto L3929;
+        case 3932: goto L3932;
+        case 3933: goto L3933;
+        case 4034: goto L4034;
+        case 4038: goto L4038;
+        case 4039: goto L4039;
+        case 4044: goto L4044;
+        case 4047: goto L4047;
+        case 4048: goto L4048;
+        case 4049: goto L4049;
+        case 4052: goto L4052;
+        case 4053: goto L4053;
+        case 4155: goto L4155;
+        case 4159: goto L4159;
+        case 4160: goto L4160;
+        case 4169: goto L4169;
+        case 4172: goto L4172;
+        case 4175: goto L4175;
+        case 4179: goto L4179;
+        case 4182: goto L4182;
+        case 4183: goto L4183;
+        case 4184: goto L4184;
+        case 4185: goto L4185;
+        case 4186: goto L4186;
+        case 4815: goto L4815;
+        case 4819: goto L4819;
+        case 4820: goto L4820;
+        case 4825: goto L4825;
+        case 4828: goto L4828;
+        case 4829: goto L4829;
+        case 4830: goto L4830;
+        case 4831: goto L4831;
+        case 4832: goto L4832;
+        case 5607: goto L5607;
+        case 5612: goto L5612;
+        case 5613: goto L5613;
+        case 5620: goto L5620;
+        case 5623: goto L5623;
+        case 5626: goto L5626;
+        case 5627: goto L5627;
+        case 5628: goto L5628;
+        case 5629: goto L5629;
+        case 5630: goto L5630;
+        case 5631: goto L5631;
+        case 5694: goto L5694;
+        case 5698: goto L5698;
+        case 5699: goto L5699;
+        case 5705: goto L5705;
+        case 5708: goto L5708;
+        case 5711: goto L5711;
+        case 5712: goto L5712;
+        case 5713: goto L5713;
+        case 5714: goto L5714;
+        case 5715: goto L5715;
+        case 5883: goto L5883;
+        case 5888: goto L5888;
+        case 5889: goto L5889;
+        case 5894: goto L5894;
+        case 5897: goto L5897;
+        case 5900: goto L5900;
+        case 5901: goto L5901;
+        case 5902: goto L5902;
+        case 5903: goto L5903;
+        case 5904: goto L5904;
+        case 6032: goto L6032;
+        case 6036: goto L6036;
+        case 6037: goto L6037;
+        case 6042: goto L6042;
+        case 6045: goto L6045;
+        case 6048: goto L6048;
+        case 6049: goto L6049;
+        case 6050: goto L6050;
+        case 6051: goto L6051;
+        case 6052: goto L6052;
+        case 6122: goto L6122;
+        case 6126: goto L6126;
+        case 6127: goto L6127;
+        case 6132: goto L6132;
+        case 6135: goto L6135;
+        case 6138: goto L6138;
+        case 6139: goto L6139;
+        case 6140: goto L6140;
+        case 6141: goto L6141;
+        case 6142: goto L6142;
+        case 6214: goto L6214;
+        case 6218: goto L6218;
+        case 6219: goto L6219;
+        case 6225: goto L6225;
+        case 6228: goto L6228;
+        case 6231: goto L6231;
+        case 6232: goto L6232;
+        case 6233: goto L6233;
+        case 6234: goto L6234;
+        case 6235: goto L6235;
+        case 6293: goto L6293;
+        case 6298: goto L6298;
+        case 6299: goto L6299;
+        case 6305: goto L6305;
+        case 6308: goto L6308;
+        case 6311: goto L6311;
+        case 6312: goto L6312;
+        case 6313: goto L6313;
+        case 6314: goto L6314;
+        case 6315: goto L6315;
+        case 6366: goto L6366;
+        case 6371: goto L6371;
+        case 6372: goto L6372;
+        case 6377: goto L6377;
+        case 6380: goto L6380;
+        case 6383: goto L6383;
+        case 6384: goto L6384;
+        case 6385: goto L6385;
+        case 6386: goto L6386;
+        case 6387: goto L6387;
+        case 6469: goto L6469;
+        case 6473: goto L6473;
+        case 6474: goto L6474;
+        case 6480: goto L6480;
+        case 6483: goto L6483;
+        case 6486: goto L6486;
+        case 6489: goto L6489;
+        case 6490: goto L6490;
+        case 6491: goto L6491;
+        case 6492: goto L6492;
+        case 6493: goto L6493;
+        case 6678: goto L6678;
+        case 6682: goto L6682;
+        case 6683: goto L6683;
+        case 6689: goto L6689;
+        case 6692: goto L6692;
+        case 6695: goto L6695;
+        case 6696: goto L6696;
+        case 6697: goto L6697;
+        case 6698: goto L6698;
+        case 6699: goto L6699;
+        case 6807: goto L6807;
+        case 6812: goto L6812;
+        case 6813: goto L6813;
+        case 6820: goto L6820;
+        case 6823: goto L6823;
+        case 6827: goto L6827;
+        case 6830: goto L6830;
+        case 6831: goto L6831;
+        case 6832: goto L6832;
+        case 6833: goto L6833;
+        case 6834: goto L6834;
+        case 6955: goto L6955;
+        case 6959: goto L6959;
+        case 6960: goto L6960;
+        case 6967: goto L6967;
+        case 6970: goto L6970;
+        case 6973: goto L6973;
+        case 6976: goto L6976;
+        case 6979: goto L6979;
+        case 6980: goto L6980;
+        case 6981: goto L6981;
+        case 6982: goto L6982;
+        case 6983: goto L6983;
+        case 6984: goto L6984;
+        case 7077: goto L7077;
+        case 7081: goto L7081;
+        case 7082: goto L7082;
+        case 7090: goto L7090;
+        case 7093: goto L7093;
+        case 7096: goto L7096;
+        case 7099: goto L7099;
+        case 7102: goto L7102;
+        case 7105: goto L7105;
+        case 7106: goto L7106;
+        case 7107: goto L7107;
+        case 7108: goto L7108;
+        case 7109: goto L7109;
+        case 7110: goto L7110;
+        case 7233: goto L7233;
+        case 7237: goto L7237;
+        case 7238: goto L7238;
+        case 7248: goto L7248;
+        case 7251: goto L7251;
+        case 7254: goto L7254;
+        case 7257: goto L7257;
+        case 7260: goto L7260;
+        case 7263: goto L7263;
+        case 7264: goto L7264;
+        case 7265: goto L7265;
+        case 7266: goto L7266;
+        case 7267: goto L7267;
+        case 7268: goto L7268;
+        case 7368: goto L7368;
+        case 7374: goto L7374;
+        case 7375: goto L7375;
+        case 7386: goto L7386;
+        case 7389: goto L7389;
+        case 7392: goto L7392;
+        case 7395: goto L7395;
+        case 7398: goto L7398;
+        case 7401: goto L7401;
+        case 7402: goto L7402;
+        case 7403: goto L7403;
+        case 7404: goto L7404;
+        case 7405: goto L7405;
+        case 7406: goto L7406;
+        case 7615: goto L7615;
+        case 7620: goto L7620;
+        case 7621: goto L7621;
+        case 7628: goto L7628;
+        case 7631: goto L7631;
+        case 7634: goto L7634;
+        case 7635: goto L7635;
+        case 7636: goto L7636;
+        case 7637: goto L7637;
+        case 7638: goto L7638;
+        case 7639: goto L7639;
+        case 7702: goto L7702;
+        case 7707: goto L7707;
+        case 7708: goto L7708;
+        case 7717: goto L7717;
+        case 7720: goto L7720;
+        case 7723: goto L7723;
+        case 7727: goto L7727;
+        case 7730: goto L7730;
+        case 7731: goto L7731;
+        case 7732: goto L7732;
+        case 7733: goto L7733;
+        case 7734: goto L7734;
+        case 7735: goto L7735;
+        case 8042: goto L8042;
+        case 8046: goto L8046;
+        case 8047: goto L8047;
+        case 8055: goto L8055;
+        case 8058: goto L8058;
+        case 8061: goto L8061;
+        case 8064: goto L8064;
+        case 8065: goto L8065;
+        case 8066: goto L8066;
+        case 8067: goto L8067;
+        case 8068: goto L8068;
+        case 8069: goto L8069;
+        case 8708: goto L8708;
+        case 8713: goto L8713;
+        case 8714: goto L8714;
+        case 8721: goto L8721;
+        case 8724: goto L8724;
+        case 8727: goto L8727;
+        case 8730: goto L8730;
+        case 8731: goto L8731;
+        case 8732: goto L8732;
+        case 8733: goto L8733;
+        case 8734: goto L8734;
+        case 9637: goto L9637;
+        case 9642: goto L9642;
+        case 9643: goto L9643;
+        case 9653: goto L9653;
+        case 9656: goto L9656;
+        case 9659: goto L9659;
+        case 9662: goto L9662;
+        case 9666: goto L9666;
+        case 9669: goto L9669;
+        case 9670: goto L9670;
+        case 9673: goto L9673;
+        case 9674: goto L9674;
+        case 9675: goto L9675;
+        case 9676: goto L9676;
+        case 9949: goto L9949;
+        case 9954: goto L9954;
+        case 9955: goto L9955;
+        case 9962: goto L9962;
+        case 9965: goto L9965;
+        case 9969: goto L9969;
+        case 9970: goto L9970;
+        case 9971: goto L9971;
+        case 9972: goto L9972;
+        case 9973: goto L9973;
+        case 10236: goto L10236;
+        case 10241: goto L10241;
+        case 10242: goto L10242;
+        case 10248: goto L10248;
+        case 10251: goto L10251;
+        case 10254: goto L10254;
+        case 10255: goto L10255;
+        case 10256: goto L10256;
+        case 10257: goto L10257;
+        case 10258: goto L10258;
+        case 10531: goto L10531;
+        case 10536: goto L10536;
+        case 10537: goto L10537;
+        case 10542: goto L10542;
+        case 10545: goto L10545;
+        case 10548: goto L10548;
+        case 10549: goto L10549;
+        case 10550: goto L10550;
+        case 10551: goto L10551;
+        case 10552: goto L10552;
+        case 11101: goto L11101;
+        case 11105: goto L11105;
+        case 11106: goto L11106;
+        case 11112: goto L11112;
+        case 11115: goto L11115;
+        case 11118: goto L11118;
+        case 11119: goto L11119;
+        case 11120: goto L11120;
+        case 11121: goto L11121;
+        case 11122: goto L11122;
+        case 11228: goto L11228;
+        case 11233: goto L11233;
+        case 11234: goto L11234;
+        case 11239: goto L11239;
+        case 11242: goto L11242;
+        case 11245: goto L11245;
+        case 11246: goto L11246;
+        case 11247: goto L11247;
+        case 11248: goto L11248;
+        case 11249: goto L11249;
+        case 11386: goto L11386;
+        case 11390: goto L11390;
+        case 11391: goto L11391;
+        case 11400: goto L11400;
+        case 11403: goto L11403;
+        case 11406: goto L11406;
+        case 11409: goto L11409;
+        case 11412: goto L11412;
+        case 11413: goto L11413;
+        case 11414: goto L11414;
+        case 11415: goto L11415;
+        case 11416: goto L11416;
+        case 11742: goto L11742;
+        case 11748: goto L11748;
+        case 11749: goto L11749;
+        case 11756: goto L11756;
+        case 11759: goto L11759;
+        case 11762: goto L11762;
+        case 11765: goto L11765;
+        case 11766: goto L11766;
+        case 11767: goto L11767;
+        case 11768: goto L11768;
+        case 11769: goto L11769;
+        case 11770: goto L11770;
+        case 12533: goto L12533;
+        case 12537: goto L12537;
+        case 12538: goto L12538;
+        case 12545: goto L12545;
+        case 12548: goto L12548;
+        case 12551: goto L12551;
+        case 12554: goto L12554;
+        case 12555: goto L12555;
+        case 12556: goto L12556;
+        case 12557: goto L12557;
+        case 12558: goto L12558;
+        case 12559: goto L12559;
+        case 12723: goto L12723;
+        case 12727: goto L12727;
+        case 12728: goto L12728;
+        case 12735: goto L12735;
+        case 12738: goto L12738;
+        case 12741: goto L12741;
+        case 12744: goto L12744;
+        case 12745: goto L12745;
+        case 12746: goto L12746;
+        case 12747: goto L12747;
+        case 12748: goto L12748;
+        case 12749: goto L12749;
+        case 12945: goto L12945;
+        case 12950: goto L12950;
+        case 12951: goto L12951;
+        case 12957: goto L12957;
+        case 12960: goto L12960;
+        case 12963: goto L12963;
+        case 12964: goto L12964;
+        case 12965: goto L12965;
+        case 12966: goto L12966;
+        case 12967: goto L12967;
+        case 13605: goto L13605;
+        case 13609: goto L13609;
+        case 13610: goto L13610;
+        case 13616: goto L13616;
+        case 13619: goto L13619;
+        case 13622: goto L13622;
+        case 13623: goto L13623;
+        case 13624: goto L13624;
+        case 13625: goto L13625;
+        case 13626: goto L13626;
+        case 14461: goto L14461;
+        case 14466: goto L14466;
+        case 14467: goto L14467;
+        case 14473: goto L14473;
+        case 14476: goto L14476;
+        case 14479: goto L14479;
+        case 14480: goto L14480;
+        case 14481: goto L14481;
+        case 14482: goto L14482;
+        case 14483: goto L14483;
+        case 14707: goto L14707;
+        case 14712: goto L14712;
+        case 14713: goto L14713;
+        case 14720: goto L14720;
+        case 14723: goto L14723;
+        case 14726: goto L14726;
+        case 14727: goto L14727;
+        case 14728: goto L14728;
+        case 14729: goto L14729;
+        case 14730: goto L14730;
+        case 14978: goto L14978;
+        case 14984: goto L14984;
+        case 14985: goto L14985;
+        case 14992: goto L14992;
+        case 14995: goto L14995;
+        case 14998: goto L14998;
+        case 14999: goto L14999;
+        case 15000: goto L15000;
+        case 15001: goto L15001;
+        case 15002: goto L15002;
+        case 15323: goto L15323;
+        case 15329: goto L15329;
+        case 15330: goto L15330;
+        case 15336: goto L15336;
+        case 15339: goto L15339;
+        case 15342: goto L15342;
+        case 15343: goto L15343;
+        case 15344: goto L15344;
+        case 15345: goto L15345;
+        case 15346: goto L15346;
+        case 15698: goto L15698;
+        case 15702: goto L15702;
+        case 15703: goto L15703;
+        case 15710: goto L15710;
+        case 15713: goto L15713;
+        case 15716: goto L15716;
+        case 15719: goto L15719;
+        case 15720: goto L15720;
+        case 15721: goto L15721;
+        case 15722: goto L15722;
+        case 15723: goto L15723;
+        case 15724: goto L15724;
+        case 16020: goto L16020;
+        case 16024: goto L16024;
+        case 16025: goto L16025;
+        case 16030: goto L16030;
+        case 16033: goto L16033;
+        case 16036: goto L16036;
+        case 16037: goto L16037;
+        case 16038: goto L16038;
+        case 16039: goto L16039;
+        case 16040: goto L16040;
+        case 16363: goto L16363;
+        case 16367: goto L16367;
+        case 16368: goto L16368;
+        case 16373: goto L16373;
+        case 16376: goto L16376;
+        case 16379: goto L16379;
+        case 16380: goto L16380;
+        case 16381: goto L16381;
+        case 16382: goto L16382;
+        case 16383: goto L16383;
+        case 16573: goto L16573;
+        case 16577: goto L16577;
+        case 16578: goto L16578;
+        case 16584: goto L16584;
+        case 16587: goto L16587;
+        case 16590: goto L16590;
+        case 16591: goto L16591;
+        case 16592: goto L16592;
+        case 16593: goto L16593;
+        case 16594: goto L16594;
+        case 16705: goto L16705;
+        case 16710: goto L16710;
+        case 16711: goto L16711;
+        case 16717: goto L16717;
+        case 16720: goto L16720;
+        case 16723: goto L16723;
+        case 16724: goto L16724;
+        case 16725: goto L16725;
+        case 16726: goto L16726;
+        case 16727: goto L16727;
+        case 17068: goto L17068;
+        case 17073: goto L17073;
+        case 17074: goto L17074;
+        case 17080: goto L17080;
+        case 17083: goto L17083;
+        case 17086: goto L17086;
+        case 17087: goto L17087;
+        case 17088: goto L17088;
+        case 17089: goto L17089;
+        case 17090: goto L17090;
+        case 17201: goto L17201;
+        case 17206: goto L17206;
+        case 17207: goto L17207;
+        case 17214: goto L17214;
+        case 17217: goto L17217;
+        case 17220: goto L17220;
+        case 17221: goto L17221;
+        case 17222: goto L17222;
+        case 17223: goto L17223;
+        case 17224: goto L17224;
+        case 17290: goto L17290;
+        case 17296: goto L17296;
+        case 17297: goto L17297;
+        case 17304: goto L17304;
+        case 17307: goto L17307;
+        case 17310: goto L17310;
+        case 17313: goto L17313;
+        case 17314: goto L17314;
+        case 17315: goto L17315;
+        case 17316: goto L17316;
+        case 17317: goto L17317;
+        case 17318: goto L17318;
+        case 17392: goto L17392;
+        case 17396: goto L17396;
+        case 17397: goto L17397;
+        case 17404: goto L17404;
+        case 17407: goto L17407;
+        case 17410: goto L17410;
+        case 17413: goto L17413;
+        case 17414: goto L17414;
+        case 17415: goto L17415;
+        case 17416: goto L17416;
+        case 17417: goto L17417;
+        case 17418: goto L17418;
+        case 17492: goto L17492;
+        case 17496: goto L17496;
+        case 17497: goto L17497;
+        case 17504: goto L17504;
+        case 17507: goto L17507;
+        case 17510: goto L17510;
+        case 17513: goto L17513;
+        case 17514: goto L17514;
+        case 17515: goto L17515;
+        case 17516: goto L17516;
+        case 17517: goto L17517;
+        case 17518: goto L17518;
+        case 17593: goto L17593;
+        case 17597: goto L17597;
+        case 17598: goto L17598;
+        case 17604: goto L17604;
+        case 17607: goto L17607;
+        case 17608: goto L17608;
+        case 17609: goto L17609;
+        case 17610: goto L17610;
+        case 17611: goto L17611;
+        case 17690: goto L17690;
+        case 17695: goto L17695;
+        case 17696: goto L17696;
+        case 17703: goto L17703;
+        case 17706: goto L17706;
+        case 17709: goto L17709;
+        case 17712: goto L17712;
+        case 17713: goto L17713;
+        case 17714: goto L17714;
+        case 17715: goto L17715;
+        case 17716: goto L17716;
+        case 17717: goto L17717;
+        case 17823: goto L17823;
+        case 17827: goto L17827;
+        case 17828: goto L17828;
+        case 17840: goto L17840;
+        case 17843: goto L17843;
+        case 17846: goto L17846;
+        case 17847: goto L17847;
+        case 17848: goto L17848;
+        case 17849: goto L17849;
+        case 17850: goto L17850;
+        case 17906: goto L17906;
+        case 17911: goto L17911;
+        case 17912: goto L17912;
+        case 17926: goto L17926;
+        case 17929: goto L17929;
+        case 17932: goto L17932;
+        case 17933: goto L17933;
+        case 17934: goto L17934;
+        case 17935: goto L17935;
+        case 17936: goto L17936;
+        case 17995: goto L17995;
+        case 18000: goto L18000;
+        case 18001: goto L18001;
+        case 18009: goto L18009;
+        case 18012: goto L18012;
+        case 18015: goto L18015;
+        case 18016: goto L18016;
+        case 18017: goto L18017;
+        case 18018: goto L18018;
+        case 18019: goto L18019;
+        case 18057: goto L18057;
+        case 18061: goto L18061;
+        case 18062: goto L18062;
+        case 18069: goto L18069;
+        case 18072: goto L18072;
+        case 18076: goto L18076;
+        case 18077: goto L18077;
+        case 18080: goto L18080;
+        case 18081: goto L18081;
+        case 18082: goto L18082;
+        case 18083: goto L18083;
+        case 18226: goto L18226;
+        case 18230: goto L18230;
+        case 18231: goto L18231;
+        case 18237: goto L18237;
+        case 18240: goto L18240;
+        case 18243: goto L18243;
+        case 18244: goto L18244;
+        case 18245: goto L18245;
+        case 18246: goto L18246;
+        case 18247: goto L18247;
+        case 18315: goto L18315;
+        case 18320: goto L18320;
+        case 18321: goto L18321;
+        case 18331: goto L18331;
+        case 18334: goto L18334;
+        case 18337: goto L18337;
+        case 18340: goto L18340;
+        case 18341: goto L18341;
+        case 18342: goto L18342;
+        case 18343: goto L18343;
+        case 18344: goto L18344;
+        case 18345: goto L18345;
+        case 18382: goto L18382;
+        case 18386: goto L18386;
+        case 18387: goto L18387;
+        case 18391: goto L18391;
+        case 18395: goto L18395;
+        case 18412: goto L18412;
+        case 18416: goto L18416;
+        case 18421: goto L18421;
+        case 18426: goto L18426;
+        case 18432: goto L18432;
+        case 18435: goto L18435;
+        case 18439: goto L18439;
+        case 18459: goto L18459;
+        case 18463: goto L18463;
+        case 18468: goto L18468;
+        case 18472: goto L18472;
+        case 18477: goto L18477;
+        case 18481: goto L18481;
+        case 18486: goto L18486;
+        case 18489: goto L18489;
+        case 18493: goto L18493;
+        case 18513: goto L18513;
+        case 18517: goto L18517;
+        case 18522: goto L18522;
+        case 18526: goto L18526;
+        case 18530: goto L18530;
+        case 18535: goto L18535;
+        case 18540: goto L18540;
+        case 18543: goto L18543;
+        case 18547: goto L18547;
+        case 18566: goto L18566;
+        case 18570: goto L18570;
+        case 18575: goto L18575;
+        case 18579: goto L18579;
+        case 18584: goto L18584;
+        case 18587: goto L18587;
+        case 18591: goto L18591;
+        case 18595: goto L18595;
+        case 18600: goto L18600;
+        case 18615: goto L18615;
+        case 18619: goto L18619;
+        case 18624: goto L18624;
+        case 18627: goto L18627;
+        case 18631: goto L18631;
+        case 18635: goto L18635;
+        case 18639: goto L18639;
+        case 18640: goto L18640;
+        case 18641: goto L18641;
+        case 18645: goto L18645;
+        case 18649: goto L18649;
+        case 18668: goto L18668;
+        case 18672: goto L18672;
+        case 18676: goto L18676;
+        case 18680: goto L18680;
+        case 18684: goto L18684;
+        case 18688: goto L18688;
+        case 18692: goto L18692;
+        case 18696: goto L18696;
+        case 18700: goto L18700;
+        case 18715: goto L18715;
+        case 18719: goto L18719;
+        case 18723: goto L18723;
+        case 18727: goto L18727;
+        case 18731: goto L18731;
+        case 18735: goto L18735;
+        case 18740: goto L18740;
+        case 18752: goto L18752;
+        case 18756: goto L18756;
+        case 18761: goto L18761;
+        case 18765: goto L18765;
+        case 18770: goto L18770;
+        case 18792: goto L18792;
+        case 18796: goto L18796;
+        case 18801: goto L18801;
+        case 18804: goto L18804;
+        case 18808: goto L18808;
+        case 18812: goto L18812;
+        case 18816: goto L18816;
+        case 18820: goto L18820;
+        case 18824: goto L18824;
+        case 18827: goto L18827;
+        case 18831: goto L18831;
+        case 18832: goto L18832;
+        case 18833: goto L18833;
+        case 18839: goto L18839;
+        case 18842: goto L18842;
+        case 18845: goto L18845;
+        case 18848: goto L18848;
+        case 18849: goto L18849;
+        case 18850: goto L18850;
+        case 18851: goto L18851;
+        case 18852: goto L18852;
+        case 18853: goto L18853;
+        case 18985: goto L18985;
+        case 18988: goto L18988;
+        case 18989: goto L18989;
+        case 19000: goto L19000;
+        case 19003: goto L19003;
+        case 19007: goto L19007;
+        case 19010: goto L19010;
+        case 19013: goto L19013;
+        case 19018: goto L19018;
+        case 19019: goto L19019;
+        case 19022: goto L19022;
+        case 19023: goto L19023;
+        case 19024: goto L19024;
+        case 19025: goto L19025;
+        case 19321: goto L19321;
+        case 19325: goto L19325;
+        case 19326: goto L19326;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 1;
+L14: /* STRING */
+    tp_aot_op(tp, f, code + 14);
+L23: /* FILE */
+    f->fname = regs[0];
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L27: /* NAME */
+    f->name = regs[0];
+L28: /* GGET */
+    tp_aot_op(tp, f, code + 28);
+L33: /* STRING */
+    tp_aot_op(tp, f, code + 33);
+L42: /* NONE */
+    regs[3] = tp_None;
+L43: /* CALLP */
+    return code + 43;
+L44: /* STRING */
+    tp_aot_op(tp, f, code + 44);
+L49: /* GSET */
+    tp_set(tp, f->globals, regs[1], regs[0]);
+L50: /* LINE */
+    f->line = code + 50;
+    f->lineno = 2;
+L62: /* GGET */
+    tp_aot_op(tp, f, code + 62);
+L67: /* STRING */
+    tp_aot_op(tp, f, code + 67);
+L76: /* STRING */
+    tp_aot_op(tp, f, code + 76);
+L80: /* LIST */
+    tp_aot_op(tp, f, code + 80);
+L81: /* CALLP */
+    return code + 81;
+L82: /* GGET */
+    tp_aot_op(tp, f, code + 82);
+L87: /* UPDATE */
+    tp_aot_op(tp, f, code + 87);
+L88: /* LINE */
+    f->line = code + 88;
+    f->lineno = 3;
+L98: /* GGET */
+    tp_aot_op(tp, f, code + 98);
+L103: /* STRING */
+    tp_aot_op(tp, f, code + 103);
+L111: /* STRING */
+    tp_aot_op(tp, f, code + 111);
+L114: /* CALLP */
+    return code + 114;
+L115: /* GGET */
+    tp_aot_op(tp, f, code + 115);
+L120: /* UPDATE */
+    tp_aot_op(tp, f, code + 120);
+L121: /* LINE */
+    f->line = code + 121;
+    f->lineno = 4;
+L132: /* GGET */
+    tp_aot_op(tp, f, code + 132);
+L137: /* STRING */
+    tp_aot_op(tp, f, code + 137);
+L145: /* STRING */
+    tp_aot_op(tp, f, code + 145);
+L148: /* CALLP */
+    return code + 148;
+L149: /* GGET */
+    tp_aot_op(tp, f, code + 149);
+L154: /* UPDATE */
+    tp_aot_op(tp, f, code + 154);
+L155: /* LINE */
+    f->line = code + 155;
+    f->lineno = 5;
+L167: /* GGET */
+    tp_aot_op(tp, f, code + 167);
+L172: /* STRING */
+    tp_aot_op(tp, f, code + 172);
+L181: /* NONE */
+    regs[3] = tp_None;
+L182: /* CALLP */
+    return code + 182;
+L183: /* STRING */
+    tp_aot_op(tp, f, code + 183);
+L188: /* GSET */
+    tp_set(tp, f->globals, regs[1], regs[0]);
+L189: /* LINE */
+    f->line = code + 189;
+    f->lineno = 6;
+L201: /* GGET */
+    tp_aot_op(tp, f, code + 201);
+L206: /* STRING */
+    tp_aot_op(tp, f, code + 206);
+L215: /* NONE */
+    regs[3] = tp_None;
+L216: /* CALLP */
+    return code + 216;
+L217: /* STRING */
+    tp_aot_op(tp, f, code + 217);
+L222: /* GSET */
+    tp_set(tp, f->globals, regs[1], regs[0]);
+L223: /* LINE */
+    f->line = code + 223;
+    f->lineno = 8;
+L228: /* CLASS */
+    regs[0] = tp_class(tp);
+L229: /* VAR */
+L232: /* STRING */
+    tp_aot_op(tp, f, code + 232);
+L236: /* GSET */
+    tp_set(tp, f->globals, regs[1], regs[0]);
+L237: /* GGET */
+    tp_aot_op(tp, f, code + 237);
+L241: /* MOVE */
+    regs[3] = regs[0];
+L242: /* GGET */
+    tp_aot_op(tp, f, code + 242);
+L246: /* CALLP */
+    return code + 246;
+L247: /* VAR */
+L250: /* LIST */
+    tp_aot_op(tp, f, code + 250);
+L251: /* LIST */
+    tp_aot_op(tp, f, code + 251);
+L252: /* NONE */
+    regs[3] = tp_None;
+L253: /* NONE */
+    regs[4] = tp_None;
+L254: /* DEF */
+    tp_aot_op(tp, f, code + 254);
+L1480: /* NONE */
+    regs[2] = tp_None;
+L1481: /* NONE */
+    regs[3] = tp_None;
+L1482: /* CALL */
+    return code + 1482;
+L1483: /* LINE */
+    f->line = code + 1483;
+    f->lineno = 43;
+L1492: /* VAR */
+L1495: /* STRING */
+    tp_aot_op(tp, f, code + 1495);
+L1498: /* LIST */
+    tp_aot_op(tp, f, code + 1498);
+L1499: /* LIST */
+    tp_aot_op(tp, f, code + 1499);
+L1500: /* NONE */
+    regs[4] = tp_None;
+L1501: /* NONE */
+    regs[5] = tp_None;
+L1502: /* DEF */
+    tp_aot_op(tp, f, code + 1502);
+L1548: /* STRING */
+    tp_aot_op(tp, f, code + 1548);
+L1552: /* GSET */
+    tp_set(tp, f->globals, regs[2], regs[1]);
+L1553: /* LINE */
+    f->line = code + 1553;
+    f->lineno = 44;
+L1558: /* VAR */
+L1561: /* STRING */
+    tp_aot_op(tp, f, code + 1561);
+L1564: /* LIST */
+    tp_aot_op(tp, f, code + 1564);
+L1565: /* LIST */
+    tp_aot_op(tp, f, code + 1565);
+L1566: /* NONE */
+    regs[5] = tp_None;
+L1567: /* NONE */
+    regs[6] = tp_None;
+L1568: /* DEF */
+    tp_aot_op(tp, f, code + 1568);
+L1691: /* STRING */
+    tp_aot_op(tp, f, code + 1691);
+L1695: /* GSET */
+    tp_set(tp, f->globals, regs[3], regs[2]);
+L1696: /* LINE */
+    f->line = code + 1696;
+    f->lineno = 50;
+L1701: /* VAR */
+L1704: /* STRING */
+    tp_aot_op(tp, f, code + 1704);
+L1707: /* LIST */
+    tp_aot_op(tp, f, code + 1707);
+L1708: /* LIST */
+    tp_aot_op(tp, f, code + 1708);
+L1709: /* NONE */
+    regs[6] = tp_None;
+L1710: /* NONE */
+    regs[7] = tp_None;
+L1711: /* DEF */
+    tp_aot_op(tp, f, code + 1711);
+L1924: /* STRING */
+    tp_aot_op(tp, f, code + 1924);
+L1928: /* GSET */
+    tp_set(tp, f->globals, regs[4], regs[3]);
+L1929: /* LINE */
+    f->line = code + 1929;
+    f->lineno = 59;
+L1937: /* VAR */
+L1940: /* STRING */
+    tp_aot_op(tp, f, code + 1940);
+L1943: /* STRING */
+    tp_aot_op(tp, f, code + 1943);
+L1946: /* STRING */
+    tp_aot_op(tp, f, code + 1946);
+L1949: /* STRING */
+    tp_aot_op(tp, f, code + 1949);
+L1952: /* LIST */
+    tp_aot_op(tp, f, code + 1952);
+L1953: /* NUMBER */
+    tp_aot_op(tp, f, code + 1953);
+L1956: /* NUMBER */
+    tp_aot_op(tp, f, code + 1956);
+L1959: /* NUMBER */
+    tp_aot_op(tp, f, code + 1959);
+L1962: /* LIST */
+    tp_aot_op(tp, f, code + 1962);
+L1963: /* NONE */
+    regs[7] = tp_None;
+L1964: /* NONE */
+    regs[8] = tp_None;
+L1965: /* DEF */
+    tp_aot_op(tp, f, code + 1965);
+L2122: /* STRING */
+    tp_aot_op(tp, f, code + 2122);
+L2126: /* GSET */
+    tp_set(tp, f->globals, regs[5], regs[4]);
+L2127: /* LINE */
+    f->line = code + 2127;
+    f->lineno = 65;
+L2133: /* VAR */
+L2136: /* STRING */
+    tp_aot_op(tp, f, code + 2136);
+L2139: /* STRING */
+    tp_aot_op(tp, f, code + 2139);
+L2142: /* STRING */
+    tp_aot_op(tp, f, code + 2142);
+L2145: /* LIST */
+    tp_aot_op(tp, f, code + 2145);
+L2146: /* LIST */
+    tp_aot_op(tp, f, code + 2146);
+L2147: /* NONE */
+    regs[8] = tp_None;
+L2148: /* NONE */
+    regs[9] = tp_None;
+L2149: /* DEF */
+    tp_aot_op(tp, f, code + 2149);
+L2232: /* STRING */
+    tp_aot_op(tp, f, code + 2232);
+L2236: /* GSET */
+    tp_set(tp, f->globals, regs[6], regs[5]);
+L2237: /* LINE */
+    f->line = code + 2237;
+    f->lineno = 68;
+L2244: /* VAR */
+L2247: /* STRING */
+    tp_aot_op(tp, f, code + 2247);
+L2250: /* STRING */
+    tp_aot_op(tp, f, code + 2250);
+L2253: /* STRING */
+    tp_aot_op(tp, f, code + 2253);
+L2256: /* LIST */
+    tp_aot_op(tp, f, code + 2256);
+L2257: /* LIST */
+    tp_aot_op(tp, f, code + 2257);
+L2258: /* NONE */
+    regs[9] = tp_None;
+L2259: /* NONE */
+    regs[10] = tp_None;
+L2260: /* DEF */
+    tp_aot_op(tp, f, code + 2260);
+L2331: /* STRING */
+    tp_aot_op(tp, f, code + 2331);
+L2336: /* GSET */
+    tp_set(tp, f->globals, regs[7], regs[6]);
+L2337: /* LINE */
+    f->line = code + 2337;
+    f->lineno = 71;
+L2344: /* VAR */
+L2347: /* STRING */
+    tp_aot_op(tp, f, code + 2347);
+L2350: /* LIST */
+    tp_aot_op(tp, f, code + 2350);
+L2351: /* LIST */
+    tp_aot_op(tp, f, code + 2351);
+L2352: /* NONE */
+    regs[10] = tp_None;
+L2353: /* NONE */
+    regs[11] = tp_None;
+L2354: /* DEF */
+    tp_aot_op(tp, f, code + 2354);
+L2456: /* STRING */
+    tp_aot_op(tp, f, code + 2456);
+L2461: /* GSET */
+    tp_set(tp, f->globals, regs[8], regs[7]);
+L2462: /* LINE */
+    f->line = code + 2462;
+    f->lineno = 78;
+L2470: /* VAR */
+L2473: /* STRING */
+    tp_aot_op(tp, f, code + 2473);
+L2476: /* STRING */
+    tp_aot_op(tp, f, code + 2476);
+L2479: /* LIST */
+    tp_aot_op(tp, f, code + 2479);
+L2480: /* NONE */
+    regs[13] = tp_None;
+L2481: /* LIST */
+    tp_aot_op(tp, f, code + 2481);
+L2482: /* NONE */
+    regs[11] = tp_None;
+L2483: /* NONE */
+    regs[12] = tp_None;
+L2484: /* DEF */
+    tp_aot_op(tp, f, code + 2484);
+L2630: /* STRING */
+    tp_aot_op(tp, f, code + 2630);
+L2635: /* GSET */
+    tp_set(tp, f->globals, regs[9], regs[8]);
+L2636: /* LINE */
+    f->line = code + 2636;
+    f->lineno = 85;
+L2644: /* VAR */
+L2647: /* STRING */
+    tp_aot_op(tp, f, code + 2647);
+L2650: /* STRING */
+    tp_aot_op(tp, f, code + 2650);
+L2653: /* LIST */
+    tp_aot_op(tp, f, code + 2653);
+L2654: /* NONE */
+    regs[14] = tp_None;
+L2655: /* LIST */
+    tp_aot_op(tp, f, code + 2655);
+L2656: /* NONE */
+    regs[12] = tp_None;
+L2657: /* NONE */
+    regs[13] = tp_None;
+L2658: /* DEF */
+    tp_aot_op(tp, f, code + 2658);
+L2712: /* STRING */
+    tp_aot_op(tp, f, code + 2712);
+L2717: /* GSET */
+    tp_set(tp, f->globals, regs[10], regs[9]);
+L2718: /* LINE */
+    f->line = code + 2718;
+    f->lineno = 88;
+L2725: /* VAR */
+L2728: /* STRING */
+    tp_aot_op(tp, f, code + 2728);
+L2731: /* STRING */
+    tp_aot_op(tp, f, code + 2731);
+L2734: /* LIST */
+    tp_aot_op(tp, f, code + 2734);
+L2735: /* NONE */
+    regs[15] = tp_None;
+L2736: /* LIST */
+    tp_aot_op(tp, f, code + 2736);
+L2737: /* NONE */
+    regs[13] = tp_None;
+L2738: /* NONE */
+    regs[14] = tp_None;
+L2739: /* DEF */
+    tp_aot_op(tp, f, code + 2739);
+L2883: /* STRING */
+    tp_aot_op(tp, f, code + 2883);
+L2888: /* GSET */
+    tp_set(tp, f->globals, regs[11], regs[10]);
+L2889: /* LINE */
+    f->line = code + 2889;
+    f->lineno = 97;
+L2897: /* VAR */
+L2900: /* STRING */
+    tp_aot_op(tp, f, code + 2900);
+L2903: /* STRING */
+    tp_aot_op(tp, f, code + 2903);
+L2906: /* LIST */
+    tp_aot_op(tp, f, code + 2906);
+L2907: /* NONE */
+    regs[16] = tp_None;
+L2908: /* LIST */
+    tp_aot_op(tp, f, code + 2908);
+L2909: /* NONE */
+    regs[14] = tp_None;
+L2910: /* NONE */
+    regs[15] = tp_None;
+L2911: /* DEF */
+    tp_aot_op(tp, f, code + 2911);
+L3079: /* STRING */
+    tp_aot_op(tp, f, code + 3079);
+L3084: /* GSET */
+    tp_set(tp, f->globals, regs[12], regs[11]);
+L3085: /* LINE */
+    f->line = code + 3085;
+    f->lineno = 107;
+L3095: /* VAR */
+L3098: /* STRING */
+    tp_aot_op(tp, f, code + 3098);
+L3102: /* STRING */
+    tp_aot_op(tp, f, code + 3102);
+L3105: /* STRING */
+    tp_aot_op(tp, f, code + 3105);
+L3108: /* LIST */
+    tp_aot_op(tp, f, code + 3108);
+L3109: /* NONE */
+    regs[17] = tp_None;
+L3110: /* LIST */
+    tp_aot_op(tp, f, code + 3110);
+L3111: /* NONE */
+    regs[15] = tp_None;
+L3112: /* NONE */
+    regs[16] = tp_None;
+L3113: /* DEF */
+    tp_aot_op(tp, f, code + 3113);
+L3270: /* STRING */
+    tp_aot_op(tp, f, code + 3270);
+L3275: /* GSET */
+    tp_set(tp, f->globals, regs[13], regs[12]);
+L3276: /* LINE */
+    f->line = code + 3276;
+    f->lineno = 115;
+L3283: /* VAR */
+L3286: /* STRING */
+    tp_aot_op(tp, f, code + 3286);
+L3289: /* STRING */
+    tp_aot_op(tp, f, code + 3289);
+L3292: /* LIST */
+    tp_aot_op(tp, f, code + 3292);
+L3293: /* NONE */
+    regs[18] = tp_None;
+L3294: /* LIST */
+    tp_aot_op(tp, f, code + 3294);
+L3295: /* NONE */
+    regs[16] = tp_None;
+L3296: /* NONE */
+    regs[17] = tp_None;
+L3297: /* DEF */
+    tp_aot_op(tp, f, code + 3297);
+L3377: /* STRING */
+    tp_aot_op(tp, f, code + 3377);
+L3382: /* GSET */
+    tp_set(tp, f->globals, regs[14], regs[13]);
+L3383: /* LINE */
+    f->line = code + 3383;
+    f->lineno = 119;
+L3391: /* VAR */
+L3394: /* STRING */
+    tp_aot_op(tp, f, code + 3394);
+L3397: /* STRING */
+    tp_aot_op(tp, f, code + 3397);
+L3400: /* LIST */
+    tp_aot_op(tp, f, code + 3400);
+L3401: /* NONE */
+    regs[19] = tp_None;
+L3402: /* LIST */
+    tp_aot_op(tp, f, code + 3402);
+L3403: /* NONE */
+    regs[17] = tp_None;
+L3404: /* NONE */
+    regs[18] = tp_None;
+L3405: /* DEF */
+    tp_aot_op(tp, f, code + 3405);
+L3538: /* STRING */
+    tp_aot_op(tp, f, code + 3538);
+L3543: /* GSET */
+    tp_set(tp, f->globals, regs[15], regs[14]);
+L3544: /* LINE */
+    f->line = code + 3544;
+    f->lineno = 127;
+L3549: /* VAR */
+L3552: /* LIST */
+    tp_aot_op(tp, f, code + 3552);
+L3553: /* LIST */
+    tp_aot_op(tp, f, code + 3553);
+L3554: /* NONE */
+    regs[18] = tp_None;
+L3555: /* NONE */
+    regs[19] = tp_None;
+L3556: /* DEF */
+    tp_aot_op(tp, f, code + 3556);
+L3639: /* STRING */
+    tp_aot_op(tp, f, code + 3639);
+L3643: /* GSET */
+    tp_set(tp, f->globals, regs[16], regs[15]);
+L3644: /* LINE */
+    f->line = code + 3644;
+    f->lineno = 131;
+L3650: /* VAR */
+L3653: /* LIST */
+    tp_aot_op(tp, f, code + 3653);
+L3654: /* LIST */
+    tp_aot_op(tp, f, code + 3654);
+L3655: /* NONE */
+    regs[19] = tp_None;
+L3656: /* NONE */
+    regs[20] = tp_None;
+L3657: /* DEF */
+    tp_aot_op(tp, f, code + 3657);
+L3730: /* STRING */
+    tp_aot_op(tp, f, code + 3730);
+L3735: /* GSET */
+    tp_set(tp, f->globals, regs[17], regs[16]);
+L3736: /* LINE */
+    f->line = code + 3736;
+    f->lineno = 135;
+L3741: /* VAR */
+L3744: /* LIST */
+    tp_aot_op(tp, f, code + 3744);
+L3745: /* LIST */
+    tp_aot_op(tp, f, code + 3745);
+L3746: /* NONE */
+    regs[20] = tp_None;
+L3747: /* NONE */
+    regs[21] = tp_None;
+L3748: /* DEF */
+    tp_aot_op(tp, f, code + 3748);
+L3797: /* STRING */
+    tp_aot_op(tp, f, code + 3797);
+L3801: /* GSET */
+    tp_set(tp, f->globals, regs[18], regs[17]);
+L3802: /* LINE */
+    f->line = code + 3802;
+    f->lineno = 138;
+L3807: /* VAR */
+L3810: /* LIST */
+    tp_aot_op(tp, f, code + 3810);
+L3811: /* LIST */
+    tp_aot_op(tp, f, code + 3811);
+L3812: /* STRING */
+    tp_aot_op(tp, f, code + 3812);
+L3815: /* NONE */
+    regs[22] = tp_None;
+L3816: /* DEF */
+    tp_aot_op(tp, f, code + 3816);
+L3915: /* STRING */
+    tp_aot_op(tp, f, code + 3915);
+L3918: /* GSET */
+    tp_set(tp, f->globals, regs[19], regs[18]);
+L3919: /* LINE */
+    f->line = code + 3919;
+    f->lineno = 141;
+L3924: /* VAR */
+L3927: /* LIST */
+    tp_aot_op(tp, f, code + 3927);
+L3928: /* LIST */
+    tp_aot_op(tp, f, code + 3928);
+L3929: /* STRING */
+    tp_aot_op(tp, f, code + 3929);
+L3932: /* NONE */
+    regs[23] = tp_None;
+L3933: /* DEF */
+    tp_aot_op(tp, f, code + 3933);
+L4034: /* STRING */
+    tp_aot_op(tp, f, code + 4034);
+L4038: /* GSET */
+    tp_set(tp, f->globals, regs[20], regs[19]);
+L4039: /* LINE */
+    f->line = code + 4039;
+    f->lineno = 144;
+L4044: /* VAR */
+L4047: /* LIST */
+    tp_aot_op(tp, f, code + 4047);
+L4048: /* LIST */
+    tp_aot_op(tp, f, code + 4048);
+L4049: /* STRING */
+    tp_aot_op(tp, f, code + 4049);
+L4052: /* NONE */
+    regs[24] = tp_None;
+L4053: /* DEF */
+    tp_aot_op(tp, f, code + 4053);
+L4155: /* STRING */
+    tp_aot_op(tp, f, code + 4155);
+L4159: /* GSET */
+    tp_set(tp, f->globals, regs[21], regs[20]);
+L4160: /* LINE */
+    f->line = code + 4160;
+    f->lineno = 147;
+L4169: /* VAR */
+L4172: /* STRING */
+    tp_aot_op(tp, f, code + 4172);
+L4175: /* STRING */
+    tp_aot_op(tp, f, code + 4175);
+L4179: /* STRING */
+    tp_aot_op(tp, f, code + 4179);
+L4182: /* LIST */
+    tp_aot_op(tp, f, code + 4182);
+L4183: /* LIST */
+    tp_aot_op(tp, f, code + 4183);
+L4184: /* NONE */
+    regs[24] = tp_None;
+L4185: /* NONE */
+    regs[25] = tp_None;
+L4186: /* DEF */
+    tp_aot_op(tp, f, code + 4186);
+L4815: /* STRING */
+    tp_aot_op(tp, f, code + 4815);
+L4819: /* GSET */
+    tp_set(tp, f->globals, regs[22], regs[21]);
+L4820: /* LINE */
+    f->line = code + 4820;
+    f->lineno = 178;
+L4825: /* VAR */
+L4828: /* LIST */
+    tp_aot_op(tp, f, code + 4828);
+L4829: /* LIST */
+    tp_aot_op(tp, f, code + 4829);
+L4830: /* NONE */
+    regs[25] = tp_None;
+L4831: /* NONE */
+    regs[26] = tp_None;
+L4832: /* DEF */
+    tp_aot_op(tp, f, code + 4832);
+L5607: /* STRING */
+    tp_aot_op(tp, f, code + 5607);
+L5612: /* GSET */
+    tp_set(tp, f->globals, regs[23], regs[22]);
+L5613: /* LINE */
+    f->line = code + 5613;
+    f->lineno = 216;
+L5620: /* VAR */
+L5623: /* STRING */
+    tp_aot_op(tp, f, code + 5623);
+L5626: /* LIST */
+    tp_aot_op(tp, f, code + 5626);
+L5627: /* NONE */
+    regs[28] = tp_None;
+L5628: /* LIST */
+    tp_aot_op(tp, f, code + 5628);
+L5629: /* NONE */
+    regs[26] = tp_None;
+L5630: /* NONE */
+    regs[27] = tp_None;
+L5631: /* DEF */
+    tp_aot_op(tp, f, code + 5631);
+L5694: /* STRING */
+    tp_aot_op(tp, f, code + 5694);
+L5698: /* GSET */
+    tp_set(tp, f->globals, regs[24], regs[23]);
+L5699: /* LINE */
+    f->line = code + 5699;
+    f->lineno = 219;
+L5705: /* VAR */
+L5708: /* STRING */
+    tp_aot_op(tp, f, code + 5708);
+L5711: /* LIST */
+    tp_aot_op(tp, f, code + 5711);
+L5712: /* LIST */
+    tp_aot_op(tp, f, code + 5712);
+L5713: /* NONE */
+    regs[27] = tp_None;
+L5714: /* NONE */
+    regs[28] = tp_None;
+L5715: /* DEF */
+    tp_aot_op(tp, f, code + 5715);
+L5883: /* STRING */
+    tp_aot_op(tp, f, code + 5883);
+L5888: /* GSET */
+    tp_set(tp, f->globals, regs[25], regs[24]);
+L5889: /* LINE */
+    f->line = code + 5889;
+    f->lineno = 227;
+L5894: /* VAR */
+L5897: /* STRING */
+    tp_aot_op(tp, f, code + 5897);
+L5900: /* LIST */
+    tp_aot_op(tp, f, code + 5900);
+L5901: /* LIST */
+    tp_aot_op(tp, f, code + 5901);
+L5902: /* NONE */
+    regs[28] = tp_None;
+L5903: /* NONE */
+    regs[29] = tp_None;
+L5904: /* DEF */
+    tp_aot_op(tp, f, code + 5904);
+L6032: /* STRING */
+    tp_aot_op(tp, f, code + 6032);
+L6036: /* GSET */
+    tp_set(tp, f->globals, regs[26], regs[25]);
+L6037: /* LINE */
+    f->line = code + 6037;
+    f->lineno = 230;
+L6042: /* VAR */
+L6045: /* STRING */
+    tp_aot_op(tp, f, code + 6045);
+L6048: /* LIST */
+    tp_aot_op(tp, f, code + 6048);
+L6049: /* LIST */
+    tp_aot_op(tp, f, code + 6049);
+L6050: /* NONE */
+    regs[29] = tp_None;
+L6051: /* NONE */
+    regs[30] = tp_None;
+L6052: /* DEF */
+    tp_aot_op(tp, f, code + 6052);
+L6122: /* STRING */
+    tp_aot_op(tp, f, code + 6122);
+L6126: /* GSET */
+    tp_set(tp, f->globals, regs[27], regs[26]);
+L6127: /* LINE */
+    f->line = code + 6127;
+    f->lineno = 233;
+L6132: /* VAR */
+L6135: /* STRING */
+    tp_aot_op(tp, f, code + 6135);
+L6138: /* LIST */
+    tp_aot_op(tp, f, code + 6138);
+L6139: /* LIST */
+    tp_aot_op(tp, f, code + 6139);
+L6140: /* NONE */
+    regs[30] = tp_None;
+L6141: /* NONE */
+    regs[31] = tp_None;
+L6142: /* DEF */
+    tp_aot_op(tp, f, code + 6142);
+L6214: /* STRING */
+    tp_aot_op(tp, f, code + 6214);
+L6218: /* GSET */
+    tp_set(tp, f->globals, regs[28], regs[27]);
+L6219: /* LINE */
+    f->line = code + 6219;
+    f->lineno = 237;
+L6225: /* VAR */
+L6228: /* STRING */
+    tp_aot_op(tp, f, code + 6228);
+L6231: /* LIST */
+    tp_aot_op(tp, f, code + 6231);
+L6232: /* LIST */
+    tp_aot_op(tp, f, code + 6232);
+L6233: /* NONE */
+    regs[31] = tp_None;
+L6234: /* NONE */
+    regs[32] = tp_None;
+L6235: /* DEF */
+    tp_aot_op(tp, f, code + 6235);
+L6293: /* STRING */
+    tp_aot_op(tp, f, code + 6293);
+L6298: /* GSET */
+    tp_set(tp, f->globals, regs[29], regs[28]);
+L6299: /* LINE */
+    f->line = code + 6299;
+    f->lineno = 240;
+L6305: /* VAR */
+L6308: /* STRING */
+    tp_aot_op(tp, f, code + 6308);
+L6311: /* LIST */
+    tp_aot_op(tp, f, code + 6311);
+L6312: /* LIST */
+    tp_aot_op(tp, f, code + 6312);
+L6313: /* NONE */
+    regs[32] = tp_None;
+L6314: /* NONE */
+    regs[33] = tp_None;
+L6315: /* DEF */
+    tp_aot_op(tp, f, code + 6315);
+L6366: /* STRING */
+    tp_aot_op(tp, f, code + 6366);
+L6371: /* GSET */
+    tp_set(tp, f->globals, regs[30], regs[29]);
+L6372: /* LINE */
+    f->line = code + 6372;
+    f->lineno = 242;
+L6377: /* VAR */
+L6380: /* STRING */
+    tp_aot_op(tp, f, code + 6380);
+L6383: /* LIST */
+    tp_aot_op(tp, f, code + 6383);
+L6384: /* LIST */
+    tp_aot_op(tp, f, code + 6384);
+L6385: /* NONE */
+    regs[33] = tp_None;
+L6386: /* NONE */
+    regs[34] = tp_None;
+L6387: /* DEF */
+    tp_aot_op(tp, f, code + 6387);
+L6469: /* STRING */
+    tp_aot_op(tp, f, code + 6469);
+L6473: /* GSET */
+    tp_set(tp, f->globals, regs[31], regs[30]);
+L6474: /* LINE */
+    f->line = code + 6474;
+    f->lineno = 246;
+L6480: /* VAR */
+L6483: /* STRING */
+    tp_aot_op(tp, f, code + 6483);
+L6486: /* STRING */
+    tp_aot_op(tp, f, code + 6486);
+L6489: /* LIST */
+    tp_aot_op(tp, f, code + 6489);
+L6490: /* LIST */
+    tp_aot_op(tp, f, code + 6490);
+L6491: /* NONE */
+    regs[34] = tp_None;
+L6492: /* NONE */
+    regs[35] = tp_None;
+L6493: /* DEF */
+    tp_aot_op(tp, f, code + 6493);
+L6678: /* STRING */
+    tp_aot_op(tp, f, code + 6678);
+L6682: /* GSET */
+    tp_set(tp, f->globals, regs[32], regs[31]);
+L6683: /* LINE */
+    f->line = code + 6683;
+    f->lineno = 255;
+L6689: /* VAR */
+L6692: /* STRING */
+    tp_aot_op(tp, f, code + 6692);
+L6695: /* LIST */
+    tp_aot_op(tp, f, code + 6695);
+L6696: /* LIST */
+    tp_aot_op(tp, f, code + 6696);
+L6697: /* NONE */
+    regs[35] = tp_None;
+L6698: /* NONE */
+    regs[36] = tp_None;
+L6699: /* DEF */
+    tp_aot_op(tp, f, code + 6699);
+L6807: /* STRING */
+    tp_aot_op(tp, f, code + 6807);
+L6812: /* GSET */
+    tp_set(tp, f->globals, regs[33], regs[32]);
+L6813: /* LINE */
+    f->line = code + 6813;
+    f->lineno = 259;
+L6820: /* VAR */
+L6823: /* STRING */
+    tp_aot_op(tp, f, code + 6823);
+L6827: /* STRING */
+    tp_aot_op(tp, f, code + 6827);
+L6830: /* LIST */
+    tp_aot_op(tp, f, code + 6830);
+L6831: /* LIST */
+    tp_aot_op(tp, f, code + 6831);
+L6832: /* NONE */
+    regs[36] = tp_None;
+L6833: /* NONE */
+    regs[37] = tp_None;
+L6834: /* DEF */
+    tp_aot_op(tp, f, code + 6834);
+L6955: /* STRING */
+    tp_aot_op(tp, f, code + 6955);
+L6959: /* GSET */
+    tp_set(tp, f->globals, regs[34], regs[33]);
+L6960: /* LINE */
+    f->line = code + 6960;
+    f->lineno = 265;
+L6967: /* VAR */
+L6970: /* STRING */
+    tp_aot_op(tp, f, code + 6970);
+L6973: /* STRING */
+    tp_aot_op(tp, f, code + 6973);
+L6976: /* STRING */
+    tp_aot_op(tp, f, code + 6976);
+L6979: /* LIST */
+    tp_aot_op(tp, f, code + 6979);
+L6980: /* NONE */
+    regs[39] = tp_None;
+L6981: /* LIST */
+    tp_aot_op(tp, f, code + 6981);
+L6982: /* NONE */
+    regs[37] = tp_None;
+L6983: /* NONE */
+    regs[38] = tp_None;
+L6984: /* DEF */
+    tp_aot_op(tp, f, code + 6984);
+L7077: /* STRING */
+    tp_aot_op(tp, f, code + 7077);
+L7081: /* GSET */
+    tp_set(tp, f->globals, regs[35], regs[34]);
+L7082: /* LINE */
+    f->line = code + 7082;
+    f->lineno = 272;
+L7090: /* VAR */
+L7093: /* STRING */
+    tp_aot_op(tp, f, code + 7093);
+L7096: /* STRING */
+    tp_aot_op(tp, f, code + 7096);
+L7099: /* STRING */
+    tp_aot_op(tp, f, code + 7099);
+L7102: /* STRING */
+    tp_aot_op(tp, f, code + 7102);
+L7105: /* LIST */
+    tp_aot_op(tp, f, code + 7105);
+L7106: /* NONE */
+    regs[40] = tp_None;
+L7107: /* LIST */
+    tp_aot_op(tp, f, code + 7107);
+L7108: /* NONE */
+    regs[38] = tp_None;
+L7109: /* NONE */
+    regs[39] = tp_None;
+L7110: /* DEF */
+    tp_aot_op(tp, f, code + 7110);
+L7233: /* STRING */
+    tp_aot_op(tp, f, code + 7233);
+L7237: /* GSET */
+    tp_set(tp, f->globals, regs[36], regs[35]);
+L7238: /* LINE */
+    f->line = code + 7238;
+    f->lineno = 281;
+L7248: /* VAR */
+L7251: /* STRING */
+    tp_aot_op(tp, f, code + 7251);
+L7254: /* STRING */
+    tp_aot_op(tp, f, code + 7254);
+L7257: /* STRING */
+    tp_aot_op(tp, f, code + 7257);
+L7260: /* STRING */
+    tp_aot_op(tp, f, code + 7260);
+L7263: /* LIST */
+    tp_aot_op(tp, f, code + 7263);
+L7264: /* NONE */
+    regs[41] = tp_None;
+L7265: /* LIST */
+    tp_aot_op(tp, f, code + 7265);
+L7266: /* NONE */
+    regs[39] = tp_None;
+L7267: /* NONE */
+    regs[40] = tp_None;
+L7268: /* DEF */
+    tp_aot_op(tp, f, code + 7268);
+L7368: /* STRING */
+    tp_aot_op(tp, f, code + 7368);
+L7374: /* GSET */
+    tp_set(tp, f->globals, regs[37], regs[36]);
+L7375: /* LINE */
+    f->line = code + 7375;
+    f->lineno = 288;
+L7386: /* VAR */
+L7389: /* STRING */
+    tp_aot_op(tp, f, code + 7389);
+L7392: /* STRING */
+    tp_aot_op(tp, f, code + 7392);
+L7395: /* STRING */
+    tp_aot_op(tp, f, code + 7395);
+L7398: /* STRING */
+    tp_aot_op(tp, f, code + 7398);
+L7401: /* LIST */
+    tp_aot_op(tp, f, code + 7401);
+L7402: /* NONE */
+    regs[42] = tp_None;
+L7403: /* LIST */
+    tp_aot_op(tp, f, code + 7403);
+L7404: /* NONE */
+    regs[40] = tp_None;
+L7405: /* NONE */
+    regs[41] = tp_None;
+L7406: /* DEF */
+    tp_aot_op(tp, f, code + 7406);
+L7615: /* STRING */
+    tp_aot_op(tp, f, code + 7615);
+L7620: /* GSET */
+    tp_set(tp, f->globals, regs[38], regs[37]);
+L7621: /* LINE */
+    f->line = code + 7621;
+    f->lineno = 301;
+L7628: /* VAR */
+L7631: /* STRING */
+    tp_aot_op(tp, f, code + 7631);
+L7634: /* LIST */
+    tp_aot_op(tp, f, code + 7634);
+L7635: /* NONE */
+    regs[43] = tp_None;
+L7636: /* LIST */
+    tp_aot_op(tp, f, code + 7636);
+L7637: /* NONE */
+    regs[41] = tp_None;
+L7638: /* NONE */
+    regs[42] = tp_None;
+L7639: /* DEF */
+    tp_aot_op(tp, f, code + 7639);
+L7702: /* STRING */
+    tp_aot_op(tp, f, code + 7702);
+L7707: /* GSET */
+    tp_set(tp, f->globals, regs[39], regs[38]);
+L7708: /* LINE */
+    f->line = code + 7708;
+    f->lineno = 306;
+L7717: /* VAR */
+L7720: /* STRING */
+    tp_aot_op(tp, f, code + 7720);
+L7723: /* STRING */
+    tp_aot_op(tp, f, code + 7723);
+L7727: /* STRING */
+    tp_aot_op(tp, f, code + 7727);
+L7730: /* LIST */
+    tp_aot_op(tp, f, code + 7730);
+L7731: /* NONE */
+    regs[44] = tp_None;
+L7732: /* LIST */
+    tp_aot_op(tp, f, code + 7732);
+L7733: /* NONE */
+    regs[42] = tp_None;
+L7734: /* NONE */
+    regs[43] = tp_None;
+L7735: /* DEF */
+    tp_aot_op(tp, f, code + 7735);
+L8042: /* STRING */
+    tp_aot_op(tp, f, code + 8042);
+L8046: /* GSET */
+    tp_set(tp, f->globals, regs[40], regs[39]);
+L8047: /* LINE */
+    f->line = code + 8047;
+    f->lineno = 327;
+L8055: /* VAR */
+L8058: /* STRING */
+    tp_aot_op(tp, f, code + 8058);
+L8061: /* STRING */
+    tp_aot_op(tp, f, code + 8061);
+L8064: /* LIST */
+    tp_aot_op(tp, f, code + 8064);
+L8065: /* NONE */
+    regs[45] = tp_None;
+L8066: /* LIST */
+    tp_aot_op(tp, f, code + 8066);
+L8067: /* NONE */
+    regs[43] = tp_None;
+L8068: /* NONE */
+    regs[44] = tp_None;
+L8069: /* DEF */
+    tp_aot_op(tp, f, code + 8069);
+L8708: /* STRING */
+    tp_aot_op(tp, f, code + 8708);
+L8713: /* GSET */
+    tp_set(tp, f->globals, regs[41], regs[40]);
+L8714: /* LINE */
+    f->line = code + 8714;
+    f->lineno = 357;
+L8721: /* VAR */
+L8724: /* STRING */
+    tp_aot_op(tp, f, code + 8724);
+L8727: /* STRING */
+    tp_aot_op(tp, f, code + 8727);
+L8730: /* LIST */
+    tp_aot_op(tp, f, code + 8730);
+L8731: /* LIST */
+    tp_aot_op(tp, f, code + 8731);
+L8732: /* NONE */
+    regs[44] = tp_None;
+L8733: /* NONE */
+    regs[45] = tp_None;
+L8734: /* DEF */
+    tp_aot_op(tp, f, code + 8734);
+L9637: /* STRING */
+    tp_aot_op(tp, f, code + 9637);
+L9642: /* GSET */
+    tp_set(tp, f->globals, regs[42], regs[41]);
+L9643: /* LINE */
+    f->line = code + 9643;
+    f->lineno = 405;
+L9653: /* VAR */
+L9656: /* STRING */
+    tp_aot_op(tp, f, code + 9656);
+L9659: /* STRING */
+    tp_aot_op(tp, f, code + 9659);
+L9662: /* STRING */
+    tp_aot_op(tp, f, code + 9662);
+L9666: /* STRING */
+    tp_aot_op(tp, f, code + 9666);
+L9669: /* LIST */
+    tp_aot_op(tp, f, code + 9669);
+L9670: /* NUMBER */
+    tp_aot_op(tp, f, code + 9670);
+L9673: /* LIST */
+    tp_aot_op(tp, f, code + 9673);
+L9674: /* NONE */
+    regs[45] = tp_None;
+L9675: /* NONE */
+    regs[46] = tp_None;
+L9676: /* DEF */
+    tp_aot_op(tp, f, code + 9676);
+L9949: /* STRING */
+    tp_aot_op(tp, f, code + 9949);
+L9954: /* GSET */
+    tp_set(tp, f->globals, regs[43], regs[42]);
+L9955: /* LINE */
+    f->line = code + 9955;
+    f->lineno = 422;
+L9962: /* VAR */
+L9965: /* STRING */
+    tp_aot_op(tp, f, code + 9965);
+L9969: /* LIST */
+    tp_aot_op(tp, f, code + 9969);
+L9970: /* LIST */
+    tp_aot_op(tp, f, code + 9970);
+L9971: /* NONE */
+    regs[46] = tp_None;
+L9972: /* NONE */
+    regs[47] = tp_None;
+L9973: /* DEF */
+    tp_aot_op(tp, f, code + 9973);
+L10236: /* STRING */
+    tp_aot_op(tp, f, code + 10236);
+L10241: /* GSET */
+    tp_set(tp, f->globals, regs[44], regs[43]);
+L10242: /* LINE */
+    f->line = code + 10242;
+    f->lineno = 439;
+L10248: /* VAR */
+L10251: /* STRING */
+    tp_aot_op(tp, f, code + 10251);
+L10254: /* LIST */
+    tp_aot_op(tp, f, code + 10254);
+L10255: /* LIST */
+    tp_aot_op(tp, f, code + 10255);
+L10256: /* NONE */
+    regs[47] = tp_None;
+L10257: /* NONE */
+    regs[48] = tp_None;
+L10258: /* DEF */
+    tp_aot_op(tp, f, code + 10258);
+L10531: /* STRING */
+    tp_aot_op(tp, f, code + 10531);
+L10536: /* GSET */
+    tp_set(tp, f->globals, regs[45], regs[44]);
+L10537: /* LINE */
+    f->line = code + 10537;
+    f->lineno = 455;
+L10542: /* VAR */
+L10545: /* STRING */
+    tp_aot_op(tp, f, code + 10545);
+L10548: /* LIST */
+    tp_aot_op(tp, f, code + 10548);
+L10549: /* LIST */
+    tp_aot_op(tp, f, code + 10549);
+L10550: /* NONE */
+    regs[48] = tp_None;
+L10551: /* NONE */
+    regs[49] = tp_None;
+L10552: /* DEF */
+    tp_aot_op(tp, f, code + 10552);
+L11101: /* STRING */
+    tp_aot_op(tp, f, code + 11101);
+L11105: /* GSET */
+    tp_set(tp, f->globals, regs[46], regs[45]);
+L11106: /* LINE */
+    f->line = code + 11106;
+    f->lineno = 483;
+L11112: /* VAR */
+L11115: /* STRING */
+    tp_aot_op(tp, f, code + 11115);
+L11118: /* LIST */
+    tp_aot_op(tp, f, code + 11118);
+L11119: /* LIST */
+    tp_aot_op(tp, f, code + 11119);
+L11120: /* NONE */
+    regs[49] = tp_None;
+L11121: /* NONE */
+    regs[50] = tp_None;
+L11122: /* DEF */
+    tp_aot_op(tp, f, code + 11122);
+L11228: /* STRING */
+    tp_aot_op(tp, f, code + 11228);
+L11233: /* GSET */
+    tp_set(tp, f->globals, regs[47], regs[46]);
+L11234: /* LINE */
+    f->line = code + 11234;
+    f->lineno = 487;
+L11239: /* VAR */
+L11242: /* STRING */
+    tp_aot_op(tp, f, code + 11242);
+L11245: /* LIST */
+    tp_aot_op(tp, f, code + 11245);
+L11246: /* LIST */
+    tp_aot_op(tp, f, code + 11246);
+L11247: /* NONE */
+    regs[50] = tp_None;
+L11248: /* NONE */
+    regs[51] = tp_None;
+L11249: /* DEF */
+    tp_aot_op(tp, f, code + 11249);
+L11386: /* STRING */
+    tp_aot_op(tp, f, code + 11386);
+L11390: /* GSET */
+    tp_set(tp, f->globals, regs[48], regs[47]);
+L11391: /* LINE */
+    f->line = code + 11391;
+    f->lineno = 494;
+L11400: /* VAR */
+L11403: /* STRING */
+    tp_aot_op(tp, f, code + 11403);
+L11406: /* STRING */
+    tp_aot_op(tp, f, code + 11406);
+L11409: /* STRING */
+    tp_aot_op(tp, f, code + 11409);
+L11412: /* LIST */
+    tp_aot_op(tp, f, code + 11412);
+L11413: /* LIST */
+    tp_aot_op(tp, f, code + 11413);
+L11414: /* NONE */
+    regs[51] = tp_None;
+L11415: /* NONE */
+    regs[52] = tp_None;
+L11416: /* DEF */
+    tp_aot_op(tp, f, code + 11416);
+L11742: /* STRING */
+    tp_aot_op(tp, f, code + 11742);
+L11748: /* GSET */
+    tp_set(tp, f->globals, regs[49], regs[48]);
+L11749: /* LINE */
+    f->line = code + 11749;
+    f->lineno = 514;
+L11756: /* VAR */
+L11759: /* STRING */
+    tp_aot_op(tp, f, code + 11759);
+L11762: /* STRING */
+    tp_aot_op(tp, f, code + 11762);
+L11765: /* LIST */
+    tp_aot_op(tp, f, code + 11765);
+L11766: /* NONE */
+    regs[54] = tp_None;
+L11767: /* LIST */
+    tp_aot_op(tp, f, code + 11767);
+L11768: /* NONE */
+    regs[52] = tp_None;
+L11769: /* NONE */
+    regs[53] = tp_None;
+L11770: /* DEF */
+    tp_aot_op(tp, f, code + 11770);
+L12533: /* STRING */
+    tp_aot_op(tp, f, code + 12533);
+L12537: /* GSET */
+    tp_set(tp, f->globals, regs[50], regs[49]);
+L12538: /* LINE */
+    f->line = code + 12538;
+    f->lineno = 560;
+L12545: /* VAR */
+L12548: /* STRING */
+    tp_aot_op(tp, f, code + 12548);
+L12551: /* STRING */
+    tp_aot_op(tp, f, code + 12551);
+L12554: /* LIST */
+    tp_aot_op(tp, f, code + 12554);
+L12555: /* NONE */
+    regs[55] = tp_None;
+L12556: /* LIST */
+    tp_aot_op(tp, f, code + 12556);
+L12557: /* NONE */
+    regs[53] = tp_None;
+L12558: /* NONE */
+    regs[54] = tp_None;
+L12559: /* DEF */
+    tp_aot_op(tp, f, code + 12559);
+L12723: /* STRING */
+    tp_aot_op(tp, f, code + 12723);
+L12727: /* GSET */
+    tp_set(tp, f->globals, regs[51], regs[50]);
+L12728: /* LINE */
+    f->line = code + 12728;
+    f->lineno = 567;
+L12735: /* VAR */
+L12738: /* STRING */
+    tp_aot_op(tp, f, code + 12738);
+L12741: /* STRING */
+    tp_aot_op(tp, f, code + 12741);
+L12744: /* LIST */
+    tp_aot_op(tp, f, code + 12744);
+L12745: /* NONE */
+    regs[56] = tp_None;
+L12746: /* LIST */
+    tp_aot_op(tp, f, code + 12746);
+L12747: /* NONE */
+    regs[54] = tp_None;
+L12748: /* NONE */
+    regs[55] = tp_None;
+L12749: /* DEF */
+    tp_aot_op(tp, f, code + 12749);
+L12945: /* STRING */
+    tp_aot_op(tp, f, code + 12945);
+L12950: /* GSET */
+    tp_set(tp, f->globals, regs[52], regs[51]);
+L12951: /* LINE */
+    f->line = code + 12951;
+    f->lineno = 575;
+L12957: /* VAR */
+L12960: /* STRING */
+    tp_aot_op(tp, f, code + 12960);
+L12963: /* LIST */
+    tp_aot_op(tp, f, code + 12963);
+L12964: /* LIST */
+    tp_aot_op(tp, f, code + 12964);
+L12965: /* NONE */
+    regs[55] = tp_None;
+L12966: /* NONE */
+    regs[56] = tp_None;
+L12967: /* DEF */
+    tp_aot_op(tp, f, code + 12967);
+L13605: /* STRING */
+    tp_aot_op(tp, f, code + 13605);
+L13609: /* GSET */
+    tp_set(tp, f->globals, regs[53], regs[52]);
+L13610: /* LINE */
+    f->line = code + 13610;
+    f->lineno = 617;
+L13616: /* VAR */
+L13619: /* STRING */
+    tp_aot_op(tp, f, code + 13619);
+L13622: /* LIST */
+    tp_aot_op(tp, f, code + 13622);
+L13623: /* LIST */
+    tp_aot_op(tp, f, code + 13623);
+L13624: /* NONE */
+    regs[56] = tp_None;
+L13625: /* NONE */
+    regs[57] = tp_None;
+L13626: /* DEF */
+    tp_aot_op(tp, f, code + 13626);
+L14461: /* STRING */
+    tp_aot_op(tp, f, code + 14461);
+L14466: /* GSET */
+    tp_set(tp, f->globals, regs[54], regs[53]);
+L14467: /* LINE */
+    f->line = code + 14467;
+    f->lineno = 672;
+L14473: /* VAR */
+L14476: /* STRING */
+    tp_aot_op(tp, f, code + 14476);
+L14479: /* LIST */
+    tp_aot_op(tp, f, code + 14479);
+L14480: /* LIST */
+    tp_aot_op(tp, f, code + 14480);
+L14481: /* NONE */
+    regs[57] = tp_None;
+L14482: /* NONE */
+    regs[58] = tp_None;
+L14483: /* DEF */
+    tp_aot_op(tp, f, code + 14483);
+L14707: /* STRING */
+    tp_aot_op(tp, f, code + 14707);
+L14712: /* GSET */
+    tp_set(tp, f->globals, regs[55], regs[54]);
+L14713: /* LINE */
+    f->line = code + 14713;
+    f->lineno = 687;
+L14720: /* VAR */
+L14723: /* STRING */
+    tp_aot_op(tp, f, code + 14723);
+L14726: /* LIST */
+    tp_aot_op(tp, f, code + 14726);
+L14727: /* LIST */
+    tp_aot_op(tp, f, code + 14727);
+L14728: /* NONE */
+    regs[58] = tp_None;
+L14729: /* NONE */
+    regs[59] = tp_None;
+L14730: /* DEF */
+    tp_aot_op(tp, f, code + 14730);
+L14978: /* STRING */
+    tp_aot_op(tp, f, code + 14978);
+L14984: /* GSET */
+    tp_set(tp, f->globals, regs[56], regs[55]);
+L14985: /* LINE */
+    f->line = code + 14985;
+    f->lineno = 694;
+L14992: /* VAR */
+L14995: /* STRING */
+    tp_aot_op(tp, f, code + 14995);
+L14998: /* LIST */
+    tp_aot_op(tp, f, code + 14998);
+L14999: /* LIST */
+    tp_aot_op(tp, f, code + 14999);
+L15000: /* NONE */
+    regs[59] = tp_None;
+L15001: /* NONE */
+    regs[60] = tp_None;
+L15002: /* DEF */
+    tp_aot_op(tp, f, code + 15002);
+L15323: /* STRING */
+    tp_aot_op(tp, f, code + 15323);
+L15329: /* GSET */
+    tp_set(tp, f->globals, regs[57], regs[56]);
+L15330: /* LINE */
+    f->line = code + 15330;
+    f->lineno = 711;
+L15336: /* VAR */
+L15339: /* STRING */
+    tp_aot_op(tp, f, code + 15339);
+L15342: /* LIST */
+    tp_aot_op(tp, f, code + 15342);
+L15343: /* LIST */
+    tp_aot_op(tp, f, code + 15343);
+L15344: /* NONE */
+    regs[60] = tp_None;
+L15345: /* NONE */
+    regs[61] = tp_None;
+L15346: /* DEF */
+    tp_aot_op(tp, f, code + 15346);
+L15698: /* STRING */
+    tp_aot_op(tp, f, code + 15698);
+L15702: /* GSET */
+    tp_set(tp, f->globals, regs[58], regs[57]);
+L15703: /* LINE */
+    f->line = code + 15703;
+    f->lineno = 730;
+L15710: /* VAR */
+L15713: /* STRING */
+    tp_aot_op(tp, f, code + 15713);
+L15716: /* STRING */
+    tp_aot_op(tp, f, code + 15716);
+L15719: /* LIST */
+    tp_aot_op(tp, f, code + 15719);
+L15720: /* NONE */
+    regs[63] = tp_None;
+L15721: /* LIST */
+    tp_aot_op(tp, f, code + 15721);
+L15722: /* NONE */
+    regs[61] = tp_None;
+L15723: /* NONE */
+    regs[62] = tp_None;
+L15724: /* DEF */
+    tp_aot_op(tp, f, code + 15724);
+L16020: /* STRING */
+    tp_aot_op(tp, f, code + 16020);
+L16024: /* GSET */
+    tp_set(tp, f->globals, regs[59], regs[58]);
+L16025: /* LINE */
+    f->line = code + 16025;
+    f->lineno = 741;
+L16030: /* VAR */
+L16033: /* STRING */
+    tp_aot_op(tp, f, code + 16033);
+L16036: /* LIST */
+    tp_aot_op(tp, f, code + 16036);
+L16037: /* LIST */
+    tp_aot_op(tp, f, code + 16037);
+L16038: /* NONE */
+    regs[62] = tp_None;
+L16039: /* NONE */
+    regs[63] = tp_None;
+L16040: /* DEF */
+    tp_aot_op(tp, f, code + 16040);
+L16363: /* STRING */
+    tp_aot_op(tp, f, code + 16363);
+L16367: /* GSET */
+    tp_set(tp, f->globals, regs[60], regs[59]);
+L16368: /* LINE */
+    f->line = code + 16368;
+    f->lineno = 760;
+L16373: /* VAR */
+L16376: /* STRING */
+    tp_aot_op(tp, f, code + 16376);
+L16379: /* LIST */
+    tp_aot_op(tp, f, code + 16379);
+L16380: /* LIST */
+    tp_aot_op(tp, f, code + 16380);
+L16381: /* NONE */
+    regs[63] = tp_None;
+L16382: /* NONE */
+    regs[64] = tp_None;
+L16383: /* DEF */
+    tp_aot_op(tp, f, code + 16383);
+L16573: /* STRING */
+    tp_aot_op(tp, f, code + 16573);
+L16577: /* GSET */
+    tp_set(tp, f->globals, regs[61], regs[60]);
+L16578: /* LINE */
+    f->line = code + 16578;
+    f->lineno = 771;
+L16584: /* VAR */
+L16587: /* STRING */
+    tp_aot_op(tp, f, code + 16587);
+L16590: /* LIST */
+    tp_aot_op(tp, f, code + 16590);
+L16591: /* LIST */
+    tp_aot_op(tp, f, code + 16591);
+L16592: /* NONE */
+    regs[64] = tp_None;
+L16593: /* NONE */
+    regs[65] = tp_None;
+L16594: /* DEF */
+    tp_aot_op(tp, f, code + 16594);
+L16705: /* STRING */
+    tp_aot_op(tp, f, code + 16705);
+L16710: /* GSET */
+    tp_set(tp, f->globals, regs[62], regs[61]);
+L16711: /* LINE */
+    f->line = code + 16711;
+    f->lineno = 778;
+L16717: /* VAR */
+L16720: /* STRING */
+    tp_aot_op(tp, f, code + 16720);
+L16723: /* LIST */
+    tp_aot_op(tp, f, code + 16723);
+L16724: /* LIST */
+    tp_aot_op(tp, f, code + 16724);
+L16725: /* NONE */
+    regs[65] = tp_None;
+L16726: /* NONE */
+    regs[66] = tp_None;
+L16727: /* DEF */
+    tp_aot_op(tp, f, code + 16727);
+L17068: /* STRING */
+    tp_aot_op(tp, f, code + 17068);
+L17073: /* GSET */
+    tp_set(tp, f->globals, regs[63], regs[62]);
+L17074: /* LINE */
+    f->line = code + 17074;
+    f->lineno = 798;
+L17080: /* VAR */
+L17083: /* STRING */
+    tp_aot_op(tp, f, code + 17083);
+L17086: /* LIST */
+    tp_aot_op(tp, f, code + 17086);
+L17087: /* LIST */
+    tp_aot_op(tp, f, code + 17087);
+L17088: /* NONE */
+    regs[66] = tp_None;
+L17089: /* NONE */
+    regs[67] = tp_None;
+L17090: /* DEF */
+    tp_aot_op(tp, f, code + 17090);
+L17201: /* STRING */
+    tp_aot_op(tp, f, code + 17201);
+L17206: /* GSET */
+    tp_set(tp, f->globals, regs[64], regs[63]);
+L17207: /* LINE */
+    f->line = code + 17207;
+    f->lineno = 805;
+L17214: /* VAR */
+L17217: /* STRING */
+    tp_aot_op(tp, f, code + 17217);
+L17220: /* LIST */
+    tp_aot_op(tp, f, code + 17220);
+L17221: /* LIST */
+    tp_aot_op(tp, f, code + 17221);
+L17222: /* NONE */
+    regs[67] = tp_None;
+L17223: /* NONE */
+    regs[68] = tp_None;
+L17224: /* DEF */
+    tp_aot_op(tp, f, code + 17224);
+L17290: /* STRING */
+    tp_aot_op(tp, f, code + 17290);
+L17296: /* GSET */
+    tp_set(tp, f->globals, regs[65], regs[64]);
+L17297: /* LINE */
+    f->line = code + 17297;
+    f->lineno = 808;
+L17304: /* VAR */
+L17307: /* STRING */
+    tp_aot_op(tp, f, code + 17307);
+L17310: /* STRING */
+    tp_aot_op(tp, f, code + 17310);
+L17313: /* LIST */
+    tp_aot_op(tp, f, code + 17313);
+L17314: /* NONE */
+    regs[70] = tp_None;
+L17315: /* LIST */
+    tp_aot_op(tp, f, code + 17315);
+L17316: /* NONE */
+    regs[68] = tp_None;
+L17317: /* NONE */
+    regs[69] = tp_None;
+L17318: /* DEF */
+    tp_aot_op(tp, f, code + 17318);
+L17392: /* STRING */
+    tp_aot_op(tp, f, code + 17392);
+L17396: /* GSET */
+    tp_set(tp, f->globals, regs[66], regs[65]);
+L17397: /* LINE */
+    f->line = code + 17397;
+    f->lineno = 813;
+L17404: /* VAR */
+L17407: /* STRING */
+    tp_aot_op(tp, f, code + 17407);
+L17410: /* STRING */
+    tp_aot_op(tp, f, code + 17410);
+L17413: /* LIST */
+    tp_aot_op(tp, f, code + 17413);
+L17414: /* NONE */
+    regs[71] = tp_None;
+L17415: /* LIST */
+    tp_aot_op(tp, f, code + 17415);
+L17416: /* NONE */
+    regs[69] = tp_None;
+L17417: /* NONE */
+    regs[70] = tp_None;
+L17418: /* DEF */
+    tp_aot_op(tp, f, code + 17418);
+L17492: /* STRING */
+    tp_aot_op(tp, f, code + 17492);
+L17496: /* GSET */
+    tp_set(tp, f->globals, regs[67], regs[66]);
+L17497: /* LINE */
+    f->line = code + 17497;
+    f->lineno = 818;
+L17504: /* VAR */
+L17507: /* STRING */
+    tp_aot_op(tp, f, code + 17507);
+L17510: /* STRING */
+    tp_aot_op(tp, f, code + 17510);
+L17513: /* LIST */
+    tp_aot_op(tp, f, code + 17513);
+L17514: /* NONE */
+    regs[72] = tp_None;
+L17515: /* LIST */
+    tp_aot_op(tp, f, code + 17515);
+L17516: /* NONE */
+    regs[70] = tp_None;
+L17517: /* NONE */
+    regs[71] = tp_None;
+L17518: /* DEF */
+    tp_aot_op(tp, f, code + 17518);
+L17593: /* STRING */
+    tp_aot_op(tp, f, code + 17593);
+L17597: /* GSET */
+    tp_set(tp, f->globals, regs[68], regs[67]);
+L17598: /* LINE */
+    f->line = code + 17598;
+    f->lineno = 822;
+L17604: /* VAR */
+L17607: /* LIST */
+    tp_aot_op(tp, f, code + 17607);
+L17608: /* LIST */
+    tp_aot_op(tp, f, code + 17608);
+L17609: /* NONE */
+    regs[71] = tp_None;
+L17610: /* NONE */
+    regs[72] = tp_None;
+L17611: /* DEF */
+    tp_aot_op(tp, f, code + 17611);
+L17690: /* STRING */
+    tp_aot_op(tp, f, code + 17690);
+L17695: /* GSET */
+    tp_set(tp, f->globals, regs[69], regs[68]);
+L17696: /* LINE */
+    f->line = code + 17696;
+    f->lineno = 827;
+L17703: /* VAR */
+L17706: /* STRING */
+    tp_aot_op(tp, f, code + 17706);
+L17709: /* STRING */
+    tp_aot_op(tp, f, code + 17709);
+L17712: /* LIST */
+    tp_aot_op(tp, f, code + 17712);
+L17713: /* NONE */
+    regs[74] = tp_None;
+L17714: /* LIST */
+    tp_aot_op(tp, f, code + 17714);
+L17715: /* NONE */
+    regs[72] = tp_None;
+L17716: /* NONE */
+    regs[73] = tp_None;
+L17717: /* DEF */
+    tp_aot_op(tp, f, code + 17717);
+L17823: /* STRING */
+    tp_aot_op(tp, f, code + 17823);
+L17827: /* GSET */
+    tp_set(tp, f->globals, regs[70], regs[69]);
+L17828: /* LINE */
+    f->line = code + 17828;
+    f->lineno = 833;
+L17840: /* VAR */
+L17843: /* STRING */
+    tp_aot_op(tp, f, code + 17843);
+L17846: /* LIST */
+    tp_aot_op(tp, f, code + 17846);
+L17847: /* LIST */
+    tp_aot_op(tp, f, code + 17847);
+L17848: /* NONE */
+    regs[73] = tp_None;
+L17849: /* NONE */
+    regs[74] = tp_None;
+L17850: /* DEF */
+    tp_aot_op(tp, f, code + 17850);
+L17906: /* STRING */
+    tp_aot_op(tp, f, code + 17906);
+L17911: /* GSET */
+    tp_set(tp, f->globals, regs[71], regs[70]);
+L17912: /* LINE */
+    f->line = code + 17912;
+    f->lineno = 834;
+L17926: /* VAR */
+L17929: /* STRING */
+    tp_aot_op(tp, f, code + 17929);
+L17932: /* LIST */
+    tp_aot_op(tp, f, code + 17932);
+L17933: /* LIST */
+    tp_aot_op(tp, f, code + 17933);
+L17934: /* NONE */
+    regs[74] = tp_None;
+L17935: /* NONE */
+    regs[75] = tp_None;
+L17936: /* DEF */
+    tp_aot_op(tp, f, code + 17936);
+L17995: /* STRING */
+    tp_aot_op(tp, f, code + 17995);
+L18000: /* GSET */
+    tp_set(tp, f->globals, regs[72], regs[71]);
+L18001: /* LINE */
+    f->line = code + 18001;
+    f->lineno = 835;
+L18009: /* VAR */
+L18012: /* STRING */
+    tp_aot_op(tp, f, code + 18012);
+L18015: /* LIST */
+    tp_aot_op(tp, f, code + 18015);
+L18016: /* LIST */
+    tp_aot_op(tp, f, code + 18016);
+L18017: /* NONE */
+    regs[75] = tp_None;
+L18018: /* NONE */
+    regs[76] = tp_None;
+L18019: /* DEF */
+    tp_aot_op(tp, f, code + 18019);
+L18057: /* STRING */
+    tp_aot_op(tp, f, code + 18057);
+L18061: /* GSET */
+    tp_set(tp, f->globals, regs[73], regs[72]);
+L18062: /* LINE */
+    f->line = code + 18062;
+    f->lineno = 837;
+L18069: /* VAR */
+L18072: /* STRING */
+    tp_aot_op(tp, f, code + 18072);
+L18076: /* LIST */
+    tp_aot_op(tp, f, code + 18076);
+L18077: /* STRING */
+    tp_aot_op(tp, f, code + 18077);
+L18080: /* LIST */
+    tp_aot_op(tp, f, code + 18080);
+L18081: /* NONE */
+    regs[76] = tp_None;
+L18082: /* NONE */
+    regs[77] = tp_None;
+L18083: /* DEF */
+    tp_aot_op(tp, f, code + 18083);
+L18226: /* STRING */
+    tp_aot_op(tp, f, code + 18226);
+L18230: /* GSET */
+    tp_set(tp, f->globals, regs[74], regs[73]);
+L18231: /* LINE */
+    f->line = code + 18231;
+    f->lineno = 841;
+L18237: /* VAR */
+L18240: /* STRING */
+    tp_aot_op(tp, f, code + 18240);
+L18243: /* LIST */
+    tp_aot_op(tp, f, code + 18243);
+L18244: /* LIST */
+    tp_aot_op(tp, f, code + 18244);
+L18245: /* NONE */
+    regs[77] = tp_None;
+L18246: /* NONE */
+    regs[78] = tp_None;
+L18247: /* DEF */
+    tp_aot_op(tp, f, code + 18247);
+L18315: /* STRING */
+    tp_aot_op(tp, f, code + 18315);
+L18320: /* GSET */
+    tp_set(tp, f->globals, regs[75], regs[74]);
+L18321: /* LINE */
+    f->line = code + 18321;
+    f->lineno = 844;
+L18331: /* VAR */
+L18334: /* STRING */
+    tp_aot_op(tp, f, code + 18334);
+L18337: /* STRING */
+    tp_aot_op(tp, f, code + 18337);
+L18340: /* LIST */
+    tp_aot_op(tp, f, code + 18340);
+L18341: /* NONE */
+    regs[80] = tp_None;
+L18342: /* LIST */
+    tp_aot_op(tp, f, code + 18342);
+L18343: /* NONE */
+    regs[78] = tp_None;
+L18344: /* NONE */
+    regs[79] = tp_None;
+L18345: /* DEF */
+    tp_aot_op(tp, f, code + 18345);
+L18382: /* STRING */
+    tp_aot_op(tp, f, code + 18382);
+L18386: /* GSET */
+    tp_set(tp, f->globals, regs[76], regs[75]);
+L18387: /* LINE */
+    f->line = code + 18387;
+    f->lineno = 846;
+L18391: /* STRING */
+    tp_aot_op(tp, f, code + 18391);
+L18395: /* LINE */
+    f->line = code + 18395;
+    f->lineno = 847;
+L18412: /* STRING */
+    tp_aot_op(tp, f, code + 18412);
+L18416: /* GGET */
+    tp_aot_op(tp, f, code + 18416);
+L18421: /* STRING */
+    tp_aot_op(tp, f, code + 18421);
+L18426: /* GGET */
+    tp_aot_op(tp, f, code + 18426);
+L18432: /* STRING */
+    tp_aot_op(tp, f, code + 18432);
+L18435: /* GGET */
+    tp_aot_op(tp, f, code + 18435);
+L18439: /* LINE */
+    f->line = code + 18439;
+    f->lineno = 848;
+L18459: /* STRING */
+    tp_aot_op(tp, f, code + 18459);
+L18463: /* GGET */
+    tp_aot_op(tp, f, code + 18463);
+L18468: /* STRING */
+    tp_aot_op(tp, f, code + 18468);
+L18472: /* GGET */
+    tp_aot_op(tp, f, code + 18472);
+L18477: /* STRING */
+    tp_aot_op(tp, f, code + 18477);
+L18481: /* GGET */
+    tp_aot_op(tp, f, code + 18481);
+L18486: /* STRING */
+    tp_aot_op(tp, f, code + 18486);
+L18489: /* GGET */
+    tp_aot_op(tp, f, code + 18489);
+L18493: /* LINE */
+    f->line = code + 18493;
+    f->lineno = 849;
+L18513: /* STRING */
+    tp_aot_op(tp, f, code + 18513);
+L18517: /* GGET */
+    tp_aot_op(tp, f, code + 18517);
+L18522: /* STRING */
+    tp_aot_op(tp, f, code + 18522);
+L18526: /* GGET */
+    tp_aot_op(tp, f, code + 18526);
+L18530: /* STRING */
+    tp_aot_op(tp, f, code + 18530);
+L18535: /* GGET */
+    tp_aot_op(tp, f, code + 18535);
+L18540: /* STRING */
+    tp_aot_op(tp, f, code + 18540);
+L18543: /* GGET */
+    tp_aot_op(tp, f, code + 18543);
+L18547: /* LINE */
+    f->line = code + 18547;
+    f->lineno = 850;
+L18566: /* STRING */
+    tp_aot_op(tp, f, code + 18566);
+L18570: /* GGET */
+    tp_aot_op(tp, f, code + 18570);
+L18575: /* STRING */
+    tp_aot_op(tp, f, code + 18575);
+L18579: /* GGET */
+    tp_aot_op(tp, f, code + 18579);
+L18584: /* STRING */
+    tp_aot_op(tp, f, code + 18584);
+L18587: /* GGET */
+    tp_aot_op(tp, f, code + 18587);
+L18591: /* STRING */
+    tp_aot_op(tp, f, code + 18591);
+L18595: /* GGET */
+    tp_aot_op(tp, f, code + 18595);
+L18600: /* LINE */
+    f->line = code + 18600;
+    f->lineno = 851;
+L18615: /* STRING */
+    tp_aot_op(tp, f, code + 18615);
+L18619: /* GGET */
+    tp_aot_op(tp, f, code + 18619);
+L18624: /* STRING */
+    tp_aot_op(tp, f, code + 18624);
+L18627: /* GGET */
+    tp_aot_op(tp, f, code + 18627);
+L18631: /* STRING */
+    tp_aot_op(tp, f, code + 18631);
+L18635: /* GGET */
+    tp_aot_op(tp, f, code + 18635);
+L18639: /* DICT */
+    tp_aot_op(tp, f, code + 18639);
+L18640: /* GSET */
+    tp_set(tp, f->globals, regs[76], regs[77]);
+L18641: /* LINE */
+    f->line = code + 18641;
+    f->lineno = 853;
+L18645: /* STRING */
+    tp_aot_op(tp, f, code + 18645);
+L18649: /* LINE */
+    f->line = code + 18649;
+    f->lineno = 854;
+L18668: /* STRING */
+    tp_aot_op(tp, f, code + 18668);
+L18672: /* GGET */
+    tp_aot_op(tp, f, code + 18672);
+L18676: /* STRING */
+    tp_aot_op(tp, f, code + 18676);
+L18680: /* GGET */
+    tp_aot_op(tp, f, code + 18680);
+L18684: /* STRING */
+    tp_aot_op(tp, f, code + 18684);
+L18688: /* GGET */
+    tp_aot_op(tp, f, code + 18688);
+L18692: /* STRING */
+    tp_aot_op(tp, f, code + 18692);
+L18696: /* GGET */
+    tp_aot_op(tp, f, code + 18696);
+L18700: /* LINE */
+    f->line = code + 18700;
+    f->lineno = 855;
+L18715: /* STRING */
+    tp_aot_op(tp, f, code + 18715);
+L18719: /* GGET */
+    tp_aot_op(tp, f, code + 18719);
+L18723: /* STRING */
+    tp_aot_op(tp, f, code + 18723);
+L18727: /* GGET */
+    tp_aot_op(tp, f, code + 18727);
+L18731: /* STRING */
+    tp_aot_op(tp, f, code + 18731);
+L18735: /* GGET */
+    tp_aot_op(tp, f, code + 18735);
+L18740: /* LINE */
+    f->line = code + 18740;
+    f->lineno = 856;
+L18752: /* STRING */
+    tp_aot_op(tp, f, code + 18752);
+L18756: /* GGET */
+    tp_aot_op(tp, f, code + 18756);
+L18761: /* STRING */
+    tp_aot_op(tp, f, code + 18761);
+L18765: /* GGET */
+    tp_aot_op(tp, f, code + 18765);
+L18770: /* LINE */
+    f->line = code + 18770;
+    f->lineno = 857;
+L18792: /* STRING */
+    tp_aot_op(tp, f, code + 18792);
+L18796: /* GGET */
+    tp_aot_op(tp, f, code + 18796);
+L18801: /* STRING */
+    tp_aot_op(tp, f, code + 18801);
+L18804: /* GGET */
+    tp_aot_op(tp, f, code + 18804);
+L18808: /* STRING */
+    tp_aot_op(tp, f, code + 18808);
+L18812: /* GGET */
+    tp_aot_op(tp, f, code + 18812);
+L18816: /* STRING */
+    tp_aot_op(tp, f, code + 18816);
+L18820: /* GGET */
+    tp_aot_op(tp, f, code + 18820);
+L18824: /* STRING */
+    tp_aot_op(tp, f, code + 18824);
+L18827: /* GGET */
+    tp_aot_op(tp, f, code + 18827);
+L18831: /* DICT */
+    tp_aot_op(tp, f, code + 18831);
+L18832: /* GSET */
+    tp_set(tp, f->globals, regs[76], regs[77]);
+L18833: /* LINE */
+    f->line = code + 18833;
+    f->lineno = 860;
+L18839: /* VAR */
+L18842: /* STRING */
+    tp_aot_op(tp, f, code + 18842);
+L18845: /* STRING */
+    tp_aot_op(tp, f, code + 18845);
+L18848: /* LIST */
+    tp_aot_op(tp, f, code + 18848);
+L18849: /* NONE */
+    regs[81] = tp_None;
+L18850: /* LIST */
+    tp_aot_op(tp, f, code + 18850);
+L18851: /* NONE */
+    regs[79] = tp_None;
+L18852: /* NONE */
+    regs[80] = tp_None;
+L18853: /* DEF */
+    tp_aot_op(tp, f, code + 18853);
+L18985: /* STRING */
+    tp_aot_op(tp, f, code + 18985);
+L18988: /* GSET */
+    tp_set(tp, f->globals, regs[77], regs[76]);
+L18989: /* LINE */
+    f->line = code + 18989;
+    f->lineno = 874;
+L19000: /* VAR */
+L19003: /* STRING */
+    tp_aot_op(tp, f, code + 19003);
+L19007: /* STRING */
+    tp_aot_op(tp, f, code + 19007);
+L19010: /* STRING */
+    tp_aot_op(tp, f, code + 19010);
+L19013: /* STRING */
+    tp_aot_op(tp, f, code + 19013);
+L19018: /* LIST */
+    tp_aot_op(tp, f, code + 19018);
+L19019: /* NUMBER */
+    tp_aot_op(tp, f, code + 19019);
+L19022: /* LIST */
+    tp_aot_op(tp, f, code + 19022);
+L19023: /* NONE */
+    regs[80] = tp_None;
+L19024: /* NONE */
+    regs[81] = tp_None;
+L19025: /* DEF */
+    tp_aot_op(tp, f, code + 19025);
+L19321: /* STRING */
+    tp_aot_op(tp, f, code + 19321);
+L19325: /* GSET */
+    tp_set(tp, f->globals, regs[78], regs[77]);
+L19326: /* EOF */
+    return code + 19326;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_255(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 17: goto L17;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 27: goto L27;
+        case 31: goto L31;
+        case 32: goto L32;
+        case 33: goto L33;
+        case 34: goto L34;
+        case 35: goto L35;
+        case 237: goto L237;
+        case 241: goto L241;
+        case 242: goto L242;
+        case 251: goto L251;
+        case 253: goto L253;
+        case 257: goto L257;
+        case 260: goto L260;
+        case 261: goto L261;
+        case 264: goto L264;
+        case 265: goto L265;
+        case 266: goto L266;
+        case 267: goto L267;
+        case 696: goto L696;
+        case 699: goto L699;
+        case 700: goto L700;
+        case 709: goto L709;
+        case 712: goto L712;
+        case 716: goto L716;
+        case 719: goto L719;
+        case 720: goto L720;
+        case 723: goto L723;
+        case 724: goto L724;
+        case 725: goto L725;
+        case 726: goto L726;
+        case 1199: goto L1199;
+        case 1201: goto L1201;
+        case 1202: goto L1202;
+        case 1206: goto L1206;
+        case 1209: goto L1209;
+        case 1214: goto L1214;
+        case 1215: goto L1215;
+        case 1219: goto L1219;
+        case 1220: goto L1220;
+        case 1223: goto L1223;
+        case 1224: goto L1224;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 8;
+L7: /* LINE */
+    f->line = code + 7;
+    f->lineno = 9;
+L17: /* VAR */
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* STRING */
+    tp_aot_op(tp, f, code + 23);
+L27: /* STRING */
+    tp_aot_op(tp, f, code + 27);
+L31: /* LIST */
+    tp_aot_op(tp, f, code + 31);
+L32: /* LIST */
+    tp_aot_op(tp, f, code + 32);
+L33: /* NONE */
+    regs[3] = tp_None;
+L34: /* NONE */
+    regs[4] = tp_None;
+L35: /* DEF */
+    tp_aot_op(tp, f, code + 35);
+L237: /* VAR */
+L241: /* MOVE */
+    regs[1] = regs[0];
+L242: /* LINE */
+    f->line = code + 242;
+    f->lineno = 16;
+L251: /* VAR */
+L253: /* STRING */
+    tp_aot_op(tp, f, code + 253);
+L257: /* STRING */
+    tp_aot_op(tp, f, code + 257);
+L260: /* LIST */
+    tp_aot_op(tp, f, code + 260);
+L261: /* NUMBER */
+    tp_aot_op(tp, f, code + 261);
+L264: /* LIST */
+    tp_aot_op(tp, f, code + 264);
+L265: /* NONE */
+    regs[5] = tp_None;
+L266: /* NONE */
+    regs[6] = tp_None;
+L267: /* DEF */
+    tp_aot_op(tp, f, code + 267);
+L696: /* VAR */
+L699: /* MOVE */
+    regs[3] = regs[2];
+L700: /* LINE */
+    f->line = code + 700;
+    f->lineno = 22;
+L709: /* VAR */
+L712: /* STRING */
+    tp_aot_op(tp, f, code + 712);
+L716: /* STRING */
+    tp_aot_op(tp, f, code + 716);
+L719: /* LIST */
+    tp_aot_op(tp, f, code + 719);
+L720: /* NUMBER */
+    tp_aot_op(tp, f, code + 720);
+L723: /* LIST */
+    tp_aot_op(tp, f, code + 723);
+L724: /* NONE */
+    regs[7] = tp_None;
+L725: /* NONE */
+    regs[8] = tp_None;
+L726: /* DEF */
+    tp_aot_op(tp, f, code + 726);
+L1199: /* VAR */
+L1201: /* MOVE */
+    regs[5] = regs[4];
+L1202: /* GGET */
+    tp_aot_op(tp, f, code + 1202);
+L1206: /* VAR */
+L1209: /* STRING */
+    tp_aot_op(tp, f, code + 1209);
+L1214: /* SET */
+    tp_set(tp, regs[6], regs[7], regs[1]);
+L1215: /* STRING */
+    tp_aot_op(tp, f, code + 1215);
+L1219: /* SET */
+    tp_set(tp, regs[6], regs[7], regs[3]);
+L1220: /* STRING */
+    tp_aot_op(tp, f, code + 1220);
+L1223: /* SET */
+    tp_set(tp, regs[6], regs[7], regs[5]);
+L1224: /* EOF */
+    return code + 1224;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_1503(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 22: goto L22;
+        case 23: goto L23;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 31: goto L31;
+        case 34: goto L34;
+        case 36: goto L36;
+        case 40: goto L40;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 44: goto L44;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 43;
+L11: /* VAR */
+L13: /* STRING */
+    tp_aot_op(tp, f, code + 13);
+L22: /* FILE */
+    f->fname = regs[1];
+L23: /* STRING */
+    tp_aot_op(tp, f, code + 23);
+L27: /* NAME */
+    f->name = regs[1];
+L28: /* GGET */
+    tp_aot_op(tp, f, code + 28);
+L31: /* STRING */
+    tp_aot_op(tp, f, code + 31);
+L34: /* MGET */
+    tp_aot_op(tp, f, code + 34);
+L36: /* STRING */
+    tp_aot_op(tp, f, code + 36);
+L40: /* METHOD */
+    tp_aot_op(tp, f, code + 40);
+L42: /* MOVE */
+    regs[5] = regs[0];
+L43: /* CALLM */
+    return code + 43;
+L44: /* EOF */
+    return code + 44;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_1569(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 32: goto L32;
+        case 36: goto L36;
+        case 37: goto L37;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 50: goto L50;
+        case 54: goto L54;
+        case 55: goto L55;
+        case 56: goto L56;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 72: goto L72;
+        case 76: goto L76;
+        case 79: goto L79;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 87: goto L87;
+        case 88: goto L88;
+        case 89: goto L89;
+        case 90: goto L90;
+        case 92: goto L92;
+        case 93: goto L93;
+        case 103: goto L103;
+        case 107: goto L107;
+        case 111: goto L111;
+        case 112: goto L112;
+        case 115: goto L115;
+        case 116: goto L116;
+        case 117: goto L117;
+        case 118: goto L118;
+        case 119: goto L119;
+        case 120: goto L120;
+        case 121: goto L121;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 44;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 45;
+L32: /* GGET */
+    tp_aot_op(tp, f, code + 32);
+L36: /* MOVE */
+    regs[3] = regs[0];
+L37: /* STRING */
+    tp_aot_op(tp, f, code + 37);
+L41: /* CALLP */
+    return code + 41;
+L42: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L44;
+    }
+L43: /* JUMP */
+    goto L63;
+L44: /* LINE */
+    f->line = code + 44;
+    f->lineno = 46;
+L50: /* GGET */
+    tp_aot_op(tp, f, code + 50);
+L54: /* MOVE */
+    regs[3] = regs[0];
+L55: /* CALLP */
+    return code + 55;
+L56: /* LINE */
+    f->line = code + 56;
+    f->lineno = 47;
+L61: /* NONE */
+    regs[1] = tp_None;
+L62: /* RETURN */
+    return code + 62;
+L63: /* LINE */
+    f->line = code + 63;
+    f->lineno = 48;
+L72: /* GGET */
+    tp_aot_op(tp, f, code + 72);
+L76: /* NUMBER */
+    tp_aot_op(tp, f, code + 76);
+L79: /* GGET */
+    tp_aot_op(tp, f, code + 79);
+L82: /* MOVE */
+    regs[10] = regs[0];
+L83: /* CALLP */
+    return code + 83;
+L84: /* NUMBER */
+    tp_aot_op(tp, f, code + 84);
+L87: /* RANGE */
+    tp_aot_op(tp, f, code + 87);
+L88: /* FOR */
+    if (regs[3].type.typeid == TP_NUMBER) {
+        if (regs[4].nint > 0 ? regs[2].nint < regs[3].nint : regs[2].nint > regs[3].nint) {
+            regs[1] = regs[2];
+            regs[2].nint += regs[4].nint;
+            goto L90;
+        }
+    } else if (tp_iter_next(tp, &regs[1], regs[2], &regs[4])) {
+        goto L90;
+    }
+L89: /* JUMP */
+    goto L121;
+L90: /* VAR */
+L92: /* MOVE */
+    regs[5] = regs[1];
+L93: /* LINE */
+    f->line = code + 93;
+    f->lineno = 49;
+L103: /* GGET */
+    tp_aot_op(tp, f, code + 103);
+L107: /* STRING */
+    tp_aot_op(tp, f, code + 107);
+L111: /* MOVE */
+    regs[9] = regs[5];
+L112: /* NUMBER */
+    tp_aot_op(tp, f, code + 112);
+L115: /* ADD */
+    if (TP_BOTH(regs[5], regs[1], TP_NUMBER_INT)) {
+        regs[10] = tp_int(regs[5].nint + regs[1].nint);
+    } else {
+        tp_aot_op(tp, f, code + 115);
+    }
+L116: /* LIST */
+    tp_aot_op(tp, f, code + 116);
+L117: /* GET */
+    regs[9] = tp_get(tp, regs[0], regs[10]);
+    tp_grey(tp, regs[9]);
+L118: /* LIST */
+    tp_aot_op(tp, f, code + 118);
+L119: /* CALLP */
+    return code + 119;
+L120: /* JUMP */
+    tp_aot_safepoint(tp, 32);
+    goto L88;
+L121: /* EOF */
+    return code + 121;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_1712(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 31: goto L31;
+        case 34: goto L34;
+        case 38: goto L38;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 49: goto L49;
+        case 51: goto L51;
+        case 54: goto L54;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 60: goto L60;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 73: goto L73;
+        case 76: goto L76;
+        case 80: goto L80;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 85: goto L85;
+        case 86: goto L86;
+        case 87: goto L87;
+        case 95: goto L95;
+        case 98: goto L98;
+        case 101: goto L101;
+        case 105: goto L105;
+        case 107: goto L107;
+        case 110: goto L110;
+        case 111: goto L111;
+        case 112: goto L112;
+        case 118: goto L118;
+        case 121: goto L121;
+        case 125: goto L125;
+        case 126: goto L126;
+        case 139: goto L139;
+        case 141: goto L141;
+        case 145: goto L145;
+        case 147: goto L147;
+        case 148: goto L148;
+        case 151: goto L151;
+        case 154: goto L154;
+        case 157: goto L157;
+        case 158: goto L158;
+        case 159: goto L159;
+        case 162: goto L162;
+        case 163: goto L163;
+        case 164: goto L164;
+        case 165: goto L165;
+        case 166: goto L166;
+        case 177: goto L177;
+        case 181: goto L181;
+        case 185: goto L185;
+        case 188: goto L188;
+        case 191: goto L191;
+        case 192: goto L192;
+        case 193: goto L193;
+        case 196: goto L196;
+        case 197: goto L197;
+        case 198: goto L198;
+        case 199: goto L199;
+        case 200: goto L200;
+        case 205: goto L205;
+        case 209: goto L209;
+        case 210: goto L210;
+        case 211: goto L211;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 50;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 51;
+L31: /* GGET */
+    tp_aot_op(tp, f, code + 31);
+L34: /* STRING */
+    tp_aot_op(tp, f, code + 34);
+L38: /* MGET */
+    tp_aot_op(tp, f, code + 38);
+L40: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L42;
+    }
+L41: /* JUMP */
+    goto L44;
+L42: /* NONE */
+    regs[1] = tp_None;
+L43: /* RETURN */
+    return code + 43;
+L44: /* LINE */
+    f->line = code + 44;
+    f->lineno = 52;
+L49: /* VAR */
+L51: /* VAR */
+L54: /* NUMBER */
+    tp_aot_op(tp, f, code + 54);
+L57: /* GET */
+    regs[1] = tp_get(tp, regs[0], regs[2]);
+    tp_grey(tp, regs[1]);
+L58: /* VAR */
+L60: /* NUMBER */
+    tp_aot_op(tp, f, code + 60);
+L63: /* GET */
+    regs[2] = tp_get(tp, regs[0], regs[3]);
+    tp_grey(tp, regs[2]);
+L64: /* LINE */
+    f->line = code + 64;
+    f->lineno = 53;
+L73: /* GGET */
+    tp_aot_op(tp, f, code + 73);
+L76: /* STRING */
+    tp_aot_op(tp, f, code + 76);
+L80: /* MGET */
+    tp_aot_op(tp, f, code + 80);
+L82: /* EQ */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[0] = tp_bool(regs[1].nint == regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 82);
+    }
+L83: /* IF */
+    if (TP_IS_INT(regs[0]) ? regs[0].nint != 0 : tp_true(tp, regs[0])) {
+        goto L85;
+    }
+L84: /* JUMP */
+    goto L87;
+L85: /* NONE */
+    regs[0] = tp_None;
+L86: /* RETURN */
+    return code + 86;
+L87: /* LINE */
+    f->line = code + 87;
+    f->lineno = 54;
+L95: /* VAR */
+L98: /* GGET */
+    tp_aot_op(tp, f, code + 98);
+L101: /* STRING */
+    tp_aot_op(tp, f, code + 101);
+L105: /* MGET */
+    tp_aot_op(tp, f, code + 105);
+L107: /* NUMBER */
+    tp_aot_op(tp, f, code + 107);
+L110: /* SUB */
+    if (TP_BOTH(regs[1], regs[4], TP_NUMBER_INT)) {
+        regs[3] = tp_int(regs[1].nint - regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 110);
+    }
+L111: /* GET */
+    regs[0] = tp_get(tp, regs[2], regs[3]);
+    tp_grey(tp, regs[0]);
+L112: /* LINE */
+    f->line = code + 112;
+    f->lineno = 55;
+L118: /* GGET */
+    tp_aot_op(tp, f, code + 118);
+L121: /* STRING */
+    tp_aot_op(tp, f, code + 121);
+L125: /* SET */
+    tp_set(tp, regs[2], regs[3], regs[1]);
+L126: /* LINE */
+    f->line = code + 126;
+    f->lineno = 56;
+L139: /* VAR */
+L141: /* STRING */
+    tp_aot_op(tp, f, code + 141);
+L145: /* METHOD */
+    tp_aot_op(tp, f, code + 145);
+L147: /* CALLM */
+    return code + 147;
+L148: /* STRING */
+    tp_aot_op(tp, f, code + 148);
+L151: /* NUMBER */
+    tp_aot_op(tp, f, code + 151);
+L154: /* GGET */
+    tp_aot_op(tp, f, code + 154);
+L157: /* MOVE */
+    regs[8] = regs[0];
+L158: /* CALLP */
+    return code + 158;
+L159: /* NUMBER */
+    tp_aot_op(tp, f, code + 159);
+L162: /* MOD */
+    regs[6] = tp_mod(tp, regs[6], regs[7]);
+L163: /* SUB */
+    if (TP_BOTH(regs[5], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[5].nint - regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 163);
+    }
+L164: /* MUL */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[4] = tp_int(regs[4].nint * regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 164);
+    }
+L165: /* ADD */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[2] = tp_int(regs[3].nint + regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 165);
+    }
+L166: /* LINE */
+    f->line = code + 166;
+    f->lineno = 57;
+L177: /* GGET */
+    tp_aot_op(tp, f, code + 177);
+L181: /* GGET */
+    tp_aot_op(tp, f, code + 181);
+L185: /* GGET */
+    tp_aot_op(tp, f, code + 185);
+L188: /* GGET */
+    tp_aot_op(tp, f, code + 188);
+L191: /* MOVE */
+    regs[7] = regs[2];
+L192: /* CALLP */
+    return code + 192;
+L193: /* NUMBER */
+    tp_aot_op(tp, f, code + 193);
+L196: /* DIV */
+    regs[9] = tp_div(tp, regs[9], regs[6]);
+L197: /* CALLP */
+    return code + 197;
+L198: /* MOVE */
+    regs[7] = regs[1];
+L199: /* CALLP */
+    return code + 199;
+L200: /* LINE */
+    f->line = code + 200;
+    f->lineno = 58;
+L205: /* GGET */
+    tp_aot_op(tp, f, code + 205);
+L209: /* MOVE */
+    regs[5] = regs[2];
+L210: /* CALLP */
+    return code + 210;
+L211: /* EOF */
+    return code + 211;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_1966(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 10: goto L10;
+        case 12: goto L12;
+        case 14: goto L14;
+        case 16: goto L16;
+        case 18: goto L18;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 32: goto L32;
+        case 33: goto L33;
+        case 44: goto L44;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 55: goto L55;
+        case 56: goto L56;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 69: goto L69;
+        case 73: goto L73;
+        case 74: goto L74;
+        case 78: goto L78;
+        case 79: goto L79;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 94: goto L94;
+        case 98: goto L98;
+        case 99: goto L99;
+        case 103: goto L103;
+        case 104: goto L104;
+        case 105: goto L105;
+        case 106: goto L106;
+        case 107: goto L107;
+        case 108: goto L108;
+        case 119: goto L119;
+        case 123: goto L123;
+        case 124: goto L124;
+        case 128: goto L128;
+        case 129: goto L129;
+        case 130: goto L130;
+        case 131: goto L131;
+        case 132: goto L132;
+        case 133: goto L133;
+        case 141: goto L141;
+        case 145: goto L145;
+        case 149: goto L149;
+        case 150: goto L150;
+        case 151: goto L151;
+        case 152: goto L152;
+        case 153: goto L153;
+        case 154: goto L154;
+        case 155: goto L155;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 59;
+L10: /* VAR */
+L12: /* VAR */
+L14: /* VAR */
+L16: /* VAR */
+L18: /* STRING */
+    tp_aot_op(tp, f, code + 18);
+L27: /* FILE */
+    f->fname = regs[4];
+L28: /* STRING */
+    tp_aot_op(tp, f, code + 28);
+L32: /* NAME */
+    f->name = regs[4];
+L33: /* LINE */
+    f->line = code + 33;
+    f->lineno = 60;
+L44: /* GGET */
+    tp_aot_op(tp, f, code + 44);
+L48: /* MOVE */
+    regs[6] = regs[0];
+L49: /* STRING */
+    tp_aot_op(tp, f, code + 49);
+L53: /* CALLP */
+    return code + 53;
+L54: /* IFN */
+    if (!(TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4]))) {
+        goto L56;
+    }
+L55: /* JUMP */
+    goto L58;
+L56: /* NONE */
+    regs[4] = tp_None;
+L57: /* RAISE */
+    return code + 57;
+L58: /* LINE */
+    f->line = code + 58;
+    f->lineno = 61;
+L69: /* GGET */
+    tp_aot_op(tp, f, code + 69);
+L73: /* MOVE */
+    regs[6] = regs[1];
+L74: /* STRING */
+    tp_aot_op(tp, f, code + 74);
+L78: /* CALLP */
+    return code + 78;
+L79: /* IFN */
+    if (!(TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4]))) {
+        goto L81;
+    }
+L80: /* JUMP */
+    goto L83;
+L81: /* NONE */
+    regs[4] = tp_None;
+L82: /* RAISE */
+    return code + 82;
+L83: /* LINE */
+    f->line = code + 83;
+    f->lineno = 62;
+L94: /* GGET */
+    tp_aot_op(tp, f, code + 94);
+L98: /* MOVE */
+    regs[6] = regs[2];
+L99: /* STRING */
+    tp_aot_op(tp, f, code + 99);
+L103: /* CALLP */
+    return code + 103;
+L104: /* IFN */
+    if (!(TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4]))) {
+        goto L106;
+    }
+L105: /* JUMP */
+    goto L108;
+L106: /* NONE */
+    regs[4] = tp_None;
+L107: /* RAISE */
+    return code + 107;
+L108: /* LINE */
+    f->line = code + 108;
+    f->lineno = 63;
+L119: /* GGET */
+    tp_aot_op(tp, f, code + 119);
+L123: /* MOVE */
+    regs[6] = regs[3];
+L124: /* STRING */
+    tp_aot_op(tp, f, code + 124);
+L128: /* CALLP */
+    return code + 128;
+L129: /* IFN */
+    if (!(TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4]))) {
+        goto L131;
+    }
+L130: /* JUMP */
+    goto L133;
+L131: /* NONE */
+    regs[4] = tp_None;
+L132: /* RAISE */
+    return code + 132;
+L133: /* LINE */
+    f->line = code + 133;
+    f->lineno = 64;
+L141: /* GGET */
+    tp_aot_op(tp, f, code + 141);
+L145: /* STRING */
+    tp_aot_op(tp, f, code + 145);
+L149: /* MOVE */
+    regs[7] = regs[0];
+L150: /* MOVE */
+    regs[8] = regs[1];
+L151: /* MOVE */
+    regs[9] = regs[2];
+L152: /* MOVE */
+    regs[10] = regs[3];
+L153: /* LIST */
+    tp_aot_op(tp, f, code + 153);
+L154: /* CALLP */
+    return code + 154;
+L155: /* EOF */
+    return code + 155;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_2150(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 12: goto L12;
+        case 14: goto L14;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 28: goto L28;
+        case 29: goto L29;
+        case 37: goto L37;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 58: goto L58;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 71: goto L71;
+        case 72: goto L72;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 79: goto L79;
+        case 80: goto L80;
+        case 81: goto L81;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 65;
+L8: /* VAR */
+L10: /* VAR */
+L12: /* VAR */
+L14: /* STRING */
+    tp_aot_op(tp, f, code + 14);
+L23: /* FILE */
+    f->fname = regs[3];
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L28: /* NAME */
+    f->name = regs[3];
+L29: /* LINE */
+    f->line = code + 29;
+    f->lineno = 66;
+L37: /* NUMBER */
+    tp_aot_op(tp, f, code + 37);
+L40: /* LT */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[3] = tp_bool(regs[2].nint < regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 40);
+    }
+L41: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L43;
+    }
+L42: /* JUMP */
+    goto L47;
+L43: /* NUMBER */
+    tp_aot_op(tp, f, code + 43);
+L46: /* ADD */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_int(regs[2].nint + regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 46);
+    }
+L47: /* LINE */
+    f->line = code + 47;
+    f->lineno = 67;
+L58: /* GGET */
+    tp_aot_op(tp, f, code + 58);
+L62: /* MOVE */
+    regs[4] = regs[0];
+L63: /* MOVE */
+    regs[5] = regs[1];
+L64: /* NUMBER */
+    tp_aot_op(tp, f, code + 64);
+L67: /* BITAND */
+    regs[6] = tp_bitwise_and(tp, regs[2], regs[1]);
+L68: /* NUMBER */
+    tp_aot_op(tp, f, code + 68);
+L71: /* RSH */
+    regs[6] = tp_rsh(tp, regs[6], regs[1]);
+L72: /* NUMBER */
+    tp_aot_op(tp, f, code + 72);
+L75: /* BITAND */
+    regs[7] = tp_bitwise_and(tp, regs[2], regs[1]);
+L76: /* NUMBER */
+    tp_aot_op(tp, f, code + 76);
+L79: /* RSH */
+    regs[7] = tp_rsh(tp, regs[7], regs[1]);
+L80: /* CALLP */
+    return code + 80;
+L81: /* EOF */
+    return code + 81;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_2261(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 15: goto L15;
+        case 24: goto L24;
+        case 25: goto L25;
+        case 30: goto L30;
+        case 31: goto L31;
+        case 45: goto L45;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 51: goto L51;
+        case 54: goto L54;
+        case 55: goto L55;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 66: goto L66;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 69: goto L69;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 68;
+L9: /* VAR */
+L11: /* VAR */
+L13: /* VAR */
+L15: /* STRING */
+    tp_aot_op(tp, f, code + 15);
+L24: /* FILE */
+    f->fname = regs[3];
+L25: /* STRING */
+    tp_aot_op(tp, f, code + 25);
+L30: /* NAME */
+    f->name = regs[3];
+L31: /* LINE */
+    f->line = code + 31;
+    f->lineno = 69;
+L45: /* STRING */
+    tp_aot_op(tp, f, code + 45);
+L49: /* MOVE */
+    regs[4] = regs[0];
+L50: /* MOVE */
+    regs[5] = regs[1];
+L51: /* NUMBER */
+    tp_aot_op(tp, f, code + 51);
+L54: /* BITAND */
+    regs[6] = tp_bitwise_and(tp, regs[2], regs[0]);
+L55: /* NUMBER */
+    tp_aot_op(tp, f, code + 55);
+L58: /* RSH */
+    regs[6] = tp_rsh(tp, regs[6], regs[0]);
+L59: /* NUMBER */
+    tp_aot_op(tp, f, code + 59);
+L62: /* BITAND */
+    regs[7] = tp_bitwise_and(tp, regs[2], regs[0]);
+L63: /* NUMBER */
+    tp_aot_op(tp, f, code + 63);
+L66: /* RSH */
+    regs[7] = tp_rsh(tp, regs[7], regs[0]);
+L67: /* LIST */
+    tp_aot_op(tp, f, code + 67);
+L68: /* RETURN */
+    return code + 68;
+L69: /* EOF */
+    return code + 69;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_2355(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 26: goto L26;
+        case 27: goto L27;
+        case 35: goto L35;
+        case 38: goto L38;
+        case 42: goto L42;
+        case 44: goto L44;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 58: goto L58;
+        case 61: goto L61;
+        case 65: goto L65;
+        case 67: goto L67;
+        case 70: goto L70;
+        case 73: goto L73;
+        case 77: goto L77;
+        case 79: goto L79;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 89: goto L89;
+        case 92: goto L92;
+        case 96: goto L96;
+        case 98: goto L98;
+        case 99: goto L99;
+        case 100: goto L100;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 71;
+L9: /* VAR */
+L11: /* STRING */
+    tp_aot_op(tp, f, code + 11);
+L20: /* FILE */
+    f->fname = regs[1];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L26: /* NAME */
+    f->name = regs[1];
+L27: /* LINE */
+    f->line = code + 27;
+    f->lineno = 74;
+L35: /* GGET */
+    tp_aot_op(tp, f, code + 35);
+L38: /* STRING */
+    tp_aot_op(tp, f, code + 38);
+L42: /* MGET */
+    tp_aot_op(tp, f, code + 42);
+L44: /* NOTIN */
+    regs[1] = tp_bool(!tp_true(tp, tp_has(tp, regs[2], regs[0])));
+L45: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L47;
+    }
+L46: /* JUMP */
+    goto L81;
+L47: /* LINE */
+    f->line = code + 47;
+    f->lineno = 75;
+L58: /* GGET */
+    tp_aot_op(tp, f, code + 58);
+L61: /* STRING */
+    tp_aot_op(tp, f, code + 61);
+L65: /* MGET */
+    tp_aot_op(tp, f, code + 65);
+L67: /* GGET */
+    tp_aot_op(tp, f, code + 67);
+L70: /* GGET */
+    tp_aot_op(tp, f, code + 70);
+L73: /* STRING */
+    tp_aot_op(tp, f, code + 73);
+L77: /* MGET */
+    tp_aot_op(tp, f, code + 77);
+L79: /* CALLP */
+    return code + 79;
+L80: /* SET */
+    tp_set(tp, regs[1], regs[0], regs[2]);
+L81: /* LINE */
+    f->line = code + 81;
+    f->lineno = 76;
+L89: /* GGET */
+    tp_aot_op(tp, f, code + 89);
+L92: /* STRING */
+    tp_aot_op(tp, f, code + 92);
+L96: /* MGET */
+    tp_aot_op(tp, f, code + 96);
+L98: /* GET */
+    regs[1] = tp_get(tp, regs[1], regs[0]);
+    tp_grey(tp, regs[1]);
+L99: /* RETURN */
+    return code + 99;
+L100: /* EOF */
+    return code + 100;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_2485(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 10: goto L10;
+        case 12: goto L12;
+        case 14: goto L14;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 29: goto L29;
+        case 30: goto L30;
+        case 36: goto L36;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 52: goto L52;
+        case 54: goto L54;
+        case 57: goto L57;
+        case 60: goto L60;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 65: goto L65;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 72: goto L72;
+        case 84: goto L84;
+        case 88: goto L88;
+        case 92: goto L92;
+        case 93: goto L93;
+        case 98: goto L98;
+        case 101: goto L101;
+        case 102: goto L102;
+        case 103: goto L103;
+        case 104: goto L104;
+        case 111: goto L111;
+        case 115: goto L115;
+        case 118: goto L118;
+        case 121: goto L121;
+        case 124: goto L124;
+        case 125: goto L125;
+        case 126: goto L126;
+        case 127: goto L127;
+        case 132: goto L132;
+        case 136: goto L136;
+        case 137: goto L137;
+        case 138: goto L138;
+        case 143: goto L143;
+        case 144: goto L144;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 78;
+L10: /* VAR */
+L12: /* VAR */
+L14: /* STRING */
+    tp_aot_op(tp, f, code + 14);
+L23: /* FILE */
+    f->fname = regs[2];
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L29: /* NAME */
+    f->name = regs[2];
+L30: /* LINE */
+    f->line = code + 30;
+    f->lineno = 79;
+L36: /* GGET */
+    tp_aot_op(tp, f, code + 36);
+L40: /* MOVE */
+    regs[4] = regs[1];
+L41: /* CALLP */
+    return code + 41;
+L42: /* LINE */
+    f->line = code + 42;
+    f->lineno = 80;
+L52: /* VAR */
+L54: /* STRING */
+    tp_aot_op(tp, f, code + 54);
+L57: /* NUMBER */
+    tp_aot_op(tp, f, code + 57);
+L60: /* GGET */
+    tp_aot_op(tp, f, code + 60);
+L63: /* MOVE */
+    regs[8] = regs[0];
+L64: /* CALLP */
+    return code + 64;
+L65: /* NUMBER */
+    tp_aot_op(tp, f, code + 65);
+L68: /* MOD */
+    regs[6] = tp_mod(tp, regs[6], regs[7]);
+L69: /* SUB */
+    if (TP_BOTH(regs[5], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[5].nint - regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 69);
+    }
+L70: /* MUL */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[4] = tp_int(regs[4].nint * regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 70);
+    }
+L71: /* ADD */
+    if (TP_BOTH(regs[0], regs[4], TP_NUMBER_INT)) {
+        regs[2] = tp_int(regs[0].nint + regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 71);
+    }
+L72: /* LINE */
+    f->line = code + 72;
+    f->lineno = 81;
+L84: /* GGET */
+    tp_aot_op(tp, f, code + 84);
+L88: /* GGET */
+    tp_aot_op(tp, f, code + 88);
+L92: /* MOVE */
+    regs[6] = regs[1];
+L93: /* GGET */
+    tp_aot_op(tp, f, code + 93);
+L98: /* STRING */
+    tp_aot_op(tp, f, code + 98);
+L101: /* ADD */
+    if (TP_BOTH(regs[9], regs[0], TP_NUMBER_INT)) {
+        regs[9] = tp_int(regs[9].nint + regs[0].nint);
+    } else {
+        tp_aot_op(tp, f, code + 101);
+    }
+L102: /* CALLP */
+    return code + 102;
+L103: /* CALLP */
+    return code + 103;
+L104: /* LINE */
+    f->line = code + 104;
+    f->lineno = 82;
+L111: /* GGET */
+    tp_aot_op(tp, f, code + 111);
+L115: /* NUMBER */
+    tp_aot_op(tp, f, code + 115);
+L118: /* NUMBER */
+    tp_aot_op(tp, f, code + 118);
+L121: /* GGET */
+    tp_aot_op(tp, f, code + 121);
+L124: /* MOVE */
+    regs[9] = regs[0];
+L125: /* CALLP */
+    return code + 125;
+L126: /* CALLP */
+    return code + 126;
+L127: /* LINE */
+    f->line = code + 127;
+    f->lineno = 83;
+L132: /* GGET */
+    tp_aot_op(tp, f, code + 132);
+L136: /* MOVE */
+    regs[5] = regs[2];
+L137: /* CALLP */
+    return code + 137;
+L138: /* LINE */
+    f->line = code + 138;
+    f->lineno = 84;
+L143: /* RETURN */
+    return code + 143;
+L144: /* EOF */
+    return code + 144;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_2659(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 10: goto L10;
+        case 12: goto L12;
+        case 14: goto L14;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 29: goto L29;
+        case 30: goto L30;
+        case 39: goto L39;
+        case 44: goto L44;
+        case 47: goto L47;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 51: goto L51;
+        case 52: goto L52;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 85;
+L10: /* VAR */
+L12: /* VAR */
+L14: /* STRING */
+    tp_aot_op(tp, f, code + 14);
+L23: /* FILE */
+    f->fname = regs[2];
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L29: /* NAME */
+    f->name = regs[2];
+L30: /* LINE */
+    f->line = code + 30;
+    f->lineno = 86;
+L39: /* GGET */
+    tp_aot_op(tp, f, code + 39);
+L44: /* STRING */
+    tp_aot_op(tp, f, code + 44);
+L47: /* MGET */
+    tp_aot_op(tp, f, code + 47);
+L49: /* MOVE */
+    regs[4] = regs[1];
+L50: /* CALLP */
+    return code + 50;
+L51: /* RETURN */
+    return code + 51;
+L52: /* EOF */
+    return code + 52;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_2740(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 22: goto L22;
+        case 23: goto L23;
+        case 28: goto L28;
+        case 29: goto L29;
+        case 35: goto L35;
+        case 39: goto L39;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 51: goto L51;
+        case 53: goto L53;
+        case 56: goto L56;
+        case 59: goto L59;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 82: goto L82;
+        case 86: goto L86;
+        case 90: goto L90;
+        case 91: goto L91;
+        case 96: goto L96;
+        case 99: goto L99;
+        case 100: goto L100;
+        case 101: goto L101;
+        case 102: goto L102;
+        case 109: goto L109;
+        case 113: goto L113;
+        case 116: goto L116;
+        case 119: goto L119;
+        case 122: goto L122;
+        case 123: goto L123;
+        case 124: goto L124;
+        case 125: goto L125;
+        case 130: goto L130;
+        case 134: goto L134;
+        case 135: goto L135;
+        case 136: goto L136;
+        case 141: goto L141;
+        case 142: goto L142;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 88;
+L9: /* VAR */
+L11: /* VAR */
+L13: /* STRING */
+    tp_aot_op(tp, f, code + 13);
+L22: /* FILE */
+    f->fname = regs[2];
+L23: /* STRING */
+    tp_aot_op(tp, f, code + 23);
+L28: /* NAME */
+    f->name = regs[2];
+L29: /* LINE */
+    f->line = code + 29;
+    f->lineno = 90;
+L35: /* GGET */
+    tp_aot_op(tp, f, code + 35);
+L39: /* MOVE */
+    regs[4] = regs[1];
+L40: /* CALLP */
+    return code + 40;
+L41: /* LINE */
+    f->line = code + 41;
+    f->lineno = 91;
+L51: /* VAR */
+L53: /* STRING */
+    tp_aot_op(tp, f, code + 53);
+L56: /* NUMBER */
+    tp_aot_op(tp, f, code + 56);
+L59: /* GGET */
+    tp_aot_op(tp, f, code + 59);
+L62: /* MOVE */
+    regs[8] = regs[0];
+L63: /* CALLP */
+    return code + 63;
+L64: /* NUMBER */
+    tp_aot_op(tp, f, code + 64);
+L67: /* MOD */
+    regs[6] = tp_mod(tp, regs[6], regs[7]);
+L68: /* SUB */
+    if (TP_BOTH(regs[5], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[5].nint - regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 68);
+    }
+L69: /* MUL */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[4] = tp_int(regs[4].nint * regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 69);
+    }
+L70: /* ADD */
+    if (TP_BOTH(regs[0], regs[4], TP_NUMBER_INT)) {
+        regs[2] = tp_int(regs[0].nint + regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 70);
+    }
+L71: /* LINE */
+    f->line = code + 71;
+    f->lineno = 92;
+L82: /* GGET */
+    tp_aot_op(tp, f, code + 82);
+L86: /* GGET */
+    tp_aot_op(tp, f, code + 86);
+L90: /* MOVE */
+    regs[6] = regs[1];
+L91: /* GGET */
+    tp_aot_op(tp, f, code + 91);
+L96: /* STRING */
+    tp_aot_op(tp, f, code + 96);
+L99: /* ADD */
+    if (TP_BOTH(regs[9], regs[0], TP_NUMBER_INT)) {
+        regs[9] = tp_int(regs[9].nint + regs[0].nint);
+    } else {
+        tp_aot_op(tp, f, code + 99);
+    }
+L100: /* CALLP */
+    return code + 100;
+L101: /* CALLP */
+    return code + 101;
+L102: /* LINE */
+    f->line = code + 102;
+    f->lineno = 93;
+L109: /* GGET */
+    tp_aot_op(tp, f, code + 109);
+L113: /* NUMBER */
+    tp_aot_op(tp, f, code + 113);
+L116: /* NUMBER */
+    tp_aot_op(tp, f, code + 116);
+L119: /* GGET */
+    tp_aot_op(tp, f, code + 119);
+L122: /* MOVE */
+    regs[9] = regs[0];
+L123: /* CALLP */
+    return code + 123;
+L124: /* CALLP */
+    return code + 124;
+L125: /* LINE */
+    f->line = code + 125;
+    f->lineno = 94;
+L130: /* GGET */
+    tp_aot_op(tp, f, code + 130);
+L134: /* MOVE */
+    regs[5] = regs[2];
+L135: /* CALLP */
+    return code + 135;
+L136: /* LINE */
+    f->line = code + 136;
+    f->lineno = 95;
+L141: /* RETURN */
+    return code + 141;
+L142: /* EOF */
+    return code + 142;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_2912(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 10: goto L10;
+        case 12: goto L12;
+        case 14: goto L14;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 29: goto L29;
+        case 30: goto L30;
+        case 37: goto L37;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 54: goto L54;
+        case 59: goto L59;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 65: goto L65;
+        case 66: goto L66;
+        case 74: goto L74;
+        case 77: goto L77;
+        case 78: goto L78;
+        case 79: goto L79;
+        case 80: goto L80;
+        case 91: goto L91;
+        case 96: goto L96;
+        case 99: goto L99;
+        case 100: goto L100;
+        case 101: goto L101;
+        case 102: goto L102;
+        case 103: goto L103;
+        case 113: goto L113;
+        case 117: goto L117;
+        case 118: goto L118;
+        case 119: goto L119;
+        case 120: goto L120;
+        case 131: goto L131;
+        case 136: goto L136;
+        case 139: goto L139;
+        case 140: goto L140;
+        case 141: goto L141;
+        case 142: goto L142;
+        case 143: goto L143;
+        case 154: goto L154;
+        case 159: goto L159;
+        case 162: goto L162;
+        case 163: goto L163;
+        case 164: goto L164;
+        case 165: goto L165;
+        case 166: goto L166;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 97;
+L10: /* VAR */
+L12: /* VAR */
+L14: /* STRING */
+    tp_aot_op(tp, f, code + 14);
+L23: /* FILE */
+    f->fname = regs[2];
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L29: /* NAME */
+    f->name = regs[2];
+L30: /* LINE */
+    f->line = code + 30;
+    f->lineno = 98;
+L37: /* NUMBER */
+    tp_aot_op(tp, f, code + 37);
+L40: /* LE */
+    if (TP_BOTH(regs[0], regs[2], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[0].nint <= regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 40);
+    }
+L41: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L43;
+    }
+L42: /* JUMP */
+    goto L66;
+L43: /* LINE */
+    f->line = code + 43;
+    f->lineno = 99;
+L54: /* GGET */
+    tp_aot_op(tp, f, code + 54);
+L59: /* STRING */
+    tp_aot_op(tp, f, code + 59);
+L62: /* MOVE */
+    regs[4] = regs[0];
+L63: /* MOVE */
+    regs[5] = regs[1];
+L64: /* CALLP */
+    return code + 64;
+L65: /* RETURN */
+    return code + 65;
+L66: /* LINE */
+    f->line = code + 66;
+    f->lineno = 100;
+L74: /* NUMBER */
+    tp_aot_op(tp, f, code + 74);
+L77: /* LE */
+    if (TP_BOTH(regs[0], regs[2], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[0].nint <= regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 77);
+    }
+L78: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L80;
+    }
+L79: /* JUMP */
+    goto L103;
+L80: /* LINE */
+    f->line = code + 80;
+    f->lineno = 101;
+L91: /* GGET */
+    tp_aot_op(tp, f, code + 91);
+L96: /* STRING */
+    tp_aot_op(tp, f, code + 96);
+L99: /* MOVE */
+    regs[4] = regs[0];
+L100: /* MOVE */
+    regs[5] = regs[1];
+L101: /* CALLP */
+    return code + 101;
+L102: /* RETURN */
+    return code + 102;
+L103: /* LINE */
+    f->line = code + 103;
+    f->lineno = 102;
+L113: /* NUMBER */
+    tp_aot_op(tp, f, code + 113);
+L117: /* LE */
+    if (TP_BOTH(regs[0], regs[2], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[0].nint <= regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 117);
+    }
+L118: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L120;
+    }
+L119: /* JUMP */
+    goto L143;
+L120: /* LINE */
+    f->line = code + 120;
+    f->lineno = 103;
+L131: /* GGET */
+    tp_aot_op(tp, f, code + 131);
+L136: /* STRING */
+    tp_aot_op(tp, f, code + 136);
+L139: /* MOVE */
+    regs[4] = regs[0];
+L140: /* MOVE */
+    regs[5] = regs[1];
+L141: /* CALLP */
+    return code + 141;
+L142: /* RETURN */
+    return code + 142;
+L143: /* LINE */
+    f->line = code + 143;
+    f->lineno = 105;
+L154: /* GGET */
+    tp_aot_op(tp, f, code + 154);
+L159: /* STRING */
+    tp_aot_op(tp, f, code + 159);
+L162: /* MOVE */
+    regs[4] = regs[0];
+L163: /* MOVE */
+    regs[5] = regs[1];
+L164: /* CALLP */
+    return code + 164;
+L165: /* RETURN */
+    return code + 165;
+L166: /* EOF */
+    return code + 166;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_3114(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 12: goto L12;
+        case 15: goto L15;
+        case 17: goto L17;
+        case 19: goto L19;
+        case 28: goto L28;
+        case 29: goto L29;
+        case 34: goto L34;
+        case 35: goto L35;
+        case 41: goto L41;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 55: goto L55;
+        case 57: goto L57;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 79: goto L79;
+        case 83: goto L83;
+        case 87: goto L87;
+        case 88: goto L88;
+        case 93: goto L93;
+        case 97: goto L97;
+        case 99: goto L99;
+        case 100: goto L100;
+        case 101: goto L101;
+        case 102: goto L102;
+        case 103: goto L103;
+        case 114: goto L114;
+        case 118: goto L118;
+        case 121: goto L121;
+        case 124: goto L124;
+        case 127: goto L127;
+        case 130: goto L130;
+        case 131: goto L131;
+        case 132: goto L132;
+        case 135: goto L135;
+        case 136: goto L136;
+        case 137: goto L137;
+        case 138: goto L138;
+        case 143: goto L143;
+        case 147: goto L147;
+        case 148: goto L148;
+        case 149: goto L149;
+        case 154: goto L154;
+        case 155: goto L155;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 107;
+L12: /* VAR */
+L15: /* VAR */
+L17: /* VAR */
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L28: /* FILE */
+    f->fname = regs[3];
+L29: /* STRING */
+    tp_aot_op(tp, f, code + 29);
+L34: /* NAME */
+    f->name = regs[3];
+L35: /* LINE */
+    f->line = code + 35;
+    f->lineno = 108;
+L41: /* GGET */
+    tp_aot_op(tp, f, code + 41);
+L45: /* MOVE */
+    regs[5] = regs[2];
+L46: /* CALLP */
+    return code + 46;
+L47: /* LINE */
+    f->line = code + 47;
+    f->lineno = 109;
+L55: /* VAR */
+L57: /* GGET */
+    tp_aot_op(tp, f, code + 57);
+L61: /* MOVE */
+    regs[6] = regs[0];
+L62: /* MOVE */
+    regs[7] = regs[1];
+L63: /* CALLP */
+    return code + 63;
+L64: /* LINE */
+    f->line = code + 64;
+    f->lineno = 110;
+L79: /* GGET */
+    tp_aot_op(tp, f, code + 79);
+L83: /* GGET */
+    tp_aot_op(tp, f, code + 83);
+L87: /* MOVE */
+    regs[7] = regs[2];
+L88: /* GGET */
+    tp_aot_op(tp, f, code + 88);
+L93: /* STRING */
+    tp_aot_op(tp, f, code + 93);
+L97: /* METHOD */
+    tp_aot_op(tp, f, code + 97);
+L99: /* CALLM */
+    return code + 99;
+L100: /* ADD */
+    if (TP_BOTH(regs[10], regs[3], TP_NUMBER_INT)) {
+        regs[10] = tp_int(regs[10].nint + regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 100);
+    }
+L101: /* CALLP */
+    return code + 101;
+L102: /* CALLP */
+    return code + 102;
+L103: /* LINE */
+    f->line = code + 103;
+    f->lineno = 111;
+L114: /* GGET */
+    tp_aot_op(tp, f, code + 114);
+L118: /* NUMBER */
+    tp_aot_op(tp, f, code + 118);
+L121: /* NUMBER */
+    tp_aot_op(tp, f, code + 121);
+L124: /* GGET */
+    tp_aot_op(tp, f, code + 124);
+L127: /* NUMBER */
+    tp_aot_op(tp, f, code + 127);
+L130: /* GET */
+    regs[11] = tp_get(tp, regs[0], regs[12]);
+    tp_grey(tp, regs[11]);
+L131: /* CALLP */
+    return code + 131;
+L132: /* GGET */
+    tp_aot_op(tp, f, code + 132);
+L135: /* MOVE */
+    regs[11] = regs[3];
+L136: /* CALLP */
+    return code + 136;
+L137: /* CALLP */
+    return code + 137;
+L138: /* LINE */
+    f->line = code + 138;
+    f->lineno = 112;
+L143: /* GGET */
+    tp_aot_op(tp, f, code + 143);
+L147: /* MOVE */
+    regs[6] = regs[3];
+L148: /* CALLP */
+    return code + 148;
+L149: /* LINE */
+    f->line = code + 149;
+    f->lineno = 113;
+L154: /* RETURN */
+    return code + 154;
+L155: /* EOF */
+    return code + 155;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_3298(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 22: goto L22;
+        case 23: goto L23;
+        case 28: goto L28;
+        case 29: goto L29;
+        case 34: goto L34;
+        case 36: goto L36;
+        case 39: goto L39;
+        case 41: goto L41;
+        case 55: goto L55;
+        case 60: goto L60;
+        case 63: goto L63;
+        case 67: goto L67;
+        case 71: goto L71;
+        case 73: goto L73;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 78: goto L78;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 115;
+L9: /* VAR */
+L11: /* VAR */
+L13: /* STRING */
+    tp_aot_op(tp, f, code + 13);
+L22: /* FILE */
+    f->fname = regs[2];
+L23: /* STRING */
+    tp_aot_op(tp, f, code + 23);
+L28: /* NAME */
+    f->name = regs[2];
+L29: /* LINE */
+    f->line = code + 29;
+    f->lineno = 116;
+L34: /* VAR */
+L36: /* STRING */
+    tp_aot_op(tp, f, code + 36);
+L39: /* MGET */
+    tp_aot_op(tp, f, code + 39);
+L41: /* LINE */
+    f->line = code + 41;
+    f->lineno = 117;
+L55: /* GGET */
+    tp_aot_op(tp, f, code + 55);
+L60: /* STRING */
+    tp_aot_op(tp, f, code + 60);
+L63: /* GGET */
+    tp_aot_op(tp, f, code + 63);
+L67: /* STRING */
+    tp_aot_op(tp, f, code + 67);
+L71: /* METHOD */
+    tp_aot_op(tp, f, code + 71);
+L73: /* CALLM */
+    return code + 73;
+L74: /* CALLP */
+    return code + 74;
+L75: /* MOVE */
+    regs[6] = regs[1];
+L76: /* CALLP */
+    return code + 76;
+L77: /* RETURN */
+    return code + 77;
+L78: /* EOF */
+    return code + 78;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_3406(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 10: goto L10;
+        case 12: goto L12;
+        case 14: goto L14;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 29: goto L29;
+        case 30: goto L30;
+        case 35: goto L35;
+        case 37: goto L37;
+        case 40: goto L40;
+        case 42: goto L42;
+        case 50: goto L50;
+        case 55: goto L55;
+        case 57: goto L57;
+        case 60: goto L60;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 73: goto L73;
+        case 75: goto L75;
+        case 78: goto L78;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 88: goto L88;
+        case 90: goto L90;
+        case 91: goto L91;
+        case 94: goto L94;
+        case 95: goto L95;
+        case 96: goto L96;
+        case 104: goto L104;
+        case 107: goto L107;
+        case 111: goto L111;
+        case 113: goto L113;
+        case 114: goto L114;
+        case 115: goto L115;
+        case 123: goto L123;
+        case 128: goto L128;
+        case 129: goto L129;
+        case 130: goto L130;
+        case 131: goto L131;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 119;
+L10: /* VAR */
+L12: /* VAR */
+L14: /* STRING */
+    tp_aot_op(tp, f, code + 14);
+L23: /* FILE */
+    f->fname = regs[2];
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L29: /* NAME */
+    f->name = regs[2];
+L30: /* LINE */
+    f->line = code + 30;
+    f->lineno = 120;
+L35: /* VAR */
+L37: /* STRING */
+    tp_aot_op(tp, f, code + 37);
+L40: /* MGET */
+    tp_aot_op(tp, f, code + 40);
+L42: /* LINE */
+    f->line = code + 42;
+    f->lineno = 121;
+L50: /* STRING */
+    tp_aot_op(tp, f, code + 50);
+L55: /* METHOD */
+    tp_aot_op(tp, f, code + 55);
+L57: /* STRING */
+    tp_aot_op(tp, f, code + 57);
+L60: /* CALLM */
+    return code + 60;
+L61: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L63;
+    }
+L62: /* JUMP */
+    goto L96;
+L63: /* LINE */
+    f->line = code + 63;
+    f->lineno = 122;
+L73: /* VAR */
+L75: /* GGET */
+    tp_aot_op(tp, f, code + 75);
+L78: /* NUMBER */
+    tp_aot_op(tp, f, code + 78);
+L81: /* NONE */
+    regs[6] = tp_None;
+L82: /* LIST */
+    tp_aot_op(tp, f, code + 82);
+L83: /* GET */
+    regs[2] = tp_get(tp, regs[2], regs[0]);
+    tp_grey(tp, regs[2]);
+L84: /* STRING */
+    tp_aot_op(tp, f, code + 84);
+L88: /* METHOD */
+    tp_aot_op(tp, f, code + 88);
+L90: /* CALLM */
+    return code + 90;
+L91: /* NUMBER */
+    tp_aot_op(tp, f, code + 91);
+L94: /* CALLP */
+    return code + 94;
+L95: /* JUMP */
+    goto L115;
+L96: /* LINE */
+    f->line = code + 96;
+    f->lineno = 124;
+L104: /* GGET */
+    tp_aot_op(tp, f, code + 104);
+L107: /* STRING */
+    tp_aot_op(tp, f, code + 107);
+L111: /* METHOD */
+    tp_aot_op(tp, f, code + 111);
+L113: /* CALLM */
+    return code + 113;
+L114: /* CALLP */
+    return code + 114;
+L115: /* LINE */
+    f->line = code + 115;
+    f->lineno = 125;
+L123: /* GGET */
+    tp_aot_op(tp, f, code + 123);
+L128: /* MOVE */
+    regs[6] = regs[1];
+L129: /* CALLP */
+    return code + 129;
+L130: /* RETURN */
+    return code + 130;
+L131: /* EOF */
+    return code + 131;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_3557(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 11: goto L11;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 33: goto L33;
+        case 35: goto L35;
+        case 38: goto L38;
+        case 41: goto L41;
+        case 45: goto L45;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 54: goto L54;
+        case 57: goto L57;
+        case 60: goto L60;
+        case 64: goto L64;
+        case 66: goto L66;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 80: goto L80;
+        case 81: goto L81;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 127;
+L7: /* VAR */
+L11: /* STRING */
+    tp_aot_op(tp, f, code + 11);
+L20: /* FILE */
+    f->fname = regs[0];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L25: /* NAME */
+    f->name = regs[0];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 128;
+L33: /* VAR */
+L35: /* GGET */
+    tp_aot_op(tp, f, code + 35);
+L38: /* GGET */
+    tp_aot_op(tp, f, code + 38);
+L41: /* STRING */
+    tp_aot_op(tp, f, code + 41);
+L45: /* MGET */
+    tp_aot_op(tp, f, code + 45);
+L47: /* CALLP */
+    return code + 47;
+L48: /* LINE */
+    f->line = code + 48;
+    f->lineno = 129;
+L54: /* GGET */
+    tp_aot_op(tp, f, code + 54);
+L57: /* GGET */
+    tp_aot_op(tp, f, code + 57);
+L60: /* STRING */
+    tp_aot_op(tp, f, code + 60);
+L64: /* MGET */
+    tp_aot_op(tp, f, code + 64);
+L66: /* NUMBER */
+    tp_aot_op(tp, f, code + 66);
+L69: /* ADD */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 69);
+    }
+L70: /* STRING */
+    tp_aot_op(tp, f, code + 70);
+L74: /* SET */
+    tp_set(tp, regs[3], regs[2], regs[1]);
+L75: /* LINE */
+    f->line = code + 75;
+    f->lineno = 130;
+L80: /* RETURN */
+    return code + 80;
+L81: /* EOF */
+    return code + 81;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_3658(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 34: goto L34;
+        case 36: goto L36;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 48: goto L48;
+        case 51: goto L51;
+        case 55: goto L55;
+        case 57: goto L57;
+        case 61: goto L61;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 65: goto L65;
+        case 70: goto L70;
+        case 71: goto L71;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 131;
+L8: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[0];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L27: /* NAME */
+    f->name = regs[0];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 132;
+L34: /* VAR */
+L36: /* GGET */
+    tp_aot_op(tp, f, code + 36);
+L40: /* CALLP */
+    return code + 40;
+L41: /* LINE */
+    f->line = code + 41;
+    f->lineno = 133;
+L48: /* GGET */
+    tp_aot_op(tp, f, code + 48);
+L51: /* STRING */
+    tp_aot_op(tp, f, code + 51);
+L55: /* MGET */
+    tp_aot_op(tp, f, code + 55);
+L57: /* STRING */
+    tp_aot_op(tp, f, code + 57);
+L61: /* METHOD */
+    tp_aot_op(tp, f, code + 61);
+L63: /* MOVE */
+    regs[3] = regs[0];
+L64: /* CALLM */
+    return code + 64;
+L65: /* LINE */
+    f->line = code + 65;
+    f->lineno = 134;
+L70: /* RETURN */
+    return code + 70;
+L71: /* EOF */
+    return code + 71;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_3749(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 11: goto L11;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 32: goto L32;
+        case 35: goto L35;
+        case 39: goto L39;
+        case 41: goto L41;
+        case 44: goto L44;
+        case 46: goto L46;
+        case 47: goto L47;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 135;
+L7: /* VAR */
+L11: /* STRING */
+    tp_aot_op(tp, f, code + 11);
+L20: /* FILE */
+    f->fname = regs[1];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 136;
+L32: /* GGET */
+    tp_aot_op(tp, f, code + 32);
+L35: /* STRING */
+    tp_aot_op(tp, f, code + 35);
+L39: /* MGET */
+    tp_aot_op(tp, f, code + 39);
+L41: /* STRING */
+    tp_aot_op(tp, f, code + 41);
+L44: /* METHOD */
+    tp_aot_op(tp, f, code + 44);
+L46: /* CALLM */
+    return code + 46;
+L47: /* EOF */
+    return code + 47;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_3817(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 22: goto L22;
+        case 23: goto L23;
+        case 37: goto L37;
+        case 40: goto L40;
+        case 44: goto L44;
+        case 46: goto L46;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 53: goto L53;
+        case 57: goto L57;
+        case 59: goto L59;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 66: goto L66;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 70: goto L70;
+        case 73: goto L73;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 78: goto L78;
+        case 79: goto L79;
+        case 80: goto L80;
+        case 87: goto L87;
+        case 91: goto L91;
+        case 94: goto L94;
+        case 95: goto L95;
+        case 96: goto L96;
+        case 97: goto L97;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 138;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L22: /* NAME */
+    f->name = regs[1];
+L23: /* LINE */
+    f->line = code + 23;
+    f->lineno = 139;
+L37: /* GGET */
+    tp_aot_op(tp, f, code + 37);
+L40: /* STRING */
+    tp_aot_op(tp, f, code + 40);
+L44: /* MGET */
+    tp_aot_op(tp, f, code + 44);
+L46: /* STRING */
+    tp_aot_op(tp, f, code + 46);
+L49: /* ADD */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 49);
+    }
+L50: /* STRING */
+    tp_aot_op(tp, f, code + 50);
+L53: /* STRING */
+    tp_aot_op(tp, f, code + 53);
+L57: /* METHOD */
+    tp_aot_op(tp, f, code + 57);
+L59: /* VAR */
+L62: /* LIST */
+    tp_aot_op(tp, f, code + 62);
+L63: /* NUMBER */
+    tp_aot_op(tp, f, code + 63);
+L66: /* ITER */
+    if (tp_iter_next(tp, &regs[2], regs[0], &regs[6])) {
+        goto L68;
+    }
+L67: /* JUMP */
+    goto L78;
+L68: /* VAR */
+L70: /* GGET */
+    tp_aot_op(tp, f, code + 70);
+L73: /* MOVE */
+    regs[8] = regs[2];
+L74: /* CALLP */
+    return code + 74;
+L75: /* NONE */
+    regs[7] = tp_None;
+L76: /* SET */
+    tp_set(tp, regs[5], regs[7], regs[2]);
+L77: /* JUMP */
+    tp_aot_safepoint(tp, 11);
+    goto L66;
+L78: /* CALLM */
+    return code + 78;
+L79: /* ADD */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[0] = tp_int(regs[1].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 79);
+    }
+L80: /* LINE */
+    f->line = code + 80;
+    f->lineno = 140;
+L87: /* GGET */
+    tp_aot_op(tp, f, code + 87);
+L91: /* STRING */
+    tp_aot_op(tp, f, code + 91);
+L94: /* MOVE */
+    regs[5] = regs[0];
+L95: /* LIST */
+    tp_aot_op(tp, f, code + 95);
+L96: /* CALLP */
+    return code + 96;
+L97: /* EOF */
+    return code + 97;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_3934(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 38: goto L38;
+        case 41: goto L41;
+        case 45: goto L45;
+        case 47: goto L47;
+        case 50: goto L50;
+        case 51: goto L51;
+        case 54: goto L54;
+        case 58: goto L58;
+        case 60: goto L60;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 71: goto L71;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 78: goto L78;
+        case 79: goto L79;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 88: goto L88;
+        case 92: goto L92;
+        case 96: goto L96;
+        case 97: goto L97;
+        case 98: goto L98;
+        case 99: goto L99;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 141;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 142;
+L38: /* GGET */
+    tp_aot_op(tp, f, code + 38);
+L41: /* STRING */
+    tp_aot_op(tp, f, code + 41);
+L45: /* MGET */
+    tp_aot_op(tp, f, code + 45);
+L47: /* STRING */
+    tp_aot_op(tp, f, code + 47);
+L50: /* ADD */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 50);
+    }
+L51: /* STRING */
+    tp_aot_op(tp, f, code + 51);
+L54: /* STRING */
+    tp_aot_op(tp, f, code + 54);
+L58: /* METHOD */
+    tp_aot_op(tp, f, code + 58);
+L60: /* VAR */
+L63: /* LIST */
+    tp_aot_op(tp, f, code + 63);
+L64: /* NUMBER */
+    tp_aot_op(tp, f, code + 64);
+L67: /* ITER */
+    if (tp_iter_next(tp, &regs[2], regs[0], &regs[6])) {
+        goto L69;
+    }
+L68: /* JUMP */
+    goto L79;
+L69: /* VAR */
+L71: /* GGET */
+    tp_aot_op(tp, f, code + 71);
+L74: /* MOVE */
+    regs[8] = regs[2];
+L75: /* CALLP */
+    return code + 75;
+L76: /* NONE */
+    regs[7] = tp_None;
+L77: /* SET */
+    tp_set(tp, regs[5], regs[7], regs[2]);
+L78: /* JUMP */
+    tp_aot_safepoint(tp, 11);
+    goto L67;
+L79: /* CALLM */
+    return code + 79;
+L80: /* ADD */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[0] = tp_int(regs[1].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 80);
+    }
+L81: /* LINE */
+    f->line = code + 81;
+    f->lineno = 143;
+L88: /* GGET */
+    tp_aot_op(tp, f, code + 88);
+L92: /* STRING */
+    tp_aot_op(tp, f, code + 92);
+L96: /* MOVE */
+    regs[5] = regs[0];
+L97: /* LIST */
+    tp_aot_op(tp, f, code + 97);
+L98: /* CALLP */
+    return code + 98;
+L99: /* EOF */
+    return code + 99;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_4054(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 38: goto L38;
+        case 41: goto L41;
+        case 45: goto L45;
+        case 47: goto L47;
+        case 50: goto L50;
+        case 51: goto L51;
+        case 54: goto L54;
+        case 58: goto L58;
+        case 60: goto L60;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 71: goto L71;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 78: goto L78;
+        case 79: goto L79;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 89: goto L89;
+        case 93: goto L93;
+        case 97: goto L97;
+        case 98: goto L98;
+        case 99: goto L99;
+        case 100: goto L100;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 144;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 145;
+L38: /* GGET */
+    tp_aot_op(tp, f, code + 38);
+L41: /* STRING */
+    tp_aot_op(tp, f, code + 41);
+L45: /* MGET */
+    tp_aot_op(tp, f, code + 45);
+L47: /* STRING */
+    tp_aot_op(tp, f, code + 47);
+L50: /* ADD */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 50);
+    }
+L51: /* STRING */
+    tp_aot_op(tp, f, code + 51);
+L54: /* STRING */
+    tp_aot_op(tp, f, code + 54);
+L58: /* METHOD */
+    tp_aot_op(tp, f, code + 58);
+L60: /* VAR */
+L63: /* LIST */
+    tp_aot_op(tp, f, code + 63);
+L64: /* NUMBER */
+    tp_aot_op(tp, f, code + 64);
+L67: /* ITER */
+    if (tp_iter_next(tp, &regs[2], regs[0], &regs[6])) {
+        goto L69;
+    }
+L68: /* JUMP */
+    goto L79;
+L69: /* VAR */
+L71: /* GGET */
+    tp_aot_op(tp, f, code + 71);
+L74: /* MOVE */
+    regs[8] = regs[2];
+L75: /* CALLP */
+    return code + 75;
+L76: /* NONE */
+    regs[7] = tp_None;
+L77: /* SET */
+    tp_set(tp, regs[5], regs[7], regs[2]);
+L78: /* JUMP */
+    tp_aot_safepoint(tp, 11);
+    goto L67;
+L79: /* CALLM */
+    return code + 79;
+L80: /* ADD */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[0] = tp_int(regs[1].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 80);
+    }
+L81: /* LINE */
+    f->line = code + 81;
+    f->lineno = 146;
+L89: /* GGET */
+    tp_aot_op(tp, f, code + 89);
+L93: /* STRING */
+    tp_aot_op(tp, f, code + 93);
+L97: /* MOVE */
+    regs[5] = regs[0];
+L98: /* LIST */
+    tp_aot_op(tp, f, code + 98);
+L99: /* CALLP */
+    return code + 99;
+L100: /* EOF */
+    return code + 100;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_4187(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 16: goto L16;
+        case 18: goto L18;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 32: goto L32;
+        case 33: goto L33;
+        case 42: goto L42;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 51: goto L51;
+        case 53: goto L53;
+        case 56: goto L56;
+        case 57: goto L57;
+        case 59: goto L59;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 65: goto L65;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 71: goto L71;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 86: goto L86;
+        case 89: goto L89;
+        case 93: goto L93;
+        case 96: goto L96;
+        case 98: goto L98;
+        case 102: goto L102;
+        case 105: goto L105;
+        case 118: goto L118;
+        case 128: goto L128;
+        case 131: goto L131;
+        case 132: goto L132;
+        case 135: goto L135;
+        case 136: goto L136;
+        case 137: goto L137;
+        case 139: goto L139;
+        case 140: goto L140;
+        case 145: goto L145;
+        case 147: goto L147;
+        case 148: goto L148;
+        case 149: goto L149;
+        case 150: goto L150;
+        case 151: goto L151;
+        case 164: goto L164;
+        case 167: goto L167;
+        case 168: goto L168;
+        case 171: goto L171;
+        case 172: goto L172;
+        case 173: goto L173;
+        case 174: goto L174;
+        case 178: goto L178;
+        case 180: goto L180;
+        case 183: goto L183;
+        case 184: goto L184;
+        case 189: goto L189;
+        case 191: goto L191;
+        case 192: goto L192;
+        case 193: goto L193;
+        case 194: goto L194;
+        case 195: goto L195;
+        case 196: goto L196;
+        case 197: goto L197;
+        case 215: goto L215;
+        case 219: goto L219;
+        case 223: goto L223;
+        case 226: goto L226;
+        case 228: goto L228;
+        case 232: goto L232;
+        case 235: goto L235;
+        case 238: goto L238;
+        case 239: goto L239;
+        case 242: goto L242;
+        case 243: goto L243;
+        case 244: goto L244;
+        case 245: goto L245;
+        case 249: goto L249;
+        case 251: goto L251;
+        case 254: goto L254;
+        case 255: goto L255;
+        case 256: goto L256;
+        case 257: goto L257;
+        case 258: goto L258;
+        case 259: goto L259;
+        case 260: goto L260;
+        case 275: goto L275;
+        case 280: goto L280;
+        case 283: goto L283;
+        case 284: goto L284;
+        case 287: goto L287;
+        case 289: goto L289;
+        case 292: goto L292;
+        case 293: goto L293;
+        case 296: goto L296;
+        case 299: goto L299;
+        case 300: goto L300;
+        case 304: goto L304;
+        case 307: goto L307;
+        case 308: goto L308;
+        case 312: goto L312;
+        case 315: goto L315;
+        case 316: goto L316;
+        case 319: goto L319;
+        case 322: goto L322;
+        case 323: goto L323;
+        case 328: goto L328;
+        case 332: goto L332;
+        case 333: goto L333;
+        case 334: goto L334;
+        case 342: goto L342;
+        case 346: goto L346;
+        case 347: goto L347;
+        case 348: goto L348;
+        case 349: goto L349;
+        case 359: goto L359;
+        case 363: goto L363;
+        case 364: goto L364;
+        case 365: goto L365;
+        case 366: goto L366;
+        case 372: goto L372;
+        case 373: goto L373;
+        case 374: goto L374;
+        case 375: goto L375;
+        case 376: goto L376;
+        case 390: goto L390;
+        case 395: goto L395;
+        case 399: goto L399;
+        case 401: goto L401;
+        case 404: goto L404;
+        case 405: goto L405;
+        case 410: goto L410;
+        case 412: goto L412;
+        case 413: goto L413;
+        case 414: goto L414;
+        case 415: goto L415;
+        case 416: goto L416;
+        case 424: goto L424;
+        case 429: goto L429;
+        case 430: goto L430;
+        case 431: goto L431;
+        case 437: goto L437;
+        case 438: goto L438;
+        case 439: goto L439;
+        case 440: goto L440;
+        case 441: goto L441;
+        case 455: goto L455;
+        case 460: goto L460;
+        case 464: goto L464;
+        case 466: goto L466;
+        case 469: goto L469;
+        case 470: goto L470;
+        case 475: goto L475;
+        case 477: goto L477;
+        case 478: goto L478;
+        case 479: goto L479;
+        case 480: goto L480;
+        case 481: goto L481;
+        case 489: goto L489;
+        case 494: goto L494;
+        case 495: goto L495;
+        case 496: goto L496;
+        case 504: goto L504;
+        case 506: goto L506;
+        case 510: goto L510;
+        case 511: goto L511;
+        case 512: goto L512;
+        case 513: goto L513;
+        case 527: goto L527;
+        case 530: goto L530;
+        case 534: goto L534;
+        case 536: goto L536;
+        case 539: goto L539;
+        case 540: goto L540;
+        case 543: goto L543;
+        case 547: goto L547;
+        case 549: goto L549;
+        case 552: goto L552;
+        case 553: goto L553;
+        case 556: goto L556;
+        case 557: goto L557;
+        case 558: goto L558;
+        case 560: goto L560;
+        case 563: goto L563;
+        case 564: goto L564;
+        case 565: goto L565;
+        case 566: goto L566;
+        case 567: goto L567;
+        case 568: goto L568;
+        case 569: goto L569;
+        case 570: goto L570;
+        case 571: goto L571;
+        case 579: goto L579;
+        case 583: goto L583;
+        case 586: goto L586;
+        case 587: goto L587;
+        case 588: goto L588;
+        case 589: goto L589;
+        case 603: goto L603;
+        case 608: goto L608;
+        case 609: goto L609;
+        case 610: goto L610;
+        case 611: goto L611;
+        case 612: goto L612;
+        case 613: goto L613;
+        case 614: goto L614;
+        case 620: goto L620;
+        case 621: goto L621;
+        case 624: goto L624;
+        case 625: goto L625;
+        case 626: goto L626;
+        case 627: goto L627;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 147;
+L11: /* VAR */
+L13: /* VAR */
+L16: /* VAR */
+L18: /* STRING */
+    tp_aot_op(tp, f, code + 18);
+L27: /* FILE */
+    f->fname = regs[3];
+L28: /* STRING */
+    tp_aot_op(tp, f, code + 28);
+L32: /* NAME */
+    f->name = regs[3];
+L33: /* LINE */
+    f->line = code + 33;
+    f->lineno = 148;
+L42: /* GGET */
+    tp_aot_op(tp, f, code + 42);
+L47: /* MOVE */
+    regs[5] = regs[1];
+L48: /* CALLP */
+    return code + 48;
+L49: /* VAR */
+L51: /* VAR */
+L53: /* NUMBER */
+    tp_aot_op(tp, f, code + 53);
+L56: /* GET */
+    regs[4] = tp_get(tp, regs[3], regs[1]);
+    tp_grey(tp, regs[4]);
+L57: /* VAR */
+L59: /* NUMBER */
+    tp_aot_op(tp, f, code + 59);
+L62: /* GET */
+    regs[5] = tp_get(tp, regs[3], regs[6]);
+    tp_grey(tp, regs[5]);
+L63: /* VAR */
+L65: /* NUMBER */
+    tp_aot_op(tp, f, code + 65);
+L68: /* GET */
+    regs[1] = tp_get(tp, regs[3], regs[7]);
+    tp_grey(tp, regs[1]);
+L69: /* VAR */
+L71: /* NUMBER */
+    tp_aot_op(tp, f, code + 71);
+L74: /* GET */
+    regs[6] = tp_get(tp, regs[3], regs[8]);
+    tp_grey(tp, regs[6]);
+L75: /* LINE */
+    f->line = code + 75;
+    f->lineno = 150;
+L86: /* VAR */
+L89: /* GGET */
+    tp_aot_op(tp, f, code + 89);
+L93: /* STRING */
+    tp_aot_op(tp, f, code + 93);
+L96: /* MGET */
+    tp_aot_op(tp, f, code + 96);
+L98: /* STRING */
+    tp_aot_op(tp, f, code + 98);
+L102: /* NUMBER */
+    tp_aot_op(tp, f, code + 102);
+L105: /* LINE */
+    f->line = code + 105;
+    f->lineno = 152;
+L118: /* LINE */
+    f->line = code + 118;
+    f->lineno = 151;
+L128: /* VAR */
+L131: /* LIST */
+    tp_aot_op(tp, f, code + 131);
+L132: /* NUMBER */
+    tp_aot_op(tp, f, code + 132);
+L135: /* ITER */
+    if (tp_iter_next(tp, &regs[17], regs[4], &regs[13])) {
+        goto L137;
+    }
+L136: /* JUMP */
+    goto L151;
+L137: /* VAR */
+L139: /* MOVE */
+    regs[7] = regs[17];
+L140: /* STRING */
+    tp_aot_op(tp, f, code + 140);
+L145: /* METHOD */
+    tp_aot_op(tp, f, code + 145);
+L147: /* CALLM */
+    return code + 147;
+L148: /* NONE */
+    regs[18] = tp_None;
+L149: /* SET */
+    tp_set(tp, regs[3], regs[18], regs[17]);
+L150: /* JUMP */
+    tp_aot_safepoint(tp, 15);
+    goto L135;
+L151: /* LINE */
+    f->line = code + 151;
+    f->lineno = 152;
+L164: /* VAR */
+L167: /* LIST */
+    tp_aot_op(tp, f, code + 167);
+L168: /* NUMBER */
+    tp_aot_op(tp, f, code + 168);
+L171: /* ITER */
+    if (tp_iter_next(tp, &regs[13], regs[5], &regs[18])) {
+        goto L173;
+    }
+L172: /* JUMP */
+    goto L195;
+L173: /* MOVE */
+    regs[7] = regs[13];
+L174: /* STRING */
+    tp_aot_op(tp, f, code + 174);
+L178: /* MGET */
+    tp_aot_op(tp, f, code + 178);
+L180: /* NUMBER */
+    tp_aot_op(tp, f, code + 180);
+L183: /* GET */
+    regs[21] = tp_get(tp, regs[21], regs[22]);
+    tp_grey(tp, regs[21]);
+L184: /* STRING */
+    tp_aot_op(tp, f, code + 184);
+L189: /* METHOD */
+    tp_aot_op(tp, f, code + 189);
+L191: /* CALLM */
+    return code + 191;
+L192: /* NONE */
+    regs[19] = tp_None;
+L193: /* SET */
+    tp_set(tp, regs[17], regs[19], regs[13]);
+L194: /* JUMP */
+    tp_aot_safepoint(tp, 23);
+    goto L171;
+L195: /* ADD */
+    if (TP_BOTH(regs[3], regs[17], TP_NUMBER_INT)) {
+        regs[12] = tp_int(regs[3].nint + regs[17].nint);
+    } else {
+        tp_aot_op(tp, f, code + 195);
+    }
+L196: /* CALLP */
+    return code + 196;
+L197: /* LINE */
+    f->line = code + 197;
+    f->lineno = 155;
+L215: /* VAR */
+L219: /* GGET */
+    tp_aot_op(tp, f, code + 219);
+L223: /* STRING */
+    tp_aot_op(tp, f, code + 223);
+L226: /* MGET */
+    tp_aot_op(tp, f, code + 226);
+L228: /* STRING */
+    tp_aot_op(tp, f, code + 228);
+L232: /* NUMBER */
+    tp_aot_op(tp, f, code + 232);
+L235: /* VAR */
+L238: /* LIST */
+    tp_aot_op(tp, f, code + 238);
+L239: /* NUMBER */
+    tp_aot_op(tp, f, code + 239);
+L242: /* ITER */
+    if (tp_iter_next(tp, &regs[10], regs[5], &regs[11])) {
+        goto L244;
+    }
+L243: /* JUMP */
+    goto L258;
+L244: /* MOVE */
+    regs[7] = regs[10];
+L245: /* STRING */
+    tp_aot_op(tp, f, code + 245);
+L249: /* MGET */
+    tp_aot_op(tp, f, code + 249);
+L251: /* NUMBER */
+    tp_aot_op(tp, f, code + 251);
+L254: /* GET */
+    regs[10] = tp_get(tp, regs[10], regs[12]);
+    tp_grey(tp, regs[10]);
+L255: /* NONE */
+    regs[12] = tp_None;
+L256: /* SET */
+    tp_set(tp, regs[9], regs[12], regs[10]);
+L257: /* JUMP */
+    tp_aot_safepoint(tp, 15);
+    goto L242;
+L258: /* MOVE */
+    regs[22] = regs[9];
+L259: /* CALLP */
+    return code + 259;
+L260: /* LINE */
+    f->line = code + 260;
+    f->lineno = 158;
+L275: /* GGET */
+    tp_aot_op(tp, f, code + 275);
+L280: /* NUMBER */
+    tp_aot_op(tp, f, code + 280);
+L283: /* CALLP */
+    return code + 283;
+L284: /* VAR */
+L287: /* VAR */
+L289: /* NUMBER */
+    tp_aot_op(tp, f, code + 289);
+L292: /* GET */
+    regs[10] = tp_get(tp, regs[8], regs[12]);
+    tp_grey(tp, regs[10]);
+L293: /* VAR */
+L296: /* NUMBER */
+    tp_aot_op(tp, f, code + 296);
+L299: /* GET */
+    regs[11] = tp_get(tp, regs[8], regs[13]);
+    tp_grey(tp, regs[11]);
+L300: /* VAR */
+L304: /* NUMBER */
+    tp_aot_op(tp, f, code + 304);
+L307: /* GET */
+    regs[12] = tp_get(tp, regs[8], regs[18]);
+    tp_grey(tp, regs[12]);
+L308: /* VAR */
+L312: /* NUMBER */
+    tp_aot_op(tp, f, code + 312);
+L315: /* GET */
+    regs[13] = tp_get(tp, regs[8], regs[19]);
+    tp_grey(tp, regs[13]);
+L316: /* VAR */
+L319: /* NUMBER */
+    tp_aot_op(tp, f, code + 319);
+L322: /* GET */
+    regs[18] = tp_get(tp, regs[8], regs[20]);
+    tp_grey(tp, regs[18]);
+L323: /* LINE */
+    f->line = code + 323;
+    f->lineno = 159;
+L328: /* GGET */
+    tp_aot_op(tp, f, code + 328);
+L332: /* MOVE */
+    regs[20] = regs[10];
+L333: /* CALLP */
+    return code + 333;
+L334: /* LINE */
+    f->line = code + 334;
+    f->lineno = 160;
+L342: /* GGET */
+    tp_aot_op(tp, f, code + 342);
+L346: /* MOVE */
+    regs[20] = regs[3];
+L347: /* MOVE */
+    regs[21] = regs[11];
+L348: /* CALLP */
+    return code + 348;
+L349: /* LINE */
+    f->line = code + 349;
+    f->lineno = 161;
+L359: /* GGET */
+    tp_aot_op(tp, f, code + 359);
+L363: /* MOVE */
+    regs[20] = regs[7];
+L364: /* MOVE */
+    regs[21] = regs[12];
+L365: /* CALLP */
+    return code + 365;
+L366: /* LINE */
+    f->line = code + 366;
+    f->lineno = 162;
+L372: /* NONE */
+    regs[19] = tp_None;
+L373: /* NE */
+    if (TP_BOTH(regs[1], regs[19], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[1].nint != regs[19].nint);
+    } else {
+        tp_aot_op(tp, f, code + 373);
+    }
+L374: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L376;
+    }
+L375: /* JUMP */
+    goto L416;
+L376: /* LINE */
+    f->line = code + 376;
+    f->lineno = 163;
+L390: /* GGET */
+    tp_aot_op(tp, f, code + 390);
+L395: /* STRING */
+    tp_aot_op(tp, f, code + 395);
+L399: /* MGET */
+    tp_aot_op(tp, f, code + 399);
+L401: /* NUMBER */
+    tp_aot_op(tp, f, code + 401);
+L404: /* GET */
+    regs[1] = tp_get(tp, regs[1], regs[0]);
+    tp_grey(tp, regs[1]);
+L405: /* STRING */
+    tp_aot_op(tp, f, code + 405);
+L410: /* METHOD */
+    tp_aot_op(tp, f, code + 410);
+L412: /* CALLM */
+    return code + 412;
+L413: /* MOVE */
+    regs[21] = regs[13];
+L414: /* CALLP */
+    return code + 414;
+L415: /* JUMP */
+    goto L431;
+L416: /* LINE */
+    f->line = code + 416;
+    f->lineno = 165;
+L424: /* GGET */
+    tp_aot_op(tp, f, code + 424);
+L429: /* MOVE */
+    regs[20] = regs[13];
+L430: /* CALLP */
+    return code + 430;
+L431: /* LINE */
+    f->line = code + 431;
+    f->lineno = 166;
+L437: /* NONE */
+    regs[19] = tp_None;
+L438: /* NE */
+    if (TP_BOTH(regs[6], regs[19], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[6].nint != regs[19].nint);
+    } else {
+        tp_aot_op(tp, f, code + 438);
+    }
+L439: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L441;
+    }
+L440: /* JUMP */
+    goto L481;
+L441: /* LINE */
+    f->line = code + 441;
+    f->lineno = 167;
+L455: /* GGET */
+    tp_aot_op(tp, f, code + 455);
+L460: /* STRING */
+    tp_aot_op(tp, f, code + 460);
+L464: /* MGET */
+    tp_aot_op(tp, f, code + 464);
+L466: /* NUMBER */
+    tp_aot_op(tp, f, code + 466);
+L469: /* GET */
+    regs[1] = tp_get(tp, regs[1], regs[0]);
+    tp_grey(tp, regs[1]);
+L470: /* STRING */
+    tp_aot_op(tp, f, code + 470);
+L475: /* METHOD */
+    tp_aot_op(tp, f, code + 475);
+L477: /* CALLM */
+    return code + 477;
+L478: /* MOVE */
+    regs[21] = regs[18];
+L479: /* CALLP */
+    return code + 479;
+L480: /* JUMP */
+    goto L496;
+L481: /* LINE */
+    f->line = code + 481;
+    f->lineno = 169;
+L489: /* GGET */
+    tp_aot_op(tp, f, code + 489);
+L494: /* MOVE */
+    regs[20] = regs[18];
+L495: /* CALLP */
+    return code + 495;
+L496: /* LINE */
+    f->line = code + 496;
+    f->lineno = 171;
+L504: /* VAR */
+L506: /* GGET */
+    tp_aot_op(tp, f, code + 506);
+L510: /* CALLP */
+    return code + 510;
+L511: /* MOVE */
+    regs[21] = regs[2];
+L512: /* LIST */
+    tp_aot_op(tp, f, code + 512);
+L513: /* LINE */
+    f->line = code + 513;
+    f->lineno = 172;
+L527: /* GGET */
+    tp_aot_op(tp, f, code + 527);
+L530: /* STRING */
+    tp_aot_op(tp, f, code + 530);
+L534: /* MGET */
+    tp_aot_op(tp, f, code + 534);
+L536: /* STRING */
+    tp_aot_op(tp, f, code + 536);
+L539: /* ADD */
+    if (TP_BOTH(regs[19], regs[20], TP_NUMBER_INT)) {
+        regs[19] = tp_int(regs[19].nint + regs[20].nint);
+    } else {
+        tp_aot_op(tp, f, code + 539);
+    }
+L540: /* STRING */
+    tp_aot_op(tp, f, code + 540);
+L543: /* STRING */
+    tp_aot_op(tp, f, code + 543);
+L547: /* METHOD */
+    tp_aot_op(tp, f, code + 547);
+L549: /* VAR */
+L552: /* LIST */
+    tp_aot_op(tp, f, code + 552);
+L553: /* NUMBER */
+    tp_aot_op(tp, f, code + 553);
+L556: /* ITER */
+    if (tp_iter_next(tp, &regs[0], regs[8], &regs[2])) {
+        goto L558;
+    }
+L557: /* JUMP */
+    goto L568;
+L558: /* VAR */
+L560: /* GGET */
+    tp_aot_op(tp, f, code + 560);
+L563: /* MOVE */
+    regs[4] = regs[0];
+L564: /* CALLP */
+    return code + 564;
+L565: /* NONE */
+    regs[3] = tp_None;
+L566: /* SET */
+    tp_set(tp, regs[1], regs[3], regs[0]);
+L567: /* JUMP */
+    tp_aot_safepoint(tp, 11);
+    goto L556;
+L568: /* MOVE */
+    regs[23] = regs[1];
+L569: /* CALLM */
+    return code + 569;
+L570: /* ADD */
+    if (TP_BOTH(regs[19], regs[20], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[19].nint + regs[20].nint);
+    } else {
+        tp_aot_op(tp, f, code + 570);
+    }
+L571: /* LINE */
+    f->line = code + 571;
+    f->lineno = 174;
+L579: /* GGET */
+    tp_aot_op(tp, f, code + 579);
+L583: /* STRING */
+    tp_aot_op(tp, f, code + 583);
+L586: /* MOVE */
+    regs[4] = regs[10];
+L587: /* LIST */
+    tp_aot_op(tp, f, code + 587);
+L588: /* CALLP */
+    return code + 588;
+L589: /* LINE */
+    f->line = code + 589;
+    f->lineno = 175;
+L603: /* GGET */
+    tp_aot_op(tp, f, code + 603);
+L608: /* MOVE */
+    regs[3] = regs[11];
+L609: /* MOVE */
+    regs[4] = regs[12];
+L610: /* MOVE */
+    regs[5] = regs[13];
+L611: /* MOVE */
+    regs[6] = regs[18];
+L612: /* LIST */
+    tp_aot_op(tp, f, code + 612);
+L613: /* CALLP */
+    return code + 613;
+L614: /* LINE */
+    f->line = code + 614;
+    f->lineno = 176;
+L620: /* MOVE */
+    regs[20] = regs[10];
+L621: /* NUMBER */
+    tp_aot_op(tp, f, code + 621);
+L624: /* GET */
+    regs[21] = tp_get(tp, regs[8], regs[22]);
+    tp_grey(tp, regs[21]);
+L625: /* LIST */
+    tp_aot_op(tp, f, code + 625);
+L626: /* RETURN */
+    return code + 626;
+L627: /* EOF */
+    return code + 627;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_4833(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 11: goto L11;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 26: goto L26;
+        case 27: goto L27;
+        case 32: goto L32;
+        case 35: goto L35;
+        case 36: goto L36;
+        case 41: goto L41;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 48: goto L48;
+        case 50: goto L50;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 61: goto L61;
+        case 64: goto L64;
+        case 67: goto L67;
+        case 69: goto L69;
+        case 72: goto L72;
+        case 73: goto L73;
+        case 74: goto L74;
+        case 77: goto L77;
+        case 78: goto L78;
+        case 87: goto L87;
+        case 90: goto L90;
+        case 91: goto L91;
+        case 94: goto L94;
+        case 95: goto L95;
+        case 96: goto L96;
+        case 97: goto L97;
+        case 106: goto L106;
+        case 109: goto L109;
+        case 110: goto L110;
+        case 111: goto L111;
+        case 118: goto L118;
+        case 119: goto L119;
+        case 128: goto L128;
+        case 131: goto L131;
+        case 132: goto L132;
+        case 136: goto L136;
+        case 137: goto L137;
+        case 138: goto L138;
+        case 139: goto L139;
+        case 155: goto L155;
+        case 159: goto L159;
+        case 161: goto L161;
+        case 166: goto L166;
+        case 170: goto L170;
+        case 173: goto L173;
+        case 174: goto L174;
+        case 177: goto L177;
+        case 178: goto L178;
+        case 179: goto L179;
+        case 180: goto L180;
+        case 193: goto L193;
+        case 197: goto L197;
+        case 199: goto L199;
+        case 204: goto L204;
+        case 207: goto L207;
+        case 210: goto L210;
+        case 213: goto L213;
+        case 214: goto L214;
+        case 215: goto L215;
+        case 216: goto L216;
+        case 222: goto L222;
+        case 225: goto L225;
+        case 226: goto L226;
+        case 227: goto L227;
+        case 234: goto L234;
+        case 235: goto L235;
+        case 243: goto L243;
+        case 247: goto L247;
+        case 249: goto L249;
+        case 250: goto L250;
+        case 251: goto L251;
+        case 256: goto L256;
+        case 259: goto L259;
+        case 260: goto L260;
+        case 261: goto L261;
+        case 262: goto L262;
+        case 271: goto L271;
+        case 275: goto L275;
+        case 278: goto L278;
+        case 281: goto L281;
+        case 282: goto L282;
+        case 283: goto L283;
+        case 284: goto L284;
+        case 285: goto L285;
+        case 286: goto L286;
+        case 287: goto L287;
+        case 294: goto L294;
+        case 295: goto L295;
+        case 304: goto L304;
+        case 307: goto L307;
+        case 308: goto L308;
+        case 312: goto L312;
+        case 313: goto L313;
+        case 314: goto L314;
+        case 315: goto L315;
+        case 330: goto L330;
+        case 335: goto L335;
+        case 339: goto L339;
+        case 342: goto L342;
+        case 345: goto L345;
+        case 346: goto L346;
+        case 347: goto L347;
+        case 348: goto L348;
+        case 349: goto L349;
+        case 350: goto L350;
+        case 351: goto L351;
+        case 361: goto L361;
+        case 364: goto L364;
+        case 365: goto L365;
+        case 369: goto L369;
+        case 370: goto L370;
+        case 371: goto L371;
+        case 372: goto L372;
+        case 388: goto L388;
+        case 393: goto L393;
+        case 397: goto L397;
+        case 400: goto L400;
+        case 403: goto L403;
+        case 404: goto L404;
+        case 405: goto L405;
+        case 406: goto L406;
+        case 407: goto L407;
+        case 408: goto L408;
+        case 409: goto L409;
+        case 418: goto L418;
+        case 421: goto L421;
+        case 422: goto L422;
+        case 425: goto L425;
+        case 426: goto L426;
+        case 427: goto L427;
+        case 428: goto L428;
+        case 445: goto L445;
+        case 450: goto L450;
+        case 453: goto L453;
+        case 456: goto L456;
+        case 457: goto L457;
+        case 460: goto L460;
+        case 461: goto L461;
+        case 462: goto L462;
+        case 463: goto L463;
+        case 464: goto L464;
+        case 465: goto L465;
+        case 466: goto L466;
+        case 475: goto L475;
+        case 479: goto L479;
+        case 482: goto L482;
+        case 485: goto L485;
+        case 486: goto L486;
+        case 487: goto L487;
+        case 488: goto L488;
+        case 489: goto L489;
+        case 490: goto L490;
+        case 491: goto L491;
+        case 498: goto L498;
+        case 499: goto L499;
+        case 508: goto L508;
+        case 511: goto L511;
+        case 512: goto L512;
+        case 516: goto L516;
+        case 517: goto L517;
+        case 518: goto L518;
+        case 519: goto L519;
+        case 528: goto L528;
+        case 531: goto L531;
+        case 532: goto L532;
+        case 533: goto L533;
+        case 543: goto L543;
+        case 546: goto L546;
+        case 547: goto L547;
+        case 548: goto L548;
+        case 551: goto L551;
+        case 552: goto L552;
+        case 553: goto L553;
+        case 554: goto L554;
+        case 563: goto L563;
+        case 566: goto L566;
+        case 567: goto L567;
+        case 571: goto L571;
+        case 572: goto L572;
+        case 573: goto L573;
+        case 574: goto L574;
+        case 583: goto L583;
+        case 586: goto L586;
+        case 587: goto L587;
+        case 588: goto L588;
+        case 589: goto L589;
+        case 592: goto L592;
+        case 594: goto L594;
+        case 597: goto L597;
+        case 598: goto L598;
+        case 600: goto L600;
+        case 603: goto L603;
+        case 604: goto L604;
+        case 606: goto L606;
+        case 609: goto L609;
+        case 610: goto L610;
+        case 612: goto L612;
+        case 615: goto L615;
+        case 616: goto L616;
+        case 627: goto L627;
+        case 631: goto L631;
+        case 632: goto L632;
+        case 633: goto L633;
+        case 634: goto L634;
+        case 635: goto L635;
+        case 636: goto L636;
+        case 637: goto L637;
+        case 638: goto L638;
+        case 652: goto L652;
+        case 655: goto L655;
+        case 656: goto L656;
+        case 657: goto L657;
+        case 660: goto L660;
+        case 661: goto L661;
+        case 664: goto L664;
+        case 665: goto L665;
+        case 666: goto L666;
+        case 667: goto L667;
+        case 668: goto L668;
+        case 669: goto L669;
+        case 670: goto L670;
+        case 671: goto L671;
+        case 682: goto L682;
+        case 685: goto L685;
+        case 689: goto L689;
+        case 690: goto L690;
+        case 691: goto L691;
+        case 692: goto L692;
+        case 693: goto L693;
+        case 702: goto L702;
+        case 705: goto L705;
+        case 706: goto L706;
+        case 707: goto L707;
+        case 710: goto L710;
+        case 711: goto L711;
+        case 712: goto L712;
+        case 713: goto L713;
+        case 732: goto L732;
+        case 736: goto L736;
+        case 739: goto L739;
+        case 740: goto L740;
+        case 741: goto L741;
+        case 742: goto L742;
+        case 749: goto L749;
+        case 750: goto L750;
+        case 753: goto L753;
+        case 756: goto L756;
+        case 757: goto L757;
+        case 758: goto L758;
+        case 759: goto L759;
+        case 760: goto L760;
+        case 761: goto L761;
+        case 766: goto L766;
+        case 769: goto L769;
+        case 772: goto L772;
+        case 773: goto L773;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 178;
+L7: /* VAR */
+L11: /* STRING */
+    tp_aot_op(tp, f, code + 11);
+L20: /* FILE */
+    f->fname = regs[1];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L26: /* NAME */
+    f->name = regs[1];
+L27: /* LINE */
+    f->line = code + 27;
+    f->lineno = 179;
+L32: /* VAR */
+L35: /* DICT */
+    tp_aot_op(tp, f, code + 35);
+L36: /* LINE */
+    f->line = code + 36;
+    f->lineno = 180;
+L41: /* VAR */
+L43: /* LIST */
+    tp_aot_op(tp, f, code + 43);
+L44: /* LINE */
+    f->line = code + 44;
+    f->lineno = 181;
+L48: /* VAR */
+L50: /* NUMBER */
+    tp_aot_op(tp, f, code + 50);
+L53: /* MOVE */
+    regs[4] = regs[3];
+L54: /* LINE */
+    f->line = code + 54;
+    f->lineno = 182;
+L61: /* GGET */
+    tp_aot_op(tp, f, code + 61);
+L64: /* STRING */
+    tp_aot_op(tp, f, code + 64);
+L67: /* MGET */
+    tp_aot_op(tp, f, code + 67);
+L69: /* NUMBER */
+    tp_aot_op(tp, f, code + 69);
+L72: /* ITER */
+    if (tp_iter_next(tp, &regs[3], regs[5], &regs[6])) {
+        goto L74;
+    }
+L73: /* JUMP */
+    goto L262;
+L74: /* VAR */
+L77: /* MOVE */
+    regs[7] = regs[3];
+L78: /* LINE */
+    f->line = code + 78;
+    f->lineno = 183;
+L87: /* NUMBER */
+    tp_aot_op(tp, f, code + 87);
+L90: /* GET */
+    regs[3] = tp_get(tp, regs[7], regs[8]);
+    tp_grey(tp, regs[3]);
+L91: /* STRING */
+    tp_aot_op(tp, f, code + 91);
+L94: /* EQ */
+    if (TP_BOTH(regs[3], regs[8], TP_NUMBER_INT)) {
+        regs[3] = tp_bool(regs[3].nint == regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 94);
+    }
+L95: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L97;
+    }
+L96: /* JUMP */
+    goto L119;
+L97: /* LINE */
+    f->line = code + 97;
+    f->lineno = 184;
+L106: /* NUMBER */
+    tp_aot_op(tp, f, code + 106);
+L109: /* GET */
+    regs[3] = tp_get(tp, regs[7], regs[8]);
+    tp_grey(tp, regs[3]);
+L110: /* SET */
+    tp_set(tp, regs[1], regs[3], regs[4]);
+L111: /* LINE */
+    f->line = code + 111;
+    f->lineno = 185;
+L118: /* JUMP */
+    tp_aot_safepoint(tp, 46);
+    goto L72;
+L119: /* LINE */
+    f->line = code + 119;
+    f->lineno = 186;
+L128: /* NUMBER */
+    tp_aot_op(tp, f, code + 128);
+L131: /* GET */
+    regs[3] = tp_get(tp, regs[7], regs[8]);
+    tp_grey(tp, regs[3]);
+L132: /* STRING */
+    tp_aot_op(tp, f, code + 132);
+L136: /* EQ */
+    if (TP_BOTH(regs[3], regs[8], TP_NUMBER_INT)) {
+        regs[3] = tp_bool(regs[3].nint == regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 136);
+    }
+L137: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L139;
+    }
+L138: /* JUMP */
+    goto L235;
+L139: /* LINE */
+    f->line = code + 139;
+    f->lineno = 187;
+L155: /* STRING */
+    tp_aot_op(tp, f, code + 155);
+L159: /* METHOD */
+    tp_aot_op(tp, f, code + 159);
+L161: /* GGET */
+    tp_aot_op(tp, f, code + 161);
+L166: /* GGET */
+    tp_aot_op(tp, f, code + 166);
+L170: /* NUMBER */
+    tp_aot_op(tp, f, code + 170);
+L173: /* GET */
+    regs[13] = tp_get(tp, regs[7], regs[15]);
+    tp_grey(tp, regs[13]);
+L174: /* NUMBER */
+    tp_aot_op(tp, f, code + 174);
+L177: /* GET */
+    regs[14] = tp_get(tp, regs[7], regs[15]);
+    tp_grey(tp, regs[14]);
+L178: /* CALLP */
+    return code + 178;
+L179: /* CALLM */
+    return code + 179;
+L180: /* LINE */
+    f->line = code + 180;
+    f->lineno = 188;
+L193: /* STRING */
+    tp_aot_op(tp, f, code + 193);
+L197: /* METHOD */
+    tp_aot_op(tp, f, code + 197);
+L199: /* GGET */
+    tp_aot_op(tp, f, code + 199);
+L204: /* NUMBER */
+    tp_aot_op(tp, f, code + 204);
+L207: /* NUMBER */
+    tp_aot_op(tp, f, code + 207);
+L210: /* NUMBER */
+    tp_aot_op(tp, f, code + 210);
+L213: /* GET */
+    regs[14] = tp_get(tp, regs[7], regs[15]);
+    tp_grey(tp, regs[14]);
+L214: /* CALLP */
+    return code + 214;
+L215: /* CALLM */
+    return code + 215;
+L216: /* LINE */
+    f->line = code + 216;
+    f->lineno = 189;
+L222: /* NUMBER */
+    tp_aot_op(tp, f, code + 222);
+L225: /* ADD */
+    if (TP_BOTH(regs[4], regs[8], TP_NUMBER_INT)) {
+        regs[3] = tp_int(regs[4].nint + regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 225);
+    }
+L226: /* MOVE */
+    regs[4] = regs[3];
+L227: /* LINE */
+    f->line = code + 227;
+    f->lineno = 190;
+L234: /* JUMP */
+    tp_aot_safepoint(tp, 162);
+    goto L72;
+L235: /* LINE */
+    f->line = code + 235;
+    f->lineno = 191;
+L243: /* STRING */
+    tp_aot_op(tp, f, code + 243);
+L247: /* METHOD */
+    tp_aot_op(tp, f, code + 247);
+L249: /* MOVE */
+    regs[10] = regs[7];
+L250: /* CALLM */
+    return code + 250;
+L251: /* LINE */
+    f->line = code + 251;
+    f->lineno = 192;
+L256: /* NUMBER */
+    tp_aot_op(tp, f, code + 256);
+L259: /* ADD */
+    if (TP_BOTH(regs[4], regs[8], TP_NUMBER_INT)) {
+        regs[3] = tp_int(regs[4].nint + regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 259);
+    }
+L260: /* MOVE */
+    regs[4] = regs[3];
+L261: /* JUMP */
+    tp_aot_safepoint(tp, 189);
+    goto L72;
+L262: /* LINE */
+    f->line = code + 262;
+    f->lineno = 193;
+L271: /* GGET */
+    tp_aot_op(tp, f, code + 271);
+L275: /* NUMBER */
+    tp_aot_op(tp, f, code + 275);
+L278: /* GGET */
+    tp_aot_op(tp, f, code + 278);
+L281: /* MOVE */
+    regs[6] = regs[2];
+L282: /* CALLP */
+    return code + 282;
+L283: /* RANGE */
+    tp_aot_op(tp, f, code + 283);
+L284: /* FOR */
+    if (regs[9].type.typeid == TP_NUMBER) {
+        if (regs[10].nint > 0 ? regs[8].nint < regs[9].nint : regs[8].nint > regs[9].nint) {
+            regs[3] = regs[8];
+            regs[8].nint += regs[10].nint;
+            goto L286;
+        }
+    } else if (tp_iter_next(tp, &regs[3], regs[8], &regs[10])) {
+        goto L286;
+    }
+L285: /* JUMP */
+    goto L466;
+L286: /* MOVE */
+    regs[4] = regs[3];
+L287: /* LINE */
+    f->line = code + 287;
+    f->lineno = 194;
+L294: /* GET */
+    regs[7] = tp_get(tp, regs[2], regs[4]);
+    tp_grey(tp, regs[7]);
+L295: /* LINE */
+    f->line = code + 295;
+    f->lineno = 195;
+L304: /* NUMBER */
+    tp_aot_op(tp, f, code + 304);
+L307: /* GET */
+    regs[3] = tp_get(tp, regs[7], regs[5]);
+    tp_grey(tp, regs[3]);
+L308: /* STRING */
+    tp_aot_op(tp, f, code + 308);
+L312: /* EQ */
+    if (TP_BOTH(regs[3], regs[5], TP_NUMBER_INT)) {
+        regs[3] = tp_bool(regs[3].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 312);
+    }
+L313: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L315;
+    }
+L314: /* JUMP */
+    goto L351;
+L315: /* LINE */
+    f->line = code + 315;
+    f->lineno = 196;
+L330: /* GGET */
+    tp_aot_op(tp, f, code + 330);
+L335: /* GGET */
+    tp_aot_op(tp, f, code + 335);
+L339: /* NUMBER */
+    tp_aot_op(tp, f, code + 339);
+L342: /* NUMBER */
+    tp_aot_op(tp, f, code + 342);
+L345: /* GET */
+    regs[5] = tp_get(tp, regs[7], regs[6]);
+    tp_grey(tp, regs[5]);
+L346: /* GET */
+    regs[14] = tp_get(tp, regs[1], regs[5]);
+    tp_grey(tp, regs[14]);
+L347: /* SUB */
+    if (TP_BOTH(regs[14], regs[4], TP_NUMBER_INT)) {
+        regs[14] = tp_int(regs[14].nint - regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 347);
+    }
+L348: /* CALLP */
+    return code + 348;
+L349: /* SET */
+    tp_set(tp, regs[2], regs[4], regs[3]);
+L350: /* JUMP */
+    tp_aot_safepoint(tp, 66);
+    goto L284;
+L351: /* LINE */
+    f->line = code + 351;
+    f->lineno = 197;
+L361: /* NUMBER */
+    tp_aot_op(tp, f, code + 361);
+L364: /* GET */
+    regs[3] = tp_get(tp, regs[7], regs[5]);
+    tp_grey(tp, regs[3]);
+L365: /* STRING */
+    tp_aot_op(tp, f, code + 365);
+L369: /* EQ */
+    if (TP_BOTH(regs[3], regs[5], TP_NUMBER_INT)) {
+        regs[3] = tp_bool(regs[3].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 369);
+    }
+L370: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L372;
+    }
+L371: /* JUMP */
+    goto L409;
+L372: /* LINE */
+    f->line = code + 372;
+    f->lineno = 198;
+L388: /* GGET */
+    tp_aot_op(tp, f, code + 388);
+L393: /* GGET */
+    tp_aot_op(tp, f, code + 393);
+L397: /* NUMBER */
+    tp_aot_op(tp, f, code + 397);
+L400: /* NUMBER */
+    tp_aot_op(tp, f, code + 400);
+L403: /* GET */
+    regs[5] = tp_get(tp, regs[7], regs[6]);
+    tp_grey(tp, regs[5]);
+L404: /* GET */
+    regs[14] = tp_get(tp, regs[1], regs[5]);
+    tp_grey(tp, regs[14]);
+L405: /* SUB */
+    if (TP_BOTH(regs[14], regs[4], TP_NUMBER_INT)) {
+        regs[14] = tp_int(regs[14].nint - regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 405);
+    }
+L406: /* CALLP */
+    return code + 406;
+L407: /* SET */
+    tp_set(tp, regs[2], regs[4], regs[3]);
+L408: /* JUMP */
+    tp_aot_safepoint(tp, 124);
+    goto L284;
+L409: /* LINE */
+    f->line = code + 409;
+    f->lineno = 199;
+L418: /* NUMBER */
+    tp_aot_op(tp, f, code + 418);
+L421: /* GET */
+    regs[3] = tp_get(tp, regs[7], regs[5]);
+    tp_grey(tp, regs[3]);
+L422: /* STRING */
+    tp_aot_op(tp, f, code + 422);
+L425: /* EQ */
+    if (TP_BOTH(regs[3], regs[5], TP_NUMBER_INT)) {
+        regs[3] = tp_bool(regs[3].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 425);
+    }
+L426: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L428;
+    }
+L427: /* JUMP */
+    tp_aot_safepoint(tp, 143);
+    goto L284;
+L428: /* LINE */
+    f->line = code + 428;
+    f->lineno = 200;
+L445: /* GGET */
+    tp_aot_op(tp, f, code + 445);
+L450: /* GGET */
+    tp_aot_op(tp, f, code + 450);
+L453: /* NUMBER */
+    tp_aot_op(tp, f, code + 453);
+L456: /* GET */
+    regs[13] = tp_get(tp, regs[7], regs[5]);
+    tp_grey(tp, regs[13]);
+L457: /* NUMBER */
+    tp_aot_op(tp, f, code + 457);
+L460: /* GET */
+    regs[5] = tp_get(tp, regs[7], regs[6]);
+    tp_grey(tp, regs[5]);
+L461: /* GET */
+    regs[14] = tp_get(tp, regs[1], regs[5]);
+    tp_grey(tp, regs[14]);
+L462: /* SUB */
+    if (TP_BOTH(regs[14], regs[4], TP_NUMBER_INT)) {
+        regs[14] = tp_int(regs[14].nint - regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 462);
+    }
+L463: /* CALLP */
+    return code + 463;
+L464: /* SET */
+    tp_set(tp, regs[2], regs[4], regs[3]);
+L465: /* JUMP */
+    tp_aot_safepoint(tp, 181);
+    goto L284;
+L466: /* LINE */
+    f->line = code + 466;
+    f->lineno = 201;
+L475: /* GGET */
+    tp_aot_op(tp, f, code + 475);
+L479: /* NUMBER */
+    tp_aot_op(tp, f, code + 479);
+L482: /* GGET */
+    tp_aot_op(tp, f, code + 482);
+L485: /* MOVE */
+    regs[6] = regs[2];
+L486: /* CALLP */
+    return code + 486;
+L487: /* RANGE */
+    tp_aot_op(tp, f, code + 487);
+L488: /* FOR */
+    if (regs[9].type.typeid == TP_NUMBER) {
+        if (regs[10].nint > 0 ? regs[8].nint < regs[9].nint : regs[8].nint > regs[9].nint) {
+            regs[3] = regs[8];
+            regs[8].nint += regs[10].nint;
+            goto L490;
+        }
+    } else if (tp_iter_next(tp, &regs[3], regs[8], &regs[10])) {
+        goto L490;
+    }
+L489: /* JUMP */
+    goto L761;
+L490: /* MOVE */
+    regs[4] = regs[3];
+L491: /* LINE */
+    f->line = code + 491;
+    f->lineno = 202;
+L498: /* GET */
+    regs[7] = tp_get(tp, regs[2], regs[4]);
+    tp_grey(tp, regs[7]);
+L499: /* LINE */
+    f->line = code + 499;
+    f->lineno = 203;
+L508: /* NUMBER */
+    tp_aot_op(tp, f, code + 508);
+L511: /* GET */
+    regs[3] = tp_get(tp, regs[7], regs[5]);
+    tp_grey(tp, regs[3]);
+L512: /* STRING */
+    tp_aot_op(tp, f, code + 512);
+L516: /* EQ */
+    if (TP_BOTH(regs[3], regs[5], TP_NUMBER_INT)) {
+        regs[3] = tp_bool(regs[3].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 516);
+    }
+L517: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L519;
+    }
+L518: /* JUMP */
+    goto L554;
+L519: /* LINE */
+    f->line = code + 519;
+    f->lineno = 204;
+L528: /* NUMBER */
+    tp_aot_op(tp, f, code + 528);
+L531: /* GET */
+    regs[3] = tp_get(tp, regs[7], regs[5]);
+    tp_grey(tp, regs[3]);
+L532: /* SET */
+    tp_set(tp, regs[2], regs[4], regs[3]);
+L533: /* LINE */
+    f->line = code + 533;
+    f->lineno = 205;
+L543: /* GGET */
+    tp_aot_op(tp, f, code + 543);
+L546: /* GET */
+    regs[12] = tp_get(tp, regs[2], regs[4]);
+    tp_grey(tp, regs[12]);
+L547: /* CALLP */
+    return code + 547;
+L548: /* NUMBER */
+    tp_aot_op(tp, f, code + 548);
+L551: /* EQ */
+    if (TP_BOTH(regs[5], regs[6], TP_NUMBER_INT)) {
+        regs[3] = tp_bool(regs[5].nint == regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 551);
+    }
+L552: /* ASSERT */
+    tp_assert(tp, regs[3], regs[5], regs[6]);
+L553: /* JUMP */
+    goto L693;
+L554: /* LINE */
+    f->line = code + 554;
+    f->lineno = 206;
+L563: /* NUMBER */
+    tp_aot_op(tp, f, code + 563);
+L566: /* GET */
+    regs[3] = tp_get(tp, regs[7], regs[5]);
+    tp_grey(tp, regs[3]);
+L567: /* STRING */
+    tp_aot_op(tp, f, code + 567);
+L571: /* EQ */
+    if (TP_BOTH(regs[3], regs[5], TP_NUMBER_INT)) {
+        regs[3] = tp_bool(regs[3].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 571);
+    }
+L572: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L574;
+    }
+L573: /* JUMP */
+    goto L671;
+L574: /* LINE */
+    f->line = code + 574;
+    f->lineno = 207;
+L583: /* NUMBER */
+    tp_aot_op(tp, f, code + 583);
+L586: /* NONE */
+    regs[12] = tp_None;
+L587: /* LIST */
+    tp_aot_op(tp, f, code + 587);
+L588: /* GET */
+    regs[3] = tp_get(tp, regs[7], regs[5]);
+    tp_grey(tp, regs[3]);
+L589: /* VAR */
+L592: /* VAR */
+L594: /* NUMBER */
+    tp_aot_op(tp, f, code + 594);
+L597: /* GET */
+    regs[5] = tp_get(tp, regs[3], regs[11]);
+    tp_grey(tp, regs[5]);
+L598: /* VAR */
+L600: /* NUMBER */
+    tp_aot_op(tp, f, code + 600);
+L603: /* GET */
+    regs[6] = tp_get(tp, regs[3], regs[12]);
+    tp_grey(tp, regs[6]);
+L604: /* VAR */
+L606: /* NUMBER */
+    tp_aot_op(tp, f, code + 606);
+L609: /* GET */
+    regs[11] = tp_get(tp, regs[3], regs[13]);
+    tp_grey(tp, regs[11]);
+L610: /* VAR */
+L612: /* NUMBER */
+    tp_aot_op(tp, f, code + 612);
+L615: /* GET */
+    regs[12] = tp_get(tp, regs[3], regs[14]);
+    tp_grey(tp, regs[12]);
+L616: /* LINE */
+    f->line = code + 616;
+    f->lineno = 208;
+L627: /* GGET */
+    tp_aot_op(tp, f, code + 627);
+L631: /* MOVE */
+    regs[15] = regs[5];
+L632: /* MOVE */
+    regs[16] = regs[6];
+L633: /* MOVE */
+    regs[17] = regs[11];
+L634: /* MOVE */
+    regs[18] = regs[12];
+L635: /* LIST */
+    tp_aot_op(tp, f, code + 635);
+L636: /* CALLP */
+    return code + 636;
+L637: /* SET */
+    tp_set(tp, regs[2], regs[4], regs[3]);
+L638: /* LINE */
+    f->line = code + 638;
+    f->lineno = 209;
+L652: /* GGET */
+    tp_aot_op(tp, f, code + 652);
+L655: /* GET */
+    regs[16] = tp_get(tp, regs[2], regs[4]);
+    tp_grey(tp, regs[16]);
+L656: /* CALLP */
+    return code + 656;
+L657: /* NUMBER */
+    tp_aot_op(tp, f, code + 657);
+L660: /* EQ */
+    if (TP_BOTH(regs[13], regs[15], TP_NUMBER_INT)) {
+        regs[13] = tp_bool(regs[13].nint == regs[15].nint);
+    } else {
+        tp_aot_op(tp, f, code + 660);
+    }
+L661: /* GGET */
+    tp_aot_op(tp, f, code + 661);
+L664: /* GET */
+    regs[16] = tp_get(tp, regs[2], regs[4]);
+    tp_grey(tp, regs[16]);
+L665: /* CALLP */
+    return code + 665;
+L666: /* LIST */
+    tp_aot_op(tp, f, code + 666);
+L667: /* NONE */
+    regs[13] = tp_None;
+L668: /* NONE */
+    regs[14] = tp_None;
+L669: /* ASSERT */
+    tp_assert(tp, regs[3], regs[13], regs[14]);
+L670: /* JUMP */
+    goto L693;
+L671: /* LINE */
+    f->line = code + 671;
+    f->lineno = 211;
+L682: /* GGET */
+    tp_aot_op(tp, f, code + 682);
+L685: /* STRING */
+    tp_aot_op(tp, f, code + 685);
+L689: /* MOVE */
+    regs[16] = regs[7];
+L690: /* LIST */
+    tp_aot_op(tp, f, code + 690);
+L691: /* CALLP */
+    return code + 691;
+L692: /* RAISE */
+    return code + 692;
+L693: /* LINE */
+    f->line = code + 693;
+    f->lineno = 212;
+L702: /* GGET */
+    tp_aot_op(tp, f, code + 702);
+L705: /* GET */
+    regs[14] = tp_get(tp, regs[2], regs[4]);
+    tp_grey(tp, regs[14]);
+L706: /* CALLP */
+    return code + 706;
+L707: /* NUMBER */
+    tp_aot_op(tp, f, code + 707);
+L710: /* NE */
+    if (TP_BOTH(regs[3], regs[13], TP_NUMBER_INT)) {
+        regs[3] = tp_bool(regs[3].nint != regs[13].nint);
+    } else {
+        tp_aot_op(tp, f, code + 710);
+    }
+L711: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L713;
+    }
+L712: /* JUMP */
+    tp_aot_safepoint(tp, 224);
+    goto L488;
+L713: /* LINE */
+    f->line = code + 713;
+    f->lineno = 213;
+L732: /* STRING */
+    tp_aot_op(tp, f, code + 732);
+L736: /* GGET */
+    tp_aot_op(tp, f, code + 736);
+L739: /* MOVE */
+    regs[15] = regs[4];
+L740: /* CALLP */
+    return code + 740;
+L741: /* ADD */
+    if (TP_BOTH(regs[3], regs[13], TP_NUMBER_INT)) {
+        regs[3] = tp_int(regs[3].nint + regs[13].nint);
+    } else {
+        tp_aot_op(tp, f, code + 741);
+    }
+L742: /* STRING */
+    tp_aot_op(tp, f, code + 742);
+L749: /* ADD */
+    if (TP_BOTH(regs[3], regs[13], TP_NUMBER_INT)) {
+        regs[3] = tp_int(regs[3].nint + regs[13].nint);
+    } else {
+        tp_aot_op(tp, f, code + 749);
+    }
+L750: /* GGET */
+    tp_aot_op(tp, f, code + 750);
+L753: /* GGET */
+    tp_aot_op(tp, f, code + 753);
+L756: /* GET */
+    regs[17] = tp_get(tp, regs[2], regs[4]);
+    tp_grey(tp, regs[17]);
+L757: /* CALLP */
+    return code + 757;
+L758: /* CALLP */
+    return code + 758;
+L759: /* ADD */
+    if (TP_BOTH(regs[3], regs[13], TP_NUMBER_INT)) {
+        regs[3] = tp_int(regs[3].nint + regs[13].nint);
+    } else {
+        tp_aot_op(tp, f, code + 759);
+    }
+L760: /* RAISE */
+    return code + 760;
+L761: /* LINE */
+    f->line = code + 761;
+    f->lineno = 214;
+L766: /* GGET */
+    tp_aot_op(tp, f, code + 766);
+L769: /* STRING */
+    tp_aot_op(tp, f, code + 769);
+L772: /* SET */
+    tp_set(tp, regs[3], regs[8], regs[2]);
+L773: /* EOF */
+    return code + 773;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_5632(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 34: goto L34;
+        case 35: goto L35;
+        case 36: goto L36;
+        case 37: goto L37;
+        case 38: goto L38;
+        case 39: goto L39;
+        case 47: goto L47;
+        case 52: goto L52;
+        case 55: goto L55;
+        case 56: goto L56;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 61: goto L61;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 216;
+L9: /* VAR */
+L11: /* STRING */
+    tp_aot_op(tp, f, code + 11);
+L20: /* FILE */
+    f->fname = regs[1];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 217;
+L34: /* NONE */
+    regs[2] = tp_None;
+L35: /* NE */
+    if (TP_BOTH(regs[0], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[0].nint != regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 35);
+    }
+L36: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L38;
+    }
+L37: /* JUMP */
+    goto L39;
+L38: /* RETURN */
+    return code + 38;
+L39: /* LINE */
+    f->line = code + 39;
+    f->lineno = 218;
+L47: /* GGET */
+    tp_aot_op(tp, f, code + 47);
+L52: /* NUMBER */
+    tp_aot_op(tp, f, code + 52);
+L55: /* CALLP */
+    return code + 55;
+L56: /* NUMBER */
+    tp_aot_op(tp, f, code + 56);
+L59: /* GET */
+    regs[1] = tp_get(tp, regs[1], regs[2]);
+    tp_grey(tp, regs[1]);
+L60: /* RETURN */
+    return code + 60;
+L61: /* EOF */
+    return code + 61;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_5716(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 32: goto L32;
+        case 34: goto L34;
+        case 38: goto L38;
+        case 39: goto L39;
+        case 40: goto L40;
+        case 48: goto L48;
+        case 51: goto L51;
+        case 55: goto L55;
+        case 56: goto L56;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 65: goto L65;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 72: goto L72;
+        case 73: goto L73;
+        case 83: goto L83;
+        case 87: goto L87;
+        case 88: goto L88;
+        case 91: goto L91;
+        case 94: goto L94;
+        case 97: goto L97;
+        case 101: goto L101;
+        case 103: goto L103;
+        case 104: goto L104;
+        case 105: goto L105;
+        case 106: goto L106;
+        case 113: goto L113;
+        case 116: goto L116;
+        case 119: goto L119;
+        case 123: goto L123;
+        case 125: goto L125;
+        case 128: goto L128;
+        case 129: goto L129;
+        case 133: goto L133;
+        case 134: goto L134;
+        case 135: goto L135;
+        case 142: goto L142;
+        case 145: goto L145;
+        case 148: goto L148;
+        case 152: goto L152;
+        case 154: goto L154;
+        case 155: goto L155;
+        case 159: goto L159;
+        case 160: goto L160;
+        case 165: goto L165;
+        case 166: goto L166;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 219;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 220;
+L32: /* VAR */
+L34: /* GGET */
+    tp_aot_op(tp, f, code + 34);
+L38: /* MOVE */
+    regs[2] = regs[0];
+L39: /* CALLP */
+    return code + 39;
+L40: /* LINE */
+    f->line = code + 40;
+    f->lineno = 221;
+L48: /* VAR */
+L51: /* GGET */
+    tp_aot_op(tp, f, code + 51);
+L55: /* MOVE */
+    regs[3] = regs[1];
+L56: /* ADD */
+    if (TP_BOTH(regs[1], regs[0], TP_NUMBER_INT)) {
+        regs[4] = tp_int(regs[1].nint + regs[0].nint);
+    } else {
+        tp_aot_op(tp, f, code + 56);
+    }
+L57: /* CALLP */
+    return code + 57;
+L58: /* MOVE */
+    regs[7] = regs[1];
+L59: /* LINE */
+    f->line = code + 59;
+    f->lineno = 222;
+L65: /* NUMBER */
+    tp_aot_op(tp, f, code + 65);
+L68: /* ITER */
+    if (tp_iter_next(tp, &regs[1], regs[7], &regs[2])) {
+        goto L70;
+    }
+L69: /* JUMP */
+    goto L135;
+L70: /* VAR */
+L72: /* MOVE */
+    regs[3] = regs[1];
+L73: /* LINE */
+    f->line = code + 73;
+    f->lineno = 223;
+L83: /* GGET */
+    tp_aot_op(tp, f, code + 83);
+L87: /* MOVE */
+    regs[5] = regs[3];
+L88: /* STRING */
+    tp_aot_op(tp, f, code + 88);
+L91: /* GGET */
+    tp_aot_op(tp, f, code + 91);
+L94: /* GGET */
+    tp_aot_op(tp, f, code + 94);
+L97: /* STRING */
+    tp_aot_op(tp, f, code + 97);
+L101: /* MGET */
+    tp_aot_op(tp, f, code + 101);
+L103: /* CALLP */
+    return code + 103;
+L104: /* ADD */
+    if (TP_BOTH(regs[6], regs[1], TP_NUMBER_INT)) {
+        regs[6] = tp_int(regs[6].nint + regs[1].nint);
+    } else {
+        tp_aot_op(tp, f, code + 104);
+    }
+L105: /* CALLP */
+    return code + 105;
+L106: /* LINE */
+    f->line = code + 106;
+    f->lineno = 224;
+L113: /* GGET */
+    tp_aot_op(tp, f, code + 113);
+L116: /* GGET */
+    tp_aot_op(tp, f, code + 116);
+L119: /* STRING */
+    tp_aot_op(tp, f, code + 119);
+L123: /* MGET */
+    tp_aot_op(tp, f, code + 123);
+L125: /* NUMBER */
+    tp_aot_op(tp, f, code + 125);
+L128: /* ADD */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[4] = tp_int(regs[4].nint + regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 128);
+    }
+L129: /* STRING */
+    tp_aot_op(tp, f, code + 129);
+L133: /* SET */
+    tp_set(tp, regs[1], regs[5], regs[4]);
+L134: /* JUMP */
+    tp_aot_safepoint(tp, 66);
+    goto L68;
+L135: /* LINE */
+    f->line = code + 135;
+    f->lineno = 225;
+L142: /* GGET */
+    tp_aot_op(tp, f, code + 142);
+L145: /* GGET */
+    tp_aot_op(tp, f, code + 145);
+L148: /* STRING */
+    tp_aot_op(tp, f, code + 148);
+L152: /* MGET */
+    tp_aot_op(tp, f, code + 152);
+L154: /* ADD */
+    if (TP_BOTH(regs[2], regs[0], TP_NUMBER_INT)) {
+        regs[2] = tp_int(regs[2].nint + regs[0].nint);
+    } else {
+        tp_aot_op(tp, f, code + 154);
+    }
+L155: /* STRING */
+    tp_aot_op(tp, f, code + 155);
+L159: /* SET */
+    tp_set(tp, regs[1], regs[4], regs[2]);
+L160: /* LINE */
+    f->line = code + 160;
+    f->lineno = 226;
+L165: /* RETURN */
+    return code + 165;
+L166: /* EOF */
+    return code + 166;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_5905(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 43: goto L43;
+        case 45: goto L45;
+        case 48: goto L48;
+        case 52: goto L52;
+        case 54: goto L54;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 62: goto L62;
+        case 65: goto L65;
+        case 68: goto L68;
+        case 71: goto L71;
+        case 74: goto L74;
+        case 78: goto L78;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 85: goto L85;
+        case 87: goto L87;
+        case 88: goto L88;
+        case 91: goto L91;
+        case 94: goto L94;
+        case 97: goto L97;
+        case 99: goto L99;
+        case 100: goto L100;
+        case 101: goto L101;
+        case 102: goto L102;
+        case 103: goto L103;
+        case 104: goto L104;
+        case 105: goto L105;
+        case 106: goto L106;
+        case 114: goto L114;
+        case 118: goto L118;
+        case 120: goto L120;
+        case 123: goto L123;
+        case 124: goto L124;
+        case 125: goto L125;
+        case 126: goto L126;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 227;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 228;
+L43: /* VAR */
+L45: /* STRING */
+    tp_aot_op(tp, f, code + 45);
+L48: /* STRING */
+    tp_aot_op(tp, f, code + 48);
+L52: /* METHOD */
+    tp_aot_op(tp, f, code + 52);
+L54: /* VAR */
+L57: /* LIST */
+    tp_aot_op(tp, f, code + 57);
+L58: /* GGET */
+    tp_aot_op(tp, f, code + 58);
+L62: /* NUMBER */
+    tp_aot_op(tp, f, code + 62);
+L65: /* GGET */
+    tp_aot_op(tp, f, code + 65);
+L68: /* NUMBER */
+    tp_aot_op(tp, f, code + 68);
+L71: /* GGET */
+    tp_aot_op(tp, f, code + 71);
+L74: /* STRING */
+    tp_aot_op(tp, f, code + 74);
+L78: /* MGET */
+    tp_aot_op(tp, f, code + 78);
+L80: /* ADD */
+    if (TP_BOTH(regs[10], regs[0], TP_NUMBER_INT)) {
+        regs[10] = tp_int(regs[10].nint + regs[0].nint);
+    } else {
+        tp_aot_op(tp, f, code + 80);
+    }
+L81: /* CALLP */
+    return code + 81;
+L82: /* RANGE */
+    tp_aot_op(tp, f, code + 82);
+L83: /* FOR */
+    if (regs[10].type.typeid == TP_NUMBER) {
+        if (regs[11].nint > 0 ? regs[9].nint < regs[10].nint : regs[9].nint > regs[10].nint) {
+            regs[2] = regs[9];
+            regs[9].nint += regs[11].nint;
+            goto L85;
+        }
+    } else if (tp_iter_next(tp, &regs[2], regs[9], &regs[11])) {
+        goto L85;
+    }
+L84: /* JUMP */
+    goto L104;
+L85: /* VAR */
+L87: /* MOVE */
+    regs[5] = regs[2];
+L88: /* STRING */
+    tp_aot_op(tp, f, code + 88);
+L91: /* GGET */
+    tp_aot_op(tp, f, code + 91);
+L94: /* STRING */
+    tp_aot_op(tp, f, code + 94);
+L97: /* MGET */
+    tp_aot_op(tp, f, code + 97);
+L99: /* IN */
+    regs[6] = tp_has(tp, regs[7], regs[5]);
+L100: /* GET */
+    regs[2] = tp_get(tp, regs[2], regs[6]);
+    tp_grey(tp, regs[2]);
+L101: /* NONE */
+    regs[6] = tp_None;
+L102: /* SET */
+    tp_set(tp, regs[1], regs[6], regs[2]);
+L103: /* JUMP */
+    tp_aot_safepoint(tp, 20);
+    goto L83;
+L104: /* MOVE */
+    regs[5] = regs[1];
+L105: /* CALLM */
+    return code + 105;
+L106: /* LINE */
+    f->line = code + 106;
+    f->lineno = 229;
+L114: /* STRING */
+    tp_aot_op(tp, f, code + 114);
+L118: /* METHOD */
+    tp_aot_op(tp, f, code + 118);
+L120: /* STRING */
+    tp_aot_op(tp, f, code + 120);
+L123: /* MUL */
+    if (TP_BOTH(regs[5], regs[0], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[5].nint * regs[0].nint);
+    } else {
+        tp_aot_op(tp, f, code + 123);
+    }
+L124: /* CALLM */
+    return code + 124;
+L125: /* RETURN */
+    return code + 125;
+L126: /* EOF */
+    return code + 126;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_6053(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 33: goto L33;
+        case 34: goto L34;
+        case 35: goto L35;
+        case 36: goto L36;
+        case 37: goto L37;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 50: goto L50;
+        case 53: goto L53;
+        case 56: goto L56;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 66: goto L66;
+        case 67: goto L67;
+        case 68: goto L68;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 230;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 231;
+L33: /* NONE */
+    regs[2] = tp_None;
+L34: /* EQ */
+    if (TP_BOTH(regs[0], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[0].nint == regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 34);
+    }
+L35: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L37;
+    }
+L36: /* JUMP */
+    goto L41;
+L37: /* NUMBER */
+    tp_aot_op(tp, f, code + 37);
+L40: /* RETURN */
+    return code + 40;
+L41: /* LINE */
+    f->line = code + 41;
+    f->lineno = 232;
+L50: /* GGET */
+    tp_aot_op(tp, f, code + 50);
+L53: /* STRING */
+    tp_aot_op(tp, f, code + 53);
+L56: /* MGET */
+    tp_aot_op(tp, f, code + 56);
+L58: /* GET */
+    regs[1] = tp_get(tp, regs[1], regs[0]);
+    tp_grey(tp, regs[1]);
+L59: /* NUMBER */
+    tp_aot_op(tp, f, code + 59);
+L62: /* GET */
+    regs[1] = tp_get(tp, regs[1], regs[2]);
+    tp_grey(tp, regs[1]);
+L63: /* STRING */
+    tp_aot_op(tp, f, code + 63);
+L66: /* EQ */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[1].nint == regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 66);
+    }
+L67: /* RETURN */
+    return code + 67;
+L68: /* EOF */
+    return code + 68;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_6143(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 30: goto L30;
+        case 32: goto L32;
+        case 35: goto L35;
+        case 38: goto L38;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 46: goto L46;
+        case 51: goto L51;
+        case 52: goto L52;
+        case 53: goto L53;
+        case 60: goto L60;
+        case 64: goto L64;
+        case 65: goto L65;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 70: goto L70;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 233;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 234;
+L30: /* VAR */
+L32: /* GGET */
+    tp_aot_op(tp, f, code + 32);
+L35: /* STRING */
+    tp_aot_op(tp, f, code + 35);
+L38: /* MGET */
+    tp_aot_op(tp, f, code + 38);
+L40: /* GET */
+    regs[1] = tp_get(tp, regs[2], regs[0]);
+    tp_grey(tp, regs[1]);
+L41: /* LINE */
+    f->line = code + 41;
+    f->lineno = 235;
+L46: /* GGET */
+    tp_aot_op(tp, f, code + 46);
+L51: /* MOVE */
+    regs[4] = regs[0];
+L52: /* CALLP */
+    return code + 52;
+L53: /* LINE */
+    f->line = code + 53;
+    f->lineno = 236;
+L60: /* GGET */
+    tp_aot_op(tp, f, code + 60);
+L64: /* MOVE */
+    regs[4] = regs[0];
+L65: /* STRING */
+    tp_aot_op(tp, f, code + 65);
+L68: /* ADD */
+    if (TP_BOTH(regs[5], regs[1], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[5].nint + regs[1].nint);
+    } else {
+        tp_aot_op(tp, f, code + 68);
+    }
+L69: /* CALLP */
+    return code + 69;
+L70: /* EOF */
+    return code + 70;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_6236(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 35: goto L35;
+        case 39: goto L39;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 55: goto L55;
+        case 56: goto L56;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 237;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 238;
+L35: /* GGET */
+    tp_aot_op(tp, f, code + 35);
+L39: /* MOVE */
+    regs[2] = regs[0];
+L40: /* CALLP */
+    return code + 40;
+L41: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L43;
+    }
+L42: /* JUMP */
+    goto L50;
+L43: /* GGET */
+    tp_aot_op(tp, f, code + 43);
+L48: /* MOVE */
+    regs[2] = regs[0];
+L49: /* CALLP */
+    return code + 49;
+L50: /* LINE */
+    f->line = code + 50;
+    f->lineno = 239;
+L55: /* RETURN */
+    return code + 55;
+L56: /* EOF */
+    return code + 56;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_6316(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 34: goto L34;
+        case 37: goto L37;
+        case 38: goto L38;
+        case 39: goto L39;
+        case 41: goto L41;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 49: goto L49;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 240;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 241;
+L34: /* NUMBER */
+    tp_aot_op(tp, f, code + 34);
+L37: /* ITER */
+    if (tp_iter_next(tp, &regs[1], regs[0], &regs[2])) {
+        goto L39;
+    }
+L38: /* JUMP */
+    goto L49;
+L39: /* VAR */
+L41: /* GGET */
+    tp_aot_op(tp, f, code + 41);
+L46: /* MOVE */
+    regs[4] = regs[1];
+L47: /* CALLP */
+    return code + 47;
+L48: /* JUMP */
+    tp_aot_safepoint(tp, 11);
+    goto L37;
+L49: /* EOF */
+    return code + 49;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_6388(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 31: goto L31;
+        case 34: goto L34;
+        case 37: goto L37;
+        case 39: goto L39;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 50: goto L50;
+        case 54: goto L54;
+        case 58: goto L58;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 70: goto L70;
+        case 73: goto L73;
+        case 76: goto L76;
+        case 78: goto L78;
+        case 79: goto L79;
+        case 80: goto L80;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 242;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 243;
+L31: /* GGET */
+    tp_aot_op(tp, f, code + 31);
+L34: /* STRING */
+    tp_aot_op(tp, f, code + 34);
+L37: /* MGET */
+    tp_aot_op(tp, f, code + 37);
+L39: /* NOTIN */
+    regs[1] = tp_bool(!tp_true(tp, tp_has(tp, regs[2], regs[0])));
+L40: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L42;
+    }
+L41: /* JUMP */
+    goto L64;
+L42: /* LINE */
+    f->line = code + 42;
+    f->lineno = 244;
+L50: /* GGET */
+    tp_aot_op(tp, f, code + 50);
+L54: /* GGET */
+    tp_aot_op(tp, f, code + 54);
+L58: /* NUMBER */
+    tp_aot_op(tp, f, code + 58);
+L61: /* CALLP */
+    return code + 61;
+L62: /* MOVE */
+    regs[4] = regs[0];
+L63: /* CALLP */
+    return code + 63;
+L64: /* LINE */
+    f->line = code + 64;
+    f->lineno = 245;
+L70: /* GGET */
+    tp_aot_op(tp, f, code + 70);
+L73: /* STRING */
+    tp_aot_op(tp, f, code + 73);
+L76: /* MGET */
+    tp_aot_op(tp, f, code + 76);
+L78: /* GET */
+    regs[1] = tp_get(tp, regs[1], regs[0]);
+    tp_grey(tp, regs[1]);
+L79: /* RETURN */
+    return code + 79;
+L80: /* EOF */
+    return code + 80;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_6494(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 26: goto L26;
+        case 27: goto L27;
+        case 36: goto L36;
+        case 39: goto L39;
+        case 42: goto L42;
+        case 44: goto L44;
+        case 45: goto L45;
+        case 48: goto L48;
+        case 51: goto L51;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 63: goto L63;
+        case 66: goto L66;
+        case 69: goto L69;
+        case 72: goto L72;
+        case 76: goto L76;
+        case 78: goto L78;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 87: goto L87;
+        case 88: goto L88;
+        case 95: goto L95;
+        case 99: goto L99;
+        case 100: goto L100;
+        case 101: goto L101;
+        case 102: goto L102;
+        case 103: goto L103;
+        case 115: goto L115;
+        case 117: goto L117;
+        case 121: goto L121;
+        case 123: goto L123;
+        case 124: goto L124;
+        case 127: goto L127;
+        case 130: goto L130;
+        case 133: goto L133;
+        case 134: goto L134;
+        case 135: goto L135;
+        case 138: goto L138;
+        case 139: goto L139;
+        case 140: goto L140;
+        case 141: goto L141;
+        case 142: goto L142;
+        case 151: goto L151;
+        case 155: goto L155;
+        case 158: goto L158;
+        case 159: goto L159;
+        case 162: goto L162;
+        case 163: goto L163;
+        case 164: goto L164;
+        case 165: goto L165;
+        case 171: goto L171;
+        case 175: goto L175;
+        case 176: goto L176;
+        case 177: goto L177;
+        case 182: goto L182;
+        case 183: goto L183;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 246;
+L8: /* VAR */
+L10: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[2];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L26: /* NAME */
+    f->name = regs[2];
+L27: /* LINE */
+    f->line = code + 27;
+    f->lineno = 247;
+L36: /* GGET */
+    tp_aot_op(tp, f, code + 36);
+L39: /* STRING */
+    tp_aot_op(tp, f, code + 39);
+L42: /* MGET */
+    tp_aot_op(tp, f, code + 42);
+L44: /* SET */
+    tp_set(tp, regs[2], regs[1], regs[0]);
+L45: /* GGET */
+    tp_aot_op(tp, f, code + 45);
+L48: /* STRING */
+    tp_aot_op(tp, f, code + 48);
+L51: /* MGET */
+    tp_aot_op(tp, f, code + 51);
+L53: /* SET */
+    tp_set(tp, regs[2], regs[0], regs[1]);
+L54: /* LINE */
+    f->line = code + 54;
+    f->lineno = 248;
+L63: /* GGET */
+    tp_aot_op(tp, f, code + 63);
+L66: /* GGET */
+    tp_aot_op(tp, f, code + 66);
+L69: /* GGET */
+    tp_aot_op(tp, f, code + 69);
+L72: /* STRING */
+    tp_aot_op(tp, f, code + 72);
+L76: /* MGET */
+    tp_aot_op(tp, f, code + 76);
+L78: /* NUMBER */
+    tp_aot_op(tp, f, code + 78);
+L81: /* ADD */
+    if (TP_BOTH(regs[0], regs[7], TP_NUMBER_INT)) {
+        regs[6] = tp_int(regs[0].nint + regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 81);
+    }
+L82: /* CALLP */
+    return code + 82;
+L83: /* STRING */
+    tp_aot_op(tp, f, code + 83);
+L87: /* SET */
+    tp_set(tp, regs[2], regs[4], regs[3]);
+L88: /* LINE */
+    f->line = code + 88;
+    f->lineno = 249;
+L95: /* GGET */
+    tp_aot_op(tp, f, code + 95);
+L99: /* MOVE */
+    regs[5] = regs[0];
+L100: /* CALLP */
+    return code + 100;
+L101: /* IFN */
+    if (!(TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3]))) {
+        goto L103;
+    }
+L102: /* JUMP */
+    goto L177;
+L103: /* LINE */
+    f->line = code + 103;
+    f->lineno = 250;
+L115: /* VAR */
+L117: /* STRING */
+    tp_aot_op(tp, f, code + 117);
+L121: /* METHOD */
+    tp_aot_op(tp, f, code + 121);
+L123: /* CALLM */
+    return code + 123;
+L124: /* STRING */
+    tp_aot_op(tp, f, code + 124);
+L127: /* NUMBER */
+    tp_aot_op(tp, f, code + 127);
+L130: /* GGET */
+    tp_aot_op(tp, f, code + 130);
+L133: /* MOVE */
+    regs[8] = regs[1];
+L134: /* CALLP */
+    return code + 134;
+L135: /* NUMBER */
+    tp_aot_op(tp, f, code + 135);
+L138: /* MOD */
+    regs[6] = tp_mod(tp, regs[6], regs[7]);
+L139: /* SUB */
+    if (TP_BOTH(regs[5], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[5].nint - regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 139);
+    }
+L140: /* MUL */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[4] = tp_int(regs[4].nint * regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 140);
+    }
+L141: /* ADD */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[2] = tp_int(regs[3].nint + regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 141);
+    }
+L142: /* LINE */
+    f->line = code + 142;
+    f->lineno = 251;
+L151: /* GGET */
+    tp_aot_op(tp, f, code + 151);
+L155: /* GGET */
+    tp_aot_op(tp, f, code + 155);
+L158: /* MOVE */
+    regs[6] = regs[0];
+L159: /* GGET */
+    tp_aot_op(tp, f, code + 159);
+L162: /* MOVE */
+    regs[9] = regs[1];
+L163: /* CALLP */
+    return code + 163;
+L164: /* CALLP */
+    return code + 164;
+L165: /* LINE */
+    f->line = code + 165;
+    f->lineno = 252;
+L171: /* GGET */
+    tp_aot_op(tp, f, code + 171);
+L175: /* MOVE */
+    regs[5] = regs[2];
+L176: /* CALLP */
+    return code + 176;
+L177: /* LINE */
+    f->line = code + 177;
+    f->lineno = 253;
+L182: /* RETURN */
+    return code + 182;
+L183: /* EOF */
+    return code + 183;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_6700(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 35: goto L35;
+        case 39: goto L39;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 46: goto L46;
+        case 49: goto L49;
+        case 53: goto L53;
+        case 55: goto L55;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 77: goto L77;
+        case 79: goto L79;
+        case 82: goto L82;
+        case 85: goto L85;
+        case 87: goto L87;
+        case 88: goto L88;
+        case 91: goto L91;
+        case 94: goto L94;
+        case 96: goto L96;
+        case 97: goto L97;
+        case 100: goto L100;
+        case 103: goto L103;
+        case 105: goto L105;
+        case 106: goto L106;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 255;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 256;
+L35: /* GGET */
+    tp_aot_op(tp, f, code + 35);
+L39: /* MOVE */
+    regs[3] = regs[0];
+L40: /* CALLP */
+    return code + 40;
+L41: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L43;
+    }
+L42: /* JUMP */
+    goto L64;
+L43: /* GGET */
+    tp_aot_op(tp, f, code + 43);
+L46: /* GGET */
+    tp_aot_op(tp, f, code + 46);
+L49: /* STRING */
+    tp_aot_op(tp, f, code + 49);
+L53: /* MGET */
+    tp_aot_op(tp, f, code + 53);
+L55: /* NUMBER */
+    tp_aot_op(tp, f, code + 55);
+L58: /* SUB */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_int(regs[2].nint - regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 58);
+    }
+L59: /* STRING */
+    tp_aot_op(tp, f, code + 59);
+L63: /* SET */
+    tp_set(tp, regs[1], regs[3], regs[2]);
+L64: /* LINE */
+    f->line = code + 64;
+    f->lineno = 257;
+L77: /* VAR */
+L79: /* GGET */
+    tp_aot_op(tp, f, code + 79);
+L82: /* STRING */
+    tp_aot_op(tp, f, code + 82);
+L85: /* MGET */
+    tp_aot_op(tp, f, code + 85);
+L87: /* GET */
+    regs[1] = tp_get(tp, regs[2], regs[0]);
+    tp_grey(tp, regs[1]);
+L88: /* GGET */
+    tp_aot_op(tp, f, code + 88);
+L91: /* STRING */
+    tp_aot_op(tp, f, code + 91);
+L94: /* MGET */
+    tp_aot_op(tp, f, code + 94);
+L96: /* DEL */
+    tp_del(tp, regs[2], regs[0]);
+L97: /* GGET */
+    tp_aot_op(tp, f, code + 97);
+L100: /* STRING */
+    tp_aot_op(tp, f, code + 100);
+L103: /* MGET */
+    tp_aot_op(tp, f, code + 103);
+L105: /* DEL */
+    tp_del(tp, regs[2], regs[1]);
+L106: /* EOF */
+    return code + 106;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_6835(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 12: goto L12;
+        case 14: goto L14;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 28: goto L28;
+        case 29: goto L29;
+        case 36: goto L36;
+        case 39: goto L39;
+        case 43: goto L43;
+        case 45: goto L45;
+        case 54: goto L54;
+        case 57: goto L57;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 65: goto L65;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 84: goto L84;
+        case 86: goto L86;
+        case 90: goto L90;
+        case 93: goto L93;
+        case 95: goto L95;
+        case 99: goto L99;
+        case 102: goto L102;
+        case 105: goto L105;
+        case 106: goto L106;
+        case 107: goto L107;
+        case 108: goto L108;
+        case 109: goto L109;
+        case 115: goto L115;
+        case 116: goto L116;
+        case 117: goto L117;
+        case 118: goto L118;
+        case 119: goto L119;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 259;
+L9: /* VAR */
+L12: /* VAR */
+L14: /* STRING */
+    tp_aot_op(tp, f, code + 14);
+L23: /* FILE */
+    f->fname = regs[2];
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L28: /* NAME */
+    f->name = regs[2];
+L29: /* LINE */
+    f->line = code + 29;
+    f->lineno = 260;
+L36: /* VAR */
+L39: /* STRING */
+    tp_aot_op(tp, f, code + 39);
+L43: /* MGET */
+    tp_aot_op(tp, f, code + 43);
+L45: /* LINE */
+    f->line = code + 45;
+    f->lineno = 261;
+L54: /* STRING */
+    tp_aot_op(tp, f, code + 54);
+L57: /* MGET */
+    tp_aot_op(tp, f, code + 57);
+L59: /* NONE */
+    regs[5] = tp_None;
+L60: /* NUMBER */
+    tp_aot_op(tp, f, code + 60);
+L63: /* LIST */
+    tp_aot_op(tp, f, code + 63);
+L64: /* GET */
+    regs[4] = tp_get(tp, regs[4], regs[3]);
+    tp_grey(tp, regs[4]);
+L65: /* STRING */
+    tp_aot_op(tp, f, code + 65);
+L68: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[4]);
+L69: /* LINE */
+    f->line = code + 69;
+    f->lineno = 262;
+L84: /* VAR */
+L86: /* GGET */
+    tp_aot_op(tp, f, code + 86);
+L90: /* STRING */
+    tp_aot_op(tp, f, code + 90);
+L93: /* MGET */
+    tp_aot_op(tp, f, code + 93);
+L95: /* STRING */
+    tp_aot_op(tp, f, code + 95);
+L99: /* STRING */
+    tp_aot_op(tp, f, code + 99);
+L102: /* NUMBER */
+    tp_aot_op(tp, f, code + 102);
+L105: /* GET */
+    regs[3] = tp_get(tp, regs[2], regs[3]);
+    tp_grey(tp, regs[3]);
+L106: /* MOVE */
+    regs[4] = regs[0];
+L107: /* LIST */
+    tp_aot_op(tp, f, code + 107);
+L108: /* CALLP */
+    return code + 108;
+L109: /* LINE */
+    f->line = code + 109;
+    f->lineno = 263;
+L115: /* MOVE */
+    regs[5] = regs[1];
+L116: /* MOVE */
+    regs[6] = regs[4];
+L117: /* CALLP */
+    return code + 117;
+L118: /* RETURN */
+    return code + 118;
+L119: /* EOF */
+    return code + 119;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_6985(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 15: goto L15;
+        case 24: goto L24;
+        case 25: goto L25;
+        case 29: goto L29;
+        case 30: goto L30;
+        case 36: goto L36;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 47: goto L47;
+        case 49: goto L49;
+        case 52: goto L52;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 59: goto L59;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 65: goto L65;
+        case 66: goto L66;
+        case 67: goto L67;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 78: goto L78;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 85: goto L85;
+        case 90: goto L90;
+        case 91: goto L91;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 265;
+L9: /* VAR */
+L11: /* VAR */
+L13: /* VAR */
+L15: /* STRING */
+    tp_aot_op(tp, f, code + 15);
+L24: /* FILE */
+    f->fname = regs[3];
+L25: /* STRING */
+    tp_aot_op(tp, f, code + 25);
+L29: /* NAME */
+    f->name = regs[3];
+L30: /* LINE */
+    f->line = code + 30;
+    f->lineno = 266;
+L36: /* GGET */
+    tp_aot_op(tp, f, code + 36);
+L40: /* MOVE */
+    regs[5] = regs[2];
+L41: /* CALLP */
+    return code + 41;
+L42: /* LINE */
+    f->line = code + 42;
+    f->lineno = 267;
+L47: /* VAR */
+L49: /* GGET */
+    tp_aot_op(tp, f, code + 49);
+L52: /* MOVE */
+    regs[6] = regs[1];
+L53: /* CALLP */
+    return code + 53;
+L54: /* LINE */
+    f->line = code + 54;
+    f->lineno = 268;
+L59: /* GGET */
+    tp_aot_op(tp, f, code + 59);
+L63: /* MOVE */
+    regs[6] = regs[0];
+L64: /* MOVE */
+    regs[7] = regs[2];
+L65: /* MOVE */
+    regs[8] = regs[3];
+L66: /* CALLP */
+    return code + 66;
+L67: /* LINE */
+    f->line = code + 67;
+    f->lineno = 269;
+L75: /* NE */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[2].nint != regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 75);
+    }
+L76: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L78;
+    }
+L77: /* JUMP */
+    goto L85;
+L78: /* GGET */
+    tp_aot_op(tp, f, code + 78);
+L83: /* MOVE */
+    regs[6] = regs[3];
+L84: /* CALLP */
+    return code + 84;
+L85: /* LINE */
+    f->line = code + 85;
+    f->lineno = 270;
+L90: /* RETURN */
+    return code + 90;
+L91: /* EOF */
+    return code + 91;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_7111(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 10: goto L10;
+        case 12: goto L12;
+        case 14: goto L14;
+        case 16: goto L16;
+        case 18: goto L18;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 32: goto L32;
+        case 33: goto L33;
+        case 39: goto L39;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 45: goto L45;
+        case 53: goto L53;
+        case 56: goto L56;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 66: goto L66;
+        case 67: goto L67;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 76: goto L76;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 85: goto L85;
+        case 93: goto L93;
+        case 94: goto L94;
+        case 95: goto L95;
+        case 96: goto L96;
+        case 101: goto L101;
+        case 102: goto L102;
+        case 103: goto L103;
+        case 108: goto L108;
+        case 113: goto L113;
+        case 114: goto L114;
+        case 115: goto L115;
+        case 120: goto L120;
+        case 121: goto L121;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 272;
+L10: /* VAR */
+L12: /* VAR */
+L14: /* VAR */
+L16: /* VAR */
+L18: /* STRING */
+    tp_aot_op(tp, f, code + 18);
+L27: /* FILE */
+    f->fname = regs[4];
+L28: /* STRING */
+    tp_aot_op(tp, f, code + 28);
+L32: /* NAME */
+    f->name = regs[4];
+L33: /* LINE */
+    f->line = code + 33;
+    f->lineno = 273;
+L39: /* GGET */
+    tp_aot_op(tp, f, code + 39);
+L43: /* MOVE */
+    regs[6] = regs[3];
+L44: /* CALLP */
+    return code + 44;
+L45: /* LINE */
+    f->line = code + 45;
+    f->lineno = 274;
+L53: /* GGET */
+    tp_aot_op(tp, f, code + 53);
+L56: /* MOVE */
+    regs[7] = regs[1];
+L57: /* MOVE */
+    regs[8] = regs[3];
+L58: /* CALLP */
+    return code + 58;
+L59: /* GGET */
+    tp_aot_op(tp, f, code + 59);
+L62: /* MOVE */
+    regs[8] = regs[2];
+L63: /* CALLP */
+    return code + 63;
+L64: /* VAR */
+L66: /* MOVE */
+    regs[6] = regs[4];
+L67: /* VAR */
+L69: /* MOVE */
+    regs[4] = regs[5];
+L70: /* LINE */
+    f->line = code + 70;
+    f->lineno = 275;
+L76: /* GGET */
+    tp_aot_op(tp, f, code + 76);
+L80: /* MOVE */
+    regs[8] = regs[0];
+L81: /* MOVE */
+    regs[9] = regs[3];
+L82: /* MOVE */
+    regs[10] = regs[6];
+L83: /* MOVE */
+    regs[11] = regs[4];
+L84: /* CALLP */
+    return code + 84;
+L85: /* LINE */
+    f->line = code + 85;
+    f->lineno = 277;
+L93: /* NE */
+    if (TP_BOTH(regs[3], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[3].nint != regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 93);
+    }
+L94: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L96;
+    }
+L95: /* JUMP */
+    goto L103;
+L96: /* GGET */
+    tp_aot_op(tp, f, code + 96);
+L101: /* MOVE */
+    regs[8] = regs[6];
+L102: /* CALLP */
+    return code + 102;
+L103: /* LINE */
+    f->line = code + 103;
+    f->lineno = 278;
+L108: /* GGET */
+    tp_aot_op(tp, f, code + 108);
+L113: /* MOVE */
+    regs[8] = regs[4];
+L114: /* CALLP */
+    return code + 114;
+L115: /* LINE */
+    f->line = code + 115;
+    f->lineno = 279;
+L120: /* RETURN */
+    return code + 120;
+L121: /* EOF */
+    return code + 121;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_7269(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 12: goto L12;
+        case 14: goto L14;
+        case 16: goto L16;
+        case 18: goto L18;
+        case 20: goto L20;
+        case 29: goto L29;
+        case 30: goto L30;
+        case 36: goto L36;
+        case 37: goto L37;
+        case 43: goto L43;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 56: goto L56;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 61: goto L61;
+        case 64: goto L64;
+        case 65: goto L65;
+        case 66: goto L66;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 71: goto L71;
+        case 72: goto L72;
+        case 78: goto L78;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 85: goto L85;
+        case 86: goto L86;
+        case 87: goto L87;
+        case 93: goto L93;
+        case 94: goto L94;
+        case 95: goto L95;
+        case 96: goto L96;
+        case 97: goto L97;
+        case 98: goto L98;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 281;
+L12: /* VAR */
+L14: /* VAR */
+L16: /* VAR */
+L18: /* VAR */
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L29: /* FILE */
+    f->fname = regs[4];
+L30: /* STRING */
+    tp_aot_op(tp, f, code + 30);
+L36: /* NAME */
+    f->name = regs[4];
+L37: /* LINE */
+    f->line = code + 37;
+    f->lineno = 282;
+L43: /* GGET */
+    tp_aot_op(tp, f, code + 43);
+L47: /* MOVE */
+    regs[6] = regs[3];
+L48: /* CALLP */
+    return code + 48;
+L49: /* LINE */
+    f->line = code + 49;
+    f->lineno = 283;
+L56: /* GGET */
+    tp_aot_op(tp, f, code + 56);
+L59: /* MOVE */
+    regs[7] = regs[1];
+L60: /* CALLP */
+    return code + 60;
+L61: /* GGET */
+    tp_aot_op(tp, f, code + 61);
+L64: /* MOVE */
+    regs[8] = regs[2];
+L65: /* CALLP */
+    return code + 65;
+L66: /* VAR */
+L68: /* MOVE */
+    regs[6] = regs[4];
+L69: /* VAR */
+L71: /* MOVE */
+    regs[4] = regs[5];
+L72: /* LINE */
+    f->line = code + 72;
+    f->lineno = 284;
+L78: /* GGET */
+    tp_aot_op(tp, f, code + 78);
+L82: /* MOVE */
+    regs[8] = regs[0];
+L83: /* MOVE */
+    regs[9] = regs[3];
+L84: /* MOVE */
+    regs[10] = regs[6];
+L85: /* MOVE */
+    regs[11] = regs[4];
+L86: /* CALLP */
+    return code + 86;
+L87: /* LINE */
+    f->line = code + 87;
+    f->lineno = 286;
+L93: /* MOVE */
+    regs[7] = regs[3];
+L94: /* MOVE */
+    regs[8] = regs[6];
+L95: /* MOVE */
+    regs[9] = regs[4];
+L96: /* LIST */
+    tp_aot_op(tp, f, code + 96);
+L97: /* RETURN */
+    return code + 97;
+L98: /* EOF */
+    return code + 98;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_7407(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 13: goto L13;
+        case 15: goto L15;
+        case 17: goto L17;
+        case 19: goto L19;
+        case 21: goto L21;
+        case 30: goto L30;
+        case 31: goto L31;
+        case 36: goto L36;
+        case 37: goto L37;
+        case 43: goto L43;
+        case 45: goto L45;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 56: goto L56;
+        case 58: goto L58;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 94: goto L94;
+        case 97: goto L97;
+        case 98: goto L98;
+        case 99: goto L99;
+        case 100: goto L100;
+        case 104: goto L104;
+        case 107: goto L107;
+        case 108: goto L108;
+        case 109: goto L109;
+        case 110: goto L110;
+        case 120: goto L120;
+        case 123: goto L123;
+        case 124: goto L124;
+        case 125: goto L125;
+        case 126: goto L126;
+        case 130: goto L130;
+        case 133: goto L133;
+        case 134: goto L134;
+        case 135: goto L135;
+        case 141: goto L141;
+        case 145: goto L145;
+        case 146: goto L146;
+        case 149: goto L149;
+        case 150: goto L150;
+        case 154: goto L154;
+        case 155: goto L155;
+        case 161: goto L161;
+        case 164: goto L164;
+        case 165: goto L165;
+        case 166: goto L166;
+        case 167: goto L167;
+        case 177: goto L177;
+        case 178: goto L178;
+        case 179: goto L179;
+        case 180: goto L180;
+        case 185: goto L185;
+        case 186: goto L186;
+        case 187: goto L187;
+        case 193: goto L193;
+        case 196: goto L196;
+        case 197: goto L197;
+        case 200: goto L200;
+        case 201: goto L201;
+        case 206: goto L206;
+        case 207: goto L207;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 288;
+L13: /* VAR */
+L15: /* VAR */
+L17: /* VAR */
+L19: /* VAR */
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L30: /* FILE */
+    f->fname = regs[4];
+L31: /* STRING */
+    tp_aot_op(tp, f, code + 31);
+L36: /* NAME */
+    f->name = regs[4];
+L37: /* LINE */
+    f->line = code + 37;
+    f->lineno = 289;
+L43: /* VAR */
+L45: /* GGET */
+    tp_aot_op(tp, f, code + 45);
+L49: /* CALLP */
+    return code + 49;
+L50: /* LINE */
+    f->line = code + 50;
+    f->lineno = 290;
+L56: /* VAR */
+L58: /* GGET */
+    tp_aot_op(tp, f, code + 58);
+L61: /* MOVE */
+    regs[6] = regs[1];
+L62: /* MOVE */
+    regs[7] = regs[3];
+L63: /* CALLP */
+    return code + 63;
+L64: /* LINE */
+    f->line = code + 64;
+    f->lineno = 291;
+L74: /* NE */
+    if (TP_BOTH(regs[3], regs[1], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[3].nint != regs[1].nint);
+    } else {
+        tp_aot_op(tp, f, code + 74);
+    }
+L75: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L77;
+    }
+L76: /* JUMP */
+    goto L84;
+L77: /* GGET */
+    tp_aot_op(tp, f, code + 77);
+L82: /* MOVE */
+    regs[6] = regs[3];
+L83: /* CALLP */
+    return code + 83;
+L84: /* LINE */
+    f->line = code + 84;
+    f->lineno = 292;
+L94: /* STRING */
+    tp_aot_op(tp, f, code + 94);
+L97: /* EQ */
+    if (TP_BOTH(regs[0], regs[5], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[0].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 97);
+    }
+L98: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L100;
+    }
+L99: /* JUMP */
+    goto L110;
+L100: /* GGET */
+    tp_aot_op(tp, f, code + 100);
+L104: /* GGET */
+    tp_aot_op(tp, f, code + 104);
+L107: /* MOVE */
+    regs[7] = regs[1];
+L108: /* CALLP */
+    return code + 108;
+L109: /* JUMP */
+    goto L135;
+L110: /* LINE */
+    f->line = code + 110;
+    f->lineno = 293;
+L120: /* STRING */
+    tp_aot_op(tp, f, code + 120);
+L123: /* EQ */
+    if (TP_BOTH(regs[0], regs[5], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[0].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 123);
+    }
+L124: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L126;
+    }
+L125: /* JUMP */
+    goto L135;
+L126: /* GGET */
+    tp_aot_op(tp, f, code + 126);
+L130: /* GGET */
+    tp_aot_op(tp, f, code + 130);
+L133: /* MOVE */
+    regs[7] = regs[1];
+L134: /* CALLP */
+    return code + 134;
+L135: /* LINE */
+    f->line = code + 135;
+    f->lineno = 294;
+L141: /* GGET */
+    tp_aot_op(tp, f, code + 141);
+L145: /* MOVE */
+    regs[6] = regs[4];
+L146: /* STRING */
+    tp_aot_op(tp, f, code + 146);
+L149: /* CALLP */
+    return code + 149;
+L150: /* LINE */
+    f->line = code + 150;
+    f->lineno = 295;
+L154: /* MOVE */
+    regs[3] = regs[1];
+L155: /* LINE */
+    f->line = code + 155;
+    f->lineno = 296;
+L161: /* GGET */
+    tp_aot_op(tp, f, code + 161);
+L164: /* MOVE */
+    regs[6] = regs[2];
+L165: /* MOVE */
+    regs[7] = regs[3];
+L166: /* CALLP */
+    return code + 166;
+L167: /* LINE */
+    f->line = code + 167;
+    f->lineno = 297;
+L177: /* NE */
+    if (TP_BOTH(regs[3], regs[1], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[3].nint != regs[1].nint);
+    } else {
+        tp_aot_op(tp, f, code + 177);
+    }
+L178: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L180;
+    }
+L179: /* JUMP */
+    goto L187;
+L180: /* GGET */
+    tp_aot_op(tp, f, code + 180);
+L185: /* MOVE */
+    regs[6] = regs[3];
+L186: /* CALLP */
+    return code + 186;
+L187: /* LINE */
+    f->line = code + 187;
+    f->lineno = 298;
+L193: /* GGET */
+    tp_aot_op(tp, f, code + 193);
+L196: /* MOVE */
+    regs[6] = regs[4];
+L197: /* STRING */
+    tp_aot_op(tp, f, code + 197);
+L200: /* CALLP */
+    return code + 200;
+L201: /* LINE */
+    f->line = code + 201;
+    f->lineno = 299;
+L206: /* RETURN */
+    return code + 206;
+L207: /* EOF */
+    return code + 207;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_7640(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 26: goto L26;
+        case 27: goto L27;
+        case 33: goto L33;
+        case 37: goto L37;
+        case 38: goto L38;
+        case 39: goto L39;
+        case 45: goto L45;
+        case 49: goto L49;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 55: goto L55;
+        case 60: goto L60;
+        case 61: goto L61;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 301;
+L9: /* VAR */
+L11: /* STRING */
+    tp_aot_op(tp, f, code + 11);
+L20: /* FILE */
+    f->fname = regs[1];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L26: /* NAME */
+    f->name = regs[1];
+L27: /* LINE */
+    f->line = code + 27;
+    f->lineno = 302;
+L33: /* GGET */
+    tp_aot_op(tp, f, code + 33);
+L37: /* MOVE */
+    regs[2] = regs[0];
+L38: /* CALLP */
+    return code + 38;
+L39: /* LINE */
+    f->line = code + 39;
+    f->lineno = 303;
+L45: /* GGET */
+    tp_aot_op(tp, f, code + 45);
+L49: /* GGET */
+    tp_aot_op(tp, f, code + 49);
+L53: /* MOVE */
+    regs[3] = regs[0];
+L54: /* CALLP */
+    return code + 54;
+L55: /* LINE */
+    f->line = code + 55;
+    f->lineno = 304;
+L60: /* RETURN */
+    return code + 60;
+L61: /* EOF */
+    return code + 61;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_7736(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 16: goto L16;
+        case 18: goto L18;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 32: goto L32;
+        case 33: goto L33;
+        case 39: goto L39;
+        case 42: goto L42;
+        case 46: goto L46;
+        case 48: goto L48;
+        case 56: goto L56;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 66: goto L66;
+        case 67: goto L67;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 75: goto L75;
+        case 77: goto L77;
+        case 80: goto L80;
+        case 82: goto L82;
+        case 86: goto L86;
+        case 88: goto L88;
+        case 91: goto L91;
+        case 99: goto L99;
+        case 102: goto L102;
+        case 103: goto L103;
+        case 104: goto L104;
+        case 105: goto L105;
+        case 108: goto L108;
+        case 116: goto L116;
+        case 119: goto L119;
+        case 120: goto L120;
+        case 121: goto L121;
+        case 122: goto L122;
+        case 125: goto L125;
+        case 133: goto L133;
+        case 136: goto L136;
+        case 137: goto L137;
+        case 138: goto L138;
+        case 139: goto L139;
+        case 142: goto L142;
+        case 150: goto L150;
+        case 153: goto L153;
+        case 154: goto L154;
+        case 155: goto L155;
+        case 156: goto L156;
+        case 159: goto L159;
+        case 167: goto L167;
+        case 170: goto L170;
+        case 171: goto L171;
+        case 172: goto L172;
+        case 173: goto L173;
+        case 176: goto L176;
+        case 184: goto L184;
+        case 187: goto L187;
+        case 188: goto L188;
+        case 189: goto L189;
+        case 190: goto L190;
+        case 193: goto L193;
+        case 202: goto L202;
+        case 206: goto L206;
+        case 207: goto L207;
+        case 208: goto L208;
+        case 209: goto L209;
+        case 212: goto L212;
+        case 218: goto L218;
+        case 221: goto L221;
+        case 222: goto L222;
+        case 223: goto L223;
+        case 224: goto L224;
+        case 229: goto L229;
+        case 232: goto L232;
+        case 239: goto L239;
+        case 243: goto L243;
+        case 244: goto L244;
+        case 245: goto L245;
+        case 246: goto L246;
+        case 252: goto L252;
+        case 256: goto L256;
+        case 261: goto L261;
+        case 262: goto L262;
+        case 263: goto L263;
+        case 274: goto L274;
+        case 280: goto L280;
+        case 281: goto L281;
+        case 282: goto L282;
+        case 283: goto L283;
+        case 284: goto L284;
+        case 285: goto L285;
+        case 286: goto L286;
+        case 295: goto L295;
+        case 299: goto L299;
+        case 300: goto L300;
+        case 301: goto L301;
+        case 302: goto L302;
+        case 303: goto L303;
+        case 304: goto L304;
+        case 305: goto L305;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 306;
+L11: /* VAR */
+L13: /* VAR */
+L16: /* VAR */
+L18: /* STRING */
+    tp_aot_op(tp, f, code + 18);
+L27: /* FILE */
+    f->fname = regs[3];
+L28: /* STRING */
+    tp_aot_op(tp, f, code + 28);
+L32: /* NAME */
+    f->name = regs[3];
+L33: /* LINE */
+    f->line = code + 33;
+    f->lineno = 307;
+L39: /* VAR */
+L42: /* STRING */
+    tp_aot_op(tp, f, code + 42);
+L46: /* MGET */
+    tp_aot_op(tp, f, code + 46);
+L48: /* LINE */
+    f->line = code + 48;
+    f->lineno = 308;
+L56: /* NUMBER */
+    tp_aot_op(tp, f, code + 56);
+L59: /* GET */
+    regs[5] = tp_get(tp, regs[3], regs[4]);
+    tp_grey(tp, regs[5]);
+L60: /* NUMBER */
+    tp_aot_op(tp, f, code + 60);
+L63: /* GET */
+    regs[3] = tp_get(tp, regs[3], regs[6]);
+    tp_grey(tp, regs[3]);
+L64: /* VAR */
+L66: /* MOVE */
+    regs[4] = regs[5];
+L67: /* VAR */
+L69: /* MOVE */
+    regs[5] = regs[3];
+L70: /* LINE */
+    f->line = code + 70;
+    f->lineno = 309;
+L75: /* VAR */
+L77: /* STRING */
+    tp_aot_op(tp, f, code + 77);
+L80: /* MGET */
+    tp_aot_op(tp, f, code + 80);
+L82: /* LINE */
+    f->line = code + 82;
+    f->lineno = 310;
+L86: /* VAR */
+L88: /* GGET */
+    tp_aot_op(tp, f, code + 88);
+L91: /* LINE */
+    f->line = code + 91;
+    f->lineno = 311;
+L99: /* STRING */
+    tp_aot_op(tp, f, code + 99);
+L102: /* EQ */
+    if (TP_BOTH(regs[3], regs[7], TP_NUMBER_INT)) {
+        regs[7] = tp_bool(regs[3].nint == regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 102);
+    }
+L103: /* IF */
+    if (TP_IS_INT(regs[7]) ? regs[7].nint != 0 : tp_true(tp, regs[7])) {
+        goto L105;
+    }
+L104: /* JUMP */
+    goto L108;
+L105: /* GGET */
+    tp_aot_op(tp, f, code + 105);
+L108: /* LINE */
+    f->line = code + 108;
+    f->lineno = 312;
+L116: /* STRING */
+    tp_aot_op(tp, f, code + 116);
+L119: /* EQ */
+    if (TP_BOTH(regs[3], regs[7], TP_NUMBER_INT)) {
+        regs[7] = tp_bool(regs[3].nint == regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 119);
+    }
+L120: /* IF */
+    if (TP_IS_INT(regs[7]) ? regs[7].nint != 0 : tp_true(tp, regs[7])) {
+        goto L122;
+    }
+L121: /* JUMP */
+    goto L125;
+L122: /* GGET */
+    tp_aot_op(tp, f, code + 122);
+L125: /* LINE */
+    f->line = code + 125;
+    f->lineno = 313;
+L133: /* STRING */
+    tp_aot_op(tp, f, code + 133);
+L136: /* EQ */
+    if (TP_BOTH(regs[3], regs[7], TP_NUMBER_INT)) {
+        regs[7] = tp_bool(regs[3].nint == regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 136);
+    }
+L137: /* IF */
+    if (TP_IS_INT(regs[7]) ? regs[7].nint != 0 : tp_true(tp, regs[7])) {
+        goto L139;
+    }
+L138: /* JUMP */
+    goto L142;
+L139: /* GGET */
+    tp_aot_op(tp, f, code + 139);
+L142: /* LINE */
+    f->line = code + 142;
+    f->lineno = 314;
+L150: /* STRING */
+    tp_aot_op(tp, f, code + 150);
+L153: /* EQ */
+    if (TP_BOTH(regs[3], regs[7], TP_NUMBER_INT)) {
+        regs[7] = tp_bool(regs[3].nint == regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 153);
+    }
+L154: /* IF */
+    if (TP_IS_INT(regs[7]) ? regs[7].nint != 0 : tp_true(tp, regs[7])) {
+        goto L156;
+    }
+L155: /* JUMP */
+    goto L159;
+L156: /* GGET */
+    tp_aot_op(tp, f, code + 156);
+L159: /* LINE */
+    f->line = code + 159;
+    f->lineno = 315;
+L167: /* STRING */
+    tp_aot_op(tp, f, code + 167);
+L170: /* EQ */
+    if (TP_BOTH(regs[3], regs[7], TP_NUMBER_INT)) {
+        regs[7] = tp_bool(regs[3].nint == regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 170);
+    }
+L171: /* IF */
+    if (TP_IS_INT(regs[7]) ? regs[7].nint != 0 : tp_true(tp, regs[7])) {
+        goto L173;
+    }
+L172: /* JUMP */
+    goto L176;
+L173: /* GGET */
+    tp_aot_op(tp, f, code + 173);
+L176: /* LINE */
+    f->line = code + 176;
+    f->lineno = 316;
+L184: /* STRING */
+    tp_aot_op(tp, f, code + 184);
+L187: /* EQ */
+    if (TP_BOTH(regs[3], regs[7], TP_NUMBER_INT)) {
+        regs[7] = tp_bool(regs[3].nint == regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 187);
+    }
+L188: /* IF */
+    if (TP_IS_INT(regs[7]) ? regs[7].nint != 0 : tp_true(tp, regs[7])) {
+        goto L190;
+    }
+L189: /* JUMP */
+    goto L193;
+L190: /* GGET */
+    tp_aot_op(tp, f, code + 190);
+L193: /* LINE */
+    f->line = code + 193;
+    f->lineno = 317;
+L202: /* STRING */
+    tp_aot_op(tp, f, code + 202);
+L206: /* EQ */
+    if (TP_BOTH(regs[3], regs[7], TP_NUMBER_INT)) {
+        regs[7] = tp_bool(regs[3].nint == regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 206);
+    }
+L207: /* IF */
+    if (TP_IS_INT(regs[7]) ? regs[7].nint != 0 : tp_true(tp, regs[7])) {
+        goto L209;
+    }
+L208: /* JUMP */
+    goto L212;
+L209: /* GGET */
+    tp_aot_op(tp, f, code + 209);
+L212: /* LINE */
+    f->line = code + 212;
+    f->lineno = 318;
+L218: /* STRING */
+    tp_aot_op(tp, f, code + 218);
+L221: /* EQ */
+    if (TP_BOTH(regs[3], regs[7], TP_NUMBER_INT)) {
+        regs[7] = tp_bool(regs[3].nint == regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 221);
+    }
+L222: /* IF */
+    if (TP_IS_INT(regs[7]) ? regs[7].nint != 0 : tp_true(tp, regs[7])) {
+        goto L224;
+    }
+L223: /* JUMP */
+    goto L232;
+L224: /* LINE */
+    f->line = code + 224;
+    f->lineno = 319;
+L229: /* GGET */
+    tp_aot_op(tp, f, code + 229);
+L232: /* LINE */
+    f->line = code + 232;
+    f->lineno = 320;
+L239: /* STRING */
+    tp_aot_op(tp, f, code + 239);
+L243: /* EQ */
+    if (TP_BOTH(regs[3], regs[7], TP_NUMBER_INT)) {
+        regs[7] = tp_bool(regs[3].nint == regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 243);
+    }
+L244: /* IF */
+    if (TP_IS_INT(regs[7]) ? regs[7].nint != 0 : tp_true(tp, regs[7])) {
+        goto L246;
+    }
+L245: /* JUMP */
+    goto L256;
+L246: /* LINE */
+    f->line = code + 246;
+    f->lineno = 321;
+L252: /* GGET */
+    tp_aot_op(tp, f, code + 252);
+L256: /* LINE */
+    f->line = code + 256;
+    f->lineno = 322;
+L261: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L263;
+    }
+L262: /* JUMP */
+    goto L286;
+L263: /* LINE */
+    f->line = code + 263;
+    f->lineno = 323;
+L274: /* GGET */
+    tp_aot_op(tp, f, code + 274);
+L280: /* MOVE */
+    regs[8] = regs[6];
+L281: /* MOVE */
+    regs[9] = regs[4];
+L282: /* MOVE */
+    regs[10] = regs[5];
+L283: /* MOVE */
+    regs[11] = regs[2];
+L284: /* CALLP */
+    return code + 284;
+L285: /* RETURN */
+    return code + 285;
+L286: /* LINE */
+    f->line = code + 286;
+    f->lineno = 325;
+L295: /* GGET */
+    tp_aot_op(tp, f, code + 295);
+L299: /* MOVE */
+    regs[8] = regs[6];
+L300: /* MOVE */
+    regs[9] = regs[4];
+L301: /* MOVE */
+    regs[10] = regs[5];
+L302: /* MOVE */
+    regs[11] = regs[2];
+L303: /* CALLP */
+    return code + 303;
+L304: /* RETURN */
+    return code + 304;
+L305: /* EOF */
+    return code + 305;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_8070(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 10: goto L10;
+        case 12: goto L12;
+        case 14: goto L14;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 29: goto L29;
+        case 30: goto L30;
+        case 36: goto L36;
+        case 39: goto L39;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 57: goto L57;
+        case 60: goto L60;
+        case 63: goto L63;
+        case 66: goto L66;
+        case 69: goto L69;
+        case 72: goto L72;
+        case 75: goto L75;
+        case 78: goto L78;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 101: goto L101;
+        case 104: goto L104;
+        case 107: goto L107;
+        case 110: goto L110;
+        case 113: goto L113;
+        case 116: goto L116;
+        case 119: goto L119;
+        case 122: goto L122;
+        case 125: goto L125;
+        case 128: goto L128;
+        case 132: goto L132;
+        case 136: goto L136;
+        case 137: goto L137;
+        case 142: goto L142;
+        case 145: goto L145;
+        case 157: goto L157;
+        case 160: goto L160;
+        case 163: goto L163;
+        case 166: goto L166;
+        case 169: goto L169;
+        case 172: goto L172;
+        case 175: goto L175;
+        case 178: goto L178;
+        case 181: goto L181;
+        case 187: goto L187;
+        case 190: goto L190;
+        case 193: goto L193;
+        case 203: goto L203;
+        case 206: goto L206;
+        case 209: goto L209;
+        case 212: goto L212;
+        case 215: goto L215;
+        case 218: goto L218;
+        case 221: goto L221;
+        case 233: goto L233;
+        case 236: goto L236;
+        case 240: goto L240;
+        case 243: goto L243;
+        case 247: goto L247;
+        case 250: goto L250;
+        case 254: goto L254;
+        case 255: goto L255;
+        case 267: goto L267;
+        case 270: goto L270;
+        case 272: goto L272;
+        case 276: goto L276;
+        case 277: goto L277;
+        case 278: goto L278;
+        case 279: goto L279;
+        case 284: goto L284;
+        case 285: goto L285;
+        case 286: goto L286;
+        case 287: goto L287;
+        case 294: goto L294;
+        case 297: goto L297;
+        case 299: goto L299;
+        case 303: goto L303;
+        case 304: goto L304;
+        case 305: goto L305;
+        case 306: goto L306;
+        case 315: goto L315;
+        case 320: goto L320;
+        case 323: goto L323;
+        case 324: goto L324;
+        case 325: goto L325;
+        case 326: goto L326;
+        case 334: goto L334;
+        case 337: goto L337;
+        case 339: goto L339;
+        case 343: goto L343;
+        case 344: goto L344;
+        case 345: goto L345;
+        case 346: goto L346;
+        case 355: goto L355;
+        case 360: goto L360;
+        case 363: goto L363;
+        case 364: goto L364;
+        case 365: goto L365;
+        case 366: goto L366;
+        case 372: goto L372;
+        case 375: goto L375;
+        case 379: goto L379;
+        case 381: goto L381;
+        case 390: goto L390;
+        case 393: goto L393;
+        case 395: goto L395;
+        case 398: goto L398;
+        case 401: goto L401;
+        case 402: goto L402;
+        case 403: goto L403;
+        case 404: goto L404;
+        case 405: goto L405;
+        case 421: goto L421;
+        case 426: goto L426;
+        case 429: goto L429;
+        case 431: goto L431;
+        case 434: goto L434;
+        case 435: goto L435;
+        case 438: goto L438;
+        case 439: goto L439;
+        case 440: goto L440;
+        case 441: goto L441;
+        case 442: goto L442;
+        case 449: goto L449;
+        case 452: goto L452;
+        case 454: goto L454;
+        case 455: goto L455;
+        case 456: goto L456;
+        case 457: goto L457;
+        case 467: goto L467;
+        case 471: goto L471;
+        case 472: goto L472;
+        case 477: goto L477;
+        case 478: goto L478;
+        case 479: goto L479;
+        case 486: goto L486;
+        case 489: goto L489;
+        case 491: goto L491;
+        case 494: goto L494;
+        case 495: goto L495;
+        case 496: goto L496;
+        case 497: goto L497;
+        case 508: goto L508;
+        case 512: goto L512;
+        case 515: goto L515;
+        case 518: goto L518;
+        case 519: goto L519;
+        case 520: goto L520;
+        case 521: goto L521;
+        case 522: goto L522;
+        case 529: goto L529;
+        case 532: goto L532;
+        case 534: goto L534;
+        case 535: goto L535;
+        case 536: goto L536;
+        case 537: goto L537;
+        case 550: goto L550;
+        case 555: goto L555;
+        case 558: goto L558;
+        case 559: goto L559;
+        case 562: goto L562;
+        case 563: goto L563;
+        case 564: goto L564;
+        case 565: goto L565;
+        case 572: goto L572;
+        case 575: goto L575;
+        case 577: goto L577;
+        case 578: goto L578;
+        case 579: goto L579;
+        case 580: goto L580;
+        case 590: goto L590;
+        case 594: goto L594;
+        case 595: goto L595;
+        case 598: goto L598;
+        case 599: goto L599;
+        case 600: goto L600;
+        case 601: goto L601;
+        case 616: goto L616;
+        case 620: goto L620;
+        case 623: goto L623;
+        case 625: goto L625;
+        case 626: goto L626;
+        case 629: goto L629;
+        case 630: goto L630;
+        case 633: goto L633;
+        case 634: goto L634;
+        case 635: goto L635;
+        case 636: goto L636;
+        case 637: goto L637;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 327;
+L10: /* VAR */
+L12: /* VAR */
+L14: /* STRING */
+    tp_aot_op(tp, f, code + 14);
+L23: /* FILE */
+    f->fname = regs[2];
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L29: /* NAME */
+    f->name = regs[2];
+L30: /* LINE */
+    f->line = code + 30;
+    f->lineno = 328;
+L36: /* VAR */
+L39: /* STRING */
+    tp_aot_op(tp, f, code + 39);
+L42: /* LIST */
+    tp_aot_op(tp, f, code + 42);
+L43: /* LINE */
+    f->line = code + 43;
+    f->lineno = 329;
+L57: /* VAR */
+L60: /* STRING */
+    tp_aot_op(tp, f, code + 60);
+L63: /* STRING */
+    tp_aot_op(tp, f, code + 63);
+L66: /* STRING */
+    tp_aot_op(tp, f, code + 66);
+L69: /* STRING */
+    tp_aot_op(tp, f, code + 69);
+L72: /* STRING */
+    tp_aot_op(tp, f, code + 72);
+L75: /* STRING */
+    tp_aot_op(tp, f, code + 75);
+L78: /* STRING */
+    tp_aot_op(tp, f, code + 78);
+L81: /* LIST */
+    tp_aot_op(tp, f, code + 81);
+L82: /* LINE */
+    f->line = code + 82;
+    f->lineno = 330;
+L101: /* VAR */
+L104: /* STRING */
+    tp_aot_op(tp, f, code + 104);
+L107: /* STRING */
+    tp_aot_op(tp, f, code + 107);
+L110: /* STRING */
+    tp_aot_op(tp, f, code + 110);
+L113: /* STRING */
+    tp_aot_op(tp, f, code + 113);
+L116: /* STRING */
+    tp_aot_op(tp, f, code + 116);
+L119: /* STRING */
+    tp_aot_op(tp, f, code + 119);
+L122: /* STRING */
+    tp_aot_op(tp, f, code + 122);
+L125: /* STRING */
+    tp_aot_op(tp, f, code + 125);
+L128: /* STRING */
+    tp_aot_op(tp, f, code + 128);
+L132: /* STRING */
+    tp_aot_op(tp, f, code + 132);
+L136: /* LIST */
+    tp_aot_op(tp, f, code + 136);
+L137: /* LINE */
+    f->line = code + 137;
+    f->lineno = 331;
+L142: /* VAR */
+L145: /* LINE */
+    f->line = code + 145;
+    f->lineno = 332;
+L157: /* STRING */
+    tp_aot_op(tp, f, code + 157);
+L160: /* GGET */
+    tp_aot_op(tp, f, code + 160);
+L163: /* STRING */
+    tp_aot_op(tp, f, code + 163);
+L166: /* GGET */
+    tp_aot_op(tp, f, code + 166);
+L169: /* STRING */
+    tp_aot_op(tp, f, code + 169);
+L172: /* GGET */
+    tp_aot_op(tp, f, code + 172);
+L175: /* STRING */
+    tp_aot_op(tp, f, code + 175);
+L178: /* GGET */
+    tp_aot_op(tp, f, code + 178);
+L181: /* LINE */
+    f->line = code + 181;
+    f->lineno = 333;
+L187: /* STRING */
+    tp_aot_op(tp, f, code + 187);
+L190: /* GGET */
+    tp_aot_op(tp, f, code + 190);
+L193: /* LINE */
+    f->line = code + 193;
+    f->lineno = 334;
+L203: /* STRING */
+    tp_aot_op(tp, f, code + 203);
+L206: /* GGET */
+    tp_aot_op(tp, f, code + 206);
+L209: /* STRING */
+    tp_aot_op(tp, f, code + 209);
+L212: /* GGET */
+    tp_aot_op(tp, f, code + 212);
+L215: /* STRING */
+    tp_aot_op(tp, f, code + 215);
+L218: /* GGET */
+    tp_aot_op(tp, f, code + 218);
+L221: /* LINE */
+    f->line = code + 221;
+    f->lineno = 335;
+L233: /* STRING */
+    tp_aot_op(tp, f, code + 233);
+L236: /* GGET */
+    tp_aot_op(tp, f, code + 236);
+L240: /* STRING */
+    tp_aot_op(tp, f, code + 240);
+L243: /* GGET */
+    tp_aot_op(tp, f, code + 243);
+L247: /* STRING */
+    tp_aot_op(tp, f, code + 247);
+L250: /* GGET */
+    tp_aot_op(tp, f, code + 250);
+L254: /* DICT */
+    tp_aot_op(tp, f, code + 254);
+L255: /* LINE */
+    f->line = code + 255;
+    f->lineno = 337;
+L267: /* STRING */
+    tp_aot_op(tp, f, code + 267);
+L270: /* MGET */
+    tp_aot_op(tp, f, code + 270);
+L272: /* STRING */
+    tp_aot_op(tp, f, code + 272);
+L276: /* EQ */
+    if (TP_BOTH(regs[5], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[5].nint == regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 276);
+    }
+L277: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L279;
+    }
+L278: /* JUMP */
+    goto L287;
+L279: /* GGET */
+    tp_aot_op(tp, f, code + 279);
+L284: /* MOVE */
+    regs[7] = regs[1];
+L285: /* CALLP */
+    return code + 285;
+L286: /* RETURN */
+    return code + 286;
+L287: /* LINE */
+    f->line = code + 287;
+    f->lineno = 338;
+L294: /* STRING */
+    tp_aot_op(tp, f, code + 294);
+L297: /* MGET */
+    tp_aot_op(tp, f, code + 297);
+L299: /* STRING */
+    tp_aot_op(tp, f, code + 299);
+L303: /* EQ */
+    if (TP_BOTH(regs[5], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[5].nint == regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 303);
+    }
+L304: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L306;
+    }
+L305: /* JUMP */
+    goto L326;
+L306: /* LINE */
+    f->line = code + 306;
+    f->lineno = 339;
+L315: /* GGET */
+    tp_aot_op(tp, f, code + 315);
+L320: /* NUMBER */
+    tp_aot_op(tp, f, code + 320);
+L323: /* MOVE */
+    regs[8] = regs[1];
+L324: /* CALLP */
+    return code + 324;
+L325: /* RETURN */
+    return code + 325;
+L326: /* LINE */
+    f->line = code + 326;
+    f->lineno = 340;
+L334: /* STRING */
+    tp_aot_op(tp, f, code + 334);
+L337: /* MGET */
+    tp_aot_op(tp, f, code + 337);
+L339: /* STRING */
+    tp_aot_op(tp, f, code + 339);
+L343: /* EQ */
+    if (TP_BOTH(regs[5], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[5].nint == regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 343);
+    }
+L344: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L346;
+    }
+L345: /* JUMP */
+    goto L366;
+L346: /* LINE */
+    f->line = code + 346;
+    f->lineno = 341;
+L355: /* GGET */
+    tp_aot_op(tp, f, code + 355);
+L360: /* NUMBER */
+    tp_aot_op(tp, f, code + 360);
+L363: /* MOVE */
+    regs[8] = regs[1];
+L364: /* CALLP */
+    return code + 364;
+L365: /* RETURN */
+    return code + 365;
+L366: /* LINE */
+    f->line = code + 366;
+    f->lineno = 342;
+L372: /* VAR */
+L375: /* STRING */
+    tp_aot_op(tp, f, code + 375);
+L379: /* MGET */
+    tp_aot_op(tp, f, code + 379);
+L381: /* LINE */
+    f->line = code + 381;
+    f->lineno = 344;
+L390: /* STRING */
+    tp_aot_op(tp, f, code + 390);
+L393: /* MGET */
+    tp_aot_op(tp, f, code + 393);
+L395: /* STRING */
+    tp_aot_op(tp, f, code + 395);
+L398: /* STRING */
+    tp_aot_op(tp, f, code + 398);
+L401: /* LIST */
+    tp_aot_op(tp, f, code + 401);
+L402: /* IN */
+    regs[6] = tp_has(tp, regs[7], regs[6]);
+L403: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L405;
+    }
+L404: /* JUMP */
+    goto L442;
+L405: /* LINE */
+    f->line = code + 405;
+    f->lineno = 345;
+L421: /* GGET */
+    tp_aot_op(tp, f, code + 421);
+L426: /* STRING */
+    tp_aot_op(tp, f, code + 426);
+L429: /* MGET */
+    tp_aot_op(tp, f, code + 429);
+L431: /* NUMBER */
+    tp_aot_op(tp, f, code + 431);
+L434: /* GET */
+    regs[9] = tp_get(tp, regs[5], regs[12]);
+    tp_grey(tp, regs[9]);
+L435: /* NUMBER */
+    tp_aot_op(tp, f, code + 435);
+L438: /* GET */
+    regs[10] = tp_get(tp, regs[5], regs[12]);
+    tp_grey(tp, regs[10]);
+L439: /* MOVE */
+    regs[11] = regs[1];
+L440: /* CALLP */
+    return code + 440;
+L441: /* RETURN */
+    return code + 441;
+L442: /* LINE */
+    f->line = code + 442;
+    f->lineno = 346;
+L449: /* STRING */
+    tp_aot_op(tp, f, code + 449);
+L452: /* MGET */
+    tp_aot_op(tp, f, code + 452);
+L454: /* IN */
+    regs[6] = tp_has(tp, regs[28], regs[6]);
+L455: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L457;
+    }
+L456: /* JUMP */
+    goto L479;
+L457: /* LINE */
+    f->line = code + 457;
+    f->lineno = 347;
+L467: /* GGET */
+    tp_aot_op(tp, f, code + 467);
+L471: /* MOVE */
+    regs[8] = regs[0];
+L472: /* GGET */
+    tp_aot_op(tp, f, code + 472);
+L477: /* CALLP */
+    return code + 477;
+L478: /* RETURN */
+    return code + 478;
+L479: /* LINE */
+    f->line = code + 479;
+    f->lineno = 348;
+L486: /* STRING */
+    tp_aot_op(tp, f, code + 486);
+L489: /* MGET */
+    tp_aot_op(tp, f, code + 489);
+L491: /* STRING */
+    tp_aot_op(tp, f, code + 491);
+L494: /* EQ */
+    if (TP_BOTH(regs[6], regs[7], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[6].nint == regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 494);
+    }
+L495: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L497;
+    }
+L496: /* JUMP */
+    goto L522;
+L497: /* LINE */
+    f->line = code + 497;
+    f->lineno = 349;
+L508: /* GGET */
+    tp_aot_op(tp, f, code + 508);
+L512: /* GGET */
+    tp_aot_op(tp, f, code + 512);
+L515: /* NUMBER */
+    tp_aot_op(tp, f, code + 515);
+L518: /* GET */
+    regs[9] = tp_get(tp, regs[5], regs[11]);
+    tp_grey(tp, regs[9]);
+L519: /* MOVE */
+    regs[10] = regs[1];
+L520: /* CALLP */
+    return code + 520;
+L521: /* RETURN */
+    return code + 521;
+L522: /* LINE */
+    f->line = code + 522;
+    f->lineno = 350;
+L529: /* STRING */
+    tp_aot_op(tp, f, code + 529);
+L532: /* MGET */
+    tp_aot_op(tp, f, code + 532);
+L534: /* IN */
+    regs[6] = tp_has(tp, regs[2], regs[6]);
+L535: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L537;
+    }
+L536: /* JUMP */
+    goto L565;
+L537: /* LINE */
+    f->line = code + 537;
+    f->lineno = 351;
+L550: /* GGET */
+    tp_aot_op(tp, f, code + 550);
+L555: /* NUMBER */
+    tp_aot_op(tp, f, code + 555);
+L558: /* GET */
+    regs[8] = tp_get(tp, regs[5], regs[10]);
+    tp_grey(tp, regs[8]);
+L559: /* NUMBER */
+    tp_aot_op(tp, f, code + 559);
+L562: /* GET */
+    regs[9] = tp_get(tp, regs[5], regs[10]);
+    tp_grey(tp, regs[9]);
+L563: /* CALLP */
+    return code + 563;
+L564: /* RETURN */
+    return code + 564;
+L565: /* LINE */
+    f->line = code + 565;
+    f->lineno = 352;
+L572: /* STRING */
+    tp_aot_op(tp, f, code + 572);
+L575: /* MGET */
+    tp_aot_op(tp, f, code + 575);
+L577: /* IN */
+    regs[6] = tp_has(tp, regs[3], regs[6]);
+L578: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L580;
+    }
+L579: /* JUMP */
+    goto L601;
+L580: /* LINE */
+    f->line = code + 580;
+    f->lineno = 353;
+L590: /* GGET */
+    tp_aot_op(tp, f, code + 590);
+L594: /* MOVE */
+    regs[8] = regs[0];
+L595: /* NUMBER */
+    tp_aot_op(tp, f, code + 595);
+L598: /* MOVE */
+    regs[10] = regs[1];
+L599: /* CALLP */
+    return code + 599;
+L600: /* RETURN */
+    return code + 600;
+L601: /* LINE */
+    f->line = code + 601;
+    f->lineno = 355;
+L616: /* GGET */
+    tp_aot_op(tp, f, code + 616);
+L620: /* STRING */
+    tp_aot_op(tp, f, code + 620);
+L623: /* MGET */
+    tp_aot_op(tp, f, code + 623);
+L625: /* GET */
+    regs[8] = tp_get(tp, regs[4], regs[12]);
+    tp_grey(tp, regs[8]);
+L626: /* NUMBER */
+    tp_aot_op(tp, f, code + 626);
+L629: /* GET */
+    regs[9] = tp_get(tp, regs[5], regs[12]);
+    tp_grey(tp, regs[9]);
+L630: /* NUMBER */
+    tp_aot_op(tp, f, code + 630);
+L633: /* GET */
+    regs[10] = tp_get(tp, regs[5], regs[12]);
+    tp_grey(tp, regs[10]);
+L634: /* MOVE */
+    regs[11] = regs[1];
+L635: /* CALLP */
+    return code + 635;
+L636: /* RETURN */
+    return code + 636;
+L637: /* EOF */
+    return code + 637;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_8735(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 22: goto L22;
+        case 23: goto L23;
+        case 28: goto L28;
+        case 29: goto L29;
+        case 37: goto L37;
+        case 41: goto L41;
+        case 43: goto L43;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 70: goto L70;
+        case 73: goto L73;
+        case 78: goto L78;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 85: goto L85;
+        case 87: goto L87;
+        case 90: goto L90;
+        case 94: goto L94;
+        case 96: goto L96;
+        case 97: goto L97;
+        case 98: goto L98;
+        case 99: goto L99;
+        case 102: goto L102;
+        case 104: goto L104;
+        case 107: goto L107;
+        case 111: goto L111;
+        case 113: goto L113;
+        case 114: goto L114;
+        case 115: goto L115;
+        case 116: goto L116;
+        case 128: goto L128;
+        case 130: goto L130;
+        case 135: goto L135;
+        case 140: goto L140;
+        case 142: goto L142;
+        case 143: goto L143;
+        case 144: goto L144;
+        case 151: goto L151;
+        case 153: goto L153;
+        case 156: goto L156;
+        case 157: goto L157;
+        case 158: goto L158;
+        case 166: goto L166;
+        case 170: goto L170;
+        case 174: goto L174;
+        case 175: goto L175;
+        case 176: goto L176;
+        case 177: goto L177;
+        case 184: goto L184;
+        case 189: goto L189;
+        case 190: goto L190;
+        case 191: goto L191;
+        case 198: goto L198;
+        case 203: goto L203;
+        case 204: goto L204;
+        case 205: goto L205;
+        case 211: goto L211;
+        case 212: goto L212;
+        case 213: goto L213;
+        case 220: goto L220;
+        case 222: goto L222;
+        case 227: goto L227;
+        case 228: goto L228;
+        case 229: goto L229;
+        case 235: goto L235;
+        case 238: goto L238;
+        case 239: goto L239;
+        case 240: goto L240;
+        case 247: goto L247;
+        case 251: goto L251;
+        case 255: goto L255;
+        case 256: goto L256;
+        case 257: goto L257;
+        case 258: goto L258;
+        case 264: goto L264;
+        case 269: goto L269;
+        case 270: goto L270;
+        case 271: goto L271;
+        case 277: goto L277;
+        case 278: goto L278;
+        case 289: goto L289;
+        case 293: goto L293;
+        case 295: goto L295;
+        case 299: goto L299;
+        case 303: goto L303;
+        case 304: goto L304;
+        case 305: goto L305;
+        case 306: goto L306;
+        case 307: goto L307;
+        case 318: goto L318;
+        case 322: goto L322;
+        case 324: goto L324;
+        case 328: goto L328;
+        case 332: goto L332;
+        case 333: goto L333;
+        case 334: goto L334;
+        case 335: goto L335;
+        case 336: goto L336;
+        case 344: goto L344;
+        case 347: goto L347;
+        case 348: goto L348;
+        case 350: goto L350;
+        case 351: goto L351;
+        case 354: goto L354;
+        case 355: goto L355;
+        case 364: goto L364;
+        case 368: goto L368;
+        case 370: goto L370;
+        case 373: goto L373;
+        case 374: goto L374;
+        case 375: goto L375;
+        case 377: goto L377;
+        case 378: goto L378;
+        case 387: goto L387;
+        case 389: goto L389;
+        case 393: goto L393;
+        case 395: goto L395;
+        case 396: goto L396;
+        case 410: goto L410;
+        case 412: goto L412;
+        case 416: goto L416;
+        case 417: goto L417;
+        case 421: goto L421;
+        case 423: goto L423;
+        case 424: goto L424;
+        case 425: goto L425;
+        case 433: goto L433;
+        case 435: goto L435;
+        case 438: goto L438;
+        case 439: goto L439;
+        case 440: goto L440;
+        case 450: goto L450;
+        case 454: goto L454;
+        case 458: goto L458;
+        case 459: goto L459;
+        case 460: goto L460;
+        case 461: goto L461;
+        case 471: goto L471;
+        case 476: goto L476;
+        case 477: goto L477;
+        case 478: goto L478;
+        case 485: goto L485;
+        case 488: goto L488;
+        case 489: goto L489;
+        case 490: goto L490;
+        case 496: goto L496;
+        case 499: goto L499;
+        case 500: goto L500;
+        case 509: goto L509;
+        case 513: goto L513;
+        case 515: goto L515;
+        case 518: goto L518;
+        case 519: goto L519;
+        case 520: goto L520;
+        case 521: goto L521;
+        case 530: goto L530;
+        case 534: goto L534;
+        case 536: goto L536;
+        case 537: goto L537;
+        case 546: goto L546;
+        case 547: goto L547;
+        case 566: goto L566;
+        case 571: goto L571;
+        case 576: goto L576;
+        case 577: goto L577;
+        case 581: goto L581;
+        case 584: goto L584;
+        case 586: goto L586;
+        case 589: goto L589;
+        case 590: goto L590;
+        case 591: goto L591;
+        case 592: goto L592;
+        case 593: goto L593;
+        case 600: goto L600;
+        case 603: goto L603;
+        case 604: goto L604;
+        case 605: goto L605;
+        case 606: goto L606;
+        case 612: goto L612;
+        case 613: goto L613;
+        case 614: goto L614;
+        case 623: goto L623;
+        case 626: goto L626;
+        case 627: goto L627;
+        case 628: goto L628;
+        case 632: goto L632;
+        case 633: goto L633;
+        case 634: goto L634;
+        case 646: goto L646;
+        case 649: goto L649;
+        case 653: goto L653;
+        case 656: goto L656;
+        case 658: goto L658;
+        case 661: goto L661;
+        case 662: goto L662;
+        case 663: goto L663;
+        case 664: goto L664;
+        case 665: goto L665;
+        case 673: goto L673;
+        case 677: goto L677;
+        case 679: goto L679;
+        case 682: goto L682;
+        case 683: goto L683;
+        case 684: goto L684;
+        case 686: goto L686;
+        case 687: goto L687;
+        case 715: goto L715;
+        case 720: goto L720;
+        case 725: goto L725;
+        case 726: goto L726;
+        case 730: goto L730;
+        case 733: goto L733;
+        case 735: goto L735;
+        case 738: goto L738;
+        case 739: goto L739;
+        case 740: goto L740;
+        case 744: goto L744;
+        case 747: goto L747;
+        case 749: goto L749;
+        case 753: goto L753;
+        case 756: goto L756;
+        case 757: goto L757;
+        case 758: goto L758;
+        case 759: goto L759;
+        case 760: goto L760;
+        case 761: goto L761;
+        case 762: goto L762;
+        case 768: goto L768;
+        case 771: goto L771;
+        case 772: goto L772;
+        case 773: goto L773;
+        case 774: goto L774;
+        case 780: goto L780;
+        case 785: goto L785;
+        case 786: goto L786;
+        case 787: goto L787;
+        case 792: goto L792;
+        case 793: goto L793;
+        case 794: goto L794;
+        case 801: goto L801;
+        case 804: goto L804;
+        case 808: goto L808;
+        case 810: goto L810;
+        case 813: goto L813;
+        case 814: goto L814;
+        case 815: goto L815;
+        case 820: goto L820;
+        case 822: goto L822;
+        case 825: goto L825;
+        case 826: goto L826;
+        case 827: goto L827;
+        case 835: goto L835;
+        case 838: goto L838;
+        case 842: goto L842;
+        case 844: goto L844;
+        case 847: goto L847;
+        case 848: goto L848;
+        case 849: goto L849;
+        case 856: goto L856;
+        case 860: goto L860;
+        case 863: goto L863;
+        case 864: goto L864;
+        case 865: goto L865;
+        case 866: goto L866;
+        case 867: goto L867;
+        case 874: goto L874;
+        case 879: goto L879;
+        case 880: goto L880;
+        case 881: goto L881;
+        case 888: goto L888;
+        case 893: goto L893;
+        case 894: goto L894;
+        case 895: goto L895;
+        case 900: goto L900;
+        case 901: goto L901;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 357;
+L9: /* VAR */
+L11: /* VAR */
+L13: /* STRING */
+    tp_aot_op(tp, f, code + 13);
+L22: /* FILE */
+    f->fname = regs[2];
+L23: /* STRING */
+    tp_aot_op(tp, f, code + 23);
+L28: /* NAME */
+    f->name = regs[2];
+L29: /* LINE */
+    f->line = code + 29;
+    f->lineno = 358;
+L37: /* STRING */
+    tp_aot_op(tp, f, code + 37);
+L41: /* MGET */
+    tp_aot_op(tp, f, code + 41);
+L43: /* STRING */
+    tp_aot_op(tp, f, code + 43);
+L47: /* EQ */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint == regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 47);
+    }
+L48: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L50;
+    }
+L49: /* JUMP */
+    goto L278;
+L50: /* LINE */
+    f->line = code + 50;
+    f->lineno = 359;
+L70: /* GGET */
+    tp_aot_op(tp, f, code + 70);
+L73: /* STRING */
+    tp_aot_op(tp, f, code + 73);
+L78: /* MGET */
+    tp_aot_op(tp, f, code + 78);
+L80: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L82;
+    }
+L81: /* JUMP */
+    goto L97;
+L82: /* STRING */
+    tp_aot_op(tp, f, code + 82);
+L85: /* MGET */
+    tp_aot_op(tp, f, code + 85);
+L87: /* GGET */
+    tp_aot_op(tp, f, code + 87);
+L90: /* STRING */
+    tp_aot_op(tp, f, code + 90);
+L94: /* MGET */
+    tp_aot_op(tp, f, code + 94);
+L96: /* NOTIN */
+    regs[2] = tp_bool(!tp_true(tp, tp_has(tp, regs[3], regs[2])));
+L97: /* IFN */
+    if (!(TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2]))) {
+        goto L99;
+    }
+L98: /* JUMP */
+    goto L114;
+L99: /* STRING */
+    tp_aot_op(tp, f, code + 99);
+L102: /* MGET */
+    tp_aot_op(tp, f, code + 102);
+L104: /* GGET */
+    tp_aot_op(tp, f, code + 104);
+L107: /* STRING */
+    tp_aot_op(tp, f, code + 107);
+L111: /* MGET */
+    tp_aot_op(tp, f, code + 111);
+L113: /* IN */
+    regs[2] = tp_has(tp, regs[3], regs[2]);
+L114: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L116;
+    }
+L115: /* JUMP */
+    goto L213;
+L116: /* LINE */
+    f->line = code + 116;
+    f->lineno = 360;
+L128: /* VAR */
+L130: /* GGET */
+    tp_aot_op(tp, f, code + 130);
+L135: /* STRING */
+    tp_aot_op(tp, f, code + 135);
+L140: /* METHOD */
+    tp_aot_op(tp, f, code + 140);
+L142: /* CALLM */
+    return code + 142;
+L143: /* CALLP */
+    return code + 143;
+L144: /* LINE */
+    f->line = code + 144;
+    f->lineno = 361;
+L151: /* VAR */
+L153: /* GGET */
+    tp_aot_op(tp, f, code + 153);
+L156: /* MOVE */
+    regs[6] = regs[1];
+L157: /* CALLP */
+    return code + 157;
+L158: /* LINE */
+    f->line = code + 158;
+    f->lineno = 362;
+L166: /* GGET */
+    tp_aot_op(tp, f, code + 166);
+L170: /* GGET */
+    tp_aot_op(tp, f, code + 170);
+L174: /* MOVE */
+    regs[7] = regs[2];
+L175: /* MOVE */
+    regs[8] = regs[3];
+L176: /* CALLP */
+    return code + 176;
+L177: /* LINE */
+    f->line = code + 177;
+    f->lineno = 363;
+L184: /* GGET */
+    tp_aot_op(tp, f, code + 184);
+L189: /* MOVE */
+    regs[6] = regs[2];
+L190: /* CALLP */
+    return code + 190;
+L191: /* LINE */
+    f->line = code + 191;
+    f->lineno = 364;
+L198: /* GGET */
+    tp_aot_op(tp, f, code + 198);
+L203: /* MOVE */
+    regs[6] = regs[3];
+L204: /* CALLP */
+    return code + 204;
+L205: /* LINE */
+    f->line = code + 205;
+    f->lineno = 365;
+L211: /* NONE */
+    regs[4] = tp_None;
+L212: /* RETURN */
+    return code + 212;
+L213: /* LINE */
+    f->line = code + 213;
+    f->lineno = 366;
+L220: /* VAR */
+L222: /* GGET */
+    tp_aot_op(tp, f, code + 222);
+L227: /* MOVE */
+    regs[7] = regs[0];
+L228: /* CALLP */
+    return code + 228;
+L229: /* LINE */
+    f->line = code + 229;
+    f->lineno = 367;
+L235: /* GGET */
+    tp_aot_op(tp, f, code + 235);
+L238: /* MOVE */
+    regs[7] = regs[1];
+L239: /* CALLP */
+    return code + 239;
+L240: /* LINE */
+    f->line = code + 240;
+    f->lineno = 368;
+L247: /* GGET */
+    tp_aot_op(tp, f, code + 247);
+L251: /* GGET */
+    tp_aot_op(tp, f, code + 251);
+L255: /* MOVE */
+    regs[8] = regs[4];
+L256: /* MOVE */
+    regs[9] = regs[3];
+L257: /* CALLP */
+    return code + 257;
+L258: /* LINE */
+    f->line = code + 258;
+    f->lineno = 369;
+L264: /* GGET */
+    tp_aot_op(tp, f, code + 264);
+L269: /* MOVE */
+    regs[7] = regs[3];
+L270: /* CALLP */
+    return code + 270;
+L271: /* LINE */
+    f->line = code + 271;
+    f->lineno = 370;
+L277: /* RETURN */
+    return code + 277;
+L278: /* LINE */
+    f->line = code + 278;
+    f->lineno = 371;
+L289: /* STRING */
+    tp_aot_op(tp, f, code + 289);
+L293: /* MGET */
+    tp_aot_op(tp, f, code + 293);
+L295: /* STRING */
+    tp_aot_op(tp, f, code + 295);
+L299: /* STRING */
+    tp_aot_op(tp, f, code + 299);
+L303: /* LIST */
+    tp_aot_op(tp, f, code + 303);
+L304: /* IN */
+    regs[5] = tp_has(tp, regs[6], regs[5]);
+L305: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L307;
+    }
+L306: /* JUMP */
+    goto L794;
+L307: /* LINE */
+    f->line = code + 307;
+    f->lineno = 372;
+L318: /* STRING */
+    tp_aot_op(tp, f, code + 318);
+L322: /* MGET */
+    tp_aot_op(tp, f, code + 322);
+L324: /* STRING */
+    tp_aot_op(tp, f, code + 324);
+L328: /* STRING */
+    tp_aot_op(tp, f, code + 328);
+L332: /* LIST */
+    tp_aot_op(tp, f, code + 332);
+L333: /* IN */
+    regs[5] = tp_has(tp, regs[6], regs[5]);
+L334: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L336;
+    }
+L335: /* JUMP */
+    goto L614;
+L336: /* LINE */
+    f->line = code + 336;
+    f->lineno = 373;
+L344: /* NUMBER */
+    tp_aot_op(tp, f, code + 344);
+L347: /* LIST */
+    tp_aot_op(tp, f, code + 347);
+L348: /* VAR */
+L350: /* MOVE */
+    regs[7] = regs[5];
+L351: /* VAR */
+L354: /* MOVE */
+    regs[5] = regs[6];
+L355: /* LINE */
+    f->line = code + 355;
+    f->lineno = 374;
+L364: /* STRING */
+    tp_aot_op(tp, f, code + 364);
+L368: /* MGET */
+    tp_aot_op(tp, f, code + 368);
+L370: /* NUMBER */
+    tp_aot_op(tp, f, code + 370);
+L373: /* ITER */
+    if (tp_iter_next(tp, &regs[6], regs[8], &regs[9])) {
+        goto L375;
+    }
+L374: /* JUMP */
+    goto L490;
+L375: /* VAR */
+L377: /* MOVE */
+    regs[2] = regs[6];
+L378: /* LINE */
+    f->line = code + 378;
+    f->lineno = 375;
+L387: /* VAR */
+L389: /* STRING */
+    tp_aot_op(tp, f, code + 389);
+L393: /* MGET */
+    tp_aot_op(tp, f, code + 393);
+L395: /* GET */
+    regs[6] = tp_get(tp, regs[3], regs[7]);
+    tp_grey(tp, regs[6]);
+L396: /* LINE */
+    f->line = code + 396;
+    f->lineno = 376;
+L410: /* VAR */
+L412: /* GGET */
+    tp_aot_op(tp, f, code + 412);
+L416: /* CALLP */
+    return code + 416;
+L417: /* STRING */
+    tp_aot_op(tp, f, code + 417);
+L421: /* METHOD */
+    tp_aot_op(tp, f, code + 421);
+L423: /* MOVE */
+    regs[12] = regs[3];
+L424: /* CALLM */
+    return code + 424;
+L425: /* LINE */
+    f->line = code + 425;
+    f->lineno = 377;
+L433: /* VAR */
+L435: /* GGET */
+    tp_aot_op(tp, f, code + 435);
+L438: /* MOVE */
+    regs[12] = regs[6];
+L439: /* CALLP */
+    return code + 439;
+L440: /* LINE */
+    f->line = code + 440;
+    f->lineno = 378;
+L450: /* GGET */
+    tp_aot_op(tp, f, code + 450);
+L454: /* GGET */
+    tp_aot_op(tp, f, code + 454);
+L458: /* MOVE */
+    regs[13] = regs[3];
+L459: /* MOVE */
+    regs[14] = regs[2];
+L460: /* CALLP */
+    return code + 460;
+L461: /* LINE */
+    f->line = code + 461;
+    f->lineno = 379;
+L471: /* GGET */
+    tp_aot_op(tp, f, code + 471);
+L476: /* MOVE */
+    regs[12] = regs[2];
+L477: /* CALLP */
+    return code + 477;
+L478: /* LINE */
+    f->line = code + 478;
+    f->lineno = 380;
+L485: /* NUMBER */
+    tp_aot_op(tp, f, code + 485);
+L488: /* ADD */
+    if (TP_BOTH(regs[7], regs[11], TP_NUMBER_INT)) {
+        regs[7] = tp_int(regs[7].nint + regs[11].nint);
+    } else {
+        tp_aot_op(tp, f, code + 488);
+    }
+L489: /* JUMP */
+    tp_aot_safepoint(tp, 116);
+    goto L373;
+L490: /* LINE */
+    f->line = code + 490;
+    f->lineno = 381;
+L496: /* NUMBER */
+    tp_aot_op(tp, f, code + 496);
+L499: /* MOVE */
+    regs[7] = regs[8];
+L500: /* LINE */
+    f->line = code + 500;
+    f->lineno = 382;
+L509: /* STRING */
+    tp_aot_op(tp, f, code + 509);
+L513: /* MGET */
+    tp_aot_op(tp, f, code + 513);
+L515: /* NUMBER */
+    tp_aot_op(tp, f, code + 515);
+L518: /* ITER */
+    if (tp_iter_next(tp, &regs[8], regs[9], &regs[10])) {
+        goto L520;
+    }
+L519: /* JUMP */
+    goto L606;
+L520: /* MOVE */
+    regs[2] = regs[8];
+L521: /* LINE */
+    f->line = code + 521;
+    f->lineno = 383;
+L530: /* STRING */
+    tp_aot_op(tp, f, code + 530);
+L534: /* MGET */
+    tp_aot_op(tp, f, code + 534);
+L536: /* GET */
+    regs[6] = tp_get(tp, regs[8], regs[7]);
+    tp_grey(tp, regs[6]);
+L537: /* LINE */
+    f->line = code + 537;
+    f->lineno = 384;
+L546: /* GET */
+    regs[3] = tp_get(tp, regs[5], regs[7]);
+    tp_grey(tp, regs[3]);
+L547: /* LINE */
+    f->line = code + 547;
+    f->lineno = 385;
+L566: /* GGET */
+    tp_aot_op(tp, f, code + 566);
+L571: /* GGET */
+    tp_aot_op(tp, f, code + 571);
+L576: /* MOVE */
+    regs[14] = regs[2];
+L577: /* GGET */
+    tp_aot_op(tp, f, code + 577);
+L581: /* STRING */
+    tp_aot_op(tp, f, code + 581);
+L584: /* MGET */
+    tp_aot_op(tp, f, code + 584);
+L586: /* STRING */
+    tp_aot_op(tp, f, code + 586);
+L589: /* MOVE */
+    regs[19] = regs[3];
+L590: /* CALLP */
+    return code + 590;
+L591: /* CALLP */
+    return code + 591;
+L592: /* CALLP */
+    return code + 592;
+L593: /* LINE */
+    f->line = code + 593;
+    f->lineno = 386;
+L600: /* NUMBER */
+    tp_aot_op(tp, f, code + 600);
+L603: /* ADD */
+    if (TP_BOTH(regs[7], regs[11], TP_NUMBER_INT)) {
+        regs[8] = tp_int(regs[7].nint + regs[11].nint);
+    } else {
+        tp_aot_op(tp, f, code + 603);
+    }
+L604: /* MOVE */
+    regs[7] = regs[8];
+L605: /* JUMP */
+    tp_aot_safepoint(tp, 87);
+    goto L518;
+L606: /* LINE */
+    f->line = code + 606;
+    f->lineno = 387;
+L612: /* NONE */
+    regs[8] = tp_None;
+L613: /* RETURN */
+    return code + 613;
+L614: /* LINE */
+    f->line = code + 614;
+    f->lineno = 389;
+L623: /* GGET */
+    tp_aot_op(tp, f, code + 623);
+L626: /* MOVE */
+    regs[11] = regs[1];
+L627: /* CALLP */
+    return code + 627;
+L628: /* GGET */
+    tp_aot_op(tp, f, code + 628);
+L632: /* MOVE */
+    regs[11] = regs[2];
+L633: /* CALLP */
+    return code + 633;
+L634: /* LINE */
+    f->line = code + 634;
+    f->lineno = 390;
+L646: /* NUMBER */
+    tp_aot_op(tp, f, code + 646);
+L649: /* GGET */
+    tp_aot_op(tp, f, code + 649);
+L653: /* STRING */
+    tp_aot_op(tp, f, code + 653);
+L656: /* MGET */
+    tp_aot_op(tp, f, code + 656);
+L658: /* STRING */
+    tp_aot_op(tp, f, code + 658);
+L661: /* MOVE */
+    regs[14] = regs[2];
+L662: /* CALLP */
+    return code + 662;
+L663: /* MOVE */
+    regs[7] = regs[8];
+L664: /* MOVE */
+    regs[3] = regs[9];
+L665: /* LINE */
+    f->line = code + 665;
+    f->lineno = 391;
+L673: /* STRING */
+    tp_aot_op(tp, f, code + 673);
+L677: /* MGET */
+    tp_aot_op(tp, f, code + 677);
+L679: /* NUMBER */
+    tp_aot_op(tp, f, code + 679);
+L682: /* ITER */
+    if (tp_iter_next(tp, &regs[8], regs[9], &regs[10])) {
+        goto L684;
+    }
+L683: /* JUMP */
+    goto L774;
+L684: /* VAR */
+L686: /* MOVE */
+    regs[11] = regs[8];
+L687: /* LINE */
+    f->line = code + 687;
+    f->lineno = 392;
+L715: /* GGET */
+    tp_aot_op(tp, f, code + 715);
+L720: /* GGET */
+    tp_aot_op(tp, f, code + 720);
+L725: /* MOVE */
+    regs[15] = regs[11];
+L726: /* GGET */
+    tp_aot_op(tp, f, code + 726);
+L730: /* STRING */
+    tp_aot_op(tp, f, code + 730);
+L733: /* MGET */
+    tp_aot_op(tp, f, code + 733);
+L735: /* STRING */
+    tp_aot_op(tp, f, code + 735);
+L738: /* NONE */
+    regs[20] = tp_None;
+L739: /* MOVE */
+    regs[0] = regs[3];
+L740: /* GGET */
+    tp_aot_op(tp, f, code + 740);
+L744: /* STRING */
+    tp_aot_op(tp, f, code + 744);
+L747: /* MGET */
+    tp_aot_op(tp, f, code + 747);
+L749: /* STRING */
+    tp_aot_op(tp, f, code + 749);
+L753: /* GGET */
+    tp_aot_op(tp, f, code + 753);
+L756: /* CALLP */
+    return code + 756;
+L757: /* CALLP */
+    return code + 757;
+L758: /* LIST */
+    tp_aot_op(tp, f, code + 758);
+L759: /* CALLP */
+    return code + 759;
+L760: /* CALLP */
+    return code + 760;
+L761: /* CALLP */
+    return code + 761;
+L762: /* LINE */
+    f->line = code + 762;
+    f->lineno = 393;
+L768: /* NUMBER */
+    tp_aot_op(tp, f, code + 768);
+L771: /* ADD */
+    if (TP_BOTH(regs[7], regs[12], TP_NUMBER_INT)) {
+        regs[8] = tp_int(regs[7].nint + regs[12].nint);
+    } else {
+        tp_aot_op(tp, f, code + 771);
+    }
+L772: /* MOVE */
+    regs[7] = regs[8];
+L773: /* JUMP */
+    tp_aot_safepoint(tp, 91);
+    goto L682;
+L774: /* LINE */
+    f->line = code + 774;
+    f->lineno = 394;
+L780: /* GGET */
+    tp_aot_op(tp, f, code + 780);
+L785: /* MOVE */
+    regs[13] = regs[2];
+L786: /* CALLP */
+    return code + 786;
+L787: /* LINE */
+    f->line = code + 787;
+    f->lineno = 395;
+L792: /* NONE */
+    regs[8] = tp_None;
+L793: /* RETURN */
+    return code + 793;
+L794: /* LINE */
+    f->line = code + 794;
+    f->lineno = 397;
+L801: /* GGET */
+    tp_aot_op(tp, f, code + 801);
+L804: /* STRING */
+    tp_aot_op(tp, f, code + 804);
+L808: /* MGET */
+    tp_aot_op(tp, f, code + 808);
+L810: /* NUMBER */
+    tp_aot_op(tp, f, code + 810);
+L813: /* GET */
+    regs[13] = tp_get(tp, regs[13], regs[9]);
+    tp_grey(tp, regs[13]);
+L814: /* CALLP */
+    return code + 814;
+L815: /* LINE */
+    f->line = code + 815;
+    f->lineno = 398;
+L820: /* VAR */
+L822: /* GGET */
+    tp_aot_op(tp, f, code + 822);
+L825: /* MOVE */
+    regs[13] = regs[1];
+L826: /* CALLP */
+    return code + 826;
+L827: /* LINE */
+    f->line = code + 827;
+    f->lineno = 399;
+L835: /* GGET */
+    tp_aot_op(tp, f, code + 835);
+L838: /* STRING */
+    tp_aot_op(tp, f, code + 838);
+L842: /* MGET */
+    tp_aot_op(tp, f, code + 842);
+L844: /* NUMBER */
+    tp_aot_op(tp, f, code + 844);
+L847: /* GET */
+    regs[13] = tp_get(tp, regs[13], regs[10]);
+    tp_grey(tp, regs[13]);
+L848: /* CALLP */
+    return code + 848;
+L849: /* LINE */
+    f->line = code + 849;
+    f->lineno = 400;
+L856: /* GGET */
+    tp_aot_op(tp, f, code + 856);
+L860: /* GGET */
+    tp_aot_op(tp, f, code + 860);
+L863: /* MOVE */
+    regs[14] = regs[2];
+L864: /* MOVE */
+    regs[15] = regs[3];
+L865: /* MOVE */
+    regs[16] = regs[8];
+L866: /* CALLP */
+    return code + 866;
+L867: /* LINE */
+    f->line = code + 867;
+    f->lineno = 401;
+L874: /* GGET */
+    tp_aot_op(tp, f, code + 874);
+L879: /* MOVE */
+    regs[13] = regs[2];
+L880: /* CALLP */
+    return code + 880;
+L881: /* LINE */
+    f->line = code + 881;
+    f->lineno = 402;
+L888: /* GGET */
+    tp_aot_op(tp, f, code + 888);
+L893: /* MOVE */
+    regs[13] = regs[3];
+L894: /* CALLP */
+    return code + 894;
+L895: /* LINE */
+    f->line = code + 895;
+    f->lineno = 403;
+L900: /* RETURN */
+    return code + 900;
+L901: /* EOF */
+    return code + 901;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_9677(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 12: goto L12;
+        case 14: goto L14;
+        case 16: goto L16;
+        case 19: goto L19;
+        case 21: goto L21;
+        case 30: goto L30;
+        case 31: goto L31;
+        case 36: goto L36;
+        case 37: goto L37;
+        case 45: goto L45;
+        case 47: goto L47;
+        case 50: goto L50;
+        case 51: goto L51;
+        case 54: goto L54;
+        case 55: goto L55;
+        case 56: goto L56;
+        case 57: goto L57;
+        case 65: goto L65;
+        case 68: goto L68;
+        case 73: goto L73;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 77: goto L77;
+        case 78: goto L78;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 89: goto L89;
+        case 92: goto L92;
+        case 93: goto L93;
+        case 94: goto L94;
+        case 96: goto L96;
+        case 97: goto L97;
+        case 103: goto L103;
+        case 105: goto L105;
+        case 106: goto L106;
+        case 113: goto L113;
+        case 115: goto L115;
+        case 118: goto L118;
+        case 119: goto L119;
+        case 120: goto L120;
+        case 121: goto L121;
+        case 127: goto L127;
+        case 128: goto L128;
+        case 129: goto L129;
+        case 130: goto L130;
+        case 138: goto L138;
+        case 142: goto L142;
+        case 146: goto L146;
+        case 147: goto L147;
+        case 148: goto L148;
+        case 149: goto L149;
+        case 156: goto L156;
+        case 161: goto L161;
+        case 162: goto L162;
+        case 163: goto L163;
+        case 168: goto L168;
+        case 171: goto L171;
+        case 172: goto L172;
+        case 173: goto L173;
+        case 180: goto L180;
+        case 183: goto L183;
+        case 184: goto L184;
+        case 185: goto L185;
+        case 186: goto L186;
+        case 187: goto L187;
+        case 194: goto L194;
+        case 198: goto L198;
+        case 199: goto L199;
+        case 200: goto L200;
+        case 203: goto L203;
+        case 206: goto L206;
+        case 207: goto L207;
+        case 213: goto L213;
+        case 216: goto L216;
+        case 217: goto L217;
+        case 227: goto L227;
+        case 231: goto L231;
+        case 232: goto L232;
+        case 233: goto L233;
+        case 236: goto L236;
+        case 237: goto L237;
+        case 240: goto L240;
+        case 241: goto L241;
+        case 242: goto L242;
+        case 250: goto L250;
+        case 255: goto L255;
+        case 256: goto L256;
+        case 257: goto L257;
+        case 258: goto L258;
+        case 259: goto L259;
+        case 260: goto L260;
+        case 266: goto L266;
+        case 269: goto L269;
+        case 270: goto L270;
+        case 271: goto L271;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 405;
+L12: /* VAR */
+L14: /* VAR */
+L16: /* VAR */
+L19: /* VAR */
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L30: /* FILE */
+    f->fname = regs[4];
+L31: /* STRING */
+    tp_aot_op(tp, f, code + 31);
+L36: /* NAME */
+    f->name = regs[4];
+L37: /* LINE */
+    f->line = code + 37;
+    f->lineno = 406;
+L45: /* VAR */
+L47: /* GGET */
+    tp_aot_op(tp, f, code + 47);
+L50: /* MOVE */
+    regs[5] = regs[3];
+L51: /* GGET */
+    tp_aot_op(tp, f, code + 51);
+L54: /* MOVE */
+    regs[8] = regs[2];
+L55: /* CALLP */
+    return code + 55;
+L56: /* CALLP */
+    return code + 56;
+L57: /* LINE */
+    f->line = code + 57;
+    f->lineno = 407;
+L65: /* NUMBER */
+    tp_aot_op(tp, f, code + 65);
+L68: /* GGET */
+    tp_aot_op(tp, f, code + 68);
+L73: /* MOVE */
+    regs[7] = regs[4];
+L74: /* CALLP */
+    return code + 74;
+L75: /* VAR */
+L77: /* MOVE */
+    regs[5] = regs[9];
+L78: /* VAR */
+L81: /* MOVE */
+    regs[9] = regs[4];
+L82: /* LINE */
+    f->line = code + 82;
+    f->lineno = 408;
+L89: /* NUMBER */
+    tp_aot_op(tp, f, code + 89);
+L92: /* ITER */
+    if (tp_iter_next(tp, &regs[4], regs[2], &regs[6])) {
+        goto L94;
+    }
+L93: /* JUMP */
+    goto L173;
+L94: /* VAR */
+L96: /* MOVE */
+    regs[7] = regs[4];
+L97: /* LINE */
+    f->line = code + 97;
+    f->lineno = 409;
+L103: /* VAR */
+L105: /* GET */
+    regs[4] = tp_get(tp, regs[9], regs[5]);
+    tp_grey(tp, regs[4]);
+L106: /* LINE */
+    f->line = code + 106;
+    f->lineno = 410;
+L113: /* VAR */
+L115: /* GGET */
+    tp_aot_op(tp, f, code + 115);
+L118: /* MOVE */
+    regs[12] = regs[7];
+L119: /* MOVE */
+    regs[13] = regs[4];
+L120: /* CALLP */
+    return code + 120;
+L121: /* LINE */
+    f->line = code + 121;
+    f->lineno = 411;
+L127: /* NE */
+    if (TP_BOTH(regs[4], regs[8], TP_NUMBER_INT)) {
+        regs[10] = tp_bool(regs[4].nint != regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 127);
+    }
+L128: /* IF */
+    if (TP_IS_INT(regs[10]) ? regs[10].nint != 0 : tp_true(tp, regs[10])) {
+        goto L130;
+    }
+L129: /* JUMP */
+    goto L163;
+L130: /* LINE */
+    f->line = code + 130;
+    f->lineno = 412;
+L138: /* GGET */
+    tp_aot_op(tp, f, code + 138);
+L142: /* GGET */
+    tp_aot_op(tp, f, code + 142);
+L146: /* MOVE */
+    regs[13] = regs[4];
+L147: /* MOVE */
+    regs[14] = regs[8];
+L148: /* CALLP */
+    return code + 148;
+L149: /* LINE */
+    f->line = code + 149;
+    f->lineno = 413;
+L156: /* GGET */
+    tp_aot_op(tp, f, code + 156);
+L161: /* MOVE */
+    regs[12] = regs[8];
+L162: /* CALLP */
+    return code + 162;
+L163: /* LINE */
+    f->line = code + 163;
+    f->lineno = 414;
+L168: /* NUMBER */
+    tp_aot_op(tp, f, code + 168);
+L171: /* ADD */
+    if (TP_BOTH(regs[5], regs[11], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[5].nint + regs[11].nint);
+    } else {
+        tp_aot_op(tp, f, code + 171);
+    }
+L172: /* JUMP */
+    tp_aot_safepoint(tp, 80);
+    goto L92;
+L173: /* LINE */
+    f->line = code + 173;
+    f->lineno = 415;
+L180: /* GGET */
+    tp_aot_op(tp, f, code + 180);
+L183: /* MOVE */
+    regs[12] = regs[9];
+L184: /* CALLP */
+    return code + 184;
+L185: /* IFN */
+    if (!(TP_IS_INT(regs[10]) ? regs[10].nint != 0 : tp_true(tp, regs[10]))) {
+        goto L187;
+    }
+L186: /* JUMP */
+    goto L217;
+L187: /* LINE */
+    f->line = code + 187;
+    f->lineno = 416;
+L194: /* GGET */
+    tp_aot_op(tp, f, code + 194);
+L198: /* MOVE */
+    regs[11] = regs[0];
+L199: /* MOVE */
+    regs[12] = regs[1];
+L200: /* NUMBER */
+    tp_aot_op(tp, f, code + 200);
+L203: /* NUMBER */
+    tp_aot_op(tp, f, code + 203);
+L206: /* CALLP */
+    return code + 206;
+L207: /* LINE */
+    f->line = code + 207;
+    f->lineno = 417;
+L213: /* NUMBER */
+    tp_aot_op(tp, f, code + 213);
+L216: /* RETURN */
+    return code + 216;
+L217: /* LINE */
+    f->line = code + 217;
+    f->lineno = 418;
+L227: /* GGET */
+    tp_aot_op(tp, f, code + 227);
+L231: /* MOVE */
+    regs[11] = regs[0];
+L232: /* MOVE */
+    regs[12] = regs[1];
+L233: /* NUMBER */
+    tp_aot_op(tp, f, code + 233);
+L236: /* GET */
+    regs[13] = tp_get(tp, regs[9], regs[1]);
+    tp_grey(tp, regs[13]);
+L237: /* GGET */
+    tp_aot_op(tp, f, code + 237);
+L240: /* CALLP */
+    return code + 240;
+L241: /* CALLP */
+    return code + 241;
+L242: /* LINE */
+    f->line = code + 242;
+    f->lineno = 419;
+L250: /* GGET */
+    tp_aot_op(tp, f, code + 250);
+L255: /* MOVE */
+    regs[13] = regs[3];
+L256: /* NONE */
+    regs[14] = tp_None;
+L257: /* LIST */
+    tp_aot_op(tp, f, code + 257);
+L258: /* GET */
+    regs[11] = tp_get(tp, regs[9], regs[12]);
+    tp_grey(tp, regs[11]);
+L259: /* CALLP */
+    return code + 259;
+L260: /* LINE */
+    f->line = code + 260;
+    f->lineno = 420;
+L266: /* NUMBER */
+    tp_aot_op(tp, f, code + 266);
+L269: /* GET */
+    regs[6] = tp_get(tp, regs[9], regs[10]);
+    tp_grey(tp, regs[6]);
+L270: /* RETURN */
+    return code + 270;
+L271: /* EOF */
+    return code + 271;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_9974(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 38: goto L38;
+        case 92: goto L92;
+        case 101: goto L101;
+        case 102: goto L102;
+        case 103: goto L103;
+        case 104: goto L104;
+        case 105: goto L105;
+        case 107: goto L107;
+        case 108: goto L108;
+        case 110: goto L110;
+        case 111: goto L111;
+        case 113: goto L113;
+        case 114: goto L114;
+        case 116: goto L116;
+        case 117: goto L117;
+        case 123: goto L123;
+        case 126: goto L126;
+        case 127: goto L127;
+        case 128: goto L128;
+        case 130: goto L130;
+        case 131: goto L131;
+        case 147: goto L147;
+        case 151: goto L151;
+        case 153: goto L153;
+        case 157: goto L157;
+        case 158: goto L158;
+        case 159: goto L159;
+        case 160: goto L160;
+        case 163: goto L163;
+        case 165: goto L165;
+        case 168: goto L168;
+        case 169: goto L169;
+        case 170: goto L170;
+        case 171: goto L171;
+        case 175: goto L175;
+        case 177: goto L177;
+        case 178: goto L178;
+        case 179: goto L179;
+        case 180: goto L180;
+        case 191: goto L191;
+        case 195: goto L195;
+        case 197: goto L197;
+        case 201: goto L201;
+        case 202: goto L202;
+        case 203: goto L203;
+        case 204: goto L204;
+        case 205: goto L205;
+        case 206: goto L206;
+        case 217: goto L217;
+        case 221: goto L221;
+        case 223: goto L223;
+        case 227: goto L227;
+        case 228: goto L228;
+        case 229: goto L229;
+        case 230: goto L230;
+        case 231: goto L231;
+        case 232: goto L232;
+        case 240: goto L240;
+        case 244: goto L244;
+        case 246: goto L246;
+        case 247: goto L247;
+        case 248: goto L248;
+        case 249: goto L249;
+        case 255: goto L255;
+        case 256: goto L256;
+        case 257: goto L257;
+        case 258: goto L258;
+        case 259: goto L259;
+        case 260: goto L260;
+        case 261: goto L261;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 422;
+L9: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[1];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L27: /* NAME */
+    f->name = regs[1];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 423;
+L38: /* STRING */
+    tp_aot_op(tp, f, code + 38);
+L92: /* LINE */
+    f->line = code + 92;
+    f->lineno = 431;
+L101: /* LIST */
+    tp_aot_op(tp, f, code + 101);
+L102: /* LIST */
+    tp_aot_op(tp, f, code + 102);
+L103: /* NONE */
+    regs[3] = tp_None;
+L104: /* NONE */
+    regs[4] = tp_None;
+L105: /* VAR */
+L107: /* MOVE */
+    regs[5] = regs[1];
+L108: /* VAR */
+L110: /* MOVE */
+    regs[1] = regs[2];
+L111: /* VAR */
+L113: /* MOVE */
+    regs[2] = regs[3];
+L114: /* VAR */
+L116: /* MOVE */
+    regs[3] = regs[4];
+L117: /* LINE */
+    f->line = code + 117;
+    f->lineno = 432;
+L123: /* NUMBER */
+    tp_aot_op(tp, f, code + 123);
+L126: /* ITER */
+    if (tp_iter_next(tp, &regs[4], regs[0], &regs[6])) {
+        goto L128;
+    }
+L127: /* JUMP */
+    goto L249;
+L128: /* VAR */
+L130: /* MOVE */
+    regs[7] = regs[4];
+L131: /* LINE */
+    f->line = code + 131;
+    f->lineno = 433;
+L147: /* STRING */
+    tp_aot_op(tp, f, code + 147);
+L151: /* MGET */
+    tp_aot_op(tp, f, code + 151);
+L153: /* STRING */
+    tp_aot_op(tp, f, code + 153);
+L157: /* EQ */
+    if (TP_BOTH(regs[4], regs[8], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[4].nint == regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 157);
+    }
+L158: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L160;
+    }
+L159: /* JUMP */
+    goto L169;
+L160: /* STRING */
+    tp_aot_op(tp, f, code + 160);
+L163: /* MGET */
+    tp_aot_op(tp, f, code + 163);
+L165: /* STRING */
+    tp_aot_op(tp, f, code + 165);
+L168: /* EQ */
+    if (TP_BOTH(regs[4], regs[8], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[4].nint == regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 168);
+    }
+L169: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L171;
+    }
+L170: /* JUMP */
+    goto L180;
+L171: /* STRING */
+    tp_aot_op(tp, f, code + 171);
+L175: /* METHOD */
+    tp_aot_op(tp, f, code + 175);
+L177: /* MOVE */
+    regs[10] = regs[7];
+L178: /* CALLM */
+    return code + 178;
+L179: /* JUMP */
+    tp_aot_safepoint(tp, 53);
+    goto L126;
+L180: /* LINE */
+    f->line = code + 180;
+    f->lineno = 434;
+L191: /* STRING */
+    tp_aot_op(tp, f, code + 191);
+L195: /* MGET */
+    tp_aot_op(tp, f, code + 195);
+L197: /* STRING */
+    tp_aot_op(tp, f, code + 197);
+L201: /* EQ */
+    if (TP_BOTH(regs[4], regs[8], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[4].nint == regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 201);
+    }
+L202: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L204;
+    }
+L203: /* JUMP */
+    goto L206;
+L204: /* MOVE */
+    regs[2] = regs[7];
+L205: /* JUMP */
+    tp_aot_safepoint(tp, 79);
+    goto L126;
+L206: /* LINE */
+    f->line = code + 206;
+    f->lineno = 435;
+L217: /* STRING */
+    tp_aot_op(tp, f, code + 217);
+L221: /* MGET */
+    tp_aot_op(tp, f, code + 221);
+L223: /* STRING */
+    tp_aot_op(tp, f, code + 223);
+L227: /* EQ */
+    if (TP_BOTH(regs[4], regs[8], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[4].nint == regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 227);
+    }
+L228: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L230;
+    }
+L229: /* JUMP */
+    goto L232;
+L230: /* MOVE */
+    regs[3] = regs[7];
+L231: /* JUMP */
+    tp_aot_safepoint(tp, 105);
+    goto L126;
+L232: /* LINE */
+    f->line = code + 232;
+    f->lineno = 436;
+L240: /* STRING */
+    tp_aot_op(tp, f, code + 240);
+L244: /* METHOD */
+    tp_aot_op(tp, f, code + 244);
+L246: /* MOVE */
+    regs[10] = regs[7];
+L247: /* CALLM */
+    return code + 247;
+L248: /* JUMP */
+    tp_aot_safepoint(tp, 122);
+    goto L126;
+L249: /* LINE */
+    f->line = code + 249;
+    f->lineno = 437;
+L255: /* MOVE */
+    regs[8] = regs[5];
+L256: /* MOVE */
+    regs[9] = regs[1];
+L257: /* MOVE */
+    regs[10] = regs[2];
+L258: /* MOVE */
+    regs[11] = regs[3];
+L259: /* LIST */
+    tp_aot_op(tp, f, code + 259);
+L260: /* RETURN */
+    return code + 260;
+L261: /* EOF */
+    return code + 261;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_10259(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 34: goto L34;
+        case 37: goto L37;
+        case 41: goto L41;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 58: goto L58;
+        case 60: goto L60;
+        case 64: goto L64;
+        case 66: goto L66;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 76: goto L76;
+        case 79: goto L79;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 89: goto L89;
+        case 93: goto L93;
+        case 95: goto L95;
+        case 98: goto L98;
+        case 101: goto L101;
+        case 102: goto L102;
+        case 105: goto L105;
+        case 106: goto L106;
+        case 118: goto L118;
+        case 120: goto L120;
+        case 124: goto L124;
+        case 128: goto L128;
+        case 131: goto L131;
+        case 133: goto L133;
+        case 137: goto L137;
+        case 138: goto L138;
+        case 150: goto L150;
+        case 154: goto L154;
+        case 157: goto L157;
+        case 159: goto L159;
+        case 163: goto L163;
+        case 168: goto L168;
+        case 169: goto L169;
+        case 177: goto L177;
+        case 182: goto L182;
+        case 184: goto L184;
+        case 185: goto L185;
+        case 196: goto L196;
+        case 200: goto L200;
+        case 203: goto L203;
+        case 205: goto L205;
+        case 209: goto L209;
+        case 213: goto L213;
+        case 214: goto L214;
+        case 215: goto L215;
+        case 216: goto L216;
+        case 217: goto L217;
+        case 226: goto L226;
+        case 230: goto L230;
+        case 232: goto L232;
+        case 236: goto L236;
+        case 237: goto L237;
+        case 238: goto L238;
+        case 250: goto L250;
+        case 255: goto L255;
+        case 256: goto L256;
+        case 260: goto L260;
+        case 263: goto L263;
+        case 265: goto L265;
+        case 268: goto L268;
+        case 269: goto L269;
+        case 270: goto L270;
+        case 271: goto L271;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 439;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 440;
+L34: /* GGET */
+    tp_aot_op(tp, f, code + 34);
+L37: /* STRING */
+    tp_aot_op(tp, f, code + 37);
+L41: /* MGET */
+    tp_aot_op(tp, f, code + 41);
+L43: /* CALLP */
+    return code + 43;
+L44: /* NUMBER */
+    tp_aot_op(tp, f, code + 44);
+L47: /* EQ */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[1].nint == regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 47);
+    }
+L48: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L50;
+    }
+L49: /* JUMP */
+    goto L81;
+L50: /* LINE */
+    f->line = code + 50;
+    f->lineno = 441;
+L58: /* VAR */
+L60: /* STRING */
+    tp_aot_op(tp, f, code + 60);
+L64: /* MGET */
+    tp_aot_op(tp, f, code + 64);
+L66: /* NUMBER */
+    tp_aot_op(tp, f, code + 66);
+L69: /* GET */
+    regs[1] = tp_get(tp, regs[2], regs[3]);
+    tp_grey(tp, regs[1]);
+L70: /* LINE */
+    f->line = code + 70;
+    f->lineno = 442;
+L76: /* VAR */
+L79: /* MOVE */
+    regs[2] = regs[1];
+L80: /* JUMP */
+    goto L106;
+L81: /* LINE */
+    f->line = code + 81;
+    f->lineno = 444;
+L89: /* STRING */
+    tp_aot_op(tp, f, code + 89);
+L93: /* MGET */
+    tp_aot_op(tp, f, code + 93);
+L95: /* VAR */
+L98: /* NUMBER */
+    tp_aot_op(tp, f, code + 98);
+L101: /* GET */
+    regs[1] = tp_get(tp, regs[3], regs[4]);
+    tp_grey(tp, regs[1]);
+L102: /* NUMBER */
+    tp_aot_op(tp, f, code + 102);
+L105: /* GET */
+    regs[2] = tp_get(tp, regs[3], regs[4]);
+    tp_grey(tp, regs[2]);
+L106: /* LINE */
+    f->line = code + 106;
+    f->lineno = 446;
+L118: /* VAR */
+L120: /* GGET */
+    tp_aot_op(tp, f, code + 120);
+L124: /* GGET */
+    tp_aot_op(tp, f, code + 124);
+L128: /* STRING */
+    tp_aot_op(tp, f, code + 128);
+L131: /* MGET */
+    tp_aot_op(tp, f, code + 131);
+L133: /* STRING */
+    tp_aot_op(tp, f, code + 133);
+L137: /* NONE */
+    regs[9] = tp_None;
+L138: /* LINE */
+    f->line = code + 138;
+    f->lineno = 447;
+L150: /* GGET */
+    tp_aot_op(tp, f, code + 150);
+L154: /* STRING */
+    tp_aot_op(tp, f, code + 154);
+L157: /* MGET */
+    tp_aot_op(tp, f, code + 157);
+L159: /* STRING */
+    tp_aot_op(tp, f, code + 159);
+L163: /* STRING */
+    tp_aot_op(tp, f, code + 163);
+L168: /* CALLP */
+    return code + 168;
+L169: /* LINE */
+    f->line = code + 169;
+    f->lineno = 448;
+L177: /* STRING */
+    tp_aot_op(tp, f, code + 177);
+L182: /* METHOD */
+    tp_aot_op(tp, f, code + 182);
+L184: /* CALLM */
+    return code + 184;
+L185: /* LINE */
+    f->line = code + 185;
+    f->lineno = 449;
+L196: /* GGET */
+    tp_aot_op(tp, f, code + 196);
+L200: /* STRING */
+    tp_aot_op(tp, f, code + 200);
+L203: /* MGET */
+    tp_aot_op(tp, f, code + 203);
+L205: /* STRING */
+    tp_aot_op(tp, f, code + 205);
+L209: /* STRING */
+    tp_aot_op(tp, f, code + 209);
+L213: /* CALLP */
+    return code + 213;
+L214: /* LIST */
+    tp_aot_op(tp, f, code + 214);
+L215: /* CALLP */
+    return code + 215;
+L216: /* CALLP */
+    return code + 216;
+L217: /* LINE */
+    f->line = code + 217;
+    f->lineno = 452;
+L226: /* STRING */
+    tp_aot_op(tp, f, code + 226);
+L230: /* MGET */
+    tp_aot_op(tp, f, code + 230);
+L232: /* STRING */
+    tp_aot_op(tp, f, code + 232);
+L236: /* EQ */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[4].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 236);
+    }
+L237: /* ASSERT */
+    tp_assert(tp, regs[1], regs[4], regs[5]);
+L238: /* LINE */
+    f->line = code + 238;
+    f->lineno = 453;
+L250: /* GGET */
+    tp_aot_op(tp, f, code + 250);
+L255: /* MOVE */
+    regs[5] = regs[2];
+L256: /* GGET */
+    tp_aot_op(tp, f, code + 256);
+L260: /* STRING */
+    tp_aot_op(tp, f, code + 260);
+L263: /* MGET */
+    tp_aot_op(tp, f, code + 263);
+L265: /* STRING */
+    tp_aot_op(tp, f, code + 265);
+L268: /* MOVE */
+    regs[10] = regs[3];
+L269: /* CALLP */
+    return code + 269;
+L270: /* CALLP */
+    return code + 270;
+L271: /* EOF */
+    return code + 271;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_10553(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 31: goto L31;
+        case 33: goto L33;
+        case 37: goto L37;
+        case 39: goto L39;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 50: goto L50;
+        case 53: goto L53;
+        case 57: goto L57;
+        case 59: goto L59;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 71: goto L71;
+        case 76: goto L76;
+        case 78: goto L78;
+        case 79: goto L79;
+        case 88: goto L88;
+        case 92: goto L92;
+        case 94: goto L94;
+        case 98: goto L98;
+        case 99: goto L99;
+        case 100: goto L100;
+        case 101: goto L101;
+        case 110: goto L110;
+        case 113: goto L113;
+        case 115: goto L115;
+        case 118: goto L118;
+        case 119: goto L119;
+        case 120: goto L120;
+        case 121: goto L121;
+        case 132: goto L132;
+        case 137: goto L137;
+        case 139: goto L139;
+        case 140: goto L140;
+        case 141: goto L141;
+        case 150: goto L150;
+        case 154: goto L154;
+        case 156: goto L156;
+        case 160: goto L160;
+        case 161: goto L161;
+        case 162: goto L162;
+        case 163: goto L163;
+        case 182: goto L182;
+        case 186: goto L186;
+        case 189: goto L189;
+        case 191: goto L191;
+        case 195: goto L195;
+        case 196: goto L196;
+        case 201: goto L201;
+        case 203: goto L203;
+        case 204: goto L204;
+        case 205: goto L205;
+        case 206: goto L206;
+        case 207: goto L207;
+        case 217: goto L217;
+        case 221: goto L221;
+        case 223: goto L223;
+        case 227: goto L227;
+        case 228: goto L228;
+        case 229: goto L229;
+        case 230: goto L230;
+        case 244: goto L244;
+        case 248: goto L248;
+        case 251: goto L251;
+        case 253: goto L253;
+        case 257: goto L257;
+        case 258: goto L258;
+        case 262: goto L262;
+        case 263: goto L263;
+        case 277: goto L277;
+        case 281: goto L281;
+        case 283: goto L283;
+        case 286: goto L286;
+        case 287: goto L287;
+        case 288: goto L288;
+        case 290: goto L290;
+        case 304: goto L304;
+        case 318: goto L318;
+        case 323: goto L323;
+        case 325: goto L325;
+        case 326: goto L326;
+        case 340: goto L340;
+        case 341: goto L341;
+        case 342: goto L342;
+        case 343: goto L343;
+        case 344: goto L344;
+        case 345: goto L345;
+        case 360: goto L360;
+        case 365: goto L365;
+        case 369: goto L369;
+        case 371: goto L371;
+        case 376: goto L376;
+        case 379: goto L379;
+        case 383: goto L383;
+        case 385: goto L385;
+        case 388: goto L388;
+        case 390: goto L390;
+        case 391: goto L391;
+        case 402: goto L402;
+        case 404: goto L404;
+        case 407: goto L407;
+        case 411: goto L411;
+        case 414: goto L414;
+        case 416: goto L416;
+        case 420: goto L420;
+        case 421: goto L421;
+        case 433: goto L433;
+        case 437: goto L437;
+        case 440: goto L440;
+        case 442: goto L442;
+        case 446: goto L446;
+        case 451: goto L451;
+        case 452: goto L452;
+        case 457: goto L457;
+        case 458: goto L458;
+        case 463: goto L463;
+        case 464: goto L464;
+        case 465: goto L465;
+        case 466: goto L466;
+        case 467: goto L467;
+        case 480: goto L480;
+        case 482: goto L482;
+        case 485: goto L485;
+        case 489: goto L489;
+        case 492: goto L492;
+        case 494: goto L494;
+        case 498: goto L498;
+        case 503: goto L503;
+        case 504: goto L504;
+        case 505: goto L505;
+        case 512: goto L512;
+        case 516: goto L516;
+        case 520: goto L520;
+        case 521: goto L521;
+        case 522: goto L522;
+        case 523: goto L523;
+        case 528: goto L528;
+        case 533: goto L533;
+        case 534: goto L534;
+        case 535: goto L535;
+        case 540: goto L540;
+        case 545: goto L545;
+        case 546: goto L546;
+        case 547: goto L547;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 455;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 456;
+L31: /* VAR */
+L33: /* STRING */
+    tp_aot_op(tp, f, code + 33);
+L37: /* MGET */
+    tp_aot_op(tp, f, code + 37);
+L39: /* NUMBER */
+    tp_aot_op(tp, f, code + 39);
+L42: /* GET */
+    regs[1] = tp_get(tp, regs[3], regs[2]);
+    tp_grey(tp, regs[1]);
+L43: /* LINE */
+    f->line = code + 43;
+    f->lineno = 457;
+L50: /* VAR */
+L53: /* STRING */
+    tp_aot_op(tp, f, code + 53);
+L57: /* MGET */
+    tp_aot_op(tp, f, code + 57);
+L59: /* NUMBER */
+    tp_aot_op(tp, f, code + 59);
+L62: /* GET */
+    regs[3] = tp_get(tp, regs[2], regs[4]);
+    tp_grey(tp, regs[3]);
+L63: /* LINE */
+    f->line = code + 63;
+    f->lineno = 458;
+L71: /* STRING */
+    tp_aot_op(tp, f, code + 71);
+L76: /* METHOD */
+    tp_aot_op(tp, f, code + 76);
+L78: /* CALLM */
+    return code + 78;
+L79: /* LINE */
+    f->line = code + 79;
+    f->lineno = 460;
+L88: /* STRING */
+    tp_aot_op(tp, f, code + 88);
+L92: /* MGET */
+    tp_aot_op(tp, f, code + 92);
+L94: /* STRING */
+    tp_aot_op(tp, f, code + 94);
+L98: /* EQ */
+    if (TP_BOTH(regs[2], regs[4], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint == regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 98);
+    }
+L99: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L101;
+    }
+L100: /* JUMP */
+    goto L141;
+L101: /* LINE */
+    f->line = code + 101;
+    f->lineno = 462;
+L110: /* STRING */
+    tp_aot_op(tp, f, code + 110);
+L113: /* MGET */
+    tp_aot_op(tp, f, code + 113);
+L115: /* STRING */
+    tp_aot_op(tp, f, code + 115);
+L118: /* EQ */
+    if (TP_BOTH(regs[2], regs[4], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint == regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 118);
+    }
+L119: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L121;
+    }
+L120: /* JUMP */
+    goto L391;
+L121: /* LINE */
+    f->line = code + 121;
+    f->lineno = 463;
+L132: /* STRING */
+    tp_aot_op(tp, f, code + 132);
+L137: /* METHOD */
+    tp_aot_op(tp, f, code + 137);
+L139: /* CALLM */
+    return code + 139;
+L140: /* JUMP */
+    goto L391;
+L141: /* LINE */
+    f->line = code + 141;
+    f->lineno = 464;
+L150: /* STRING */
+    tp_aot_op(tp, f, code + 150);
+L154: /* MGET */
+    tp_aot_op(tp, f, code + 154);
+L156: /* STRING */
+    tp_aot_op(tp, f, code + 156);
+L160: /* EQ */
+    if (TP_BOTH(regs[2], regs[4], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint == regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 160);
+    }
+L161: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L163;
+    }
+L162: /* JUMP */
+    goto L207;
+L163: /* LINE */
+    f->line = code + 163;
+    f->lineno = 465;
+L182: /* GGET */
+    tp_aot_op(tp, f, code + 182);
+L186: /* STRING */
+    tp_aot_op(tp, f, code + 186);
+L189: /* MGET */
+    tp_aot_op(tp, f, code + 189);
+L191: /* STRING */
+    tp_aot_op(tp, f, code + 191);
+L195: /* NONE */
+    regs[7] = tp_None;
+L196: /* STRING */
+    tp_aot_op(tp, f, code + 196);
+L201: /* METHOD */
+    tp_aot_op(tp, f, code + 201);
+L203: /* CALLM */
+    return code + 203;
+L204: /* LIST */
+    tp_aot_op(tp, f, code + 204);
+L205: /* CALLP */
+    return code + 205;
+L206: /* JUMP */
+    goto L391;
+L207: /* LINE */
+    f->line = code + 207;
+    f->lineno = 466;
+L217: /* STRING */
+    tp_aot_op(tp, f, code + 217);
+L221: /* MGET */
+    tp_aot_op(tp, f, code + 221);
+L223: /* STRING */
+    tp_aot_op(tp, f, code + 223);
+L227: /* EQ */
+    if (TP_BOTH(regs[2], regs[4], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint == regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 227);
+    }
+L228: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L230;
+    }
+L229: /* JUMP */
+    goto L345;
+L230: /* LINE */
+    f->line = code + 230;
+    f->lineno = 467;
+L244: /* GGET */
+    tp_aot_op(tp, f, code + 244);
+L248: /* STRING */
+    tp_aot_op(tp, f, code + 248);
+L251: /* MGET */
+    tp_aot_op(tp, f, code + 251);
+L253: /* STRING */
+    tp_aot_op(tp, f, code + 253);
+L257: /* NONE */
+    regs[7] = tp_None;
+L258: /* VAR */
+L262: /* LIST */
+    tp_aot_op(tp, f, code + 262);
+L263: /* LINE */
+    f->line = code + 263;
+    f->lineno = 468;
+L277: /* STRING */
+    tp_aot_op(tp, f, code + 277);
+L281: /* MGET */
+    tp_aot_op(tp, f, code + 281);
+L283: /* NUMBER */
+    tp_aot_op(tp, f, code + 283);
+L286: /* ITER */
+    if (tp_iter_next(tp, &regs[12], regs[13], &regs[14])) {
+        goto L288;
+    }
+L287: /* JUMP */
+    goto L343;
+L288: /* VAR */
+L290: /* LINE */
+    f->line = code + 290;
+    f->lineno = 467;
+L304: /* LINE */
+    f->line = code + 304;
+    f->lineno = 468;
+L318: /* STRING */
+    tp_aot_op(tp, f, code + 318);
+L323: /* METHOD */
+    tp_aot_op(tp, f, code + 323);
+L325: /* CALLM */
+    return code + 325;
+L326: /* LINE */
+    f->line = code + 326;
+    f->lineno = 467;
+L340: /* NONE */
+    regs[15] = tp_None;
+L341: /* SET */
+    tp_set(tp, regs[8], regs[15], regs[12]);
+L342: /* JUMP */
+    tp_aot_safepoint(tp, 56);
+    goto L286;
+L343: /* CALLP */
+    return code + 343;
+L344: /* JUMP */
+    goto L391;
+L345: /* LINE */
+    f->line = code + 345;
+    f->lineno = 470;
+L360: /* GGET */
+    tp_aot_op(tp, f, code + 360);
+L365: /* STRING */
+    tp_aot_op(tp, f, code + 365);
+L369: /* METHOD */
+    tp_aot_op(tp, f, code + 369);
+L371: /* STRING */
+    tp_aot_op(tp, f, code + 371);
+L376: /* GGET */
+    tp_aot_op(tp, f, code + 376);
+L379: /* STRING */
+    tp_aot_op(tp, f, code + 379);
+L383: /* MGET */
+    tp_aot_op(tp, f, code + 383);
+L385: /* STRING */
+    tp_aot_op(tp, f, code + 385);
+L388: /* MGET */
+    tp_aot_op(tp, f, code + 388);
+L390: /* CALLM */
+    return code + 390;
+L391: /* LINE */
+    f->line = code + 391;
+    f->lineno = 472;
+L402: /* VAR */
+L404: /* GGET */
+    tp_aot_op(tp, f, code + 404);
+L407: /* GGET */
+    tp_aot_op(tp, f, code + 407);
+L411: /* STRING */
+    tp_aot_op(tp, f, code + 411);
+L414: /* MGET */
+    tp_aot_op(tp, f, code + 414);
+L416: /* STRING */
+    tp_aot_op(tp, f, code + 416);
+L420: /* NONE */
+    regs[18] = tp_None;
+L421: /* LINE */
+    f->line = code + 421;
+    f->lineno = 473;
+L433: /* GGET */
+    tp_aot_op(tp, f, code + 433);
+L437: /* STRING */
+    tp_aot_op(tp, f, code + 437);
+L440: /* MGET */
+    tp_aot_op(tp, f, code + 440);
+L442: /* STRING */
+    tp_aot_op(tp, f, code + 442);
+L446: /* STRING */
+    tp_aot_op(tp, f, code + 446);
+L451: /* CALLP */
+    return code + 451;
+L452: /* LINE */
+    f->line = code + 452;
+    f->lineno = 474;
+L457: /* MOVE */
+    regs[13] = regs[1];
+L458: /* LINE */
+    f->line = code + 458;
+    f->lineno = 475;
+L463: /* MOVE */
+    regs[14] = regs[3];
+L464: /* LIST */
+    tp_aot_op(tp, f, code + 464);
+L465: /* CALLP */
+    return code + 465;
+L466: /* CALLP */
+    return code + 466;
+L467: /* LINE */
+    f->line = code + 467;
+    f->lineno = 478;
+L480: /* VAR */
+L482: /* GGET */
+    tp_aot_op(tp, f, code + 482);
+L485: /* GGET */
+    tp_aot_op(tp, f, code + 485);
+L489: /* STRING */
+    tp_aot_op(tp, f, code + 489);
+L492: /* MGET */
+    tp_aot_op(tp, f, code + 492);
+L494: /* STRING */
+    tp_aot_op(tp, f, code + 494);
+L498: /* STRING */
+    tp_aot_op(tp, f, code + 498);
+L503: /* CALLP */
+    return code + 503;
+L504: /* CALLP */
+    return code + 504;
+L505: /* LINE */
+    f->line = code + 505;
+    f->lineno = 479;
+L512: /* GGET */
+    tp_aot_op(tp, f, code + 512);
+L516: /* GGET */
+    tp_aot_op(tp, f, code + 516);
+L520: /* MOVE */
+    regs[17] = regs[4];
+L521: /* MOVE */
+    regs[18] = regs[2];
+L522: /* CALLP */
+    return code + 522;
+L523: /* LINE */
+    f->line = code + 523;
+    f->lineno = 480;
+L528: /* GGET */
+    tp_aot_op(tp, f, code + 528);
+L533: /* MOVE */
+    regs[7] = regs[4];
+L534: /* CALLP */
+    return code + 534;
+L535: /* LINE */
+    f->line = code + 535;
+    f->lineno = 481;
+L540: /* GGET */
+    tp_aot_op(tp, f, code + 540);
+L545: /* MOVE */
+    regs[7] = regs[2];
+L546: /* CALLP */
+    return code + 546;
+L547: /* EOF */
+    return code + 547;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_11123(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 33: goto L33;
+        case 37: goto L37;
+        case 39: goto L39;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 45: goto L45;
+        case 55: goto L55;
+        case 58: goto L58;
+        case 60: goto L60;
+        case 63: goto L63;
+        case 67: goto L67;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 72: goto L72;
+        case 82: goto L82;
+        case 85: goto L85;
+        case 89: goto L89;
+        case 91: goto L91;
+        case 95: goto L95;
+        case 97: goto L97;
+        case 100: goto L100;
+        case 102: goto L102;
+        case 103: goto L103;
+        case 104: goto L104;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 483;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 484;
+L33: /* STRING */
+    tp_aot_op(tp, f, code + 33);
+L37: /* MGET */
+    tp_aot_op(tp, f, code + 37);
+L39: /* NUMBER */
+    tp_aot_op(tp, f, code + 39);
+L42: /* ITER */
+    if (tp_iter_next(tp, &regs[1], regs[3], &regs[2])) {
+        goto L44;
+    }
+L43: /* JUMP */
+    goto L104;
+L44: /* MOVE */
+    regs[0] = regs[1];
+L45: /* LINE */
+    f->line = code + 45;
+    f->lineno = 485;
+L55: /* STRING */
+    tp_aot_op(tp, f, code + 55);
+L58: /* MGET */
+    tp_aot_op(tp, f, code + 58);
+L60: /* GGET */
+    tp_aot_op(tp, f, code + 60);
+L63: /* STRING */
+    tp_aot_op(tp, f, code + 63);
+L67: /* MGET */
+    tp_aot_op(tp, f, code + 67);
+L69: /* NOTIN */
+    regs[1] = tp_bool(!tp_true(tp, tp_has(tp, regs[4], regs[1])));
+L70: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L72;
+    }
+L71: /* JUMP */
+    tp_aot_safepoint(tp, 29);
+    goto L42;
+L72: /* LINE */
+    f->line = code + 72;
+    f->lineno = 486;
+L82: /* GGET */
+    tp_aot_op(tp, f, code + 82);
+L85: /* STRING */
+    tp_aot_op(tp, f, code + 85);
+L89: /* MGET */
+    tp_aot_op(tp, f, code + 89);
+L91: /* STRING */
+    tp_aot_op(tp, f, code + 91);
+L95: /* METHOD */
+    tp_aot_op(tp, f, code + 95);
+L97: /* STRING */
+    tp_aot_op(tp, f, code + 97);
+L100: /* MGET */
+    tp_aot_op(tp, f, code + 100);
+L102: /* CALLM */
+    return code + 102;
+L103: /* JUMP */
+    tp_aot_safepoint(tp, 61);
+    goto L42;
+L104: /* EOF */
+    return code + 104;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_11250(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 31: goto L31;
+        case 35: goto L35;
+        case 37: goto L37;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 44: goto L44;
+        case 45: goto L45;
+        case 53: goto L53;
+        case 55: goto L55;
+        case 58: goto L58;
+        case 62: goto L62;
+        case 64: goto L64;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 77: goto L77;
+        case 79: goto L79;
+        case 82: goto L82;
+        case 86: goto L86;
+        case 88: goto L88;
+        case 91: goto L91;
+        case 92: goto L92;
+        case 93: goto L93;
+        case 100: goto L100;
+        case 104: goto L104;
+        case 107: goto L107;
+        case 108: goto L108;
+        case 109: goto L109;
+        case 120: goto L120;
+        case 125: goto L125;
+        case 126: goto L126;
+        case 127: goto L127;
+        case 132: goto L132;
+        case 133: goto L133;
+        case 134: goto L134;
+        case 135: goto L135;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 487;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 488;
+L31: /* STRING */
+    tp_aot_op(tp, f, code + 31);
+L35: /* MGET */
+    tp_aot_op(tp, f, code + 35);
+L37: /* NUMBER */
+    tp_aot_op(tp, f, code + 37);
+L40: /* ITER */
+    if (tp_iter_next(tp, &regs[1], regs[3], &regs[2])) {
+        goto L42;
+    }
+L41: /* JUMP */
+    goto L135;
+L42: /* VAR */
+L44: /* MOVE */
+    regs[4] = regs[1];
+L45: /* LINE */
+    f->line = code + 45;
+    f->lineno = 489;
+L53: /* VAR */
+L55: /* GGET */
+    tp_aot_op(tp, f, code + 55);
+L58: /* STRING */
+    tp_aot_op(tp, f, code + 58);
+L62: /* MGET */
+    tp_aot_op(tp, f, code + 62);
+L64: /* NUMBER */
+    tp_aot_op(tp, f, code + 64);
+L67: /* GET */
+    regs[6] = tp_get(tp, regs[6], regs[7]);
+    tp_grey(tp, regs[6]);
+L68: /* CALLP */
+    return code + 68;
+L69: /* LINE */
+    f->line = code + 69;
+    f->lineno = 490;
+L77: /* VAR */
+L79: /* GGET */
+    tp_aot_op(tp, f, code + 79);
+L82: /* STRING */
+    tp_aot_op(tp, f, code + 82);
+L86: /* MGET */
+    tp_aot_op(tp, f, code + 86);
+L88: /* NUMBER */
+    tp_aot_op(tp, f, code + 88);
+L91: /* GET */
+    regs[7] = tp_get(tp, regs[7], regs[8]);
+    tp_grey(tp, regs[7]);
+L92: /* CALLP */
+    return code + 92;
+L93: /* LINE */
+    f->line = code + 93;
+    f->lineno = 491;
+L100: /* GGET */
+    tp_aot_op(tp, f, code + 100);
+L104: /* GGET */
+    tp_aot_op(tp, f, code + 104);
+L107: /* MOVE */
+    regs[8] = regs[1];
+L108: /* CALLP */
+    return code + 108;
+L109: /* LINE */
+    f->line = code + 109;
+    f->lineno = 492;
+L120: /* GGET */
+    tp_aot_op(tp, f, code + 120);
+L125: /* MOVE */
+    regs[7] = regs[1];
+L126: /* CALLP */
+    return code + 126;
+L127: /* GGET */
+    tp_aot_op(tp, f, code + 127);
+L132: /* MOVE */
+    regs[7] = regs[9];
+L133: /* CALLP */
+    return code + 133;
+L134: /* JUMP */
+    tp_aot_safepoint(tp, 94);
+    goto L40;
+L135: /* EOF */
+    return code + 135;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_11417(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 15: goto L15;
+        case 17: goto L17;
+        case 26: goto L26;
+        case 27: goto L27;
+        case 33: goto L33;
+        case 34: goto L34;
+        case 43: goto L43;
+        case 46: goto L46;
+        case 51: goto L51;
+        case 54: goto L54;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 61: goto L61;
+        case 73: goto L73;
+        case 76: goto L76;
+        case 80: goto L80;
+        case 82: goto L82;
+        case 85: goto L85;
+        case 86: goto L86;
+        case 87: goto L87;
+        case 90: goto L90;
+        case 94: goto L94;
+        case 96: goto L96;
+        case 99: goto L99;
+        case 100: goto L100;
+        case 101: goto L101;
+        case 103: goto L103;
+        case 104: goto L104;
+        case 106: goto L106;
+        case 107: goto L107;
+        case 116: goto L116;
+        case 120: goto L120;
+        case 124: goto L124;
+        case 127: goto L127;
+        case 128: goto L128;
+        case 129: goto L129;
+        case 130: goto L130;
+        case 131: goto L131;
+        case 140: goto L140;
+        case 144: goto L144;
+        case 147: goto L147;
+        case 150: goto L150;
+        case 155: goto L155;
+        case 156: goto L156;
+        case 157: goto L157;
+        case 166: goto L166;
+        case 171: goto L171;
+        case 172: goto L172;
+        case 173: goto L173;
+        case 178: goto L178;
+        case 179: goto L179;
+        case 180: goto L180;
+        case 184: goto L184;
+        case 186: goto L186;
+        case 189: goto L189;
+        case 190: goto L190;
+        case 196: goto L196;
+        case 199: goto L199;
+        case 200: goto L200;
+        case 201: goto L201;
+        case 203: goto L203;
+        case 204: goto L204;
+        case 212: goto L212;
+        case 215: goto L215;
+        case 216: goto L216;
+        case 217: goto L217;
+        case 218: goto L218;
+        case 226: goto L226;
+        case 227: goto L227;
+        case 228: goto L228;
+        case 229: goto L229;
+        case 230: goto L230;
+        case 240: goto L240;
+        case 244: goto L244;
+        case 248: goto L248;
+        case 249: goto L249;
+        case 250: goto L250;
+        case 251: goto L251;
+        case 258: goto L258;
+        case 263: goto L263;
+        case 264: goto L264;
+        case 265: goto L265;
+        case 270: goto L270;
+        case 273: goto L273;
+        case 274: goto L274;
+        case 275: goto L275;
+        case 276: goto L276;
+        case 286: goto L286;
+        case 290: goto L290;
+        case 294: goto L294;
+        case 295: goto L295;
+        case 298: goto L298;
+        case 299: goto L299;
+        case 302: goto L302;
+        case 303: goto L303;
+        case 304: goto L304;
+        case 305: goto L305;
+        case 311: goto L311;
+        case 316: goto L316;
+        case 317: goto L317;
+        case 318: goto L318;
+        case 323: goto L323;
+        case 324: goto L324;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 494;
+L11: /* VAR */
+L13: /* VAR */
+L15: /* VAR */
+L17: /* STRING */
+    tp_aot_op(tp, f, code + 17);
+L26: /* FILE */
+    f->fname = regs[3];
+L27: /* STRING */
+    tp_aot_op(tp, f, code + 27);
+L33: /* NAME */
+    f->name = regs[3];
+L34: /* LINE */
+    f->line = code + 34;
+    f->lineno = 498;
+L43: /* VAR */
+L46: /* GGET */
+    tp_aot_op(tp, f, code + 46);
+L51: /* NUMBER */
+    tp_aot_op(tp, f, code + 51);
+L54: /* GGET */
+    tp_aot_op(tp, f, code + 54);
+L57: /* MOVE */
+    regs[8] = regs[1];
+L58: /* CALLP */
+    return code + 58;
+L59: /* ADD */
+    if (TP_BOTH(regs[5], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[5].nint + regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 59);
+    }
+L60: /* CALLP */
+    return code + 60;
+L61: /* LINE */
+    f->line = code + 61;
+    f->lineno = 499;
+L73: /* GGET */
+    tp_aot_op(tp, f, code + 73);
+L76: /* STRING */
+    tp_aot_op(tp, f, code + 76);
+L80: /* MGET */
+    tp_aot_op(tp, f, code + 80);
+L82: /* NUMBER */
+    tp_aot_op(tp, f, code + 82);
+L85: /* GET */
+    regs[6] = tp_get(tp, regs[6], regs[7]);
+    tp_grey(tp, regs[6]);
+L86: /* CALLP */
+    return code + 86;
+L87: /* GGET */
+    tp_aot_op(tp, f, code + 87);
+L90: /* STRING */
+    tp_aot_op(tp, f, code + 90);
+L94: /* MGET */
+    tp_aot_op(tp, f, code + 94);
+L96: /* NUMBER */
+    tp_aot_op(tp, f, code + 96);
+L99: /* GET */
+    regs[7] = tp_get(tp, regs[7], regs[8]);
+    tp_grey(tp, regs[7]);
+L100: /* CALLP */
+    return code + 100;
+L101: /* VAR */
+L103: /* MOVE */
+    regs[5] = regs[12];
+L104: /* VAR */
+L106: /* MOVE */
+    regs[12] = regs[4];
+L107: /* LINE */
+    f->line = code + 107;
+    f->lineno = 500;
+L116: /* GGET */
+    tp_aot_op(tp, f, code + 116);
+L120: /* GGET */
+    tp_aot_op(tp, f, code + 120);
+L124: /* NUMBER */
+    tp_aot_op(tp, f, code + 124);
+L127: /* GET */
+    regs[8] = tp_get(tp, regs[3], regs[11]);
+    tp_grey(tp, regs[8]);
+L128: /* MOVE */
+    regs[9] = regs[5];
+L129: /* MOVE */
+    regs[10] = regs[12];
+L130: /* CALLP */
+    return code + 130;
+L131: /* LINE */
+    f->line = code + 131;
+    f->lineno = 501;
+L140: /* GGET */
+    tp_aot_op(tp, f, code + 140);
+L144: /* NUMBER */
+    tp_aot_op(tp, f, code + 144);
+L147: /* NUMBER */
+    tp_aot_op(tp, f, code + 147);
+L150: /* GGET */
+    tp_aot_op(tp, f, code + 150);
+L155: /* CALLP */
+    return code + 155;
+L156: /* CALLP */
+    return code + 156;
+L157: /* LINE */
+    f->line = code + 157;
+    f->lineno = 502;
+L166: /* GGET */
+    tp_aot_op(tp, f, code + 166);
+L171: /* MOVE */
+    regs[7] = regs[5];
+L172: /* CALLP */
+    return code + 172;
+L173: /* GGET */
+    tp_aot_op(tp, f, code + 173);
+L178: /* MOVE */
+    regs[7] = regs[12];
+L179: /* CALLP */
+    return code + 179;
+L180: /* LINE */
+    f->line = code + 180;
+    f->lineno = 503;
+L184: /* VAR */
+L186: /* NUMBER */
+    tp_aot_op(tp, f, code + 186);
+L189: /* MOVE */
+    regs[4] = regs[6];
+L190: /* LINE */
+    f->line = code + 190;
+    f->lineno = 504;
+L196: /* NUMBER */
+    tp_aot_op(tp, f, code + 196);
+L199: /* ITER */
+    if (tp_iter_next(tp, &regs[6], regs[1], &regs[7])) {
+        goto L201;
+    }
+L200: /* JUMP */
+    goto L276;
+L201: /* VAR */
+L203: /* MOVE */
+    regs[8] = regs[6];
+L204: /* LINE */
+    f->line = code + 204;
+    f->lineno = 505;
+L212: /* GGET */
+    tp_aot_op(tp, f, code + 212);
+L215: /* MOVE */
+    regs[10] = regs[8];
+L216: /* GET */
+    regs[11] = tp_get(tp, regs[3], regs[4]);
+    tp_grey(tp, regs[11]);
+L217: /* CALLP */
+    return code + 217;
+L218: /* LINE */
+    f->line = code + 218;
+    f->lineno = 506;
+L226: /* GET */
+    regs[9] = tp_get(tp, regs[3], regs[4]);
+    tp_grey(tp, regs[9]);
+L227: /* NE */
+    if (TP_BOTH(regs[5], regs[9], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[5].nint != regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 227);
+    }
+L228: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L230;
+    }
+L229: /* JUMP */
+    goto L265;
+L230: /* LINE */
+    f->line = code + 230;
+    f->lineno = 507;
+L240: /* GGET */
+    tp_aot_op(tp, f, code + 240);
+L244: /* GGET */
+    tp_aot_op(tp, f, code + 244);
+L248: /* GET */
+    regs[11] = tp_get(tp, regs[3], regs[4]);
+    tp_grey(tp, regs[11]);
+L249: /* MOVE */
+    regs[12] = regs[5];
+L250: /* CALLP */
+    return code + 250;
+L251: /* LINE */
+    f->line = code + 251;
+    f->lineno = 508;
+L258: /* GGET */
+    tp_aot_op(tp, f, code + 258);
+L263: /* MOVE */
+    regs[10] = regs[5];
+L264: /* CALLP */
+    return code + 264;
+L265: /* LINE */
+    f->line = code + 265;
+    f->lineno = 509;
+L270: /* NUMBER */
+    tp_aot_op(tp, f, code + 270);
+L273: /* ADD */
+    if (TP_BOTH(regs[4], regs[9], TP_NUMBER_INT)) {
+        regs[6] = tp_int(regs[4].nint + regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 273);
+    }
+L274: /* MOVE */
+    regs[4] = regs[6];
+L275: /* JUMP */
+    tp_aot_safepoint(tp, 76);
+    goto L199;
+L276: /* LINE */
+    f->line = code + 276;
+    f->lineno = 510;
+L286: /* GGET */
+    tp_aot_op(tp, f, code + 286);
+L290: /* GGET */
+    tp_aot_op(tp, f, code + 290);
+L294: /* MOVE */
+    regs[11] = regs[2];
+L295: /* NUMBER */
+    tp_aot_op(tp, f, code + 295);
+L298: /* GET */
+    regs[12] = tp_get(tp, regs[3], regs[7]);
+    tp_grey(tp, regs[12]);
+L299: /* GGET */
+    tp_aot_op(tp, f, code + 299);
+L302: /* MOVE */
+    regs[1] = regs[3];
+L303: /* CALLP */
+    return code + 303;
+L304: /* CALLP */
+    return code + 304;
+L305: /* LINE */
+    f->line = code + 305;
+    f->lineno = 511;
+L311: /* GGET */
+    tp_aot_op(tp, f, code + 311);
+L316: /* MOVE */
+    regs[10] = regs[3];
+L317: /* CALLP */
+    return code + 317;
+L318: /* LINE */
+    f->line = code + 318;
+    f->lineno = 512;
+L323: /* RETURN */
+    return code + 323;
+L324: /* EOF */
+    return code + 324;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_11771(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 22: goto L22;
+        case 23: goto L23;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 34: goto L34;
+        case 37: goto L37;
+        case 41: goto L41;
+        case 43: goto L43;
+        case 53: goto L53;
+        case 58: goto L58;
+        case 62: goto L62;
+        case 64: goto L64;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 73: goto L73;
+        case 75: goto L75;
+        case 78: goto L78;
+        case 79: goto L79;
+        case 81: goto L81;
+        case 84: goto L84;
+        case 85: goto L85;
+        case 87: goto L87;
+        case 90: goto L90;
+        case 91: goto L91;
+        case 93: goto L93;
+        case 96: goto L96;
+        case 97: goto L97;
+        case 110: goto L110;
+        case 113: goto L113;
+        case 114: goto L114;
+        case 115: goto L115;
+        case 118: goto L118;
+        case 119: goto L119;
+        case 120: goto L120;
+        case 121: goto L121;
+        case 122: goto L122;
+        case 123: goto L123;
+        case 124: goto L124;
+        case 125: goto L125;
+        case 126: goto L126;
+        case 127: goto L127;
+        case 128: goto L128;
+        case 129: goto L129;
+        case 136: goto L136;
+        case 140: goto L140;
+        case 141: goto L141;
+        case 142: goto L142;
+        case 152: goto L152;
+        case 155: goto L155;
+        case 156: goto L156;
+        case 160: goto L160;
+        case 162: goto L162;
+        case 166: goto L166;
+        case 167: goto L167;
+        case 168: goto L168;
+        case 169: goto L169;
+        case 182: goto L182;
+        case 188: goto L188;
+        case 191: goto L191;
+        case 192: goto L192;
+        case 193: goto L193;
+        case 194: goto L194;
+        case 195: goto L195;
+        case 196: goto L196;
+        case 208: goto L208;
+        case 213: goto L213;
+        case 217: goto L217;
+        case 218: goto L218;
+        case 221: goto L221;
+        case 222: goto L222;
+        case 223: goto L223;
+        case 224: goto L224;
+        case 225: goto L225;
+        case 231: goto L231;
+        case 232: goto L232;
+        case 239: goto L239;
+        case 241: goto L241;
+        case 244: goto L244;
+        case 247: goto L247;
+        case 248: goto L248;
+        case 249: goto L249;
+        case 254: goto L254;
+        case 256: goto L256;
+        case 257: goto L257;
+        case 267: goto L267;
+        case 270: goto L270;
+        case 271: goto L271;
+        case 272: goto L272;
+        case 275: goto L275;
+        case 276: goto L276;
+        case 277: goto L277;
+        case 278: goto L278;
+        case 279: goto L279;
+        case 280: goto L280;
+        case 281: goto L281;
+        case 282: goto L282;
+        case 297: goto L297;
+        case 300: goto L300;
+        case 304: goto L304;
+        case 307: goto L307;
+        case 309: goto L309;
+        case 313: goto L313;
+        case 314: goto L314;
+        case 315: goto L315;
+        case 316: goto L316;
+        case 317: goto L317;
+        case 321: goto L321;
+        case 322: goto L322;
+        case 323: goto L323;
+        case 329: goto L329;
+        case 332: goto L332;
+        case 333: goto L333;
+        case 334: goto L334;
+        case 336: goto L336;
+        case 337: goto L337;
+        case 346: goto L346;
+        case 350: goto L350;
+        case 352: goto L352;
+        case 355: goto L355;
+        case 357: goto L357;
+        case 360: goto L360;
+        case 361: goto L361;
+        case 363: goto L363;
+        case 366: goto L366;
+        case 367: goto L367;
+        case 380: goto L380;
+        case 383: goto L383;
+        case 388: goto L388;
+        case 390: goto L390;
+        case 391: goto L391;
+        case 392: goto L392;
+        case 395: goto L395;
+        case 396: goto L396;
+        case 397: goto L397;
+        case 399: goto L399;
+        case 400: goto L400;
+        case 402: goto L402;
+        case 403: goto L403;
+        case 412: goto L412;
+        case 416: goto L416;
+        case 419: goto L419;
+        case 420: goto L420;
+        case 421: goto L421;
+        case 422: goto L422;
+        case 423: goto L423;
+        case 435: goto L435;
+        case 440: goto L440;
+        case 441: goto L441;
+        case 442: goto L442;
+        case 447: goto L447;
+        case 448: goto L448;
+        case 449: goto L449;
+        case 450: goto L450;
+        case 455: goto L455;
+        case 456: goto L456;
+        case 457: goto L457;
+        case 466: goto L466;
+        case 468: goto L468;
+        case 471: goto L471;
+        case 475: goto L475;
+        case 477: goto L477;
+        case 480: goto L480;
+        case 481: goto L481;
+        case 482: goto L482;
+        case 489: goto L489;
+        case 493: goto L493;
+        case 494: goto L494;
+        case 495: goto L495;
+        case 504: goto L504;
+        case 508: goto L508;
+        case 512: goto L512;
+        case 513: goto L513;
+        case 514: goto L514;
+        case 515: goto L515;
+        case 525: goto L525;
+        case 530: goto L530;
+        case 533: goto L533;
+        case 534: goto L534;
+        case 537: goto L537;
+        case 540: goto L540;
+        case 543: goto L543;
+        case 544: goto L544;
+        case 547: goto L547;
+        case 550: goto L550;
+        case 551: goto L551;
+        case 561: goto L561;
+        case 566: goto L566;
+        case 570: goto L570;
+        case 571: goto L571;
+        case 572: goto L572;
+        case 573: goto L573;
+        case 579: goto L579;
+        case 580: goto L580;
+        case 581: goto L581;
+        case 582: goto L582;
+        case 583: goto L583;
+        case 591: goto L591;
+        case 594: goto L594;
+        case 598: goto L598;
+        case 600: goto L600;
+        case 603: goto L603;
+        case 604: goto L604;
+        case 605: goto L605;
+        case 616: goto L616;
+        case 620: goto L620;
+        case 623: goto L623;
+        case 624: goto L624;
+        case 625: goto L625;
+        case 626: goto L626;
+        case 627: goto L627;
+        case 635: goto L635;
+        case 640: goto L640;
+        case 641: goto L641;
+        case 642: goto L642;
+        case 648: goto L648;
+        case 649: goto L649;
+        case 650: goto L650;
+        case 651: goto L651;
+        case 652: goto L652;
+        case 661: goto L661;
+        case 665: goto L665;
+        case 669: goto L669;
+        case 670: goto L670;
+        case 671: goto L671;
+        case 672: goto L672;
+        case 673: goto L673;
+        case 681: goto L681;
+        case 686: goto L686;
+        case 687: goto L687;
+        case 688: goto L688;
+        case 694: goto L694;
+        case 698: goto L698;
+        case 699: goto L699;
+        case 700: goto L700;
+        case 709: goto L709;
+        case 713: goto L713;
+        case 717: goto L717;
+        case 718: goto L718;
+        case 719: goto L719;
+        case 720: goto L720;
+        case 721: goto L721;
+        case 728: goto L728;
+        case 733: goto L733;
+        case 734: goto L734;
+        case 735: goto L735;
+        case 746: goto L746;
+        case 751: goto L751;
+        case 752: goto L752;
+        case 753: goto L753;
+        case 754: goto L754;
+        case 755: goto L755;
+        case 760: goto L760;
+        case 761: goto L761;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 514;
+L9: /* VAR */
+L11: /* VAR */
+L13: /* STRING */
+    tp_aot_op(tp, f, code + 13);
+L22: /* FILE */
+    f->fname = regs[2];
+L23: /* STRING */
+    tp_aot_op(tp, f, code + 23);
+L27: /* NAME */
+    f->name = regs[2];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 515;
+L34: /* VAR */
+L37: /* STRING */
+    tp_aot_op(tp, f, code + 37);
+L41: /* MGET */
+    tp_aot_op(tp, f, code + 41);
+L43: /* LINE */
+    f->line = code + 43;
+    f->lineno = 516;
+L53: /* GGET */
+    tp_aot_op(tp, f, code + 53);
+L58: /* STRING */
+    tp_aot_op(tp, f, code + 58);
+L62: /* MGET */
+    tp_aot_op(tp, f, code + 62);
+L64: /* NUMBER */
+    tp_aot_op(tp, f, code + 64);
+L67: /* NONE */
+    regs[7] = tp_None;
+L68: /* LIST */
+    tp_aot_op(tp, f, code + 68);
+L69: /* GET */
+    regs[4] = tp_get(tp, regs[4], regs[5]);
+    tp_grey(tp, regs[4]);
+L70: /* CALLP */
+    return code + 70;
+L71: /* VAR */
+L73: /* VAR */
+L75: /* NUMBER */
+    tp_aot_op(tp, f, code + 75);
+L78: /* GET */
+    regs[3] = tp_get(tp, regs[11], regs[5]);
+    tp_grey(tp, regs[3]);
+L79: /* VAR */
+L81: /* NUMBER */
+    tp_aot_op(tp, f, code + 81);
+L84: /* GET */
+    regs[4] = tp_get(tp, regs[11], regs[6]);
+    tp_grey(tp, regs[4]);
+L85: /* VAR */
+L87: /* NUMBER */
+    tp_aot_op(tp, f, code + 87);
+L90: /* GET */
+    regs[5] = tp_get(tp, regs[11], regs[7]);
+    tp_grey(tp, regs[5]);
+L91: /* VAR */
+L93: /* NUMBER */
+    tp_aot_op(tp, f, code + 93);
+L96: /* GET */
+    regs[6] = tp_get(tp, regs[11], regs[8]);
+    tp_grey(tp, regs[6]);
+L97: /* LINE */
+    f->line = code + 97;
+    f->lineno = 517;
+L110: /* GGET */
+    tp_aot_op(tp, f, code + 110);
+L113: /* MOVE */
+    regs[8] = regs[4];
+L114: /* CALLP */
+    return code + 114;
+L115: /* NUMBER */
+    tp_aot_op(tp, f, code + 115);
+L118: /* EQ */
+    if (TP_BOTH(regs[11], regs[7], TP_NUMBER_INT)) {
+        regs[11] = tp_bool(regs[11].nint == regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 118);
+    }
+L119: /* IF */
+    if (TP_IS_INT(regs[11]) ? regs[11].nint != 0 : tp_true(tp, regs[11])) {
+        goto L121;
+    }
+L120: /* JUMP */
+    goto L123;
+L121: /* NONE */
+    regs[7] = tp_None;
+L122: /* EQ */
+    if (TP_BOTH(regs[5], regs[7], TP_NUMBER_INT)) {
+        regs[11] = tp_bool(regs[5].nint == regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 122);
+    }
+L123: /* IF */
+    if (TP_IS_INT(regs[11]) ? regs[11].nint != 0 : tp_true(tp, regs[11])) {
+        goto L125;
+    }
+L124: /* JUMP */
+    goto L127;
+L125: /* NONE */
+    regs[7] = tp_None;
+L126: /* EQ */
+    if (TP_BOTH(regs[6], regs[7], TP_NUMBER_INT)) {
+        regs[11] = tp_bool(regs[6].nint == regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 126);
+    }
+L127: /* IF */
+    if (TP_IS_INT(regs[11]) ? regs[11].nint != 0 : tp_true(tp, regs[11])) {
+        goto L129;
+    }
+L128: /* JUMP */
+    goto L232;
+L129: /* LINE */
+    f->line = code + 129;
+    f->lineno = 520;
+L136: /* GGET */
+    tp_aot_op(tp, f, code + 136);
+L140: /* MOVE */
+    regs[8] = regs[1];
+L141: /* CALLP */
+    return code + 141;
+L142: /* LINE */
+    f->line = code + 142;
+    f->lineno = 521;
+L152: /* NUMBER */
+    tp_aot_op(tp, f, code + 152);
+L155: /* GET */
+    regs[11] = tp_get(tp, regs[2], regs[7]);
+    tp_grey(tp, regs[11]);
+L156: /* STRING */
+    tp_aot_op(tp, f, code + 156);
+L160: /* MGET */
+    tp_aot_op(tp, f, code + 160);
+L162: /* STRING */
+    tp_aot_op(tp, f, code + 162);
+L166: /* EQ */
+    if (TP_BOTH(regs[11], regs[7], TP_NUMBER_INT)) {
+        regs[11] = tp_bool(regs[11].nint == regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 166);
+    }
+L167: /* IF */
+    if (TP_IS_INT(regs[11]) ? regs[11].nint != 0 : tp_true(tp, regs[11])) {
+        goto L169;
+    }
+L168: /* JUMP */
+    goto L196;
+L169: /* LINE */
+    f->line = code + 169;
+    f->lineno = 522;
+L182: /* GGET */
+    tp_aot_op(tp, f, code + 182);
+L188: /* NUMBER */
+    tp_aot_op(tp, f, code + 188);
+L191: /* GET */
+    regs[8] = tp_get(tp, regs[2], regs[12]);
+    tp_grey(tp, regs[8]);
+L192: /* MOVE */
+    regs[9] = regs[3];
+L193: /* MOVE */
+    regs[10] = regs[1];
+L194: /* CALLP */
+    return code + 194;
+L195: /* RETURN */
+    return code + 195;
+L196: /* LINE */
+    f->line = code + 196;
+    f->lineno = 523;
+L208: /* GGET */
+    tp_aot_op(tp, f, code + 208);
+L213: /* GGET */
+    tp_aot_op(tp, f, code + 213);
+L217: /* MOVE */
+    regs[9] = regs[1];
+L218: /* NUMBER */
+    tp_aot_op(tp, f, code + 218);
+L221: /* GET */
+    regs[12] = tp_get(tp, regs[2], regs[13]);
+    tp_grey(tp, regs[12]);
+L222: /* LIST */
+    tp_aot_op(tp, f, code + 222);
+L223: /* ADD */
+    if (TP_BOTH(regs[10], regs[3], TP_NUMBER_INT)) {
+        regs[10] = tp_int(regs[10].nint + regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 223);
+    }
+L224: /* CALLP */
+    return code + 224;
+L225: /* LINE */
+    f->line = code + 225;
+    f->lineno = 524;
+L231: /* RETURN */
+    return code + 231;
+L232: /* LINE */
+    f->line = code + 232;
+    f->lineno = 525;
+L239: /* VAR */
+L241: /* GGET */
+    tp_aot_op(tp, f, code + 241);
+L244: /* NUMBER */
+    tp_aot_op(tp, f, code + 244);
+L247: /* GET */
+    regs[9] = tp_get(tp, regs[2], regs[10]);
+    tp_grey(tp, regs[9]);
+L248: /* CALLP */
+    return code + 248;
+L249: /* LINE */
+    f->line = code + 249;
+    f->lineno = 526;
+L254: /* VAR */
+L256: /* NONE */
+    regs[7] = tp_None;
+L257: /* LINE */
+    f->line = code + 257;
+    f->lineno = 527;
+L267: /* GGET */
+    tp_aot_op(tp, f, code + 267);
+L270: /* MOVE */
+    regs[10] = regs[4];
+L271: /* CALLP */
+    return code + 271;
+L272: /* NUMBER */
+    tp_aot_op(tp, f, code + 272);
+L275: /* NE */
+    if (TP_BOTH(regs[8], regs[9], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[8].nint != regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 275);
+    }
+L276: /* IFN */
+    if (!(TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8]))) {
+        goto L278;
+    }
+L277: /* JUMP */
+    goto L280;
+L278: /* NONE */
+    regs[9] = tp_None;
+L279: /* NE */
+    if (TP_BOTH(regs[6], regs[9], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[6].nint != regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 279);
+    }
+L280: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L282;
+    }
+L281: /* JUMP */
+    goto L515;
+L282: /* LINE */
+    f->line = code + 282;
+    f->lineno = 528;
+L297: /* GGET */
+    tp_aot_op(tp, f, code + 297);
+L300: /* GGET */
+    tp_aot_op(tp, f, code + 300);
+L304: /* STRING */
+    tp_aot_op(tp, f, code + 304);
+L307: /* MGET */
+    tp_aot_op(tp, f, code + 307);
+L309: /* STRING */
+    tp_aot_op(tp, f, code + 309);
+L313: /* NONE */
+    regs[15] = tp_None;
+L314: /* LIST */
+    tp_aot_op(tp, f, code + 314);
+L315: /* CALLP */
+    return code + 315;
+L316: /* CALLP */
+    return code + 316;
+L317: /* GGET */
+    tp_aot_op(tp, f, code + 317);
+L321: /* MOVE */
+    regs[10] = regs[7];
+L322: /* CALLP */
+    return code + 322;
+L323: /* LINE */
+    f->line = code + 323;
+    f->lineno = 529;
+L329: /* NUMBER */
+    tp_aot_op(tp, f, code + 329);
+L332: /* ITER */
+    if (tp_iter_next(tp, &regs[8], regs[4], &regs[9])) {
+        goto L334;
+    }
+L333: /* JUMP */
+    goto L450;
+L334: /* VAR */
+L336: /* MOVE */
+    regs[10] = regs[8];
+L337: /* LINE */
+    f->line = code + 337;
+    f->lineno = 530;
+L346: /* STRING */
+    tp_aot_op(tp, f, code + 346);
+L350: /* MGET */
+    tp_aot_op(tp, f, code + 350);
+L352: /* VAR */
+L355: /* VAR */
+L357: /* NUMBER */
+    tp_aot_op(tp, f, code + 357);
+L360: /* GET */
+    regs[12] = tp_get(tp, regs[8], regs[14]);
+    tp_grey(tp, regs[12]);
+L361: /* VAR */
+L363: /* NUMBER */
+    tp_aot_op(tp, f, code + 363);
+L366: /* GET */
+    regs[13] = tp_get(tp, regs[8], regs[15]);
+    tp_grey(tp, regs[13]);
+L367: /* LINE */
+    f->line = code + 367;
+    f->lineno = 531;
+L380: /* GGET */
+    tp_aot_op(tp, f, code + 380);
+L383: /* STRING */
+    tp_aot_op(tp, f, code + 383);
+L388: /* METHOD */
+    tp_aot_op(tp, f, code + 388);
+L390: /* CALLM */
+    return code + 390;
+L391: /* CALLP */
+    return code + 391;
+L392: /* GGET */
+    tp_aot_op(tp, f, code + 392);
+L395: /* MOVE */
+    regs[17] = regs[13];
+L396: /* CALLP */
+    return code + 396;
+L397: /* VAR */
+L399: /* MOVE */
+    regs[15] = regs[8];
+L400: /* VAR */
+L402: /* MOVE */
+    regs[8] = regs[14];
+L403: /* LINE */
+    f->line = code + 403;
+    f->lineno = 532;
+L412: /* GGET */
+    tp_aot_op(tp, f, code + 412);
+L416: /* GGET */
+    tp_aot_op(tp, f, code + 416);
+L419: /* MOVE */
+    regs[18] = regs[7];
+L420: /* MOVE */
+    regs[19] = regs[15];
+L421: /* MOVE */
+    regs[20] = regs[8];
+L422: /* CALLP */
+    return code + 422;
+L423: /* LINE */
+    f->line = code + 423;
+    f->lineno = 533;
+L435: /* GGET */
+    tp_aot_op(tp, f, code + 435);
+L440: /* MOVE */
+    regs[17] = regs[15];
+L441: /* CALLP */
+    return code + 441;
+L442: /* GGET */
+    tp_aot_op(tp, f, code + 442);
+L447: /* MOVE */
+    regs[17] = regs[8];
+L448: /* CALLP */
+    return code + 448;
+L449: /* JUMP */
+    tp_aot_safepoint(tp, 117);
+    goto L332;
+L450: /* LINE */
+    f->line = code + 450;
+    f->lineno = 534;
+L455: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L457;
+    }
+L456: /* JUMP */
+    goto L515;
+L457: /* LINE */
+    f->line = code + 457;
+    f->lineno = 535;
+L466: /* VAR */
+L468: /* GGET */
+    tp_aot_op(tp, f, code + 468);
+L471: /* STRING */
+    tp_aot_op(tp, f, code + 471);
+L475: /* MGET */
+    tp_aot_op(tp, f, code + 475);
+L477: /* NUMBER */
+    tp_aot_op(tp, f, code + 477);
+L480: /* GET */
+    regs[17] = tp_get(tp, regs[17], regs[18]);
+    tp_grey(tp, regs[17]);
+L481: /* CALLP */
+    return code + 481;
+L482: /* LINE */
+    f->line = code + 482;
+    f->lineno = 536;
+L489: /* GGET */
+    tp_aot_op(tp, f, code + 489);
+L493: /* MOVE */
+    regs[17] = regs[9];
+L494: /* CALLP */
+    return code + 494;
+L495: /* LINE */
+    f->line = code + 495;
+    f->lineno = 537;
+L504: /* GGET */
+    tp_aot_op(tp, f, code + 504);
+L508: /* GGET */
+    tp_aot_op(tp, f, code + 508);
+L512: /* MOVE */
+    regs[18] = regs[7];
+L513: /* MOVE */
+    regs[19] = regs[9];
+L514: /* CALLP */
+    return code + 514;
+L515: /* LINE */
+    f->line = code + 515;
+    f->lineno = 539;
+L525: /* GGET */
+    tp_aot_op(tp, f, code + 525);
+L530: /* NUMBER */
+    tp_aot_op(tp, f, code + 530);
+L533: /* CALLP */
+    return code + 533;
+L534: /* VAR */
+L537: /* VAR */
+L540: /* NUMBER */
+    tp_aot_op(tp, f, code + 540);
+L543: /* GET */
+    regs[16] = tp_get(tp, regs[14], regs[18]);
+    tp_grey(tp, regs[16]);
+L544: /* VAR */
+L547: /* NUMBER */
+    tp_aot_op(tp, f, code + 547);
+L550: /* GET */
+    regs[17] = tp_get(tp, regs[14], regs[19]);
+    tp_grey(tp, regs[17]);
+L551: /* LINE */
+    f->line = code + 551;
+    f->lineno = 543;
+L561: /* GGET */
+    tp_aot_op(tp, f, code + 561);
+L566: /* GGET */
+    tp_aot_op(tp, f, code + 566);
+L570: /* MOVE */
+    regs[20] = regs[16];
+L571: /* MOVE */
+    regs[21] = regs[3];
+L572: /* CALLP */
+    return code + 572;
+L573: /* LINE */
+    f->line = code + 573;
+    f->lineno = 544;
+L579: /* NONE */
+    regs[18] = tp_None;
+L580: /* NE */
+    if (TP_BOTH(regs[5], regs[18], TP_NUMBER_INT)) {
+        regs[14] = tp_bool(regs[5].nint != regs[18].nint);
+    } else {
+        tp_aot_op(tp, f, code + 580);
+    }
+L581: /* IF */
+    if (TP_IS_INT(regs[14]) ? regs[14].nint != 0 : tp_true(tp, regs[14])) {
+        goto L583;
+    }
+L582: /* JUMP */
+    goto L642;
+L583: /* LINE */
+    f->line = code + 583;
+    f->lineno = 545;
+L591: /* GGET */
+    tp_aot_op(tp, f, code + 591);
+L594: /* STRING */
+    tp_aot_op(tp, f, code + 594);
+L598: /* MGET */
+    tp_aot_op(tp, f, code + 598);
+L600: /* NUMBER */
+    tp_aot_op(tp, f, code + 600);
+L603: /* GET */
+    regs[19] = tp_get(tp, regs[19], regs[20]);
+    tp_grey(tp, regs[19]);
+L604: /* CALLP */
+    return code + 604;
+L605: /* LINE */
+    f->line = code + 605;
+    f->lineno = 546;
+L616: /* GGET */
+    tp_aot_op(tp, f, code + 616);
+L620: /* GGET */
+    tp_aot_op(tp, f, code + 620);
+L623: /* MOVE */
+    regs[20] = regs[16];
+L624: /* MOVE */
+    regs[21] = regs[16];
+L625: /* MOVE */
+    regs[22] = regs[8];
+L626: /* CALLP */
+    return code + 626;
+L627: /* LINE */
+    f->line = code + 627;
+    f->lineno = 547;
+L635: /* GGET */
+    tp_aot_op(tp, f, code + 635);
+L640: /* MOVE */
+    regs[19] = regs[8];
+L641: /* CALLP */
+    return code + 641;
+L642: /* LINE */
+    f->line = code + 642;
+    f->lineno = 548;
+L648: /* NONE */
+    regs[18] = tp_None;
+L649: /* NE */
+    if (TP_BOTH(regs[7], regs[18], TP_NUMBER_INT)) {
+        regs[14] = tp_bool(regs[7].nint != regs[18].nint);
+    } else {
+        tp_aot_op(tp, f, code + 649);
+    }
+L650: /* IF */
+    if (TP_IS_INT(regs[14]) ? regs[14].nint != 0 : tp_true(tp, regs[14])) {
+        goto L652;
+    }
+L651: /* JUMP */
+    goto L673;
+L652: /* LINE */
+    f->line = code + 652;
+    f->lineno = 549;
+L661: /* GGET */
+    tp_aot_op(tp, f, code + 661);
+L665: /* GGET */
+    tp_aot_op(tp, f, code + 665);
+L669: /* MOVE */
+    regs[20] = regs[17];
+L670: /* MOVE */
+    regs[21] = regs[7];
+L671: /* CALLP */
+    return code + 671;
+L672: /* JUMP */
+    goto L688;
+L673: /* LINE */
+    f->line = code + 673;
+    f->lineno = 551;
+L681: /* GGET */
+    tp_aot_op(tp, f, code + 681);
+L686: /* MOVE */
+    regs[19] = regs[17];
+L687: /* CALLP */
+    return code + 687;
+L688: /* LINE */
+    f->line = code + 688;
+    f->lineno = 553;
+L694: /* GGET */
+    tp_aot_op(tp, f, code + 694);
+L698: /* MOVE */
+    regs[19] = regs[1];
+L699: /* CALLP */
+    return code + 699;
+L700: /* LINE */
+    f->line = code + 700;
+    f->lineno = 555;
+L709: /* GGET */
+    tp_aot_op(tp, f, code + 709);
+L713: /* GGET */
+    tp_aot_op(tp, f, code + 713);
+L717: /* MOVE */
+    regs[20] = regs[1];
+L718: /* MOVE */
+    regs[21] = regs[11];
+L719: /* MOVE */
+    regs[22] = regs[16];
+L720: /* CALLP */
+    return code + 720;
+L721: /* LINE */
+    f->line = code + 721;
+    f->lineno = 556;
+L728: /* GGET */
+    tp_aot_op(tp, f, code + 728);
+L733: /* MOVE */
+    regs[19] = regs[11];
+L734: /* CALLP */
+    return code + 734;
+L735: /* LINE */
+    f->line = code + 735;
+    f->lineno = 557;
+L746: /* GGET */
+    tp_aot_op(tp, f, code + 746);
+L751: /* MOVE */
+    regs[20] = regs[16];
+L752: /* MOVE */
+    regs[21] = regs[17];
+L753: /* LIST */
+    tp_aot_op(tp, f, code + 753);
+L754: /* CALLP */
+    return code + 754;
+L755: /* LINE */
+    f->line = code + 755;
+    f->lineno = 558;
+L760: /* RETURN */
+    return code + 760;
+L761: /* EOF */
+    return code + 761;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_12560(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 22: goto L22;
+        case 23: goto L23;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 35: goto L35;
+        case 38: goto L38;
+        case 40: goto L40;
+        case 43: goto L43;
+        case 47: goto L47;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 51: goto L51;
+        case 52: goto L52;
+        case 61: goto L61;
+        case 66: goto L66;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 79: goto L79;
+        case 82: goto L82;
+        case 84: goto L84;
+        case 87: goto L87;
+        case 92: goto L92;
+        case 94: goto L94;
+        case 95: goto L95;
+        case 96: goto L96;
+        case 97: goto L97;
+        case 107: goto L107;
+        case 110: goto L110;
+        case 115: goto L115;
+        case 117: goto L117;
+        case 121: goto L121;
+        case 123: goto L123;
+        case 126: goto L126;
+        case 128: goto L128;
+        case 129: goto L129;
+        case 141: goto L141;
+        case 146: goto L146;
+        case 151: goto L151;
+        case 153: goto L153;
+        case 154: goto L154;
+        case 157: goto L157;
+        case 159: goto L159;
+        case 160: goto L160;
+        case 161: goto L161;
+        case 162: goto L162;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 560;
+L9: /* VAR */
+L11: /* VAR */
+L13: /* STRING */
+    tp_aot_op(tp, f, code + 13);
+L22: /* FILE */
+    f->fname = regs[2];
+L23: /* STRING */
+    tp_aot_op(tp, f, code + 23);
+L27: /* NAME */
+    f->name = regs[2];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 561;
+L35: /* STRING */
+    tp_aot_op(tp, f, code + 35);
+L38: /* MGET */
+    tp_aot_op(tp, f, code + 38);
+L40: /* GGET */
+    tp_aot_op(tp, f, code + 40);
+L43: /* STRING */
+    tp_aot_op(tp, f, code + 43);
+L47: /* MGET */
+    tp_aot_op(tp, f, code + 47);
+L49: /* IN */
+    regs[2] = tp_has(tp, regs[3], regs[2]);
+L50: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L52;
+    }
+L51: /* JUMP */
+    goto L70;
+L52: /* LINE */
+    f->line = code + 52;
+    f->lineno = 562;
+L61: /* GGET */
+    tp_aot_op(tp, f, code + 61);
+L66: /* MOVE */
+    regs[4] = regs[0];
+L67: /* MOVE */
+    regs[5] = regs[1];
+L68: /* CALLP */
+    return code + 68;
+L69: /* RETURN */
+    return code + 69;
+L70: /* LINE */
+    f->line = code + 70;
+    f->lineno = 563;
+L79: /* STRING */
+    tp_aot_op(tp, f, code + 79);
+L82: /* MGET */
+    tp_aot_op(tp, f, code + 82);
+L84: /* GGET */
+    tp_aot_op(tp, f, code + 84);
+L87: /* STRING */
+    tp_aot_op(tp, f, code + 87);
+L92: /* MGET */
+    tp_aot_op(tp, f, code + 92);
+L94: /* NOTIN */
+    regs[2] = tp_bool(!tp_true(tp, tp_has(tp, regs[3], regs[2])));
+L95: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L97;
+    }
+L96: /* JUMP */
+    goto L129;
+L97: /* LINE */
+    f->line = code + 97;
+    f->lineno = 564;
+L107: /* GGET */
+    tp_aot_op(tp, f, code + 107);
+L110: /* STRING */
+    tp_aot_op(tp, f, code + 110);
+L115: /* MGET */
+    tp_aot_op(tp, f, code + 115);
+L117: /* STRING */
+    tp_aot_op(tp, f, code + 117);
+L121: /* METHOD */
+    tp_aot_op(tp, f, code + 121);
+L123: /* STRING */
+    tp_aot_op(tp, f, code + 123);
+L126: /* MGET */
+    tp_aot_op(tp, f, code + 126);
+L128: /* CALLM */
+    return code + 128;
+L129: /* LINE */
+    f->line = code + 129;
+    f->lineno = 565;
+L141: /* GGET */
+    tp_aot_op(tp, f, code + 141);
+L146: /* STRING */
+    tp_aot_op(tp, f, code + 146);
+L151: /* METHOD */
+    tp_aot_op(tp, f, code + 151);
+L153: /* CALLM */
+    return code + 153;
+L154: /* STRING */
+    tp_aot_op(tp, f, code + 154);
+L157: /* MGET */
+    tp_aot_op(tp, f, code + 157);
+L159: /* MOVE */
+    regs[5] = regs[1];
+L160: /* CALLP */
+    return code + 160;
+L161: /* RETURN */
+    return code + 161;
+L162: /* EOF */
+    return code + 162;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_12750(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 26: goto L26;
+        case 27: goto L27;
+        case 35: goto L35;
+        case 38: goto L38;
+        case 40: goto L40;
+        case 43: goto L43;
+        case 48: goto L48;
+        case 50: goto L50;
+        case 51: goto L51;
+        case 52: goto L52;
+        case 53: goto L53;
+        case 60: goto L60;
+        case 63: goto L63;
+        case 66: goto L66;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 87: goto L87;
+        case 92: goto L92;
+        case 96: goto L96;
+        case 98: goto L98;
+        case 105: goto L105;
+        case 108: goto L108;
+        case 112: goto L112;
+        case 114: goto L114;
+        case 117: goto L117;
+        case 119: goto L119;
+        case 120: goto L120;
+        case 128: goto L128;
+        case 131: goto L131;
+        case 133: goto L133;
+        case 136: goto L136;
+        case 140: goto L140;
+        case 142: goto L142;
+        case 143: goto L143;
+        case 144: goto L144;
+        case 145: goto L145;
+        case 154: goto L154;
+        case 157: goto L157;
+        case 161: goto L161;
+        case 163: goto L163;
+        case 167: goto L167;
+        case 169: goto L169;
+        case 172: goto L172;
+        case 174: goto L174;
+        case 175: goto L175;
+        case 183: goto L183;
+        case 187: goto L187;
+        case 190: goto L190;
+        case 192: goto L192;
+        case 193: goto L193;
+        case 194: goto L194;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 567;
+L9: /* VAR */
+L11: /* STRING */
+    tp_aot_op(tp, f, code + 11);
+L20: /* FILE */
+    f->fname = regs[1];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L26: /* NAME */
+    f->name = regs[1];
+L27: /* LINE */
+    f->line = code + 27;
+    f->lineno = 568;
+L35: /* STRING */
+    tp_aot_op(tp, f, code + 35);
+L38: /* MGET */
+    tp_aot_op(tp, f, code + 38);
+L40: /* GGET */
+    tp_aot_op(tp, f, code + 40);
+L43: /* STRING */
+    tp_aot_op(tp, f, code + 43);
+L48: /* MGET */
+    tp_aot_op(tp, f, code + 48);
+L50: /* IN */
+    regs[1] = tp_has(tp, regs[2], regs[1]);
+L51: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L53;
+    }
+L52: /* JUMP */
+    goto L120;
+L53: /* LINE */
+    f->line = code + 53;
+    f->lineno = 569;
+L60: /* GGET */
+    tp_aot_op(tp, f, code + 60);
+L63: /* NUMBER */
+    tp_aot_op(tp, f, code + 63);
+L66: /* STRING */
+    tp_aot_op(tp, f, code + 66);
+L70: /* SET */
+    tp_set(tp, regs[1], regs[3], regs[2]);
+L71: /* LINE */
+    f->line = code + 71;
+    f->lineno = 570;
+L87: /* GGET */
+    tp_aot_op(tp, f, code + 87);
+L92: /* STRING */
+    tp_aot_op(tp, f, code + 92);
+L96: /* METHOD */
+    tp_aot_op(tp, f, code + 96);
+L98: /* STRING */
+    tp_aot_op(tp, f, code + 98);
+L105: /* GGET */
+    tp_aot_op(tp, f, code + 105);
+L108: /* STRING */
+    tp_aot_op(tp, f, code + 108);
+L112: /* MGET */
+    tp_aot_op(tp, f, code + 112);
+L114: /* STRING */
+    tp_aot_op(tp, f, code + 114);
+L117: /* MGET */
+    tp_aot_op(tp, f, code + 117);
+L119: /* CALLM */
+    return code + 119;
+L120: /* LINE */
+    f->line = code + 120;
+    f->lineno = 571;
+L128: /* STRING */
+    tp_aot_op(tp, f, code + 128);
+L131: /* MGET */
+    tp_aot_op(tp, f, code + 131);
+L133: /* GGET */
+    tp_aot_op(tp, f, code + 133);
+L136: /* STRING */
+    tp_aot_op(tp, f, code + 136);
+L140: /* MGET */
+    tp_aot_op(tp, f, code + 140);
+L142: /* NOTIN */
+    regs[1] = tp_bool(!tp_true(tp, tp_has(tp, regs[2], regs[1])));
+L143: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L145;
+    }
+L144: /* JUMP */
+    goto L175;
+L145: /* LINE */
+    f->line = code + 145;
+    f->lineno = 572;
+L154: /* GGET */
+    tp_aot_op(tp, f, code + 154);
+L157: /* STRING */
+    tp_aot_op(tp, f, code + 157);
+L161: /* MGET */
+    tp_aot_op(tp, f, code + 161);
+L163: /* STRING */
+    tp_aot_op(tp, f, code + 163);
+L167: /* METHOD */
+    tp_aot_op(tp, f, code + 167);
+L169: /* STRING */
+    tp_aot_op(tp, f, code + 169);
+L172: /* MGET */
+    tp_aot_op(tp, f, code + 172);
+L174: /* CALLM */
+    return code + 174;
+L175: /* LINE */
+    f->line = code + 175;
+    f->lineno = 573;
+L183: /* GGET */
+    tp_aot_op(tp, f, code + 183);
+L187: /* STRING */
+    tp_aot_op(tp, f, code + 187);
+L190: /* MGET */
+    tp_aot_op(tp, f, code + 190);
+L192: /* CALLP */
+    return code + 192;
+L193: /* RETURN */
+    return code + 193;
+L194: /* EOF */
+    return code + 194;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_12968(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 24: goto L24;
+        case 25: goto L25;
+        case 32: goto L32;
+        case 35: goto L35;
+        case 39: goto L39;
+        case 41: goto L41;
+        case 54: goto L54;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 67: goto L67;
+        case 69: goto L69;
+        case 72: goto L72;
+        case 73: goto L73;
+        case 75: goto L75;
+        case 77: goto L77;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 83: goto L83;
+        case 86: goto L86;
+        case 87: goto L87;
+        case 92: goto L92;
+        case 95: goto L95;
+        case 99: goto L99;
+        case 101: goto L101;
+        case 102: goto L102;
+        case 108: goto L108;
+        case 112: goto L112;
+        case 115: goto L115;
+        case 117: goto L117;
+        case 118: goto L118;
+        case 129: goto L129;
+        case 134: goto L134;
+        case 137: goto L137;
+        case 138: goto L138;
+        case 142: goto L142;
+        case 144: goto L144;
+        case 145: goto L145;
+        case 148: goto L148;
+        case 150: goto L150;
+        case 153: goto L153;
+        case 154: goto L154;
+        case 156: goto L156;
+        case 159: goto L159;
+        case 160: goto L160;
+        case 162: goto L162;
+        case 165: goto L165;
+        case 166: goto L166;
+        case 168: goto L168;
+        case 171: goto L171;
+        case 172: goto L172;
+        case 177: goto L177;
+        case 180: goto L180;
+        case 181: goto L181;
+        case 182: goto L182;
+        case 184: goto L184;
+        case 185: goto L185;
+        case 191: goto L191;
+        case 196: goto L196;
+        case 197: goto L197;
+        case 198: goto L198;
+        case 199: goto L199;
+        case 204: goto L204;
+        case 207: goto L207;
+        case 208: goto L208;
+        case 209: goto L209;
+        case 210: goto L210;
+        case 219: goto L219;
+        case 224: goto L224;
+        case 228: goto L228;
+        case 230: goto L230;
+        case 233: goto L233;
+        case 234: goto L234;
+        case 235: goto L235;
+        case 236: goto L236;
+        case 242: goto L242;
+        case 243: goto L243;
+        case 244: goto L244;
+        case 245: goto L245;
+        case 246: goto L246;
+        case 255: goto L255;
+        case 260: goto L260;
+        case 264: goto L264;
+        case 266: goto L266;
+        case 269: goto L269;
+        case 270: goto L270;
+        case 271: goto L271;
+        case 272: goto L272;
+        case 287: goto L287;
+        case 292: goto L292;
+        case 296: goto L296;
+        case 299: goto L299;
+        case 301: goto L301;
+        case 305: goto L305;
+        case 310: goto L310;
+        case 311: goto L311;
+        case 312: goto L312;
+        case 318: goto L318;
+        case 319: goto L319;
+        case 320: goto L320;
+        case 321: goto L321;
+        case 322: goto L322;
+        case 331: goto L331;
+        case 336: goto L336;
+        case 340: goto L340;
+        case 342: goto L342;
+        case 345: goto L345;
+        case 346: goto L346;
+        case 347: goto L347;
+        case 348: goto L348;
+        case 363: goto L363;
+        case 368: goto L368;
+        case 372: goto L372;
+        case 375: goto L375;
+        case 377: goto L377;
+        case 381: goto L381;
+        case 386: goto L386;
+        case 387: goto L387;
+        case 388: goto L388;
+        case 396: goto L396;
+        case 399: goto L399;
+        case 402: goto L402;
+        case 405: goto L405;
+        case 409: goto L409;
+        case 411: goto L411;
+        case 412: goto L412;
+        case 420: goto L420;
+        case 424: goto L424;
+        case 427: goto L427;
+        case 428: goto L428;
+        case 431: goto L431;
+        case 433: goto L433;
+        case 434: goto L434;
+        case 443: goto L443;
+        case 448: goto L448;
+        case 451: goto L451;
+        case 454: goto L454;
+        case 455: goto L455;
+        case 456: goto L456;
+        case 457: goto L457;
+        case 463: goto L463;
+        case 466: goto L466;
+        case 469: goto L469;
+        case 473: goto L473;
+        case 475: goto L475;
+        case 479: goto L479;
+        case 482: goto L482;
+        case 485: goto L485;
+        case 487: goto L487;
+        case 488: goto L488;
+        case 496: goto L496;
+        case 500: goto L500;
+        case 502: goto L502;
+        case 503: goto L503;
+        case 504: goto L504;
+        case 510: goto L510;
+        case 513: goto L513;
+        case 514: goto L514;
+        case 517: goto L517;
+        case 518: goto L518;
+        case 524: goto L524;
+        case 527: goto L527;
+        case 532: goto L532;
+        case 534: goto L534;
+        case 535: goto L535;
+        case 536: goto L536;
+        case 550: goto L550;
+        case 555: goto L555;
+        case 559: goto L559;
+        case 562: goto L562;
+        case 564: goto L564;
+        case 567: goto L567;
+        case 570: goto L570;
+        case 573: goto L573;
+        case 574: goto L574;
+        case 575: goto L575;
+        case 576: goto L576;
+        case 577: goto L577;
+        case 593: goto L593;
+        case 598: goto L598;
+        case 603: goto L603;
+        case 606: goto L606;
+        case 607: goto L607;
+        case 611: goto L611;
+        case 614: goto L614;
+        case 616: goto L616;
+        case 619: goto L619;
+        case 620: goto L620;
+        case 621: goto L621;
+        case 622: goto L622;
+        case 623: goto L623;
+        case 629: goto L629;
+        case 634: goto L634;
+        case 635: goto L635;
+        case 636: goto L636;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 575;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L24: /* NAME */
+    f->name = regs[1];
+L25: /* LINE */
+    f->line = code + 25;
+    f->lineno = 576;
+L32: /* VAR */
+L35: /* STRING */
+    tp_aot_op(tp, f, code + 35);
+L39: /* MGET */
+    tp_aot_op(tp, f, code + 39);
+L41: /* LINE */
+    f->line = code + 41;
+    f->lineno = 578;
+L54: /* GGET */
+    tp_aot_op(tp, f, code + 54);
+L58: /* MOVE */
+    regs[3] = regs[0];
+L59: /* NUMBER */
+    tp_aot_op(tp, f, code + 59);
+L62: /* GET */
+    regs[4] = tp_get(tp, regs[1], regs[6]);
+    tp_grey(tp, regs[4]);
+L63: /* STRING */
+    tp_aot_op(tp, f, code + 63);
+L67: /* MGET */
+    tp_aot_op(tp, f, code + 67);
+L69: /* STRING */
+    tp_aot_op(tp, f, code + 69);
+L72: /* CALLP */
+    return code + 72;
+L73: /* VAR */
+L75: /* VAR */
+L77: /* NUMBER */
+    tp_aot_op(tp, f, code + 77);
+L80: /* GET */
+    regs[2] = tp_get(tp, regs[7], regs[4]);
+    tp_grey(tp, regs[2]);
+L81: /* VAR */
+L83: /* NUMBER */
+    tp_aot_op(tp, f, code + 83);
+L86: /* GET */
+    regs[3] = tp_get(tp, regs[7], regs[5]);
+    tp_grey(tp, regs[3]);
+L87: /* LINE */
+    f->line = code + 87;
+    f->lineno = 580;
+L92: /* GGET */
+    tp_aot_op(tp, f, code + 92);
+L95: /* STRING */
+    tp_aot_op(tp, f, code + 95);
+L99: /* METHOD */
+    tp_aot_op(tp, f, code + 99);
+L101: /* CALLM */
+    return code + 101;
+L102: /* LINE */
+    f->line = code + 102;
+    f->lineno = 581;
+L108: /* GGET */
+    tp_aot_op(tp, f, code + 108);
+L112: /* STRING */
+    tp_aot_op(tp, f, code + 112);
+L115: /* MGET */
+    tp_aot_op(tp, f, code + 115);
+L117: /* CALLP */
+    return code + 117;
+L118: /* LINE */
+    f->line = code + 118;
+    f->lineno = 582;
+L129: /* GGET */
+    tp_aot_op(tp, f, code + 129);
+L134: /* NUMBER */
+    tp_aot_op(tp, f, code + 134);
+L137: /* GET */
+    regs[5] = tp_get(tp, regs[1], regs[6]);
+    tp_grey(tp, regs[5]);
+L138: /* STRING */
+    tp_aot_op(tp, f, code + 138);
+L142: /* MGET */
+    tp_aot_op(tp, f, code + 142);
+L144: /* CALLP */
+    return code + 144;
+L145: /* VAR */
+L148: /* VAR */
+L150: /* NUMBER */
+    tp_aot_op(tp, f, code + 150);
+L153: /* GET */
+    regs[4] = tp_get(tp, regs[7], regs[6]);
+    tp_grey(tp, regs[4]);
+L154: /* VAR */
+L156: /* NUMBER */
+    tp_aot_op(tp, f, code + 156);
+L159: /* GET */
+    regs[5] = tp_get(tp, regs[7], regs[8]);
+    tp_grey(tp, regs[5]);
+L160: /* VAR */
+L162: /* NUMBER */
+    tp_aot_op(tp, f, code + 162);
+L165: /* GET */
+    regs[6] = tp_get(tp, regs[7], regs[9]);
+    tp_grey(tp, regs[6]);
+L166: /* VAR */
+L168: /* NUMBER */
+    tp_aot_op(tp, f, code + 168);
+L171: /* GET */
+    regs[8] = tp_get(tp, regs[7], regs[10]);
+    tp_grey(tp, regs[8]);
+L172: /* LINE */
+    f->line = code + 172;
+    f->lineno = 584;
+L177: /* NUMBER */
+    tp_aot_op(tp, f, code + 177);
+L180: /* ITER */
+    if (tp_iter_next(tp, &regs[7], regs[4], &regs[9])) {
+        goto L182;
+    }
+L181: /* JUMP */
+    goto L199;
+L182: /* VAR */
+L184: /* MOVE */
+    regs[10] = regs[7];
+L185: /* LINE */
+    f->line = code + 185;
+    f->lineno = 586;
+L191: /* GGET */
+    tp_aot_op(tp, f, code + 191);
+L196: /* MOVE */
+    regs[12] = regs[10];
+L197: /* CALLP */
+    return code + 197;
+L198: /* JUMP */
+    tp_aot_safepoint(tp, 18);
+    goto L180;
+L199: /* LINE */
+    f->line = code + 199;
+    f->lineno = 587;
+L204: /* NUMBER */
+    tp_aot_op(tp, f, code + 204);
+L207: /* ITER */
+    if (tp_iter_next(tp, &regs[7], regs[5], &regs[9])) {
+        goto L209;
+    }
+L208: /* JUMP */
+    goto L236;
+L209: /* MOVE */
+    regs[10] = regs[7];
+L210: /* LINE */
+    f->line = code + 210;
+    f->lineno = 589;
+L219: /* GGET */
+    tp_aot_op(tp, f, code + 219);
+L224: /* STRING */
+    tp_aot_op(tp, f, code + 224);
+L228: /* MGET */
+    tp_aot_op(tp, f, code + 228);
+L230: /* NUMBER */
+    tp_aot_op(tp, f, code + 230);
+L233: /* GET */
+    regs[12] = tp_get(tp, regs[12], regs[13]);
+    tp_grey(tp, regs[12]);
+L234: /* CALLP */
+    return code + 234;
+L235: /* JUMP */
+    tp_aot_safepoint(tp, 28);
+    goto L207;
+L236: /* LINE */
+    f->line = code + 236;
+    f->lineno = 590;
+L242: /* NONE */
+    regs[9] = tp_None;
+L243: /* NE */
+    if (TP_BOTH(regs[6], regs[9], TP_NUMBER_INT)) {
+        regs[7] = tp_bool(regs[6].nint != regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 243);
+    }
+L244: /* IF */
+    if (TP_IS_INT(regs[7]) ? regs[7].nint != 0 : tp_true(tp, regs[7])) {
+        goto L246;
+    }
+L245: /* JUMP */
+    goto L272;
+L246: /* LINE */
+    f->line = code + 246;
+    f->lineno = 592;
+L255: /* GGET */
+    tp_aot_op(tp, f, code + 255);
+L260: /* STRING */
+    tp_aot_op(tp, f, code + 260);
+L264: /* MGET */
+    tp_aot_op(tp, f, code + 264);
+L266: /* NUMBER */
+    tp_aot_op(tp, f, code + 266);
+L269: /* GET */
+    regs[12] = tp_get(tp, regs[12], regs[9]);
+    tp_grey(tp, regs[12]);
+L270: /* CALLP */
+    return code + 270;
+L271: /* JUMP */
+    goto L312;
+L272: /* LINE */
+    f->line = code + 272;
+    f->lineno = 594;
+L287: /* GGET */
+    tp_aot_op(tp, f, code + 287);
+L292: /* GGET */
+    tp_aot_op(tp, f, code + 292);
+L296: /* STRING */
+    tp_aot_op(tp, f, code + 296);
+L299: /* MGET */
+    tp_aot_op(tp, f, code + 299);
+L301: /* STRING */
+    tp_aot_op(tp, f, code + 301);
+L305: /* STRING */
+    tp_aot_op(tp, f, code + 305);
+L310: /* CALLP */
+    return code + 310;
+L311: /* CALLP */
+    return code + 311;
+L312: /* LINE */
+    f->line = code + 312;
+    f->lineno = 595;
+L318: /* NONE */
+    regs[9] = tp_None;
+L319: /* NE */
+    if (TP_BOTH(regs[8], regs[9], TP_NUMBER_INT)) {
+        regs[7] = tp_bool(regs[8].nint != regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 319);
+    }
+L320: /* IF */
+    if (TP_IS_INT(regs[7]) ? regs[7].nint != 0 : tp_true(tp, regs[7])) {
+        goto L322;
+    }
+L321: /* JUMP */
+    goto L348;
+L322: /* LINE */
+    f->line = code + 322;
+    f->lineno = 597;
+L331: /* GGET */
+    tp_aot_op(tp, f, code + 331);
+L336: /* STRING */
+    tp_aot_op(tp, f, code + 336);
+L340: /* MGET */
+    tp_aot_op(tp, f, code + 340);
+L342: /* NUMBER */
+    tp_aot_op(tp, f, code + 342);
+L345: /* GET */
+    regs[12] = tp_get(tp, regs[12], regs[9]);
+    tp_grey(tp, regs[12]);
+L346: /* CALLP */
+    return code + 346;
+L347: /* JUMP */
+    goto L388;
+L348: /* LINE */
+    f->line = code + 348;
+    f->lineno = 599;
+L363: /* GGET */
+    tp_aot_op(tp, f, code + 363);
+L368: /* GGET */
+    tp_aot_op(tp, f, code + 368);
+L372: /* STRING */
+    tp_aot_op(tp, f, code + 372);
+L375: /* MGET */
+    tp_aot_op(tp, f, code + 375);
+L377: /* STRING */
+    tp_aot_op(tp, f, code + 377);
+L381: /* STRING */
+    tp_aot_op(tp, f, code + 381);
+L386: /* CALLP */
+    return code + 386;
+L387: /* CALLP */
+    return code + 387;
+L388: /* LINE */
+    f->line = code + 388;
+    f->lineno = 600;
+L396: /* VAR */
+L399: /* GGET */
+    tp_aot_op(tp, f, code + 399);
+L402: /* GGET */
+    tp_aot_op(tp, f, code + 402);
+L405: /* STRING */
+    tp_aot_op(tp, f, code + 405);
+L409: /* MGET */
+    tp_aot_op(tp, f, code + 409);
+L411: /* CALLP */
+    return code + 411;
+L412: /* LINE */
+    f->line = code + 412;
+    f->lineno = 602;
+L420: /* GGET */
+    tp_aot_op(tp, f, code + 420);
+L424: /* NUMBER */
+    tp_aot_op(tp, f, code + 424);
+L427: /* GET */
+    regs[12] = tp_get(tp, regs[1], regs[13]);
+    tp_grey(tp, regs[12]);
+L428: /* STRING */
+    tp_aot_op(tp, f, code + 428);
+L431: /* MGET */
+    tp_aot_op(tp, f, code + 431);
+L433: /* CALLP */
+    return code + 433;
+L434: /* LINE */
+    f->line = code + 434;
+    f->lineno = 604;
+L443: /* GGET */
+    tp_aot_op(tp, f, code + 443);
+L448: /* GGET */
+    tp_aot_op(tp, f, code + 448);
+L451: /* NUMBER */
+    tp_aot_op(tp, f, code + 451);
+L454: /* GET */
+    regs[14] = tp_get(tp, regs[1], regs[15]);
+    tp_grey(tp, regs[14]);
+L455: /* CALLP */
+    return code + 455;
+L456: /* CALLP */
+    return code + 456;
+L457: /* LINE */
+    f->line = code + 457;
+    f->lineno = 605;
+L463: /* VAR */
+L466: /* GGET */
+    tp_aot_op(tp, f, code + 466);
+L469: /* STRING */
+    tp_aot_op(tp, f, code + 469);
+L473: /* MGET */
+    tp_aot_op(tp, f, code + 473);
+L475: /* LINE */
+    f->line = code + 475;
+    f->lineno = 606;
+L479: /* GGET */
+    tp_aot_op(tp, f, code + 479);
+L482: /* STRING */
+    tp_aot_op(tp, f, code + 482);
+L485: /* METHOD */
+    tp_aot_op(tp, f, code + 485);
+L487: /* CALLM */
+    return code + 487;
+L488: /* LINE */
+    f->line = code + 488;
+    f->lineno = 608;
+L496: /* STRING */
+    tp_aot_op(tp, f, code + 496);
+L500: /* METHOD */
+    tp_aot_op(tp, f, code + 500);
+L502: /* MOVE */
+    regs[14] = regs[7];
+L503: /* CALLM */
+    return code + 503;
+L504: /* LINE */
+    f->line = code + 504;
+    f->lineno = 609;
+L510: /* GGET */
+    tp_aot_op(tp, f, code + 510);
+L513: /* MOVE */
+    regs[13] = regs[3];
+L514: /* STRING */
+    tp_aot_op(tp, f, code + 514);
+L517: /* CALLP */
+    return code + 517;
+L518: /* LINE */
+    f->line = code + 518;
+    f->lineno = 611;
+L524: /* GGET */
+    tp_aot_op(tp, f, code + 524);
+L527: /* STRING */
+    tp_aot_op(tp, f, code + 527);
+L532: /* MGET */
+    tp_aot_op(tp, f, code + 532);
+L534: /* IF */
+    if (TP_IS_INT(regs[11]) ? regs[11].nint != 0 : tp_true(tp, regs[11])) {
+        goto L536;
+    }
+L535: /* JUMP */
+    goto L577;
+L536: /* LINE */
+    f->line = code + 536;
+    f->lineno = 612;
+L550: /* GGET */
+    tp_aot_op(tp, f, code + 550);
+L555: /* GGET */
+    tp_aot_op(tp, f, code + 555);
+L559: /* STRING */
+    tp_aot_op(tp, f, code + 559);
+L562: /* MGET */
+    tp_aot_op(tp, f, code + 562);
+L564: /* NUMBER */
+    tp_aot_op(tp, f, code + 564);
+L567: /* NUMBER */
+    tp_aot_op(tp, f, code + 567);
+L570: /* NUMBER */
+    tp_aot_op(tp, f, code + 570);
+L573: /* GET */
+    regs[19] = tp_get(tp, regs[1], regs[20]);
+    tp_grey(tp, regs[19]);
+L574: /* LIST */
+    tp_aot_op(tp, f, code + 574);
+L575: /* CALLP */
+    return code + 575;
+L576: /* CALLP */
+    return code + 576;
+L577: /* LINE */
+    f->line = code + 577;
+    f->lineno = 613;
+L593: /* GGET */
+    tp_aot_op(tp, f, code + 593);
+L598: /* GGET */
+    tp_aot_op(tp, f, code + 598);
+L603: /* NUMBER */
+    tp_aot_op(tp, f, code + 603);
+L606: /* GET */
+    regs[15] = tp_get(tp, regs[1], regs[17]);
+    tp_grey(tp, regs[15]);
+L607: /* GGET */
+    tp_aot_op(tp, f, code + 607);
+L611: /* STRING */
+    tp_aot_op(tp, f, code + 611);
+L614: /* MGET */
+    tp_aot_op(tp, f, code + 614);
+L616: /* STRING */
+    tp_aot_op(tp, f, code + 616);
+L619: /* MOVE */
+    regs[20] = regs[2];
+L620: /* CALLP */
+    return code + 620;
+L621: /* CALLP */
+    return code + 621;
+L622: /* CALLP */
+    return code + 622;
+L623: /* LINE */
+    f->line = code + 623;
+    f->lineno = 615;
+L629: /* GGET */
+    tp_aot_op(tp, f, code + 629);
+L634: /* MOVE */
+    regs[13] = regs[2];
+L635: /* CALLP */
+    return code + 635;
+L636: /* EOF */
+    return code + 636;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_13627(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 33: goto L33;
+        case 36: goto L36;
+        case 40: goto L40;
+        case 42: goto L42;
+        case 48: goto L48;
+        case 51: goto L51;
+        case 52: goto L52;
+        case 61: goto L61;
+        case 64: goto L64;
+        case 65: goto L65;
+        case 69: goto L69;
+        case 71: goto L71;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 78: goto L78;
+        case 85: goto L85;
+        case 88: goto L88;
+        case 91: goto L91;
+        case 92: goto L92;
+        case 105: goto L105;
+        case 109: goto L109;
+        case 112: goto L112;
+        case 114: goto L114;
+        case 118: goto L118;
+        case 122: goto L122;
+        case 123: goto L123;
+        case 124: goto L124;
+        case 128: goto L128;
+        case 138: goto L138;
+        case 141: goto L141;
+        case 142: goto L142;
+        case 146: goto L146;
+        case 148: goto L148;
+        case 151: goto L151;
+        case 152: goto L152;
+        case 162: goto L162;
+        case 165: goto L165;
+        case 166: goto L166;
+        case 170: goto L170;
+        case 172: goto L172;
+        case 175: goto L175;
+        case 176: goto L176;
+        case 182: goto L182;
+        case 184: goto L184;
+        case 188: goto L188;
+        case 189: goto L189;
+        case 196: goto L196;
+        case 200: goto L200;
+        case 204: goto L204;
+        case 205: goto L205;
+        case 206: goto L206;
+        case 211: goto L211;
+        case 215: goto L215;
+        case 216: goto L216;
+        case 217: goto L217;
+        case 228: goto L228;
+        case 230: goto L230;
+        case 235: goto L235;
+        case 240: goto L240;
+        case 242: goto L242;
+        case 243: goto L243;
+        case 244: goto L244;
+        case 251: goto L251;
+        case 255: goto L255;
+        case 259: goto L259;
+        case 260: goto L260;
+        case 261: goto L261;
+        case 262: goto L262;
+        case 269: goto L269;
+        case 274: goto L274;
+        case 275: goto L275;
+        case 276: goto L276;
+        case 288: goto L288;
+        case 293: goto L293;
+        case 296: goto L296;
+        case 300: goto L300;
+        case 303: goto L303;
+        case 305: goto L305;
+        case 309: goto L309;
+        case 310: goto L310;
+        case 322: goto L322;
+        case 326: goto L326;
+        case 329: goto L329;
+        case 331: goto L331;
+        case 335: goto L335;
+        case 339: goto L339;
+        case 340: goto L340;
+        case 350: goto L350;
+        case 354: goto L354;
+        case 357: goto L357;
+        case 359: goto L359;
+        case 362: goto L362;
+        case 363: goto L363;
+        case 364: goto L364;
+        case 370: goto L370;
+        case 371: goto L371;
+        case 372: goto L372;
+        case 373: goto L373;
+        case 374: goto L374;
+        case 375: goto L375;
+        case 382: goto L382;
+        case 387: goto L387;
+        case 388: goto L388;
+        case 389: goto L389;
+        case 399: goto L399;
+        case 403: goto L403;
+        case 404: goto L404;
+        case 405: goto L405;
+        case 408: goto L408;
+        case 409: goto L409;
+        case 412: goto L412;
+        case 414: goto L414;
+        case 417: goto L417;
+        case 418: goto L418;
+        case 420: goto L420;
+        case 423: goto L423;
+        case 424: goto L424;
+        case 429: goto L429;
+        case 432: goto L432;
+        case 436: goto L436;
+        case 438: goto L438;
+        case 439: goto L439;
+        case 445: goto L445;
+        case 449: goto L449;
+        case 452: goto L452;
+        case 454: goto L454;
+        case 455: goto L455;
+        case 464: goto L464;
+        case 469: goto L469;
+        case 472: goto L472;
+        case 475: goto L475;
+        case 476: goto L476;
+        case 477: goto L477;
+        case 478: goto L478;
+        case 490: goto L490;
+        case 495: goto L495;
+        case 500: goto L500;
+        case 502: goto L502;
+        case 503: goto L503;
+        case 506: goto L506;
+        case 508: goto L508;
+        case 509: goto L509;
+        case 514: goto L514;
+        case 518: goto L518;
+        case 519: goto L519;
+        case 520: goto L520;
+        case 527: goto L527;
+        case 530: goto L530;
+        case 534: goto L534;
+        case 536: goto L536;
+        case 539: goto L539;
+        case 540: goto L540;
+        case 541: goto L541;
+        case 543: goto L543;
+        case 544: goto L544;
+        case 557: goto L557;
+        case 561: goto L561;
+        case 565: goto L565;
+        case 568: goto L568;
+        case 570: goto L570;
+        case 574: goto L574;
+        case 575: goto L575;
+        case 576: goto L576;
+        case 589: goto L589;
+        case 594: goto L594;
+        case 599: goto L599;
+        case 601: goto L601;
+        case 602: goto L602;
+        case 603: goto L603;
+        case 614: goto L614;
+        case 618: goto L618;
+        case 621: goto L621;
+        case 622: goto L622;
+        case 623: goto L623;
+        case 627: goto L627;
+        case 628: goto L628;
+        case 629: goto L629;
+        case 630: goto L630;
+        case 638: goto L638;
+        case 643: goto L643;
+        case 644: goto L644;
+        case 645: goto L645;
+        case 646: goto L646;
+        case 652: goto L652;
+        case 657: goto L657;
+        case 658: goto L658;
+        case 659: goto L659;
+        case 663: goto L663;
+        case 666: goto L666;
+        case 669: goto L669;
+        case 671: goto L671;
+        case 672: goto L672;
+        case 678: goto L678;
+        case 681: goto L681;
+        case 682: goto L682;
+        case 685: goto L685;
+        case 686: goto L686;
+        case 697: goto L697;
+        case 702: goto L702;
+        case 705: goto L705;
+        case 706: goto L706;
+        case 709: goto L709;
+        case 711: goto L711;
+        case 714: goto L714;
+        case 715: goto L715;
+        case 718: goto L718;
+        case 721: goto L721;
+        case 722: goto L722;
+        case 725: goto L725;
+        case 728: goto L728;
+        case 729: goto L729;
+        case 736: goto L736;
+        case 741: goto L741;
+        case 742: goto L742;
+        case 743: goto L743;
+        case 750: goto L750;
+        case 755: goto L755;
+        case 756: goto L756;
+        case 757: goto L757;
+        case 767: goto L767;
+        case 771: goto L771;
+        case 775: goto L775;
+        case 776: goto L776;
+        case 777: goto L777;
+        case 778: goto L778;
+        case 779: goto L779;
+        case 785: goto L785;
+        case 790: goto L790;
+        case 791: goto L791;
+        case 792: goto L792;
+        case 798: goto L798;
+        case 803: goto L803;
+        case 804: goto L804;
+        case 805: goto L805;
+        case 812: goto L812;
+        case 817: goto L817;
+        case 818: goto L818;
+        case 819: goto L819;
+        case 826: goto L826;
+        case 831: goto L831;
+        case 832: goto L832;
+        case 833: goto L833;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 617;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 618;
+L33: /* VAR */
+L36: /* STRING */
+    tp_aot_op(tp, f, code + 36);
+L40: /* MGET */
+    tp_aot_op(tp, f, code + 40);
+L42: /* LINE */
+    f->line = code + 42;
+    f->lineno = 619;
+L48: /* VAR */
+L51: /* NONE */
+    regs[3] = tp_None;
+L52: /* LINE */
+    f->line = code + 52;
+    f->lineno = 620;
+L61: /* NUMBER */
+    tp_aot_op(tp, f, code + 61);
+L64: /* GET */
+    regs[2] = tp_get(tp, regs[1], regs[4]);
+    tp_grey(tp, regs[2]);
+L65: /* STRING */
+    tp_aot_op(tp, f, code + 65);
+L69: /* MGET */
+    tp_aot_op(tp, f, code + 69);
+L71: /* STRING */
+    tp_aot_op(tp, f, code + 71);
+L75: /* EQ */
+    if (TP_BOTH(regs[2], regs[4], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint == regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 75);
+    }
+L76: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L78;
+    }
+L77: /* JUMP */
+    goto L124;
+L78: /* LINE */
+    f->line = code + 78;
+    f->lineno = 621;
+L85: /* VAR */
+L88: /* NUMBER */
+    tp_aot_op(tp, f, code + 88);
+L91: /* GET */
+    regs[2] = tp_get(tp, regs[1], regs[5]);
+    tp_grey(tp, regs[2]);
+L92: /* LINE */
+    f->line = code + 92;
+    f->lineno = 622;
+L105: /* GGET */
+    tp_aot_op(tp, f, code + 105);
+L109: /* STRING */
+    tp_aot_op(tp, f, code + 109);
+L112: /* MGET */
+    tp_aot_op(tp, f, code + 112);
+L114: /* STRING */
+    tp_aot_op(tp, f, code + 114);
+L118: /* STRING */
+    tp_aot_op(tp, f, code + 118);
+L122: /* CALLP */
+    return code + 122;
+L123: /* JUMP */
+    goto L176;
+L124: /* LINE */
+    f->line = code + 124;
+    f->lineno = 623;
+L128: /* LINE */
+    f->line = code + 128;
+    f->lineno = 624;
+L138: /* NUMBER */
+    tp_aot_op(tp, f, code + 138);
+L141: /* GET */
+    regs[4] = tp_get(tp, regs[1], regs[5]);
+    tp_grey(tp, regs[4]);
+L142: /* STRING */
+    tp_aot_op(tp, f, code + 142);
+L146: /* MGET */
+    tp_aot_op(tp, f, code + 146);
+L148: /* NUMBER */
+    tp_aot_op(tp, f, code + 148);
+L151: /* GET */
+    regs[2] = tp_get(tp, regs[4], regs[5]);
+    tp_grey(tp, regs[2]);
+L152: /* LINE */
+    f->line = code + 152;
+    f->lineno = 625;
+L162: /* NUMBER */
+    tp_aot_op(tp, f, code + 162);
+L165: /* GET */
+    regs[4] = tp_get(tp, regs[1], regs[5]);
+    tp_grey(tp, regs[4]);
+L166: /* STRING */
+    tp_aot_op(tp, f, code + 166);
+L170: /* MGET */
+    tp_aot_op(tp, f, code + 170);
+L172: /* NUMBER */
+    tp_aot_op(tp, f, code + 172);
+L175: /* GET */
+    regs[3] = tp_get(tp, regs[4], regs[5]);
+    tp_grey(tp, regs[3]);
+L176: /* LINE */
+    f->line = code + 176;
+    f->lineno = 627;
+L182: /* VAR */
+L184: /* GGET */
+    tp_aot_op(tp, f, code + 184);
+L188: /* CALLP */
+    return code + 188;
+L189: /* LINE */
+    f->line = code + 189;
+    f->lineno = 628;
+L196: /* GGET */
+    tp_aot_op(tp, f, code + 196);
+L200: /* GGET */
+    tp_aot_op(tp, f, code + 200);
+L204: /* MOVE */
+    regs[8] = regs[4];
+L205: /* CALLP */
+    return code + 205;
+L206: /* LINE */
+    f->line = code + 206;
+    f->lineno = 629;
+L211: /* GGET */
+    tp_aot_op(tp, f, code + 211);
+L215: /* MOVE */
+    regs[7] = regs[4];
+L216: /* CALLP */
+    return code + 216;
+L217: /* LINE */
+    f->line = code + 217;
+    f->lineno = 630;
+L228: /* VAR */
+L230: /* GGET */
+    tp_aot_op(tp, f, code + 230);
+L235: /* STRING */
+    tp_aot_op(tp, f, code + 235);
+L240: /* METHOD */
+    tp_aot_op(tp, f, code + 240);
+L242: /* CALLM */
+    return code + 242;
+L243: /* CALLP */
+    return code + 243;
+L244: /* LINE */
+    f->line = code + 244;
+    f->lineno = 631;
+L251: /* GGET */
+    tp_aot_op(tp, f, code + 251);
+L255: /* GGET */
+    tp_aot_op(tp, f, code + 255);
+L259: /* MOVE */
+    regs[9] = regs[5];
+L260: /* MOVE */
+    regs[10] = regs[4];
+L261: /* CALLP */
+    return code + 261;
+L262: /* LINE */
+    f->line = code + 262;
+    f->lineno = 632;
+L269: /* GGET */
+    tp_aot_op(tp, f, code + 269);
+L274: /* MOVE */
+    regs[8] = regs[5];
+L275: /* CALLP */
+    return code + 275;
+L276: /* LINE */
+    f->line = code + 276;
+    f->lineno = 634;
+L288: /* GGET */
+    tp_aot_op(tp, f, code + 288);
+L293: /* GGET */
+    tp_aot_op(tp, f, code + 293);
+L296: /* GGET */
+    tp_aot_op(tp, f, code + 296);
+L300: /* STRING */
+    tp_aot_op(tp, f, code + 300);
+L303: /* MGET */
+    tp_aot_op(tp, f, code + 303);
+L305: /* STRING */
+    tp_aot_op(tp, f, code + 305);
+L309: /* NONE */
+    regs[14] = tp_None;
+L310: /* LINE */
+    f->line = code + 310;
+    f->lineno = 635;
+L322: /* GGET */
+    tp_aot_op(tp, f, code + 322);
+L326: /* STRING */
+    tp_aot_op(tp, f, code + 326);
+L329: /* MGET */
+    tp_aot_op(tp, f, code + 329);
+L331: /* STRING */
+    tp_aot_op(tp, f, code + 331);
+L335: /* STRING */
+    tp_aot_op(tp, f, code + 335);
+L339: /* CALLP */
+    return code + 339;
+L340: /* LINE */
+    f->line = code + 340;
+    f->lineno = 636;
+L350: /* GGET */
+    tp_aot_op(tp, f, code + 350);
+L354: /* STRING */
+    tp_aot_op(tp, f, code + 354);
+L357: /* MGET */
+    tp_aot_op(tp, f, code + 357);
+L359: /* STRING */
+    tp_aot_op(tp, f, code + 359);
+L362: /* MOVE */
+    regs[22] = regs[4];
+L363: /* CALLP */
+    return code + 363;
+L364: /* LINE */
+    f->line = code + 364;
+    f->lineno = 637;
+L370: /* MOVE */
+    regs[18] = regs[3];
+L371: /* LIST */
+    tp_aot_op(tp, f, code + 371);
+L372: /* CALLP */
+    return code + 372;
+L373: /* CALLP */
+    return code + 373;
+L374: /* CALLP */
+    return code + 374;
+L375: /* LINE */
+    f->line = code + 375;
+    f->lineno = 638;
+L382: /* GGET */
+    tp_aot_op(tp, f, code + 382);
+L387: /* MOVE */
+    regs[8] = regs[4];
+L388: /* CALLP */
+    return code + 388;
+L389: /* LINE */
+    f->line = code + 389;
+    f->lineno = 641;
+L399: /* GGET */
+    tp_aot_op(tp, f, code + 399);
+L403: /* MOVE */
+    regs[8] = regs[0];
+L404: /* LIST */
+    tp_aot_op(tp, f, code + 404);
+L405: /* STRING */
+    tp_aot_op(tp, f, code + 405);
+L408: /* CALLP */
+    return code + 408;
+L409: /* VAR */
+L412: /* VAR */
+L414: /* NUMBER */
+    tp_aot_op(tp, f, code + 414);
+L417: /* GET */
+    regs[7] = tp_get(tp, regs[6], regs[9]);
+    tp_grey(tp, regs[7]);
+L418: /* VAR */
+L420: /* NUMBER */
+    tp_aot_op(tp, f, code + 420);
+L423: /* GET */
+    regs[8] = tp_get(tp, regs[6], regs[10]);
+    tp_grey(tp, regs[8]);
+L424: /* LINE */
+    f->line = code + 424;
+    f->lineno = 643;
+L429: /* GGET */
+    tp_aot_op(tp, f, code + 429);
+L432: /* STRING */
+    tp_aot_op(tp, f, code + 432);
+L436: /* METHOD */
+    tp_aot_op(tp, f, code + 436);
+L438: /* CALLM */
+    return code + 438;
+L439: /* LINE */
+    f->line = code + 439;
+    f->lineno = 644;
+L445: /* GGET */
+    tp_aot_op(tp, f, code + 445);
+L449: /* STRING */
+    tp_aot_op(tp, f, code + 449);
+L452: /* MGET */
+    tp_aot_op(tp, f, code + 452);
+L454: /* CALLP */
+    return code + 454;
+L455: /* LINE */
+    f->line = code + 455;
+    f->lineno = 646;
+L464: /* GGET */
+    tp_aot_op(tp, f, code + 464);
+L469: /* GGET */
+    tp_aot_op(tp, f, code + 469);
+L472: /* NUMBER */
+    tp_aot_op(tp, f, code + 472);
+L475: /* GET */
+    regs[12] = tp_get(tp, regs[1], regs[13]);
+    tp_grey(tp, regs[12]);
+L476: /* CALLP */
+    return code + 476;
+L477: /* CALLP */
+    return code + 477;
+L478: /* LINE */
+    f->line = code + 478;
+    f->lineno = 651;
+L490: /* GGET */
+    tp_aot_op(tp, f, code + 490);
+L495: /* STRING */
+    tp_aot_op(tp, f, code + 495);
+L500: /* METHOD */
+    tp_aot_op(tp, f, code + 500);
+L502: /* CALLM */
+    return code + 502;
+L503: /* STRING */
+    tp_aot_op(tp, f, code + 503);
+L506: /* MGET */
+    tp_aot_op(tp, f, code + 506);
+L508: /* CALLP */
+    return code + 508;
+L509: /* LINE */
+    f->line = code + 509;
+    f->lineno = 652;
+L514: /* GGET */
+    tp_aot_op(tp, f, code + 514);
+L518: /* MOVE */
+    regs[10] = regs[4];
+L519: /* CALLP */
+    return code + 519;
+L520: /* LINE */
+    f->line = code + 520;
+    f->lineno = 653;
+L527: /* GGET */
+    tp_aot_op(tp, f, code + 527);
+L530: /* STRING */
+    tp_aot_op(tp, f, code + 530);
+L534: /* MGET */
+    tp_aot_op(tp, f, code + 534);
+L536: /* NUMBER */
+    tp_aot_op(tp, f, code + 536);
+L539: /* ITER */
+    if (tp_iter_next(tp, &regs[6], regs[9], &regs[10])) {
+        goto L541;
+    }
+L540: /* JUMP */
+    goto L646;
+L541: /* VAR */
+L543: /* MOVE */
+    regs[11] = regs[6];
+L544: /* LINE */
+    f->line = code + 544;
+    f->lineno = 654;
+L557: /* VAR */
+L561: /* GGET */
+    tp_aot_op(tp, f, code + 561);
+L565: /* STRING */
+    tp_aot_op(tp, f, code + 565);
+L568: /* MGET */
+    tp_aot_op(tp, f, code + 568);
+L570: /* STRING */
+    tp_aot_op(tp, f, code + 570);
+L574: /* MOVE */
+    regs[16] = regs[11];
+L575: /* CALLP */
+    return code + 575;
+L576: /* LINE */
+    f->line = code + 576;
+    f->lineno = 655;
+L589: /* GGET */
+    tp_aot_op(tp, f, code + 589);
+L594: /* STRING */
+    tp_aot_op(tp, f, code + 594);
+L599: /* METHOD */
+    tp_aot_op(tp, f, code + 599);
+L601: /* CALLM */
+    return code + 601;
+L602: /* CALLP */
+    return code + 602;
+L603: /* LINE */
+    f->line = code + 603;
+    f->lineno = 656;
+L614: /* GGET */
+    tp_aot_op(tp, f, code + 614);
+L618: /* GGET */
+    tp_aot_op(tp, f, code + 618);
+L621: /* MOVE */
+    regs[15] = regs[4];
+L622: /* MOVE */
+    regs[16] = regs[5];
+L623: /* GGET */
+    tp_aot_op(tp, f, code + 623);
+L627: /* MOVE */
+    regs[19] = regs[11];
+L628: /* CALLP */
+    return code + 628;
+L629: /* CALLP */
+    return code + 629;
+L630: /* LINE */
+    f->line = code + 630;
+    f->lineno = 657;
+L638: /* GGET */
+    tp_aot_op(tp, f, code + 638);
+L643: /* MOVE */
+    regs[14] = regs[5];
+L644: /* CALLP */
+    return code + 644;
+L645: /* JUMP */
+    tp_aot_safepoint(tp, 106);
+    goto L539;
+L646: /* LINE */
+    f->line = code + 646;
+    f->lineno = 658;
+L652: /* GGET */
+    tp_aot_op(tp, f, code + 652);
+L657: /* MOVE */
+    regs[13] = regs[4];
+L658: /* CALLP */
+    return code + 658;
+L659: /* LINE */
+    f->line = code + 659;
+    f->lineno = 659;
+L663: /* GGET */
+    tp_aot_op(tp, f, code + 663);
+L666: /* STRING */
+    tp_aot_op(tp, f, code + 666);
+L669: /* METHOD */
+    tp_aot_op(tp, f, code + 669);
+L671: /* CALLM */
+    return code + 671;
+L672: /* LINE */
+    f->line = code + 672;
+    f->lineno = 661;
+L678: /* GGET */
+    tp_aot_op(tp, f, code + 678);
+L681: /* MOVE */
+    regs[13] = regs[8];
+L682: /* STRING */
+    tp_aot_op(tp, f, code + 682);
+L685: /* CALLP */
+    return code + 685;
+L686: /* LINE */
+    f->line = code + 686;
+    f->lineno = 663;
+L697: /* GGET */
+    tp_aot_op(tp, f, code + 697);
+L702: /* NUMBER */
+    tp_aot_op(tp, f, code + 702);
+L705: /* CALLP */
+    return code + 705;
+L706: /* VAR */
+L709: /* VAR */
+L711: /* NUMBER */
+    tp_aot_op(tp, f, code + 711);
+L714: /* GET */
+    regs[10] = tp_get(tp, regs[9], regs[13]);
+    tp_grey(tp, regs[10]);
+L715: /* VAR */
+L718: /* NUMBER */
+    tp_aot_op(tp, f, code + 718);
+L721: /* GET */
+    regs[12] = tp_get(tp, regs[9], regs[14]);
+    tp_grey(tp, regs[12]);
+L722: /* VAR */
+L725: /* NUMBER */
+    tp_aot_op(tp, f, code + 725);
+L728: /* GET */
+    regs[13] = tp_get(tp, regs[9], regs[15]);
+    tp_grey(tp, regs[13]);
+L729: /* LINE */
+    f->line = code + 729;
+    f->lineno = 664;
+L736: /* GGET */
+    tp_aot_op(tp, f, code + 736);
+L741: /* MOVE */
+    regs[15] = regs[12];
+L742: /* CALLP */
+    return code + 742;
+L743: /* LINE */
+    f->line = code + 743;
+    f->lineno = 665;
+L750: /* GGET */
+    tp_aot_op(tp, f, code + 750);
+L755: /* MOVE */
+    regs[15] = regs[13];
+L756: /* CALLP */
+    return code + 756;
+L757: /* LINE */
+    f->line = code + 757;
+    f->lineno = 666;
+L767: /* GGET */
+    tp_aot_op(tp, f, code + 767);
+L771: /* GGET */
+    tp_aot_op(tp, f, code + 771);
+L775: /* MOVE */
+    regs[16] = regs[10];
+L776: /* MOVE */
+    regs[17] = regs[7];
+L777: /* MOVE */
+    regs[18] = regs[12];
+L778: /* CALLP */
+    return code + 778;
+L779: /* LINE */
+    f->line = code + 779;
+    f->lineno = 667;
+L785: /* GGET */
+    tp_aot_op(tp, f, code + 785);
+L790: /* MOVE */
+    regs[15] = regs[7];
+L791: /* CALLP */
+    return code + 791;
+L792: /* LINE */
+    f->line = code + 792;
+    f->lineno = 668;
+L798: /* GGET */
+    tp_aot_op(tp, f, code + 798);
+L803: /* MOVE */
+    regs[15] = regs[10];
+L804: /* CALLP */
+    return code + 804;
+L805: /* LINE */
+    f->line = code + 805;
+    f->lineno = 669;
+L812: /* GGET */
+    tp_aot_op(tp, f, code + 812);
+L817: /* MOVE */
+    regs[15] = regs[12];
+L818: /* CALLP */
+    return code + 818;
+L819: /* LINE */
+    f->line = code + 819;
+    f->lineno = 670;
+L826: /* GGET */
+    tp_aot_op(tp, f, code + 826);
+L831: /* MOVE */
+    regs[15] = regs[13];
+L832: /* CALLP */
+    return code + 832;
+L833: /* EOF */
+    return code + 833;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_14484(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 32: goto L32;
+        case 35: goto L35;
+        case 39: goto L39;
+        case 41: goto L41;
+        case 47: goto L47;
+        case 52: goto L52;
+        case 53: goto L53;
+        case 59: goto L59;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 75: goto L75;
+        case 78: goto L78;
+        case 79: goto L79;
+        case 84: goto L84;
+        case 85: goto L85;
+        case 92: goto L92;
+        case 94: goto L94;
+        case 97: goto L97;
+        case 100: goto L100;
+        case 101: goto L101;
+        case 102: goto L102;
+        case 107: goto L107;
+        case 111: goto L111;
+        case 114: goto L114;
+        case 115: goto L115;
+        case 122: goto L122;
+        case 127: goto L127;
+        case 128: goto L128;
+        case 129: goto L129;
+        case 135: goto L135;
+        case 139: goto L139;
+        case 140: goto L140;
+        case 143: goto L143;
+        case 144: goto L144;
+        case 153: goto L153;
+        case 158: goto L158;
+        case 161: goto L161;
+        case 164: goto L164;
+        case 165: goto L165;
+        case 166: goto L166;
+        case 167: goto L167;
+        case 173: goto L173;
+        case 177: goto L177;
+        case 178: goto L178;
+        case 182: goto L182;
+        case 183: goto L183;
+        case 189: goto L189;
+        case 192: goto L192;
+        case 193: goto L193;
+        case 197: goto L197;
+        case 198: goto L198;
+        case 204: goto L204;
+        case 207: goto L207;
+        case 208: goto L208;
+        case 211: goto L211;
+        case 212: goto L212;
+        case 217: goto L217;
+        case 221: goto L221;
+        case 222: goto L222;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 672;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 673;
+L32: /* VAR */
+L35: /* STRING */
+    tp_aot_op(tp, f, code + 35);
+L39: /* MGET */
+    tp_aot_op(tp, f, code + 39);
+L41: /* LINE */
+    f->line = code + 41;
+    f->lineno = 674;
+L47: /* GGET */
+    tp_aot_op(tp, f, code + 47);
+L52: /* CALLP */
+    return code + 52;
+L53: /* LINE */
+    f->line = code + 53;
+    f->lineno = 675;
+L59: /* GGET */
+    tp_aot_op(tp, f, code + 59);
+L62: /* MOVE */
+    regs[3] = regs[0];
+L63: /* STRING */
+    tp_aot_op(tp, f, code + 63);
+L67: /* CALLP */
+    return code + 67;
+L68: /* LINE */
+    f->line = code + 68;
+    f->lineno = 676;
+L75: /* GGET */
+    tp_aot_op(tp, f, code + 75);
+L78: /* MOVE */
+    regs[3] = regs[0];
+L79: /* STRING */
+    tp_aot_op(tp, f, code + 79);
+L84: /* CALLP */
+    return code + 84;
+L85: /* LINE */
+    f->line = code + 85;
+    f->lineno = 677;
+L92: /* VAR */
+L94: /* GGET */
+    tp_aot_op(tp, f, code + 94);
+L97: /* NUMBER */
+    tp_aot_op(tp, f, code + 97);
+L100: /* GET */
+    regs[4] = tp_get(tp, regs[1], regs[5]);
+    tp_grey(tp, regs[4]);
+L101: /* CALLP */
+    return code + 101;
+L102: /* LINE */
+    f->line = code + 102;
+    f->lineno = 678;
+L107: /* GGET */
+    tp_aot_op(tp, f, code + 107);
+L111: /* GGET */
+    tp_aot_op(tp, f, code + 111);
+L114: /* CALLP */
+    return code + 114;
+L115: /* LINE */
+    f->line = code + 115;
+    f->lineno = 679;
+L122: /* GGET */
+    tp_aot_op(tp, f, code + 122);
+L127: /* MOVE */
+    regs[4] = regs[5];
+L128: /* CALLP */
+    return code + 128;
+L129: /* LINE */
+    f->line = code + 129;
+    f->lineno = 680;
+L135: /* GGET */
+    tp_aot_op(tp, f, code + 135);
+L139: /* MOVE */
+    regs[4] = regs[0];
+L140: /* STRING */
+    tp_aot_op(tp, f, code + 140);
+L143: /* CALLP */
+    return code + 143;
+L144: /* LINE */
+    f->line = code + 144;
+    f->lineno = 681;
+L153: /* GGET */
+    tp_aot_op(tp, f, code + 153);
+L158: /* GGET */
+    tp_aot_op(tp, f, code + 158);
+L161: /* NUMBER */
+    tp_aot_op(tp, f, code + 161);
+L164: /* GET */
+    regs[6] = tp_get(tp, regs[1], regs[2]);
+    tp_grey(tp, regs[6]);
+L165: /* CALLP */
+    return code + 165;
+L166: /* CALLP */
+    return code + 166;
+L167: /* LINE */
+    f->line = code + 167;
+    f->lineno = 682;
+L173: /* GGET */
+    tp_aot_op(tp, f, code + 173);
+L177: /* MOVE */
+    regs[4] = regs[0];
+L178: /* STRING */
+    tp_aot_op(tp, f, code + 178);
+L182: /* CALLP */
+    return code + 182;
+L183: /* LINE */
+    f->line = code + 183;
+    f->lineno = 683;
+L189: /* GGET */
+    tp_aot_op(tp, f, code + 189);
+L192: /* MOVE */
+    regs[4] = regs[0];
+L193: /* STRING */
+    tp_aot_op(tp, f, code + 193);
+L197: /* CALLP */
+    return code + 197;
+L198: /* LINE */
+    f->line = code + 198;
+    f->lineno = 684;
+L204: /* GGET */
+    tp_aot_op(tp, f, code + 204);
+L207: /* MOVE */
+    regs[4] = regs[0];
+L208: /* STRING */
+    tp_aot_op(tp, f, code + 208);
+L211: /* CALLP */
+    return code + 211;
+L212: /* LINE */
+    f->line = code + 212;
+    f->lineno = 685;
+L217: /* GGET */
+    tp_aot_op(tp, f, code + 217);
+L221: /* CALLP */
+    return code + 221;
+L222: /* EOF */
+    return code + 222;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_14731(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 46: goto L46;
+        case 50: goto L50;
+        case 52: goto L52;
+        case 56: goto L56;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 63: goto L63;
+        case 65: goto L65;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 73: goto L73;
+        case 75: goto L75;
+        case 79: goto L79;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 85: goto L85;
+        case 86: goto L86;
+        case 106: goto L106;
+        case 110: goto L110;
+        case 112: goto L112;
+        case 115: goto L115;
+        case 116: goto L116;
+        case 119: goto L119;
+        case 121: goto L121;
+        case 125: goto L125;
+        case 126: goto L126;
+        case 127: goto L127;
+        case 128: goto L128;
+        case 132: goto L132;
+        case 134: goto L134;
+        case 137: goto L137;
+        case 138: goto L138;
+        case 141: goto L141;
+        case 143: goto L143;
+        case 146: goto L146;
+        case 150: goto L150;
+        case 152: goto L152;
+        case 153: goto L153;
+        case 154: goto L154;
+        case 155: goto L155;
+        case 158: goto L158;
+        case 159: goto L159;
+        case 169: goto L169;
+        case 174: goto L174;
+        case 178: goto L178;
+        case 180: goto L180;
+        case 183: goto L183;
+        case 184: goto L184;
+        case 185: goto L185;
+        case 186: goto L186;
+        case 187: goto L187;
+        case 190: goto L190;
+        case 192: goto L192;
+        case 195: goto L195;
+        case 196: goto L196;
+        case 198: goto L198;
+        case 201: goto L201;
+        case 202: goto L202;
+        case 204: goto L204;
+        case 207: goto L207;
+        case 208: goto L208;
+        case 210: goto L210;
+        case 213: goto L213;
+        case 214: goto L214;
+        case 228: goto L228;
+        case 231: goto L231;
+        case 232: goto L232;
+        case 233: goto L233;
+        case 236: goto L236;
+        case 237: goto L237;
+        case 238: goto L238;
+        case 239: goto L239;
+        case 240: goto L240;
+        case 241: goto L241;
+        case 242: goto L242;
+        case 243: goto L243;
+        case 244: goto L244;
+        case 245: goto L245;
+        case 246: goto L246;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 687;
+L9: /* VAR */
+L11: /* STRING */
+    tp_aot_op(tp, f, code + 11);
+L20: /* FILE */
+    f->fname = regs[1];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L27: /* NAME */
+    f->name = regs[1];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 689;
+L46: /* STRING */
+    tp_aot_op(tp, f, code + 46);
+L50: /* MGET */
+    tp_aot_op(tp, f, code + 50);
+L52: /* STRING */
+    tp_aot_op(tp, f, code + 52);
+L56: /* NE */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[1].nint != regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 56);
+    }
+L57: /* IFN */
+    if (!(TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1]))) {
+        goto L59;
+    }
+L58: /* JUMP */
+    goto L80;
+L59: /* STRING */
+    tp_aot_op(tp, f, code + 59);
+L63: /* MGET */
+    tp_aot_op(tp, f, code + 63);
+L65: /* NUMBER */
+    tp_aot_op(tp, f, code + 65);
+L68: /* GET */
+    regs[1] = tp_get(tp, regs[1], regs[2]);
+    tp_grey(tp, regs[1]);
+L69: /* STRING */
+    tp_aot_op(tp, f, code + 69);
+L73: /* MGET */
+    tp_aot_op(tp, f, code + 73);
+L75: /* STRING */
+    tp_aot_op(tp, f, code + 75);
+L79: /* NE */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[1].nint != regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 79);
+    }
+L80: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L82;
+    }
+L81: /* JUMP */
+    goto L86;
+L82: /* NUMBER */
+    tp_aot_op(tp, f, code + 82);
+L85: /* RETURN */
+    return code + 85;
+L86: /* LINE */
+    f->line = code + 86;
+    f->lineno = 690;
+L106: /* STRING */
+    tp_aot_op(tp, f, code + 106);
+L110: /* MGET */
+    tp_aot_op(tp, f, code + 110);
+L112: /* NUMBER */
+    tp_aot_op(tp, f, code + 112);
+L115: /* GET */
+    regs[1] = tp_get(tp, regs[1], regs[2]);
+    tp_grey(tp, regs[1]);
+L116: /* STRING */
+    tp_aot_op(tp, f, code + 116);
+L119: /* MGET */
+    tp_aot_op(tp, f, code + 119);
+L121: /* STRING */
+    tp_aot_op(tp, f, code + 121);
+L125: /* NE */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[1].nint != regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 125);
+    }
+L126: /* IFN */
+    if (!(TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1]))) {
+        goto L128;
+    }
+L127: /* JUMP */
+    goto L153;
+L128: /* STRING */
+    tp_aot_op(tp, f, code + 128);
+L132: /* MGET */
+    tp_aot_op(tp, f, code + 132);
+L134: /* NUMBER */
+    tp_aot_op(tp, f, code + 134);
+L137: /* GET */
+    regs[1] = tp_get(tp, regs[1], regs[2]);
+    tp_grey(tp, regs[1]);
+L138: /* STRING */
+    tp_aot_op(tp, f, code + 138);
+L141: /* MGET */
+    tp_aot_op(tp, f, code + 141);
+L143: /* GGET */
+    tp_aot_op(tp, f, code + 143);
+L146: /* STRING */
+    tp_aot_op(tp, f, code + 146);
+L150: /* MGET */
+    tp_aot_op(tp, f, code + 150);
+L152: /* IN */
+    regs[1] = tp_has(tp, regs[2], regs[1]);
+L153: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L155;
+    }
+L154: /* JUMP */
+    goto L159;
+L155: /* NUMBER */
+    tp_aot_op(tp, f, code + 155);
+L158: /* RETURN */
+    return code + 158;
+L159: /* LINE */
+    f->line = code + 159;
+    f->lineno = 691;
+L169: /* GGET */
+    tp_aot_op(tp, f, code + 169);
+L174: /* STRING */
+    tp_aot_op(tp, f, code + 174);
+L178: /* MGET */
+    tp_aot_op(tp, f, code + 178);
+L180: /* NUMBER */
+    tp_aot_op(tp, f, code + 180);
+L183: /* NONE */
+    regs[6] = tp_None;
+L184: /* LIST */
+    tp_aot_op(tp, f, code + 184);
+L185: /* GET */
+    regs[3] = tp_get(tp, regs[3], regs[4]);
+    tp_grey(tp, regs[3]);
+L186: /* CALLP */
+    return code + 186;
+L187: /* VAR */
+L190: /* VAR */
+L192: /* NUMBER */
+    tp_aot_op(tp, f, code + 192);
+L195: /* GET */
+    regs[2] = tp_get(tp, regs[1], regs[4]);
+    tp_grey(tp, regs[2]);
+L196: /* VAR */
+L198: /* NUMBER */
+    tp_aot_op(tp, f, code + 198);
+L201: /* GET */
+    regs[3] = tp_get(tp, regs[1], regs[5]);
+    tp_grey(tp, regs[3]);
+L202: /* VAR */
+L204: /* NUMBER */
+    tp_aot_op(tp, f, code + 204);
+L207: /* GET */
+    regs[4] = tp_get(tp, regs[1], regs[6]);
+    tp_grey(tp, regs[4]);
+L208: /* VAR */
+L210: /* NUMBER */
+    tp_aot_op(tp, f, code + 210);
+L213: /* GET */
+    regs[5] = tp_get(tp, regs[1], regs[7]);
+    tp_grey(tp, regs[5]);
+L214: /* LINE */
+    f->line = code + 214;
+    f->lineno = 692;
+L228: /* GGET */
+    tp_aot_op(tp, f, code + 228);
+L231: /* MOVE */
+    regs[7] = regs[3];
+L232: /* CALLP */
+    return code + 232;
+L233: /* NUMBER */
+    tp_aot_op(tp, f, code + 233);
+L236: /* EQ */
+    if (TP_BOTH(regs[1], regs[6], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[1].nint == regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 236);
+    }
+L237: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L239;
+    }
+L238: /* JUMP */
+    goto L241;
+L239: /* NONE */
+    regs[6] = tp_None;
+L240: /* EQ */
+    if (TP_BOTH(regs[4], regs[6], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[4].nint == regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 240);
+    }
+L241: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L243;
+    }
+L242: /* JUMP */
+    goto L245;
+L243: /* NONE */
+    regs[6] = tp_None;
+L244: /* EQ */
+    if (TP_BOTH(regs[5], regs[6], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[5].nint == regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 244);
+    }
+L245: /* RETURN */
+    return code + 245;
+L246: /* EOF */
+    return code + 246;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_15003(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 35: goto L35;
+        case 38: goto L38;
+        case 42: goto L42;
+        case 44: goto L44;
+        case 50: goto L50;
+        case 52: goto L52;
+        case 56: goto L56;
+        case 57: goto L57;
+        case 63: goto L63;
+        case 65: goto L65;
+        case 70: goto L70;
+        case 73: goto L73;
+        case 74: goto L74;
+        case 86: goto L86;
+        case 91: goto L91;
+        case 95: goto L95;
+        case 98: goto L98;
+        case 99: goto L99;
+        case 102: goto L102;
+        case 103: goto L103;
+        case 107: goto L107;
+        case 109: goto L109;
+        case 110: goto L110;
+        case 125: goto L125;
+        case 127: goto L127;
+        case 132: goto L132;
+        case 133: goto L133;
+        case 136: goto L136;
+        case 137: goto L137;
+        case 141: goto L141;
+        case 142: goto L142;
+        case 145: goto L145;
+        case 146: goto L146;
+        case 151: goto L151;
+        case 152: goto L152;
+        case 163: goto L163;
+        case 167: goto L167;
+        case 170: goto L170;
+        case 171: goto L171;
+        case 174: goto L174;
+        case 175: goto L175;
+        case 176: goto L176;
+        case 180: goto L180;
+        case 181: goto L181;
+        case 184: goto L184;
+        case 185: goto L185;
+        case 202: goto L202;
+        case 207: goto L207;
+        case 212: goto L212;
+        case 215: goto L215;
+        case 216: goto L216;
+        case 220: goto L220;
+        case 223: goto L223;
+        case 225: goto L225;
+        case 228: goto L228;
+        case 229: goto L229;
+        case 230: goto L230;
+        case 231: goto L231;
+        case 232: goto L232;
+        case 241: goto L241;
+        case 246: goto L246;
+        case 249: goto L249;
+        case 252: goto L252;
+        case 253: goto L253;
+        case 254: goto L254;
+        case 255: goto L255;
+        case 261: goto L261;
+        case 265: goto L265;
+        case 266: goto L266;
+        case 270: goto L270;
+        case 271: goto L271;
+        case 283: goto L283;
+        case 286: goto L286;
+        case 287: goto L287;
+        case 291: goto L291;
+        case 292: goto L292;
+        case 295: goto L295;
+        case 296: goto L296;
+        case 299: goto L299;
+        case 300: goto L300;
+        case 304: goto L304;
+        case 305: goto L305;
+        case 312: goto L312;
+        case 317: goto L317;
+        case 318: goto L318;
+        case 319: goto L319;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 694;
+L9: /* VAR */
+L11: /* STRING */
+    tp_aot_op(tp, f, code + 11);
+L20: /* FILE */
+    f->fname = regs[1];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L27: /* NAME */
+    f->name = regs[1];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 697;
+L35: /* VAR */
+L38: /* STRING */
+    tp_aot_op(tp, f, code + 38);
+L42: /* MGET */
+    tp_aot_op(tp, f, code + 42);
+L44: /* LINE */
+    f->line = code + 44;
+    f->lineno = 698;
+L50: /* VAR */
+L52: /* GGET */
+    tp_aot_op(tp, f, code + 52);
+L56: /* CALLP */
+    return code + 56;
+L57: /* LINE */
+    f->line = code + 57;
+    f->lineno = 699;
+L63: /* VAR */
+L65: /* GGET */
+    tp_aot_op(tp, f, code + 65);
+L70: /* NUMBER */
+    tp_aot_op(tp, f, code + 70);
+L73: /* CALLP */
+    return code + 73;
+L74: /* LINE */
+    f->line = code + 74;
+    f->lineno = 700;
+L86: /* GGET */
+    tp_aot_op(tp, f, code + 86);
+L91: /* GGET */
+    tp_aot_op(tp, f, code + 91);
+L95: /* NUMBER */
+    tp_aot_op(tp, f, code + 95);
+L98: /* GET */
+    regs[7] = tp_get(tp, regs[2], regs[9]);
+    tp_grey(tp, regs[7]);
+L99: /* NUMBER */
+    tp_aot_op(tp, f, code + 99);
+L102: /* GET */
+    regs[8] = tp_get(tp, regs[1], regs[9]);
+    tp_grey(tp, regs[8]);
+L103: /* STRING */
+    tp_aot_op(tp, f, code + 103);
+L107: /* MGET */
+    tp_aot_op(tp, f, code + 107);
+L109: /* CALLP */
+    return code + 109;
+L110: /* LINE */
+    f->line = code + 110;
+    f->lineno = 702;
+L125: /* VAR */
+L127: /* GGET */
+    tp_aot_op(tp, f, code + 127);
+L132: /* CALLP */
+    return code + 132;
+L133: /* GGET */
+    tp_aot_op(tp, f, code + 133);
+L136: /* MOVE */
+    regs[7] = regs[3];
+L137: /* STRING */
+    tp_aot_op(tp, f, code + 137);
+L141: /* CALLP */
+    return code + 141;
+L142: /* GGET */
+    tp_aot_op(tp, f, code + 142);
+L145: /* MOVE */
+    regs[7] = regs[3];
+L146: /* STRING */
+    tp_aot_op(tp, f, code + 146);
+L151: /* CALLP */
+    return code + 151;
+L152: /* LINE */
+    f->line = code + 152;
+    f->lineno = 703;
+L163: /* GGET */
+    tp_aot_op(tp, f, code + 163);
+L167: /* GGET */
+    tp_aot_op(tp, f, code + 167);
+L170: /* MOVE */
+    regs[8] = regs[4];
+L171: /* NUMBER */
+    tp_aot_op(tp, f, code + 171);
+L174: /* GET */
+    regs[9] = tp_get(tp, regs[2], regs[10]);
+    tp_grey(tp, regs[9]);
+L175: /* CALLP */
+    return code + 175;
+L176: /* GGET */
+    tp_aot_op(tp, f, code + 176);
+L180: /* MOVE */
+    regs[7] = regs[3];
+L181: /* STRING */
+    tp_aot_op(tp, f, code + 181);
+L184: /* CALLP */
+    return code + 184;
+L185: /* LINE */
+    f->line = code + 185;
+    f->lineno = 704;
+L202: /* GGET */
+    tp_aot_op(tp, f, code + 202);
+L207: /* GGET */
+    tp_aot_op(tp, f, code + 207);
+L212: /* NUMBER */
+    tp_aot_op(tp, f, code + 212);
+L215: /* GET */
+    regs[9] = tp_get(tp, regs[1], regs[10]);
+    tp_grey(tp, regs[9]);
+L216: /* GGET */
+    tp_aot_op(tp, f, code + 216);
+L220: /* STRING */
+    tp_aot_op(tp, f, code + 220);
+L223: /* MGET */
+    tp_aot_op(tp, f, code + 223);
+L225: /* STRING */
+    tp_aot_op(tp, f, code + 225);
+L228: /* MOVE */
+    regs[13] = regs[4];
+L229: /* CALLP */
+    return code + 229;
+L230: /* CALLP */
+    return code + 230;
+L231: /* CALLP */
+    return code + 231;
+L232: /* LINE */
+    f->line = code + 232;
+    f->lineno = 705;
+L241: /* GGET */
+    tp_aot_op(tp, f, code + 241);
+L246: /* GGET */
+    tp_aot_op(tp, f, code + 246);
+L249: /* NUMBER */
+    tp_aot_op(tp, f, code + 249);
+L252: /* GET */
+    regs[9] = tp_get(tp, regs[1], regs[10]);
+    tp_grey(tp, regs[9]);
+L253: /* CALLP */
+    return code + 253;
+L254: /* CALLP */
+    return code + 254;
+L255: /* LINE */
+    f->line = code + 255;
+    f->lineno = 706;
+L261: /* GGET */
+    tp_aot_op(tp, f, code + 261);
+L265: /* MOVE */
+    regs[7] = regs[3];
+L266: /* STRING */
+    tp_aot_op(tp, f, code + 266);
+L270: /* CALLP */
+    return code + 270;
+L271: /* LINE */
+    f->line = code + 271;
+    f->lineno = 707;
+L283: /* GGET */
+    tp_aot_op(tp, f, code + 283);
+L286: /* MOVE */
+    regs[7] = regs[3];
+L287: /* STRING */
+    tp_aot_op(tp, f, code + 287);
+L291: /* CALLP */
+    return code + 291;
+L292: /* GGET */
+    tp_aot_op(tp, f, code + 292);
+L295: /* MOVE */
+    regs[7] = regs[3];
+L296: /* STRING */
+    tp_aot_op(tp, f, code + 296);
+L299: /* CALLP */
+    return code + 299;
+L300: /* GGET */
+    tp_aot_op(tp, f, code + 300);
+L304: /* CALLP */
+    return code + 304;
+L305: /* LINE */
+    f->line = code + 305;
+    f->lineno = 709;
+L312: /* GGET */
+    tp_aot_op(tp, f, code + 312);
+L317: /* MOVE */
+    regs[7] = regs[2];
+L318: /* CALLP */
+    return code + 318;
+L319: /* EOF */
+    return code + 319;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_15347(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 24: goto L24;
+        case 25: goto L25;
+        case 32: goto L32;
+        case 35: goto L35;
+        case 39: goto L39;
+        case 41: goto L41;
+        case 50: goto L50;
+        case 56: goto L56;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 73: goto L73;
+        case 79: goto L79;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 88: goto L88;
+        case 90: goto L90;
+        case 94: goto L94;
+        case 95: goto L95;
+        case 102: goto L102;
+        case 104: goto L104;
+        case 107: goto L107;
+        case 110: goto L110;
+        case 111: goto L111;
+        case 112: goto L112;
+        case 119: goto L119;
+        case 121: goto L121;
+        case 126: goto L126;
+        case 129: goto L129;
+        case 130: goto L130;
+        case 145: goto L145;
+        case 147: goto L147;
+        case 152: goto L152;
+        case 153: goto L153;
+        case 156: goto L156;
+        case 157: goto L157;
+        case 161: goto L161;
+        case 162: goto L162;
+        case 165: goto L165;
+        case 166: goto L166;
+        case 171: goto L171;
+        case 172: goto L172;
+        case 183: goto L183;
+        case 187: goto L187;
+        case 191: goto L191;
+        case 192: goto L192;
+        case 193: goto L193;
+        case 194: goto L194;
+        case 195: goto L195;
+        case 199: goto L199;
+        case 200: goto L200;
+        case 203: goto L203;
+        case 204: goto L204;
+        case 221: goto L221;
+        case 226: goto L226;
+        case 231: goto L231;
+        case 234: goto L234;
+        case 235: goto L235;
+        case 239: goto L239;
+        case 242: goto L242;
+        case 244: goto L244;
+        case 247: goto L247;
+        case 248: goto L248;
+        case 249: goto L249;
+        case 250: goto L250;
+        case 251: goto L251;
+        case 260: goto L260;
+        case 265: goto L265;
+        case 268: goto L268;
+        case 271: goto L271;
+        case 272: goto L272;
+        case 273: goto L273;
+        case 274: goto L274;
+        case 280: goto L280;
+        case 284: goto L284;
+        case 285: goto L285;
+        case 289: goto L289;
+        case 290: goto L290;
+        case 302: goto L302;
+        case 305: goto L305;
+        case 306: goto L306;
+        case 310: goto L310;
+        case 311: goto L311;
+        case 314: goto L314;
+        case 315: goto L315;
+        case 318: goto L318;
+        case 319: goto L319;
+        case 323: goto L323;
+        case 324: goto L324;
+        case 331: goto L331;
+        case 336: goto L336;
+        case 337: goto L337;
+        case 338: goto L338;
+        case 343: goto L343;
+        case 348: goto L348;
+        case 349: goto L349;
+        case 350: goto L350;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 711;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L24: /* NAME */
+    f->name = regs[1];
+L25: /* LINE */
+    f->line = code + 25;
+    f->lineno = 712;
+L32: /* VAR */
+L35: /* STRING */
+    tp_aot_op(tp, f, code + 35);
+L39: /* MGET */
+    tp_aot_op(tp, f, code + 39);
+L41: /* LINE */
+    f->line = code + 41;
+    f->lineno = 713;
+L50: /* GGET */
+    tp_aot_op(tp, f, code + 50);
+L56: /* NUMBER */
+    tp_aot_op(tp, f, code + 56);
+L59: /* GET */
+    regs[3] = tp_get(tp, regs[1], regs[4]);
+    tp_grey(tp, regs[3]);
+L60: /* CALLP */
+    return code + 60;
+L61: /* IF */
+    if (TP_IS_INT(regs[11]) ? regs[11].nint != 0 : tp_true(tp, regs[11])) {
+        goto L63;
+    }
+L62: /* JUMP */
+    goto L82;
+L63: /* LINE */
+    f->line = code + 63;
+    f->lineno = 714;
+L73: /* GGET */
+    tp_aot_op(tp, f, code + 73);
+L79: /* MOVE */
+    regs[3] = regs[0];
+L80: /* CALLP */
+    return code + 80;
+L81: /* RETURN */
+    return code + 81;
+L82: /* LINE */
+    f->line = code + 82;
+    f->lineno = 716;
+L88: /* VAR */
+L90: /* GGET */
+    tp_aot_op(tp, f, code + 90);
+L94: /* CALLP */
+    return code + 94;
+L95: /* LINE */
+    f->line = code + 95;
+    f->lineno = 717;
+L102: /* VAR */
+L104: /* GGET */
+    tp_aot_op(tp, f, code + 104);
+L107: /* NUMBER */
+    tp_aot_op(tp, f, code + 107);
+L110: /* GET */
+    regs[5] = tp_get(tp, regs[1], regs[6]);
+    tp_grey(tp, regs[5]);
+L111: /* CALLP */
+    return code + 111;
+L112: /* LINE */
+    f->line = code + 112;
+    f->lineno = 718;
+L119: /* VAR */
+L121: /* GGET */
+    tp_aot_op(tp, f, code + 121);
+L126: /* NUMBER */
+    tp_aot_op(tp, f, code + 126);
+L129: /* CALLP */
+    return code + 129;
+L130: /* LINE */
+    f->line = code + 130;
+    f->lineno = 720;
+L145: /* VAR */
+L147: /* GGET */
+    tp_aot_op(tp, f, code + 147);
+L152: /* CALLP */
+    return code + 152;
+L153: /* GGET */
+    tp_aot_op(tp, f, code + 153);
+L156: /* MOVE */
+    regs[7] = regs[4];
+L157: /* STRING */
+    tp_aot_op(tp, f, code + 157);
+L161: /* CALLP */
+    return code + 161;
+L162: /* GGET */
+    tp_aot_op(tp, f, code + 162);
+L165: /* MOVE */
+    regs[7] = regs[4];
+L166: /* STRING */
+    tp_aot_op(tp, f, code + 166);
+L171: /* CALLP */
+    return code + 171;
+L172: /* LINE */
+    f->line = code + 172;
+    f->lineno = 721;
+L183: /* GGET */
+    tp_aot_op(tp, f, code + 183);
+L187: /* GGET */
+    tp_aot_op(tp, f, code + 187);
+L191: /* MOVE */
+    regs[8] = regs[11];
+L192: /* MOVE */
+    regs[9] = regs[2];
+L193: /* MOVE */
+    regs[10] = regs[3];
+L194: /* CALLP */
+    return code + 194;
+L195: /* GGET */
+    tp_aot_op(tp, f, code + 195);
+L199: /* MOVE */
+    regs[7] = regs[4];
+L200: /* STRING */
+    tp_aot_op(tp, f, code + 200);
+L203: /* CALLP */
+    return code + 203;
+L204: /* LINE */
+    f->line = code + 204;
+    f->lineno = 722;
+L221: /* GGET */
+    tp_aot_op(tp, f, code + 221);
+L226: /* GGET */
+    tp_aot_op(tp, f, code + 226);
+L231: /* NUMBER */
+    tp_aot_op(tp, f, code + 231);
+L234: /* GET */
+    regs[9] = tp_get(tp, regs[1], regs[12]);
+    tp_grey(tp, regs[9]);
+L235: /* GGET */
+    tp_aot_op(tp, f, code + 235);
+L239: /* STRING */
+    tp_aot_op(tp, f, code + 239);
+L242: /* MGET */
+    tp_aot_op(tp, f, code + 242);
+L244: /* STRING */
+    tp_aot_op(tp, f, code + 244);
+L247: /* MOVE */
+    regs[15] = regs[11];
+L248: /* CALLP */
+    return code + 248;
+L249: /* CALLP */
+    return code + 249;
+L250: /* CALLP */
+    return code + 250;
+L251: /* LINE */
+    f->line = code + 251;
+    f->lineno = 723;
+L260: /* GGET */
+    tp_aot_op(tp, f, code + 260);
+L265: /* GGET */
+    tp_aot_op(tp, f, code + 265);
+L268: /* NUMBER */
+    tp_aot_op(tp, f, code + 268);
+L271: /* GET */
+    regs[9] = tp_get(tp, regs[1], regs[10]);
+    tp_grey(tp, regs[9]);
+L272: /* CALLP */
+    return code + 272;
+L273: /* CALLP */
+    return code + 273;
+L274: /* LINE */
+    f->line = code + 274;
+    f->lineno = 724;
+L280: /* GGET */
+    tp_aot_op(tp, f, code + 280);
+L284: /* MOVE */
+    regs[7] = regs[4];
+L285: /* STRING */
+    tp_aot_op(tp, f, code + 285);
+L289: /* CALLP */
+    return code + 289;
+L290: /* LINE */
+    f->line = code + 290;
+    f->lineno = 725;
+L302: /* GGET */
+    tp_aot_op(tp, f, code + 302);
+L305: /* MOVE */
+    regs[7] = regs[4];
+L306: /* STRING */
+    tp_aot_op(tp, f, code + 306);
+L310: /* CALLP */
+    return code + 310;
+L311: /* GGET */
+    tp_aot_op(tp, f, code + 311);
+L314: /* MOVE */
+    regs[7] = regs[4];
+L315: /* STRING */
+    tp_aot_op(tp, f, code + 315);
+L318: /* CALLP */
+    return code + 318;
+L319: /* GGET */
+    tp_aot_op(tp, f, code + 319);
+L323: /* CALLP */
+    return code + 323;
+L324: /* LINE */
+    f->line = code + 324;
+    f->lineno = 727;
+L331: /* GGET */
+    tp_aot_op(tp, f, code + 331);
+L336: /* MOVE */
+    regs[7] = regs[2];
+L337: /* CALLP */
+    return code + 337;
+L338: /* LINE */
+    f->line = code + 338;
+    f->lineno = 728;
+L343: /* GGET */
+    tp_aot_op(tp, f, code + 343);
+L348: /* MOVE */
+    regs[7] = regs[3];
+L349: /* CALLP */
+    return code + 349;
+L350: /* EOF */
+    return code + 350;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_15725(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 22: goto L22;
+        case 23: goto L23;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 37: goto L37;
+        case 40: goto L40;
+        case 44: goto L44;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 62: goto L62;
+        case 67: goto L67;
+        case 71: goto L71;
+        case 74: goto L74;
+        case 76: goto L76;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 90: goto L90;
+        case 94: goto L94;
+        case 98: goto L98;
+        case 99: goto L99;
+        case 102: goto L102;
+        case 105: goto L105;
+        case 106: goto L106;
+        case 116: goto L116;
+        case 118: goto L118;
+        case 122: goto L122;
+        case 125: goto L125;
+        case 127: goto L127;
+        case 130: goto L130;
+        case 131: goto L131;
+        case 141: goto L141;
+        case 145: goto L145;
+        case 148: goto L148;
+        case 150: goto L150;
+        case 153: goto L153;
+        case 154: goto L154;
+        case 155: goto L155;
+        case 167: goto L167;
+        case 171: goto L171;
+        case 174: goto L174;
+        case 176: goto L176;
+        case 180: goto L180;
+        case 184: goto L184;
+        case 185: goto L185;
+        case 186: goto L186;
+        case 187: goto L187;
+        case 201: goto L201;
+        case 203: goto L203;
+        case 207: goto L207;
+        case 210: goto L210;
+        case 212: goto L212;
+        case 216: goto L216;
+        case 219: goto L219;
+        case 220: goto L220;
+        case 224: goto L224;
+        case 226: goto L226;
+        case 229: goto L229;
+        case 230: goto L230;
+        case 231: goto L231;
+        case 232: goto L232;
+        case 248: goto L248;
+        case 251: goto L251;
+        case 255: goto L255;
+        case 258: goto L258;
+        case 260: goto L260;
+        case 263: goto L263;
+        case 264: goto L264;
+        case 268: goto L268;
+        case 270: goto L270;
+        case 273: goto L273;
+        case 274: goto L274;
+        case 278: goto L278;
+        case 280: goto L280;
+        case 283: goto L283;
+        case 284: goto L284;
+        case 285: goto L285;
+        case 286: goto L286;
+        case 287: goto L287;
+        case 288: goto L288;
+        case 293: goto L293;
+        case 294: goto L294;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 730;
+L9: /* VAR */
+L11: /* VAR */
+L13: /* STRING */
+    tp_aot_op(tp, f, code + 13);
+L22: /* FILE */
+    f->fname = regs[1];
+L23: /* STRING */
+    tp_aot_op(tp, f, code + 23);
+L27: /* NAME */
+    f->name = regs[1];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 731;
+L37: /* VAR */
+L40: /* STRING */
+    tp_aot_op(tp, f, code + 40);
+L44: /* GGET */
+    tp_aot_op(tp, f, code + 44);
+L48: /* CALLP */
+    return code + 48;
+L49: /* ADD */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 49);
+    }
+L50: /* LINE */
+    f->line = code + 50;
+    f->lineno = 732;
+L62: /* GGET */
+    tp_aot_op(tp, f, code + 62);
+L67: /* GGET */
+    tp_aot_op(tp, f, code + 67);
+L71: /* STRING */
+    tp_aot_op(tp, f, code + 71);
+L74: /* MGET */
+    tp_aot_op(tp, f, code + 74);
+L76: /* STRING */
+    tp_aot_op(tp, f, code + 76);
+L80: /* MOVE */
+    regs[7] = regs[1];
+L81: /* CALLP */
+    return code + 81;
+L82: /* CALLP */
+    return code + 82;
+L83: /* LINE */
+    f->line = code + 83;
+    f->lineno = 733;
+L90: /* GGET */
+    tp_aot_op(tp, f, code + 90);
+L94: /* GGET */
+    tp_aot_op(tp, f, code + 94);
+L98: /* MOVE */
+    regs[4] = regs[14];
+L99: /* NUMBER */
+    tp_aot_op(tp, f, code + 99);
+L102: /* NUMBER */
+    tp_aot_op(tp, f, code + 102);
+L105: /* CALLP */
+    return code + 105;
+L106: /* LINE */
+    f->line = code + 106;
+    f->lineno = 734;
+L116: /* VAR */
+L118: /* GGET */
+    tp_aot_op(tp, f, code + 118);
+L122: /* STRING */
+    tp_aot_op(tp, f, code + 122);
+L125: /* MGET */
+    tp_aot_op(tp, f, code + 125);
+L127: /* STRING */
+    tp_aot_op(tp, f, code + 127);
+L130: /* NONE */
+    regs[6] = tp_None;
+L131: /* LINE */
+    f->line = code + 131;
+    f->lineno = 735;
+L141: /* GGET */
+    tp_aot_op(tp, f, code + 141);
+L145: /* STRING */
+    tp_aot_op(tp, f, code + 145);
+L148: /* MGET */
+    tp_aot_op(tp, f, code + 148);
+L150: /* STRING */
+    tp_aot_op(tp, f, code + 150);
+L153: /* MOVE */
+    regs[13] = regs[14];
+L154: /* CALLP */
+    return code + 154;
+L155: /* LINE */
+    f->line = code + 155;
+    f->lineno = 736;
+L167: /* GGET */
+    tp_aot_op(tp, f, code + 167);
+L171: /* STRING */
+    tp_aot_op(tp, f, code + 171);
+L174: /* MGET */
+    tp_aot_op(tp, f, code + 174);
+L176: /* STRING */
+    tp_aot_op(tp, f, code + 176);
+L180: /* STRING */
+    tp_aot_op(tp, f, code + 180);
+L184: /* CALLP */
+    return code + 184;
+L185: /* LIST */
+    tp_aot_op(tp, f, code + 185);
+L186: /* CALLP */
+    return code + 186;
+L187: /* LINE */
+    f->line = code + 187;
+    f->lineno = 737;
+L201: /* VAR */
+L203: /* GGET */
+    tp_aot_op(tp, f, code + 203);
+L207: /* STRING */
+    tp_aot_op(tp, f, code + 207);
+L210: /* MGET */
+    tp_aot_op(tp, f, code + 210);
+L212: /* STRING */
+    tp_aot_op(tp, f, code + 212);
+L216: /* STRING */
+    tp_aot_op(tp, f, code + 216);
+L219: /* MOVE */
+    regs[9] = regs[1];
+L220: /* STRING */
+    tp_aot_op(tp, f, code + 220);
+L224: /* MGET */
+    tp_aot_op(tp, f, code + 224);
+L226: /* NUMBER */
+    tp_aot_op(tp, f, code + 226);
+L229: /* GET */
+    regs[10] = tp_get(tp, regs[10], regs[11]);
+    tp_grey(tp, regs[10]);
+L230: /* LIST */
+    tp_aot_op(tp, f, code + 230);
+L231: /* CALLP */
+    return code + 231;
+L232: /* LINE */
+    f->line = code + 232;
+    f->lineno = 738;
+L248: /* GGET */
+    tp_aot_op(tp, f, code + 248);
+L251: /* GGET */
+    tp_aot_op(tp, f, code + 251);
+L255: /* STRING */
+    tp_aot_op(tp, f, code + 255);
+L258: /* MGET */
+    tp_aot_op(tp, f, code + 258);
+L260: /* STRING */
+    tp_aot_op(tp, f, code + 260);
+L263: /* NONE */
+    regs[9] = tp_None;
+L264: /* STRING */
+    tp_aot_op(tp, f, code + 264);
+L268: /* MGET */
+    tp_aot_op(tp, f, code + 268);
+L270: /* NUMBER */
+    tp_aot_op(tp, f, code + 270);
+L273: /* GET */
+    regs[11] = tp_get(tp, regs[11], regs[1]);
+    tp_grey(tp, regs[11]);
+L274: /* STRING */
+    tp_aot_op(tp, f, code + 274);
+L278: /* MGET */
+    tp_aot_op(tp, f, code + 278);
+L280: /* NUMBER */
+    tp_aot_op(tp, f, code + 280);
+L283: /* GET */
+    regs[12] = tp_get(tp, regs[12], regs[1]);
+    tp_grey(tp, regs[12]);
+L284: /* MOVE */
+    regs[13] = regs[2];
+L285: /* LIST */
+    tp_aot_op(tp, f, code + 285);
+L286: /* CALLP */
+    return code + 286;
+L287: /* CALLP */
+    return code + 287;
+L288: /* LINE */
+    f->line = code + 288;
+    f->lineno = 739;
+L293: /* RETURN */
+    return code + 293;
+L294: /* EOF */
+    return code + 294;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_16041(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 30: goto L30;
+        case 33: goto L33;
+        case 37: goto L37;
+        case 39: goto L39;
+        case 45: goto L45;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 54: goto L54;
+        case 56: goto L56;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 67: goto L67;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 72: goto L72;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 81: goto L81;
+        case 84: goto L84;
+        case 85: goto L85;
+        case 86: goto L86;
+        case 87: goto L87;
+        case 96: goto L96;
+        case 100: goto L100;
+        case 102: goto L102;
+        case 106: goto L106;
+        case 107: goto L107;
+        case 108: goto L108;
+        case 109: goto L109;
+        case 125: goto L125;
+        case 127: goto L127;
+        case 130: goto L130;
+        case 134: goto L134;
+        case 136: goto L136;
+        case 139: goto L139;
+        case 140: goto L140;
+        case 141: goto L141;
+        case 145: goto L145;
+        case 148: goto L148;
+        case 149: goto L149;
+        case 150: goto L150;
+        case 155: goto L155;
+        case 156: goto L156;
+        case 157: goto L157;
+        case 164: goto L164;
+        case 168: goto L168;
+        case 169: goto L169;
+        case 172: goto L172;
+        case 173: goto L173;
+        case 174: goto L174;
+        case 186: goto L186;
+        case 191: goto L191;
+        case 194: goto L194;
+        case 198: goto L198;
+        case 200: goto L200;
+        case 203: goto L203;
+        case 204: goto L204;
+        case 205: goto L205;
+        case 206: goto L206;
+        case 207: goto L207;
+        case 216: goto L216;
+        case 220: goto L220;
+        case 222: goto L222;
+        case 226: goto L226;
+        case 227: goto L227;
+        case 228: goto L228;
+        case 229: goto L229;
+        case 241: goto L241;
+        case 246: goto L246;
+        case 249: goto L249;
+        case 253: goto L253;
+        case 255: goto L255;
+        case 258: goto L258;
+        case 259: goto L259;
+        case 260: goto L260;
+        case 261: goto L261;
+        case 262: goto L262;
+        case 268: goto L268;
+        case 269: goto L269;
+        case 270: goto L270;
+        case 277: goto L277;
+        case 281: goto L281;
+        case 282: goto L282;
+        case 285: goto L285;
+        case 286: goto L286;
+        case 291: goto L291;
+        case 294: goto L294;
+        case 295: goto L295;
+        case 296: goto L296;
+        case 301: goto L301;
+        case 304: goto L304;
+        case 305: goto L305;
+        case 306: goto L306;
+        case 307: goto L307;
+        case 313: goto L313;
+        case 316: goto L316;
+        case 317: goto L317;
+        case 320: goto L320;
+        case 321: goto L321;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 741;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 742;
+L30: /* VAR */
+L33: /* STRING */
+    tp_aot_op(tp, f, code + 33);
+L37: /* MGET */
+    tp_aot_op(tp, f, code + 37);
+L39: /* LINE */
+    f->line = code + 39;
+    f->lineno = 743;
+L45: /* GGET */
+    tp_aot_op(tp, f, code + 45);
+L49: /* CALLP */
+    return code + 49;
+L50: /* LINE */
+    f->line = code + 50;
+    f->lineno = 744;
+L54: /* VAR */
+L56: /* NUMBER */
+    tp_aot_op(tp, f, code + 56);
+L59: /* MOVE */
+    regs[3] = regs[2];
+L60: /* LINE */
+    f->line = code + 60;
+    f->lineno = 745;
+L67: /* NUMBER */
+    tp_aot_op(tp, f, code + 67);
+L70: /* ITER */
+    if (tp_iter_next(tp, &regs[2], regs[1], &regs[4])) {
+        goto L72;
+    }
+L71: /* JUMP */
+    goto L296;
+L72: /* VAR */
+L74: /* MOVE */
+    regs[5] = regs[2];
+L75: /* LINE */
+    f->line = code + 75;
+    f->lineno = 746;
+L81: /* GGET */
+    tp_aot_op(tp, f, code + 81);
+L84: /* MOVE */
+    regs[7] = regs[0];
+L85: /* MOVE */
+    regs[8] = regs[3];
+L86: /* CALLP */
+    return code + 86;
+L87: /* LINE */
+    f->line = code + 87;
+    f->lineno = 747;
+L96: /* STRING */
+    tp_aot_op(tp, f, code + 96);
+L100: /* MGET */
+    tp_aot_op(tp, f, code + 100);
+L102: /* STRING */
+    tp_aot_op(tp, f, code + 102);
+L106: /* EQ */
+    if (TP_BOTH(regs[2], regs[6], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint == regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 106);
+    }
+L107: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L109;
+    }
+L108: /* JUMP */
+    goto L207;
+L109: /* LINE */
+    f->line = code + 109;
+    f->lineno = 748;
+L125: /* VAR */
+L127: /* GGET */
+    tp_aot_op(tp, f, code + 127);
+L130: /* STRING */
+    tp_aot_op(tp, f, code + 130);
+L134: /* MGET */
+    tp_aot_op(tp, f, code + 134);
+L136: /* NUMBER */
+    tp_aot_op(tp, f, code + 136);
+L139: /* GET */
+    regs[8] = tp_get(tp, regs[8], regs[9]);
+    tp_grey(tp, regs[8]);
+L140: /* CALLP */
+    return code + 140;
+L141: /* GGET */
+    tp_aot_op(tp, f, code + 141);
+L145: /* GGET */
+    tp_aot_op(tp, f, code + 145);
+L148: /* MOVE */
+    regs[9] = regs[2];
+L149: /* CALLP */
+    return code + 149;
+L150: /* GGET */
+    tp_aot_op(tp, f, code + 150);
+L155: /* MOVE */
+    regs[8] = regs[2];
+L156: /* CALLP */
+    return code + 156;
+L157: /* LINE */
+    f->line = code + 157;
+    f->lineno = 749;
+L164: /* GGET */
+    tp_aot_op(tp, f, code + 164);
+L168: /* MOVE */
+    regs[8] = regs[0];
+L169: /* NUMBER */
+    tp_aot_op(tp, f, code + 169);
+L172: /* ADD */
+    if (TP_BOTH(regs[3], regs[10], TP_NUMBER_INT)) {
+        regs[9] = tp_int(regs[3].nint + regs[10].nint);
+    } else {
+        tp_aot_op(tp, f, code + 172);
+    }
+L173: /* CALLP */
+    return code + 173;
+L174: /* LINE */
+    f->line = code + 174;
+    f->lineno = 750;
+L186: /* GGET */
+    tp_aot_op(tp, f, code + 186);
+L191: /* GGET */
+    tp_aot_op(tp, f, code + 191);
+L194: /* STRING */
+    tp_aot_op(tp, f, code + 194);
+L198: /* MGET */
+    tp_aot_op(tp, f, code + 198);
+L200: /* NUMBER */
+    tp_aot_op(tp, f, code + 200);
+L203: /* GET */
+    regs[10] = tp_get(tp, regs[10], regs[6]);
+    tp_grey(tp, regs[10]);
+L204: /* CALLP */
+    return code + 204;
+L205: /* CALLP */
+    return code + 205;
+L206: /* JUMP */
+    goto L270;
+L207: /* LINE */
+    f->line = code + 207;
+    f->lineno = 751;
+L216: /* STRING */
+    tp_aot_op(tp, f, code + 216);
+L220: /* MGET */
+    tp_aot_op(tp, f, code + 220);
+L222: /* STRING */
+    tp_aot_op(tp, f, code + 222);
+L226: /* EQ */
+    if (TP_BOTH(regs[6], regs[7], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[6].nint == regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 226);
+    }
+L227: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L229;
+    }
+L228: /* JUMP */
+    goto L262;
+L229: /* LINE */
+    f->line = code + 229;
+    f->lineno = 752;
+L241: /* GGET */
+    tp_aot_op(tp, f, code + 241);
+L246: /* GGET */
+    tp_aot_op(tp, f, code + 246);
+L249: /* STRING */
+    tp_aot_op(tp, f, code + 249);
+L253: /* MGET */
+    tp_aot_op(tp, f, code + 253);
+L255: /* NUMBER */
+    tp_aot_op(tp, f, code + 255);
+L258: /* GET */
+    regs[10] = tp_get(tp, regs[10], regs[6]);
+    tp_grey(tp, regs[10]);
+L259: /* CALLP */
+    return code + 259;
+L260: /* CALLP */
+    return code + 260;
+L261: /* JUMP */
+    goto L270;
+L262: /* LINE */
+    f->line = code + 262;
+    f->lineno = 754;
+L268: /* NONE */
+    regs[6] = tp_None;
+L269: /* RAISE */
+    return code + 269;
+L270: /* LINE */
+    f->line = code + 270;
+    f->lineno = 755;
+L277: /* GGET */
+    tp_aot_op(tp, f, code + 277);
+L281: /* MOVE */
+    regs[8] = regs[0];
+L282: /* STRING */
+    tp_aot_op(tp, f, code + 282);
+L285: /* CALLP */
+    return code + 285;
+L286: /* LINE */
+    f->line = code + 286;
+    f->lineno = 756;
+L291: /* NUMBER */
+    tp_aot_op(tp, f, code + 291);
+L294: /* ADD */
+    if (TP_BOTH(regs[3], regs[7], TP_NUMBER_INT)) {
+        regs[3] = tp_int(regs[3].nint + regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 294);
+    }
+L295: /* JUMP */
+    tp_aot_safepoint(tp, 225);
+    goto L70;
+L296: /* LINE */
+    f->line = code + 296;
+    f->lineno = 757;
+L301: /* GGET */
+    tp_aot_op(tp, f, code + 301);
+L304: /* MOVE */
+    regs[7] = regs[0];
+L305: /* MOVE */
+    regs[8] = regs[3];
+L306: /* CALLP */
+    return code + 306;
+L307: /* LINE */
+    f->line = code + 307;
+    f->lineno = 758;
+L313: /* GGET */
+    tp_aot_op(tp, f, code + 313);
+L316: /* MOVE */
+    regs[7] = regs[0];
+L317: /* STRING */
+    tp_aot_op(tp, f, code + 317);
+L320: /* CALLP */
+    return code + 320;
+L321: /* EOF */
+    return code + 321;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_16384(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 30: goto L30;
+        case 33: goto L33;
+        case 37: goto L37;
+        case 39: goto L39;
+        case 45: goto L45;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 57: goto L57;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 66: goto L66;
+        case 67: goto L67;
+        case 76: goto L76;
+        case 81: goto L81;
+        case 84: goto L84;
+        case 87: goto L87;
+        case 88: goto L88;
+        case 89: goto L89;
+        case 90: goto L90;
+        case 96: goto L96;
+        case 100: goto L100;
+        case 104: goto L104;
+        case 107: goto L107;
+        case 108: goto L108;
+        case 114: goto L114;
+        case 118: goto L118;
+        case 119: goto L119;
+        case 122: goto L122;
+        case 123: goto L123;
+        case 129: goto L129;
+        case 132: goto L132;
+        case 133: goto L133;
+        case 137: goto L137;
+        case 138: goto L138;
+        case 150: goto L150;
+        case 155: goto L155;
+        case 158: goto L158;
+        case 161: goto L161;
+        case 162: goto L162;
+        case 166: goto L166;
+        case 168: goto L168;
+        case 171: goto L171;
+        case 172: goto L172;
+        case 173: goto L173;
+        case 174: goto L174;
+        case 180: goto L180;
+        case 183: goto L183;
+        case 184: goto L184;
+        case 187: goto L187;
+        case 188: goto L188;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 760;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 761;
+L30: /* VAR */
+L33: /* STRING */
+    tp_aot_op(tp, f, code + 33);
+L37: /* MGET */
+    tp_aot_op(tp, f, code + 37);
+L39: /* LINE */
+    f->line = code + 39;
+    f->lineno = 762;
+L45: /* GGET */
+    tp_aot_op(tp, f, code + 45);
+L49: /* CALLP */
+    return code + 49;
+L50: /* LINE */
+    f->line = code + 50;
+    f->lineno = 763;
+L57: /* GGET */
+    tp_aot_op(tp, f, code + 57);
+L61: /* MOVE */
+    regs[3] = regs[0];
+L62: /* STRING */
+    tp_aot_op(tp, f, code + 62);
+L66: /* CALLP */
+    return code + 66;
+L67: /* LINE */
+    f->line = code + 67;
+    f->lineno = 764;
+L76: /* GGET */
+    tp_aot_op(tp, f, code + 76);
+L81: /* GGET */
+    tp_aot_op(tp, f, code + 81);
+L84: /* NUMBER */
+    tp_aot_op(tp, f, code + 84);
+L87: /* GET */
+    regs[5] = tp_get(tp, regs[1], regs[3]);
+    tp_grey(tp, regs[5]);
+L88: /* CALLP */
+    return code + 88;
+L89: /* CALLP */
+    return code + 89;
+L90: /* LINE */
+    f->line = code + 90;
+    f->lineno = 765;
+L96: /* GGET */
+    tp_aot_op(tp, f, code + 96);
+L100: /* GGET */
+    tp_aot_op(tp, f, code + 100);
+L104: /* NUMBER */
+    tp_aot_op(tp, f, code + 104);
+L107: /* CALLP */
+    return code + 107;
+L108: /* LINE */
+    f->line = code + 108;
+    f->lineno = 766;
+L114: /* GGET */
+    tp_aot_op(tp, f, code + 114);
+L118: /* MOVE */
+    regs[3] = regs[0];
+L119: /* STRING */
+    tp_aot_op(tp, f, code + 119);
+L122: /* CALLP */
+    return code + 122;
+L123: /* LINE */
+    f->line = code + 123;
+    f->lineno = 767;
+L129: /* GGET */
+    tp_aot_op(tp, f, code + 129);
+L132: /* MOVE */
+    regs[3] = regs[0];
+L133: /* STRING */
+    tp_aot_op(tp, f, code + 133);
+L137: /* CALLP */
+    return code + 137;
+L138: /* LINE */
+    f->line = code + 138;
+    f->lineno = 768;
+L150: /* GGET */
+    tp_aot_op(tp, f, code + 150);
+L155: /* GGET */
+    tp_aot_op(tp, f, code + 155);
+L158: /* NUMBER */
+    tp_aot_op(tp, f, code + 158);
+L161: /* GET */
+    regs[5] = tp_get(tp, regs[1], regs[3]);
+    tp_grey(tp, regs[5]);
+L162: /* STRING */
+    tp_aot_op(tp, f, code + 162);
+L166: /* MGET */
+    tp_aot_op(tp, f, code + 166);
+L168: /* NUMBER */
+    tp_aot_op(tp, f, code + 168);
+L171: /* GET */
+    regs[5] = tp_get(tp, regs[5], regs[3]);
+    tp_grey(tp, regs[5]);
+L172: /* CALLP */
+    return code + 172;
+L173: /* CALLP */
+    return code + 173;
+L174: /* LINE */
+    f->line = code + 174;
+    f->lineno = 769;
+L180: /* GGET */
+    tp_aot_op(tp, f, code + 180);
+L183: /* MOVE */
+    regs[3] = regs[0];
+L184: /* STRING */
+    tp_aot_op(tp, f, code + 184);
+L187: /* CALLP */
+    return code + 187;
+L188: /* EOF */
+    return code + 188;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_16595(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 36: goto L36;
+        case 40: goto L40;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 46: goto L46;
+        case 49: goto L49;
+        case 53: goto L53;
+        case 55: goto L55;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 61: goto L61;
+        case 69: goto L69;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 81: goto L81;
+        case 85: goto L85;
+        case 89: goto L89;
+        case 90: goto L90;
+        case 91: goto L91;
+        case 96: goto L96;
+        case 101: goto L101;
+        case 102: goto L102;
+        case 103: goto L103;
+        case 107: goto L107;
+        case 108: goto L108;
+        case 109: goto L109;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 771;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 772;
+L36: /* STRING */
+    tp_aot_op(tp, f, code + 36);
+L40: /* MGET */
+    tp_aot_op(tp, f, code + 40);
+L42: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L44;
+    }
+L43: /* JUMP */
+    goto L61;
+L44: /* VAR */
+L46: /* GGET */
+    tp_aot_op(tp, f, code + 46);
+L49: /* STRING */
+    tp_aot_op(tp, f, code + 49);
+L53: /* MGET */
+    tp_aot_op(tp, f, code + 53);
+L55: /* NUMBER */
+    tp_aot_op(tp, f, code + 55);
+L58: /* GET */
+    regs[3] = tp_get(tp, regs[3], regs[4]);
+    tp_grey(tp, regs[3]);
+L59: /* CALLP */
+    return code + 59;
+L60: /* JUMP */
+    goto L75;
+L61: /* LINE */
+    f->line = code + 61;
+    f->lineno = 773;
+L69: /* GGET */
+    tp_aot_op(tp, f, code + 69);
+L74: /* CALLP */
+    return code + 74;
+L75: /* LINE */
+    f->line = code + 75;
+    f->lineno = 774;
+L81: /* GGET */
+    tp_aot_op(tp, f, code + 81);
+L85: /* GGET */
+    tp_aot_op(tp, f, code + 85);
+L89: /* MOVE */
+    regs[4] = regs[1];
+L90: /* CALLP */
+    return code + 90;
+L91: /* LINE */
+    f->line = code + 91;
+    f->lineno = 775;
+L96: /* GGET */
+    tp_aot_op(tp, f, code + 96);
+L101: /* MOVE */
+    regs[3] = regs[1];
+L102: /* CALLP */
+    return code + 102;
+L103: /* LINE */
+    f->line = code + 103;
+    f->lineno = 776;
+L107: /* NONE */
+    regs[2] = tp_None;
+L108: /* RETURN */
+    return code + 108;
+L109: /* EOF */
+    return code + 109;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_16728(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 45: goto L45;
+        case 48: goto L48;
+        case 51: goto L51;
+        case 54: goto L54;
+        case 57: goto L57;
+        case 60: goto L60;
+        case 63: goto L63;
+        case 66: goto L66;
+        case 69: goto L69;
+        case 72: goto L72;
+        case 76: goto L76;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 86: goto L86;
+        case 90: goto L90;
+        case 92: goto L92;
+        case 93: goto L93;
+        case 94: goto L94;
+        case 101: goto L101;
+        case 103: goto L103;
+        case 107: goto L107;
+        case 109: goto L109;
+        case 112: goto L112;
+        case 113: goto L113;
+        case 127: goto L127;
+        case 131: goto L131;
+        case 133: goto L133;
+        case 137: goto L137;
+        case 138: goto L138;
+        case 139: goto L139;
+        case 140: goto L140;
+        case 143: goto L143;
+        case 145: goto L145;
+        case 146: goto L146;
+        case 147: goto L147;
+        case 148: goto L148;
+        case 159: goto L159;
+        case 163: goto L163;
+        case 166: goto L166;
+        case 167: goto L167;
+        case 170: goto L170;
+        case 172: goto L172;
+        case 175: goto L175;
+        case 176: goto L176;
+        case 178: goto L178;
+        case 181: goto L181;
+        case 182: goto L182;
+        case 184: goto L184;
+        case 187: goto L187;
+        case 188: goto L188;
+        case 189: goto L189;
+        case 194: goto L194;
+        case 201: goto L201;
+        case 204: goto L204;
+        case 205: goto L205;
+        case 206: goto L206;
+        case 214: goto L214;
+        case 219: goto L219;
+        case 220: goto L220;
+        case 228: goto L228;
+        case 233: goto L233;
+        case 234: goto L234;
+        case 235: goto L235;
+        case 239: goto L239;
+        case 246: goto L246;
+        case 251: goto L251;
+        case 252: goto L252;
+        case 259: goto L259;
+        case 264: goto L264;
+        case 265: goto L265;
+        case 272: goto L272;
+        case 277: goto L277;
+        case 278: goto L278;
+        case 285: goto L285;
+        case 289: goto L289;
+        case 293: goto L293;
+        case 294: goto L294;
+        case 295: goto L295;
+        case 296: goto L296;
+        case 297: goto L297;
+        case 302: goto L302;
+        case 307: goto L307;
+        case 308: goto L308;
+        case 309: goto L309;
+        case 314: goto L314;
+        case 319: goto L319;
+        case 320: goto L320;
+        case 321: goto L321;
+        case 326: goto L326;
+        case 331: goto L331;
+        case 332: goto L332;
+        case 333: goto L333;
+        case 337: goto L337;
+        case 338: goto L338;
+        case 339: goto L339;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 778;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 779;
+L45: /* VAR */
+L48: /* STRING */
+    tp_aot_op(tp, f, code + 48);
+L51: /* STRING */
+    tp_aot_op(tp, f, code + 51);
+L54: /* STRING */
+    tp_aot_op(tp, f, code + 54);
+L57: /* STRING */
+    tp_aot_op(tp, f, code + 57);
+L60: /* STRING */
+    tp_aot_op(tp, f, code + 60);
+L63: /* STRING */
+    tp_aot_op(tp, f, code + 63);
+L66: /* STRING */
+    tp_aot_op(tp, f, code + 66);
+L69: /* STRING */
+    tp_aot_op(tp, f, code + 69);
+L72: /* STRING */
+    tp_aot_op(tp, f, code + 72);
+L76: /* STRING */
+    tp_aot_op(tp, f, code + 76);
+L80: /* LIST */
+    tp_aot_op(tp, f, code + 80);
+L81: /* LINE */
+    f->line = code + 81;
+    f->lineno = 780;
+L86: /* STRING */
+    tp_aot_op(tp, f, code + 86);
+L90: /* MGET */
+    tp_aot_op(tp, f, code + 90);
+L92: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L94;
+    }
+L93: /* JUMP */
+    goto L235;
+L94: /* LINE */
+    f->line = code + 94;
+    f->lineno = 781;
+L101: /* VAR */
+L103: /* STRING */
+    tp_aot_op(tp, f, code + 103);
+L107: /* MGET */
+    tp_aot_op(tp, f, code + 107);
+L109: /* NUMBER */
+    tp_aot_op(tp, f, code + 109);
+L112: /* GET */
+    regs[4] = tp_get(tp, regs[2], regs[3]);
+    tp_grey(tp, regs[4]);
+L113: /* LINE */
+    f->line = code + 113;
+    f->lineno = 782;
+L127: /* STRING */
+    tp_aot_op(tp, f, code + 127);
+L131: /* MGET */
+    tp_aot_op(tp, f, code + 131);
+L133: /* STRING */
+    tp_aot_op(tp, f, code + 133);
+L137: /* EQ */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint == regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 137);
+    }
+L138: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L140;
+    }
+L139: /* JUMP */
+    goto L146;
+L140: /* STRING */
+    tp_aot_op(tp, f, code + 140);
+L143: /* MGET */
+    tp_aot_op(tp, f, code + 143);
+L145: /* IN */
+    regs[2] = tp_has(tp, regs[1], regs[2]);
+L146: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L148;
+    }
+L147: /* JUMP */
+    goto L189;
+L148: /* LINE */
+    f->line = code + 148;
+    f->lineno = 783;
+L159: /* GGET */
+    tp_aot_op(tp, f, code + 159);
+L163: /* NUMBER */
+    tp_aot_op(tp, f, code + 163);
+L166: /* CALLP */
+    return code + 166;
+L167: /* VAR */
+L170: /* VAR */
+L172: /* NUMBER */
+    tp_aot_op(tp, f, code + 172);
+L175: /* GET */
+    regs[3] = tp_get(tp, regs[2], regs[5]);
+    tp_grey(tp, regs[3]);
+L176: /* VAR */
+L178: /* NUMBER */
+    tp_aot_op(tp, f, code + 178);
+L181: /* GET */
+    regs[4] = tp_get(tp, regs[2], regs[6]);
+    tp_grey(tp, regs[4]);
+L182: /* VAR */
+L184: /* NUMBER */
+    tp_aot_op(tp, f, code + 184);
+L187: /* GET */
+    regs[5] = tp_get(tp, regs[2], regs[7]);
+    tp_grey(tp, regs[5]);
+L188: /* JUMP */
+    goto L278;
+L189: /* LINE */
+    f->line = code + 189;
+    f->lineno = 784;
+L194: /* LINE */
+    f->line = code + 194;
+    f->lineno = 785;
+L201: /* GGET */
+    tp_aot_op(tp, f, code + 201);
+L204: /* MOVE */
+    regs[7] = regs[4];
+L205: /* CALLP */
+    return code + 205;
+L206: /* LINE */
+    f->line = code + 206;
+    f->lineno = 786;
+L214: /* GGET */
+    tp_aot_op(tp, f, code + 214);
+L219: /* CALLP */
+    return code + 219;
+L220: /* LINE */
+    f->line = code + 220;
+    f->lineno = 787;
+L228: /* GGET */
+    tp_aot_op(tp, f, code + 228);
+L233: /* CALLP */
+    return code + 233;
+L234: /* JUMP */
+    goto L278;
+L235: /* LINE */
+    f->line = code + 235;
+    f->lineno = 788;
+L239: /* LINE */
+    f->line = code + 239;
+    f->lineno = 789;
+L246: /* GGET */
+    tp_aot_op(tp, f, code + 246);
+L251: /* CALLP */
+    return code + 251;
+L252: /* LINE */
+    f->line = code + 252;
+    f->lineno = 790;
+L259: /* GGET */
+    tp_aot_op(tp, f, code + 259);
+L264: /* CALLP */
+    return code + 264;
+L265: /* LINE */
+    f->line = code + 265;
+    f->lineno = 791;
+L272: /* GGET */
+    tp_aot_op(tp, f, code + 272);
+L277: /* CALLP */
+    return code + 277;
+L278: /* LINE */
+    f->line = code + 278;
+    f->lineno = 792;
+L285: /* GGET */
+    tp_aot_op(tp, f, code + 285);
+L289: /* GGET */
+    tp_aot_op(tp, f, code + 289);
+L293: /* MOVE */
+    regs[8] = regs[3];
+L294: /* MOVE */
+    regs[9] = regs[4];
+L295: /* MOVE */
+    regs[10] = regs[5];
+L296: /* CALLP */
+    return code + 296;
+L297: /* LINE */
+    f->line = code + 297;
+    f->lineno = 793;
+L302: /* GGET */
+    tp_aot_op(tp, f, code + 302);
+L307: /* MOVE */
+    regs[7] = regs[3];
+L308: /* CALLP */
+    return code + 308;
+L309: /* LINE */
+    f->line = code + 309;
+    f->lineno = 794;
+L314: /* GGET */
+    tp_aot_op(tp, f, code + 314);
+L319: /* MOVE */
+    regs[7] = regs[4];
+L320: /* CALLP */
+    return code + 320;
+L321: /* LINE */
+    f->line = code + 321;
+    f->lineno = 795;
+L326: /* GGET */
+    tp_aot_op(tp, f, code + 326);
+L331: /* MOVE */
+    regs[7] = regs[5];
+L332: /* CALLP */
+    return code + 332;
+L333: /* LINE */
+    f->line = code + 333;
+    f->lineno = 796;
+L337: /* NONE */
+    regs[2] = tp_None;
+L338: /* RETURN */
+    return code + 338;
+L339: /* EOF */
+    return code + 339;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_17091(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 36: goto L36;
+        case 40: goto L40;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 46: goto L46;
+        case 49: goto L49;
+        case 53: goto L53;
+        case 55: goto L55;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 61: goto L61;
+        case 69: goto L69;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 81: goto L81;
+        case 85: goto L85;
+        case 89: goto L89;
+        case 90: goto L90;
+        case 91: goto L91;
+        case 96: goto L96;
+        case 101: goto L101;
+        case 102: goto L102;
+        case 103: goto L103;
+        case 107: goto L107;
+        case 108: goto L108;
+        case 109: goto L109;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 798;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 799;
+L36: /* STRING */
+    tp_aot_op(tp, f, code + 36);
+L40: /* MGET */
+    tp_aot_op(tp, f, code + 40);
+L42: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L44;
+    }
+L43: /* JUMP */
+    goto L61;
+L44: /* VAR */
+L46: /* GGET */
+    tp_aot_op(tp, f, code + 46);
+L49: /* STRING */
+    tp_aot_op(tp, f, code + 49);
+L53: /* MGET */
+    tp_aot_op(tp, f, code + 53);
+L55: /* NUMBER */
+    tp_aot_op(tp, f, code + 55);
+L58: /* GET */
+    regs[3] = tp_get(tp, regs[3], regs[4]);
+    tp_grey(tp, regs[3]);
+L59: /* CALLP */
+    return code + 59;
+L60: /* JUMP */
+    goto L75;
+L61: /* LINE */
+    f->line = code + 61;
+    f->lineno = 800;
+L69: /* GGET */
+    tp_aot_op(tp, f, code + 69);
+L74: /* CALLP */
+    return code + 74;
+L75: /* LINE */
+    f->line = code + 75;
+    f->lineno = 801;
+L81: /* GGET */
+    tp_aot_op(tp, f, code + 81);
+L85: /* GGET */
+    tp_aot_op(tp, f, code + 85);
+L89: /* MOVE */
+    regs[4] = regs[1];
+L90: /* CALLP */
+    return code + 90;
+L91: /* LINE */
+    f->line = code + 91;
+    f->lineno = 802;
+L96: /* GGET */
+    tp_aot_op(tp, f, code + 96);
+L101: /* MOVE */
+    regs[3] = regs[1];
+L102: /* CALLP */
+    return code + 102;
+L103: /* LINE */
+    f->line = code + 103;
+    f->lineno = 803;
+L107: /* NONE */
+    regs[2] = tp_None;
+L108: /* RETURN */
+    return code + 108;
+L109: /* EOF */
+    return code + 109;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_17225(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 39: goto L39;
+        case 43: goto L43;
+        case 45: goto L45;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 52: goto L52;
+        case 57: goto L57;
+        case 60: goto L60;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 64: goto L64;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 805;
+L9: /* VAR */
+L11: /* STRING */
+    tp_aot_op(tp, f, code + 11);
+L20: /* FILE */
+    f->fname = regs[1];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L27: /* NAME */
+    f->name = regs[1];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 806;
+L39: /* STRING */
+    tp_aot_op(tp, f, code + 39);
+L43: /* MGET */
+    tp_aot_op(tp, f, code + 43);
+L45: /* NUMBER */
+    tp_aot_op(tp, f, code + 45);
+L48: /* ITER */
+    if (tp_iter_next(tp, &regs[1], regs[3], &regs[2])) {
+        goto L50;
+    }
+L49: /* JUMP */
+    goto L64;
+L50: /* VAR */
+L52: /* GGET */
+    tp_aot_op(tp, f, code + 52);
+L57: /* GGET */
+    tp_aot_op(tp, f, code + 57);
+L60: /* MOVE */
+    regs[6] = regs[1];
+L61: /* CALLP */
+    return code + 61;
+L62: /* CALLP */
+    return code + 62;
+L63: /* JUMP */
+    tp_aot_safepoint(tp, 15);
+    goto L48;
+L64: /* EOF */
+    return code + 64;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_17319(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 22: goto L22;
+        case 23: goto L23;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 34: goto L34;
+        case 38: goto L38;
+        case 39: goto L39;
+        case 40: goto L40;
+        case 49: goto L49;
+        case 54: goto L54;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 63: goto L63;
+        case 65: goto L65;
+        case 66: goto L66;
+        case 71: goto L71;
+        case 72: goto L72;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 808;
+L9: /* VAR */
+L11: /* VAR */
+L13: /* STRING */
+    tp_aot_op(tp, f, code + 13);
+L22: /* FILE */
+    f->fname = regs[2];
+L23: /* STRING */
+    tp_aot_op(tp, f, code + 23);
+L27: /* NAME */
+    f->name = regs[2];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 809;
+L34: /* GGET */
+    tp_aot_op(tp, f, code + 34);
+L38: /* MOVE */
+    regs[3] = regs[1];
+L39: /* CALLP */
+    return code + 39;
+L40: /* LINE */
+    f->line = code + 40;
+    f->lineno = 810;
+L49: /* GGET */
+    tp_aot_op(tp, f, code + 49);
+L54: /* GGET */
+    tp_aot_op(tp, f, code + 54);
+L58: /* MOVE */
+    regs[4] = regs[1];
+L59: /* STRING */
+    tp_aot_op(tp, f, code + 59);
+L63: /* MGET */
+    tp_aot_op(tp, f, code + 63);
+L65: /* CALLP */
+    return code + 65;
+L66: /* LINE */
+    f->line = code + 66;
+    f->lineno = 811;
+L71: /* RETURN */
+    return code + 71;
+L72: /* EOF */
+    return code + 72;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_17419(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 22: goto L22;
+        case 23: goto L23;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 34: goto L34;
+        case 38: goto L38;
+        case 39: goto L39;
+        case 40: goto L40;
+        case 49: goto L49;
+        case 54: goto L54;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 63: goto L63;
+        case 65: goto L65;
+        case 66: goto L66;
+        case 71: goto L71;
+        case 72: goto L72;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 813;
+L9: /* VAR */
+L11: /* VAR */
+L13: /* STRING */
+    tp_aot_op(tp, f, code + 13);
+L22: /* FILE */
+    f->fname = regs[2];
+L23: /* STRING */
+    tp_aot_op(tp, f, code + 23);
+L27: /* NAME */
+    f->name = regs[2];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 814;
+L34: /* GGET */
+    tp_aot_op(tp, f, code + 34);
+L38: /* MOVE */
+    regs[3] = regs[1];
+L39: /* CALLP */
+    return code + 39;
+L40: /* LINE */
+    f->line = code + 40;
+    f->lineno = 815;
+L49: /* GGET */
+    tp_aot_op(tp, f, code + 49);
+L54: /* GGET */
+    tp_aot_op(tp, f, code + 54);
+L58: /* MOVE */
+    regs[4] = regs[1];
+L59: /* STRING */
+    tp_aot_op(tp, f, code + 59);
+L63: /* MGET */
+    tp_aot_op(tp, f, code + 63);
+L65: /* CALLP */
+    return code + 65;
+L66: /* LINE */
+    f->line = code + 66;
+    f->lineno = 816;
+L71: /* RETURN */
+    return code + 71;
+L72: /* EOF */
+    return code + 72;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_17519(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 22: goto L22;
+        case 23: goto L23;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 34: goto L34;
+        case 37: goto L37;
+        case 41: goto L41;
+        case 43: goto L43;
+        case 55: goto L55;
+        case 59: goto L59;
+        case 62: goto L62;
+        case 65: goto L65;
+        case 66: goto L66;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 72: goto L72;
+        case 73: goto L73;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 818;
+L9: /* VAR */
+L11: /* VAR */
+L13: /* STRING */
+    tp_aot_op(tp, f, code + 13);
+L22: /* FILE */
+    f->fname = regs[2];
+L23: /* STRING */
+    tp_aot_op(tp, f, code + 23);
+L27: /* NAME */
+    f->name = regs[2];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 819;
+L34: /* VAR */
+L37: /* STRING */
+    tp_aot_op(tp, f, code + 37);
+L41: /* MGET */
+    tp_aot_op(tp, f, code + 41);
+L43: /* LINE */
+    f->line = code + 43;
+    f->lineno = 820;
+L55: /* GGET */
+    tp_aot_op(tp, f, code + 55);
+L59: /* GGET */
+    tp_aot_op(tp, f, code + 59);
+L62: /* NUMBER */
+    tp_aot_op(tp, f, code + 62);
+L65: /* GET */
+    regs[5] = tp_get(tp, regs[2], regs[0]);
+    tp_grey(tp, regs[5]);
+L66: /* NUMBER */
+    tp_aot_op(tp, f, code + 66);
+L69: /* GET */
+    regs[6] = tp_get(tp, regs[2], regs[0]);
+    tp_grey(tp, regs[6]);
+L70: /* MOVE */
+    regs[7] = regs[1];
+L71: /* CALLP */
+    return code + 71;
+L72: /* RETURN */
+    return code + 72;
+L73: /* EOF */
+    return code + 73;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_17612(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 34: goto L34;
+        case 37: goto L37;
+        case 40: goto L40;
+        case 44: goto L44;
+        case 46: goto L46;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 54: goto L54;
+        case 55: goto L55;
+        case 63: goto L63;
+        case 66: goto L66;
+        case 70: goto L70;
+        case 72: goto L72;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 77: goto L77;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 822;
+L8: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[0];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L27: /* NAME */
+    f->name = regs[0];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 824;
+L34: /* GGET */
+    tp_aot_op(tp, f, code + 34);
+L37: /* GGET */
+    tp_aot_op(tp, f, code + 37);
+L40: /* STRING */
+    tp_aot_op(tp, f, code + 40);
+L44: /* MGET */
+    tp_aot_op(tp, f, code + 44);
+L46: /* NUMBER */
+    tp_aot_op(tp, f, code + 46);
+L49: /* ADD */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 49);
+    }
+L50: /* STRING */
+    tp_aot_op(tp, f, code + 50);
+L54: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[1]);
+L55: /* LINE */
+    f->line = code + 55;
+    f->lineno = 825;
+L63: /* GGET */
+    tp_aot_op(tp, f, code + 63);
+L66: /* STRING */
+    tp_aot_op(tp, f, code + 66);
+L70: /* MGET */
+    tp_aot_op(tp, f, code + 70);
+L72: /* NUMBER */
+    tp_aot_op(tp, f, code + 72);
+L75: /* SUB */
+    if (TP_BOTH(regs[0], regs[1], TP_NUMBER_INT)) {
+        regs[0] = tp_int(regs[0].nint - regs[1].nint);
+    } else {
+        tp_aot_op(tp, f, code + 75);
+    }
+L76: /* RETURN */
+    return code + 76;
+L77: /* EOF */
+    return code + 77;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_17718(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 22: goto L22;
+        case 23: goto L23;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 34: goto L34;
+        case 37: goto L37;
+        case 41: goto L41;
+        case 43: goto L43;
+        case 54: goto L54;
+        case 58: goto L58;
+        case 62: goto L62;
+        case 65: goto L65;
+        case 66: goto L66;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 72: goto L72;
+        case 81: goto L81;
+        case 85: goto L85;
+        case 88: goto L88;
+        case 91: goto L91;
+        case 96: goto L96;
+        case 97: goto L97;
+        case 98: goto L98;
+        case 103: goto L103;
+        case 104: goto L104;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 827;
+L9: /* VAR */
+L11: /* VAR */
+L13: /* STRING */
+    tp_aot_op(tp, f, code + 13);
+L22: /* FILE */
+    f->fname = regs[2];
+L23: /* STRING */
+    tp_aot_op(tp, f, code + 23);
+L27: /* NAME */
+    f->name = regs[2];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 828;
+L34: /* VAR */
+L37: /* STRING */
+    tp_aot_op(tp, f, code + 37);
+L41: /* MGET */
+    tp_aot_op(tp, f, code + 41);
+L43: /* LINE */
+    f->line = code + 43;
+    f->lineno = 829;
+L54: /* GGET */
+    tp_aot_op(tp, f, code + 54);
+L58: /* GGET */
+    tp_aot_op(tp, f, code + 58);
+L62: /* NUMBER */
+    tp_aot_op(tp, f, code + 62);
+L65: /* GET */
+    regs[5] = tp_get(tp, regs[2], regs[0]);
+    tp_grey(tp, regs[5]);
+L66: /* NUMBER */
+    tp_aot_op(tp, f, code + 66);
+L69: /* GET */
+    regs[6] = tp_get(tp, regs[2], regs[0]);
+    tp_grey(tp, regs[6]);
+L70: /* MOVE */
+    regs[7] = regs[1];
+L71: /* CALLP */
+    return code + 71;
+L72: /* LINE */
+    f->line = code + 72;
+    f->lineno = 830;
+L81: /* GGET */
+    tp_aot_op(tp, f, code + 81);
+L85: /* NUMBER */
+    tp_aot_op(tp, f, code + 85);
+L88: /* NUMBER */
+    tp_aot_op(tp, f, code + 88);
+L91: /* GGET */
+    tp_aot_op(tp, f, code + 91);
+L96: /* CALLP */
+    return code + 96;
+L97: /* CALLP */
+    return code + 97;
+L98: /* LINE */
+    f->line = code + 98;
+    f->lineno = 831;
+L103: /* RETURN */
+    return code + 103;
+L104: /* EOF */
+    return code + 104;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_17851(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 14: goto L14;
+        case 16: goto L16;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 31: goto L31;
+        case 32: goto L32;
+        case 36: goto L36;
+        case 39: goto L39;
+        case 43: goto L43;
+        case 45: goto L45;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 53: goto L53;
+        case 54: goto L54;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 833;
+L14: /* VAR */
+L16: /* STRING */
+    tp_aot_op(tp, f, code + 16);
+L25: /* FILE */
+    f->fname = regs[1];
+L26: /* STRING */
+    tp_aot_op(tp, f, code + 26);
+L31: /* NAME */
+    f->name = regs[1];
+L32: /* GGET */
+    tp_aot_op(tp, f, code + 32);
+L36: /* GGET */
+    tp_aot_op(tp, f, code + 36);
+L39: /* STRING */
+    tp_aot_op(tp, f, code + 39);
+L43: /* MGET */
+    tp_aot_op(tp, f, code + 43);
+L45: /* NUMBER */
+    tp_aot_op(tp, f, code + 45);
+L48: /* GET */
+    regs[2] = tp_get(tp, regs[2], regs[3]);
+    tp_grey(tp, regs[2]);
+L49: /* STRING */
+    tp_aot_op(tp, f, code + 49);
+L53: /* CALLP */
+    return code + 53;
+L54: /* EOF */
+    return code + 54;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_17937(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 16: goto L16;
+        case 18: goto L18;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 33: goto L33;
+        case 34: goto L34;
+        case 38: goto L38;
+        case 41: goto L41;
+        case 45: goto L45;
+        case 47: goto L47;
+        case 50: goto L50;
+        case 51: goto L51;
+        case 56: goto L56;
+        case 57: goto L57;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 834;
+L16: /* VAR */
+L18: /* STRING */
+    tp_aot_op(tp, f, code + 18);
+L27: /* FILE */
+    f->fname = regs[1];
+L28: /* STRING */
+    tp_aot_op(tp, f, code + 28);
+L33: /* NAME */
+    f->name = regs[1];
+L34: /* GGET */
+    tp_aot_op(tp, f, code + 34);
+L38: /* GGET */
+    tp_aot_op(tp, f, code + 38);
+L41: /* STRING */
+    tp_aot_op(tp, f, code + 41);
+L45: /* MGET */
+    tp_aot_op(tp, f, code + 45);
+L47: /* NUMBER */
+    tp_aot_op(tp, f, code + 47);
+L50: /* GET */
+    regs[2] = tp_get(tp, regs[2], regs[3]);
+    tp_grey(tp, regs[2]);
+L51: /* STRING */
+    tp_aot_op(tp, f, code + 51);
+L56: /* CALLP */
+    return code + 56;
+L57: /* EOF */
+    return code + 57;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_18020(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 10: goto L10;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 26: goto L26;
+        case 27: goto L27;
+        case 31: goto L31;
+        case 35: goto L35;
+        case 36: goto L36;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 835;
+L10: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[1];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L26: /* NAME */
+    f->name = regs[1];
+L27: /* GGET */
+    tp_aot_op(tp, f, code + 27);
+L31: /* GGET */
+    tp_aot_op(tp, f, code + 31);
+L35: /* CALLP */
+    return code + 35;
+L36: /* EOF */
+    return code + 36;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_18084(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 26: goto L26;
+        case 27: goto L27;
+        case 34: goto L34;
+        case 37: goto L37;
+        case 41: goto L41;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 62: goto L62;
+        case 66: goto L66;
+        case 70: goto L70;
+        case 75: goto L75;
+        case 80: goto L80;
+        case 83: goto L83;
+        case 87: goto L87;
+        case 89: goto L89;
+        case 93: goto L93;
+        case 95: goto L95;
+        case 96: goto L96;
+        case 97: goto L97;
+        case 98: goto L98;
+        case 99: goto L99;
+        case 113: goto L113;
+        case 117: goto L117;
+        case 121: goto L121;
+        case 126: goto L126;
+        case 131: goto L131;
+        case 135: goto L135;
+        case 137: goto L137;
+        case 138: goto L138;
+        case 139: goto L139;
+        case 140: goto L140;
+        case 141: goto L141;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 837;
+L9: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[1];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L26: /* NAME */
+    f->name = regs[1];
+L27: /* LINE */
+    f->line = code + 27;
+    f->lineno = 838;
+L34: /* GGET */
+    tp_aot_op(tp, f, code + 34);
+L37: /* STRING */
+    tp_aot_op(tp, f, code + 37);
+L41: /* MGET */
+    tp_aot_op(tp, f, code + 41);
+L43: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L45;
+    }
+L44: /* JUMP */
+    goto L47;
+L45: /* NONE */
+    regs[1] = tp_None;
+L46: /* RETURN */
+    return code + 46;
+L47: /* LINE */
+    f->line = code + 47;
+    f->lineno = 839;
+L62: /* GGET */
+    tp_aot_op(tp, f, code + 62);
+L66: /* GGET */
+    tp_aot_op(tp, f, code + 66);
+L70: /* GGET */
+    tp_aot_op(tp, f, code + 70);
+L75: /* GGET */
+    tp_aot_op(tp, f, code + 75);
+L80: /* GGET */
+    tp_aot_op(tp, f, code + 80);
+L83: /* STRING */
+    tp_aot_op(tp, f, code + 83);
+L87: /* MGET */
+    tp_aot_op(tp, f, code + 87);
+L89: /* STRING */
+    tp_aot_op(tp, f, code + 89);
+L93: /* METHOD */
+    tp_aot_op(tp, f, code + 93);
+L95: /* CALLM */
+    return code + 95;
+L96: /* CALLP */
+    return code + 96;
+L97: /* CALLP */
+    return code + 97;
+L98: /* CALLP */
+    return code + 98;
+L99: /* LINE */
+    f->line = code + 99;
+    f->lineno = 840;
+L113: /* GGET */
+    tp_aot_op(tp, f, code + 113);
+L117: /* GGET */
+    tp_aot_op(tp, f, code + 117);
+L121: /* GGET */
+    tp_aot_op(tp, f, code + 121);
+L126: /* GGET */
+    tp_aot_op(tp, f, code + 126);
+L131: /* STRING */
+    tp_aot_op(tp, f, code + 131);
+L135: /* METHOD */
+    tp_aot_op(tp, f, code + 135);
+L137: /* CALLM */
+    return code + 137;
+L138: /* CALLP */
+    return code + 138;
+L139: /* CALLP */
+    return code + 139;
+L140: /* CALLP */
+    return code + 140;
+L141: /* EOF */
+    return code + 141;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_18248(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 31: goto L31;
+        case 35: goto L35;
+        case 36: goto L36;
+        case 46: goto L46;
+        case 51: goto L51;
+        case 54: goto L54;
+        case 58: goto L58;
+        case 60: goto L60;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 65: goto L65;
+        case 66: goto L66;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 841;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 842;
+L31: /* GGET */
+    tp_aot_op(tp, f, code + 31);
+L35: /* CALLP */
+    return code + 35;
+L36: /* LINE */
+    f->line = code + 36;
+    f->lineno = 843;
+L46: /* GGET */
+    tp_aot_op(tp, f, code + 46);
+L51: /* GGET */
+    tp_aot_op(tp, f, code + 51);
+L54: /* STRING */
+    tp_aot_op(tp, f, code + 54);
+L58: /* MGET */
+    tp_aot_op(tp, f, code + 58);
+L60: /* NUMBER */
+    tp_aot_op(tp, f, code + 60);
+L63: /* GET */
+    regs[3] = tp_get(tp, regs[3], regs[4]);
+    tp_grey(tp, regs[3]);
+L64: /* CALLP */
+    return code + 64;
+L65: /* CALLP */
+    return code + 65;
+L66: /* EOF */
+    return code + 66;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_18346(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 12: goto L12;
+        case 14: goto L14;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 28: goto L28;
+        case 29: goto L29;
+        case 32: goto L32;
+        case 34: goto L34;
+        case 35: goto L35;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 844;
+L12: /* VAR */
+L14: /* STRING */
+    tp_aot_op(tp, f, code + 14);
+L23: /* FILE */
+    f->fname = regs[1];
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L28: /* NAME */
+    f->name = regs[1];
+L29: /* STRING */
+    tp_aot_op(tp, f, code + 29);
+L32: /* MGET */
+    tp_aot_op(tp, f, code + 32);
+L34: /* RETURN */
+    return code + 34;
+L35: /* EOF */
+    return code + 35;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_18854(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 34: goto L34;
+        case 37: goto L37;
+        case 39: goto L39;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 45: goto L45;
+        case 48: goto L48;
+        case 50: goto L50;
+        case 51: goto L51;
+        case 55: goto L55;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 68: goto L68;
+        case 72: goto L72;
+        case 74: goto L74;
+        case 78: goto L78;
+        case 79: goto L79;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 92: goto L92;
+        case 96: goto L96;
+        case 100: goto L100;
+        case 102: goto L102;
+        case 103: goto L103;
+        case 104: goto L104;
+        case 105: goto L105;
+        case 106: goto L106;
+        case 107: goto L107;
+        case 116: goto L116;
+        case 120: goto L120;
+        case 124: goto L124;
+        case 126: goto L126;
+        case 127: goto L127;
+        case 128: goto L128;
+        case 129: goto L129;
+        case 130: goto L130;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 860;
+L8: /* VAR */
+L10: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[2];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L25: /* NAME */
+    f->name = regs[2];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 861;
+L34: /* STRING */
+    tp_aot_op(tp, f, code + 34);
+L37: /* MGET */
+    tp_aot_op(tp, f, code + 37);
+L39: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L41;
+    }
+L40: /* JUMP */
+    goto L51;
+L41: /* GGET */
+    tp_aot_op(tp, f, code + 41);
+L45: /* STRING */
+    tp_aot_op(tp, f, code + 45);
+L48: /* MGET */
+    tp_aot_op(tp, f, code + 48);
+L50: /* CALLP */
+    return code + 50;
+L51: /* LINE */
+    f->line = code + 51;
+    f->lineno = 863;
+L55: /* NUMBER */
+    tp_aot_op(tp, f, code + 55);
+L58: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L60;
+    }
+L59: /* JUMP */
+    goto L130;
+L60: /* LINE */
+    f->line = code + 60;
+    f->lineno = 864;
+L68: /* STRING */
+    tp_aot_op(tp, f, code + 68);
+L72: /* MGET */
+    tp_aot_op(tp, f, code + 72);
+L74: /* GGET */
+    tp_aot_op(tp, f, code + 74);
+L78: /* IN */
+    regs[2] = tp_has(tp, regs[3], regs[2]);
+L79: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L81;
+    }
+L80: /* JUMP */
+    goto L107;
+L81: /* LINE */
+    f->line = code + 81;
+    f->lineno = 865;
+L92: /* GGET */
+    tp_aot_op(tp, f, code + 92);
+L96: /* STRING */
+    tp_aot_op(tp, f, code + 96);
+L100: /* MGET */
+    tp_aot_op(tp, f, code + 100);
+L102: /* GET */
+    regs[3] = tp_get(tp, regs[3], regs[2]);
+    tp_grey(tp, regs[3]);
+L103: /* MOVE */
+    regs[4] = regs[0];
+L104: /* MOVE */
+    regs[5] = regs[1];
+L105: /* CALLP */
+    return code + 105;
+L106: /* RETURN */
+    return code + 106;
+L107: /* LINE */
+    f->line = code + 107;
+    f->lineno = 867;
+L116: /* GGET */
+    tp_aot_op(tp, f, code + 116);
+L120: /* STRING */
+    tp_aot_op(tp, f, code + 120);
+L124: /* MGET */
+    tp_aot_op(tp, f, code + 124);
+L126: /* GET */
+    regs[3] = tp_get(tp, regs[3], regs[5]);
+    tp_grey(tp, regs[3]);
+L127: /* MOVE */
+    regs[4] = regs[0];
+L128: /* CALLP */
+    return code + 128;
+L129: /* RETURN */
+    return code + 129;
+L130: /* EOF */
+    return code + 130;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_19026(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 13: goto L13;
+        case 16: goto L16;
+        case 18: goto L18;
+        case 20: goto L20;
+        case 24: goto L24;
+        case 33: goto L33;
+        case 34: goto L34;
+        case 38: goto L38;
+        case 39: goto L39;
+        case 51: goto L51;
+        case 55: goto L55;
+        case 58: goto L58;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 66: goto L66;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 72: goto L72;
+        case 73: goto L73;
+        case 78: goto L78;
+        case 86: goto L86;
+        case 91: goto L91;
+        case 95: goto L95;
+        case 97: goto L97;
+        case 98: goto L98;
+        case 99: goto L99;
+        case 106: goto L106;
+        case 109: goto L109;
+        case 113: goto L113;
+        case 114: goto L114;
+        case 115: goto L115;
+        case 116: goto L116;
+        case 117: goto L117;
+        case 123: goto L123;
+        case 126: goto L126;
+        case 130: goto L130;
+        case 132: goto L132;
+        case 135: goto L135;
+        case 136: goto L136;
+        case 140: goto L140;
+        case 143: goto L143;
+        case 144: goto L144;
+        case 145: goto L145;
+        case 149: goto L149;
+        case 152: goto L152;
+        case 155: goto L155;
+        case 157: goto L157;
+        case 158: goto L158;
+        case 164: goto L164;
+        case 165: goto L165;
+        case 166: goto L166;
+        case 178: goto L178;
+        case 181: goto L181;
+        case 186: goto L186;
+        case 191: goto L191;
+        case 193: goto L193;
+        case 196: goto L196;
+        case 199: goto L199;
+        case 201: goto L201;
+        case 202: goto L202;
+        case 205: goto L205;
+        case 206: goto L206;
+        case 218: goto L218;
+        case 221: goto L221;
+        case 226: goto L226;
+        case 231: goto L231;
+        case 233: goto L233;
+        case 236: goto L236;
+        case 239: goto L239;
+        case 241: goto L241;
+        case 242: goto L242;
+        case 245: goto L245;
+        case 246: goto L246;
+        case 251: goto L251;
+        case 256: goto L256;
+        case 257: goto L257;
+        case 265: goto L265;
+        case 267: goto L267;
+        case 270: goto L270;
+        case 273: goto L273;
+        case 275: goto L275;
+        case 278: goto L278;
+        case 279: goto L279;
+        case 280: goto L280;
+        case 287: goto L287;
+        case 291: goto L291;
+        case 292: goto L292;
+        case 293: goto L293;
+        case 294: goto L294;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 874;
+L13: /* VAR */
+L16: /* VAR */
+L18: /* VAR */
+L20: /* VAR */
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L33: /* FILE */
+    f->fname = regs[4];
+L34: /* STRING */
+    tp_aot_op(tp, f, code + 34);
+L38: /* NAME */
+    f->name = regs[4];
+L39: /* LINE */
+    f->line = code + 39;
+    f->lineno = 875;
+L51: /* GGET */
+    tp_aot_op(tp, f, code + 51);
+L55: /* NUMBER */
+    tp_aot_op(tp, f, code + 55);
+L58: /* NUMBER */
+    tp_aot_op(tp, f, code + 58);
+L61: /* LIST */
+    tp_aot_op(tp, f, code + 61);
+L62: /* STRING */
+    tp_aot_op(tp, f, code + 62);
+L66: /* STRING */
+    tp_aot_op(tp, f, code + 66);
+L70: /* MOVE */
+    regs[10] = regs[2];
+L71: /* LIST */
+    tp_aot_op(tp, f, code + 71);
+L72: /* CALLP */
+    return code + 72;
+L73: /* LINE */
+    f->line = code + 73;
+    f->lineno = 876;
+L78: /* LINE */
+    f->line = code + 78;
+    f->lineno = 877;
+L86: /* GGET */
+    tp_aot_op(tp, f, code + 86);
+L91: /* STRING */
+    tp_aot_op(tp, f, code + 91);
+L95: /* METHOD */
+    tp_aot_op(tp, f, code + 95);
+L97: /* MOVE */
+    regs[7] = regs[1];
+L98: /* CALLM */
+    return code + 98;
+L99: /* LINE */
+    f->line = code + 99;
+    f->lineno = 878;
+L106: /* STRING */
+    tp_aot_op(tp, f, code + 106);
+L109: /* GGET */
+    tp_aot_op(tp, f, code + 109);
+L113: /* MOVE */
+    regs[7] = regs[1];
+L114: /* MOVE */
+    regs[8] = regs[0];
+L115: /* CALLP */
+    return code + 115;
+L116: /* GSET */
+    tp_set(tp, f->globals, regs[4], regs[5]);
+L117: /* LINE */
+    f->line = code + 117;
+    f->lineno = 879;
+L123: /* GGET */
+    tp_aot_op(tp, f, code + 123);
+L126: /* STRING */
+    tp_aot_op(tp, f, code + 126);
+L130: /* METHOD */
+    tp_aot_op(tp, f, code + 130);
+L132: /* NUMBER */
+    tp_aot_op(tp, f, code + 132);
+L135: /* CALLM */
+    return code + 135;
+L136: /* LINE */
+    f->line = code + 136;
+    f->lineno = 880;
+L140: /* GGET */
+    tp_aot_op(tp, f, code + 140);
+L143: /* MOVE */
+    regs[6] = regs[2];
+L144: /* CALLP */
+    return code + 144;
+L145: /* LINE */
+    f->line = code + 145;
+    f->lineno = 881;
+L149: /* GGET */
+    tp_aot_op(tp, f, code + 149);
+L152: /* STRING */
+    tp_aot_op(tp, f, code + 152);
+L155: /* METHOD */
+    tp_aot_op(tp, f, code + 155);
+L157: /* CALLM */
+    return code + 157;
+L158: /* LINE */
+    f->line = code + 158;
+    f->lineno = 882;
+L164: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L166;
+    }
+L165: /* JUMP */
+    goto L246;
+L166: /* LINE */
+    f->line = code + 166;
+    f->lineno = 883;
+L178: /* GGET */
+    tp_aot_op(tp, f, code + 178);
+L181: /* GGET */
+    tp_aot_op(tp, f, code + 181);
+L186: /* STRING */
+    tp_aot_op(tp, f, code + 186);
+L191: /* METHOD */
+    tp_aot_op(tp, f, code + 191);
+L193: /* GGET */
+    tp_aot_op(tp, f, code + 193);
+L196: /* STRING */
+    tp_aot_op(tp, f, code + 196);
+L199: /* MGET */
+    tp_aot_op(tp, f, code + 199);
+L201: /* CALLM */
+    return code + 201;
+L202: /* STRING */
+    tp_aot_op(tp, f, code + 202);
+L205: /* SET */
+    tp_set(tp, regs[4], regs[6], regs[5]);
+L206: /* LINE */
+    f->line = code + 206;
+    f->lineno = 884;
+L218: /* GGET */
+    tp_aot_op(tp, f, code + 218);
+L221: /* GGET */
+    tp_aot_op(tp, f, code + 221);
+L226: /* STRING */
+    tp_aot_op(tp, f, code + 226);
+L231: /* METHOD */
+    tp_aot_op(tp, f, code + 231);
+L233: /* GGET */
+    tp_aot_op(tp, f, code + 233);
+L236: /* STRING */
+    tp_aot_op(tp, f, code + 236);
+L239: /* MGET */
+    tp_aot_op(tp, f, code + 239);
+L241: /* CALLM */
+    return code + 241;
+L242: /* STRING */
+    tp_aot_op(tp, f, code + 242);
+L245: /* SET */
+    tp_set(tp, regs[4], regs[6], regs[5]);
+L246: /* LINE */
+    f->line = code + 246;
+    f->lineno = 885;
+L251: /* GGET */
+    tp_aot_op(tp, f, code + 251);
+L256: /* CALLP */
+    return code + 256;
+L257: /* LINE */
+    f->line = code + 257;
+    f->lineno = 886;
+L265: /* VAR */
+L267: /* GGET */
+    tp_aot_op(tp, f, code + 267);
+L270: /* STRING */
+    tp_aot_op(tp, f, code + 270);
+L273: /* MGET */
+    tp_aot_op(tp, f, code + 273);
+L275: /* STRING */
+    tp_aot_op(tp, f, code + 275);
+L278: /* NONE */
+    regs[6] = tp_None;
+L279: /* GSET */
+    tp_set(tp, f->globals, regs[5], regs[6]);
+L280: /* LINE */
+    f->line = code + 280;
+    f->lineno = 889;
+L287: /* GGET */
+    tp_aot_op(tp, f, code + 287);
+L291: /* MOVE */
+    regs[7] = regs[4];
+L292: /* CALLP */
+    return code + 292;
+L293: /* RETURN */
+    return code + 293;
+L294: /* EOF */
+    return code + 294;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_291(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 12: goto L12;
+        case 15: goto L15;
+        case 18: goto L18;
+        case 21: goto L21;
+        case 30: goto L30;
+        case 31: goto L31;
+        case 36: goto L36;
+        case 37: goto L37;
+        case 45: goto L45;
+        case 48: goto L48;
+        case 52: goto L52;
+        case 53: goto L53;
+        case 65: goto L65;
+        case 66: goto L66;
+        case 67: goto L67;
+        case 71: goto L71;
+        case 72: goto L72;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 89: goto L89;
+        case 93: goto L93;
+        case 95: goto L95;
+        case 99: goto L99;
+        case 101: goto L101;
+        case 104: goto L104;
+        case 105: goto L105;
+        case 109: goto L109;
+        case 110: goto L110;
+        case 138: goto L138;
+        case 139: goto L139;
+        case 142: goto L142;
+        case 145: goto L145;
+        case 146: goto L146;
+        case 147: goto L147;
+        case 150: goto L150;
+        case 151: goto L151;
+        case 154: goto L154;
+        case 155: goto L155;
+        case 159: goto L159;
+        case 160: goto L160;
+        case 163: goto L163;
+        case 164: goto L164;
+        case 168: goto L168;
+        case 169: goto L169;
+        case 173: goto L173;
+        case 174: goto L174;
+        case 178: goto L178;
+        case 179: goto L179;
+        case 183: goto L183;
+        case 184: goto L184;
+        case 192: goto L192;
+        case 195: goto L195;
+        case 199: goto L199;
+        case 200: goto L200;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 9;
+L12: /* VAR */
+L15: /* VAR */
+L18: /* VAR */
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L30: /* FILE */
+    f->fname = regs[3];
+L31: /* STRING */
+    tp_aot_op(tp, f, code + 31);
+L36: /* NAME */
+    f->name = regs[3];
+L37: /* LINE */
+    f->line = code + 37;
+    f->lineno = 10;
+L45: /* NUMBER */
+    tp_aot_op(tp, f, code + 45);
+L48: /* STRING */
+    tp_aot_op(tp, f, code + 48);
+L52: /* SET */
+    tp_set(tp, regs[0], regs[4], regs[3]);
+L53: /* LINE */
+    f->line = code + 53;
+    f->lineno = 11;
+L65: /* MOVE */
+    regs[3] = regs[1];
+L66: /* MOVE */
+    regs[4] = regs[2];
+L67: /* STRING */
+    tp_aot_op(tp, f, code + 67);
+L71: /* SET */
+    tp_set(tp, regs[0], regs[5], regs[3]);
+L72: /* STRING */
+    tp_aot_op(tp, f, code + 72);
+L76: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[4]);
+L77: /* LINE */
+    f->line = code + 77;
+    f->lineno = 12;
+L89: /* STRING */
+    tp_aot_op(tp, f, code + 89);
+L93: /* MGET */
+    tp_aot_op(tp, f, code + 93);
+L95: /* STRING */
+    tp_aot_op(tp, f, code + 95);
+L99: /* METHOD */
+    tp_aot_op(tp, f, code + 99);
+L101: /* STRING */
+    tp_aot_op(tp, f, code + 101);
+L104: /* CALLM */
+    return code + 104;
+L105: /* STRING */
+    tp_aot_op(tp, f, code + 105);
+L109: /* SET */
+    tp_set(tp, regs[0], regs[4], regs[3]);
+L110: /* LINE */
+    f->line = code + 110;
+    f->lineno = 14;
+L138: /* LIST */
+    tp_aot_op(tp, f, code + 138);
+L139: /* STRING */
+    tp_aot_op(tp, f, code + 139);
+L142: /* STRING */
+    tp_aot_op(tp, f, code + 142);
+L145: /* LIST */
+    tp_aot_op(tp, f, code + 145);
+L146: /* LIST */
+    tp_aot_op(tp, f, code + 146);
+L147: /* NUMBER */
+    tp_aot_op(tp, f, code + 147);
+L150: /* LIST */
+    tp_aot_op(tp, f, code + 150);
+L151: /* NUMBER */
+    tp_aot_op(tp, f, code + 151);
+L154: /* DICT */
+    tp_aot_op(tp, f, code + 154);
+L155: /* STRING */
+    tp_aot_op(tp, f, code + 155);
+L159: /* SET */
+    tp_set(tp, regs[0], regs[7], regs[3]);
+L160: /* STRING */
+    tp_aot_op(tp, f, code + 160);
+L163: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[4]);
+L164: /* STRING */
+    tp_aot_op(tp, f, code + 164);
+L168: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[5]);
+L169: /* STRING */
+    tp_aot_op(tp, f, code + 169);
+L173: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[6]);
+L174: /* STRING */
+    tp_aot_op(tp, f, code + 174);
+L178: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[1]);
+L179: /* STRING */
+    tp_aot_op(tp, f, code + 179);
+L183: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[2]);
+L184: /* LINE */
+    f->line = code + 184;
+    f->lineno = 15;
+L192: /* NUMBER */
+    tp_aot_op(tp, f, code + 192);
+L195: /* STRING */
+    tp_aot_op(tp, f, code + 195);
+L199: /* SET */
+    tp_set(tp, regs[0], regs[4], regs[3]);
+L200: /* EOF */
+    return code + 200;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_523(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 11: goto L11;
+        case 14: goto L14;
+        case 16: goto L16;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 30: goto L30;
+        case 31: goto L31;
+        case 84: goto L84;
+        case 87: goto L87;
+        case 91: goto L91;
+        case 93: goto L93;
+        case 94: goto L94;
+        case 95: goto L95;
+        case 96: goto L96;
+        case 100: goto L100;
+        case 102: goto L102;
+        case 106: goto L106;
+        case 108: goto L108;
+        case 112: goto L112;
+        case 114: goto L114;
+        case 117: goto L117;
+        case 119: goto L119;
+        case 122: goto L122;
+        case 124: goto L124;
+        case 128: goto L128;
+        case 130: goto L130;
+        case 134: goto L134;
+        case 136: goto L136;
+        case 140: goto L140;
+        case 142: goto L142;
+        case 147: goto L147;
+        case 149: goto L149;
+        case 153: goto L153;
+        case 155: goto L155;
+        case 159: goto L159;
+        case 161: goto L161;
+        case 166: goto L166;
+        case 168: goto L168;
+        case 172: goto L172;
+        case 174: goto L174;
+        case 178: goto L178;
+        case 180: goto L180;
+        case 184: goto L184;
+        case 186: goto L186;
+        case 190: goto L190;
+        case 192: goto L192;
+        case 193: goto L193;
+        case 194: goto L194;
+        case 195: goto L195;
+        case 206: goto L206;
+        case 210: goto L210;
+        case 212: goto L212;
+        case 216: goto L216;
+        case 218: goto L218;
+        case 219: goto L219;
+        case 220: goto L220;
+        case 278: goto L278;
+        case 279: goto L279;
+        case 280: goto L280;
+        case 281: goto L281;
+        case 284: goto L284;
+        case 287: goto L287;
+        case 290: goto L290;
+        case 294: goto L294;
+        case 296: goto L296;
+        case 297: goto L297;
+        case 298: goto L298;
+        case 301: goto L301;
+        case 302: goto L302;
+        case 303: goto L303;
+        case 307: goto L307;
+        case 308: goto L308;
+        case 311: goto L311;
+        case 312: goto L312;
+        case 315: goto L315;
+        case 319: goto L319;
+        case 320: goto L320;
+        case 323: goto L323;
+        case 324: goto L324;
+        case 327: goto L327;
+        case 328: goto L328;
+        case 332: goto L332;
+        case 333: goto L333;
+        case 337: goto L337;
+        case 338: goto L338;
+        case 342: goto L342;
+        case 343: goto L343;
+        case 348: goto L348;
+        case 349: goto L349;
+        case 353: goto L353;
+        case 354: goto L354;
+        case 358: goto L358;
+        case 359: goto L359;
+        case 364: goto L364;
+        case 365: goto L365;
+        case 369: goto L369;
+        case 370: goto L370;
+        case 374: goto L374;
+        case 375: goto L375;
+        case 379: goto L379;
+        case 380: goto L380;
+        case 384: goto L384;
+        case 385: goto L385;
+        case 393: goto L393;
+        case 397: goto L397;
+        case 399: goto L399;
+        case 402: goto L402;
+        case 403: goto L403;
+        case 407: goto L407;
+        case 408: goto L408;
+        case 416: goto L416;
+        case 420: goto L420;
+        case 424: goto L424;
+        case 426: goto L426;
+        case 427: goto L427;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 16;
+L11: /* VAR */
+L14: /* VAR */
+L16: /* STRING */
+    tp_aot_op(tp, f, code + 16);
+L25: /* FILE */
+    f->fname = regs[2];
+L26: /* STRING */
+    tp_aot_op(tp, f, code + 26);
+L30: /* NAME */
+    f->name = regs[2];
+L31: /* LINE */
+    f->line = code + 31;
+    f->lineno = 17;
+L84: /* GGET */
+    tp_aot_op(tp, f, code + 84);
+L87: /* STRING */
+    tp_aot_op(tp, f, code + 87);
+L91: /* MGET */
+    tp_aot_op(tp, f, code + 91);
+L93: /* CALLP */
+    return code + 93;
+L94: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L96;
+    }
+L95: /* JUMP */
+    goto L195;
+L96: /* STRING */
+    tp_aot_op(tp, f, code + 96);
+L100: /* MGET */
+    tp_aot_op(tp, f, code + 100);
+L102: /* STRING */
+    tp_aot_op(tp, f, code + 102);
+L106: /* METHOD */
+    tp_aot_op(tp, f, code + 106);
+L108: /* STRING */
+    tp_aot_op(tp, f, code + 108);
+L112: /* MGET */
+    tp_aot_op(tp, f, code + 112);
+L114: /* STRING */
+    tp_aot_op(tp, f, code + 114);
+L117: /* MGET */
+    tp_aot_op(tp, f, code + 117);
+L119: /* STRING */
+    tp_aot_op(tp, f, code + 119);
+L122: /* MGET */
+    tp_aot_op(tp, f, code + 122);
+L124: /* STRING */
+    tp_aot_op(tp, f, code + 124);
+L128: /* MGET */
+    tp_aot_op(tp, f, code + 128);
+L130: /* STRING */
+    tp_aot_op(tp, f, code + 130);
+L134: /* MGET */
+    tp_aot_op(tp, f, code + 134);
+L136: /* STRING */
+    tp_aot_op(tp, f, code + 136);
+L140: /* MGET */
+    tp_aot_op(tp, f, code + 140);
+L142: /* STRING */
+    tp_aot_op(tp, f, code + 142);
+L147: /* MGET */
+    tp_aot_op(tp, f, code + 147);
+L149: /* STRING */
+    tp_aot_op(tp, f, code + 149);
+L153: /* MGET */
+    tp_aot_op(tp, f, code + 153);
+L155: /* STRING */
+    tp_aot_op(tp, f, code + 155);
+L159: /* MGET */
+    tp_aot_op(tp, f, code + 159);
+L161: /* STRING */
+    tp_aot_op(tp, f, code + 161);
+L166: /* MGET */
+    tp_aot_op(tp, f, code + 166);
+L168: /* STRING */
+    tp_aot_op(tp, f, code + 168);
+L172: /* MGET */
+    tp_aot_op(tp, f, code + 172);
+L174: /* STRING */
+    tp_aot_op(tp, f, code + 174);
+L178: /* MGET */
+    tp_aot_op(tp, f, code + 178);
+L180: /* STRING */
+    tp_aot_op(tp, f, code + 180);
+L184: /* MGET */
+    tp_aot_op(tp, f, code + 184);
+L186: /* STRING */
+    tp_aot_op(tp, f, code + 186);
+L190: /* MGET */
+    tp_aot_op(tp, f, code + 190);
+L192: /* LIST */
+    tp_aot_op(tp, f, code + 192);
+L193: /* CALLM */
+    return code + 193;
+L194: /* JUMP */
+    goto L220;
+L195: /* LINE */
+    f->line = code + 195;
+    f->lineno = 18;
+L206: /* STRING */
+    tp_aot_op(tp, f, code + 206);
+L210: /* MGET */
+    tp_aot_op(tp, f, code + 210);
+L212: /* STRING */
+    tp_aot_op(tp, f, code + 212);
+L216: /* METHOD */
+    tp_aot_op(tp, f, code + 216);
+L218: /* NONE */
+    regs[5] = tp_None;
+L219: /* CALLM */
+    return code + 219;
+L220: /* LINE */
+    f->line = code + 220;
+    f->lineno = 19;
+L278: /* LIST */
+    tp_aot_op(tp, f, code + 278);
+L279: /* DICT */
+    tp_aot_op(tp, f, code + 279);
+L280: /* DICT */
+    tp_aot_op(tp, f, code + 280);
+L281: /* NUMBER */
+    tp_aot_op(tp, f, code + 281);
+L284: /* NUMBER */
+    tp_aot_op(tp, f, code + 284);
+L287: /* GGET */
+    tp_aot_op(tp, f, code + 287);
+L290: /* STRING */
+    tp_aot_op(tp, f, code + 290);
+L294: /* MGET */
+    tp_aot_op(tp, f, code + 294);
+L296: /* CALLP */
+    return code + 296;
+L297: /* MOVE */
+    regs[8] = regs[1];
+L298: /* NUMBER */
+    tp_aot_op(tp, f, code + 298);
+L301: /* LIST */
+    tp_aot_op(tp, f, code + 301);
+L302: /* LIST */
+    tp_aot_op(tp, f, code + 302);
+L303: /* STRING */
+    tp_aot_op(tp, f, code + 303);
+L307: /* LIST */
+    tp_aot_op(tp, f, code + 307);
+L308: /* NUMBER */
+    tp_aot_op(tp, f, code + 308);
+L311: /* DICT */
+    tp_aot_op(tp, f, code + 311);
+L312: /* NUMBER */
+    tp_aot_op(tp, f, code + 312);
+L315: /* STRING */
+    tp_aot_op(tp, f, code + 315);
+L319: /* SET */
+    tp_set(tp, regs[0], regs[16], regs[2]);
+L320: /* STRING */
+    tp_aot_op(tp, f, code + 320);
+L323: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[3]);
+L324: /* STRING */
+    tp_aot_op(tp, f, code + 324);
+L327: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[4]);
+L328: /* STRING */
+    tp_aot_op(tp, f, code + 328);
+L332: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[5]);
+L333: /* STRING */
+    tp_aot_op(tp, f, code + 333);
+L337: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[6]);
+L338: /* STRING */
+    tp_aot_op(tp, f, code + 338);
+L342: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[7]);
+L343: /* STRING */
+    tp_aot_op(tp, f, code + 343);
+L348: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[8]);
+L349: /* STRING */
+    tp_aot_op(tp, f, code + 349);
+L353: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[9]);
+L354: /* STRING */
+    tp_aot_op(tp, f, code + 354);
+L358: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[10]);
+L359: /* STRING */
+    tp_aot_op(tp, f, code + 359);
+L364: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[11]);
+L365: /* STRING */
+    tp_aot_op(tp, f, code + 365);
+L369: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[12]);
+L370: /* STRING */
+    tp_aot_op(tp, f, code + 370);
+L374: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[13]);
+L375: /* STRING */
+    tp_aot_op(tp, f, code + 375);
+L379: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[14]);
+L380: /* STRING */
+    tp_aot_op(tp, f, code + 380);
+L384: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[15]);
+L385: /* LINE */
+    f->line = code + 385;
+    f->lineno = 20;
+L393: /* STRING */
+    tp_aot_op(tp, f, code + 393);
+L397: /* MGET */
+    tp_aot_op(tp, f, code + 397);
+L399: /* NUMBER */
+    tp_aot_op(tp, f, code + 399);
+L402: /* ADD */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_int(regs[2].nint + regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 402);
+    }
+L403: /* STRING */
+    tp_aot_op(tp, f, code + 403);
+L407: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[2]);
+L408: /* LINE */
+    f->line = code + 408;
+    f->lineno = 21;
+L416: /* GGET */
+    tp_aot_op(tp, f, code + 416);
+L420: /* STRING */
+    tp_aot_op(tp, f, code + 420);
+L424: /* MGET */
+    tp_aot_op(tp, f, code + 424);
+L426: /* CALLP */
+    return code + 426;
+L427: /* EOF */
+    return code + 427;
+}
+
+static tpd_code * _tp_tinypy_compiler_encode_982(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 11: goto L11;
+        case 14: goto L14;
+        case 16: goto L16;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 29: goto L29;
+        case 30: goto L30;
+        case 43: goto L43;
+        case 47: goto L47;
+        case 49: goto L49;
+        case 53: goto L53;
+        case 55: goto L55;
+        case 58: goto L58;
+        case 62: goto L62;
+        case 64: goto L64;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 81: goto L81;
+        case 85: goto L85;
+        case 87: goto L87;
+        case 91: goto L91;
+        case 93: goto L93;
+        case 96: goto L96;
+        case 100: goto L100;
+        case 102: goto L102;
+        case 103: goto L103;
+        case 104: goto L104;
+        case 115: goto L115;
+        case 119: goto L119;
+        case 121: goto L121;
+        case 125: goto L125;
+        case 127: goto L127;
+        case 131: goto L131;
+        case 133: goto L133;
+        case 134: goto L134;
+        case 139: goto L139;
+        case 140: goto L140;
+        case 141: goto L141;
+        case 148: goto L148;
+        case 152: goto L152;
+        case 155: goto L155;
+        case 156: goto L156;
+        case 164: goto L164;
+        case 168: goto L168;
+        case 170: goto L170;
+        case 173: goto L173;
+        case 174: goto L174;
+        case 175: goto L175;
+        case 176: goto L176;
+        case 194: goto L194;
+        case 198: goto L198;
+        case 212: goto L212;
+        case 213: goto L213;
+        case 223: goto L223;
+        case 227: goto L227;
+        case 229: goto L229;
+        case 232: goto L232;
+        case 233: goto L233;
+        case 234: goto L234;
+        case 243: goto L243;
+        case 246: goto L246;
+        case 250: goto L250;
+        case 252: goto L252;
+        case 253: goto L253;
+        case 256: goto L256;
+        case 257: goto L257;
+        case 258: goto L258;
+        case 259: goto L259;
+        case 308: goto L308;
+        case 312: goto L312;
+        case 314: goto L314;
+        case 317: goto L317;
+        case 319: goto L319;
+        case 320: goto L320;
+        case 323: goto L323;
+        case 326: goto L326;
+        case 327: goto L327;
+        case 331: goto L331;
+        case 332: goto L332;
+        case 335: goto L335;
+        case 336: goto L336;
+        case 339: goto L339;
+        case 340: goto L340;
+        case 343: goto L343;
+        case 344: goto L344;
+        case 347: goto L347;
+        case 348: goto L348;
+        case 351: goto L351;
+        case 352: goto L352;
+        case 356: goto L356;
+        case 357: goto L357;
+        case 360: goto L360;
+        case 361: goto L361;
+        case 365: goto L365;
+        case 366: goto L366;
+        case 369: goto L369;
+        case 370: goto L370;
+        case 374: goto L374;
+        case 375: goto L375;
+        case 378: goto L378;
+        case 379: goto L379;
+        case 384: goto L384;
+        case 385: goto L385;
+        case 388: goto L388;
+        case 389: goto L389;
+        case 393: goto L393;
+        case 394: goto L394;
+        case 397: goto L397;
+        case 398: goto L398;
+        case 402: goto L402;
+        case 403: goto L403;
+        case 406: goto L406;
+        case 407: goto L407;
+        case 412: goto L412;
+        case 413: goto L413;
+        case 416: goto L416;
+        case 417: goto L417;
+        case 421: goto L421;
+        case 422: goto L422;
+        case 425: goto L425;
+        case 426: goto L426;
+        case 430: goto L430;
+        case 431: goto L431;
+        case 434: goto L434;
+        case 435: goto L435;
+        case 439: goto L439;
+        case 440: goto L440;
+        case 443: goto L443;
+        case 444: goto L444;
+        case 448: goto L448;
+        case 449: goto L449;
+        case 450: goto L450;
+        case 459: goto L459;
+        case 463: goto L463;
+        case 465: goto L465;
+        case 468: goto L468;
+        case 470: goto L470;
+        case 471: goto L471;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 22;
+L11: /* VAR */
+L14: /* VAR */
+L16: /* STRING */
+    tp_aot_op(tp, f, code + 16);
+L25: /* FILE */
+    f->fname = regs[2];
+L26: /* STRING */
+    tp_aot_op(tp, f, code + 26);
+L29: /* NAME */
+    f->name = regs[2];
+L30: /* LINE */
+    f->line = code + 30;
+    f->lineno = 25;
+L43: /* STRING */
+    tp_aot_op(tp, f, code + 43);
+L47: /* MGET */
+    tp_aot_op(tp, f, code + 47);
+L49: /* STRING */
+    tp_aot_op(tp, f, code + 49);
+L53: /* METHOD */
+    tp_aot_op(tp, f, code + 53);
+L55: /* GGET */
+    tp_aot_op(tp, f, code + 55);
+L58: /* STRING */
+    tp_aot_op(tp, f, code + 58);
+L62: /* MGET */
+    tp_aot_op(tp, f, code + 62);
+L64: /* NUMBER */
+    tp_aot_op(tp, f, code + 64);
+L67: /* CALLP */
+    return code + 67;
+L68: /* CALLM */
+    return code + 68;
+L69: /* LINE */
+    f->line = code + 69;
+    f->lineno = 26;
+L81: /* STRING */
+    tp_aot_op(tp, f, code + 81);
+L85: /* MGET */
+    tp_aot_op(tp, f, code + 85);
+L87: /* STRING */
+    tp_aot_op(tp, f, code + 87);
+L91: /* METHOD */
+    tp_aot_op(tp, f, code + 91);
+L93: /* GGET */
+    tp_aot_op(tp, f, code + 93);
+L96: /* STRING */
+    tp_aot_op(tp, f, code + 96);
+L100: /* MGET */
+    tp_aot_op(tp, f, code + 100);
+L102: /* CALLP */
+    return code + 102;
+L103: /* CALLM */
+    return code + 103;
+L104: /* LINE */
+    f->line = code + 104;
+    f->lineno = 27;
+L115: /* STRING */
+    tp_aot_op(tp, f, code + 115);
+L119: /* MGET */
+    tp_aot_op(tp, f, code + 119);
+L121: /* STRING */
+    tp_aot_op(tp, f, code + 121);
+L125: /* METHOD */
+    tp_aot_op(tp, f, code + 125);
+L127: /* STRING */
+    tp_aot_op(tp, f, code + 127);
+L131: /* MGET */
+    tp_aot_op(tp, f, code + 131);
+L133: /* CALLM */
+    return code + 133;
+L134: /* LINE */
+    f->line = code + 134;
+    f->lineno = 28;
+L139: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L141;
+    }
+L140: /* JUMP */
+    goto L156;
+L141: /* LINE */
+    f->line = code + 141;
+    f->lineno = 29;
+L148: /* GGET */
+    tp_aot_op(tp, f, code + 148);
+L152: /* GGET */
+    tp_aot_op(tp, f, code + 152);
+L155: /* CALLP */
+    return code + 155;
+L156: /* LINE */
+    f->line = code + 156;
+    f->lineno = 31;
+L164: /* STRING */
+    tp_aot_op(tp, f, code + 164);
+L168: /* MGET */
+    tp_aot_op(tp, f, code + 168);
+L170: /* NUMBER */
+    tp_aot_op(tp, f, code + 170);
+L173: /* NE */
+    if (TP_BOTH(regs[2], regs[5], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint != regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 173);
+    }
+L174: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L176;
+    }
+L175: /* JUMP */
+    goto L213;
+L176: /* LINE */
+    f->line = code + 176;
+    f->lineno = 32;
+L194: /* GGET */
+    tp_aot_op(tp, f, code + 194);
+L198: /* STRING */
+    tp_aot_op(tp, f, code + 198);
+L212: /* CALLP */
+    return code + 212;
+L213: /* LINE */
+    f->line = code + 213;
+    f->lineno = 36;
+L223: /* STRING */
+    tp_aot_op(tp, f, code + 223);
+L227: /* MGET */
+    tp_aot_op(tp, f, code + 227);
+L229: /* NUMBER */
+    tp_aot_op(tp, f, code + 229);
+L232: /* EQ */
+    if (TP_BOTH(regs[5], regs[6], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[5].nint == regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 232);
+    }
+L233: /* ASSERT */
+    tp_assert(tp, regs[2], regs[5], regs[6]);
+L234: /* LINE */
+    f->line = code + 234;
+    f->lineno = 38;
+L243: /* GGET */
+    tp_aot_op(tp, f, code + 243);
+L246: /* STRING */
+    tp_aot_op(tp, f, code + 246);
+L250: /* MGET */
+    tp_aot_op(tp, f, code + 250);
+L252: /* CALLP */
+    return code + 252;
+L253: /* NUMBER */
+    tp_aot_op(tp, f, code + 253);
+L256: /* GT */
+    if (TP_BOTH(regs[2], regs[5], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint > regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 256);
+    }
+L257: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L259;
+    }
+L258: /* JUMP */
+    goto L450;
+L259: /* LINE */
+    f->line = code + 259;
+    f->lineno = 39;
+L308: /* STRING */
+    tp_aot_op(tp, f, code + 308);
+L312: /* MGET */
+    tp_aot_op(tp, f, code + 312);
+L314: /* STRING */
+    tp_aot_op(tp, f, code + 314);
+L317: /* METHOD */
+    tp_aot_op(tp, f, code + 317);
+L319: /* CALLM */
+    return code + 319;
+L320: /* VAR */
+L323: /* NUMBER */
+    tp_aot_op(tp, f, code + 323);
+L326: /* GET */
+    regs[5] = tp_get(tp, regs[2], regs[6]);
+    tp_grey(tp, regs[5]);
+L327: /* STRING */
+    tp_aot_op(tp, f, code + 327);
+L331: /* SET */
+    tp_set(tp, regs[0], regs[6], regs[5]);
+L332: /* NUMBER */
+    tp_aot_op(tp, f, code + 332);
+L335: /* GET */
+    regs[5] = tp_get(tp, regs[2], regs[6]);
+    tp_grey(tp, regs[5]);
+L336: /* STRING */
+    tp_aot_op(tp, f, code + 336);
+L339: /* SET */
+    tp_set(tp, regs[0], regs[6], regs[5]);
+L340: /* NUMBER */
+    tp_aot_op(tp, f, code + 340);
+L343: /* GET */
+    regs[5] = tp_get(tp, regs[2], regs[6]);
+    tp_grey(tp, regs[5]);
+L344: /* STRING */
+    tp_aot_op(tp, f, code + 344);
+L347: /* SET */
+    tp_set(tp, regs[0], regs[6], regs[5]);
+L348: /* NUMBER */
+    tp_aot_op(tp, f, code + 348);
+L351: /* GET */
+    regs[5] = tp_get(tp, regs[2], regs[6]);
+    tp_grey(tp, regs[5]);
+L352: /* STRING */
+    tp_aot_op(tp, f, code + 352);
+L356: /* SET */
+    tp_set(tp, regs[0], regs[6], regs[5]);
+L357: /* NUMBER */
+    tp_aot_op(tp, f, code + 357);
+L360: /* GET */
+    regs[5] = tp_get(tp, regs[2], regs[6]);
+    tp_grey(tp, regs[5]);
+L361: /* STRING */
+    tp_aot_op(tp, f, code + 361);
+L365: /* SET */
+    tp_set(tp, regs[0], regs[6], regs[5]);
+L366: /* NUMBER */
+    tp_aot_op(tp, f, code + 366);
+L369: /* GET */
+    regs[5] = tp_get(tp, regs[2], regs[6]);
+    tp_grey(tp, regs[5]);
+L370: /* STRING */
+    tp_aot_op(tp, f, code + 370);
+L374: /* SET */
+    tp_set(tp, regs[0], regs[6], regs[5]);
+L375: /* NUMBER */
+    tp_aot_op(tp, f, code + 375);
+L378: /* GET */
+    regs[5] = tp_get(tp, regs[2], regs[6]);
+    tp_grey(tp, regs[5]);
+L379: /* STRING */
+    tp_aot_op(tp, f, code + 379);
+L384: /* SET */
+    tp_set(tp, regs[0], regs[6], regs[5]);
+L385: /* NUMBER */
+    tp_aot_op(tp, f, code + 385);
+L388: /* GET */
+    regs[5] = tp_get(tp, regs[2], regs[6]);
+    tp_grey(tp, regs[5]);
+L389: /* STRING */
+    tp_aot_op(tp, f, code + 389);
+L393: /* SET */
+    tp_set(tp, regs[0], regs[6], regs[5]);
+L394: /* NUMBER */
+    tp_aot_op(tp, f, code + 394);
+L397: /* GET */
+    regs[5] = tp_get(tp, regs[2], regs[6]);
+    tp_grey(tp, regs[5]);
+L398: /* STRING */
+    tp_aot_op(tp, f, code + 398);
+L402: /* SET */
+    tp_set(tp, regs[0], regs[6], regs[5]);
+L403: /* NUMBER */
+    tp_aot_op(tp, f, code + 403);
+L406: /* GET */
+    regs[5] = tp_get(tp, regs[2], regs[6]);
+    tp_grey(tp, regs[5]);
+L407: /* STRING */
+    tp_aot_op(tp, f, code + 407);
+L412: /* SET */
+    tp_set(tp, regs[0], regs[6], regs[5]);
+L413: /* NUMBER */
+    tp_aot_op(tp, f, code + 413);
+L416: /* GET */
+    regs[5] = tp_get(tp, regs[2], regs[6]);
+    tp_grey(tp, regs[5]);
+L417: /* STRING */
+    tp_aot_op(tp, f, code + 417);
+L421: /* SET */
+    tp_set(tp, regs[0], regs[6], regs[5]);
+L422: /* NUMBER */
+    tp_aot_op(tp, f, code + 422);
+L425: /* GET */
+    regs[5] = tp_get(tp, regs[2], regs[6]);
+    tp_grey(tp, regs[5]);
+L426: /* STRING */
+    tp_aot_op(tp, f, code + 426);
+L430: /* SET */
+    tp_set(tp, regs[0], regs[6], regs[5]);
+L431: /* NUMBER */
+    tp_aot_op(tp, f, code + 431);
+L434: /* GET */
+    regs[5] = tp_get(tp, regs[2], regs[6]);
+    tp_grey(tp, regs[5]);
+L435: /* STRING */
+    tp_aot_op(tp, f, code + 435);
+L439: /* SET */
+    tp_set(tp, regs[0], regs[6], regs[5]);
+L440: /* NUMBER */
+    tp_aot_op(tp, f, code + 440);
+L443: /* GET */
+    regs[5] = tp_get(tp, regs[2], regs[6]);
+    tp_grey(tp, regs[5]);
+L444: /* STRING */
+    tp_aot_op(tp, f, code + 444);
+L448: /* SET */
+    tp_set(tp, regs[0], regs[6], regs[5]);
+L449: /* JUMP */
+    goto L471;
+L450: /* LINE */
+    f->line = code + 450;
+    f->lineno = 40;
+L459: /* STRING */
+    tp_aot_op(tp, f, code + 459);
+L463: /* MGET */
+    tp_aot_op(tp, f, code + 463);
+L465: /* STRING */
+    tp_aot_op(tp, f, code + 465);
+L468: /* METHOD */
+    tp_aot_op(tp, f, code + 468);
+L470: /* CALLM */
+    return code + 470;
+L471: /* EOF */
+    return code + 471;
+}
+
+static const tpd_aot _tp_tinypy_compiler_encode_aot[] = {
+    {0, _tp_tinypy_compiler_encode_0},
+    {255, _tp_tinypy_compiler_encode_255},
+    {1503, _tp_tinypy_compiler_encode_1503},
+    {1569, _tp_tinypy_compiler_encode_1569},
+    {1712, _tp_tinypy_compiler_encode_1712},
+    {1966, _tp_tinypy_compiler_encode_1966},
+    {2150, _tp_tinypy_compiler_encode_2150},
+    {2261, _tp_tinypy_compiler_encode_2261},
+    {2355, _tp_tinypy_compiler_encode_2355},
+    {2485, _tp_tinypy_compiler_encode_2485},
+    {2659, _tp_tinypy_compiler_encode_2659},
+    {2740, _tp_tinypy_compiler_encode_2740},
+    {2912, _tp_tinypy_compiler_encode_2912},
+    {3114, _tp_tinypy_compiler_encode_3114},
+    {3298, _tp_tinypy_compiler_encode_3298},
+    {3406, _tp_tinypy_compiler_encode_3406},
+    {3557, _tp_tinypy_compiler_encode_3557},
+    {3658, _tp_tinypy_compiler_encode_3658},
+    {3749, _tp_tinypy_compiler_encode_3749},
+    {3817, _tp_tinypy_compiler_encode_3817},
+    {3934, _tp_tinypy_compiler_encode_3934},
+    {4054, _tp_tinypy_compiler_encode_4054},
+    {4187, _tp_tinypy_compiler_encode_4187},
+    {4833, _tp_tinypy_compiler_encode_4833},
+    {5632, _tp_tinypy_compiler_encode_5632},
+    {5716, _tp_tinypy_compiler_encode_5716},
+    {5905, _tp_tinypy_compiler_encode_5905},
+    {6053, _tp_tinypy_compiler_encode_6053},
+    {6143, _tp_tinypy_compiler_encode_6143},
+    {6236, _tp_tinypy_compiler_encode_6236},
+    {6316, _tp_tinypy_compiler_encode_6316},
+    {6388, _tp_tinypy_compiler_encode_6388},
+    {6494, _tp_tinypy_compiler_encode_6494},
+    {6700, _tp_tinypy_compiler_encode_6700},
+    {6835, _tp_tinypy_compiler_encode_6835},
+    {6985, _tp_tinypy_compiler_encode_6985},
+    {7111, _tp_tinypy_compiler_encode_7111},
+    {7269, _tp_tinypy_compiler_encode_7269},
+    {7407, _tp_tinypy_compiler_encode_7407},
+    {7640, _tp_tinypy_compiler_encode_7640},
+    {7736, _tp_tinypy_compiler_encode_7736},
+    {8070, _tp_tinypy_compiler_encode_8070},
+    {8735, _tp_tinypy_compiler_encode_8735},
+    {9677, _tp_tinypy_compiler_encode_9677},
+    {9974, _tp_tinypy_compiler_encode_9974},
+    {10259, _tp_tinypy_compiler_encode_10259},
+    {10553, _tp_tinypy_compiler_encode_10553},
+    {11123, _tp_tinypy_compiler_encode_11123},
+    {11250, _tp_tinypy_compiler_encode_11250},
+    {11417, _tp_tinypy_compiler_encode_11417},
+    {11771, _tp_tinypy_compiler_encode_11771},
+    {12560, _tp_tinypy_compiler_encode_12560},
+    {12750, _tp_tinypy_compiler_encode_12750},
+    {12968, _tp_tinypy_compiler_encode_12968},
+    {13627, _tp_tinypy_compiler_encode_13627},
+    {14484, _tp_tinypy_compiler_encode_14484},
+    {14731, _tp_tinypy_compiler_encode_14731},
+    {15003, _tp_tinypy_compiler_encode_15003},
+    {15347, _tp_tinypy_compiler_encode_15347},
+    {15725, _tp_tinypy_compiler_encode_15725},
+    {16041, _tp_tinypy_compiler_encode_16041},
+    {16384, _tp_tinypy_compiler_encode_16384},
+    {16595, _tp_tinypy_compiler_encode_16595},
+    {16728, _tp_tinypy_compiler_encode_16728},
+    {17091, _tp_tinypy_compiler_encode_17091},
+    {17225, _tp_tinypy_compiler_encode_17225},
+    {17319, _tp_tinypy_compiler_encode_17319},
+    {17419, _tp_tinypy_compiler_encode_17419},
+    {17519, _tp_tinypy_compiler_encode_17519},
+    {17612, _tp_tinypy_compiler_encode_17612},
+    {17718, _tp_tinypy_compiler_encode_17718},
+    {17851, _tp_tinypy_compiler_encode_17851},
+    {17937, _tp_tinypy_compiler_encode_17937},
+    {18020, _tp_tinypy_compiler_encode_18020},
+    {18084, _tp_tinypy_compiler_encode_18084},
+    {18248, _tp_tinypy_compiler_encode_18248},
+    {18346, _tp_tinypy_compiler_encode_18346},
+    {18854, _tp_tinypy_compiler_encode_18854},
+    {19026, _tp_tinypy_compiler_encode_19026},
+    {291, _tp_tinypy_compiler_encode_291},
+    {523, _tp_tinypy_compiler_encode_523},
+    {982, _tp_tinypy_compiler_encode_982},
+};
+
+void tinypy_compiler_encode_init(TP) {
+    tp_aot_import(tp, "tinypy.compiler.encode", _tp_tinypy_compiler_encode_tpc, sizeof(_tp_tinypy_compiler_encode_tpc),
+        _tp_tinypy_compiler_encode_aot, 82);
+}
@@ -2,6 +2,8 @@ import tinypy.compiler.tokenize as tokenize
 from tinypy.compiler.tokenize import Token
 from tinypy.compiler.boot import *
 from tinypy.compiler.opcodes import *
+import tinypy.compiler.peephole as peephole
+import tinypy.compiler.regalloc as regalloc
 
 class DState:
     def __init__(self,code,fname):
@@ -12,14 +14,17 @@ class DState:
         self.stack,self.out,self._scopei,self.tstack,self._tagi,self.data = [],[('tag','EOF')],0,[],0,{}
         self.error = False
     def begin(self,gbl=False):
-        if len(self.stack): self.stack.append((self.vars,self.r2n,self.n2r,self._tmpi,self.mreg,self.snum,self._globals,self.lineno,self.globals,self.rglobals,self.cregs,self.tmpc))
+        if len(self.stack): self.stack.append((self.vars,self.r2n,self.n2r,self._tmpi,self.mreg,self.snum,self._globals,self.lineno,self.globals,self.rglobals,self.cregs,self.tmpc,self.consts,self.mcaches))
         else: self.stack.append(None)
-        self.vars,self.r2n,self.n2r,self._tmpi,self.mreg,self.snum,self._globals,self.lineno,self.globals,self.rglobals,self.cregs,self.tmpc = [],{},{},0,0,str(self._scopei),gbl,-1,[],[],['regs'],0
+        self.vars,self.r2n,self.n2r,self._tmpi,self.mreg,self.snum,self._globals,self.lineno,self.globals,self.rglobals,self.cregs,self.tmpc,self.consts,self.mcaches = [],{},{},0,0,str(self._scopei),gbl,-1,[],[],['regs'],0,{},0
         self._scopei += 1
         insert(self.cregs)
     def end(self, eof=True):
         # cregs is already inserted to out; this modifies it in place.
-        self.cregs.append(self.mreg)
+        # The VM sets the varargs and varkw registers of every frame.
+        self.cregs.append(max(self.mreg, 2))
+        self.cregs.append(len(self.consts))
+        self.cregs.append(self.mcaches)
         if eof:
             code(EOF)
 
@@ -31,7 +36,7 @@ class DState:
         assert(self.tmpc == 0) #REG
 
         if len(self.stack) > 1:
-            self.vars,self.r2n,self.n2r,self._tmpi,self.mreg,self.snum,self._globals,self.lineno,self.globals,self.rglobals,self.cregs,self.tmpc = self.stack.pop()
+            self.vars,self.r2n,self.n2r,self._tmpi,self.mreg,self.snum,self._globals,self.lineno,self.globals,self.rglobals,self.cregs,self.tmpc,self.consts,self.mcaches = self.stack.pop()
         else: self.stack.pop()
 
 
@@ -63,15 +68,32 @@ def code_16(i,a,b):
 def get_code16(i,a,b):
     return ('code',i,a,(b&0xff00)>>8,(b&0xff)>>0)
 
+def const_slot(key):
+    # NUMBER and STRING load through a constant pool slot of the code
+    # object; the VM decodes each literal once, on first use.
+    if key not in D.consts:
+        D.consts[key] = len(D.consts)
+    return D.consts[key]
+
 def _do_string(v,r=None):
     r = get_tmp(r)
     val = v + b"\0"*(4-len(v)%4)
-    code_16(STRING,r,len(v))
+    code_16(STRING,r,const_slot(b's'+v))
+    code_16(0,0,len(v))
     write(val)
     return r
 def do_string(t,r=None):
     return _do_string(t.val,r)
 
+def _do_gget(v,r=None):
+    # laid out like STRING; the VM caches the lookup per constant slot.
+    r = get_tmp(r)
+    val = v + b"\0"*(4-len(v)%4)
+    code_16(GGET,r,const_slot(b's'+v))
+    code_16(0,0,len(v))
+    write(val)
+    return r
+
 def _do_integer(i,r=None):
     if i <= 0x7fffffff:
         return _do_number('=i', i, r)
@@ -85,7 +107,8 @@ def _do_integer(i,r=None):
 def _do_number(format, i, r=None):
     r = get_tmp(r)
     buf = pack(format, i)
-    code(NUMBER,r,ord(format[1]),len(buf))
+    code_16(NUMBER,r,const_slot(format.encode()+buf))
+    code(0,0,ord(format[1]),len(buf))
     write(buf)
     return r
 
@@ -161,8 +184,9 @@ def map_tags():
             tags[item[1]] = n
             continue
         if item[0] == 'regs':
-            out.append(get_code16(REGS,item[1],0))
-            n += 1
+            out.append(get_code16(REGS,item[1],item[2]))
+            out.append(get_code16(0,0,item[3]))
+            n += 2
             continue
         out.append(item)
         n += 1
@@ -283,11 +307,11 @@ def do_cmp(t, trace, r=None):
     items = t.items
     b,c = items[0],items[1]
     v = t.val
-    if v[0] in ('>','>='):
-        b,c,v = c,b,'<'+v[1:]
     cd = EQ
     if v == '<': cd = LT
     if v == '<=': cd = LE
+    if v == '>': cd = GT
+    if v == '>=': cd = GE
     if v == '!=': cd = NE
     if v == 'is': cd = EQ
     if v == 'isnot': cd = NE
@@ -467,10 +491,38 @@ def do_del(tt):
         code(DEL,r,r2)
         free_tmp(r); free_tmp(r2) #REG
 
+def do_call_method(fnc,p,r):
+    # obj.name(...): METHOD leaves the function and the receiver in the
+    # first two registers and CALLM passes the receiver as the first
+    # argument, so no bound method is made.
+    tmps = get_tmps(2+len(p))
+    b,c = do(fnc.items[0]),do(fnc.items[1])
+    code(METHOD,tmps[0],b,c)
+    code_16(0,0,mcache_slot())
+    free_tmp(b); free_tmp(c)
+    n = 2
+    for tt in p:
+        b = do(tt,tmps[n])
+        if b != tmps[n]:
+            code(MOVE,tmps[n],b)
+            free_tmp(b)
+        n += 1
+    code(CALLM,r,tmps[0],len(tmps))
+    free_tmps(tmps)
+    return r
+
 def do_call(t,r=None):
     items = t.items
-    fnc = do(items[0])
     p,n,l,d = p_filter(t.items[1:])
+    if len(n) == 0 and l == None and d == None:
+        # positional only: the callee and its arguments go to consecutive
+        # registers; CALLP copies them to the callee without a params list.
+        r = get_tmp(r)
+        if items[0].type == 'mget':
+            return do_call_method(items[0],p,r)
+        manage_seq(CALLP,r,[items[0]]+p)
+        return r
+    fnc = do(items[0])
     e = None
     if len(n) != 0 or d != None:
         e = do(Token(t.pos,'dict',None,[])); un_tmp(e);
@@ -510,11 +562,7 @@ def do_name(t,r=None):
         return do_local(t,r)
     if t.val not in D.rglobals:
         D.rglobals.append(t.val)
-    r = get_tmp(r)
-    c = do_string(t.as_string())
-    code(GGET,r,c)
-    free_tmp(c)
-    return r
+    return _do_gget(t.as_string().val,r)
 
 def do_local(t,r=None):
     if t.val in D.rglobals:
@@ -549,11 +597,15 @@ def do_def(tok):
         do_local(d.items[0])
     else:
         do_local(Token(tok.pos, 'name', '__kwargs__'))
+    nparams = len(D.vars)
 
     do_info(items[0].val)
 
     free_tmp(do(items[2])) #REG
+    regs = D.cregs
     D.end()
+    # the VM sets this many registers on a call; see regalloc.py.
+    regs.append(nparams)
     tag(t, 'end')
 
     if D._globals:
@@ -596,11 +648,8 @@ def do_class(tok):
 
     # we must refetch the kls object, because after begin() the kls reg is
     # invalidated.
-    ts = do_string(name.as_string())
-    kls = get_tmp()
-    code(GGET, kls, ts)
+    kls = _do_gget(name.as_string().val)
     un_tmp(kls)
-    free_tmp(ts) #REG
     for val in D.vars:
         val_name = Token(tok.pos,'name',val)
         ts = do_string(val_name.as_string())
@@ -635,8 +684,34 @@ def do_while(t):
     tag(t,'end')
     pop_tag()
 
+def is_range_call(t):
+    # for ... in range(...), unless range is a local.
+    if t.type != 'call' or t.items[0].type != 'name': return False
+    if t.items[0].val != 'range' or t.items[0].val in D.vars: return False
+    p,n,l,d = p_filter(t.items[1:])
+    return len(n) == 0 and l == None and d == None
+
+def do_for_range(tok):
+    # RANGE turns the range into a counter in three registers and FOR
+    # steps it; there is no list and no range object.
+    items = tok.items
+    reg = get_tmp()
+    s = get_tmps(3)
+    manage_seq(RANGE,s[0],items[1].items)
+
+    t = stack_tag(); tag(t,'loop'); tag(t,'continue')
+    code(FOR,reg,s[0]); jump(t,'end')
+    free_tmp(do_set_ctx(items[0], Token(tok.pos, 'reg', reg)))
+    free_tmp(do(items[2])) #REG
+    jump(t,'loop')
+    tag(t,'break'); tag(t,'end'); pop_tag()
+
+    free_tmps(s) #REG
+
 def do_for(tok):
     items = tok.items
+    if is_range_call(items[1]):
+        return do_for_range(tok)
 
     reg = get_tmp()
     itr = do(items[1])
@@ -744,9 +819,16 @@ def do_get(t,r=None):
     items = t.items
     return infix(GET,items[0],items[1],r)
 
+def mcache_slot():
+    # MGET remembers where it found the attribute in a cache of its own.
+    D.mcaches += 1
+    return D.mcaches - 1
+
 def do_mget(t,r=None):
     items = t.items
-    return infix(MGET,items[0],items[1],r)
+    r = infix(MGET,items[0],items[1],r)
+    code_16(0,0,mcache_slot())
+    return r
 
 def do_break(t): jump(D.tstack[-1],'break')
 def do_continue(t): jump(D.tstack[-1],'continue')
@@ -789,7 +871,7 @@ def do(t,r=None):
     #    D.error = True
     #    tokenize.u_error('encode',D.code,t.pos)
 
-def encode(fname,s,t):
+def encode(fname,s,t,optimize=True):
     t = Token((1,1),'module','module',[t])
     global D
     s = tokenize.clean(s)
@@ -797,6 +879,9 @@ def encode(fname,s,t):
     D.begin(True)
     do(t)
     D.end()
+    if optimize:
+        D.out = peephole.peephole(D.out)
+        D.out = regalloc.regalloc(D.out)
     map_tags()
     out = D.out; D = None
     # Use a function instead of ''.join() so that bytes and
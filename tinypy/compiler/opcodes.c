@@ -0,0 +1,2168 @@
+/* Generated from tinypy/compiler/opcodes.py with tpc -a. Do not modify. */
+#include <tinypy/tp.h>
+
+static unsigned char _tp_tinypy_compiler_opcodes_tpc[] = {
+0x2d,0x06,0x00,0x8e,0x00,0x00,0x00,0x00,0x1f,0x02,0x00,0x01,0x45,0x4f,0x46,0x20,
+0x3d,0x20,0x30,0x00,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x1a,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x6f,0x70,0x63,0x6f,
+0x64,0x65,0x73,0x2e,0x70,0x79,0x00,0x00,0x22,0x00,0x00,0x00,0x0d,0x00,0x00,0x01,
+0x00,0x00,0x00,0x01,0x3f,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x0d,0x00,0x00,0x02,
+0x00,0x00,0x00,0x03,0x45,0x4f,0x46,0x00,0x0c,0x01,0x00,0x03,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x02,0x00,0x03,0x41,0x44,0x44,0x20,
+0x3d,0x20,0x31,0x00,0x0d,0x00,0x00,0x04,0x00,0x00,0x00,0x03,0x41,0x44,0x44,0x00,
+0x0c,0x01,0x00,0x05,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,
+0x1f,0x02,0x00,0x04,0x53,0x55,0x42,0x20,0x3d,0x20,0x32,0x00,0x0d,0x00,0x00,0x06,
+0x00,0x00,0x00,0x03,0x53,0x55,0x42,0x00,0x0c,0x01,0x00,0x07,0x00,0x00,0x69,0x04,
+0x02,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x02,0x00,0x05,0x4d,0x55,0x4c,0x20,
+0x3d,0x20,0x33,0x00,0x0d,0x00,0x00,0x08,0x00,0x00,0x00,0x03,0x4d,0x55,0x4c,0x00,
+0x0c,0x01,0x00,0x09,0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,
+0x1f,0x02,0x00,0x06,0x44,0x49,0x56,0x20,0x3d,0x20,0x34,0x00,0x0d,0x00,0x00,0x0a,
+0x00,0x00,0x00,0x03,0x44,0x49,0x56,0x00,0x0c,0x01,0x00,0x0b,0x00,0x00,0x69,0x04,
+0x04,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x02,0x00,0x07,0x50,0x4f,0x57,0x20,
+0x3d,0x20,0x35,0x00,0x0d,0x00,0x00,0x0c,0x00,0x00,0x00,0x03,0x50,0x4f,0x57,0x00,
+0x0c,0x01,0x00,0x0d,0x00,0x00,0x69,0x04,0x05,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,
+0x1f,0x03,0x00,0x08,0x4d,0x4f,0x44,0x20,0x3d,0x20,0x34,0x30,0x00,0x00,0x00,0x00,
+0x0d,0x00,0x00,0x0e,0x00,0x00,0x00,0x03,0x4d,0x4f,0x44,0x00,0x0c,0x01,0x00,0x0f,
+0x00,0x00,0x69,0x04,0x28,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x09,
+0x4c,0x53,0x48,0x20,0x3d,0x20,0x34,0x31,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x10,
+0x00,0x00,0x00,0x03,0x4c,0x53,0x48,0x00,0x0c,0x01,0x00,0x11,0x00,0x00,0x69,0x04,
+0x29,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x0a,0x52,0x53,0x48,0x20,
+0x3d,0x20,0x34,0x32,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x12,0x00,0x00,0x00,0x03,
+0x52,0x53,0x48,0x00,0x0c,0x01,0x00,0x13,0x00,0x00,0x69,0x04,0x2a,0x00,0x00,0x00,
+0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x0c,0x42,0x49,0x54,0x41,0x4e,0x44,0x20,0x3d,
+0x20,0x36,0x00,0x00,0x0d,0x00,0x00,0x14,0x00,0x00,0x00,0x06,0x42,0x49,0x54,0x41,
+0x4e,0x44,0x00,0x00,0x0c,0x01,0x00,0x15,0x00,0x00,0x69,0x04,0x06,0x00,0x00,0x00,
+0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x0d,0x42,0x49,0x54,0x4f,0x52,0x20,0x3d,0x20,
+0x37,0x00,0x00,0x00,0x0d,0x00,0x00,0x16,0x00,0x00,0x00,0x05,0x42,0x49,0x54,0x4f,
+0x52,0x00,0x00,0x00,0x0c,0x01,0x00,0x17,0x00,0x00,0x69,0x04,0x07,0x00,0x00,0x00,
+0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x0e,0x42,0x49,0x54,0x58,0x4f,0x52,0x20,0x3d,
+0x20,0x34,0x36,0x00,0x0d,0x00,0x00,0x18,0x00,0x00,0x00,0x06,0x42,0x49,0x54,0x58,
+0x4f,0x52,0x00,0x00,0x0c,0x01,0x00,0x19,0x00,0x00,0x69,0x04,0x2e,0x00,0x00,0x00,
+0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x0f,0x4e,0x4f,0x54,0x20,0x3d,0x20,0x34,0x38,
+0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x1a,0x00,0x00,0x00,0x03,0x4e,0x4f,0x54,0x00,
+0x0c,0x01,0x00,0x1b,0x00,0x00,0x69,0x04,0x30,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,
+0x1f,0x03,0x00,0x10,0x42,0x49,0x54,0x4e,0x4f,0x54,0x20,0x3d,0x20,0x34,0x39,0x00,
+0x0d,0x00,0x00,0x1c,0x00,0x00,0x00,0x06,0x42,0x49,0x54,0x4e,0x4f,0x54,0x00,0x00,
+0x0c,0x01,0x00,0x1d,0x00,0x00,0x69,0x04,0x31,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,
+0x1f,0x03,0x00,0x12,0x4d,0x4f,0x56,0x45,0x20,0x3d,0x20,0x31,0x36,0x00,0x00,0x00,
+0x0d,0x00,0x00,0x1e,0x00,0x00,0x00,0x04,0x4d,0x4f,0x56,0x45,0x00,0x00,0x00,0x00,
+0x0c,0x01,0x00,0x1f,0x00,0x00,0x69,0x04,0x10,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,
+0x1f,0x03,0x00,0x13,0x4d,0x47,0x45,0x54,0x20,0x3d,0x20,0x39,0x00,0x00,0x00,0x00,
+0x0d,0x00,0x00,0x20,0x00,0x00,0x00,0x04,0x4d,0x47,0x45,0x54,0x00,0x00,0x00,0x00,
+0x0c,0x01,0x00,0x21,0x00,0x00,0x69,0x04,0x09,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,
+0x1f,0x03,0x00,0x14,0x4d,0x45,0x54,0x48,0x4f,0x44,0x20,0x3d,0x20,0x35,0x36,0x00,
+0x0d,0x00,0x00,0x22,0x00,0x00,0x00,0x06,0x4d,0x45,0x54,0x48,0x4f,0x44,0x00,0x00,
+0x0c,0x01,0x00,0x23,0x00,0x00,0x69,0x04,0x38,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,
+0x1f,0x03,0x00,0x15,0x47,0x45,0x54,0x20,0x3d,0x20,0x31,0x30,0x00,0x00,0x00,0x00,
+0x0d,0x00,0x00,0x24,0x00,0x00,0x00,0x03,0x47,0x45,0x54,0x00,0x0c,0x01,0x00,0x25,
+0x00,0x00,0x69,0x04,0x0a,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x16,
+0x53,0x45,0x54,0x20,0x3d,0x20,0x31,0x31,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x26,
+0x00,0x00,0x00,0x03,0x53,0x45,0x54,0x00,0x0c,0x01,0x00,0x27,0x00,0x00,0x69,0x04,
+0x0b,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x17,0x49,0x54,0x45,0x52,
+0x20,0x3d,0x20,0x34,0x33,0x00,0x00,0x00,0x0d,0x00,0x00,0x28,0x00,0x00,0x00,0x04,
+0x49,0x54,0x45,0x52,0x00,0x00,0x00,0x00,0x0c,0x01,0x00,0x29,0x00,0x00,0x69,0x04,
+0x2b,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x18,0x52,0x41,0x4e,0x47,
+0x45,0x20,0x3d,0x20,0x35,0x38,0x00,0x00,0x0d,0x00,0x00,0x2a,0x00,0x00,0x00,0x05,
+0x52,0x41,0x4e,0x47,0x45,0x00,0x00,0x00,0x0c,0x01,0x00,0x2b,0x00,0x00,0x69,0x04,
+0x3a,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x19,0x46,0x4f,0x52,0x20,
+0x3d,0x20,0x35,0x39,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x2c,0x00,0x00,0x00,0x03,
+0x46,0x4f,0x52,0x00,0x0c,0x01,0x00,0x2d,0x00,0x00,0x69,0x04,0x3b,0x00,0x00,0x00,
+0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x1b,0x4c,0x45,0x4e,0x20,0x3d,0x20,0x33,0x30,
+0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x2e,0x00,0x00,0x00,0x03,0x4c,0x45,0x4e,0x00,
+0x0c,0x01,0x00,0x2f,0x00,0x00,0x69,0x04,0x1e,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,
+0x1f,0x03,0x00,0x1c,0x47,0x47,0x45,0x54,0x20,0x3d,0x20,0x31,0x34,0x00,0x00,0x00,
+0x0d,0x00,0x00,0x30,0x00,0x00,0x00,0x04,0x47,0x47,0x45,0x54,0x00,0x00,0x00,0x00,
+0x0c,0x01,0x00,0x31,0x00,0x00,0x69,0x04,0x0e,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,
+0x1f,0x03,0x00,0x1d,0x47,0x53,0x45,0x54,0x20,0x3d,0x20,0x31,0x35,0x00,0x00,0x00,
+0x0d,0x00,0x00,0x32,0x00,0x00,0x00,0x04,0x47,0x53,0x45,0x54,0x00,0x00,0x00,0x00,
+0x0c,0x01,0x00,0x33,0x00,0x00,0x69,0x04,0x0f,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,
+0x1f,0x03,0x00,0x1e,0x49,0x47,0x45,0x54,0x20,0x3d,0x20,0x33,0x33,0x00,0x00,0x00,
+0x0d,0x00,0x00,0x34,0x00,0x00,0x00,0x04,0x49,0x47,0x45,0x54,0x00,0x00,0x00,0x00,
+0x0c,0x01,0x00,0x35,0x00,0x00,0x69,0x04,0x21,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,
+0x1f,0x03,0x00,0x1f,0x44,0x45,0x4c,0x20,0x3d,0x20,0x34,0x34,0x00,0x00,0x00,0x00,
+0x0d,0x00,0x00,0x36,0x00,0x00,0x00,0x03,0x44,0x45,0x4c,0x00,0x0c,0x01,0x00,0x37,
+0x00,0x00,0x69,0x04,0x2c,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x20,
+0x55,0x50,0x44,0x41,0x54,0x45,0x20,0x3d,0x20,0x35,0x30,0x00,0x0d,0x00,0x00,0x38,
+0x00,0x00,0x00,0x06,0x55,0x50,0x44,0x41,0x54,0x45,0x00,0x00,0x0c,0x01,0x00,0x39,
+0x00,0x00,0x69,0x04,0x32,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x22,
+0x44,0x45,0x46,0x20,0x3d,0x20,0x31,0x37,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x3a,
+0x00,0x00,0x00,0x03,0x44,0x45,0x46,0x00,0x0c,0x01,0x00,0x3b,0x00,0x00,0x69,0x04,
+0x11,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x23,0x50,0x41,0x53,0x53,
+0x20,0x3d,0x20,0x31,0x38,0x00,0x00,0x00,0x0d,0x00,0x00,0x3c,0x00,0x00,0x00,0x04,
+0x50,0x41,0x53,0x53,0x00,0x00,0x00,0x00,0x0c,0x01,0x00,0x3d,0x00,0x00,0x69,0x04,
+0x12,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x25,0x4a,0x55,0x4d,0x50,
+0x20,0x3d,0x20,0x31,0x39,0x00,0x00,0x00,0x0d,0x00,0x00,0x3e,0x00,0x00,0x00,0x04,
+0x4a,0x55,0x4d,0x50,0x00,0x00,0x00,0x00,0x0c,0x01,0x00,0x3f,0x00,0x00,0x69,0x04,
+0x13,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x26,0x43,0x41,0x4c,0x4c,
+0x20,0x3d,0x20,0x32,0x30,0x00,0x00,0x00,0x0d,0x00,0x00,0x40,0x00,0x00,0x00,0x04,
+0x43,0x41,0x4c,0x4c,0x00,0x00,0x00,0x00,0x0c,0x01,0x00,0x41,0x00,0x00,0x69,0x04,
+0x14,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x27,0x43,0x41,0x4c,0x4c,
+0x50,0x20,0x3d,0x20,0x35,0x35,0x00,0x00,0x0d,0x00,0x00,0x42,0x00,0x00,0x00,0x05,
+0x43,0x41,0x4c,0x4c,0x50,0x00,0x00,0x00,0x0c,0x01,0x00,0x43,0x00,0x00,0x69,0x04,
+0x37,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x28,0x43,0x41,0x4c,0x4c,
+0x4d,0x20,0x3d,0x20,0x35,0x37,0x00,0x00,0x0d,0x00,0x00,0x44,0x00,0x00,0x00,0x05,
+0x43,0x41,0x4c,0x4c,0x4d,0x00,0x00,0x00,0x0c,0x01,0x00,0x45,0x00,0x00,0x69,0x04,
+0x39,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x29,0x52,0x45,0x54,0x55,
+0x52,0x4e,0x20,0x3d,0x20,0x32,0x31,0x00,0x0d,0x00,0x00,0x46,0x00,0x00,0x00,0x06,
+0x52,0x45,0x54,0x55,0x52,0x4e,0x00,0x00,0x0c,0x01,0x00,0x47,0x00,0x00,0x69,0x04,
+0x15,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x02,0x00,0x2a,0x49,0x46,0x20,0x3d,
+0x20,0x32,0x32,0x00,0x0d,0x00,0x00,0x48,0x00,0x00,0x00,0x02,0x49,0x46,0x00,0x00,
+0x0c,0x01,0x00,0x49,0x00,0x00,0x69,0x04,0x16,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,
+0x1f,0x03,0x00,0x2b,0x49,0x46,0x4e,0x20,0x3d,0x20,0x34,0x37,0x00,0x00,0x00,0x00,
+0x0d,0x00,0x00,0x4a,0x00,0x00,0x00,0x03,0x49,0x46,0x4e,0x00,0x0c,0x01,0x00,0x4b,
+0x00,0x00,0x69,0x04,0x2f,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x2c,
+0x52,0x41,0x49,0x53,0x45,0x20,0x3d,0x20,0x33,0x38,0x00,0x00,0x0d,0x00,0x00,0x4c,
+0x00,0x00,0x00,0x05,0x52,0x41,0x49,0x53,0x45,0x00,0x00,0x00,0x0c,0x01,0x00,0x4d,
+0x00,0x00,0x69,0x04,0x26,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x2d,
+0x53,0x45,0x54,0x4a,0x4d,0x50,0x20,0x3d,0x20,0x33,0x39,0x00,0x0d,0x00,0x00,0x4e,
+0x00,0x00,0x00,0x06,0x53,0x45,0x54,0x4a,0x4d,0x50,0x00,0x00,0x0c,0x01,0x00,0x4f,
+0x00,0x00,0x69,0x04,0x27,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x2f,
+0x41,0x53,0x53,0x45,0x52,0x54,0x20,0x3d,0x20,0x32,0x33,0x00,0x0d,0x00,0x00,0x50,
+0x00,0x00,0x00,0x06,0x41,0x53,0x53,0x45,0x52,0x54,0x00,0x00,0x0c,0x01,0x00,0x51,
+0x00,0x00,0x69,0x04,0x17,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x31,
+0x4e,0x4f,0x54,0x49,0x4e,0x20,0x3d,0x20,0x38,0x00,0x00,0x00,0x0d,0x00,0x00,0x52,
+0x00,0x00,0x00,0x05,0x4e,0x4f,0x54,0x49,0x4e,0x00,0x00,0x00,0x0c,0x01,0x00,0x53,
+0x00,0x00,0x69,0x04,0x08,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x02,0x00,0x32,
+0x45,0x51,0x20,0x3d,0x20,0x32,0x34,0x00,0x0d,0x00,0x00,0x54,0x00,0x00,0x00,0x02,
+0x45,0x51,0x00,0x00,0x0c,0x01,0x00,0x55,0x00,0x00,0x69,0x04,0x18,0x00,0x00,0x00,
+0x0f,0x00,0x01,0x00,0x1f,0x02,0x00,0x33,0x4c,0x45,0x20,0x3d,0x20,0x32,0x35,0x00,
+0x0d,0x00,0x00,0x56,0x00,0x00,0x00,0x02,0x4c,0x45,0x00,0x00,0x0c,0x01,0x00,0x57,
+0x00,0x00,0x69,0x04,0x19,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x02,0x00,0x34,
+0x4c,0x54,0x20,0x3d,0x20,0x32,0x36,0x00,0x0d,0x00,0x00,0x58,0x00,0x00,0x00,0x02,
+0x4c,0x54,0x00,0x00,0x0c,0x01,0x00,0x59,0x00,0x00,0x69,0x04,0x1a,0x00,0x00,0x00,
+0x0f,0x00,0x01,0x00,0x1f,0x02,0x00,0x35,0x47,0x45,0x20,0x3d,0x20,0x35,0x33,0x00,
+0x0d,0x00,0x00,0x5a,0x00,0x00,0x00,0x02,0x47,0x45,0x00,0x00,0x0c,0x01,0x00,0x5b,
+0x00,0x00,0x69,0x04,0x35,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x02,0x00,0x36,
+0x47,0x54,0x20,0x3d,0x20,0x35,0x34,0x00,0x0d,0x00,0x00,0x5c,0x00,0x00,0x00,0x02,
+0x47,0x54,0x00,0x00,0x0c,0x01,0x00,0x5d,0x00,0x00,0x69,0x04,0x36,0x00,0x00,0x00,
+0x0f,0x00,0x01,0x00,0x1f,0x02,0x00,0x37,0x4e,0x45,0x20,0x3d,0x20,0x33,0x36,0x00,
+0x0d,0x00,0x00,0x5e,0x00,0x00,0x00,0x02,0x4e,0x45,0x00,0x00,0x0c,0x01,0x00,0x5f,
+0x00,0x00,0x69,0x04,0x24,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x02,0x00,0x38,
+0x49,0x4e,0x20,0x3d,0x20,0x33,0x37,0x00,0x0d,0x00,0x00,0x60,0x00,0x00,0x00,0x02,
+0x49,0x4e,0x00,0x00,0x0c,0x01,0x00,0x61,0x00,0x00,0x69,0x04,0x25,0x00,0x00,0x00,
+0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x3a,0x50,0x41,0x52,0x41,0x4d,0x53,0x20,0x3d,
+0x20,0x33,0x32,0x00,0x0d,0x00,0x00,0x62,0x00,0x00,0x00,0x06,0x50,0x41,0x52,0x41,
+0x4d,0x53,0x00,0x00,0x0c,0x01,0x00,0x63,0x00,0x00,0x69,0x04,0x20,0x00,0x00,0x00,
+0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x3b,0x4e,0x55,0x4d,0x42,0x45,0x52,0x20,0x3d,
+0x20,0x31,0x32,0x00,0x0d,0x00,0x00,0x64,0x00,0x00,0x00,0x06,0x4e,0x55,0x4d,0x42,
+0x45,0x52,0x00,0x00,0x0c,0x01,0x00,0x65,0x00,0x00,0x69,0x04,0x0c,0x00,0x00,0x00,
+0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x3c,0x53,0x54,0x52,0x49,0x4e,0x47,0x20,0x3d,
+0x20,0x31,0x33,0x00,0x0d,0x00,0x00,0x66,0x00,0x00,0x00,0x06,0x53,0x54,0x52,0x49,
+0x4e,0x47,0x00,0x00,0x0c,0x01,0x00,0x67,0x00,0x00,0x69,0x04,0x0d,0x00,0x00,0x00,
+0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x3d,0x44,0x49,0x43,0x54,0x20,0x3d,0x20,0x32,
+0x37,0x00,0x00,0x00,0x0d,0x00,0x00,0x68,0x00,0x00,0x00,0x04,0x44,0x49,0x43,0x54,
+0x00,0x00,0x00,0x00,0x0c,0x01,0x00,0x69,0x00,0x00,0x69,0x04,0x1b,0x00,0x00,0x00,
+0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x3e,0x4c,0x49,0x53,0x54,0x20,0x3d,0x20,0x32,
+0x38,0x00,0x00,0x00,0x0d,0x00,0x00,0x6a,0x00,0x00,0x00,0x04,0x4c,0x49,0x53,0x54,
+0x00,0x00,0x00,0x00,0x0c,0x01,0x00,0x6b,0x00,0x00,0x69,0x04,0x1c,0x00,0x00,0x00,
+0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x3f,0x4e,0x4f,0x4e,0x45,0x20,0x3d,0x20,0x32,
+0x39,0x00,0x00,0x00,0x0d,0x00,0x00,0x6c,0x00,0x00,0x00,0x04,0x4e,0x4f,0x4e,0x45,
+0x00,0x00,0x00,0x00,0x0c,0x01,0x00,0x6d,0x00,0x00,0x69,0x04,0x1d,0x00,0x00,0x00,
+0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x40,0x43,0x4c,0x41,0x53,0x53,0x20,0x3d,0x20,
+0x35,0x32,0x00,0x00,0x0d,0x00,0x00,0x6e,0x00,0x00,0x00,0x05,0x43,0x4c,0x41,0x53,
+0x53,0x00,0x00,0x00,0x0c,0x01,0x00,0x6f,0x00,0x00,0x69,0x04,0x34,0x00,0x00,0x00,
+0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x42,0x4c,0x49,0x4e,0x45,0x20,0x3d,0x20,0x33,
+0x31,0x00,0x00,0x00,0x0d,0x00,0x00,0x70,0x00,0x00,0x00,0x04,0x4c,0x49,0x4e,0x45,
+0x00,0x00,0x00,0x00,0x0c,0x01,0x00,0x71,0x00,0x00,0x69,0x04,0x1f,0x00,0x00,0x00,
+0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x43,0x46,0x49,0x4c,0x45,0x20,0x3d,0x20,0x33,
+0x34,0x00,0x00,0x00,0x0d,0x00,0x00,0x72,0x00,0x00,0x00,0x04,0x46,0x49,0x4c,0x45,
+0x00,0x00,0x00,0x00,0x0c,0x01,0x00,0x73,0x00,0x00,0x69,0x04,0x22,0x00,0x00,0x00,
+0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x44,0x4e,0x41,0x4d,0x45,0x20,0x3d,0x20,0x33,
+0x35,0x00,0x00,0x00,0x0d,0x00,0x00,0x74,0x00,0x00,0x00,0x04,0x4e,0x41,0x4d,0x45,
+0x00,0x00,0x00,0x00,0x0c,0x01,0x00,0x75,0x00,0x00,0x69,0x04,0x23,0x00,0x00,0x00,
+0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x46,0x52,0x45,0x47,0x53,0x20,0x3d,0x20,0x34,
+0x35,0x00,0x00,0x00,0x0d,0x00,0x00,0x76,0x00,0x00,0x00,0x04,0x52,0x45,0x47,0x53,
+0x00,0x00,0x00,0x00,0x0c,0x01,0x00,0x77,0x00,0x00,0x69,0x04,0x2d,0x00,0x00,0x00,
+0x0f,0x00,0x01,0x00,0x1f,0x03,0x00,0x47,0x56,0x41,0x52,0x20,0x3d,0x20,0x35,0x31,
+0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x78,0x00,0x00,0x00,0x03,0x56,0x41,0x52,0x00,
+0x0c,0x01,0x00,0x79,0x00,0x00,0x69,0x04,0x33,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,
+0x1f,0x04,0x00,0x4b,0x47,0x45,0x54,0x5f,0x4c,0x49,0x53,0x54,0x20,0x3d,0x20,0x36,
+0x30,0x00,0x00,0x00,0x0d,0x00,0x00,0x7a,0x00,0x00,0x00,0x08,0x47,0x45,0x54,0x5f,
+0x4c,0x49,0x53,0x54,0x00,0x00,0x00,0x00,0x0c,0x01,0x00,0x7b,0x00,0x00,0x69,0x04,
+0x3c,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x04,0x00,0x4c,0x47,0x45,0x54,0x5f,
+0x44,0x49,0x43,0x54,0x20,0x3d,0x20,0x36,0x31,0x00,0x00,0x00,0x0d,0x00,0x00,0x7c,
+0x00,0x00,0x00,0x08,0x47,0x45,0x54,0x5f,0x44,0x49,0x43,0x54,0x00,0x00,0x00,0x00,
+0x0c,0x01,0x00,0x7d,0x00,0x00,0x69,0x04,0x3d,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,
+0x1f,0x04,0x00,0x4d,0x47,0x45,0x54,0x5f,0x41,0x4e,0x59,0x20,0x3d,0x20,0x36,0x32,
+0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x7e,0x00,0x00,0x00,0x07,0x47,0x45,0x54,0x5f,
+0x41,0x4e,0x59,0x00,0x0c,0x01,0x00,0x7f,0x00,0x00,0x69,0x04,0x3e,0x00,0x00,0x00,
+0x0f,0x00,0x01,0x00,0x1f,0x04,0x00,0x4e,0x41,0x44,0x44,0x5f,0x49,0x4e,0x54,0x20,
+0x3d,0x20,0x36,0x33,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x80,0x00,0x00,0x00,0x07,
+0x41,0x44,0x44,0x5f,0x49,0x4e,0x54,0x00,0x0c,0x01,0x00,0x81,0x00,0x00,0x69,0x04,
+0x3f,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x04,0x00,0x4f,0x41,0x44,0x44,0x5f,
+0x46,0x4c,0x4f,0x41,0x54,0x20,0x3d,0x20,0x36,0x34,0x00,0x00,0x0d,0x00,0x00,0x82,
+0x00,0x00,0x00,0x09,0x41,0x44,0x44,0x5f,0x46,0x4c,0x4f,0x41,0x54,0x00,0x00,0x00,
+0x0c,0x01,0x00,0x83,0x00,0x00,0x69,0x04,0x40,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,
+0x1f,0x04,0x00,0x50,0x41,0x44,0x44,0x5f,0x41,0x4e,0x59,0x20,0x3d,0x20,0x36,0x35,
+0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x84,0x00,0x00,0x00,0x07,0x41,0x44,0x44,0x5f,
+0x41,0x4e,0x59,0x00,0x0c,0x01,0x00,0x85,0x00,0x00,0x69,0x04,0x41,0x00,0x00,0x00,
+0x0f,0x00,0x01,0x00,0x1f,0x04,0x00,0x51,0x49,0x54,0x45,0x52,0x5f,0x4c,0x49,0x53,
+0x54,0x20,0x3d,0x20,0x36,0x36,0x00,0x00,0x0d,0x00,0x00,0x86,0x00,0x00,0x00,0x09,
+0x49,0x54,0x45,0x52,0x5f,0x4c,0x49,0x53,0x54,0x00,0x00,0x00,0x0c,0x01,0x00,0x87,
+0x00,0x00,0x69,0x04,0x42,0x00,0x00,0x00,0x0f,0x00,0x01,0x00,0x1f,0x04,0x00,0x52,
+0x49,0x54,0x45,0x52,0x5f,0x41,0x4e,0x59,0x20,0x3d,0x20,0x36,0x37,0x00,0x00,0x00,
+0x0d,0x00,0x00,0x88,0x00,0x00,0x00,0x08,0x49,0x54,0x45,0x52,0x5f,0x41,0x4e,0x59,
+0x00,0x00,0x00,0x00,0x0c,0x01,0x00,0x89,0x00,0x00,0x69,0x04,0x43,0x00,0x00,0x00,
+0x0f,0x00,0x01,0x00,0x1f,0x05,0x00,0x54,0x64,0x65,0x66,0x20,0x5f,0x6d,0x61,0x6b,
+0x65,0x5f,0x64,0x69,0x63,0x74,0x73,0x28,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x05,
+0x2a,0x24,0x31,0x33,0x38,0x00,0x00,0x00,0x1c,0x01,0x00,0x00,0x1c,0x02,0x00,0x00,
+0x1d,0x03,0x00,0x00,0x1d,0x04,0x00,0x00,0x11,0x00,0x00,0xb8,0x2d,0x08,0x00,0x08,
+0x00,0x00,0x00,0x00,0x1f,0x05,0x00,0x54,0x64,0x65,0x66,0x20,0x5f,0x6d,0x61,0x6b,
+0x65,0x5f,0x64,0x69,0x63,0x74,0x73,0x28,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x0b,
+0x5f,0x5f,0x76,0x61,0x72,0x61,0x72,0x67,0x73,0x5f,0x5f,0x00,0x0d,0x00,0x00,0x00,
+0x00,0x00,0x00,0x1a,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x6f,0x70,0x63,0x6f,0x64,0x65,0x73,0x2e,0x70,0x79,0x00,0x00,
+0x22,0x00,0x00,0x00,0x0d,0x00,0x00,0x01,0x00,0x00,0x00,0x0b,0x5f,0x6d,0x61,0x6b,
+0x65,0x5f,0x64,0x69,0x63,0x74,0x73,0x00,0x23,0x00,0x00,0x00,0x1f,0x04,0x00,0x55,
+0x20,0x20,0x20,0x20,0x6e,0x61,0x6d,0x65,0x73,0x20,0x3d,0x20,0x7b,0x7d,0x00,0x00,
+0x33,0x00,0x00,0x05,0x6e,0x61,0x6d,0x65,0x73,0x00,0x00,0x00,0x1b,0x00,0x00,0x00,
+0x1f,0x04,0x00,0x56,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,0x73,0x20,0x3d,0x20,
+0x7b,0x7d,0x00,0x00,0x33,0x01,0x00,0x05,0x63,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,
+0x1b,0x01,0x00,0x00,0x1f,0x05,0x00,0x57,0x20,0x20,0x20,0x20,0x47,0x20,0x3d,0x20,
+0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x28,0x29,0x00,0x00,0x00,0x33,0x04,0x00,0x01,
+0x47,0x00,0x00,0x00,0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x07,0x67,0x6c,0x6f,0x62,
+0x61,0x6c,0x73,0x00,0x37,0x03,0x02,0x01,0x10,0x04,0x03,0x00,0x1f,0x04,0x00,0x58,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x6b,0x20,0x69,0x6e,0x20,0x47,0x3a,0x00,
+0x0c,0x02,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x03,0x04,0x02,
+0x13,0x00,0x00,0x66,0x33,0x05,0x00,0x01,0x6b,0x00,0x00,0x00,0x10,0x05,0x03,0x00,
+0x1f,0x0c,0x00,0x59,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,
+0x6f,0x74,0x20,0x28,0x6b,0x5b,0x30,0x5d,0x20,0x3e,0x3d,0x20,0x27,0x41,0x27,0x20,
+0x61,0x6e,0x64,0x20,0x6b,0x5b,0x30,0x5d,0x20,0x3c,0x3d,0x20,0x27,0x5a,0x27,0x29,
+0x3a,0x00,0x00,0x00,0x0c,0x07,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x06,0x05,0x07,0x0d,0x07,0x00,0x04,0x00,0x00,0x00,0x01,0x41,0x00,0x00,0x00,
+0x35,0x06,0x06,0x07,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x09,0x0c,0x07,0x00,0x03,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x06,0x05,0x07,0x0d,0x07,0x00,0x05,
+0x00,0x00,0x00,0x01,0x5a,0x00,0x00,0x00,0x19,0x06,0x06,0x07,0x30,0x03,0x06,0x00,
+0x16,0x03,0x00,0x00,0x13,0x00,0x00,0x09,0x1f,0x06,0x00,0x5a,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,
+0x00,0x00,0x00,0x00,0x13,0x00,0xff,0xd2,0x1f,0x06,0x00,0x5b,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6e,0x61,0x6d,0x65,0x73,0x5b,0x47,0x5b,0x6b,0x5d,0x5d,0x20,
+0x3d,0x20,0x6b,0x00,0x0a,0x03,0x04,0x05,0x0b,0x00,0x03,0x05,0x1f,0x06,0x00,0x5c,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6b,0x20,0x69,0x6e,0x20,
+0x63,0x6f,0x64,0x65,0x73,0x3a,0x00,0x00,0x25,0x03,0x05,0x01,0x16,0x03,0x00,0x00,
+0x13,0x00,0x00,0x1c,0x1f,0x0c,0x00,0x5d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x61,0x69,0x73,0x65,0x20,0x45,0x78,0x63,0x65,0x70,0x74,
+0x69,0x6f,0x6e,0x28,0x22,0x64,0x75,0x70,0x6c,0x69,0x63,0x61,0x74,0x65,0x64,0x20,
+0x63,0x6f,0x64,0x65,0x73,0x22,0x29,0x00,0x0e,0x06,0x00,0x06,0x00,0x00,0x00,0x09,
+0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x00,0x00,0x00,0x0d,0x07,0x00,0x07,
+0x00,0x00,0x00,0x10,0x64,0x75,0x70,0x6c,0x69,0x63,0x61,0x74,0x65,0x64,0x20,0x63,
+0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x00,0x37,0x03,0x06,0x02,0x26,0x03,0x00,0x00,
+0x1f,0x06,0x00,0x5e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x64,0x65,
+0x73,0x5b,0x6b,0x5d,0x20,0x3d,0x20,0x47,0x5b,0x6b,0x5d,0x00,0x0a,0x03,0x04,0x05,
+0x0b,0x01,0x05,0x03,0x13,0x00,0xff,0x9a,0x1f,0x06,0x00,0x5f,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6e,0x61,0x6d,0x65,0x73,0x2c,0x20,0x63,0x6f,
+0x64,0x65,0x73,0x00,0x10,0x06,0x00,0x00,0x10,0x07,0x01,0x00,0x1c,0x03,0x06,0x02,
+0x15,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x8a,0x00,0x00,0x00,0x0b,
+0x5f,0x6d,0x61,0x6b,0x65,0x5f,0x64,0x69,0x63,0x74,0x73,0x00,0x0f,0x01,0x00,0x00,
+0x1f,0x08,0x00,0x61,0x6e,0x61,0x6d,0x65,0x73,0x2c,0x20,0x63,0x6f,0x64,0x65,0x73,
+0x20,0x3d,0x20,0x5f,0x6d,0x61,0x6b,0x65,0x5f,0x64,0x69,0x63,0x74,0x73,0x28,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x8a,0x00,0x00,0x00,0x0b,0x5f,0x6d,0x61,0x6b,
+0x65,0x5f,0x64,0x69,0x63,0x74,0x73,0x00,0x37,0x01,0x02,0x01,0x33,0x01,0x00,0x05,
+0x2a,0x24,0x31,0x34,0x34,0x00,0x00,0x00,0x0d,0x02,0x00,0x8b,0x00,0x00,0x00,0x05,
+0x6e,0x61,0x6d,0x65,0x73,0x00,0x00,0x00,0x0c,0x04,0x00,0x03,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x03,0x01,0x04,0x0f,0x02,0x03,0x00,0x0d,0x02,0x00,0x8c,
+0x00,0x00,0x00,0x05,0x63,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x0c,0x04,0x00,0x05,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x03,0x01,0x04,0x0f,0x02,0x03,0x00,
+0x1f,0x05,0x00,0x63,0x64,0x65,0x66,0x20,0x63,0x72,0x65,0x61,0x74,0x65,0x5f,0x63,
+0x63,0x6f,0x64,0x65,0x28,0x29,0x3a,0x00,0x33,0x01,0x00,0x05,0x2a,0x24,0x31,0x35,
+0x32,0x00,0x00,0x00,0x1c,0x02,0x00,0x00,0x1c,0x03,0x00,0x00,0x1d,0x04,0x00,0x00,
+0x1d,0x05,0x00,0x00,0x11,0x01,0x02,0x68,0x2d,0x12,0x00,0x19,0x00,0x00,0x00,0x08,
+0x1f,0x05,0x00,0x63,0x64,0x65,0x66,0x20,0x63,0x72,0x65,0x61,0x74,0x65,0x5f,0x63,
+0x63,0x6f,0x64,0x65,0x28,0x29,0x3a,0x00,0x33,0x00,0x00,0x0b,0x5f,0x5f,0x76,0x61,
+0x72,0x61,0x72,0x67,0x73,0x5f,0x5f,0x00,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x1a,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x6f,0x70,0x63,0x6f,0x64,0x65,0x73,0x2e,0x70,0x79,0x00,0x00,0x22,0x00,0x00,0x00,
+0x0d,0x00,0x00,0x01,0x00,0x00,0x00,0x0c,0x63,0x72,0x65,0x61,0x74,0x65,0x5f,0x63,
+0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x1f,0x04,0x00,0x64,
+0x20,0x20,0x20,0x20,0x6c,0x69,0x6e,0x65,0x73,0x20,0x3d,0x20,0x5b,0x5d,0x00,0x00,
+0x33,0x00,0x00,0x05,0x6c,0x69,0x6e,0x65,0x73,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,
+0x1f,0x04,0x00,0x65,0x20,0x20,0x20,0x20,0x63,0x61,0x73,0x65,0x73,0x20,0x3d,0x20,
+0x5b,0x5d,0x00,0x00,0x33,0x01,0x00,0x05,0x63,0x61,0x73,0x65,0x73,0x00,0x00,0x00,
+0x1c,0x01,0x00,0x00,0x1f,0x04,0x00,0x66,0x20,0x20,0x20,0x20,0x6c,0x61,0x62,0x65,
+0x6c,0x73,0x20,0x3d,0x20,0x5b,0x5d,0x00,0x33,0x03,0x00,0x06,0x6c,0x61,0x62,0x65,
+0x6c,0x73,0x00,0x00,0x1c,0x02,0x00,0x00,0x10,0x03,0x02,0x00,0x1f,0x06,0x00,0x68,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x6e,0x61,0x6d,0x65,0x20,0x69,0x6e,0x20,
+0x63,0x6f,0x64,0x65,0x73,0x3a,0x00,0x00,0x0e,0x04,0x00,0x02,0x00,0x00,0x00,0x05,
+0x63,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x0c,0x05,0x00,0x03,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x2b,0x02,0x04,0x05,0x13,0x00,0x00,0xa6,0x33,0x06,0x00,0x04,
+0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,0x10,0x06,0x02,0x00,0x1f,0x07,0x00,0x69,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x76,0x61,0x6c,0x20,0x3d,0x20,0x63,
+0x6f,0x64,0x65,0x73,0x5b,0x6e,0x61,0x6d,0x65,0x5d,0x00,0x00,0x33,0x02,0x00,0x04,
+0x63,0x76,0x61,0x6c,0x00,0x00,0x00,0x00,0x0e,0x07,0x00,0x02,0x00,0x00,0x00,0x05,
+0x63,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x0a,0x02,0x07,0x06,0x1f,0x08,0x00,0x6a,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6e,0x61,0x6d,0x65,0x20,0x3d,0x20,
+0x22,0x54,0x50,0x5f,0x49,0x22,0x20,0x2b,0x20,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,
+0x33,0x07,0x00,0x05,0x63,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x0d,0x08,0x00,0x04,
+0x00,0x00,0x00,0x04,0x54,0x50,0x5f,0x49,0x00,0x00,0x00,0x00,0x01,0x07,0x08,0x06,
+0x1f,0x11,0x00,0x6b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x69,0x6e,0x65,
+0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x22,0x23,0x64,0x65,0x66,0x69,0x6e,
+0x65,0x20,0x22,0x20,0x2b,0x20,0x63,0x6e,0x61,0x6d,0x65,0x20,0x2b,0x20,0x22,0x20,
+0x22,0x20,0x2b,0x20,0x73,0x74,0x72,0x28,0x63,0x76,0x61,0x6c,0x29,0x20,0x2b,0x20,
+0x22,0x20,0x22,0x29,0x00,0x00,0x00,0x00,0x0d,0x0c,0x00,0x05,0x00,0x00,0x00,0x06,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x09,0x00,0x0c,0x00,0x00,0x00,0x00,
+0x0d,0x0b,0x00,0x06,0x00,0x00,0x00,0x08,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,
+0x00,0x00,0x00,0x00,0x01,0x0b,0x0b,0x07,0x0d,0x0c,0x00,0x07,0x00,0x00,0x00,0x01,
+0x20,0x00,0x00,0x00,0x01,0x0b,0x0b,0x0c,0x0e,0x0d,0x00,0x08,0x00,0x00,0x00,0x03,
+0x73,0x74,0x72,0x00,0x10,0x0e,0x02,0x00,0x37,0x0c,0x0d,0x02,0x01,0x0b,0x0b,0x0c,
+0x0d,0x0c,0x00,0x07,0x00,0x00,0x00,0x01,0x20,0x00,0x00,0x00,0x01,0x0b,0x0b,0x0c,
+0x39,0x08,0x09,0x03,0x1f,0x11,0x00,0x6c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x63,0x61,0x73,0x65,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x22,0x63,0x61,
+0x73,0x65,0x20,0x22,0x20,0x2b,0x20,0x63,0x6e,0x61,0x6d,0x65,0x20,0x2b,0x20,0x27,
+0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x22,0x27,0x20,0x2b,0x20,0x6e,0x61,
+0x6d,0x65,0x20,0x2b,0x20,0x27,0x22,0x3b,0x27,0x29,0x00,0x00,0x0d,0x0c,0x00,0x05,
+0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x09,0x01,0x0c,
+0x00,0x00,0x00,0x01,0x0d,0x0b,0x00,0x09,0x00,0x00,0x00,0x05,0x63,0x61,0x73,0x65,
+0x20,0x00,0x00,0x00,0x01,0x0b,0x0b,0x07,0x0d,0x0c,0x00,0x0a,0x00,0x00,0x00,0x0a,
+0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x22,0x00,0x00,0x01,0x0b,0x0b,0x0c,
+0x01,0x0b,0x0b,0x06,0x0d,0x0c,0x00,0x0b,0x00,0x00,0x00,0x02,0x22,0x3b,0x00,0x00,
+0x01,0x0b,0x0b,0x0c,0x39,0x08,0x09,0x03,0x1f,0x11,0x00,0x6d,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6c,0x61,0x62,0x65,0x6c,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,
+0x64,0x28,0x22,0x20,0x20,0x20,0x20,0x5b,0x22,0x20,0x2b,0x20,0x63,0x6e,0x61,0x6d,
+0x65,0x20,0x2b,0x20,0x22,0x5d,0x20,0x3d,0x20,0x4c,0x28,0x22,0x20,0x2b,0x20,0x6e,
+0x61,0x6d,0x65,0x20,0x2b,0x20,0x22,0x29,0x2c,0x20,0x5c,0x5c,0x22,0x29,0x00,0x00,
+0x0d,0x0c,0x00,0x05,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x09,0x03,0x0c,0x00,0x00,0x00,0x02,0x0d,0x0b,0x00,0x0c,0x00,0x00,0x00,0x05,
+0x20,0x20,0x20,0x20,0x5b,0x00,0x00,0x00,0x01,0x0b,0x0b,0x07,0x0d,0x0c,0x00,0x0d,
+0x00,0x00,0x00,0x06,0x5d,0x20,0x3d,0x20,0x4c,0x28,0x00,0x00,0x01,0x0b,0x0b,0x0c,
+0x01,0x0b,0x0b,0x06,0x0d,0x0c,0x00,0x0e,0x00,0x00,0x00,0x04,0x29,0x2c,0x20,0x5c,
+0x00,0x00,0x00,0x00,0x01,0x0b,0x0b,0x0c,0x39,0x08,0x09,0x03,0x13,0x00,0xff,0x5a,
+0x1f,0x0b,0x00,0x6f,0x20,0x20,0x20,0x20,0x63,0x61,0x73,0x65,0x73,0x2e,0x61,0x70,
+0x70,0x65,0x6e,0x64,0x28,0x22,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x20,0x3a,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x4e,0x55,0x4c,0x4c,0x3b,0x22,0x29,0x3b,0x00,
+0x0d,0x05,0x00,0x05,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x08,0x01,0x05,0x00,0x00,0x00,0x03,0x0d,0x0a,0x00,0x0f,0x00,0x00,0x00,0x16,
+0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x20,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+0x20,0x4e,0x55,0x4c,0x4c,0x3b,0x00,0x00,0x39,0x04,0x08,0x03,0x1f,0x14,0x00,0x70,
+0x20,0x20,0x20,0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x20,0x3d,0x20,0x22,0x2f,0x2a,
+0x20,0x47,0x65,0x6e,0x65,0x72,0x61,0x74,0x65,0x64,0x20,0x66,0x72,0x6f,0x6d,0x20,
+0x6f,0x70,0x63,0x6f,0x64,0x65,0x73,0x2e,0x70,0x79,0x20,0x77,0x69,0x74,0x68,0x20,
+0x74,0x70,0x63,0x20,0x2d,0x78,0x2e,0x20,0x44,0x6f,0x20,0x6e,0x6f,0x74,0x20,0x6d,
+0x6f,0x64,0x69,0x66,0x79,0x2e,0x20,0x2a,0x2f,0x5c,0x6e,0x22,0x00,0x00,0x00,0x00,
+0x33,0x04,0x00,0x06,0x68,0x65,0x61,0x64,0x65,0x72,0x00,0x00,0x0d,0x04,0x00,0x10,
+0x00,0x00,0x00,0x3c,0x2f,0x2a,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,0x74,0x65,0x64,
+0x20,0x66,0x72,0x6f,0x6d,0x20,0x6f,0x70,0x63,0x6f,0x64,0x65,0x73,0x2e,0x70,0x79,
+0x20,0x77,0x69,0x74,0x68,0x20,0x74,0x70,0x63,0x20,0x2d,0x78,0x2e,0x20,0x44,0x6f,
+0x20,0x6e,0x6f,0x74,0x20,0x6d,0x6f,0x64,0x69,0x66,0x79,0x2e,0x20,0x2a,0x2f,0x0a,
+0x00,0x00,0x00,0x00,0x1f,0x08,0x00,0x71,0x20,0x20,0x20,0x20,0x65,0x6e,0x75,0x6d,
+0x73,0x20,0x3d,0x20,0x27,0x5c,0x6e,0x27,0x2e,0x6a,0x6f,0x69,0x6e,0x28,0x6c,0x69,
+0x6e,0x65,0x73,0x29,0x00,0x00,0x00,0x00,0x33,0x05,0x00,0x05,0x65,0x6e,0x75,0x6d,
+0x73,0x00,0x00,0x00,0x0d,0x0c,0x00,0x11,0x00,0x00,0x00,0x01,0x0a,0x00,0x00,0x00,
+0x0d,0x0d,0x00,0x12,0x00,0x00,0x00,0x04,0x6a,0x6f,0x69,0x6e,0x00,0x00,0x00,0x00,
+0x38,0x09,0x0c,0x0d,0x00,0x00,0x00,0x04,0x10,0x0b,0x00,0x00,0x39,0x05,0x09,0x03,
+0x1f,0x10,0x00,0x72,0x20,0x20,0x20,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,
+0x65,0x20,0x3d,0x20,0x28,0x22,0x63,0x68,0x61,0x72,0x20,0x2a,0x20,0x74,0x70,0x5f,
+0x67,0x65,0x74,0x5f,0x6f,0x70,0x63,0x6f,0x64,0x65,0x5f,0x6e,0x61,0x6d,0x65,0x28,
+0x69,0x6e,0x74,0x20,0x6f,0x70,0x63,0x6f,0x64,0x65,0x29,0x20,0x7b,0x5c,0x6e,0x22,
+0x00,0x00,0x00,0x00,0x33,0x08,0x00,0x09,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,
+0x65,0x00,0x00,0x00,0x1f,0x05,0x00,0x75,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2b,
+0x20,0x22,0x5c,0x6e,0x7d,0x5c,0x6e,0x7d,0x5c,0x6e,0x22,0x00,0x1f,0x07,0x00,0x74,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2b,0x20,0x27,0x5c,0x6e,0x27,0x2e,0x6a,0x6f,
+0x69,0x6e,0x28,0x63,0x61,0x73,0x65,0x73,0x29,0x00,0x00,0x00,0x1f,0x08,0x00,0x73,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2b,0x20,0x22,0x73,0x77,0x69,0x74,0x63,0x68,
+0x28,0x6f,0x70,0x63,0x6f,0x64,0x65,0x29,0x20,0x7b,0x5c,0x6e,0x22,0x00,0x00,0x00,
+0x1f,0x10,0x00,0x72,0x20,0x20,0x20,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,
+0x65,0x20,0x3d,0x20,0x28,0x22,0x63,0x68,0x61,0x72,0x20,0x2a,0x20,0x74,0x70,0x5f,
+0x67,0x65,0x74,0x5f,0x6f,0x70,0x63,0x6f,0x64,0x65,0x5f,0x6e,0x61,0x6d,0x65,0x28,
+0x69,0x6e,0x74,0x20,0x6f,0x70,0x63,0x6f,0x64,0x65,0x29,0x20,0x7b,0x5c,0x6e,0x22,
+0x00,0x00,0x00,0x00,0x0d,0x09,0x00,0x13,0x00,0x00,0x00,0x28,0x63,0x68,0x61,0x72,
+0x20,0x2a,0x20,0x74,0x70,0x5f,0x67,0x65,0x74,0x5f,0x6f,0x70,0x63,0x6f,0x64,0x65,
+0x5f,0x6e,0x61,0x6d,0x65,0x28,0x69,0x6e,0x74,0x20,0x6f,0x70,0x63,0x6f,0x64,0x65,
+0x29,0x20,0x7b,0x0a,0x00,0x00,0x00,0x00,0x1f,0x08,0x00,0x73,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x2b,0x20,0x22,0x73,0x77,0x69,0x74,0x63,0x68,0x28,0x6f,0x70,0x63,
+0x6f,0x64,0x65,0x29,0x20,0x7b,0x5c,0x6e,0x22,0x00,0x00,0x00,0x0d,0x0a,0x00,0x14,
+0x00,0x00,0x00,0x11,0x73,0x77,0x69,0x74,0x63,0x68,0x28,0x6f,0x70,0x63,0x6f,0x64,
+0x65,0x29,0x20,0x7b,0x0a,0x00,0x00,0x00,0x01,0x09,0x09,0x0a,0x1f,0x07,0x00,0x74,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2b,0x20,0x27,0x5c,0x6e,0x27,0x2e,0x6a,0x6f,
+0x69,0x6e,0x28,0x63,0x61,0x73,0x65,0x73,0x29,0x00,0x00,0x00,0x0d,0x0e,0x00,0x11,
+0x00,0x00,0x00,0x01,0x0a,0x00,0x00,0x00,0x0d,0x0f,0x00,0x12,0x00,0x00,0x00,0x04,
+0x6a,0x6f,0x69,0x6e,0x00,0x00,0x00,0x00,0x38,0x0b,0x0e,0x0f,0x00,0x00,0x00,0x05,
+0x10,0x0d,0x01,0x00,0x39,0x0a,0x0b,0x03,0x01,0x09,0x09,0x0a,0x1f,0x05,0x00,0x75,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2b,0x20,0x22,0x5c,0x6e,0x7d,0x5c,0x6e,0x7d,
+0x5c,0x6e,0x22,0x00,0x0d,0x0a,0x00,0x15,0x00,0x00,0x00,0x05,0x0a,0x7d,0x0a,0x7d,
+0x0a,0x00,0x00,0x00,0x01,0x08,0x09,0x0a,0x1f,0x10,0x00,0x7a,0x20,0x20,0x20,0x20,
+0x64,0x69,0x73,0x70,0x61,0x74,0x63,0x68,0x20,0x3d,0x20,0x28,0x22,0x23,0x64,0x65,
+0x66,0x69,0x6e,0x65,0x20,0x54,0x50,0x5f,0x44,0x49,0x53,0x50,0x41,0x54,0x43,0x48,
+0x5f,0x54,0x41,0x42,0x4c,0x45,0x28,0x4c,0x2c,0x20,0x44,0x45,0x46,0x41,0x55,0x4c,
+0x54,0x29,0x20,0x7b,0x20,0x5c,0x5c,0x5c,0x6e,0x22,0x00,0x00,0x33,0x09,0x00,0x08,
+0x64,0x69,0x73,0x70,0x61,0x74,0x63,0x68,0x00,0x00,0x00,0x00,0x1f,0x05,0x00,0x7d,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2b,0x20,0x22,0x5c,0x6e,0x7d,0x5c,0x6e,0x22,
+0x00,0x00,0x00,0x00,0x1f,0x07,0x00,0x7c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2b,
+0x20,0x27,0x5c,0x6e,0x27,0x2e,0x6a,0x6f,0x69,0x6e,0x28,0x6c,0x61,0x62,0x65,0x6c,
+0x73,0x29,0x00,0x00,0x1f,0x0b,0x00,0x7b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2b,
+0x20,0x22,0x20,0x20,0x20,0x20,0x5b,0x30,0x20,0x2e,0x2e,0x2e,0x20,0x32,0x35,0x35,
+0x5d,0x20,0x3d,0x20,0x44,0x45,0x46,0x41,0x55,0x4c,0x54,0x2c,0x20,0x5c,0x5c,0x5c,
+0x6e,0x22,0x00,0x00,0x1f,0x10,0x00,0x7a,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x70,
+0x61,0x74,0x63,0x68,0x20,0x3d,0x20,0x28,0x22,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,
+0x20,0x54,0x50,0x5f,0x44,0x49,0x53,0x50,0x41,0x54,0x43,0x48,0x5f,0x54,0x41,0x42,
+0x4c,0x45,0x28,0x4c,0x2c,0x20,0x44,0x45,0x46,0x41,0x55,0x4c,0x54,0x29,0x20,0x7b,
+0x20,0x5c,0x5c,0x5c,0x6e,0x22,0x00,0x00,0x0d,0x0a,0x00,0x16,0x00,0x00,0x00,0x2a,
+0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x54,0x50,0x5f,0x44,0x49,0x53,0x50,0x41,
+0x54,0x43,0x48,0x5f,0x54,0x41,0x42,0x4c,0x45,0x28,0x4c,0x2c,0x20,0x44,0x45,0x46,
+0x41,0x55,0x4c,0x54,0x29,0x20,0x7b,0x20,0x5c,0x0a,0x00,0x00,0x1f,0x0b,0x00,0x7b,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2b,0x20,0x22,0x20,0x20,0x20,0x20,0x5b,0x30,
+0x20,0x2e,0x2e,0x2e,0x20,0x32,0x35,0x35,0x5d,0x20,0x3d,0x20,0x44,0x45,0x46,0x41,
+0x55,0x4c,0x54,0x2c,0x20,0x5c,0x5c,0x5c,0x6e,0x22,0x00,0x00,0x0d,0x0b,0x00,0x17,
+0x00,0x00,0x00,0x1d,0x20,0x20,0x20,0x20,0x5b,0x30,0x20,0x2e,0x2e,0x2e,0x20,0x32,
+0x35,0x35,0x5d,0x20,0x3d,0x20,0x44,0x45,0x46,0x41,0x55,0x4c,0x54,0x2c,0x20,0x5c,
+0x0a,0x00,0x00,0x00,0x01,0x0a,0x0a,0x0b,0x1f,0x07,0x00,0x7c,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x2b,0x20,0x27,0x5c,0x6e,0x27,0x2e,0x6a,0x6f,0x69,0x6e,0x28,0x6c,
+0x61,0x62,0x65,0x6c,0x73,0x29,0x00,0x00,0x0d,0x0f,0x00,0x11,0x00,0x00,0x00,0x01,
+0x0a,0x00,0x00,0x00,0x0d,0x10,0x00,0x12,0x00,0x00,0x00,0x04,0x6a,0x6f,0x69,0x6e,
+0x00,0x00,0x00,0x00,0x38,0x0c,0x0f,0x10,0x00,0x00,0x00,0x06,0x10,0x0e,0x03,0x00,
+0x39,0x0b,0x0c,0x03,0x01,0x0a,0x0a,0x0b,0x1f,0x05,0x00,0x7d,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x2b,0x20,0x22,0x5c,0x6e,0x7d,0x5c,0x6e,0x22,0x00,0x00,0x00,0x00,
+0x0d,0x0b,0x00,0x18,0x00,0x00,0x00,0x03,0x0a,0x7d,0x0a,0x00,0x01,0x09,0x0a,0x0b,
+0x1f,0x0f,0x00,0x7f,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x27,
+0x5c,0x6e,0x27,0x2e,0x6a,0x6f,0x69,0x6e,0x28,0x5b,0x68,0x65,0x61,0x64,0x65,0x72,
+0x2c,0x20,0x65,0x6e,0x75,0x6d,0x73,0x2c,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,
+0x74,0x65,0x2c,0x20,0x64,0x69,0x73,0x70,0x61,0x74,0x63,0x68,0x5d,0x29,0x00,0x00,
+0x0d,0x0e,0x00,0x11,0x00,0x00,0x00,0x01,0x0a,0x00,0x00,0x00,0x0d,0x0f,0x00,0x12,
+0x00,0x00,0x00,0x04,0x6a,0x6f,0x69,0x6e,0x00,0x00,0x00,0x00,0x38,0x0b,0x0e,0x0f,
+0x00,0x00,0x00,0x07,0x10,0x0e,0x04,0x00,0x10,0x0f,0x05,0x00,0x10,0x10,0x08,0x00,
+0x10,0x11,0x09,0x00,0x1c,0x0d,0x0e,0x04,0x39,0x0a,0x0b,0x03,0x15,0x0a,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x8d,0x00,0x00,0x00,0x0c,0x63,0x72,0x65,0x61,
+0x74,0x65,0x5f,0x63,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0f,0x02,0x01,0x00,
+0x00,0x00,0x00,0x00,
+};
+
+static tpd_code * _tp_tinypy_compiler_opcodes_0(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 5: goto L5;
+        case 14: goto L14;
+        case 15: goto L15;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 22: goto L22;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 29: goto L29;
+        case 32: goto L32;
+        case 35: goto L35;
+        case 36: goto L36;
+        case 39: goto L39;
+        case 42: goto L42;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 49: goto L49;
+        case 52: goto L52;
+        case 55: goto L55;
+        case 56: goto L56;
+        case 59: goto L59;
+        case 62: goto L62;
+        case 65: goto L65;
+        case 66: goto L66;
+        case 69: goto L69;
+        case 72: goto L72;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 80: goto L80;
+        case 83: goto L83;
+        case 86: goto L86;
+        case 87: goto L87;
+        case 91: goto L91;
+        case 94: goto L94;
+        case 97: goto L97;
+        case 98: goto L98;
+        case 102: goto L102;
+        case 105: goto L105;
+        case 108: goto L108;
+        case 109: goto L109;
+        case 113: goto L113;
+        case 117: goto L117;
+        case 120: goto L120;
+        case 121: goto L121;
+        case 125: goto L125;
+        case 129: goto L129;
+        case 132: goto L132;
+        case 133: goto L133;
+        case 137: goto L137;
+        case 141: goto L141;
+        case 144: goto L144;
+        case 145: goto L145;
+        case 149: goto L149;
+        case 152: goto L152;
+        case 155: goto L155;
+        case 156: goto L156;
+        case 160: goto L160;
+        case 164: goto L164;
+        case 167: goto L167;
+        case 168: goto L168;
+        case 172: goto L172;
+        case 176: goto L176;
+        case 179: goto L179;
+        case 180: goto L180;
+        case 184: goto L184;
+        case 188: goto L188;
+        case 191: goto L191;
+        case 192: goto L192;
+        case 196: goto L196;
+        case 200: goto L200;
+        case 203: goto L203;
+        case 204: goto L204;
+        case 208: goto L208;
+        case 211: goto L211;
+        case 214: goto L214;
+        case 215: goto L215;
+        case 219: goto L219;
+        case 222: goto L222;
+        case 225: goto L225;
+        case 226: goto L226;
+        case 230: goto L230;
+        case 234: goto L234;
+        case 237: goto L237;
+        case 238: goto L238;
+        case 242: goto L242;
+        case 246: goto L246;
+        case 249: goto L249;
+        case 250: goto L250;
+        case 254: goto L254;
+        case 257: goto L257;
+        case 260: goto L260;
+        case 261: goto L261;
+        case 265: goto L265;
+        case 268: goto L268;
+        case 271: goto L271;
+        case 272: goto L272;
+        case 276: goto L276;
+        case 280: goto L280;
+        case 283: goto L283;
+        case 284: goto L284;
+        case 288: goto L288;
+        case 292: goto L292;
+        case 295: goto L295;
+        case 296: goto L296;
+        case 300: goto L300;
+        case 304: goto L304;
+        case 307: goto L307;
+        case 308: goto L308;
+        case 312: goto L312;
+        case 315: goto L315;
+        case 318: goto L318;
+        case 319: goto L319;
+        case 323: goto L323;
+        case 327: goto L327;
+        case 330: goto L330;
+        case 331: goto L331;
+        case 335: goto L335;
+        case 338: goto L338;
+        case 341: goto L341;
+        case 342: goto L342;
+        case 346: goto L346;
+        case 350: goto L350;
+        case 353: goto L353;
+        case 354: goto L354;
+        case 358: goto L358;
+        case 362: goto L362;
+        case 365: goto L365;
+        case 366: goto L366;
+        case 370: goto L370;
+        case 374: goto L374;
+        case 377: goto L377;
+        case 378: goto L378;
+        case 382: goto L382;
+        case 386: goto L386;
+        case 389: goto L389;
+        case 390: goto L390;
+        case 394: goto L394;
+        case 398: goto L398;
+        case 401: goto L401;
+        case 402: goto L402;
+        case 406: goto L406;
+        case 410: goto L410;
+        case 413: goto L413;
+        case 414: goto L414;
+        case 417: goto L417;
+        case 420: goto L420;
+        case 423: goto L423;
+        case 424: goto L424;
+        case 428: goto L428;
+        case 431: goto L431;
+        case 434: goto L434;
+        case 435: goto L435;
+        case 439: goto L439;
+        case 443: goto L443;
+        case 446: goto L446;
+        case 447: goto L447;
+        case 451: goto L451;
+        case 455: goto L455;
+        case 458: goto L458;
+        case 459: goto L459;
+        case 463: goto L463;
+        case 467: goto L467;
+        case 470: goto L470;
+        case 471: goto L471;
+        case 475: goto L475;
+        case 479: goto L479;
+        case 482: goto L482;
+        case 483: goto L483;
+        case 486: goto L486;
+        case 489: goto L489;
+        case 492: goto L492;
+        case 493: goto L493;
+        case 496: goto L496;
+        case 499: goto L499;
+        case 502: goto L502;
+        case 503: goto L503;
+        case 506: goto L506;
+        case 509: goto L509;
+        case 512: goto L512;
+        case 513: goto L513;
+        case 516: goto L516;
+        case 519: goto L519;
+        case 522: goto L522;
+        case 523: goto L523;
+        case 526: goto L526;
+        case 529: goto L529;
+        case 532: goto L532;
+        case 533: goto L533;
+        case 536: goto L536;
+        case 539: goto L539;
+        case 542: goto L542;
+        case 543: goto L543;
+        case 546: goto L546;
+        case 549: goto L549;
+        case 552: goto L552;
+        case 553: goto L553;
+        case 557: goto L557;
+        case 561: goto L561;
+        case 564: goto L564;
+        case 565: goto L565;
+        case 569: goto L569;
+        case 573: goto L573;
+        case 576: goto L576;
+        case 577: goto L577;
+        case 581: goto L581;
+        case 585: goto L585;
+        case 588: goto L588;
+        case 589: goto L589;
+        case 593: goto L593;
+        case 597: goto L597;
+        case 600: goto L600;
+        case 601: goto L601;
+        case 605: goto L605;
+        case 609: goto L609;
+        case 612: goto L612;
+        case 613: goto L613;
+        case 617: goto L617;
+        case 621: goto L621;
+        case 624: goto L624;
+        case 625: goto L625;
+        case 629: goto L629;
+        case 633: goto L633;
+        case 636: goto L636;
+        case 637: goto L637;
+        case 641: goto L641;
+        case 645: goto L645;
+        case 648: goto L648;
+        case 649: goto L649;
+        case 653: goto L653;
+        case 657: goto L657;
+        case 660: goto L660;
+        case 661: goto L661;
+        case 665: goto L665;
+        case 669: goto L669;
+        case 672: goto L672;
+        case 673: goto L673;
+        case 677: goto L677;
+        case 681: goto L681;
+        case 684: goto L684;
+        case 685: goto L685;
+        case 689: goto L689;
+        case 692: goto L692;
+        case 695: goto L695;
+        case 696: goto L696;
+        case 701: goto L701;
+        case 706: goto L706;
+        case 709: goto L709;
+        case 710: goto L710;
+        case 715: goto L715;
+        case 720: goto L720;
+        case 723: goto L723;
+        case 724: goto L724;
+        case 729: goto L729;
+        case 733: goto L733;
+        case 736: goto L736;
+        case 737: goto L737;
+        case 742: goto L742;
+        case 746: goto L746;
+        case 749: goto L749;
+        case 750: goto L750;
+        case 755: goto L755;
+        case 760: goto L760;
+        case 763: goto L763;
+        case 764: goto L764;
+        case 769: goto L769;
+        case 773: goto L773;
+        case 776: goto L776;
+        case 777: goto L777;
+        case 782: goto L782;
+        case 787: goto L787;
+        case 790: goto L790;
+        case 791: goto L791;
+        case 796: goto L796;
+        case 801: goto L801;
+        case 804: goto L804;
+        case 805: goto L805;
+        case 811: goto L811;
+        case 814: goto L814;
+        case 815: goto L815;
+        case 816: goto L816;
+        case 817: goto L817;
+        case 818: goto L818;
+        case 1002: goto L1002;
+        case 1007: goto L1007;
+        case 1008: goto L1008;
+        case 1017: goto L1017;
+        case 1022: goto L1022;
+        case 1023: goto L1023;
+        case 1026: goto L1026;
+        case 1030: goto L1030;
+        case 1033: goto L1033;
+        case 1034: goto L1034;
+        case 1035: goto L1035;
+        case 1039: goto L1039;
+        case 1042: goto L1042;
+        case 1043: goto L1043;
+        case 1044: goto L1044;
+        case 1050: goto L1050;
+        case 1053: goto L1053;
+        case 1054: goto L1054;
+        case 1055: goto L1055;
+        case 1056: goto L1056;
+        case 1057: goto L1057;
+        case 1673: goto L1673;
+        case 1679: goto L1679;
+        case 1680: goto L1680;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 1;
+L5: /* STRING */
+    tp_aot_op(tp, f, code + 5);
+L14: /* FILE */
+    f->fname = regs[0];
+L15: /* STRING */
+    tp_aot_op(tp, f, code + 15);
+L18: /* NAME */
+    f->name = regs[0];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L22: /* NUMBER */
+    tp_aot_op(tp, f, code + 22);
+L25: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 3;
+L29: /* STRING */
+    tp_aot_op(tp, f, code + 29);
+L32: /* NUMBER */
+    tp_aot_op(tp, f, code + 32);
+L35: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L36: /* LINE */
+    f->line = code + 36;
+    f->lineno = 4;
+L39: /* STRING */
+    tp_aot_op(tp, f, code + 39);
+L42: /* NUMBER */
+    tp_aot_op(tp, f, code + 42);
+L45: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L46: /* LINE */
+    f->line = code + 46;
+    f->lineno = 5;
+L49: /* STRING */
+    tp_aot_op(tp, f, code + 49);
+L52: /* NUMBER */
+    tp_aot_op(tp, f, code + 52);
+L55: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L56: /* LINE */
+    f->line = code + 56;
+    f->lineno = 6;
+L59: /* STRING */
+    tp_aot_op(tp, f, code + 59);
+L62: /* NUMBER */
+    tp_aot_op(tp, f, code + 62);
+L65: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L66: /* LINE */
+    f->line = code + 66;
+    f->lineno = 7;
+L69: /* STRING */
+    tp_aot_op(tp, f, code + 69);
+L72: /* NUMBER */
+    tp_aot_op(tp, f, code + 72);
+L75: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L76: /* LINE */
+    f->line = code + 76;
+    f->lineno = 8;
+L80: /* STRING */
+    tp_aot_op(tp, f, code + 80);
+L83: /* NUMBER */
+    tp_aot_op(tp, f, code + 83);
+L86: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L87: /* LINE */
+    f->line = code + 87;
+    f->lineno = 9;
+L91: /* STRING */
+    tp_aot_op(tp, f, code + 91);
+L94: /* NUMBER */
+    tp_aot_op(tp, f, code + 94);
+L97: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L98: /* LINE */
+    f->line = code + 98;
+    f->lineno = 10;
+L102: /* STRING */
+    tp_aot_op(tp, f, code + 102);
+L105: /* NUMBER */
+    tp_aot_op(tp, f, code + 105);
+L108: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L109: /* LINE */
+    f->line = code + 109;
+    f->lineno = 12;
+L113: /* STRING */
+    tp_aot_op(tp, f, code + 113);
+L117: /* NUMBER */
+    tp_aot_op(tp, f, code + 117);
+L120: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L121: /* LINE */
+    f->line = code + 121;
+    f->lineno = 13;
+L125: /* STRING */
+    tp_aot_op(tp, f, code + 125);
+L129: /* NUMBER */
+    tp_aot_op(tp, f, code + 129);
+L132: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L133: /* LINE */
+    f->line = code + 133;
+    f->lineno = 14;
+L137: /* STRING */
+    tp_aot_op(tp, f, code + 137);
+L141: /* NUMBER */
+    tp_aot_op(tp, f, code + 141);
+L144: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L145: /* LINE */
+    f->line = code + 145;
+    f->lineno = 15;
+L149: /* STRING */
+    tp_aot_op(tp, f, code + 149);
+L152: /* NUMBER */
+    tp_aot_op(tp, f, code + 152);
+L155: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L156: /* LINE */
+    f->line = code + 156;
+    f->lineno = 16;
+L160: /* STRING */
+    tp_aot_op(tp, f, code + 160);
+L164: /* NUMBER */
+    tp_aot_op(tp, f, code + 164);
+L167: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L168: /* LINE */
+    f->line = code + 168;
+    f->lineno = 18;
+L172: /* STRING */
+    tp_aot_op(tp, f, code + 172);
+L176: /* NUMBER */
+    tp_aot_op(tp, f, code + 176);
+L179: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L180: /* LINE */
+    f->line = code + 180;
+    f->lineno = 19;
+L184: /* STRING */
+    tp_aot_op(tp, f, code + 184);
+L188: /* NUMBER */
+    tp_aot_op(tp, f, code + 188);
+L191: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L192: /* LINE */
+    f->line = code + 192;
+    f->lineno = 20;
+L196: /* STRING */
+    tp_aot_op(tp, f, code + 196);
+L200: /* NUMBER */
+    tp_aot_op(tp, f, code + 200);
+L203: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L204: /* LINE */
+    f->line = code + 204;
+    f->lineno = 21;
+L208: /* STRING */
+    tp_aot_op(tp, f, code + 208);
+L211: /* NUMBER */
+    tp_aot_op(tp, f, code + 211);
+L214: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L215: /* LINE */
+    f->line = code + 215;
+    f->lineno = 22;
+L219: /* STRING */
+    tp_aot_op(tp, f, code + 219);
+L222: /* NUMBER */
+    tp_aot_op(tp, f, code + 222);
+L225: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L226: /* LINE */
+    f->line = code + 226;
+    f->lineno = 23;
+L230: /* STRING */
+    tp_aot_op(tp, f, code + 230);
+L234: /* NUMBER */
+    tp_aot_op(tp, f, code + 234);
+L237: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L238: /* LINE */
+    f->line = code + 238;
+    f->lineno = 24;
+L242: /* STRING */
+    tp_aot_op(tp, f, code + 242);
+L246: /* NUMBER */
+    tp_aot_op(tp, f, code + 246);
+L249: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L250: /* LINE */
+    f->line = code + 250;
+    f->lineno = 25;
+L254: /* STRING */
+    tp_aot_op(tp, f, code + 254);
+L257: /* NUMBER */
+    tp_aot_op(tp, f, code + 257);
+L260: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L261: /* LINE */
+    f->line = code + 261;
+    f->lineno = 27;
+L265: /* STRING */
+    tp_aot_op(tp, f, code + 265);
+L268: /* NUMBER */
+    tp_aot_op(tp, f, code + 268);
+L271: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L272: /* LINE */
+    f->line = code + 272;
+    f->lineno = 28;
+L276: /* STRING */
+    tp_aot_op(tp, f, code + 276);
+L280: /* NUMBER */
+    tp_aot_op(tp, f, code + 280);
+L283: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L284: /* LINE */
+    f->line = code + 284;
+    f->lineno = 29;
+L288: /* STRING */
+    tp_aot_op(tp, f, code + 288);
+L292: /* NUMBER */
+    tp_aot_op(tp, f, code + 292);
+L295: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L296: /* LINE */
+    f->line = code + 296;
+    f->lineno = 30;
+L300: /* STRING */
+    tp_aot_op(tp, f, code + 300);
+L304: /* NUMBER */
+    tp_aot_op(tp, f, code + 304);
+L307: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L308: /* LINE */
+    f->line = code + 308;
+    f->lineno = 31;
+L312: /* STRING */
+    tp_aot_op(tp, f, code + 312);
+L315: /* NUMBER */
+    tp_aot_op(tp, f, code + 315);
+L318: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L319: /* LINE */
+    f->line = code + 319;
+    f->lineno = 32;
+L323: /* STRING */
+    tp_aot_op(tp, f, code + 323);
+L327: /* NUMBER */
+    tp_aot_op(tp, f, code + 327);
+L330: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L331: /* LINE */
+    f->line = code + 331;
+    f->lineno = 34;
+L335: /* STRING */
+    tp_aot_op(tp, f, code + 335);
+L338: /* NUMBER */
+    tp_aot_op(tp, f, code + 338);
+L341: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L342: /* LINE */
+    f->line = code + 342;
+    f->lineno = 35;
+L346: /* STRING */
+    tp_aot_op(tp, f, code + 346);
+L350: /* NUMBER */
+    tp_aot_op(tp, f, code + 350);
+L353: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L354: /* LINE */
+    f->line = code + 354;
+    f->lineno = 37;
+L358: /* STRING */
+    tp_aot_op(tp, f, code + 358);
+L362: /* NUMBER */
+    tp_aot_op(tp, f, code + 362);
+L365: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L366: /* LINE */
+    f->line = code + 366;
+    f->lineno = 38;
+L370: /* STRING */
+    tp_aot_op(tp, f, code + 370);
+L374: /* NUMBER */
+    tp_aot_op(tp, f, code + 374);
+L377: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L378: /* LINE */
+    f->line = code + 378;
+    f->lineno = 39;
+L382: /* STRING */
+    tp_aot_op(tp, f, code + 382);
+L386: /* NUMBER */
+    tp_aot_op(tp, f, code + 386);
+L389: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L390: /* LINE */
+    f->line = code + 390;
+    f->lineno = 40;
+L394: /* STRING */
+    tp_aot_op(tp, f, code + 394);
+L398: /* NUMBER */
+    tp_aot_op(tp, f, code + 398);
+L401: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L402: /* LINE */
+    f->line = code + 402;
+    f->lineno = 41;
+L406: /* STRING */
+    tp_aot_op(tp, f, code + 406);
+L410: /* NUMBER */
+    tp_aot_op(tp, f, code + 410);
+L413: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L414: /* LINE */
+    f->line = code + 414;
+    f->lineno = 42;
+L417: /* STRING */
+    tp_aot_op(tp, f, code + 417);
+L420: /* NUMBER */
+    tp_aot_op(tp, f, code + 420);
+L423: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L424: /* LINE */
+    f->line = code + 424;
+    f->lineno = 43;
+L428: /* STRING */
+    tp_aot_op(tp, f, code + 428);
+L431: /* NUMBER */
+    tp_aot_op(tp, f, code + 431);
+L434: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L435: /* LINE */
+    f->line = code + 435;
+    f->lineno = 44;
+L439: /* STRING */
+    tp_aot_op(tp, f, code + 439);
+L443: /* NUMBER */
+    tp_aot_op(tp, f, code + 443);
+L446: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L447: /* LINE */
+    f->line = code + 447;
+    f->lineno = 45;
+L451: /* STRING */
+    tp_aot_op(tp, f, code + 451);
+L455: /* NUMBER */
+    tp_aot_op(tp, f, code + 455);
+L458: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L459: /* LINE */
+    f->line = code + 459;
+    f->lineno = 47;
+L463: /* STRING */
+    tp_aot_op(tp, f, code + 463);
+L467: /* NUMBER */
+    tp_aot_op(tp, f, code + 467);
+L470: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L471: /* LINE */
+    f->line = code + 471;
+    f->lineno = 49;
+L475: /* STRING */
+    tp_aot_op(tp, f, code + 475);
+L479: /* NUMBER */
+    tp_aot_op(tp, f, code + 479);
+L482: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L483: /* LINE */
+    f->line = code + 483;
+    f->lineno = 50;
+L486: /* STRING */
+    tp_aot_op(tp, f, code + 486);
+L489: /* NUMBER */
+    tp_aot_op(tp, f, code + 489);
+L492: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L493: /* LINE */
+    f->line = code + 493;
+    f->lineno = 51;
+L496: /* STRING */
+    tp_aot_op(tp, f, code + 496);
+L499: /* NUMBER */
+    tp_aot_op(tp, f, code + 499);
+L502: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L503: /* LINE */
+    f->line = code + 503;
+    f->lineno = 52;
+L506: /* STRING */
+    tp_aot_op(tp, f, code + 506);
+L509: /* NUMBER */
+    tp_aot_op(tp, f, code + 509);
+L512: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L513: /* LINE */
+    f->line = code + 513;
+    f->lineno = 53;
+L516: /* STRING */
+    tp_aot_op(tp, f, code + 516);
+L519: /* NUMBER */
+    tp_aot_op(tp, f, code + 519);
+L522: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L523: /* LINE */
+    f->line = code + 523;
+    f->lineno = 54;
+L526: /* STRING */
+    tp_aot_op(tp, f, code + 526);
+L529: /* NUMBER */
+    tp_aot_op(tp, f, code + 529);
+L532: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L533: /* LINE */
+    f->line = code + 533;
+    f->lineno = 55;
+L536: /* STRING */
+    tp_aot_op(tp, f, code + 536);
+L539: /* NUMBER */
+    tp_aot_op(tp, f, code + 539);
+L542: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L543: /* LINE */
+    f->line = code + 543;
+    f->lineno = 56;
+L546: /* STRING */
+    tp_aot_op(tp, f, code + 546);
+L549: /* NUMBER */
+    tp_aot_op(tp, f, code + 549);
+L552: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L553: /* LINE */
+    f->line = code + 553;
+    f->lineno = 58;
+L557: /* STRING */
+    tp_aot_op(tp, f, code + 557);
+L561: /* NUMBER */
+    tp_aot_op(tp, f, code + 561);
+L564: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L565: /* LINE */
+    f->line = code + 565;
+    f->lineno = 59;
+L569: /* STRING */
+    tp_aot_op(tp, f, code + 569);
+L573: /* NUMBER */
+    tp_aot_op(tp, f, code + 573);
+L576: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L577: /* LINE */
+    f->line = code + 577;
+    f->lineno = 60;
+L581: /* STRING */
+    tp_aot_op(tp, f, code + 581);
+L585: /* NUMBER */
+    tp_aot_op(tp, f, code + 585);
+L588: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L589: /* LINE */
+    f->line = code + 589;
+    f->lineno = 61;
+L593: /* STRING */
+    tp_aot_op(tp, f, code + 593);
+L597: /* NUMBER */
+    tp_aot_op(tp, f, code + 597);
+L600: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L601: /* LINE */
+    f->line = code + 601;
+    f->lineno = 62;
+L605: /* STRING */
+    tp_aot_op(tp, f, code + 605);
+L609: /* NUMBER */
+    tp_aot_op(tp, f, code + 609);
+L612: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L613: /* LINE */
+    f->line = code + 613;
+    f->lineno = 63;
+L617: /* STRING */
+    tp_aot_op(tp, f, code + 617);
+L621: /* NUMBER */
+    tp_aot_op(tp, f, code + 621);
+L624: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L625: /* LINE */
+    f->line = code + 625;
+    f->lineno = 64;
+L629: /* STRING */
+    tp_aot_op(tp, f, code + 629);
+L633: /* NUMBER */
+    tp_aot_op(tp, f, code + 633);
+L636: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L637: /* LINE */
+    f->line = code + 637;
+    f->lineno = 66;
+L641: /* STRING */
+    tp_aot_op(tp, f, code + 641);
+L645: /* NUMBER */
+    tp_aot_op(tp, f, code + 645);
+L648: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L649: /* LINE */
+    f->line = code + 649;
+    f->lineno = 67;
+L653: /* STRING */
+    tp_aot_op(tp, f, code + 653);
+L657: /* NUMBER */
+    tp_aot_op(tp, f, code + 657);
+L660: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L661: /* LINE */
+    f->line = code + 661;
+    f->lineno = 68;
+L665: /* STRING */
+    tp_aot_op(tp, f, code + 665);
+L669: /* NUMBER */
+    tp_aot_op(tp, f, code + 669);
+L672: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L673: /* LINE */
+    f->line = code + 673;
+    f->lineno = 70;
+L677: /* STRING */
+    tp_aot_op(tp, f, code + 677);
+L681: /* NUMBER */
+    tp_aot_op(tp, f, code + 681);
+L684: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L685: /* LINE */
+    f->line = code + 685;
+    f->lineno = 71;
+L689: /* STRING */
+    tp_aot_op(tp, f, code + 689);
+L692: /* NUMBER */
+    tp_aot_op(tp, f, code + 692);
+L695: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L696: /* LINE */
+    f->line = code + 696;
+    f->lineno = 75;
+L701: /* STRING */
+    tp_aot_op(tp, f, code + 701);
+L706: /* NUMBER */
+    tp_aot_op(tp, f, code + 706);
+L709: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L710: /* LINE */
+    f->line = code + 710;
+    f->lineno = 76;
+L715: /* STRING */
+    tp_aot_op(tp, f, code + 715);
+L720: /* NUMBER */
+    tp_aot_op(tp, f, code + 720);
+L723: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L724: /* LINE */
+    f->line = code + 724;
+    f->lineno = 77;
+L729: /* STRING */
+    tp_aot_op(tp, f, code + 729);
+L733: /* NUMBER */
+    tp_aot_op(tp, f, code + 733);
+L736: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L737: /* LINE */
+    f->line = code + 737;
+    f->lineno = 78;
+L742: /* STRING */
+    tp_aot_op(tp, f, code + 742);
+L746: /* NUMBER */
+    tp_aot_op(tp, f, code + 746);
+L749: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L750: /* LINE */
+    f->line = code + 750;
+    f->lineno = 79;
+L755: /* STRING */
+    tp_aot_op(tp, f, code + 755);
+L760: /* NUMBER */
+    tp_aot_op(tp, f, code + 760);
+L763: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L764: /* LINE */
+    f->line = code + 764;
+    f->lineno = 80;
+L769: /* STRING */
+    tp_aot_op(tp, f, code + 769);
+L773: /* NUMBER */
+    tp_aot_op(tp, f, code + 773);
+L776: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L777: /* LINE */
+    f->line = code + 777;
+    f->lineno = 81;
+L782: /* STRING */
+    tp_aot_op(tp, f, code + 782);
+L787: /* NUMBER */
+    tp_aot_op(tp, f, code + 787);
+L790: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L791: /* LINE */
+    f->line = code + 791;
+    f->lineno = 82;
+L796: /* STRING */
+    tp_aot_op(tp, f, code + 796);
+L801: /* NUMBER */
+    tp_aot_op(tp, f, code + 801);
+L804: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L805: /* LINE */
+    f->line = code + 805;
+    f->lineno = 84;
+L811: /* VAR */
+L814: /* LIST */
+    tp_aot_op(tp, f, code + 814);
+L815: /* LIST */
+    tp_aot_op(tp, f, code + 815);
+L816: /* NONE */
+    regs[3] = tp_None;
+L817: /* NONE */
+    regs[4] = tp_None;
+L818: /* DEF */
+    tp_aot_op(tp, f, code + 818);
+L1002: /* STRING */
+    tp_aot_op(tp, f, code + 1002);
+L1007: /* GSET */
+    tp_set(tp, f->globals, regs[1], regs[0]);
+L1008: /* LINE */
+    f->line = code + 1008;
+    f->lineno = 97;
+L1017: /* GGET */
+    tp_aot_op(tp, f, code + 1017);
+L1022: /* CALLP */
+    return code + 1022;
+L1023: /* VAR */
+L1026: /* STRING */
+    tp_aot_op(tp, f, code + 1026);
+L1030: /* NUMBER */
+    tp_aot_op(tp, f, code + 1030);
+L1033: /* GET */
+    regs[3] = tp_get(tp, regs[1], regs[4]);
+    tp_grey(tp, regs[3]);
+L1034: /* GSET */
+    tp_set(tp, f->globals, regs[2], regs[3]);
+L1035: /* STRING */
+    tp_aot_op(tp, f, code + 1035);
+L1039: /* NUMBER */
+    tp_aot_op(tp, f, code + 1039);
+L1042: /* GET */
+    regs[3] = tp_get(tp, regs[1], regs[4]);
+    tp_grey(tp, regs[3]);
+L1043: /* GSET */
+    tp_set(tp, f->globals, regs[2], regs[3]);
+L1044: /* LINE */
+    f->line = code + 1044;
+    f->lineno = 99;
+L1050: /* VAR */
+L1053: /* LIST */
+    tp_aot_op(tp, f, code + 1053);
+L1054: /* LIST */
+    tp_aot_op(tp, f, code + 1054);
+L1055: /* NONE */
+    regs[4] = tp_None;
+L1056: /* NONE */
+    regs[5] = tp_None;
+L1057: /* DEF */
+    tp_aot_op(tp, f, code + 1057);
+L1673: /* STRING */
+    tp_aot_op(tp, f, code + 1673);
+L1679: /* GSET */
+    tp_set(tp, f->globals, regs[2], regs[1]);
+L1680: /* EOF */
+    return code + 1680;
+}
+
+static tpd_code * _tp_tinypy_compiler_opcodes_819(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 33: goto L33;
+        case 36: goto L36;
+        case 37: goto L37;
+        case 42: goto L42;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 52: goto L52;
+        case 54: goto L54;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 65: goto L65;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 72: goto L72;
+        case 73: goto L73;
+        case 86: goto L86;
+        case 89: goto L89;
+        case 90: goto L90;
+        case 93: goto L93;
+        case 94: goto L94;
+        case 95: goto L95;
+        case 96: goto L96;
+        case 99: goto L99;
+        case 100: goto L100;
+        case 103: goto L103;
+        case 104: goto L104;
+        case 105: goto L105;
+        case 106: goto L106;
+        case 107: goto L107;
+        case 114: goto L114;
+        case 115: goto L115;
+        case 122: goto L122;
+        case 123: goto L123;
+        case 124: goto L124;
+        case 131: goto L131;
+        case 132: goto L132;
+        case 133: goto L133;
+        case 134: goto L134;
+        case 147: goto L147;
+        case 152: goto L152;
+        case 159: goto L159;
+        case 160: goto L160;
+        case 161: goto L161;
+        case 168: goto L168;
+        case 169: goto L169;
+        case 170: goto L170;
+        case 171: goto L171;
+        case 178: goto L178;
+        case 179: goto L179;
+        case 180: goto L180;
+        case 181: goto L181;
+        case 182: goto L182;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 84;
+L8: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[0];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L27: /* NAME */
+    f->name = regs[0];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 85;
+L33: /* VAR */
+L36: /* DICT */
+    tp_aot_op(tp, f, code + 36);
+L37: /* LINE */
+    f->line = code + 37;
+    f->lineno = 86;
+L42: /* VAR */
+L45: /* DICT */
+    tp_aot_op(tp, f, code + 45);
+L46: /* LINE */
+    f->line = code + 46;
+    f->lineno = 87;
+L52: /* VAR */
+L54: /* GGET */
+    tp_aot_op(tp, f, code + 54);
+L58: /* CALLP */
+    return code + 58;
+L59: /* MOVE */
+    regs[4] = regs[3];
+L60: /* LINE */
+    f->line = code + 60;
+    f->lineno = 88;
+L65: /* NUMBER */
+    tp_aot_op(tp, f, code + 65);
+L68: /* ITER */
+    if (tp_iter_next(tp, &regs[3], regs[4], &regs[2])) {
+        goto L70;
+    }
+L69: /* JUMP */
+    goto L171;
+L70: /* VAR */
+L72: /* MOVE */
+    regs[5] = regs[3];
+L73: /* LINE */
+    f->line = code + 73;
+    f->lineno = 89;
+L86: /* NUMBER */
+    tp_aot_op(tp, f, code + 86);
+L89: /* GET */
+    regs[6] = tp_get(tp, regs[5], regs[7]);
+    tp_grey(tp, regs[6]);
+L90: /* STRING */
+    tp_aot_op(tp, f, code + 90);
+L93: /* GE */
+    if (TP_BOTH(regs[6], regs[7], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[6].nint >= regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 93);
+    }
+L94: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L96;
+    }
+L95: /* JUMP */
+    goto L104;
+L96: /* NUMBER */
+    tp_aot_op(tp, f, code + 96);
+L99: /* GET */
+    regs[6] = tp_get(tp, regs[5], regs[7]);
+    tp_grey(tp, regs[6]);
+L100: /* STRING */
+    tp_aot_op(tp, f, code + 100);
+L103: /* LE */
+    if (TP_BOTH(regs[6], regs[7], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[6].nint <= regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 103);
+    }
+L104: /* NOT */
+    regs[3] = tp_bool(!tp_true(tp, regs[6]));
+L105: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L107;
+    }
+L106: /* JUMP */
+    goto L115;
+L107: /* LINE */
+    f->line = code + 107;
+    f->lineno = 90;
+L114: /* JUMP */
+    tp_aot_safepoint(tp, 46);
+    goto L68;
+L115: /* LINE */
+    f->line = code + 115;
+    f->lineno = 91;
+L122: /* GET */
+    regs[3] = tp_get(tp, regs[4], regs[5]);
+    tp_grey(tp, regs[3]);
+L123: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[5]);
+L124: /* LINE */
+    f->line = code + 124;
+    f->lineno = 92;
+L131: /* IN */
+    regs[3] = tp_has(tp, regs[1], regs[5]);
+L132: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L134;
+    }
+L133: /* JUMP */
+    goto L161;
+L134: /* LINE */
+    f->line = code + 134;
+    f->lineno = 93;
+L147: /* GGET */
+    tp_aot_op(tp, f, code + 147);
+L152: /* STRING */
+    tp_aot_op(tp, f, code + 152);
+L159: /* CALLP */
+    return code + 159;
+L160: /* RAISE */
+    return code + 160;
+L161: /* LINE */
+    f->line = code + 161;
+    f->lineno = 94;
+L168: /* GET */
+    regs[3] = tp_get(tp, regs[4], regs[5]);
+    tp_grey(tp, regs[3]);
+L169: /* SET */
+    tp_set(tp, regs[1], regs[5], regs[3]);
+L170: /* JUMP */
+    tp_aot_safepoint(tp, 102);
+    goto L68;
+L171: /* LINE */
+    f->line = code + 171;
+    f->lineno = 95;
+L178: /* MOVE */
+    regs[6] = regs[0];
+L179: /* MOVE */
+    regs[7] = regs[1];
+L180: /* LIST */
+    tp_aot_op(tp, f, code + 180);
+L181: /* RETURN */
+    return code + 181;
+L182: /* EOF */
+    return code + 182;
+}
+
+static tpd_code * _tp_tinypy_compiler_opcodes_1058(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 28: goto L28;
+        case 29: goto L29;
+        case 34: goto L34;
+        case 37: goto L37;
+        case 38: goto L38;
+        case 43: goto L43;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 52: goto L52;
+        case 55: goto L55;
+        case 56: goto L56;
+        case 57: goto L57;
+        case 64: goto L64;
+        case 68: goto L68;
+        case 71: goto L71;
+        case 72: goto L72;
+        case 73: goto L73;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 85: goto L85;
+        case 88: goto L88;
+        case 92: goto L92;
+        case 93: goto L93;
+        case 102: goto L102;
+        case 105: goto L105;
+        case 109: goto L109;
+        case 110: goto L110;
+        case 128: goto L128;
+        case 132: goto L132;
+        case 134: goto L134;
+        case 139: goto L139;
+        case 140: goto L140;
+        case 143: goto L143;
+        case 144: goto L144;
+        case 147: goto L147;
+        case 148: goto L148;
+        case 149: goto L149;
+        case 150: goto L150;
+        case 153: goto L153;
+        case 154: goto L154;
+        case 155: goto L155;
+        case 173: goto L173;
+        case 177: goto L177;
+        case 179: goto L179;
+        case 183: goto L183;
+        case 184: goto L184;
+        case 189: goto L189;
+        case 190: goto L190;
+        case 191: goto L191;
+        case 194: goto L194;
+        case 195: goto L195;
+        case 196: goto L196;
+        case 214: goto L214;
+        case 218: goto L218;
+        case 220: goto L220;
+        case 224: goto L224;
+        case 225: goto L225;
+        case 229: goto L229;
+        case 230: goto L230;
+        case 231: goto L231;
+        case 235: goto L235;
+        case 236: goto L236;
+        case 237: goto L237;
+        case 238: goto L238;
+        case 250: goto L250;
+        case 254: goto L254;
+        case 256: goto L256;
+        case 264: goto L264;
+        case 265: goto L265;
+        case 286: goto L286;
+        case 289: goto L289;
+        case 307: goto L307;
+        case 316: goto L316;
+        case 319: goto L319;
+        case 322: goto L322;
+        case 326: goto L326;
+        case 328: goto L328;
+        case 329: goto L329;
+        case 330: goto L330;
+        case 347: goto L347;
+        case 351: goto L351;
+        case 357: goto L357;
+        case 365: goto L365;
+        case 374: goto L374;
+        case 391: goto L391;
+        case 404: goto L404;
+        case 413: goto L413;
+        case 420: goto L420;
+        case 421: goto L421;
+        case 429: goto L429;
+        case 432: goto L432;
+        case 436: goto L436;
+        case 438: goto L438;
+        case 439: goto L439;
+        case 440: goto L440;
+        case 441: goto L441;
+        case 447: goto L447;
+        case 451: goto L451;
+        case 452: goto L452;
+        case 469: goto L469;
+        case 473: goto L473;
+        case 479: goto L479;
+        case 487: goto L487;
+        case 499: goto L499;
+        case 516: goto L516;
+        case 529: goto L529;
+        case 541: goto L541;
+        case 551: goto L551;
+        case 552: goto L552;
+        case 560: goto L560;
+        case 563: goto L563;
+        case 567: goto L567;
+        case 569: goto L569;
+        case 570: goto L570;
+        case 571: goto L571;
+        case 572: goto L572;
+        case 578: goto L578;
+        case 581: goto L581;
+        case 582: goto L582;
+        case 598: goto L598;
+        case 601: goto L601;
+        case 605: goto L605;
+        case 607: goto L607;
+        case 608: goto L608;
+        case 609: goto L609;
+        case 610: goto L610;
+        case 611: goto L611;
+        case 612: goto L612;
+        case 613: goto L613;
+        case 614: goto L614;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 99;
+L8: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[0];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L28: /* NAME */
+    f->name = regs[0];
+L29: /* LINE */
+    f->line = code + 29;
+    f->lineno = 100;
+L34: /* VAR */
+L37: /* LIST */
+    tp_aot_op(tp, f, code + 37);
+L38: /* LINE */
+    f->line = code + 38;
+    f->lineno = 101;
+L43: /* VAR */
+L46: /* LIST */
+    tp_aot_op(tp, f, code + 46);
+L47: /* LINE */
+    f->line = code + 47;
+    f->lineno = 102;
+L52: /* VAR */
+L55: /* LIST */
+    tp_aot_op(tp, f, code + 55);
+L56: /* MOVE */
+    regs[3] = regs[2];
+L57: /* LINE */
+    f->line = code + 57;
+    f->lineno = 104;
+L64: /* GGET */
+    tp_aot_op(tp, f, code + 64);
+L68: /* NUMBER */
+    tp_aot_op(tp, f, code + 68);
+L71: /* ITER */
+    if (tp_iter_next(tp, &regs[2], regs[4], &regs[5])) {
+        goto L73;
+    }
+L72: /* JUMP */
+    goto L238;
+L73: /* VAR */
+L76: /* MOVE */
+    regs[6] = regs[2];
+L77: /* LINE */
+    f->line = code + 77;
+    f->lineno = 105;
+L85: /* VAR */
+L88: /* GGET */
+    tp_aot_op(tp, f, code + 88);
+L92: /* GET */
+    regs[2] = tp_get(tp, regs[7], regs[6]);
+    tp_grey(tp, regs[2]);
+L93: /* LINE */
+    f->line = code + 93;
+    f->lineno = 106;
+L102: /* VAR */
+L105: /* STRING */
+    tp_aot_op(tp, f, code + 105);
+L109: /* ADD */
+    if (TP_BOTH(regs[8], regs[6], TP_NUMBER_INT)) {
+        regs[7] = tp_int(regs[8].nint + regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 109);
+    }
+L110: /* LINE */
+    f->line = code + 110;
+    f->lineno = 107;
+L128: /* STRING */
+    tp_aot_op(tp, f, code + 128);
+L132: /* METHOD */
+    tp_aot_op(tp, f, code + 132);
+L134: /* STRING */
+    tp_aot_op(tp, f, code + 134);
+L139: /* ADD */
+    if (TP_BOTH(regs[11], regs[7], TP_NUMBER_INT)) {
+        regs[11] = tp_int(regs[11].nint + regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 139);
+    }
+L140: /* STRING */
+    tp_aot_op(tp, f, code + 140);
+L143: /* ADD */
+    if (TP_BOTH(regs[11], regs[12], TP_NUMBER_INT)) {
+        regs[11] = tp_int(regs[11].nint + regs[12].nint);
+    } else {
+        tp_aot_op(tp, f, code + 143);
+    }
+L144: /* GGET */
+    tp_aot_op(tp, f, code + 144);
+L147: /* MOVE */
+    regs[14] = regs[2];
+L148: /* CALLP */
+    return code + 148;
+L149: /* ADD */
+    if (TP_BOTH(regs[11], regs[12], TP_NUMBER_INT)) {
+        regs[11] = tp_int(regs[11].nint + regs[12].nint);
+    } else {
+        tp_aot_op(tp, f, code + 149);
+    }
+L150: /* STRING */
+    tp_aot_op(tp, f, code + 150);
+L153: /* ADD */
+    if (TP_BOTH(regs[11], regs[12], TP_NUMBER_INT)) {
+        regs[11] = tp_int(regs[11].nint + regs[12].nint);
+    } else {
+        tp_aot_op(tp, f, code + 153);
+    }
+L154: /* CALLM */
+    return code + 154;
+L155: /* LINE */
+    f->line = code + 155;
+    f->lineno = 108;
+L173: /* STRING */
+    tp_aot_op(tp, f, code + 173);
+L177: /* METHOD */
+    tp_aot_op(tp, f, code + 177);
+L179: /* STRING */
+    tp_aot_op(tp, f, code + 179);
+L183: /* ADD */
+    if (TP_BOTH(regs[11], regs[7], TP_NUMBER_INT)) {
+        regs[11] = tp_int(regs[11].nint + regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 183);
+    }
+L184: /* STRING */
+    tp_aot_op(tp, f, code + 184);
+L189: /* ADD */
+    if (TP_BOTH(regs[11], regs[12], TP_NUMBER_INT)) {
+        regs[11] = tp_int(regs[11].nint + regs[12].nint);
+    } else {
+        tp_aot_op(tp, f, code + 189);
+    }
+L190: /* ADD */
+    if (TP_BOTH(regs[11], regs[6], TP_NUMBER_INT)) {
+        regs[11] = tp_int(regs[11].nint + regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 190);
+    }
+L191: /* STRING */
+    tp_aot_op(tp, f, code + 191);
+L194: /* ADD */
+    if (TP_BOTH(regs[11], regs[12], TP_NUMBER_INT)) {
+        regs[11] = tp_int(regs[11].nint + regs[12].nint);
+    } else {
+        tp_aot_op(tp, f, code + 194);
+    }
+L195: /* CALLM */
+    return code + 195;
+L196: /* LINE */
+    f->line = code + 196;
+    f->lineno = 109;
+L214: /* STRING */
+    tp_aot_op(tp, f, code + 214);
+L218: /* METHOD */
+    tp_aot_op(tp, f, code + 218);
+L220: /* STRING */
+    tp_aot_op(tp, f, code + 220);
+L224: /* ADD */
+    if (TP_BOTH(regs[11], regs[7], TP_NUMBER_INT)) {
+        regs[11] = tp_int(regs[11].nint + regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 224);
+    }
+L225: /* STRING */
+    tp_aot_op(tp, f, code + 225);
+L229: /* ADD */
+    if (TP_BOTH(regs[11], regs[12], TP_NUMBER_INT)) {
+        regs[11] = tp_int(regs[11].nint + regs[12].nint);
+    } else {
+        tp_aot_op(tp, f, code + 229);
+    }
+L230: /* ADD */
+    if (TP_BOTH(regs[11], regs[6], TP_NUMBER_INT)) {
+        regs[11] = tp_int(regs[11].nint + regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 230);
+    }
+L231: /* STRING */
+    tp_aot_op(tp, f, code + 231);
+L235: /* ADD */
+    if (TP_BOTH(regs[11], regs[12], TP_NUMBER_INT)) {
+        regs[11] = tp_int(regs[11].nint + regs[12].nint);
+    } else {
+        tp_aot_op(tp, f, code + 235);
+    }
+L236: /* CALLM */
+    return code + 236;
+L237: /* JUMP */
+    tp_aot_safepoint(tp, 166);
+    goto L71;
+L238: /* LINE */
+    f->line = code + 238;
+    f->lineno = 111;
+L250: /* STRING */
+    tp_aot_op(tp, f, code + 250);
+L254: /* METHOD */
+    tp_aot_op(tp, f, code + 254);
+L256: /* STRING */
+    tp_aot_op(tp, f, code + 256);
+L264: /* CALLM */
+    return code + 264;
+L265: /* LINE */
+    f->line = code + 265;
+    f->lineno = 112;
+L286: /* VAR */
+L289: /* STRING */
+    tp_aot_op(tp, f, code + 289);
+L307: /* LINE */
+    f->line = code + 307;
+    f->lineno = 113;
+L316: /* VAR */
+L319: /* STRING */
+    tp_aot_op(tp, f, code + 319);
+L322: /* STRING */
+    tp_aot_op(tp, f, code + 322);
+L326: /* METHOD */
+    tp_aot_op(tp, f, code + 326);
+L328: /* MOVE */
+    regs[11] = regs[0];
+L329: /* CALLM */
+    return code + 329;
+L330: /* LINE */
+    f->line = code + 330;
+    f->lineno = 114;
+L347: /* VAR */
+L351: /* LINE */
+    f->line = code + 351;
+    f->lineno = 117;
+L357: /* LINE */
+    f->line = code + 357;
+    f->lineno = 116;
+L365: /* LINE */
+    f->line = code + 365;
+    f->lineno = 115;
+L374: /* LINE */
+    f->line = code + 374;
+    f->lineno = 114;
+L391: /* STRING */
+    tp_aot_op(tp, f, code + 391);
+L404: /* LINE */
+    f->line = code + 404;
+    f->lineno = 115;
+L413: /* STRING */
+    tp_aot_op(tp, f, code + 413);
+L420: /* ADD */
+    if (TP_BOTH(regs[9], regs[10], TP_NUMBER_INT)) {
+        regs[9] = tp_int(regs[9].nint + regs[10].nint);
+    } else {
+        tp_aot_op(tp, f, code + 420);
+    }
+L421: /* LINE */
+    f->line = code + 421;
+    f->lineno = 116;
+L429: /* STRING */
+    tp_aot_op(tp, f, code + 429);
+L432: /* STRING */
+    tp_aot_op(tp, f, code + 432);
+L436: /* METHOD */
+    tp_aot_op(tp, f, code + 436);
+L438: /* MOVE */
+    regs[13] = regs[1];
+L439: /* CALLM */
+    return code + 439;
+L440: /* ADD */
+    if (TP_BOTH(regs[9], regs[10], TP_NUMBER_INT)) {
+        regs[9] = tp_int(regs[9].nint + regs[10].nint);
+    } else {
+        tp_aot_op(tp, f, code + 440);
+    }
+L441: /* LINE */
+    f->line = code + 441;
+    f->lineno = 117;
+L447: /* STRING */
+    tp_aot_op(tp, f, code + 447);
+L451: /* ADD */
+    if (TP_BOTH(regs[9], regs[10], TP_NUMBER_INT)) {
+        regs[8] = tp_int(regs[9].nint + regs[10].nint);
+    } else {
+        tp_aot_op(tp, f, code + 451);
+    }
+L452: /* LINE */
+    f->line = code + 452;
+    f->lineno = 122;
+L469: /* VAR */
+L473: /* LINE */
+    f->line = code + 473;
+    f->lineno = 125;
+L479: /* LINE */
+    f->line = code + 479;
+    f->lineno = 124;
+L487: /* LINE */
+    f->line = code + 487;
+    f->lineno = 123;
+L499: /* LINE */
+    f->line = code + 499;
+    f->lineno = 122;
+L516: /* STRING */
+    tp_aot_op(tp, f, code + 516);
+L529: /* LINE */
+    f->line = code + 529;
+    f->lineno = 123;
+L541: /* STRING */
+    tp_aot_op(tp, f, code + 541);
+L551: /* ADD */
+    if (TP_BOTH(regs[10], regs[11], TP_NUMBER_INT)) {
+        regs[10] = tp_int(regs[10].nint + regs[11].nint);
+    } else {
+        tp_aot_op(tp, f, code + 551);
+    }
+L552: /* LINE */
+    f->line = code + 552;
+    f->lineno = 124;
+L560: /* STRING */
+    tp_aot_op(tp, f, code + 560);
+L563: /* STRING */
+    tp_aot_op(tp, f, code + 563);
+L567: /* METHOD */
+    tp_aot_op(tp, f, code + 567);
+L569: /* MOVE */
+    regs[14] = regs[3];
+L570: /* CALLM */
+    return code + 570;
+L571: /* ADD */
+    if (TP_BOTH(regs[10], regs[11], TP_NUMBER_INT)) {
+        regs[10] = tp_int(regs[10].nint + regs[11].nint);
+    } else {
+        tp_aot_op(tp, f, code + 571);
+    }
+L572: /* LINE */
+    f->line = code + 572;
+    f->lineno = 125;
+L578: /* STRING */
+    tp_aot_op(tp, f, code + 578);
+L581: /* ADD */
+    if (TP_BOTH(regs[10], regs[11], TP_NUMBER_INT)) {
+        regs[9] = tp_int(regs[10].nint + regs[11].nint);
+    } else {
+        tp_aot_op(tp, f, code + 581);
+    }
+L582: /* LINE */
+    f->line = code + 582;
+    f->lineno = 127;
+L598: /* STRING */
+    tp_aot_op(tp, f, code + 598);
+L601: /* STRING */
+    tp_aot_op(tp, f, code + 601);
+L605: /* METHOD */
+    tp_aot_op(tp, f, code + 605);
+L607: /* MOVE */
+    regs[14] = regs[4];
+L608: /* MOVE */
+    regs[15] = regs[5];
+L609: /* MOVE */
+    regs[16] = regs[8];
+L610: /* MOVE */
+    regs[17] = regs[9];
+L611: /* LIST */
+    tp_aot_op(tp, f, code + 611);
+L612: /* CALLM */
+    return code + 612;
+L613: /* RETURN */
+    return code + 613;
+L614: /* EOF */
+    return code + 614;
+}
+
+static const tpd_aot _tp_tinypy_compiler_opcodes_aot[] = {
+    {0, _tp_tinypy_compiler_opcodes_0},
+    {819, _tp_tinypy_compiler_opcodes_819},
+    {1058, _tp_tinypy_compiler_opcodes_1058},
+};
+
+void tinypy_compiler_opcodes_init(TP) {
+    tp_aot_import(tp, "tinypy.compiler.opcodes", _tp_tinypy_compiler_opcodes_tpc, sizeof(_tp_tinypy_compiler_opcodes_tpc),
+        _tp_tinypy_compiler_opcodes_aot, 3);
+}
@@ -17,9 +17,12 @@ BITNOT = 49
 
 MOVE = 16
 MGET = 9
+METHOD = 56
 GET = 10
 SET = 11
 ITER = 43
+RANGE = 58
+FOR = 59
 
 LEN = 30
 GGET = 14
@@ -33,6 +36,8 @@ PASS = 18
 
 JUMP = 19
 CALL = 20
+CALLP = 55
+CALLM = 57
 RETURN = 21
 IF = 22
 IFN = 47
@@ -45,6 +50,8 @@ NOTIN = 8
 EQ = 24
 LE = 25
 LT = 26
+GE = 53
+GT = 54
 NE = 36
 IN = 37
 
@@ -63,6 +70,17 @@ NAME = 35
 REGS = 45
 VAR = 51
 
+# The VM writes these over GET, ADD and ITER as it runs them; the compiler
+# never emits them. See tp_quicken.c.
+GET_LIST = 60
+GET_DICT = 61
+GET_ANY = 62
+ADD_INT = 63
+ADD_FLOAT = 64
+ADD_ANY = 65
+ITER_LIST = 66
+ITER_ANY = 67
+
 def _make_dicts():
     names = {}
     codes = {}
@@ -81,12 +99,14 @@ names, codes = _make_dicts()
 def create_ccode():
     lines = []
     cases = []
+    labels = []
 
     for name in codes:
         cval = codes[name]
         cname = "TP_I" + name
         lines.append("#define " + cname + " " + str(cval) + " ")
         cases.append("case " + cname + ': return "' + name + '";')
+        labels.append("    [" + cname + "] = L(" + name + "), \\")
 
     cases.append("default : return NULL;");
     header = "/* Generated from opcodes.py with tpc -x. Do not modify. */\n"
@@ -96,4 +116,12 @@ def create_ccode():
        + '\n'.join(cases)
        + "\n}\n}\n"
     )
-    return '\n'.join([header, enums, translate])
+    # label table for the threaded dispatch engine in tp_step;
+    # L(name) maps an opcode name to a label address, and every byte
+    # that is not an opcode dispatches to DEFAULT.
+    dispatch = ("#define TP_DISPATCH_TABLE(L, DEFAULT) { \\\n"
+       + "    [0 ... 255] = DEFAULT, \\\n"
+       + '\n'.join(labels)
+       + "\n}\n"
+    )
+    return '\n'.join([header, enums, translate, dispatch])
@@ -0,0 +1,13025 @@
+/* Generated from tinypy/compiler/parse.py with tpc -a. Do not modify. */
+#include <tinypy/tp.h>
+
+static unsigned char _tp_tinypy_compiler_parse_tpc[] = {
+0x2d,0x67,0x00,0xa3,0x00,0x00,0x00,0x00,0x1f,0x0b,0x00,0x01,0x69,0x6d,0x70,0x6f,
+0x72,0x74,0x20,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,
+0x65,0x72,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x20,0x61,0x73,0x20,0x74,
+0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x00,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x18,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,0x22,0x00,0x00,0x00,
+0x0d,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x3f,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
+0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x0a,0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,
+0x5f,0x5f,0x00,0x00,0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2e,0x74,0x6f,0x6b,0x65,
+0x6e,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x1d,0x03,0x00,0x00,0x37,0x00,0x01,0x03,
+0x0d,0x01,0x00,0x04,0x00,0x00,0x00,0x08,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,
+0x00,0x00,0x00,0x00,0x0f,0x01,0x00,0x00,0x1f,0x0b,0x00,0x02,0x66,0x72,0x6f,0x6d,
+0x20,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,
+0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x20,0x69,0x6d,0x70,0x6f,0x72,0x74,
+0x20,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x0a,
+0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,0x5f,0x5f,0x00,0x00,0x0d,0x02,0x00,0x03,
+0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,
+0x0d,0x04,0x00,0x05,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x1c,0x03,0x04,0x01,0x37,0x00,0x01,0x03,0x0e,0x01,0x00,0x06,0x00,0x00,0x00,0x08,
+0x5f,0x5f,0x64,0x69,0x63,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,0x32,0x01,0x00,0x00,
+0x1f,0x09,0x00,0x03,0x66,0x72,0x6f,0x6d,0x20,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,
+0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2e,0x62,0x6f,0x6f,0x74,0x20,0x69,0x6d,
+0x70,0x6f,0x72,0x74,0x20,0x2a,0x00,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x0a,
+0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,0x5f,0x5f,0x00,0x00,0x0d,0x02,0x00,0x07,
+0x00,0x00,0x00,0x14,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2e,0x62,0x6f,0x6f,0x74,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x08,
+0x00,0x00,0x00,0x01,0x2a,0x00,0x00,0x00,0x37,0x00,0x01,0x03,0x0e,0x01,0x00,0x06,
+0x00,0x00,0x00,0x08,0x5f,0x5f,0x64,0x69,0x63,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,
+0x32,0x01,0x00,0x00,0x1f,0x05,0x00,0x05,0x64,0x65,0x66,0x20,0x63,0x68,0x65,0x63,
+0x6b,0x28,0x74,0x2c,0x2a,0x76,0x73,0x29,0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x04,
+0x2a,0x24,0x31,0x38,0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x09,0x00,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x1c,0x01,0x05,0x01,0x1c,0x02,0x00,0x00,0x0d,0x03,0x00,0x0a,
+0x00,0x00,0x00,0x02,0x76,0x73,0x00,0x00,0x1d,0x04,0x00,0x00,0x11,0x00,0x00,0x7c,
+0x2d,0x04,0x00,0x07,0x00,0x00,0x00,0x03,0x1f,0x05,0x00,0x05,0x64,0x65,0x66,0x20,
+0x63,0x68,0x65,0x63,0x6b,0x28,0x74,0x2c,0x2a,0x76,0x73,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x33,0x01,0x00,0x02,0x76,0x73,0x00,0x00,
+0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,
+0x00,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x05,
+0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,0x23,0x02,0x00,0x00,0x1f,0x09,0x00,0x06,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x76,0x73,0x5b,0x30,0x5d,0x20,0x3d,0x3d,0x20,
+0x4e,0x6f,0x6e,0x65,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x54,0x72,0x75,
+0x65,0x00,0x00,0x00,0x0c,0x03,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x02,0x01,0x03,0x1d,0x03,0x00,0x00,0x18,0x02,0x02,0x03,0x16,0x02,0x00,0x00,
+0x13,0x00,0x00,0x05,0x0c,0x02,0x00,0x03,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x15,0x02,0x00,0x00,0x1f,0x09,0x00,0x07,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,
+0x2e,0x74,0x79,0x70,0x65,0x20,0x69,0x6e,0x20,0x76,0x73,0x3a,0x20,0x72,0x65,0x74,
+0x75,0x72,0x6e,0x20,0x54,0x72,0x75,0x65,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x04,
+0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x09,0x02,0x00,0x03,
+0x00,0x00,0x00,0x00,0x25,0x02,0x02,0x01,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x05,
+0x0c,0x02,0x00,0x03,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x15,0x02,0x00,0x00,
+0x1f,0x0e,0x00,0x08,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,0x2e,0x74,0x79,0x70,
+0x65,0x20,0x3d,0x3d,0x20,0x27,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x27,0x20,0x61,0x6e,
+0x64,0x20,0x74,0x2e,0x76,0x61,0x6c,0x20,0x69,0x6e,0x20,0x76,0x73,0x3a,0x20,0x72,
+0x65,0x74,0x75,0x72,0x6e,0x20,0x54,0x72,0x75,0x65,0x00,0x00,0x0d,0x03,0x00,0x04,
+0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x09,0x02,0x00,0x03,
+0x00,0x00,0x00,0x01,0x0d,0x03,0x00,0x05,0x00,0x00,0x00,0x06,0x73,0x79,0x6d,0x62,
+0x6f,0x6c,0x00,0x00,0x18,0x02,0x02,0x03,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x07,
+0x0d,0x03,0x00,0x06,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x09,0x02,0x00,0x03,
+0x00,0x00,0x00,0x02,0x25,0x02,0x02,0x01,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x05,
+0x0c,0x02,0x00,0x03,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x15,0x02,0x00,0x00,
+0x1f,0x05,0x00,0x09,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x46,
+0x61,0x6c,0x73,0x65,0x00,0x00,0x00,0x00,0x0c,0x02,0x00,0x02,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x15,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x0b,
+0x00,0x00,0x00,0x05,0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,0x0f,0x01,0x00,0x00,
+0x1f,0x04,0x00,0x0b,0x64,0x65,0x66,0x20,0x74,0x77,0x65,0x61,0x6b,0x28,0x6b,0x2c,
+0x76,0x29,0x3a,0x00,0x33,0x01,0x00,0x04,0x2a,0x24,0x32,0x35,0x00,0x00,0x00,0x00,
+0x0d,0x06,0x00,0x0c,0x00,0x00,0x00,0x01,0x6b,0x00,0x00,0x00,0x0d,0x07,0x00,0x0d,
+0x00,0x00,0x00,0x01,0x76,0x00,0x00,0x00,0x1c,0x02,0x06,0x02,0x1c,0x03,0x00,0x00,
+0x1d,0x04,0x00,0x00,0x1d,0x05,0x00,0x00,0x11,0x01,0x00,0x70,0x2d,0x08,0x00,0x0b,
+0x00,0x00,0x00,0x02,0x1f,0x04,0x00,0x0b,0x64,0x65,0x66,0x20,0x74,0x77,0x65,0x61,
+0x6b,0x28,0x6b,0x2c,0x76,0x29,0x3a,0x00,0x33,0x00,0x00,0x01,0x6b,0x00,0x00,0x00,
+0x33,0x01,0x00,0x01,0x76,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x18,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,0x22,0x02,0x00,0x00,
+0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x05,0x74,0x77,0x65,0x61,0x6b,0x00,0x00,0x00,
+0x23,0x02,0x00,0x00,0x1f,0x08,0x00,0x0c,0x20,0x20,0x20,0x20,0x50,0x2e,0x73,0x74,
+0x61,0x63,0x6b,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x28,0x6b,0x2c,0x64,0x6d,
+0x61,0x70,0x5b,0x6b,0x5d,0x29,0x29,0x00,0x0e,0x06,0x00,0x02,0x00,0x00,0x00,0x01,
+0x50,0x00,0x00,0x00,0x0d,0x07,0x00,0x03,0x00,0x00,0x00,0x05,0x73,0x74,0x61,0x63,
+0x6b,0x00,0x00,0x00,0x09,0x06,0x06,0x07,0x00,0x00,0x00,0x00,0x0d,0x07,0x00,0x04,
+0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x03,0x06,0x07,
+0x00,0x00,0x00,0x01,0x10,0x06,0x00,0x00,0x0e,0x07,0x00,0x05,0x00,0x00,0x00,0x04,
+0x64,0x6d,0x61,0x70,0x00,0x00,0x00,0x00,0x0a,0x07,0x07,0x00,0x1c,0x05,0x06,0x02,
+0x39,0x02,0x03,0x03,0x1f,0x07,0x00,0x0d,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x76,
+0x3a,0x20,0x64,0x6d,0x61,0x70,0x5b,0x6b,0x5d,0x20,0x3d,0x20,0x6f,0x6d,0x61,0x70,
+0x5b,0x6b,0x5d,0x00,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x0c,0x0e,0x02,0x00,0x05,
+0x00,0x00,0x00,0x04,0x64,0x6d,0x61,0x70,0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x06,
+0x00,0x00,0x00,0x04,0x6f,0x6d,0x61,0x70,0x00,0x00,0x00,0x00,0x0a,0x03,0x03,0x00,
+0x0b,0x02,0x00,0x03,0x13,0x00,0x00,0x20,0x1f,0x0b,0x00,0x0e,0x20,0x20,0x20,0x20,
+0x65,0x6c,0x73,0x65,0x3a,0x20,0x64,0x6d,0x61,0x70,0x5b,0x6b,0x5d,0x20,0x3d,0x20,
+0x7b,0x27,0x6c,0x62,0x70,0x27,0x3a,0x30,0x2c,0x27,0x6e,0x75,0x64,0x27,0x3a,0x69,
+0x74,0x73,0x65,0x6c,0x66,0x7d,0x00,0x00,0x0e,0x02,0x00,0x05,0x00,0x00,0x00,0x04,
+0x64,0x6d,0x61,0x70,0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x07,0x00,0x00,0x00,0x03,
+0x6c,0x62,0x70,0x00,0x0c,0x05,0x00,0x08,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0d,0x06,0x00,0x09,0x00,0x00,0x00,0x03,0x6e,0x75,0x64,0x00,0x0e,0x07,0x00,0x0a,
+0x00,0x00,0x00,0x06,0x69,0x74,0x73,0x65,0x6c,0x66,0x00,0x00,0x1b,0x03,0x04,0x04,
+0x0b,0x02,0x00,0x03,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x0e,0x00,0x00,0x00,0x05,
+0x74,0x77,0x65,0x61,0x6b,0x00,0x00,0x00,0x0f,0x02,0x01,0x00,0x1f,0x04,0x00,0x0f,
+0x64,0x65,0x66,0x20,0x72,0x65,0x73,0x74,0x6f,0x72,0x65,0x28,0x29,0x3a,0x00,0x00,
+0x33,0x02,0x00,0x04,0x2a,0x24,0x33,0x33,0x00,0x00,0x00,0x00,0x1c,0x03,0x00,0x00,
+0x1c,0x04,0x00,0x00,0x1d,0x05,0x00,0x00,0x1d,0x06,0x00,0x00,0x11,0x02,0x00,0x4a,
+0x2d,0x06,0x00,0x08,0x00,0x00,0x00,0x02,0x1f,0x04,0x00,0x0f,0x64,0x65,0x66,0x20,
+0x72,0x65,0x73,0x74,0x6f,0x72,0x65,0x28,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x0b,
+0x5f,0x5f,0x76,0x61,0x72,0x61,0x72,0x67,0x73,0x5f,0x5f,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x07,0x72,0x65,0x73,0x74,
+0x6f,0x72,0x65,0x00,0x23,0x01,0x00,0x00,0x1f,0x06,0x00,0x10,0x20,0x20,0x20,0x20,
+0x6b,0x2c,0x76,0x20,0x3d,0x20,0x50,0x2e,0x73,0x74,0x61,0x63,0x6b,0x2e,0x70,0x6f,
+0x70,0x28,0x29,0x00,0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x03,0x00,0x00,0x00,0x05,0x73,0x74,0x61,0x63,0x6b,0x00,0x00,0x00,
+0x09,0x02,0x02,0x03,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x04,0x00,0x00,0x00,0x03,
+0x70,0x6f,0x70,0x00,0x38,0x04,0x02,0x03,0x00,0x00,0x00,0x01,0x39,0x01,0x04,0x02,
+0x33,0x01,0x00,0x03,0x2a,0x24,0x32,0x00,0x33,0x04,0x00,0x01,0x6b,0x00,0x00,0x00,
+0x0c,0x02,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x04,0x01,0x02,
+0x33,0x05,0x00,0x01,0x76,0x00,0x00,0x00,0x0c,0x03,0x00,0x06,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x05,0x01,0x03,0x1f,0x04,0x00,0x11,0x20,0x20,0x20,0x20,
+0x64,0x6d,0x61,0x70,0x5b,0x6b,0x5d,0x20,0x3d,0x20,0x76,0x00,0x0e,0x01,0x00,0x07,
+0x00,0x00,0x00,0x04,0x64,0x6d,0x61,0x70,0x00,0x00,0x00,0x00,0x0b,0x01,0x04,0x05,
+0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x0f,0x00,0x00,0x00,0x07,0x72,0x65,0x73,0x74,
+0x6f,0x72,0x65,0x00,0x0f,0x03,0x02,0x00,0x1f,0x03,0x00,0x13,0x64,0x65,0x66,0x20,
+0x63,0x70,0x79,0x28,0x64,0x29,0x3a,0x00,0x33,0x03,0x00,0x04,0x2a,0x24,0x33,0x39,
+0x00,0x00,0x00,0x00,0x0d,0x08,0x00,0x10,0x00,0x00,0x00,0x01,0x64,0x00,0x00,0x00,
+0x1c,0x04,0x08,0x01,0x1c,0x05,0x00,0x00,0x1d,0x06,0x00,0x00,0x1d,0x07,0x00,0x00,
+0x11,0x03,0x00,0x39,0x2d,0x05,0x00,0x03,0x00,0x00,0x00,0x00,0x1f,0x03,0x00,0x13,
+0x64,0x65,0x66,0x20,0x63,0x70,0x79,0x28,0x64,0x29,0x3a,0x00,0x33,0x00,0x00,0x01,
+0x64,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,
+0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,
+0x00,0x00,0x00,0x03,0x63,0x70,0x79,0x00,0x23,0x01,0x00,0x00,0x1f,0x03,0x00,0x14,
+0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x7b,0x7d,0x00,0x00,0x33,0x01,0x00,0x01,
+0x72,0x00,0x00,0x00,0x1b,0x02,0x00,0x00,0x10,0x01,0x02,0x00,0x1f,0x07,0x00,0x15,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x6b,0x20,0x69,0x6e,0x20,0x64,0x3a,0x20,
+0x72,0x5b,0x6b,0x5d,0x20,0x3d,0x20,0x64,0x5b,0x6b,0x5d,0x00,0x0c,0x03,0x00,0x02,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x02,0x00,0x03,0x13,0x00,0x00,0x07,
+0x33,0x04,0x00,0x01,0x6b,0x00,0x00,0x00,0x10,0x04,0x02,0x00,0x0a,0x02,0x00,0x04,
+0x0b,0x01,0x04,0x02,0x13,0x00,0xff,0xf9,0x1f,0x04,0x00,0x16,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,0x15,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x11,0x00,0x00,0x00,0x03,0x63,0x70,0x79,0x00,
+0x0f,0x04,0x03,0x00,0x1f,0x04,0x00,0x18,0x63,0x6c,0x61,0x73,0x73,0x20,0x50,0x44,
+0x61,0x74,0x61,0x3a,0x00,0x00,0x00,0x00,0x34,0x04,0x00,0x00,0x33,0x04,0x00,0x04,
+0x2a,0x24,0x34,0x36,0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x12,0x00,0x00,0x00,0x05,
+0x50,0x44,0x61,0x74,0x61,0x00,0x00,0x00,0x0f,0x05,0x04,0x00,0x0e,0x06,0x00,0x13,
+0x00,0x00,0x00,0x07,0x73,0x65,0x74,0x6d,0x65,0x74,0x61,0x00,0x10,0x07,0x04,0x00,
+0x0e,0x08,0x00,0x14,0x00,0x00,0x00,0x06,0x6f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,
+0x37,0x05,0x06,0x03,0x33,0x04,0x00,0x04,0x2a,0x24,0x35,0x32,0x00,0x00,0x00,0x00,
+0x1c,0x05,0x00,0x00,0x1c,0x06,0x00,0x00,0x1d,0x07,0x00,0x00,0x1d,0x08,0x00,0x00,
+0x11,0x04,0x02,0xe8,0x2d,0x0b,0x00,0x09,0x00,0x00,0x00,0x00,0x1f,0x04,0x00,0x18,
+0x63,0x6c,0x61,0x73,0x73,0x20,0x50,0x44,0x61,0x74,0x61,0x3a,0x00,0x00,0x00,0x00,
+0x1f,0x09,0x00,0x19,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x5f,0x5f,0x69,0x6e,
+0x69,0x74,0x5f,0x5f,0x28,0x73,0x65,0x6c,0x66,0x2c,0x73,0x2c,0x74,0x6f,0x6b,0x65,
+0x6e,0x73,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x03,0x2a,0x24,0x30,0x00,
+0x0d,0x05,0x00,0x00,0x00,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,
+0x0d,0x06,0x00,0x01,0x00,0x00,0x00,0x01,0x73,0x00,0x00,0x00,0x0d,0x07,0x00,0x02,
+0x00,0x00,0x00,0x06,0x74,0x6f,0x6b,0x65,0x6e,0x73,0x00,0x00,0x1c,0x01,0x05,0x03,
+0x1c,0x02,0x00,0x00,0x1d,0x03,0x00,0x00,0x1d,0x04,0x00,0x00,0x11,0x00,0x00,0x78,
+0x2d,0x05,0x00,0x09,0x00,0x00,0x00,0x00,0x1f,0x09,0x00,0x19,0x20,0x20,0x20,0x20,
+0x64,0x65,0x66,0x20,0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,0x28,0x73,0x65,0x6c,
+0x66,0x2c,0x73,0x2c,0x74,0x6f,0x6b,0x65,0x6e,0x73,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x01,
+0x73,0x00,0x00,0x00,0x33,0x02,0x00,0x06,0x74,0x6f,0x6b,0x65,0x6e,0x73,0x00,0x00,
+0x0d,0x03,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,
+0x00,0x00,0x00,0x00,0x22,0x03,0x00,0x00,0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x08,
+0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,0x23,0x03,0x00,0x00,
+0x1f,0x05,0x00,0x1a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,
+0x2e,0x73,0x20,0x3d,0x20,0x73,0x00,0x00,0x0d,0x03,0x00,0x02,0x00,0x00,0x00,0x01,
+0x73,0x00,0x00,0x00,0x0b,0x00,0x03,0x01,0x1f,0x08,0x00,0x1b,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x73,0x20,
+0x3d,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x73,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x03,
+0x00,0x00,0x00,0x06,0x74,0x6f,0x6b,0x65,0x6e,0x73,0x00,0x00,0x0b,0x00,0x03,0x02,
+0x1f,0x06,0x00,0x1c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,
+0x2e,0x70,0x6f,0x73,0x20,0x3d,0x20,0x30,0x00,0x00,0x00,0x00,0x0c,0x03,0x00,0x04,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x05,0x00,0x00,0x00,0x03,
+0x70,0x6f,0x73,0x00,0x0b,0x00,0x01,0x03,0x1f,0x07,0x00,0x1d,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,
+0x20,0x4e,0x6f,0x6e,0x65,0x00,0x00,0x00,0x1d,0x03,0x00,0x00,0x0d,0x01,0x00,0x06,
+0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0b,0x00,0x01,0x03,
+0x1f,0x06,0x00,0x1e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,
+0x2e,0x73,0x74,0x61,0x63,0x6b,0x20,0x3d,0x20,0x5b,0x5d,0x00,0x1c,0x03,0x00,0x00,
+0x0d,0x01,0x00,0x07,0x00,0x00,0x00,0x05,0x73,0x74,0x61,0x63,0x6b,0x00,0x00,0x00,
+0x0b,0x00,0x01,0x03,0x1f,0x07,0x00,0x1f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x73,0x65,0x6c,0x66,0x2e,0x5f,0x74,0x65,0x72,0x6d,0x69,0x6e,0x61,0x6c,0x20,0x3d,
+0x20,0x30,0x00,0x00,0x0c,0x03,0x00,0x04,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x08,0x00,0x00,0x00,0x09,0x5f,0x74,0x65,0x72,0x6d,0x69,0x6e,0x61,
+0x6c,0x00,0x00,0x00,0x0b,0x00,0x01,0x03,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x08,
+0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,0x10,0x01,0x00,0x00,
+0x1f,0x05,0x00,0x20,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x69,0x6e,0x69,0x74,
+0x28,0x73,0x65,0x6c,0x66,0x29,0x3a,0x00,0x33,0x02,0x00,0x03,0x2a,0x24,0x38,0x00,
+0x0d,0x07,0x00,0x00,0x00,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,
+0x1c,0x03,0x07,0x01,0x1c,0x04,0x00,0x00,0x1d,0x05,0x00,0x00,0x1d,0x06,0x00,0x00,
+0x11,0x02,0x00,0x60,0x2d,0x05,0x00,0x07,0x00,0x00,0x00,0x01,0x1f,0x05,0x00,0x20,
+0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x69,0x6e,0x69,0x74,0x28,0x73,0x65,0x6c,
+0x66,0x29,0x3a,0x00,0x33,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,
+0x00,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x04,
+0x69,0x6e,0x69,0x74,0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x07,0x00,0x21,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x20,0x6f,
+0x6d,0x61,0x70,0x2c,0x64,0x6d,0x61,0x70,0x00,0x00,0x00,0x00,0x1f,0x08,0x00,0x22,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x6d,0x61,0x70,0x20,0x3d,0x20,0x63,
+0x70,0x79,0x28,0x62,0x61,0x73,0x65,0x5f,0x64,0x6d,0x61,0x70,0x29,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x02,0x00,0x00,0x00,0x04,0x6f,0x6d,0x61,0x70,0x00,0x00,0x00,0x00,
+0x0e,0x03,0x00,0x03,0x00,0x00,0x00,0x03,0x63,0x70,0x79,0x00,0x0e,0x04,0x00,0x04,
+0x00,0x00,0x00,0x09,0x62,0x61,0x73,0x65,0x5f,0x64,0x6d,0x61,0x70,0x00,0x00,0x00,
+0x37,0x02,0x03,0x02,0x0f,0x01,0x02,0x00,0x1f,0x08,0x00,0x23,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x64,0x6d,0x61,0x70,0x20,0x3d,0x20,0x63,0x70,0x79,0x28,0x62,
+0x61,0x73,0x65,0x5f,0x64,0x6d,0x61,0x70,0x29,0x00,0x00,0x00,0x0d,0x01,0x00,0x05,
+0x00,0x00,0x00,0x04,0x64,0x6d,0x61,0x70,0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x03,
+0x00,0x00,0x00,0x03,0x63,0x70,0x79,0x00,0x0e,0x04,0x00,0x04,0x00,0x00,0x00,0x09,
+0x62,0x61,0x73,0x65,0x5f,0x64,0x6d,0x61,0x70,0x00,0x00,0x00,0x37,0x02,0x03,0x02,
+0x0f,0x01,0x02,0x00,0x1f,0x06,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x73,0x65,0x6c,0x66,0x2e,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x29,0x00,0x00,
+0x0d,0x04,0x00,0x06,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,
+0x38,0x02,0x00,0x04,0x00,0x00,0x00,0x00,0x39,0x01,0x02,0x02,0x00,0x00,0x00,0x00,
+0x33,0x03,0x00,0x04,0x69,0x6e,0x69,0x74,0x00,0x00,0x00,0x00,0x10,0x03,0x02,0x00,
+0x1f,0x08,0x00,0x25,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x61,0x64,0x76,0x61,
+0x6e,0x63,0x65,0x28,0x73,0x65,0x6c,0x66,0x2c,0x76,0x61,0x6c,0x3d,0x4e,0x6f,0x6e,
+0x65,0x29,0x3a,0x00,0x33,0x04,0x00,0x04,0x2a,0x24,0x31,0x34,0x00,0x00,0x00,0x00,
+0x0d,0x09,0x00,0x00,0x00,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,
+0x0d,0x0a,0x00,0x03,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x1c,0x05,0x09,0x02,
+0x1d,0x09,0x00,0x00,0x1c,0x06,0x09,0x01,0x1d,0x07,0x00,0x00,0x1d,0x08,0x00,0x00,
+0x11,0x04,0x01,0x2f,0x2d,0x0a,0x00,0x12,0x00,0x00,0x00,0x09,0x1f,0x08,0x00,0x25,
+0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,
+0x73,0x65,0x6c,0x66,0x2c,0x76,0x61,0x6c,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,
+0x33,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x03,
+0x76,0x61,0x6c,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,
+0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,
+0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x23,0x02,0x00,0x00,
+0x1f,0x0a,0x00,0x26,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,
+0x6f,0x74,0x20,0x63,0x68,0x65,0x63,0x6b,0x28,0x73,0x65,0x6c,0x66,0x2e,0x74,0x6f,
+0x6b,0x65,0x6e,0x2c,0x76,0x61,0x6c,0x29,0x3a,0x00,0x00,0x00,0x0e,0x04,0x00,0x02,
+0x00,0x00,0x00,0x05,0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,0x0d,0x07,0x00,0x03,
+0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x09,0x05,0x00,0x07,
+0x00,0x00,0x00,0x00,0x10,0x06,0x01,0x00,0x37,0x03,0x04,0x03,0x2f,0x03,0x00,0x00,
+0x13,0x00,0x00,0x1f,0x1f,0x0c,0x00,0x27,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x65,0x72,0x72,0x6f,0x72,0x28,0x27,0x65,0x78,0x70,0x65,0x63,
+0x74,0x65,0x64,0x20,0x27,0x2b,0x76,0x61,0x6c,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x74,
+0x6f,0x6b,0x65,0x6e,0x29,0x00,0x00,0x00,0x0e,0x03,0x00,0x04,0x00,0x00,0x00,0x05,
+0x65,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x0d,0x04,0x00,0x05,0x00,0x00,0x00,0x09,
+0x65,0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x20,0x00,0x00,0x00,0x01,0x04,0x04,0x01,
+0x0d,0x06,0x00,0x03,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x09,0x05,0x00,0x06,0x00,0x00,0x00,0x01,0x37,0x02,0x03,0x03,0x1f,0x0a,0x00,0x28,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x73,0x65,0x6c,0x66,0x2e,
+0x70,0x6f,0x73,0x20,0x3c,0x20,0x6c,0x65,0x6e,0x28,0x73,0x65,0x6c,0x66,0x2e,0x74,
+0x6f,0x6b,0x65,0x6e,0x73,0x29,0x3a,0x00,0x0d,0x03,0x00,0x06,0x00,0x00,0x00,0x03,
+0x70,0x6f,0x73,0x00,0x09,0x02,0x00,0x03,0x00,0x00,0x00,0x02,0x0e,0x04,0x00,0x07,
+0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x0d,0x06,0x00,0x08,0x00,0x00,0x00,0x06,
+0x74,0x6f,0x6b,0x65,0x6e,0x73,0x00,0x00,0x09,0x05,0x00,0x06,0x00,0x00,0x00,0x03,
+0x37,0x03,0x04,0x02,0x1a,0x02,0x02,0x03,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x30,
+0x1f,0x0a,0x00,0x29,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x74,0x20,0x3d,0x20,0x73,0x65,0x6c,0x66,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x73,0x5b,
+0x73,0x65,0x6c,0x66,0x2e,0x70,0x6f,0x73,0x5d,0x00,0x00,0x00,0x33,0x02,0x00,0x01,
+0x74,0x00,0x00,0x00,0x0d,0x04,0x00,0x08,0x00,0x00,0x00,0x06,0x74,0x6f,0x6b,0x65,
+0x6e,0x73,0x00,0x00,0x09,0x03,0x00,0x04,0x00,0x00,0x00,0x04,0x0d,0x05,0x00,0x06,
+0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x04,0x00,0x05,0x00,0x00,0x00,0x05,
+0x0a,0x02,0x03,0x04,0x1f,0x07,0x00,0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,0x2e,0x70,0x6f,0x73,0x20,0x2b,0x3d,0x20,
+0x31,0x00,0x00,0x00,0x0d,0x04,0x00,0x06,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,
+0x09,0x03,0x00,0x04,0x00,0x00,0x00,0x06,0x0c,0x04,0x00,0x09,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x01,0x03,0x03,0x04,0x0d,0x04,0x00,0x06,0x00,0x00,0x00,0x03,
+0x70,0x6f,0x73,0x00,0x0b,0x00,0x04,0x03,0x13,0x00,0x00,0x1f,0x1f,0x0b,0x00,0x2c,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x20,0x3d,0x20,
+0x54,0x6f,0x6b,0x65,0x6e,0x28,0x28,0x30,0x2c,0x30,0x29,0x2c,0x27,0x65,0x6f,0x66,
+0x27,0x2c,0x27,0x65,0x6f,0x66,0x27,0x29,0x00,0x00,0x00,0x00,0x0e,0x04,0x00,0x0a,
+0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0c,0x08,0x00,0x0b,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0c,0x09,0x00,0x0b,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x1c,0x05,0x08,0x02,0x0d,0x06,0x00,0x0c,0x00,0x00,0x00,0x03,
+0x65,0x6f,0x66,0x00,0x0d,0x07,0x00,0x0c,0x00,0x00,0x00,0x03,0x65,0x6f,0x66,0x00,
+0x37,0x02,0x04,0x04,0x1f,0x07,0x00,0x2d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x73,0x65,0x6c,0x66,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x3d,0x20,0x64,0x6f,0x28,
+0x74,0x29,0x00,0x00,0x0e,0x04,0x00,0x0d,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,
+0x10,0x05,0x02,0x00,0x37,0x03,0x04,0x02,0x0d,0x04,0x00,0x03,0x00,0x00,0x00,0x05,
+0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0b,0x00,0x04,0x03,0x1f,0x07,0x00,0x2f,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,0x2e,0x5f,0x74,0x65,
+0x72,0x6d,0x69,0x6e,0x61,0x6c,0x20,0x2b,0x3d,0x20,0x31,0x00,0x0d,0x04,0x00,0x0e,
+0x00,0x00,0x00,0x09,0x5f,0x74,0x65,0x72,0x6d,0x69,0x6e,0x61,0x6c,0x00,0x00,0x00,
+0x09,0x03,0x00,0x04,0x00,0x00,0x00,0x07,0x0c,0x04,0x00,0x09,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x01,0x03,0x03,0x04,0x0d,0x04,0x00,0x0e,0x00,0x00,0x00,0x09,
+0x5f,0x74,0x65,0x72,0x6d,0x69,0x6e,0x61,0x6c,0x00,0x00,0x00,0x0b,0x00,0x04,0x03,
+0x1f,0x0e,0x00,0x30,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x63,
+0x68,0x65,0x63,0x6b,0x28,0x73,0x65,0x6c,0x66,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2c,
+0x27,0x6e,0x6c,0x27,0x2c,0x27,0x65,0x6f,0x66,0x27,0x2c,0x27,0x3b,0x27,0x2c,0x27,
+0x64,0x65,0x64,0x65,0x6e,0x74,0x27,0x29,0x3a,0x00,0x00,0x00,0x0e,0x04,0x00,0x02,
+0x00,0x00,0x00,0x05,0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,0x0d,0x01,0x00,0x03,
+0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x09,0x05,0x00,0x01,
+0x00,0x00,0x00,0x08,0x0d,0x06,0x00,0x0f,0x00,0x00,0x00,0x02,0x6e,0x6c,0x00,0x00,
+0x0d,0x07,0x00,0x0c,0x00,0x00,0x00,0x03,0x65,0x6f,0x66,0x00,0x0d,0x08,0x00,0x10,
+0x00,0x00,0x00,0x01,0x3b,0x00,0x00,0x00,0x0d,0x09,0x00,0x11,0x00,0x00,0x00,0x06,
+0x64,0x65,0x64,0x65,0x6e,0x74,0x00,0x00,0x37,0x03,0x04,0x06,0x16,0x03,0x00,0x00,
+0x13,0x00,0x00,0x13,0x1f,0x08,0x00,0x31,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,0x2e,0x5f,0x74,0x65,0x72,0x6d,0x69,0x6e,
+0x61,0x6c,0x20,0x3d,0x20,0x30,0x00,0x00,0x0c,0x03,0x00,0x0b,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x0e,0x00,0x00,0x00,0x09,0x5f,0x74,0x65,0x72,
+0x6d,0x69,0x6e,0x61,0x6c,0x00,0x00,0x00,0x0b,0x00,0x04,0x03,0x1f,0x05,0x00,0x32,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,
+0x00,0x00,0x00,0x00,0x15,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x05,0x00,0x07,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x10,0x05,0x04,0x00,0x1f,0x06,0x00,0x34,
+0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x74,0x65,0x72,0x6d,0x69,0x6e,0x61,0x6c,
+0x28,0x73,0x65,0x6c,0x66,0x29,0x3a,0x00,0x33,0x06,0x00,0x04,0x2a,0x24,0x32,0x32,
+0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,
+0x00,0x00,0x00,0x00,0x1c,0x07,0x02,0x01,0x1c,0x08,0x00,0x00,0x1d,0x09,0x00,0x00,
+0x1d,0x0a,0x00,0x00,0x11,0x06,0x00,0x54,0x2d,0x05,0x00,0x07,0x00,0x00,0x00,0x02,
+0x1f,0x06,0x00,0x34,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x74,0x65,0x72,0x6d,
+0x69,0x6e,0x61,0x6c,0x28,0x73,0x65,0x6c,0x66,0x29,0x3a,0x00,0x33,0x00,0x00,0x04,
+0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x18,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x08,0x74,0x65,0x72,0x6d,0x69,0x6e,0x61,0x6c,
+0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x08,0x00,0x35,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x73,0x65,0x6c,0x66,0x2e,0x5f,0x74,0x65,0x72,
+0x6d,0x69,0x6e,0x61,0x6c,0x20,0x3e,0x20,0x31,0x3a,0x00,0x00,0x0d,0x02,0x00,0x02,
+0x00,0x00,0x00,0x09,0x5f,0x74,0x65,0x72,0x6d,0x69,0x6e,0x61,0x6c,0x00,0x00,0x00,
+0x09,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x0c,0x02,0x00,0x03,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x36,0x01,0x01,0x02,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x21,
+0x1f,0x0d,0x00,0x36,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x65,0x72,0x72,0x6f,0x72,0x28,0x27,0x69,0x6e,0x76,0x61,0x6c,0x69,0x64,0x20,0x73,
+0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x27,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x74,
+0x6f,0x6b,0x65,0x6e,0x29,0x00,0x00,0x00,0x0e,0x02,0x00,0x04,0x00,0x00,0x00,0x05,
+0x65,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x0d,0x03,0x00,0x05,0x00,0x00,0x00,0x11,
+0x69,0x6e,0x76,0x61,0x6c,0x69,0x64,0x20,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,
+0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x09,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x37,0x01,0x02,0x03,
+0x00,0x00,0x00,0x00,0x33,0x07,0x00,0x08,0x74,0x65,0x72,0x6d,0x69,0x6e,0x61,0x6c,
+0x00,0x00,0x00,0x00,0x10,0x07,0x06,0x00,0x0e,0x08,0x00,0x04,0x00,0x00,0x00,0x05,
+0x50,0x44,0x61,0x74,0x61,0x00,0x00,0x00,0x33,0x08,0x00,0x04,0x2a,0x24,0x32,0x38,
+0x00,0x00,0x00,0x00,0x0d,0x09,0x00,0x05,0x00,0x00,0x00,0x08,0x5f,0x5f,0x69,0x6e,
+0x69,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,0x0b,0x08,0x09,0x01,0x0d,0x09,0x00,0x06,
+0x00,0x00,0x00,0x04,0x69,0x6e,0x69,0x74,0x00,0x00,0x00,0x00,0x0b,0x08,0x09,0x03,
+0x0d,0x09,0x00,0x07,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,
+0x0b,0x08,0x09,0x05,0x0d,0x09,0x00,0x08,0x00,0x00,0x00,0x08,0x74,0x65,0x72,0x6d,
+0x69,0x6e,0x61,0x6c,0x00,0x00,0x00,0x00,0x0b,0x08,0x09,0x07,0x00,0x00,0x00,0x00,
+0x1d,0x06,0x00,0x00,0x1d,0x07,0x00,0x00,0x14,0x05,0x04,0x06,0x1f,0x05,0x00,0x38,
+0x64,0x65,0x66,0x20,0x65,0x72,0x72,0x6f,0x72,0x28,0x63,0x74,0x78,0x2c,0x74,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x05,0x00,0x04,0x2a,0x24,0x36,0x30,0x00,0x00,0x00,0x00,
+0x0d,0x0a,0x00,0x15,0x00,0x00,0x00,0x03,0x63,0x74,0x78,0x00,0x0d,0x0b,0x00,0x09,
+0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x1c,0x06,0x0a,0x02,0x1c,0x07,0x00,0x00,
+0x1d,0x08,0x00,0x00,0x1d,0x09,0x00,0x00,0x11,0x05,0x00,0x41,0x2d,0x09,0x00,0x07,
+0x00,0x00,0x00,0x03,0x1f,0x05,0x00,0x38,0x64,0x65,0x66,0x20,0x65,0x72,0x72,0x6f,
+0x72,0x28,0x63,0x74,0x78,0x2c,0x74,0x29,0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x03,
+0x63,0x74,0x78,0x00,0x33,0x01,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,
+0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,
+0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x05,0x65,0x72,0x72,0x6f,
+0x72,0x00,0x00,0x00,0x23,0x02,0x00,0x00,0x1f,0x09,0x00,0x39,0x20,0x20,0x20,0x20,
+0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x2e,0x75,0x5f,0x65,0x72,0x72,0x6f,0x72,
+0x28,0x63,0x74,0x78,0x2c,0x50,0x2e,0x73,0x2c,0x74,0x2e,0x70,0x6f,0x73,0x29,0x00,
+0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x08,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x03,0x00,0x00,0x00,0x07,0x75,0x5f,0x65,0x72,
+0x72,0x6f,0x72,0x00,0x38,0x04,0x02,0x03,0x00,0x00,0x00,0x00,0x10,0x06,0x00,0x00,
+0x0e,0x07,0x00,0x04,0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x0d,0x02,0x00,0x05,
+0x00,0x00,0x00,0x01,0x73,0x00,0x00,0x00,0x09,0x07,0x07,0x02,0x00,0x00,0x00,0x01,
+0x0d,0x02,0x00,0x06,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x08,0x01,0x02,
+0x00,0x00,0x00,0x02,0x39,0x02,0x04,0x05,0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x16,
+0x00,0x00,0x00,0x05,0x65,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x0f,0x06,0x05,0x00,
+0x1f,0x03,0x00,0x3b,0x64,0x65,0x66,0x20,0x6e,0x75,0x64,0x28,0x74,0x29,0x3a,0x00,
+0x33,0x06,0x00,0x04,0x2a,0x24,0x36,0x38,0x00,0x00,0x00,0x00,0x0d,0x0b,0x00,0x09,
+0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x1c,0x07,0x0b,0x01,0x1c,0x08,0x00,0x00,
+0x1d,0x09,0x00,0x00,0x1d,0x0a,0x00,0x00,0x11,0x06,0x00,0x26,0x2d,0x05,0x00,0x02,
+0x00,0x00,0x00,0x01,0x1f,0x03,0x00,0x3b,0x64,0x65,0x66,0x20,0x6e,0x75,0x64,0x28,
+0x74,0x29,0x3a,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x03,0x6e,0x75,0x64,0x00,
+0x23,0x01,0x00,0x00,0x1f,0x05,0x00,0x3e,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x74,0x2e,0x6e,0x75,0x64,0x28,0x74,0x29,0x00,0x0d,0x01,0x00,0x01,
+0x00,0x00,0x00,0x03,0x6e,0x75,0x64,0x00,0x38,0x02,0x00,0x01,0x00,0x00,0x00,0x00,
+0x10,0x04,0x00,0x00,0x39,0x01,0x02,0x03,0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x07,0x00,0x17,0x00,0x00,0x00,0x03,0x6e,0x75,0x64,0x00,0x0f,0x07,0x06,0x00,
+0x1f,0x05,0x00,0x3f,0x64,0x65,0x66,0x20,0x6c,0x65,0x64,0x28,0x74,0x2c,0x6c,0x65,
+0x66,0x74,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x07,0x00,0x04,0x2a,0x24,0x37,0x35,
+0x00,0x00,0x00,0x00,0x0d,0x0c,0x00,0x09,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x0d,0x0d,0x00,0x18,0x00,0x00,0x00,0x04,0x6c,0x65,0x66,0x74,0x00,0x00,0x00,0x00,
+0x1c,0x08,0x0c,0x02,0x1c,0x09,0x00,0x00,0x1d,0x0a,0x00,0x00,0x1d,0x0b,0x00,0x00,
+0x11,0x07,0x00,0x2e,0x2d,0x07,0x00,0x02,0x00,0x00,0x00,0x01,0x1f,0x05,0x00,0x3f,
+0x64,0x65,0x66,0x20,0x6c,0x65,0x64,0x28,0x74,0x2c,0x6c,0x65,0x66,0x74,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x33,0x01,0x00,0x04,
+0x6c,0x65,0x66,0x74,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x18,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,0x22,0x02,0x00,0x00,
+0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x03,0x6c,0x65,0x64,0x00,0x23,0x02,0x00,0x00,
+0x1f,0x07,0x00,0x42,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,
+0x2e,0x6c,0x65,0x64,0x28,0x74,0x2c,0x6c,0x65,0x66,0x74,0x29,0x00,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x03,0x6c,0x65,0x64,0x00,0x38,0x03,0x00,0x02,
+0x00,0x00,0x00,0x00,0x10,0x05,0x00,0x00,0x10,0x06,0x01,0x00,0x39,0x02,0x03,0x04,
+0x15,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x08,0x00,0x19,0x00,0x00,0x00,0x03,
+0x6c,0x65,0x64,0x00,0x0f,0x08,0x07,0x00,0x1f,0x04,0x00,0x43,0x64,0x65,0x66,0x20,
+0x67,0x65,0x74,0x5f,0x6c,0x62,0x70,0x28,0x74,0x29,0x3a,0x00,0x33,0x08,0x00,0x04,
+0x2a,0x24,0x38,0x33,0x00,0x00,0x00,0x00,0x0d,0x0d,0x00,0x09,0x00,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x1c,0x09,0x0d,0x01,0x1c,0x0a,0x00,0x00,0x1d,0x0b,0x00,0x00,
+0x1d,0x0c,0x00,0x00,0x11,0x08,0x00,0x26,0x2d,0x03,0x00,0x03,0x00,0x00,0x00,0x01,
+0x1f,0x04,0x00,0x43,0x64,0x65,0x66,0x20,0x67,0x65,0x74,0x5f,0x6c,0x62,0x70,0x28,
+0x74,0x29,0x3a,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,
+0x6c,0x62,0x70,0x00,0x23,0x01,0x00,0x00,0x1f,0x05,0x00,0x46,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x2e,0x6c,0x62,0x70,0x00,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x02,0x00,0x00,0x00,0x03,0x6c,0x62,0x70,0x00,0x09,0x01,0x00,0x01,
+0x00,0x00,0x00,0x00,0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x09,0x00,0x1a,
+0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,0x6c,0x62,0x70,0x00,0x0f,0x09,0x08,0x00,
+0x1f,0x05,0x00,0x47,0x64,0x65,0x66,0x20,0x67,0x65,0x74,0x5f,0x69,0x74,0x65,0x6d,
+0x73,0x28,0x74,0x29,0x3a,0x00,0x00,0x00,0x33,0x09,0x00,0x04,0x2a,0x24,0x39,0x30,
+0x00,0x00,0x00,0x00,0x0d,0x0e,0x00,0x09,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x1c,0x0a,0x0e,0x01,0x1c,0x0b,0x00,0x00,0x1d,0x0c,0x00,0x00,0x1d,0x0d,0x00,0x00,
+0x11,0x09,0x00,0x29,0x2d,0x03,0x00,0x03,0x00,0x00,0x00,0x01,0x1f,0x05,0x00,0x47,
+0x64,0x65,0x66,0x20,0x67,0x65,0x74,0x5f,0x69,0x74,0x65,0x6d,0x73,0x28,0x74,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x09,0x67,0x65,0x74,0x5f,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x05,0x00,0x4a,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x2e,0x69,0x74,0x65,
+0x6d,0x73,0x00,0x00,0x0d,0x01,0x00,0x02,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x09,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x15,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x0a,0x00,0x1b,0x00,0x00,0x00,0x09,0x67,0x65,0x74,0x5f,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x0f,0x0a,0x09,0x00,0x1f,0x08,0x00,0x4c,
+0x64,0x65,0x66,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x72,
+0x62,0x70,0x2c,0x20,0x6c,0x65,0x66,0x74,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,
+0x33,0x0a,0x00,0x04,0x2a,0x24,0x39,0x37,0x00,0x00,0x00,0x00,0x0d,0x0f,0x00,0x1c,
+0x00,0x00,0x00,0x03,0x72,0x62,0x70,0x00,0x0d,0x10,0x00,0x18,0x00,0x00,0x00,0x04,
+0x6c,0x65,0x66,0x74,0x00,0x00,0x00,0x00,0x1c,0x0b,0x0f,0x02,0x1d,0x0f,0x00,0x00,
+0x1c,0x0c,0x0f,0x01,0x1d,0x0d,0x00,0x00,0x1d,0x0e,0x00,0x00,0x11,0x0a,0x00,0x9f,
+0x2d,0x07,0x00,0x08,0x00,0x00,0x00,0x03,0x1f,0x08,0x00,0x4c,0x64,0x65,0x66,0x20,
+0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x72,0x62,0x70,0x2c,0x20,
+0x6c,0x65,0x66,0x74,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x33,0x00,0x00,0x03,
+0x72,0x62,0x70,0x00,0x33,0x01,0x00,0x04,0x6c,0x65,0x66,0x74,0x00,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,
+0x00,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x0a,
+0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x00,0x00,0x23,0x02,0x00,0x00,
+0x1f,0x06,0x00,0x4d,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6c,0x65,0x66,0x74,0x20,
+0x69,0x73,0x20,0x4e,0x6f,0x6e,0x65,0x3a,0x00,0x00,0x00,0x00,0x1d,0x03,0x00,0x00,
+0x18,0x02,0x01,0x03,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x29,0x1f,0x05,0x00,0x4e,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x20,0x3d,0x20,0x50,0x2e,0x74,0x6f,
+0x6b,0x65,0x6e,0x00,0x33,0x02,0x00,0x01,0x74,0x00,0x00,0x00,0x0e,0x03,0x00,0x02,
+0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x0d,0x04,0x00,0x03,0x00,0x00,0x00,0x05,
+0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x09,0x02,0x03,0x04,0x00,0x00,0x00,0x00,
+0x1f,0x05,0x00,0x4f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,
+0x6e,0x63,0x65,0x28,0x29,0x00,0x00,0x00,0x0e,0x04,0x00,0x04,0x00,0x00,0x00,0x07,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x37,0x03,0x04,0x01,0x1f,0x06,0x00,0x50,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x65,0x66,0x74,0x20,0x3d,0x20,0x6e,
+0x75,0x64,0x28,0x74,0x29,0x00,0x00,0x00,0x0e,0x04,0x00,0x05,0x00,0x00,0x00,0x03,
+0x6e,0x75,0x64,0x00,0x10,0x05,0x02,0x00,0x37,0x01,0x04,0x02,0x1f,0x09,0x00,0x51,
+0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x72,0x62,0x70,0x20,0x3c,0x20,
+0x67,0x65,0x74,0x5f,0x6c,0x62,0x70,0x28,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x29,
+0x3a,0x00,0x00,0x00,0x0e,0x05,0x00,0x06,0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,
+0x6c,0x62,0x70,0x00,0x0e,0x06,0x00,0x02,0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x09,0x06,0x06,0x02,0x00,0x00,0x00,0x01,0x37,0x04,0x05,0x02,0x1a,0x03,0x00,0x04,
+0x16,0x03,0x00,0x00,0x13,0x00,0x00,0x2a,0x1f,0x05,0x00,0x52,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x74,0x20,0x3d,0x20,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x00,
+0x0e,0x03,0x00,0x02,0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x0d,0x04,0x00,0x03,
+0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x09,0x02,0x03,0x04,
+0x00,0x00,0x00,0x02,0x1f,0x05,0x00,0x53,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x29,0x00,0x00,0x00,0x0e,0x04,0x00,0x04,
+0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x37,0x03,0x04,0x01,
+0x1f,0x07,0x00,0x54,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x65,0x66,0x74,
+0x20,0x3d,0x20,0x6c,0x65,0x64,0x28,0x74,0x2c,0x6c,0x65,0x66,0x74,0x29,0x00,0x00,
+0x0e,0x04,0x00,0x07,0x00,0x00,0x00,0x03,0x6c,0x65,0x64,0x00,0x10,0x05,0x02,0x00,
+0x10,0x06,0x01,0x00,0x37,0x01,0x04,0x03,0x13,0x00,0xff,0xc7,0x1f,0x04,0x00,0x55,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6c,0x65,0x66,0x74,0x00,
+0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x0b,0x00,0x1d,0x00,0x00,0x00,0x0a,
+0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x00,0x00,0x0f,0x0b,0x0a,0x00,
+0x1f,0x06,0x00,0x57,0x64,0x65,0x66,0x20,0x69,0x6e,0x66,0x69,0x78,0x5f,0x6c,0x65,
+0x64,0x28,0x74,0x2c,0x6c,0x65,0x66,0x74,0x29,0x3a,0x00,0x00,0x33,0x0b,0x00,0x05,
+0x2a,0x24,0x31,0x30,0x36,0x00,0x00,0x00,0x0d,0x10,0x00,0x09,0x00,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x0d,0x11,0x00,0x18,0x00,0x00,0x00,0x04,0x6c,0x65,0x66,0x74,
+0x00,0x00,0x00,0x00,0x1c,0x0c,0x10,0x02,0x1c,0x0d,0x00,0x00,0x1d,0x0e,0x00,0x00,
+0x1d,0x0f,0x00,0x00,0x11,0x0b,0x00,0x42,0x2d,0x04,0x00,0x05,0x00,0x00,0x00,0x01,
+0x1f,0x06,0x00,0x57,0x64,0x65,0x66,0x20,0x69,0x6e,0x66,0x69,0x78,0x5f,0x6c,0x65,
+0x64,0x28,0x74,0x2c,0x6c,0x65,0x66,0x74,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x33,0x01,0x00,0x04,0x6c,0x65,0x66,0x74,0x00,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,
+0x00,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x09,
+0x69,0x6e,0x66,0x69,0x78,0x5f,0x6c,0x65,0x64,0x00,0x00,0x00,0x23,0x02,0x00,0x00,
+0x1f,0x0a,0x00,0x58,0x20,0x20,0x20,0x20,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x20,
+0x3d,0x20,0x5b,0x6c,0x65,0x66,0x74,0x2c,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,
+0x6f,0x6e,0x28,0x74,0x2e,0x62,0x70,0x29,0x5d,0x00,0x00,0x00,0x0e,0x02,0x00,0x02,
+0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x00,0x00,
+0x0d,0x03,0x00,0x03,0x00,0x00,0x00,0x02,0x62,0x70,0x00,0x00,0x09,0x03,0x00,0x03,
+0x00,0x00,0x00,0x00,0x37,0x02,0x02,0x02,0x1c,0x02,0x01,0x02,0x0d,0x01,0x00,0x04,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x0b,0x00,0x01,0x02,
+0x1f,0x04,0x00,0x59,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,
+0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x0c,0x00,0x1e,
+0x00,0x00,0x00,0x09,0x69,0x6e,0x66,0x69,0x78,0x5f,0x6c,0x65,0x64,0x00,0x00,0x00,
+0x0f,0x0c,0x0b,0x00,0x1f,0x06,0x00,0x5a,0x64,0x65,0x66,0x20,0x69,0x6e,0x66,0x69,
+0x78,0x5f,0x69,0x73,0x28,0x74,0x2c,0x6c,0x65,0x66,0x74,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x0c,0x00,0x05,0x2a,0x24,0x31,0x31,0x34,0x00,0x00,0x00,0x0d,0x11,0x00,0x09,
+0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x12,0x00,0x18,0x00,0x00,0x00,0x04,
+0x6c,0x65,0x66,0x74,0x00,0x00,0x00,0x00,0x1c,0x0d,0x11,0x02,0x1c,0x0e,0x00,0x00,
+0x1d,0x0f,0x00,0x00,0x1d,0x10,0x00,0x00,0x11,0x0c,0x00,0x7d,0x2d,0x07,0x00,0x0c,
+0x00,0x00,0x00,0x02,0x1f,0x06,0x00,0x5a,0x64,0x65,0x66,0x20,0x69,0x6e,0x66,0x69,
+0x78,0x5f,0x69,0x73,0x28,0x74,0x2c,0x6c,0x65,0x66,0x74,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x33,0x01,0x00,0x04,0x6c,0x65,0x66,0x74,
+0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,
+0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,
+0x00,0x00,0x00,0x08,0x69,0x6e,0x66,0x69,0x78,0x5f,0x69,0x73,0x00,0x00,0x00,0x00,
+0x23,0x02,0x00,0x00,0x1f,0x08,0x00,0x5b,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x63,
+0x68,0x65,0x63,0x6b,0x28,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2c,0x27,0x6e,0x6f,
+0x74,0x27,0x29,0x3a,0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x02,0x00,0x00,0x00,0x05,
+0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,0x0e,0x04,0x00,0x03,0x00,0x00,0x00,0x01,
+0x50,0x00,0x00,0x00,0x0d,0x06,0x00,0x04,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x09,0x04,0x04,0x06,0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x05,
+0x00,0x00,0x00,0x03,0x6e,0x6f,0x74,0x00,0x37,0x02,0x03,0x03,0x16,0x02,0x00,0x00,
+0x13,0x00,0x00,0x1f,0x1f,0x06,0x00,0x5c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x74,0x2e,0x76,0x61,0x6c,0x20,0x3d,0x20,0x27,0x69,0x73,0x6e,0x6f,0x74,0x27,0x00,
+0x0d,0x02,0x00,0x06,0x00,0x00,0x00,0x05,0x69,0x73,0x6e,0x6f,0x74,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x07,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x0b,0x00,0x03,0x02,
+0x1f,0x06,0x00,0x5d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,
+0x6e,0x63,0x65,0x28,0x27,0x6e,0x6f,0x74,0x27,0x29,0x00,0x00,0x0e,0x03,0x00,0x08,
+0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x0d,0x04,0x00,0x05,
+0x00,0x00,0x00,0x03,0x6e,0x6f,0x74,0x00,0x37,0x02,0x03,0x02,0x1f,0x0a,0x00,0x5e,
+0x20,0x20,0x20,0x20,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x20,0x3d,0x20,0x5b,0x6c,
+0x65,0x66,0x74,0x2c,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x74,
+0x2e,0x62,0x70,0x29,0x5d,0x00,0x00,0x00,0x10,0x03,0x01,0x00,0x0e,0x05,0x00,0x09,
+0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x00,0x00,
+0x0d,0x01,0x00,0x0a,0x00,0x00,0x00,0x02,0x62,0x70,0x00,0x00,0x09,0x06,0x00,0x01,
+0x00,0x00,0x00,0x01,0x37,0x04,0x05,0x02,0x1c,0x02,0x03,0x02,0x0d,0x03,0x00,0x0b,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x0b,0x00,0x03,0x02,
+0x1f,0x04,0x00,0x5f,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,
+0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x0d,0x00,0x1f,
+0x00,0x00,0x00,0x08,0x69,0x6e,0x66,0x69,0x78,0x5f,0x69,0x73,0x00,0x00,0x00,0x00,
+0x0f,0x0d,0x0c,0x00,0x1f,0x06,0x00,0x60,0x64,0x65,0x66,0x20,0x69,0x6e,0x66,0x69,
+0x78,0x5f,0x6e,0x6f,0x74,0x28,0x74,0x2c,0x6c,0x65,0x66,0x74,0x29,0x3a,0x00,0x00,
+0x33,0x0d,0x00,0x05,0x2a,0x24,0x31,0x32,0x32,0x00,0x00,0x00,0x0d,0x12,0x00,0x09,
+0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x13,0x00,0x18,0x00,0x00,0x00,0x04,
+0x6c,0x65,0x66,0x74,0x00,0x00,0x00,0x00,0x1c,0x0e,0x12,0x02,0x1c,0x0f,0x00,0x00,
+0x1d,0x10,0x00,0x00,0x1d,0x11,0x00,0x00,0x11,0x0d,0x00,0x5f,0x2d,0x05,0x00,0x09,
+0x00,0x00,0x00,0x01,0x1f,0x06,0x00,0x60,0x64,0x65,0x66,0x20,0x69,0x6e,0x66,0x69,
+0x78,0x5f,0x6e,0x6f,0x74,0x28,0x74,0x2c,0x6c,0x65,0x66,0x74,0x29,0x3a,0x00,0x00,
+0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x33,0x01,0x00,0x04,0x6c,0x65,0x66,0x74,
+0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,
+0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,
+0x00,0x00,0x00,0x09,0x69,0x6e,0x66,0x69,0x78,0x5f,0x6e,0x6f,0x74,0x00,0x00,0x00,
+0x23,0x02,0x00,0x00,0x1f,0x05,0x00,0x61,0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,
+0x6e,0x63,0x65,0x28,0x27,0x69,0x6e,0x27,0x29,0x00,0x00,0x00,0x0e,0x03,0x00,0x02,
+0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x0d,0x04,0x00,0x03,
+0x00,0x00,0x00,0x02,0x69,0x6e,0x00,0x00,0x37,0x02,0x03,0x02,0x1f,0x05,0x00,0x62,
+0x20,0x20,0x20,0x20,0x74,0x2e,0x76,0x61,0x6c,0x20,0x3d,0x20,0x27,0x6e,0x6f,0x74,
+0x69,0x6e,0x27,0x00,0x0d,0x02,0x00,0x04,0x00,0x00,0x00,0x05,0x6e,0x6f,0x74,0x69,
+0x6e,0x00,0x00,0x00,0x0d,0x03,0x00,0x05,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,
+0x0b,0x00,0x03,0x02,0x1f,0x0a,0x00,0x63,0x20,0x20,0x20,0x20,0x74,0x2e,0x69,0x74,
+0x65,0x6d,0x73,0x20,0x3d,0x20,0x5b,0x6c,0x65,0x66,0x74,0x2c,0x65,0x78,0x70,0x72,
+0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x74,0x2e,0x62,0x70,0x29,0x5d,0x00,0x00,0x00,
+0x10,0x03,0x01,0x00,0x0e,0x01,0x00,0x06,0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x72,
+0x65,0x73,0x73,0x69,0x6f,0x6e,0x00,0x00,0x0d,0x02,0x00,0x07,0x00,0x00,0x00,0x02,
+0x62,0x70,0x00,0x00,0x09,0x02,0x00,0x02,0x00,0x00,0x00,0x00,0x37,0x04,0x01,0x02,
+0x1c,0x02,0x03,0x02,0x0d,0x03,0x00,0x08,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x0b,0x00,0x03,0x02,0x1f,0x04,0x00,0x64,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x0e,0x00,0x20,0x00,0x00,0x00,0x09,0x69,0x6e,0x66,0x69,
+0x78,0x5f,0x6e,0x6f,0x74,0x00,0x00,0x00,0x0f,0x0e,0x0d,0x00,0x1f,0x07,0x00,0x65,
+0x64,0x65,0x66,0x20,0x69,0x6e,0x66,0x69,0x78,0x5f,0x74,0x75,0x70,0x6c,0x65,0x28,
+0x74,0x2c,0x6c,0x65,0x66,0x74,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x0e,0x00,0x05,
+0x2a,0x24,0x31,0x33,0x30,0x00,0x00,0x00,0x0d,0x13,0x00,0x09,0x00,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x0d,0x14,0x00,0x18,0x00,0x00,0x00,0x04,0x6c,0x65,0x66,0x74,
+0x00,0x00,0x00,0x00,0x1c,0x0f,0x13,0x02,0x1c,0x10,0x00,0x00,0x1d,0x11,0x00,0x00,
+0x1d,0x12,0x00,0x00,0x11,0x0e,0x00,0x8b,0x2d,0x06,0x00,0x0a,0x00,0x00,0x00,0x04,
+0x1f,0x07,0x00,0x65,0x64,0x65,0x66,0x20,0x69,0x6e,0x66,0x69,0x78,0x5f,0x74,0x75,
+0x70,0x6c,0x65,0x28,0x74,0x2c,0x6c,0x65,0x66,0x74,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x33,0x01,0x00,0x04,0x6c,0x65,0x66,0x74,
+0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,
+0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,
+0x00,0x00,0x00,0x0b,0x69,0x6e,0x66,0x69,0x78,0x5f,0x74,0x75,0x70,0x6c,0x65,0x00,
+0x23,0x02,0x00,0x00,0x1f,0x07,0x00,0x66,0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,
+0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x74,0x2e,0x62,0x70,0x29,
+0x00,0x00,0x00,0x00,0x33,0x02,0x00,0x01,0x72,0x00,0x00,0x00,0x0e,0x03,0x00,0x02,
+0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x00,0x00,
+0x0d,0x05,0x00,0x03,0x00,0x00,0x00,0x02,0x62,0x70,0x00,0x00,0x09,0x04,0x00,0x05,
+0x00,0x00,0x00,0x00,0x37,0x02,0x03,0x02,0x1f,0x06,0x00,0x67,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x6c,0x65,0x66,0x74,0x2e,0x76,0x61,0x6c,0x20,0x3d,0x3d,0x20,0x27,
+0x2c,0x27,0x3a,0x00,0x0d,0x03,0x00,0x04,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,
+0x09,0x04,0x01,0x03,0x00,0x00,0x00,0x01,0x0d,0x03,0x00,0x05,0x00,0x00,0x00,0x01,
+0x2c,0x00,0x00,0x00,0x18,0x04,0x04,0x03,0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x1f,
+0x1f,0x08,0x00,0x68,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x65,0x66,0x74,
+0x2e,0x69,0x74,0x65,0x6d,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x72,0x29,
+0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x06,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x09,0x05,0x01,0x00,0x00,0x00,0x00,0x02,0x0d,0x00,0x00,0x07,
+0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x03,0x05,0x00,
+0x00,0x00,0x00,0x03,0x10,0x05,0x02,0x00,0x39,0x04,0x03,0x03,0x1f,0x05,0x00,0x69,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6c,
+0x65,0x66,0x74,0x00,0x15,0x01,0x00,0x00,0x1f,0x06,0x00,0x6a,0x20,0x20,0x20,0x20,
+0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x20,0x3d,0x20,0x5b,0x6c,0x65,0x66,0x74,0x2c,
+0x72,0x5d,0x00,0x00,0x10,0x03,0x01,0x00,0x10,0x04,0x02,0x00,0x1c,0x04,0x03,0x02,
+0x0d,0x03,0x00,0x06,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x0b,0x00,0x03,0x04,0x1f,0x06,0x00,0x6b,0x20,0x20,0x20,0x20,0x74,0x2e,0x74,0x79,
+0x70,0x65,0x20,0x3d,0x20,0x27,0x74,0x75,0x70,0x6c,0x65,0x27,0x00,0x00,0x00,0x00,
+0x0d,0x04,0x00,0x08,0x00,0x00,0x00,0x05,0x74,0x75,0x70,0x6c,0x65,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x09,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,
+0x0b,0x00,0x03,0x04,0x1f,0x04,0x00,0x6c,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x74,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x0f,0x00,0x21,0x00,0x00,0x00,0x0b,0x69,0x6e,0x66,0x69,0x78,0x5f,0x74,0x75,
+0x70,0x6c,0x65,0x00,0x0f,0x0f,0x0e,0x00,0x1f,0x03,0x00,0x6d,0x64,0x65,0x66,0x20,
+0x6c,0x73,0x74,0x28,0x74,0x29,0x3a,0x00,0x33,0x0f,0x00,0x05,0x2a,0x24,0x31,0x33,
+0x38,0x00,0x00,0x00,0x0d,0x14,0x00,0x09,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x1c,0x10,0x14,0x01,0x1c,0x11,0x00,0x00,0x1d,0x12,0x00,0x00,0x1d,0x13,0x00,0x00,
+0x11,0x0f,0x00,0x5e,0x2d,0x06,0x00,0x07,0x00,0x00,0x00,0x00,0x1f,0x03,0x00,0x6d,
+0x64,0x65,0x66,0x20,0x6c,0x73,0x74,0x28,0x74,0x29,0x3a,0x00,0x33,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,
+0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,
+0x00,0x00,0x00,0x03,0x6c,0x73,0x74,0x00,0x23,0x01,0x00,0x00,0x1f,0x07,0x00,0x6e,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,0x20,0x3d,0x3d,0x20,0x4e,0x6f,0x6e,0x65,
+0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,0x5d,0x00,0x1d,0x01,0x00,0x00,
+0x18,0x01,0x00,0x01,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x03,0x1c,0x01,0x00,0x00,
+0x15,0x01,0x00,0x00,0x1f,0x0b,0x00,0x6f,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x63,
+0x68,0x65,0x63,0x6b,0x28,0x74,0x2c,0x27,0x2c,0x27,0x2c,0x27,0x74,0x75,0x70,0x6c,
+0x65,0x27,0x2c,0x27,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x73,0x27,0x29,
+0x3a,0x00,0x00,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x05,0x63,0x68,0x65,0x63,
+0x6b,0x00,0x00,0x00,0x10,0x02,0x00,0x00,0x0d,0x03,0x00,0x03,0x00,0x00,0x00,0x01,
+0x2c,0x00,0x00,0x00,0x0d,0x04,0x00,0x04,0x00,0x00,0x00,0x05,0x74,0x75,0x70,0x6c,
+0x65,0x00,0x00,0x00,0x0d,0x05,0x00,0x05,0x00,0x00,0x00,0x0a,0x73,0x74,0x61,0x74,
+0x65,0x6d,0x65,0x6e,0x74,0x73,0x00,0x00,0x37,0x01,0x01,0x05,0x16,0x01,0x00,0x00,
+0x13,0x00,0x00,0x11,0x1f,0x07,0x00,0x70,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x67,0x65,0x74,0x5f,0x69,0x74,0x65,0x6d,0x73,
+0x28,0x74,0x29,0x00,0x0e,0x01,0x00,0x06,0x00,0x00,0x00,0x09,0x67,0x65,0x74,0x5f,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x10,0x02,0x00,0x00,0x37,0x01,0x01,0x02,
+0x15,0x01,0x00,0x00,0x1f,0x04,0x00,0x71,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x5b,0x74,0x5d,0x00,0x00,0x10,0x01,0x00,0x00,0x1c,0x01,0x01,0x01,
+0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x10,0x00,0x22,0x00,0x00,0x00,0x03,
+0x6c,0x73,0x74,0x00,0x0f,0x10,0x0f,0x00,0x1f,0x05,0x00,0x72,0x64,0x65,0x66,0x20,
+0x69,0x6c,0x73,0x74,0x28,0x74,0x79,0x70,0x2c,0x74,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x10,0x00,0x05,0x2a,0x24,0x31,0x34,0x35,0x00,0x00,0x00,0x0d,0x15,0x00,0x23,
+0x00,0x00,0x00,0x03,0x74,0x79,0x70,0x00,0x0d,0x16,0x00,0x09,0x00,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x1c,0x11,0x15,0x02,0x1c,0x12,0x00,0x00,0x1d,0x13,0x00,0x00,
+0x1d,0x14,0x00,0x00,0x11,0x10,0x00,0x3a,0x2d,0x08,0x00,0x05,0x00,0x00,0x00,0x01,
+0x1f,0x05,0x00,0x72,0x64,0x65,0x66,0x20,0x69,0x6c,0x73,0x74,0x28,0x74,0x79,0x70,
+0x2c,0x74,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x03,0x74,0x79,0x70,0x00,
+0x33,0x01,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x18,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,0x22,0x02,0x00,0x00,
+0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x04,0x69,0x6c,0x73,0x74,0x00,0x00,0x00,0x00,
+0x23,0x02,0x00,0x00,0x1f,0x0a,0x00,0x73,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x2e,0x70,0x6f,0x73,0x2c,0x74,
+0x79,0x70,0x2c,0x74,0x79,0x70,0x2c,0x6c,0x73,0x74,0x28,0x74,0x29,0x29,0x00,0x00,
+0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x0d,0x06,0x00,0x03,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x03,0x01,0x06,
+0x00,0x00,0x00,0x00,0x10,0x04,0x00,0x00,0x10,0x05,0x00,0x00,0x0e,0x06,0x00,0x04,
+0x00,0x00,0x00,0x03,0x6c,0x73,0x74,0x00,0x10,0x07,0x01,0x00,0x37,0x06,0x06,0x02,
+0x37,0x02,0x02,0x05,0x15,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x11,0x00,0x24,
+0x00,0x00,0x00,0x04,0x69,0x6c,0x73,0x74,0x00,0x00,0x00,0x00,0x0f,0x11,0x10,0x00,
+0x1f,0x06,0x00,0x75,0x64,0x65,0x66,0x20,0x63,0x61,0x6c,0x6c,0x5f,0x6c,0x65,0x64,
+0x28,0x74,0x2c,0x6c,0x65,0x66,0x74,0x29,0x3a,0x00,0x00,0x00,0x33,0x11,0x00,0x05,
+0x2a,0x24,0x31,0x35,0x33,0x00,0x00,0x00,0x0d,0x16,0x00,0x09,0x00,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x0d,0x17,0x00,0x18,0x00,0x00,0x00,0x04,0x6c,0x65,0x66,0x74,
+0x00,0x00,0x00,0x00,0x1c,0x12,0x16,0x02,0x1c,0x13,0x00,0x00,0x1d,0x14,0x00,0x00,
+0x1d,0x15,0x00,0x00,0x11,0x11,0x00,0xd8,0x2d,0x08,0x00,0x13,0x00,0x00,0x00,0x06,
+0x1f,0x06,0x00,0x75,0x64,0x65,0x66,0x20,0x63,0x61,0x6c,0x6c,0x5f,0x6c,0x65,0x64,
+0x28,0x74,0x2c,0x6c,0x65,0x66,0x74,0x29,0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x33,0x01,0x00,0x04,0x6c,0x65,0x66,0x74,0x00,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,
+0x00,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x08,
+0x63,0x61,0x6c,0x6c,0x5f,0x6c,0x65,0x64,0x00,0x00,0x00,0x00,0x23,0x02,0x00,0x00,
+0x1f,0x0a,0x00,0x76,0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x54,0x6f,0x6b,0x65,
+0x6e,0x28,0x74,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x63,0x61,0x6c,0x6c,0x27,0x2c,0x27,
+0x24,0x27,0x2c,0x5b,0x6c,0x65,0x66,0x74,0x5d,0x29,0x00,0x00,0x33,0x02,0x00,0x01,
+0x72,0x00,0x00,0x00,0x0e,0x03,0x00,0x02,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,
+0x09,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x04,0x00,0x00,0x00,0x04,
+0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x05,0x00,0x00,0x00,0x01,
+0x24,0x00,0x00,0x00,0x10,0x02,0x01,0x00,0x1c,0x07,0x02,0x01,0x37,0x02,0x03,0x05,
+0x1f,0x09,0x00,0x77,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x6e,0x6f,
+0x74,0x20,0x63,0x68,0x65,0x63,0x6b,0x28,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2c,
+0x27,0x29,0x27,0x29,0x3a,0x00,0x00,0x00,0x0e,0x04,0x00,0x06,0x00,0x00,0x00,0x05,
+0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,0x0e,0x05,0x00,0x07,0x00,0x00,0x00,0x01,
+0x50,0x00,0x00,0x00,0x0d,0x07,0x00,0x08,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x09,0x05,0x05,0x07,0x00,0x00,0x00,0x01,0x0d,0x06,0x00,0x09,
+0x00,0x00,0x00,0x01,0x29,0x00,0x00,0x00,0x37,0x03,0x04,0x03,0x2f,0x03,0x00,0x00,
+0x13,0x00,0x00,0x68,0x1f,0x06,0x00,0x78,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x74,0x77,0x65,0x61,0x6b,0x28,0x27,0x2c,0x27,0x2c,0x30,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x03,0x00,0x0a,0x00,0x00,0x00,0x05,0x74,0x77,0x65,0x61,0x6b,0x00,0x00,0x00,
+0x0d,0x04,0x00,0x0b,0x00,0x00,0x00,0x01,0x2c,0x00,0x00,0x00,0x0c,0x05,0x00,0x0c,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x37,0x00,0x03,0x03,0x1f,0x0a,0x00,0x79,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x2e,0x69,0x74,0x65,0x6d,0x73,0x2e,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,
+0x6e,0x28,0x30,0x29,0x29,0x00,0x00,0x00,0x0d,0x07,0x00,0x0d,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x06,0x02,0x07,0x00,0x00,0x00,0x02,
+0x0d,0x07,0x00,0x0e,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x03,0x06,0x07,0x00,0x00,0x00,0x03,0x0e,0x06,0x00,0x0f,0x00,0x00,0x00,0x0a,
+0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x00,0x00,0x0c,0x07,0x00,0x0c,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x37,0x05,0x06,0x02,0x39,0x00,0x03,0x03,
+0x1f,0x0b,0x00,0x7a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x50,
+0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2e,0x76,0x61,0x6c,0x20,0x3d,0x3d,0x20,0x27,0x2c,
+0x27,0x3a,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x27,0x2c,0x27,0x29,0x00,
+0x0e,0x00,0x00,0x07,0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x0d,0x03,0x00,0x08,
+0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x09,0x00,0x00,0x03,
+0x00,0x00,0x00,0x04,0x0d,0x03,0x00,0x10,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,
+0x09,0x00,0x00,0x03,0x00,0x00,0x00,0x05,0x0d,0x03,0x00,0x0b,0x00,0x00,0x00,0x01,
+0x2c,0x00,0x00,0x00,0x18,0x00,0x00,0x03,0x16,0x00,0x00,0x00,0x13,0x00,0x00,0x09,
+0x0e,0x03,0x00,0x11,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,
+0x0d,0x04,0x00,0x0b,0x00,0x00,0x00,0x01,0x2c,0x00,0x00,0x00,0x37,0x00,0x03,0x02,
+0x1f,0x05,0x00,0x7b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x74,
+0x6f,0x72,0x65,0x28,0x29,0x00,0x00,0x00,0x0e,0x03,0x00,0x12,0x00,0x00,0x00,0x07,
+0x72,0x65,0x73,0x74,0x6f,0x72,0x65,0x00,0x37,0x00,0x03,0x01,0x13,0x00,0xff,0x87,
+0x1f,0x05,0x00,0x7c,0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,
+0x22,0x29,0x22,0x29,0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x11,0x00,0x00,0x00,0x07,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x0d,0x04,0x00,0x09,0x00,0x00,0x00,0x01,
+0x29,0x00,0x00,0x00,0x37,0x00,0x03,0x02,0x1f,0x04,0x00,0x7d,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,0x15,0x02,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x12,0x00,0x25,0x00,0x00,0x00,0x08,0x63,0x61,0x6c,0x6c,
+0x5f,0x6c,0x65,0x64,0x00,0x00,0x00,0x00,0x0f,0x12,0x11,0x00,0x1f,0x06,0x00,0x7e,
+0x64,0x65,0x66,0x20,0x67,0x65,0x74,0x5f,0x6c,0x65,0x64,0x28,0x74,0x2c,0x6c,0x65,
+0x66,0x74,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x12,0x00,0x05,0x2a,0x24,0x31,0x36,
+0x31,0x00,0x00,0x00,0x0d,0x17,0x00,0x09,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x0d,0x18,0x00,0x18,0x00,0x00,0x00,0x04,0x6c,0x65,0x66,0x74,0x00,0x00,0x00,0x00,
+0x1c,0x13,0x17,0x02,0x1c,0x14,0x00,0x00,0x1d,0x15,0x00,0x00,0x1d,0x16,0x00,0x00,
+0x11,0x12,0x01,0xb1,0x2d,0x0d,0x00,0x16,0x00,0x00,0x00,0x0c,0x1f,0x06,0x00,0x7e,
+0x64,0x65,0x66,0x20,0x67,0x65,0x74,0x5f,0x6c,0x65,0x64,0x28,0x74,0x2c,0x6c,0x65,
+0x66,0x74,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x33,0x01,0x00,0x04,0x6c,0x65,0x66,0x74,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,
+0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,
+0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,
+0x6c,0x65,0x64,0x00,0x23,0x02,0x00,0x00,0x1f,0x0a,0x00,0x7f,0x20,0x20,0x20,0x20,
+0x72,0x20,0x3d,0x20,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x2e,0x70,0x6f,0x73,0x2c,
+0x27,0x67,0x65,0x74,0x27,0x2c,0x27,0x2e,0x27,0x2c,0x5b,0x6c,0x65,0x66,0x74,0x5d,
+0x29,0x00,0x00,0x00,0x33,0x02,0x00,0x01,0x72,0x00,0x00,0x00,0x0e,0x03,0x00,0x02,
+0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0d,0x08,0x00,0x03,
+0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x04,0x00,0x08,0x00,0x00,0x00,0x00,
+0x0d,0x05,0x00,0x04,0x00,0x00,0x00,0x03,0x67,0x65,0x74,0x00,0x0d,0x06,0x00,0x05,
+0x00,0x00,0x00,0x01,0x2e,0x00,0x00,0x00,0x10,0x08,0x01,0x00,0x1c,0x07,0x08,0x01,
+0x37,0x02,0x03,0x05,0x1f,0x05,0x00,0x80,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,
+0x73,0x20,0x3d,0x20,0x20,0x5b,0x6c,0x65,0x66,0x74,0x5d,0x00,0x33,0x0c,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x10,0x04,0x01,0x00,0x1c,0x0c,0x04,0x01,
+0x1f,0x05,0x00,0x81,0x20,0x20,0x20,0x20,0x6d,0x6f,0x72,0x65,0x20,0x3d,0x20,0x46,
+0x61,0x6c,0x73,0x65,0x00,0x00,0x00,0x00,0x33,0x03,0x00,0x04,0x6d,0x6f,0x72,0x65,
+0x00,0x00,0x00,0x00,0x0c,0x03,0x00,0x06,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x1f,0x09,0x00,0x82,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x6e,0x6f,
+0x74,0x20,0x63,0x68,0x65,0x63,0x6b,0x28,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2c,
+0x27,0x5d,0x27,0x29,0x3a,0x00,0x00,0x00,0x0e,0x06,0x00,0x07,0x00,0x00,0x00,0x05,
+0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,0x0e,0x07,0x00,0x08,0x00,0x00,0x00,0x01,
+0x50,0x00,0x00,0x00,0x0d,0x09,0x00,0x09,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x09,0x07,0x07,0x09,0x00,0x00,0x00,0x01,0x0d,0x08,0x00,0x0a,
+0x00,0x00,0x00,0x01,0x5d,0x00,0x00,0x00,0x37,0x05,0x06,0x03,0x2f,0x05,0x00,0x00,
+0x13,0x00,0x00,0xad,0x1f,0x06,0x00,0x83,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6d,0x6f,0x72,0x65,0x20,0x3d,0x20,0x46,0x61,0x6c,0x73,0x65,0x00,0x00,0x00,0x00,
+0x0c,0x03,0x00,0x06,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x1f,0x08,0x00,0x84,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x63,0x68,0x65,0x63,0x6b,
+0x28,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2c,0x27,0x3a,0x27,0x29,0x3a,0x00,0x00,
+0x0e,0x05,0x00,0x07,0x00,0x00,0x00,0x05,0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,
+0x0e,0x06,0x00,0x08,0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x0d,0x08,0x00,0x09,
+0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x09,0x06,0x06,0x08,
+0x00,0x00,0x00,0x02,0x0d,0x07,0x00,0x0b,0x00,0x00,0x00,0x01,0x3a,0x00,0x00,0x00,
+0x37,0x04,0x05,0x03,0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x35,0x1f,0x10,0x00,0x85,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,
+0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x50,
+0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x73,0x79,0x6d,0x62,
+0x6f,0x6c,0x27,0x2c,0x27,0x4e,0x6f,0x6e,0x65,0x27,0x29,0x29,0x00,0x00,0x00,0x00,
+0x0d,0x08,0x00,0x0c,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x05,0x0c,0x08,0x00,0x00,0x00,0x03,0x0e,0x08,0x00,0x02,0x00,0x00,0x00,0x05,
+0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0e,0x09,0x00,0x08,0x00,0x00,0x00,0x01,
+0x50,0x00,0x00,0x00,0x0d,0x04,0x00,0x09,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x09,0x09,0x09,0x04,0x00,0x00,0x00,0x04,0x0d,0x04,0x00,0x03,
+0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x09,0x09,0x04,0x00,0x00,0x00,0x05,
+0x0d,0x0a,0x00,0x0d,0x00,0x00,0x00,0x06,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x00,0x00,
+0x0d,0x0b,0x00,0x0e,0x00,0x00,0x00,0x04,0x4e,0x6f,0x6e,0x65,0x00,0x00,0x00,0x00,
+0x37,0x07,0x08,0x04,0x39,0x04,0x05,0x03,0x13,0x00,0x00,0x1c,0x1f,0x0a,0x00,0x87,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,
+0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x65,0x78,0x70,0x72,0x65,0x73,0x73,
+0x69,0x6f,0x6e,0x28,0x30,0x29,0x29,0x00,0x0d,0x08,0x00,0x0c,0x00,0x00,0x00,0x06,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x05,0x0c,0x08,0x00,0x00,0x00,0x06,
+0x0e,0x08,0x00,0x0f,0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,
+0x6f,0x6e,0x00,0x00,0x0c,0x09,0x00,0x06,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x37,0x07,0x08,0x02,0x39,0x04,0x05,0x03,0x1f,0x08,0x00,0x88,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x63,0x68,0x65,0x63,0x6b,0x28,0x50,0x2e,0x74,
+0x6f,0x6b,0x65,0x6e,0x2c,0x27,0x3a,0x27,0x29,0x3a,0x00,0x00,0x0e,0x05,0x00,0x07,
+0x00,0x00,0x00,0x05,0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,0x0e,0x06,0x00,0x08,
+0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x0d,0x08,0x00,0x09,0x00,0x00,0x00,0x05,
+0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x09,0x06,0x06,0x08,0x00,0x00,0x00,0x07,
+0x0d,0x07,0x00,0x0b,0x00,0x00,0x00,0x01,0x3a,0x00,0x00,0x00,0x37,0x04,0x05,0x03,
+0x16,0x04,0x00,0x00,0x13,0x00,0xff,0x5d,0x1f,0x07,0x00,0x89,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,
+0x27,0x3a,0x27,0x29,0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x10,0x00,0x00,0x00,0x07,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x0d,0x06,0x00,0x0b,0x00,0x00,0x00,0x01,
+0x3a,0x00,0x00,0x00,0x37,0x04,0x05,0x02,0x1f,0x06,0x00,0x8a,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x6f,0x72,0x65,0x20,0x3d,0x20,0x54,
+0x72,0x75,0x65,0x00,0x0c,0x03,0x00,0x11,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x13,0x00,0xff,0x42,0x1f,0x04,0x00,0x8b,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6d,
+0x6f,0x72,0x65,0x3a,0x00,0x00,0x00,0x00,0x16,0x03,0x00,0x00,0x13,0x00,0x00,0x33,
+0x1f,0x0f,0x00,0x8c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,
+0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x50,
+0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x73,0x79,0x6d,0x62,
+0x6f,0x6c,0x27,0x2c,0x27,0x4e,0x6f,0x6e,0x65,0x27,0x29,0x29,0x00,0x00,0x00,0x00,
+0x0d,0x08,0x00,0x0c,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x05,0x0c,0x08,0x00,0x00,0x00,0x08,0x0e,0x08,0x00,0x02,0x00,0x00,0x00,0x05,
+0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0e,0x09,0x00,0x08,0x00,0x00,0x00,0x01,
+0x50,0x00,0x00,0x00,0x0d,0x04,0x00,0x09,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x09,0x09,0x09,0x04,0x00,0x00,0x00,0x09,0x0d,0x04,0x00,0x03,
+0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x09,0x09,0x04,0x00,0x00,0x00,0x0a,
+0x0d,0x0a,0x00,0x0d,0x00,0x00,0x00,0x06,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x00,0x00,
+0x0d,0x0b,0x00,0x0e,0x00,0x00,0x00,0x04,0x4e,0x6f,0x6e,0x65,0x00,0x00,0x00,0x00,
+0x37,0x07,0x08,0x04,0x39,0x04,0x05,0x03,0x1f,0x06,0x00,0x8d,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x6c,0x65,0x6e,0x28,0x69,0x74,0x65,0x6d,0x73,0x29,0x20,0x3e,0x20,
+0x32,0x3a,0x00,0x00,0x0e,0x05,0x00,0x12,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,
+0x10,0x06,0x0c,0x00,0x37,0x04,0x05,0x02,0x0c,0x05,0x00,0x13,0x00,0x00,0x69,0x04,
+0x02,0x00,0x00,0x00,0x36,0x04,0x04,0x05,0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x2a,
+0x1f,0x0f,0x00,0x8e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,
+0x73,0x20,0x3d,0x20,0x5b,0x6c,0x65,0x66,0x74,0x2c,0x54,0x6f,0x6b,0x65,0x6e,0x28,
+0x74,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x73,0x6c,0x69,0x63,0x65,0x27,0x2c,0x27,0x3a,
+0x27,0x2c,0x69,0x74,0x65,0x6d,0x73,0x5b,0x31,0x3a,0x5d,0x29,0x5d,0x00,0x00,0x00,
+0x10,0x05,0x01,0x00,0x0e,0x07,0x00,0x02,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x0d,0x04,0x00,0x03,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,
+0x09,0x08,0x00,0x04,0x00,0x00,0x00,0x0b,0x0d,0x09,0x00,0x14,0x00,0x00,0x00,0x05,
+0x73,0x6c,0x69,0x63,0x65,0x00,0x00,0x00,0x0d,0x0a,0x00,0x0b,0x00,0x00,0x00,0x01,
+0x3a,0x00,0x00,0x00,0x0c,0x00,0x00,0x11,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x1d,0x01,0x00,0x00,0x1c,0x04,0x00,0x02,0x0a,0x0b,0x0c,0x04,0x37,0x06,0x07,0x05,
+0x1c,0x0c,0x05,0x02,0x1f,0x05,0x00,0x8f,0x20,0x20,0x20,0x20,0x72,0x2e,0x69,0x74,
+0x65,0x6d,0x73,0x20,0x3d,0x20,0x69,0x74,0x65,0x6d,0x73,0x00,0x0d,0x04,0x00,0x15,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x0b,0x02,0x04,0x0c,
+0x1f,0x05,0x00,0x90,0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,
+0x22,0x5d,0x22,0x29,0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x10,0x00,0x00,0x00,0x07,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x0d,0x06,0x00,0x0a,0x00,0x00,0x00,0x01,
+0x5d,0x00,0x00,0x00,0x37,0x04,0x05,0x02,0x1f,0x04,0x00,0x91,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,0x15,0x02,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x13,0x00,0x26,0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,
+0x6c,0x65,0x64,0x00,0x0f,0x13,0x12,0x00,0x1f,0x06,0x00,0x92,0x64,0x65,0x66,0x20,
+0x64,0x6f,0x74,0x5f,0x6c,0x65,0x64,0x28,0x74,0x2c,0x6c,0x65,0x66,0x74,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x13,0x00,0x05,0x2a,0x24,0x31,0x36,0x39,0x00,0x00,0x00,
+0x0d,0x18,0x00,0x09,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x19,0x00,0x18,
+0x00,0x00,0x00,0x04,0x6c,0x65,0x66,0x74,0x00,0x00,0x00,0x00,0x1c,0x14,0x18,0x02,
+0x1c,0x15,0x00,0x00,0x1d,0x16,0x00,0x00,0x1d,0x17,0x00,0x00,0x11,0x13,0x00,0x62,
+0x2d,0x06,0x00,0x08,0x00,0x00,0x00,0x02,0x1f,0x06,0x00,0x92,0x64,0x65,0x66,0x20,
+0x64,0x6f,0x74,0x5f,0x6c,0x65,0x64,0x28,0x74,0x2c,0x6c,0x65,0x66,0x74,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x33,0x01,0x00,0x04,
+0x6c,0x65,0x66,0x74,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x18,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,0x22,0x02,0x00,0x00,
+0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x07,0x64,0x6f,0x74,0x5f,0x6c,0x65,0x64,0x00,
+0x23,0x02,0x00,0x00,0x1f,0x07,0x00,0x93,0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,
+0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x74,0x2e,0x62,0x70,0x29,
+0x00,0x00,0x00,0x00,0x33,0x02,0x00,0x01,0x72,0x00,0x00,0x00,0x0e,0x03,0x00,0x02,
+0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x00,0x00,
+0x0d,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x62,0x70,0x00,0x00,0x09,0x04,0x00,0x04,
+0x00,0x00,0x00,0x00,0x37,0x02,0x03,0x02,0x1f,0x05,0x00,0x94,0x20,0x20,0x20,0x20,
+0x72,0x2e,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x27,0x6e,0x61,0x6d,0x65,0x27,0x00,
+0x0d,0x04,0x00,0x04,0x00,0x00,0x00,0x04,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x05,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,
+0x0b,0x02,0x03,0x04,0x1f,0x09,0x00,0x95,0x20,0x20,0x20,0x20,0x74,0x2e,0x69,0x74,
+0x65,0x6d,0x73,0x20,0x3d,0x20,0x5b,0x6c,0x65,0x66,0x74,0x2c,0x72,0x2e,0x61,0x73,
+0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x28,0x29,0x5d,0x00,0x00,0x10,0x03,0x01,0x00,
+0x0d,0x01,0x00,0x06,0x00,0x00,0x00,0x09,0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x00,0x00,0x00,0x38,0x04,0x02,0x01,0x00,0x00,0x00,0x01,0x39,0x04,0x04,0x02,
+0x1c,0x04,0x03,0x02,0x0d,0x03,0x00,0x07,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x0b,0x00,0x03,0x04,0x1f,0x04,0x00,0x96,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x14,0x00,0x27,0x00,0x00,0x00,0x07,0x64,0x6f,0x74,0x5f,
+0x6c,0x65,0x64,0x00,0x0f,0x14,0x13,0x00,0x1f,0x04,0x00,0x98,0x64,0x65,0x66,0x20,
+0x69,0x74,0x73,0x65,0x6c,0x66,0x28,0x74,0x29,0x3a,0x00,0x00,0x33,0x14,0x00,0x05,
+0x2a,0x24,0x31,0x37,0x37,0x00,0x00,0x00,0x0d,0x19,0x00,0x09,0x00,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x1c,0x15,0x19,0x01,0x1c,0x16,0x00,0x00,0x1d,0x17,0x00,0x00,
+0x1d,0x18,0x00,0x00,0x11,0x14,0x00,0x20,0x2d,0x03,0x00,0x02,0x00,0x00,0x00,0x00,
+0x1f,0x04,0x00,0x98,0x64,0x65,0x66,0x20,0x69,0x74,0x73,0x65,0x6c,0x66,0x28,0x74,
+0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x06,0x69,0x74,0x73,0x65,
+0x6c,0x66,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x04,0x00,0x99,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x15,0x00,0x28,0x00,0x00,0x00,0x06,0x69,0x74,0x73,0x65,
+0x6c,0x66,0x00,0x00,0x0f,0x15,0x14,0x00,0x1f,0x05,0x00,0x9a,0x64,0x65,0x66,0x20,
+0x70,0x61,0x72,0x65,0x6e,0x5f,0x6e,0x75,0x64,0x28,0x74,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x15,0x00,0x05,0x2a,0x24,0x31,0x38,0x34,0x00,0x00,0x00,0x0d,0x1a,0x00,0x09,
+0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x1c,0x16,0x1a,0x01,0x1c,0x17,0x00,0x00,
+0x1d,0x18,0x00,0x00,0x1d,0x19,0x00,0x00,0x11,0x15,0x00,0x5d,0x2d,0x04,0x00,0x0a,
+0x00,0x00,0x00,0x00,0x1f,0x05,0x00,0x9a,0x64,0x65,0x66,0x20,0x70,0x61,0x72,0x65,
+0x6e,0x5f,0x6e,0x75,0x64,0x28,0x74,0x29,0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,
+0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x0d,0x00,0x00,0x01,
+0x00,0x00,0x00,0x09,0x70,0x61,0x72,0x65,0x6e,0x5f,0x6e,0x75,0x64,0x00,0x00,0x00,
+0x23,0x00,0x00,0x00,0x1f,0x05,0x00,0x9b,0x20,0x20,0x20,0x20,0x74,0x77,0x65,0x61,
+0x6b,0x28,0x27,0x2c,0x27,0x2c,0x31,0x29,0x00,0x00,0x00,0x00,0x0e,0x01,0x00,0x02,
+0x00,0x00,0x00,0x05,0x74,0x77,0x65,0x61,0x6b,0x00,0x00,0x00,0x0d,0x02,0x00,0x03,
+0x00,0x00,0x00,0x01,0x2c,0x00,0x00,0x00,0x0c,0x03,0x00,0x04,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x37,0x00,0x01,0x03,0x1f,0x06,0x00,0x9c,0x20,0x20,0x20,0x20,
+0x72,0x20,0x3d,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x30,
+0x29,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x72,0x00,0x00,0x00,0x0e,0x02,0x00,0x05,
+0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x00,0x00,
+0x0c,0x03,0x00,0x06,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x37,0x00,0x02,0x02,
+0x1f,0x04,0x00,0x9d,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x74,0x6f,0x72,0x65,0x28,
+0x29,0x00,0x00,0x00,0x0e,0x02,0x00,0x07,0x00,0x00,0x00,0x07,0x72,0x65,0x73,0x74,
+0x6f,0x72,0x65,0x00,0x37,0x01,0x02,0x01,0x1f,0x05,0x00,0x9e,0x20,0x20,0x20,0x20,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x27,0x29,0x27,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x02,0x00,0x08,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,
+0x0d,0x03,0x00,0x09,0x00,0x00,0x00,0x01,0x29,0x00,0x00,0x00,0x37,0x01,0x02,0x02,
+0x1f,0x04,0x00,0x9f,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,
+0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x16,0x00,0x29,
+0x00,0x00,0x00,0x09,0x70,0x61,0x72,0x65,0x6e,0x5f,0x6e,0x75,0x64,0x00,0x00,0x00,
+0x0f,0x16,0x15,0x00,0x1f,0x05,0x00,0xa0,0x64,0x65,0x66,0x20,0x6c,0x69,0x73,0x74,
+0x5f,0x6e,0x75,0x64,0x28,0x74,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x16,0x00,0x05,
+0x2a,0x24,0x31,0x39,0x31,0x00,0x00,0x00,0x0d,0x1b,0x00,0x09,0x00,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x1c,0x17,0x1b,0x01,0x1c,0x18,0x00,0x00,0x1d,0x19,0x00,0x00,
+0x1d,0x1a,0x00,0x00,0x11,0x16,0x01,0xbe,0x2d,0x09,0x00,0x16,0x00,0x00,0x00,0x0b,
+0x1f,0x05,0x00,0xa0,0x64,0x65,0x66,0x20,0x6c,0x69,0x73,0x74,0x5f,0x6e,0x75,0x64,
+0x28,0x74,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,
+0x00,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x08,
+0x6c,0x69,0x73,0x74,0x5f,0x6e,0x75,0x64,0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,
+0x1f,0x05,0x00,0xa1,0x20,0x20,0x20,0x20,0x74,0x2e,0x74,0x79,0x70,0x65,0x20,0x3d,
+0x20,0x27,0x6c,0x69,0x73,0x74,0x27,0x00,0x0d,0x01,0x00,0x02,0x00,0x00,0x00,0x04,
+0x6c,0x69,0x73,0x74,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x04,
+0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x0b,0x00,0x02,0x01,0x1f,0x05,0x00,0xa2,
+0x20,0x20,0x20,0x20,0x74,0x2e,0x76,0x61,0x6c,0x20,0x3d,0x20,0x27,0x5b,0x5d,0x27,
+0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x04,0x00,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,
+0x0d,0x02,0x00,0x05,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x0b,0x00,0x02,0x01,
+0x1f,0x05,0x00,0xa3,0x20,0x20,0x20,0x20,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x20,
+0x3d,0x20,0x5b,0x5d,0x00,0x00,0x00,0x00,0x1c,0x01,0x00,0x00,0x0d,0x02,0x00,0x06,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x0b,0x00,0x02,0x01,
+0x1f,0x05,0x00,0xa4,0x20,0x20,0x20,0x20,0x6e,0x65,0x78,0x74,0x20,0x3d,0x20,0x50,
+0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x33,0x01,0x00,0x04,0x6e,0x65,0x78,0x74,
+0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x07,0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x08,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x09,0x01,0x02,0x03,0x00,0x00,0x00,0x00,0x1f,0x05,0x00,0xa5,0x20,0x20,0x20,0x20,
+0x74,0x77,0x65,0x61,0x6b,0x28,0x27,0x2c,0x27,0x2c,0x30,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x03,0x00,0x09,0x00,0x00,0x00,0x05,0x74,0x77,0x65,0x61,0x6b,0x00,0x00,0x00,
+0x0d,0x04,0x00,0x0a,0x00,0x00,0x00,0x01,0x2c,0x00,0x00,0x00,0x0c,0x05,0x00,0x0b,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x37,0x02,0x03,0x03,0x1f,0x0a,0x00,0xa6,
+0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x6e,0x6f,0x74,0x20,0x63,0x68,
+0x65,0x63,0x6b,0x28,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2c,0x27,0x66,0x6f,0x72,
+0x27,0x2c,0x27,0x5d,0x27,0x29,0x3a,0x00,0x0e,0x04,0x00,0x0c,0x00,0x00,0x00,0x05,
+0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,0x0e,0x05,0x00,0x07,0x00,0x00,0x00,0x01,
+0x50,0x00,0x00,0x00,0x0d,0x08,0x00,0x08,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x09,0x05,0x05,0x08,0x00,0x00,0x00,0x01,0x0d,0x06,0x00,0x0d,
+0x00,0x00,0x00,0x03,0x66,0x6f,0x72,0x00,0x0d,0x07,0x00,0x0e,0x00,0x00,0x00,0x01,
+0x5d,0x00,0x00,0x00,0x37,0x03,0x04,0x04,0x2f,0x03,0x00,0x00,0x13,0x00,0x00,0x53,
+0x1f,0x07,0x00,0xa7,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,
+0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x30,0x29,0x00,0x00,0x00,
+0x33,0x02,0x00,0x01,0x72,0x00,0x00,0x00,0x0e,0x04,0x00,0x0f,0x00,0x00,0x00,0x0a,
+0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x00,0x00,0x0c,0x05,0x00,0x0b,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x37,0x02,0x04,0x02,0x1f,0x07,0x00,0xa8,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x2e,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x72,0x29,0x00,0x00,0x00,0x0d,0x08,0x00,0x06,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x07,0x00,0x08,
+0x00,0x00,0x00,0x02,0x0d,0x08,0x00,0x10,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x04,0x07,0x08,0x00,0x00,0x00,0x03,0x10,0x06,0x02,0x00,
+0x39,0x03,0x04,0x03,0x1f,0x0b,0x00,0xa9,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2e,0x76,0x61,0x6c,0x20,0x3d,
+0x3d,0x20,0x27,0x2c,0x27,0x3a,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x27,
+0x2c,0x27,0x29,0x00,0x0e,0x03,0x00,0x07,0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,
+0x0d,0x04,0x00,0x08,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x09,0x03,0x03,0x04,0x00,0x00,0x00,0x04,0x0d,0x04,0x00,0x05,0x00,0x00,0x00,0x03,
+0x76,0x61,0x6c,0x00,0x09,0x03,0x03,0x04,0x00,0x00,0x00,0x05,0x0d,0x04,0x00,0x0a,
+0x00,0x00,0x00,0x01,0x2c,0x00,0x00,0x00,0x18,0x03,0x03,0x04,0x16,0x03,0x00,0x00,
+0x13,0x00,0xff,0xa2,0x0e,0x04,0x00,0x11,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,
+0x6e,0x63,0x65,0x00,0x0d,0x05,0x00,0x0a,0x00,0x00,0x00,0x01,0x2c,0x00,0x00,0x00,
+0x37,0x03,0x04,0x02,0x13,0x00,0xff,0x99,0x1f,0x08,0x00,0xaa,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x63,0x68,0x65,0x63,0x6b,0x28,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,
+0x2c,0x27,0x66,0x6f,0x72,0x27,0x29,0x3a,0x00,0x00,0x00,0x00,0x0e,0x04,0x00,0x0c,
+0x00,0x00,0x00,0x05,0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,0x0e,0x05,0x00,0x07,
+0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x0d,0x07,0x00,0x08,0x00,0x00,0x00,0x05,
+0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x09,0x05,0x05,0x07,0x00,0x00,0x00,0x06,
+0x0d,0x06,0x00,0x0d,0x00,0x00,0x00,0x03,0x66,0x6f,0x72,0x00,0x37,0x03,0x04,0x03,
+0x16,0x03,0x00,0x00,0x13,0x00,0x00,0xab,0x1f,0x05,0x00,0xab,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x74,0x6f,0x72,0x65,0x28,0x29,0x00,0x00,0x00,
+0x0e,0x04,0x00,0x12,0x00,0x00,0x00,0x07,0x72,0x65,0x73,0x74,0x6f,0x72,0x65,0x00,
+0x37,0x03,0x04,0x01,0x1f,0x06,0x00,0xac,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x74,0x2e,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x27,0x63,0x6f,0x6d,0x70,0x27,0x00,
+0x0d,0x03,0x00,0x13,0x00,0x00,0x00,0x04,0x63,0x6f,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x0d,0x04,0x00,0x03,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,
+0x0b,0x00,0x04,0x03,0x1f,0x06,0x00,0xad,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x27,0x66,0x6f,0x72,0x27,0x29,0x00,0x00,
+0x0e,0x04,0x00,0x11,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,
+0x0d,0x05,0x00,0x0d,0x00,0x00,0x00,0x03,0x66,0x6f,0x72,0x00,0x37,0x03,0x04,0x02,
+0x1f,0x06,0x00,0xae,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x77,0x65,0x61,
+0x6b,0x28,0x27,0x69,0x6e,0x27,0x2c,0x30,0x29,0x00,0x00,0x00,0x0e,0x04,0x00,0x09,
+0x00,0x00,0x00,0x05,0x74,0x77,0x65,0x61,0x6b,0x00,0x00,0x00,0x0d,0x05,0x00,0x14,
+0x00,0x00,0x00,0x02,0x69,0x6e,0x00,0x00,0x0c,0x06,0x00,0x0b,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x37,0x03,0x04,0x03,0x1f,0x06,0x00,0xaf,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x74,0x77,0x65,0x61,0x6b,0x28,0x27,0x2c,0x27,0x2c,0x20,0x31,
+0x29,0x00,0x00,0x00,0x0e,0x04,0x00,0x09,0x00,0x00,0x00,0x05,0x74,0x77,0x65,0x61,
+0x6b,0x00,0x00,0x00,0x0d,0x05,0x00,0x0a,0x00,0x00,0x00,0x01,0x2c,0x00,0x00,0x00,
+0x0c,0x06,0x00,0x15,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x37,0x03,0x04,0x03,
+0x1f,0x0a,0x00,0xb0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x2e,0x69,0x74,
+0x65,0x6d,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x65,0x78,0x70,0x72,0x65,
+0x73,0x73,0x69,0x6f,0x6e,0x28,0x30,0x29,0x29,0x00,0x00,0x00,0x0d,0x08,0x00,0x06,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x07,0x00,0x08,
+0x00,0x00,0x00,0x07,0x0d,0x08,0x00,0x10,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x04,0x07,0x08,0x00,0x00,0x00,0x08,0x0e,0x07,0x00,0x0f,
+0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x00,0x00,
+0x0c,0x08,0x00,0x0b,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x37,0x06,0x07,0x02,
+0x39,0x03,0x04,0x03,0x1f,0x06,0x00,0xb1,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x27,0x69,0x6e,0x27,0x29,0x00,0x00,0x00,
+0x0e,0x04,0x00,0x11,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,
+0x0d,0x05,0x00,0x14,0x00,0x00,0x00,0x02,0x69,0x6e,0x00,0x00,0x37,0x03,0x04,0x02,
+0x1f,0x0a,0x00,0xb2,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x2e,0x69,0x74,
+0x65,0x6d,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x65,0x78,0x70,0x72,0x65,
+0x73,0x73,0x69,0x6f,0x6e,0x28,0x30,0x29,0x29,0x00,0x00,0x00,0x0d,0x08,0x00,0x06,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x07,0x00,0x08,
+0x00,0x00,0x00,0x09,0x0d,0x08,0x00,0x10,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x04,0x07,0x08,0x00,0x00,0x00,0x0a,0x0e,0x07,0x00,0x0f,
+0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x00,0x00,
+0x0c,0x08,0x00,0x0b,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x37,0x06,0x07,0x02,
+0x39,0x03,0x04,0x03,0x1f,0x05,0x00,0xb3,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x72,0x65,0x73,0x74,0x6f,0x72,0x65,0x28,0x29,0x00,0x00,0x00,0x0e,0x04,0x00,0x12,
+0x00,0x00,0x00,0x07,0x72,0x65,0x73,0x74,0x6f,0x72,0x65,0x00,0x37,0x03,0x04,0x01,
+0x1f,0x04,0x00,0xb4,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x74,0x6f,0x72,0x65,0x28,
+0x29,0x00,0x00,0x00,0x0e,0x04,0x00,0x12,0x00,0x00,0x00,0x07,0x72,0x65,0x73,0x74,
+0x6f,0x72,0x65,0x00,0x37,0x03,0x04,0x01,0x1f,0x05,0x00,0xb5,0x20,0x20,0x20,0x20,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x27,0x5d,0x27,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x04,0x00,0x11,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,
+0x0d,0x05,0x00,0x0e,0x00,0x00,0x00,0x01,0x5d,0x00,0x00,0x00,0x37,0x03,0x04,0x02,
+0x1f,0x04,0x00,0xb6,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,
+0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x17,0x00,0x2a,
+0x00,0x00,0x00,0x08,0x6c,0x69,0x73,0x74,0x5f,0x6e,0x75,0x64,0x00,0x00,0x00,0x00,
+0x0f,0x17,0x16,0x00,0x1f,0x05,0x00,0xb7,0x64,0x65,0x66,0x20,0x64,0x69,0x63,0x74,
+0x5f,0x6e,0x75,0x64,0x28,0x74,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x17,0x00,0x05,
+0x2a,0x24,0x31,0x39,0x38,0x00,0x00,0x00,0x0d,0x1c,0x00,0x09,0x00,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x1c,0x18,0x1c,0x01,0x1c,0x19,0x00,0x00,0x1d,0x1a,0x00,0x00,
+0x1d,0x1b,0x00,0x00,0x11,0x17,0x00,0xda,0x2d,0x07,0x00,0x13,0x00,0x00,0x00,0x04,
+0x1f,0x05,0x00,0xb7,0x64,0x65,0x66,0x20,0x64,0x69,0x63,0x74,0x5f,0x6e,0x75,0x64,
+0x28,0x74,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,
+0x00,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x08,
+0x64,0x69,0x63,0x74,0x5f,0x6e,0x75,0x64,0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,
+0x1f,0x05,0x00,0xb8,0x20,0x20,0x20,0x20,0x74,0x2e,0x74,0x79,0x70,0x65,0x3d,0x27,
+0x64,0x69,0x63,0x74,0x27,0x00,0x00,0x00,0x0d,0x01,0x00,0x02,0x00,0x00,0x00,0x04,
+0x64,0x69,0x63,0x74,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x04,
+0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x0b,0x00,0x02,0x01,0x1f,0x05,0x00,0xb9,
+0x20,0x20,0x20,0x20,0x74,0x2e,0x76,0x61,0x6c,0x20,0x3d,0x20,0x27,0x7b,0x7d,0x27,
+0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x04,0x00,0x00,0x00,0x02,0x7b,0x7d,0x00,0x00,
+0x0d,0x02,0x00,0x05,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x0b,0x00,0x02,0x01,
+0x1f,0x05,0x00,0xba,0x20,0x20,0x20,0x20,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x20,
+0x3d,0x20,0x5b,0x5d,0x00,0x00,0x00,0x00,0x1c,0x01,0x00,0x00,0x0d,0x02,0x00,0x06,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x0b,0x00,0x02,0x01,
+0x1f,0x05,0x00,0xbb,0x20,0x20,0x20,0x20,0x74,0x77,0x65,0x61,0x6b,0x28,0x27,0x2c,
+0x27,0x2c,0x30,0x29,0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x07,0x00,0x00,0x00,0x05,
+0x74,0x77,0x65,0x61,0x6b,0x00,0x00,0x00,0x0d,0x03,0x00,0x08,0x00,0x00,0x00,0x01,
+0x2c,0x00,0x00,0x00,0x0c,0x04,0x00,0x09,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x37,0x01,0x02,0x03,0x1f,0x09,0x00,0xbc,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,
+0x65,0x20,0x6e,0x6f,0x74,0x20,0x63,0x68,0x65,0x63,0x6b,0x28,0x50,0x2e,0x74,0x6f,
+0x6b,0x65,0x6e,0x2c,0x27,0x7d,0x27,0x29,0x3a,0x00,0x00,0x00,0x0e,0x03,0x00,0x0a,
+0x00,0x00,0x00,0x05,0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,0x0e,0x04,0x00,0x0b,
+0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x0d,0x06,0x00,0x0c,0x00,0x00,0x00,0x05,
+0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x09,0x04,0x04,0x06,0x00,0x00,0x00,0x00,
+0x0d,0x05,0x00,0x0d,0x00,0x00,0x00,0x01,0x7d,0x00,0x00,0x00,0x37,0x02,0x03,0x03,
+0x2f,0x02,0x00,0x00,0x13,0x00,0x00,0x4b,0x1f,0x0a,0x00,0xbd,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x2e,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x28,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x30,0x29,
+0x29,0x00,0x00,0x00,0x0d,0x06,0x00,0x06,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x09,0x05,0x00,0x06,0x00,0x00,0x00,0x01,0x0d,0x06,0x00,0x0e,
+0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x02,0x05,0x06,
+0x00,0x00,0x00,0x02,0x0e,0x05,0x00,0x0f,0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x72,
+0x65,0x73,0x73,0x69,0x6f,0x6e,0x00,0x00,0x0c,0x06,0x00,0x09,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x37,0x04,0x05,0x02,0x39,0x01,0x02,0x03,0x1f,0x0c,0x00,0xbe,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x63,0x68,0x65,0x63,0x6b,
+0x28,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2c,0x27,0x3a,0x27,0x2c,0x27,0x2c,0x27,
+0x29,0x3a,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x02,0x00,0x0a,0x00,0x00,0x00,0x05,0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,
+0x0e,0x03,0x00,0x0b,0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x0d,0x06,0x00,0x0c,
+0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x09,0x03,0x03,0x06,
+0x00,0x00,0x00,0x03,0x0d,0x04,0x00,0x10,0x00,0x00,0x00,0x01,0x3a,0x00,0x00,0x00,
+0x0d,0x05,0x00,0x08,0x00,0x00,0x00,0x01,0x2c,0x00,0x00,0x00,0x37,0x01,0x02,0x04,
+0x16,0x01,0x00,0x00,0x13,0x00,0xff,0xaa,0x0e,0x02,0x00,0x11,0x00,0x00,0x00,0x07,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x37,0x01,0x02,0x01,0x13,0x00,0xff,0xa4,
+0x1f,0x04,0x00,0xbf,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x74,0x6f,0x72,0x65,0x28,
+0x29,0x00,0x00,0x00,0x0e,0x02,0x00,0x12,0x00,0x00,0x00,0x07,0x72,0x65,0x73,0x74,
+0x6f,0x72,0x65,0x00,0x37,0x01,0x02,0x01,0x1f,0x05,0x00,0xc0,0x20,0x20,0x20,0x20,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x27,0x7d,0x27,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x02,0x00,0x11,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,
+0x0d,0x03,0x00,0x0d,0x00,0x00,0x00,0x01,0x7d,0x00,0x00,0x00,0x37,0x01,0x02,0x02,
+0x1f,0x04,0x00,0xc1,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,
+0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x18,0x00,0x2b,
+0x00,0x00,0x00,0x08,0x64,0x69,0x63,0x74,0x5f,0x6e,0x75,0x64,0x00,0x00,0x00,0x00,
+0x0f,0x18,0x17,0x00,0x1f,0x06,0x00,0xc3,0x64,0x65,0x66,0x20,0x61,0x64,0x76,0x61,
+0x6e,0x63,0x65,0x28,0x74,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x18,0x00,0x05,0x2a,0x24,0x32,0x30,0x35,0x00,0x00,0x00,0x0d,0x1d,0x00,0x09,
+0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x1c,0x19,0x1d,0x01,0x1d,0x1d,0x00,0x00,
+0x1c,0x1a,0x1d,0x01,0x1d,0x1b,0x00,0x00,0x1d,0x1c,0x00,0x00,0x11,0x18,0x00,0x2f,
+0x2d,0x06,0x00,0x03,0x00,0x00,0x00,0x01,0x1f,0x06,0x00,0xc3,0x64,0x65,0x66,0x20,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x74,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,
+0x6e,0x63,0x65,0x00,0x23,0x01,0x00,0x00,0x1f,0x06,0x00,0xc4,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x50,0x2e,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,
+0x28,0x74,0x29,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,
+0x38,0x03,0x01,0x02,0x00,0x00,0x00,0x00,0x10,0x05,0x00,0x00,0x39,0x01,0x03,0x03,
+0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x19,0x00,0x2c,0x00,0x00,0x00,0x07,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x0f,0x19,0x18,0x00,0x1f,0x05,0x00,0xc6,
+0x64,0x65,0x66,0x20,0x69,0x62,0x6c,0x6f,0x63,0x6b,0x28,0x69,0x74,0x65,0x6d,0x73,
+0x29,0x3a,0x00,0x00,0x33,0x19,0x00,0x05,0x2a,0x24,0x32,0x31,0x33,0x00,0x00,0x00,
+0x0d,0x1e,0x00,0x2d,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x1c,0x1a,0x1e,0x01,0x1c,0x1b,0x00,0x00,0x1d,0x1c,0x00,0x00,0x1d,0x1d,0x00,0x00,
+0x11,0x19,0x00,0xc9,0x2d,0x06,0x00,0x0f,0x00,0x00,0x00,0x05,0x1f,0x05,0x00,0xc6,
+0x64,0x65,0x66,0x20,0x69,0x62,0x6c,0x6f,0x63,0x6b,0x28,0x69,0x74,0x65,0x6d,0x73,
+0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,
+0x00,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x06,
+0x69,0x62,0x6c,0x6f,0x63,0x6b,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x0c,0x00,0xc7,
+0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x63,0x68,0x65,0x63,0x6b,0x28,
+0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2c,0x27,0x6e,0x6c,0x27,0x2c,0x27,0x3b,0x27,
+0x29,0x3a,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x05,0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,
+0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x0d,0x05,0x00,0x04,
+0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x09,0x02,0x02,0x05,
+0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x05,0x00,0x00,0x00,0x02,0x6e,0x6c,0x00,0x00,
+0x0d,0x04,0x00,0x06,0x00,0x00,0x00,0x01,0x3b,0x00,0x00,0x00,0x37,0x01,0x01,0x04,
+0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x07,0x0e,0x01,0x00,0x07,0x00,0x00,0x00,0x07,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x37,0x01,0x01,0x01,0x13,0x00,0xff,0xe5,
+0x1f,0x04,0x00,0xc8,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x54,0x72,
+0x75,0x65,0x3a,0x00,0x0c,0x01,0x00,0x08,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x7b,0x1f,0x09,0x00,0xc9,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,
+0x28,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x30,0x29,0x29,0x00,
+0x0d,0x04,0x00,0x09,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x01,0x00,0x04,0x00,0x00,0x00,0x01,0x0e,0x04,0x00,0x0a,0x00,0x00,0x00,0x0a,
+0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x00,0x00,0x0c,0x05,0x00,0x0b,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x37,0x03,0x04,0x02,0x39,0x01,0x01,0x03,
+0x1f,0x06,0x00,0xca,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x50,0x2e,0x74,0x65,
+0x72,0x6d,0x69,0x6e,0x61,0x6c,0x28,0x29,0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x03,
+0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x0d,0x04,0x00,0x0c,0x00,0x00,0x00,0x08,
+0x74,0x65,0x72,0x6d,0x69,0x6e,0x61,0x6c,0x00,0x00,0x00,0x00,0x38,0x01,0x03,0x04,
+0x00,0x00,0x00,0x02,0x39,0x01,0x01,0x02,0x1f,0x0d,0x00,0xcb,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x63,0x68,0x65,0x63,0x6b,0x28,
+0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2c,0x27,0x6e,0x6c,0x27,0x2c,0x27,0x3b,0x27,
+0x29,0x3a,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x05,0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,
+0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x0d,0x05,0x00,0x04,
+0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x09,0x02,0x02,0x05,
+0x00,0x00,0x00,0x03,0x0d,0x03,0x00,0x05,0x00,0x00,0x00,0x02,0x6e,0x6c,0x00,0x00,
+0x0d,0x04,0x00,0x06,0x00,0x00,0x00,0x01,0x3b,0x00,0x00,0x00,0x37,0x01,0x01,0x04,
+0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x07,0x0e,0x01,0x00,0x07,0x00,0x00,0x00,0x07,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x37,0x01,0x01,0x01,0x13,0x00,0xff,0xe5,
+0x1f,0x0c,0x00,0xcc,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x63,
+0x68,0x65,0x63,0x6b,0x28,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2c,0x27,0x64,0x65,
+0x64,0x65,0x6e,0x74,0x27,0x2c,0x27,0x65,0x6f,0x66,0x27,0x29,0x3a,0x20,0x62,0x72,
+0x65,0x61,0x6b,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x05,0x63,0x68,0x65,0x63,
+0x6b,0x00,0x00,0x00,0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,
+0x0d,0x05,0x00,0x04,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x09,0x02,0x02,0x05,0x00,0x00,0x00,0x04,0x0d,0x03,0x00,0x0d,0x00,0x00,0x00,0x06,
+0x64,0x65,0x64,0x65,0x6e,0x74,0x00,0x00,0x0d,0x04,0x00,0x0e,0x00,0x00,0x00,0x03,
+0x65,0x6f,0x66,0x00,0x37,0x01,0x01,0x04,0x16,0x01,0x00,0x00,0x13,0x00,0xff,0x82,
+0x00,0x00,0x00,0x00,0x0d,0x1a,0x00,0x2e,0x00,0x00,0x00,0x06,0x69,0x62,0x6c,0x6f,
+0x63,0x6b,0x00,0x00,0x0f,0x1a,0x19,0x00,0x1f,0x04,0x00,0xce,0x64,0x65,0x66,0x20,
+0x62,0x6c,0x6f,0x63,0x6b,0x28,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x1a,0x00,0x05,
+0x2a,0x24,0x32,0x32,0x30,0x00,0x00,0x00,0x1c,0x1b,0x00,0x00,0x1c,0x1c,0x00,0x00,
+0x1d,0x1d,0x00,0x00,0x1d,0x1e,0x00,0x00,0x11,0x1a,0x01,0x88,0x2d,0x08,0x00,0x15,
+0x00,0x00,0x00,0x0a,0x1f,0x04,0x00,0xce,0x64,0x65,0x66,0x20,0x62,0x6c,0x6f,0x63,
+0x6b,0x28,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x0b,0x5f,0x5f,0x76,0x61,
+0x72,0x61,0x72,0x67,0x73,0x5f,0x5f,0x00,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x18,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,0x22,0x00,0x00,0x00,
+0x0d,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x62,0x6c,0x6f,0x63,0x6b,0x00,0x00,0x00,
+0x23,0x00,0x00,0x00,0x1f,0x04,0x00,0xcf,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,
+0x73,0x20,0x3d,0x20,0x5b,0x5d,0x00,0x00,0x33,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x1f,0x05,0x00,0xd0,0x20,0x20,0x20,0x20,
+0x74,0x6f,0x6b,0x20,0x3d,0x20,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x33,0x07,0x00,0x03,0x74,0x6f,0x6b,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x01,
+0x50,0x00,0x00,0x00,0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x09,0x07,0x01,0x02,0x00,0x00,0x00,0x00,0x1f,0x07,0x00,0xd2,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x63,0x68,0x65,0x63,0x6b,0x28,0x50,0x2e,0x74,
+0x6f,0x6b,0x65,0x6e,0x2c,0x27,0x6e,0x6c,0x27,0x29,0x3a,0x00,0x0e,0x02,0x00,0x04,
+0x00,0x00,0x00,0x05,0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,0x0e,0x03,0x00,0x02,
+0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x0d,0x05,0x00,0x03,0x00,0x00,0x00,0x05,
+0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x09,0x03,0x03,0x05,0x00,0x00,0x00,0x01,
+0x0d,0x04,0x00,0x05,0x00,0x00,0x00,0x02,0x6e,0x6c,0x00,0x00,0x37,0x01,0x02,0x03,
+0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x57,0x1f,0x0c,0x00,0xd3,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x63,0x68,0x65,0x63,0x6b,0x28,
+0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2c,0x27,0x6e,0x6c,0x27,0x29,0x3a,0x20,0x61,
+0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x29,0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x04,
+0x00,0x00,0x00,0x05,0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,0x0e,0x03,0x00,0x02,
+0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x0d,0x05,0x00,0x03,0x00,0x00,0x00,0x05,
+0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x09,0x03,0x03,0x05,0x00,0x00,0x00,0x02,
+0x0d,0x04,0x00,0x05,0x00,0x00,0x00,0x02,0x6e,0x6c,0x00,0x00,0x37,0x01,0x02,0x03,
+0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x07,0x0e,0x02,0x00,0x06,0x00,0x00,0x00,0x07,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x37,0x01,0x02,0x01,0x13,0x00,0xff,0xe8,
+0x1f,0x07,0x00,0xd4,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,
+0x6e,0x63,0x65,0x28,0x27,0x69,0x6e,0x64,0x65,0x6e,0x74,0x27,0x29,0x00,0x00,0x00,
+0x0e,0x02,0x00,0x06,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,
+0x0d,0x03,0x00,0x07,0x00,0x00,0x00,0x06,0x69,0x6e,0x64,0x65,0x6e,0x74,0x00,0x00,
+0x37,0x01,0x02,0x02,0x1f,0x06,0x00,0xd5,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x62,0x6c,0x6f,0x63,0x6b,0x28,0x69,0x74,0x65,0x6d,0x73,0x29,0x00,0x00,0x00,
+0x0e,0x02,0x00,0x08,0x00,0x00,0x00,0x06,0x69,0x62,0x6c,0x6f,0x63,0x6b,0x00,0x00,
+0x10,0x03,0x00,0x00,0x37,0x01,0x02,0x02,0x1f,0x07,0x00,0xd6,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x27,0x64,0x65,0x64,
+0x65,0x6e,0x74,0x27,0x29,0x00,0x00,0x00,0x0e,0x02,0x00,0x06,0x00,0x00,0x00,0x07,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x0d,0x03,0x00,0x09,0x00,0x00,0x00,0x06,
+0x64,0x65,0x64,0x65,0x6e,0x74,0x00,0x00,0x37,0x01,0x02,0x02,0x13,0x00,0x00,0x7a,
+0x1f,0x03,0x00,0xd7,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x3a,0x00,0x00,0x00,
+0x1f,0x09,0x00,0xd8,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,
+0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x65,0x78,0x70,0x72,0x65,0x73,0x73,
+0x69,0x6f,0x6e,0x28,0x30,0x29,0x29,0x00,0x0d,0x05,0x00,0x0a,0x00,0x00,0x00,0x06,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x02,0x00,0x05,0x00,0x00,0x00,0x03,
+0x0e,0x05,0x00,0x0b,0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,
+0x6f,0x6e,0x00,0x00,0x0c,0x06,0x00,0x0c,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x37,0x04,0x05,0x02,0x39,0x01,0x02,0x03,0x1f,0x09,0x00,0xd9,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x63,0x68,0x65,0x63,0x6b,0x28,
+0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2c,0x27,0x3b,0x27,0x29,0x3a,0x00,0x00,0x00,
+0x0e,0x02,0x00,0x04,0x00,0x00,0x00,0x05,0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,
+0x0e,0x03,0x00,0x02,0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x0d,0x05,0x00,0x03,
+0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x09,0x03,0x03,0x05,
+0x00,0x00,0x00,0x04,0x0d,0x04,0x00,0x0d,0x00,0x00,0x00,0x01,0x3b,0x00,0x00,0x00,
+0x37,0x01,0x02,0x03,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x2d,0x1f,0x07,0x00,0xda,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,
+0x6e,0x63,0x65,0x28,0x27,0x3b,0x27,0x29,0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x06,
+0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x0d,0x03,0x00,0x0d,
+0x00,0x00,0x00,0x01,0x3b,0x00,0x00,0x00,0x37,0x01,0x02,0x02,0x1f,0x0a,0x00,0xdb,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,
+0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x65,0x78,0x70,0x72,0x65,0x73,0x73,
+0x69,0x6f,0x6e,0x28,0x30,0x29,0x29,0x00,0x0d,0x05,0x00,0x0a,0x00,0x00,0x00,0x06,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x02,0x00,0x05,0x00,0x00,0x00,0x05,
+0x0e,0x05,0x00,0x0b,0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,
+0x6f,0x6e,0x00,0x00,0x0c,0x06,0x00,0x0c,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x37,0x04,0x05,0x02,0x39,0x01,0x02,0x03,0x13,0x00,0xff,0xc2,0x1f,0x06,0x00,0xdc,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x50,0x2e,0x74,0x65,0x72,0x6d,0x69,0x6e,
+0x61,0x6c,0x28,0x29,0x00,0x00,0x00,0x00,0x0e,0x04,0x00,0x02,0x00,0x00,0x00,0x01,
+0x50,0x00,0x00,0x00,0x0d,0x05,0x00,0x0e,0x00,0x00,0x00,0x08,0x74,0x65,0x72,0x6d,
+0x69,0x6e,0x61,0x6c,0x00,0x00,0x00,0x00,0x38,0x02,0x04,0x05,0x00,0x00,0x00,0x06,
+0x39,0x01,0x02,0x02,0x1f,0x0b,0x00,0xdd,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,
+0x65,0x20,0x63,0x68,0x65,0x63,0x6b,0x28,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2c,
+0x27,0x6e,0x6c,0x27,0x29,0x3a,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x04,0x00,0x00,0x00,0x05,0x63,0x68,0x65,0x63,
+0x6b,0x00,0x00,0x00,0x0e,0x03,0x00,0x02,0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,
+0x0d,0x05,0x00,0x03,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x09,0x03,0x03,0x05,0x00,0x00,0x00,0x07,0x0d,0x04,0x00,0x05,0x00,0x00,0x00,0x02,
+0x6e,0x6c,0x00,0x00,0x37,0x01,0x02,0x03,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x07,
+0x0e,0x02,0x00,0x06,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,
+0x37,0x01,0x02,0x01,0x13,0x00,0xff,0xe8,0x1f,0x06,0x00,0xe2,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x6c,0x65,0x6e,0x28,0x69,0x74,0x65,0x6d,0x73,0x29,0x20,0x3e,0x20,
+0x31,0x3a,0x00,0x00,0x0e,0x02,0x00,0x0f,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,
+0x10,0x03,0x00,0x00,0x37,0x01,0x02,0x02,0x0c,0x02,0x00,0x10,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x36,0x01,0x01,0x02,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x24,
+0x1f,0x0e,0x00,0xe3,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x6f,0x6b,0x2e,0x70,0x6f,0x73,
+0x2c,0x27,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x73,0x27,0x2c,0x27,0x3b,
+0x27,0x2c,0x69,0x74,0x65,0x6d,0x73,0x29,0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x11,
+0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0d,0x01,0x00,0x12,
+0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x03,0x07,0x01,0x00,0x00,0x00,0x08,
+0x0d,0x04,0x00,0x13,0x00,0x00,0x00,0x0a,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,
+0x74,0x73,0x00,0x00,0x0d,0x05,0x00,0x0d,0x00,0x00,0x00,0x01,0x3b,0x00,0x00,0x00,
+0x10,0x06,0x00,0x00,0x37,0x01,0x02,0x05,0x15,0x01,0x00,0x00,0x1f,0x06,0x00,0xe4,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x69,0x74,0x65,0x6d,0x73,
+0x2e,0x70,0x6f,0x70,0x28,0x29,0x00,0x00,0x0d,0x04,0x00,0x14,0x00,0x00,0x00,0x03,
+0x70,0x6f,0x70,0x00,0x38,0x02,0x00,0x04,0x00,0x00,0x00,0x09,0x39,0x01,0x02,0x02,
+0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x1b,0x00,0x2f,0x00,0x00,0x00,0x05,
+0x62,0x6c,0x6f,0x63,0x6b,0x00,0x00,0x00,0x0f,0x1b,0x1a,0x00,0x1f,0x04,0x00,0xe6,
+0x64,0x65,0x66,0x20,0x64,0x65,0x66,0x5f,0x6e,0x75,0x64,0x28,0x74,0x29,0x3a,0x00,
+0x33,0x1b,0x00,0x05,0x2a,0x24,0x32,0x32,0x36,0x00,0x00,0x00,0x0d,0x20,0x00,0x09,
+0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x1c,0x1c,0x20,0x01,0x1c,0x1d,0x00,0x00,
+0x1d,0x1e,0x00,0x00,0x1d,0x1f,0x00,0x00,0x11,0x1b,0x01,0x40,0x2d,0x09,0x00,0x15,
+0x00,0x00,0x00,0x09,0x1f,0x04,0x00,0xe6,0x64,0x65,0x66,0x20,0x64,0x65,0x66,0x5f,
+0x6e,0x75,0x64,0x28,0x74,0x29,0x3a,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,
+0x00,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x07,
+0x64,0x65,0x66,0x5f,0x6e,0x75,0x64,0x00,0x23,0x01,0x00,0x00,0x1f,0x07,0x00,0xe7,
+0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,0x73,0x20,0x3d,0x20,0x74,0x2e,0x69,0x74,
+0x65,0x6d,0x73,0x20,0x3d,0x20,0x5b,0x5d,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x1c,0x02,0x00,0x00,0x0d,0x03,0x00,0x02,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x0b,0x00,0x03,0x02,
+0x10,0x01,0x02,0x00,0x1f,0x0a,0x00,0xe8,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,
+0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,
+0x29,0x3b,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x29,0x00,0x00,0x00,0x00,
+0x0d,0x06,0x00,0x03,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x03,0x01,0x06,0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x04,0x00,0x00,0x00,0x01,
+0x50,0x00,0x00,0x00,0x0d,0x06,0x00,0x05,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x09,0x05,0x05,0x06,0x00,0x00,0x00,0x01,0x39,0x02,0x03,0x03,
+0x0e,0x03,0x00,0x06,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,
+0x37,0x02,0x03,0x01,0x1f,0x05,0x00,0xe9,0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,
+0x6e,0x63,0x65,0x28,0x27,0x28,0x27,0x29,0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x06,
+0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x0d,0x04,0x00,0x07,
+0x00,0x00,0x00,0x01,0x28,0x00,0x00,0x00,0x37,0x02,0x03,0x02,0x1f,0x0a,0x00,0xea,
+0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x2e,
+0x70,0x6f,0x73,0x2c,0x27,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x27,0x2c,0x27,0x28,0x29,
+0x3a,0x27,0x2c,0x5b,0x5d,0x29,0x00,0x00,0x33,0x02,0x00,0x01,0x72,0x00,0x00,0x00,
+0x0e,0x04,0x00,0x08,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x09,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x05,0x00,0x02,
+0x00,0x00,0x00,0x02,0x0d,0x06,0x00,0x0a,0x00,0x00,0x00,0x06,0x73,0x79,0x6d,0x62,
+0x6f,0x6c,0x00,0x00,0x0d,0x07,0x00,0x0b,0x00,0x00,0x00,0x03,0x28,0x29,0x3a,0x00,
+0x1c,0x08,0x00,0x00,0x37,0x02,0x04,0x05,0x1f,0x05,0x00,0xeb,0x20,0x20,0x20,0x20,
+0x69,0x74,0x65,0x6d,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x72,0x29,0x00,
+0x0d,0x07,0x00,0x03,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x04,0x01,0x07,0x00,0x00,0x00,0x03,0x10,0x06,0x02,0x00,0x39,0x03,0x04,0x03,
+0x1f,0x09,0x00,0xec,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x6e,0x6f,
+0x74,0x20,0x63,0x68,0x65,0x63,0x6b,0x28,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2c,
+0x27,0x29,0x27,0x29,0x3a,0x00,0x00,0x00,0x0e,0x05,0x00,0x0c,0x00,0x00,0x00,0x05,
+0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,0x0e,0x06,0x00,0x04,0x00,0x00,0x00,0x01,
+0x50,0x00,0x00,0x00,0x0d,0x08,0x00,0x05,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x09,0x06,0x06,0x08,0x00,0x00,0x00,0x04,0x0d,0x07,0x00,0x0d,
+0x00,0x00,0x00,0x01,0x29,0x00,0x00,0x00,0x37,0x04,0x05,0x03,0x2f,0x04,0x00,0x00,
+0x13,0x00,0x00,0x67,0x1f,0x06,0x00,0xed,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x74,0x77,0x65,0x61,0x6b,0x28,0x27,0x2c,0x27,0x2c,0x30,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x04,0x00,0x0e,0x00,0x00,0x00,0x05,0x74,0x77,0x65,0x61,0x6b,0x00,0x00,0x00,
+0x0d,0x05,0x00,0x0f,0x00,0x00,0x00,0x01,0x2c,0x00,0x00,0x00,0x0c,0x06,0x00,0x10,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x37,0x03,0x04,0x03,0x1f,0x0a,0x00,0xee,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x2e,0x69,0x74,0x65,0x6d,0x73,0x2e,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,
+0x6e,0x28,0x30,0x29,0x29,0x00,0x00,0x00,0x0d,0x08,0x00,0x02,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x07,0x02,0x08,0x00,0x00,0x00,0x05,
+0x0d,0x08,0x00,0x03,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x04,0x07,0x08,0x00,0x00,0x00,0x06,0x0e,0x07,0x00,0x11,0x00,0x00,0x00,0x0a,
+0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x00,0x00,0x0c,0x08,0x00,0x10,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x37,0x06,0x07,0x02,0x39,0x03,0x04,0x03,
+0x1f,0x0b,0x00,0xef,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x63,
+0x68,0x65,0x63,0x6b,0x28,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2c,0x27,0x2c,0x27,
+0x29,0x3a,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x27,0x2c,0x27,0x29,0x00,
+0x0e,0x04,0x00,0x0c,0x00,0x00,0x00,0x05,0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,
+0x0e,0x05,0x00,0x04,0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x0d,0x07,0x00,0x05,
+0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x09,0x05,0x05,0x07,
+0x00,0x00,0x00,0x07,0x0d,0x06,0x00,0x0f,0x00,0x00,0x00,0x01,0x2c,0x00,0x00,0x00,
+0x37,0x03,0x04,0x03,0x16,0x03,0x00,0x00,0x13,0x00,0x00,0x09,0x0e,0x04,0x00,0x06,
+0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x0d,0x05,0x00,0x0f,
+0x00,0x00,0x00,0x01,0x2c,0x00,0x00,0x00,0x37,0x03,0x04,0x02,0x1f,0x05,0x00,0xf0,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x74,0x6f,0x72,0x65,0x28,
+0x29,0x00,0x00,0x00,0x0e,0x04,0x00,0x12,0x00,0x00,0x00,0x07,0x72,0x65,0x73,0x74,
+0x6f,0x72,0x65,0x00,0x37,0x03,0x04,0x01,0x13,0x00,0xff,0x88,0x1f,0x05,0x00,0xf1,
+0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x27,0x29,0x27,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x04,0x00,0x06,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,
+0x6e,0x63,0x65,0x00,0x0d,0x05,0x00,0x0d,0x00,0x00,0x00,0x01,0x29,0x00,0x00,0x00,
+0x37,0x03,0x04,0x02,0x1f,0x05,0x00,0xf2,0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,
+0x6e,0x63,0x65,0x28,0x27,0x3a,0x27,0x29,0x00,0x00,0x00,0x00,0x0e,0x04,0x00,0x06,
+0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x0d,0x05,0x00,0x13,
+0x00,0x00,0x00,0x01,0x3a,0x00,0x00,0x00,0x37,0x03,0x04,0x02,0x1f,0x07,0x00,0xf3,
+0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,
+0x28,0x62,0x6c,0x6f,0x63,0x6b,0x28,0x29,0x29,0x00,0x00,0x00,0x0d,0x07,0x00,0x03,
+0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x04,0x01,0x07,
+0x00,0x00,0x00,0x08,0x0e,0x07,0x00,0x14,0x00,0x00,0x00,0x05,0x62,0x6c,0x6f,0x63,
+0x6b,0x00,0x00,0x00,0x37,0x06,0x07,0x01,0x39,0x03,0x04,0x03,0x1f,0x04,0x00,0xf4,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x00,0x00,0x00,0x00,
+0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x1c,0x00,0x30,0x00,0x00,0x00,0x07,
+0x64,0x65,0x66,0x5f,0x6e,0x75,0x64,0x00,0x0f,0x1c,0x1b,0x00,0x1f,0x05,0x00,0xf7,
+0x64,0x65,0x66,0x20,0x77,0x68,0x69,0x6c,0x65,0x5f,0x6e,0x75,0x64,0x28,0x74,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x1c,0x00,0x05,0x2a,0x24,0x32,0x33,0x33,0x00,0x00,0x00,
+0x0d,0x21,0x00,0x09,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x1c,0x1d,0x21,0x01,
+0x1c,0x1e,0x00,0x00,0x1d,0x1f,0x00,0x00,0x1d,0x20,0x00,0x00,0x11,0x1c,0x00,0x6f,
+0x2d,0x07,0x00,0x09,0x00,0x00,0x00,0x02,0x1f,0x05,0x00,0xf7,0x64,0x65,0x66,0x20,
+0x77,0x68,0x69,0x6c,0x65,0x5f,0x6e,0x75,0x64,0x28,0x74,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x18,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x09,0x77,0x68,0x69,0x6c,0x65,0x5f,0x6e,0x75,
+0x64,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x07,0x00,0xf8,0x20,0x20,0x20,0x20,
+0x69,0x74,0x65,0x6d,0x73,0x20,0x3d,0x20,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x20,
+0x3d,0x20,0x5b,0x5d,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x1c,0x02,0x00,0x00,0x0d,0x03,0x00,0x02,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x0b,0x00,0x03,0x02,0x10,0x01,0x02,0x00,
+0x1f,0x08,0x00,0xf9,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,0x73,0x2e,0x61,0x70,
+0x70,0x65,0x6e,0x64,0x28,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,
+0x30,0x29,0x29,0x00,0x0d,0x05,0x00,0x03,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x03,0x01,0x05,0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x04,
+0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x00,0x00,
+0x0c,0x06,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x37,0x05,0x05,0x02,
+0x39,0x02,0x03,0x03,0x1f,0x05,0x00,0xfa,0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,
+0x6e,0x63,0x65,0x28,0x27,0x3a,0x27,0x29,0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x06,
+0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x0d,0x04,0x00,0x07,
+0x00,0x00,0x00,0x01,0x3a,0x00,0x00,0x00,0x37,0x02,0x03,0x02,0x1f,0x07,0x00,0xfb,
+0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,
+0x28,0x62,0x6c,0x6f,0x63,0x6b,0x28,0x29,0x29,0x00,0x00,0x00,0x0d,0x05,0x00,0x03,
+0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x03,0x01,0x05,
+0x00,0x00,0x00,0x01,0x0e,0x05,0x00,0x08,0x00,0x00,0x00,0x05,0x62,0x6c,0x6f,0x63,
+0x6b,0x00,0x00,0x00,0x37,0x05,0x05,0x01,0x39,0x02,0x03,0x03,0x1f,0x04,0x00,0xfc,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x00,0x00,0x00,0x00,
+0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x1d,0x00,0x31,0x00,0x00,0x00,0x09,
+0x77,0x68,0x69,0x6c,0x65,0x5f,0x6e,0x75,0x64,0x00,0x00,0x00,0x0f,0x1d,0x1c,0x00,
+0x1f,0x05,0x00,0xfd,0x64,0x65,0x66,0x20,0x63,0x6c,0x61,0x73,0x73,0x5f,0x6e,0x75,
+0x64,0x28,0x74,0x29,0x3a,0x00,0x00,0x00,0x33,0x1d,0x00,0x05,0x2a,0x24,0x32,0x34,
+0x30,0x00,0x00,0x00,0x0d,0x22,0x00,0x09,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x1c,0x1e,0x22,0x01,0x1c,0x1f,0x00,0x00,0x1d,0x20,0x00,0x00,0x1d,0x21,0x00,0x00,
+0x11,0x1d,0x00,0x7e,0x2d,0x08,0x00,0x0b,0x00,0x00,0x00,0x02,0x1f,0x05,0x00,0xfd,
+0x64,0x65,0x66,0x20,0x63,0x6c,0x61,0x73,0x73,0x5f,0x6e,0x75,0x64,0x28,0x74,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x09,0x63,0x6c,0x61,0x73,
+0x73,0x5f,0x6e,0x75,0x64,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x07,0x00,0xfe,
+0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,0x73,0x20,0x3d,0x20,0x74,0x2e,0x69,0x74,
+0x65,0x6d,0x73,0x20,0x3d,0x20,0x5b,0x5d,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x1c,0x02,0x00,0x00,0x0d,0x03,0x00,0x02,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x0b,0x00,0x03,0x02,
+0x10,0x01,0x02,0x00,0x1f,0x08,0x00,0xff,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,
+0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x65,0x78,0x70,0x72,0x65,0x73,0x73,
+0x69,0x6f,0x6e,0x28,0x30,0x29,0x29,0x00,0x0d,0x05,0x00,0x03,0x00,0x00,0x00,0x06,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x03,0x01,0x05,0x00,0x00,0x00,0x00,
+0x0e,0x05,0x00,0x04,0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,
+0x6f,0x6e,0x00,0x00,0x0c,0x06,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x37,0x05,0x05,0x02,0x39,0x02,0x03,0x03,0x1f,0x05,0x01,0x00,0x20,0x20,0x20,0x20,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x27,0x3a,0x27,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x03,0x00,0x06,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,
+0x0d,0x04,0x00,0x07,0x00,0x00,0x00,0x01,0x3a,0x00,0x00,0x00,0x37,0x02,0x03,0x02,
+0x1f,0x0c,0x01,0x02,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,0x73,0x2e,0x61,0x70,
+0x70,0x65,0x6e,0x64,0x28,0x69,0x6c,0x73,0x74,0x28,0x27,0x73,0x74,0x61,0x74,0x65,
+0x6d,0x65,0x6e,0x74,0x73,0x27,0x2c,0x62,0x6c,0x6f,0x63,0x6b,0x28,0x29,0x29,0x29,
+0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x03,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x03,0x01,0x05,0x00,0x00,0x00,0x01,0x0e,0x05,0x00,0x08,
+0x00,0x00,0x00,0x04,0x69,0x6c,0x73,0x74,0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x09,
+0x00,0x00,0x00,0x0a,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x73,0x00,0x00,
+0x0e,0x01,0x00,0x0a,0x00,0x00,0x00,0x05,0x62,0x6c,0x6f,0x63,0x6b,0x00,0x00,0x00,
+0x37,0x07,0x01,0x01,0x37,0x05,0x05,0x03,0x39,0x02,0x03,0x03,0x1f,0x04,0x01,0x03,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x00,0x00,0x00,0x00,
+0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x1e,0x00,0x32,0x00,0x00,0x00,0x09,
+0x63,0x6c,0x61,0x73,0x73,0x5f,0x6e,0x75,0x64,0x00,0x00,0x00,0x0f,0x1e,0x1d,0x00,
+0x1f,0x05,0x01,0x05,0x64,0x65,0x66,0x20,0x66,0x72,0x6f,0x6d,0x5f,0x6e,0x75,0x64,
+0x28,0x74,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x1e,0x00,0x05,0x2a,0x24,0x32,0x34,
+0x37,0x00,0x00,0x00,0x0d,0x23,0x00,0x09,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x1c,0x1f,0x23,0x01,0x1c,0x20,0x00,0x00,0x1d,0x21,0x00,0x00,0x1d,0x22,0x00,0x00,
+0x11,0x1e,0x01,0x1b,0x2d,0x09,0x00,0x13,0x00,0x00,0x00,0x07,0x1f,0x05,0x01,0x05,
+0x64,0x65,0x66,0x20,0x66,0x72,0x6f,0x6d,0x5f,0x6e,0x75,0x64,0x28,0x74,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x08,0x66,0x72,0x6f,0x6d,
+0x5f,0x6e,0x75,0x64,0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x07,0x01,0x06,
+0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,0x73,0x20,0x3d,0x20,0x74,0x2e,0x69,0x74,
+0x65,0x6d,0x73,0x20,0x3d,0x20,0x5b,0x5d,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x1c,0x02,0x00,0x00,0x0d,0x03,0x00,0x02,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x0b,0x00,0x03,0x02,
+0x10,0x01,0x02,0x00,0x1f,0x03,0x01,0x09,0x20,0x20,0x20,0x20,0x73,0x20,0x3d,0x20,
+0x27,0x27,0x00,0x00,0x33,0x02,0x00,0x01,0x73,0x00,0x00,0x00,0x0d,0x02,0x00,0x03,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x04,0x01,0x0a,0x20,0x20,0x20,0x20,
+0x77,0x68,0x69,0x6c,0x65,0x20,0x54,0x72,0x75,0x65,0x3a,0x00,0x0c,0x03,0x00,0x04,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x16,0x03,0x00,0x00,0x13,0x00,0x00,0x81,
+0x1f,0x09,0x01,0x0b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x63,
+0x68,0x65,0x63,0x6b,0x28,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2c,0x20,0x27,0x6d,
+0x67,0x65,0x74,0x27,0x29,0x3a,0x00,0x00,0x0e,0x03,0x00,0x05,0x00,0x00,0x00,0x05,
+0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,0x0e,0x04,0x00,0x06,0x00,0x00,0x00,0x01,
+0x50,0x00,0x00,0x00,0x0d,0x06,0x00,0x07,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x09,0x04,0x04,0x06,0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x08,
+0x00,0x00,0x00,0x04,0x6d,0x67,0x65,0x74,0x00,0x00,0x00,0x00,0x37,0x03,0x03,0x03,
+0x16,0x03,0x00,0x00,0x13,0x00,0x00,0x19,0x1f,0x06,0x01,0x0c,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x20,0x3d,0x20,0x73,0x20,0x2b,0x20,
+0x27,0x2e,0x27,0x00,0x0d,0x03,0x00,0x09,0x00,0x00,0x00,0x01,0x2e,0x00,0x00,0x00,
+0x01,0x02,0x02,0x03,0x1f,0x06,0x01,0x0d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x29,0x00,0x00,0x00,
+0x0e,0x03,0x00,0x0a,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,
+0x37,0x03,0x03,0x01,0x13,0x00,0xff,0xc6,0x1f,0x0a,0x01,0x0e,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x63,0x68,0x65,0x63,0x6b,0x28,0x50,
+0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2c,0x20,0x27,0x6e,0x61,0x6d,0x65,0x27,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x05,0x00,0x00,0x00,0x05,0x63,0x68,0x65,0x63,
+0x6b,0x00,0x00,0x00,0x0e,0x04,0x00,0x06,0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,
+0x0d,0x06,0x00,0x07,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x09,0x04,0x04,0x06,0x00,0x00,0x00,0x01,0x0d,0x05,0x00,0x0b,0x00,0x00,0x00,0x04,
+0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,0x37,0x03,0x03,0x03,0x16,0x03,0x00,0x00,
+0x13,0x00,0x00,0x26,0x1f,0x08,0x01,0x0f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x73,0x20,0x3d,0x20,0x73,0x20,0x2b,0x20,0x50,0x2e,0x74,0x6f,
+0x6b,0x65,0x6e,0x2e,0x76,0x61,0x6c,0x00,0x0e,0x03,0x00,0x06,0x00,0x00,0x00,0x01,
+0x50,0x00,0x00,0x00,0x0d,0x04,0x00,0x07,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x09,0x03,0x03,0x04,0x00,0x00,0x00,0x02,0x0d,0x04,0x00,0x0c,
+0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x09,0x03,0x03,0x04,0x00,0x00,0x00,0x03,
+0x01,0x02,0x02,0x03,0x1f,0x06,0x01,0x10,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x29,0x00,0x00,0x00,
+0x0e,0x03,0x00,0x0a,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,
+0x37,0x03,0x03,0x01,0x13,0x00,0xff,0x82,0x1f,0x05,0x01,0x12,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x72,0x65,0x61,0x6b,0x00,0x00,0x00,
+0x1f,0x09,0x01,0x14,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,0x20,0x3d,0x20,0x54,
+0x6f,0x6b,0x65,0x6e,0x28,0x74,0x2e,0x70,0x6f,0x73,0x2c,0x20,0x27,0x6e,0x61,0x6d,
+0x65,0x27,0x2c,0x20,0x73,0x29,0x00,0x00,0x33,0x03,0x00,0x04,0x65,0x78,0x70,0x72,
+0x00,0x00,0x00,0x00,0x0e,0x04,0x00,0x0d,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x0d,0x08,0x00,0x0e,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,
+0x09,0x05,0x00,0x08,0x00,0x00,0x00,0x04,0x0d,0x06,0x00,0x0b,0x00,0x00,0x00,0x04,
+0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,0x10,0x07,0x02,0x00,0x37,0x03,0x04,0x04,
+0x1f,0x06,0x01,0x15,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,0x73,0x2e,0x61,0x70,
+0x70,0x65,0x6e,0x64,0x28,0x65,0x78,0x70,0x72,0x29,0x00,0x00,0x0d,0x07,0x00,0x0f,
+0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x04,0x01,0x07,
+0x00,0x00,0x00,0x05,0x10,0x06,0x03,0x00,0x39,0x03,0x04,0x03,0x1f,0x06,0x01,0x17,
+0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x27,0x69,0x6d,0x70,
+0x6f,0x72,0x74,0x27,0x29,0x00,0x00,0x00,0x0e,0x04,0x00,0x0a,0x00,0x00,0x00,0x07,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x0d,0x05,0x00,0x10,0x00,0x00,0x00,0x06,
+0x69,0x6d,0x70,0x6f,0x72,0x74,0x00,0x00,0x37,0x03,0x04,0x02,0x1f,0x08,0x01,0x18,
+0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,
+0x28,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x30,0x29,0x29,0x00,
+0x0d,0x07,0x00,0x0f,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x04,0x01,0x07,0x00,0x00,0x00,0x06,0x0e,0x07,0x00,0x11,0x00,0x00,0x00,0x0a,
+0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x00,0x00,0x0c,0x08,0x00,0x12,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x37,0x06,0x07,0x02,0x39,0x03,0x04,0x03,
+0x1f,0x04,0x01,0x19,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,
+0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x1f,0x00,0x33,
+0x00,0x00,0x00,0x08,0x66,0x72,0x6f,0x6d,0x5f,0x6e,0x75,0x64,0x00,0x00,0x00,0x00,
+0x0f,0x1f,0x1e,0x00,0x1f,0x05,0x01,0x1b,0x64,0x65,0x66,0x20,0x69,0x6d,0x70,0x6f,
+0x72,0x74,0x5f,0x6e,0x75,0x64,0x28,0x74,0x29,0x3a,0x00,0x00,0x33,0x1f,0x00,0x05,
+0x2a,0x24,0x32,0x35,0x34,0x00,0x00,0x00,0x0d,0x24,0x00,0x09,0x00,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x1c,0x20,0x24,0x01,0x1c,0x21,0x00,0x00,0x1d,0x22,0x00,0x00,
+0x1d,0x23,0x00,0x00,0x11,0x1f,0x01,0x37,0x2d,0x09,0x00,0x13,0x00,0x00,0x00,0x08,
+0x1f,0x05,0x01,0x1b,0x64,0x65,0x66,0x20,0x69,0x6d,0x70,0x6f,0x72,0x74,0x5f,0x6e,
+0x75,0x64,0x28,0x74,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,
+0x00,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x0a,
+0x69,0x6d,0x70,0x6f,0x72,0x74,0x5f,0x6e,0x75,0x64,0x00,0x00,0x23,0x01,0x00,0x00,
+0x1f,0x07,0x01,0x1c,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,0x73,0x20,0x3d,0x20,
+0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x20,0x3d,0x20,0x5b,0x5d,0x00,0x00,0x00,0x00,
+0x33,0x01,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x1c,0x02,0x00,0x00,
+0x0d,0x03,0x00,0x02,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x0b,0x00,0x03,0x02,0x10,0x01,0x02,0x00,0x1f,0x03,0x01,0x1d,0x20,0x20,0x20,0x20,
+0x73,0x20,0x3d,0x20,0x27,0x27,0x00,0x00,0x33,0x02,0x00,0x01,0x73,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x04,0x01,0x1e,
+0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x54,0x72,0x75,0x65,0x3a,0x00,
+0x0c,0x03,0x00,0x04,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x16,0x03,0x00,0x00,
+0x13,0x00,0x00,0x81,0x1f,0x09,0x01,0x1f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x63,0x68,0x65,0x63,0x6b,0x28,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,
+0x2c,0x20,0x27,0x6d,0x67,0x65,0x74,0x27,0x29,0x3a,0x00,0x00,0x0e,0x03,0x00,0x05,
+0x00,0x00,0x00,0x05,0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,0x0e,0x04,0x00,0x06,
+0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x0d,0x06,0x00,0x07,0x00,0x00,0x00,0x05,
+0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x09,0x04,0x04,0x06,0x00,0x00,0x00,0x00,
+0x0d,0x05,0x00,0x08,0x00,0x00,0x00,0x04,0x6d,0x67,0x65,0x74,0x00,0x00,0x00,0x00,
+0x37,0x03,0x03,0x03,0x16,0x03,0x00,0x00,0x13,0x00,0x00,0x19,0x1f,0x06,0x01,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x20,0x3d,0x20,
+0x73,0x20,0x2b,0x20,0x27,0x2e,0x27,0x00,0x0d,0x03,0x00,0x09,0x00,0x00,0x00,0x01,
+0x2e,0x00,0x00,0x00,0x01,0x02,0x02,0x03,0x1f,0x06,0x01,0x21,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,
+0x29,0x00,0x00,0x00,0x0e,0x03,0x00,0x0a,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,
+0x6e,0x63,0x65,0x00,0x37,0x03,0x03,0x01,0x13,0x00,0xff,0xc6,0x1f,0x0a,0x01,0x22,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x63,0x68,0x65,
+0x63,0x6b,0x28,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2c,0x20,0x27,0x6e,0x61,0x6d,
+0x65,0x27,0x29,0x3a,0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x05,0x00,0x00,0x00,0x05,
+0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,0x0e,0x04,0x00,0x06,0x00,0x00,0x00,0x01,
+0x50,0x00,0x00,0x00,0x0d,0x06,0x00,0x07,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x09,0x04,0x04,0x06,0x00,0x00,0x00,0x01,0x0d,0x05,0x00,0x0b,
+0x00,0x00,0x00,0x04,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,0x37,0x03,0x03,0x03,
+0x16,0x03,0x00,0x00,0x13,0x00,0x00,0x26,0x1f,0x08,0x01,0x23,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x20,0x3d,0x20,0x73,0x20,0x2b,0x20,
+0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2e,0x76,0x61,0x6c,0x00,0x0e,0x03,0x00,0x06,
+0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x0d,0x04,0x00,0x07,0x00,0x00,0x00,0x05,
+0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x09,0x03,0x03,0x04,0x00,0x00,0x00,0x02,
+0x0d,0x04,0x00,0x0c,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x09,0x03,0x03,0x04,
+0x00,0x00,0x00,0x03,0x01,0x02,0x02,0x03,0x1f,0x06,0x01,0x24,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,
+0x29,0x00,0x00,0x00,0x0e,0x03,0x00,0x0a,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,
+0x6e,0x63,0x65,0x00,0x37,0x03,0x03,0x01,0x13,0x00,0xff,0x82,0x1f,0x05,0x01,0x26,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x72,0x65,0x61,
+0x6b,0x00,0x00,0x00,0x1f,0x09,0x01,0x28,0x20,0x20,0x20,0x20,0x65,0x78,0x70,0x72,
+0x20,0x3d,0x20,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x2e,0x70,0x6f,0x73,0x2c,0x20,
+0x27,0x6e,0x61,0x6d,0x65,0x27,0x2c,0x20,0x73,0x29,0x00,0x00,0x33,0x03,0x00,0x04,
+0x65,0x78,0x70,0x72,0x00,0x00,0x00,0x00,0x0e,0x04,0x00,0x0d,0x00,0x00,0x00,0x05,
+0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0d,0x08,0x00,0x0e,0x00,0x00,0x00,0x03,
+0x70,0x6f,0x73,0x00,0x09,0x05,0x00,0x08,0x00,0x00,0x00,0x04,0x0d,0x06,0x00,0x0b,
+0x00,0x00,0x00,0x04,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,0x10,0x07,0x02,0x00,
+0x37,0x03,0x04,0x04,0x1f,0x06,0x01,0x29,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,
+0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x65,0x78,0x70,0x72,0x29,0x00,0x00,
+0x0d,0x07,0x00,0x0f,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x04,0x01,0x07,0x00,0x00,0x00,0x05,0x10,0x06,0x03,0x00,0x39,0x03,0x04,0x03,
+0x1f,0x08,0x01,0x2a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x63,0x68,0x65,0x63,0x6b,
+0x28,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2c,0x20,0x27,0x61,0x73,0x27,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x0e,0x04,0x00,0x05,0x00,0x00,0x00,0x05,0x63,0x68,0x65,0x63,
+0x6b,0x00,0x00,0x00,0x0e,0x05,0x00,0x06,0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,
+0x0d,0x07,0x00,0x07,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x09,0x05,0x05,0x07,0x00,0x00,0x00,0x06,0x0d,0x06,0x00,0x10,0x00,0x00,0x00,0x02,
+0x61,0x73,0x00,0x00,0x37,0x03,0x04,0x03,0x16,0x03,0x00,0x00,0x13,0x00,0x00,0x2a,
+0x1f,0x06,0x01,0x2b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,
+0x6e,0x63,0x65,0x28,0x27,0x61,0x73,0x27,0x29,0x00,0x00,0x00,0x0e,0x04,0x00,0x0a,
+0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x0d,0x05,0x00,0x10,
+0x00,0x00,0x00,0x02,0x61,0x73,0x00,0x00,0x37,0x03,0x04,0x02,0x1f,0x09,0x01,0x2c,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,0x73,0x2e,0x61,0x70,
+0x70,0x65,0x6e,0x64,0x28,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,
+0x30,0x29,0x29,0x00,0x0d,0x07,0x00,0x0f,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x04,0x01,0x07,0x00,0x00,0x00,0x07,0x0e,0x07,0x00,0x11,
+0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x00,0x00,
+0x0c,0x08,0x00,0x12,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x37,0x06,0x07,0x02,
+0x39,0x03,0x04,0x03,0x1f,0x04,0x01,0x2e,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x74,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x20,0x00,0x34,0x00,0x00,0x00,0x0a,0x69,0x6d,0x70,0x6f,0x72,0x74,0x5f,0x6e,
+0x75,0x64,0x00,0x00,0x0f,0x20,0x1f,0x00,0x1f,0x04,0x01,0x30,0x64,0x65,0x66,0x20,
+0x66,0x6f,0x72,0x5f,0x6e,0x75,0x64,0x28,0x74,0x29,0x3a,0x00,0x33,0x20,0x00,0x05,
+0x2a,0x24,0x32,0x36,0x31,0x00,0x00,0x00,0x0d,0x25,0x00,0x09,0x00,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x1c,0x21,0x25,0x01,0x1c,0x22,0x00,0x00,0x1d,0x23,0x00,0x00,
+0x1d,0x24,0x00,0x00,0x11,0x20,0x00,0xaf,0x2d,0x07,0x00,0x0c,0x00,0x00,0x00,0x03,
+0x1f,0x04,0x01,0x30,0x64,0x65,0x66,0x20,0x66,0x6f,0x72,0x5f,0x6e,0x75,0x64,0x28,
+0x74,0x29,0x3a,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x07,0x66,0x6f,0x72,0x5f,
+0x6e,0x75,0x64,0x00,0x23,0x01,0x00,0x00,0x1f,0x07,0x01,0x31,0x20,0x20,0x20,0x20,
+0x69,0x74,0x65,0x6d,0x73,0x20,0x3d,0x20,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x20,
+0x3d,0x20,0x5b,0x5d,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x1c,0x02,0x00,0x00,0x0d,0x03,0x00,0x02,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x0b,0x00,0x03,0x02,0x10,0x01,0x02,0x00,
+0x1f,0x05,0x01,0x32,0x20,0x20,0x20,0x20,0x74,0x77,0x65,0x61,0x6b,0x28,0x27,0x69,
+0x6e,0x27,0x2c,0x30,0x29,0x00,0x00,0x00,0x0e,0x03,0x00,0x03,0x00,0x00,0x00,0x05,
+0x74,0x77,0x65,0x61,0x6b,0x00,0x00,0x00,0x0d,0x04,0x00,0x04,0x00,0x00,0x00,0x02,
+0x69,0x6e,0x00,0x00,0x0c,0x05,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x37,0x02,0x03,0x03,0x1f,0x08,0x01,0x33,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,
+0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x65,0x78,0x70,0x72,0x65,0x73,0x73,
+0x69,0x6f,0x6e,0x28,0x30,0x29,0x29,0x00,0x0d,0x05,0x00,0x06,0x00,0x00,0x00,0x06,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x03,0x01,0x05,0x00,0x00,0x00,0x00,
+0x0e,0x05,0x00,0x07,0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,
+0x6f,0x6e,0x00,0x00,0x0c,0x06,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x37,0x05,0x05,0x02,0x39,0x02,0x03,0x03,0x1f,0x05,0x01,0x34,0x20,0x20,0x20,0x20,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x27,0x69,0x6e,0x27,0x29,0x00,0x00,0x00,
+0x0e,0x03,0x00,0x08,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,
+0x0d,0x04,0x00,0x04,0x00,0x00,0x00,0x02,0x69,0x6e,0x00,0x00,0x37,0x02,0x03,0x02,
+0x1f,0x08,0x01,0x35,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,0x73,0x2e,0x61,0x70,
+0x70,0x65,0x6e,0x64,0x28,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,
+0x30,0x29,0x29,0x00,0x0d,0x05,0x00,0x06,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x03,0x01,0x05,0x00,0x00,0x00,0x01,0x0e,0x05,0x00,0x07,
+0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x00,0x00,
+0x0c,0x06,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x37,0x05,0x05,0x02,
+0x39,0x02,0x03,0x03,0x1f,0x04,0x01,0x36,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x74,
+0x6f,0x72,0x65,0x28,0x29,0x00,0x00,0x00,0x0e,0x03,0x00,0x09,0x00,0x00,0x00,0x07,
+0x72,0x65,0x73,0x74,0x6f,0x72,0x65,0x00,0x37,0x02,0x03,0x01,0x1f,0x05,0x01,0x37,
+0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x27,0x3a,0x27,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x08,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,
+0x6e,0x63,0x65,0x00,0x0d,0x04,0x00,0x0a,0x00,0x00,0x00,0x01,0x3a,0x00,0x00,0x00,
+0x37,0x02,0x03,0x02,0x1f,0x07,0x01,0x38,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,
+0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x62,0x6c,0x6f,0x63,0x6b,0x28,0x29,
+0x29,0x00,0x00,0x00,0x0d,0x05,0x00,0x06,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x03,0x01,0x05,0x00,0x00,0x00,0x02,0x0e,0x05,0x00,0x0b,
+0x00,0x00,0x00,0x05,0x62,0x6c,0x6f,0x63,0x6b,0x00,0x00,0x00,0x37,0x05,0x05,0x01,
+0x39,0x02,0x03,0x03,0x1f,0x04,0x01,0x39,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x74,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x21,0x00,0x35,0x00,0x00,0x00,0x07,0x66,0x6f,0x72,0x5f,0x6e,0x75,0x64,0x00,
+0x0f,0x21,0x20,0x00,0x1f,0x04,0x01,0x3b,0x64,0x65,0x66,0x20,0x69,0x66,0x5f,0x6e,
+0x75,0x64,0x28,0x74,0x29,0x3a,0x00,0x00,0x33,0x21,0x00,0x05,0x2a,0x24,0x32,0x36,
+0x38,0x00,0x00,0x00,0x0d,0x26,0x00,0x09,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x1c,0x22,0x26,0x01,0x1c,0x23,0x00,0x00,0x1d,0x24,0x00,0x00,0x1d,0x25,0x00,0x00,
+0x11,0x21,0x01,0xa1,0x2d,0x10,0x00,0x10,0x00,0x00,0x00,0x0a,0x1f,0x04,0x01,0x3b,
+0x64,0x65,0x66,0x20,0x69,0x66,0x5f,0x6e,0x75,0x64,0x28,0x74,0x29,0x3a,0x00,0x00,
+0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x18,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x06,0x69,0x66,0x5f,0x6e,0x75,0x64,0x00,0x00,
+0x23,0x01,0x00,0x00,0x1f,0x07,0x01,0x3c,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,
+0x73,0x20,0x3d,0x20,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x20,0x3d,0x20,0x5b,0x5d,
+0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x1c,0x02,0x00,0x00,0x0d,0x03,0x00,0x02,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x0b,0x00,0x03,0x02,0x10,0x01,0x02,0x00,0x1f,0x06,0x01,0x3d,
+0x20,0x20,0x20,0x20,0x61,0x20,0x3d,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,
+0x6f,0x6e,0x28,0x30,0x29,0x00,0x00,0x00,0x33,0x02,0x00,0x01,0x61,0x00,0x00,0x00,
+0x0e,0x04,0x00,0x03,0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,
+0x6f,0x6e,0x00,0x00,0x0c,0x05,0x00,0x04,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x37,0x02,0x04,0x02,0x1f,0x05,0x01,0x3e,0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,
+0x6e,0x63,0x65,0x28,0x27,0x3a,0x27,0x29,0x00,0x00,0x00,0x00,0x0e,0x04,0x00,0x05,
+0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x0d,0x05,0x00,0x06,
+0x00,0x00,0x00,0x01,0x3a,0x00,0x00,0x00,0x37,0x03,0x04,0x02,0x1f,0x04,0x01,0x3f,
+0x20,0x20,0x20,0x20,0x62,0x20,0x3d,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x28,0x29,0x00,
+0x33,0x03,0x00,0x01,0x62,0x00,0x00,0x00,0x0e,0x05,0x00,0x07,0x00,0x00,0x00,0x05,
+0x62,0x6c,0x6f,0x63,0x6b,0x00,0x00,0x00,0x37,0x03,0x05,0x01,0x1f,0x0d,0x01,0x40,
+0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,
+0x28,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x65,0x6c,
+0x69,0x66,0x27,0x2c,0x27,0x65,0x6c,0x69,0x66,0x27,0x2c,0x5b,0x61,0x2c,0x62,0x5d,
+0x29,0x29,0x00,0x00,0x0d,0x08,0x00,0x08,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x05,0x01,0x08,0x00,0x00,0x00,0x00,0x0e,0x08,0x00,0x09,
+0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0d,0x0d,0x00,0x0a,
+0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x09,0x00,0x0d,0x00,0x00,0x00,0x01,
+0x0d,0x0a,0x00,0x0b,0x00,0x00,0x00,0x04,0x65,0x6c,0x69,0x66,0x00,0x00,0x00,0x00,
+0x0d,0x0b,0x00,0x0b,0x00,0x00,0x00,0x04,0x65,0x6c,0x69,0x66,0x00,0x00,0x00,0x00,
+0x10,0x0d,0x02,0x00,0x10,0x0e,0x03,0x00,0x1c,0x0c,0x0d,0x02,0x37,0x07,0x08,0x05,
+0x39,0x04,0x05,0x03,0x1f,0x09,0x01,0x41,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,
+0x65,0x20,0x63,0x68,0x65,0x63,0x6b,0x28,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2c,
+0x27,0x65,0x6c,0x69,0x66,0x27,0x29,0x3a,0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x0c,
+0x00,0x00,0x00,0x05,0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,0x0e,0x06,0x00,0x0d,
+0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x0d,0x08,0x00,0x0e,0x00,0x00,0x00,0x05,
+0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x09,0x06,0x06,0x08,0x00,0x00,0x00,0x02,
+0x0d,0x07,0x00,0x0b,0x00,0x00,0x00,0x04,0x65,0x6c,0x69,0x66,0x00,0x00,0x00,0x00,
+0x37,0x04,0x05,0x03,0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x7b,0x1f,0x06,0x01,0x42,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x20,0x3d,0x20,0x50,0x2e,
+0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x33,0x04,0x00,0x03,0x74,0x6f,0x6b,0x00,
+0x0e,0x05,0x00,0x0d,0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x0d,0x06,0x00,0x0e,
+0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x09,0x04,0x05,0x06,
+0x00,0x00,0x00,0x03,0x1f,0x06,0x01,0x43,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x27,0x65,0x6c,0x69,0x66,0x27,0x29,0x00,
+0x0e,0x06,0x00,0x05,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,
+0x0d,0x07,0x00,0x0b,0x00,0x00,0x00,0x04,0x65,0x6c,0x69,0x66,0x00,0x00,0x00,0x00,
+0x37,0x05,0x06,0x02,0x1f,0x07,0x01,0x44,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x61,0x20,0x3d,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x30,
+0x29,0x00,0x00,0x00,0x0e,0x06,0x00,0x03,0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x72,
+0x65,0x73,0x73,0x69,0x6f,0x6e,0x00,0x00,0x0c,0x07,0x00,0x04,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x37,0x02,0x06,0x02,0x1f,0x06,0x01,0x45,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x27,0x3a,0x27,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x05,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,
+0x6e,0x63,0x65,0x00,0x0d,0x07,0x00,0x06,0x00,0x00,0x00,0x01,0x3a,0x00,0x00,0x00,
+0x37,0x05,0x06,0x02,0x1f,0x05,0x01,0x46,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x62,0x20,0x3d,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x28,0x29,0x00,0x0e,0x06,0x00,0x07,
+0x00,0x00,0x00,0x05,0x62,0x6c,0x6f,0x63,0x6b,0x00,0x00,0x00,0x37,0x03,0x06,0x01,
+0x1f,0x0f,0x01,0x47,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,
+0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,
+0x6f,0x6b,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x65,0x6c,0x69,0x66,0x27,0x2c,0x27,0x65,
+0x6c,0x69,0x66,0x27,0x2c,0x5b,0x61,0x2c,0x62,0x5d,0x29,0x29,0x00,0x00,0x00,0x00,
+0x0d,0x09,0x00,0x08,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x06,0x01,0x09,0x00,0x00,0x00,0x04,0x0e,0x09,0x00,0x09,0x00,0x00,0x00,0x05,
+0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0d,0x0e,0x00,0x0a,0x00,0x00,0x00,0x03,
+0x70,0x6f,0x73,0x00,0x09,0x0a,0x04,0x0e,0x00,0x00,0x00,0x05,0x0d,0x0b,0x00,0x0b,
+0x00,0x00,0x00,0x04,0x65,0x6c,0x69,0x66,0x00,0x00,0x00,0x00,0x0d,0x0c,0x00,0x0b,
+0x00,0x00,0x00,0x04,0x65,0x6c,0x69,0x66,0x00,0x00,0x00,0x00,0x10,0x0e,0x02,0x00,
+0x10,0x0f,0x03,0x00,0x1c,0x0d,0x0e,0x02,0x37,0x08,0x09,0x05,0x39,0x05,0x06,0x03,
+0x13,0x00,0xff,0x73,0x1f,0x08,0x01,0x48,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x63,
+0x68,0x65,0x63,0x6b,0x28,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2c,0x27,0x65,0x6c,
+0x73,0x65,0x27,0x29,0x3a,0x00,0x00,0x00,0x0e,0x06,0x00,0x0c,0x00,0x00,0x00,0x05,
+0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,0x0e,0x07,0x00,0x0d,0x00,0x00,0x00,0x01,
+0x50,0x00,0x00,0x00,0x0d,0x09,0x00,0x0e,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x09,0x07,0x07,0x09,0x00,0x00,0x00,0x06,0x0d,0x08,0x00,0x0f,
+0x00,0x00,0x00,0x04,0x65,0x6c,0x73,0x65,0x00,0x00,0x00,0x00,0x37,0x05,0x06,0x03,
+0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x65,0x1f,0x06,0x01,0x49,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x20,0x3d,0x20,0x50,0x2e,0x74,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x0e,0x05,0x00,0x0d,0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,
+0x0d,0x06,0x00,0x0e,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x09,0x04,0x05,0x06,0x00,0x00,0x00,0x07,0x1f,0x06,0x01,0x4a,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x27,0x65,0x6c,0x73,
+0x65,0x27,0x29,0x00,0x0e,0x06,0x00,0x05,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,
+0x6e,0x63,0x65,0x00,0x0d,0x07,0x00,0x0f,0x00,0x00,0x00,0x04,0x65,0x6c,0x73,0x65,
+0x00,0x00,0x00,0x00,0x37,0x05,0x06,0x02,0x1f,0x06,0x01,0x4b,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,0x27,0x3a,0x27,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x05,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,
+0x6e,0x63,0x65,0x00,0x0d,0x07,0x00,0x06,0x00,0x00,0x00,0x01,0x3a,0x00,0x00,0x00,
+0x37,0x05,0x06,0x02,0x1f,0x05,0x01,0x4c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x62,0x20,0x3d,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x28,0x29,0x00,0x0e,0x06,0x00,0x07,
+0x00,0x00,0x00,0x05,0x62,0x6c,0x6f,0x63,0x6b,0x00,0x00,0x00,0x37,0x03,0x06,0x01,
+0x1f,0x0e,0x01,0x4d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,
+0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,
+0x6f,0x6b,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x65,0x6c,0x73,0x65,0x27,0x2c,0x27,0x65,
+0x6c,0x73,0x65,0x27,0x2c,0x5b,0x62,0x5d,0x29,0x29,0x00,0x00,0x0d,0x09,0x00,0x08,
+0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x06,0x01,0x09,
+0x00,0x00,0x00,0x08,0x0e,0x09,0x00,0x09,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x0d,0x0e,0x00,0x0a,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,
+0x09,0x0a,0x04,0x0e,0x00,0x00,0x00,0x09,0x0d,0x0b,0x00,0x0f,0x00,0x00,0x00,0x04,
+0x65,0x6c,0x73,0x65,0x00,0x00,0x00,0x00,0x0d,0x0c,0x00,0x0f,0x00,0x00,0x00,0x04,
+0x65,0x6c,0x73,0x65,0x00,0x00,0x00,0x00,0x10,0x0e,0x03,0x00,0x1c,0x0d,0x0e,0x01,
+0x37,0x08,0x09,0x05,0x39,0x05,0x06,0x03,0x1f,0x04,0x01,0x4e,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x22,0x00,0x36,0x00,0x00,0x00,0x06,0x69,0x66,0x5f,0x6e,
+0x75,0x64,0x00,0x00,0x0f,0x22,0x21,0x00,0x1f,0x04,0x01,0x4f,0x64,0x65,0x66,0x20,
+0x74,0x72,0x79,0x5f,0x6e,0x75,0x64,0x28,0x74,0x29,0x3a,0x00,0x33,0x22,0x00,0x05,
+0x2a,0x24,0x32,0x37,0x35,0x00,0x00,0x00,0x0d,0x27,0x00,0x09,0x00,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x1c,0x23,0x27,0x01,0x1c,0x24,0x00,0x00,0x1d,0x25,0x00,0x00,
+0x1d,0x26,0x00,0x00,0x11,0x22,0x01,0x31,0x2d,0x0f,0x00,0x11,0x00,0x00,0x00,0x07,
+0x1f,0x04,0x01,0x4f,0x64,0x65,0x66,0x20,0x74,0x72,0x79,0x5f,0x6e,0x75,0x64,0x28,
+0x74,0x29,0x3a,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x07,0x74,0x72,0x79,0x5f,
+0x6e,0x75,0x64,0x00,0x23,0x01,0x00,0x00,0x1f,0x07,0x01,0x50,0x20,0x20,0x20,0x20,
+0x69,0x74,0x65,0x6d,0x73,0x20,0x3d,0x20,0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x20,
+0x3d,0x20,0x5b,0x5d,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x1c,0x02,0x00,0x00,0x0d,0x03,0x00,0x02,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x0b,0x00,0x03,0x02,0x10,0x01,0x02,0x00,
+0x1f,0x05,0x01,0x51,0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,
+0x27,0x3a,0x27,0x29,0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x03,0x00,0x00,0x00,0x07,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x0d,0x04,0x00,0x04,0x00,0x00,0x00,0x01,
+0x3a,0x00,0x00,0x00,0x37,0x02,0x03,0x02,0x1f,0x04,0x01,0x52,0x20,0x20,0x20,0x20,
+0x62,0x20,0x3d,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x28,0x29,0x00,0x33,0x02,0x00,0x01,
+0x62,0x00,0x00,0x00,0x0e,0x04,0x00,0x05,0x00,0x00,0x00,0x05,0x62,0x6c,0x6f,0x63,
+0x6b,0x00,0x00,0x00,0x37,0x02,0x04,0x01,0x1f,0x05,0x01,0x53,0x20,0x20,0x20,0x20,
+0x69,0x74,0x65,0x6d,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x62,0x29,0x00,
+0x0d,0x07,0x00,0x06,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x04,0x01,0x07,0x00,0x00,0x00,0x00,0x10,0x06,0x02,0x00,0x39,0x03,0x04,0x03,
+0x1f,0x09,0x01,0x54,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x63,0x68,
+0x65,0x63,0x6b,0x28,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2c,0x27,0x65,0x78,0x63,
+0x65,0x70,0x74,0x27,0x29,0x3a,0x00,0x00,0x0e,0x04,0x00,0x07,0x00,0x00,0x00,0x05,
+0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,0x0e,0x05,0x00,0x08,0x00,0x00,0x00,0x01,
+0x50,0x00,0x00,0x00,0x0d,0x07,0x00,0x09,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x09,0x05,0x05,0x07,0x00,0x00,0x00,0x01,0x0d,0x06,0x00,0x0a,
+0x00,0x00,0x00,0x06,0x65,0x78,0x63,0x65,0x70,0x74,0x00,0x00,0x37,0x03,0x04,0x03,
+0x16,0x03,0x00,0x00,0x13,0x00,0x00,0xba,0x1f,0x06,0x01,0x55,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x20,0x3d,0x20,0x50,0x2e,0x74,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x33,0x03,0x00,0x03,0x74,0x6f,0x6b,0x00,0x0e,0x04,0x00,0x08,
+0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x0d,0x05,0x00,0x09,0x00,0x00,0x00,0x05,
+0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x09,0x03,0x04,0x05,0x00,0x00,0x00,0x02,
+0x1f,0x07,0x01,0x56,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,
+0x6e,0x63,0x65,0x28,0x27,0x65,0x78,0x63,0x65,0x70,0x74,0x27,0x29,0x00,0x00,0x00,
+0x0e,0x05,0x00,0x03,0x00,0x00,0x00,0x07,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,
+0x0d,0x06,0x00,0x0a,0x00,0x00,0x00,0x06,0x65,0x78,0x63,0x65,0x70,0x74,0x00,0x00,
+0x37,0x04,0x05,0x02,0x1f,0x0e,0x01,0x57,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x6e,0x6f,0x74,0x20,0x63,0x68,0x65,0x63,0x6b,0x28,0x50,0x2e,0x74,
+0x6f,0x6b,0x65,0x6e,0x2c,0x27,0x3a,0x27,0x29,0x3a,0x20,0x61,0x20,0x3d,0x20,0x65,
+0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x30,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x06,0x00,0x07,0x00,0x00,0x00,0x05,0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,
+0x0e,0x07,0x00,0x08,0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x0d,0x09,0x00,0x09,
+0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x09,0x07,0x07,0x09,
+0x00,0x00,0x00,0x03,0x0d,0x08,0x00,0x04,0x00,0x00,0x00,0x01,0x3a,0x00,0x00,0x00,
+0x37,0x05,0x06,0x03,0x2f,0x05,0x00,0x00,0x13,0x00,0x00,0x0d,0x33,0x04,0x00,0x01,
+0x61,0x00,0x00,0x00,0x0e,0x06,0x00,0x0b,0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x72,
+0x65,0x73,0x73,0x69,0x6f,0x6e,0x00,0x00,0x0c,0x07,0x00,0x0c,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x37,0x04,0x06,0x02,0x13,0x00,0x00,0x21,0x1f,0x0d,0x01,0x58,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x3a,0x20,0x61,0x20,
+0x3d,0x20,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x6f,0x6b,0x2e,0x70,0x6f,0x73,0x2c,
+0x27,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x27,0x2c,0x27,0x4e,0x6f,0x6e,0x65,0x27,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x0d,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x0d,0x0a,0x00,0x0e,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,
+0x09,0x07,0x03,0x0a,0x00,0x00,0x00,0x04,0x0d,0x08,0x00,0x0f,0x00,0x00,0x00,0x06,
+0x73,0x79,0x6d,0x62,0x6f,0x6c,0x00,0x00,0x0d,0x09,0x00,0x10,0x00,0x00,0x00,0x04,
+0x4e,0x6f,0x6e,0x65,0x00,0x00,0x00,0x00,0x37,0x04,0x06,0x04,0x1f,0x06,0x01,0x59,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,
+0x27,0x3a,0x27,0x29,0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x03,0x00,0x00,0x00,0x07,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x0d,0x07,0x00,0x04,0x00,0x00,0x00,0x01,
+0x3a,0x00,0x00,0x00,0x37,0x05,0x06,0x02,0x1f,0x05,0x01,0x5a,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x62,0x20,0x3d,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x28,0x29,0x00,
+0x0e,0x06,0x00,0x05,0x00,0x00,0x00,0x05,0x62,0x6c,0x6f,0x63,0x6b,0x00,0x00,0x00,
+0x37,0x02,0x06,0x01,0x1f,0x10,0x01,0x5b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x74,0x65,0x6d,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x54,0x6f,0x6b,
+0x65,0x6e,0x28,0x74,0x6f,0x6b,0x2e,0x70,0x6f,0x73,0x2c,0x27,0x65,0x78,0x63,0x65,
+0x70,0x74,0x27,0x2c,0x27,0x65,0x78,0x63,0x65,0x70,0x74,0x27,0x2c,0x5b,0x61,0x2c,
+0x62,0x5d,0x29,0x29,0x00,0x00,0x00,0x00,0x0d,0x09,0x00,0x06,0x00,0x00,0x00,0x06,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x06,0x01,0x09,0x00,0x00,0x00,0x05,
+0x0e,0x09,0x00,0x0d,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x0d,0x0d,0x00,0x0e,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x0a,0x03,0x0d,
+0x00,0x00,0x00,0x06,0x0d,0x0b,0x00,0x0a,0x00,0x00,0x00,0x06,0x65,0x78,0x63,0x65,
+0x70,0x74,0x00,0x00,0x0d,0x0c,0x00,0x0a,0x00,0x00,0x00,0x06,0x65,0x78,0x63,0x65,
+0x70,0x74,0x00,0x00,0x10,0x0d,0x04,0x00,0x10,0x0e,0x02,0x00,0x1c,0x0d,0x0d,0x02,
+0x37,0x08,0x09,0x05,0x39,0x05,0x06,0x03,0x13,0x00,0xff,0x34,0x1f,0x04,0x01,0x63,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x00,0x00,0x00,0x00,
+0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x23,0x00,0x37,0x00,0x00,0x00,0x07,
+0x74,0x72,0x79,0x5f,0x6e,0x75,0x64,0x00,0x0f,0x23,0x22,0x00,0x1f,0x05,0x01,0x64,
+0x64,0x65,0x66,0x20,0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,0x75,0x64,0x28,0x74,
+0x29,0x3a,0x00,0x00,0x33,0x23,0x00,0x05,0x2a,0x24,0x32,0x38,0x32,0x00,0x00,0x00,
+0x0d,0x28,0x00,0x09,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x1c,0x24,0x28,0x01,
+0x1c,0x25,0x00,0x00,0x1d,0x26,0x00,0x00,0x1d,0x27,0x00,0x00,0x11,0x23,0x00,0x44,
+0x2d,0x04,0x00,0x05,0x00,0x00,0x00,0x01,0x1f,0x05,0x01,0x64,0x64,0x65,0x66,0x20,
+0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,0x75,0x64,0x28,0x74,0x29,0x3a,0x00,0x00,
+0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x18,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x0a,0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,
+0x75,0x64,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x04,0x01,0x67,0x20,0x20,0x20,0x20,
+0x62,0x70,0x20,0x3d,0x20,0x74,0x2e,0x62,0x70,0x00,0x00,0x00,0x33,0x01,0x00,0x02,
+0x62,0x70,0x00,0x00,0x0d,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x62,0x70,0x00,0x00,
+0x09,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x1f,0x08,0x01,0x68,0x20,0x20,0x20,0x20,
+0x74,0x2e,0x69,0x74,0x65,0x6d,0x73,0x20,0x3d,0x20,0x5b,0x65,0x78,0x70,0x72,0x65,
+0x73,0x73,0x69,0x6f,0x6e,0x28,0x62,0x70,0x29,0x5d,0x00,0x00,0x0e,0x02,0x00,0x03,
+0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,0x6f,0x6e,0x00,0x00,
+0x10,0x03,0x01,0x00,0x37,0x01,0x02,0x02,0x1c,0x02,0x01,0x01,0x0d,0x01,0x00,0x04,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x0b,0x00,0x01,0x02,
+0x1f,0x04,0x01,0x69,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,
+0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x24,0x00,0x38,
+0x00,0x00,0x00,0x0a,0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,0x75,0x64,0x00,0x00,
+0x0f,0x24,0x23,0x00,0x1f,0x05,0x01,0x6a,0x64,0x65,0x66,0x20,0x70,0x72,0x65,0x66,
+0x69,0x78,0x5f,0x6e,0x75,0x64,0x30,0x28,0x74,0x29,0x3a,0x00,0x33,0x24,0x00,0x05,
+0x2a,0x24,0x32,0x38,0x39,0x00,0x00,0x00,0x0d,0x29,0x00,0x09,0x00,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x1c,0x25,0x29,0x01,0x1c,0x26,0x00,0x00,0x1d,0x27,0x00,0x00,
+0x1d,0x28,0x00,0x00,0x11,0x24,0x00,0x59,0x2d,0x07,0x00,0x0a,0x00,0x00,0x00,0x01,
+0x1f,0x05,0x01,0x6a,0x64,0x65,0x66,0x20,0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,
+0x75,0x64,0x30,0x28,0x74,0x29,0x3a,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,
+0x00,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x0b,
+0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,0x75,0x64,0x30,0x00,0x23,0x01,0x00,0x00,
+0x1f,0x0e,0x01,0x6b,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x63,0x68,0x65,0x63,0x6b,
+0x28,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x2c,0x27,0x6e,0x6c,0x27,0x2c,0x27,0x3b,
+0x27,0x2c,0x27,0x65,0x6f,0x66,0x27,0x2c,0x27,0x64,0x65,0x64,0x65,0x6e,0x74,0x27,
+0x29,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x00,0x0e,0x01,0x00,0x02,
+0x00,0x00,0x00,0x05,0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,0x0e,0x02,0x00,0x03,
+0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x0d,0x03,0x00,0x04,0x00,0x00,0x00,0x05,
+0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x09,0x02,0x02,0x03,0x00,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x05,0x00,0x00,0x00,0x02,0x6e,0x6c,0x00,0x00,0x0d,0x04,0x00,0x06,
+0x00,0x00,0x00,0x01,0x3b,0x00,0x00,0x00,0x0d,0x05,0x00,0x07,0x00,0x00,0x00,0x03,
+0x65,0x6f,0x66,0x00,0x0d,0x06,0x00,0x08,0x00,0x00,0x00,0x06,0x64,0x65,0x64,0x65,
+0x6e,0x74,0x00,0x00,0x37,0x01,0x01,0x06,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x02,
+0x15,0x00,0x00,0x00,0x1f,0x07,0x01,0x6c,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,0x75,0x64,0x28,0x74,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x01,0x00,0x09,0x00,0x00,0x00,0x0a,0x70,0x72,0x65,0x66,
+0x69,0x78,0x5f,0x6e,0x75,0x64,0x00,0x00,0x10,0x02,0x00,0x00,0x37,0x01,0x01,0x02,
+0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x25,0x00,0x39,0x00,0x00,0x00,0x0b,
+0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,0x75,0x64,0x30,0x00,0x0f,0x25,0x24,0x00,
+0x1f,0x05,0x01,0x6d,0x64,0x65,0x66,0x20,0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,
+0x75,0x64,0x73,0x28,0x74,0x29,0x3a,0x00,0x33,0x25,0x00,0x05,0x2a,0x24,0x32,0x39,
+0x36,0x00,0x00,0x00,0x0d,0x2a,0x00,0x09,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x1c,0x26,0x2a,0x01,0x1c,0x27,0x00,0x00,0x1d,0x28,0x00,0x00,0x1d,0x29,0x00,0x00,
+0x11,0x25,0x00,0x43,0x2d,0x05,0x00,0x06,0x00,0x00,0x00,0x01,0x1f,0x05,0x01,0x6d,
+0x64,0x65,0x66,0x20,0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,0x75,0x64,0x73,0x28,
+0x74,0x29,0x3a,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x0b,0x70,0x72,0x65,0x66,
+0x69,0x78,0x5f,0x6e,0x75,0x64,0x73,0x00,0x23,0x01,0x00,0x00,0x1f,0x06,0x01,0x6e,
+0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,
+0x6f,0x6e,0x28,0x30,0x29,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x72,0x00,0x00,0x00,
+0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x72,0x65,0x73,0x73,0x69,
+0x6f,0x6e,0x00,0x00,0x0c,0x03,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x37,0x01,0x02,0x02,0x1f,0x07,0x01,0x6f,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x69,0x6c,0x73,0x74,0x28,0x74,0x2e,0x74,0x79,0x70,0x65,0x2c,0x72,
+0x29,0x00,0x00,0x00,0x0e,0x02,0x00,0x04,0x00,0x00,0x00,0x04,0x69,0x6c,0x73,0x74,
+0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x05,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,
+0x00,0x00,0x00,0x00,0x09,0x03,0x00,0x03,0x00,0x00,0x00,0x00,0x10,0x04,0x01,0x00,
+0x37,0x00,0x02,0x03,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x26,0x00,0x3a,
+0x00,0x00,0x00,0x0b,0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,0x75,0x64,0x73,0x00,
+0x0f,0x26,0x25,0x00,0x1f,0x05,0x01,0x71,0x64,0x65,0x66,0x20,0x70,0x72,0x65,0x66,
+0x69,0x78,0x5f,0x6e,0x65,0x67,0x28,0x74,0x29,0x3a,0x00,0x00,0x33,0x26,0x00,0x05,
+0x2a,0x24,0x33,0x30,0x33,0x00,0x00,0x00,0x0d,0x2b,0x00,0x09,0x00,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x1c,0x27,0x2b,0x01,0x1c,0x28,0x00,0x00,0x1d,0x29,0x00,0x00,
+0x1d,0x2a,0x00,0x00,0x11,0x26,0x00,0xd0,0x2d,0x08,0x00,0x0f,0x00,0x00,0x00,0x05,
+0x1f,0x05,0x01,0x71,0x64,0x65,0x66,0x20,0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,
+0x65,0x67,0x28,0x74,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,
+0x00,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x0a,
+0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,0x65,0x67,0x00,0x00,0x23,0x01,0x00,0x00,
+0x1f,0x06,0x01,0x72,0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x65,0x78,0x70,0x72,
+0x65,0x73,0x73,0x69,0x6f,0x6e,0x28,0x35,0x30,0x29,0x00,0x00,0x33,0x01,0x00,0x01,
+0x72,0x00,0x00,0x00,0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x0a,0x65,0x78,0x70,0x72,
+0x65,0x73,0x73,0x69,0x6f,0x6e,0x00,0x00,0x0c,0x03,0x00,0x03,0x00,0x00,0x69,0x04,
+0x32,0x00,0x00,0x00,0x37,0x01,0x02,0x02,0x1f,0x07,0x01,0x73,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x72,0x2e,0x74,0x79,0x70,0x65,0x20,0x3d,0x3d,0x20,0x27,0x66,0x6c,
+0x6f,0x61,0x74,0x27,0x3a,0x00,0x00,0x00,0x0d,0x02,0x00,0x04,0x00,0x00,0x00,0x04,
+0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x09,0x03,0x01,0x02,0x00,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x05,0x00,0x00,0x00,0x05,0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,0x00,
+0x18,0x03,0x03,0x02,0x16,0x03,0x00,0x00,0x13,0x00,0x00,0x28,0x1f,0x09,0x01,0x74,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x2e,0x76,0x61,0x6c,0x20,0x3d,0x20,
+0x73,0x74,0x72,0x28,0x2d,0x66,0x6c,0x6f,0x61,0x74,0x28,0x72,0x2e,0x76,0x61,0x6c,
+0x29,0x29,0x00,0x00,0x0e,0x02,0x00,0x06,0x00,0x00,0x00,0x03,0x73,0x74,0x72,0x00,
+0x0c,0x03,0x00,0x07,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x05,
+0x00,0x00,0x00,0x05,0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,0x00,0x0d,0x07,0x00,0x08,
+0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x09,0x06,0x01,0x07,0x00,0x00,0x00,0x01,
+0x37,0x04,0x05,0x02,0x02,0x03,0x03,0x04,0x37,0x03,0x02,0x02,0x0d,0x02,0x00,0x08,
+0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x0b,0x01,0x02,0x03,0x1f,0x05,0x01,0x75,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,
+0x00,0x00,0x00,0x00,0x15,0x01,0x00,0x00,0x1f,0x07,0x01,0x76,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x72,0x2e,0x74,0x79,0x70,0x65,0x20,0x3d,0x3d,0x20,0x27,0x69,0x6e,
+0x74,0x65,0x67,0x65,0x72,0x27,0x3a,0x00,0x0d,0x02,0x00,0x04,0x00,0x00,0x00,0x04,
+0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x09,0x03,0x01,0x02,0x00,0x00,0x00,0x02,
+0x0d,0x02,0x00,0x09,0x00,0x00,0x00,0x07,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x00,
+0x18,0x03,0x03,0x02,0x16,0x03,0x00,0x00,0x13,0x00,0x00,0x27,0x1f,0x09,0x01,0x77,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x2e,0x76,0x61,0x6c,0x20,0x3d,0x20,
+0x73,0x74,0x72,0x28,0x2d,0x69,0x6e,0x74,0x28,0x72,0x2e,0x76,0x61,0x6c,0x29,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x06,0x00,0x00,0x00,0x03,0x73,0x74,0x72,0x00,
+0x0c,0x03,0x00,0x07,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x0a,
+0x00,0x00,0x00,0x03,0x69,0x6e,0x74,0x00,0x0d,0x07,0x00,0x08,0x00,0x00,0x00,0x03,
+0x76,0x61,0x6c,0x00,0x09,0x06,0x01,0x07,0x00,0x00,0x00,0x03,0x37,0x04,0x05,0x02,
+0x02,0x03,0x03,0x04,0x37,0x03,0x02,0x02,0x0d,0x02,0x00,0x08,0x00,0x00,0x00,0x03,
+0x76,0x61,0x6c,0x00,0x0b,0x01,0x02,0x03,0x1f,0x05,0x01,0x78,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,
+0x15,0x01,0x00,0x00,0x1f,0x0c,0x01,0x79,0x20,0x20,0x20,0x20,0x74,0x2e,0x69,0x74,
+0x65,0x6d,0x73,0x20,0x3d,0x20,0x5b,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x2e,0x70,
+0x6f,0x73,0x2c,0x27,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x27,0x2c,0x27,0x30,0x27,
+0x29,0x2c,0x72,0x5d,0x00,0x00,0x00,0x00,0x0e,0x04,0x00,0x0b,0x00,0x00,0x00,0x05,
+0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0d,0x02,0x00,0x0c,0x00,0x00,0x00,0x03,
+0x70,0x6f,0x73,0x00,0x09,0x05,0x00,0x02,0x00,0x00,0x00,0x04,0x0d,0x06,0x00,0x09,
+0x00,0x00,0x00,0x07,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x00,0x0d,0x07,0x00,0x0d,
+0x00,0x00,0x00,0x01,0x30,0x00,0x00,0x00,0x37,0x02,0x04,0x04,0x10,0x03,0x01,0x00,
+0x1c,0x03,0x02,0x02,0x0d,0x02,0x00,0x0e,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x0b,0x00,0x02,0x03,0x1f,0x04,0x01,0x7a,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x27,0x00,0x3b,0x00,0x00,0x00,0x0a,0x70,0x72,0x65,0x66,
+0x69,0x78,0x5f,0x6e,0x65,0x67,0x00,0x00,0x0f,0x27,0x26,0x00,0x1f,0x05,0x01,0x7b,
+0x64,0x65,0x66,0x20,0x6c,0x61,0x72,0x67,0x73,0x5f,0x6e,0x75,0x64,0x28,0x74,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x27,0x00,0x05,0x2a,0x24,0x33,0x31,0x30,0x00,0x00,0x00,
+0x0d,0x2c,0x00,0x09,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x1c,0x28,0x2c,0x01,
+0x1c,0x29,0x00,0x00,0x1d,0x2a,0x00,0x00,0x1d,0x2b,0x00,0x00,0x11,0x27,0x00,0x4e,
+0x2d,0x03,0x00,0x07,0x00,0x00,0x00,0x00,0x1f,0x05,0x01,0x7b,0x64,0x65,0x66,0x20,
+0x6c,0x61,0x72,0x67,0x73,0x5f,0x6e,0x75,0x64,0x28,0x74,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x18,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x09,0x6c,0x61,0x72,0x67,0x73,0x5f,0x6e,0x75,
+0x64,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x06,0x01,0x7c,0x20,0x20,0x20,0x20,
+0x72,0x20,0x3d,0x20,0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,0x75,0x64,0x28,0x74,
+0x29,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x72,0x00,0x00,0x00,0x0e,0x01,0x00,0x02,
+0x00,0x00,0x00,0x0a,0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,0x75,0x64,0x00,0x00,
+0x10,0x02,0x00,0x00,0x37,0x01,0x01,0x02,0x1f,0x06,0x01,0x7d,0x20,0x20,0x20,0x20,
+0x74,0x2e,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x27,0x6c,0x61,0x72,0x67,0x73,0x27,
+0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x05,0x6c,0x61,0x72,0x67,
+0x73,0x00,0x00,0x00,0x0d,0x01,0x00,0x04,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,
+0x00,0x00,0x00,0x00,0x0b,0x00,0x01,0x02,0x1f,0x04,0x01,0x7e,0x20,0x20,0x20,0x20,
+0x74,0x2e,0x76,0x61,0x6c,0x20,0x3d,0x20,0x27,0x2a,0x27,0x00,0x0d,0x02,0x00,0x05,
+0x00,0x00,0x00,0x01,0x2a,0x00,0x00,0x00,0x0d,0x01,0x00,0x06,0x00,0x00,0x00,0x03,
+0x76,0x61,0x6c,0x00,0x0b,0x00,0x01,0x02,0x1f,0x04,0x01,0x7f,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x28,0x00,0x3c,0x00,0x00,0x00,0x09,0x6c,0x61,0x72,0x67,
+0x73,0x5f,0x6e,0x75,0x64,0x00,0x00,0x00,0x0f,0x28,0x27,0x00,0x1f,0x05,0x01,0x80,
+0x64,0x65,0x66,0x20,0x64,0x61,0x72,0x67,0x73,0x5f,0x6e,0x75,0x64,0x28,0x74,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x28,0x00,0x05,0x2a,0x24,0x33,0x31,0x37,0x00,0x00,0x00,
+0x0d,0x2d,0x00,0x09,0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x1c,0x29,0x2d,0x01,
+0x1c,0x2a,0x00,0x00,0x1d,0x2b,0x00,0x00,0x1d,0x2c,0x00,0x00,0x11,0x28,0x00,0x4f,
+0x2d,0x03,0x00,0x07,0x00,0x00,0x00,0x00,0x1f,0x05,0x01,0x80,0x64,0x65,0x66,0x20,
+0x64,0x61,0x72,0x67,0x73,0x5f,0x6e,0x75,0x64,0x28,0x74,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x18,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x09,0x64,0x61,0x72,0x67,0x73,0x5f,0x6e,0x75,
+0x64,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x06,0x01,0x81,0x20,0x20,0x20,0x20,
+0x72,0x20,0x3d,0x20,0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,0x75,0x64,0x28,0x74,
+0x29,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x72,0x00,0x00,0x00,0x0e,0x01,0x00,0x02,
+0x00,0x00,0x00,0x0a,0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,0x75,0x64,0x00,0x00,
+0x10,0x02,0x00,0x00,0x37,0x01,0x01,0x02,0x1f,0x06,0x01,0x82,0x20,0x20,0x20,0x20,
+0x74,0x2e,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x27,0x64,0x61,0x72,0x67,0x73,0x27,
+0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x05,0x64,0x61,0x72,0x67,
+0x73,0x00,0x00,0x00,0x0d,0x01,0x00,0x04,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,
+0x00,0x00,0x00,0x00,0x0b,0x00,0x01,0x02,0x1f,0x05,0x01,0x83,0x20,0x20,0x20,0x20,
+0x74,0x2e,0x76,0x61,0x6c,0x20,0x3d,0x20,0x27,0x2a,0x2a,0x27,0x00,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x05,0x00,0x00,0x00,0x02,0x2a,0x2a,0x00,0x00,0x0d,0x01,0x00,0x06,
+0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x0b,0x00,0x01,0x02,0x1f,0x04,0x01,0x84,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x00,0x00,0x00,0x00,
+0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x29,0x00,0x3d,0x00,0x00,0x00,0x09,
+0x64,0x61,0x72,0x67,0x73,0x5f,0x6e,0x75,0x64,0x00,0x00,0x00,0x0f,0x29,0x28,0x00,
+0x1f,0x04,0x01,0x87,0x62,0x61,0x73,0x65,0x5f,0x64,0x6d,0x61,0x70,0x20,0x3d,0x20,
+0x7b,0x00,0x00,0x00,0x0d,0x29,0x00,0x3e,0x00,0x00,0x00,0x09,0x62,0x61,0x73,0x65,
+0x5f,0x64,0x6d,0x61,0x70,0x00,0x00,0x00,0x1f,0x0c,0x01,0x88,0x20,0x20,0x20,0x20,
+0x27,0x2c,0x27,0x3a,0x7b,0x27,0x6c,0x62,0x70,0x27,0x3a,0x32,0x30,0x2c,0x27,0x62,
+0x70,0x27,0x3a,0x32,0x30,0x2c,0x27,0x6c,0x65,0x64,0x27,0x3a,0x69,0x6e,0x66,0x69,
+0x78,0x5f,0x74,0x75,0x70,0x6c,0x65,0x7d,0x2c,0x00,0x00,0x00,0x0d,0x2b,0x00,0x3f,
+0x00,0x00,0x00,0x01,0x2c,0x00,0x00,0x00,0x0d,0x01,0x00,0x40,0x00,0x00,0x00,0x03,
+0x6c,0x62,0x70,0x00,0x0c,0x02,0x00,0x41,0x00,0x00,0x69,0x04,0x14,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x42,0x00,0x00,0x00,0x02,0x62,0x70,0x00,0x00,0x0c,0x04,0x00,0x41,
+0x00,0x00,0x69,0x04,0x14,0x00,0x00,0x00,0x0d,0x05,0x00,0x19,0x00,0x00,0x00,0x03,
+0x6c,0x65,0x64,0x00,0x0e,0x06,0x00,0x21,0x00,0x00,0x00,0x0b,0x69,0x6e,0x66,0x69,
+0x78,0x5f,0x74,0x75,0x70,0x6c,0x65,0x00,0x1b,0x2c,0x01,0x06,0x1f,0x0b,0x01,0x89,
+0x20,0x20,0x20,0x20,0x27,0x2b,0x27,0x3a,0x7b,0x27,0x6c,0x62,0x70,0x27,0x3a,0x35,
+0x30,0x2c,0x27,0x62,0x70,0x27,0x3a,0x35,0x30,0x2c,0x27,0x6c,0x65,0x64,0x27,0x3a,
+0x69,0x6e,0x66,0x69,0x78,0x5f,0x6c,0x65,0x64,0x7d,0x2c,0x00,0x0d,0x2d,0x00,0x43,
+0x00,0x00,0x00,0x01,0x2b,0x00,0x00,0x00,0x0d,0x01,0x00,0x40,0x00,0x00,0x00,0x03,
+0x6c,0x62,0x70,0x00,0x0c,0x02,0x00,0x44,0x00,0x00,0x69,0x04,0x32,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x42,0x00,0x00,0x00,0x02,0x62,0x70,0x00,0x00,0x0c,0x04,0x00,0x44,
+0x00,0x00,0x69,0x04,0x32,0x00,0x00,0x00,0x0d,0x05,0x00,0x19,0x00,0x00,0x00,0x03,
+0x6c,0x65,0x64,0x00,0x0e,0x06,0x00,0x1e,0x00,0x00,0x00,0x09,0x69,0x6e,0x66,0x69,
+0x78,0x5f,0x6c,0x65,0x64,0x00,0x00,0x00,0x1b,0x2e,0x01,0x06,0x1f,0x09,0x01,0x8a,
+0x20,0x20,0x20,0x20,0x27,0x2d,0x27,0x3a,0x7b,0x27,0x6c,0x62,0x70,0x27,0x3a,0x35,
+0x30,0x2c,0x27,0x6e,0x75,0x64,0x27,0x3a,0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,
+0x65,0x67,0x2c,0x00,0x0d,0x2f,0x00,0x45,0x00,0x00,0x00,0x01,0x2d,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x40,0x00,0x00,0x00,0x03,0x6c,0x62,0x70,0x00,0x0c,0x02,0x00,0x44,
+0x00,0x00,0x69,0x04,0x32,0x00,0x00,0x00,0x0d,0x03,0x00,0x17,0x00,0x00,0x00,0x03,
+0x6e,0x75,0x64,0x00,0x0e,0x04,0x00,0x3b,0x00,0x00,0x00,0x0a,0x70,0x72,0x65,0x66,
+0x69,0x78,0x5f,0x6e,0x65,0x67,0x00,0x00,0x1f,0x09,0x01,0x8b,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x27,0x62,0x70,0x27,0x3a,0x35,0x30,0x2c,0x27,0x6c,0x65,0x64,
+0x27,0x3a,0x69,0x6e,0x66,0x69,0x78,0x5f,0x6c,0x65,0x64,0x7d,0x2c,0x00,0x00,0x00,
+0x0d,0x05,0x00,0x42,0x00,0x00,0x00,0x02,0x62,0x70,0x00,0x00,0x0c,0x06,0x00,0x44,
+0x00,0x00,0x69,0x04,0x32,0x00,0x00,0x00,0x0d,0x07,0x00,0x19,0x00,0x00,0x00,0x03,
+0x6c,0x65,0x64,0x00,0x0e,0x08,0x00,0x1e,0x00,0x00,0x00,0x09,0x69,0x6e,0x66,0x69,
+0x78,0x5f,0x6c,0x65,0x64,0x00,0x00,0x00,0x1b,0x30,0x01,0x08,0x1f,0x0c,0x01,0x8c,
+0x20,0x20,0x20,0x20,0x27,0x6e,0x6f,0x74,0x27,0x3a,0x7b,0x27,0x6c,0x62,0x70,0x27,
+0x3a,0x33,0x35,0x2c,0x27,0x6e,0x75,0x64,0x27,0x3a,0x70,0x72,0x65,0x66,0x69,0x78,
+0x5f,0x6e,0x75,0x64,0x2c,0x27,0x62,0x70,0x27,0x3a,0x33,0x35,0x2c,0x00,0x00,0x00,
+0x0d,0x31,0x00,0x46,0x00,0x00,0x00,0x03,0x6e,0x6f,0x74,0x00,0x0d,0x01,0x00,0x40,
+0x00,0x00,0x00,0x03,0x6c,0x62,0x70,0x00,0x0c,0x02,0x00,0x47,0x00,0x00,0x69,0x04,
+0x23,0x00,0x00,0x00,0x0d,0x03,0x00,0x17,0x00,0x00,0x00,0x03,0x6e,0x75,0x64,0x00,
+0x0e,0x04,0x00,0x38,0x00,0x00,0x00,0x0a,0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,
+0x75,0x64,0x00,0x00,0x0d,0x05,0x00,0x42,0x00,0x00,0x00,0x02,0x62,0x70,0x00,0x00,
+0x0c,0x06,0x00,0x47,0x00,0x00,0x69,0x04,0x23,0x00,0x00,0x00,0x1f,0x09,0x01,0x8d,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x27,0x62,0x70,0x27,0x3a,0x33,0x35,0x2c,
+0x27,0x6c,0x65,0x64,0x27,0x3a,0x69,0x6e,0x66,0x69,0x78,0x5f,0x6e,0x6f,0x74,0x20,
+0x7d,0x2c,0x00,0x00,0x0d,0x07,0x00,0x42,0x00,0x00,0x00,0x02,0x62,0x70,0x00,0x00,
+0x0c,0x08,0x00,0x47,0x00,0x00,0x69,0x04,0x23,0x00,0x00,0x00,0x0d,0x09,0x00,0x19,
+0x00,0x00,0x00,0x03,0x6c,0x65,0x64,0x00,0x0e,0x0a,0x00,0x20,0x00,0x00,0x00,0x09,
+0x69,0x6e,0x66,0x69,0x78,0x5f,0x6e,0x6f,0x74,0x00,0x00,0x00,0x1b,0x32,0x01,0x0a,
+0x1f,0x0b,0x01,0x8e,0x20,0x20,0x20,0x20,0x27,0x25,0x27,0x3a,0x7b,0x27,0x6c,0x62,
+0x70,0x27,0x3a,0x36,0x30,0x2c,0x27,0x62,0x70,0x27,0x3a,0x36,0x30,0x2c,0x27,0x6c,
+0x65,0x64,0x27,0x3a,0x69,0x6e,0x66,0x69,0x78,0x5f,0x6c,0x65,0x64,0x7d,0x2c,0x00,
+0x0d,0x33,0x00,0x48,0x00,0x00,0x00,0x01,0x25,0x00,0x00,0x00,0x0d,0x01,0x00,0x40,
+0x00,0x00,0x00,0x03,0x6c,0x62,0x70,0x00,0x0c,0x02,0x00,0x49,0x00,0x00,0x69,0x04,
+0x3c,0x00,0x00,0x00,0x0d,0x03,0x00,0x42,0x00,0x00,0x00,0x02,0x62,0x70,0x00,0x00,
+0x0c,0x04,0x00,0x49,0x00,0x00,0x69,0x04,0x3c,0x00,0x00,0x00,0x0d,0x05,0x00,0x19,
+0x00,0x00,0x00,0x03,0x6c,0x65,0x64,0x00,0x0e,0x06,0x00,0x1e,0x00,0x00,0x00,0x09,
+0x69,0x6e,0x66,0x69,0x78,0x5f,0x6c,0x65,0x64,0x00,0x00,0x00,0x1b,0x34,0x01,0x06,
+0x1f,0x09,0x01,0x8f,0x20,0x20,0x20,0x20,0x27,0x2a,0x27,0x3a,0x7b,0x27,0x6c,0x62,
+0x70,0x27,0x3a,0x36,0x30,0x2c,0x27,0x6e,0x75,0x64,0x27,0x3a,0x6c,0x61,0x72,0x67,
+0x73,0x5f,0x6e,0x75,0x64,0x2c,0x00,0x00,0x0d,0x35,0x00,0x08,0x00,0x00,0x00,0x01,
+0x2a,0x00,0x00,0x00,0x0d,0x01,0x00,0x40,0x00,0x00,0x00,0x03,0x6c,0x62,0x70,0x00,
+0x0c,0x02,0x00,0x49,0x00,0x00,0x69,0x04,0x3c,0x00,0x00,0x00,0x0d,0x03,0x00,0x17,
+0x00,0x00,0x00,0x03,0x6e,0x75,0x64,0x00,0x0e,0x04,0x00,0x3c,0x00,0x00,0x00,0x09,
+0x6c,0x61,0x72,0x67,0x73,0x5f,0x6e,0x75,0x64,0x00,0x00,0x00,0x1f,0x09,0x01,0x90,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x27,0x62,0x70,0x27,0x3a,0x36,0x30,0x2c,
+0x27,0x6c,0x65,0x64,0x27,0x3a,0x69,0x6e,0x66,0x69,0x78,0x5f,0x6c,0x65,0x64,0x2c,
+0x7d,0x2c,0x00,0x00,0x0d,0x05,0x00,0x42,0x00,0x00,0x00,0x02,0x62,0x70,0x00,0x00,
+0x0c,0x06,0x00,0x49,0x00,0x00,0x69,0x04,0x3c,0x00,0x00,0x00,0x0d,0x07,0x00,0x19,
+0x00,0x00,0x00,0x03,0x6c,0x65,0x64,0x00,0x0e,0x08,0x00,0x1e,0x00,0x00,0x00,0x09,
+0x69,0x6e,0x66,0x69,0x78,0x5f,0x6c,0x65,0x64,0x00,0x00,0x00,0x1b,0x36,0x01,0x08,
+0x1f,0x0a,0x01,0x91,0x20,0x20,0x20,0x20,0x27,0x2a,0x2a,0x27,0x3a,0x20,0x7b,0x27,
+0x6c,0x62,0x70,0x27,0x3a,0x36,0x35,0x2c,0x27,0x6e,0x75,0x64,0x27,0x3a,0x64,0x61,
+0x72,0x67,0x73,0x5f,0x6e,0x75,0x64,0x2c,0x00,0x00,0x00,0x00,0x0d,0x37,0x00,0x4a,
+0x00,0x00,0x00,0x02,0x2a,0x2a,0x00,0x00,0x0d,0x01,0x00,0x40,0x00,0x00,0x00,0x03,
+0x6c,0x62,0x70,0x00,0x0c,0x02,0x00,0x4b,0x00,0x00,0x69,0x04,0x41,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x17,0x00,0x00,0x00,0x03,0x6e,0x75,0x64,0x00,0x0e,0x04,0x00,0x3d,
+0x00,0x00,0x00,0x09,0x64,0x61,0x72,0x67,0x73,0x5f,0x6e,0x75,0x64,0x00,0x00,0x00,
+0x1f,0x09,0x01,0x92,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x27,0x62,0x70,0x27,
+0x3a,0x36,0x35,0x2c,0x27,0x6c,0x65,0x64,0x27,0x3a,0x69,0x6e,0x66,0x69,0x78,0x5f,
+0x6c,0x65,0x64,0x2c,0x7d,0x2c,0x00,0x00,0x0d,0x05,0x00,0x42,0x00,0x00,0x00,0x02,
+0x62,0x70,0x00,0x00,0x0c,0x06,0x00,0x4b,0x00,0x00,0x69,0x04,0x41,0x00,0x00,0x00,
+0x0d,0x07,0x00,0x19,0x00,0x00,0x00,0x03,0x6c,0x65,0x64,0x00,0x0e,0x08,0x00,0x1e,
+0x00,0x00,0x00,0x09,0x69,0x6e,0x66,0x69,0x78,0x5f,0x6c,0x65,0x64,0x00,0x00,0x00,
+0x1b,0x38,0x01,0x08,0x1f,0x0b,0x01,0x93,0x20,0x20,0x20,0x20,0x27,0x2f,0x27,0x3a,
+0x7b,0x27,0x6c,0x62,0x70,0x27,0x3a,0x36,0x30,0x2c,0x27,0x62,0x70,0x27,0x3a,0x36,
+0x30,0x2c,0x27,0x6c,0x65,0x64,0x27,0x3a,0x69,0x6e,0x66,0x69,0x78,0x5f,0x6c,0x65,
+0x64,0x7d,0x2c,0x00,0x0d,0x39,0x00,0x4c,0x00,0x00,0x00,0x01,0x2f,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x40,0x00,0x00,0x00,0x03,0x6c,0x62,0x70,0x00,0x0c,0x02,0x00,0x49,
+0x00,0x00,0x69,0x04,0x3c,0x00,0x00,0x00,0x0d,0x03,0x00,0x42,0x00,0x00,0x00,0x02,
+0x62,0x70,0x00,0x00,0x0c,0x04,0x00,0x49,0x00,0x00,0x69,0x04,0x3c,0x00,0x00,0x00,
+0x0d,0x05,0x00,0x19,0x00,0x00,0x00,0x03,0x6c,0x65,0x64,0x00,0x0e,0x06,0x00,0x1e,
+0x00,0x00,0x00,0x09,0x69,0x6e,0x66,0x69,0x78,0x5f,0x6c,0x65,0x64,0x00,0x00,0x00,
+0x1b,0x3a,0x01,0x06,0x1f,0x09,0x01,0x94,0x20,0x20,0x20,0x20,0x27,0x28,0x27,0x3a,
+0x7b,0x27,0x6c,0x62,0x70,0x27,0x3a,0x37,0x30,0x2c,0x27,0x6e,0x75,0x64,0x27,0x3a,
+0x70,0x61,0x72,0x65,0x6e,0x5f,0x6e,0x75,0x64,0x2c,0x00,0x00,0x0d,0x3b,0x00,0x4d,
+0x00,0x00,0x00,0x01,0x28,0x00,0x00,0x00,0x0d,0x01,0x00,0x40,0x00,0x00,0x00,0x03,
+0x6c,0x62,0x70,0x00,0x0c,0x02,0x00,0x4e,0x00,0x00,0x69,0x04,0x46,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x17,0x00,0x00,0x00,0x03,0x6e,0x75,0x64,0x00,0x0e,0x04,0x00,0x29,
+0x00,0x00,0x00,0x09,0x70,0x61,0x72,0x65,0x6e,0x5f,0x6e,0x75,0x64,0x00,0x00,0x00,
+0x1f,0x09,0x01,0x95,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x27,0x62,0x70,0x27,
+0x3a,0x38,0x30,0x2c,0x27,0x6c,0x65,0x64,0x27,0x3a,0x63,0x61,0x6c,0x6c,0x5f,0x6c,
+0x65,0x64,0x2c,0x7d,0x2c,0x00,0x00,0x00,0x0d,0x05,0x00,0x42,0x00,0x00,0x00,0x02,
+0x62,0x70,0x00,0x00,0x0c,0x06,0x00,0x4f,0x00,0x00,0x69,0x04,0x50,0x00,0x00,0x00,
+0x0d,0x07,0x00,0x19,0x00,0x00,0x00,0x03,0x6c,0x65,0x64,0x00,0x0e,0x08,0x00,0x25,
+0x00,0x00,0x00,0x08,0x63,0x61,0x6c,0x6c,0x5f,0x6c,0x65,0x64,0x00,0x00,0x00,0x00,
+0x1b,0x3c,0x01,0x08,0x1f,0x09,0x01,0x96,0x20,0x20,0x20,0x20,0x27,0x5b,0x27,0x3a,
+0x7b,0x27,0x6c,0x62,0x70,0x27,0x3a,0x37,0x30,0x2c,0x27,0x6e,0x75,0x64,0x27,0x3a,
+0x6c,0x69,0x73,0x74,0x5f,0x6e,0x75,0x64,0x2c,0x00,0x00,0x00,0x0d,0x3d,0x00,0x50,
+0x00,0x00,0x00,0x01,0x5b,0x00,0x00,0x00,0x0d,0x01,0x00,0x40,0x00,0x00,0x00,0x03,
+0x6c,0x62,0x70,0x00,0x0c,0x02,0x00,0x4e,0x00,0x00,0x69,0x04,0x46,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x17,0x00,0x00,0x00,0x03,0x6e,0x75,0x64,0x00,0x0e,0x04,0x00,0x2a,
+0x00,0x00,0x00,0x08,0x6c,0x69,0x73,0x74,0x5f,0x6e,0x75,0x64,0x00,0x00,0x00,0x00,
+0x1f,0x09,0x01,0x97,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x27,0x62,0x70,0x27,
+0x3a,0x38,0x30,0x2c,0x27,0x6c,0x65,0x64,0x27,0x3a,0x67,0x65,0x74,0x5f,0x6c,0x65,
+0x64,0x2c,0x7d,0x2c,0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x42,0x00,0x00,0x00,0x02,
+0x62,0x70,0x00,0x00,0x0c,0x06,0x00,0x4f,0x00,0x00,0x69,0x04,0x50,0x00,0x00,0x00,
+0x0d,0x07,0x00,0x19,0x00,0x00,0x00,0x03,0x6c,0x65,0x64,0x00,0x0e,0x08,0x00,0x26,
+0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,0x6c,0x65,0x64,0x00,0x1b,0x3e,0x01,0x08,
+0x1f,0x09,0x01,0x98,0x20,0x20,0x20,0x20,0x27,0x7b,0x27,0x3a,0x7b,0x27,0x6c,0x62,
+0x70,0x27,0x3a,0x30,0x2c,0x27,0x6e,0x75,0x64,0x27,0x3a,0x64,0x69,0x63,0x74,0x5f,
+0x6e,0x75,0x64,0x2c,0x7d,0x2c,0x00,0x00,0x0d,0x3f,0x00,0x51,0x00,0x00,0x00,0x01,
+0x7b,0x00,0x00,0x00,0x0d,0x01,0x00,0x40,0x00,0x00,0x00,0x03,0x6c,0x62,0x70,0x00,
+0x0c,0x02,0x00,0x52,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x17,
+0x00,0x00,0x00,0x03,0x6e,0x75,0x64,0x00,0x0e,0x04,0x00,0x2b,0x00,0x00,0x00,0x08,
+0x64,0x69,0x63,0x74,0x5f,0x6e,0x75,0x64,0x00,0x00,0x00,0x00,0x1b,0x40,0x01,0x04,
+0x1f,0x0f,0x01,0x99,0x20,0x20,0x20,0x20,0x27,0x2e,0x27,0x3a,0x7b,0x27,0x6c,0x62,
+0x70,0x27,0x3a,0x38,0x30,0x2c,0x27,0x62,0x70,0x27,0x3a,0x38,0x30,0x2c,0x27,0x6c,
+0x65,0x64,0x27,0x3a,0x64,0x6f,0x74,0x5f,0x6c,0x65,0x64,0x2c,0x27,0x74,0x79,0x70,
+0x65,0x27,0x3a,0x27,0x6d,0x67,0x65,0x74,0x27,0x2c,0x7d,0x2c,0x00,0x00,0x00,0x00,
+0x0d,0x41,0x00,0x53,0x00,0x00,0x00,0x01,0x2e,0x00,0x00,0x00,0x0d,0x01,0x00,0x40,
+0x00,0x00,0x00,0x03,0x6c,0x62,0x70,0x00,0x0c,0x02,0x00,0x4f,0x00,0x00,0x69,0x04,
+0x50,0x00,0x00,0x00,0x0d,0x03,0x00,0x42,0x00,0x00,0x00,0x02,0x62,0x70,0x00,0x00,
+0x0c,0x04,0x00,0x4f,0x00,0x00,0x69,0x04,0x50,0x00,0x00,0x00,0x0d,0x05,0x00,0x19,
+0x00,0x00,0x00,0x03,0x6c,0x65,0x64,0x00,0x0e,0x06,0x00,0x27,0x00,0x00,0x00,0x07,
+0x64,0x6f,0x74,0x5f,0x6c,0x65,0x64,0x00,0x0d,0x07,0x00,0x54,0x00,0x00,0x00,0x04,
+0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x0d,0x08,0x00,0x55,0x00,0x00,0x00,0x04,
+0x6d,0x67,0x65,0x74,0x00,0x00,0x00,0x00,0x1b,0x42,0x01,0x08,0x1f,0x0d,0x01,0x9a,
+0x20,0x20,0x20,0x20,0x27,0x62,0x72,0x65,0x61,0x6b,0x27,0x3a,0x7b,0x27,0x6c,0x62,
+0x70,0x27,0x3a,0x30,0x2c,0x27,0x6e,0x75,0x64,0x27,0x3a,0x69,0x74,0x73,0x65,0x6c,
+0x66,0x2c,0x27,0x74,0x79,0x70,0x65,0x27,0x3a,0x27,0x62,0x72,0x65,0x61,0x6b,0x27,
+0x7d,0x2c,0x00,0x00,0x0d,0x43,0x00,0x56,0x00,0x00,0x00,0x05,0x62,0x72,0x65,0x61,
+0x6b,0x00,0x00,0x00,0x0d,0x01,0x00,0x40,0x00,0x00,0x00,0x03,0x6c,0x62,0x70,0x00,
+0x0c,0x02,0x00,0x52,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x17,
+0x00,0x00,0x00,0x03,0x6e,0x75,0x64,0x00,0x0e,0x04,0x00,0x28,0x00,0x00,0x00,0x06,
+0x69,0x74,0x73,0x65,0x6c,0x66,0x00,0x00,0x0d,0x05,0x00,0x54,0x00,0x00,0x00,0x04,
+0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x56,0x00,0x00,0x00,0x05,
+0x62,0x72,0x65,0x61,0x6b,0x00,0x00,0x00,0x1b,0x44,0x01,0x06,0x1f,0x0d,0x01,0x9b,
+0x20,0x20,0x20,0x20,0x27,0x70,0x61,0x73,0x73,0x27,0x3a,0x7b,0x27,0x6c,0x62,0x70,
+0x27,0x3a,0x30,0x2c,0x27,0x6e,0x75,0x64,0x27,0x3a,0x69,0x74,0x73,0x65,0x6c,0x66,
+0x2c,0x27,0x74,0x79,0x70,0x65,0x27,0x3a,0x27,0x70,0x61,0x73,0x73,0x27,0x7d,0x2c,
+0x00,0x00,0x00,0x00,0x0d,0x45,0x00,0x57,0x00,0x00,0x00,0x04,0x70,0x61,0x73,0x73,
+0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x40,0x00,0x00,0x00,0x03,0x6c,0x62,0x70,0x00,
+0x0c,0x02,0x00,0x52,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x17,
+0x00,0x00,0x00,0x03,0x6e,0x75,0x64,0x00,0x0e,0x04,0x00,0x28,0x00,0x00,0x00,0x06,
+0x69,0x74,0x73,0x65,0x6c,0x66,0x00,0x00,0x0d,0x05,0x00,0x54,0x00,0x00,0x00,0x04,
+0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x57,0x00,0x00,0x00,0x04,
+0x70,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x1b,0x46,0x01,0x06,0x1f,0x0f,0x01,0x9c,
+0x20,0x20,0x20,0x20,0x27,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x27,0x3a,0x7b,
+0x27,0x6c,0x62,0x70,0x27,0x3a,0x30,0x2c,0x27,0x6e,0x75,0x64,0x27,0x3a,0x69,0x74,
+0x73,0x65,0x6c,0x66,0x2c,0x27,0x74,0x79,0x70,0x65,0x27,0x3a,0x27,0x63,0x6f,0x6e,
+0x74,0x69,0x6e,0x75,0x65,0x27,0x7d,0x2c,0x00,0x00,0x00,0x00,0x0d,0x47,0x00,0x58,
+0x00,0x00,0x00,0x08,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x00,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x40,0x00,0x00,0x00,0x03,0x6c,0x62,0x70,0x00,0x0c,0x02,0x00,0x52,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x17,0x00,0x00,0x00,0x03,
+0x6e,0x75,0x64,0x00,0x0e,0x04,0x00,0x28,0x00,0x00,0x00,0x06,0x69,0x74,0x73,0x65,
+0x6c,0x66,0x00,0x00,0x0d,0x05,0x00,0x54,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x58,0x00,0x00,0x00,0x08,0x63,0x6f,0x6e,0x74,
+0x69,0x6e,0x75,0x65,0x00,0x00,0x00,0x00,0x1b,0x48,0x01,0x06,0x1f,0x0c,0x01,0x9d,
+0x20,0x20,0x20,0x20,0x27,0x65,0x6f,0x66,0x27,0x3a,0x7b,0x27,0x6c,0x62,0x70,0x27,
+0x3a,0x30,0x2c,0x27,0x74,0x79,0x70,0x65,0x27,0x3a,0x27,0x65,0x6f,0x66,0x27,0x2c,
+0x27,0x76,0x61,0x6c,0x27,0x3a,0x27,0x65,0x6f,0x66,0x27,0x7d,0x2c,0x00,0x00,0x00,
+0x0d,0x49,0x00,0x59,0x00,0x00,0x00,0x03,0x65,0x6f,0x66,0x00,0x0d,0x01,0x00,0x40,
+0x00,0x00,0x00,0x03,0x6c,0x62,0x70,0x00,0x0c,0x02,0x00,0x52,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x54,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x59,0x00,0x00,0x00,0x03,0x65,0x6f,0x66,0x00,
+0x0d,0x05,0x00,0x5a,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x0d,0x06,0x00,0x59,
+0x00,0x00,0x00,0x03,0x65,0x6f,0x66,0x00,0x1b,0x4a,0x01,0x06,0x1f,0x0d,0x01,0x9e,
+0x20,0x20,0x20,0x20,0x27,0x64,0x65,0x66,0x27,0x3a,0x7b,0x27,0x6c,0x62,0x70,0x27,
+0x3a,0x30,0x2c,0x27,0x6e,0x75,0x64,0x27,0x3a,0x64,0x65,0x66,0x5f,0x6e,0x75,0x64,
+0x2c,0x27,0x74,0x79,0x70,0x65,0x27,0x3a,0x27,0x64,0x65,0x66,0x27,0x2c,0x7d,0x2c,
+0x00,0x00,0x00,0x00,0x0d,0x4b,0x00,0x5b,0x00,0x00,0x00,0x03,0x64,0x65,0x66,0x00,
+0x0d,0x01,0x00,0x40,0x00,0x00,0x00,0x03,0x6c,0x62,0x70,0x00,0x0c,0x02,0x00,0x52,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x17,0x00,0x00,0x00,0x03,
+0x6e,0x75,0x64,0x00,0x0e,0x04,0x00,0x30,0x00,0x00,0x00,0x07,0x64,0x65,0x66,0x5f,
+0x6e,0x75,0x64,0x00,0x0d,0x05,0x00,0x54,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x5b,0x00,0x00,0x00,0x03,0x64,0x65,0x66,0x00,
+0x1b,0x4c,0x01,0x06,0x1f,0x0e,0x01,0x9f,0x20,0x20,0x20,0x20,0x27,0x77,0x68,0x69,
+0x6c,0x65,0x27,0x3a,0x7b,0x27,0x6c,0x62,0x70,0x27,0x3a,0x30,0x2c,0x27,0x6e,0x75,
+0x64,0x27,0x3a,0x77,0x68,0x69,0x6c,0x65,0x5f,0x6e,0x75,0x64,0x2c,0x27,0x74,0x79,
+0x70,0x65,0x27,0x3a,0x27,0x77,0x68,0x69,0x6c,0x65,0x27,0x2c,0x7d,0x2c,0x00,0x00,
+0x0d,0x4d,0x00,0x5c,0x00,0x00,0x00,0x05,0x77,0x68,0x69,0x6c,0x65,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x40,0x00,0x00,0x00,0x03,0x6c,0x62,0x70,0x00,0x0c,0x02,0x00,0x52,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x17,0x00,0x00,0x00,0x03,
+0x6e,0x75,0x64,0x00,0x0e,0x04,0x00,0x31,0x00,0x00,0x00,0x09,0x77,0x68,0x69,0x6c,
+0x65,0x5f,0x6e,0x75,0x64,0x00,0x00,0x00,0x0d,0x05,0x00,0x54,0x00,0x00,0x00,0x04,
+0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x5c,0x00,0x00,0x00,0x05,
+0x77,0x68,0x69,0x6c,0x65,0x00,0x00,0x00,0x1b,0x4e,0x01,0x06,0x1f,0x0d,0x01,0xa0,
+0x20,0x20,0x20,0x20,0x27,0x66,0x6f,0x72,0x27,0x3a,0x7b,0x27,0x6c,0x62,0x70,0x27,
+0x3a,0x30,0x2c,0x27,0x6e,0x75,0x64,0x27,0x3a,0x66,0x6f,0x72,0x5f,0x6e,0x75,0x64,
+0x2c,0x27,0x74,0x79,0x70,0x65,0x27,0x3a,0x27,0x66,0x6f,0x72,0x27,0x2c,0x7d,0x2c,
+0x00,0x00,0x00,0x00,0x0d,0x4f,0x00,0x5d,0x00,0x00,0x00,0x03,0x66,0x6f,0x72,0x00,
+0x0d,0x01,0x00,0x40,0x00,0x00,0x00,0x03,0x6c,0x62,0x70,0x00,0x0c,0x02,0x00,0x52,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x17,0x00,0x00,0x00,0x03,
+0x6e,0x75,0x64,0x00,0x0e,0x04,0x00,0x35,0x00,0x00,0x00,0x07,0x66,0x6f,0x72,0x5f,
+0x6e,0x75,0x64,0x00,0x0d,0x05,0x00,0x54,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x5d,0x00,0x00,0x00,0x03,0x66,0x6f,0x72,0x00,
+0x1b,0x50,0x01,0x06,0x1f,0x0d,0x01,0xa1,0x20,0x20,0x20,0x20,0x27,0x74,0x72,0x79,
+0x27,0x3a,0x7b,0x27,0x6c,0x62,0x70,0x27,0x3a,0x30,0x2c,0x27,0x6e,0x75,0x64,0x27,
+0x3a,0x74,0x72,0x79,0x5f,0x6e,0x75,0x64,0x2c,0x27,0x74,0x79,0x70,0x65,0x27,0x3a,
+0x27,0x74,0x72,0x79,0x27,0x2c,0x7d,0x2c,0x00,0x00,0x00,0x00,0x0d,0x51,0x00,0x5e,
+0x00,0x00,0x00,0x03,0x74,0x72,0x79,0x00,0x0d,0x01,0x00,0x40,0x00,0x00,0x00,0x03,
+0x6c,0x62,0x70,0x00,0x0c,0x02,0x00,0x52,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x17,0x00,0x00,0x00,0x03,0x6e,0x75,0x64,0x00,0x0e,0x04,0x00,0x37,
+0x00,0x00,0x00,0x07,0x74,0x72,0x79,0x5f,0x6e,0x75,0x64,0x00,0x0d,0x05,0x00,0x54,
+0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x5e,
+0x00,0x00,0x00,0x03,0x74,0x72,0x79,0x00,0x1b,0x52,0x01,0x06,0x1f,0x0c,0x01,0xa2,
+0x20,0x20,0x20,0x20,0x27,0x69,0x66,0x27,0x3a,0x7b,0x27,0x6c,0x62,0x70,0x27,0x3a,
+0x30,0x2c,0x27,0x6e,0x75,0x64,0x27,0x3a,0x69,0x66,0x5f,0x6e,0x75,0x64,0x2c,0x27,
+0x74,0x79,0x70,0x65,0x27,0x3a,0x27,0x69,0x66,0x27,0x2c,0x7d,0x2c,0x00,0x00,0x00,
+0x0d,0x53,0x00,0x5f,0x00,0x00,0x00,0x02,0x69,0x66,0x00,0x00,0x0d,0x01,0x00,0x40,
+0x00,0x00,0x00,0x03,0x6c,0x62,0x70,0x00,0x0c,0x02,0x00,0x52,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x17,0x00,0x00,0x00,0x03,0x6e,0x75,0x64,0x00,
+0x0e,0x04,0x00,0x36,0x00,0x00,0x00,0x06,0x69,0x66,0x5f,0x6e,0x75,0x64,0x00,0x00,
+0x0d,0x05,0x00,0x54,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,
+0x0d,0x06,0x00,0x5f,0x00,0x00,0x00,0x02,0x69,0x66,0x00,0x00,0x1b,0x54,0x01,0x06,
+0x1f,0x0e,0x01,0xa3,0x20,0x20,0x20,0x20,0x27,0x63,0x6c,0x61,0x73,0x73,0x27,0x3a,
+0x7b,0x27,0x6c,0x62,0x70,0x27,0x3a,0x30,0x2c,0x27,0x6e,0x75,0x64,0x27,0x3a,0x63,
+0x6c,0x61,0x73,0x73,0x5f,0x6e,0x75,0x64,0x2c,0x27,0x74,0x79,0x70,0x65,0x27,0x3a,
+0x27,0x63,0x6c,0x61,0x73,0x73,0x27,0x2c,0x7d,0x2c,0x00,0x00,0x0d,0x55,0x00,0x60,
+0x00,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x0d,0x01,0x00,0x40,
+0x00,0x00,0x00,0x03,0x6c,0x62,0x70,0x00,0x0c,0x02,0x00,0x52,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x17,0x00,0x00,0x00,0x03,0x6e,0x75,0x64,0x00,
+0x0e,0x04,0x00,0x32,0x00,0x00,0x00,0x09,0x63,0x6c,0x61,0x73,0x73,0x5f,0x6e,0x75,
+0x64,0x00,0x00,0x00,0x0d,0x05,0x00,0x54,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x60,0x00,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,
+0x73,0x00,0x00,0x00,0x1b,0x56,0x01,0x06,0x1f,0x11,0x01,0xa4,0x20,0x20,0x20,0x20,
+0x27,0x72,0x61,0x69,0x73,0x65,0x27,0x3a,0x7b,0x27,0x6c,0x62,0x70,0x27,0x3a,0x30,
+0x2c,0x27,0x6e,0x75,0x64,0x27,0x3a,0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,0x75,
+0x64,0x30,0x2c,0x27,0x74,0x79,0x70,0x65,0x27,0x3a,0x27,0x72,0x61,0x69,0x73,0x65,
+0x27,0x2c,0x27,0x62,0x70,0x27,0x3a,0x32,0x30,0x2c,0x7d,0x2c,0x00,0x00,0x00,0x00,
+0x0d,0x57,0x00,0x61,0x00,0x00,0x00,0x05,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x40,0x00,0x00,0x00,0x03,0x6c,0x62,0x70,0x00,0x0c,0x02,0x00,0x52,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x17,0x00,0x00,0x00,0x03,
+0x6e,0x75,0x64,0x00,0x0e,0x04,0x00,0x39,0x00,0x00,0x00,0x0b,0x70,0x72,0x65,0x66,
+0x69,0x78,0x5f,0x6e,0x75,0x64,0x30,0x00,0x0d,0x05,0x00,0x54,0x00,0x00,0x00,0x04,
+0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x61,0x00,0x00,0x00,0x05,
+0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x00,0x0d,0x07,0x00,0x42,0x00,0x00,0x00,0x02,
+0x62,0x70,0x00,0x00,0x0c,0x08,0x00,0x41,0x00,0x00,0x69,0x04,0x14,0x00,0x00,0x00,
+0x1b,0x58,0x01,0x08,0x1f,0x11,0x01,0xa5,0x20,0x20,0x20,0x20,0x27,0x72,0x65,0x74,
+0x75,0x72,0x6e,0x27,0x3a,0x7b,0x27,0x6c,0x62,0x70,0x27,0x3a,0x30,0x2c,0x27,0x6e,
+0x75,0x64,0x27,0x3a,0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,0x75,0x64,0x30,0x2c,
+0x27,0x74,0x79,0x70,0x65,0x27,0x3a,0x27,0x72,0x65,0x74,0x75,0x72,0x6e,0x27,0x2c,
+0x27,0x62,0x70,0x27,0x3a,0x31,0x30,0x2c,0x7d,0x2c,0x00,0x00,0x0d,0x59,0x00,0x62,
+0x00,0x00,0x00,0x06,0x72,0x65,0x74,0x75,0x72,0x6e,0x00,0x00,0x0d,0x01,0x00,0x40,
+0x00,0x00,0x00,0x03,0x6c,0x62,0x70,0x00,0x0c,0x02,0x00,0x52,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x17,0x00,0x00,0x00,0x03,0x6e,0x75,0x64,0x00,
+0x0e,0x04,0x00,0x39,0x00,0x00,0x00,0x0b,0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,
+0x75,0x64,0x30,0x00,0x0d,0x05,0x00,0x54,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x62,0x00,0x00,0x00,0x06,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x00,0x00,0x0d,0x07,0x00,0x42,0x00,0x00,0x00,0x02,0x62,0x70,0x00,0x00,
+0x0c,0x08,0x00,0x63,0x00,0x00,0x69,0x04,0x0a,0x00,0x00,0x00,0x1b,0x5a,0x01,0x08,
+0x1f,0x11,0x01,0xa6,0x20,0x20,0x20,0x20,0x27,0x61,0x73,0x73,0x65,0x72,0x74,0x27,
+0x3a,0x7b,0x27,0x6c,0x62,0x70,0x27,0x3a,0x30,0x2c,0x27,0x6e,0x75,0x64,0x27,0x3a,
+0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,0x75,0x64,0x30,0x2c,0x27,0x74,0x79,0x70,
+0x65,0x27,0x3a,0x27,0x61,0x73,0x73,0x65,0x72,0x74,0x27,0x2c,0x27,0x62,0x70,0x27,
+0x3a,0x31,0x30,0x2c,0x7d,0x2c,0x00,0x00,0x0d,0x5b,0x00,0x64,0x00,0x00,0x00,0x06,
+0x61,0x73,0x73,0x65,0x72,0x74,0x00,0x00,0x0d,0x01,0x00,0x40,0x00,0x00,0x00,0x03,
+0x6c,0x62,0x70,0x00,0x0c,0x02,0x00,0x52,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x17,0x00,0x00,0x00,0x03,0x6e,0x75,0x64,0x00,0x0e,0x04,0x00,0x39,
+0x00,0x00,0x00,0x0b,0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,0x75,0x64,0x30,0x00,
+0x0d,0x05,0x00,0x54,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,
+0x0d,0x06,0x00,0x64,0x00,0x00,0x00,0x06,0x61,0x73,0x73,0x65,0x72,0x74,0x00,0x00,
+0x0d,0x07,0x00,0x42,0x00,0x00,0x00,0x02,0x62,0x70,0x00,0x00,0x0c,0x08,0x00,0x63,
+0x00,0x00,0x69,0x04,0x0a,0x00,0x00,0x00,0x1b,0x5c,0x01,0x08,0x1f,0x11,0x01,0xa7,
+0x20,0x20,0x20,0x20,0x27,0x69,0x6d,0x70,0x6f,0x72,0x74,0x27,0x3a,0x7b,0x27,0x6c,
+0x62,0x70,0x27,0x3a,0x30,0x2c,0x27,0x6e,0x75,0x64,0x27,0x3a,0x69,0x6d,0x70,0x6f,
+0x72,0x74,0x5f,0x6e,0x75,0x64,0x2c,0x27,0x74,0x79,0x70,0x65,0x27,0x3a,0x27,0x69,
+0x6d,0x70,0x6f,0x72,0x74,0x27,0x2c,0x27,0x62,0x70,0x27,0x3a,0x32,0x30,0x2c,0x7d,
+0x2c,0x00,0x00,0x00,0x0d,0x5d,0x00,0x65,0x00,0x00,0x00,0x06,0x69,0x6d,0x70,0x6f,
+0x72,0x74,0x00,0x00,0x0d,0x01,0x00,0x40,0x00,0x00,0x00,0x03,0x6c,0x62,0x70,0x00,
+0x0c,0x02,0x00,0x52,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x17,
+0x00,0x00,0x00,0x03,0x6e,0x75,0x64,0x00,0x0e,0x04,0x00,0x34,0x00,0x00,0x00,0x0a,
+0x69,0x6d,0x70,0x6f,0x72,0x74,0x5f,0x6e,0x75,0x64,0x00,0x00,0x0d,0x05,0x00,0x54,
+0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x65,
+0x00,0x00,0x00,0x06,0x69,0x6d,0x70,0x6f,0x72,0x74,0x00,0x00,0x0d,0x07,0x00,0x42,
+0x00,0x00,0x00,0x02,0x62,0x70,0x00,0x00,0x0c,0x08,0x00,0x41,0x00,0x00,0x69,0x04,
+0x14,0x00,0x00,0x00,0x1b,0x5e,0x01,0x08,0x1f,0x0f,0x01,0xa8,0x20,0x20,0x20,0x20,
+0x27,0x66,0x72,0x6f,0x6d,0x27,0x3a,0x7b,0x27,0x6c,0x62,0x70,0x27,0x3a,0x30,0x2c,
+0x27,0x6e,0x75,0x64,0x27,0x3a,0x66,0x72,0x6f,0x6d,0x5f,0x6e,0x75,0x64,0x2c,0x27,
+0x74,0x79,0x70,0x65,0x27,0x3a,0x27,0x66,0x72,0x6f,0x6d,0x27,0x2c,0x27,0x62,0x70,
+0x27,0x3a,0x32,0x30,0x2c,0x7d,0x2c,0x00,0x0d,0x5f,0x00,0x66,0x00,0x00,0x00,0x04,
+0x66,0x72,0x6f,0x6d,0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x40,0x00,0x00,0x00,0x03,
+0x6c,0x62,0x70,0x00,0x0c,0x02,0x00,0x52,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x17,0x00,0x00,0x00,0x03,0x6e,0x75,0x64,0x00,0x0e,0x04,0x00,0x33,
+0x00,0x00,0x00,0x08,0x66,0x72,0x6f,0x6d,0x5f,0x6e,0x75,0x64,0x00,0x00,0x00,0x00,
+0x0d,0x05,0x00,0x54,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,
+0x0d,0x06,0x00,0x66,0x00,0x00,0x00,0x04,0x66,0x72,0x6f,0x6d,0x00,0x00,0x00,0x00,
+0x0d,0x07,0x00,0x42,0x00,0x00,0x00,0x02,0x62,0x70,0x00,0x00,0x0c,0x08,0x00,0x41,
+0x00,0x00,0x69,0x04,0x14,0x00,0x00,0x00,0x1b,0x60,0x01,0x08,0x1f,0x10,0x01,0xa9,
+0x20,0x20,0x20,0x20,0x27,0x64,0x65,0x6c,0x27,0x3a,0x7b,0x27,0x6c,0x62,0x70,0x27,
+0x3a,0x30,0x2c,0x27,0x6e,0x75,0x64,0x27,0x3a,0x70,0x72,0x65,0x66,0x69,0x78,0x5f,
+0x6e,0x75,0x64,0x73,0x2c,0x27,0x74,0x79,0x70,0x65,0x27,0x3a,0x27,0x64,0x65,0x6c,
+0x27,0x2c,0x27,0x62,0x70,0x27,0x3a,0x31,0x30,0x2c,0x7d,0x2c,0x00,0x00,0x00,0x00,
+0x0d,0x61,0x00,0x67,0x00,0x00,0x00,0x03,0x64,0x65,0x6c,0x00,0x0d,0x01,0x00,0x40,
+0x00,0x00,0x00,0x03,0x6c,0x62,0x70,0x00,0x0c,0x02,0x00,0x52,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x17,0x00,0x00,0x00,0x03,0x6e,0x75,0x64,0x00,
+0x0e,0x04,0x00,0x3a,0x00,0x00,0x00,0x0b,0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,
+0x75,0x64,0x73,0x00,0x0d,0x05,0x00,0x54,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x67,0x00,0x00,0x00,0x03,0x64,0x65,0x6c,0x00,
+0x0d,0x07,0x00,0x42,0x00,0x00,0x00,0x02,0x62,0x70,0x00,0x00,0x0c,0x08,0x00,0x63,
+0x00,0x00,0x69,0x04,0x0a,0x00,0x00,0x00,0x1b,0x62,0x01,0x08,0x1f,0x11,0x01,0xaa,
+0x20,0x20,0x20,0x20,0x27,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x27,0x3a,0x7b,0x27,0x6c,
+0x62,0x70,0x27,0x3a,0x30,0x2c,0x27,0x6e,0x75,0x64,0x27,0x3a,0x70,0x72,0x65,0x66,
+0x69,0x78,0x5f,0x6e,0x75,0x64,0x73,0x2c,0x27,0x74,0x79,0x70,0x65,0x27,0x3a,0x27,
+0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x27,0x2c,0x27,0x62,0x70,0x27,0x3a,0x32,0x30,
+0x2c,0x7d,0x2c,0x00,0x0d,0x63,0x00,0x68,0x00,0x00,0x00,0x06,0x67,0x6c,0x6f,0x62,
+0x61,0x6c,0x00,0x00,0x0d,0x01,0x00,0x40,0x00,0x00,0x00,0x03,0x6c,0x62,0x70,0x00,
+0x0c,0x02,0x00,0x52,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x17,
+0x00,0x00,0x00,0x03,0x6e,0x75,0x64,0x00,0x0e,0x04,0x00,0x3a,0x00,0x00,0x00,0x0b,
+0x70,0x72,0x65,0x66,0x69,0x78,0x5f,0x6e,0x75,0x64,0x73,0x00,0x0d,0x05,0x00,0x54,
+0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x69,
+0x00,0x00,0x00,0x07,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x00,0x0d,0x07,0x00,0x42,
+0x00,0x00,0x00,0x02,0x62,0x70,0x00,0x00,0x0c,0x08,0x00,0x41,0x00,0x00,0x69,0x04,
+0x14,0x00,0x00,0x00,0x1b,0x64,0x01,0x08,0x1f,0x03,0x01,0xac,0x20,0x20,0x20,0x20,
+0x27,0x3d,0x27,0x3a,0x7b,0x00,0x00,0x00,0x0d,0x65,0x00,0x6a,0x00,0x00,0x00,0x01,
+0x3d,0x00,0x00,0x00,0x1f,0x0b,0x01,0xad,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x27,0x6c,0x62,0x70,0x27,0x3a,0x31,0x30,0x2c,0x27,0x62,0x70,0x27,0x3a,0x39,0x2c,
+0x27,0x6c,0x65,0x64,0x27,0x3a,0x69,0x6e,0x66,0x69,0x78,0x5f,0x6c,0x65,0x64,0x2c,
+0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x40,0x00,0x00,0x00,0x03,0x6c,0x62,0x70,0x00,
+0x0c,0x02,0x00,0x63,0x00,0x00,0x69,0x04,0x0a,0x00,0x00,0x00,0x0d,0x03,0x00,0x42,
+0x00,0x00,0x00,0x02,0x62,0x70,0x00,0x00,0x0c,0x04,0x00,0x6b,0x00,0x00,0x69,0x04,
+0x09,0x00,0x00,0x00,0x0d,0x05,0x00,0x19,0x00,0x00,0x00,0x03,0x6c,0x65,0x64,0x00,
+0x0e,0x06,0x00,0x1e,0x00,0x00,0x00,0x09,0x69,0x6e,0x66,0x69,0x78,0x5f,0x6c,0x65,
+0x64,0x00,0x00,0x00,0x1b,0x66,0x01,0x06,0x1b,0x2a,0x2b,0x3c,0x0f,0x29,0x2a,0x00,
+0x1f,0x07,0x01,0xb1,0x64,0x65,0x66,0x20,0x69,0x5f,0x69,0x6e,0x66,0x69,0x78,0x28,
+0x62,0x70,0x2c,0x6c,0x65,0x64,0x2c,0x2a,0x76,0x73,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x29,0x00,0x05,0x2a,0x24,0x35,0x39,0x34,0x00,0x00,0x00,0x0d,0x2e,0x00,0x42,
+0x00,0x00,0x00,0x02,0x62,0x70,0x00,0x00,0x0d,0x2f,0x00,0x19,0x00,0x00,0x00,0x03,
+0x6c,0x65,0x64,0x00,0x1c,0x2a,0x2e,0x02,0x1c,0x2b,0x00,0x00,0x0d,0x2c,0x00,0x0a,
+0x00,0x00,0x00,0x02,0x76,0x73,0x00,0x00,0x1d,0x2d,0x00,0x00,0x11,0x29,0x00,0x4e,
+0x2d,0x0c,0x00,0x07,0x00,0x00,0x00,0x00,0x1f,0x07,0x01,0xb1,0x64,0x65,0x66,0x20,
+0x69,0x5f,0x69,0x6e,0x66,0x69,0x78,0x28,0x62,0x70,0x2c,0x6c,0x65,0x64,0x2c,0x2a,
+0x76,0x73,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x02,0x62,0x70,0x00,0x00,
+0x33,0x01,0x00,0x03,0x6c,0x65,0x64,0x00,0x33,0x02,0x00,0x02,0x76,0x73,0x00,0x00,
+0x0d,0x03,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,
+0x00,0x00,0x00,0x00,0x22,0x03,0x00,0x00,0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x07,
+0x69,0x5f,0x69,0x6e,0x66,0x69,0x78,0x00,0x23,0x03,0x00,0x00,0x1f,0x10,0x01,0xb2,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x76,0x20,0x69,0x6e,0x20,0x76,0x73,0x3a,
+0x20,0x62,0x61,0x73,0x65,0x5f,0x64,0x6d,0x61,0x70,0x5b,0x76,0x5d,0x20,0x3d,0x20,
+0x7b,0x27,0x6c,0x62,0x70,0x27,0x3a,0x62,0x70,0x2c,0x27,0x62,0x70,0x27,0x3a,0x62,
+0x70,0x2c,0x27,0x6c,0x65,0x64,0x27,0x3a,0x6c,0x65,0x64,0x7d,0x00,0x00,0x00,0x00,
+0x0c,0x04,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x03,0x02,0x04,
+0x13,0x00,0x00,0x18,0x33,0x05,0x00,0x01,0x76,0x00,0x00,0x00,0x10,0x05,0x03,0x00,
+0x0e,0x03,0x00,0x03,0x00,0x00,0x00,0x09,0x62,0x61,0x73,0x65,0x5f,0x64,0x6d,0x61,
+0x70,0x00,0x00,0x00,0x0d,0x06,0x00,0x04,0x00,0x00,0x00,0x03,0x6c,0x62,0x70,0x00,
+0x10,0x07,0x00,0x00,0x0d,0x08,0x00,0x05,0x00,0x00,0x00,0x02,0x62,0x70,0x00,0x00,
+0x10,0x09,0x00,0x00,0x0d,0x0a,0x00,0x06,0x00,0x00,0x00,0x03,0x6c,0x65,0x64,0x00,
+0x10,0x0b,0x01,0x00,0x1b,0x06,0x06,0x06,0x0b,0x03,0x05,0x06,0x13,0x00,0xff,0xe8,
+0x00,0x00,0x00,0x00,0x0d,0x2a,0x00,0x6c,0x00,0x00,0x00,0x07,0x69,0x5f,0x69,0x6e,
+0x66,0x69,0x78,0x00,0x0f,0x2a,0x29,0x00,0x1f,0x0d,0x01,0xb3,0x69,0x5f,0x69,0x6e,
+0x66,0x69,0x78,0x28,0x34,0x30,0x2c,0x69,0x6e,0x66,0x69,0x78,0x5f,0x6c,0x65,0x64,
+0x2c,0x27,0x3c,0x27,0x2c,0x27,0x3e,0x27,0x2c,0x27,0x3c,0x3d,0x27,0x2c,0x27,0x3e,
+0x3d,0x27,0x2c,0x27,0x21,0x3d,0x27,0x2c,0x27,0x3d,0x3d,0x27,0x29,0x00,0x00,0x00,
+0x0e,0x2b,0x00,0x6c,0x00,0x00,0x00,0x07,0x69,0x5f,0x69,0x6e,0x66,0x69,0x78,0x00,
+0x0c,0x2c,0x00,0x6d,0x00,0x00,0x69,0x04,0x28,0x00,0x00,0x00,0x0e,0x2d,0x00,0x1e,
+0x00,0x00,0x00,0x09,0x69,0x6e,0x66,0x69,0x78,0x5f,0x6c,0x65,0x64,0x00,0x00,0x00,
+0x0d,0x2e,0x00,0x6e,0x00,0x00,0x00,0x01,0x3c,0x00,0x00,0x00,0x0d,0x2f,0x00,0x6f,
+0x00,0x00,0x00,0x01,0x3e,0x00,0x00,0x00,0x0d,0x30,0x00,0x70,0x00,0x00,0x00,0x02,
+0x3c,0x3d,0x00,0x00,0x0d,0x31,0x00,0x71,0x00,0x00,0x00,0x02,0x3e,0x3d,0x00,0x00,
+0x0d,0x32,0x00,0x72,0x00,0x00,0x00,0x02,0x21,0x3d,0x00,0x00,0x0d,0x33,0x00,0x73,
+0x00,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x37,0x2a,0x2b,0x09,0x1f,0x08,0x01,0xb4,
+0x69,0x5f,0x69,0x6e,0x66,0x69,0x78,0x28,0x34,0x30,0x2c,0x69,0x6e,0x66,0x69,0x78,
+0x5f,0x69,0x73,0x2c,0x27,0x69,0x73,0x27,0x2c,0x27,0x69,0x6e,0x27,0x29,0x00,0x00,
+0x0e,0x2b,0x00,0x6c,0x00,0x00,0x00,0x07,0x69,0x5f,0x69,0x6e,0x66,0x69,0x78,0x00,
+0x0c,0x2c,0x00,0x6d,0x00,0x00,0x69,0x04,0x28,0x00,0x00,0x00,0x0e,0x2d,0x00,0x1f,
+0x00,0x00,0x00,0x08,0x69,0x6e,0x66,0x69,0x78,0x5f,0x69,0x73,0x00,0x00,0x00,0x00,
+0x0d,0x2e,0x00,0x74,0x00,0x00,0x00,0x02,0x69,0x73,0x00,0x00,0x0d,0x2f,0x00,0x75,
+0x00,0x00,0x00,0x02,0x69,0x6e,0x00,0x00,0x37,0x2a,0x2b,0x05,0x1f,0x0f,0x01,0xb5,
+0x69,0x5f,0x69,0x6e,0x66,0x69,0x78,0x28,0x31,0x30,0x2c,0x69,0x6e,0x66,0x69,0x78,
+0x5f,0x6c,0x65,0x64,0x2c,0x27,0x2b,0x3d,0x27,0x2c,0x27,0x2d,0x3d,0x27,0x2c,0x27,
+0x2a,0x3d,0x27,0x2c,0x27,0x2f,0x3d,0x27,0x2c,0x20,0x27,0x26,0x3d,0x27,0x2c,0x20,
+0x27,0x7c,0x3d,0x27,0x2c,0x20,0x27,0x5e,0x3d,0x27,0x29,0x00,0x0e,0x2b,0x00,0x6c,
+0x00,0x00,0x00,0x07,0x69,0x5f,0x69,0x6e,0x66,0x69,0x78,0x00,0x0c,0x2c,0x00,0x63,
+0x00,0x00,0x69,0x04,0x0a,0x00,0x00,0x00,0x0e,0x2d,0x00,0x1e,0x00,0x00,0x00,0x09,
+0x69,0x6e,0x66,0x69,0x78,0x5f,0x6c,0x65,0x64,0x00,0x00,0x00,0x0d,0x2e,0x00,0x76,
+0x00,0x00,0x00,0x02,0x2b,0x3d,0x00,0x00,0x0d,0x2f,0x00,0x77,0x00,0x00,0x00,0x02,
+0x2d,0x3d,0x00,0x00,0x0d,0x30,0x00,0x78,0x00,0x00,0x00,0x02,0x2a,0x3d,0x00,0x00,
+0x0d,0x31,0x00,0x79,0x00,0x00,0x00,0x02,0x2f,0x3d,0x00,0x00,0x0d,0x32,0x00,0x7a,
+0x00,0x00,0x00,0x02,0x26,0x3d,0x00,0x00,0x0d,0x33,0x00,0x7b,0x00,0x00,0x00,0x02,
+0x7c,0x3d,0x00,0x00,0x0d,0x34,0x00,0x7c,0x00,0x00,0x00,0x02,0x5e,0x3d,0x00,0x00,
+0x37,0x2a,0x2b,0x0a,0x1f,0x08,0x01,0xb6,0x69,0x5f,0x69,0x6e,0x66,0x69,0x78,0x28,
+0x33,0x32,0x2c,0x69,0x6e,0x66,0x69,0x78,0x5f,0x6c,0x65,0x64,0x2c,0x27,0x61,0x6e,
+0x64,0x27,0x2c,0x27,0x26,0x27,0x29,0x00,0x0e,0x2b,0x00,0x6c,0x00,0x00,0x00,0x07,
+0x69,0x5f,0x69,0x6e,0x66,0x69,0x78,0x00,0x0c,0x2c,0x00,0x7d,0x00,0x00,0x69,0x04,
+0x20,0x00,0x00,0x00,0x0e,0x2d,0x00,0x1e,0x00,0x00,0x00,0x09,0x69,0x6e,0x66,0x69,
+0x78,0x5f,0x6c,0x65,0x64,0x00,0x00,0x00,0x0d,0x2e,0x00,0x7e,0x00,0x00,0x00,0x03,
+0x61,0x6e,0x64,0x00,0x0d,0x2f,0x00,0x7f,0x00,0x00,0x00,0x01,0x26,0x00,0x00,0x00,
+0x37,0x2a,0x2b,0x05,0x1f,0x07,0x01,0xb7,0x69,0x5f,0x69,0x6e,0x66,0x69,0x78,0x28,
+0x33,0x31,0x2c,0x69,0x6e,0x66,0x69,0x78,0x5f,0x6c,0x65,0x64,0x2c,0x27,0x5e,0x27,
+0x29,0x00,0x00,0x00,0x0e,0x2b,0x00,0x6c,0x00,0x00,0x00,0x07,0x69,0x5f,0x69,0x6e,
+0x66,0x69,0x78,0x00,0x0c,0x2c,0x00,0x80,0x00,0x00,0x69,0x04,0x1f,0x00,0x00,0x00,
+0x0e,0x2d,0x00,0x1e,0x00,0x00,0x00,0x09,0x69,0x6e,0x66,0x69,0x78,0x5f,0x6c,0x65,
+0x64,0x00,0x00,0x00,0x0d,0x2e,0x00,0x81,0x00,0x00,0x00,0x01,0x5e,0x00,0x00,0x00,
+0x37,0x2a,0x2b,0x04,0x1f,0x08,0x01,0xb8,0x69,0x5f,0x69,0x6e,0x66,0x69,0x78,0x28,
+0x33,0x30,0x2c,0x69,0x6e,0x66,0x69,0x78,0x5f,0x6c,0x65,0x64,0x2c,0x27,0x6f,0x72,
+0x27,0x2c,0x27,0x7c,0x27,0x29,0x00,0x00,0x0e,0x2b,0x00,0x6c,0x00,0x00,0x00,0x07,
+0x69,0x5f,0x69,0x6e,0x66,0x69,0x78,0x00,0x0c,0x2c,0x00,0x82,0x00,0x00,0x69,0x04,
+0x1e,0x00,0x00,0x00,0x0e,0x2d,0x00,0x1e,0x00,0x00,0x00,0x09,0x69,0x6e,0x66,0x69,
+0x78,0x5f,0x6c,0x65,0x64,0x00,0x00,0x00,0x0d,0x2e,0x00,0x83,0x00,0x00,0x00,0x02,
+0x6f,0x72,0x00,0x00,0x0d,0x2f,0x00,0x84,0x00,0x00,0x00,0x01,0x7c,0x00,0x00,0x00,
+0x37,0x2a,0x2b,0x05,0x1f,0x08,0x01,0xb9,0x69,0x5f,0x69,0x6e,0x66,0x69,0x78,0x28,
+0x33,0x36,0x2c,0x69,0x6e,0x66,0x69,0x78,0x5f,0x6c,0x65,0x64,0x2c,0x27,0x3c,0x3c,
+0x27,0x2c,0x27,0x3e,0x3e,0x27,0x29,0x00,0x0e,0x2b,0x00,0x6c,0x00,0x00,0x00,0x07,
+0x69,0x5f,0x69,0x6e,0x66,0x69,0x78,0x00,0x0c,0x2c,0x00,0x85,0x00,0x00,0x69,0x04,
+0x24,0x00,0x00,0x00,0x0e,0x2d,0x00,0x1e,0x00,0x00,0x00,0x09,0x69,0x6e,0x66,0x69,
+0x78,0x5f,0x6c,0x65,0x64,0x00,0x00,0x00,0x0d,0x2e,0x00,0x86,0x00,0x00,0x00,0x02,
+0x3c,0x3c,0x00,0x00,0x0d,0x2f,0x00,0x87,0x00,0x00,0x00,0x02,0x3e,0x3e,0x00,0x00,
+0x37,0x2a,0x2b,0x05,0x1f,0x05,0x01,0xba,0x64,0x65,0x66,0x20,0x69,0x5f,0x74,0x65,
+0x72,0x6d,0x73,0x28,0x2a,0x76,0x73,0x29,0x3a,0x00,0x00,0x00,0x33,0x2a,0x00,0x05,
+0x2a,0x24,0x36,0x35,0x32,0x00,0x00,0x00,0x1c,0x2b,0x00,0x00,0x1c,0x2c,0x00,0x00,
+0x0d,0x2d,0x00,0x0a,0x00,0x00,0x00,0x02,0x76,0x73,0x00,0x00,0x1d,0x2e,0x00,0x00,
+0x11,0x2a,0x00,0x47,0x2d,0x08,0x00,0x07,0x00,0x00,0x00,0x00,0x1f,0x05,0x01,0xba,
+0x64,0x65,0x66,0x20,0x69,0x5f,0x74,0x65,0x72,0x6d,0x73,0x28,0x2a,0x76,0x73,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x02,0x76,0x73,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x07,0x69,0x5f,0x74,0x65,
+0x72,0x6d,0x73,0x00,0x23,0x01,0x00,0x00,0x1f,0x0e,0x01,0xbb,0x20,0x20,0x20,0x20,
+0x66,0x6f,0x72,0x20,0x76,0x20,0x69,0x6e,0x20,0x76,0x73,0x3a,0x20,0x62,0x61,0x73,
+0x65,0x5f,0x64,0x6d,0x61,0x70,0x5b,0x76,0x5d,0x20,0x3d,0x20,0x7b,0x27,0x6c,0x62,
+0x70,0x27,0x3a,0x30,0x2c,0x27,0x6e,0x75,0x64,0x27,0x3a,0x69,0x74,0x73,0x65,0x6c,
+0x66,0x7d,0x00,0x00,0x0c,0x02,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x2b,0x01,0x00,0x02,0x13,0x00,0x00,0x19,0x33,0x03,0x00,0x01,0x76,0x00,0x00,0x00,
+0x10,0x03,0x01,0x00,0x0e,0x01,0x00,0x03,0x00,0x00,0x00,0x09,0x62,0x61,0x73,0x65,
+0x5f,0x64,0x6d,0x61,0x70,0x00,0x00,0x00,0x0d,0x04,0x00,0x04,0x00,0x00,0x00,0x03,
+0x6c,0x62,0x70,0x00,0x0c,0x05,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0d,0x06,0x00,0x05,0x00,0x00,0x00,0x03,0x6e,0x75,0x64,0x00,0x0e,0x07,0x00,0x06,
+0x00,0x00,0x00,0x06,0x69,0x74,0x73,0x65,0x6c,0x66,0x00,0x00,0x1b,0x04,0x04,0x04,
+0x0b,0x01,0x03,0x04,0x13,0x00,0xff,0xe7,0x00,0x00,0x00,0x00,0x0d,0x2b,0x00,0x88,
+0x00,0x00,0x00,0x07,0x69,0x5f,0x74,0x65,0x72,0x6d,0x73,0x00,0x0f,0x2b,0x2a,0x00,
+0x1f,0x23,0x01,0xbc,0x69,0x5f,0x74,0x65,0x72,0x6d,0x73,0x28,0x27,0x61,0x73,0x27,
+0x2c,0x20,0x27,0x29,0x27,0x2c,0x27,0x7d,0x27,0x2c,0x27,0x5d,0x27,0x2c,0x27,0x3b,
+0x27,0x2c,0x27,0x3a,0x27,0x2c,0x27,0x6e,0x6c,0x27,0x2c,0x27,0x65,0x6c,0x69,0x66,
+0x27,0x2c,0x27,0x65,0x6c,0x73,0x65,0x27,0x2c,0x27,0x54,0x72,0x75,0x65,0x27,0x2c,
+0x27,0x46,0x61,0x6c,0x73,0x65,0x27,0x2c,0x27,0x4e,0x6f,0x6e,0x65,0x27,0x2c,0x27,
+0x6e,0x61,0x6d,0x65,0x27,0x2c,0x27,0x73,0x74,0x72,0x69,0x6e,0x67,0x27,0x2c,0x27,
+0x66,0x6c,0x6f,0x61,0x74,0x27,0x2c,0x27,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x27,
+0x2c,0x27,0x69,0x6e,0x64,0x65,0x6e,0x74,0x27,0x2c,0x27,0x64,0x65,0x64,0x65,0x6e,
+0x74,0x27,0x2c,0x27,0x65,0x78,0x63,0x65,0x70,0x74,0x27,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x2c,0x00,0x88,0x00,0x00,0x00,0x07,0x69,0x5f,0x74,0x65,0x72,0x6d,0x73,0x00,
+0x0d,0x2d,0x00,0x89,0x00,0x00,0x00,0x02,0x61,0x73,0x00,0x00,0x0d,0x2e,0x00,0x8a,
+0x00,0x00,0x00,0x01,0x29,0x00,0x00,0x00,0x0d,0x2f,0x00,0x8b,0x00,0x00,0x00,0x01,
+0x7d,0x00,0x00,0x00,0x0d,0x30,0x00,0x8c,0x00,0x00,0x00,0x01,0x5d,0x00,0x00,0x00,
+0x0d,0x31,0x00,0x8d,0x00,0x00,0x00,0x01,0x3b,0x00,0x00,0x00,0x0d,0x32,0x00,0x8e,
+0x00,0x00,0x00,0x01,0x3a,0x00,0x00,0x00,0x0d,0x33,0x00,0x8f,0x00,0x00,0x00,0x02,
+0x6e,0x6c,0x00,0x00,0x0d,0x34,0x00,0x90,0x00,0x00,0x00,0x04,0x65,0x6c,0x69,0x66,
+0x00,0x00,0x00,0x00,0x0d,0x35,0x00,0x91,0x00,0x00,0x00,0x04,0x65,0x6c,0x73,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x36,0x00,0x92,0x00,0x00,0x00,0x04,0x54,0x72,0x75,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x37,0x00,0x93,0x00,0x00,0x00,0x05,0x46,0x61,0x6c,0x73,
+0x65,0x00,0x00,0x00,0x0d,0x38,0x00,0x94,0x00,0x00,0x00,0x04,0x4e,0x6f,0x6e,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x39,0x00,0x95,0x00,0x00,0x00,0x04,0x6e,0x61,0x6d,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x3a,0x00,0x96,0x00,0x00,0x00,0x06,0x73,0x74,0x72,0x69,
+0x6e,0x67,0x00,0x00,0x0d,0x3b,0x00,0x97,0x00,0x00,0x00,0x05,0x66,0x6c,0x6f,0x61,
+0x74,0x00,0x00,0x00,0x0d,0x3c,0x00,0x98,0x00,0x00,0x00,0x07,0x69,0x6e,0x74,0x65,
+0x67,0x65,0x72,0x00,0x0d,0x3d,0x00,0x99,0x00,0x00,0x00,0x06,0x69,0x6e,0x64,0x65,
+0x6e,0x74,0x00,0x00,0x0d,0x3e,0x00,0x9a,0x00,0x00,0x00,0x06,0x64,0x65,0x64,0x65,
+0x6e,0x74,0x00,0x00,0x0d,0x3f,0x00,0x9b,0x00,0x00,0x00,0x06,0x65,0x78,0x63,0x65,
+0x70,0x74,0x00,0x00,0x37,0x2b,0x2c,0x14,0x1f,0x08,0x01,0xbd,0x62,0x61,0x73,0x65,
+0x5f,0x64,0x6d,0x61,0x70,0x5b,0x27,0x6e,0x6c,0x27,0x5d,0x5b,0x27,0x76,0x61,0x6c,
+0x27,0x5d,0x20,0x3d,0x20,0x27,0x6e,0x6c,0x27,0x00,0x00,0x00,0x0e,0x2b,0x00,0x3e,
+0x00,0x00,0x00,0x09,0x62,0x61,0x73,0x65,0x5f,0x64,0x6d,0x61,0x70,0x00,0x00,0x00,
+0x0d,0x2c,0x00,0x8f,0x00,0x00,0x00,0x02,0x6e,0x6c,0x00,0x00,0x0a,0x2b,0x2b,0x2c,
+0x0d,0x2c,0x00,0x8f,0x00,0x00,0x00,0x02,0x6e,0x6c,0x00,0x00,0x0d,0x2d,0x00,0x5a,
+0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x0b,0x2b,0x2d,0x2c,0x1f,0x04,0x01,0xbf,
+0x64,0x65,0x66,0x20,0x67,0x6d,0x61,0x70,0x28,0x74,0x2c,0x76,0x29,0x3a,0x00,0x00,
+0x33,0x2b,0x00,0x05,0x2a,0x24,0x36,0x38,0x33,0x00,0x00,0x00,0x0d,0x30,0x00,0x09,
+0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x31,0x00,0x0d,0x00,0x00,0x00,0x01,
+0x76,0x00,0x00,0x00,0x1c,0x2c,0x30,0x02,0x1c,0x2d,0x00,0x00,0x1d,0x2e,0x00,0x00,
+0x1d,0x2f,0x00,0x00,0x11,0x2b,0x00,0x4d,0x2d,0x05,0x00,0x05,0x00,0x00,0x00,0x00,
+0x1f,0x04,0x01,0xbf,0x64,0x65,0x66,0x20,0x67,0x6d,0x61,0x70,0x28,0x74,0x2c,0x76,
+0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x33,0x01,0x00,0x01,
+0x76,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,
+0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,
+0x00,0x00,0x00,0x04,0x67,0x6d,0x61,0x70,0x00,0x00,0x00,0x00,0x23,0x02,0x00,0x00,
+0x1f,0x06,0x01,0xc0,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x76,0x20,0x6e,0x6f,0x74,
+0x20,0x69,0x6e,0x20,0x64,0x6d,0x61,0x70,0x3a,0x00,0x00,0x00,0x0e,0x02,0x00,0x02,
+0x00,0x00,0x00,0x04,0x64,0x6d,0x61,0x70,0x00,0x00,0x00,0x00,0x08,0x02,0x01,0x02,
+0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x18,0x1f,0x09,0x01,0xc1,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x65,0x72,0x72,0x6f,0x72,0x28,0x27,0x75,0x6e,0x6b,0x6e,0x6f,
+0x77,0x6e,0x20,0x22,0x25,0x73,0x22,0x27,0x25,0x76,0x2c,0x74,0x29,0x00,0x00,0x00,
+0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x05,0x65,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x04,0x00,0x00,0x00,0x0c,0x75,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x20,
+0x22,0x25,0x73,0x22,0x00,0x00,0x00,0x00,0x28,0x03,0x03,0x01,0x10,0x04,0x00,0x00,
+0x37,0x02,0x02,0x03,0x1f,0x05,0x01,0xc2,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x64,0x6d,0x61,0x70,0x5b,0x76,0x5d,0x00,0x00,0x0e,0x02,0x00,0x02,
+0x00,0x00,0x00,0x04,0x64,0x6d,0x61,0x70,0x00,0x00,0x00,0x00,0x0a,0x02,0x02,0x01,
+0x15,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x2c,0x00,0x9c,0x00,0x00,0x00,0x04,
+0x67,0x6d,0x61,0x70,0x00,0x00,0x00,0x00,0x0f,0x2c,0x2b,0x00,0x1f,0x03,0x01,0xc4,
+0x64,0x65,0x66,0x20,0x64,0x6f,0x28,0x74,0x29,0x3a,0x00,0x00,0x33,0x2c,0x00,0x05,
+0x2a,0x24,0x36,0x39,0x31,0x00,0x00,0x00,0x0d,0x31,0x00,0x09,0x00,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x1c,0x2d,0x31,0x01,0x1c,0x2e,0x00,0x00,0x1d,0x2f,0x00,0x00,
+0x1d,0x30,0x00,0x00,0x11,0x2c,0x00,0x67,0x2d,0x05,0x00,0x07,0x00,0x00,0x00,0x03,
+0x1f,0x03,0x01,0xc4,0x64,0x65,0x66,0x20,0x64,0x6f,0x28,0x74,0x29,0x3a,0x00,0x00,
+0x33,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x18,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x23,0x01,0x00,0x00,
+0x1f,0x0c,0x01,0xc5,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,0x2e,0x74,0x79,0x70,
+0x65,0x20,0x3d,0x3d,0x20,0x27,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x27,0x3a,0x20,0x72,
+0x20,0x3d,0x20,0x67,0x6d,0x61,0x70,0x28,0x74,0x2c,0x20,0x74,0x2e,0x76,0x61,0x6c,
+0x29,0x00,0x00,0x00,0x0d,0x02,0x00,0x02,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,
+0x00,0x00,0x00,0x00,0x09,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x03,
+0x00,0x00,0x00,0x06,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x00,0x00,0x18,0x01,0x01,0x02,
+0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x0f,0x33,0x01,0x00,0x01,0x72,0x00,0x00,0x00,
+0x0e,0x02,0x00,0x04,0x00,0x00,0x00,0x04,0x67,0x6d,0x61,0x70,0x00,0x00,0x00,0x00,
+0x10,0x03,0x00,0x00,0x0d,0x01,0x00,0x05,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,
+0x09,0x04,0x00,0x01,0x00,0x00,0x00,0x01,0x37,0x01,0x02,0x03,0x13,0x00,0x00,0x16,
+0x1f,0x08,0x01,0xc6,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x3a,0x20,0x72,0x20,
+0x3d,0x20,0x67,0x6d,0x61,0x70,0x28,0x74,0x2c,0x20,0x74,0x2e,0x74,0x79,0x70,0x65,
+0x29,0x00,0x00,0x00,0x0e,0x02,0x00,0x04,0x00,0x00,0x00,0x04,0x67,0x6d,0x61,0x70,
+0x00,0x00,0x00,0x00,0x10,0x03,0x00,0x00,0x0d,0x01,0x00,0x02,0x00,0x00,0x00,0x04,
+0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x09,0x04,0x00,0x01,0x00,0x00,0x00,0x02,
+0x37,0x01,0x02,0x03,0x1f,0x04,0x01,0xc7,0x20,0x20,0x20,0x20,0x6d,0x65,0x72,0x67,
+0x65,0x28,0x74,0x2c,0x20,0x72,0x29,0x00,0x0e,0x02,0x00,0x06,0x00,0x00,0x00,0x05,
+0x6d,0x65,0x72,0x67,0x65,0x00,0x00,0x00,0x10,0x03,0x00,0x00,0x10,0x04,0x01,0x00,
+0x37,0x02,0x02,0x03,0x1f,0x04,0x01,0xc8,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x74,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x2d,0x00,0x9d,0x00,0x00,0x00,0x02,0x64,0x6f,0x00,0x00,0x0f,0x2d,0x2c,0x00,
+0x1f,0x05,0x01,0xc9,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x6d,0x6f,0x64,0x75,0x6c,
+0x65,0x28,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x2d,0x00,0x05,0x2a,0x24,0x36,0x39,
+0x38,0x00,0x00,0x00,0x1c,0x2e,0x00,0x00,0x1c,0x2f,0x00,0x00,0x1d,0x30,0x00,0x00,
+0x1d,0x31,0x00,0x00,0x11,0x2d,0x00,0x95,0x2d,0x08,0x00,0x0e,0x00,0x00,0x00,0x03,
+0x1f,0x05,0x01,0xc9,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x6d,0x6f,0x64,0x75,0x6c,
+0x65,0x28,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x0b,0x5f,0x5f,0x76,0x61,
+0x72,0x61,0x72,0x67,0x73,0x5f,0x5f,0x00,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x18,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,0x22,0x00,0x00,0x00,
+0x0d,0x00,0x00,0x01,0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x6d,0x6f,0x64,0x75,0x6c,
+0x65,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x1f,0x05,0x01,0xca,0x20,0x20,0x20,0x20,
+0x74,0x6f,0x6b,0x20,0x3d,0x20,0x50,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,
+0x33,0x00,0x00,0x03,0x74,0x6f,0x6b,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x01,
+0x50,0x00,0x00,0x00,0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x05,0x74,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x09,0x00,0x01,0x02,0x00,0x00,0x00,0x00,0x1f,0x04,0x01,0xcb,
+0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,0x73,0x20,0x3d,0x20,0x5b,0x5d,0x00,0x00,
+0x33,0x01,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x1c,0x01,0x00,0x00,
+0x1f,0x05,0x01,0xcc,0x20,0x20,0x20,0x20,0x69,0x62,0x6c,0x6f,0x63,0x6b,0x28,0x69,
+0x74,0x65,0x6d,0x73,0x29,0x00,0x00,0x00,0x0e,0x03,0x00,0x04,0x00,0x00,0x00,0x06,
+0x69,0x62,0x6c,0x6f,0x63,0x6b,0x00,0x00,0x10,0x04,0x01,0x00,0x37,0x02,0x03,0x02,
+0x1f,0x05,0x01,0xcd,0x20,0x20,0x20,0x20,0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x28,
+0x27,0x65,0x6f,0x66,0x27,0x29,0x00,0x00,0x0e,0x03,0x00,0x05,0x00,0x00,0x00,0x07,
+0x61,0x64,0x76,0x61,0x6e,0x63,0x65,0x00,0x0d,0x04,0x00,0x06,0x00,0x00,0x00,0x03,
+0x65,0x6f,0x66,0x00,0x37,0x02,0x03,0x02,0x1f,0x06,0x01,0xce,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x6c,0x65,0x6e,0x28,0x69,0x74,0x65,0x6d,0x73,0x29,0x20,0x3e,0x20,
+0x31,0x3a,0x00,0x00,0x0e,0x03,0x00,0x07,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,
+0x10,0x04,0x01,0x00,0x37,0x02,0x03,0x02,0x0c,0x03,0x00,0x08,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x36,0x02,0x02,0x03,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x24,
+0x1f,0x0e,0x01,0xcf,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x74,0x6f,0x6b,0x2e,0x70,0x6f,0x73,
+0x2c,0x27,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,0x74,0x73,0x27,0x2c,0x27,0x3b,
+0x27,0x2c,0x69,0x74,0x65,0x6d,0x73,0x29,0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x09,
+0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0d,0x02,0x00,0x0a,
+0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x09,0x04,0x00,0x02,0x00,0x00,0x00,0x01,
+0x0d,0x05,0x00,0x0b,0x00,0x00,0x00,0x0a,0x73,0x74,0x61,0x74,0x65,0x6d,0x65,0x6e,
+0x74,0x73,0x00,0x00,0x0d,0x06,0x00,0x0c,0x00,0x00,0x00,0x01,0x3b,0x00,0x00,0x00,
+0x10,0x07,0x01,0x00,0x37,0x02,0x03,0x05,0x15,0x02,0x00,0x00,0x1f,0x06,0x01,0xd0,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x69,0x74,0x65,0x6d,0x73,
+0x2e,0x70,0x6f,0x70,0x28,0x29,0x00,0x00,0x0d,0x05,0x00,0x0d,0x00,0x00,0x00,0x03,
+0x70,0x6f,0x70,0x00,0x38,0x03,0x01,0x05,0x00,0x00,0x00,0x02,0x39,0x02,0x03,0x02,
+0x15,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x2e,0x00,0x9e,0x00,0x00,0x00,0x09,
+0x64,0x6f,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x00,0x00,0x00,0x0f,0x2e,0x2d,0x00,
+0x1f,0x07,0x01,0xd2,0x64,0x65,0x66,0x20,0x70,0x61,0x72,0x73,0x65,0x28,0x73,0x2c,
+0x74,0x6f,0x6b,0x65,0x6e,0x73,0x2c,0x77,0x72,0x61,0x70,0x3d,0x30,0x29,0x3a,0x00,
+0x33,0x2e,0x00,0x05,0x2a,0x24,0x37,0x30,0x34,0x00,0x00,0x00,0x0d,0x33,0x00,0x9f,
+0x00,0x00,0x00,0x01,0x73,0x00,0x00,0x00,0x0d,0x34,0x00,0xa0,0x00,0x00,0x00,0x06,
+0x74,0x6f,0x6b,0x65,0x6e,0x73,0x00,0x00,0x0d,0x35,0x00,0xa1,0x00,0x00,0x00,0x04,
+0x77,0x72,0x61,0x70,0x00,0x00,0x00,0x00,0x1c,0x2f,0x33,0x03,0x0c,0x33,0x00,0x52,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x1c,0x30,0x33,0x01,0x1d,0x31,0x00,0x00,
+0x1d,0x32,0x00,0x00,0x11,0x2e,0x00,0x76,0x2d,0x07,0x00,0x08,0x00,0x00,0x00,0x02,
+0x1f,0x07,0x01,0xd2,0x64,0x65,0x66,0x20,0x70,0x61,0x72,0x73,0x65,0x28,0x73,0x2c,
+0x74,0x6f,0x6b,0x65,0x6e,0x73,0x2c,0x77,0x72,0x61,0x70,0x3d,0x30,0x29,0x3a,0x00,
+0x33,0x00,0x00,0x01,0x73,0x00,0x00,0x00,0x33,0x01,0x00,0x06,0x74,0x6f,0x6b,0x65,
+0x6e,0x73,0x00,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x61,0x72,0x73,
+0x65,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,
+0x00,0x00,0x00,0x05,0x70,0x61,0x72,0x73,0x65,0x00,0x00,0x00,0x23,0x02,0x00,0x00,
+0x1f,0x04,0x01,0xd3,0x20,0x20,0x20,0x20,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x20,0x50,
+0x00,0x00,0x00,0x00,0x1f,0x07,0x01,0xd4,0x20,0x20,0x20,0x20,0x73,0x20,0x3d,0x20,
+0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x2e,0x63,0x6c,0x65,0x61,0x6e,0x28,0x73,
+0x29,0x00,0x00,0x00,0x0e,0x06,0x00,0x02,0x00,0x00,0x00,0x08,0x74,0x6f,0x6b,0x65,
+0x6e,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x05,
+0x63,0x6c,0x65,0x61,0x6e,0x00,0x00,0x00,0x38,0x03,0x06,0x02,0x00,0x00,0x00,0x00,
+0x10,0x05,0x00,0x00,0x39,0x00,0x03,0x03,0x1f,0x08,0x01,0xd5,0x20,0x20,0x20,0x20,
+0x50,0x3d,0x50,0x44,0x61,0x74,0x61,0x28,0x73,0x2c,0x74,0x6f,0x6b,0x65,0x6e,0x73,
+0x29,0x3b,0x20,0x50,0x2e,0x69,0x6e,0x69,0x74,0x28,0x29,0x00,0x0d,0x02,0x00,0x04,
+0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x0e,0x04,0x00,0x05,0x00,0x00,0x00,0x05,
+0x50,0x44,0x61,0x74,0x61,0x00,0x00,0x00,0x10,0x05,0x00,0x00,0x10,0x06,0x01,0x00,
+0x37,0x03,0x04,0x03,0x0f,0x02,0x03,0x00,0x0e,0x05,0x00,0x04,0x00,0x00,0x00,0x01,
+0x50,0x00,0x00,0x00,0x0d,0x06,0x00,0x06,0x00,0x00,0x00,0x04,0x69,0x6e,0x69,0x74,
+0x00,0x00,0x00,0x00,0x38,0x03,0x05,0x06,0x00,0x00,0x00,0x01,0x39,0x02,0x03,0x02,
+0x1f,0x05,0x01,0xd6,0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x64,0x6f,0x5f,0x6d,
+0x6f,0x64,0x75,0x6c,0x65,0x28,0x29,0x00,0x33,0x02,0x00,0x01,0x72,0x00,0x00,0x00,
+0x0e,0x04,0x00,0x07,0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x6d,0x6f,0x64,0x75,0x6c,
+0x65,0x00,0x00,0x00,0x37,0x02,0x04,0x01,0x1f,0x04,0x01,0xd7,0x20,0x20,0x20,0x20,
+0x50,0x20,0x3d,0x20,0x4e,0x6f,0x6e,0x65,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x04,
+0x00,0x00,0x00,0x01,0x50,0x00,0x00,0x00,0x1d,0x04,0x00,0x00,0x0f,0x03,0x04,0x00,
+0x1f,0x04,0x01,0xd8,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,
+0x00,0x00,0x00,0x00,0x15,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x2f,0x00,0xa2,
+0x00,0x00,0x00,0x05,0x70,0x61,0x72,0x73,0x65,0x00,0x00,0x00,0x0f,0x2f,0x2e,0x00,
+0x00,0x00,0x00,0x00,
+};
+
+static tpd_code * _tp_tinypy_compiler_parse_0(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 14: goto L14;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 33: goto L33;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 62: goto L62;
+        case 67: goto L67;
+        case 76: goto L76;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 87: goto L87;
+        case 88: goto L88;
+        case 98: goto L98;
+        case 103: goto L103;
+        case 111: goto L111;
+        case 114: goto L114;
+        case 115: goto L115;
+        case 120: goto L120;
+        case 121: goto L121;
+        case 127: goto L127;
+        case 130: goto L130;
+        case 133: goto L133;
+        case 134: goto L134;
+        case 135: goto L135;
+        case 138: goto L138;
+        case 139: goto L139;
+        case 263: goto L263;
+        case 267: goto L267;
+        case 268: goto L268;
+        case 273: goto L273;
+        case 276: goto L276;
+        case 279: goto L279;
+        case 282: goto L282;
+        case 283: goto L283;
+        case 284: goto L284;
+        case 285: goto L285;
+        case 286: goto L286;
+        case 398: goto L398;
+        case 402: goto L402;
+        case 403: goto L403;
+        case 408: goto L408;
+        case 411: goto L411;
+        case 412: goto L412;
+        case 413: goto L413;
+        case 414: goto L414;
+        case 415: goto L415;
+        case 489: goto L489;
+        case 493: goto L493;
+        case 494: goto L494;
+        case 498: goto L498;
+        case 501: goto L501;
+        case 504: goto L504;
+        case 505: goto L505;
+        case 506: goto L506;
+        case 507: goto L507;
+        case 508: goto L508;
+        case 565: goto L565;
+        case 568: goto L568;
+        case 569: goto L569;
+        case 574: goto L574;
+        case 575: goto L575;
+        case 578: goto L578;
+        case 582: goto L582;
+        case 583: goto L583;
+        case 587: goto L587;
+        case 588: goto L588;
+        case 592: goto L592;
+        case 593: goto L593;
+        case 596: goto L596;
+        case 597: goto L597;
+        case 598: goto L598;
+        case 599: goto L599;
+        case 600: goto L600;
+        case 1344: goto L1344;
+        case 1345: goto L1345;
+        case 1346: goto L1346;
+        case 1347: goto L1347;
+        case 1353: goto L1353;
+        case 1356: goto L1356;
+        case 1359: goto L1359;
+        case 1362: goto L1362;
+        case 1363: goto L1363;
+        case 1364: goto L1364;
+        case 1365: goto L1365;
+        case 1366: goto L1366;
+        case 1431: goto L1431;
+        case 1435: goto L1435;
+        case 1436: goto L1436;
+        case 1440: goto L1440;
+        case 1443: goto L1443;
+        case 1446: goto L1446;
+        case 1447: goto L1447;
+        case 1448: goto L1448;
+        case 1449: goto L1449;
+        case 1450: goto L1450;
+        case 1488: goto L1488;
+        case 1491: goto L1491;
+        case 1492: goto L1492;
+        case 1498: goto L1498;
+        case 1501: goto L1501;
+        case 1504: goto L1504;
+        case 1508: goto L1508;
+        case 1509: goto L1509;
+        case 1510: goto L1510;
+        case 1511: goto L1511;
+        case 1512: goto L1512;
+        case 1558: goto L1558;
+        case 1561: goto L1561;
+        case 1562: goto L1562;
+        case 1567: goto L1567;
+        case 1570: goto L1570;
+        case 1573: goto L1573;
+        case 1574: goto L1574;
+        case 1575: goto L1575;
+        case 1576: goto L1576;
+        case 1577: goto L1577;
+        case 1615: goto L1615;
+        case 1619: goto L1619;
+        case 1620: goto L1620;
+        case 1626: goto L1626;
+        case 1629: goto L1629;
+        case 1632: goto L1632;
+        case 1633: goto L1633;
+        case 1634: goto L1634;
+        case 1635: goto L1635;
+        case 1636: goto L1636;
+        case 1677: goto L1677;
+        case 1682: goto L1682;
+        case 1683: goto L1683;
+        case 1692: goto L1692;
+        case 1695: goto L1695;
+        case 1698: goto L1698;
+        case 1702: goto L1702;
+        case 1703: goto L1703;
+        case 1704: goto L1704;
+        case 1705: goto L1705;
+        case 1706: goto L1706;
+        case 1707: goto L1707;
+        case 1866: goto L1866;
+        case 1871: goto L1871;
+        case 1872: goto L1872;
+        case 1879: goto L1879;
+        case 1882: goto L1882;
+        case 1885: goto L1885;
+        case 1889: goto L1889;
+        case 1890: goto L1890;
+        case 1891: goto L1891;
+        case 1892: goto L1892;
+        case 1893: goto L1893;
+        case 1959: goto L1959;
+        case 1964: goto L1964;
+        case 1965: goto L1965;
+        case 1972: goto L1972;
+        case 1975: goto L1975;
+        case 1978: goto L1978;
+        case 1982: goto L1982;
+        case 1983: goto L1983;
+        case 1984: goto L1984;
+        case 1985: goto L1985;
+        case 1986: goto L1986;
+        case 2111: goto L2111;
+        case 2116: goto L2116;
+        case 2117: goto L2117;
+        case 2124: goto L2124;
+        case 2127: goto L2127;
+        case 2130: goto L2130;
+        case 2134: goto L2134;
+        case 2135: goto L2135;
+        case 2136: goto L2136;
+        case 2137: goto L2137;
+        case 2138: goto L2138;
+        case 2233: goto L2233;
+        case 2238: goto L2238;
+        case 2239: goto L2239;
+        case 2247: goto L2247;
+        case 2250: goto L2250;
+        case 2253: goto L2253;
+        case 2257: goto L2257;
+        case 2258: goto L2258;
+        case 2259: goto L2259;
+        case 2260: goto L2260;
+        case 2261: goto L2261;
+        case 2400: goto L2400;
+        case 2405: goto L2405;
+        case 2406: goto L2406;
+        case 2410: goto L2410;
+        case 2413: goto L2413;
+        case 2416: goto L2416;
+        case 2417: goto L2417;
+        case 2418: goto L2418;
+        case 2419: goto L2419;
+        case 2420: goto L2420;
+        case 2514: goto L2514;
+        case 2517: goto L2517;
+        case 2518: goto L2518;
+        case 2524: goto L2524;
+        case 2527: goto L2527;
+        case 2530: goto L2530;
+        case 2533: goto L2533;
+        case 2534: goto L2534;
+        case 2535: goto L2535;
+        case 2536: goto L2536;
+        case 2537: goto L2537;
+        case 2595: goto L2595;
+        case 2599: goto L2599;
+        case 2600: goto L2600;
+        case 2607: goto L2607;
+        case 2610: goto L2610;
+        case 2613: goto L2613;
+        case 2617: goto L2617;
+        case 2618: goto L2618;
+        case 2619: goto L2619;
+        case 2620: goto L2620;
+        case 2621: goto L2621;
+        case 2837: goto L2837;
+        case 2842: goto L2842;
+        case 2843: goto L2843;
+        case 2850: goto L2850;
+        case 2853: goto L2853;
+        case 2856: goto L2856;
+        case 2860: goto L2860;
+        case 2861: goto L2861;
+        case 2862: goto L2862;
+        case 2863: goto L2863;
+        case 2864: goto L2864;
+        case 3297: goto L3297;
+        case 3301: goto L3301;
+        case 3302: goto L3302;
+        case 3309: goto L3309;
+        case 3312: goto L3312;
+        case 3315: goto L3315;
+        case 3319: goto L3319;
+        case 3320: goto L3320;
+        case 3321: goto L3321;
+        case 3322: goto L3322;
+        case 3323: goto L3323;
+        case 3421: goto L3421;
+        case 3425: goto L3425;
+        case 3426: goto L3426;
+        case 3431: goto L3431;
+        case 3434: goto L3434;
+        case 3437: goto L3437;
+        case 3438: goto L3438;
+        case 3439: goto L3439;
+        case 3440: goto L3440;
+        case 3441: goto L3441;
+        case 3473: goto L3473;
+        case 3477: goto L3477;
+        case 3478: goto L3478;
+        case 3484: goto L3484;
+        case 3487: goto L3487;
+        case 3490: goto L3490;
+        case 3491: goto L3491;
+        case 3492: goto L3492;
+        case 3493: goto L3493;
+        case 3494: goto L3494;
+        case 3587: goto L3587;
+        case 3592: goto L3592;
+        case 3593: goto L3593;
+        case 3599: goto L3599;
+        case 3602: goto L3602;
+        case 3605: goto L3605;
+        case 3606: goto L3606;
+        case 3607: goto L3607;
+        case 3608: goto L3608;
+        case 3609: goto L3609;
+        case 4055: goto L4055;
+        case 4060: goto L4060;
+        case 4061: goto L4061;
+        case 4067: goto L4067;
+        case 4070: goto L4070;
+        case 4073: goto L4073;
+        case 4074: goto L4074;
+        case 4075: goto L4075;
+        case 4076: goto L4076;
+        case 4077: goto L4077;
+        case 4295: goto L4295;
+        case 4300: goto L4300;
+        case 4301: goto L4301;
+        case 4308: goto L4308;
+        case 4311: goto L4311;
+        case 4314: goto L4314;
+        case 4315: goto L4315;
+        case 4316: goto L4316;
+        case 4317: goto L4317;
+        case 4318: goto L4318;
+        case 4319: goto L4319;
+        case 4366: goto L4366;
+        case 4370: goto L4370;
+        case 4371: goto L4371;
+        case 4377: goto L4377;
+        case 4380: goto L4380;
+        case 4384: goto L4384;
+        case 4385: goto L4385;
+        case 4386: goto L4386;
+        case 4387: goto L4387;
+        case 4388: goto L4388;
+        case 4589: goto L4589;
+        case 4593: goto L4593;
+        case 4594: goto L4594;
+        case 4599: goto L4599;
+        case 4602: goto L4602;
+        case 4603: goto L4603;
+        case 4604: goto L4604;
+        case 4605: goto L4605;
+        case 4606: goto L4606;
+        case 4998: goto L4998;
+        case 5002: goto L5002;
+        case 5003: goto L5003;
+        case 5008: goto L5008;
+        case 5011: goto L5011;
+        case 5014: goto L5014;
+        case 5015: goto L5015;
+        case 5016: goto L5016;
+        case 5017: goto L5017;
+        case 5018: goto L5018;
+        case 5338: goto L5338;
+        case 5342: goto L5342;
+        case 5343: goto L5343;
+        case 5349: goto L5349;
+        case 5352: goto L5352;
+        case 5355: goto L5355;
+        case 5356: goto L5356;
+        case 5357: goto L5357;
+        case 5358: goto L5358;
+        case 5359: goto L5359;
+        case 5470: goto L5470;
+        case 5475: goto L5475;
+        case 5476: goto L5476;
+        case 5482: goto L5482;
+        case 5485: goto L5485;
+        case 5488: goto L5488;
+        case 5489: goto L5489;
+        case 5490: goto L5490;
+        case 5491: goto L5491;
+        case 5492: goto L5492;
+        case 5618: goto L5618;
+        case 5623: goto L5623;
+        case 5624: goto L5624;
+        case 5630: goto L5630;
+        case 5633: goto L5633;
+        case 5636: goto L5636;
+        case 5637: goto L5637;
+        case 5638: goto L5638;
+        case 5639: goto L5639;
+        case 5640: goto L5640;
+        case 5923: goto L5923;
+        case 5928: goto L5928;
+        case 5929: goto L5929;
+        case 5935: goto L5935;
+        case 5938: goto L5938;
+        case 5941: goto L5941;
+        case 5942: goto L5942;
+        case 5943: goto L5943;
+        case 5944: goto L5944;
+        case 5945: goto L5945;
+        case 6256: goto L6256;
+        case 6261: goto L6261;
+        case 6262: goto L6262;
+        case 6267: goto L6267;
+        case 6270: goto L6270;
+        case 6273: goto L6273;
+        case 6274: goto L6274;
+        case 6275: goto L6275;
+        case 6276: goto L6276;
+        case 6277: goto L6277;
+        case 6452: goto L6452;
+        case 6456: goto L6456;
+        case 6457: goto L6457;
+        case 6462: goto L6462;
+        case 6465: goto L6465;
+        case 6468: goto L6468;
+        case 6469: goto L6469;
+        case 6470: goto L6470;
+        case 6471: goto L6471;
+        case 6472: goto L6472;
+        case 6889: goto L6889;
+        case 6893: goto L6893;
+        case 6894: goto L6894;
+        case 6899: goto L6899;
+        case 6902: goto L6902;
+        case 6905: goto L6905;
+        case 6906: goto L6906;
+        case 6907: goto L6907;
+        case 6908: goto L6908;
+        case 6909: goto L6909;
+        case 7214: goto L7214;
+        case 7218: goto L7218;
+        case 7219: goto L7219;
+        case 7225: goto L7225;
+        case 7228: goto L7228;
+        case 7231: goto L7231;
+        case 7232: goto L7232;
+        case 7233: goto L7233;
+        case 7234: goto L7234;
+        case 7235: goto L7235;
+        case 7303: goto L7303;
+        case 7308: goto L7308;
+        case 7309: goto L7309;
+        case 7315: goto L7315;
+        case 7318: goto L7318;
+        case 7321: goto L7321;
+        case 7322: goto L7322;
+        case 7323: goto L7323;
+        case 7324: goto L7324;
+        case 7325: goto L7325;
+        case 7414: goto L7414;
+        case 7419: goto L7419;
+        case 7420: goto L7420;
+        case 7426: goto L7426;
+        case 7429: goto L7429;
+        case 7432: goto L7432;
+        case 7433: goto L7433;
+        case 7434: goto L7434;
+        case 7435: goto L7435;
+        case 7436: goto L7436;
+        case 7503: goto L7503;
+        case 7508: goto L7508;
+        case 7509: goto L7509;
+        case 7515: goto L7515;
+        case 7518: goto L7518;
+        case 7521: goto L7521;
+        case 7522: goto L7522;
+        case 7523: goto L7523;
+        case 7524: goto L7524;
+        case 7525: goto L7525;
+        case 7733: goto L7733;
+        case 7738: goto L7738;
+        case 7739: goto L7739;
+        case 7745: goto L7745;
+        case 7748: goto L7748;
+        case 7751: goto L7751;
+        case 7752: goto L7752;
+        case 7753: goto L7753;
+        case 7754: goto L7754;
+        case 7755: goto L7755;
+        case 7833: goto L7833;
+        case 7838: goto L7838;
+        case 7839: goto L7839;
+        case 7845: goto L7845;
+        case 7848: goto L7848;
+        case 7851: goto L7851;
+        case 7852: goto L7852;
+        case 7853: goto L7853;
+        case 7854: goto L7854;
+        case 7855: goto L7855;
+        case 7934: goto L7934;
+        case 7939: goto L7939;
+        case 7940: goto L7940;
+        case 7945: goto L7945;
+        case 7950: goto L7950;
+        case 7963: goto L7963;
+        case 7966: goto L7966;
+        case 7969: goto L7969;
+        case 7972: goto L7972;
+        case 7975: goto L7975;
+        case 7978: goto L7978;
+        case 7981: goto L7981;
+        case 7986: goto L7986;
+        case 7987: goto L7987;
+        case 7999: goto L7999;
+        case 8002: goto L8002;
+        case 8005: goto L8005;
+        case 8008: goto L8008;
+        case 8011: goto L8011;
+        case 8014: goto L8014;
+        case 8017: goto L8017;
+        case 8022: goto L8022;
+        case 8023: goto L8023;
+        case 8033: goto L8033;
+        case 8036: goto L8036;
+        case 8039: goto L8039;
+        case 8042: goto L8042;
+        case 8045: goto L8045;
+        case 8050: goto L8050;
+        case 8060: goto L8060;
+        case 8063: goto L8063;
+        case 8066: goto L8066;
+        case 8069: goto L8069;
+        case 8074: goto L8074;
+        case 8075: goto L8075;
+        case 8088: goto L8088;
+        case 8091: goto L8091;
+        case 8094: goto L8094;
+        case 8097: goto L8097;
+        case 8100: goto L8100;
+        case 8105: goto L8105;
+        case 8108: goto L8108;
+        case 8111: goto L8111;
+        case 8121: goto L8121;
+        case 8124: goto L8124;
+        case 8127: goto L8127;
+        case 8130: goto L8130;
+        case 8135: goto L8135;
+        case 8136: goto L8136;
+        case 8148: goto L8148;
+        case 8151: goto L8151;
+        case 8154: goto L8154;
+        case 8157: goto L8157;
+        case 8160: goto L8160;
+        case 8163: goto L8163;
+        case 8166: goto L8166;
+        case 8171: goto L8171;
+        case 8172: goto L8172;
+        case 8182: goto L8182;
+        case 8185: goto L8185;
+        case 8188: goto L8188;
+        case 8191: goto L8191;
+        case 8194: goto L8194;
+        case 8199: goto L8199;
+        case 8209: goto L8209;
+        case 8212: goto L8212;
+        case 8215: goto L8215;
+        case 8218: goto L8218;
+        case 8223: goto L8223;
+        case 8224: goto L8224;
+        case 8235: goto L8235;
+        case 8238: goto L8238;
+        case 8241: goto L8241;
+        case 8244: goto L8244;
+        case 8247: goto L8247;
+        case 8252: goto L8252;
+        case 8262: goto L8262;
+        case 8265: goto L8265;
+        case 8268: goto L8268;
+        case 8271: goto L8271;
+        case 8276: goto L8276;
+        case 8277: goto L8277;
+        case 8289: goto L8289;
+        case 8292: goto L8292;
+        case 8295: goto L8295;
+        case 8298: goto L8298;
+        case 8301: goto L8301;
+        case 8304: goto L8304;
+        case 8307: goto L8307;
+        case 8312: goto L8312;
+        case 8313: goto L8313;
+        case 8323: goto L8323;
+        case 8326: goto L8326;
+        case 8329: goto L8329;
+        case 8332: goto L8332;
+        case 8335: goto L8335;
+        case 8340: goto L8340;
+        case 8350: goto L8350;
+        case 8353: goto L8353;
+        case 8356: goto L8356;
+        case 8359: goto L8359;
+        case 8364: goto L8364;
+        case 8365: goto L8365;
+        case 8375: goto L8375;
+        case 8378: goto L8378;
+        case 8381: goto L8381;
+        case 8384: goto L8384;
+        case 8387: goto L8387;
+        case 8392: goto L8392;
+        case 8402: goto L8402;
+        case 8405: goto L8405;
+        case 8408: goto L8408;
+        case 8411: goto L8411;
+        case 8415: goto L8415;
+        case 8416: goto L8416;
+        case 8426: goto L8426;
+        case 8429: goto L8429;
+        case 8432: goto L8432;
+        case 8435: goto L8435;
+        case 8438: goto L8438;
+        case 8443: goto L8443;
+        case 8444: goto L8444;
+        case 8460: goto L8460;
+        case 8463: goto L8463;
+        case 8466: goto L8466;
+        case 8469: goto L8469;
+        case 8472: goto L8472;
+        case 8475: goto L8475;
+        case 8478: goto L8478;
+        case 8482: goto L8482;
+        case 8486: goto L8486;
+        case 8490: goto L8490;
+        case 8491: goto L8491;
+        case 8505: goto L8505;
+        case 8509: goto L8509;
+        case 8512: goto L8512;
+        case 8515: goto L8515;
+        case 8518: goto L8518;
+        case 8522: goto L8522;
+        case 8526: goto L8526;
+        case 8530: goto L8530;
+        case 8531: goto L8531;
+        case 8545: goto L8545;
+        case 8549: goto L8549;
+        case 8552: goto L8552;
+        case 8555: goto L8555;
+        case 8558: goto L8558;
+        case 8562: goto L8562;
+        case 8566: goto L8566;
+        case 8570: goto L8570;
+        case 8571: goto L8571;
+        case 8587: goto L8587;
+        case 8592: goto L8592;
+        case 8595: goto L8595;
+        case 8598: goto L8598;
+        case 8601: goto L8601;
+        case 8605: goto L8605;
+        case 8609: goto L8609;
+        case 8614: goto L8614;
+        case 8615: goto L8615;
+        case 8628: goto L8628;
+        case 8631: goto L8631;
+        case 8634: goto L8634;
+        case 8637: goto L8637;
+        case 8641: goto L8641;
+        case 8644: goto L8644;
+        case 8647: goto L8647;
+        case 8650: goto L8650;
+        case 8651: goto L8651;
+        case 8665: goto L8665;
+        case 8668: goto L8668;
+        case 8671: goto L8671;
+        case 8674: goto L8674;
+        case 8677: goto L8677;
+        case 8681: goto L8681;
+        case 8685: goto L8685;
+        case 8688: goto L8688;
+        case 8689: goto L8689;
+        case 8704: goto L8704;
+        case 8708: goto L8708;
+        case 8711: goto L8711;
+        case 8714: goto L8714;
+        case 8717: goto L8717;
+        case 8722: goto L8722;
+        case 8726: goto L8726;
+        case 8730: goto L8730;
+        case 8731: goto L8731;
+        case 8745: goto L8745;
+        case 8748: goto L8748;
+        case 8751: goto L8751;
+        case 8754: goto L8754;
+        case 8757: goto L8757;
+        case 8761: goto L8761;
+        case 8765: goto L8765;
+        case 8768: goto L8768;
+        case 8769: goto L8769;
+        case 8783: goto L8783;
+        case 8786: goto L8786;
+        case 8789: goto L8789;
+        case 8792: goto L8792;
+        case 8795: goto L8795;
+        case 8799: goto L8799;
+        case 8803: goto L8803;
+        case 8806: goto L8806;
+        case 8807: goto L8807;
+        case 8820: goto L8820;
+        case 8823: goto L8823;
+        case 8826: goto L8826;
+        case 8829: goto L8829;
+        case 8832: goto L8832;
+        case 8836: goto L8836;
+        case 8840: goto L8840;
+        case 8843: goto L8843;
+        case 8844: goto L8844;
+        case 8859: goto L8859;
+        case 8863: goto L8863;
+        case 8866: goto L8866;
+        case 8869: goto L8869;
+        case 8872: goto L8872;
+        case 8877: goto L8877;
+        case 8881: goto L8881;
+        case 8885: goto L8885;
+        case 8886: goto L8886;
+        case 8904: goto L8904;
+        case 8908: goto L8908;
+        case 8911: goto L8911;
+        case 8914: goto L8914;
+        case 8917: goto L8917;
+        case 8922: goto L8922;
+        case 8926: goto L8926;
+        case 8930: goto L8930;
+        case 8933: goto L8933;
+        case 8936: goto L8936;
+        case 8937: goto L8937;
+        case 8955: goto L8955;
+        case 8959: goto L8959;
+        case 8962: goto L8962;
+        case 8965: goto L8965;
+        case 8968: goto L8968;
+        case 8973: goto L8973;
+        case 8977: goto L8977;
+        case 8981: goto L8981;
+        case 8984: goto L8984;
+        case 8987: goto L8987;
+        case 8988: goto L8988;
+        case 9006: goto L9006;
+        case 9010: goto L9010;
+        case 9013: goto L9013;
+        case 9016: goto L9016;
+        case 9019: goto L9019;
+        case 9024: goto L9024;
+        case 9028: goto L9028;
+        case 9032: goto L9032;
+        case 9035: goto L9035;
+        case 9038: goto L9038;
+        case 9039: goto L9039;
+        case 9057: goto L9057;
+        case 9061: goto L9061;
+        case 9064: goto L9064;
+        case 9067: goto L9067;
+        case 9070: goto L9070;
+        case 9075: goto L9075;
+        case 9079: goto L9079;
+        case 9083: goto L9083;
+        case 9086: goto L9086;
+        case 9089: goto L9089;
+        case 9090: goto L9090;
+        case 9106: goto L9106;
+        case 9110: goto L9110;
+        case 9113: goto L9113;
+        case 9116: goto L9116;
+        case 9119: goto L9119;
+        case 9124: goto L9124;
+        case 9128: goto L9128;
+        case 9132: goto L9132;
+        case 9135: goto L9135;
+        case 9138: goto L9138;
+        case 9139: goto L9139;
+        case 9156: goto L9156;
+        case 9159: goto L9159;
+        case 9162: goto L9162;
+        case 9165: goto L9165;
+        case 9168: goto L9168;
+        case 9173: goto L9173;
+        case 9177: goto L9177;
+        case 9180: goto L9180;
+        case 9183: goto L9183;
+        case 9186: goto L9186;
+        case 9187: goto L9187;
+        case 9205: goto L9205;
+        case 9209: goto L9209;
+        case 9212: goto L9212;
+        case 9215: goto L9215;
+        case 9218: goto L9218;
+        case 9223: goto L9223;
+        case 9227: goto L9227;
+        case 9231: goto L9231;
+        case 9234: goto L9234;
+        case 9237: goto L9237;
+        case 9238: goto L9238;
+        case 9242: goto L9242;
+        case 9245: goto L9245;
+        case 9257: goto L9257;
+        case 9260: goto L9260;
+        case 9263: goto L9263;
+        case 9266: goto L9266;
+        case 9269: goto L9269;
+        case 9272: goto L9272;
+        case 9277: goto L9277;
+        case 9278: goto L9278;
+        case 9279: goto L9279;
+        case 9280: goto L9280;
+        case 9288: goto L9288;
+        case 9291: goto L9291;
+        case 9294: goto L9294;
+        case 9297: goto L9297;
+        case 9298: goto L9298;
+        case 9299: goto L9299;
+        case 9302: goto L9302;
+        case 9303: goto L9303;
+        case 9381: goto L9381;
+        case 9385: goto L9385;
+        case 9386: goto L9386;
+        case 9400: goto L9400;
+        case 9404: goto L9404;
+        case 9407: goto L9407;
+        case 9412: goto L9412;
+        case 9415: goto L9415;
+        case 9418: goto L9418;
+        case 9421: goto L9421;
+        case 9424: goto L9424;
+        case 9427: goto L9427;
+        case 9430: goto L9430;
+        case 9431: goto L9431;
+        case 9440: goto L9440;
+        case 9444: goto L9444;
+        case 9447: goto L9447;
+        case 9452: goto L9452;
+        case 9455: goto L9455;
+        case 9458: goto L9458;
+        case 9459: goto L9459;
+        case 9475: goto L9475;
+        case 9479: goto L9479;
+        case 9482: goto L9482;
+        case 9487: goto L9487;
+        case 9490: goto L9490;
+        case 9493: goto L9493;
+        case 9496: goto L9496;
+        case 9499: goto L9499;
+        case 9502: goto L9502;
+        case 9505: goto L9505;
+        case 9508: goto L9508;
+        case 9509: goto L9509;
+        case 9518: goto L9518;
+        case 9522: goto L9522;
+        case 9525: goto L9525;
+        case 9530: goto L9530;
+        case 9533: goto L9533;
+        case 9536: goto L9536;
+        case 9537: goto L9537;
+        case 9545: goto L9545;
+        case 9549: goto L9549;
+        case 9552: goto L9552;
+        case 9557: goto L9557;
+        case 9560: goto L9560;
+        case 9561: goto L9561;
+        case 9570: goto L9570;
+        case 9574: goto L9574;
+        case 9577: goto L9577;
+        case 9582: goto L9582;
+        case 9585: goto L9585;
+        case 9588: goto L9588;
+        case 9589: goto L9589;
+        case 9598: goto L9598;
+        case 9602: goto L9602;
+        case 9605: goto L9605;
+        case 9610: goto L9610;
+        case 9613: goto L9613;
+        case 9616: goto L9616;
+        case 9617: goto L9617;
+        case 9623: goto L9623;
+        case 9626: goto L9626;
+        case 9627: goto L9627;
+        case 9628: goto L9628;
+        case 9631: goto L9631;
+        case 9632: goto L9632;
+        case 9703: goto L9703;
+        case 9707: goto L9707;
+        case 9708: goto L9708;
+        case 9744: goto L9744;
+        case 9748: goto L9748;
+        case 9751: goto L9751;
+        case 9754: goto L9754;
+        case 9757: goto L9757;
+        case 9760: goto L9760;
+        case 9763: goto L9763;
+        case 9766: goto L9766;
+        case 9769: goto L9769;
+        case 9773: goto L9773;
+        case 9777: goto L9777;
+        case 9781: goto L9781;
+        case 9785: goto L9785;
+        case 9789: goto L9789;
+        case 9793: goto L9793;
+        case 9797: goto L9797;
+        case 9801: goto L9801;
+        case 9805: goto L9805;
+        case 9809: goto L9809;
+        case 9813: goto L9813;
+        case 9817: goto L9817;
+        case 9818: goto L9818;
+        case 9827: goto L9827;
+        case 9832: goto L9832;
+        case 9835: goto L9835;
+        case 9836: goto L9836;
+        case 9839: goto L9839;
+        case 9842: goto L9842;
+        case 9843: goto L9843;
+        case 9848: goto L9848;
+        case 9851: goto L9851;
+        case 9854: goto L9854;
+        case 9857: goto L9857;
+        case 9858: goto L9858;
+        case 9859: goto L9859;
+        case 9860: goto L9860;
+        case 9861: goto L9861;
+        case 9938: goto L9938;
+        case 9942: goto L9942;
+        case 9943: goto L9943;
+        case 9947: goto L9947;
+        case 9950: goto L9950;
+        case 9953: goto L9953;
+        case 9954: goto L9954;
+        case 9955: goto L9955;
+        case 9956: goto L9956;
+        case 9957: goto L9957;
+        case 10060: goto L10060;
+        case 10063: goto L10063;
+        case 10064: goto L10064;
+        case 10070: goto L10070;
+        case 10073: goto L10073;
+        case 10074: goto L10074;
+        case 10075: goto L10075;
+        case 10076: goto L10076;
+        case 10077: goto L10077;
+        case 10226: goto L10226;
+        case 10231: goto L10231;
+        case 10232: goto L10232;
+        case 10240: goto L10240;
+        case 10243: goto L10243;
+        case 10246: goto L10246;
+        case 10250: goto L10250;
+        case 10254: goto L10254;
+        case 10255: goto L10255;
+        case 10258: goto L10258;
+        case 10259: goto L10259;
+        case 10260: goto L10260;
+        case 10261: goto L10261;
+        case 10379: goto L10379;
+        case 10383: goto L10383;
+        case 10384: goto L10384;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 1;
+L14: /* STRING */
+    tp_aot_op(tp, f, code + 14);
+L23: /* FILE */
+    f->fname = regs[0];
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L27: /* NAME */
+    f->name = regs[0];
+L28: /* GGET */
+    tp_aot_op(tp, f, code + 28);
+L33: /* STRING */
+    tp_aot_op(tp, f, code + 33);
+L42: /* NONE */
+    regs[3] = tp_None;
+L43: /* CALLP */
+    return code + 43;
+L44: /* STRING */
+    tp_aot_op(tp, f, code + 44);
+L49: /* GSET */
+    tp_set(tp, f->globals, regs[1], regs[0]);
+L50: /* LINE */
+    f->line = code + 50;
+    f->lineno = 2;
+L62: /* GGET */
+    tp_aot_op(tp, f, code + 62);
+L67: /* STRING */
+    tp_aot_op(tp, f, code + 67);
+L76: /* STRING */
+    tp_aot_op(tp, f, code + 76);
+L80: /* LIST */
+    tp_aot_op(tp, f, code + 80);
+L81: /* CALLP */
+    return code + 81;
+L82: /* GGET */
+    tp_aot_op(tp, f, code + 82);
+L87: /* UPDATE */
+    tp_aot_op(tp, f, code + 87);
+L88: /* LINE */
+    f->line = code + 88;
+    f->lineno = 3;
+L98: /* GGET */
+    tp_aot_op(tp, f, code + 98);
+L103: /* STRING */
+    tp_aot_op(tp, f, code + 103);
+L111: /* STRING */
+    tp_aot_op(tp, f, code + 111);
+L114: /* CALLP */
+    return code + 114;
+L115: /* GGET */
+    tp_aot_op(tp, f, code + 115);
+L120: /* UPDATE */
+    tp_aot_op(tp, f, code + 120);
+L121: /* LINE */
+    f->line = code + 121;
+    f->lineno = 5;
+L127: /* VAR */
+L130: /* STRING */
+    tp_aot_op(tp, f, code + 130);
+L133: /* LIST */
+    tp_aot_op(tp, f, code + 133);
+L134: /* LIST */
+    tp_aot_op(tp, f, code + 134);
+L135: /* STRING */
+    tp_aot_op(tp, f, code + 135);
+L138: /* NONE */
+    regs[4] = tp_None;
+L139: /* DEF */
+    tp_aot_op(tp, f, code + 139);
+L263: /* STRING */
+    tp_aot_op(tp, f, code + 263);
+L267: /* GSET */
+    tp_set(tp, f->globals, regs[1], regs[0]);
+L268: /* LINE */
+    f->line = code + 268;
+    f->lineno = 11;
+L273: /* VAR */
+L276: /* STRING */
+    tp_aot_op(tp, f, code + 276);
+L279: /* STRING */
+    tp_aot_op(tp, f, code + 279);
+L282: /* LIST */
+    tp_aot_op(tp, f, code + 282);
+L283: /* LIST */
+    tp_aot_op(tp, f, code + 283);
+L284: /* NONE */
+    regs[4] = tp_None;
+L285: /* NONE */
+    regs[5] = tp_None;
+L286: /* DEF */
+    tp_aot_op(tp, f, code + 286);
+L398: /* STRING */
+    tp_aot_op(tp, f, code + 398);
+L402: /* GSET */
+    tp_set(tp, f->globals, regs[2], regs[1]);
+L403: /* LINE */
+    f->line = code + 403;
+    f->lineno = 15;
+L408: /* VAR */
+L411: /* LIST */
+    tp_aot_op(tp, f, code + 411);
+L412: /* LIST */
+    tp_aot_op(tp, f, code + 412);
+L413: /* NONE */
+    regs[5] = tp_None;
+L414: /* NONE */
+    regs[6] = tp_None;
+L415: /* DEF */
+    tp_aot_op(tp, f, code + 415);
+L489: /* STRING */
+    tp_aot_op(tp, f, code + 489);
+L493: /* GSET */
+    tp_set(tp, f->globals, regs[3], regs[2]);
+L494: /* LINE */
+    f->line = code + 494;
+    f->lineno = 19;
+L498: /* VAR */
+L501: /* STRING */
+    tp_aot_op(tp, f, code + 501);
+L504: /* LIST */
+    tp_aot_op(tp, f, code + 504);
+L505: /* LIST */
+    tp_aot_op(tp, f, code + 505);
+L506: /* NONE */
+    regs[6] = tp_None;
+L507: /* NONE */
+    regs[7] = tp_None;
+L508: /* DEF */
+    tp_aot_op(tp, f, code + 508);
+L565: /* STRING */
+    tp_aot_op(tp, f, code + 565);
+L568: /* GSET */
+    tp_set(tp, f->globals, regs[4], regs[3]);
+L569: /* LINE */
+    f->line = code + 569;
+    f->lineno = 24;
+L574: /* CLASS */
+    regs[4] = tp_class(tp);
+L575: /* VAR */
+L578: /* STRING */
+    tp_aot_op(tp, f, code + 578);
+L582: /* GSET */
+    tp_set(tp, f->globals, regs[5], regs[4]);
+L583: /* GGET */
+    tp_aot_op(tp, f, code + 583);
+L587: /* MOVE */
+    regs[7] = regs[4];
+L588: /* GGET */
+    tp_aot_op(tp, f, code + 588);
+L592: /* CALLP */
+    return code + 592;
+L593: /* VAR */
+L596: /* LIST */
+    tp_aot_op(tp, f, code + 596);
+L597: /* LIST */
+    tp_aot_op(tp, f, code + 597);
+L598: /* NONE */
+    regs[7] = tp_None;
+L599: /* NONE */
+    regs[8] = tp_None;
+L600: /* DEF */
+    tp_aot_op(tp, f, code + 600);
+L1344: /* NONE */
+    regs[6] = tp_None;
+L1345: /* NONE */
+    regs[7] = tp_None;
+L1346: /* CALL */
+    return code + 1346;
+L1347: /* LINE */
+    f->line = code + 1347;
+    f->lineno = 56;
+L1353: /* VAR */
+L1356: /* STRING */
+    tp_aot_op(tp, f, code + 1356);
+L1359: /* STRING */
+    tp_aot_op(tp, f, code + 1359);
+L1362: /* LIST */
+    tp_aot_op(tp, f, code + 1362);
+L1363: /* LIST */
+    tp_aot_op(tp, f, code + 1363);
+L1364: /* NONE */
+    regs[8] = tp_None;
+L1365: /* NONE */
+    regs[9] = tp_None;
+L1366: /* DEF */
+    tp_aot_op(tp, f, code + 1366);
+L1431: /* STRING */
+    tp_aot_op(tp, f, code + 1431);
+L1435: /* GSET */
+    tp_set(tp, f->globals, regs[6], regs[5]);
+L1436: /* LINE */
+    f->line = code + 1436;
+    f->lineno = 59;
+L1440: /* VAR */
+L1443: /* STRING */
+    tp_aot_op(tp, f, code + 1443);
+L1446: /* LIST */
+    tp_aot_op(tp, f, code + 1446);
+L1447: /* LIST */
+    tp_aot_op(tp, f, code + 1447);
+L1448: /* NONE */
+    regs[9] = tp_None;
+L1449: /* NONE */
+    regs[10] = tp_None;
+L1450: /* DEF */
+    tp_aot_op(tp, f, code + 1450);
+L1488: /* STRING */
+    tp_aot_op(tp, f, code + 1488);
+L1491: /* GSET */
+    tp_set(tp, f->globals, regs[7], regs[6]);
+L1492: /* LINE */
+    f->line = code + 1492;
+    f->lineno = 63;
+L1498: /* VAR */
+L1501: /* STRING */
+    tp_aot_op(tp, f, code + 1501);
+L1504: /* STRING */
+    tp_aot_op(tp, f, code + 1504);
+L1508: /* LIST */
+    tp_aot_op(tp, f, code + 1508);
+L1509: /* LIST */
+    tp_aot_op(tp, f, code + 1509);
+L1510: /* NONE */
+    regs[10] = tp_None;
+L1511: /* NONE */
+    regs[11] = tp_None;
+L1512: /* DEF */
+    tp_aot_op(tp, f, code + 1512);
+L1558: /* STRING */
+    tp_aot_op(tp, f, code + 1558);
+L1561: /* GSET */
+    tp_set(tp, f->globals, regs[8], regs[7]);
+L1562: /* LINE */
+    f->line = code + 1562;
+    f->lineno = 67;
+L1567: /* VAR */
+L1570: /* STRING */
+    tp_aot_op(tp, f, code + 1570);
+L1573: /* LIST */
+    tp_aot_op(tp, f, code + 1573);
+L1574: /* LIST */
+    tp_aot_op(tp, f, code + 1574);
+L1575: /* NONE */
+    regs[11] = tp_None;
+L1576: /* NONE */
+    regs[12] = tp_None;
+L1577: /* DEF */
+    tp_aot_op(tp, f, code + 1577);
+L1615: /* STRING */
+    tp_aot_op(tp, f, code + 1615);
+L1619: /* GSET */
+    tp_set(tp, f->globals, regs[9], regs[8]);
+L1620: /* LINE */
+    f->line = code + 1620;
+    f->lineno = 71;
+L1626: /* VAR */
+L1629: /* STRING */
+    tp_aot_op(tp, f, code + 1629);
+L1632: /* LIST */
+    tp_aot_op(tp, f, code + 1632);
+L1633: /* LIST */
+    tp_aot_op(tp, f, code + 1633);
+L1634: /* NONE */
+    regs[12] = tp_None;
+L1635: /* NONE */
+    regs[13] = tp_None;
+L1636: /* DEF */
+    tp_aot_op(tp, f, code + 1636);
+L1677: /* STRING */
+    tp_aot_op(tp, f, code + 1677);
+L1682: /* GSET */
+    tp_set(tp, f->globals, regs[10], regs[9]);
+L1683: /* LINE */
+    f->line = code + 1683;
+    f->lineno = 76;
+L1692: /* VAR */
+L1695: /* STRING */
+    tp_aot_op(tp, f, code + 1695);
+L1698: /* STRING */
+    tp_aot_op(tp, f, code + 1698);
+L1702: /* LIST */
+    tp_aot_op(tp, f, code + 1702);
+L1703: /* NONE */
+    regs[15] = tp_None;
+L1704: /* LIST */
+    tp_aot_op(tp, f, code + 1704);
+L1705: /* NONE */
+    regs[13] = tp_None;
+L1706: /* NONE */
+    regs[14] = tp_None;
+L1707: /* DEF */
+    tp_aot_op(tp, f, code + 1707);
+L1866: /* STRING */
+    tp_aot_op(tp, f, code + 1866);
+L1871: /* GSET */
+    tp_set(tp, f->globals, regs[11], regs[10]);
+L1872: /* LINE */
+    f->line = code + 1872;
+    f->lineno = 87;
+L1879: /* VAR */
+L1882: /* STRING */
+    tp_aot_op(tp, f, code + 1882);
+L1885: /* STRING */
+    tp_aot_op(tp, f, code + 1885);
+L1889: /* LIST */
+    tp_aot_op(tp, f, code + 1889);
+L1890: /* LIST */
+    tp_aot_op(tp, f, code + 1890);
+L1891: /* NONE */
+    regs[14] = tp_None;
+L1892: /* NONE */
+    regs[15] = tp_None;
+L1893: /* DEF */
+    tp_aot_op(tp, f, code + 1893);
+L1959: /* STRING */
+    tp_aot_op(tp, f, code + 1959);
+L1964: /* GSET */
+    tp_set(tp, f->globals, regs[12], regs[11]);
+L1965: /* LINE */
+    f->line = code + 1965;
+    f->lineno = 90;
+L1972: /* VAR */
+L1975: /* STRING */
+    tp_aot_op(tp, f, code + 1975);
+L1978: /* STRING */
+    tp_aot_op(tp, f, code + 1978);
+L1982: /* LIST */
+    tp_aot_op(tp, f, code + 1982);
+L1983: /* LIST */
+    tp_aot_op(tp, f, code + 1983);
+L1984: /* NONE */
+    regs[15] = tp_None;
+L1985: /* NONE */
+    regs[16] = tp_None;
+L1986: /* DEF */
+    tp_aot_op(tp, f, code + 1986);
+L2111: /* STRING */
+    tp_aot_op(tp, f, code + 2111);
+L2116: /* GSET */
+    tp_set(tp, f->globals, regs[13], regs[12]);
+L2117: /* LINE */
+    f->line = code + 2117;
+    f->lineno = 96;
+L2124: /* VAR */
+L2127: /* STRING */
+    tp_aot_op(tp, f, code + 2127);
+L2130: /* STRING */
+    tp_aot_op(tp, f, code + 2130);
+L2134: /* LIST */
+    tp_aot_op(tp, f, code + 2134);
+L2135: /* LIST */
+    tp_aot_op(tp, f, code + 2135);
+L2136: /* NONE */
+    regs[16] = tp_None;
+L2137: /* NONE */
+    regs[17] = tp_None;
+L2138: /* DEF */
+    tp_aot_op(tp, f, code + 2138);
+L2233: /* STRING */
+    tp_aot_op(tp, f, code + 2233);
+L2238: /* GSET */
+    tp_set(tp, f->globals, regs[14], regs[13]);
+L2239: /* LINE */
+    f->line = code + 2239;
+    f->lineno = 101;
+L2247: /* VAR */
+L2250: /* STRING */
+    tp_aot_op(tp, f, code + 2250);
+L2253: /* STRING */
+    tp_aot_op(tp, f, code + 2253);
+L2257: /* LIST */
+    tp_aot_op(tp, f, code + 2257);
+L2258: /* LIST */
+    tp_aot_op(tp, f, code + 2258);
+L2259: /* NONE */
+    regs[17] = tp_None;
+L2260: /* NONE */
+    regs[18] = tp_None;
+L2261: /* DEF */
+    tp_aot_op(tp, f, code + 2261);
+L2400: /* STRING */
+    tp_aot_op(tp, f, code + 2400);
+L2405: /* GSET */
+    tp_set(tp, f->globals, regs[15], regs[14]);
+L2406: /* LINE */
+    f->line = code + 2406;
+    f->lineno = 109;
+L2410: /* VAR */
+L2413: /* STRING */
+    tp_aot_op(tp, f, code + 2413);
+L2416: /* LIST */
+    tp_aot_op(tp, f, code + 2416);
+L2417: /* LIST */
+    tp_aot_op(tp, f, code + 2417);
+L2418: /* NONE */
+    regs[18] = tp_None;
+L2419: /* NONE */
+    regs[19] = tp_None;
+L2420: /* DEF */
+    tp_aot_op(tp, f, code + 2420);
+L2514: /* STRING */
+    tp_aot_op(tp, f, code + 2514);
+L2517: /* GSET */
+    tp_set(tp, f->globals, regs[16], regs[15]);
+L2518: /* LINE */
+    f->line = code + 2518;
+    f->lineno = 114;
+L2524: /* VAR */
+L2527: /* STRING */
+    tp_aot_op(tp, f, code + 2527);
+L2530: /* STRING */
+    tp_aot_op(tp, f, code + 2530);
+L2533: /* LIST */
+    tp_aot_op(tp, f, code + 2533);
+L2534: /* LIST */
+    tp_aot_op(tp, f, code + 2534);
+L2535: /* NONE */
+    regs[19] = tp_None;
+L2536: /* NONE */
+    regs[20] = tp_None;
+L2537: /* DEF */
+    tp_aot_op(tp, f, code + 2537);
+L2595: /* STRING */
+    tp_aot_op(tp, f, code + 2595);
+L2599: /* GSET */
+    tp_set(tp, f->globals, regs[17], regs[16]);
+L2600: /* LINE */
+    f->line = code + 2600;
+    f->lineno = 117;
+L2607: /* VAR */
+L2610: /* STRING */
+    tp_aot_op(tp, f, code + 2610);
+L2613: /* STRING */
+    tp_aot_op(tp, f, code + 2613);
+L2617: /* LIST */
+    tp_aot_op(tp, f, code + 2617);
+L2618: /* LIST */
+    tp_aot_op(tp, f, code + 2618);
+L2619: /* NONE */
+    regs[20] = tp_None;
+L2620: /* NONE */
+    regs[21] = tp_None;
+L2621: /* DEF */
+    tp_aot_op(tp, f, code + 2621);
+L2837: /* STRING */
+    tp_aot_op(tp, f, code + 2837);
+L2842: /* GSET */
+    tp_set(tp, f->globals, regs[18], regs[17]);
+L2843: /* LINE */
+    f->line = code + 2843;
+    f->lineno = 126;
+L2850: /* VAR */
+L2853: /* STRING */
+    tp_aot_op(tp, f, code + 2853);
+L2856: /* STRING */
+    tp_aot_op(tp, f, code + 2856);
+L2860: /* LIST */
+    tp_aot_op(tp, f, code + 2860);
+L2861: /* LIST */
+    tp_aot_op(tp, f, code + 2861);
+L2862: /* NONE */
+    regs[21] = tp_None;
+L2863: /* NONE */
+    regs[22] = tp_None;
+L2864: /* DEF */
+    tp_aot_op(tp, f, code + 2864);
+L3297: /* STRING */
+    tp_aot_op(tp, f, code + 3297);
+L3301: /* GSET */
+    tp_set(tp, f->globals, regs[19], regs[18]);
+L3302: /* LINE */
+    f->line = code + 3302;
+    f->lineno = 146;
+L3309: /* VAR */
+L3312: /* STRING */
+    tp_aot_op(tp, f, code + 3312);
+L3315: /* STRING */
+    tp_aot_op(tp, f, code + 3315);
+L3319: /* LIST */
+    tp_aot_op(tp, f, code + 3319);
+L3320: /* LIST */
+    tp_aot_op(tp, f, code + 3320);
+L3321: /* NONE */
+    regs[22] = tp_None;
+L3322: /* NONE */
+    regs[23] = tp_None;
+L3323: /* DEF */
+    tp_aot_op(tp, f, code + 3323);
+L3421: /* STRING */
+    tp_aot_op(tp, f, code + 3421);
+L3425: /* GSET */
+    tp_set(tp, f->globals, regs[20], regs[19]);
+L3426: /* LINE */
+    f->line = code + 3426;
+    f->lineno = 152;
+L3431: /* VAR */
+L3434: /* STRING */
+    tp_aot_op(tp, f, code + 3434);
+L3437: /* LIST */
+    tp_aot_op(tp, f, code + 3437);
+L3438: /* LIST */
+    tp_aot_op(tp, f, code + 3438);
+L3439: /* NONE */
+    regs[23] = tp_None;
+L3440: /* NONE */
+    regs[24] = tp_None;
+L3441: /* DEF */
+    tp_aot_op(tp, f, code + 3441);
+L3473: /* STRING */
+    tp_aot_op(tp, f, code + 3473);
+L3477: /* GSET */
+    tp_set(tp, f->globals, regs[21], regs[20]);
+L3478: /* LINE */
+    f->line = code + 3478;
+    f->lineno = 154;
+L3484: /* VAR */
+L3487: /* STRING */
+    tp_aot_op(tp, f, code + 3487);
+L3490: /* LIST */
+    tp_aot_op(tp, f, code + 3490);
+L3491: /* LIST */
+    tp_aot_op(tp, f, code + 3491);
+L3492: /* NONE */
+    regs[24] = tp_None;
+L3493: /* NONE */
+    regs[25] = tp_None;
+L3494: /* DEF */
+    tp_aot_op(tp, f, code + 3494);
+L3587: /* STRING */
+    tp_aot_op(tp, f, code + 3587);
+L3592: /* GSET */
+    tp_set(tp, f->globals, regs[22], regs[21]);
+L3593: /* LINE */
+    f->line = code + 3593;
+    f->lineno = 160;
+L3599: /* VAR */
+L3602: /* STRING */
+    tp_aot_op(tp, f, code + 3602);
+L3605: /* LIST */
+    tp_aot_op(tp, f, code + 3605);
+L3606: /* LIST */
+    tp_aot_op(tp, f, code + 3606);
+L3607: /* NONE */
+    regs[25] = tp_None;
+L3608: /* NONE */
+    regs[26] = tp_None;
+L3609: /* DEF */
+    tp_aot_op(tp, f, code + 3609);
+L4055: /* STRING */
+    tp_aot_op(tp, f, code + 4055);
+L4060: /* GSET */
+    tp_set(tp, f->globals, regs[23], regs[22]);
+L4061: /* LINE */
+    f->line = code + 4061;
+    f->lineno = 183;
+L4067: /* VAR */
+L4070: /* STRING */
+    tp_aot_op(tp, f, code + 4070);
+L4073: /* LIST */
+    tp_aot_op(tp, f, code + 4073);
+L4074: /* LIST */
+    tp_aot_op(tp, f, code + 4074);
+L4075: /* NONE */
+    regs[26] = tp_None;
+L4076: /* NONE */
+    regs[27] = tp_None;
+L4077: /* DEF */
+    tp_aot_op(tp, f, code + 4077);
+L4295: /* STRING */
+    tp_aot_op(tp, f, code + 4295);
+L4300: /* GSET */
+    tp_set(tp, f->globals, regs[24], regs[23]);
+L4301: /* LINE */
+    f->line = code + 4301;
+    f->lineno = 195;
+L4308: /* VAR */
+L4311: /* STRING */
+    tp_aot_op(tp, f, code + 4311);
+L4314: /* LIST */
+    tp_aot_op(tp, f, code + 4314);
+L4315: /* NONE */
+    regs[29] = tp_None;
+L4316: /* LIST */
+    tp_aot_op(tp, f, code + 4316);
+L4317: /* NONE */
+    regs[27] = tp_None;
+L4318: /* NONE */
+    regs[28] = tp_None;
+L4319: /* DEF */
+    tp_aot_op(tp, f, code + 4319);
+L4366: /* STRING */
+    tp_aot_op(tp, f, code + 4366);
+L4370: /* GSET */
+    tp_set(tp, f->globals, regs[25], regs[24]);
+L4371: /* LINE */
+    f->line = code + 4371;
+    f->lineno = 198;
+L4377: /* VAR */
+L4380: /* STRING */
+    tp_aot_op(tp, f, code + 4380);
+L4384: /* LIST */
+    tp_aot_op(tp, f, code + 4384);
+L4385: /* LIST */
+    tp_aot_op(tp, f, code + 4385);
+L4386: /* NONE */
+    regs[28] = tp_None;
+L4387: /* NONE */
+    regs[29] = tp_None;
+L4388: /* DEF */
+    tp_aot_op(tp, f, code + 4388);
+L4589: /* STRING */
+    tp_aot_op(tp, f, code + 4589);
+L4593: /* GSET */
+    tp_set(tp, f->globals, regs[26], regs[25]);
+L4594: /* LINE */
+    f->line = code + 4594;
+    f->lineno = 206;
+L4599: /* VAR */
+L4602: /* LIST */
+    tp_aot_op(tp, f, code + 4602);
+L4603: /* LIST */
+    tp_aot_op(tp, f, code + 4603);
+L4604: /* NONE */
+    regs[29] = tp_None;
+L4605: /* NONE */
+    regs[30] = tp_None;
+L4606: /* DEF */
+    tp_aot_op(tp, f, code + 4606);
+L4998: /* STRING */
+    tp_aot_op(tp, f, code + 4998);
+L5002: /* GSET */
+    tp_set(tp, f->globals, regs[27], regs[26]);
+L5003: /* LINE */
+    f->line = code + 5003;
+    f->lineno = 230;
+L5008: /* VAR */
+L5011: /* STRING */
+    tp_aot_op(tp, f, code + 5011);
+L5014: /* LIST */
+    tp_aot_op(tp, f, code + 5014);
+L5015: /* LIST */
+    tp_aot_op(tp, f, code + 5015);
+L5016: /* NONE */
+    regs[30] = tp_None;
+L5017: /* NONE */
+    regs[31] = tp_None;
+L5018: /* DEF */
+    tp_aot_op(tp, f, code + 5018);
+L5338: /* STRING */
+    tp_aot_op(tp, f, code + 5338);
+L5342: /* GSET */
+    tp_set(tp, f->globals, regs[28], regs[27]);
+L5343: /* LINE */
+    f->line = code + 5343;
+    f->lineno = 247;
+L5349: /* VAR */
+L5352: /* STRING */
+    tp_aot_op(tp, f, code + 5352);
+L5355: /* LIST */
+    tp_aot_op(tp, f, code + 5355);
+L5356: /* LIST */
+    tp_aot_op(tp, f, code + 5356);
+L5357: /* NONE */
+    regs[31] = tp_None;
+L5358: /* NONE */
+    regs[32] = tp_None;
+L5359: /* DEF */
+    tp_aot_op(tp, f, code + 5359);
+L5470: /* STRING */
+    tp_aot_op(tp, f, code + 5470);
+L5475: /* GSET */
+    tp_set(tp, f->globals, regs[29], regs[28]);
+L5476: /* LINE */
+    f->line = code + 5476;
+    f->lineno = 253;
+L5482: /* VAR */
+L5485: /* STRING */
+    tp_aot_op(tp, f, code + 5485);
+L5488: /* LIST */
+    tp_aot_op(tp, f, code + 5488);
+L5489: /* LIST */
+    tp_aot_op(tp, f, code + 5489);
+L5490: /* NONE */
+    regs[32] = tp_None;
+L5491: /* NONE */
+    regs[33] = tp_None;
+L5492: /* DEF */
+    tp_aot_op(tp, f, code + 5492);
+L5618: /* STRING */
+    tp_aot_op(tp, f, code + 5618);
+L5623: /* GSET */
+    tp_set(tp, f->globals, regs[30], regs[29]);
+L5624: /* LINE */
+    f->line = code + 5624;
+    f->lineno = 261;
+L5630: /* VAR */
+L5633: /* STRING */
+    tp_aot_op(tp, f, code + 5633);
+L5636: /* LIST */
+    tp_aot_op(tp, f, code + 5636);
+L5637: /* LIST */
+    tp_aot_op(tp, f, code + 5637);
+L5638: /* NONE */
+    regs[33] = tp_None;
+L5639: /* NONE */
+    regs[34] = tp_None;
+L5640: /* DEF */
+    tp_aot_op(tp, f, code + 5640);
+L5923: /* STRING */
+    tp_aot_op(tp, f, code + 5923);
+L5928: /* GSET */
+    tp_set(tp, f->globals, regs[31], regs[30]);
+L5929: /* LINE */
+    f->line = code + 5929;
+    f->lineno = 283;
+L5935: /* VAR */
+L5938: /* STRING */
+    tp_aot_op(tp, f, code + 5938);
+L5941: /* LIST */
+    tp_aot_op(tp, f, code + 5941);
+L5942: /* LIST */
+    tp_aot_op(tp, f, code + 5942);
+L5943: /* NONE */
+    regs[34] = tp_None;
+L5944: /* NONE */
+    regs[35] = tp_None;
+L5945: /* DEF */
+    tp_aot_op(tp, f, code + 5945);
+L6256: /* STRING */
+    tp_aot_op(tp, f, code + 6256);
+L6261: /* GSET */
+    tp_set(tp, f->globals, regs[32], regs[31]);
+L6262: /* LINE */
+    f->line = code + 6262;
+    f->lineno = 304;
+L6267: /* VAR */
+L6270: /* STRING */
+    tp_aot_op(tp, f, code + 6270);
+L6273: /* LIST */
+    tp_aot_op(tp, f, code + 6273);
+L6274: /* LIST */
+    tp_aot_op(tp, f, code + 6274);
+L6275: /* NONE */
+    regs[35] = tp_None;
+L6276: /* NONE */
+    regs[36] = tp_None;
+L6277: /* DEF */
+    tp_aot_op(tp, f, code + 6277);
+L6452: /* STRING */
+    tp_aot_op(tp, f, code + 6452);
+L6456: /* GSET */
+    tp_set(tp, f->globals, regs[33], regs[32]);
+L6457: /* LINE */
+    f->line = code + 6457;
+    f->lineno = 315;
+L6462: /* VAR */
+L6465: /* STRING */
+    tp_aot_op(tp, f, code + 6465);
+L6468: /* LIST */
+    tp_aot_op(tp, f, code + 6468);
+L6469: /* LIST */
+    tp_aot_op(tp, f, code + 6469);
+L6470: /* NONE */
+    regs[36] = tp_None;
+L6471: /* NONE */
+    regs[37] = tp_None;
+L6472: /* DEF */
+    tp_aot_op(tp, f, code + 6472);
+L6889: /* STRING */
+    tp_aot_op(tp, f, code + 6889);
+L6893: /* GSET */
+    tp_set(tp, f->globals, regs[34], regs[33]);
+L6894: /* LINE */
+    f->line = code + 6894;
+    f->lineno = 335;
+L6899: /* VAR */
+L6902: /* STRING */
+    tp_aot_op(tp, f, code + 6902);
+L6905: /* LIST */
+    tp_aot_op(tp, f, code + 6905);
+L6906: /* LIST */
+    tp_aot_op(tp, f, code + 6906);
+L6907: /* NONE */
+    regs[37] = tp_None;
+L6908: /* NONE */
+    regs[38] = tp_None;
+L6909: /* DEF */
+    tp_aot_op(tp, f, code + 6909);
+L7214: /* STRING */
+    tp_aot_op(tp, f, code + 7214);
+L7218: /* GSET */
+    tp_set(tp, f->globals, regs[35], regs[34]);
+L7219: /* LINE */
+    f->line = code + 7219;
+    f->lineno = 356;
+L7225: /* VAR */
+L7228: /* STRING */
+    tp_aot_op(tp, f, code + 7228);
+L7231: /* LIST */
+    tp_aot_op(tp, f, code + 7231);
+L7232: /* LIST */
+    tp_aot_op(tp, f, code + 7232);
+L7233: /* NONE */
+    regs[38] = tp_None;
+L7234: /* NONE */
+    regs[39] = tp_None;
+L7235: /* DEF */
+    tp_aot_op(tp, f, code + 7235);
+L7303: /* STRING */
+    tp_aot_op(tp, f, code + 7303);
+L7308: /* GSET */
+    tp_set(tp, f->globals, regs[36], regs[35]);
+L7309: /* LINE */
+    f->line = code + 7309;
+    f->lineno = 362;
+L7315: /* VAR */
+L7318: /* STRING */
+    tp_aot_op(tp, f, code + 7318);
+L7321: /* LIST */
+    tp_aot_op(tp, f, code + 7321);
+L7322: /* LIST */
+    tp_aot_op(tp, f, code + 7322);
+L7323: /* NONE */
+    regs[39] = tp_None;
+L7324: /* NONE */
+    regs[40] = tp_None;
+L7325: /* DEF */
+    tp_aot_op(tp, f, code + 7325);
+L7414: /* STRING */
+    tp_aot_op(tp, f, code + 7414);
+L7419: /* GSET */
+    tp_set(tp, f->globals, regs[37], regs[36]);
+L7420: /* LINE */
+    f->line = code + 7420;
+    f->lineno = 365;
+L7426: /* VAR */
+L7429: /* STRING */
+    tp_aot_op(tp, f, code + 7429);
+L7432: /* LIST */
+    tp_aot_op(tp, f, code + 7432);
+L7433: /* LIST */
+    tp_aot_op(tp, f, code + 7433);
+L7434: /* NONE */
+    regs[40] = tp_None;
+L7435: /* NONE */
+    regs[41] = tp_None;
+L7436: /* DEF */
+    tp_aot_op(tp, f, code + 7436);
+L7503: /* STRING */
+    tp_aot_op(tp, f, code + 7503);
+L7508: /* GSET */
+    tp_set(tp, f->globals, regs[38], regs[37]);
+L7509: /* LINE */
+    f->line = code + 7509;
+    f->lineno = 369;
+L7515: /* VAR */
+L7518: /* STRING */
+    tp_aot_op(tp, f, code + 7518);
+L7521: /* LIST */
+    tp_aot_op(tp, f, code + 7521);
+L7522: /* LIST */
+    tp_aot_op(tp, f, code + 7522);
+L7523: /* NONE */
+    regs[41] = tp_None;
+L7524: /* NONE */
+    regs[42] = tp_None;
+L7525: /* DEF */
+    tp_aot_op(tp, f, code + 7525);
+L7733: /* STRING */
+    tp_aot_op(tp, f, code + 7733);
+L7738: /* GSET */
+    tp_set(tp, f->globals, regs[39], regs[38]);
+L7739: /* LINE */
+    f->line = code + 7739;
+    f->lineno = 379;
+L7745: /* VAR */
+L7748: /* STRING */
+    tp_aot_op(tp, f, code + 7748);
+L7751: /* LIST */
+    tp_aot_op(tp, f, code + 7751);
+L7752: /* LIST */
+    tp_aot_op(tp, f, code + 7752);
+L7753: /* NONE */
+    regs[42] = tp_None;
+L7754: /* NONE */
+    regs[43] = tp_None;
+L7755: /* DEF */
+    tp_aot_op(tp, f, code + 7755);
+L7833: /* STRING */
+    tp_aot_op(tp, f, code + 7833);
+L7838: /* GSET */
+    tp_set(tp, f->globals, regs[40], regs[39]);
+L7839: /* LINE */
+    f->line = code + 7839;
+    f->lineno = 384;
+L7845: /* VAR */
+L7848: /* STRING */
+    tp_aot_op(tp, f, code + 7848);
+L7851: /* LIST */
+    tp_aot_op(tp, f, code + 7851);
+L7852: /* LIST */
+    tp_aot_op(tp, f, code + 7852);
+L7853: /* NONE */
+    regs[43] = tp_None;
+L7854: /* NONE */
+    regs[44] = tp_None;
+L7855: /* DEF */
+    tp_aot_op(tp, f, code + 7855);
+L7934: /* STRING */
+    tp_aot_op(tp, f, code + 7934);
+L7939: /* GSET */
+    tp_set(tp, f->globals, regs[41], regs[40]);
+L7940: /* LINE */
+    f->line = code + 7940;
+    f->lineno = 391;
+L7945: /* STRING */
+    tp_aot_op(tp, f, code + 7945);
+L7950: /* LINE */
+    f->line = code + 7950;
+    f->lineno = 392;
+L7963: /* STRING */
+    tp_aot_op(tp, f, code + 7963);
+L7966: /* STRING */
+    tp_aot_op(tp, f, code + 7966);
+L7969: /* NUMBER */
+    tp_aot_op(tp, f, code + 7969);
+L7972: /* STRING */
+    tp_aot_op(tp, f, code + 7972);
+L7975: /* NUMBER */
+    tp_aot_op(tp, f, code + 7975);
+L7978: /* STRING */
+    tp_aot_op(tp, f, code + 7978);
+L7981: /* GGET */
+    tp_aot_op(tp, f, code + 7981);
+L7986: /* DICT */
+    tp_aot_op(tp, f, code + 7986);
+L7987: /* LINE */
+    f->line = code + 7987;
+    f->lineno = 393;
+L7999: /* STRING */
+    tp_aot_op(tp, f, code + 7999);
+L8002: /* STRING */
+    tp_aot_op(tp, f, code + 8002);
+L8005: /* NUMBER */
+    tp_aot_op(tp, f, code + 8005);
+L8008: /* STRING */
+    tp_aot_op(tp, f, code + 8008);
+L8011: /* NUMBER */
+    tp_aot_op(tp, f, code + 8011);
+L8014: /* STRING */
+    tp_aot_op(tp, f, code + 8014);
+L8017: /* GGET */
+    tp_aot_op(tp, f, code + 8017);
+L8022: /* DICT */
+    tp_aot_op(tp, f, code + 8022);
+L8023: /* LINE */
+    f->line = code + 8023;
+    f->lineno = 394;
+L8033: /* STRING */
+    tp_aot_op(tp, f, code + 8033);
+L8036: /* STRING */
+    tp_aot_op(tp, f, code + 8036);
+L8039: /* NUMBER */
+    tp_aot_op(tp, f, code + 8039);
+L8042: /* STRING */
+    tp_aot_op(tp, f, code + 8042);
+L8045: /* GGET */
+    tp_aot_op(tp, f, code + 8045);
+L8050: /* LINE */
+    f->line = code + 8050;
+    f->lineno = 395;
+L8060: /* STRING */
+    tp_aot_op(tp, f, code + 8060);
+L8063: /* NUMBER */
+    tp_aot_op(tp, f, code + 8063);
+L8066: /* STRING */
+    tp_aot_op(tp, f, code + 8066);
+L8069: /* GGET */
+    tp_aot_op(tp, f, code + 8069);
+L8074: /* DICT */
+    tp_aot_op(tp, f, code + 8074);
+L8075: /* LINE */
+    f->line = code + 8075;
+    f->lineno = 396;
+L8088: /* STRING */
+    tp_aot_op(tp, f, code + 8088);
+L8091: /* STRING */
+    tp_aot_op(tp, f, code + 8091);
+L8094: /* NUMBER */
+    tp_aot_op(tp, f, code + 8094);
+L8097: /* STRING */
+    tp_aot_op(tp, f, code + 8097);
+L8100: /* GGET */
+    tp_aot_op(tp, f, code + 8100);
+L8105: /* STRING */
+    tp_aot_op(tp, f, code + 8105);
+L8108: /* NUMBER */
+    tp_aot_op(tp, f, code + 8108);
+L8111: /* LINE */
+    f->line = code + 8111;
+    f->lineno = 397;
+L8121: /* STRING */
+    tp_aot_op(tp, f, code + 8121);
+L8124: /* NUMBER */
+    tp_aot_op(tp, f, code + 8124);
+L8127: /* STRING */
+    tp_aot_op(tp, f, code + 8127);
+L8130: /* GGET */
+    tp_aot_op(tp, f, code + 8130);
+L8135: /* DICT */
+    tp_aot_op(tp, f, code + 8135);
+L8136: /* LINE */
+    f->line = code + 8136;
+    f->lineno = 398;
+L8148: /* STRING */
+    tp_aot_op(tp, f, code + 8148);
+L8151: /* STRING */
+    tp_aot_op(tp, f, code + 8151);
+L8154: /* NUMBER */
+    tp_aot_op(tp, f, code + 8154);
+L8157: /* STRING */
+    tp_aot_op(tp, f, code + 8157);
+L8160: /* NUMBER */
+    tp_aot_op(tp, f, code + 8160);
+L8163: /* STRING */
+    tp_aot_op(tp, f, code + 8163);
+L8166: /* GGET */
+    tp_aot_op(tp, f, code + 8166);
+L8171: /* DICT */
+    tp_aot_op(tp, f, code + 8171);
+L8172: /* LINE */
+    f->line = code + 8172;
+    f->lineno = 399;
+L8182: /* STRING */
+    tp_aot_op(tp, f, code + 8182);
+L8185: /* STRING */
+    tp_aot_op(tp, f, code + 8185);
+L8188: /* NUMBER */
+    tp_aot_op(tp, f, code + 8188);
+L8191: /* STRING */
+    tp_aot_op(tp, f, code + 8191);
+L8194: /* GGET */
+    tp_aot_op(tp, f, code + 8194);
+L8199: /* LINE */
+    f->line = code + 8199;
+    f->lineno = 400;
+L8209: /* STRING */
+    tp_aot_op(tp, f, code + 8209);
+L8212: /* NUMBER */
+    tp_aot_op(tp, f, code + 8212);
+L8215: /* STRING */
+    tp_aot_op(tp, f, code + 8215);
+L8218: /* GGET */
+    tp_aot_op(tp, f, code + 8218);
+L8223: /* DICT */
+    tp_aot_op(tp, f, code + 8223);
+L8224: /* LINE */
+    f->line = code + 8224;
+    f->lineno = 401;
+L8235: /* STRING */
+    tp_aot_op(tp, f, code + 8235);
+L8238: /* STRING */
+    tp_aot_op(tp, f, code + 8238);
+L8241: /* NUMBER */
+    tp_aot_op(tp, f, code + 8241);
+L8244: /* STRING */
+    tp_aot_op(tp, f, code + 8244);
+L8247: /* GGET */
+    tp_aot_op(tp, f, code + 8247);
+L8252: /* LINE */
+    f->line = code + 8252;
+    f->lineno = 402;
+L8262: /* STRING */
+    tp_aot_op(tp, f, code + 8262);
+L8265: /* NUMBER */
+    tp_aot_op(tp, f, code + 8265);
+L8268: /* STRING */
+    tp_aot_op(tp, f, code + 8268);
+L8271: /* GGET */
+    tp_aot_op(tp, f, code + 8271);
+L8276: /* DICT */
+    tp_aot_op(tp, f, code + 8276);
+L8277: /* LINE */
+    f->line = code + 8277;
+    f->lineno = 403;
+L8289: /* STRING */
+    tp_aot_op(tp, f, code + 8289);
+L8292: /* STRING */
+    tp_aot_op(tp, f, code + 8292);
+L8295: /* NUMBER */
+    tp_aot_op(tp, f, code + 8295);
+L8298: /* STRING */
+    tp_aot_op(tp, f, code + 8298);
+L8301: /* NUMBER */
+    tp_aot_op(tp, f, code + 8301);
+L8304: /* STRING */
+    tp_aot_op(tp, f, code + 8304);
+L8307: /* GGET */
+    tp_aot_op(tp, f, code + 8307);
+L8312: /* DICT */
+    tp_aot_op(tp, f, code + 8312);
+L8313: /* LINE */
+    f->line = code + 8313;
+    f->lineno = 404;
+L8323: /* STRING */
+    tp_aot_op(tp, f, code + 8323);
+L8326: /* STRING */
+    tp_aot_op(tp, f, code + 8326);
+L8329: /* NUMBER */
+    tp_aot_op(tp, f, code + 8329);
+L8332: /* STRING */
+    tp_aot_op(tp, f, code + 8332);
+L8335: /* GGET */
+    tp_aot_op(tp, f, code + 8335);
+L8340: /* LINE */
+    f->line = code + 8340;
+    f->lineno = 405;
+L8350: /* STRING */
+    tp_aot_op(tp, f, code + 8350);
+L8353: /* NUMBER */
+    tp_aot_op(tp, f, code + 8353);
+L8356: /* STRING */
+    tp_aot_op(tp, f, code + 8356);
+L8359: /* GGET */
+    tp_aot_op(tp, f, code + 8359);
+L8364: /* DICT */
+    tp_aot_op(tp, f, code + 8364);
+L8365: /* LINE */
+    f->line = code + 8365;
+    f->lineno = 406;
+L8375: /* STRING */
+    tp_aot_op(tp, f, code + 8375);
+L8378: /* STRING */
+    tp_aot_op(tp, f, code + 8378);
+L8381: /* NUMBER */
+    tp_aot_op(tp, f, code + 8381);
+L8384: /* STRING */
+    tp_aot_op(tp, f, code + 8384);
+L8387: /* GGET */
+    tp_aot_op(tp, f, code + 8387);
+L8392: /* LINE */
+    f->line = code + 8392;
+    f->lineno = 407;
+L8402: /* STRING */
+    tp_aot_op(tp, f, code + 8402);
+L8405: /* NUMBER */
+    tp_aot_op(tp, f, code + 8405);
+L8408: /* STRING */
+    tp_aot_op(tp, f, code + 8408);
+L8411: /* GGET */
+    tp_aot_op(tp, f, code + 8411);
+L8415: /* DICT */
+    tp_aot_op(tp, f, code + 8415);
+L8416: /* LINE */
+    f->line = code + 8416;
+    f->lineno = 408;
+L8426: /* STRING */
+    tp_aot_op(tp, f, code + 8426);
+L8429: /* STRING */
+    tp_aot_op(tp, f, code + 8429);
+L8432: /* NUMBER */
+    tp_aot_op(tp, f, code + 8432);
+L8435: /* STRING */
+    tp_aot_op(tp, f, code + 8435);
+L8438: /* GGET */
+    tp_aot_op(tp, f, code + 8438);
+L8443: /* DICT */
+    tp_aot_op(tp, f, code + 8443);
+L8444: /* LINE */
+    f->line = code + 8444;
+    f->lineno = 409;
+L8460: /* STRING */
+    tp_aot_op(tp, f, code + 8460);
+L8463: /* STRING */
+    tp_aot_op(tp, f, code + 8463);
+L8466: /* NUMBER */
+    tp_aot_op(tp, f, code + 8466);
+L8469: /* STRING */
+    tp_aot_op(tp, f, code + 8469);
+L8472: /* NUMBER */
+    tp_aot_op(tp, f, code + 8472);
+L8475: /* STRING */
+    tp_aot_op(tp, f, code + 8475);
+L8478: /* GGET */
+    tp_aot_op(tp, f, code + 8478);
+L8482: /* STRING */
+    tp_aot_op(tp, f, code + 8482);
+L8486: /* STRING */
+    tp_aot_op(tp, f, code + 8486);
+L8490: /* DICT */
+    tp_aot_op(tp, f, code + 8490);
+L8491: /* LINE */
+    f->line = code + 8491;
+    f->lineno = 410;
+L8505: /* STRING */
+    tp_aot_op(tp, f, code + 8505);
+L8509: /* STRING */
+    tp_aot_op(tp, f, code + 8509);
+L8512: /* NUMBER */
+    tp_aot_op(tp, f, code + 8512);
+L8515: /* STRING */
+    tp_aot_op(tp, f, code + 8515);
+L8518: /* GGET */
+    tp_aot_op(tp, f, code + 8518);
+L8522: /* STRING */
+    tp_aot_op(tp, f, code + 8522);
+L8526: /* STRING */
+    tp_aot_op(tp, f, code + 8526);
+L8530: /* DICT */
+    tp_aot_op(tp, f, code + 8530);
+L8531: /* LINE */
+    f->line = code + 8531;
+    f->lineno = 411;
+L8545: /* STRING */
+    tp_aot_op(tp, f, code + 8545);
+L8549: /* STRING */
+    tp_aot_op(tp, f, code + 8549);
+L8552: /* NUMBER */
+    tp_aot_op(tp, f, code + 8552);
+L8555: /* STRING */
+    tp_aot_op(tp, f, code + 8555);
+L8558: /* GGET */
+    tp_aot_op(tp, f, code + 8558);
+L8562: /* STRING */
+    tp_aot_op(tp, f, code + 8562);
+L8566: /* STRING */
+    tp_aot_op(tp, f, code + 8566);
+L8570: /* DICT */
+    tp_aot_op(tp, f, code + 8570);
+L8571: /* LINE */
+    f->line = code + 8571;
+    f->lineno = 412;
+L8587: /* STRING */
+    tp_aot_op(tp, f, code + 8587);
+L8592: /* STRING */
+    tp_aot_op(tp, f, code + 8592);
+L8595: /* NUMBER */
+    tp_aot_op(tp, f, code + 8595);
+L8598: /* STRING */
+    tp_aot_op(tp, f, code + 8598);
+L8601: /* GGET */
+    tp_aot_op(tp, f, code + 8601);
+L8605: /* STRING */
+    tp_aot_op(tp, f, code + 8605);
+L8609: /* STRING */
+    tp_aot_op(tp, f, code + 8609);
+L8614: /* DICT */
+    tp_aot_op(tp, f, code + 8614);
+L8615: /* LINE */
+    f->line = code + 8615;
+    f->lineno = 413;
+L8628: /* STRING */
+    tp_aot_op(tp, f, code + 8628);
+L8631: /* STRING */
+    tp_aot_op(tp, f, code + 8631);
+L8634: /* NUMBER */
+    tp_aot_op(tp, f, code + 8634);
+L8637: /* STRING */
+    tp_aot_op(tp, f, code + 8637);
+L8641: /* STRING */
+    tp_aot_op(tp, f, code + 8641);
+L8644: /* STRING */
+    tp_aot_op(tp, f, code + 8644);
+L8647: /* STRING */
+    tp_aot_op(tp, f, code + 8647);
+L8650: /* DICT */
+    tp_aot_op(tp, f, code + 8650);
+L8651: /* LINE */
+    f->line = code + 8651;
+    f->lineno = 414;
+L8665: /* STRING */
+    tp_aot_op(tp, f, code + 8665);
+L8668: /* STRING */
+    tp_aot_op(tp, f, code + 8668);
+L8671: /* NUMBER */
+    tp_aot_op(tp, f, code + 8671);
+L8674: /* STRING */
+    tp_aot_op(tp, f, code + 8674);
+L8677: /* GGET */
+    tp_aot_op(tp, f, code + 8677);
+L8681: /* STRING */
+    tp_aot_op(tp, f, code + 8681);
+L8685: /* STRING */
+    tp_aot_op(tp, f, code + 8685);
+L8688: /* DICT */
+    tp_aot_op(tp, f, code + 8688);
+L8689: /* LINE */
+    f->line = code + 8689;
+    f->lineno = 415;
+L8704: /* STRING */
+    tp_aot_op(tp, f, code + 8704);
+L8708: /* STRING */
+    tp_aot_op(tp, f, code + 8708);
+L8711: /* NUMBER */
+    tp_aot_op(tp, f, code + 8711);
+L8714: /* STRING */
+    tp_aot_op(tp, f, code + 8714);
+L8717: /* GGET */
+    tp_aot_op(tp, f, code + 8717);
+L8722: /* STRING */
+    tp_aot_op(tp, f, code + 8722);
+L8726: /* STRING */
+    tp_aot_op(tp, f, code + 8726);
+L8730: /* DICT */
+    tp_aot_op(tp, f, code + 8730);
+L8731: /* LINE */
+    f->line = code + 8731;
+    f->lineno = 416;
+L8745: /* STRING */
+    tp_aot_op(tp, f, code + 8745);
+L8748: /* STRING */
+    tp_aot_op(tp, f, code + 8748);
+L8751: /* NUMBER */
+    tp_aot_op(tp, f, code + 8751);
+L8754: /* STRING */
+    tp_aot_op(tp, f, code + 8754);
+L8757: /* GGET */
+    tp_aot_op(tp, f, code + 8757);
+L8761: /* STRING */
+    tp_aot_op(tp, f, code + 8761);
+L8765: /* STRING */
+    tp_aot_op(tp, f, code + 8765);
+L8768: /* DICT */
+    tp_aot_op(tp, f, code + 8768);
+L8769: /* LINE */
+    f->line = code + 8769;
+    f->lineno = 417;
+L8783: /* STRING */
+    tp_aot_op(tp, f, code + 8783);
+L8786: /* STRING */
+    tp_aot_op(tp, f, code + 8786);
+L8789: /* NUMBER */
+    tp_aot_op(tp, f, code + 8789);
+L8792: /* STRING */
+    tp_aot_op(tp, f, code + 8792);
+L8795: /* GGET */
+    tp_aot_op(tp, f, code + 8795);
+L8799: /* STRING */
+    tp_aot_op(tp, f, code + 8799);
+L8803: /* STRING */
+    tp_aot_op(tp, f, code + 8803);
+L8806: /* DICT */
+    tp_aot_op(tp, f, code + 8806);
+L8807: /* LINE */
+    f->line = code + 8807;
+    f->lineno = 418;
+L8820: /* STRING */
+    tp_aot_op(tp, f, code + 8820);
+L8823: /* STRING */
+    tp_aot_op(tp, f, code + 8823);
+L8826: /* NUMBER */
+    tp_aot_op(tp, f, code + 8826);
+L8829: /* STRING */
+    tp_aot_op(tp, f, code + 8829);
+L8832: /* GGET */
+    tp_aot_op(tp, f, code + 8832);
+L8836: /* STRING */
+    tp_aot_op(tp, f, code + 8836);
+L8840: /* STRING */
+    tp_aot_op(tp, f, code + 8840);
+L8843: /* DICT */
+    tp_aot_op(tp, f, code + 8843);
+L8844: /* LINE */
+    f->line = code + 8844;
+    f->lineno = 419;
+L8859: /* STRING */
+    tp_aot_op(tp, f, code + 8859);
+L8863: /* STRING */
+    tp_aot_op(tp, f, code + 8863);
+L8866: /* NUMBER */
+    tp_aot_op(tp, f, code + 8866);
+L8869: /* STRING */
+    tp_aot_op(tp, f, code + 8869);
+L8872: /* GGET */
+    tp_aot_op(tp, f, code + 8872);
+L8877: /* STRING */
+    tp_aot_op(tp, f, code + 8877);
+L8881: /* STRING */
+    tp_aot_op(tp, f, code + 8881);
+L8885: /* DICT */
+    tp_aot_op(tp, f, code + 8885);
+L8886: /* LINE */
+    f->line = code + 8886;
+    f->lineno = 420;
+L8904: /* STRING */
+    tp_aot_op(tp, f, code + 8904);
+L8908: /* STRING */
+    tp_aot_op(tp, f, code + 8908);
+L8911: /* NUMBER */
+    tp_aot_op(tp, f, code + 8911);
+L8914: /* STRING */
+    tp_aot_op(tp, f, code + 8914);
+L8917: /* GGET */
+    tp_aot_op(tp, f, code + 8917);
+L8922: /* STRING */
+    tp_aot_op(tp, f, code + 8922);
+L8926: /* STRING */
+    tp_aot_op(tp, f, code + 8926);
+L8930: /* STRING */
+    tp_aot_op(tp, f, code + 8930);
+L8933: /* NUMBER */
+    tp_aot_op(tp, f, code + 8933);
+L8936: /* DICT */
+    tp_aot_op(tp, f, code + 8936);
+L8937: /* LINE */
+    f->line = code + 8937;
+    f->lineno = 421;
+L8955: /* STRING */
+    tp_aot_op(tp, f, code + 8955);
+L8959: /* STRING */
+    tp_aot_op(tp, f, code + 8959);
+L8962: /* NUMBER */
+    tp_aot_op(tp, f, code + 8962);
+L8965: /* STRING */
+    tp_aot_op(tp, f, code + 8965);
+L8968: /* GGET */
+    tp_aot_op(tp, f, code + 8968);
+L8973: /* STRING */
+    tp_aot_op(tp, f, code + 8973);
+L8977: /* STRING */
+    tp_aot_op(tp, f, code + 8977);
+L8981: /* STRING */
+    tp_aot_op(tp, f, code + 8981);
+L8984: /* NUMBER */
+    tp_aot_op(tp, f, code + 8984);
+L8987: /* DICT */
+    tp_aot_op(tp, f, code + 8987);
+L8988: /* LINE */
+    f->line = code + 8988;
+    f->lineno = 422;
+L9006: /* STRING */
+    tp_aot_op(tp, f, code + 9006);
+L9010: /* STRING */
+    tp_aot_op(tp, f, code + 9010);
+L9013: /* NUMBER */
+    tp_aot_op(tp, f, code + 9013);
+L9016: /* STRING */
+    tp_aot_op(tp, f, code + 9016);
+L9019: /* GGET */
+    tp_aot_op(tp, f, code + 9019);
+L9024: /* STRING */
+    tp_aot_op(tp, f, code + 9024);
+L9028: /* STRING */
+    tp_aot_op(tp, f, code + 9028);
+L9032: /* STRING */
+    tp_aot_op(tp, f, code + 9032);
+L9035: /* NUMBER */
+    tp_aot_op(tp, f, code + 9035);
+L9038: /* DICT */
+    tp_aot_op(tp, f, code + 9038);
+L9039: /* LINE */
+    f->line = code + 9039;
+    f->lineno = 423;
+L9057: /* STRING */
+    tp_aot_op(tp, f, code + 9057);
+L9061: /* STRING */
+    tp_aot_op(tp, f, code + 9061);
+L9064: /* NUMBER */
+    tp_aot_op(tp, f, code + 9064);
+L9067: /* STRING */
+    tp_aot_op(tp, f, code + 9067);
+L9070: /* GGET */
+    tp_aot_op(tp, f, code + 9070);
+L9075: /* STRING */
+    tp_aot_op(tp, f, code + 9075);
+L9079: /* STRING */
+    tp_aot_op(tp, f, code + 9079);
+L9083: /* STRING */
+    tp_aot_op(tp, f, code + 9083);
+L9086: /* NUMBER */
+    tp_aot_op(tp, f, code + 9086);
+L9089: /* DICT */
+    tp_aot_op(tp, f, code + 9089);
+L9090: /* LINE */
+    f->line = code + 9090;
+    f->lineno = 424;
+L9106: /* STRING */
+    tp_aot_op(tp, f, code + 9106);
+L9110: /* STRING */
+    tp_aot_op(tp, f, code + 9110);
+L9113: /* NUMBER */
+    tp_aot_op(tp, f, code + 9113);
+L9116: /* STRING */
+    tp_aot_op(tp, f, code + 9116);
+L9119: /* GGET */
+    tp_aot_op(tp, f, code + 9119);
+L9124: /* STRING */
+    tp_aot_op(tp, f, code + 9124);
+L9128: /* STRING */
+    tp_aot_op(tp, f, code + 9128);
+L9132: /* STRING */
+    tp_aot_op(tp, f, code + 9132);
+L9135: /* NUMBER */
+    tp_aot_op(tp, f, code + 9135);
+L9138: /* DICT */
+    tp_aot_op(tp, f, code + 9138);
+L9139: /* LINE */
+    f->line = code + 9139;
+    f->lineno = 425;
+L9156: /* STRING */
+    tp_aot_op(tp, f, code + 9156);
+L9159: /* STRING */
+    tp_aot_op(tp, f, code + 9159);
+L9162: /* NUMBER */
+    tp_aot_op(tp, f, code + 9162);
+L9165: /* STRING */
+    tp_aot_op(tp, f, code + 9165);
+L9168: /* GGET */
+    tp_aot_op(tp, f, code + 9168);
+L9173: /* STRING */
+    tp_aot_op(tp, f, code + 9173);
+L9177: /* STRING */
+    tp_aot_op(tp, f, code + 9177);
+L9180: /* STRING */
+    tp_aot_op(tp, f, code + 9180);
+L9183: /* NUMBER */
+    tp_aot_op(tp, f, code + 9183);
+L9186: /* DICT */
+    tp_aot_op(tp, f, code + 9186);
+L9187: /* LINE */
+    f->line = code + 9187;
+    f->lineno = 426;
+L9205: /* STRING */
+    tp_aot_op(tp, f, code + 9205);
+L9209: /* STRING */
+    tp_aot_op(tp, f, code + 9209);
+L9212: /* NUMBER */
+    tp_aot_op(tp, f, code + 9212);
+L9215: /* STRING */
+    tp_aot_op(tp, f, code + 9215);
+L9218: /* GGET */
+    tp_aot_op(tp, f, code + 9218);
+L9223: /* STRING */
+    tp_aot_op(tp, f, code + 9223);
+L9227: /* STRING */
+    tp_aot_op(tp, f, code + 9227);
+L9231: /* STRING */
+    tp_aot_op(tp, f, code + 9231);
+L9234: /* NUMBER */
+    tp_aot_op(tp, f, code + 9234);
+L9237: /* DICT */
+    tp_aot_op(tp, f, code + 9237);
+L9238: /* LINE */
+    f->line = code + 9238;
+    f->lineno = 428;
+L9242: /* STRING */
+    tp_aot_op(tp, f, code + 9242);
+L9245: /* LINE */
+    f->line = code + 9245;
+    f->lineno = 429;
+L9257: /* STRING */
+    tp_aot_op(tp, f, code + 9257);
+L9260: /* NUMBER */
+    tp_aot_op(tp, f, code + 9260);
+L9263: /* STRING */
+    tp_aot_op(tp, f, code + 9263);
+L9266: /* NUMBER */
+    tp_aot_op(tp, f, code + 9266);
+L9269: /* STRING */
+    tp_aot_op(tp, f, code + 9269);
+L9272: /* GGET */
+    tp_aot_op(tp, f, code + 9272);
+L9277: /* DICT */
+    tp_aot_op(tp, f, code + 9277);
+L9278: /* DICT */
+    tp_aot_op(tp, f, code + 9278);
+L9279: /* GSET */
+    tp_set(tp, f->globals, regs[41], regs[42]);
+L9280: /* LINE */
+    f->line = code + 9280;
+    f->lineno = 433;
+L9288: /* VAR */
+L9291: /* STRING */
+    tp_aot_op(tp, f, code + 9291);
+L9294: /* STRING */
+    tp_aot_op(tp, f, code + 9294);
+L9297: /* LIST */
+    tp_aot_op(tp, f, code + 9297);
+L9298: /* LIST */
+    tp_aot_op(tp, f, code + 9298);
+L9299: /* STRING */
+    tp_aot_op(tp, f, code + 9299);
+L9302: /* NONE */
+    regs[45] = tp_None;
+L9303: /* DEF */
+    tp_aot_op(tp, f, code + 9303);
+L9381: /* STRING */
+    tp_aot_op(tp, f, code + 9381);
+L9385: /* GSET */
+    tp_set(tp, f->globals, regs[42], regs[41]);
+L9386: /* LINE */
+    f->line = code + 9386;
+    f->lineno = 435;
+L9400: /* GGET */
+    tp_aot_op(tp, f, code + 9400);
+L9404: /* NUMBER */
+    tp_aot_op(tp, f, code + 9404);
+L9407: /* GGET */
+    tp_aot_op(tp, f, code + 9407);
+L9412: /* STRING */
+    tp_aot_op(tp, f, code + 9412);
+L9415: /* STRING */
+    tp_aot_op(tp, f, code + 9415);
+L9418: /* STRING */
+    tp_aot_op(tp, f, code + 9418);
+L9421: /* STRING */
+    tp_aot_op(tp, f, code + 9421);
+L9424: /* STRING */
+    tp_aot_op(tp, f, code + 9424);
+L9427: /* STRING */
+    tp_aot_op(tp, f, code + 9427);
+L9430: /* CALLP */
+    return code + 9430;
+L9431: /* LINE */
+    f->line = code + 9431;
+    f->lineno = 436;
+L9440: /* GGET */
+    tp_aot_op(tp, f, code + 9440);
+L9444: /* NUMBER */
+    tp_aot_op(tp, f, code + 9444);
+L9447: /* GGET */
+    tp_aot_op(tp, f, code + 9447);
+L9452: /* STRING */
+    tp_aot_op(tp, f, code + 9452);
+L9455: /* STRING */
+    tp_aot_op(tp, f, code + 9455);
+L9458: /* CALLP */
+    return code + 9458;
+L9459: /* LINE */
+    f->line = code + 9459;
+    f->lineno = 437;
+L9475: /* GGET */
+    tp_aot_op(tp, f, code + 9475);
+L9479: /* NUMBER */
+    tp_aot_op(tp, f, code + 9479);
+L9482: /* GGET */
+    tp_aot_op(tp, f, code + 9482);
+L9487: /* STRING */
+    tp_aot_op(tp, f, code + 9487);
+L9490: /* STRING */
+    tp_aot_op(tp, f, code + 9490);
+L9493: /* STRING */
+    tp_aot_op(tp, f, code + 9493);
+L9496: /* STRING */
+    tp_aot_op(tp, f, code + 9496);
+L9499: /* STRING */
+    tp_aot_op(tp, f, code + 9499);
+L9502: /* STRING */
+    tp_aot_op(tp, f, code + 9502);
+L9505: /* STRING */
+    tp_aot_op(tp, f, code + 9505);
+L9508: /* CALLP */
+    return code + 9508;
+L9509: /* LINE */
+    f->line = code + 9509;
+    f->lineno = 438;
+L9518: /* GGET */
+    tp_aot_op(tp, f, code + 9518);
+L9522: /* NUMBER */
+    tp_aot_op(tp, f, code + 9522);
+L9525: /* GGET */
+    tp_aot_op(tp, f, code + 9525);
+L9530: /* STRING */
+    tp_aot_op(tp, f, code + 9530);
+L9533: /* STRING */
+    tp_aot_op(tp, f, code + 9533);
+L9536: /* CALLP */
+    return code + 9536;
+L9537: /* LINE */
+    f->line = code + 9537;
+    f->lineno = 439;
+L9545: /* GGET */
+    tp_aot_op(tp, f, code + 9545);
+L9549: /* NUMBER */
+    tp_aot_op(tp, f, code + 9549);
+L9552: /* GGET */
+    tp_aot_op(tp, f, code + 9552);
+L9557: /* STRING */
+    tp_aot_op(tp, f, code + 9557);
+L9560: /* CALLP */
+    return code + 9560;
+L9561: /* LINE */
+    f->line = code + 9561;
+    f->lineno = 440;
+L9570: /* GGET */
+    tp_aot_op(tp, f, code + 9570);
+L9574: /* NUMBER */
+    tp_aot_op(tp, f, code + 9574);
+L9577: /* GGET */
+    tp_aot_op(tp, f, code + 9577);
+L9582: /* STRING */
+    tp_aot_op(tp, f, code + 9582);
+L9585: /* STRING */
+    tp_aot_op(tp, f, code + 9585);
+L9588: /* CALLP */
+    return code + 9588;
+L9589: /* LINE */
+    f->line = code + 9589;
+    f->lineno = 441;
+L9598: /* GGET */
+    tp_aot_op(tp, f, code + 9598);
+L9602: /* NUMBER */
+    tp_aot_op(tp, f, code + 9602);
+L9605: /* GGET */
+    tp_aot_op(tp, f, code + 9605);
+L9610: /* STRING */
+    tp_aot_op(tp, f, code + 9610);
+L9613: /* STRING */
+    tp_aot_op(tp, f, code + 9613);
+L9616: /* CALLP */
+    return code + 9616;
+L9617: /* LINE */
+    f->line = code + 9617;
+    f->lineno = 442;
+L9623: /* VAR */
+L9626: /* LIST */
+    tp_aot_op(tp, f, code + 9626);
+L9627: /* LIST */
+    tp_aot_op(tp, f, code + 9627);
+L9628: /* STRING */
+    tp_aot_op(tp, f, code + 9628);
+L9631: /* NONE */
+    regs[46] = tp_None;
+L9632: /* DEF */
+    tp_aot_op(tp, f, code + 9632);
+L9703: /* STRING */
+    tp_aot_op(tp, f, code + 9703);
+L9707: /* GSET */
+    tp_set(tp, f->globals, regs[43], regs[42]);
+L9708: /* LINE */
+    f->line = code + 9708;
+    f->lineno = 444;
+L9744: /* GGET */
+    tp_aot_op(tp, f, code + 9744);
+L9748: /* STRING */
+    tp_aot_op(tp, f, code + 9748);
+L9751: /* STRING */
+    tp_aot_op(tp, f, code + 9751);
+L9754: /* STRING */
+    tp_aot_op(tp, f, code + 9754);
+L9757: /* STRING */
+    tp_aot_op(tp, f, code + 9757);
+L9760: /* STRING */
+    tp_aot_op(tp, f, code + 9760);
+L9763: /* STRING */
+    tp_aot_op(tp, f, code + 9763);
+L9766: /* STRING */
+    tp_aot_op(tp, f, code + 9766);
+L9769: /* STRING */
+    tp_aot_op(tp, f, code + 9769);
+L9773: /* STRING */
+    tp_aot_op(tp, f, code + 9773);
+L9777: /* STRING */
+    tp_aot_op(tp, f, code + 9777);
+L9781: /* STRING */
+    tp_aot_op(tp, f, code + 9781);
+L9785: /* STRING */
+    tp_aot_op(tp, f, code + 9785);
+L9789: /* STRING */
+    tp_aot_op(tp, f, code + 9789);
+L9793: /* STRING */
+    tp_aot_op(tp, f, code + 9793);
+L9797: /* STRING */
+    tp_aot_op(tp, f, code + 9797);
+L9801: /* STRING */
+    tp_aot_op(tp, f, code + 9801);
+L9805: /* STRING */
+    tp_aot_op(tp, f, code + 9805);
+L9809: /* STRING */
+    tp_aot_op(tp, f, code + 9809);
+L9813: /* STRING */
+    tp_aot_op(tp, f, code + 9813);
+L9817: /* CALLP */
+    return code + 9817;
+L9818: /* LINE */
+    f->line = code + 9818;
+    f->lineno = 445;
+L9827: /* GGET */
+    tp_aot_op(tp, f, code + 9827);
+L9832: /* STRING */
+    tp_aot_op(tp, f, code + 9832);
+L9835: /* GET */
+    regs[43] = tp_get(tp, regs[43], regs[44]);
+    tp_grey(tp, regs[43]);
+L9836: /* STRING */
+    tp_aot_op(tp, f, code + 9836);
+L9839: /* STRING */
+    tp_aot_op(tp, f, code + 9839);
+L9842: /* SET */
+    tp_set(tp, regs[43], regs[45], regs[44]);
+L9843: /* LINE */
+    f->line = code + 9843;
+    f->lineno = 447;
+L9848: /* VAR */
+L9851: /* STRING */
+    tp_aot_op(tp, f, code + 9851);
+L9854: /* STRING */
+    tp_aot_op(tp, f, code + 9854);
+L9857: /* LIST */
+    tp_aot_op(tp, f, code + 9857);
+L9858: /* LIST */
+    tp_aot_op(tp, f, code + 9858);
+L9859: /* NONE */
+    regs[46] = tp_None;
+L9860: /* NONE */
+    regs[47] = tp_None;
+L9861: /* DEF */
+    tp_aot_op(tp, f, code + 9861);
+L9938: /* STRING */
+    tp_aot_op(tp, f, code + 9938);
+L9942: /* GSET */
+    tp_set(tp, f->globals, regs[44], regs[43]);
+L9943: /* LINE */
+    f->line = code + 9943;
+    f->lineno = 452;
+L9947: /* VAR */
+L9950: /* STRING */
+    tp_aot_op(tp, f, code + 9950);
+L9953: /* LIST */
+    tp_aot_op(tp, f, code + 9953);
+L9954: /* LIST */
+    tp_aot_op(tp, f, code + 9954);
+L9955: /* NONE */
+    regs[47] = tp_None;
+L9956: /* NONE */
+    regs[48] = tp_None;
+L9957: /* DEF */
+    tp_aot_op(tp, f, code + 9957);
+L10060: /* STRING */
+    tp_aot_op(tp, f, code + 10060);
+L10063: /* GSET */
+    tp_set(tp, f->globals, regs[45], regs[44]);
+L10064: /* LINE */
+    f->line = code + 10064;
+    f->lineno = 457;
+L10070: /* VAR */
+L10073: /* LIST */
+    tp_aot_op(tp, f, code + 10073);
+L10074: /* LIST */
+    tp_aot_op(tp, f, code + 10074);
+L10075: /* NONE */
+    regs[48] = tp_None;
+L10076: /* NONE */
+    regs[49] = tp_None;
+L10077: /* DEF */
+    tp_aot_op(tp, f, code + 10077);
+L10226: /* STRING */
+    tp_aot_op(tp, f, code + 10226);
+L10231: /* GSET */
+    tp_set(tp, f->globals, regs[46], regs[45]);
+L10232: /* LINE */
+    f->line = code + 10232;
+    f->lineno = 466;
+L10240: /* VAR */
+L10243: /* STRING */
+    tp_aot_op(tp, f, code + 10243);
+L10246: /* STRING */
+    tp_aot_op(tp, f, code + 10246);
+L10250: /* STRING */
+    tp_aot_op(tp, f, code + 10250);
+L10254: /* LIST */
+    tp_aot_op(tp, f, code + 10254);
+L10255: /* NUMBER */
+    tp_aot_op(tp, f, code + 10255);
+L10258: /* LIST */
+    tp_aot_op(tp, f, code + 10258);
+L10259: /* NONE */
+    regs[49] = tp_None;
+L10260: /* NONE */
+    regs[50] = tp_None;
+L10261: /* DEF */
+    tp_aot_op(tp, f, code + 10261);
+L10379: /* STRING */
+    tp_aot_op(tp, f, code + 10379);
+L10383: /* GSET */
+    tp_set(tp, f->globals, regs[47], regs[46]);
+L10384: /* EOF */
+    return code + 10384;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_140(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 26: goto L26;
+        case 27: goto L27;
+        case 37: goto L37;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 45: goto L45;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 59: goto L59;
+        case 63: goto L63;
+        case 65: goto L65;
+        case 66: goto L66;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 71: goto L71;
+        case 72: goto L72;
+        case 87: goto L87;
+        case 91: goto L91;
+        case 93: goto L93;
+        case 97: goto L97;
+        case 98: goto L98;
+        case 99: goto L99;
+        case 100: goto L100;
+        case 103: goto L103;
+        case 105: goto L105;
+        case 106: goto L106;
+        case 107: goto L107;
+        case 108: goto L108;
+        case 111: goto L111;
+        case 112: goto L112;
+        case 118: goto L118;
+        case 121: goto L121;
+        case 122: goto L122;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 5;
+L8: /* VAR */
+L10: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[2];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L26: /* NAME */
+    f->name = regs[2];
+L27: /* LINE */
+    f->line = code + 27;
+    f->lineno = 6;
+L37: /* NUMBER */
+    tp_aot_op(tp, f, code + 37);
+L40: /* GET */
+    regs[2] = tp_get(tp, regs[1], regs[3]);
+    tp_grey(tp, regs[2]);
+L41: /* NONE */
+    regs[3] = tp_None;
+L42: /* EQ */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint == regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 42);
+    }
+L43: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L45;
+    }
+L44: /* JUMP */
+    goto L49;
+L45: /* NUMBER */
+    tp_aot_op(tp, f, code + 45);
+L48: /* RETURN */
+    return code + 48;
+L49: /* LINE */
+    f->line = code + 49;
+    f->lineno = 7;
+L59: /* STRING */
+    tp_aot_op(tp, f, code + 59);
+L63: /* MGET */
+    tp_aot_op(tp, f, code + 63);
+L65: /* IN */
+    regs[2] = tp_has(tp, regs[1], regs[2]);
+L66: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L68;
+    }
+L67: /* JUMP */
+    goto L72;
+L68: /* NUMBER */
+    tp_aot_op(tp, f, code + 68);
+L71: /* RETURN */
+    return code + 71;
+L72: /* LINE */
+    f->line = code + 72;
+    f->lineno = 8;
+L87: /* STRING */
+    tp_aot_op(tp, f, code + 87);
+L91: /* MGET */
+    tp_aot_op(tp, f, code + 91);
+L93: /* STRING */
+    tp_aot_op(tp, f, code + 93);
+L97: /* EQ */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint == regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 97);
+    }
+L98: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L100;
+    }
+L99: /* JUMP */
+    goto L106;
+L100: /* STRING */
+    tp_aot_op(tp, f, code + 100);
+L103: /* MGET */
+    tp_aot_op(tp, f, code + 103);
+L105: /* IN */
+    regs[2] = tp_has(tp, regs[1], regs[2]);
+L106: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L108;
+    }
+L107: /* JUMP */
+    goto L112;
+L108: /* NUMBER */
+    tp_aot_op(tp, f, code + 108);
+L111: /* RETURN */
+    return code + 111;
+L112: /* LINE */
+    f->line = code + 112;
+    f->lineno = 9;
+L118: /* NUMBER */
+    tp_aot_op(tp, f, code + 118);
+L121: /* RETURN */
+    return code + 121;
+L122: /* EOF */
+    return code + 122;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_287(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 35: goto L35;
+        case 38: goto L38;
+        case 42: goto L42;
+        case 44: goto L44;
+        case 48: goto L48;
+        case 50: goto L50;
+        case 51: goto L51;
+        case 55: goto L55;
+        case 56: goto L56;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 66: goto L66;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 72: goto L72;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 78: goto L78;
+        case 79: goto L79;
+        case 91: goto L91;
+        case 95: goto L95;
+        case 98: goto L98;
+        case 101: goto L101;
+        case 104: goto L104;
+        case 108: goto L108;
+        case 109: goto L109;
+        case 110: goto L110;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 11;
+L7: /* VAR */
+L9: /* VAR */
+L11: /* STRING */
+    tp_aot_op(tp, f, code + 11);
+L20: /* FILE */
+    f->fname = regs[2];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L25: /* NAME */
+    f->name = regs[2];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 12;
+L35: /* GGET */
+    tp_aot_op(tp, f, code + 35);
+L38: /* STRING */
+    tp_aot_op(tp, f, code + 38);
+L42: /* MGET */
+    tp_aot_op(tp, f, code + 42);
+L44: /* STRING */
+    tp_aot_op(tp, f, code + 44);
+L48: /* METHOD */
+    tp_aot_op(tp, f, code + 48);
+L50: /* MOVE */
+    regs[6] = regs[0];
+L51: /* GGET */
+    tp_aot_op(tp, f, code + 51);
+L55: /* GET */
+    regs[7] = tp_get(tp, regs[7], regs[0]);
+    tp_grey(tp, regs[7]);
+L56: /* LIST */
+    tp_aot_op(tp, f, code + 56);
+L57: /* CALLM */
+    return code + 57;
+L58: /* LINE */
+    f->line = code + 58;
+    f->lineno = 13;
+L66: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L68;
+    }
+L67: /* JUMP */
+    goto L79;
+L68: /* GGET */
+    tp_aot_op(tp, f, code + 68);
+L72: /* GGET */
+    tp_aot_op(tp, f, code + 72);
+L76: /* GET */
+    regs[3] = tp_get(tp, regs[3], regs[0]);
+    tp_grey(tp, regs[3]);
+L77: /* SET */
+    tp_set(tp, regs[2], regs[0], regs[3]);
+L78: /* JUMP */
+    goto L110;
+L79: /* LINE */
+    f->line = code + 79;
+    f->lineno = 14;
+L91: /* GGET */
+    tp_aot_op(tp, f, code + 91);
+L95: /* STRING */
+    tp_aot_op(tp, f, code + 95);
+L98: /* NUMBER */
+    tp_aot_op(tp, f, code + 98);
+L101: /* STRING */
+    tp_aot_op(tp, f, code + 101);
+L104: /* GGET */
+    tp_aot_op(tp, f, code + 104);
+L108: /* DICT */
+    tp_aot_op(tp, f, code + 108);
+L109: /* SET */
+    tp_set(tp, regs[2], regs[0], regs[3]);
+L110: /* EOF */
+    return code + 110;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_416(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 11: goto L11;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 33: goto L33;
+        case 36: goto L36;
+        case 40: goto L40;
+        case 42: goto L42;
+        case 45: goto L45;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 50: goto L50;
+        case 52: goto L52;
+        case 55: goto L55;
+        case 56: goto L56;
+        case 58: goto L58;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 67: goto L67;
+        case 71: goto L71;
+        case 72: goto L72;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 15;
+L7: /* VAR */
+L11: /* STRING */
+    tp_aot_op(tp, f, code + 11);
+L20: /* FILE */
+    f->fname = regs[1];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 16;
+L33: /* GGET */
+    tp_aot_op(tp, f, code + 33);
+L36: /* STRING */
+    tp_aot_op(tp, f, code + 36);
+L40: /* MGET */
+    tp_aot_op(tp, f, code + 40);
+L42: /* STRING */
+    tp_aot_op(tp, f, code + 42);
+L45: /* METHOD */
+    tp_aot_op(tp, f, code + 45);
+L47: /* CALLM */
+    return code + 47;
+L48: /* VAR */
+L50: /* VAR */
+L52: /* NUMBER */
+    tp_aot_op(tp, f, code + 52);
+L55: /* GET */
+    regs[4] = tp_get(tp, regs[1], regs[2]);
+    tp_grey(tp, regs[4]);
+L56: /* VAR */
+L58: /* NUMBER */
+    tp_aot_op(tp, f, code + 58);
+L61: /* GET */
+    regs[5] = tp_get(tp, regs[1], regs[3]);
+    tp_grey(tp, regs[5]);
+L62: /* LINE */
+    f->line = code + 62;
+    f->lineno = 17;
+L67: /* GGET */
+    tp_aot_op(tp, f, code + 67);
+L71: /* SET */
+    tp_set(tp, regs[1], regs[4], regs[5]);
+L72: /* EOF */
+    return code + 72;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_509(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 6: goto L6;
+        case 8: goto L8;
+        case 17: goto L17;
+        case 18: goto L18;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 26: goto L26;
+        case 28: goto L28;
+        case 29: goto L29;
+        case 30: goto L30;
+        case 38: goto L38;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 54: goto L54;
+        case 55: goto L55;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 19;
+L6: /* VAR */
+L8: /* STRING */
+    tp_aot_op(tp, f, code + 8);
+L17: /* FILE */
+    f->fname = regs[1];
+L18: /* STRING */
+    tp_aot_op(tp, f, code + 18);
+L21: /* NAME */
+    f->name = regs[1];
+L22: /* LINE */
+    f->line = code + 22;
+    f->lineno = 20;
+L26: /* VAR */
+L28: /* DICT */
+    tp_aot_op(tp, f, code + 28);
+L29: /* MOVE */
+    regs[1] = regs[2];
+L30: /* LINE */
+    f->line = code + 30;
+    f->lineno = 21;
+L38: /* NUMBER */
+    tp_aot_op(tp, f, code + 38);
+L41: /* ITER */
+    if (tp_iter_next(tp, &regs[2], regs[0], &regs[3])) {
+        goto L43;
+    }
+L42: /* JUMP */
+    goto L49;
+L43: /* VAR */
+L45: /* MOVE */
+    regs[4] = regs[2];
+L46: /* GET */
+    regs[2] = tp_get(tp, regs[0], regs[4]);
+    tp_grey(tp, regs[2]);
+L47: /* SET */
+    tp_set(tp, regs[1], regs[4], regs[2]);
+L48: /* JUMP */
+    tp_aot_safepoint(tp, 7);
+    goto L41;
+L49: /* LINE */
+    f->line = code + 49;
+    f->lineno = 22;
+L54: /* RETURN */
+    return code + 54;
+L55: /* EOF */
+    return code + 55;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_601(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 17: goto L17;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 26: goto L26;
+        case 30: goto L30;
+        case 31: goto L31;
+        case 32: goto L32;
+        case 33: goto L33;
+        case 34: goto L34;
+        case 154: goto L154;
+        case 158: goto L158;
+        case 159: goto L159;
+        case 165: goto L165;
+        case 167: goto L167;
+        case 171: goto L171;
+        case 172: goto L172;
+        case 173: goto L173;
+        case 174: goto L174;
+        case 175: goto L175;
+        case 271: goto L271;
+        case 274: goto L274;
+        case 275: goto L275;
+        case 284: goto L284;
+        case 287: goto L287;
+        case 291: goto L291;
+        case 294: goto L294;
+        case 295: goto L295;
+        case 296: goto L296;
+        case 297: goto L297;
+        case 298: goto L298;
+        case 299: goto L299;
+        case 602: goto L602;
+        case 605: goto L605;
+        case 606: goto L606;
+        case 613: goto L613;
+        case 616: goto L616;
+        case 620: goto L620;
+        case 621: goto L621;
+        case 622: goto L622;
+        case 623: goto L623;
+        case 624: goto L624;
+        case 708: goto L708;
+        case 712: goto L712;
+        case 713: goto L713;
+        case 717: goto L717;
+        case 720: goto L720;
+        case 725: goto L725;
+        case 726: goto L726;
+        case 730: goto L730;
+        case 731: goto L731;
+        case 735: goto L735;
+        case 736: goto L736;
+        case 741: goto L741;
+        case 742: goto L742;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 24;
+L7: /* LINE */
+    f->line = code + 7;
+    f->lineno = 25;
+L17: /* VAR */
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* STRING */
+    tp_aot_op(tp, f, code + 23);
+L26: /* STRING */
+    tp_aot_op(tp, f, code + 26);
+L30: /* LIST */
+    tp_aot_op(tp, f, code + 30);
+L31: /* LIST */
+    tp_aot_op(tp, f, code + 31);
+L32: /* NONE */
+    regs[3] = tp_None;
+L33: /* NONE */
+    regs[4] = tp_None;
+L34: /* DEF */
+    tp_aot_op(tp, f, code + 34);
+L154: /* VAR */
+L158: /* MOVE */
+    regs[1] = regs[0];
+L159: /* LINE */
+    f->line = code + 159;
+    f->lineno = 32;
+L165: /* VAR */
+L167: /* STRING */
+    tp_aot_op(tp, f, code + 167);
+L171: /* LIST */
+    tp_aot_op(tp, f, code + 171);
+L172: /* LIST */
+    tp_aot_op(tp, f, code + 172);
+L173: /* NONE */
+    regs[5] = tp_None;
+L174: /* NONE */
+    regs[6] = tp_None;
+L175: /* DEF */
+    tp_aot_op(tp, f, code + 175);
+L271: /* VAR */
+L274: /* MOVE */
+    regs[3] = regs[2];
+L275: /* LINE */
+    f->line = code + 275;
+    f->lineno = 37;
+L284: /* VAR */
+L287: /* STRING */
+    tp_aot_op(tp, f, code + 287);
+L291: /* STRING */
+    tp_aot_op(tp, f, code + 291);
+L294: /* LIST */
+    tp_aot_op(tp, f, code + 294);
+L295: /* NONE */
+    regs[9] = tp_None;
+L296: /* LIST */
+    tp_aot_op(tp, f, code + 296);
+L297: /* NONE */
+    regs[7] = tp_None;
+L298: /* NONE */
+    regs[8] = tp_None;
+L299: /* DEF */
+    tp_aot_op(tp, f, code + 299);
+L602: /* VAR */
+L605: /* MOVE */
+    regs[5] = regs[4];
+L606: /* LINE */
+    f->line = code + 606;
+    f->lineno = 52;
+L613: /* VAR */
+L616: /* STRING */
+    tp_aot_op(tp, f, code + 616);
+L620: /* LIST */
+    tp_aot_op(tp, f, code + 620);
+L621: /* LIST */
+    tp_aot_op(tp, f, code + 621);
+L622: /* NONE */
+    regs[9] = tp_None;
+L623: /* NONE */
+    regs[10] = tp_None;
+L624: /* DEF */
+    tp_aot_op(tp, f, code + 624);
+L708: /* VAR */
+L712: /* MOVE */
+    regs[7] = regs[6];
+L713: /* GGET */
+    tp_aot_op(tp, f, code + 713);
+L717: /* VAR */
+L720: /* STRING */
+    tp_aot_op(tp, f, code + 720);
+L725: /* SET */
+    tp_set(tp, regs[8], regs[9], regs[1]);
+L726: /* STRING */
+    tp_aot_op(tp, f, code + 726);
+L730: /* SET */
+    tp_set(tp, regs[8], regs[9], regs[3]);
+L731: /* STRING */
+    tp_aot_op(tp, f, code + 731);
+L735: /* SET */
+    tp_set(tp, regs[8], regs[9], regs[5]);
+L736: /* STRING */
+    tp_aot_op(tp, f, code + 736);
+L741: /* SET */
+    tp_set(tp, regs[8], regs[9], regs[7]);
+L742: /* EOF */
+    return code + 742;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_1367(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 26: goto L26;
+        case 27: goto L27;
+        case 37: goto L37;
+        case 42: goto L42;
+        case 46: goto L46;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 52: goto L52;
+        case 55: goto L55;
+        case 57: goto L57;
+        case 60: goto L60;
+        case 62: goto L62;
+        case 63: goto L63;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 56;
+L8: /* VAR */
+L10: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[2];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L26: /* NAME */
+    f->name = regs[2];
+L27: /* LINE */
+    f->line = code + 27;
+    f->lineno = 57;
+L37: /* GGET */
+    tp_aot_op(tp, f, code + 37);
+L42: /* STRING */
+    tp_aot_op(tp, f, code + 42);
+L46: /* METHOD */
+    tp_aot_op(tp, f, code + 46);
+L48: /* MOVE */
+    regs[6] = regs[0];
+L49: /* GGET */
+    tp_aot_op(tp, f, code + 49);
+L52: /* STRING */
+    tp_aot_op(tp, f, code + 52);
+L55: /* MGET */
+    tp_aot_op(tp, f, code + 55);
+L57: /* STRING */
+    tp_aot_op(tp, f, code + 57);
+L60: /* MGET */
+    tp_aot_op(tp, f, code + 60);
+L62: /* CALLM */
+    return code + 62;
+L63: /* EOF */
+    return code + 63;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_1451(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 6: goto L6;
+        case 8: goto L8;
+        case 17: goto L17;
+        case 18: goto L18;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 28: goto L28;
+        case 31: goto L31;
+        case 33: goto L33;
+        case 34: goto L34;
+        case 35: goto L35;
+        case 36: goto L36;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 59;
+L6: /* VAR */
+L8: /* STRING */
+    tp_aot_op(tp, f, code + 8);
+L17: /* FILE */
+    f->fname = regs[1];
+L18: /* STRING */
+    tp_aot_op(tp, f, code + 18);
+L21: /* NAME */
+    f->name = regs[1];
+L22: /* LINE */
+    f->line = code + 22;
+    f->lineno = 62;
+L28: /* STRING */
+    tp_aot_op(tp, f, code + 28);
+L31: /* METHOD */
+    tp_aot_op(tp, f, code + 31);
+L33: /* MOVE */
+    regs[4] = regs[0];
+L34: /* CALLM */
+    return code + 34;
+L35: /* RETURN */
+    return code + 35;
+L36: /* EOF */
+    return code + 36;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_1513(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 13: goto L13;
+        case 22: goto L22;
+        case 23: goto L23;
+        case 26: goto L26;
+        case 27: goto L27;
+        case 35: goto L35;
+        case 38: goto L38;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 44: goto L44;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 63;
+L8: /* VAR */
+L10: /* VAR */
+L13: /* STRING */
+    tp_aot_op(tp, f, code + 13);
+L22: /* FILE */
+    f->fname = regs[2];
+L23: /* STRING */
+    tp_aot_op(tp, f, code + 23);
+L26: /* NAME */
+    f->name = regs[2];
+L27: /* LINE */
+    f->line = code + 27;
+    f->lineno = 66;
+L35: /* STRING */
+    tp_aot_op(tp, f, code + 35);
+L38: /* METHOD */
+    tp_aot_op(tp, f, code + 38);
+L40: /* MOVE */
+    regs[5] = regs[0];
+L41: /* MOVE */
+    regs[6] = regs[1];
+L42: /* CALLM */
+    return code + 42;
+L43: /* RETURN */
+    return code + 43;
+L44: /* EOF */
+    return code + 44;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_1578(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 30: goto L30;
+        case 33: goto L33;
+        case 35: goto L35;
+        case 36: goto L36;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 67;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 70;
+L30: /* STRING */
+    tp_aot_op(tp, f, code + 30);
+L33: /* MGET */
+    tp_aot_op(tp, f, code + 33);
+L35: /* RETURN */
+    return code + 35;
+L36: /* EOF */
+    return code + 36;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_1637(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 32: goto L32;
+        case 36: goto L36;
+        case 38: goto L38;
+        case 39: goto L39;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 71;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 74;
+L32: /* STRING */
+    tp_aot_op(tp, f, code + 32);
+L36: /* MGET */
+    tp_aot_op(tp, f, code + 36);
+L38: /* RETURN */
+    return code + 38;
+L39: /* EOF */
+    return code + 39;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_1708(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 16: goto L16;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 31: goto L31;
+        case 32: goto L32;
+        case 39: goto L39;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 49: goto L49;
+        case 51: goto L51;
+        case 54: goto L54;
+        case 58: goto L58;
+        case 60: goto L60;
+        case 66: goto L66;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 78: goto L78;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 93: goto L93;
+        case 97: goto L97;
+        case 100: goto L100;
+        case 104: goto L104;
+        case 106: goto L106;
+        case 107: goto L107;
+        case 108: goto L108;
+        case 109: goto L109;
+        case 110: goto L110;
+        case 116: goto L116;
+        case 119: goto L119;
+        case 123: goto L123;
+        case 125: goto L125;
+        case 131: goto L131;
+        case 135: goto L135;
+        case 136: goto L136;
+        case 144: goto L144;
+        case 147: goto L147;
+        case 148: goto L148;
+        case 149: goto L149;
+        case 150: goto L150;
+        case 151: goto L151;
+        case 156: goto L156;
+        case 157: goto L157;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 76;
+L11: /* VAR */
+L13: /* VAR */
+L16: /* STRING */
+    tp_aot_op(tp, f, code + 16);
+L25: /* FILE */
+    f->fname = regs[2];
+L26: /* STRING */
+    tp_aot_op(tp, f, code + 26);
+L31: /* NAME */
+    f->name = regs[2];
+L32: /* LINE */
+    f->line = code + 32;
+    f->lineno = 77;
+L39: /* NONE */
+    regs[3] = tp_None;
+L40: /* EQ */
+    if (TP_BOTH(regs[1], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[1].nint == regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 40);
+    }
+L41: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L43;
+    }
+L42: /* JUMP */
+    goto L83;
+L43: /* LINE */
+    f->line = code + 43;
+    f->lineno = 78;
+L49: /* VAR */
+L51: /* GGET */
+    tp_aot_op(tp, f, code + 51);
+L54: /* STRING */
+    tp_aot_op(tp, f, code + 54);
+L58: /* MGET */
+    tp_aot_op(tp, f, code + 58);
+L60: /* LINE */
+    f->line = code + 60;
+    f->lineno = 79;
+L66: /* GGET */
+    tp_aot_op(tp, f, code + 66);
+L70: /* CALLP */
+    return code + 70;
+L71: /* LINE */
+    f->line = code + 71;
+    f->lineno = 80;
+L78: /* GGET */
+    tp_aot_op(tp, f, code + 78);
+L81: /* MOVE */
+    regs[5] = regs[2];
+L82: /* CALLP */
+    return code + 82;
+L83: /* LINE */
+    f->line = code + 83;
+    f->lineno = 81;
+L93: /* GGET */
+    tp_aot_op(tp, f, code + 93);
+L97: /* GGET */
+    tp_aot_op(tp, f, code + 97);
+L100: /* STRING */
+    tp_aot_op(tp, f, code + 100);
+L104: /* MGET */
+    tp_aot_op(tp, f, code + 104);
+L106: /* CALLP */
+    return code + 106;
+L107: /* LT */
+    if (TP_BOTH(regs[0], regs[4], TP_NUMBER_INT)) {
+        regs[3] = tp_bool(regs[0].nint < regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 107);
+    }
+L108: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L110;
+    }
+L109: /* JUMP */
+    goto L151;
+L110: /* LINE */
+    f->line = code + 110;
+    f->lineno = 82;
+L116: /* GGET */
+    tp_aot_op(tp, f, code + 116);
+L119: /* STRING */
+    tp_aot_op(tp, f, code + 119);
+L123: /* MGET */
+    tp_aot_op(tp, f, code + 123);
+L125: /* LINE */
+    f->line = code + 125;
+    f->lineno = 83;
+L131: /* GGET */
+    tp_aot_op(tp, f, code + 131);
+L135: /* CALLP */
+    return code + 135;
+L136: /* LINE */
+    f->line = code + 136;
+    f->lineno = 84;
+L144: /* GGET */
+    tp_aot_op(tp, f, code + 144);
+L147: /* MOVE */
+    regs[5] = regs[2];
+L148: /* MOVE */
+    regs[6] = regs[1];
+L149: /* CALLP */
+    return code + 149;
+L150: /* JUMP */
+    tp_aot_safepoint(tp, 57);
+    goto L93;
+L151: /* LINE */
+    f->line = code + 151;
+    f->lineno = 85;
+L156: /* RETURN */
+    return code + 156;
+L157: /* EOF */
+    return code + 157;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_1894(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 14: goto L14;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 29: goto L29;
+        case 30: goto L30;
+        case 41: goto L41;
+        case 46: goto L46;
+        case 49: goto L49;
+        case 51: goto L51;
+        case 52: goto L52;
+        case 53: goto L53;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 63: goto L63;
+        case 64: goto L64;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 87;
+L9: /* VAR */
+L11: /* VAR */
+L14: /* STRING */
+    tp_aot_op(tp, f, code + 14);
+L23: /* FILE */
+    f->fname = regs[2];
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L29: /* NAME */
+    f->name = regs[2];
+L30: /* LINE */
+    f->line = code + 30;
+    f->lineno = 88;
+L41: /* GGET */
+    tp_aot_op(tp, f, code + 41);
+L46: /* STRING */
+    tp_aot_op(tp, f, code + 46);
+L49: /* MGET */
+    tp_aot_op(tp, f, code + 49);
+L51: /* CALLP */
+    return code + 51;
+L52: /* LIST */
+    tp_aot_op(tp, f, code + 52);
+L53: /* STRING */
+    tp_aot_op(tp, f, code + 53);
+L57: /* SET */
+    tp_set(tp, regs[0], regs[1], regs[2]);
+L58: /* LINE */
+    f->line = code + 58;
+    f->lineno = 89;
+L63: /* RETURN */
+    return code + 63;
+L64: /* EOF */
+    return code + 64;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_1987(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 14: goto L14;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 29: goto L29;
+        case 30: goto L30;
+        case 39: goto L39;
+        case 43: goto L43;
+        case 46: goto L46;
+        case 50: goto L50;
+        case 52: goto L52;
+        case 55: goto L55;
+        case 56: goto L56;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 65: goto L65;
+        case 69: goto L69;
+        case 72: goto L72;
+        case 73: goto L73;
+        case 80: goto L80;
+        case 84: goto L84;
+        case 87: goto L87;
+        case 88: goto L88;
+        case 99: goto L99;
+        case 100: goto L100;
+        case 105: goto L105;
+        case 108: goto L108;
+        case 110: goto L110;
+        case 111: goto L111;
+        case 112: goto L112;
+        case 116: goto L116;
+        case 117: goto L117;
+        case 122: goto L122;
+        case 123: goto L123;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 90;
+L9: /* VAR */
+L11: /* VAR */
+L14: /* STRING */
+    tp_aot_op(tp, f, code + 14);
+L23: /* FILE */
+    f->fname = regs[2];
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L29: /* NAME */
+    f->name = regs[2];
+L30: /* LINE */
+    f->line = code + 30;
+    f->lineno = 91;
+L39: /* GGET */
+    tp_aot_op(tp, f, code + 39);
+L43: /* GGET */
+    tp_aot_op(tp, f, code + 43);
+L46: /* STRING */
+    tp_aot_op(tp, f, code + 46);
+L50: /* MGET */
+    tp_aot_op(tp, f, code + 50);
+L52: /* STRING */
+    tp_aot_op(tp, f, code + 52);
+L55: /* CALLP */
+    return code + 55;
+L56: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L58;
+    }
+L57: /* JUMP */
+    goto L88;
+L58: /* LINE */
+    f->line = code + 58;
+    f->lineno = 92;
+L65: /* STRING */
+    tp_aot_op(tp, f, code + 65);
+L69: /* STRING */
+    tp_aot_op(tp, f, code + 69);
+L72: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[2]);
+L73: /* LINE */
+    f->line = code + 73;
+    f->lineno = 93;
+L80: /* GGET */
+    tp_aot_op(tp, f, code + 80);
+L84: /* STRING */
+    tp_aot_op(tp, f, code + 84);
+L87: /* CALLP */
+    return code + 87;
+L88: /* LINE */
+    f->line = code + 88;
+    f->lineno = 94;
+L99: /* MOVE */
+    regs[3] = regs[1];
+L100: /* GGET */
+    tp_aot_op(tp, f, code + 100);
+L105: /* STRING */
+    tp_aot_op(tp, f, code + 105);
+L108: /* MGET */
+    tp_aot_op(tp, f, code + 108);
+L110: /* CALLP */
+    return code + 110;
+L111: /* LIST */
+    tp_aot_op(tp, f, code + 111);
+L112: /* STRING */
+    tp_aot_op(tp, f, code + 112);
+L116: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[2]);
+L117: /* LINE */
+    f->line = code + 117;
+    f->lineno = 95;
+L122: /* RETURN */
+    return code + 122;
+L123: /* EOF */
+    return code + 123;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_2139(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 14: goto L14;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 29: goto L29;
+        case 30: goto L30;
+        case 36: goto L36;
+        case 40: goto L40;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 50: goto L50;
+        case 54: goto L54;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 75: goto L75;
+        case 78: goto L78;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 86: goto L86;
+        case 87: goto L87;
+        case 92: goto L92;
+        case 93: goto L93;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 96;
+L9: /* VAR */
+L11: /* VAR */
+L14: /* STRING */
+    tp_aot_op(tp, f, code + 14);
+L23: /* FILE */
+    f->fname = regs[2];
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L29: /* NAME */
+    f->name = regs[2];
+L30: /* LINE */
+    f->line = code + 30;
+    f->lineno = 97;
+L36: /* GGET */
+    tp_aot_op(tp, f, code + 36);
+L40: /* STRING */
+    tp_aot_op(tp, f, code + 40);
+L43: /* CALLP */
+    return code + 43;
+L44: /* LINE */
+    f->line = code + 44;
+    f->lineno = 98;
+L50: /* STRING */
+    tp_aot_op(tp, f, code + 50);
+L54: /* STRING */
+    tp_aot_op(tp, f, code + 54);
+L57: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[2]);
+L58: /* LINE */
+    f->line = code + 58;
+    f->lineno = 99;
+L69: /* MOVE */
+    regs[3] = regs[1];
+L70: /* GGET */
+    tp_aot_op(tp, f, code + 70);
+L75: /* STRING */
+    tp_aot_op(tp, f, code + 75);
+L78: /* MGET */
+    tp_aot_op(tp, f, code + 78);
+L80: /* CALLP */
+    return code + 80;
+L81: /* LIST */
+    tp_aot_op(tp, f, code + 81);
+L82: /* STRING */
+    tp_aot_op(tp, f, code + 82);
+L86: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[2]);
+L87: /* LINE */
+    f->line = code + 87;
+    f->lineno = 100;
+L92: /* RETURN */
+    return code + 92;
+L93: /* EOF */
+    return code + 93;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_2262(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 10: goto L10;
+        case 12: goto L12;
+        case 15: goto L15;
+        case 24: goto L24;
+        case 25: goto L25;
+        case 30: goto L30;
+        case 31: goto L31;
+        case 39: goto L39;
+        case 41: goto L41;
+        case 46: goto L46;
+        case 49: goto L49;
+        case 51: goto L51;
+        case 52: goto L52;
+        case 59: goto L59;
+        case 62: goto L62;
+        case 64: goto L64;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 79: goto L79;
+        case 83: goto L83;
+        case 85: goto L85;
+        case 89: goto L89;
+        case 91: goto L91;
+        case 92: goto L92;
+        case 93: goto L93;
+        case 99: goto L99;
+        case 100: goto L100;
+        case 107: goto L107;
+        case 108: goto L108;
+        case 109: goto L109;
+        case 110: goto L110;
+        case 114: goto L114;
+        case 115: goto L115;
+        case 122: goto L122;
+        case 126: goto L126;
+        case 130: goto L130;
+        case 131: goto L131;
+        case 136: goto L136;
+        case 137: goto L137;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 101;
+L10: /* VAR */
+L12: /* VAR */
+L15: /* STRING */
+    tp_aot_op(tp, f, code + 15);
+L24: /* FILE */
+    f->fname = regs[2];
+L25: /* STRING */
+    tp_aot_op(tp, f, code + 25);
+L30: /* NAME */
+    f->name = regs[2];
+L31: /* LINE */
+    f->line = code + 31;
+    f->lineno = 102;
+L39: /* VAR */
+L41: /* GGET */
+    tp_aot_op(tp, f, code + 41);
+L46: /* STRING */
+    tp_aot_op(tp, f, code + 46);
+L49: /* MGET */
+    tp_aot_op(tp, f, code + 49);
+L51: /* CALLP */
+    return code + 51;
+L52: /* LINE */
+    f->line = code + 52;
+    f->lineno = 103;
+L59: /* STRING */
+    tp_aot_op(tp, f, code + 59);
+L62: /* MGET */
+    tp_aot_op(tp, f, code + 62);
+L64: /* STRING */
+    tp_aot_op(tp, f, code + 64);
+L67: /* EQ */
+    if (TP_BOTH(regs[4], regs[3], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[4].nint == regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 67);
+    }
+L68: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L70;
+    }
+L69: /* JUMP */
+    goto L100;
+L70: /* LINE */
+    f->line = code + 70;
+    f->lineno = 104;
+L79: /* STRING */
+    tp_aot_op(tp, f, code + 79);
+L83: /* MGET */
+    tp_aot_op(tp, f, code + 83);
+L85: /* STRING */
+    tp_aot_op(tp, f, code + 85);
+L89: /* METHOD */
+    tp_aot_op(tp, f, code + 89);
+L91: /* MOVE */
+    regs[5] = regs[2];
+L92: /* CALLM */
+    return code + 92;
+L93: /* LINE */
+    f->line = code + 93;
+    f->lineno = 105;
+L99: /* RETURN */
+    return code + 99;
+L100: /* LINE */
+    f->line = code + 100;
+    f->lineno = 106;
+L107: /* MOVE */
+    regs[3] = regs[1];
+L108: /* MOVE */
+    regs[4] = regs[2];
+L109: /* LIST */
+    tp_aot_op(tp, f, code + 109);
+L110: /* STRING */
+    tp_aot_op(tp, f, code + 110);
+L114: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[4]);
+L115: /* LINE */
+    f->line = code + 115;
+    f->lineno = 107;
+L122: /* STRING */
+    tp_aot_op(tp, f, code + 122);
+L126: /* STRING */
+    tp_aot_op(tp, f, code + 126);
+L130: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[4]);
+L131: /* LINE */
+    f->line = code + 131;
+    f->lineno = 108;
+L136: /* RETURN */
+    return code + 136;
+L137: /* EOF */
+    return code + 137;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_2421(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 6: goto L6;
+        case 8: goto L8;
+        case 17: goto L17;
+        case 18: goto L18;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 30: goto L30;
+        case 31: goto L31;
+        case 32: goto L32;
+        case 33: goto L33;
+        case 34: goto L34;
+        case 35: goto L35;
+        case 36: goto L36;
+        case 48: goto L48;
+        case 52: goto L52;
+        case 53: goto L53;
+        case 56: goto L56;
+        case 60: goto L60;
+        case 65: goto L65;
+        case 66: goto L66;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 76: goto L76;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 89: goto L89;
+        case 90: goto L90;
+        case 91: goto L91;
+        case 92: goto L92;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 109;
+L6: /* VAR */
+L8: /* STRING */
+    tp_aot_op(tp, f, code + 8);
+L17: /* FILE */
+    f->fname = regs[1];
+L18: /* STRING */
+    tp_aot_op(tp, f, code + 18);
+L21: /* NAME */
+    f->name = regs[1];
+L22: /* LINE */
+    f->line = code + 22;
+    f->lineno = 110;
+L30: /* NONE */
+    regs[1] = tp_None;
+L31: /* EQ */
+    if (TP_BOTH(regs[0], regs[1], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[0].nint == regs[1].nint);
+    } else {
+        tp_aot_op(tp, f, code + 31);
+    }
+L32: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L34;
+    }
+L33: /* JUMP */
+    goto L36;
+L34: /* LIST */
+    tp_aot_op(tp, f, code + 34);
+L35: /* RETURN */
+    return code + 35;
+L36: /* LINE */
+    f->line = code + 36;
+    f->lineno = 111;
+L48: /* GGET */
+    tp_aot_op(tp, f, code + 48);
+L52: /* MOVE */
+    regs[2] = regs[0];
+L53: /* STRING */
+    tp_aot_op(tp, f, code + 53);
+L56: /* STRING */
+    tp_aot_op(tp, f, code + 56);
+L60: /* STRING */
+    tp_aot_op(tp, f, code + 60);
+L65: /* CALLP */
+    return code + 65;
+L66: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L68;
+    }
+L67: /* JUMP */
+    goto L84;
+L68: /* LINE */
+    f->line = code + 68;
+    f->lineno = 112;
+L76: /* GGET */
+    tp_aot_op(tp, f, code + 76);
+L81: /* MOVE */
+    regs[2] = regs[0];
+L82: /* CALLP */
+    return code + 82;
+L83: /* RETURN */
+    return code + 83;
+L84: /* LINE */
+    f->line = code + 84;
+    f->lineno = 113;
+L89: /* MOVE */
+    regs[1] = regs[0];
+L90: /* LIST */
+    tp_aot_op(tp, f, code + 90);
+L91: /* RETURN */
+    return code + 91;
+L92: /* EOF */
+    return code + 92;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_2538(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 26: goto L26;
+        case 27: goto L27;
+        case 38: goto L38;
+        case 42: goto L42;
+        case 45: goto L45;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 52: goto L52;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 55: goto L55;
+        case 56: goto L56;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 114;
+L8: /* VAR */
+L10: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[2];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L26: /* NAME */
+    f->name = regs[2];
+L27: /* LINE */
+    f->line = code + 27;
+    f->lineno = 115;
+L38: /* GGET */
+    tp_aot_op(tp, f, code + 38);
+L42: /* STRING */
+    tp_aot_op(tp, f, code + 42);
+L45: /* MGET */
+    tp_aot_op(tp, f, code + 45);
+L47: /* MOVE */
+    regs[4] = regs[0];
+L48: /* MOVE */
+    regs[5] = regs[0];
+L49: /* GGET */
+    tp_aot_op(tp, f, code + 49);
+L52: /* MOVE */
+    regs[7] = regs[1];
+L53: /* CALLP */
+    return code + 53;
+L54: /* CALLP */
+    return code + 54;
+L55: /* RETURN */
+    return code + 55;
+L56: /* EOF */
+    return code + 56;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_2622(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 14: goto L14;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 29: goto L29;
+        case 30: goto L30;
+        case 41: goto L41;
+        case 43: goto L43;
+        case 47: goto L47;
+        case 50: goto L50;
+        case 52: goto L52;
+        case 56: goto L56;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 72: goto L72;
+        case 76: goto L76;
+        case 79: goto L79;
+        case 83: goto L83;
+        case 85: goto L85;
+        case 88: goto L88;
+        case 89: goto L89;
+        case 90: goto L90;
+        case 91: goto L91;
+        case 98: goto L98;
+        case 102: goto L102;
+        case 105: goto L105;
+        case 108: goto L108;
+        case 109: goto L109;
+        case 120: goto L120;
+        case 124: goto L124;
+        case 126: goto L126;
+        case 130: goto L130;
+        case 132: goto L132;
+        case 137: goto L137;
+        case 140: goto L140;
+        case 141: goto L141;
+        case 142: goto L142;
+        case 154: goto L154;
+        case 157: goto L157;
+        case 161: goto L161;
+        case 163: goto L163;
+        case 166: goto L166;
+        case 168: goto L168;
+        case 171: goto L171;
+        case 172: goto L172;
+        case 173: goto L173;
+        case 174: goto L174;
+        case 178: goto L178;
+        case 181: goto L181;
+        case 182: goto L182;
+        case 188: goto L188;
+        case 192: goto L192;
+        case 193: goto L193;
+        case 194: goto L194;
+        case 200: goto L200;
+        case 204: goto L204;
+        case 207: goto L207;
+        case 208: goto L208;
+        case 213: goto L213;
+        case 214: goto L214;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 117;
+L9: /* VAR */
+L11: /* VAR */
+L14: /* STRING */
+    tp_aot_op(tp, f, code + 14);
+L23: /* FILE */
+    f->fname = regs[2];
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L29: /* NAME */
+    f->name = regs[2];
+L30: /* LINE */
+    f->line = code + 30;
+    f->lineno = 118;
+L41: /* VAR */
+L43: /* GGET */
+    tp_aot_op(tp, f, code + 43);
+L47: /* STRING */
+    tp_aot_op(tp, f, code + 47);
+L50: /* MGET */
+    tp_aot_op(tp, f, code + 50);
+L52: /* STRING */
+    tp_aot_op(tp, f, code + 52);
+L56: /* STRING */
+    tp_aot_op(tp, f, code + 56);
+L59: /* MOVE */
+    regs[2] = regs[1];
+L60: /* LIST */
+    tp_aot_op(tp, f, code + 60);
+L61: /* CALLP */
+    return code + 61;
+L62: /* LINE */
+    f->line = code + 62;
+    f->lineno = 119;
+L72: /* GGET */
+    tp_aot_op(tp, f, code + 72);
+L76: /* GGET */
+    tp_aot_op(tp, f, code + 76);
+L79: /* STRING */
+    tp_aot_op(tp, f, code + 79);
+L83: /* MGET */
+    tp_aot_op(tp, f, code + 83);
+L85: /* STRING */
+    tp_aot_op(tp, f, code + 85);
+L88: /* CALLP */
+    return code + 88;
+L89: /* IFN */
+    if (!(TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3]))) {
+        goto L91;
+    }
+L90: /* JUMP */
+    goto L194;
+L91: /* LINE */
+    f->line = code + 91;
+    f->lineno = 120;
+L98: /* GGET */
+    tp_aot_op(tp, f, code + 98);
+L102: /* STRING */
+    tp_aot_op(tp, f, code + 102);
+L105: /* NUMBER */
+    tp_aot_op(tp, f, code + 105);
+L108: /* CALLP */
+    return code + 108;
+L109: /* LINE */
+    f->line = code + 109;
+    f->lineno = 121;
+L120: /* STRING */
+    tp_aot_op(tp, f, code + 120);
+L124: /* MGET */
+    tp_aot_op(tp, f, code + 124);
+L126: /* STRING */
+    tp_aot_op(tp, f, code + 126);
+L130: /* METHOD */
+    tp_aot_op(tp, f, code + 130);
+L132: /* GGET */
+    tp_aot_op(tp, f, code + 132);
+L137: /* NUMBER */
+    tp_aot_op(tp, f, code + 137);
+L140: /* CALLP */
+    return code + 140;
+L141: /* CALLM */
+    return code + 141;
+L142: /* LINE */
+    f->line = code + 142;
+    f->lineno = 122;
+L154: /* GGET */
+    tp_aot_op(tp, f, code + 154);
+L157: /* STRING */
+    tp_aot_op(tp, f, code + 157);
+L161: /* MGET */
+    tp_aot_op(tp, f, code + 161);
+L163: /* STRING */
+    tp_aot_op(tp, f, code + 163);
+L166: /* MGET */
+    tp_aot_op(tp, f, code + 166);
+L168: /* STRING */
+    tp_aot_op(tp, f, code + 168);
+L171: /* EQ */
+    if (TP_BOTH(regs[0], regs[3], TP_NUMBER_INT)) {
+        regs[0] = tp_bool(regs[0].nint == regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 171);
+    }
+L172: /* IF */
+    if (TP_IS_INT(regs[0]) ? regs[0].nint != 0 : tp_true(tp, regs[0])) {
+        goto L174;
+    }
+L173: /* JUMP */
+    goto L182;
+L174: /* GGET */
+    tp_aot_op(tp, f, code + 174);
+L178: /* STRING */
+    tp_aot_op(tp, f, code + 178);
+L181: /* CALLP */
+    return code + 181;
+L182: /* LINE */
+    f->line = code + 182;
+    f->lineno = 123;
+L188: /* GGET */
+    tp_aot_op(tp, f, code + 188);
+L192: /* CALLP */
+    return code + 192;
+L193: /* JUMP */
+    tp_aot_safepoint(tp, 121);
+    goto L72;
+L194: /* LINE */
+    f->line = code + 194;
+    f->lineno = 124;
+L200: /* GGET */
+    tp_aot_op(tp, f, code + 200);
+L204: /* STRING */
+    tp_aot_op(tp, f, code + 204);
+L207: /* CALLP */
+    return code + 207;
+L208: /* LINE */
+    f->line = code + 208;
+    f->lineno = 125;
+L213: /* RETURN */
+    return code + 213;
+L214: /* EOF */
+    return code + 214;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_2865(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 14: goto L14;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 28: goto L28;
+        case 29: goto L29;
+        case 40: goto L40;
+        case 42: goto L42;
+        case 46: goto L46;
+        case 49: goto L49;
+        case 51: goto L51;
+        case 54: goto L54;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 66: goto L66;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 77: goto L77;
+        case 80: goto L80;
+        case 83: goto L83;
+        case 93: goto L93;
+        case 97: goto L97;
+        case 100: goto L100;
+        case 104: goto L104;
+        case 106: goto L106;
+        case 109: goto L109;
+        case 110: goto L110;
+        case 111: goto L111;
+        case 112: goto L112;
+        case 119: goto L119;
+        case 122: goto L122;
+        case 131: goto L131;
+        case 135: goto L135;
+        case 138: goto L138;
+        case 142: goto L142;
+        case 144: goto L144;
+        case 147: goto L147;
+        case 148: goto L148;
+        case 149: goto L149;
+        case 150: goto L150;
+        case 167: goto L167;
+        case 171: goto L171;
+        case 173: goto L173;
+        case 177: goto L177;
+        case 180: goto L180;
+        case 184: goto L184;
+        case 186: goto L186;
+        case 189: goto L189;
+        case 191: goto L191;
+        case 195: goto L195;
+        case 199: goto L199;
+        case 200: goto L200;
+        case 201: goto L201;
+        case 202: goto L202;
+        case 213: goto L213;
+        case 217: goto L217;
+        case 219: goto L219;
+        case 224: goto L224;
+        case 227: goto L227;
+        case 228: goto L228;
+        case 229: goto L229;
+        case 238: goto L238;
+        case 242: goto L242;
+        case 245: goto L245;
+        case 249: goto L249;
+        case 251: goto L251;
+        case 254: goto L254;
+        case 255: goto L255;
+        case 256: goto L256;
+        case 257: goto L257;
+        case 265: goto L265;
+        case 269: goto L269;
+        case 272: goto L272;
+        case 273: goto L273;
+        case 280: goto L280;
+        case 283: goto L283;
+        case 284: goto L284;
+        case 289: goto L289;
+        case 290: goto L290;
+        case 291: goto L291;
+        case 307: goto L307;
+        case 311: goto L311;
+        case 313: goto L313;
+        case 317: goto L317;
+        case 320: goto L320;
+        case 324: goto L324;
+        case 326: goto L326;
+        case 329: goto L329;
+        case 331: goto L331;
+        case 335: goto L335;
+        case 339: goto L339;
+        case 340: goto L340;
+        case 341: goto L341;
+        case 348: goto L348;
+        case 351: goto L351;
+        case 352: goto L352;
+        case 353: goto L353;
+        case 356: goto L356;
+        case 357: goto L357;
+        case 358: goto L358;
+        case 359: goto L359;
+        case 375: goto L375;
+        case 376: goto L376;
+        case 380: goto L380;
+        case 383: goto L383;
+        case 385: goto L385;
+        case 389: goto L389;
+        case 392: goto L392;
+        case 395: goto L395;
+        case 396: goto L396;
+        case 397: goto L397;
+        case 398: goto L398;
+        case 399: goto L399;
+        case 400: goto L400;
+        case 406: goto L406;
+        case 410: goto L410;
+        case 411: goto L411;
+        case 417: goto L417;
+        case 421: goto L421;
+        case 424: goto L424;
+        case 425: goto L425;
+        case 430: goto L430;
+        case 431: goto L431;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 126;
+L9: /* VAR */
+L11: /* VAR */
+L14: /* STRING */
+    tp_aot_op(tp, f, code + 14);
+L23: /* FILE */
+    f->fname = regs[2];
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L28: /* NAME */
+    f->name = regs[2];
+L29: /* LINE */
+    f->line = code + 29;
+    f->lineno = 127;
+L40: /* VAR */
+L42: /* GGET */
+    tp_aot_op(tp, f, code + 42);
+L46: /* STRING */
+    tp_aot_op(tp, f, code + 46);
+L49: /* MGET */
+    tp_aot_op(tp, f, code + 49);
+L51: /* STRING */
+    tp_aot_op(tp, f, code + 51);
+L54: /* STRING */
+    tp_aot_op(tp, f, code + 54);
+L57: /* MOVE */
+    regs[8] = regs[1];
+L58: /* LIST */
+    tp_aot_op(tp, f, code + 58);
+L59: /* CALLP */
+    return code + 59;
+L60: /* LINE */
+    f->line = code + 60;
+    f->lineno = 128;
+L66: /* VAR */
+L69: /* MOVE */
+    regs[4] = regs[1];
+L70: /* LIST */
+    tp_aot_op(tp, f, code + 70);
+L71: /* LINE */
+    f->line = code + 71;
+    f->lineno = 129;
+L77: /* VAR */
+L80: /* NUMBER */
+    tp_aot_op(tp, f, code + 80);
+L83: /* LINE */
+    f->line = code + 83;
+    f->lineno = 130;
+L93: /* GGET */
+    tp_aot_op(tp, f, code + 93);
+L97: /* GGET */
+    tp_aot_op(tp, f, code + 97);
+L100: /* STRING */
+    tp_aot_op(tp, f, code + 100);
+L104: /* MGET */
+    tp_aot_op(tp, f, code + 104);
+L106: /* STRING */
+    tp_aot_op(tp, f, code + 106);
+L109: /* CALLP */
+    return code + 109;
+L110: /* IFN */
+    if (!(TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5]))) {
+        goto L112;
+    }
+L111: /* JUMP */
+    goto L284;
+L112: /* LINE */
+    f->line = code + 112;
+    f->lineno = 131;
+L119: /* NUMBER */
+    tp_aot_op(tp, f, code + 119);
+L122: /* LINE */
+    f->line = code + 122;
+    f->lineno = 132;
+L131: /* GGET */
+    tp_aot_op(tp, f, code + 131);
+L135: /* GGET */
+    tp_aot_op(tp, f, code + 135);
+L138: /* STRING */
+    tp_aot_op(tp, f, code + 138);
+L142: /* MGET */
+    tp_aot_op(tp, f, code + 142);
+L144: /* STRING */
+    tp_aot_op(tp, f, code + 144);
+L147: /* CALLP */
+    return code + 147;
+L148: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L150;
+    }
+L149: /* JUMP */
+    goto L202;
+L150: /* LINE */
+    f->line = code + 150;
+    f->lineno = 133;
+L167: /* STRING */
+    tp_aot_op(tp, f, code + 167);
+L171: /* METHOD */
+    tp_aot_op(tp, f, code + 171);
+L173: /* GGET */
+    tp_aot_op(tp, f, code + 173);
+L177: /* GGET */
+    tp_aot_op(tp, f, code + 177);
+L180: /* STRING */
+    tp_aot_op(tp, f, code + 180);
+L184: /* MGET */
+    tp_aot_op(tp, f, code + 184);
+L186: /* STRING */
+    tp_aot_op(tp, f, code + 186);
+L189: /* MGET */
+    tp_aot_op(tp, f, code + 189);
+L191: /* STRING */
+    tp_aot_op(tp, f, code + 191);
+L195: /* STRING */
+    tp_aot_op(tp, f, code + 195);
+L199: /* CALLP */
+    return code + 199;
+L200: /* CALLM */
+    return code + 200;
+L201: /* JUMP */
+    goto L229;
+L202: /* LINE */
+    f->line = code + 202;
+    f->lineno = 135;
+L213: /* STRING */
+    tp_aot_op(tp, f, code + 213);
+L217: /* METHOD */
+    tp_aot_op(tp, f, code + 217);
+L219: /* GGET */
+    tp_aot_op(tp, f, code + 219);
+L224: /* NUMBER */
+    tp_aot_op(tp, f, code + 224);
+L227: /* CALLP */
+    return code + 227;
+L228: /* CALLM */
+    return code + 228;
+L229: /* LINE */
+    f->line = code + 229;
+    f->lineno = 136;
+L238: /* GGET */
+    tp_aot_op(tp, f, code + 238);
+L242: /* GGET */
+    tp_aot_op(tp, f, code + 242);
+L245: /* STRING */
+    tp_aot_op(tp, f, code + 245);
+L249: /* MGET */
+    tp_aot_op(tp, f, code + 249);
+L251: /* STRING */
+    tp_aot_op(tp, f, code + 251);
+L254: /* CALLP */
+    return code + 254;
+L255: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L257;
+    }
+L256: /* JUMP */
+    tp_aot_safepoint(tp, 163);
+    goto L93;
+L257: /* LINE */
+    f->line = code + 257;
+    f->lineno = 137;
+L265: /* GGET */
+    tp_aot_op(tp, f, code + 265);
+L269: /* STRING */
+    tp_aot_op(tp, f, code + 269);
+L272: /* CALLP */
+    return code + 272;
+L273: /* LINE */
+    f->line = code + 273;
+    f->lineno = 138;
+L280: /* NUMBER */
+    tp_aot_op(tp, f, code + 280);
+L283: /* JUMP */
+    tp_aot_safepoint(tp, 190);
+    goto L93;
+L284: /* LINE */
+    f->line = code + 284;
+    f->lineno = 139;
+L289: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L291;
+    }
+L290: /* JUMP */
+    goto L341;
+L291: /* LINE */
+    f->line = code + 291;
+    f->lineno = 140;
+L307: /* STRING */
+    tp_aot_op(tp, f, code + 307);
+L311: /* METHOD */
+    tp_aot_op(tp, f, code + 311);
+L313: /* GGET */
+    tp_aot_op(tp, f, code + 313);
+L317: /* GGET */
+    tp_aot_op(tp, f, code + 317);
+L320: /* STRING */
+    tp_aot_op(tp, f, code + 320);
+L324: /* MGET */
+    tp_aot_op(tp, f, code + 324);
+L326: /* STRING */
+    tp_aot_op(tp, f, code + 326);
+L329: /* MGET */
+    tp_aot_op(tp, f, code + 329);
+L331: /* STRING */
+    tp_aot_op(tp, f, code + 331);
+L335: /* STRING */
+    tp_aot_op(tp, f, code + 335);
+L339: /* CALLP */
+    return code + 339;
+L340: /* CALLM */
+    return code + 340;
+L341: /* LINE */
+    f->line = code + 341;
+    f->lineno = 141;
+L348: /* GGET */
+    tp_aot_op(tp, f, code + 348);
+L351: /* MOVE */
+    regs[6] = regs[12];
+L352: /* CALLP */
+    return code + 352;
+L353: /* NUMBER */
+    tp_aot_op(tp, f, code + 353);
+L356: /* GT */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[4].nint > regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 356);
+    }
+L357: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L359;
+    }
+L358: /* JUMP */
+    goto L400;
+L359: /* LINE */
+    f->line = code + 359;
+    f->lineno = 142;
+L375: /* MOVE */
+    regs[5] = regs[1];
+L376: /* GGET */
+    tp_aot_op(tp, f, code + 376);
+L380: /* STRING */
+    tp_aot_op(tp, f, code + 380);
+L383: /* MGET */
+    tp_aot_op(tp, f, code + 383);
+L385: /* STRING */
+    tp_aot_op(tp, f, code + 385);
+L389: /* STRING */
+    tp_aot_op(tp, f, code + 389);
+L392: /* NUMBER */
+    tp_aot_op(tp, f, code + 392);
+L395: /* NONE */
+    regs[1] = tp_None;
+L396: /* LIST */
+    tp_aot_op(tp, f, code + 396);
+L397: /* GET */
+    regs[11] = tp_get(tp, regs[12], regs[4]);
+    tp_grey(tp, regs[11]);
+L398: /* CALLP */
+    return code + 398;
+L399: /* LIST */
+    tp_aot_op(tp, f, code + 399);
+L400: /* LINE */
+    f->line = code + 400;
+    f->lineno = 143;
+L406: /* STRING */
+    tp_aot_op(tp, f, code + 406);
+L410: /* SET */
+    tp_set(tp, regs[2], regs[4], regs[12]);
+L411: /* LINE */
+    f->line = code + 411;
+    f->lineno = 144;
+L417: /* GGET */
+    tp_aot_op(tp, f, code + 417);
+L421: /* STRING */
+    tp_aot_op(tp, f, code + 421);
+L424: /* CALLP */
+    return code + 424;
+L425: /* LINE */
+    f->line = code + 425;
+    f->lineno = 145;
+L430: /* RETURN */
+    return code + 430;
+L431: /* EOF */
+    return code + 431;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_3324(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 14: goto L14;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 28: goto L28;
+        case 29: goto L29;
+        case 37: goto L37;
+        case 39: goto L39;
+        case 44: goto L44;
+        case 47: goto L47;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 56: goto L56;
+        case 60: goto L60;
+        case 64: goto L64;
+        case 65: goto L65;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 81: goto L81;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 85: goto L85;
+        case 89: goto L89;
+        case 90: goto L90;
+        case 95: goto L95;
+        case 96: goto L96;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 146;
+L9: /* VAR */
+L11: /* VAR */
+L14: /* STRING */
+    tp_aot_op(tp, f, code + 14);
+L23: /* FILE */
+    f->fname = regs[2];
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L28: /* NAME */
+    f->name = regs[2];
+L29: /* LINE */
+    f->line = code + 29;
+    f->lineno = 147;
+L37: /* VAR */
+L39: /* GGET */
+    tp_aot_op(tp, f, code + 39);
+L44: /* STRING */
+    tp_aot_op(tp, f, code + 44);
+L47: /* MGET */
+    tp_aot_op(tp, f, code + 47);
+L49: /* CALLP */
+    return code + 49;
+L50: /* LINE */
+    f->line = code + 50;
+    f->lineno = 148;
+L56: /* STRING */
+    tp_aot_op(tp, f, code + 56);
+L60: /* STRING */
+    tp_aot_op(tp, f, code + 60);
+L64: /* SET */
+    tp_set(tp, regs[2], regs[3], regs[4]);
+L65: /* LINE */
+    f->line = code + 65;
+    f->lineno = 149;
+L75: /* MOVE */
+    regs[3] = regs[1];
+L76: /* STRING */
+    tp_aot_op(tp, f, code + 76);
+L81: /* METHOD */
+    tp_aot_op(tp, f, code + 81);
+L83: /* CALLM */
+    return code + 83;
+L84: /* LIST */
+    tp_aot_op(tp, f, code + 84);
+L85: /* STRING */
+    tp_aot_op(tp, f, code + 85);
+L89: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[4]);
+L90: /* LINE */
+    f->line = code + 90;
+    f->lineno = 150;
+L95: /* RETURN */
+    return code + 95;
+L96: /* EOF */
+    return code + 96;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_3442(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 29: goto L29;
+        case 30: goto L30;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 152;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 153;
+L29: /* RETURN */
+    return code + 29;
+L30: /* EOF */
+    return code + 30;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_3495(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 32: goto L32;
+        case 36: goto L36;
+        case 39: goto L39;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 50: goto L50;
+        case 52: goto L52;
+        case 57: goto L57;
+        case 60: goto L60;
+        case 61: goto L61;
+        case 66: goto L66;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 77: goto L77;
+        case 81: goto L81;
+        case 84: goto L84;
+        case 85: goto L85;
+        case 90: goto L90;
+        case 91: goto L91;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 154;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[0];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[0];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 155;
+L32: /* GGET */
+    tp_aot_op(tp, f, code + 32);
+L36: /* STRING */
+    tp_aot_op(tp, f, code + 36);
+L39: /* NUMBER */
+    tp_aot_op(tp, f, code + 39);
+L42: /* CALLP */
+    return code + 42;
+L43: /* LINE */
+    f->line = code + 43;
+    f->lineno = 156;
+L50: /* VAR */
+L52: /* GGET */
+    tp_aot_op(tp, f, code + 52);
+L57: /* NUMBER */
+    tp_aot_op(tp, f, code + 57);
+L60: /* CALLP */
+    return code + 60;
+L61: /* LINE */
+    f->line = code + 61;
+    f->lineno = 157;
+L66: /* GGET */
+    tp_aot_op(tp, f, code + 66);
+L70: /* CALLP */
+    return code + 70;
+L71: /* LINE */
+    f->line = code + 71;
+    f->lineno = 158;
+L77: /* GGET */
+    tp_aot_op(tp, f, code + 77);
+L81: /* STRING */
+    tp_aot_op(tp, f, code + 81);
+L84: /* CALLP */
+    return code + 84;
+L85: /* LINE */
+    f->line = code + 85;
+    f->lineno = 159;
+L90: /* RETURN */
+    return code + 90;
+L91: /* EOF */
+    return code + 91;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_3610(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 32: goto L32;
+        case 36: goto L36;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 47: goto L47;
+        case 50: goto L50;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 60: goto L60;
+        case 61: goto L61;
+        case 65: goto L65;
+        case 66: goto L66;
+        case 72: goto L72;
+        case 75: goto L75;
+        case 78: goto L78;
+        case 82: goto L82;
+        case 84: goto L84;
+        case 90: goto L90;
+        case 94: goto L94;
+        case 97: goto L97;
+        case 100: goto L100;
+        case 101: goto L101;
+        case 112: goto L112;
+        case 116: goto L116;
+        case 119: goto L119;
+        case 123: goto L123;
+        case 125: goto L125;
+        case 128: goto L128;
+        case 131: goto L131;
+        case 132: goto L132;
+        case 133: goto L133;
+        case 134: goto L134;
+        case 142: goto L142;
+        case 144: goto L144;
+        case 149: goto L149;
+        case 152: goto L152;
+        case 153: goto L153;
+        case 161: goto L161;
+        case 165: goto L165;
+        case 167: goto L167;
+        case 171: goto L171;
+        case 173: goto L173;
+        case 174: goto L174;
+        case 175: goto L175;
+        case 187: goto L187;
+        case 190: goto L190;
+        case 194: goto L194;
+        case 196: goto L196;
+        case 199: goto L199;
+        case 201: goto L201;
+        case 204: goto L204;
+        case 205: goto L205;
+        case 206: goto L206;
+        case 207: goto L207;
+        case 211: goto L211;
+        case 214: goto L214;
+        case 215: goto L215;
+        case 216: goto L216;
+        case 225: goto L225;
+        case 229: goto L229;
+        case 232: goto L232;
+        case 236: goto L236;
+        case 238: goto L238;
+        case 241: goto L241;
+        case 242: goto L242;
+        case 243: goto L243;
+        case 244: goto L244;
+        case 250: goto L250;
+        case 254: goto L254;
+        case 255: goto L255;
+        case 262: goto L262;
+        case 266: goto L266;
+        case 270: goto L270;
+        case 271: goto L271;
+        case 278: goto L278;
+        case 282: goto L282;
+        case 285: goto L285;
+        case 286: goto L286;
+        case 293: goto L293;
+        case 297: goto L297;
+        case 300: goto L300;
+        case 303: goto L303;
+        case 304: goto L304;
+        case 311: goto L311;
+        case 315: goto L315;
+        case 318: goto L318;
+        case 321: goto L321;
+        case 322: goto L322;
+        case 333: goto L333;
+        case 337: goto L337;
+        case 339: goto L339;
+        case 343: goto L343;
+        case 345: goto L345;
+        case 350: goto L350;
+        case 353: goto L353;
+        case 354: goto L354;
+        case 355: goto L355;
+        case 362: goto L362;
+        case 366: goto L366;
+        case 369: goto L369;
+        case 370: goto L370;
+        case 381: goto L381;
+        case 385: goto L385;
+        case 387: goto L387;
+        case 391: goto L391;
+        case 393: goto L393;
+        case 398: goto L398;
+        case 401: goto L401;
+        case 402: goto L402;
+        case 403: goto L403;
+        case 409: goto L409;
+        case 413: goto L413;
+        case 414: goto L414;
+        case 419: goto L419;
+        case 423: goto L423;
+        case 424: goto L424;
+        case 430: goto L430;
+        case 434: goto L434;
+        case 437: goto L437;
+        case 438: goto L438;
+        case 443: goto L443;
+        case 444: goto L444;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 160;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 161;
+L32: /* STRING */
+    tp_aot_op(tp, f, code + 32);
+L36: /* STRING */
+    tp_aot_op(tp, f, code + 36);
+L40: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[1]);
+L41: /* LINE */
+    f->line = code + 41;
+    f->lineno = 162;
+L47: /* STRING */
+    tp_aot_op(tp, f, code + 47);
+L50: /* STRING */
+    tp_aot_op(tp, f, code + 50);
+L53: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[1]);
+L54: /* LINE */
+    f->line = code + 54;
+    f->lineno = 163;
+L60: /* LIST */
+    tp_aot_op(tp, f, code + 60);
+L61: /* STRING */
+    tp_aot_op(tp, f, code + 61);
+L65: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[1]);
+L66: /* LINE */
+    f->line = code + 66;
+    f->lineno = 164;
+L72: /* VAR */
+L75: /* GGET */
+    tp_aot_op(tp, f, code + 75);
+L78: /* STRING */
+    tp_aot_op(tp, f, code + 78);
+L82: /* MGET */
+    tp_aot_op(tp, f, code + 82);
+L84: /* LINE */
+    f->line = code + 84;
+    f->lineno = 165;
+L90: /* GGET */
+    tp_aot_op(tp, f, code + 90);
+L94: /* STRING */
+    tp_aot_op(tp, f, code + 94);
+L97: /* NUMBER */
+    tp_aot_op(tp, f, code + 97);
+L100: /* CALLP */
+    return code + 100;
+L101: /* LINE */
+    f->line = code + 101;
+    f->lineno = 166;
+L112: /* GGET */
+    tp_aot_op(tp, f, code + 112);
+L116: /* GGET */
+    tp_aot_op(tp, f, code + 116);
+L119: /* STRING */
+    tp_aot_op(tp, f, code + 119);
+L123: /* MGET */
+    tp_aot_op(tp, f, code + 123);
+L125: /* STRING */
+    tp_aot_op(tp, f, code + 125);
+L128: /* STRING */
+    tp_aot_op(tp, f, code + 128);
+L131: /* CALLP */
+    return code + 131;
+L132: /* IFN */
+    if (!(TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3]))) {
+        goto L134;
+    }
+L133: /* JUMP */
+    goto L216;
+L134: /* LINE */
+    f->line = code + 134;
+    f->lineno = 167;
+L142: /* VAR */
+L144: /* GGET */
+    tp_aot_op(tp, f, code + 144);
+L149: /* NUMBER */
+    tp_aot_op(tp, f, code + 149);
+L152: /* CALLP */
+    return code + 152;
+L153: /* LINE */
+    f->line = code + 153;
+    f->lineno = 168;
+L161: /* STRING */
+    tp_aot_op(tp, f, code + 161);
+L165: /* MGET */
+    tp_aot_op(tp, f, code + 165);
+L167: /* STRING */
+    tp_aot_op(tp, f, code + 167);
+L171: /* METHOD */
+    tp_aot_op(tp, f, code + 171);
+L173: /* MOVE */
+    regs[6] = regs[2];
+L174: /* CALLM */
+    return code + 174;
+L175: /* LINE */
+    f->line = code + 175;
+    f->lineno = 169;
+L187: /* GGET */
+    tp_aot_op(tp, f, code + 187);
+L190: /* STRING */
+    tp_aot_op(tp, f, code + 190);
+L194: /* MGET */
+    tp_aot_op(tp, f, code + 194);
+L196: /* STRING */
+    tp_aot_op(tp, f, code + 196);
+L199: /* MGET */
+    tp_aot_op(tp, f, code + 199);
+L201: /* STRING */
+    tp_aot_op(tp, f, code + 201);
+L204: /* EQ */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[3] = tp_bool(regs[3].nint == regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 204);
+    }
+L205: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L207;
+    }
+L206: /* JUMP */
+    tp_aot_safepoint(tp, 94);
+    goto L112;
+L207: /* GGET */
+    tp_aot_op(tp, f, code + 207);
+L211: /* STRING */
+    tp_aot_op(tp, f, code + 211);
+L214: /* CALLP */
+    return code + 214;
+L215: /* JUMP */
+    tp_aot_safepoint(tp, 103);
+    goto L112;
+L216: /* LINE */
+    f->line = code + 216;
+    f->lineno = 170;
+L225: /* GGET */
+    tp_aot_op(tp, f, code + 225);
+L229: /* GGET */
+    tp_aot_op(tp, f, code + 229);
+L232: /* STRING */
+    tp_aot_op(tp, f, code + 232);
+L236: /* MGET */
+    tp_aot_op(tp, f, code + 236);
+L238: /* STRING */
+    tp_aot_op(tp, f, code + 238);
+L241: /* CALLP */
+    return code + 241;
+L242: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L244;
+    }
+L243: /* JUMP */
+    goto L414;
+L244: /* LINE */
+    f->line = code + 244;
+    f->lineno = 171;
+L250: /* GGET */
+    tp_aot_op(tp, f, code + 250);
+L254: /* CALLP */
+    return code + 254;
+L255: /* LINE */
+    f->line = code + 255;
+    f->lineno = 172;
+L262: /* STRING */
+    tp_aot_op(tp, f, code + 262);
+L266: /* STRING */
+    tp_aot_op(tp, f, code + 266);
+L270: /* SET */
+    tp_set(tp, regs[0], regs[4], regs[3]);
+L271: /* LINE */
+    f->line = code + 271;
+    f->lineno = 173;
+L278: /* GGET */
+    tp_aot_op(tp, f, code + 278);
+L282: /* STRING */
+    tp_aot_op(tp, f, code + 282);
+L285: /* CALLP */
+    return code + 285;
+L286: /* LINE */
+    f->line = code + 286;
+    f->lineno = 174;
+L293: /* GGET */
+    tp_aot_op(tp, f, code + 293);
+L297: /* STRING */
+    tp_aot_op(tp, f, code + 297);
+L300: /* NUMBER */
+    tp_aot_op(tp, f, code + 300);
+L303: /* CALLP */
+    return code + 303;
+L304: /* LINE */
+    f->line = code + 304;
+    f->lineno = 175;
+L311: /* GGET */
+    tp_aot_op(tp, f, code + 311);
+L315: /* STRING */
+    tp_aot_op(tp, f, code + 315);
+L318: /* NUMBER */
+    tp_aot_op(tp, f, code + 318);
+L321: /* CALLP */
+    return code + 321;
+L322: /* LINE */
+    f->line = code + 322;
+    f->lineno = 176;
+L333: /* STRING */
+    tp_aot_op(tp, f, code + 333);
+L337: /* MGET */
+    tp_aot_op(tp, f, code + 337);
+L339: /* STRING */
+    tp_aot_op(tp, f, code + 339);
+L343: /* METHOD */
+    tp_aot_op(tp, f, code + 343);
+L345: /* GGET */
+    tp_aot_op(tp, f, code + 345);
+L350: /* NUMBER */
+    tp_aot_op(tp, f, code + 350);
+L353: /* CALLP */
+    return code + 353;
+L354: /* CALLM */
+    return code + 354;
+L355: /* LINE */
+    f->line = code + 355;
+    f->lineno = 177;
+L362: /* GGET */
+    tp_aot_op(tp, f, code + 362);
+L366: /* STRING */
+    tp_aot_op(tp, f, code + 366);
+L369: /* CALLP */
+    return code + 369;
+L370: /* LINE */
+    f->line = code + 370;
+    f->lineno = 178;
+L381: /* STRING */
+    tp_aot_op(tp, f, code + 381);
+L385: /* MGET */
+    tp_aot_op(tp, f, code + 385);
+L387: /* STRING */
+    tp_aot_op(tp, f, code + 387);
+L391: /* METHOD */
+    tp_aot_op(tp, f, code + 391);
+L393: /* GGET */
+    tp_aot_op(tp, f, code + 393);
+L398: /* NUMBER */
+    tp_aot_op(tp, f, code + 398);
+L401: /* CALLP */
+    return code + 401;
+L402: /* CALLM */
+    return code + 402;
+L403: /* LINE */
+    f->line = code + 403;
+    f->lineno = 179;
+L409: /* GGET */
+    tp_aot_op(tp, f, code + 409);
+L413: /* CALLP */
+    return code + 413;
+L414: /* LINE */
+    f->line = code + 414;
+    f->lineno = 180;
+L419: /* GGET */
+    tp_aot_op(tp, f, code + 419);
+L423: /* CALLP */
+    return code + 423;
+L424: /* LINE */
+    f->line = code + 424;
+    f->lineno = 181;
+L430: /* GGET */
+    tp_aot_op(tp, f, code + 430);
+L434: /* STRING */
+    tp_aot_op(tp, f, code + 434);
+L437: /* CALLP */
+    return code + 437;
+L438: /* LINE */
+    f->line = code + 438;
+    f->lineno = 182;
+L443: /* RETURN */
+    return code + 443;
+L444: /* EOF */
+    return code + 444;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_4078(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 32: goto L32;
+        case 36: goto L36;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 47: goto L47;
+        case 50: goto L50;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 60: goto L60;
+        case 61: goto L61;
+        case 65: goto L65;
+        case 66: goto L66;
+        case 72: goto L72;
+        case 76: goto L76;
+        case 79: goto L79;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 93: goto L93;
+        case 97: goto L97;
+        case 100: goto L100;
+        case 104: goto L104;
+        case 106: goto L106;
+        case 109: goto L109;
+        case 110: goto L110;
+        case 111: goto L111;
+        case 112: goto L112;
+        case 123: goto L123;
+        case 127: goto L127;
+        case 129: goto L129;
+        case 133: goto L133;
+        case 135: goto L135;
+        case 140: goto L140;
+        case 143: goto L143;
+        case 144: goto L144;
+        case 145: goto L145;
+        case 158: goto L158;
+        case 162: goto L162;
+        case 165: goto L165;
+        case 169: goto L169;
+        case 171: goto L171;
+        case 174: goto L174;
+        case 177: goto L177;
+        case 178: goto L178;
+        case 179: goto L179;
+        case 180: goto L180;
+        case 184: goto L184;
+        case 185: goto L185;
+        case 186: goto L186;
+        case 191: goto L191;
+        case 195: goto L195;
+        case 196: goto L196;
+        case 202: goto L202;
+        case 206: goto L206;
+        case 209: goto L209;
+        case 210: goto L210;
+        case 215: goto L215;
+        case 216: goto L216;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 183;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 184;
+L32: /* STRING */
+    tp_aot_op(tp, f, code + 32);
+L36: /* STRING */
+    tp_aot_op(tp, f, code + 36);
+L40: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[1]);
+L41: /* LINE */
+    f->line = code + 41;
+    f->lineno = 185;
+L47: /* STRING */
+    tp_aot_op(tp, f, code + 47);
+L50: /* STRING */
+    tp_aot_op(tp, f, code + 50);
+L53: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[1]);
+L54: /* LINE */
+    f->line = code + 54;
+    f->lineno = 186;
+L60: /* LIST */
+    tp_aot_op(tp, f, code + 60);
+L61: /* STRING */
+    tp_aot_op(tp, f, code + 61);
+L65: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[1]);
+L66: /* LINE */
+    f->line = code + 66;
+    f->lineno = 187;
+L72: /* GGET */
+    tp_aot_op(tp, f, code + 72);
+L76: /* STRING */
+    tp_aot_op(tp, f, code + 76);
+L79: /* NUMBER */
+    tp_aot_op(tp, f, code + 79);
+L82: /* CALLP */
+    return code + 82;
+L83: /* LINE */
+    f->line = code + 83;
+    f->lineno = 188;
+L93: /* GGET */
+    tp_aot_op(tp, f, code + 93);
+L97: /* GGET */
+    tp_aot_op(tp, f, code + 97);
+L100: /* STRING */
+    tp_aot_op(tp, f, code + 100);
+L104: /* MGET */
+    tp_aot_op(tp, f, code + 104);
+L106: /* STRING */
+    tp_aot_op(tp, f, code + 106);
+L109: /* CALLP */
+    return code + 109;
+L110: /* IFN */
+    if (!(TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2]))) {
+        goto L112;
+    }
+L111: /* JUMP */
+    goto L186;
+L112: /* LINE */
+    f->line = code + 112;
+    f->lineno = 189;
+L123: /* STRING */
+    tp_aot_op(tp, f, code + 123);
+L127: /* MGET */
+    tp_aot_op(tp, f, code + 127);
+L129: /* STRING */
+    tp_aot_op(tp, f, code + 129);
+L133: /* METHOD */
+    tp_aot_op(tp, f, code + 133);
+L135: /* GGET */
+    tp_aot_op(tp, f, code + 135);
+L140: /* NUMBER */
+    tp_aot_op(tp, f, code + 140);
+L143: /* CALLP */
+    return code + 143;
+L144: /* CALLM */
+    return code + 144;
+L145: /* LINE */
+    f->line = code + 145;
+    f->lineno = 190;
+L158: /* GGET */
+    tp_aot_op(tp, f, code + 158);
+L162: /* GGET */
+    tp_aot_op(tp, f, code + 162);
+L165: /* STRING */
+    tp_aot_op(tp, f, code + 165);
+L169: /* MGET */
+    tp_aot_op(tp, f, code + 169);
+L171: /* STRING */
+    tp_aot_op(tp, f, code + 171);
+L174: /* STRING */
+    tp_aot_op(tp, f, code + 174);
+L177: /* CALLP */
+    return code + 177;
+L178: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L180;
+    }
+L179: /* JUMP */
+    tp_aot_safepoint(tp, 86);
+    goto L93;
+L180: /* GGET */
+    tp_aot_op(tp, f, code + 180);
+L184: /* CALLP */
+    return code + 184;
+L185: /* JUMP */
+    tp_aot_safepoint(tp, 92);
+    goto L93;
+L186: /* LINE */
+    f->line = code + 186;
+    f->lineno = 191;
+L191: /* GGET */
+    tp_aot_op(tp, f, code + 191);
+L195: /* CALLP */
+    return code + 195;
+L196: /* LINE */
+    f->line = code + 196;
+    f->lineno = 192;
+L202: /* GGET */
+    tp_aot_op(tp, f, code + 202);
+L206: /* STRING */
+    tp_aot_op(tp, f, code + 206);
+L209: /* CALLP */
+    return code + 209;
+L210: /* LINE */
+    f->line = code + 210;
+    f->lineno = 193;
+L215: /* RETURN */
+    return code + 215;
+L216: /* EOF */
+    return code + 216;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_4320(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 33: goto L33;
+        case 36: goto L36;
+        case 40: goto L40;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 45: goto L45;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 195;
+L9: /* VAR */
+L11: /* STRING */
+    tp_aot_op(tp, f, code + 11);
+L20: /* FILE */
+    f->fname = regs[1];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 196;
+L33: /* GGET */
+    tp_aot_op(tp, f, code + 33);
+L36: /* STRING */
+    tp_aot_op(tp, f, code + 36);
+L40: /* METHOD */
+    tp_aot_op(tp, f, code + 40);
+L42: /* MOVE */
+    regs[5] = regs[0];
+L43: /* CALLM */
+    return code + 43;
+L44: /* RETURN */
+    return code + 44;
+L45: /* EOF */
+    return code + 45;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_4389(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 11: goto L11;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 39: goto L39;
+        case 43: goto L43;
+        case 46: goto L46;
+        case 50: goto L50;
+        case 52: goto L52;
+        case 55: goto L55;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 61: goto L61;
+        case 65: goto L65;
+        case 66: goto L66;
+        case 67: goto L67;
+        case 72: goto L72;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 87: goto L87;
+        case 91: goto L91;
+        case 93: goto L93;
+        case 98: goto L98;
+        case 101: goto L101;
+        case 102: goto L102;
+        case 103: goto L103;
+        case 110: goto L110;
+        case 113: goto L113;
+        case 118: goto L118;
+        case 120: goto L120;
+        case 121: goto L121;
+        case 135: goto L135;
+        case 139: goto L139;
+        case 142: goto L142;
+        case 146: goto L146;
+        case 148: goto L148;
+        case 151: goto L151;
+        case 154: goto L154;
+        case 155: goto L155;
+        case 156: goto L156;
+        case 157: goto L157;
+        case 161: goto L161;
+        case 162: goto L162;
+        case 163: goto L163;
+        case 176: goto L176;
+        case 180: goto L180;
+        case 183: goto L183;
+        case 187: goto L187;
+        case 189: goto L189;
+        case 193: goto L193;
+        case 196: goto L196;
+        case 197: goto L197;
+        case 198: goto L198;
+        case 199: goto L199;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 198;
+L8: /* VAR */
+L11: /* STRING */
+    tp_aot_op(tp, f, code + 11);
+L20: /* FILE */
+    f->fname = regs[1];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 199;
+L39: /* GGET */
+    tp_aot_op(tp, f, code + 39);
+L43: /* GGET */
+    tp_aot_op(tp, f, code + 43);
+L46: /* STRING */
+    tp_aot_op(tp, f, code + 46);
+L50: /* MGET */
+    tp_aot_op(tp, f, code + 50);
+L52: /* STRING */
+    tp_aot_op(tp, f, code + 52);
+L55: /* STRING */
+    tp_aot_op(tp, f, code + 55);
+L58: /* CALLP */
+    return code + 58;
+L59: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L61;
+    }
+L60: /* JUMP */
+    goto L67;
+L61: /* GGET */
+    tp_aot_op(tp, f, code + 61);
+L65: /* CALLP */
+    return code + 65;
+L66: /* JUMP */
+    tp_aot_safepoint(tp, 27);
+    goto L39;
+L67: /* LINE */
+    f->line = code + 67;
+    f->lineno = 200;
+L72: /* NUMBER */
+    tp_aot_op(tp, f, code + 72);
+L75: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L77;
+    }
+L76: /* JUMP */
+    goto L199;
+L77: /* LINE */
+    f->line = code + 77;
+    f->lineno = 201;
+L87: /* STRING */
+    tp_aot_op(tp, f, code + 87);
+L91: /* METHOD */
+    tp_aot_op(tp, f, code + 91);
+L93: /* GGET */
+    tp_aot_op(tp, f, code + 93);
+L98: /* NUMBER */
+    tp_aot_op(tp, f, code + 98);
+L101: /* CALLP */
+    return code + 101;
+L102: /* CALLM */
+    return code + 102;
+L103: /* LINE */
+    f->line = code + 103;
+    f->lineno = 202;
+L110: /* GGET */
+    tp_aot_op(tp, f, code + 110);
+L113: /* STRING */
+    tp_aot_op(tp, f, code + 113);
+L118: /* METHOD */
+    tp_aot_op(tp, f, code + 118);
+L120: /* CALLM */
+    return code + 120;
+L121: /* LINE */
+    f->line = code + 121;
+    f->lineno = 203;
+L135: /* GGET */
+    tp_aot_op(tp, f, code + 135);
+L139: /* GGET */
+    tp_aot_op(tp, f, code + 139);
+L142: /* STRING */
+    tp_aot_op(tp, f, code + 142);
+L146: /* MGET */
+    tp_aot_op(tp, f, code + 146);
+L148: /* STRING */
+    tp_aot_op(tp, f, code + 148);
+L151: /* STRING */
+    tp_aot_op(tp, f, code + 151);
+L154: /* CALLP */
+    return code + 154;
+L155: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L157;
+    }
+L156: /* JUMP */
+    goto L163;
+L157: /* GGET */
+    tp_aot_op(tp, f, code + 157);
+L161: /* CALLP */
+    return code + 161;
+L162: /* JUMP */
+    tp_aot_safepoint(tp, 27);
+    goto L135;
+L163: /* LINE */
+    f->line = code + 163;
+    f->lineno = 204;
+L176: /* GGET */
+    tp_aot_op(tp, f, code + 176);
+L180: /* GGET */
+    tp_aot_op(tp, f, code + 180);
+L183: /* STRING */
+    tp_aot_op(tp, f, code + 183);
+L187: /* MGET */
+    tp_aot_op(tp, f, code + 187);
+L189: /* STRING */
+    tp_aot_op(tp, f, code + 189);
+L193: /* STRING */
+    tp_aot_op(tp, f, code + 193);
+L196: /* CALLP */
+    return code + 196;
+L197: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L199;
+    }
+L198: /* JUMP */
+    tp_aot_safepoint(tp, 126);
+    goto L72;
+L199: /* EOF */
+    return code + 199;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_4607(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 11: goto L11;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 31: goto L31;
+        case 34: goto L34;
+        case 35: goto L35;
+        case 41: goto L41;
+        case 43: goto L43;
+        case 46: goto L46;
+        case 50: goto L50;
+        case 52: goto L52;
+        case 60: goto L60;
+        case 64: goto L64;
+        case 67: goto L67;
+        case 71: goto L71;
+        case 73: goto L73;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 78: goto L78;
+        case 79: goto L79;
+        case 92: goto L92;
+        case 96: goto L96;
+        case 99: goto L99;
+        case 103: goto L103;
+        case 105: goto L105;
+        case 108: goto L108;
+        case 109: goto L109;
+        case 110: goto L110;
+        case 111: goto L111;
+        case 115: goto L115;
+        case 116: goto L116;
+        case 117: goto L117;
+        case 125: goto L125;
+        case 129: goto L129;
+        case 133: goto L133;
+        case 134: goto L134;
+        case 141: goto L141;
+        case 145: goto L145;
+        case 146: goto L146;
+        case 147: goto L147;
+        case 155: goto L155;
+        case 159: goto L159;
+        case 163: goto L163;
+        case 164: goto L164;
+        case 165: goto L165;
+        case 169: goto L169;
+        case 179: goto L179;
+        case 183: goto L183;
+        case 185: goto L185;
+        case 190: goto L190;
+        case 193: goto L193;
+        case 194: goto L194;
+        case 195: goto L195;
+        case 205: goto L205;
+        case 209: goto L209;
+        case 212: goto L212;
+        case 216: goto L216;
+        case 218: goto L218;
+        case 221: goto L221;
+        case 222: goto L222;
+        case 223: goto L223;
+        case 224: goto L224;
+        case 232: goto L232;
+        case 236: goto L236;
+        case 239: goto L239;
+        case 240: goto L240;
+        case 251: goto L251;
+        case 255: goto L255;
+        case 257: goto L257;
+        case 262: goto L262;
+        case 265: goto L265;
+        case 266: goto L266;
+        case 267: goto L267;
+        case 268: goto L268;
+        case 275: goto L275;
+        case 278: goto L278;
+        case 283: goto L283;
+        case 285: goto L285;
+        case 286: goto L286;
+        case 298: goto L298;
+        case 302: goto L302;
+        case 305: goto L305;
+        case 309: goto L309;
+        case 311: goto L311;
+        case 314: goto L314;
+        case 315: goto L315;
+        case 316: goto L316;
+        case 317: goto L317;
+        case 321: goto L321;
+        case 322: goto L322;
+        case 323: goto L323;
+        case 330: goto L330;
+        case 333: goto L333;
+        case 334: goto L334;
+        case 335: goto L335;
+        case 338: goto L338;
+        case 339: goto L339;
+        case 340: goto L340;
+        case 341: goto L341;
+        case 356: goto L356;
+        case 360: goto L360;
+        case 363: goto L363;
+        case 365: goto L365;
+        case 370: goto L370;
+        case 373: goto L373;
+        case 374: goto L374;
+        case 375: goto L375;
+        case 376: goto L376;
+        case 383: goto L383;
+        case 386: goto L386;
+        case 388: goto L388;
+        case 389: goto L389;
+        case 390: goto L390;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 206;
+L7: /* VAR */
+L11: /* STRING */
+    tp_aot_op(tp, f, code + 11);
+L20: /* FILE */
+    f->fname = regs[0];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L25: /* NAME */
+    f->name = regs[0];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 207;
+L31: /* VAR */
+L34: /* LIST */
+    tp_aot_op(tp, f, code + 34);
+L35: /* LINE */
+    f->line = code + 35;
+    f->lineno = 208;
+L41: /* VAR */
+L43: /* GGET */
+    tp_aot_op(tp, f, code + 43);
+L46: /* STRING */
+    tp_aot_op(tp, f, code + 46);
+L50: /* MGET */
+    tp_aot_op(tp, f, code + 50);
+L52: /* LINE */
+    f->line = code + 52;
+    f->lineno = 210;
+L60: /* GGET */
+    tp_aot_op(tp, f, code + 60);
+L64: /* GGET */
+    tp_aot_op(tp, f, code + 64);
+L67: /* STRING */
+    tp_aot_op(tp, f, code + 67);
+L71: /* MGET */
+    tp_aot_op(tp, f, code + 71);
+L73: /* STRING */
+    tp_aot_op(tp, f, code + 73);
+L76: /* CALLP */
+    return code + 76;
+L77: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L79;
+    }
+L78: /* JUMP */
+    goto L165;
+L79: /* LINE */
+    f->line = code + 79;
+    f->lineno = 211;
+L92: /* GGET */
+    tp_aot_op(tp, f, code + 92);
+L96: /* GGET */
+    tp_aot_op(tp, f, code + 96);
+L99: /* STRING */
+    tp_aot_op(tp, f, code + 99);
+L103: /* MGET */
+    tp_aot_op(tp, f, code + 103);
+L105: /* STRING */
+    tp_aot_op(tp, f, code + 105);
+L108: /* CALLP */
+    return code + 108;
+L109: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L111;
+    }
+L110: /* JUMP */
+    goto L117;
+L111: /* GGET */
+    tp_aot_op(tp, f, code + 111);
+L115: /* CALLP */
+    return code + 115;
+L116: /* JUMP */
+    tp_aot_safepoint(tp, 24);
+    goto L92;
+L117: /* LINE */
+    f->line = code + 117;
+    f->lineno = 212;
+L125: /* GGET */
+    tp_aot_op(tp, f, code + 125);
+L129: /* STRING */
+    tp_aot_op(tp, f, code + 129);
+L133: /* CALLP */
+    return code + 133;
+L134: /* LINE */
+    f->line = code + 134;
+    f->lineno = 213;
+L141: /* GGET */
+    tp_aot_op(tp, f, code + 141);
+L145: /* MOVE */
+    regs[3] = regs[0];
+L146: /* CALLP */
+    return code + 146;
+L147: /* LINE */
+    f->line = code + 147;
+    f->lineno = 214;
+L155: /* GGET */
+    tp_aot_op(tp, f, code + 155);
+L159: /* STRING */
+    tp_aot_op(tp, f, code + 159);
+L163: /* CALLP */
+    return code + 163;
+L164: /* JUMP */
+    goto L286;
+L165: /* LINE */
+    f->line = code + 165;
+    f->lineno = 215;
+L169: /* LINE */
+    f->line = code + 169;
+    f->lineno = 216;
+L179: /* STRING */
+    tp_aot_op(tp, f, code + 179);
+L183: /* METHOD */
+    tp_aot_op(tp, f, code + 183);
+L185: /* GGET */
+    tp_aot_op(tp, f, code + 185);
+L190: /* NUMBER */
+    tp_aot_op(tp, f, code + 190);
+L193: /* CALLP */
+    return code + 193;
+L194: /* CALLM */
+    return code + 194;
+L195: /* LINE */
+    f->line = code + 195;
+    f->lineno = 217;
+L205: /* GGET */
+    tp_aot_op(tp, f, code + 205);
+L209: /* GGET */
+    tp_aot_op(tp, f, code + 209);
+L212: /* STRING */
+    tp_aot_op(tp, f, code + 212);
+L216: /* MGET */
+    tp_aot_op(tp, f, code + 216);
+L218: /* STRING */
+    tp_aot_op(tp, f, code + 218);
+L221: /* CALLP */
+    return code + 221;
+L222: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L224;
+    }
+L223: /* JUMP */
+    goto L268;
+L224: /* LINE */
+    f->line = code + 224;
+    f->lineno = 218;
+L232: /* GGET */
+    tp_aot_op(tp, f, code + 232);
+L236: /* STRING */
+    tp_aot_op(tp, f, code + 236);
+L239: /* CALLP */
+    return code + 239;
+L240: /* LINE */
+    f->line = code + 240;
+    f->lineno = 219;
+L251: /* STRING */
+    tp_aot_op(tp, f, code + 251);
+L255: /* METHOD */
+    tp_aot_op(tp, f, code + 255);
+L257: /* GGET */
+    tp_aot_op(tp, f, code + 257);
+L262: /* NUMBER */
+    tp_aot_op(tp, f, code + 262);
+L265: /* CALLP */
+    return code + 265;
+L266: /* CALLM */
+    return code + 266;
+L267: /* JUMP */
+    tp_aot_safepoint(tp, 62);
+    goto L205;
+L268: /* LINE */
+    f->line = code + 268;
+    f->lineno = 220;
+L275: /* GGET */
+    tp_aot_op(tp, f, code + 275);
+L278: /* STRING */
+    tp_aot_op(tp, f, code + 278);
+L283: /* METHOD */
+    tp_aot_op(tp, f, code + 283);
+L285: /* CALLM */
+    return code + 285;
+L286: /* LINE */
+    f->line = code + 286;
+    f->lineno = 221;
+L298: /* GGET */
+    tp_aot_op(tp, f, code + 298);
+L302: /* GGET */
+    tp_aot_op(tp, f, code + 302);
+L305: /* STRING */
+    tp_aot_op(tp, f, code + 305);
+L309: /* MGET */
+    tp_aot_op(tp, f, code + 309);
+L311: /* STRING */
+    tp_aot_op(tp, f, code + 311);
+L314: /* CALLP */
+    return code + 314;
+L315: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L317;
+    }
+L316: /* JUMP */
+    goto L323;
+L317: /* GGET */
+    tp_aot_op(tp, f, code + 317);
+L321: /* CALLP */
+    return code + 321;
+L322: /* JUMP */
+    tp_aot_safepoint(tp, 24);
+    goto L298;
+L323: /* LINE */
+    f->line = code + 323;
+    f->lineno = 226;
+L330: /* GGET */
+    tp_aot_op(tp, f, code + 330);
+L333: /* MOVE */
+    regs[3] = regs[0];
+L334: /* CALLP */
+    return code + 334;
+L335: /* NUMBER */
+    tp_aot_op(tp, f, code + 335);
+L338: /* GT */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[1].nint > regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 338);
+    }
+L339: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L341;
+    }
+L340: /* JUMP */
+    goto L376;
+L341: /* LINE */
+    f->line = code + 341;
+    f->lineno = 227;
+L356: /* GGET */
+    tp_aot_op(tp, f, code + 356);
+L360: /* STRING */
+    tp_aot_op(tp, f, code + 360);
+L363: /* MGET */
+    tp_aot_op(tp, f, code + 363);
+L365: /* STRING */
+    tp_aot_op(tp, f, code + 365);
+L370: /* STRING */
+    tp_aot_op(tp, f, code + 370);
+L373: /* MOVE */
+    regs[6] = regs[0];
+L374: /* CALLP */
+    return code + 374;
+L375: /* RETURN */
+    return code + 375;
+L376: /* LINE */
+    f->line = code + 376;
+    f->lineno = 228;
+L383: /* STRING */
+    tp_aot_op(tp, f, code + 383);
+L386: /* METHOD */
+    tp_aot_op(tp, f, code + 386);
+L388: /* CALLM */
+    return code + 388;
+L389: /* RETURN */
+    return code + 389;
+L390: /* EOF */
+    return code + 390;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_5019(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 32: goto L32;
+        case 35: goto L35;
+        case 36: goto L36;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 53: goto L53;
+        case 57: goto L57;
+        case 59: goto L59;
+        case 62: goto L62;
+        case 66: goto L66;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 73: goto L73;
+        case 74: goto L74;
+        case 80: goto L80;
+        case 84: goto L84;
+        case 87: goto L87;
+        case 88: goto L88;
+        case 99: goto L99;
+        case 101: goto L101;
+        case 105: goto L105;
+        case 108: goto L108;
+        case 110: goto L110;
+        case 114: goto L114;
+        case 117: goto L117;
+        case 118: goto L118;
+        case 119: goto L119;
+        case 125: goto L125;
+        case 129: goto L129;
+        case 131: goto L131;
+        case 132: goto L132;
+        case 133: goto L133;
+        case 143: goto L143;
+        case 147: goto L147;
+        case 150: goto L150;
+        case 154: goto L154;
+        case 156: goto L156;
+        case 159: goto L159;
+        case 160: goto L160;
+        case 161: goto L161;
+        case 162: goto L162;
+        case 169: goto L169;
+        case 173: goto L173;
+        case 176: goto L176;
+        case 179: goto L179;
+        case 180: goto L180;
+        case 191: goto L191;
+        case 195: goto L195;
+        case 197: goto L197;
+        case 201: goto L201;
+        case 203: goto L203;
+        case 208: goto L208;
+        case 211: goto L211;
+        case 212: goto L212;
+        case 213: goto L213;
+        case 225: goto L225;
+        case 229: goto L229;
+        case 232: goto L232;
+        case 236: goto L236;
+        case 238: goto L238;
+        case 241: goto L241;
+        case 242: goto L242;
+        case 243: goto L243;
+        case 244: goto L244;
+        case 248: goto L248;
+        case 251: goto L251;
+        case 252: goto L252;
+        case 258: goto L258;
+        case 262: goto L262;
+        case 263: goto L263;
+        case 264: goto L264;
+        case 270: goto L270;
+        case 274: goto L274;
+        case 277: goto L277;
+        case 278: goto L278;
+        case 284: goto L284;
+        case 288: goto L288;
+        case 291: goto L291;
+        case 292: goto L292;
+        case 300: goto L300;
+        case 304: goto L304;
+        case 306: goto L306;
+        case 310: goto L310;
+        case 311: goto L311;
+        case 312: goto L312;
+        case 317: goto L317;
+        case 318: goto L318;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 230;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 231;
+L32: /* VAR */
+L35: /* LIST */
+    tp_aot_op(tp, f, code + 35);
+L36: /* STRING */
+    tp_aot_op(tp, f, code + 36);
+L40: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[2]);
+L41: /* MOVE */
+    regs[1] = regs[2];
+L42: /* LINE */
+    f->line = code + 42;
+    f->lineno = 232;
+L53: /* STRING */
+    tp_aot_op(tp, f, code + 53);
+L57: /* METHOD */
+    tp_aot_op(tp, f, code + 57);
+L59: /* GGET */
+    tp_aot_op(tp, f, code + 59);
+L62: /* STRING */
+    tp_aot_op(tp, f, code + 62);
+L66: /* MGET */
+    tp_aot_op(tp, f, code + 66);
+L68: /* CALLM */
+    return code + 68;
+L69: /* GGET */
+    tp_aot_op(tp, f, code + 69);
+L73: /* CALLP */
+    return code + 73;
+L74: /* LINE */
+    f->line = code + 74;
+    f->lineno = 233;
+L80: /* GGET */
+    tp_aot_op(tp, f, code + 80);
+L84: /* STRING */
+    tp_aot_op(tp, f, code + 84);
+L87: /* CALLP */
+    return code + 87;
+L88: /* LINE */
+    f->line = code + 88;
+    f->lineno = 234;
+L99: /* VAR */
+L101: /* GGET */
+    tp_aot_op(tp, f, code + 101);
+L105: /* STRING */
+    tp_aot_op(tp, f, code + 105);
+L108: /* MGET */
+    tp_aot_op(tp, f, code + 108);
+L110: /* STRING */
+    tp_aot_op(tp, f, code + 110);
+L114: /* STRING */
+    tp_aot_op(tp, f, code + 114);
+L117: /* LIST */
+    tp_aot_op(tp, f, code + 117);
+L118: /* CALLP */
+    return code + 118;
+L119: /* LINE */
+    f->line = code + 119;
+    f->lineno = 235;
+L125: /* STRING */
+    tp_aot_op(tp, f, code + 125);
+L129: /* METHOD */
+    tp_aot_op(tp, f, code + 129);
+L131: /* MOVE */
+    regs[6] = regs[2];
+L132: /* CALLM */
+    return code + 132;
+L133: /* LINE */
+    f->line = code + 133;
+    f->lineno = 236;
+L143: /* GGET */
+    tp_aot_op(tp, f, code + 143);
+L147: /* GGET */
+    tp_aot_op(tp, f, code + 147);
+L150: /* STRING */
+    tp_aot_op(tp, f, code + 150);
+L154: /* MGET */
+    tp_aot_op(tp, f, code + 154);
+L156: /* STRING */
+    tp_aot_op(tp, f, code + 156);
+L159: /* CALLP */
+    return code + 159;
+L160: /* IFN */
+    if (!(TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4]))) {
+        goto L162;
+    }
+L161: /* JUMP */
+    goto L264;
+L162: /* LINE */
+    f->line = code + 162;
+    f->lineno = 237;
+L169: /* GGET */
+    tp_aot_op(tp, f, code + 169);
+L173: /* STRING */
+    tp_aot_op(tp, f, code + 173);
+L176: /* NUMBER */
+    tp_aot_op(tp, f, code + 176);
+L179: /* CALLP */
+    return code + 179;
+L180: /* LINE */
+    f->line = code + 180;
+    f->lineno = 238;
+L191: /* STRING */
+    tp_aot_op(tp, f, code + 191);
+L195: /* MGET */
+    tp_aot_op(tp, f, code + 195);
+L197: /* STRING */
+    tp_aot_op(tp, f, code + 197);
+L201: /* METHOD */
+    tp_aot_op(tp, f, code + 201);
+L203: /* GGET */
+    tp_aot_op(tp, f, code + 203);
+L208: /* NUMBER */
+    tp_aot_op(tp, f, code + 208);
+L211: /* CALLP */
+    return code + 211;
+L212: /* CALLM */
+    return code + 212;
+L213: /* LINE */
+    f->line = code + 213;
+    f->lineno = 239;
+L225: /* GGET */
+    tp_aot_op(tp, f, code + 225);
+L229: /* GGET */
+    tp_aot_op(tp, f, code + 229);
+L232: /* STRING */
+    tp_aot_op(tp, f, code + 232);
+L236: /* MGET */
+    tp_aot_op(tp, f, code + 236);
+L238: /* STRING */
+    tp_aot_op(tp, f, code + 238);
+L241: /* CALLP */
+    return code + 241;
+L242: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L244;
+    }
+L243: /* JUMP */
+    goto L252;
+L244: /* GGET */
+    tp_aot_op(tp, f, code + 244);
+L248: /* STRING */
+    tp_aot_op(tp, f, code + 248);
+L251: /* CALLP */
+    return code + 251;
+L252: /* LINE */
+    f->line = code + 252;
+    f->lineno = 240;
+L258: /* GGET */
+    tp_aot_op(tp, f, code + 258);
+L262: /* CALLP */
+    return code + 262;
+L263: /* JUMP */
+    tp_aot_safepoint(tp, 120);
+    goto L143;
+L264: /* LINE */
+    f->line = code + 264;
+    f->lineno = 241;
+L270: /* GGET */
+    tp_aot_op(tp, f, code + 270);
+L274: /* STRING */
+    tp_aot_op(tp, f, code + 274);
+L277: /* CALLP */
+    return code + 277;
+L278: /* LINE */
+    f->line = code + 278;
+    f->lineno = 242;
+L284: /* GGET */
+    tp_aot_op(tp, f, code + 284);
+L288: /* STRING */
+    tp_aot_op(tp, f, code + 288);
+L291: /* CALLP */
+    return code + 291;
+L292: /* LINE */
+    f->line = code + 292;
+    f->lineno = 243;
+L300: /* STRING */
+    tp_aot_op(tp, f, code + 300);
+L304: /* METHOD */
+    tp_aot_op(tp, f, code + 304);
+L306: /* GGET */
+    tp_aot_op(tp, f, code + 306);
+L310: /* CALLP */
+    return code + 310;
+L311: /* CALLM */
+    return code + 311;
+L312: /* LINE */
+    f->line = code + 312;
+    f->lineno = 244;
+L317: /* RETURN */
+    return code + 317;
+L318: /* EOF */
+    return code + 318;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_5360(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 34: goto L34;
+        case 37: goto L37;
+        case 38: goto L38;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 53: goto L53;
+        case 57: goto L57;
+        case 59: goto L59;
+        case 64: goto L64;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 75: goto L75;
+        case 79: goto L79;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 91: goto L91;
+        case 95: goto L95;
+        case 97: goto L97;
+        case 101: goto L101;
+        case 102: goto L102;
+        case 103: goto L103;
+        case 108: goto L108;
+        case 109: goto L109;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 247;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 248;
+L34: /* VAR */
+L37: /* LIST */
+    tp_aot_op(tp, f, code + 37);
+L38: /* STRING */
+    tp_aot_op(tp, f, code + 38);
+L42: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[2]);
+L43: /* MOVE */
+    regs[1] = regs[2];
+L44: /* LINE */
+    f->line = code + 44;
+    f->lineno = 249;
+L53: /* STRING */
+    tp_aot_op(tp, f, code + 53);
+L57: /* METHOD */
+    tp_aot_op(tp, f, code + 57);
+L59: /* GGET */
+    tp_aot_op(tp, f, code + 59);
+L64: /* NUMBER */
+    tp_aot_op(tp, f, code + 64);
+L67: /* CALLP */
+    return code + 67;
+L68: /* CALLM */
+    return code + 68;
+L69: /* LINE */
+    f->line = code + 69;
+    f->lineno = 250;
+L75: /* GGET */
+    tp_aot_op(tp, f, code + 75);
+L79: /* STRING */
+    tp_aot_op(tp, f, code + 79);
+L82: /* CALLP */
+    return code + 82;
+L83: /* LINE */
+    f->line = code + 83;
+    f->lineno = 251;
+L91: /* STRING */
+    tp_aot_op(tp, f, code + 91);
+L95: /* METHOD */
+    tp_aot_op(tp, f, code + 95);
+L97: /* GGET */
+    tp_aot_op(tp, f, code + 97);
+L101: /* CALLP */
+    return code + 101;
+L102: /* CALLM */
+    return code + 102;
+L103: /* LINE */
+    f->line = code + 103;
+    f->lineno = 252;
+L108: /* RETURN */
+    return code + 108;
+L109: /* EOF */
+    return code + 109;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_5493(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 34: goto L34;
+        case 37: goto L37;
+        case 38: goto L38;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 53: goto L53;
+        case 57: goto L57;
+        case 59: goto L59;
+        case 64: goto L64;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 75: goto L75;
+        case 79: goto L79;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 96: goto L96;
+        case 100: goto L100;
+        case 102: goto L102;
+        case 106: goto L106;
+        case 111: goto L111;
+        case 115: goto L115;
+        case 116: goto L116;
+        case 117: goto L117;
+        case 118: goto L118;
+        case 123: goto L123;
+        case 124: goto L124;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 253;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 254;
+L34: /* VAR */
+L37: /* LIST */
+    tp_aot_op(tp, f, code + 37);
+L38: /* STRING */
+    tp_aot_op(tp, f, code + 38);
+L42: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[2]);
+L43: /* MOVE */
+    regs[1] = regs[2];
+L44: /* LINE */
+    f->line = code + 44;
+    f->lineno = 255;
+L53: /* STRING */
+    tp_aot_op(tp, f, code + 53);
+L57: /* METHOD */
+    tp_aot_op(tp, f, code + 57);
+L59: /* GGET */
+    tp_aot_op(tp, f, code + 59);
+L64: /* NUMBER */
+    tp_aot_op(tp, f, code + 64);
+L67: /* CALLP */
+    return code + 67;
+L68: /* CALLM */
+    return code + 68;
+L69: /* LINE */
+    f->line = code + 69;
+    f->lineno = 256;
+L75: /* GGET */
+    tp_aot_op(tp, f, code + 75);
+L79: /* STRING */
+    tp_aot_op(tp, f, code + 79);
+L82: /* CALLP */
+    return code + 82;
+L83: /* LINE */
+    f->line = code + 83;
+    f->lineno = 258;
+L96: /* STRING */
+    tp_aot_op(tp, f, code + 96);
+L100: /* METHOD */
+    tp_aot_op(tp, f, code + 100);
+L102: /* GGET */
+    tp_aot_op(tp, f, code + 102);
+L106: /* STRING */
+    tp_aot_op(tp, f, code + 106);
+L111: /* GGET */
+    tp_aot_op(tp, f, code + 111);
+L115: /* CALLP */
+    return code + 115;
+L116: /* CALLP */
+    return code + 116;
+L117: /* CALLM */
+    return code + 117;
+L118: /* LINE */
+    f->line = code + 118;
+    f->lineno = 259;
+L123: /* RETURN */
+    return code + 123;
+L124: /* EOF */
+    return code + 124;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_5641(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 34: goto L34;
+        case 37: goto L37;
+        case 38: goto L38;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 48: goto L48;
+        case 50: goto L50;
+        case 53: goto L53;
+        case 58: goto L58;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 73: goto L73;
+        case 77: goto L77;
+        case 80: goto L80;
+        case 84: goto L84;
+        case 86: goto L86;
+        case 90: goto L90;
+        case 91: goto L91;
+        case 92: goto L92;
+        case 93: goto L93;
+        case 100: goto L100;
+        case 103: goto L103;
+        case 104: goto L104;
+        case 111: goto L111;
+        case 115: goto L115;
+        case 116: goto L116;
+        case 117: goto L117;
+        case 128: goto L128;
+        case 132: goto L132;
+        case 135: goto L135;
+        case 139: goto L139;
+        case 141: goto L141;
+        case 145: goto L145;
+        case 146: goto L146;
+        case 147: goto L147;
+        case 148: goto L148;
+        case 157: goto L157;
+        case 160: goto L160;
+        case 164: goto L164;
+        case 166: goto L166;
+        case 169: goto L169;
+        case 171: goto L171;
+        case 172: goto L172;
+        case 179: goto L179;
+        case 183: goto L183;
+        case 184: goto L184;
+        case 185: goto L185;
+        case 191: goto L191;
+        case 201: goto L201;
+        case 204: goto L204;
+        case 208: goto L208;
+        case 211: goto L211;
+        case 213: goto L213;
+        case 217: goto L217;
+        case 218: goto L218;
+        case 219: goto L219;
+        case 226: goto L226;
+        case 230: goto L230;
+        case 232: goto L232;
+        case 233: goto L233;
+        case 234: goto L234;
+        case 241: goto L241;
+        case 245: goto L245;
+        case 249: goto L249;
+        case 250: goto L250;
+        case 259: goto L259;
+        case 263: goto L263;
+        case 265: goto L265;
+        case 270: goto L270;
+        case 273: goto L273;
+        case 274: goto L274;
+        case 275: goto L275;
+        case 280: goto L280;
+        case 281: goto L281;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 261;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 262;
+L34: /* VAR */
+L37: /* LIST */
+    tp_aot_op(tp, f, code + 37);
+L38: /* STRING */
+    tp_aot_op(tp, f, code + 38);
+L42: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[2]);
+L43: /* MOVE */
+    regs[1] = regs[2];
+L44: /* LINE */
+    f->line = code + 44;
+    f->lineno = 265;
+L48: /* VAR */
+L50: /* STRING */
+    tp_aot_op(tp, f, code + 50);
+L53: /* LINE */
+    f->line = code + 53;
+    f->lineno = 266;
+L58: /* NUMBER */
+    tp_aot_op(tp, f, code + 58);
+L61: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L63;
+    }
+L62: /* JUMP */
+    goto L191;
+L63: /* LINE */
+    f->line = code + 63;
+    f->lineno = 267;
+L73: /* GGET */
+    tp_aot_op(tp, f, code + 73);
+L77: /* GGET */
+    tp_aot_op(tp, f, code + 77);
+L80: /* STRING */
+    tp_aot_op(tp, f, code + 80);
+L84: /* MGET */
+    tp_aot_op(tp, f, code + 84);
+L86: /* STRING */
+    tp_aot_op(tp, f, code + 86);
+L90: /* CALLP */
+    return code + 90;
+L91: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L93;
+    }
+L92: /* JUMP */
+    goto L117;
+L93: /* LINE */
+    f->line = code + 93;
+    f->lineno = 268;
+L100: /* STRING */
+    tp_aot_op(tp, f, code + 100);
+L103: /* ADD */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_int(regs[2].nint + regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 103);
+    }
+L104: /* LINE */
+    f->line = code + 104;
+    f->lineno = 269;
+L111: /* GGET */
+    tp_aot_op(tp, f, code + 111);
+L115: /* CALLP */
+    return code + 115;
+L116: /* JUMP */
+    tp_aot_safepoint(tp, 58);
+    goto L58;
+L117: /* LINE */
+    f->line = code + 117;
+    f->lineno = 270;
+L128: /* GGET */
+    tp_aot_op(tp, f, code + 128);
+L132: /* GGET */
+    tp_aot_op(tp, f, code + 132);
+L135: /* STRING */
+    tp_aot_op(tp, f, code + 135);
+L139: /* MGET */
+    tp_aot_op(tp, f, code + 139);
+L141: /* STRING */
+    tp_aot_op(tp, f, code + 141);
+L145: /* CALLP */
+    return code + 145;
+L146: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L148;
+    }
+L147: /* JUMP */
+    goto L185;
+L148: /* LINE */
+    f->line = code + 148;
+    f->lineno = 271;
+L157: /* GGET */
+    tp_aot_op(tp, f, code + 157);
+L160: /* STRING */
+    tp_aot_op(tp, f, code + 160);
+L164: /* MGET */
+    tp_aot_op(tp, f, code + 164);
+L166: /* STRING */
+    tp_aot_op(tp, f, code + 166);
+L169: /* MGET */
+    tp_aot_op(tp, f, code + 169);
+L171: /* ADD */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_int(regs[2].nint + regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 171);
+    }
+L172: /* LINE */
+    f->line = code + 172;
+    f->lineno = 272;
+L179: /* GGET */
+    tp_aot_op(tp, f, code + 179);
+L183: /* CALLP */
+    return code + 183;
+L184: /* JUMP */
+    tp_aot_safepoint(tp, 126);
+    goto L58;
+L185: /* LINE */
+    f->line = code + 185;
+    f->lineno = 274;
+L191: /* LINE */
+    f->line = code + 191;
+    f->lineno = 276;
+L201: /* VAR */
+L204: /* GGET */
+    tp_aot_op(tp, f, code + 204);
+L208: /* STRING */
+    tp_aot_op(tp, f, code + 208);
+L211: /* MGET */
+    tp_aot_op(tp, f, code + 211);
+L213: /* STRING */
+    tp_aot_op(tp, f, code + 213);
+L217: /* MOVE */
+    regs[7] = regs[2];
+L218: /* CALLP */
+    return code + 218;
+L219: /* LINE */
+    f->line = code + 219;
+    f->lineno = 277;
+L226: /* STRING */
+    tp_aot_op(tp, f, code + 226);
+L230: /* METHOD */
+    tp_aot_op(tp, f, code + 230);
+L232: /* MOVE */
+    regs[6] = regs[3];
+L233: /* CALLM */
+    return code + 233;
+L234: /* LINE */
+    f->line = code + 234;
+    f->lineno = 279;
+L241: /* GGET */
+    tp_aot_op(tp, f, code + 241);
+L245: /* STRING */
+    tp_aot_op(tp, f, code + 245);
+L249: /* CALLP */
+    return code + 249;
+L250: /* LINE */
+    f->line = code + 250;
+    f->lineno = 280;
+L259: /* STRING */
+    tp_aot_op(tp, f, code + 259);
+L263: /* METHOD */
+    tp_aot_op(tp, f, code + 263);
+L265: /* GGET */
+    tp_aot_op(tp, f, code + 265);
+L270: /* NUMBER */
+    tp_aot_op(tp, f, code + 270);
+L273: /* CALLP */
+    return code + 273;
+L274: /* CALLM */
+    return code + 274;
+L275: /* LINE */
+    f->line = code + 275;
+    f->lineno = 281;
+L280: /* RETURN */
+    return code + 280;
+L281: /* EOF */
+    return code + 281;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_5946(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 34: goto L34;
+        case 37: goto L37;
+        case 38: goto L38;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 48: goto L48;
+        case 50: goto L50;
+        case 53: goto L53;
+        case 58: goto L58;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 73: goto L73;
+        case 77: goto L77;
+        case 80: goto L80;
+        case 84: goto L84;
+        case 86: goto L86;
+        case 90: goto L90;
+        case 91: goto L91;
+        case 92: goto L92;
+        case 93: goto L93;
+        case 100: goto L100;
+        case 103: goto L103;
+        case 104: goto L104;
+        case 111: goto L111;
+        case 115: goto L115;
+        case 116: goto L116;
+        case 117: goto L117;
+        case 128: goto L128;
+        case 132: goto L132;
+        case 135: goto L135;
+        case 139: goto L139;
+        case 141: goto L141;
+        case 145: goto L145;
+        case 146: goto L146;
+        case 147: goto L147;
+        case 148: goto L148;
+        case 157: goto L157;
+        case 160: goto L160;
+        case 164: goto L164;
+        case 166: goto L166;
+        case 169: goto L169;
+        case 171: goto L171;
+        case 172: goto L172;
+        case 179: goto L179;
+        case 183: goto L183;
+        case 184: goto L184;
+        case 185: goto L185;
+        case 191: goto L191;
+        case 201: goto L201;
+        case 204: goto L204;
+        case 208: goto L208;
+        case 211: goto L211;
+        case 213: goto L213;
+        case 217: goto L217;
+        case 218: goto L218;
+        case 219: goto L219;
+        case 226: goto L226;
+        case 230: goto L230;
+        case 232: goto L232;
+        case 233: goto L233;
+        case 234: goto L234;
+        case 243: goto L243;
+        case 247: goto L247;
+        case 250: goto L250;
+        case 254: goto L254;
+        case 256: goto L256;
+        case 259: goto L259;
+        case 260: goto L260;
+        case 261: goto L261;
+        case 262: goto L262;
+        case 269: goto L269;
+        case 273: goto L273;
+        case 276: goto L276;
+        case 277: goto L277;
+        case 287: goto L287;
+        case 291: goto L291;
+        case 293: goto L293;
+        case 298: goto L298;
+        case 301: goto L301;
+        case 302: goto L302;
+        case 303: goto L303;
+        case 308: goto L308;
+        case 309: goto L309;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 283;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 284;
+L34: /* VAR */
+L37: /* LIST */
+    tp_aot_op(tp, f, code + 37);
+L38: /* STRING */
+    tp_aot_op(tp, f, code + 38);
+L42: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[2]);
+L43: /* MOVE */
+    regs[1] = regs[2];
+L44: /* LINE */
+    f->line = code + 44;
+    f->lineno = 285;
+L48: /* VAR */
+L50: /* STRING */
+    tp_aot_op(tp, f, code + 50);
+L53: /* LINE */
+    f->line = code + 53;
+    f->lineno = 286;
+L58: /* NUMBER */
+    tp_aot_op(tp, f, code + 58);
+L61: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L63;
+    }
+L62: /* JUMP */
+    goto L191;
+L63: /* LINE */
+    f->line = code + 63;
+    f->lineno = 287;
+L73: /* GGET */
+    tp_aot_op(tp, f, code + 73);
+L77: /* GGET */
+    tp_aot_op(tp, f, code + 77);
+L80: /* STRING */
+    tp_aot_op(tp, f, code + 80);
+L84: /* MGET */
+    tp_aot_op(tp, f, code + 84);
+L86: /* STRING */
+    tp_aot_op(tp, f, code + 86);
+L90: /* CALLP */
+    return code + 90;
+L91: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L93;
+    }
+L92: /* JUMP */
+    goto L117;
+L93: /* LINE */
+    f->line = code + 93;
+    f->lineno = 288;
+L100: /* STRING */
+    tp_aot_op(tp, f, code + 100);
+L103: /* ADD */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_int(regs[2].nint + regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 103);
+    }
+L104: /* LINE */
+    f->line = code + 104;
+    f->lineno = 289;
+L111: /* GGET */
+    tp_aot_op(tp, f, code + 111);
+L115: /* CALLP */
+    return code + 115;
+L116: /* JUMP */
+    tp_aot_safepoint(tp, 58);
+    goto L58;
+L117: /* LINE */
+    f->line = code + 117;
+    f->lineno = 290;
+L128: /* GGET */
+    tp_aot_op(tp, f, code + 128);
+L132: /* GGET */
+    tp_aot_op(tp, f, code + 132);
+L135: /* STRING */
+    tp_aot_op(tp, f, code + 135);
+L139: /* MGET */
+    tp_aot_op(tp, f, code + 139);
+L141: /* STRING */
+    tp_aot_op(tp, f, code + 141);
+L145: /* CALLP */
+    return code + 145;
+L146: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L148;
+    }
+L147: /* JUMP */
+    goto L185;
+L148: /* LINE */
+    f->line = code + 148;
+    f->lineno = 291;
+L157: /* GGET */
+    tp_aot_op(tp, f, code + 157);
+L160: /* STRING */
+    tp_aot_op(tp, f, code + 160);
+L164: /* MGET */
+    tp_aot_op(tp, f, code + 164);
+L166: /* STRING */
+    tp_aot_op(tp, f, code + 166);
+L169: /* MGET */
+    tp_aot_op(tp, f, code + 169);
+L171: /* ADD */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_int(regs[2].nint + regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 171);
+    }
+L172: /* LINE */
+    f->line = code + 172;
+    f->lineno = 292;
+L179: /* GGET */
+    tp_aot_op(tp, f, code + 179);
+L183: /* CALLP */
+    return code + 183;
+L184: /* JUMP */
+    tp_aot_safepoint(tp, 126);
+    goto L58;
+L185: /* LINE */
+    f->line = code + 185;
+    f->lineno = 294;
+L191: /* LINE */
+    f->line = code + 191;
+    f->lineno = 296;
+L201: /* VAR */
+L204: /* GGET */
+    tp_aot_op(tp, f, code + 204);
+L208: /* STRING */
+    tp_aot_op(tp, f, code + 208);
+L211: /* MGET */
+    tp_aot_op(tp, f, code + 211);
+L213: /* STRING */
+    tp_aot_op(tp, f, code + 213);
+L217: /* MOVE */
+    regs[7] = regs[2];
+L218: /* CALLP */
+    return code + 218;
+L219: /* LINE */
+    f->line = code + 219;
+    f->lineno = 297;
+L226: /* STRING */
+    tp_aot_op(tp, f, code + 226);
+L230: /* METHOD */
+    tp_aot_op(tp, f, code + 230);
+L232: /* MOVE */
+    regs[6] = regs[3];
+L233: /* CALLM */
+    return code + 233;
+L234: /* LINE */
+    f->line = code + 234;
+    f->lineno = 298;
+L243: /* GGET */
+    tp_aot_op(tp, f, code + 243);
+L247: /* GGET */
+    tp_aot_op(tp, f, code + 247);
+L250: /* STRING */
+    tp_aot_op(tp, f, code + 250);
+L254: /* MGET */
+    tp_aot_op(tp, f, code + 254);
+L256: /* STRING */
+    tp_aot_op(tp, f, code + 256);
+L259: /* CALLP */
+    return code + 259;
+L260: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L262;
+    }
+L261: /* JUMP */
+    goto L303;
+L262: /* LINE */
+    f->line = code + 262;
+    f->lineno = 299;
+L269: /* GGET */
+    tp_aot_op(tp, f, code + 269);
+L273: /* STRING */
+    tp_aot_op(tp, f, code + 273);
+L276: /* CALLP */
+    return code + 276;
+L277: /* LINE */
+    f->line = code + 277;
+    f->lineno = 300;
+L287: /* STRING */
+    tp_aot_op(tp, f, code + 287);
+L291: /* METHOD */
+    tp_aot_op(tp, f, code + 291);
+L293: /* GGET */
+    tp_aot_op(tp, f, code + 293);
+L298: /* NUMBER */
+    tp_aot_op(tp, f, code + 298);
+L301: /* CALLP */
+    return code + 301;
+L302: /* CALLM */
+    return code + 302;
+L303: /* LINE */
+    f->line = code + 303;
+    f->lineno = 302;
+L308: /* RETURN */
+    return code + 308;
+L309: /* EOF */
+    return code + 309;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_6278(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 32: goto L32;
+        case 35: goto L35;
+        case 36: goto L36;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 48: goto L48;
+        case 52: goto L52;
+        case 55: goto L55;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 68: goto L68;
+        case 72: goto L72;
+        case 74: goto L74;
+        case 79: goto L79;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 90: goto L90;
+        case 94: goto L94;
+        case 97: goto L97;
+        case 98: goto L98;
+        case 107: goto L107;
+        case 111: goto L111;
+        case 113: goto L113;
+        case 118: goto L118;
+        case 121: goto L121;
+        case 122: goto L122;
+        case 123: goto L123;
+        case 128: goto L128;
+        case 132: goto L132;
+        case 133: goto L133;
+        case 139: goto L139;
+        case 143: goto L143;
+        case 146: goto L146;
+        case 147: goto L147;
+        case 155: goto L155;
+        case 159: goto L159;
+        case 161: goto L161;
+        case 165: goto L165;
+        case 166: goto L166;
+        case 167: goto L167;
+        case 172: goto L172;
+        case 173: goto L173;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 304;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 305;
+L32: /* VAR */
+L35: /* LIST */
+    tp_aot_op(tp, f, code + 35);
+L36: /* STRING */
+    tp_aot_op(tp, f, code + 36);
+L40: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[2]);
+L41: /* MOVE */
+    regs[1] = regs[2];
+L42: /* LINE */
+    f->line = code + 42;
+    f->lineno = 306;
+L48: /* GGET */
+    tp_aot_op(tp, f, code + 48);
+L52: /* STRING */
+    tp_aot_op(tp, f, code + 52);
+L55: /* NUMBER */
+    tp_aot_op(tp, f, code + 55);
+L58: /* CALLP */
+    return code + 58;
+L59: /* LINE */
+    f->line = code + 59;
+    f->lineno = 307;
+L68: /* STRING */
+    tp_aot_op(tp, f, code + 68);
+L72: /* METHOD */
+    tp_aot_op(tp, f, code + 72);
+L74: /* GGET */
+    tp_aot_op(tp, f, code + 74);
+L79: /* NUMBER */
+    tp_aot_op(tp, f, code + 79);
+L82: /* CALLP */
+    return code + 82;
+L83: /* CALLM */
+    return code + 83;
+L84: /* LINE */
+    f->line = code + 84;
+    f->lineno = 308;
+L90: /* GGET */
+    tp_aot_op(tp, f, code + 90);
+L94: /* STRING */
+    tp_aot_op(tp, f, code + 94);
+L97: /* CALLP */
+    return code + 97;
+L98: /* LINE */
+    f->line = code + 98;
+    f->lineno = 309;
+L107: /* STRING */
+    tp_aot_op(tp, f, code + 107);
+L111: /* METHOD */
+    tp_aot_op(tp, f, code + 111);
+L113: /* GGET */
+    tp_aot_op(tp, f, code + 113);
+L118: /* NUMBER */
+    tp_aot_op(tp, f, code + 118);
+L121: /* CALLP */
+    return code + 121;
+L122: /* CALLM */
+    return code + 122;
+L123: /* LINE */
+    f->line = code + 123;
+    f->lineno = 310;
+L128: /* GGET */
+    tp_aot_op(tp, f, code + 128);
+L132: /* CALLP */
+    return code + 132;
+L133: /* LINE */
+    f->line = code + 133;
+    f->lineno = 311;
+L139: /* GGET */
+    tp_aot_op(tp, f, code + 139);
+L143: /* STRING */
+    tp_aot_op(tp, f, code + 143);
+L146: /* CALLP */
+    return code + 146;
+L147: /* LINE */
+    f->line = code + 147;
+    f->lineno = 312;
+L155: /* STRING */
+    tp_aot_op(tp, f, code + 155);
+L159: /* METHOD */
+    tp_aot_op(tp, f, code + 159);
+L161: /* GGET */
+    tp_aot_op(tp, f, code + 161);
+L165: /* CALLP */
+    return code + 165;
+L166: /* CALLM */
+    return code + 166;
+L167: /* LINE */
+    f->line = code + 167;
+    f->lineno = 313;
+L172: /* RETURN */
+    return code + 172;
+L173: /* EOF */
+    return code + 173;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_6473(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 32: goto L32;
+        case 35: goto L35;
+        case 36: goto L36;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 49: goto L49;
+        case 51: goto L51;
+        case 56: goto L56;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 66: goto L66;
+        case 70: goto L70;
+        case 73: goto L73;
+        case 74: goto L74;
+        case 79: goto L79;
+        case 81: goto L81;
+        case 85: goto L85;
+        case 86: goto L86;
+        case 100: goto L100;
+        case 104: goto L104;
+        case 106: goto L106;
+        case 110: goto L110;
+        case 113: goto L113;
+        case 115: goto L115;
+        case 119: goto L119;
+        case 123: goto L123;
+        case 124: goto L124;
+        case 125: goto L125;
+        case 126: goto L126;
+        case 127: goto L127;
+        case 128: goto L128;
+        case 138: goto L138;
+        case 142: goto L142;
+        case 145: goto L145;
+        case 149: goto L149;
+        case 151: goto L151;
+        case 155: goto L155;
+        case 156: goto L156;
+        case 157: goto L157;
+        case 158: goto L158;
+        case 165: goto L165;
+        case 167: goto L167;
+        case 170: goto L170;
+        case 174: goto L174;
+        case 176: goto L176;
+        case 183: goto L183;
+        case 187: goto L187;
+        case 191: goto L191;
+        case 192: goto L192;
+        case 200: goto L200;
+        case 205: goto L205;
+        case 208: goto L208;
+        case 209: goto L209;
+        case 216: goto L216;
+        case 220: goto L220;
+        case 223: goto L223;
+        case 224: goto L224;
+        case 230: goto L230;
+        case 234: goto L234;
+        case 235: goto L235;
+        case 251: goto L251;
+        case 255: goto L255;
+        case 257: goto L257;
+        case 261: goto L261;
+        case 264: goto L264;
+        case 266: goto L266;
+        case 270: goto L270;
+        case 274: goto L274;
+        case 275: goto L275;
+        case 276: goto L276;
+        case 277: goto L277;
+        case 278: goto L278;
+        case 279: goto L279;
+        case 280: goto L280;
+        case 289: goto L289;
+        case 293: goto L293;
+        case 296: goto L296;
+        case 300: goto L300;
+        case 302: goto L302;
+        case 306: goto L306;
+        case 307: goto L307;
+        case 308: goto L308;
+        case 309: goto L309;
+        case 316: goto L316;
+        case 319: goto L319;
+        case 323: goto L323;
+        case 325: goto L325;
+        case 332: goto L332;
+        case 336: goto L336;
+        case 340: goto L340;
+        case 341: goto L341;
+        case 348: goto L348;
+        case 352: goto L352;
+        case 355: goto L355;
+        case 356: goto L356;
+        case 362: goto L362;
+        case 366: goto L366;
+        case 367: goto L367;
+        case 382: goto L382;
+        case 386: goto L386;
+        case 388: goto L388;
+        case 392: goto L392;
+        case 395: goto L395;
+        case 397: goto L397;
+        case 401: goto L401;
+        case 405: goto L405;
+        case 406: goto L406;
+        case 407: goto L407;
+        case 408: goto L408;
+        case 409: goto L409;
+        case 414: goto L414;
+        case 415: goto L415;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 315;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 316;
+L32: /* VAR */
+L35: /* LIST */
+    tp_aot_op(tp, f, code + 35);
+L36: /* STRING */
+    tp_aot_op(tp, f, code + 36);
+L40: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[2]);
+L41: /* MOVE */
+    regs[1] = regs[2];
+L42: /* LINE */
+    f->line = code + 42;
+    f->lineno = 317;
+L49: /* VAR */
+L51: /* GGET */
+    tp_aot_op(tp, f, code + 51);
+L56: /* NUMBER */
+    tp_aot_op(tp, f, code + 56);
+L59: /* CALLP */
+    return code + 59;
+L60: /* LINE */
+    f->line = code + 60;
+    f->lineno = 318;
+L66: /* GGET */
+    tp_aot_op(tp, f, code + 66);
+L70: /* STRING */
+    tp_aot_op(tp, f, code + 70);
+L73: /* CALLP */
+    return code + 73;
+L74: /* LINE */
+    f->line = code + 74;
+    f->lineno = 319;
+L79: /* VAR */
+L81: /* GGET */
+    tp_aot_op(tp, f, code + 81);
+L85: /* CALLP */
+    return code + 85;
+L86: /* LINE */
+    f->line = code + 86;
+    f->lineno = 320;
+L100: /* STRING */
+    tp_aot_op(tp, f, code + 100);
+L104: /* METHOD */
+    tp_aot_op(tp, f, code + 104);
+L106: /* GGET */
+    tp_aot_op(tp, f, code + 106);
+L110: /* STRING */
+    tp_aot_op(tp, f, code + 110);
+L113: /* MGET */
+    tp_aot_op(tp, f, code + 113);
+L115: /* STRING */
+    tp_aot_op(tp, f, code + 115);
+L119: /* STRING */
+    tp_aot_op(tp, f, code + 119);
+L123: /* MOVE */
+    regs[13] = regs[2];
+L124: /* MOVE */
+    regs[14] = regs[3];
+L125: /* LIST */
+    tp_aot_op(tp, f, code + 125);
+L126: /* CALLP */
+    return code + 126;
+L127: /* CALLM */
+    return code + 127;
+L128: /* LINE */
+    f->line = code + 128;
+    f->lineno = 321;
+L138: /* GGET */
+    tp_aot_op(tp, f, code + 138);
+L142: /* GGET */
+    tp_aot_op(tp, f, code + 142);
+L145: /* STRING */
+    tp_aot_op(tp, f, code + 145);
+L149: /* MGET */
+    tp_aot_op(tp, f, code + 149);
+L151: /* STRING */
+    tp_aot_op(tp, f, code + 151);
+L155: /* CALLP */
+    return code + 155;
+L156: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L158;
+    }
+L157: /* JUMP */
+    goto L280;
+L158: /* LINE */
+    f->line = code + 158;
+    f->lineno = 322;
+L165: /* VAR */
+L167: /* GGET */
+    tp_aot_op(tp, f, code + 167);
+L170: /* STRING */
+    tp_aot_op(tp, f, code + 170);
+L174: /* MGET */
+    tp_aot_op(tp, f, code + 174);
+L176: /* LINE */
+    f->line = code + 176;
+    f->lineno = 323;
+L183: /* GGET */
+    tp_aot_op(tp, f, code + 183);
+L187: /* STRING */
+    tp_aot_op(tp, f, code + 187);
+L191: /* CALLP */
+    return code + 191;
+L192: /* LINE */
+    f->line = code + 192;
+    f->lineno = 324;
+L200: /* GGET */
+    tp_aot_op(tp, f, code + 200);
+L205: /* NUMBER */
+    tp_aot_op(tp, f, code + 205);
+L208: /* CALLP */
+    return code + 208;
+L209: /* LINE */
+    f->line = code + 209;
+    f->lineno = 325;
+L216: /* GGET */
+    tp_aot_op(tp, f, code + 216);
+L220: /* STRING */
+    tp_aot_op(tp, f, code + 220);
+L223: /* CALLP */
+    return code + 223;
+L224: /* LINE */
+    f->line = code + 224;
+    f->lineno = 326;
+L230: /* GGET */
+    tp_aot_op(tp, f, code + 230);
+L234: /* CALLP */
+    return code + 234;
+L235: /* LINE */
+    f->line = code + 235;
+    f->lineno = 327;
+L251: /* STRING */
+    tp_aot_op(tp, f, code + 251);
+L255: /* METHOD */
+    tp_aot_op(tp, f, code + 255);
+L257: /* GGET */
+    tp_aot_op(tp, f, code + 257);
+L261: /* STRING */
+    tp_aot_op(tp, f, code + 261);
+L264: /* MGET */
+    tp_aot_op(tp, f, code + 264);
+L266: /* STRING */
+    tp_aot_op(tp, f, code + 266);
+L270: /* STRING */
+    tp_aot_op(tp, f, code + 270);
+L274: /* MOVE */
+    regs[14] = regs[2];
+L275: /* MOVE */
+    regs[15] = regs[3];
+L276: /* LIST */
+    tp_aot_op(tp, f, code + 276);
+L277: /* CALLP */
+    return code + 277;
+L278: /* CALLM */
+    return code + 278;
+L279: /* JUMP */
+    tp_aot_safepoint(tp, 141);
+    goto L138;
+L280: /* LINE */
+    f->line = code + 280;
+    f->lineno = 328;
+L289: /* GGET */
+    tp_aot_op(tp, f, code + 289);
+L293: /* GGET */
+    tp_aot_op(tp, f, code + 293);
+L296: /* STRING */
+    tp_aot_op(tp, f, code + 296);
+L300: /* MGET */
+    tp_aot_op(tp, f, code + 300);
+L302: /* STRING */
+    tp_aot_op(tp, f, code + 302);
+L306: /* CALLP */
+    return code + 306;
+L307: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L309;
+    }
+L308: /* JUMP */
+    goto L409;
+L309: /* LINE */
+    f->line = code + 309;
+    f->lineno = 329;
+L316: /* GGET */
+    tp_aot_op(tp, f, code + 316);
+L319: /* STRING */
+    tp_aot_op(tp, f, code + 319);
+L323: /* MGET */
+    tp_aot_op(tp, f, code + 323);
+L325: /* LINE */
+    f->line = code + 325;
+    f->lineno = 330;
+L332: /* GGET */
+    tp_aot_op(tp, f, code + 332);
+L336: /* STRING */
+    tp_aot_op(tp, f, code + 336);
+L340: /* CALLP */
+    return code + 340;
+L341: /* LINE */
+    f->line = code + 341;
+    f->lineno = 331;
+L348: /* GGET */
+    tp_aot_op(tp, f, code + 348);
+L352: /* STRING */
+    tp_aot_op(tp, f, code + 352);
+L355: /* CALLP */
+    return code + 355;
+L356: /* LINE */
+    f->line = code + 356;
+    f->lineno = 332;
+L362: /* GGET */
+    tp_aot_op(tp, f, code + 362);
+L366: /* CALLP */
+    return code + 366;
+L367: /* LINE */
+    f->line = code + 367;
+    f->lineno = 333;
+L382: /* STRING */
+    tp_aot_op(tp, f, code + 382);
+L386: /* METHOD */
+    tp_aot_op(tp, f, code + 386);
+L388: /* GGET */
+    tp_aot_op(tp, f, code + 388);
+L392: /* STRING */
+    tp_aot_op(tp, f, code + 392);
+L395: /* MGET */
+    tp_aot_op(tp, f, code + 395);
+L397: /* STRING */
+    tp_aot_op(tp, f, code + 397);
+L401: /* STRING */
+    tp_aot_op(tp, f, code + 401);
+L405: /* MOVE */
+    regs[14] = regs[3];
+L406: /* LIST */
+    tp_aot_op(tp, f, code + 406);
+L407: /* CALLP */
+    return code + 407;
+L408: /* CALLM */
+    return code + 408;
+L409: /* LINE */
+    f->line = code + 409;
+    f->lineno = 334;
+L414: /* RETURN */
+    return code + 414;
+L415: /* EOF */
+    return code + 415;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_6910(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 32: goto L32;
+        case 35: goto L35;
+        case 36: goto L36;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 48: goto L48;
+        case 52: goto L52;
+        case 55: goto L55;
+        case 56: goto L56;
+        case 61: goto L61;
+        case 63: goto L63;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 74: goto L74;
+        case 78: goto L78;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 92: goto L92;
+        case 96: goto L96;
+        case 99: goto L99;
+        case 103: goto L103;
+        case 105: goto L105;
+        case 109: goto L109;
+        case 110: goto L110;
+        case 111: goto L111;
+        case 112: goto L112;
+        case 119: goto L119;
+        case 121: goto L121;
+        case 124: goto L124;
+        case 128: goto L128;
+        case 130: goto L130;
+        case 138: goto L138;
+        case 142: goto L142;
+        case 146: goto L146;
+        case 147: goto L147;
+        case 162: goto L162;
+        case 166: goto L166;
+        case 169: goto L169;
+        case 173: goto L173;
+        case 175: goto L175;
+        case 178: goto L178;
+        case 179: goto L179;
+        case 180: goto L180;
+        case 181: goto L181;
+        case 183: goto L183;
+        case 188: goto L188;
+        case 191: goto L191;
+        case 192: goto L192;
+        case 193: goto L193;
+        case 207: goto L207;
+        case 211: goto L211;
+        case 214: goto L214;
+        case 216: goto L216;
+        case 220: goto L220;
+        case 224: goto L224;
+        case 225: goto L225;
+        case 232: goto L232;
+        case 236: goto L236;
+        case 239: goto L239;
+        case 240: goto L240;
+        case 246: goto L246;
+        case 250: goto L250;
+        case 251: goto L251;
+        case 268: goto L268;
+        case 272: goto L272;
+        case 274: goto L274;
+        case 278: goto L278;
+        case 281: goto L281;
+        case 283: goto L283;
+        case 287: goto L287;
+        case 291: goto L291;
+        case 292: goto L292;
+        case 293: goto L293;
+        case 294: goto L294;
+        case 295: goto L295;
+        case 296: goto L296;
+        case 297: goto L297;
+        case 302: goto L302;
+        case 303: goto L303;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 335;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 336;
+L32: /* VAR */
+L35: /* LIST */
+    tp_aot_op(tp, f, code + 35);
+L36: /* STRING */
+    tp_aot_op(tp, f, code + 36);
+L40: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[2]);
+L41: /* MOVE */
+    regs[1] = regs[2];
+L42: /* LINE */
+    f->line = code + 42;
+    f->lineno = 337;
+L48: /* GGET */
+    tp_aot_op(tp, f, code + 48);
+L52: /* STRING */
+    tp_aot_op(tp, f, code + 52);
+L55: /* CALLP */
+    return code + 55;
+L56: /* LINE */
+    f->line = code + 56;
+    f->lineno = 338;
+L61: /* VAR */
+L63: /* GGET */
+    tp_aot_op(tp, f, code + 63);
+L67: /* CALLP */
+    return code + 67;
+L68: /* LINE */
+    f->line = code + 68;
+    f->lineno = 339;
+L74: /* STRING */
+    tp_aot_op(tp, f, code + 74);
+L78: /* METHOD */
+    tp_aot_op(tp, f, code + 78);
+L80: /* MOVE */
+    regs[6] = regs[2];
+L81: /* CALLM */
+    return code + 81;
+L82: /* LINE */
+    f->line = code + 82;
+    f->lineno = 340;
+L92: /* GGET */
+    tp_aot_op(tp, f, code + 92);
+L96: /* GGET */
+    tp_aot_op(tp, f, code + 96);
+L99: /* STRING */
+    tp_aot_op(tp, f, code + 99);
+L103: /* MGET */
+    tp_aot_op(tp, f, code + 103);
+L105: /* STRING */
+    tp_aot_op(tp, f, code + 105);
+L109: /* CALLP */
+    return code + 109;
+L110: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L112;
+    }
+L111: /* JUMP */
+    goto L297;
+L112: /* LINE */
+    f->line = code + 112;
+    f->lineno = 341;
+L119: /* VAR */
+L121: /* GGET */
+    tp_aot_op(tp, f, code + 121);
+L124: /* STRING */
+    tp_aot_op(tp, f, code + 124);
+L128: /* MGET */
+    tp_aot_op(tp, f, code + 128);
+L130: /* LINE */
+    f->line = code + 130;
+    f->lineno = 342;
+L138: /* GGET */
+    tp_aot_op(tp, f, code + 138);
+L142: /* STRING */
+    tp_aot_op(tp, f, code + 142);
+L146: /* CALLP */
+    return code + 146;
+L147: /* LINE */
+    f->line = code + 147;
+    f->lineno = 343;
+L162: /* GGET */
+    tp_aot_op(tp, f, code + 162);
+L166: /* GGET */
+    tp_aot_op(tp, f, code + 166);
+L169: /* STRING */
+    tp_aot_op(tp, f, code + 169);
+L173: /* MGET */
+    tp_aot_op(tp, f, code + 173);
+L175: /* STRING */
+    tp_aot_op(tp, f, code + 175);
+L178: /* CALLP */
+    return code + 178;
+L179: /* IFN */
+    if (!(TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5]))) {
+        goto L181;
+    }
+L180: /* JUMP */
+    goto L193;
+L181: /* VAR */
+L183: /* GGET */
+    tp_aot_op(tp, f, code + 183);
+L188: /* NUMBER */
+    tp_aot_op(tp, f, code + 188);
+L191: /* CALLP */
+    return code + 191;
+L192: /* JUMP */
+    goto L225;
+L193: /* LINE */
+    f->line = code + 193;
+    f->lineno = 344;
+L207: /* GGET */
+    tp_aot_op(tp, f, code + 207);
+L211: /* STRING */
+    tp_aot_op(tp, f, code + 211);
+L214: /* MGET */
+    tp_aot_op(tp, f, code + 214);
+L216: /* STRING */
+    tp_aot_op(tp, f, code + 216);
+L220: /* STRING */
+    tp_aot_op(tp, f, code + 220);
+L224: /* CALLP */
+    return code + 224;
+L225: /* LINE */
+    f->line = code + 225;
+    f->lineno = 345;
+L232: /* GGET */
+    tp_aot_op(tp, f, code + 232);
+L236: /* STRING */
+    tp_aot_op(tp, f, code + 236);
+L239: /* CALLP */
+    return code + 239;
+L240: /* LINE */
+    f->line = code + 240;
+    f->lineno = 346;
+L246: /* GGET */
+    tp_aot_op(tp, f, code + 246);
+L250: /* CALLP */
+    return code + 250;
+L251: /* LINE */
+    f->line = code + 251;
+    f->lineno = 347;
+L268: /* STRING */
+    tp_aot_op(tp, f, code + 268);
+L272: /* METHOD */
+    tp_aot_op(tp, f, code + 272);
+L274: /* GGET */
+    tp_aot_op(tp, f, code + 274);
+L278: /* STRING */
+    tp_aot_op(tp, f, code + 278);
+L281: /* MGET */
+    tp_aot_op(tp, f, code + 281);
+L283: /* STRING */
+    tp_aot_op(tp, f, code + 283);
+L287: /* STRING */
+    tp_aot_op(tp, f, code + 287);
+L291: /* MOVE */
+    regs[13] = regs[4];
+L292: /* MOVE */
+    regs[14] = regs[2];
+L293: /* LIST */
+    tp_aot_op(tp, f, code + 293);
+L294: /* CALLP */
+    return code + 294;
+L295: /* CALLM */
+    return code + 295;
+L296: /* JUMP */
+    tp_aot_safepoint(tp, 204);
+    goto L92;
+L297: /* LINE */
+    f->line = code + 297;
+    f->lineno = 355;
+L302: /* RETURN */
+    return code + 302;
+L303: /* EOF */
+    return code + 303;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_7236(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 31: goto L31;
+        case 33: goto L33;
+        case 36: goto L36;
+        case 38: goto L38;
+        case 47: goto L47;
+        case 52: goto L52;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 55: goto L55;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 65: goto L65;
+        case 66: goto L66;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 356;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 359;
+L31: /* VAR */
+L33: /* STRING */
+    tp_aot_op(tp, f, code + 33);
+L36: /* MGET */
+    tp_aot_op(tp, f, code + 36);
+L38: /* LINE */
+    f->line = code + 38;
+    f->lineno = 360;
+L47: /* GGET */
+    tp_aot_op(tp, f, code + 47);
+L52: /* MOVE */
+    regs[3] = regs[1];
+L53: /* CALLP */
+    return code + 53;
+L54: /* LIST */
+    tp_aot_op(tp, f, code + 54);
+L55: /* STRING */
+    tp_aot_op(tp, f, code + 55);
+L59: /* SET */
+    tp_set(tp, regs[0], regs[1], regs[2]);
+L60: /* LINE */
+    f->line = code + 60;
+    f->lineno = 361;
+L65: /* RETURN */
+    return code + 65;
+L66: /* EOF */
+    return code + 66;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_7326(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 41: goto L41;
+        case 45: goto L45;
+        case 48: goto L48;
+        case 52: goto L52;
+        case 54: goto L54;
+        case 57: goto L57;
+        case 60: goto L60;
+        case 63: goto L63;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 79: goto L79;
+        case 84: goto L84;
+        case 85: goto L85;
+        case 86: goto L86;
+        case 87: goto L87;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 362;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 363;
+L41: /* GGET */
+    tp_aot_op(tp, f, code + 41);
+L45: /* GGET */
+    tp_aot_op(tp, f, code + 45);
+L48: /* STRING */
+    tp_aot_op(tp, f, code + 48);
+L52: /* MGET */
+    tp_aot_op(tp, f, code + 52);
+L54: /* STRING */
+    tp_aot_op(tp, f, code + 54);
+L57: /* STRING */
+    tp_aot_op(tp, f, code + 57);
+L60: /* STRING */
+    tp_aot_op(tp, f, code + 60);
+L63: /* STRING */
+    tp_aot_op(tp, f, code + 63);
+L67: /* CALLP */
+    return code + 67;
+L68: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L70;
+    }
+L69: /* JUMP */
+    goto L71;
+L70: /* RETURN */
+    return code + 70;
+L71: /* LINE */
+    f->line = code + 71;
+    f->lineno = 364;
+L79: /* GGET */
+    tp_aot_op(tp, f, code + 79);
+L84: /* MOVE */
+    regs[2] = regs[0];
+L85: /* CALLP */
+    return code + 85;
+L86: /* RETURN */
+    return code + 86;
+L87: /* EOF */
+    return code + 87;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_7437(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 33: goto L33;
+        case 35: goto L35;
+        case 40: goto L40;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 52: goto L52;
+        case 56: goto L56;
+        case 60: goto L60;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 65: goto L65;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 365;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 366;
+L33: /* VAR */
+L35: /* GGET */
+    tp_aot_op(tp, f, code + 35);
+L40: /* NUMBER */
+    tp_aot_op(tp, f, code + 40);
+L43: /* CALLP */
+    return code + 43;
+L44: /* LINE */
+    f->line = code + 44;
+    f->lineno = 367;
+L52: /* GGET */
+    tp_aot_op(tp, f, code + 52);
+L56: /* STRING */
+    tp_aot_op(tp, f, code + 56);
+L60: /* MGET */
+    tp_aot_op(tp, f, code + 60);
+L62: /* MOVE */
+    regs[4] = regs[1];
+L63: /* CALLP */
+    return code + 63;
+L64: /* RETURN */
+    return code + 64;
+L65: /* EOF */
+    return code + 65;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_7526(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 33: goto L33;
+        case 35: goto L35;
+        case 40: goto L40;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 52: goto L52;
+        case 56: goto L56;
+        case 58: goto L58;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 65: goto L65;
+        case 75: goto L75;
+        case 78: goto L78;
+        case 81: goto L81;
+        case 85: goto L85;
+        case 88: goto L88;
+        case 90: goto L90;
+        case 91: goto L91;
+        case 92: goto L92;
+        case 93: goto L93;
+        case 96: goto L96;
+        case 97: goto L97;
+        case 103: goto L103;
+        case 104: goto L104;
+        case 112: goto L112;
+        case 116: goto L116;
+        case 118: goto L118;
+        case 122: goto L122;
+        case 123: goto L123;
+        case 124: goto L124;
+        case 125: goto L125;
+        case 135: goto L135;
+        case 138: goto L138;
+        case 141: goto L141;
+        case 144: goto L144;
+        case 147: goto L147;
+        case 149: goto L149;
+        case 150: goto L150;
+        case 151: goto L151;
+        case 152: goto L152;
+        case 155: goto L155;
+        case 156: goto L156;
+        case 162: goto L162;
+        case 163: goto L163;
+        case 176: goto L176;
+        case 180: goto L180;
+        case 183: goto L183;
+        case 185: goto L185;
+        case 189: goto L189;
+        case 192: goto L192;
+        case 193: goto L193;
+        case 194: goto L194;
+        case 195: goto L195;
+        case 199: goto L199;
+        case 200: goto L200;
+        case 205: goto L205;
+        case 206: goto L206;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 369;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 370;
+L33: /* VAR */
+L35: /* GGET */
+    tp_aot_op(tp, f, code + 35);
+L40: /* NUMBER */
+    tp_aot_op(tp, f, code + 40);
+L43: /* CALLP */
+    return code + 43;
+L44: /* LINE */
+    f->line = code + 44;
+    f->lineno = 371;
+L52: /* STRING */
+    tp_aot_op(tp, f, code + 52);
+L56: /* MGET */
+    tp_aot_op(tp, f, code + 56);
+L58: /* STRING */
+    tp_aot_op(tp, f, code + 58);
+L62: /* EQ */
+    if (TP_BOTH(regs[3], regs[2], TP_NUMBER_INT)) {
+        regs[3] = tp_bool(regs[3].nint == regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 62);
+    }
+L63: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L65;
+    }
+L64: /* JUMP */
+    goto L104;
+L65: /* LINE */
+    f->line = code + 65;
+    f->lineno = 372;
+L75: /* GGET */
+    tp_aot_op(tp, f, code + 75);
+L78: /* NUMBER */
+    tp_aot_op(tp, f, code + 78);
+L81: /* GGET */
+    tp_aot_op(tp, f, code + 81);
+L85: /* STRING */
+    tp_aot_op(tp, f, code + 85);
+L88: /* MGET */
+    tp_aot_op(tp, f, code + 88);
+L90: /* CALLP */
+    return code + 90;
+L91: /* SUB */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[3] = tp_int(regs[3].nint - regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 91);
+    }
+L92: /* CALLP */
+    return code + 92;
+L93: /* STRING */
+    tp_aot_op(tp, f, code + 93);
+L96: /* SET */
+    tp_set(tp, regs[1], regs[2], regs[3]);
+L97: /* LINE */
+    f->line = code + 97;
+    f->lineno = 373;
+L103: /* RETURN */
+    return code + 103;
+L104: /* LINE */
+    f->line = code + 104;
+    f->lineno = 374;
+L112: /* STRING */
+    tp_aot_op(tp, f, code + 112);
+L116: /* MGET */
+    tp_aot_op(tp, f, code + 116);
+L118: /* STRING */
+    tp_aot_op(tp, f, code + 118);
+L122: /* EQ */
+    if (TP_BOTH(regs[3], regs[2], TP_NUMBER_INT)) {
+        regs[3] = tp_bool(regs[3].nint == regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 122);
+    }
+L123: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L125;
+    }
+L124: /* JUMP */
+    goto L163;
+L125: /* LINE */
+    f->line = code + 125;
+    f->lineno = 375;
+L135: /* GGET */
+    tp_aot_op(tp, f, code + 135);
+L138: /* NUMBER */
+    tp_aot_op(tp, f, code + 138);
+L141: /* GGET */
+    tp_aot_op(tp, f, code + 141);
+L144: /* STRING */
+    tp_aot_op(tp, f, code + 144);
+L147: /* MGET */
+    tp_aot_op(tp, f, code + 147);
+L149: /* CALLP */
+    return code + 149;
+L150: /* SUB */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[3] = tp_int(regs[3].nint - regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 150);
+    }
+L151: /* CALLP */
+    return code + 151;
+L152: /* STRING */
+    tp_aot_op(tp, f, code + 152);
+L155: /* SET */
+    tp_set(tp, regs[1], regs[2], regs[3]);
+L156: /* LINE */
+    f->line = code + 156;
+    f->lineno = 376;
+L162: /* RETURN */
+    return code + 162;
+L163: /* LINE */
+    f->line = code + 163;
+    f->lineno = 377;
+L176: /* GGET */
+    tp_aot_op(tp, f, code + 176);
+L180: /* STRING */
+    tp_aot_op(tp, f, code + 180);
+L183: /* MGET */
+    tp_aot_op(tp, f, code + 183);
+L185: /* STRING */
+    tp_aot_op(tp, f, code + 185);
+L189: /* STRING */
+    tp_aot_op(tp, f, code + 189);
+L192: /* CALLP */
+    return code + 192;
+L193: /* MOVE */
+    regs[3] = regs[1];
+L194: /* LIST */
+    tp_aot_op(tp, f, code + 194);
+L195: /* STRING */
+    tp_aot_op(tp, f, code + 195);
+L199: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[3]);
+L200: /* LINE */
+    f->line = code + 200;
+    f->lineno = 378;
+L205: /* RETURN */
+    return code + 205;
+L206: /* EOF */
+    return code + 206;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_7756(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 33: goto L33;
+        case 35: goto L35;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 49: goto L49;
+        case 53: goto L53;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 63: goto L63;
+        case 66: goto L66;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 75: goto L75;
+        case 76: goto L76;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 379;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 380;
+L33: /* VAR */
+L35: /* GGET */
+    tp_aot_op(tp, f, code + 35);
+L40: /* MOVE */
+    regs[2] = regs[0];
+L41: /* CALLP */
+    return code + 41;
+L42: /* LINE */
+    f->line = code + 42;
+    f->lineno = 381;
+L49: /* STRING */
+    tp_aot_op(tp, f, code + 49);
+L53: /* STRING */
+    tp_aot_op(tp, f, code + 53);
+L57: /* SET */
+    tp_set(tp, regs[0], regs[1], regs[2]);
+L58: /* LINE */
+    f->line = code + 58;
+    f->lineno = 382;
+L63: /* STRING */
+    tp_aot_op(tp, f, code + 63);
+L66: /* STRING */
+    tp_aot_op(tp, f, code + 66);
+L69: /* SET */
+    tp_set(tp, regs[0], regs[1], regs[2]);
+L70: /* LINE */
+    f->line = code + 70;
+    f->lineno = 383;
+L75: /* RETURN */
+    return code + 75;
+L76: /* EOF */
+    return code + 76;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_7856(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 33: goto L33;
+        case 35: goto L35;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 49: goto L49;
+        case 53: goto L53;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 64: goto L64;
+        case 67: goto L67;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 76: goto L76;
+        case 77: goto L77;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 384;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 385;
+L33: /* VAR */
+L35: /* GGET */
+    tp_aot_op(tp, f, code + 35);
+L40: /* MOVE */
+    regs[2] = regs[0];
+L41: /* CALLP */
+    return code + 41;
+L42: /* LINE */
+    f->line = code + 42;
+    f->lineno = 386;
+L49: /* STRING */
+    tp_aot_op(tp, f, code + 49);
+L53: /* STRING */
+    tp_aot_op(tp, f, code + 53);
+L57: /* SET */
+    tp_set(tp, regs[0], regs[1], regs[2]);
+L58: /* LINE */
+    f->line = code + 58;
+    f->lineno = 387;
+L64: /* STRING */
+    tp_aot_op(tp, f, code + 64);
+L67: /* STRING */
+    tp_aot_op(tp, f, code + 67);
+L70: /* SET */
+    tp_set(tp, regs[0], regs[1], regs[2]);
+L71: /* LINE */
+    f->line = code + 71;
+    f->lineno = 388;
+L76: /* RETURN */
+    return code + 76;
+L77: /* EOF */
+    return code + 77;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_9304(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 10: goto L10;
+        case 12: goto L12;
+        case 14: goto L14;
+        case 16: goto L16;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 30: goto L30;
+        case 31: goto L31;
+        case 48: goto L48;
+        case 51: goto L51;
+        case 52: goto L52;
+        case 53: goto L53;
+        case 55: goto L55;
+        case 56: goto L56;
+        case 61: goto L61;
+        case 64: goto L64;
+        case 65: goto L65;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 72: goto L72;
+        case 73: goto L73;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 76: goto L76;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 433;
+L10: /* VAR */
+L12: /* VAR */
+L14: /* VAR */
+L16: /* STRING */
+    tp_aot_op(tp, f, code + 16);
+L25: /* FILE */
+    f->fname = regs[3];
+L26: /* STRING */
+    tp_aot_op(tp, f, code + 26);
+L30: /* NAME */
+    f->name = regs[3];
+L31: /* LINE */
+    f->line = code + 31;
+    f->lineno = 434;
+L48: /* NUMBER */
+    tp_aot_op(tp, f, code + 48);
+L51: /* ITER */
+    if (tp_iter_next(tp, &regs[3], regs[2], &regs[4])) {
+        goto L53;
+    }
+L52: /* JUMP */
+    goto L76;
+L53: /* VAR */
+L55: /* MOVE */
+    regs[5] = regs[3];
+L56: /* GGET */
+    tp_aot_op(tp, f, code + 56);
+L61: /* STRING */
+    tp_aot_op(tp, f, code + 61);
+L64: /* MOVE */
+    regs[7] = regs[0];
+L65: /* STRING */
+    tp_aot_op(tp, f, code + 65);
+L68: /* MOVE */
+    regs[9] = regs[0];
+L69: /* STRING */
+    tp_aot_op(tp, f, code + 69);
+L72: /* MOVE */
+    regs[11] = regs[1];
+L73: /* DICT */
+    tp_aot_op(tp, f, code + 73);
+L74: /* SET */
+    tp_set(tp, regs[3], regs[5], regs[6]);
+L75: /* JUMP */
+    tp_aot_safepoint(tp, 24);
+    goto L51;
+L76: /* EOF */
+    return code + 76;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_9633(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 24: goto L24;
+        case 25: goto L25;
+        case 40: goto L40;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 45: goto L45;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 53: goto L53;
+        case 56: goto L56;
+        case 59: goto L59;
+        case 62: goto L62;
+        case 66: goto L66;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 69: goto L69;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 442;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L24: /* NAME */
+    f->name = regs[1];
+L25: /* LINE */
+    f->line = code + 25;
+    f->lineno = 443;
+L40: /* NUMBER */
+    tp_aot_op(tp, f, code + 40);
+L43: /* ITER */
+    if (tp_iter_next(tp, &regs[1], regs[0], &regs[2])) {
+        goto L45;
+    }
+L44: /* JUMP */
+    goto L69;
+L45: /* VAR */
+L47: /* MOVE */
+    regs[3] = regs[1];
+L48: /* GGET */
+    tp_aot_op(tp, f, code + 48);
+L53: /* STRING */
+    tp_aot_op(tp, f, code + 53);
+L56: /* NUMBER */
+    tp_aot_op(tp, f, code + 56);
+L59: /* STRING */
+    tp_aot_op(tp, f, code + 59);
+L62: /* GGET */
+    tp_aot_op(tp, f, code + 62);
+L66: /* DICT */
+    tp_aot_op(tp, f, code + 66);
+L67: /* SET */
+    tp_set(tp, regs[1], regs[3], regs[4]);
+L68: /* JUMP */
+    tp_aot_safepoint(tp, 25);
+    goto L43;
+L69: /* EOF */
+    return code + 69;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_9862(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 33: goto L33;
+        case 37: goto L37;
+        case 38: goto L38;
+        case 39: goto L39;
+        case 40: goto L40;
+        case 50: goto L50;
+        case 54: goto L54;
+        case 60: goto L60;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 69: goto L69;
+        case 73: goto L73;
+        case 74: goto L74;
+        case 75: goto L75;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 447;
+L7: /* VAR */
+L9: /* VAR */
+L11: /* STRING */
+    tp_aot_op(tp, f, code + 11);
+L20: /* FILE */
+    f->fname = regs[2];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L25: /* NAME */
+    f->name = regs[2];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 448;
+L33: /* GGET */
+    tp_aot_op(tp, f, code + 33);
+L37: /* NOTIN */
+    regs[2] = tp_bool(!tp_true(tp, tp_has(tp, regs[2], regs[1])));
+L38: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L40;
+    }
+L39: /* JUMP */
+    goto L63;
+L40: /* LINE */
+    f->line = code + 40;
+    f->lineno = 449;
+L50: /* GGET */
+    tp_aot_op(tp, f, code + 50);
+L54: /* STRING */
+    tp_aot_op(tp, f, code + 54);
+L60: /* MOD */
+    regs[3] = tp_mod(tp, regs[3], regs[1]);
+L61: /* MOVE */
+    regs[4] = regs[0];
+L62: /* CALLP */
+    return code + 62;
+L63: /* LINE */
+    f->line = code + 63;
+    f->lineno = 450;
+L69: /* GGET */
+    tp_aot_op(tp, f, code + 69);
+L73: /* GET */
+    regs[2] = tp_get(tp, regs[2], regs[1]);
+    tp_grey(tp, regs[2]);
+L74: /* RETURN */
+    return code + 74;
+L75: /* EOF */
+    return code + 75;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_9958(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 6: goto L6;
+        case 8: goto L8;
+        case 17: goto L17;
+        case 18: goto L18;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 35: goto L35;
+        case 39: goto L39;
+        case 41: goto L41;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 50: goto L50;
+        case 54: goto L54;
+        case 55: goto L55;
+        case 58: goto L58;
+        case 60: goto L60;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 71: goto L71;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 80: goto L80;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 88: goto L88;
+        case 92: goto L92;
+        case 93: goto L93;
+        case 94: goto L94;
+        case 95: goto L95;
+        case 100: goto L100;
+        case 101: goto L101;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 452;
+L6: /* VAR */
+L8: /* STRING */
+    tp_aot_op(tp, f, code + 8);
+L17: /* FILE */
+    f->fname = regs[1];
+L18: /* STRING */
+    tp_aot_op(tp, f, code + 18);
+L21: /* NAME */
+    f->name = regs[1];
+L22: /* LINE */
+    f->line = code + 22;
+    f->lineno = 453;
+L35: /* STRING */
+    tp_aot_op(tp, f, code + 35);
+L39: /* MGET */
+    tp_aot_op(tp, f, code + 39);
+L41: /* STRING */
+    tp_aot_op(tp, f, code + 41);
+L45: /* EQ */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[1].nint == regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 45);
+    }
+L46: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L48;
+    }
+L47: /* JUMP */
+    goto L62;
+L48: /* VAR */
+L50: /* GGET */
+    tp_aot_op(tp, f, code + 50);
+L54: /* MOVE */
+    regs[3] = regs[0];
+L55: /* STRING */
+    tp_aot_op(tp, f, code + 55);
+L58: /* MGET */
+    tp_aot_op(tp, f, code + 58);
+L60: /* CALLP */
+    return code + 60;
+L61: /* JUMP */
+    goto L83;
+L62: /* LINE */
+    f->line = code + 62;
+    f->lineno = 454;
+L71: /* GGET */
+    tp_aot_op(tp, f, code + 71);
+L75: /* MOVE */
+    regs[3] = regs[0];
+L76: /* STRING */
+    tp_aot_op(tp, f, code + 76);
+L80: /* MGET */
+    tp_aot_op(tp, f, code + 80);
+L82: /* CALLP */
+    return code + 82;
+L83: /* LINE */
+    f->line = code + 83;
+    f->lineno = 455;
+L88: /* GGET */
+    tp_aot_op(tp, f, code + 88);
+L92: /* MOVE */
+    regs[3] = regs[0];
+L93: /* MOVE */
+    regs[4] = regs[1];
+L94: /* CALLP */
+    return code + 94;
+L95: /* LINE */
+    f->line = code + 95;
+    f->lineno = 456;
+L100: /* RETURN */
+    return code + 100;
+L101: /* EOF */
+    return code + 101;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_10078(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 34: goto L34;
+        case 36: goto L36;
+        case 39: goto L39;
+        case 43: goto L43;
+        case 45: goto L45;
+        case 50: goto L50;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 60: goto L60;
+        case 64: goto L64;
+        case 65: goto L65;
+        case 66: goto L66;
+        case 72: goto L72;
+        case 76: goto L76;
+        case 79: goto L79;
+        case 80: goto L80;
+        case 87: goto L87;
+        case 90: goto L90;
+        case 91: goto L91;
+        case 92: goto L92;
+        case 95: goto L95;
+        case 96: goto L96;
+        case 97: goto L97;
+        case 98: goto L98;
+        case 113: goto L113;
+        case 117: goto L117;
+        case 120: goto L120;
+        case 122: goto L122;
+        case 127: goto L127;
+        case 130: goto L130;
+        case 131: goto L131;
+        case 132: goto L132;
+        case 133: goto L133;
+        case 140: goto L140;
+        case 143: goto L143;
+        case 145: goto L145;
+        case 146: goto L146;
+        case 147: goto L147;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 457;
+L8: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[0];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L27: /* NAME */
+    f->name = regs[0];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 458;
+L34: /* VAR */
+L36: /* GGET */
+    tp_aot_op(tp, f, code + 36);
+L39: /* STRING */
+    tp_aot_op(tp, f, code + 39);
+L43: /* MGET */
+    tp_aot_op(tp, f, code + 43);
+L45: /* LINE */
+    f->line = code + 45;
+    f->lineno = 459;
+L50: /* VAR */
+L53: /* LIST */
+    tp_aot_op(tp, f, code + 53);
+L54: /* LINE */
+    f->line = code + 54;
+    f->lineno = 460;
+L60: /* GGET */
+    tp_aot_op(tp, f, code + 60);
+L64: /* MOVE */
+    regs[4] = regs[1];
+L65: /* CALLP */
+    return code + 65;
+L66: /* LINE */
+    f->line = code + 66;
+    f->lineno = 461;
+L72: /* GGET */
+    tp_aot_op(tp, f, code + 72);
+L76: /* STRING */
+    tp_aot_op(tp, f, code + 76);
+L79: /* CALLP */
+    return code + 79;
+L80: /* LINE */
+    f->line = code + 80;
+    f->lineno = 462;
+L87: /* GGET */
+    tp_aot_op(tp, f, code + 87);
+L90: /* MOVE */
+    regs[4] = regs[1];
+L91: /* CALLP */
+    return code + 91;
+L92: /* NUMBER */
+    tp_aot_op(tp, f, code + 92);
+L95: /* GT */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint > regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 95);
+    }
+L96: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L98;
+    }
+L97: /* JUMP */
+    goto L133;
+L98: /* LINE */
+    f->line = code + 98;
+    f->lineno = 463;
+L113: /* GGET */
+    tp_aot_op(tp, f, code + 113);
+L117: /* STRING */
+    tp_aot_op(tp, f, code + 117);
+L120: /* MGET */
+    tp_aot_op(tp, f, code + 120);
+L122: /* STRING */
+    tp_aot_op(tp, f, code + 122);
+L127: /* STRING */
+    tp_aot_op(tp, f, code + 127);
+L130: /* MOVE */
+    regs[7] = regs[1];
+L131: /* CALLP */
+    return code + 131;
+L132: /* RETURN */
+    return code + 132;
+L133: /* LINE */
+    f->line = code + 133;
+    f->lineno = 464;
+L140: /* STRING */
+    tp_aot_op(tp, f, code + 140);
+L143: /* METHOD */
+    tp_aot_op(tp, f, code + 143);
+L145: /* CALLM */
+    return code + 145;
+L146: /* RETURN */
+    return code + 146;
+L147: /* EOF */
+    return code + 147;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_10262(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 10: goto L10;
+        case 12: goto L12;
+        case 15: goto L15;
+        case 24: goto L24;
+        case 25: goto L25;
+        case 29: goto L29;
+        case 30: goto L30;
+        case 35: goto L35;
+        case 43: goto L43;
+        case 48: goto L48;
+        case 52: goto L52;
+        case 54: goto L54;
+        case 55: goto L55;
+        case 56: goto L56;
+        case 65: goto L65;
+        case 68: goto L68;
+        case 72: goto L72;
+        case 73: goto L73;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 79: goto L79;
+        case 83: goto L83;
+        case 85: goto L85;
+        case 86: goto L86;
+        case 92: goto L92;
+        case 94: goto L94;
+        case 99: goto L99;
+        case 100: goto L100;
+        case 105: goto L105;
+        case 108: goto L108;
+        case 109: goto L109;
+        case 110: goto L110;
+        case 115: goto L115;
+        case 116: goto L116;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 466;
+L10: /* VAR */
+L12: /* VAR */
+L15: /* STRING */
+    tp_aot_op(tp, f, code + 15);
+L24: /* FILE */
+    f->fname = regs[2];
+L25: /* STRING */
+    tp_aot_op(tp, f, code + 25);
+L29: /* NAME */
+    f->name = regs[2];
+L30: /* LINE */
+    f->line = code + 30;
+    f->lineno = 467;
+L35: /* LINE */
+    f->line = code + 35;
+    f->lineno = 468;
+L43: /* GGET */
+    tp_aot_op(tp, f, code + 43);
+L48: /* STRING */
+    tp_aot_op(tp, f, code + 48);
+L52: /* METHOD */
+    tp_aot_op(tp, f, code + 52);
+L54: /* MOVE */
+    regs[5] = regs[0];
+L55: /* CALLM */
+    return code + 55;
+L56: /* LINE */
+    f->line = code + 56;
+    f->lineno = 469;
+L65: /* STRING */
+    tp_aot_op(tp, f, code + 65);
+L68: /* GGET */
+    tp_aot_op(tp, f, code + 68);
+L72: /* MOVE */
+    regs[5] = regs[0];
+L73: /* MOVE */
+    regs[6] = regs[1];
+L74: /* CALLP */
+    return code + 74;
+L75: /* GSET */
+    tp_set(tp, f->globals, regs[2], regs[3]);
+L76: /* GGET */
+    tp_aot_op(tp, f, code + 76);
+L79: /* STRING */
+    tp_aot_op(tp, f, code + 79);
+L83: /* METHOD */
+    tp_aot_op(tp, f, code + 83);
+L85: /* CALLM */
+    return code + 85;
+L86: /* LINE */
+    f->line = code + 86;
+    f->lineno = 470;
+L92: /* VAR */
+L94: /* GGET */
+    tp_aot_op(tp, f, code + 94);
+L99: /* CALLP */
+    return code + 99;
+L100: /* LINE */
+    f->line = code + 100;
+    f->lineno = 471;
+L105: /* STRING */
+    tp_aot_op(tp, f, code + 105);
+L108: /* NONE */
+    regs[4] = tp_None;
+L109: /* GSET */
+    tp_set(tp, f->globals, regs[3], regs[4]);
+L110: /* LINE */
+    f->line = code + 110;
+    f->lineno = 472;
+L115: /* RETURN */
+    return code + 115;
+L116: /* EOF */
+    return code + 116;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_636(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 12: goto L12;
+        case 15: goto L15;
+        case 17: goto L17;
+        case 20: goto L20;
+        case 29: goto L29;
+        case 30: goto L30;
+        case 35: goto L35;
+        case 36: goto L36;
+        case 42: goto L42;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 55: goto L55;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 67: goto L67;
+        case 70: goto L70;
+        case 73: goto L73;
+        case 74: goto L74;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 87: goto L87;
+        case 88: goto L88;
+        case 95: goto L95;
+        case 96: goto L96;
+        case 100: goto L100;
+        case 101: goto L101;
+        case 109: goto L109;
+        case 112: goto L112;
+        case 117: goto L117;
+        case 118: goto L118;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 25;
+L12: /* VAR */
+L15: /* VAR */
+L17: /* VAR */
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L29: /* FILE */
+    f->fname = regs[3];
+L30: /* STRING */
+    tp_aot_op(tp, f, code + 30);
+L35: /* NAME */
+    f->name = regs[3];
+L36: /* LINE */
+    f->line = code + 36;
+    f->lineno = 26;
+L42: /* STRING */
+    tp_aot_op(tp, f, code + 42);
+L45: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[1]);
+L46: /* LINE */
+    f->line = code + 46;
+    f->lineno = 27;
+L55: /* STRING */
+    tp_aot_op(tp, f, code + 55);
+L59: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[2]);
+L60: /* LINE */
+    f->line = code + 60;
+    f->lineno = 28;
+L67: /* NUMBER */
+    tp_aot_op(tp, f, code + 67);
+L70: /* STRING */
+    tp_aot_op(tp, f, code + 70);
+L73: /* SET */
+    tp_set(tp, regs[0], regs[1], regs[3]);
+L74: /* LINE */
+    f->line = code + 74;
+    f->lineno = 29;
+L82: /* NONE */
+    regs[3] = tp_None;
+L83: /* STRING */
+    tp_aot_op(tp, f, code + 83);
+L87: /* SET */
+    tp_set(tp, regs[0], regs[1], regs[3]);
+L88: /* LINE */
+    f->line = code + 88;
+    f->lineno = 30;
+L95: /* LIST */
+    tp_aot_op(tp, f, code + 95);
+L96: /* STRING */
+    tp_aot_op(tp, f, code + 96);
+L100: /* SET */
+    tp_set(tp, regs[0], regs[1], regs[3]);
+L101: /* LINE */
+    f->line = code + 101;
+    f->lineno = 31;
+L109: /* NUMBER */
+    tp_aot_op(tp, f, code + 109);
+L112: /* STRING */
+    tp_aot_op(tp, f, code + 112);
+L117: /* SET */
+    tp_set(tp, regs[0], regs[1], regs[3]);
+L118: /* EOF */
+    return code + 118;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_777(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 11: goto L11;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 34: goto L34;
+        case 43: goto L43;
+        case 47: goto L47;
+        case 50: goto L50;
+        case 55: goto L55;
+        case 56: goto L56;
+        case 57: goto L57;
+        case 66: goto L66;
+        case 70: goto L70;
+        case 73: goto L73;
+        case 78: goto L78;
+        case 79: goto L79;
+        case 80: goto L80;
+        case 87: goto L87;
+        case 91: goto L91;
+        case 93: goto L93;
+        case 94: goto L94;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 32;
+L8: /* VAR */
+L11: /* STRING */
+    tp_aot_op(tp, f, code + 11);
+L20: /* FILE */
+    f->fname = regs[1];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 33;
+L34: /* LINE */
+    f->line = code + 34;
+    f->lineno = 34;
+L43: /* STRING */
+    tp_aot_op(tp, f, code + 43);
+L47: /* GGET */
+    tp_aot_op(tp, f, code + 47);
+L50: /* GGET */
+    tp_aot_op(tp, f, code + 50);
+L55: /* CALLP */
+    return code + 55;
+L56: /* GSET */
+    tp_set(tp, f->globals, regs[1], regs[2]);
+L57: /* LINE */
+    f->line = code + 57;
+    f->lineno = 35;
+L66: /* STRING */
+    tp_aot_op(tp, f, code + 66);
+L70: /* GGET */
+    tp_aot_op(tp, f, code + 70);
+L73: /* GGET */
+    tp_aot_op(tp, f, code + 73);
+L78: /* CALLP */
+    return code + 78;
+L79: /* GSET */
+    tp_set(tp, f->globals, regs[1], regs[2]);
+L80: /* LINE */
+    f->line = code + 80;
+    f->lineno = 36;
+L87: /* STRING */
+    tp_aot_op(tp, f, code + 87);
+L91: /* METHOD */
+    tp_aot_op(tp, f, code + 91);
+L93: /* CALLM */
+    return code + 93;
+L94: /* EOF */
+    return code + 94;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_901(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 11: goto L11;
+        case 14: goto L14;
+        case 16: goto L16;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 30: goto L30;
+        case 31: goto L31;
+        case 42: goto L42;
+        case 46: goto L46;
+        case 50: goto L50;
+        case 52: goto L52;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 55: goto L55;
+        case 56: goto L56;
+        case 69: goto L69;
+        case 73: goto L73;
+        case 78: goto L78;
+        case 79: goto L79;
+        case 83: goto L83;
+        case 85: goto L85;
+        case 86: goto L86;
+        case 97: goto L97;
+        case 100: goto L100;
+        case 102: goto L102;
+        case 105: goto L105;
+        case 109: goto L109;
+        case 111: goto L111;
+        case 112: goto L112;
+        case 113: goto L113;
+        case 114: goto L114;
+        case 115: goto L115;
+        case 126: goto L126;
+        case 128: goto L128;
+        case 132: goto L132;
+        case 134: goto L134;
+        case 137: goto L137;
+        case 139: goto L139;
+        case 140: goto L140;
+        case 148: goto L148;
+        case 151: goto L151;
+        case 153: goto L153;
+        case 156: goto L156;
+        case 157: goto L157;
+        case 160: goto L160;
+        case 161: goto L161;
+        case 162: goto L162;
+        case 174: goto L174;
+        case 178: goto L178;
+        case 181: goto L181;
+        case 184: goto L184;
+        case 185: goto L185;
+        case 188: goto L188;
+        case 191: goto L191;
+        case 192: goto L192;
+        case 200: goto L200;
+        case 203: goto L203;
+        case 204: goto L204;
+        case 205: goto L205;
+        case 209: goto L209;
+        case 210: goto L210;
+        case 218: goto L218;
+        case 223: goto L223;
+        case 225: goto L225;
+        case 228: goto L228;
+        case 229: goto L229;
+        case 234: goto L234;
+        case 235: goto L235;
+        case 250: goto L250;
+        case 254: goto L254;
+        case 258: goto L258;
+        case 260: goto L260;
+        case 263: goto L263;
+        case 266: goto L266;
+        case 269: goto L269;
+        case 273: goto L273;
+        case 274: goto L274;
+        case 275: goto L275;
+        case 276: goto L276;
+        case 285: goto L285;
+        case 288: goto L288;
+        case 293: goto L293;
+        case 294: goto L294;
+        case 300: goto L300;
+        case 301: goto L301;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 37;
+L11: /* VAR */
+L14: /* VAR */
+L16: /* STRING */
+    tp_aot_op(tp, f, code + 16);
+L25: /* FILE */
+    f->fname = regs[2];
+L26: /* STRING */
+    tp_aot_op(tp, f, code + 26);
+L30: /* NAME */
+    f->name = regs[2];
+L31: /* LINE */
+    f->line = code + 31;
+    f->lineno = 38;
+L42: /* GGET */
+    tp_aot_op(tp, f, code + 42);
+L46: /* STRING */
+    tp_aot_op(tp, f, code + 46);
+L50: /* MGET */
+    tp_aot_op(tp, f, code + 50);
+L52: /* MOVE */
+    regs[6] = regs[1];
+L53: /* CALLP */
+    return code + 53;
+L54: /* IFN */
+    if (!(TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3]))) {
+        goto L56;
+    }
+L55: /* JUMP */
+    goto L86;
+L56: /* LINE */
+    f->line = code + 56;
+    f->lineno = 39;
+L69: /* GGET */
+    tp_aot_op(tp, f, code + 69);
+L73: /* STRING */
+    tp_aot_op(tp, f, code + 73);
+L78: /* ADD */
+    if (TP_BOTH(regs[4], regs[1], TP_NUMBER_INT)) {
+        regs[4] = tp_int(regs[4].nint + regs[1].nint);
+    } else {
+        tp_aot_op(tp, f, code + 78);
+    }
+L79: /* STRING */
+    tp_aot_op(tp, f, code + 79);
+L83: /* MGET */
+    tp_aot_op(tp, f, code + 83);
+L85: /* CALLP */
+    return code + 85;
+L86: /* LINE */
+    f->line = code + 86;
+    f->lineno = 40;
+L97: /* STRING */
+    tp_aot_op(tp, f, code + 97);
+L100: /* MGET */
+    tp_aot_op(tp, f, code + 100);
+L102: /* GGET */
+    tp_aot_op(tp, f, code + 102);
+L105: /* STRING */
+    tp_aot_op(tp, f, code + 105);
+L109: /* MGET */
+    tp_aot_op(tp, f, code + 109);
+L111: /* CALLP */
+    return code + 111;
+L112: /* LT */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint < regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 112);
+    }
+L113: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L115;
+    }
+L114: /* JUMP */
+    goto L162;
+L115: /* LINE */
+    f->line = code + 115;
+    f->lineno = 41;
+L126: /* VAR */
+L128: /* STRING */
+    tp_aot_op(tp, f, code + 128);
+L132: /* MGET */
+    tp_aot_op(tp, f, code + 132);
+L134: /* STRING */
+    tp_aot_op(tp, f, code + 134);
+L137: /* MGET */
+    tp_aot_op(tp, f, code + 137);
+L139: /* GET */
+    regs[2] = tp_get(tp, regs[3], regs[4]);
+    tp_grey(tp, regs[2]);
+L140: /* LINE */
+    f->line = code + 140;
+    f->lineno = 42;
+L148: /* STRING */
+    tp_aot_op(tp, f, code + 148);
+L151: /* MGET */
+    tp_aot_op(tp, f, code + 151);
+L153: /* NUMBER */
+    tp_aot_op(tp, f, code + 153);
+L156: /* ADD */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[3] = tp_int(regs[3].nint + regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 156);
+    }
+L157: /* STRING */
+    tp_aot_op(tp, f, code + 157);
+L160: /* SET */
+    tp_set(tp, regs[0], regs[4], regs[3]);
+L161: /* JUMP */
+    goto L192;
+L162: /* LINE */
+    f->line = code + 162;
+    f->lineno = 44;
+L174: /* GGET */
+    tp_aot_op(tp, f, code + 174);
+L178: /* NUMBER */
+    tp_aot_op(tp, f, code + 178);
+L181: /* NUMBER */
+    tp_aot_op(tp, f, code + 181);
+L184: /* LIST */
+    tp_aot_op(tp, f, code + 184);
+L185: /* STRING */
+    tp_aot_op(tp, f, code + 185);
+L188: /* STRING */
+    tp_aot_op(tp, f, code + 188);
+L191: /* CALLP */
+    return code + 191;
+L192: /* LINE */
+    f->line = code + 192;
+    f->lineno = 45;
+L200: /* GGET */
+    tp_aot_op(tp, f, code + 200);
+L203: /* MOVE */
+    regs[5] = regs[2];
+L204: /* CALLP */
+    return code + 204;
+L205: /* STRING */
+    tp_aot_op(tp, f, code + 205);
+L209: /* SET */
+    tp_set(tp, regs[0], regs[4], regs[3]);
+L210: /* LINE */
+    f->line = code + 210;
+    f->lineno = 47;
+L218: /* STRING */
+    tp_aot_op(tp, f, code + 218);
+L223: /* MGET */
+    tp_aot_op(tp, f, code + 223);
+L225: /* NUMBER */
+    tp_aot_op(tp, f, code + 225);
+L228: /* ADD */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[3] = tp_int(regs[3].nint + regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 228);
+    }
+L229: /* STRING */
+    tp_aot_op(tp, f, code + 229);
+L234: /* SET */
+    tp_set(tp, regs[0], regs[4], regs[3]);
+L235: /* LINE */
+    f->line = code + 235;
+    f->lineno = 48;
+L250: /* GGET */
+    tp_aot_op(tp, f, code + 250);
+L254: /* STRING */
+    tp_aot_op(tp, f, code + 254);
+L258: /* MGET */
+    tp_aot_op(tp, f, code + 258);
+L260: /* STRING */
+    tp_aot_op(tp, f, code + 260);
+L263: /* STRING */
+    tp_aot_op(tp, f, code + 263);
+L266: /* STRING */
+    tp_aot_op(tp, f, code + 266);
+L269: /* STRING */
+    tp_aot_op(tp, f, code + 269);
+L273: /* CALLP */
+    return code + 273;
+L274: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L276;
+    }
+L275: /* JUMP */
+    goto L294;
+L276: /* LINE */
+    f->line = code + 276;
+    f->lineno = 49;
+L285: /* NUMBER */
+    tp_aot_op(tp, f, code + 285);
+L288: /* STRING */
+    tp_aot_op(tp, f, code + 288);
+L293: /* SET */
+    tp_set(tp, regs[0], regs[4], regs[3]);
+L294: /* LINE */
+    f->line = code + 294;
+    f->lineno = 50;
+L300: /* RETURN */
+    return code + 300;
+L301: /* EOF */
+    return code + 301;
+}
+
+static tpd_code * _tp_tinypy_compiler_parse_1226(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 37: goto L37;
+        case 42: goto L42;
+        case 44: goto L44;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 64: goto L64;
+        case 68: goto L68;
+        case 75: goto L75;
+        case 79: goto L79;
+        case 81: goto L81;
+        case 82: goto L82;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 52;
+L9: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[1];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L27: /* NAME */
+    f->name = regs[1];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 53;
+L37: /* STRING */
+    tp_aot_op(tp, f, code + 37);
+L42: /* MGET */
+    tp_aot_op(tp, f, code + 42);
+L44: /* NUMBER */
+    tp_aot_op(tp, f, code + 44);
+L47: /* GT */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[1].nint > regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 47);
+    }
+L48: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L50;
+    }
+L49: /* JUMP */
+    goto L82;
+L50: /* LINE */
+    f->line = code + 50;
+    f->lineno = 54;
+L64: /* GGET */
+    tp_aot_op(tp, f, code + 64);
+L68: /* STRING */
+    tp_aot_op(tp, f, code + 68);
+L75: /* STRING */
+    tp_aot_op(tp, f, code + 75);
+L79: /* MGET */
+    tp_aot_op(tp, f, code + 79);
+L81: /* CALLP */
+    return code + 81;
+L82: /* EOF */
+    return code + 82;
+}
+
+static const tpd_aot _tp_tinypy_compiler_parse_aot[] = {
+    {0, _tp_tinypy_compiler_parse_0},
+    {140, _tp_tinypy_compiler_parse_140},
+    {287, _tp_tinypy_compiler_parse_287},
+    {416, _tp_tinypy_compiler_parse_416},
+    {509, _tp_tinypy_compiler_parse_509},
+    {601, _tp_tinypy_compiler_parse_601},
+    {1367, _tp_tinypy_compiler_parse_1367},
+    {1451, _tp_tinypy_compiler_parse_1451},
+    {1513, _tp_tinypy_compiler_parse_1513},
+    {1578, _tp_tinypy_compiler_parse_1578},
+    {1637, _tp_tinypy_compiler_parse_1637},
+    {1708, _tp_tinypy_compiler_parse_1708},
+    {1894, _tp_tinypy_compiler_parse_1894},
+    {1987, _tp_tinypy_compiler_parse_1987},
+    {2139, _tp_tinypy_compiler_parse_2139},
+    {2262, _tp_tinypy_compiler_parse_2262},
+    {2421, _tp_tinypy_compiler_parse_2421},
+    {2538, _tp_tinypy_compiler_parse_2538},
+    {2622, _tp_tinypy_compiler_parse_2622},
+    {2865, _tp_tinypy_compiler_parse_2865},
+    {3324, _tp_tinypy_compiler_parse_3324},
+    {3442, _tp_tinypy_compiler_parse_3442},
+    {3495, _tp_tinypy_compiler_parse_3495},
+    {3610, _tp_tinypy_compiler_parse_3610},
+    {4078, _tp_tinypy_compiler_parse_4078},
+    {4320, _tp_tinypy_compiler_parse_4320},
+    {4389, _tp_tinypy_compiler_parse_4389},
+    {4607, _tp_tinypy_compiler_parse_4607},
+    {5019, _tp_tinypy_compiler_parse_5019},
+    {5360, _tp_tinypy_compiler_parse_5360},
+    {5493, _tp_tinypy_compiler_parse_5493},
+    {5641, _tp_tinypy_compiler_parse_5641},
+    {5946, _tp_tinypy_compiler_parse_5946},
+    {6278, _tp_tinypy_compiler_parse_6278},
+    {6473, _tp_tinypy_compiler_parse_6473},
+    {6910, _tp_tinypy_compiler_parse_6910},
+    {7236, _tp_tinypy_compiler_parse_7236},
+    {7326, _tp_tinypy_compiler_parse_7326},
+    {7437, _tp_tinypy_compiler_parse_7437},
+    {7526, _tp_tinypy_compiler_parse_7526},
+    {7756, _tp_tinypy_compiler_parse_7756},
+    {7856, _tp_tinypy_compiler_parse_7856},
+    {9304, _tp_tinypy_compiler_parse_9304},
+    {9633, _tp_tinypy_compiler_parse_9633},
+    {9862, _tp_tinypy_compiler_parse_9862},
+    {9958, _tp_tinypy_compiler_parse_9958},
+    {10078, _tp_tinypy_compiler_parse_10078},
+    {10262, _tp_tinypy_compiler_parse_10262},
+    {636, _tp_tinypy_compiler_parse_636},
+    {777, _tp_tinypy_compiler_parse_777},
+    {901, _tp_tinypy_compiler_parse_901},
+    {1226, _tp_tinypy_compiler_parse_1226},
+};
+
+void tinypy_compiler_parse_init(TP) {
+    tp_aot_import(tp, "tinypy.compiler.parse", _tp_tinypy_compiler_parse_tpc, sizeof(_tp_tinypy_compiler_parse_tpc),
+        _tp_tinypy_compiler_parse_aot, 52);
+}
@@ -0,0 +1,9041 @@
+/* Generated from tinypy/compiler/peephole.py with tpc -a. Do not modify. */
+#include <tinypy/tp.h>
+
+static unsigned char _tp_tinypy_compiler_peephole_tpc[] = {
+0x2d,0x18,0x00,0x58,0x00,0x00,0x00,0x00,0x1f,0x09,0x00,0x01,0x66,0x72,0x6f,0x6d,
+0x20,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,
+0x2e,0x62,0x6f,0x6f,0x74,0x20,0x69,0x6d,0x70,0x6f,0x72,0x74,0x20,0x2a,0x00,0x00,
+0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,
+0x2e,0x70,0x79,0x00,0x22,0x00,0x00,0x00,0x0d,0x00,0x00,0x01,0x00,0x00,0x00,0x01,
+0x3f,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x0a,
+0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,0x5f,0x5f,0x00,0x00,0x0d,0x02,0x00,0x03,
+0x00,0x00,0x00,0x14,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2e,0x62,0x6f,0x6f,0x74,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x04,
+0x00,0x00,0x00,0x01,0x2a,0x00,0x00,0x00,0x37,0x00,0x01,0x03,0x0e,0x01,0x00,0x05,
+0x00,0x00,0x00,0x08,0x5f,0x5f,0x64,0x69,0x63,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,
+0x32,0x01,0x00,0x00,0x1f,0x0a,0x00,0x02,0x66,0x72,0x6f,0x6d,0x20,0x74,0x69,0x6e,
+0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2e,0x6f,0x70,0x63,
+0x6f,0x64,0x65,0x73,0x20,0x69,0x6d,0x70,0x6f,0x72,0x74,0x20,0x2a,0x00,0x00,0x00,
+0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x0a,0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,
+0x5f,0x5f,0x00,0x00,0x0d,0x02,0x00,0x06,0x00,0x00,0x00,0x17,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2e,0x6f,0x70,0x63,0x6f,
+0x64,0x65,0x73,0x00,0x0d,0x03,0x00,0x04,0x00,0x00,0x00,0x01,0x2a,0x00,0x00,0x00,
+0x37,0x00,0x01,0x03,0x0e,0x01,0x00,0x05,0x00,0x00,0x00,0x08,0x5f,0x5f,0x64,0x69,
+0x63,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,0x32,0x01,0x00,0x00,0x1f,0x08,0x00,0x11,
+0x53,0x4b,0x49,0x50,0x53,0x20,0x3d,0x20,0x5b,0x49,0x46,0x2c,0x20,0x49,0x46,0x4e,
+0x2c,0x20,0x49,0x54,0x45,0x52,0x2c,0x20,0x46,0x4f,0x52,0x5d,0x00,0x00,0x00,0x00,
+0x0d,0x00,0x00,0x07,0x00,0x00,0x00,0x05,0x53,0x4b,0x49,0x50,0x53,0x00,0x00,0x00,
+0x0e,0x02,0x00,0x08,0x00,0x00,0x00,0x02,0x49,0x46,0x00,0x00,0x0e,0x03,0x00,0x09,
+0x00,0x00,0x00,0x03,0x49,0x46,0x4e,0x00,0x0e,0x04,0x00,0x0a,0x00,0x00,0x00,0x04,
+0x49,0x54,0x45,0x52,0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x0b,0x00,0x00,0x00,0x03,
+0x46,0x4f,0x52,0x00,0x1c,0x01,0x02,0x04,0x0f,0x00,0x01,0x00,0x1f,0x0c,0x00,0x13,
+0x4f,0x50,0x45,0x52,0x41,0x4e,0x44,0x53,0x20,0x3d,0x20,0x5b,0x53,0x54,0x52,0x49,
+0x4e,0x47,0x2c,0x20,0x47,0x47,0x45,0x54,0x2c,0x20,0x4e,0x55,0x4d,0x42,0x45,0x52,
+0x2c,0x20,0x4d,0x47,0x45,0x54,0x2c,0x20,0x4d,0x45,0x54,0x48,0x4f,0x44,0x5d,0x00,
+0x0d,0x00,0x00,0x0c,0x00,0x00,0x00,0x08,0x4f,0x50,0x45,0x52,0x41,0x4e,0x44,0x53,
+0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x0d,0x00,0x00,0x00,0x06,0x53,0x54,0x52,0x49,
+0x4e,0x47,0x00,0x00,0x0e,0x03,0x00,0x0e,0x00,0x00,0x00,0x04,0x47,0x47,0x45,0x54,
+0x00,0x00,0x00,0x00,0x0e,0x04,0x00,0x0f,0x00,0x00,0x00,0x06,0x4e,0x55,0x4d,0x42,
+0x45,0x52,0x00,0x00,0x0e,0x05,0x00,0x10,0x00,0x00,0x00,0x04,0x4d,0x47,0x45,0x54,
+0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x11,0x00,0x00,0x00,0x06,0x4d,0x45,0x54,0x48,
+0x4f,0x44,0x00,0x00,0x1c,0x01,0x02,0x05,0x0f,0x00,0x01,0x00,0x1f,0x13,0x00,0x14,
+0x42,0x49,0x4e,0x41,0x52,0x59,0x20,0x3d,0x20,0x5b,0x41,0x44,0x44,0x2c,0x20,0x53,
+0x55,0x42,0x2c,0x20,0x4d,0x55,0x4c,0x2c,0x20,0x44,0x49,0x56,0x2c,0x20,0x50,0x4f,
+0x57,0x2c,0x20,0x4d,0x4f,0x44,0x2c,0x20,0x4c,0x53,0x48,0x2c,0x20,0x52,0x53,0x48,
+0x2c,0x20,0x42,0x49,0x54,0x41,0x4e,0x44,0x2c,0x20,0x42,0x49,0x54,0x4f,0x52,0x2c,
+0x20,0x42,0x49,0x54,0x58,0x4f,0x52,0x2c,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x12,
+0x00,0x00,0x00,0x06,0x42,0x49,0x4e,0x41,0x52,0x59,0x00,0x00,0x0e,0x02,0x00,0x13,
+0x00,0x00,0x00,0x03,0x41,0x44,0x44,0x00,0x0e,0x03,0x00,0x14,0x00,0x00,0x00,0x03,
+0x53,0x55,0x42,0x00,0x0e,0x04,0x00,0x15,0x00,0x00,0x00,0x03,0x4d,0x55,0x4c,0x00,
+0x0e,0x05,0x00,0x16,0x00,0x00,0x00,0x03,0x44,0x49,0x56,0x00,0x0e,0x06,0x00,0x17,
+0x00,0x00,0x00,0x03,0x50,0x4f,0x57,0x00,0x0e,0x07,0x00,0x18,0x00,0x00,0x00,0x03,
+0x4d,0x4f,0x44,0x00,0x0e,0x08,0x00,0x19,0x00,0x00,0x00,0x03,0x4c,0x53,0x48,0x00,
+0x0e,0x09,0x00,0x1a,0x00,0x00,0x00,0x03,0x52,0x53,0x48,0x00,0x0e,0x0a,0x00,0x1b,
+0x00,0x00,0x00,0x06,0x42,0x49,0x54,0x41,0x4e,0x44,0x00,0x00,0x0e,0x0b,0x00,0x1c,
+0x00,0x00,0x00,0x05,0x42,0x49,0x54,0x4f,0x52,0x00,0x00,0x00,0x0e,0x0c,0x00,0x1d,
+0x00,0x00,0x00,0x06,0x42,0x49,0x54,0x58,0x4f,0x52,0x00,0x00,0x1f,0x0d,0x00,0x15,
+0x20,0x20,0x20,0x20,0x45,0x51,0x2c,0x20,0x4e,0x45,0x2c,0x20,0x4c,0x45,0x2c,0x20,
+0x4c,0x54,0x2c,0x20,0x47,0x45,0x2c,0x20,0x47,0x54,0x2c,0x20,0x49,0x4e,0x2c,0x20,
+0x4e,0x4f,0x54,0x49,0x4e,0x2c,0x20,0x47,0x45,0x54,0x2c,0x20,0x4d,0x47,0x45,0x54,
+0x5d,0x00,0x00,0x00,0x0e,0x0d,0x00,0x1e,0x00,0x00,0x00,0x02,0x45,0x51,0x00,0x00,
+0x0e,0x0e,0x00,0x1f,0x00,0x00,0x00,0x02,0x4e,0x45,0x00,0x00,0x0e,0x0f,0x00,0x20,
+0x00,0x00,0x00,0x02,0x4c,0x45,0x00,0x00,0x0e,0x10,0x00,0x21,0x00,0x00,0x00,0x02,
+0x4c,0x54,0x00,0x00,0x0e,0x11,0x00,0x22,0x00,0x00,0x00,0x02,0x47,0x45,0x00,0x00,
+0x0e,0x12,0x00,0x23,0x00,0x00,0x00,0x02,0x47,0x54,0x00,0x00,0x0e,0x13,0x00,0x24,
+0x00,0x00,0x00,0x02,0x49,0x4e,0x00,0x00,0x0e,0x14,0x00,0x25,0x00,0x00,0x00,0x05,
+0x4e,0x4f,0x54,0x49,0x4e,0x00,0x00,0x00,0x0e,0x15,0x00,0x26,0x00,0x00,0x00,0x03,
+0x47,0x45,0x54,0x00,0x0e,0x16,0x00,0x10,0x00,0x00,0x00,0x04,0x4d,0x47,0x45,0x54,
+0x00,0x00,0x00,0x00,0x1c,0x01,0x02,0x15,0x0f,0x00,0x01,0x00,0x1f,0x09,0x00,0x16,
+0x55,0x4e,0x41,0x52,0x59,0x20,0x3d,0x20,0x5b,0x4e,0x4f,0x54,0x2c,0x20,0x42,0x49,
+0x54,0x4e,0x4f,0x54,0x2c,0x20,0x4c,0x45,0x4e,0x2c,0x20,0x4d,0x4f,0x56,0x45,0x5d,
+0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x27,0x00,0x00,0x00,0x05,0x55,0x4e,0x41,0x52,
+0x59,0x00,0x00,0x00,0x0e,0x02,0x00,0x28,0x00,0x00,0x00,0x03,0x4e,0x4f,0x54,0x00,
+0x0e,0x03,0x00,0x29,0x00,0x00,0x00,0x06,0x42,0x49,0x54,0x4e,0x4f,0x54,0x00,0x00,
+0x0e,0x04,0x00,0x2a,0x00,0x00,0x00,0x03,0x4c,0x45,0x4e,0x00,0x0e,0x05,0x00,0x2b,
+0x00,0x00,0x00,0x04,0x4d,0x4f,0x56,0x45,0x00,0x00,0x00,0x00,0x1c,0x01,0x02,0x04,
+0x0f,0x00,0x01,0x00,0x1f,0x0b,0x00,0x17,0x4c,0x4f,0x41,0x44,0x53,0x20,0x3d,0x20,
+0x5b,0x4e,0x55,0x4d,0x42,0x45,0x52,0x2c,0x20,0x53,0x54,0x52,0x49,0x4e,0x47,0x2c,
+0x20,0x47,0x47,0x45,0x54,0x2c,0x20,0x4e,0x4f,0x4e,0x45,0x2c,0x20,0x43,0x4c,0x41,
+0x53,0x53,0x5d,0x00,0x0d,0x00,0x00,0x2c,0x00,0x00,0x00,0x05,0x4c,0x4f,0x41,0x44,
+0x53,0x00,0x00,0x00,0x0e,0x02,0x00,0x0f,0x00,0x00,0x00,0x06,0x4e,0x55,0x4d,0x42,
+0x45,0x52,0x00,0x00,0x0e,0x03,0x00,0x0d,0x00,0x00,0x00,0x06,0x53,0x54,0x52,0x49,
+0x4e,0x47,0x00,0x00,0x0e,0x04,0x00,0x0e,0x00,0x00,0x00,0x04,0x47,0x47,0x45,0x54,
+0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x2d,0x00,0x00,0x00,0x04,0x4e,0x4f,0x4e,0x45,
+0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x2e,0x00,0x00,0x00,0x05,0x43,0x4c,0x41,0x53,
+0x53,0x00,0x00,0x00,0x1c,0x01,0x02,0x05,0x0f,0x00,0x01,0x00,0x1f,0x12,0x00,0x19,
+0x52,0x45,0x54,0x41,0x52,0x47,0x45,0x54,0x20,0x3d,0x20,0x42,0x49,0x4e,0x41,0x52,
+0x59,0x20,0x2b,0x20,0x55,0x4e,0x41,0x52,0x59,0x20,0x2b,0x20,0x4c,0x4f,0x41,0x44,
+0x53,0x20,0x2b,0x20,0x5b,0x4c,0x49,0x53,0x54,0x2c,0x20,0x44,0x49,0x43,0x54,0x2c,
+0x20,0x43,0x41,0x4c,0x4c,0x2c,0x20,0x43,0x41,0x4c,0x4c,0x50,0x2c,0x20,0x43,0x41,
+0x4c,0x4c,0x4d,0x5d,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x2f,0x00,0x00,0x00,0x08,
+0x52,0x45,0x54,0x41,0x52,0x47,0x45,0x54,0x00,0x00,0x00,0x00,0x0e,0x01,0x00,0x12,
+0x00,0x00,0x00,0x06,0x42,0x49,0x4e,0x41,0x52,0x59,0x00,0x00,0x0e,0x02,0x00,0x27,
+0x00,0x00,0x00,0x05,0x55,0x4e,0x41,0x52,0x59,0x00,0x00,0x00,0x01,0x01,0x01,0x02,
+0x0e,0x02,0x00,0x2c,0x00,0x00,0x00,0x05,0x4c,0x4f,0x41,0x44,0x53,0x00,0x00,0x00,
+0x01,0x01,0x01,0x02,0x0e,0x03,0x00,0x30,0x00,0x00,0x00,0x04,0x4c,0x49,0x53,0x54,
+0x00,0x00,0x00,0x00,0x0e,0x04,0x00,0x31,0x00,0x00,0x00,0x04,0x44,0x49,0x43,0x54,
+0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x32,0x00,0x00,0x00,0x04,0x43,0x41,0x4c,0x4c,
+0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x33,0x00,0x00,0x00,0x05,0x43,0x41,0x4c,0x4c,
+0x50,0x00,0x00,0x00,0x0e,0x07,0x00,0x34,0x00,0x00,0x00,0x05,0x43,0x41,0x4c,0x4c,
+0x4d,0x00,0x00,0x00,0x1c,0x02,0x03,0x05,0x01,0x01,0x01,0x02,0x0f,0x00,0x01,0x00,
+0x1f,0x08,0x00,0x1c,0x73,0x74,0x61,0x74,0x73,0x20,0x3d,0x20,0x7b,0x27,0x62,0x65,
+0x66,0x6f,0x72,0x65,0x27,0x3a,0x30,0x2c,0x20,0x27,0x61,0x66,0x74,0x65,0x72,0x27,
+0x3a,0x30,0x7d,0x00,0x0d,0x00,0x00,0x35,0x00,0x00,0x00,0x05,0x73,0x74,0x61,0x74,
+0x73,0x00,0x00,0x00,0x0d,0x02,0x00,0x36,0x00,0x00,0x00,0x06,0x62,0x65,0x66,0x6f,
+0x72,0x65,0x00,0x00,0x0c,0x03,0x00,0x37,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0d,0x04,0x00,0x38,0x00,0x00,0x00,0x05,0x61,0x66,0x74,0x65,0x72,0x00,0x00,0x00,
+0x0c,0x05,0x00,0x37,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x1b,0x01,0x02,0x04,
+0x0f,0x00,0x01,0x00,0x1f,0x06,0x00,0x1e,0x64,0x65,0x66,0x20,0x70,0x61,0x72,0x73,
+0x65,0x28,0x6f,0x75,0x74,0x2c,0x20,0x69,0x2c,0x20,0x65,0x6e,0x64,0x29,0x3a,0x00,
+0x33,0x00,0x00,0x04,0x2a,0x24,0x37,0x37,0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x39,
+0x00,0x00,0x00,0x03,0x6f,0x75,0x74,0x00,0x0d,0x06,0x00,0x3a,0x00,0x00,0x00,0x01,
+0x69,0x00,0x00,0x00,0x0d,0x07,0x00,0x3b,0x00,0x00,0x00,0x03,0x65,0x6e,0x64,0x00,
+0x1c,0x01,0x05,0x03,0x1c,0x02,0x00,0x00,0x1d,0x03,0x00,0x00,0x1d,0x04,0x00,0x00,
+0x11,0x00,0x02,0x1d,0x2d,0x10,0x00,0x11,0x00,0x00,0x00,0x07,0x1f,0x06,0x00,0x1e,
+0x64,0x65,0x66,0x20,0x70,0x61,0x72,0x73,0x65,0x28,0x6f,0x75,0x74,0x2c,0x20,0x69,
+0x2c,0x20,0x65,0x6e,0x64,0x29,0x3a,0x00,0x33,0x00,0x00,0x03,0x6f,0x75,0x74,0x00,
+0x33,0x01,0x00,0x01,0x69,0x00,0x00,0x00,0x33,0x02,0x00,0x03,0x65,0x6e,0x64,0x00,
+0x0d,0x03,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,
+0x2e,0x70,0x79,0x00,0x22,0x03,0x00,0x00,0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x05,
+0x70,0x61,0x72,0x73,0x65,0x00,0x00,0x00,0x23,0x03,0x00,0x00,0x1f,0x04,0x00,0x21,
+0x20,0x20,0x20,0x20,0x6e,0x6f,0x64,0x65,0x73,0x20,0x3d,0x20,0x5b,0x5d,0x00,0x00,
+0x33,0x03,0x00,0x05,0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x1c,0x03,0x00,0x00,
+0x1f,0x06,0x00,0x22,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x69,0x20,
+0x3c,0x20,0x6c,0x65,0x6e,0x28,0x6f,0x75,0x74,0x29,0x3a,0x00,0x0e,0x04,0x00,0x02,
+0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x10,0x05,0x00,0x00,0x37,0x07,0x04,0x02,
+0x1a,0x0e,0x01,0x07,0x16,0x0e,0x00,0x00,0x13,0x00,0x01,0xdc,0x1f,0x06,0x00,0x23,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,0x20,0x3d,0x20,0x6f,
+0x75,0x74,0x5b,0x69,0x5d,0x00,0x00,0x00,0x33,0x0e,0x00,0x04,0x69,0x74,0x65,0x6d,
+0x00,0x00,0x00,0x00,0x0a,0x0e,0x00,0x01,0x1f,0x04,0x00,0x24,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x20,0x2b,0x3d,0x20,0x31,0x00,0x00,0x0c,0x04,0x00,0x03,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x04,0x1f,0x06,0x00,0x25,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6b,0x69,0x6e,0x64,0x20,0x3d,0x20,0x69,
+0x74,0x65,0x6d,0x5b,0x30,0x5d,0x00,0x00,0x33,0x07,0x00,0x04,0x6b,0x69,0x6e,0x64,
+0x00,0x00,0x00,0x00,0x0c,0x05,0x00,0x04,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x07,0x0e,0x05,0x1f,0x07,0x00,0x26,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x6b,0x69,0x6e,0x64,0x20,0x3d,0x3d,0x20,0x27,0x74,0x61,0x67,0x27,
+0x3a,0x00,0x00,0x00,0x0d,0x05,0x00,0x05,0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,
+0x18,0x04,0x07,0x05,0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x3a,0x1f,0x08,0x00,0x27,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,
+0x74,0x65,0x6d,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x65,0x6e,0x64,0x3a,0x00,0x00,
+0x0c,0x05,0x00,0x03,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x04,0x0e,0x05,
+0x18,0x04,0x04,0x02,0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x0e,0x1f,0x08,0x00,0x28,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x69,0x00,
+0x10,0x05,0x03,0x00,0x10,0x06,0x01,0x00,0x1c,0x04,0x05,0x02,0x15,0x04,0x00,0x00,
+0x1f,0x0b,0x00,0x29,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6e,0x6f,0x64,0x65,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x5b,0x27,0x74,
+0x61,0x67,0x27,0x2c,0x20,0x69,0x74,0x65,0x6d,0x5b,0x31,0x5d,0x5d,0x29,0x00,0x00,
+0x0d,0x08,0x00,0x06,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x05,0x03,0x08,0x00,0x00,0x00,0x00,0x0d,0x08,0x00,0x05,0x00,0x00,0x00,0x03,
+0x74,0x61,0x67,0x00,0x0c,0x0a,0x00,0x03,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x09,0x0e,0x0a,0x1c,0x07,0x08,0x02,0x39,0x04,0x05,0x03,0x13,0x00,0xff,0x90,
+0x1f,0x08,0x00,0x2a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,
+0x20,0x6b,0x69,0x6e,0x64,0x20,0x3d,0x3d,0x20,0x27,0x72,0x65,0x67,0x73,0x27,0x3a,
+0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x07,0x00,0x00,0x00,0x04,0x72,0x65,0x67,0x73,
+0x00,0x00,0x00,0x00,0x18,0x04,0x07,0x05,0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x1b,
+0x1f,0x0b,0x00,0x2b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6e,0x6f,0x64,0x65,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x5b,0x27,0x72,
+0x65,0x67,0x73,0x27,0x2c,0x20,0x69,0x74,0x65,0x6d,0x5d,0x29,0x00,0x00,0x00,0x00,
+0x0d,0x08,0x00,0x06,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x05,0x03,0x08,0x00,0x00,0x00,0x01,0x0d,0x08,0x00,0x07,0x00,0x00,0x00,0x04,
+0x72,0x65,0x67,0x73,0x00,0x00,0x00,0x00,0x10,0x09,0x0e,0x00,0x1c,0x07,0x08,0x02,
+0x39,0x04,0x05,0x03,0x13,0x00,0xff,0x66,0x1f,0x0d,0x00,0x2c,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x6b,0x69,0x6e,0x64,0x20,0x3d,0x3d,
+0x20,0x27,0x6a,0x75,0x6d,0x70,0x27,0x20,0x6f,0x72,0x20,0x6b,0x69,0x6e,0x64,0x20,
+0x3d,0x3d,0x20,0x27,0x73,0x65,0x74,0x6a,0x6d,0x70,0x27,0x3a,0x00,0x00,0x00,0x00,
+0x0d,0x05,0x00,0x08,0x00,0x00,0x00,0x04,0x6a,0x75,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x18,0x04,0x07,0x05,0x2f,0x04,0x00,0x00,0x13,0x00,0x00,0x06,0x0d,0x05,0x00,0x09,
+0x00,0x00,0x00,0x06,0x73,0x65,0x74,0x6a,0x6d,0x70,0x00,0x00,0x18,0x04,0x07,0x05,
+0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x1b,0x1f,0x0b,0x00,0x2d,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x6f,0x64,0x65,0x73,0x2e,0x61,0x70,
+0x70,0x65,0x6e,0x64,0x28,0x5b,0x6b,0x69,0x6e,0x64,0x2c,0x20,0x69,0x74,0x65,0x6d,
+0x5b,0x31,0x5d,0x5d,0x29,0x00,0x00,0x00,0x0d,0x08,0x00,0x06,0x00,0x00,0x00,0x06,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x05,0x03,0x08,0x00,0x00,0x00,0x02,
+0x10,0x08,0x07,0x00,0x0c,0x0a,0x00,0x03,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x09,0x0e,0x0a,0x1c,0x07,0x08,0x02,0x39,0x04,0x05,0x03,0x13,0x00,0xff,0x30,
+0x1f,0x07,0x00,0x2e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,
+0x20,0x6b,0x69,0x6e,0x64,0x20,0x3d,0x3d,0x20,0x27,0x66,0x6e,0x63,0x27,0x3a,0x00,
+0x0d,0x05,0x00,0x0a,0x00,0x00,0x00,0x03,0x66,0x6e,0x63,0x00,0x18,0x04,0x07,0x05,
+0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x4c,0x1f,0x0c,0x00,0x2f,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x6f,0x64,0x79,0x2c,0x20,0x69,0x20,
+0x3d,0x20,0x70,0x61,0x72,0x73,0x65,0x28,0x6f,0x75,0x74,0x2c,0x20,0x69,0x2c,0x20,
+0x69,0x74,0x65,0x6d,0x5b,0x32,0x5d,0x29,0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x01,
+0x00,0x00,0x00,0x05,0x70,0x61,0x72,0x73,0x65,0x00,0x00,0x00,0x10,0x06,0x00,0x00,
+0x10,0x07,0x01,0x00,0x0c,0x09,0x00,0x0b,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,
+0x0a,0x08,0x0e,0x09,0x37,0x04,0x05,0x04,0x33,0x04,0x00,0x04,0x2a,0x24,0x34,0x39,
+0x00,0x00,0x00,0x00,0x33,0x05,0x00,0x04,0x62,0x6f,0x64,0x79,0x00,0x00,0x00,0x00,
+0x0c,0x07,0x00,0x04,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x05,0x04,0x07,
+0x0c,0x07,0x00,0x03,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x01,0x04,0x07,
+0x1f,0x0f,0x00,0x30,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6e,0x6f,0x64,0x65,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x5b,0x27,0x66,
+0x6e,0x63,0x27,0x2c,0x20,0x69,0x74,0x65,0x6d,0x5b,0x31,0x5d,0x2c,0x20,0x69,0x74,
+0x65,0x6d,0x5b,0x32,0x5d,0x2c,0x20,0x62,0x6f,0x64,0x79,0x5d,0x29,0x00,0x00,0x00,
+0x0d,0x09,0x00,0x06,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x06,0x03,0x09,0x00,0x00,0x00,0x03,0x0d,0x09,0x00,0x0a,0x00,0x00,0x00,0x03,
+0x66,0x6e,0x63,0x00,0x0c,0x0d,0x00,0x03,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x0a,0x0e,0x0d,0x0c,0x0d,0x00,0x0b,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,
+0x0a,0x0b,0x0e,0x0d,0x10,0x0c,0x05,0x00,0x1c,0x08,0x09,0x04,0x39,0x04,0x06,0x03,
+0x13,0x00,0xfe,0xd7,0x1f,0x04,0x00,0x31,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x65,0x6c,0x73,0x65,0x3a,0x00,0x00,0x00,0x1f,0x06,0x00,0x32,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x74,0x72,0x61,0x20,0x3d,0x20,
+0x5b,0x5d,0x00,0x00,0x33,0x04,0x00,0x05,0x65,0x78,0x74,0x72,0x61,0x00,0x00,0x00,
+0x1c,0x04,0x00,0x00,0x1f,0x09,0x00,0x33,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,0x74,0x65,0x6d,0x5b,0x31,0x5d,0x20,0x69,
+0x6e,0x20,0x4f,0x50,0x45,0x52,0x41,0x4e,0x44,0x53,0x3a,0x00,0x0c,0x07,0x00,0x03,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x06,0x0e,0x07,0x0e,0x07,0x00,0x0c,
+0x00,0x00,0x00,0x08,0x4f,0x50,0x45,0x52,0x41,0x4e,0x44,0x53,0x00,0x00,0x00,0x00,
+0x25,0x06,0x06,0x07,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x1f,0x1f,0x0a,0x00,0x34,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x65,0x78,0x74,0x72,0x61,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x6f,0x75,0x74,
+0x5b,0x69,0x5d,0x29,0x00,0x00,0x00,0x00,0x0d,0x0a,0x00,0x06,0x00,0x00,0x00,0x06,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x07,0x04,0x0a,0x00,0x00,0x00,0x04,
+0x0a,0x09,0x00,0x01,0x39,0x06,0x07,0x03,0x1f,0x06,0x00,0x35,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x20,0x2b,0x3d,
+0x20,0x31,0x00,0x00,0x0c,0x07,0x00,0x03,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x01,0x01,0x01,0x07,0x1f,0x0e,0x00,0x36,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x69,0x20,0x3c,0x20,0x6c,0x65,
+0x6e,0x28,0x6f,0x75,0x74,0x29,0x20,0x61,0x6e,0x64,0x20,0x6f,0x75,0x74,0x5b,0x69,
+0x5d,0x5b,0x30,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x64,0x61,0x74,0x61,0x27,0x3a,0x00,
+0x0e,0x08,0x00,0x02,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x10,0x09,0x00,0x00,
+0x37,0x07,0x08,0x02,0x1a,0x06,0x01,0x07,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x0b,
+0x0a,0x06,0x00,0x01,0x0c,0x07,0x00,0x04,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x06,0x06,0x07,0x0d,0x07,0x00,0x0d,0x00,0x00,0x00,0x04,0x64,0x61,0x74,0x61,
+0x00,0x00,0x00,0x00,0x18,0x06,0x06,0x07,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x20,
+0x1f,0x0a,0x00,0x37,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x65,0x78,0x74,0x72,0x61,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,
+0x28,0x6f,0x75,0x74,0x5b,0x69,0x5d,0x29,0x00,0x00,0x00,0x00,0x0d,0x0a,0x00,0x06,
+0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x07,0x04,0x0a,
+0x00,0x00,0x00,0x05,0x0a,0x09,0x00,0x01,0x39,0x06,0x07,0x03,0x1f,0x06,0x00,0x38,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x20,0x2b,0x3d,0x20,0x31,0x00,0x00,0x0c,0x07,0x00,0x03,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x07,0x13,0x00,0xff,0xce,0x1f,0x14,0x00,0x39,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x6f,0x64,0x65,
+0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x5b,0x27,0x63,0x6f,0x64,0x65,0x27,
+0x2c,0x20,0x69,0x74,0x65,0x6d,0x5b,0x31,0x5d,0x2c,0x20,0x69,0x74,0x65,0x6d,0x5b,
+0x32,0x5d,0x2c,0x20,0x69,0x74,0x65,0x6d,0x5b,0x33,0x5d,0x2c,0x20,0x69,0x74,0x65,
+0x6d,0x5b,0x34,0x5d,0x2c,0x20,0x65,0x78,0x74,0x72,0x61,0x5d,0x29,0x00,0x00,0x00,
+0x0d,0x0a,0x00,0x06,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x07,0x03,0x0a,0x00,0x00,0x00,0x06,0x0d,0x0a,0x00,0x0e,0x00,0x00,0x00,0x04,
+0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0c,0x05,0x00,0x03,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x0b,0x0e,0x05,0x0c,0x05,0x00,0x0b,0x00,0x00,0x69,0x04,
+0x02,0x00,0x00,0x00,0x0a,0x0c,0x0e,0x05,0x0c,0x05,0x00,0x0f,0x00,0x00,0x69,0x04,
+0x03,0x00,0x00,0x00,0x0a,0x0d,0x0e,0x05,0x0c,0x05,0x00,0x10,0x00,0x00,0x69,0x04,
+0x04,0x00,0x00,0x00,0x0a,0x0e,0x0e,0x05,0x10,0x0f,0x04,0x00,0x1c,0x09,0x0a,0x06,
+0x39,0x06,0x07,0x03,0x13,0x00,0xfe,0x1e,0x1f,0x05,0x00,0x3a,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x69,0x00,
+0x10,0x07,0x03,0x00,0x10,0x08,0x01,0x00,0x1c,0x06,0x07,0x02,0x15,0x06,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x3c,0x00,0x00,0x00,0x05,0x70,0x61,0x72,0x73,
+0x65,0x00,0x00,0x00,0x0f,0x01,0x00,0x00,0x1f,0x07,0x00,0x3c,0x64,0x65,0x66,0x20,
+0x75,0x6e,0x70,0x61,0x72,0x73,0x65,0x28,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x6f,
+0x75,0x74,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x04,0x2a,0x24,0x38,0x36,
+0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x3d,0x00,0x00,0x00,0x05,0x6e,0x6f,0x64,0x65,
+0x73,0x00,0x00,0x00,0x0d,0x07,0x00,0x39,0x00,0x00,0x00,0x03,0x6f,0x75,0x74,0x00,
+0x1c,0x02,0x06,0x02,0x1c,0x03,0x00,0x00,0x1d,0x04,0x00,0x00,0x1d,0x05,0x00,0x00,
+0x11,0x01,0x01,0x2a,0x2d,0x0c,0x00,0x0e,0x00,0x00,0x00,0x06,0x1f,0x07,0x00,0x3c,
+0x64,0x65,0x66,0x20,0x75,0x6e,0x70,0x61,0x72,0x73,0x65,0x28,0x6e,0x6f,0x64,0x65,
+0x73,0x2c,0x20,0x6f,0x75,0x74,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x05,
+0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x33,0x01,0x00,0x03,0x6f,0x75,0x74,0x00,
+0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,
+0x2e,0x70,0x79,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x07,
+0x75,0x6e,0x70,0x61,0x72,0x73,0x65,0x00,0x23,0x02,0x00,0x00,0x1f,0x05,0x00,0x3d,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x6e,0x20,0x69,0x6e,0x20,0x6e,0x6f,0x64,
+0x65,0x73,0x3a,0x00,0x0c,0x03,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x2b,0x02,0x00,0x03,0x13,0x00,0x00,0xfa,0x33,0x04,0x00,0x01,0x6e,0x00,0x00,0x00,
+0x10,0x04,0x02,0x00,0x1f,0x05,0x00,0x3e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6b,0x69,0x6e,0x64,0x20,0x3d,0x20,0x6e,0x5b,0x30,0x5d,0x00,0x33,0x02,0x00,0x04,
+0x6b,0x69,0x6e,0x64,0x00,0x00,0x00,0x00,0x0c,0x05,0x00,0x02,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x02,0x04,0x05,0x1f,0x07,0x00,0x3f,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6b,0x69,0x6e,0x64,0x20,0x3d,0x3d,0x20,0x27,
+0x63,0x6f,0x64,0x65,0x27,0x3a,0x00,0x00,0x0d,0x05,0x00,0x03,0x00,0x00,0x00,0x04,
+0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x18,0x05,0x02,0x05,0x16,0x05,0x00,0x00,
+0x13,0x00,0x00,0x42,0x1f,0x0f,0x00,0x40,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x28,
+0x27,0x63,0x6f,0x64,0x65,0x27,0x2c,0x20,0x6e,0x5b,0x31,0x5d,0x2c,0x20,0x6e,0x5b,
+0x32,0x5d,0x2c,0x20,0x6e,0x5b,0x33,0x5d,0x2c,0x20,0x6e,0x5b,0x34,0x5d,0x29,0x29,
+0x00,0x00,0x00,0x00,0x0d,0x07,0x00,0x04,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x05,0x01,0x07,0x00,0x00,0x00,0x00,0x0d,0x07,0x00,0x03,
+0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x0c,0x0b,0x00,0x05,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x08,0x04,0x0b,0x0c,0x0b,0x00,0x06,
+0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x0a,0x09,0x04,0x0b,0x0c,0x0b,0x00,0x07,
+0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,0x0a,0x0a,0x04,0x0b,0x0c,0x0b,0x00,0x08,
+0x00,0x00,0x69,0x04,0x04,0x00,0x00,0x00,0x0a,0x0b,0x04,0x0b,0x1c,0x07,0x07,0x05,
+0x39,0x05,0x05,0x03,0x1f,0x08,0x00,0x41,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x65,0x78,0x74,0x65,0x6e,0x64,0x28,0x6e,
+0x5b,0x35,0x5d,0x29,0x00,0x00,0x00,0x00,0x0d,0x07,0x00,0x09,0x00,0x00,0x00,0x06,
+0x65,0x78,0x74,0x65,0x6e,0x64,0x00,0x00,0x38,0x05,0x01,0x07,0x00,0x00,0x00,0x01,
+0x0c,0x07,0x00,0x0a,0x00,0x00,0x69,0x04,0x05,0x00,0x00,0x00,0x0a,0x07,0x04,0x07,
+0x39,0x05,0x05,0x03,0x13,0x00,0xff,0x9f,0x1f,0x08,0x00,0x42,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x6b,0x69,0x6e,0x64,0x20,0x3d,0x3d,
+0x20,0x27,0x72,0x65,0x67,0x73,0x27,0x3a,0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x0b,
+0x00,0x00,0x00,0x04,0x72,0x65,0x67,0x73,0x00,0x00,0x00,0x00,0x18,0x05,0x02,0x05,
+0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x16,0x1f,0x08,0x00,0x43,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x28,0x6e,0x5b,0x31,0x5d,0x29,0x00,0x00,0x00,0x00,0x0d,0x07,0x00,0x04,
+0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x05,0x01,0x07,
+0x00,0x00,0x00,0x02,0x0c,0x07,0x00,0x05,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x07,0x04,0x07,0x39,0x05,0x05,0x03,0x13,0x00,0xff,0x7a,0x1f,0x07,0x00,0x44,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x6b,0x69,0x6e,
+0x64,0x20,0x3d,0x3d,0x20,0x27,0x66,0x6e,0x63,0x27,0x3a,0x00,0x0d,0x05,0x00,0x0c,
+0x00,0x00,0x00,0x03,0x66,0x6e,0x63,0x00,0x18,0x05,0x02,0x05,0x16,0x05,0x00,0x00,
+0x13,0x00,0x00,0x4e,0x1f,0x0b,0x00,0x45,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x28,
+0x27,0x66,0x6e,0x63,0x27,0x2c,0x20,0x6e,0x5b,0x31,0x5d,0x2c,0x20,0x6e,0x5b,0x32,
+0x5d,0x29,0x29,0x00,0x0d,0x07,0x00,0x04,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x05,0x01,0x07,0x00,0x00,0x00,0x03,0x0d,0x07,0x00,0x0c,
+0x00,0x00,0x00,0x03,0x66,0x6e,0x63,0x00,0x0c,0x0a,0x00,0x05,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x08,0x04,0x0a,0x0c,0x0a,0x00,0x06,0x00,0x00,0x69,0x04,
+0x02,0x00,0x00,0x00,0x0a,0x09,0x04,0x0a,0x1c,0x07,0x07,0x03,0x39,0x05,0x05,0x03,
+0x1f,0x08,0x00,0x46,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x75,0x6e,0x70,0x61,0x72,0x73,0x65,0x28,0x6e,0x5b,0x33,0x5d,0x2c,0x20,0x6f,0x75,
+0x74,0x29,0x00,0x00,0x0e,0x05,0x00,0x01,0x00,0x00,0x00,0x07,0x75,0x6e,0x70,0x61,
+0x72,0x73,0x65,0x00,0x0c,0x07,0x00,0x07,0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,
+0x0a,0x06,0x04,0x07,0x10,0x07,0x01,0x00,0x37,0x05,0x05,0x03,0x1f,0x0a,0x00,0x47,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x28,0x27,0x74,0x61,0x67,0x27,0x2c,0x20,0x6e,
+0x5b,0x32,0x5d,0x29,0x29,0x00,0x00,0x00,0x0d,0x07,0x00,0x04,0x00,0x00,0x00,0x06,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x05,0x01,0x07,0x00,0x00,0x00,0x04,
+0x0d,0x07,0x00,0x0d,0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,0x0c,0x09,0x00,0x06,
+0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x0a,0x08,0x04,0x09,0x1c,0x07,0x07,0x02,
+0x39,0x05,0x05,0x03,0x13,0x00,0xff,0x1f,0x1f,0x0a,0x00,0x49,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x28,0x28,0x6b,0x69,0x6e,0x64,0x2c,0x20,0x6e,0x5b,0x31,0x5d,0x29,0x29,
+0x00,0x00,0x00,0x00,0x0d,0x07,0x00,0x04,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x05,0x01,0x07,0x00,0x00,0x00,0x05,0x10,0x07,0x02,0x00,
+0x0c,0x09,0x00,0x05,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x08,0x04,0x09,
+0x1c,0x07,0x07,0x02,0x39,0x05,0x05,0x03,0x13,0x00,0xff,0x06,0x1f,0x04,0x00,0x4a,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x00,0x00,
+0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x3e,0x00,0x00,0x00,0x07,
+0x75,0x6e,0x70,0x61,0x72,0x73,0x65,0x00,0x0f,0x02,0x01,0x00,0x1f,0x05,0x00,0x4c,
+0x64,0x65,0x66,0x20,0x63,0x6f,0x75,0x6e,0x74,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x02,0x00,0x04,0x2a,0x24,0x39,0x34,0x00,0x00,0x00,0x00,
+0x0d,0x07,0x00,0x3d,0x00,0x00,0x00,0x05,0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,
+0x1c,0x03,0x07,0x01,0x1c,0x04,0x00,0x00,0x1d,0x05,0x00,0x00,0x1d,0x06,0x00,0x00,
+0x11,0x02,0x00,0x99,0x2d,0x08,0x00,0x08,0x00,0x00,0x00,0x00,0x1f,0x05,0x00,0x4c,
+0x64,0x65,0x66,0x20,0x63,0x6f,0x75,0x6e,0x74,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x05,0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,
+0x2e,0x70,0x79,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x05,
+0x63,0x6f,0x75,0x6e,0x74,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x03,0x00,0x4d,
+0x20,0x20,0x20,0x20,0x6e,0x20,0x3d,0x20,0x30,0x00,0x00,0x00,0x33,0x01,0x00,0x01,
+0x6e,0x00,0x00,0x00,0x0c,0x02,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x10,0x01,0x02,0x00,0x1f,0x06,0x00,0x4e,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,
+0x6e,0x6f,0x64,0x65,0x20,0x69,0x6e,0x20,0x6e,0x6f,0x64,0x65,0x73,0x3a,0x00,0x00,
+0x0c,0x03,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x02,0x00,0x03,
+0x13,0x00,0x00,0x62,0x33,0x04,0x00,0x04,0x6e,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,
+0x10,0x04,0x02,0x00,0x1f,0x08,0x00,0x4f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x6e,0x6f,0x64,0x65,0x5b,0x30,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x66,
+0x6e,0x63,0x27,0x3a,0x00,0x00,0x00,0x00,0x0c,0x05,0x00,0x02,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x02,0x04,0x05,0x0d,0x05,0x00,0x03,0x00,0x00,0x00,0x03,
+0x66,0x6e,0x63,0x00,0x18,0x02,0x02,0x05,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x1b,
+0x1f,0x09,0x00,0x50,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6e,0x20,0x2b,0x3d,0x20,0x31,0x20,0x2b,0x20,0x63,0x6f,0x75,0x6e,0x74,0x28,0x6e,
+0x6f,0x64,0x65,0x5b,0x33,0x5d,0x29,0x00,0x0c,0x05,0x00,0x04,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0e,0x06,0x00,0x01,0x00,0x00,0x00,0x05,0x63,0x6f,0x75,0x6e,
+0x74,0x00,0x00,0x00,0x0c,0x02,0x00,0x05,0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,
+0x0a,0x07,0x04,0x02,0x37,0x02,0x06,0x02,0x01,0x05,0x05,0x02,0x01,0x02,0x01,0x05,
+0x10,0x01,0x02,0x00,0x13,0x00,0xff,0xce,0x1f,0x0e,0x00,0x51,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x6e,0x6f,0x64,0x65,0x5b,0x30,0x5d,
+0x20,0x21,0x3d,0x20,0x27,0x74,0x61,0x67,0x27,0x20,0x61,0x6e,0x64,0x20,0x6e,0x6f,
+0x64,0x65,0x5b,0x30,0x5d,0x20,0x21,0x3d,0x20,0x27,0x72,0x65,0x67,0x73,0x27,0x3a,
+0x00,0x00,0x00,0x00,0x0c,0x05,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x02,0x04,0x05,0x0d,0x05,0x00,0x06,0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,
+0x24,0x02,0x02,0x05,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x0a,0x0c,0x05,0x00,0x02,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x02,0x04,0x05,0x0d,0x05,0x00,0x07,
+0x00,0x00,0x00,0x04,0x72,0x65,0x67,0x73,0x00,0x00,0x00,0x00,0x24,0x02,0x02,0x05,
+0x16,0x02,0x00,0x00,0x13,0x00,0xff,0xaa,0x1f,0x05,0x00,0x52,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x20,0x2b,0x3d,0x20,0x31,0x00,0x00,
+0x0c,0x05,0x00,0x04,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x02,0x01,0x05,
+0x10,0x01,0x02,0x00,0x13,0x00,0xff,0x9e,0x1f,0x04,0x00,0x53,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6e,0x00,0x00,0x00,0x00,0x15,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x3f,0x00,0x00,0x00,0x05,0x63,0x6f,0x75,0x6e,
+0x74,0x00,0x00,0x00,0x0f,0x03,0x02,0x00,0x1f,0x04,0x00,0x55,0x64,0x65,0x66,0x20,
+0x73,0x70,0x61,0x6e,0x28,0x61,0x2c,0x20,0x6e,0x29,0x3a,0x00,0x33,0x03,0x00,0x05,
+0x2a,0x24,0x31,0x30,0x31,0x00,0x00,0x00,0x0d,0x08,0x00,0x40,0x00,0x00,0x00,0x01,
+0x61,0x00,0x00,0x00,0x0d,0x09,0x00,0x41,0x00,0x00,0x00,0x01,0x6e,0x00,0x00,0x00,
+0x1c,0x04,0x08,0x02,0x1c,0x05,0x00,0x00,0x1d,0x06,0x00,0x00,0x1d,0x07,0x00,0x00,
+0x11,0x03,0x00,0x4e,0x2d,0x0b,0x00,0x04,0x00,0x00,0x00,0x01,0x1f,0x04,0x00,0x55,
+0x64,0x65,0x66,0x20,0x73,0x70,0x61,0x6e,0x28,0x61,0x2c,0x20,0x6e,0x29,0x3a,0x00,
+0x33,0x00,0x00,0x01,0x61,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x6e,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,
+0x2e,0x70,0x79,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x04,
+0x73,0x70,0x61,0x6e,0x00,0x00,0x00,0x00,0x23,0x02,0x00,0x00,0x1f,0x03,0x00,0x56,
+0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x5b,0x5d,0x00,0x00,0x33,0x02,0x00,0x01,
+0x72,0x00,0x00,0x00,0x1c,0x03,0x00,0x00,0x10,0x02,0x03,0x00,0x1f,0x08,0x00,0x57,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x6b,0x20,0x69,0x6e,0x20,0x72,0x61,0x6e,
+0x67,0x65,0x28,0x61,0x2c,0x20,0x61,0x20,0x2b,0x20,0x6e,0x29,0x3a,0x00,0x00,0x00,
+0x0e,0x04,0x00,0x02,0x00,0x00,0x00,0x05,0x72,0x61,0x6e,0x67,0x65,0x00,0x00,0x00,
+0x10,0x05,0x00,0x00,0x01,0x06,0x00,0x01,0x3a,0x08,0x04,0x03,0x3b,0x03,0x08,0x00,
+0x13,0x00,0x00,0x13,0x33,0x04,0x00,0x01,0x6b,0x00,0x00,0x00,0x10,0x04,0x03,0x00,
+0x1f,0x05,0x00,0x58,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x2e,0x61,0x70,
+0x70,0x65,0x6e,0x64,0x28,0x6b,0x29,0x00,0x0d,0x00,0x00,0x03,0x00,0x00,0x00,0x06,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x05,0x02,0x00,0x00,0x00,0x00,0x00,
+0x10,0x07,0x04,0x00,0x39,0x03,0x05,0x03,0x13,0x00,0xff,0xed,0x1f,0x04,0x00,0x59,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,
+0x15,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x42,0x00,0x00,0x00,0x04,
+0x73,0x70,0x61,0x6e,0x00,0x00,0x00,0x00,0x0f,0x04,0x03,0x00,0x1f,0x04,0x00,0x5b,
+0x64,0x65,0x66,0x20,0x75,0x73,0x65,0x73,0x28,0x6e,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x04,0x00,0x05,0x2a,0x24,0x31,0x30,0x39,0x00,0x00,0x00,0x0d,0x09,0x00,0x41,
+0x00,0x00,0x00,0x01,0x6e,0x00,0x00,0x00,0x1c,0x05,0x09,0x01,0x1c,0x06,0x00,0x00,
+0x1d,0x07,0x00,0x00,0x1d,0x08,0x00,0x00,0x11,0x04,0x01,0xd0,0x2d,0x0e,0x00,0x26,
+0x00,0x00,0x00,0x00,0x1f,0x04,0x00,0x5b,0x64,0x65,0x66,0x20,0x75,0x73,0x65,0x73,
+0x28,0x6e,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x6e,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,
+0x2e,0x70,0x79,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x04,
+0x75,0x73,0x65,0x73,0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x0c,0x00,0x5d,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,0x5b,0x30,0x5d,0x20,0x3d,0x3d,0x20,0x27,
+0x66,0x6e,0x63,0x27,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x70,0x61,
+0x6e,0x28,0x6e,0x5b,0x31,0x5d,0x20,0x2b,0x20,0x31,0x2c,0x20,0x34,0x29,0x00,0x00,
+0x0c,0x02,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x01,0x00,0x02,
+0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x66,0x6e,0x63,0x00,0x18,0x01,0x01,0x02,
+0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x12,0x0e,0x02,0x00,0x04,0x00,0x00,0x00,0x04,
+0x73,0x70,0x61,0x6e,0x00,0x00,0x00,0x00,0x0c,0x05,0x00,0x05,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x03,0x00,0x05,0x0c,0x05,0x00,0x05,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x01,0x03,0x03,0x05,0x0c,0x04,0x00,0x06,0x00,0x00,0x69,0x04,
+0x04,0x00,0x00,0x00,0x37,0x01,0x02,0x03,0x15,0x01,0x00,0x00,0x1f,0x09,0x00,0x5e,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,0x5b,0x30,0x5d,0x20,0x21,0x3d,0x20,0x27,
+0x63,0x6f,0x64,0x65,0x27,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,0x5d,
+0x00,0x00,0x00,0x00,0x0c,0x02,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x01,0x00,0x02,0x0d,0x02,0x00,0x07,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,
+0x00,0x00,0x00,0x00,0x24,0x01,0x01,0x02,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x03,
+0x1c,0x01,0x00,0x00,0x15,0x01,0x00,0x00,0x1f,0x0a,0x00,0x5f,0x20,0x20,0x20,0x20,
+0x69,0x2c,0x20,0x61,0x2c,0x20,0x62,0x2c,0x20,0x63,0x20,0x3d,0x20,0x6e,0x5b,0x31,
+0x5d,0x2c,0x20,0x6e,0x5b,0x32,0x5d,0x2c,0x20,0x6e,0x5b,0x33,0x5d,0x2c,0x20,0x6e,
+0x5b,0x34,0x5d,0x00,0x0c,0x03,0x00,0x05,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x01,0x00,0x03,0x0c,0x04,0x00,0x08,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,
+0x0a,0x02,0x00,0x04,0x0c,0x05,0x00,0x09,0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,
+0x0a,0x03,0x00,0x05,0x0c,0x06,0x00,0x06,0x00,0x00,0x69,0x04,0x04,0x00,0x00,0x00,
+0x0a,0x04,0x00,0x06,0x33,0x05,0x00,0x01,0x69,0x00,0x00,0x00,0x10,0x05,0x01,0x00,
+0x33,0x01,0x00,0x01,0x61,0x00,0x00,0x00,0x10,0x01,0x02,0x00,0x33,0x02,0x00,0x01,
+0x62,0x00,0x00,0x00,0x10,0x02,0x03,0x00,0x33,0x03,0x00,0x01,0x63,0x00,0x00,0x00,
+0x10,0x03,0x04,0x00,0x1f,0x09,0x00,0x60,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,
+0x20,0x69,0x6e,0x20,0x42,0x49,0x4e,0x41,0x52,0x59,0x3a,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x5b,0x62,0x2c,0x20,0x63,0x5d,0x00,0x00,0x00,0x0e,0x06,0x00,0x0a,
+0x00,0x00,0x00,0x06,0x42,0x49,0x4e,0x41,0x52,0x59,0x00,0x00,0x25,0x04,0x05,0x06,
+0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x05,0x10,0x06,0x02,0x00,0x10,0x07,0x03,0x00,
+0x1c,0x04,0x06,0x02,0x15,0x04,0x00,0x00,0x1f,0x08,0x00,0x61,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x69,0x20,0x69,0x6e,0x20,0x55,0x4e,0x41,0x52,0x59,0x3a,0x20,0x72,
+0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,0x62,0x5d,0x00,0x00,0x00,0x0e,0x06,0x00,0x0b,
+0x00,0x00,0x00,0x05,0x55,0x4e,0x41,0x52,0x59,0x00,0x00,0x00,0x25,0x04,0x05,0x06,
+0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x04,0x10,0x06,0x02,0x00,0x1c,0x04,0x06,0x01,
+0x15,0x04,0x00,0x00,0x1f,0x13,0x00,0x62,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,
+0x20,0x69,0x6e,0x20,0x4c,0x4f,0x41,0x44,0x53,0x20,0x6f,0x72,0x20,0x69,0x20,0x69,
+0x6e,0x20,0x5b,0x4c,0x49,0x4e,0x45,0x2c,0x20,0x56,0x41,0x52,0x2c,0x20,0x50,0x41,
+0x53,0x53,0x2c,0x20,0x52,0x45,0x47,0x53,0x2c,0x20,0x53,0x45,0x54,0x4a,0x4d,0x50,
+0x2c,0x20,0x4a,0x55,0x4d,0x50,0x5d,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+0x5b,0x5d,0x00,0x00,0x0e,0x06,0x00,0x0c,0x00,0x00,0x00,0x05,0x4c,0x4f,0x41,0x44,
+0x53,0x00,0x00,0x00,0x25,0x04,0x05,0x06,0x2f,0x04,0x00,0x00,0x13,0x00,0x00,0x1a,
+0x0e,0x07,0x00,0x0d,0x00,0x00,0x00,0x04,0x4c,0x49,0x4e,0x45,0x00,0x00,0x00,0x00,
+0x0e,0x08,0x00,0x0e,0x00,0x00,0x00,0x03,0x56,0x41,0x52,0x00,0x0e,0x09,0x00,0x0f,
+0x00,0x00,0x00,0x04,0x50,0x41,0x53,0x53,0x00,0x00,0x00,0x00,0x0e,0x0a,0x00,0x10,
+0x00,0x00,0x00,0x04,0x52,0x45,0x47,0x53,0x00,0x00,0x00,0x00,0x0e,0x0b,0x00,0x11,
+0x00,0x00,0x00,0x06,0x53,0x45,0x54,0x4a,0x4d,0x50,0x00,0x00,0x0e,0x0c,0x00,0x12,
+0x00,0x00,0x00,0x04,0x4a,0x55,0x4d,0x50,0x00,0x00,0x00,0x00,0x1c,0x06,0x07,0x06,
+0x25,0x04,0x05,0x06,0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x03,0x1c,0x04,0x00,0x00,
+0x15,0x04,0x00,0x00,0x1f,0x11,0x00,0x63,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,
+0x20,0x69,0x6e,0x20,0x5b,0x4c,0x49,0x53,0x54,0x2c,0x20,0x44,0x49,0x43,0x54,0x2c,
+0x20,0x43,0x41,0x4c,0x4c,0x50,0x2c,0x20,0x43,0x41,0x4c,0x4c,0x4d,0x2c,0x20,0x52,
+0x41,0x4e,0x47,0x45,0x5d,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x70,
+0x61,0x6e,0x28,0x62,0x2c,0x20,0x63,0x29,0x00,0x00,0x00,0x00,0x0e,0x07,0x00,0x13,
+0x00,0x00,0x00,0x04,0x4c,0x49,0x53,0x54,0x00,0x00,0x00,0x00,0x0e,0x08,0x00,0x14,
+0x00,0x00,0x00,0x04,0x44,0x49,0x43,0x54,0x00,0x00,0x00,0x00,0x0e,0x09,0x00,0x15,
+0x00,0x00,0x00,0x05,0x43,0x41,0x4c,0x4c,0x50,0x00,0x00,0x00,0x0e,0x0a,0x00,0x16,
+0x00,0x00,0x00,0x05,0x43,0x41,0x4c,0x4c,0x4d,0x00,0x00,0x00,0x0e,0x0b,0x00,0x17,
+0x00,0x00,0x00,0x05,0x52,0x41,0x4e,0x47,0x45,0x00,0x00,0x00,0x1c,0x06,0x07,0x05,
+0x25,0x04,0x05,0x06,0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x09,0x0e,0x06,0x00,0x04,
+0x00,0x00,0x00,0x04,0x73,0x70,0x61,0x6e,0x00,0x00,0x00,0x00,0x10,0x07,0x02,0x00,
+0x10,0x08,0x03,0x00,0x37,0x04,0x06,0x03,0x15,0x04,0x00,0x00,0x1f,0x0a,0x00,0x64,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,0x20,0x3d,0x3d,0x20,0x43,0x41,0x4c,0x4c,
+0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,0x62,0x2c,0x20,0x63,0x2c,0x20,
+0x63,0x20,0x2b,0x20,0x31,0x5d,0x00,0x00,0x0e,0x06,0x00,0x18,0x00,0x00,0x00,0x04,
+0x43,0x41,0x4c,0x4c,0x00,0x00,0x00,0x00,0x18,0x04,0x05,0x06,0x16,0x04,0x00,0x00,
+0x13,0x00,0x00,0x09,0x10,0x06,0x02,0x00,0x10,0x07,0x03,0x00,0x0c,0x09,0x00,0x05,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x08,0x03,0x09,0x1c,0x04,0x06,0x03,
+0x15,0x04,0x00,0x00,0x1f,0x0b,0x00,0x65,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,
+0x20,0x3d,0x3d,0x20,0x46,0x4f,0x52,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+0x5b,0x62,0x2c,0x20,0x62,0x20,0x2b,0x20,0x31,0x2c,0x20,0x62,0x20,0x2b,0x20,0x32,
+0x5d,0x00,0x00,0x00,0x0e,0x06,0x00,0x19,0x00,0x00,0x00,0x03,0x46,0x4f,0x52,0x00,
+0x18,0x04,0x05,0x06,0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x0c,0x10,0x06,0x02,0x00,
+0x0c,0x09,0x00,0x05,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x07,0x02,0x09,
+0x0c,0x09,0x00,0x08,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x01,0x08,0x02,0x09,
+0x1c,0x04,0x06,0x03,0x15,0x04,0x00,0x00,0x1f,0x09,0x00,0x66,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x69,0x20,0x3d,0x3d,0x20,0x4d,0x45,0x54,0x48,0x4f,0x44,0x3a,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,0x62,0x2c,0x20,0x63,0x5d,0x00,0x00,0x00,
+0x0e,0x06,0x00,0x1a,0x00,0x00,0x00,0x06,0x4d,0x45,0x54,0x48,0x4f,0x44,0x00,0x00,
+0x18,0x04,0x05,0x06,0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x05,0x10,0x06,0x02,0x00,
+0x10,0x07,0x03,0x00,0x1c,0x04,0x06,0x02,0x15,0x04,0x00,0x00,0x1f,0x11,0x00,0x67,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,0x20,0x69,0x6e,0x20,0x5b,0x49,0x46,0x2c,
+0x20,0x49,0x46,0x4e,0x2c,0x20,0x52,0x45,0x54,0x55,0x52,0x4e,0x2c,0x20,0x52,0x41,
+0x49,0x53,0x45,0x2c,0x20,0x45,0x4f,0x46,0x2c,0x20,0x46,0x49,0x4c,0x45,0x2c,0x20,
+0x4e,0x41,0x4d,0x45,0x5d,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,0x61,
+0x5d,0x00,0x00,0x00,0x0e,0x07,0x00,0x1b,0x00,0x00,0x00,0x02,0x49,0x46,0x00,0x00,
+0x0e,0x08,0x00,0x1c,0x00,0x00,0x00,0x03,0x49,0x46,0x4e,0x00,0x0e,0x09,0x00,0x1d,
+0x00,0x00,0x00,0x06,0x52,0x45,0x54,0x55,0x52,0x4e,0x00,0x00,0x0e,0x0a,0x00,0x1e,
+0x00,0x00,0x00,0x05,0x52,0x41,0x49,0x53,0x45,0x00,0x00,0x00,0x0e,0x0b,0x00,0x1f,
+0x00,0x00,0x00,0x03,0x45,0x4f,0x46,0x00,0x0e,0x0c,0x00,0x20,0x00,0x00,0x00,0x04,
+0x46,0x49,0x4c,0x45,0x00,0x00,0x00,0x00,0x0e,0x0d,0x00,0x21,0x00,0x00,0x00,0x04,
+0x4e,0x41,0x4d,0x45,0x00,0x00,0x00,0x00,0x1c,0x06,0x07,0x07,0x25,0x04,0x05,0x06,
+0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x04,0x10,0x06,0x01,0x00,0x1c,0x04,0x06,0x01,
+0x15,0x04,0x00,0x00,0x1f,0x08,0x00,0x68,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,
+0x20,0x3d,0x3d,0x20,0x49,0x54,0x45,0x52,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+0x20,0x5b,0x62,0x2c,0x20,0x63,0x5d,0x00,0x0e,0x06,0x00,0x22,0x00,0x00,0x00,0x04,
+0x49,0x54,0x45,0x52,0x00,0x00,0x00,0x00,0x18,0x04,0x05,0x06,0x16,0x04,0x00,0x00,
+0x13,0x00,0x00,0x05,0x10,0x06,0x02,0x00,0x10,0x07,0x03,0x00,0x1c,0x04,0x06,0x02,
+0x15,0x04,0x00,0x00,0x1f,0x0c,0x00,0x69,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,
+0x20,0x69,0x6e,0x20,0x5b,0x44,0x45,0x4c,0x2c,0x20,0x55,0x50,0x44,0x41,0x54,0x45,
+0x2c,0x20,0x47,0x53,0x45,0x54,0x5d,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+0x5b,0x61,0x2c,0x20,0x62,0x5d,0x00,0x00,0x0e,0x07,0x00,0x23,0x00,0x00,0x00,0x03,
+0x44,0x45,0x4c,0x00,0x0e,0x08,0x00,0x24,0x00,0x00,0x00,0x06,0x55,0x50,0x44,0x41,
+0x54,0x45,0x00,0x00,0x0e,0x09,0x00,0x25,0x00,0x00,0x00,0x04,0x47,0x53,0x45,0x54,
+0x00,0x00,0x00,0x00,0x1c,0x06,0x07,0x03,0x25,0x04,0x05,0x06,0x16,0x04,0x00,0x00,
+0x13,0x00,0x00,0x05,0x10,0x06,0x01,0x00,0x10,0x07,0x02,0x00,0x1c,0x04,0x06,0x02,
+0x15,0x04,0x00,0x00,0x1f,0x06,0x00,0x6a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x5b,0x61,0x2c,0x20,0x62,0x2c,0x20,0x63,0x5d,0x00,0x00,0x00,0x00,
+0x10,0x06,0x01,0x00,0x10,0x07,0x02,0x00,0x10,0x08,0x03,0x00,0x1c,0x04,0x06,0x03,
+0x15,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x43,0x00,0x00,0x00,0x04,
+0x75,0x73,0x65,0x73,0x00,0x00,0x00,0x00,0x0f,0x05,0x04,0x00,0x1f,0x04,0x00,0x6c,
+0x64,0x65,0x66,0x20,0x6b,0x69,0x6c,0x6c,0x73,0x28,0x6e,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x05,0x00,0x05,0x2a,0x24,0x31,0x31,0x36,0x00,0x00,0x00,0x0d,0x0a,0x00,0x41,
+0x00,0x00,0x00,0x01,0x6e,0x00,0x00,0x00,0x1c,0x06,0x0a,0x01,0x1c,0x07,0x00,0x00,
+0x1d,0x08,0x00,0x00,0x1d,0x09,0x00,0x00,0x11,0x05,0x00,0xb5,0x2d,0x05,0x00,0x0c,
+0x00,0x00,0x00,0x00,0x1f,0x04,0x00,0x6c,0x64,0x65,0x66,0x20,0x6b,0x69,0x6c,0x6c,
+0x73,0x28,0x6e,0x29,0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x6e,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,
+0x2e,0x70,0x79,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x05,
+0x6b,0x69,0x6c,0x6c,0x73,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x09,0x00,0x6e,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,0x5b,0x30,0x5d,0x20,0x3d,0x3d,0x20,0x27,
+0x66,0x6e,0x63,0x27,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,0x6e,0x5b,
+0x31,0x5d,0x5d,0x00,0x0c,0x02,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x01,0x00,0x02,0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x66,0x6e,0x63,0x00,
+0x18,0x01,0x01,0x02,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x07,0x0c,0x02,0x00,0x04,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x02,0x00,0x02,0x1c,0x01,0x02,0x01,
+0x15,0x01,0x00,0x00,0x1f,0x09,0x00,0x6f,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,
+0x5b,0x30,0x5d,0x20,0x21,0x3d,0x20,0x27,0x63,0x6f,0x64,0x65,0x27,0x3a,0x20,0x72,
+0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,0x5d,0x00,0x00,0x00,0x00,0x0c,0x02,0x00,0x02,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x01,0x00,0x02,0x0d,0x02,0x00,0x05,
+0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x24,0x01,0x01,0x02,
+0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x03,0x1c,0x01,0x00,0x00,0x15,0x01,0x00,0x00,
+0x1f,0x04,0x00,0x70,0x20,0x20,0x20,0x20,0x69,0x20,0x3d,0x20,0x6e,0x5b,0x31,0x5d,
+0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x69,0x00,0x00,0x00,0x0c,0x02,0x00,0x04,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x01,0x00,0x02,0x1f,0x09,0x00,0x71,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,0x20,0x69,0x6e,0x20,0x52,0x45,0x54,0x41,
+0x52,0x47,0x45,0x54,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,0x6e,0x5b,
+0x32,0x5d,0x5d,0x00,0x0e,0x02,0x00,0x06,0x00,0x00,0x00,0x08,0x52,0x45,0x54,0x41,
+0x52,0x47,0x45,0x54,0x00,0x00,0x00,0x00,0x25,0x02,0x01,0x02,0x16,0x02,0x00,0x00,
+0x13,0x00,0x00,0x07,0x0c,0x03,0x00,0x07,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,
+0x0a,0x02,0x00,0x03,0x1c,0x02,0x02,0x01,0x15,0x02,0x00,0x00,0x1f,0x0b,0x00,0x72,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,0x20,0x3d,0x3d,0x20,0x4d,0x45,0x54,0x48,
+0x4f,0x44,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,0x6e,0x5b,0x32,0x5d,
+0x2c,0x20,0x6e,0x5b,0x32,0x5d,0x20,0x2b,0x20,0x31,0x5d,0x00,0x0e,0x02,0x00,0x08,
+0x00,0x00,0x00,0x06,0x4d,0x45,0x54,0x48,0x4f,0x44,0x00,0x00,0x18,0x02,0x01,0x02,
+0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x0f,0x0c,0x04,0x00,0x07,0x00,0x00,0x69,0x04,
+0x02,0x00,0x00,0x00,0x0a,0x02,0x00,0x04,0x0c,0x04,0x00,0x07,0x00,0x00,0x69,0x04,
+0x02,0x00,0x00,0x00,0x0a,0x03,0x00,0x04,0x0c,0x04,0x00,0x04,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x01,0x03,0x03,0x04,0x1c,0x02,0x02,0x02,0x15,0x02,0x00,0x00,
+0x1f,0x0a,0x00,0x73,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,0x20,0x3d,0x3d,0x20,
+0x52,0x41,0x4e,0x47,0x45,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x70,
+0x61,0x6e,0x28,0x6e,0x5b,0x32,0x5d,0x2c,0x20,0x33,0x29,0x00,0x0e,0x02,0x00,0x09,
+0x00,0x00,0x00,0x05,0x52,0x41,0x4e,0x47,0x45,0x00,0x00,0x00,0x18,0x02,0x01,0x02,
+0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x0e,0x0e,0x02,0x00,0x0a,0x00,0x00,0x00,0x04,
+0x73,0x70,0x61,0x6e,0x00,0x00,0x00,0x00,0x0c,0x01,0x00,0x07,0x00,0x00,0x69,0x04,
+0x02,0x00,0x00,0x00,0x0a,0x03,0x00,0x01,0x0c,0x04,0x00,0x0b,0x00,0x00,0x69,0x04,
+0x03,0x00,0x00,0x00,0x37,0x02,0x02,0x03,0x15,0x02,0x00,0x00,0x1f,0x04,0x00,0x74,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,0x5d,0x00,0x00,0x00,
+0x1c,0x02,0x00,0x00,0x15,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x44,
+0x00,0x00,0x00,0x05,0x6b,0x69,0x6c,0x6c,0x73,0x00,0x00,0x00,0x0f,0x06,0x05,0x00,
+0x1f,0x06,0x00,0x76,0x64,0x65,0x66,0x20,0x69,0x6e,0x64,0x65,0x78,0x5f,0x74,0x61,
+0x67,0x73,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,0x3a,0x00,0x00,0x33,0x06,0x00,0x05,
+0x2a,0x24,0x31,0x32,0x33,0x00,0x00,0x00,0x0d,0x0b,0x00,0x3d,0x00,0x00,0x00,0x05,
+0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x1c,0x07,0x0b,0x01,0x1c,0x08,0x00,0x00,
+0x1d,0x09,0x00,0x00,0x1d,0x0a,0x00,0x00,0x11,0x06,0x00,0x6c,0x2d,0x08,0x00,0x07,
+0x00,0x00,0x00,0x00,0x1f,0x06,0x00,0x76,0x64,0x65,0x66,0x20,0x69,0x6e,0x64,0x65,
+0x78,0x5f,0x74,0x61,0x67,0x73,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,0x3a,0x00,0x00,
+0x33,0x00,0x00,0x05,0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x2e,0x70,0x79,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x0a,0x69,0x6e,0x64,0x65,
+0x78,0x5f,0x74,0x61,0x67,0x73,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x04,0x00,0x77,
+0x20,0x20,0x20,0x20,0x74,0x61,0x67,0x73,0x20,0x3d,0x20,0x7b,0x7d,0x00,0x00,0x00,
+0x33,0x01,0x00,0x04,0x74,0x61,0x67,0x73,0x00,0x00,0x00,0x00,0x1b,0x02,0x00,0x00,
+0x10,0x01,0x02,0x00,0x1f,0x08,0x00,0x78,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,
+0x6b,0x20,0x69,0x6e,0x20,0x72,0x61,0x6e,0x67,0x65,0x28,0x6c,0x65,0x6e,0x28,0x6e,
+0x6f,0x64,0x65,0x73,0x29,0x29,0x3a,0x00,0x0e,0x03,0x00,0x02,0x00,0x00,0x00,0x05,
+0x72,0x61,0x6e,0x67,0x65,0x00,0x00,0x00,0x0e,0x04,0x00,0x03,0x00,0x00,0x00,0x03,
+0x6c,0x65,0x6e,0x00,0x10,0x05,0x00,0x00,0x37,0x04,0x04,0x02,0x3a,0x05,0x03,0x02,
+0x3b,0x02,0x05,0x00,0x13,0x00,0x00,0x2a,0x33,0x03,0x00,0x01,0x6b,0x00,0x00,0x00,
+0x10,0x03,0x02,0x00,0x1f,0x09,0x00,0x79,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,0x5d,0x5b,0x30,0x5d,0x20,0x3d,
+0x3d,0x20,0x27,0x74,0x61,0x67,0x27,0x3a,0x00,0x00,0x00,0x00,0x0a,0x02,0x00,0x03,
+0x0c,0x04,0x00,0x04,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x02,0x02,0x04,
+0x0d,0x04,0x00,0x05,0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,0x18,0x02,0x02,0x04,
+0x16,0x02,0x00,0x00,0x13,0x00,0xff,0xe7,0x1f,0x09,0x00,0x7a,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x61,0x67,0x73,0x5b,0x6e,0x6f,0x64,
+0x65,0x73,0x5b,0x6b,0x5d,0x5b,0x31,0x5d,0x5d,0x20,0x3d,0x20,0x6b,0x00,0x00,0x00,
+0x0a,0x02,0x00,0x03,0x0c,0x04,0x00,0x06,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x02,0x02,0x04,0x0b,0x01,0x02,0x03,0x13,0x00,0xff,0xd6,0x1f,0x04,0x00,0x7b,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x61,0x67,0x73,0x00,
+0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x07,0x00,0x45,0x00,0x00,0x00,0x0a,
+0x69,0x6e,0x64,0x65,0x78,0x5f,0x74,0x61,0x67,0x73,0x00,0x00,0x0f,0x07,0x06,0x00,
+0x1f,0x07,0x00,0x7d,0x64,0x65,0x66,0x20,0x6e,0x65,0x78,0x74,0x5f,0x6e,0x6f,0x64,
+0x65,0x28,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x6b,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x07,0x00,0x05,0x2a,0x24,0x31,0x33,0x30,0x00,0x00,0x00,0x0d,0x0c,0x00,0x3d,
+0x00,0x00,0x00,0x05,0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x0d,0x0d,0x00,0x46,
+0x00,0x00,0x00,0x01,0x6b,0x00,0x00,0x00,0x1c,0x08,0x0c,0x02,0x1c,0x09,0x00,0x00,
+0x1d,0x0a,0x00,0x00,0x1d,0x0b,0x00,0x00,0x11,0x07,0x00,0x52,0x2d,0x04,0x00,0x06,
+0x00,0x00,0x00,0x00,0x1f,0x07,0x00,0x7d,0x64,0x65,0x66,0x20,0x6e,0x65,0x78,0x74,
+0x5f,0x6e,0x6f,0x64,0x65,0x28,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x6b,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x05,0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,
+0x33,0x01,0x00,0x01,0x6b,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x1b,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x2e,0x70,0x79,0x00,0x22,0x02,0x00,0x00,
+0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x09,0x6e,0x65,0x78,0x74,0x5f,0x6e,0x6f,0x64,
+0x65,0x00,0x00,0x00,0x23,0x02,0x00,0x00,0x1f,0x0d,0x00,0x7f,0x20,0x20,0x20,0x20,
+0x77,0x68,0x69,0x6c,0x65,0x20,0x6b,0x20,0x3c,0x20,0x6c,0x65,0x6e,0x28,0x6e,0x6f,
+0x64,0x65,0x73,0x29,0x20,0x61,0x6e,0x64,0x20,0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,
+0x5d,0x5b,0x30,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x74,0x61,0x67,0x27,0x3a,0x00,0x00,
+0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x10,0x03,0x00,0x00,
+0x37,0x03,0x02,0x02,0x1a,0x02,0x01,0x03,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x0a,
+0x0a,0x02,0x00,0x01,0x0c,0x03,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x02,0x02,0x03,0x0d,0x03,0x00,0x04,0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,
+0x18,0x02,0x02,0x03,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x0b,0x1f,0x04,0x00,0x80,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6b,0x20,0x2b,0x3d,0x20,0x31,0x00,0x00,
+0x0c,0x03,0x00,0x05,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x03,
+0x13,0x00,0xff,0xe4,0x1f,0x04,0x00,0x81,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x6b,0x00,0x00,0x00,0x00,0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x08,0x00,0x47,0x00,0x00,0x00,0x09,0x6e,0x65,0x78,0x74,0x5f,0x6e,0x6f,0x64,
+0x65,0x00,0x00,0x00,0x0f,0x08,0x07,0x00,0x1f,0x07,0x00,0x83,0x64,0x65,0x66,0x20,
+0x61,0x66,0x74,0x65,0x72,0x5f,0x73,0x6b,0x69,0x70,0x28,0x6e,0x6f,0x64,0x65,0x73,
+0x2c,0x20,0x6b,0x29,0x3a,0x00,0x00,0x00,0x33,0x08,0x00,0x05,0x2a,0x24,0x31,0x33,
+0x38,0x00,0x00,0x00,0x0d,0x0d,0x00,0x3d,0x00,0x00,0x00,0x05,0x6e,0x6f,0x64,0x65,
+0x73,0x00,0x00,0x00,0x0d,0x0e,0x00,0x46,0x00,0x00,0x00,0x01,0x6b,0x00,0x00,0x00,
+0x1c,0x09,0x0d,0x02,0x1c,0x0a,0x00,0x00,0x1d,0x0b,0x00,0x00,0x1d,0x0c,0x00,0x00,
+0x11,0x08,0x00,0x80,0x2d,0x04,0x00,0x07,0x00,0x00,0x00,0x00,0x1f,0x07,0x00,0x83,
+0x64,0x65,0x66,0x20,0x61,0x66,0x74,0x65,0x72,0x5f,0x73,0x6b,0x69,0x70,0x28,0x6e,
+0x6f,0x64,0x65,0x73,0x2c,0x20,0x6b,0x29,0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x05,
+0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x6b,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,
+0x2e,0x70,0x79,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x0a,
+0x61,0x66,0x74,0x65,0x72,0x5f,0x73,0x6b,0x69,0x70,0x00,0x00,0x23,0x02,0x00,0x00,
+0x1f,0x03,0x00,0x85,0x20,0x20,0x20,0x20,0x6b,0x20,0x2d,0x3d,0x20,0x31,0x00,0x00,
+0x0c,0x03,0x00,0x02,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x02,0x01,0x01,0x03,
+0x1f,0x0b,0x00,0x86,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x6b,0x20,
+0x3e,0x3d,0x20,0x30,0x20,0x61,0x6e,0x64,0x20,0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,
+0x5d,0x5b,0x30,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x74,0x61,0x67,0x27,0x3a,0x00,0x00,
+0x0c,0x03,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x35,0x02,0x01,0x03,
+0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x0a,0x0a,0x02,0x00,0x01,0x0c,0x03,0x00,0x03,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x02,0x02,0x03,0x0d,0x03,0x00,0x04,
+0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,0x18,0x02,0x02,0x03,0x16,0x02,0x00,0x00,
+0x13,0x00,0x00,0x0b,0x1f,0x04,0x00,0x87,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6b,0x20,0x2d,0x3d,0x20,0x31,0x00,0x00,0x0c,0x03,0x00,0x02,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x02,0x01,0x01,0x03,0x13,0x00,0xff,0xe6,0x1f,0x12,0x00,0x88,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6b,0x20,0x3e,0x3d,0x20,
+0x30,0x20,0x61,0x6e,0x64,0x20,0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,0x5d,0x5b,0x30,
+0x5d,0x20,0x3d,0x3d,0x20,0x27,0x63,0x6f,0x64,0x65,0x27,0x20,0x61,0x6e,0x64,0x20,
+0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,0x5d,0x5b,0x31,0x5d,0x20,0x69,0x6e,0x20,0x53,
+0x4b,0x49,0x50,0x53,0x00,0x00,0x00,0x00,0x0c,0x03,0x00,0x03,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x35,0x02,0x01,0x03,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x0b,
+0x0a,0x02,0x00,0x01,0x0c,0x03,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x02,0x02,0x03,0x0d,0x03,0x00,0x05,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,
+0x00,0x00,0x00,0x00,0x18,0x02,0x02,0x03,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x0b,
+0x0a,0x02,0x00,0x01,0x0c,0x03,0x00,0x02,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x02,0x02,0x03,0x0e,0x03,0x00,0x06,0x00,0x00,0x00,0x05,0x53,0x4b,0x49,0x50,
+0x53,0x00,0x00,0x00,0x25,0x02,0x02,0x03,0x15,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x09,0x00,0x48,0x00,0x00,0x00,0x0a,0x61,0x66,0x74,0x65,0x72,0x5f,0x73,0x6b,
+0x69,0x70,0x00,0x00,0x0f,0x09,0x08,0x00,0x1f,0x08,0x00,0x8a,0x64,0x65,0x66,0x20,
+0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x6f,0x72,0x73,0x28,0x6e,0x6f,0x64,0x65,0x73,
+0x2c,0x20,0x74,0x61,0x67,0x73,0x2c,0x20,0x6b,0x29,0x3a,0x00,0x33,0x09,0x00,0x05,
+0x2a,0x24,0x31,0x34,0x36,0x00,0x00,0x00,0x0d,0x0e,0x00,0x3d,0x00,0x00,0x00,0x05,
+0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x0d,0x0f,0x00,0x49,0x00,0x00,0x00,0x04,
+0x74,0x61,0x67,0x73,0x00,0x00,0x00,0x00,0x0d,0x10,0x00,0x46,0x00,0x00,0x00,0x01,
+0x6b,0x00,0x00,0x00,0x1c,0x0a,0x0e,0x03,0x1c,0x0b,0x00,0x00,0x1d,0x0c,0x00,0x00,
+0x1d,0x0d,0x00,0x00,0x11,0x09,0x00,0xd5,0x2d,0x09,0x00,0x0b,0x00,0x00,0x00,0x00,
+0x1f,0x08,0x00,0x8a,0x64,0x65,0x66,0x20,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x6f,
+0x72,0x73,0x28,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x74,0x61,0x67,0x73,0x2c,0x20,
+0x6b,0x29,0x3a,0x00,0x33,0x00,0x00,0x05,0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,
+0x33,0x01,0x00,0x04,0x74,0x61,0x67,0x73,0x00,0x00,0x00,0x00,0x33,0x02,0x00,0x01,
+0x6b,0x00,0x00,0x00,0x0d,0x03,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x65,0x65,0x70,
+0x68,0x6f,0x6c,0x65,0x2e,0x70,0x79,0x00,0x22,0x03,0x00,0x00,0x0d,0x03,0x00,0x01,
+0x00,0x00,0x00,0x0a,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x6f,0x72,0x73,0x00,0x00,
+0x23,0x03,0x00,0x00,0x1f,0x05,0x00,0x8b,0x20,0x20,0x20,0x20,0x6e,0x20,0x3d,0x20,
+0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,0x5d,0x00,0x00,0x00,0x00,0x33,0x03,0x00,0x01,
+0x6e,0x00,0x00,0x00,0x0a,0x03,0x00,0x02,0x1f,0x06,0x00,0x8c,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x6e,0x5b,0x30,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x6a,0x75,0x6d,0x70,
+0x27,0x3a,0x00,0x00,0x0c,0x04,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x05,0x03,0x04,0x0d,0x04,0x00,0x03,0x00,0x00,0x00,0x04,0x6a,0x75,0x6d,0x70,
+0x00,0x00,0x00,0x00,0x18,0x05,0x05,0x04,0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x10,
+0x1f,0x07,0x00,0x8d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x5b,0x74,0x61,0x67,0x73,0x5b,0x6e,0x5b,0x31,0x5d,0x5d,0x5d,0x00,
+0x0c,0x07,0x00,0x04,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x06,0x03,0x07,
+0x0a,0x04,0x01,0x06,0x1c,0x05,0x04,0x01,0x15,0x05,0x00,0x00,0x1f,0x06,0x00,0x8e,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,0x5b,0x30,0x5d,0x20,0x3d,0x3d,0x20,0x27,
+0x63,0x6f,0x64,0x65,0x27,0x3a,0x00,0x00,0x0c,0x04,0x00,0x02,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x05,0x03,0x04,0x0d,0x04,0x00,0x05,0x00,0x00,0x00,0x04,
+0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x18,0x05,0x05,0x04,0x16,0x05,0x00,0x00,
+0x13,0x00,0x00,0x69,0x1f,0x0b,0x00,0x8f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x6e,0x5b,0x31,0x5d,0x20,0x69,0x6e,0x20,0x5b,0x52,0x45,0x54,0x55,
+0x52,0x4e,0x2c,0x20,0x52,0x41,0x49,0x53,0x45,0x2c,0x20,0x45,0x4f,0x46,0x5d,0x3a,
+0x00,0x00,0x00,0x00,0x0c,0x04,0x00,0x04,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x05,0x03,0x04,0x0e,0x06,0x00,0x06,0x00,0x00,0x00,0x06,0x52,0x45,0x54,0x55,
+0x52,0x4e,0x00,0x00,0x0e,0x07,0x00,0x07,0x00,0x00,0x00,0x05,0x52,0x41,0x49,0x53,
+0x45,0x00,0x00,0x00,0x0e,0x08,0x00,0x08,0x00,0x00,0x00,0x03,0x45,0x4f,0x46,0x00,
+0x1c,0x04,0x06,0x03,0x25,0x05,0x05,0x04,0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x0a,
+0x1f,0x06,0x00,0x90,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,0x5d,0x00,0x00,0x00,0x1c,0x05,0x00,0x00,
+0x15,0x05,0x00,0x00,0x1f,0x07,0x00,0x91,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x6e,0x5b,0x31,0x5d,0x20,0x69,0x6e,0x20,0x53,0x4b,0x49,0x50,0x53,
+0x3a,0x00,0x00,0x00,0x0c,0x04,0x00,0x04,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x05,0x03,0x04,0x0e,0x04,0x00,0x09,0x00,0x00,0x00,0x05,0x53,0x4b,0x49,0x50,
+0x53,0x00,0x00,0x00,0x25,0x05,0x05,0x04,0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x2e,
+0x1f,0x0b,0x00,0x92,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6b,0x32,0x20,0x3d,0x20,0x6e,0x65,0x78,0x74,0x5f,0x6e,0x6f,0x64,0x65,0x28,0x6e,
+0x6f,0x64,0x65,0x73,0x2c,0x20,0x6b,0x20,0x2b,0x20,0x31,0x29,0x00,0x00,0x00,0x00,
+0x33,0x05,0x00,0x02,0x6b,0x32,0x00,0x00,0x0e,0x06,0x00,0x0a,0x00,0x00,0x00,0x09,
+0x6e,0x65,0x78,0x74,0x5f,0x6e,0x6f,0x64,0x65,0x00,0x00,0x00,0x10,0x07,0x00,0x00,
+0x0c,0x00,0x00,0x04,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x08,0x02,0x00,
+0x37,0x05,0x06,0x03,0x1f,0x09,0x00,0x93,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,0x6b,0x20,0x2b,0x20,
+0x31,0x2c,0x20,0x6b,0x32,0x20,0x2b,0x20,0x31,0x5d,0x00,0x00,0x0c,0x08,0x00,0x04,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x06,0x02,0x08,0x0c,0x08,0x00,0x04,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x07,0x05,0x08,0x1c,0x04,0x06,0x02,
+0x15,0x04,0x00,0x00,0x1f,0x05,0x00,0x94,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x5b,0x6b,0x20,0x2b,0x20,0x31,0x5d,0x00,0x00,0x0c,0x07,0x00,0x04,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x06,0x02,0x07,0x1c,0x04,0x06,0x01,
+0x15,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x0a,0x00,0x4a,0x00,0x00,0x00,0x0a,
+0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x6f,0x72,0x73,0x00,0x00,0x0f,0x0a,0x09,0x00,
+0x1f,0x0b,0x00,0x96,0x64,0x65,0x66,0x20,0x6c,0x69,0x76,0x65,0x28,0x6e,0x6f,0x64,
+0x65,0x73,0x2c,0x20,0x74,0x61,0x67,0x73,0x2c,0x20,0x68,0x61,0x6e,0x64,0x6c,0x65,
+0x72,0x73,0x2c,0x20,0x73,0x74,0x61,0x72,0x74,0x73,0x2c,0x20,0x72,0x29,0x3a,0x00,
+0x33,0x0a,0x00,0x05,0x2a,0x24,0x31,0x35,0x35,0x00,0x00,0x00,0x0d,0x0f,0x00,0x3d,
+0x00,0x00,0x00,0x05,0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x0d,0x10,0x00,0x49,
+0x00,0x00,0x00,0x04,0x74,0x61,0x67,0x73,0x00,0x00,0x00,0x00,0x0d,0x11,0x00,0x4b,
+0x00,0x00,0x00,0x08,0x68,0x61,0x6e,0x64,0x6c,0x65,0x72,0x73,0x00,0x00,0x00,0x00,
+0x0d,0x12,0x00,0x4c,0x00,0x00,0x00,0x06,0x73,0x74,0x61,0x72,0x74,0x73,0x00,0x00,
+0x0d,0x13,0x00,0x4d,0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,0x1c,0x0b,0x0f,0x05,
+0x1c,0x0c,0x00,0x00,0x1d,0x0d,0x00,0x00,0x1d,0x0e,0x00,0x00,0x11,0x0a,0x00,0xf2,
+0x2d,0x0e,0x00,0x0a,0x00,0x00,0x00,0x02,0x1f,0x0b,0x00,0x96,0x64,0x65,0x66,0x20,
+0x6c,0x69,0x76,0x65,0x28,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x74,0x61,0x67,0x73,
+0x2c,0x20,0x68,0x61,0x6e,0x64,0x6c,0x65,0x72,0x73,0x2c,0x20,0x73,0x74,0x61,0x72,
+0x74,0x73,0x2c,0x20,0x72,0x29,0x3a,0x00,0x33,0x00,0x00,0x05,0x6e,0x6f,0x64,0x65,
+0x73,0x00,0x00,0x00,0x33,0x01,0x00,0x04,0x74,0x61,0x67,0x73,0x00,0x00,0x00,0x00,
+0x33,0x02,0x00,0x08,0x68,0x61,0x6e,0x64,0x6c,0x65,0x72,0x73,0x00,0x00,0x00,0x00,
+0x33,0x03,0x00,0x06,0x73,0x74,0x61,0x72,0x74,0x73,0x00,0x00,0x33,0x04,0x00,0x01,
+0x72,0x00,0x00,0x00,0x0d,0x05,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x65,0x65,0x70,
+0x68,0x6f,0x6c,0x65,0x2e,0x70,0x79,0x00,0x22,0x05,0x00,0x00,0x0d,0x05,0x00,0x01,
+0x00,0x00,0x00,0x04,0x6c,0x69,0x76,0x65,0x00,0x00,0x00,0x00,0x23,0x05,0x00,0x00,
+0x1f,0x08,0x00,0x99,0x20,0x20,0x20,0x20,0x74,0x6f,0x64,0x6f,0x20,0x3d,0x20,0x73,
+0x74,0x61,0x72,0x74,0x73,0x20,0x2b,0x20,0x68,0x61,0x6e,0x64,0x6c,0x65,0x72,0x73,
+0x00,0x00,0x00,0x00,0x33,0x05,0x00,0x04,0x74,0x6f,0x64,0x6f,0x00,0x00,0x00,0x00,
+0x01,0x05,0x03,0x02,0x1f,0x04,0x00,0x9a,0x20,0x20,0x20,0x20,0x73,0x65,0x65,0x6e,
+0x20,0x3d,0x20,0x7b,0x7d,0x00,0x00,0x00,0x33,0x02,0x00,0x04,0x73,0x65,0x65,0x6e,
+0x00,0x00,0x00,0x00,0x1b,0x02,0x00,0x00,0x1f,0x06,0x00,0x9b,0x20,0x20,0x20,0x20,
+0x77,0x68,0x69,0x6c,0x65,0x20,0x6c,0x65,0x6e,0x28,0x74,0x6f,0x64,0x6f,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x02,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,
+0x10,0x07,0x05,0x00,0x37,0x03,0x06,0x02,0x16,0x03,0x00,0x00,0x13,0x00,0x00,0x97,
+0x1f,0x06,0x00,0x9c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6b,0x20,0x3d,0x20,
+0x74,0x6f,0x64,0x6f,0x2e,0x70,0x6f,0x70,0x28,0x29,0x00,0x00,0x33,0x03,0x00,0x01,
+0x6b,0x00,0x00,0x00,0x0d,0x09,0x00,0x03,0x00,0x00,0x00,0x03,0x70,0x6f,0x70,0x00,
+0x38,0x07,0x05,0x09,0x00,0x00,0x00,0x00,0x39,0x03,0x07,0x02,0x1f,0x0b,0x00,0x9d,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6b,0x20,0x3e,0x3d,0x20,
+0x6c,0x65,0x6e,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,0x20,0x6f,0x72,0x20,0x6b,0x20,
+0x69,0x6e,0x20,0x73,0x65,0x65,0x6e,0x3a,0x00,0x00,0x00,0x00,0x0e,0x08,0x00,0x02,
+0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x10,0x09,0x00,0x00,0x37,0x07,0x08,0x02,
+0x35,0x06,0x03,0x07,0x2f,0x06,0x00,0x00,0x13,0x00,0x00,0x02,0x25,0x06,0x03,0x02,
+0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x09,0x1f,0x06,0x00,0x9e,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,
+0x00,0x00,0x00,0x00,0x13,0x00,0xff,0xcc,0x1f,0x06,0x00,0x9f,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x73,0x65,0x65,0x6e,0x5b,0x6b,0x5d,0x20,0x3d,0x20,0x54,0x72,
+0x75,0x65,0x00,0x00,0x0c,0x06,0x00,0x04,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0b,0x02,0x03,0x06,0x1f,0x06,0x00,0xa0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6e,0x20,0x3d,0x20,0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,0x5d,0x00,0x00,0x00,0x00,
+0x33,0x06,0x00,0x01,0x6e,0x00,0x00,0x00,0x0a,0x06,0x00,0x03,0x1f,0x07,0x00,0xa1,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x72,0x20,0x69,0x6e,0x20,
+0x75,0x73,0x65,0x73,0x28,0x6e,0x29,0x3a,0x00,0x00,0x00,0x00,0x0e,0x09,0x00,0x05,
+0x00,0x00,0x00,0x04,0x75,0x73,0x65,0x73,0x00,0x00,0x00,0x00,0x10,0x0a,0x06,0x00,
+0x37,0x08,0x09,0x02,0x25,0x07,0x04,0x08,0x16,0x07,0x00,0x00,0x13,0x00,0x00,0x0c,
+0x1f,0x06,0x00,0xa2,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x54,0x72,0x75,0x65,0x00,0x0c,0x07,0x00,0x04,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x15,0x07,0x00,0x00,0x1f,0x07,0x00,0xa3,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x72,0x20,0x69,0x6e,0x20,
+0x6b,0x69,0x6c,0x6c,0x73,0x28,0x6e,0x29,0x3a,0x00,0x00,0x00,0x0e,0x09,0x00,0x06,
+0x00,0x00,0x00,0x05,0x6b,0x69,0x6c,0x6c,0x73,0x00,0x00,0x00,0x10,0x0a,0x06,0x00,
+0x37,0x08,0x09,0x02,0x25,0x07,0x04,0x08,0x16,0x07,0x00,0x00,0x13,0x00,0x00,0x09,
+0x1f,0x06,0x00,0xa4,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x00,0x00,0x00,0x00,0x13,0x00,0xff,0x82,
+0x1f,0x0c,0x00,0xa5,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,0x64,0x6f,
+0x2e,0x65,0x78,0x74,0x65,0x6e,0x64,0x28,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x6f,
+0x72,0x73,0x28,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x74,0x61,0x67,0x73,0x2c,0x20,
+0x6b,0x29,0x29,0x00,0x0d,0x0a,0x00,0x07,0x00,0x00,0x00,0x06,0x65,0x78,0x74,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x08,0x05,0x0a,0x00,0x00,0x00,0x01,0x0e,0x0a,0x00,0x08,
+0x00,0x00,0x00,0x0a,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x6f,0x72,0x73,0x00,0x00,
+0x10,0x0b,0x00,0x00,0x10,0x0c,0x01,0x00,0x10,0x0d,0x03,0x00,0x37,0x0a,0x0a,0x04,
+0x39,0x07,0x08,0x03,0x13,0x00,0xff,0x64,0x1f,0x05,0x00,0xa6,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x46,0x61,0x6c,0x73,0x65,0x00,0x00,0x00,0x00,
+0x0c,0x07,0x00,0x09,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x15,0x07,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x0b,0x00,0x4e,0x00,0x00,0x00,0x04,0x6c,0x69,0x76,0x65,
+0x00,0x00,0x00,0x00,0x0f,0x0b,0x0a,0x00,0x1f,0x05,0x00,0xa8,0x64,0x65,0x66,0x20,
+0x69,0x73,0x5f,0x63,0x6f,0x64,0x65,0x28,0x6e,0x2c,0x20,0x69,0x29,0x3a,0x00,0x00,
+0x33,0x0b,0x00,0x05,0x2a,0x24,0x31,0x36,0x36,0x00,0x00,0x00,0x0d,0x10,0x00,0x41,
+0x00,0x00,0x00,0x01,0x6e,0x00,0x00,0x00,0x0d,0x11,0x00,0x3a,0x00,0x00,0x00,0x01,
+0x69,0x00,0x00,0x00,0x1c,0x0c,0x10,0x02,0x1c,0x0d,0x00,0x00,0x1d,0x0e,0x00,0x00,
+0x1d,0x0f,0x00,0x00,0x11,0x0b,0x00,0x39,0x2d,0x04,0x00,0x05,0x00,0x00,0x00,0x00,
+0x1f,0x05,0x00,0xa8,0x64,0x65,0x66,0x20,0x69,0x73,0x5f,0x63,0x6f,0x64,0x65,0x28,
+0x6e,0x2c,0x20,0x69,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x01,0x6e,0x00,0x00,0x00,
+0x33,0x01,0x00,0x01,0x69,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x1b,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x2e,0x70,0x79,0x00,0x22,0x02,0x00,0x00,
+0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x07,0x69,0x73,0x5f,0x63,0x6f,0x64,0x65,0x00,
+0x23,0x02,0x00,0x00,0x1f,0x0a,0x00,0xa9,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x6e,0x5b,0x30,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x63,0x6f,0x64,0x65,
+0x27,0x20,0x61,0x6e,0x64,0x20,0x6e,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x69,0x00,
+0x0c,0x03,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x02,0x00,0x03,
+0x0d,0x03,0x00,0x03,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,
+0x18,0x02,0x02,0x03,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x06,0x0c,0x03,0x00,0x04,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x02,0x00,0x03,0x18,0x02,0x02,0x01,
+0x15,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x0c,0x00,0x4f,0x00,0x00,0x00,0x07,
+0x69,0x73,0x5f,0x63,0x6f,0x64,0x65,0x00,0x0f,0x0c,0x0b,0x00,0x1f,0x06,0x00,0xab,
+0x64,0x65,0x66,0x20,0x72,0x65,0x6d,0x6f,0x76,0x65,0x5f,0x64,0x65,0x61,0x64,0x28,
+0x6e,0x6f,0x64,0x65,0x73,0x29,0x3a,0x00,0x33,0x0c,0x00,0x05,0x2a,0x24,0x31,0x37,
+0x34,0x00,0x00,0x00,0x0d,0x11,0x00,0x3d,0x00,0x00,0x00,0x05,0x6e,0x6f,0x64,0x65,
+0x73,0x00,0x00,0x00,0x1c,0x0d,0x11,0x01,0x1c,0x0e,0x00,0x00,0x1d,0x0f,0x00,0x00,
+0x1d,0x10,0x00,0x00,0x11,0x0c,0x01,0x41,0x2d,0x08,0x00,0x0e,0x00,0x00,0x00,0x00,
+0x1f,0x06,0x00,0xab,0x64,0x65,0x66,0x20,0x72,0x65,0x6d,0x6f,0x76,0x65,0x5f,0x64,
+0x65,0x61,0x64,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,0x3a,0x00,0x33,0x00,0x00,0x05,
+0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x1b,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x2e,0x70,0x79,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x0b,0x72,0x65,0x6d,0x6f,0x76,0x65,0x5f,0x64,
+0x65,0x61,0x64,0x00,0x23,0x01,0x00,0x00,0x1f,0x05,0x00,0xae,0x20,0x20,0x20,0x20,
+0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x20,0x3d,0x20,0x46,0x61,0x6c,0x73,0x65,0x00,
+0x33,0x01,0x00,0x07,0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x00,0x0c,0x01,0x00,0x02,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x1f,0x03,0x00,0xaf,0x20,0x20,0x20,0x20,
+0x6b,0x20,0x3d,0x20,0x30,0x00,0x00,0x00,0x33,0x02,0x00,0x01,0x6b,0x00,0x00,0x00,
+0x0c,0x02,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x1f,0x07,0x00,0xb0,
+0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x6b,0x20,0x3c,0x20,0x6c,0x65,
+0x6e,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,0x3a,0x00,0x00,0x00,0x0e,0x03,0x00,0x03,
+0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x10,0x04,0x00,0x00,0x37,0x06,0x03,0x02,
+0x1a,0x05,0x02,0x06,0x16,0x05,0x00,0x00,0x13,0x00,0x00,0xf8,0x1f,0x06,0x00,0xb1,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x20,0x3d,0x20,0x6e,0x6f,0x64,0x65,
+0x73,0x5b,0x6b,0x5d,0x00,0x00,0x00,0x00,0x33,0x05,0x00,0x01,0x6e,0x00,0x00,0x00,
+0x0a,0x05,0x00,0x02,0x1f,0x04,0x00,0xb2,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6b,0x20,0x2b,0x3d,0x20,0x31,0x00,0x00,0x0c,0x03,0x00,0x04,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x01,0x02,0x02,0x03,0x1f,0x13,0x00,0xb3,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,0x6f,0x74,0x20,0x28,0x6e,0x5b,0x30,0x5d,
+0x20,0x3d,0x3d,0x20,0x27,0x6a,0x75,0x6d,0x70,0x27,0x20,0x6f,0x72,0x20,0x69,0x73,
+0x5f,0x63,0x6f,0x64,0x65,0x28,0x6e,0x2c,0x20,0x52,0x45,0x54,0x55,0x52,0x4e,0x29,
+0x20,0x6f,0x72,0x20,0x69,0x73,0x5f,0x63,0x6f,0x64,0x65,0x28,0x6e,0x2c,0x20,0x52,
+0x41,0x49,0x53,0x45,0x29,0x29,0x3a,0x00,0x0c,0x04,0x00,0x02,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x03,0x05,0x04,0x0d,0x04,0x00,0x05,0x00,0x00,0x00,0x04,
+0x6a,0x75,0x6d,0x70,0x00,0x00,0x00,0x00,0x18,0x03,0x03,0x04,0x2f,0x03,0x00,0x00,
+0x13,0x00,0x00,0x0a,0x0e,0x04,0x00,0x06,0x00,0x00,0x00,0x07,0x69,0x73,0x5f,0x63,
+0x6f,0x64,0x65,0x00,0x0e,0x06,0x00,0x07,0x00,0x00,0x00,0x06,0x52,0x45,0x54,0x55,
+0x52,0x4e,0x00,0x00,0x37,0x03,0x04,0x03,0x2f,0x03,0x00,0x00,0x13,0x00,0x00,0x0a,
+0x0e,0x04,0x00,0x06,0x00,0x00,0x00,0x07,0x69,0x73,0x5f,0x63,0x6f,0x64,0x65,0x00,
+0x0e,0x06,0x00,0x08,0x00,0x00,0x00,0x05,0x52,0x41,0x49,0x53,0x45,0x00,0x00,0x00,
+0x37,0x03,0x04,0x03,0x2f,0x03,0x00,0x00,0x13,0x00,0x00,0x09,0x1f,0x06,0x00,0xb4,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,
+0x69,0x6e,0x75,0x65,0x00,0x00,0x00,0x00,0x13,0x00,0xff,0xa9,0x1f,0x0a,0x00,0xb5,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x61,0x66,0x74,0x65,0x72,
+0x5f,0x73,0x6b,0x69,0x70,0x28,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x6b,0x20,0x2d,
+0x20,0x31,0x29,0x3a,0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x09,0x00,0x00,0x00,0x0a,
+0x61,0x66,0x74,0x65,0x72,0x5f,0x73,0x6b,0x69,0x70,0x00,0x00,0x10,0x04,0x00,0x00,
+0x0c,0x06,0x00,0x04,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x02,0x05,0x02,0x06,
+0x37,0x06,0x03,0x03,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x09,0x1f,0x06,0x00,0xb6,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,
+0x69,0x6e,0x75,0x65,0x00,0x00,0x00,0x00,0x13,0x00,0xff,0x89,0x1f,0x0e,0x00,0xb7,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x6b,0x20,
+0x3c,0x20,0x6c,0x65,0x6e,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,0x20,0x61,0x6e,0x64,
+0x20,0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,0x5d,0x5b,0x30,0x5d,0x20,0x21,0x3d,0x20,
+0x27,0x74,0x61,0x67,0x27,0x3a,0x00,0x00,0x0e,0x04,0x00,0x03,0x00,0x00,0x00,0x03,
+0x6c,0x65,0x6e,0x00,0x10,0x05,0x00,0x00,0x37,0x03,0x04,0x02,0x1a,0x06,0x02,0x03,
+0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x0a,0x0a,0x06,0x00,0x02,0x0c,0x03,0x00,0x02,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x06,0x06,0x03,0x0d,0x03,0x00,0x0a,
+0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,0x24,0x06,0x06,0x03,0x16,0x06,0x00,0x00,
+0x13,0x00,0xff,0x67,0x1f,0x07,0x00,0xb8,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6d,0x20,0x3d,0x20,0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,0x5d,
+0x00,0x00,0x00,0x00,0x33,0x06,0x00,0x01,0x6d,0x00,0x00,0x00,0x0a,0x06,0x00,0x02,
+0x1f,0x13,0x00,0xb9,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x6e,0x6f,0x74,0x20,0x28,0x69,0x73,0x5f,0x63,0x6f,0x64,0x65,0x28,
+0x6d,0x2c,0x20,0x45,0x4f,0x46,0x29,0x20,0x6f,0x72,0x20,0x69,0x73,0x5f,0x63,0x6f,
+0x64,0x65,0x28,0x6d,0x2c,0x20,0x56,0x41,0x52,0x29,0x20,0x6f,0x72,0x20,0x6d,0x5b,
+0x30,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x64,0x65,0x61,0x64,0x27,0x29,0x3a,0x00,0x00,
+0x0e,0x05,0x00,0x06,0x00,0x00,0x00,0x07,0x69,0x73,0x5f,0x63,0x6f,0x64,0x65,0x00,
+0x0e,0x07,0x00,0x0b,0x00,0x00,0x00,0x03,0x45,0x4f,0x46,0x00,0x37,0x04,0x05,0x03,
+0x2f,0x04,0x00,0x00,0x13,0x00,0x00,0x09,0x0e,0x05,0x00,0x06,0x00,0x00,0x00,0x07,
+0x69,0x73,0x5f,0x63,0x6f,0x64,0x65,0x00,0x0e,0x07,0x00,0x0c,0x00,0x00,0x00,0x03,
+0x56,0x41,0x52,0x00,0x37,0x04,0x05,0x03,0x2f,0x04,0x00,0x00,0x13,0x00,0x00,0x0a,
+0x0c,0x05,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x04,0x06,0x05,
+0x0d,0x05,0x00,0x0d,0x00,0x00,0x00,0x04,0x64,0x65,0x61,0x64,0x00,0x00,0x00,0x00,
+0x18,0x04,0x04,0x05,0x2f,0x04,0x00,0x00,0x13,0x00,0x00,0x1d,0x1f,0x09,0x00,0xba,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,0x5d,0x20,0x3d,0x20,0x5b,0x27,0x64,0x65,0x61,
+0x64,0x27,0x5d,0x00,0x0d,0x04,0x00,0x0d,0x00,0x00,0x00,0x04,0x64,0x65,0x61,0x64,
+0x00,0x00,0x00,0x00,0x1c,0x03,0x04,0x01,0x0b,0x00,0x02,0x03,0x1f,0x08,0x00,0xbb,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x20,0x3d,0x20,0x54,0x72,0x75,0x65,0x00,0x00,
+0x0c,0x01,0x00,0x04,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x1f,0x05,0x00,0xbc,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6b,0x20,0x2b,0x3d,
+0x20,0x31,0x00,0x00,0x0c,0x04,0x00,0x04,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x01,0x02,0x02,0x04,0x13,0x00,0xff,0x89,0x1f,0x05,0x00,0xbd,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x00,0x00,
+0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x0d,0x00,0x50,0x00,0x00,0x00,0x0b,
+0x72,0x65,0x6d,0x6f,0x76,0x65,0x5f,0x64,0x65,0x61,0x64,0x00,0x0f,0x0d,0x0c,0x00,
+0x1f,0x06,0x00,0xbf,0x64,0x65,0x66,0x20,0x72,0x65,0x6d,0x6f,0x76,0x65,0x5f,0x74,
+0x61,0x67,0x73,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,0x3a,0x00,0x33,0x0d,0x00,0x05,
+0x2a,0x24,0x31,0x38,0x31,0x00,0x00,0x00,0x0d,0x12,0x00,0x3d,0x00,0x00,0x00,0x05,
+0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x1c,0x0e,0x12,0x01,0x1c,0x0f,0x00,0x00,
+0x1d,0x10,0x00,0x00,0x1d,0x11,0x00,0x00,0x11,0x0d,0x00,0xd7,0x2d,0x0a,0x00,0x0a,
+0x00,0x00,0x00,0x00,0x1f,0x06,0x00,0xbf,0x64,0x65,0x66,0x20,0x72,0x65,0x6d,0x6f,
+0x76,0x65,0x5f,0x74,0x61,0x67,0x73,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,0x3a,0x00,
+0x33,0x00,0x00,0x05,0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x2e,0x70,0x79,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x0b,0x72,0x65,0x6d,0x6f,
+0x76,0x65,0x5f,0x74,0x61,0x67,0x73,0x00,0x23,0x01,0x00,0x00,0x1f,0x04,0x00,0xc0,
+0x20,0x20,0x20,0x20,0x75,0x73,0x65,0x64,0x20,0x3d,0x20,0x7b,0x7d,0x00,0x00,0x00,
+0x33,0x01,0x00,0x04,0x75,0x73,0x65,0x64,0x00,0x00,0x00,0x00,0x1b,0x02,0x00,0x00,
+0x10,0x01,0x02,0x00,0x1f,0x05,0x00,0xc1,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,
+0x6e,0x20,0x69,0x6e,0x20,0x6e,0x6f,0x64,0x65,0x73,0x3a,0x00,0x0c,0x03,0x00,0x02,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x02,0x00,0x03,0x13,0x00,0x00,0x39,
+0x33,0x04,0x00,0x01,0x6e,0x00,0x00,0x00,0x10,0x04,0x02,0x00,0x1f,0x0c,0x00,0xc2,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,0x5b,0x30,0x5d,0x20,
+0x3d,0x3d,0x20,0x27,0x6a,0x75,0x6d,0x70,0x27,0x20,0x6f,0x72,0x20,0x6e,0x5b,0x30,
+0x5d,0x20,0x3d,0x3d,0x20,0x27,0x73,0x65,0x74,0x6a,0x6d,0x70,0x27,0x3a,0x00,0x00,
+0x0c,0x05,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x02,0x04,0x05,
+0x0d,0x05,0x00,0x03,0x00,0x00,0x00,0x04,0x6a,0x75,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x18,0x02,0x02,0x05,0x2f,0x02,0x00,0x00,0x13,0x00,0x00,0x0a,0x0c,0x05,0x00,0x02,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x02,0x04,0x05,0x0d,0x05,0x00,0x04,
+0x00,0x00,0x00,0x06,0x73,0x65,0x74,0x6a,0x6d,0x70,0x00,0x00,0x18,0x02,0x02,0x05,
+0x16,0x02,0x00,0x00,0x13,0x00,0xff,0xd9,0x1f,0x08,0x00,0xc3,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x73,0x65,0x64,0x5b,0x6e,0x5b,0x31,
+0x5d,0x5d,0x20,0x3d,0x20,0x54,0x72,0x75,0x65,0x00,0x00,0x00,0x0c,0x02,0x00,0x05,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0c,0x06,0x00,0x05,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x05,0x04,0x06,0x0b,0x01,0x05,0x02,0x13,0x00,0xff,0xc7,
+0x1f,0x05,0x00,0xc4,0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x20,
+0x3d,0x20,0x46,0x61,0x6c,0x73,0x65,0x00,0x33,0x02,0x00,0x07,0x63,0x68,0x61,0x6e,
+0x67,0x65,0x64,0x00,0x0c,0x03,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x10,0x02,0x03,0x00,0x1f,0x08,0x00,0xc5,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,
+0x6b,0x20,0x69,0x6e,0x20,0x72,0x61,0x6e,0x67,0x65,0x28,0x6c,0x65,0x6e,0x28,0x6e,
+0x6f,0x64,0x65,0x73,0x29,0x29,0x3a,0x00,0x0e,0x08,0x00,0x06,0x00,0x00,0x00,0x05,
+0x72,0x61,0x6e,0x67,0x65,0x00,0x00,0x00,0x0e,0x04,0x00,0x07,0x00,0x00,0x00,0x03,
+0x6c,0x65,0x6e,0x00,0x10,0x05,0x00,0x00,0x37,0x09,0x04,0x02,0x3a,0x05,0x08,0x02,
+0x3b,0x03,0x05,0x00,0x13,0x00,0x00,0x44,0x33,0x08,0x00,0x01,0x6b,0x00,0x00,0x00,
+0x10,0x08,0x03,0x00,0x1f,0x10,0x00,0xc6,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,0x5d,0x5b,0x30,0x5d,0x20,0x3d,
+0x3d,0x20,0x27,0x74,0x61,0x67,0x27,0x20,0x61,0x6e,0x64,0x20,0x6e,0x6f,0x64,0x65,
+0x73,0x5b,0x6b,0x5d,0x5b,0x31,0x5d,0x20,0x6e,0x6f,0x74,0x20,0x69,0x6e,0x20,0x75,
+0x73,0x65,0x64,0x3a,0x00,0x00,0x00,0x00,0x0a,0x03,0x00,0x08,0x0c,0x09,0x00,0x02,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x03,0x03,0x09,0x0d,0x09,0x00,0x08,
+0x00,0x00,0x00,0x03,0x74,0x61,0x67,0x00,0x18,0x03,0x03,0x09,0x16,0x03,0x00,0x00,
+0x13,0x00,0x00,0x07,0x0a,0x03,0x00,0x08,0x0c,0x09,0x00,0x05,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x03,0x03,0x09,0x08,0x03,0x03,0x01,0x16,0x03,0x00,0x00,
+0x13,0x00,0xff,0xd8,0x1f,0x08,0x00,0xc7,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,0x5d,0x20,0x3d,0x20,0x5b,
+0x27,0x64,0x65,0x61,0x64,0x27,0x5d,0x00,0x0d,0x09,0x00,0x09,0x00,0x00,0x00,0x04,
+0x64,0x65,0x61,0x64,0x00,0x00,0x00,0x00,0x1c,0x03,0x09,0x01,0x0b,0x00,0x08,0x03,
+0x1f,0x07,0x00,0xc8,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x20,0x3d,0x20,0x54,0x72,0x75,0x65,0x00,0x00,
+0x0c,0x03,0x00,0x05,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x10,0x02,0x03,0x00,
+0x13,0x00,0xff,0xbc,0x1f,0x05,0x00,0xc9,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x00,0x00,0x15,0x02,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x0e,0x00,0x51,0x00,0x00,0x00,0x0b,0x72,0x65,0x6d,0x6f,
+0x76,0x65,0x5f,0x74,0x61,0x67,0x73,0x00,0x0f,0x0e,0x0d,0x00,0x1f,0x08,0x00,0xcb,
+0x64,0x65,0x66,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x6a,0x75,0x6d,0x70,0x73,
+0x28,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x74,0x61,0x67,0x73,0x29,0x3a,0x00,0x00,
+0x33,0x0e,0x00,0x05,0x2a,0x24,0x31,0x38,0x38,0x00,0x00,0x00,0x0d,0x13,0x00,0x3d,
+0x00,0x00,0x00,0x05,0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x0d,0x14,0x00,0x49,
+0x00,0x00,0x00,0x04,0x74,0x61,0x67,0x73,0x00,0x00,0x00,0x00,0x1c,0x0f,0x13,0x02,
+0x1c,0x10,0x00,0x00,0x1d,0x11,0x00,0x00,0x1d,0x12,0x00,0x00,0x11,0x0e,0x01,0x79,
+0x2d,0x0f,0x00,0x0a,0x00,0x00,0x00,0x00,0x1f,0x08,0x00,0xcb,0x64,0x65,0x66,0x20,
+0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x6a,0x75,0x6d,0x70,0x73,0x28,0x6e,0x6f,0x64,
+0x65,0x73,0x2c,0x20,0x74,0x61,0x67,0x73,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x05,
+0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x33,0x01,0x00,0x04,0x74,0x61,0x67,0x73,
+0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x65,0x65,0x70,
+0x68,0x6f,0x6c,0x65,0x2e,0x70,0x79,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,
+0x00,0x00,0x00,0x0c,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x6a,0x75,0x6d,0x70,0x73,
+0x00,0x00,0x00,0x00,0x23,0x02,0x00,0x00,0x1f,0x05,0x00,0xcc,0x20,0x20,0x20,0x20,
+0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x20,0x3d,0x20,0x46,0x61,0x6c,0x73,0x65,0x00,
+0x33,0x02,0x00,0x07,0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x00,0x0c,0x03,0x00,0x02,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x10,0x02,0x03,0x00,0x1f,0x08,0x00,0xcd,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x6b,0x20,0x69,0x6e,0x20,0x72,0x61,0x6e,
+0x67,0x65,0x28,0x6c,0x65,0x6e,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,0x29,0x3a,0x00,
+0x0e,0x04,0x00,0x03,0x00,0x00,0x00,0x05,0x72,0x61,0x6e,0x67,0x65,0x00,0x00,0x00,
+0x0e,0x06,0x00,0x04,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x10,0x07,0x00,0x00,
+0x37,0x05,0x06,0x02,0x3a,0x08,0x04,0x02,0x3b,0x03,0x08,0x00,0x13,0x00,0x01,0x2d,
+0x33,0x04,0x00,0x01,0x6b,0x00,0x00,0x00,0x10,0x04,0x03,0x00,0x1f,0x06,0x00,0xce,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x20,0x3d,0x20,0x6e,0x6f,0x64,0x65,
+0x73,0x5b,0x6b,0x5d,0x00,0x00,0x00,0x00,0x33,0x03,0x00,0x01,0x6e,0x00,0x00,0x00,
+0x0a,0x03,0x00,0x04,0x1f,0x07,0x00,0xcf,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x6e,0x5b,0x30,0x5d,0x20,0x21,0x3d,0x20,0x27,0x6a,0x75,0x6d,0x70,
+0x27,0x3a,0x00,0x00,0x0c,0x06,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x05,0x03,0x06,0x0d,0x06,0x00,0x05,0x00,0x00,0x00,0x04,0x6a,0x75,0x6d,0x70,
+0x00,0x00,0x00,0x00,0x24,0x05,0x05,0x06,0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x09,
+0x1f,0x06,0x00,0xd0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x00,0x00,0x00,0x00,0x13,0x00,0xff,0xd7,
+0x1f,0x05,0x00,0xd2,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x65,0x6e,
+0x20,0x3d,0x20,0x7b,0x7d,0x00,0x00,0x00,0x33,0x05,0x00,0x04,0x73,0x65,0x65,0x6e,
+0x00,0x00,0x00,0x00,0x1b,0x05,0x00,0x00,0x1f,0x0b,0x00,0xd3,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x74,0x20,0x3d,0x20,0x6e,0x65,0x78,0x74,0x5f,0x6e,0x6f,0x64,
+0x65,0x28,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x74,0x61,0x67,0x73,0x5b,0x6e,0x5b,
+0x31,0x5d,0x5d,0x29,0x00,0x00,0x00,0x00,0x33,0x06,0x00,0x01,0x74,0x00,0x00,0x00,
+0x0e,0x0b,0x00,0x06,0x00,0x00,0x00,0x09,0x6e,0x65,0x78,0x74,0x5f,0x6e,0x6f,0x64,
+0x65,0x00,0x00,0x00,0x10,0x0c,0x00,0x00,0x0c,0x07,0x00,0x07,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x0e,0x03,0x07,0x0a,0x0d,0x01,0x0e,0x37,0x06,0x0b,0x03,
+0x1f,0x13,0x00,0xd4,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,
+0x65,0x20,0x74,0x20,0x3c,0x20,0x6c,0x65,0x6e,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,
+0x20,0x61,0x6e,0x64,0x20,0x6e,0x6f,0x64,0x65,0x73,0x5b,0x74,0x5d,0x5b,0x30,0x5d,
+0x20,0x3d,0x3d,0x20,0x27,0x6a,0x75,0x6d,0x70,0x27,0x20,0x61,0x6e,0x64,0x20,0x74,
+0x20,0x6e,0x6f,0x74,0x20,0x69,0x6e,0x20,0x73,0x65,0x65,0x6e,0x3a,0x00,0x00,0x00,
+0x0e,0x0c,0x00,0x04,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x10,0x0d,0x00,0x00,
+0x37,0x0b,0x0c,0x02,0x1a,0x07,0x06,0x0b,0x16,0x07,0x00,0x00,0x13,0x00,0x00,0x0b,
+0x0a,0x07,0x00,0x06,0x0c,0x0b,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x07,0x07,0x0b,0x0d,0x0b,0x00,0x05,0x00,0x00,0x00,0x04,0x6a,0x75,0x6d,0x70,
+0x00,0x00,0x00,0x00,0x18,0x07,0x07,0x0b,0x16,0x07,0x00,0x00,0x13,0x00,0x00,0x02,
+0x08,0x07,0x06,0x05,0x16,0x07,0x00,0x00,0x13,0x00,0x00,0x62,0x1f,0x07,0x00,0xd5,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x65,0x6e,
+0x5b,0x74,0x5d,0x20,0x3d,0x20,0x54,0x72,0x75,0x65,0x00,0x00,0x0c,0x07,0x00,0x07,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0b,0x05,0x06,0x07,0x1f,0x09,0x00,0xd6,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,
+0x6f,0x64,0x65,0x73,0x5b,0x74,0x5d,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x6e,0x5b,
+0x31,0x5d,0x3a,0x00,0x0a,0x07,0x00,0x06,0x0c,0x0b,0x00,0x07,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x07,0x07,0x0b,0x0c,0x0c,0x00,0x07,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x0b,0x03,0x0c,0x18,0x07,0x07,0x0b,0x16,0x07,0x00,0x00,
+0x13,0x00,0x00,0x09,0x1f,0x06,0x00,0xd7,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x72,0x65,0x61,0x6b,0x00,0x00,0x00,
+0x13,0x00,0x00,0x38,0x1f,0x08,0x00,0xd8,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6e,0x5b,0x31,0x5d,0x20,0x3d,0x20,0x6e,0x6f,0x64,0x65,0x73,
+0x5b,0x74,0x5d,0x5b,0x31,0x5d,0x00,0x00,0x0a,0x07,0x00,0x06,0x0c,0x0b,0x00,0x07,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x07,0x07,0x0b,0x0c,0x0b,0x00,0x07,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0b,0x03,0x0b,0x07,0x1f,0x07,0x00,0xd9,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x6e,
+0x67,0x65,0x64,0x20,0x3d,0x20,0x54,0x72,0x75,0x65,0x00,0x00,0x0c,0x02,0x00,0x07,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x1f,0x0c,0x00,0xda,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x20,0x3d,0x20,0x6e,0x65,0x78,0x74,
+0x5f,0x6e,0x6f,0x64,0x65,0x28,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x74,0x61,0x67,
+0x73,0x5b,0x6e,0x5b,0x31,0x5d,0x5d,0x29,0x00,0x00,0x00,0x00,0x0e,0x0b,0x00,0x06,
+0x00,0x00,0x00,0x09,0x6e,0x65,0x78,0x74,0x5f,0x6e,0x6f,0x64,0x65,0x00,0x00,0x00,
+0x10,0x0c,0x00,0x00,0x0c,0x07,0x00,0x07,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x0e,0x03,0x07,0x0a,0x0d,0x01,0x0e,0x37,0x06,0x0b,0x03,0x13,0x00,0xff,0x89,
+0x1f,0x17,0x00,0xdc,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x74,
+0x20,0x3d,0x3d,0x20,0x6e,0x65,0x78,0x74,0x5f,0x6e,0x6f,0x64,0x65,0x28,0x6e,0x6f,
+0x64,0x65,0x73,0x2c,0x20,0x6b,0x20,0x2b,0x20,0x31,0x29,0x20,0x61,0x6e,0x64,0x20,
+0x74,0x61,0x67,0x73,0x5b,0x6e,0x5b,0x31,0x5d,0x5d,0x20,0x3e,0x20,0x6b,0x20,0x61,
+0x6e,0x64,0x20,0x6e,0x6f,0x74,0x20,0x61,0x66,0x74,0x65,0x72,0x5f,0x73,0x6b,0x69,
+0x70,0x28,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x6b,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x0e,0x0c,0x00,0x06,0x00,0x00,0x00,0x09,0x6e,0x65,0x78,0x74,0x5f,0x6e,0x6f,0x64,
+0x65,0x00,0x00,0x00,0x10,0x0d,0x00,0x00,0x0c,0x07,0x00,0x07,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x01,0x0e,0x04,0x07,0x37,0x0b,0x0c,0x03,0x18,0x07,0x06,0x0b,
+0x16,0x07,0x00,0x00,0x13,0x00,0x00,0x07,0x0c,0x0c,0x00,0x07,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x0b,0x03,0x0c,0x0a,0x07,0x01,0x0b,0x36,0x07,0x07,0x04,
+0x16,0x07,0x00,0x00,0x13,0x00,0x00,0x0a,0x0e,0x0c,0x00,0x08,0x00,0x00,0x00,0x0a,
+0x61,0x66,0x74,0x65,0x72,0x5f,0x73,0x6b,0x69,0x70,0x00,0x00,0x10,0x0d,0x00,0x00,
+0x10,0x0e,0x04,0x00,0x37,0x0b,0x0c,0x03,0x30,0x07,0x0b,0x00,0x16,0x07,0x00,0x00,
+0x13,0x00,0xfe,0xee,0x1f,0x08,0x00,0xdd,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,0x5d,0x20,0x3d,0x20,0x5b,
+0x27,0x64,0x65,0x61,0x64,0x27,0x5d,0x00,0x0d,0x0b,0x00,0x09,0x00,0x00,0x00,0x04,
+0x64,0x65,0x61,0x64,0x00,0x00,0x00,0x00,0x1c,0x07,0x0b,0x01,0x0b,0x00,0x04,0x07,
+0x1f,0x07,0x00,0xde,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x20,0x3d,0x20,0x54,0x72,0x75,0x65,0x00,0x00,
+0x0c,0x02,0x00,0x07,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x13,0x00,0xfe,0xd3,
+0x1f,0x05,0x00,0xdf,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,
+0x68,0x61,0x6e,0x67,0x65,0x64,0x00,0x00,0x15,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x0f,0x00,0x52,0x00,0x00,0x00,0x0c,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x6a,
+0x75,0x6d,0x70,0x73,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0e,0x00,0x1f,0x09,0x00,0xe1,
+0x64,0x65,0x66,0x20,0x66,0x6f,0x6c,0x64,0x28,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,
+0x74,0x61,0x67,0x73,0x2c,0x20,0x68,0x61,0x6e,0x64,0x6c,0x65,0x72,0x73,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x0f,0x00,0x05,0x2a,0x24,0x31,0x39,0x36,0x00,0x00,0x00,
+0x0d,0x14,0x00,0x3d,0x00,0x00,0x00,0x05,0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,
+0x0d,0x15,0x00,0x49,0x00,0x00,0x00,0x04,0x74,0x61,0x67,0x73,0x00,0x00,0x00,0x00,
+0x0d,0x16,0x00,0x4b,0x00,0x00,0x00,0x08,0x68,0x61,0x6e,0x64,0x6c,0x65,0x72,0x73,
+0x00,0x00,0x00,0x00,0x1c,0x10,0x14,0x03,0x1c,0x11,0x00,0x00,0x1d,0x12,0x00,0x00,
+0x1d,0x13,0x00,0x00,0x11,0x0f,0x02,0xb2,0x2d,0x17,0x00,0x15,0x00,0x00,0x00,0x00,
+0x1f,0x09,0x00,0xe1,0x64,0x65,0x66,0x20,0x66,0x6f,0x6c,0x64,0x28,0x6e,0x6f,0x64,
+0x65,0x73,0x2c,0x20,0x74,0x61,0x67,0x73,0x2c,0x20,0x68,0x61,0x6e,0x64,0x6c,0x65,
+0x72,0x73,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x05,0x6e,0x6f,0x64,0x65,
+0x73,0x00,0x00,0x00,0x33,0x01,0x00,0x04,0x74,0x61,0x67,0x73,0x00,0x00,0x00,0x00,
+0x33,0x02,0x00,0x08,0x68,0x61,0x6e,0x64,0x6c,0x65,0x72,0x73,0x00,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,
+0x2e,0x70,0x79,0x00,0x22,0x03,0x00,0x00,0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x04,
+0x66,0x6f,0x6c,0x64,0x00,0x00,0x00,0x00,0x23,0x03,0x00,0x00,0x1f,0x05,0x00,0xe2,
+0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x20,0x3d,0x20,0x46,0x61,
+0x6c,0x73,0x65,0x00,0x33,0x03,0x00,0x07,0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x00,
+0x0c,0x04,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x10,0x03,0x04,0x00,
+0x1f,0x09,0x00,0xe3,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x6b,0x20,0x69,0x6e,
+0x20,0x72,0x61,0x6e,0x67,0x65,0x28,0x6c,0x65,0x6e,0x28,0x6e,0x6f,0x64,0x65,0x73,
+0x29,0x20,0x2d,0x20,0x31,0x29,0x3a,0x00,0x0e,0x05,0x00,0x03,0x00,0x00,0x00,0x05,
+0x72,0x61,0x6e,0x67,0x65,0x00,0x00,0x00,0x0e,0x07,0x00,0x04,0x00,0x00,0x00,0x03,
+0x6c,0x65,0x6e,0x00,0x10,0x08,0x00,0x00,0x37,0x06,0x07,0x02,0x0c,0x07,0x00,0x05,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x02,0x06,0x06,0x07,0x3a,0x0c,0x05,0x02,
+0x3b,0x04,0x0c,0x00,0x13,0x00,0x02,0x5e,0x33,0x05,0x00,0x01,0x6b,0x00,0x00,0x00,
+0x10,0x05,0x04,0x00,0x1f,0x06,0x00,0xe4,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6e,0x20,0x3d,0x20,0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,0x5d,0x00,0x00,0x00,0x00,
+0x33,0x04,0x00,0x01,0x6e,0x00,0x00,0x00,0x0a,0x04,0x00,0x05,0x1f,0x0d,0x00,0xe5,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,0x5b,0x30,0x5d,0x20,
+0x21,0x3d,0x20,0x27,0x63,0x6f,0x64,0x65,0x27,0x20,0x6f,0x72,0x20,0x61,0x66,0x74,
+0x65,0x72,0x5f,0x73,0x6b,0x69,0x70,0x28,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x6b,
+0x29,0x3a,0x00,0x00,0x0c,0x07,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x06,0x04,0x07,0x0d,0x07,0x00,0x06,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,
+0x00,0x00,0x00,0x00,0x24,0x06,0x06,0x07,0x2f,0x06,0x00,0x00,0x13,0x00,0x00,0x09,
+0x0e,0x07,0x00,0x07,0x00,0x00,0x00,0x0a,0x61,0x66,0x74,0x65,0x72,0x5f,0x73,0x6b,
+0x69,0x70,0x00,0x00,0x10,0x08,0x00,0x00,0x10,0x09,0x05,0x00,0x37,0x06,0x07,0x03,
+0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x09,0x1f,0x06,0x00,0xe6,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,
+0x00,0x00,0x00,0x00,0x13,0x00,0xff,0xc7,0x1f,0x05,0x00,0xe7,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x20,0x3d,0x20,0x6e,0x5b,0x31,0x5d,0x00,0x00,0x00,0x00,
+0x33,0x06,0x00,0x01,0x69,0x00,0x00,0x00,0x0c,0x08,0x00,0x05,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x06,0x04,0x08,0x1f,0x0e,0x00,0xe8,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,0x20,0x3d,0x3d,0x20,0x50,0x41,0x53,0x53,
+0x20,0x6f,0x72,0x20,0x28,0x69,0x20,0x3d,0x3d,0x20,0x4d,0x4f,0x56,0x45,0x20,0x61,
+0x6e,0x64,0x20,0x6e,0x5b,0x32,0x5d,0x20,0x3d,0x3d,0x20,0x6e,0x5b,0x33,0x5d,0x29,
+0x3a,0x00,0x00,0x00,0x0e,0x08,0x00,0x08,0x00,0x00,0x00,0x04,0x50,0x41,0x53,0x53,
+0x00,0x00,0x00,0x00,0x18,0x07,0x06,0x08,0x2f,0x07,0x00,0x00,0x13,0x00,0x00,0x11,
+0x0e,0x08,0x00,0x09,0x00,0x00,0x00,0x04,0x4d,0x4f,0x56,0x45,0x00,0x00,0x00,0x00,
+0x18,0x07,0x06,0x08,0x16,0x07,0x00,0x00,0x13,0x00,0x00,0x0a,0x0c,0x08,0x00,0x0a,
+0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x0a,0x07,0x04,0x08,0x0c,0x09,0x00,0x0b,
+0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,0x0a,0x08,0x04,0x09,0x18,0x07,0x07,0x08,
+0x16,0x07,0x00,0x00,0x13,0x00,0x00,0x23,0x1f,0x08,0x00,0xe9,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,0x5d,
+0x20,0x3d,0x20,0x5b,0x27,0x64,0x65,0x61,0x64,0x27,0x5d,0x00,0x0d,0x08,0x00,0x0c,
+0x00,0x00,0x00,0x04,0x64,0x65,0x61,0x64,0x00,0x00,0x00,0x00,0x1c,0x07,0x08,0x01,
+0x0b,0x00,0x05,0x07,0x1f,0x07,0x00,0xea,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x20,0x3d,0x20,0x54,0x72,
+0x75,0x65,0x00,0x00,0x0c,0x03,0x00,0x05,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x1f,0x06,0x00,0xeb,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x00,0x00,0x00,0x00,0x13,0x00,0xff,0x71,
+0x1f,0x05,0x00,0xed,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6b,0x32,0x20,0x3d,
+0x20,0x6b,0x20,0x2b,0x20,0x31,0x00,0x00,0x33,0x07,0x00,0x02,0x6b,0x32,0x00,0x00,
+0x0c,0x09,0x00,0x05,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x07,0x05,0x09,
+0x1f,0x0f,0x00,0xee,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,
+0x65,0x20,0x6b,0x32,0x20,0x3c,0x20,0x6c,0x65,0x6e,0x28,0x6e,0x6f,0x64,0x65,0x73,
+0x29,0x20,0x61,0x6e,0x64,0x20,0x69,0x73,0x5f,0x63,0x6f,0x64,0x65,0x28,0x6e,0x6f,
+0x64,0x65,0x73,0x5b,0x6b,0x32,0x5d,0x2c,0x20,0x56,0x41,0x52,0x29,0x3a,0x00,0x00,
+0x0e,0x0a,0x00,0x04,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x10,0x0b,0x00,0x00,
+0x37,0x09,0x0a,0x02,0x1a,0x08,0x07,0x09,0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x0a,
+0x0e,0x09,0x00,0x0d,0x00,0x00,0x00,0x07,0x69,0x73,0x5f,0x63,0x6f,0x64,0x65,0x00,
+0x0a,0x0a,0x00,0x07,0x0e,0x0b,0x00,0x0e,0x00,0x00,0x00,0x03,0x56,0x41,0x52,0x00,
+0x37,0x08,0x09,0x03,0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x0c,0x1f,0x05,0x00,0xef,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6b,0x32,0x20,0x2b,
+0x3d,0x20,0x31,0x00,0x0c,0x09,0x00,0x05,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x01,0x07,0x07,0x09,0x13,0x00,0xff,0xe3,0x1f,0x0e,0x00,0xf0,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6b,0x32,0x20,0x3d,0x3d,0x20,0x6c,0x65,0x6e,
+0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,0x20,0x6f,0x72,0x20,0x6e,0x6f,0x64,0x65,0x73,
+0x5b,0x6b,0x32,0x5d,0x5b,0x30,0x5d,0x20,0x21,0x3d,0x20,0x27,0x63,0x6f,0x64,0x65,
+0x27,0x3a,0x00,0x00,0x0e,0x0a,0x00,0x04,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,
+0x10,0x0b,0x00,0x00,0x37,0x09,0x0a,0x02,0x18,0x08,0x07,0x09,0x2f,0x08,0x00,0x00,
+0x13,0x00,0x00,0x0b,0x0a,0x08,0x00,0x07,0x0c,0x09,0x00,0x02,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x08,0x08,0x09,0x0d,0x09,0x00,0x06,0x00,0x00,0x00,0x04,
+0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,0x24,0x08,0x08,0x09,0x16,0x08,0x00,0x00,
+0x13,0x00,0x00,0x09,0x1f,0x06,0x00,0xf1,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x00,0x00,0x00,0x00,
+0x13,0x00,0xff,0x0c,0x1f,0x06,0x00,0xf2,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6d,0x20,0x3d,0x20,0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,0x32,0x5d,0x00,0x00,0x00,
+0x33,0x08,0x00,0x01,0x6d,0x00,0x00,0x00,0x0a,0x08,0x00,0x07,0x1f,0x05,0x00,0xf3,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x20,0x3d,0x20,0x6e,0x5b,0x32,0x5d,
+0x00,0x00,0x00,0x00,0x33,0x09,0x00,0x01,0x74,0x00,0x00,0x00,0x0c,0x0b,0x00,0x0a,
+0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x0a,0x09,0x04,0x0b,0x1f,0x15,0x00,0xf5,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,0x20,0x3d,0x3d,0x20,
+0x4e,0x4f,0x54,0x20,0x61,0x6e,0x64,0x20,0x28,0x6d,0x5b,0x31,0x5d,0x20,0x3d,0x3d,
+0x20,0x49,0x46,0x20,0x6f,0x72,0x20,0x6d,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x49,
+0x46,0x4e,0x29,0x20,0x61,0x6e,0x64,0x20,0x6d,0x5b,0x32,0x5d,0x20,0x3d,0x3d,0x20,
+0x74,0x20,0x61,0x6e,0x64,0x20,0x6b,0x32,0x20,0x3d,0x3d,0x20,0x6b,0x20,0x2b,0x20,
+0x31,0x3a,0x00,0x00,0x0e,0x0b,0x00,0x0f,0x00,0x00,0x00,0x03,0x4e,0x4f,0x54,0x00,
+0x18,0x0a,0x06,0x0b,0x16,0x0a,0x00,0x00,0x13,0x00,0x00,0x13,0x0c,0x0b,0x00,0x05,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x0a,0x08,0x0b,0x0e,0x0b,0x00,0x10,
+0x00,0x00,0x00,0x02,0x49,0x46,0x00,0x00,0x18,0x0a,0x0a,0x0b,0x2f,0x0a,0x00,0x00,
+0x13,0x00,0x00,0x09,0x0c,0x0b,0x00,0x05,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x0a,0x08,0x0b,0x0e,0x0b,0x00,0x11,0x00,0x00,0x00,0x03,0x49,0x46,0x4e,0x00,
+0x18,0x0a,0x0a,0x0b,0x16,0x0a,0x00,0x00,0x13,0x00,0x00,0x06,0x0c,0x0b,0x00,0x0a,
+0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x0a,0x0a,0x08,0x0b,0x18,0x0a,0x0a,0x09,
+0x16,0x0a,0x00,0x00,0x13,0x00,0x00,0x06,0x0c,0x0f,0x00,0x05,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x01,0x0b,0x05,0x0f,0x18,0x0a,0x07,0x0b,0x16,0x0a,0x00,0x00,
+0x13,0x00,0x00,0x8c,0x1f,0x14,0x00,0xf6,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,0x6f,0x74,0x20,0x6c,0x69,0x76,0x65,0x28,
+0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x74,0x61,0x67,0x73,0x2c,0x20,0x68,0x61,0x6e,
+0x64,0x6c,0x65,0x72,0x73,0x2c,0x20,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x6f,0x72,
+0x73,0x28,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x74,0x61,0x67,0x73,0x2c,0x20,0x6b,
+0x32,0x29,0x2c,0x20,0x74,0x29,0x3a,0x00,0x0e,0x0f,0x00,0x12,0x00,0x00,0x00,0x04,
+0x6c,0x69,0x76,0x65,0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x10,0x11,0x01,0x00,
+0x10,0x12,0x02,0x00,0x0e,0x13,0x00,0x13,0x00,0x00,0x00,0x0a,0x73,0x75,0x63,0x63,
+0x65,0x73,0x73,0x6f,0x72,0x73,0x00,0x00,0x10,0x14,0x00,0x00,0x10,0x15,0x01,0x00,
+0x10,0x16,0x07,0x00,0x37,0x13,0x13,0x04,0x10,0x14,0x09,0x00,0x37,0x0b,0x0f,0x06,
+0x2f,0x0b,0x00,0x00,0x13,0x00,0x00,0x5b,0x1f,0x0b,0x00,0xf7,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6d,
+0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x49,0x46,0x3a,0x20,0x6d,0x5b,0x31,0x5d,0x20,
+0x3d,0x20,0x49,0x46,0x4e,0x00,0x00,0x00,0x0c,0x0b,0x00,0x05,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x0a,0x08,0x0b,0x0e,0x0b,0x00,0x10,0x00,0x00,0x00,0x02,
+0x49,0x46,0x00,0x00,0x18,0x0a,0x0a,0x0b,0x16,0x0a,0x00,0x00,0x13,0x00,0x00,0x09,
+0x0e,0x0a,0x00,0x11,0x00,0x00,0x00,0x03,0x49,0x46,0x4e,0x00,0x0c,0x0b,0x00,0x05,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0b,0x08,0x0b,0x0a,0x13,0x00,0x00,0x11,
+0x1f,0x08,0x00,0xf8,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x3a,0x20,0x6d,0x5b,0x31,0x5d,0x20,0x3d,
+0x20,0x49,0x46,0x00,0x0e,0x0a,0x00,0x10,0x00,0x00,0x00,0x02,0x49,0x46,0x00,0x00,
+0x0c,0x0b,0x00,0x05,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0b,0x08,0x0b,0x0a,
+0x1f,0x07,0x00,0xf9,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6d,0x5b,0x32,0x5d,0x20,0x3d,0x20,0x6e,0x5b,0x33,0x5d,0x00,
+0x0c,0x0b,0x00,0x0b,0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,0x0a,0x0a,0x04,0x0b,
+0x0c,0x0b,0x00,0x0a,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x0b,0x08,0x0b,0x0a,
+0x1f,0x09,0x00,0xfa,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,0x5d,0x20,0x3d,0x20,0x5b,
+0x27,0x64,0x65,0x61,0x64,0x27,0x5d,0x00,0x0d,0x0b,0x00,0x0c,0x00,0x00,0x00,0x04,
+0x64,0x65,0x61,0x64,0x00,0x00,0x00,0x00,0x1c,0x0a,0x0b,0x01,0x0b,0x00,0x05,0x0a,
+0x1f,0x08,0x00,0xfb,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x20,0x3d,0x20,0x54,0x72,
+0x75,0x65,0x00,0x00,0x0c,0x03,0x00,0x05,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x1f,0x06,0x00,0xfc,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x00,0x00,0x00,0x00,0x13,0x00,0xfe,0x2d,
+0x1f,0x12,0x00,0xfe,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,
+0x20,0x69,0x6e,0x20,0x52,0x45,0x54,0x41,0x52,0x47,0x45,0x54,0x20,0x61,0x6e,0x64,
+0x20,0x6d,0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x4d,0x4f,0x56,0x45,0x20,0x61,0x6e,
+0x64,0x20,0x6d,0x5b,0x33,0x5d,0x20,0x3d,0x3d,0x20,0x74,0x20,0x61,0x6e,0x64,0x20,
+0x6d,0x5b,0x32,0x5d,0x20,0x21,0x3d,0x20,0x74,0x3a,0x00,0x00,0x0e,0x0b,0x00,0x14,
+0x00,0x00,0x00,0x08,0x52,0x45,0x54,0x41,0x52,0x47,0x45,0x54,0x00,0x00,0x00,0x00,
+0x25,0x0a,0x06,0x0b,0x16,0x0a,0x00,0x00,0x13,0x00,0x00,0x0a,0x0c,0x0b,0x00,0x05,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x0a,0x08,0x0b,0x0e,0x0b,0x00,0x09,
+0x00,0x00,0x00,0x04,0x4d,0x4f,0x56,0x45,0x00,0x00,0x00,0x00,0x18,0x0a,0x0a,0x0b,
+0x16,0x0a,0x00,0x00,0x13,0x00,0x00,0x06,0x0c,0x0b,0x00,0x0b,0x00,0x00,0x69,0x04,
+0x03,0x00,0x00,0x00,0x0a,0x0a,0x08,0x0b,0x18,0x0a,0x0a,0x09,0x16,0x0a,0x00,0x00,
+0x13,0x00,0x00,0x06,0x0c,0x0b,0x00,0x0a,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,
+0x0a,0x0a,0x08,0x0b,0x24,0x0a,0x0a,0x09,0x16,0x0a,0x00,0x00,0x13,0x00,0xfd,0xf9,
+0x1f,0x14,0x00,0xff,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x6e,0x6f,0x74,0x20,0x6c,0x69,0x76,0x65,0x28,0x6e,0x6f,0x64,0x65,
+0x73,0x2c,0x20,0x74,0x61,0x67,0x73,0x2c,0x20,0x68,0x61,0x6e,0x64,0x6c,0x65,0x72,
+0x73,0x2c,0x20,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x6f,0x72,0x73,0x28,0x6e,0x6f,
+0x64,0x65,0x73,0x2c,0x20,0x74,0x61,0x67,0x73,0x2c,0x20,0x6b,0x32,0x29,0x2c,0x20,
+0x74,0x29,0x3a,0x00,0x0e,0x0f,0x00,0x12,0x00,0x00,0x00,0x04,0x6c,0x69,0x76,0x65,
+0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x10,0x11,0x01,0x00,0x10,0x12,0x02,0x00,
+0x0e,0x13,0x00,0x13,0x00,0x00,0x00,0x0a,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x6f,
+0x72,0x73,0x00,0x00,0x10,0x14,0x00,0x00,0x10,0x15,0x01,0x00,0x10,0x16,0x07,0x00,
+0x37,0x13,0x13,0x04,0x10,0x14,0x09,0x00,0x37,0x0b,0x0f,0x06,0x2f,0x0b,0x00,0x00,
+0x13,0x00,0xfd,0xd0,0x1f,0x07,0x01,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x5b,0x32,0x5d,0x20,0x3d,0x20,0x6d,
+0x5b,0x32,0x5d,0x00,0x0c,0x0b,0x00,0x0a,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,
+0x0a,0x0a,0x08,0x0b,0x0c,0x0b,0x00,0x0a,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,
+0x0b,0x04,0x0b,0x0a,0x1f,0x0a,0x01,0x01,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,0x32,
+0x5d,0x20,0x3d,0x20,0x5b,0x27,0x64,0x65,0x61,0x64,0x27,0x5d,0x00,0x00,0x00,0x00,
+0x0d,0x0b,0x00,0x0c,0x00,0x00,0x00,0x04,0x64,0x65,0x61,0x64,0x00,0x00,0x00,0x00,
+0x1c,0x0a,0x0b,0x01,0x0b,0x00,0x07,0x0a,0x1f,0x08,0x01,0x02,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x6e,
+0x67,0x65,0x64,0x20,0x3d,0x20,0x54,0x72,0x75,0x65,0x00,0x00,0x0c,0x03,0x00,0x05,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x13,0x00,0xfd,0xa2,0x1f,0x05,0x01,0x03,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x68,0x61,0x6e,0x67,
+0x65,0x64,0x00,0x00,0x15,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x10,0x00,0x53,
+0x00,0x00,0x00,0x04,0x66,0x6f,0x6c,0x64,0x00,0x00,0x00,0x00,0x0f,0x10,0x0f,0x00,
+0x1f,0x07,0x01,0x05,0x64,0x65,0x66,0x20,0x69,0x6e,0x76,0x65,0x72,0x74,0x28,0x6e,
+0x6f,0x64,0x65,0x73,0x2c,0x20,0x74,0x61,0x67,0x73,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x10,0x00,0x05,0x2a,0x24,0x32,0x30,0x35,0x00,0x00,0x00,0x0d,0x15,0x00,0x3d,
+0x00,0x00,0x00,0x05,0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x0d,0x16,0x00,0x49,
+0x00,0x00,0x00,0x04,0x74,0x61,0x67,0x73,0x00,0x00,0x00,0x00,0x1c,0x11,0x15,0x02,
+0x1c,0x12,0x00,0x00,0x1d,0x13,0x00,0x00,0x1d,0x14,0x00,0x00,0x11,0x10,0x01,0x6a,
+0x2d,0x0f,0x00,0x0e,0x00,0x00,0x00,0x00,0x1f,0x07,0x01,0x05,0x64,0x65,0x66,0x20,
+0x69,0x6e,0x76,0x65,0x72,0x74,0x28,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x74,0x61,
+0x67,0x73,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x05,0x6e,0x6f,0x64,0x65,
+0x73,0x00,0x00,0x00,0x33,0x01,0x00,0x04,0x74,0x61,0x67,0x73,0x00,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,
+0x2e,0x70,0x79,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x06,
+0x69,0x6e,0x76,0x65,0x72,0x74,0x00,0x00,0x23,0x02,0x00,0x00,0x1f,0x05,0x01,0x07,
+0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x20,0x3d,0x20,0x46,0x61,
+0x6c,0x73,0x65,0x00,0x33,0x02,0x00,0x07,0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x00,
+0x0c,0x03,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x10,0x02,0x03,0x00,
+0x1f,0x09,0x01,0x08,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x6b,0x20,0x69,0x6e,
+0x20,0x72,0x61,0x6e,0x67,0x65,0x28,0x6c,0x65,0x6e,0x28,0x6e,0x6f,0x64,0x65,0x73,
+0x29,0x20,0x2d,0x20,0x33,0x29,0x3a,0x00,0x0e,0x04,0x00,0x03,0x00,0x00,0x00,0x05,
+0x72,0x61,0x6e,0x67,0x65,0x00,0x00,0x00,0x0e,0x06,0x00,0x04,0x00,0x00,0x00,0x03,
+0x6c,0x65,0x6e,0x00,0x10,0x07,0x00,0x00,0x37,0x05,0x06,0x02,0x0c,0x06,0x00,0x05,
+0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,0x02,0x05,0x05,0x06,0x3a,0x0c,0x04,0x02,
+0x3b,0x03,0x0c,0x00,0x13,0x00,0x01,0x1c,0x33,0x04,0x00,0x01,0x6b,0x00,0x00,0x00,
+0x10,0x04,0x03,0x00,0x1f,0x06,0x01,0x09,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6e,0x20,0x3d,0x20,0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,0x5d,0x00,0x00,0x00,0x00,
+0x33,0x03,0x00,0x01,0x6e,0x00,0x00,0x00,0x0a,0x03,0x00,0x04,0x1f,0x0d,0x01,0x0a,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,0x6f,0x74,0x20,0x28,
+0x69,0x73,0x5f,0x63,0x6f,0x64,0x65,0x28,0x6e,0x2c,0x20,0x49,0x46,0x29,0x20,0x6f,
+0x72,0x20,0x69,0x73,0x5f,0x63,0x6f,0x64,0x65,0x28,0x6e,0x2c,0x20,0x49,0x46,0x4e,
+0x29,0x29,0x3a,0x00,0x0e,0x07,0x00,0x06,0x00,0x00,0x00,0x07,0x69,0x73,0x5f,0x63,
+0x6f,0x64,0x65,0x00,0x10,0x08,0x03,0x00,0x0e,0x09,0x00,0x07,0x00,0x00,0x00,0x02,
+0x49,0x46,0x00,0x00,0x37,0x06,0x07,0x03,0x2f,0x06,0x00,0x00,0x13,0x00,0x00,0x0a,
+0x0e,0x07,0x00,0x06,0x00,0x00,0x00,0x07,0x69,0x73,0x5f,0x63,0x6f,0x64,0x65,0x00,
+0x10,0x08,0x03,0x00,0x0e,0x09,0x00,0x08,0x00,0x00,0x00,0x03,0x49,0x46,0x4e,0x00,
+0x37,0x06,0x07,0x03,0x2f,0x06,0x00,0x00,0x13,0x00,0x00,0x09,0x1f,0x06,0x01,0x0b,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,
+0x69,0x6e,0x75,0x65,0x00,0x00,0x00,0x00,0x13,0x00,0xff,0xc6,0x1f,0x0b,0x01,0x0c,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6a,0x31,0x2c,0x20,0x6a,0x32,0x20,0x3d,
+0x20,0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,0x20,0x2b,0x20,0x31,0x5d,0x2c,0x20,0x6e,
+0x6f,0x64,0x65,0x73,0x5b,0x6b,0x20,0x2b,0x20,0x32,0x5d,0x00,0x0c,0x08,0x00,0x09,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x07,0x04,0x08,0x0a,0x05,0x00,0x07,
+0x0c,0x09,0x00,0x0a,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x01,0x08,0x04,0x09,
+0x0a,0x06,0x00,0x08,0x33,0x07,0x00,0x02,0x6a,0x31,0x00,0x00,0x10,0x07,0x05,0x00,
+0x33,0x05,0x00,0x02,0x6a,0x32,0x00,0x00,0x10,0x05,0x06,0x00,0x1f,0x0c,0x01,0x0d,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6a,0x31,0x5b,0x30,0x5d,
+0x20,0x21,0x3d,0x20,0x27,0x6a,0x75,0x6d,0x70,0x27,0x20,0x6f,0x72,0x20,0x6a,0x32,
+0x5b,0x30,0x5d,0x20,0x21,0x3d,0x20,0x27,0x6a,0x75,0x6d,0x70,0x27,0x3a,0x00,0x00,
+0x0c,0x08,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x06,0x07,0x08,
+0x0d,0x08,0x00,0x0b,0x00,0x00,0x00,0x04,0x6a,0x75,0x6d,0x70,0x00,0x00,0x00,0x00,
+0x24,0x06,0x06,0x08,0x2f,0x06,0x00,0x00,0x13,0x00,0x00,0x0a,0x0c,0x08,0x00,0x02,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x06,0x05,0x08,0x0d,0x08,0x00,0x0b,
+0x00,0x00,0x00,0x04,0x6a,0x75,0x6d,0x70,0x00,0x00,0x00,0x00,0x24,0x06,0x06,0x08,
+0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x09,0x1f,0x06,0x01,0x0e,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,
+0x00,0x00,0x00,0x00,0x13,0x00,0xff,0x7f,0x1f,0x17,0x01,0x0f,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,0x65,0x78,0x74,0x5f,0x6e,0x6f,0x64,0x65,
+0x28,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x6b,0x20,0x2b,0x20,0x33,0x29,0x20,0x21,
+0x3d,0x20,0x6e,0x65,0x78,0x74,0x5f,0x6e,0x6f,0x64,0x65,0x28,0x6e,0x6f,0x64,0x65,
+0x73,0x2c,0x20,0x74,0x61,0x67,0x73,0x5b,0x6a,0x31,0x5b,0x31,0x5d,0x5d,0x29,0x20,
+0x6f,0x72,0x20,0x74,0x61,0x67,0x73,0x5b,0x6a,0x31,0x5b,0x31,0x5d,0x5d,0x20,0x3c,
+0x20,0x6b,0x20,0x2b,0x20,0x33,0x3a,0x00,0x0e,0x08,0x00,0x0c,0x00,0x00,0x00,0x09,
+0x6e,0x65,0x78,0x74,0x5f,0x6e,0x6f,0x64,0x65,0x00,0x00,0x00,0x10,0x09,0x00,0x00,
+0x0c,0x0b,0x00,0x05,0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,0x01,0x0a,0x04,0x0b,
+0x37,0x06,0x08,0x03,0x0e,0x09,0x00,0x0c,0x00,0x00,0x00,0x09,0x6e,0x65,0x78,0x74,
+0x5f,0x6e,0x6f,0x64,0x65,0x00,0x00,0x00,0x10,0x0a,0x00,0x00,0x0c,0x08,0x00,0x09,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x08,0x07,0x08,0x0a,0x0b,0x01,0x08,
+0x37,0x08,0x09,0x03,0x24,0x06,0x06,0x08,0x2f,0x06,0x00,0x00,0x13,0x00,0x00,0x0b,
+0x0c,0x09,0x00,0x09,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x08,0x07,0x09,
+0x0a,0x06,0x01,0x08,0x0c,0x09,0x00,0x05,0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,
+0x01,0x08,0x04,0x09,0x1a,0x06,0x06,0x08,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x09,
+0x1f,0x06,0x01,0x10,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x00,0x00,0x00,0x00,0x13,0x00,0xff,0x39,
+0x1f,0x09,0x01,0x11,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,
+0x5b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x49,0x46,0x3a,0x20,0x6e,0x5b,0x31,0x5d,0x20,
+0x3d,0x20,0x49,0x46,0x4e,0x00,0x00,0x00,0x0c,0x08,0x00,0x09,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x06,0x03,0x08,0x0e,0x08,0x00,0x07,0x00,0x00,0x00,0x02,
+0x49,0x46,0x00,0x00,0x18,0x06,0x06,0x08,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x09,
+0x0e,0x06,0x00,0x08,0x00,0x00,0x00,0x03,0x49,0x46,0x4e,0x00,0x0c,0x08,0x00,0x09,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0b,0x03,0x08,0x06,0x13,0x00,0x00,0x0f,
+0x1f,0x06,0x01,0x12,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,
+0x3a,0x20,0x6e,0x5b,0x31,0x5d,0x20,0x3d,0x20,0x49,0x46,0x00,0x0e,0x06,0x00,0x07,
+0x00,0x00,0x00,0x02,0x49,0x46,0x00,0x00,0x0c,0x08,0x00,0x09,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0b,0x03,0x08,0x06,0x1f,0x07,0x01,0x13,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,0x20,0x2b,0x20,0x31,0x5d,
+0x20,0x3d,0x20,0x6a,0x32,0x00,0x00,0x00,0x0c,0x08,0x00,0x09,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x01,0x06,0x04,0x08,0x0b,0x00,0x06,0x05,0x1f,0x08,0x01,0x14,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,0x20,
+0x2b,0x20,0x32,0x5d,0x20,0x3d,0x20,0x5b,0x27,0x64,0x65,0x61,0x64,0x27,0x5d,0x00,
+0x0d,0x08,0x00,0x0d,0x00,0x00,0x00,0x04,0x64,0x65,0x61,0x64,0x00,0x00,0x00,0x00,
+0x1c,0x06,0x08,0x01,0x0c,0x09,0x00,0x0a,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,
+0x01,0x08,0x04,0x09,0x0b,0x00,0x08,0x06,0x1f,0x06,0x01,0x15,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x20,0x3d,0x20,0x54,0x72,
+0x75,0x65,0x00,0x00,0x0c,0x02,0x00,0x09,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x13,0x00,0xfe,0xe4,0x1f,0x05,0x01,0x16,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x00,0x00,0x15,0x02,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x11,0x00,0x54,0x00,0x00,0x00,0x06,0x69,0x6e,0x76,0x65,
+0x72,0x74,0x00,0x00,0x0f,0x11,0x10,0x00,0x1f,0x05,0x01,0x18,0x64,0x65,0x66,0x20,
+0x73,0x77,0x65,0x65,0x70,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x11,0x00,0x05,0x2a,0x24,0x32,0x31,0x33,0x00,0x00,0x00,0x0d,0x16,0x00,0x3d,
+0x00,0x00,0x00,0x05,0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x1c,0x12,0x16,0x01,
+0x1c,0x13,0x00,0x00,0x1d,0x14,0x00,0x00,0x1d,0x15,0x00,0x00,0x11,0x11,0x00,0x5b,
+0x2d,0x08,0x00,0x05,0x00,0x00,0x00,0x01,0x1f,0x05,0x01,0x18,0x64,0x65,0x66,0x20,
+0x73,0x77,0x65,0x65,0x70,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x00,0x00,0x05,0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x2e,0x70,0x79,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x05,0x73,0x77,0x65,0x65,
+0x70,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x03,0x01,0x19,0x20,0x20,0x20,0x20,
+0x72,0x20,0x3d,0x20,0x5b,0x5d,0x00,0x00,0x33,0x01,0x00,0x01,0x72,0x00,0x00,0x00,
+0x1c,0x02,0x00,0x00,0x10,0x01,0x02,0x00,0x1f,0x05,0x01,0x1a,0x20,0x20,0x20,0x20,
+0x66,0x6f,0x72,0x20,0x6e,0x20,0x69,0x6e,0x20,0x6e,0x6f,0x64,0x65,0x73,0x3a,0x00,
+0x0c,0x03,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x02,0x00,0x03,
+0x13,0x00,0x00,0x27,0x33,0x04,0x00,0x01,0x6e,0x00,0x00,0x00,0x10,0x04,0x02,0x00,
+0x1f,0x07,0x01,0x1b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,
+0x5b,0x30,0x5d,0x20,0x21,0x3d,0x20,0x27,0x64,0x65,0x61,0x64,0x27,0x3a,0x00,0x00,
+0x0c,0x05,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x02,0x04,0x05,
+0x0d,0x05,0x00,0x03,0x00,0x00,0x00,0x04,0x64,0x65,0x61,0x64,0x00,0x00,0x00,0x00,
+0x24,0x02,0x02,0x05,0x16,0x02,0x00,0x00,0x13,0x00,0xff,0xe9,0x1f,0x06,0x01,0x1c,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x2e,0x61,0x70,
+0x70,0x65,0x6e,0x64,0x28,0x6e,0x29,0x00,0x0d,0x02,0x00,0x04,0x00,0x00,0x00,0x06,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x05,0x01,0x02,0x00,0x00,0x00,0x00,
+0x10,0x07,0x04,0x00,0x39,0x02,0x05,0x03,0x13,0x00,0xff,0xd9,0x1f,0x04,0x01,0x1d,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,
+0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x12,0x00,0x55,0x00,0x00,0x00,0x05,
+0x73,0x77,0x65,0x65,0x70,0x00,0x00,0x00,0x0f,0x12,0x11,0x00,0x1f,0x06,0x01,0x1f,
+0x64,0x65,0x66,0x20,0x6f,0x70,0x74,0x69,0x6d,0x69,0x7a,0x65,0x28,0x6e,0x6f,0x64,
+0x65,0x73,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x12,0x00,0x05,0x2a,0x24,0x32,0x32,
+0x30,0x00,0x00,0x00,0x0d,0x17,0x00,0x3d,0x00,0x00,0x00,0x05,0x6e,0x6f,0x64,0x65,
+0x73,0x00,0x00,0x00,0x1c,0x13,0x17,0x01,0x1c,0x14,0x00,0x00,0x1d,0x15,0x00,0x00,
+0x1d,0x16,0x00,0x00,0x11,0x12,0x01,0xcd,0x2d,0x0a,0x00,0x0f,0x00,0x00,0x00,0x01,
+0x1f,0x06,0x01,0x1f,0x64,0x65,0x66,0x20,0x6f,0x70,0x74,0x69,0x6d,0x69,0x7a,0x65,
+0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x05,
+0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x1b,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x2e,0x70,0x79,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x08,0x6f,0x70,0x74,0x69,0x6d,0x69,0x7a,0x65,
+0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x05,0x01,0x20,0x20,0x20,0x20,0x20,
+0x66,0x6f,0x72,0x20,0x6e,0x20,0x69,0x6e,0x20,0x6e,0x6f,0x64,0x65,0x73,0x3a,0x00,
+0x0c,0x02,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x01,0x00,0x02,
+0x13,0x00,0x00,0x2f,0x33,0x03,0x00,0x01,0x6e,0x00,0x00,0x00,0x10,0x03,0x01,0x00,
+0x1f,0x07,0x01,0x21,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,
+0x5b,0x30,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x66,0x6e,0x63,0x27,0x3a,0x00,0x00,0x00,
+0x0c,0x04,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x01,0x03,0x04,
+0x0d,0x04,0x00,0x03,0x00,0x00,0x00,0x03,0x66,0x6e,0x63,0x00,0x18,0x01,0x01,0x04,
+0x16,0x01,0x00,0x00,0x13,0x00,0xff,0xea,0x1f,0x09,0x01,0x22,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x5b,0x33,0x5d,0x20,0x3d,0x20,0x6f,
+0x70,0x74,0x69,0x6d,0x69,0x7a,0x65,0x28,0x6e,0x5b,0x33,0x5d,0x29,0x00,0x00,0x00,
+0x0e,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x6f,0x70,0x74,0x69,0x6d,0x69,0x7a,0x65,
+0x00,0x00,0x00,0x00,0x0c,0x06,0x00,0x04,0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,
+0x0a,0x05,0x03,0x06,0x37,0x01,0x04,0x02,0x0c,0x04,0x00,0x04,0x00,0x00,0x69,0x04,
+0x03,0x00,0x00,0x00,0x0b,0x03,0x04,0x01,0x13,0x00,0xff,0xd1,0x1f,0x05,0x01,0x23,
+0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x20,0x3d,0x20,0x54,0x72,
+0x75,0x65,0x00,0x00,0x33,0x01,0x00,0x07,0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x00,
+0x0c,0x01,0x00,0x05,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x1f,0x05,0x01,0x24,
+0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x63,0x68,0x61,0x6e,0x67,0x65,
+0x64,0x3a,0x00,0x00,0x16,0x01,0x00,0x00,0x13,0x00,0x01,0x5c,0x1f,0x09,0x01,0x25,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x61,0x67,0x73,0x20,0x3d,0x20,0x69,
+0x6e,0x64,0x65,0x78,0x5f,0x74,0x61,0x67,0x73,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,
+0x00,0x00,0x00,0x00,0x33,0x02,0x00,0x04,0x74,0x61,0x67,0x73,0x00,0x00,0x00,0x00,
+0x0e,0x05,0x00,0x06,0x00,0x00,0x00,0x0a,0x69,0x6e,0x64,0x65,0x78,0x5f,0x74,0x61,
+0x67,0x73,0x00,0x00,0x10,0x06,0x00,0x00,0x37,0x02,0x05,0x02,0x1f,0x0b,0x01,0x26,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x20,
+0x3d,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x6a,0x75,0x6d,0x70,0x73,0x28,0x6e,
+0x6f,0x64,0x65,0x73,0x2c,0x20,0x74,0x61,0x67,0x73,0x29,0x00,0x0e,0x05,0x00,0x07,
+0x00,0x00,0x00,0x0c,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x6a,0x75,0x6d,0x70,0x73,
+0x00,0x00,0x00,0x00,0x10,0x06,0x00,0x00,0x10,0x07,0x02,0x00,0x37,0x01,0x05,0x03,
+0x1f,0x08,0x01,0x27,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x6f,0x64,0x65,
+0x73,0x20,0x3d,0x20,0x73,0x77,0x65,0x65,0x70,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x08,0x00,0x00,0x00,0x05,0x73,0x77,0x65,0x65,
+0x70,0x00,0x00,0x00,0x10,0x06,0x00,0x00,0x37,0x00,0x05,0x02,0x1f,0x09,0x01,0x28,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x61,0x67,0x73,0x20,0x3d,0x20,0x69,
+0x6e,0x64,0x65,0x78,0x5f,0x74,0x61,0x67,0x73,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x06,0x00,0x00,0x00,0x0a,0x69,0x6e,0x64,0x65,
+0x78,0x5f,0x74,0x61,0x67,0x73,0x00,0x00,0x10,0x06,0x00,0x00,0x37,0x02,0x05,0x02,
+0x1f,0x08,0x01,0x29,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,
+0x6e,0x76,0x65,0x72,0x74,0x28,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x74,0x61,0x67,
+0x73,0x29,0x3a,0x00,0x0e,0x05,0x00,0x09,0x00,0x00,0x00,0x06,0x69,0x6e,0x76,0x65,
+0x72,0x74,0x00,0x00,0x10,0x06,0x00,0x00,0x10,0x07,0x02,0x00,0x37,0x04,0x05,0x03,
+0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x2e,0x1f,0x07,0x01,0x2a,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x20,
+0x3d,0x20,0x54,0x72,0x75,0x65,0x00,0x00,0x0c,0x01,0x00,0x05,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x1f,0x09,0x01,0x2b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6e,0x6f,0x64,0x65,0x73,0x20,0x3d,0x20,0x73,0x77,0x65,0x65,
+0x70,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x08,
+0x00,0x00,0x00,0x05,0x73,0x77,0x65,0x65,0x70,0x00,0x00,0x00,0x10,0x06,0x00,0x00,
+0x37,0x00,0x05,0x02,0x1f,0x0a,0x01,0x2c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x74,0x61,0x67,0x73,0x20,0x3d,0x20,0x69,0x6e,0x64,0x65,0x78,
+0x5f,0x74,0x61,0x67,0x73,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x05,0x00,0x06,0x00,0x00,0x00,0x0a,0x69,0x6e,0x64,0x65,0x78,0x5f,0x74,0x61,
+0x67,0x73,0x00,0x00,0x10,0x06,0x00,0x00,0x37,0x02,0x05,0x02,0x1f,0x06,0x01,0x2d,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x61,0x6e,0x64,0x6c,0x65,0x72,0x73,
+0x20,0x3d,0x20,0x5b,0x5d,0x00,0x00,0x00,0x33,0x04,0x00,0x08,0x68,0x61,0x6e,0x64,
+0x6c,0x65,0x72,0x73,0x00,0x00,0x00,0x00,0x1c,0x05,0x00,0x00,0x10,0x04,0x05,0x00,
+0x1f,0x06,0x01,0x2e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,
+0x6e,0x20,0x69,0x6e,0x20,0x6e,0x6f,0x64,0x65,0x73,0x3a,0x00,0x0c,0x06,0x00,0x02,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x05,0x00,0x06,0x13,0x00,0x00,0x30,
+0x10,0x03,0x05,0x00,0x1f,0x09,0x01,0x2f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,0x5b,0x30,0x5d,0x20,0x3d,0x3d,0x20,0x27,
+0x73,0x65,0x74,0x6a,0x6d,0x70,0x27,0x3a,0x00,0x00,0x00,0x00,0x0c,0x07,0x00,0x02,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x05,0x03,0x07,0x0d,0x07,0x00,0x0a,
+0x00,0x00,0x00,0x06,0x73,0x65,0x74,0x6a,0x6d,0x70,0x00,0x00,0x18,0x05,0x05,0x07,
+0x16,0x05,0x00,0x00,0x13,0x00,0xff,0xe9,0x1f,0x0b,0x01,0x30,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x61,0x6e,0x64,
+0x6c,0x65,0x72,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x74,0x61,0x67,0x73,
+0x5b,0x6e,0x5b,0x31,0x5d,0x5d,0x29,0x00,0x0d,0x05,0x00,0x0b,0x00,0x00,0x00,0x06,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x07,0x04,0x05,0x00,0x00,0x00,0x00,
+0x0c,0x05,0x00,0x05,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x05,0x03,0x05,
+0x0a,0x09,0x02,0x05,0x39,0x05,0x07,0x03,0x13,0x00,0xff,0xd0,0x1f,0x0a,0x01,0x31,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x66,0x6f,0x6c,0x64,0x28,
+0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x74,0x61,0x67,0x73,0x2c,0x20,0x68,0x61,0x6e,
+0x64,0x6c,0x65,0x72,0x73,0x29,0x3a,0x00,0x0e,0x06,0x00,0x0c,0x00,0x00,0x00,0x04,
+0x66,0x6f,0x6c,0x64,0x00,0x00,0x00,0x00,0x10,0x07,0x00,0x00,0x10,0x08,0x02,0x00,
+0x10,0x09,0x04,0x00,0x37,0x05,0x06,0x04,0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x1c,
+0x1f,0x07,0x01,0x32,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x20,0x3d,0x20,0x54,0x72,0x75,0x65,0x00,0x00,
+0x0c,0x01,0x00,0x05,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x1f,0x09,0x01,0x33,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x6f,0x64,0x65,
+0x73,0x20,0x3d,0x20,0x73,0x77,0x65,0x65,0x70,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x08,0x00,0x00,0x00,0x05,0x73,0x77,0x65,0x65,
+0x70,0x00,0x00,0x00,0x10,0x07,0x00,0x00,0x37,0x00,0x06,0x02,0x1f,0x08,0x01,0x34,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x72,0x65,0x6d,0x6f,0x76,
+0x65,0x5f,0x64,0x65,0x61,0x64,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,0x3a,0x00,0x00,
+0x0e,0x06,0x00,0x0d,0x00,0x00,0x00,0x0b,0x72,0x65,0x6d,0x6f,0x76,0x65,0x5f,0x64,
+0x65,0x61,0x64,0x00,0x10,0x07,0x00,0x00,0x37,0x05,0x06,0x02,0x16,0x05,0x00,0x00,
+0x13,0x00,0x00,0x1c,0x1f,0x07,0x01,0x35,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x20,0x3d,0x20,0x54,0x72,
+0x75,0x65,0x00,0x00,0x0c,0x01,0x00,0x05,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x1f,0x09,0x01,0x36,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6e,0x6f,0x64,0x65,0x73,0x20,0x3d,0x20,0x73,0x77,0x65,0x65,0x70,0x28,0x6e,0x6f,
+0x64,0x65,0x73,0x29,0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x08,0x00,0x00,0x00,0x05,
+0x73,0x77,0x65,0x65,0x70,0x00,0x00,0x00,0x10,0x07,0x00,0x00,0x37,0x00,0x06,0x02,
+0x1f,0x08,0x01,0x37,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x72,
+0x65,0x6d,0x6f,0x76,0x65,0x5f,0x74,0x61,0x67,0x73,0x28,0x6e,0x6f,0x64,0x65,0x73,
+0x29,0x3a,0x00,0x00,0x0e,0x06,0x00,0x0e,0x00,0x00,0x00,0x0b,0x72,0x65,0x6d,0x6f,
+0x76,0x65,0x5f,0x74,0x61,0x67,0x73,0x00,0x10,0x07,0x00,0x00,0x37,0x05,0x06,0x02,
+0x16,0x05,0x00,0x00,0x13,0x00,0xfe,0xc0,0x1f,0x07,0x01,0x38,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x20,
+0x3d,0x20,0x54,0x72,0x75,0x65,0x00,0x00,0x0c,0x01,0x00,0x05,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x1f,0x09,0x01,0x39,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6e,0x6f,0x64,0x65,0x73,0x20,0x3d,0x20,0x73,0x77,0x65,0x65,
+0x70,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x08,
+0x00,0x00,0x00,0x05,0x73,0x77,0x65,0x65,0x70,0x00,0x00,0x00,0x10,0x07,0x00,0x00,
+0x37,0x00,0x06,0x02,0x13,0x00,0xfe,0xa4,0x1f,0x05,0x01,0x3a,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x00,
+0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x13,0x00,0x56,0x00,0x00,0x00,0x08,
+0x6f,0x70,0x74,0x69,0x6d,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x0f,0x13,0x12,0x00,
+0x1f,0x05,0x01,0x3c,0x64,0x65,0x66,0x20,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,
+0x28,0x6f,0x75,0x74,0x29,0x3a,0x00,0x00,0x33,0x13,0x00,0x05,0x2a,0x24,0x32,0x32,
+0x37,0x00,0x00,0x00,0x0d,0x01,0x00,0x39,0x00,0x00,0x00,0x03,0x6f,0x75,0x74,0x00,
+0x1c,0x14,0x01,0x01,0x1c,0x15,0x00,0x00,0x1d,0x16,0x00,0x00,0x1d,0x17,0x00,0x00,
+0x11,0x13,0x00,0xa5,0x2d,0x08,0x00,0x0b,0x00,0x00,0x00,0x00,0x1f,0x05,0x01,0x3c,
+0x64,0x65,0x66,0x20,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x28,0x6f,0x75,0x74,
+0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x03,0x6f,0x75,0x74,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x2e,0x70,0x79,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x08,0x70,0x65,0x65,0x70,
+0x68,0x6f,0x6c,0x65,0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x09,0x01,0x3e,
+0x20,0x20,0x20,0x20,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x69,0x20,0x3d,0x20,0x70,
+0x61,0x72,0x73,0x65,0x28,0x6f,0x75,0x74,0x2c,0x20,0x30,0x2c,0x20,0x4e,0x6f,0x6e,
+0x65,0x29,0x00,0x00,0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x05,0x70,0x61,0x72,0x73,
+0x65,0x00,0x00,0x00,0x10,0x03,0x00,0x00,0x0c,0x04,0x00,0x03,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x1d,0x05,0x00,0x00,0x37,0x01,0x02,0x04,0x33,0x01,0x00,0x03,
+0x2a,0x24,0x32,0x00,0x33,0x02,0x00,0x05,0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,
+0x0c,0x04,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x02,0x01,0x04,
+0x33,0x03,0x00,0x01,0x69,0x00,0x00,0x00,0x0c,0x05,0x00,0x04,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x03,0x01,0x05,0x1f,0x09,0x01,0x3f,0x20,0x20,0x20,0x20,
+0x73,0x74,0x61,0x74,0x73,0x5b,0x27,0x62,0x65,0x66,0x6f,0x72,0x65,0x27,0x5d,0x20,
+0x2b,0x3d,0x20,0x63,0x6f,0x75,0x6e,0x74,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,0x00,
+0x0e,0x01,0x00,0x05,0x00,0x00,0x00,0x05,0x73,0x74,0x61,0x74,0x73,0x00,0x00,0x00,
+0x0e,0x04,0x00,0x05,0x00,0x00,0x00,0x05,0x73,0x74,0x61,0x74,0x73,0x00,0x00,0x00,
+0x0d,0x05,0x00,0x06,0x00,0x00,0x00,0x06,0x62,0x65,0x66,0x6f,0x72,0x65,0x00,0x00,
+0x0a,0x04,0x04,0x05,0x0e,0x06,0x00,0x07,0x00,0x00,0x00,0x05,0x63,0x6f,0x75,0x6e,
+0x74,0x00,0x00,0x00,0x10,0x07,0x02,0x00,0x37,0x05,0x06,0x02,0x01,0x04,0x04,0x05,
+0x0d,0x05,0x00,0x06,0x00,0x00,0x00,0x06,0x62,0x65,0x66,0x6f,0x72,0x65,0x00,0x00,
+0x0b,0x01,0x05,0x04,0x1f,0x07,0x01,0x40,0x20,0x20,0x20,0x20,0x6e,0x6f,0x64,0x65,
+0x73,0x20,0x3d,0x20,0x6f,0x70,0x74,0x69,0x6d,0x69,0x7a,0x65,0x28,0x6e,0x6f,0x64,
+0x65,0x73,0x29,0x00,0x0e,0x04,0x00,0x08,0x00,0x00,0x00,0x08,0x6f,0x70,0x74,0x69,
+0x6d,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x10,0x05,0x02,0x00,0x37,0x02,0x04,0x02,
+0x1f,0x09,0x01,0x41,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x74,0x73,0x5b,0x27,0x61,
+0x66,0x74,0x65,0x72,0x27,0x5d,0x20,0x2b,0x3d,0x20,0x63,0x6f,0x75,0x6e,0x74,0x28,
+0x6e,0x6f,0x64,0x65,0x73,0x29,0x00,0x00,0x0e,0x01,0x00,0x05,0x00,0x00,0x00,0x05,
+0x73,0x74,0x61,0x74,0x73,0x00,0x00,0x00,0x0e,0x04,0x00,0x05,0x00,0x00,0x00,0x05,
+0x73,0x74,0x61,0x74,0x73,0x00,0x00,0x00,0x0d,0x05,0x00,0x09,0x00,0x00,0x00,0x05,
+0x61,0x66,0x74,0x65,0x72,0x00,0x00,0x00,0x0a,0x04,0x04,0x05,0x0e,0x06,0x00,0x07,
+0x00,0x00,0x00,0x05,0x63,0x6f,0x75,0x6e,0x74,0x00,0x00,0x00,0x10,0x07,0x02,0x00,
+0x37,0x05,0x06,0x02,0x01,0x04,0x04,0x05,0x0d,0x05,0x00,0x09,0x00,0x00,0x00,0x05,
+0x61,0x66,0x74,0x65,0x72,0x00,0x00,0x00,0x0b,0x01,0x05,0x04,0x1f,0x08,0x01,0x42,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x75,0x6e,0x70,0x61,0x72,
+0x73,0x65,0x28,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x5b,0x5d,0x29,0x00,0x00,0x00,
+0x0e,0x04,0x00,0x0a,0x00,0x00,0x00,0x07,0x75,0x6e,0x70,0x61,0x72,0x73,0x65,0x00,
+0x10,0x05,0x02,0x00,0x1c,0x06,0x00,0x00,0x37,0x01,0x04,0x03,0x15,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x14,0x00,0x57,0x00,0x00,0x00,0x08,0x70,0x65,0x65,0x70,
+0x68,0x6f,0x6c,0x65,0x00,0x00,0x00,0x00,0x0f,0x14,0x13,0x00,0x00,0x00,0x00,0x00,
+};
+
+static tpd_code * _tp_tinypy_compiler_peephole_0(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 31: goto L31;
+        case 39: goto L39;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 60: goto L60;
+        case 65: goto L65;
+        case 73: goto L73;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 92: goto L92;
+        case 96: goto L96;
+        case 99: goto L99;
+        case 102: goto L102;
+        case 106: goto L106;
+        case 109: goto L109;
+        case 110: goto L110;
+        case 111: goto L111;
+        case 124: goto L124;
+        case 129: goto L129;
+        case 133: goto L133;
+        case 137: goto L137;
+        case 141: goto L141;
+        case 145: goto L145;
+        case 149: goto L149;
+        case 150: goto L150;
+        case 151: goto L151;
+        case 171: goto L171;
+        case 175: goto L175;
+        case 178: goto L178;
+        case 181: goto L181;
+        case 184: goto L184;
+        case 187: goto L187;
+        case 190: goto L190;
+        case 193: goto L193;
+        case 196: goto L196;
+        case 199: goto L199;
+        case 203: goto L203;
+        case 207: goto L207;
+        case 211: goto L211;
+        case 225: goto L225;
+        case 228: goto L228;
+        case 231: goto L231;
+        case 234: goto L234;
+        case 237: goto L237;
+        case 240: goto L240;
+        case 243: goto L243;
+        case 246: goto L246;
+        case 250: goto L250;
+        case 253: goto L253;
+        case 257: goto L257;
+        case 258: goto L258;
+        case 259: goto L259;
+        case 269: goto L269;
+        case 273: goto L273;
+        case 276: goto L276;
+        case 280: goto L280;
+        case 283: goto L283;
+        case 287: goto L287;
+        case 288: goto L288;
+        case 289: goto L289;
+        case 301: goto L301;
+        case 305: goto L305;
+        case 309: goto L309;
+        case 313: goto L313;
+        case 317: goto L317;
+        case 321: goto L321;
+        case 325: goto L325;
+        case 326: goto L326;
+        case 327: goto L327;
+        case 346: goto L346;
+        case 351: goto L351;
+        case 355: goto L355;
+        case 359: goto L359;
+        case 360: goto L360;
+        case 364: goto L364;
+        case 365: goto L365;
+        case 369: goto L369;
+        case 373: goto L373;
+        case 377: goto L377;
+        case 381: goto L381;
+        case 385: goto L385;
+        case 386: goto L386;
+        case 387: goto L387;
+        case 388: goto L388;
+        case 397: goto L397;
+        case 401: goto L401;
+        case 405: goto L405;
+        case 408: goto L408;
+        case 412: goto L412;
+        case 415: goto L415;
+        case 416: goto L416;
+        case 417: goto L417;
+        case 424: goto L424;
+        case 427: goto L427;
+        case 430: goto L430;
+        case 433: goto L433;
+        case 436: goto L436;
+        case 437: goto L437;
+        case 438: goto L438;
+        case 439: goto L439;
+        case 440: goto L440;
+        case 981: goto L981;
+        case 985: goto L985;
+        case 986: goto L986;
+        case 994: goto L994;
+        case 997: goto L997;
+        case 1001: goto L1001;
+        case 1004: goto L1004;
+        case 1005: goto L1005;
+        case 1006: goto L1006;
+        case 1007: goto L1007;
+        case 1008: goto L1008;
+        case 1306: goto L1306;
+        case 1310: goto L1310;
+        case 1311: goto L1311;
+        case 1317: goto L1317;
+        case 1320: goto L1320;
+        case 1324: goto L1324;
+        case 1325: goto L1325;
+        case 1326: goto L1326;
+        case 1327: goto L1327;
+        case 1328: goto L1328;
+        case 1481: goto L1481;
+        case 1485: goto L1485;
+        case 1486: goto L1486;
+        case 1491: goto L1491;
+        case 1494: goto L1494;
+        case 1497: goto L1497;
+        case 1500: goto L1500;
+        case 1501: goto L1501;
+        case 1502: goto L1502;
+        case 1503: goto L1503;
+        case 1504: goto L1504;
+        case 1582: goto L1582;
+        case 1586: goto L1586;
+        case 1587: goto L1587;
+        case 1592: goto L1592;
+        case 1595: goto L1595;
+        case 1598: goto L1598;
+        case 1599: goto L1599;
+        case 1600: goto L1600;
+        case 1601: goto L1601;
+        case 1602: goto L1602;
+        case 2066: goto L2066;
+        case 2070: goto L2070;
+        case 2071: goto L2071;
+        case 2076: goto L2076;
+        case 2079: goto L2079;
+        case 2082: goto L2082;
+        case 2083: goto L2083;
+        case 2084: goto L2084;
+        case 2085: goto L2085;
+        case 2086: goto L2086;
+        case 2267: goto L2267;
+        case 2271: goto L2271;
+        case 2272: goto L2272;
+        case 2279: goto L2279;
+        case 2282: goto L2282;
+        case 2286: goto L2286;
+        case 2287: goto L2287;
+        case 2288: goto L2288;
+        case 2289: goto L2289;
+        case 2290: goto L2290;
+        case 2398: goto L2398;
+        case 2403: goto L2403;
+        case 2404: goto L2404;
+        case 2412: goto L2412;
+        case 2415: goto L2415;
+        case 2419: goto L2419;
+        case 2422: goto L2422;
+        case 2423: goto L2423;
+        case 2424: goto L2424;
+        case 2425: goto L2425;
+        case 2426: goto L2426;
+        case 2508: goto L2508;
+        case 2513: goto L2513;
+        case 2514: goto L2514;
+        case 2522: goto L2522;
+        case 2525: goto L2525;
+        case 2529: goto L2529;
+        case 2532: goto L2532;
+        case 2533: goto L2533;
+        case 2534: goto L2534;
+        case 2535: goto L2535;
+        case 2536: goto L2536;
+        case 2664: goto L2664;
+        case 2669: goto L2669;
+        case 2670: goto L2670;
+        case 2679: goto L2679;
+        case 2682: goto L2682;
+        case 2686: goto L2686;
+        case 2690: goto L2690;
+        case 2693: goto L2693;
+        case 2694: goto L2694;
+        case 2695: goto L2695;
+        case 2696: goto L2696;
+        case 2697: goto L2697;
+        case 2910: goto L2910;
+        case 2915: goto L2915;
+        case 2916: goto L2916;
+        case 2928: goto L2928;
+        case 2931: goto L2931;
+        case 2935: goto L2935;
+        case 2939: goto L2939;
+        case 2944: goto L2944;
+        case 2948: goto L2948;
+        case 2951: goto L2951;
+        case 2952: goto L2952;
+        case 2953: goto L2953;
+        case 2954: goto L2954;
+        case 2955: goto L2955;
+        case 3197: goto L3197;
+        case 3201: goto L3201;
+        case 3202: goto L3202;
+        case 3208: goto L3208;
+        case 3211: goto L3211;
+        case 3214: goto L3214;
+        case 3217: goto L3217;
+        case 3218: goto L3218;
+        case 3219: goto L3219;
+        case 3220: goto L3220;
+        case 3221: goto L3221;
+        case 3278: goto L3278;
+        case 3282: goto L3282;
+        case 3283: goto L3283;
+        case 3290: goto L3290;
+        case 3293: goto L3293;
+        case 3297: goto L3297;
+        case 3298: goto L3298;
+        case 3299: goto L3299;
+        case 3300: goto L3300;
+        case 3301: goto L3301;
+        case 3622: goto L3622;
+        case 3627: goto L3627;
+        case 3628: goto L3628;
+        case 3635: goto L3635;
+        case 3638: goto L3638;
+        case 3642: goto L3642;
+        case 3643: goto L3643;
+        case 3644: goto L3644;
+        case 3645: goto L3645;
+        case 3646: goto L3646;
+        case 3861: goto L3861;
+        case 3866: goto L3866;
+        case 3867: goto L3867;
+        case 3876: goto L3876;
+        case 3879: goto L3879;
+        case 3883: goto L3883;
+        case 3887: goto L3887;
+        case 3888: goto L3888;
+        case 3889: goto L3889;
+        case 3890: goto L3890;
+        case 3891: goto L3891;
+        case 4268: goto L4268;
+        case 4274: goto L4274;
+        case 4275: goto L4275;
+        case 4285: goto L4285;
+        case 4288: goto L4288;
+        case 4292: goto L4292;
+        case 4296: goto L4296;
+        case 4301: goto L4301;
+        case 4302: goto L4302;
+        case 4303: goto L4303;
+        case 4304: goto L4304;
+        case 4305: goto L4305;
+        case 4995: goto L4995;
+        case 4999: goto L4999;
+        case 5000: goto L5000;
+        case 5008: goto L5008;
+        case 5011: goto L5011;
+        case 5015: goto L5015;
+        case 5019: goto L5019;
+        case 5020: goto L5020;
+        case 5021: goto L5021;
+        case 5022: goto L5022;
+        case 5023: goto L5023;
+        case 5385: goto L5385;
+        case 5389: goto L5389;
+        case 5390: goto L5390;
+        case 5396: goto L5396;
+        case 5399: goto L5399;
+        case 5403: goto L5403;
+        case 5404: goto L5404;
+        case 5405: goto L5405;
+        case 5406: goto L5406;
+        case 5407: goto L5407;
+        case 5498: goto L5498;
+        case 5502: goto L5502;
+        case 5503: goto L5503;
+        case 5510: goto L5510;
+        case 5513: goto L5513;
+        case 5517: goto L5517;
+        case 5518: goto L5518;
+        case 5519: goto L5519;
+        case 5520: goto L5520;
+        case 5521: goto L5521;
+        case 5982: goto L5982;
+        case 5987: goto L5987;
+        case 5988: goto L5988;
+        case 5994: goto L5994;
+        case 5997: goto L5997;
+        case 6000: goto L6000;
+        case 6001: goto L6001;
+        case 6002: goto L6002;
+        case 6003: goto L6003;
+        case 6004: goto L6004;
+        case 6169: goto L6169;
+        case 6174: goto L6174;
+        case 6175: goto L6175;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 1;
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[0];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L25: /* NAME */
+    f->name = regs[0];
+L26: /* GGET */
+    tp_aot_op(tp, f, code + 26);
+L31: /* STRING */
+    tp_aot_op(tp, f, code + 31);
+L39: /* STRING */
+    tp_aot_op(tp, f, code + 39);
+L42: /* CALLP */
+    return code + 42;
+L43: /* GGET */
+    tp_aot_op(tp, f, code + 43);
+L48: /* UPDATE */
+    tp_aot_op(tp, f, code + 48);
+L49: /* LINE */
+    f->line = code + 49;
+    f->lineno = 2;
+L60: /* GGET */
+    tp_aot_op(tp, f, code + 60);
+L65: /* STRING */
+    tp_aot_op(tp, f, code + 65);
+L73: /* STRING */
+    tp_aot_op(tp, f, code + 73);
+L76: /* CALLP */
+    return code + 76;
+L77: /* GGET */
+    tp_aot_op(tp, f, code + 77);
+L82: /* UPDATE */
+    tp_aot_op(tp, f, code + 82);
+L83: /* LINE */
+    f->line = code + 83;
+    f->lineno = 17;
+L92: /* STRING */
+    tp_aot_op(tp, f, code + 92);
+L96: /* GGET */
+    tp_aot_op(tp, f, code + 96);
+L99: /* GGET */
+    tp_aot_op(tp, f, code + 99);
+L102: /* GGET */
+    tp_aot_op(tp, f, code + 102);
+L106: /* GGET */
+    tp_aot_op(tp, f, code + 106);
+L109: /* LIST */
+    tp_aot_op(tp, f, code + 109);
+L110: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L111: /* LINE */
+    f->line = code + 111;
+    f->lineno = 19;
+L124: /* STRING */
+    tp_aot_op(tp, f, code + 124);
+L129: /* GGET */
+    tp_aot_op(tp, f, code + 129);
+L133: /* GGET */
+    tp_aot_op(tp, f, code + 133);
+L137: /* GGET */
+    tp_aot_op(tp, f, code + 137);
+L141: /* GGET */
+    tp_aot_op(tp, f, code + 141);
+L145: /* GGET */
+    tp_aot_op(tp, f, code + 145);
+L149: /* LIST */
+    tp_aot_op(tp, f, code + 149);
+L150: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L151: /* LINE */
+    f->line = code + 151;
+    f->lineno = 20;
+L171: /* STRING */
+    tp_aot_op(tp, f, code + 171);
+L175: /* GGET */
+    tp_aot_op(tp, f, code + 175);
+L178: /* GGET */
+    tp_aot_op(tp, f, code + 178);
+L181: /* GGET */
+    tp_aot_op(tp, f, code + 181);
+L184: /* GGET */
+    tp_aot_op(tp, f, code + 184);
+L187: /* GGET */
+    tp_aot_op(tp, f, code + 187);
+L190: /* GGET */
+    tp_aot_op(tp, f, code + 190);
+L193: /* GGET */
+    tp_aot_op(tp, f, code + 193);
+L196: /* GGET */
+    tp_aot_op(tp, f, code + 196);
+L199: /* GGET */
+    tp_aot_op(tp, f, code + 199);
+L203: /* GGET */
+    tp_aot_op(tp, f, code + 203);
+L207: /* GGET */
+    tp_aot_op(tp, f, code + 207);
+L211: /* LINE */
+    f->line = code + 211;
+    f->lineno = 21;
+L225: /* GGET */
+    tp_aot_op(tp, f, code + 225);
+L228: /* GGET */
+    tp_aot_op(tp, f, code + 228);
+L231: /* GGET */
+    tp_aot_op(tp, f, code + 231);
+L234: /* GGET */
+    tp_aot_op(tp, f, code + 234);
+L237: /* GGET */
+    tp_aot_op(tp, f, code + 237);
+L240: /* GGET */
+    tp_aot_op(tp, f, code + 240);
+L243: /* GGET */
+    tp_aot_op(tp, f, code + 243);
+L246: /* GGET */
+    tp_aot_op(tp, f, code + 246);
+L250: /* GGET */
+    tp_aot_op(tp, f, code + 250);
+L253: /* GGET */
+    tp_aot_op(tp, f, code + 253);
+L257: /* LIST */
+    tp_aot_op(tp, f, code + 257);
+L258: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L259: /* LINE */
+    f->line = code + 259;
+    f->lineno = 22;
+L269: /* STRING */
+    tp_aot_op(tp, f, code + 269);
+L273: /* GGET */
+    tp_aot_op(tp, f, code + 273);
+L276: /* GGET */
+    tp_aot_op(tp, f, code + 276);
+L280: /* GGET */
+    tp_aot_op(tp, f, code + 280);
+L283: /* GGET */
+    tp_aot_op(tp, f, code + 283);
+L287: /* LIST */
+    tp_aot_op(tp, f, code + 287);
+L288: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L289: /* LINE */
+    f->line = code + 289;
+    f->lineno = 23;
+L301: /* STRING */
+    tp_aot_op(tp, f, code + 301);
+L305: /* GGET */
+    tp_aot_op(tp, f, code + 305);
+L309: /* GGET */
+    tp_aot_op(tp, f, code + 309);
+L313: /* GGET */
+    tp_aot_op(tp, f, code + 313);
+L317: /* GGET */
+    tp_aot_op(tp, f, code + 317);
+L321: /* GGET */
+    tp_aot_op(tp, f, code + 321);
+L325: /* LIST */
+    tp_aot_op(tp, f, code + 325);
+L326: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L327: /* LINE */
+    f->line = code + 327;
+    f->lineno = 25;
+L346: /* STRING */
+    tp_aot_op(tp, f, code + 346);
+L351: /* GGET */
+    tp_aot_op(tp, f, code + 351);
+L355: /* GGET */
+    tp_aot_op(tp, f, code + 355);
+L359: /* ADD */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 359);
+    }
+L360: /* GGET */
+    tp_aot_op(tp, f, code + 360);
+L364: /* ADD */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 364);
+    }
+L365: /* GGET */
+    tp_aot_op(tp, f, code + 365);
+L369: /* GGET */
+    tp_aot_op(tp, f, code + 369);
+L373: /* GGET */
+    tp_aot_op(tp, f, code + 373);
+L377: /* GGET */
+    tp_aot_op(tp, f, code + 377);
+L381: /* GGET */
+    tp_aot_op(tp, f, code + 381);
+L385: /* LIST */
+    tp_aot_op(tp, f, code + 385);
+L386: /* ADD */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 386);
+    }
+L387: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L388: /* LINE */
+    f->line = code + 388;
+    f->lineno = 28;
+L397: /* STRING */
+    tp_aot_op(tp, f, code + 397);
+L401: /* STRING */
+    tp_aot_op(tp, f, code + 401);
+L405: /* NUMBER */
+    tp_aot_op(tp, f, code + 405);
+L408: /* STRING */
+    tp_aot_op(tp, f, code + 408);
+L412: /* NUMBER */
+    tp_aot_op(tp, f, code + 412);
+L415: /* DICT */
+    tp_aot_op(tp, f, code + 415);
+L416: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L417: /* LINE */
+    f->line = code + 417;
+    f->lineno = 30;
+L424: /* VAR */
+L427: /* STRING */
+    tp_aot_op(tp, f, code + 427);
+L430: /* STRING */
+    tp_aot_op(tp, f, code + 430);
+L433: /* STRING */
+    tp_aot_op(tp, f, code + 433);
+L436: /* LIST */
+    tp_aot_op(tp, f, code + 436);
+L437: /* LIST */
+    tp_aot_op(tp, f, code + 437);
+L438: /* NONE */
+    regs[3] = tp_None;
+L439: /* NONE */
+    regs[4] = tp_None;
+L440: /* DEF */
+    tp_aot_op(tp, f, code + 440);
+L981: /* STRING */
+    tp_aot_op(tp, f, code + 981);
+L985: /* GSET */
+    tp_set(tp, f->globals, regs[1], regs[0]);
+L986: /* LINE */
+    f->line = code + 986;
+    f->lineno = 60;
+L994: /* VAR */
+L997: /* STRING */
+    tp_aot_op(tp, f, code + 997);
+L1001: /* STRING */
+    tp_aot_op(tp, f, code + 1001);
+L1004: /* LIST */
+    tp_aot_op(tp, f, code + 1004);
+L1005: /* LIST */
+    tp_aot_op(tp, f, code + 1005);
+L1006: /* NONE */
+    regs[4] = tp_None;
+L1007: /* NONE */
+    regs[5] = tp_None;
+L1008: /* DEF */
+    tp_aot_op(tp, f, code + 1008);
+L1306: /* STRING */
+    tp_aot_op(tp, f, code + 1306);
+L1310: /* GSET */
+    tp_set(tp, f->globals, regs[2], regs[1]);
+L1311: /* LINE */
+    f->line = code + 1311;
+    f->lineno = 76;
+L1317: /* VAR */
+L1320: /* STRING */
+    tp_aot_op(tp, f, code + 1320);
+L1324: /* LIST */
+    tp_aot_op(tp, f, code + 1324);
+L1325: /* LIST */
+    tp_aot_op(tp, f, code + 1325);
+L1326: /* NONE */
+    regs[5] = tp_None;
+L1327: /* NONE */
+    regs[6] = tp_None;
+L1328: /* DEF */
+    tp_aot_op(tp, f, code + 1328);
+L1481: /* STRING */
+    tp_aot_op(tp, f, code + 1481);
+L1485: /* GSET */
+    tp_set(tp, f->globals, regs[3], regs[2]);
+L1486: /* LINE */
+    f->line = code + 1486;
+    f->lineno = 85;
+L1491: /* VAR */
+L1494: /* STRING */
+    tp_aot_op(tp, f, code + 1494);
+L1497: /* STRING */
+    tp_aot_op(tp, f, code + 1497);
+L1500: /* LIST */
+    tp_aot_op(tp, f, code + 1500);
+L1501: /* LIST */
+    tp_aot_op(tp, f, code + 1501);
+L1502: /* NONE */
+    regs[6] = tp_None;
+L1503: /* NONE */
+    regs[7] = tp_None;
+L1504: /* DEF */
+    tp_aot_op(tp, f, code + 1504);
+L1582: /* STRING */
+    tp_aot_op(tp, f, code + 1582);
+L1586: /* GSET */
+    tp_set(tp, f->globals, regs[4], regs[3]);
+L1587: /* LINE */
+    f->line = code + 1587;
+    f->lineno = 91;
+L1592: /* VAR */
+L1595: /* STRING */
+    tp_aot_op(tp, f, code + 1595);
+L1598: /* LIST */
+    tp_aot_op(tp, f, code + 1598);
+L1599: /* LIST */
+    tp_aot_op(tp, f, code + 1599);
+L1600: /* NONE */
+    regs[7] = tp_None;
+L1601: /* NONE */
+    regs[8] = tp_None;
+L1602: /* DEF */
+    tp_aot_op(tp, f, code + 1602);
+L2066: /* STRING */
+    tp_aot_op(tp, f, code + 2066);
+L2070: /* GSET */
+    tp_set(tp, f->globals, regs[5], regs[4]);
+L2071: /* LINE */
+    f->line = code + 2071;
+    f->lineno = 108;
+L2076: /* VAR */
+L2079: /* STRING */
+    tp_aot_op(tp, f, code + 2079);
+L2082: /* LIST */
+    tp_aot_op(tp, f, code + 2082);
+L2083: /* LIST */
+    tp_aot_op(tp, f, code + 2083);
+L2084: /* NONE */
+    regs[8] = tp_None;
+L2085: /* NONE */
+    regs[9] = tp_None;
+L2086: /* DEF */
+    tp_aot_op(tp, f, code + 2086);
+L2267: /* STRING */
+    tp_aot_op(tp, f, code + 2267);
+L2271: /* GSET */
+    tp_set(tp, f->globals, regs[6], regs[5]);
+L2272: /* LINE */
+    f->line = code + 2272;
+    f->lineno = 118;
+L2279: /* VAR */
+L2282: /* STRING */
+    tp_aot_op(tp, f, code + 2282);
+L2286: /* LIST */
+    tp_aot_op(tp, f, code + 2286);
+L2287: /* LIST */
+    tp_aot_op(tp, f, code + 2287);
+L2288: /* NONE */
+    regs[9] = tp_None;
+L2289: /* NONE */
+    regs[10] = tp_None;
+L2290: /* DEF */
+    tp_aot_op(tp, f, code + 2290);
+L2398: /* STRING */
+    tp_aot_op(tp, f, code + 2398);
+L2403: /* GSET */
+    tp_set(tp, f->globals, regs[7], regs[6]);
+L2404: /* LINE */
+    f->line = code + 2404;
+    f->lineno = 125;
+L2412: /* VAR */
+L2415: /* STRING */
+    tp_aot_op(tp, f, code + 2415);
+L2419: /* STRING */
+    tp_aot_op(tp, f, code + 2419);
+L2422: /* LIST */
+    tp_aot_op(tp, f, code + 2422);
+L2423: /* LIST */
+    tp_aot_op(tp, f, code + 2423);
+L2424: /* NONE */
+    regs[10] = tp_None;
+L2425: /* NONE */
+    regs[11] = tp_None;
+L2426: /* DEF */
+    tp_aot_op(tp, f, code + 2426);
+L2508: /* STRING */
+    tp_aot_op(tp, f, code + 2508);
+L2513: /* GSET */
+    tp_set(tp, f->globals, regs[8], regs[7]);
+L2514: /* LINE */
+    f->line = code + 2514;
+    f->lineno = 131;
+L2522: /* VAR */
+L2525: /* STRING */
+    tp_aot_op(tp, f, code + 2525);
+L2529: /* STRING */
+    tp_aot_op(tp, f, code + 2529);
+L2532: /* LIST */
+    tp_aot_op(tp, f, code + 2532);
+L2533: /* LIST */
+    tp_aot_op(tp, f, code + 2533);
+L2534: /* NONE */
+    regs[11] = tp_None;
+L2535: /* NONE */
+    regs[12] = tp_None;
+L2536: /* DEF */
+    tp_aot_op(tp, f, code + 2536);
+L2664: /* STRING */
+    tp_aot_op(tp, f, code + 2664);
+L2669: /* GSET */
+    tp_set(tp, f->globals, regs[9], regs[8]);
+L2670: /* LINE */
+    f->line = code + 2670;
+    f->lineno = 138;
+L2679: /* VAR */
+L2682: /* STRING */
+    tp_aot_op(tp, f, code + 2682);
+L2686: /* STRING */
+    tp_aot_op(tp, f, code + 2686);
+L2690: /* STRING */
+    tp_aot_op(tp, f, code + 2690);
+L2693: /* LIST */
+    tp_aot_op(tp, f, code + 2693);
+L2694: /* LIST */
+    tp_aot_op(tp, f, code + 2694);
+L2695: /* NONE */
+    regs[12] = tp_None;
+L2696: /* NONE */
+    regs[13] = tp_None;
+L2697: /* DEF */
+    tp_aot_op(tp, f, code + 2697);
+L2910: /* STRING */
+    tp_aot_op(tp, f, code + 2910);
+L2915: /* GSET */
+    tp_set(tp, f->globals, regs[10], regs[9]);
+L2916: /* LINE */
+    f->line = code + 2916;
+    f->lineno = 150;
+L2928: /* VAR */
+L2931: /* STRING */
+    tp_aot_op(tp, f, code + 2931);
+L2935: /* STRING */
+    tp_aot_op(tp, f, code + 2935);
+L2939: /* STRING */
+    tp_aot_op(tp, f, code + 2939);
+L2944: /* STRING */
+    tp_aot_op(tp, f, code + 2944);
+L2948: /* STRING */
+    tp_aot_op(tp, f, code + 2948);
+L2951: /* LIST */
+    tp_aot_op(tp, f, code + 2951);
+L2952: /* LIST */
+    tp_aot_op(tp, f, code + 2952);
+L2953: /* NONE */
+    regs[13] = tp_None;
+L2954: /* NONE */
+    regs[14] = tp_None;
+L2955: /* DEF */
+    tp_aot_op(tp, f, code + 2955);
+L3197: /* STRING */
+    tp_aot_op(tp, f, code + 3197);
+L3201: /* GSET */
+    tp_set(tp, f->globals, regs[11], regs[10]);
+L3202: /* LINE */
+    f->line = code + 3202;
+    f->lineno = 168;
+L3208: /* VAR */
+L3211: /* STRING */
+    tp_aot_op(tp, f, code + 3211);
+L3214: /* STRING */
+    tp_aot_op(tp, f, code + 3214);
+L3217: /* LIST */
+    tp_aot_op(tp, f, code + 3217);
+L3218: /* LIST */
+    tp_aot_op(tp, f, code + 3218);
+L3219: /* NONE */
+    regs[14] = tp_None;
+L3220: /* NONE */
+    regs[15] = tp_None;
+L3221: /* DEF */
+    tp_aot_op(tp, f, code + 3221);
+L3278: /* STRING */
+    tp_aot_op(tp, f, code + 3278);
+L3282: /* GSET */
+    tp_set(tp, f->globals, regs[12], regs[11]);
+L3283: /* LINE */
+    f->line = code + 3283;
+    f->lineno = 171;
+L3290: /* VAR */
+L3293: /* STRING */
+    tp_aot_op(tp, f, code + 3293);
+L3297: /* LIST */
+    tp_aot_op(tp, f, code + 3297);
+L3298: /* LIST */
+    tp_aot_op(tp, f, code + 3298);
+L3299: /* NONE */
+    regs[15] = tp_None;
+L3300: /* NONE */
+    regs[16] = tp_None;
+L3301: /* DEF */
+    tp_aot_op(tp, f, code + 3301);
+L3622: /* STRING */
+    tp_aot_op(tp, f, code + 3622);
+L3627: /* GSET */
+    tp_set(tp, f->globals, regs[13], regs[12]);
+L3628: /* LINE */
+    f->line = code + 3628;
+    f->lineno = 191;
+L3635: /* VAR */
+L3638: /* STRING */
+    tp_aot_op(tp, f, code + 3638);
+L3642: /* LIST */
+    tp_aot_op(tp, f, code + 3642);
+L3643: /* LIST */
+    tp_aot_op(tp, f, code + 3643);
+L3644: /* NONE */
+    regs[16] = tp_None;
+L3645: /* NONE */
+    regs[17] = tp_None;
+L3646: /* DEF */
+    tp_aot_op(tp, f, code + 3646);
+L3861: /* STRING */
+    tp_aot_op(tp, f, code + 3861);
+L3866: /* GSET */
+    tp_set(tp, f->globals, regs[14], regs[13]);
+L3867: /* LINE */
+    f->line = code + 3867;
+    f->lineno = 203;
+L3876: /* VAR */
+L3879: /* STRING */
+    tp_aot_op(tp, f, code + 3879);
+L3883: /* STRING */
+    tp_aot_op(tp, f, code + 3883);
+L3887: /* LIST */
+    tp_aot_op(tp, f, code + 3887);
+L3888: /* LIST */
+    tp_aot_op(tp, f, code + 3888);
+L3889: /* NONE */
+    regs[17] = tp_None;
+L3890: /* NONE */
+    regs[18] = tp_None;
+L3891: /* DEF */
+    tp_aot_op(tp, f, code + 3891);
+L4268: /* STRING */
+    tp_aot_op(tp, f, code + 4268);
+L4274: /* GSET */
+    tp_set(tp, f->globals, regs[15], regs[14]);
+L4275: /* LINE */
+    f->line = code + 4275;
+    f->lineno = 225;
+L4285: /* VAR */
+L4288: /* STRING */
+    tp_aot_op(tp, f, code + 4288);
+L4292: /* STRING */
+    tp_aot_op(tp, f, code + 4292);
+L4296: /* STRING */
+    tp_aot_op(tp, f, code + 4296);
+L4301: /* LIST */
+    tp_aot_op(tp, f, code + 4301);
+L4302: /* LIST */
+    tp_aot_op(tp, f, code + 4302);
+L4303: /* NONE */
+    regs[18] = tp_None;
+L4304: /* NONE */
+    regs[19] = tp_None;
+L4305: /* DEF */
+    tp_aot_op(tp, f, code + 4305);
+L4995: /* STRING */
+    tp_aot_op(tp, f, code + 4995);
+L4999: /* GSET */
+    tp_set(tp, f->globals, regs[16], regs[15]);
+L5000: /* LINE */
+    f->line = code + 5000;
+    f->lineno = 261;
+L5008: /* VAR */
+L5011: /* STRING */
+    tp_aot_op(tp, f, code + 5011);
+L5015: /* STRING */
+    tp_aot_op(tp, f, code + 5015);
+L5019: /* LIST */
+    tp_aot_op(tp, f, code + 5019);
+L5020: /* LIST */
+    tp_aot_op(tp, f, code + 5020);
+L5021: /* NONE */
+    regs[19] = tp_None;
+L5022: /* NONE */
+    regs[20] = tp_None;
+L5023: /* DEF */
+    tp_aot_op(tp, f, code + 5023);
+L5385: /* STRING */
+    tp_aot_op(tp, f, code + 5385);
+L5389: /* GSET */
+    tp_set(tp, f->globals, regs[17], regs[16]);
+L5390: /* LINE */
+    f->line = code + 5390;
+    f->lineno = 280;
+L5396: /* VAR */
+L5399: /* STRING */
+    tp_aot_op(tp, f, code + 5399);
+L5403: /* LIST */
+    tp_aot_op(tp, f, code + 5403);
+L5404: /* LIST */
+    tp_aot_op(tp, f, code + 5404);
+L5405: /* NONE */
+    regs[20] = tp_None;
+L5406: /* NONE */
+    regs[21] = tp_None;
+L5407: /* DEF */
+    tp_aot_op(tp, f, code + 5407);
+L5498: /* STRING */
+    tp_aot_op(tp, f, code + 5498);
+L5502: /* GSET */
+    tp_set(tp, f->globals, regs[18], regs[17]);
+L5503: /* LINE */
+    f->line = code + 5503;
+    f->lineno = 287;
+L5510: /* VAR */
+L5513: /* STRING */
+    tp_aot_op(tp, f, code + 5513);
+L5517: /* LIST */
+    tp_aot_op(tp, f, code + 5517);
+L5518: /* LIST */
+    tp_aot_op(tp, f, code + 5518);
+L5519: /* NONE */
+    regs[21] = tp_None;
+L5520: /* NONE */
+    regs[22] = tp_None;
+L5521: /* DEF */
+    tp_aot_op(tp, f, code + 5521);
+L5982: /* STRING */
+    tp_aot_op(tp, f, code + 5982);
+L5987: /* GSET */
+    tp_set(tp, f->globals, regs[19], regs[18]);
+L5988: /* LINE */
+    f->line = code + 5988;
+    f->lineno = 316;
+L5994: /* VAR */
+L5997: /* STRING */
+    tp_aot_op(tp, f, code + 5997);
+L6000: /* LIST */
+    tp_aot_op(tp, f, code + 6000);
+L6001: /* LIST */
+    tp_aot_op(tp, f, code + 6001);
+L6002: /* NONE */
+    regs[22] = tp_None;
+L6003: /* NONE */
+    regs[23] = tp_None;
+L6004: /* DEF */
+    tp_aot_op(tp, f, code + 6004);
+L6169: /* STRING */
+    tp_aot_op(tp, f, code + 6169);
+L6174: /* GSET */
+    tp_set(tp, f->globals, regs[20], regs[19]);
+L6175: /* EOF */
+    return code + 6175;
+}
+
+static tpd_code * _tp_tinypy_compiler_peephole_441(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 15: goto L15;
+        case 24: goto L24;
+        case 25: goto L25;
+        case 29: goto L29;
+        case 30: goto L30;
+        case 35: goto L35;
+        case 38: goto L38;
+        case 39: goto L39;
+        case 46: goto L46;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 51: goto L51;
+        case 52: goto L52;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 61: goto L61;
+        case 64: goto L64;
+        case 65: goto L65;
+        case 70: goto L70;
+        case 73: goto L73;
+        case 74: goto L74;
+        case 81: goto L81;
+        case 84: goto L84;
+        case 87: goto L87;
+        case 88: goto L88;
+        case 96: goto L96;
+        case 99: goto L99;
+        case 100: goto L100;
+        case 101: goto L101;
+        case 102: goto L102;
+        case 111: goto L111;
+        case 114: goto L114;
+        case 115: goto L115;
+        case 116: goto L116;
+        case 117: goto L117;
+        case 118: goto L118;
+        case 127: goto L127;
+        case 128: goto L128;
+        case 129: goto L129;
+        case 130: goto L130;
+        case 131: goto L131;
+        case 143: goto L143;
+        case 147: goto L147;
+        case 149: goto L149;
+        case 152: goto L152;
+        case 155: goto L155;
+        case 156: goto L156;
+        case 157: goto L157;
+        case 158: goto L158;
+        case 159: goto L159;
+        case 168: goto L168;
+        case 172: goto L172;
+        case 173: goto L173;
+        case 174: goto L174;
+        case 175: goto L175;
+        case 187: goto L187;
+        case 191: goto L191;
+        case 193: goto L193;
+        case 197: goto L197;
+        case 198: goto L198;
+        case 199: goto L199;
+        case 200: goto L200;
+        case 201: goto L201;
+        case 215: goto L215;
+        case 219: goto L219;
+        case 220: goto L220;
+        case 221: goto L221;
+        case 222: goto L222;
+        case 226: goto L226;
+        case 227: goto L227;
+        case 228: goto L228;
+        case 229: goto L229;
+        case 241: goto L241;
+        case 245: goto L245;
+        case 247: goto L247;
+        case 248: goto L248;
+        case 251: goto L251;
+        case 252: goto L252;
+        case 253: goto L253;
+        case 254: goto L254;
+        case 255: goto L255;
+        case 263: goto L263;
+        case 266: goto L266;
+        case 267: goto L267;
+        case 268: goto L268;
+        case 269: goto L269;
+        case 282: goto L282;
+        case 286: goto L286;
+        case 287: goto L287;
+        case 288: goto L288;
+        case 291: goto L291;
+        case 292: goto L292;
+        case 293: goto L293;
+        case 296: goto L296;
+        case 299: goto L299;
+        case 302: goto L302;
+        case 303: goto L303;
+        case 306: goto L306;
+        case 307: goto L307;
+        case 323: goto L323;
+        case 327: goto L327;
+        case 329: goto L329;
+        case 332: goto L332;
+        case 335: goto L335;
+        case 336: goto L336;
+        case 339: goto L339;
+        case 340: goto L340;
+        case 341: goto L341;
+        case 342: goto L342;
+        case 343: goto L343;
+        case 344: goto L344;
+        case 349: goto L349;
+        case 356: goto L356;
+        case 359: goto L359;
+        case 360: goto L360;
+        case 370: goto L370;
+        case 373: goto L373;
+        case 374: goto L374;
+        case 379: goto L379;
+        case 380: goto L380;
+        case 381: goto L381;
+        case 382: goto L382;
+        case 393: goto L393;
+        case 397: goto L397;
+        case 399: goto L399;
+        case 400: goto L400;
+        case 401: goto L401;
+        case 408: goto L408;
+        case 411: goto L411;
+        case 412: goto L412;
+        case 427: goto L427;
+        case 430: goto L430;
+        case 431: goto L431;
+        case 432: goto L432;
+        case 433: goto L433;
+        case 434: goto L434;
+        case 435: goto L435;
+        case 436: goto L436;
+        case 439: goto L439;
+        case 440: goto L440;
+        case 444: goto L444;
+        case 445: goto L445;
+        case 446: goto L446;
+        case 447: goto L447;
+        case 458: goto L458;
+        case 462: goto L462;
+        case 464: goto L464;
+        case 465: goto L465;
+        case 466: goto L466;
+        case 473: goto L473;
+        case 476: goto L476;
+        case 477: goto L477;
+        case 478: goto L478;
+        case 499: goto L499;
+        case 503: goto L503;
+        case 505: goto L505;
+        case 509: goto L509;
+        case 512: goto L512;
+        case 513: goto L513;
+        case 516: goto L516;
+        case 517: goto L517;
+        case 520: goto L520;
+        case 521: goto L521;
+        case 524: goto L524;
+        case 525: goto L525;
+        case 526: goto L526;
+        case 527: goto L527;
+        case 528: goto L528;
+        case 529: goto L529;
+        case 535: goto L535;
+        case 536: goto L536;
+        case 537: goto L537;
+        case 538: goto L538;
+        case 539: goto L539;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 30;
+L9: /* VAR */
+L11: /* VAR */
+L13: /* VAR */
+L15: /* STRING */
+    tp_aot_op(tp, f, code + 15);
+L24: /* FILE */
+    f->fname = regs[3];
+L25: /* STRING */
+    tp_aot_op(tp, f, code + 25);
+L29: /* NAME */
+    f->name = regs[3];
+L30: /* LINE */
+    f->line = code + 30;
+    f->lineno = 33;
+L35: /* VAR */
+L38: /* LIST */
+    tp_aot_op(tp, f, code + 38);
+L39: /* LINE */
+    f->line = code + 39;
+    f->lineno = 34;
+L46: /* GGET */
+    tp_aot_op(tp, f, code + 46);
+L49: /* MOVE */
+    regs[5] = regs[0];
+L50: /* CALLP */
+    return code + 50;
+L51: /* LT */
+    if (TP_BOTH(regs[1], regs[7], TP_NUMBER_INT)) {
+        regs[14] = tp_bool(regs[1].nint < regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 51);
+    }
+L52: /* IF */
+    if (TP_IS_INT(regs[14]) ? regs[14].nint != 0 : tp_true(tp, regs[14])) {
+        goto L54;
+    }
+L53: /* JUMP */
+    goto L529;
+L54: /* LINE */
+    f->line = code + 54;
+    f->lineno = 35;
+L61: /* VAR */
+L64: /* GET */
+    regs[14] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[14]);
+L65: /* LINE */
+    f->line = code + 65;
+    f->lineno = 36;
+L70: /* NUMBER */
+    tp_aot_op(tp, f, code + 70);
+L73: /* ADD */
+    if (TP_BOTH(regs[1], regs[4], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 73);
+    }
+L74: /* LINE */
+    f->line = code + 74;
+    f->lineno = 37;
+L81: /* VAR */
+L84: /* NUMBER */
+    tp_aot_op(tp, f, code + 84);
+L87: /* GET */
+    regs[7] = tp_get(tp, regs[14], regs[5]);
+    tp_grey(tp, regs[7]);
+L88: /* LINE */
+    f->line = code + 88;
+    f->lineno = 38;
+L96: /* STRING */
+    tp_aot_op(tp, f, code + 96);
+L99: /* EQ */
+    if (TP_BOTH(regs[7], regs[5], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[7].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 99);
+    }
+L100: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L102;
+    }
+L101: /* JUMP */
+    goto L159;
+L102: /* LINE */
+    f->line = code + 102;
+    f->lineno = 39;
+L111: /* NUMBER */
+    tp_aot_op(tp, f, code + 111);
+L114: /* GET */
+    regs[4] = tp_get(tp, regs[14], regs[5]);
+    tp_grey(tp, regs[4]);
+L115: /* EQ */
+    if (TP_BOTH(regs[4], regs[2], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[4].nint == regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 115);
+    }
+L116: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L118;
+    }
+L117: /* JUMP */
+    goto L131;
+L118: /* LINE */
+    f->line = code + 118;
+    f->lineno = 40;
+L127: /* MOVE */
+    regs[5] = regs[3];
+L128: /* MOVE */
+    regs[6] = regs[1];
+L129: /* LIST */
+    tp_aot_op(tp, f, code + 129);
+L130: /* RETURN */
+    return code + 130;
+L131: /* LINE */
+    f->line = code + 131;
+    f->lineno = 41;
+L143: /* STRING */
+    tp_aot_op(tp, f, code + 143);
+L147: /* METHOD */
+    tp_aot_op(tp, f, code + 147);
+L149: /* STRING */
+    tp_aot_op(tp, f, code + 149);
+L152: /* NUMBER */
+    tp_aot_op(tp, f, code + 152);
+L155: /* GET */
+    regs[9] = tp_get(tp, regs[14], regs[10]);
+    tp_grey(tp, regs[9]);
+L156: /* LIST */
+    tp_aot_op(tp, f, code + 156);
+L157: /* CALLM */
+    return code + 157;
+L158: /* JUMP */
+    tp_aot_safepoint(tp, 112);
+    goto L46;
+L159: /* LINE */
+    f->line = code + 159;
+    f->lineno = 42;
+L168: /* STRING */
+    tp_aot_op(tp, f, code + 168);
+L172: /* EQ */
+    if (TP_BOTH(regs[7], regs[5], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[7].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 172);
+    }
+L173: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L175;
+    }
+L174: /* JUMP */
+    goto L201;
+L175: /* LINE */
+    f->line = code + 175;
+    f->lineno = 43;
+L187: /* STRING */
+    tp_aot_op(tp, f, code + 187);
+L191: /* METHOD */
+    tp_aot_op(tp, f, code + 191);
+L193: /* STRING */
+    tp_aot_op(tp, f, code + 193);
+L197: /* MOVE */
+    regs[9] = regs[14];
+L198: /* LIST */
+    tp_aot_op(tp, f, code + 198);
+L199: /* CALLM */
+    return code + 199;
+L200: /* JUMP */
+    tp_aot_safepoint(tp, 154);
+    goto L46;
+L201: /* LINE */
+    f->line = code + 201;
+    f->lineno = 44;
+L215: /* STRING */
+    tp_aot_op(tp, f, code + 215);
+L219: /* EQ */
+    if (TP_BOTH(regs[7], regs[5], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[7].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 219);
+    }
+L220: /* IFN */
+    if (!(TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4]))) {
+        goto L222;
+    }
+L221: /* JUMP */
+    goto L227;
+L222: /* STRING */
+    tp_aot_op(tp, f, code + 222);
+L226: /* EQ */
+    if (TP_BOTH(regs[7], regs[5], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[7].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 226);
+    }
+L227: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L229;
+    }
+L228: /* JUMP */
+    goto L255;
+L229: /* LINE */
+    f->line = code + 229;
+    f->lineno = 45;
+L241: /* STRING */
+    tp_aot_op(tp, f, code + 241);
+L245: /* METHOD */
+    tp_aot_op(tp, f, code + 245);
+L247: /* MOVE */
+    regs[8] = regs[7];
+L248: /* NUMBER */
+    tp_aot_op(tp, f, code + 248);
+L251: /* GET */
+    regs[9] = tp_get(tp, regs[14], regs[10]);
+    tp_grey(tp, regs[9]);
+L252: /* LIST */
+    tp_aot_op(tp, f, code + 252);
+L253: /* CALLM */
+    return code + 253;
+L254: /* JUMP */
+    tp_aot_safepoint(tp, 208);
+    goto L46;
+L255: /* LINE */
+    f->line = code + 255;
+    f->lineno = 46;
+L263: /* STRING */
+    tp_aot_op(tp, f, code + 263);
+L266: /* EQ */
+    if (TP_BOTH(regs[7], regs[5], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[7].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 266);
+    }
+L267: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L269;
+    }
+L268: /* JUMP */
+    goto L344;
+L269: /* LINE */
+    f->line = code + 269;
+    f->lineno = 47;
+L282: /* GGET */
+    tp_aot_op(tp, f, code + 282);
+L286: /* MOVE */
+    regs[6] = regs[0];
+L287: /* MOVE */
+    regs[7] = regs[1];
+L288: /* NUMBER */
+    tp_aot_op(tp, f, code + 288);
+L291: /* GET */
+    regs[8] = tp_get(tp, regs[14], regs[9]);
+    tp_grey(tp, regs[8]);
+L292: /* CALLP */
+    return code + 292;
+L293: /* VAR */
+L296: /* VAR */
+L299: /* NUMBER */
+    tp_aot_op(tp, f, code + 299);
+L302: /* GET */
+    regs[5] = tp_get(tp, regs[4], regs[7]);
+    tp_grey(tp, regs[5]);
+L303: /* NUMBER */
+    tp_aot_op(tp, f, code + 303);
+L306: /* GET */
+    regs[1] = tp_get(tp, regs[4], regs[7]);
+    tp_grey(tp, regs[1]);
+L307: /* LINE */
+    f->line = code + 307;
+    f->lineno = 48;
+L323: /* STRING */
+    tp_aot_op(tp, f, code + 323);
+L327: /* METHOD */
+    tp_aot_op(tp, f, code + 327);
+L329: /* STRING */
+    tp_aot_op(tp, f, code + 329);
+L332: /* NUMBER */
+    tp_aot_op(tp, f, code + 332);
+L335: /* GET */
+    regs[10] = tp_get(tp, regs[14], regs[13]);
+    tp_grey(tp, regs[10]);
+L336: /* NUMBER */
+    tp_aot_op(tp, f, code + 336);
+L339: /* GET */
+    regs[11] = tp_get(tp, regs[14], regs[13]);
+    tp_grey(tp, regs[11]);
+L340: /* MOVE */
+    regs[12] = regs[5];
+L341: /* LIST */
+    tp_aot_op(tp, f, code + 341);
+L342: /* CALLM */
+    return code + 342;
+L343: /* JUMP */
+    tp_aot_safepoint(tp, 297);
+    goto L46;
+L344: /* LINE */
+    f->line = code + 344;
+    f->lineno = 49;
+L349: /* LINE */
+    f->line = code + 349;
+    f->lineno = 50;
+L356: /* VAR */
+L359: /* LIST */
+    tp_aot_op(tp, f, code + 359);
+L360: /* LINE */
+    f->line = code + 360;
+    f->lineno = 51;
+L370: /* NUMBER */
+    tp_aot_op(tp, f, code + 370);
+L373: /* GET */
+    regs[6] = tp_get(tp, regs[14], regs[7]);
+    tp_grey(tp, regs[6]);
+L374: /* GGET */
+    tp_aot_op(tp, f, code + 374);
+L379: /* IN */
+    regs[6] = tp_has(tp, regs[7], regs[6]);
+L380: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L382;
+    }
+L381: /* JUMP */
+    goto L412;
+L382: /* LINE */
+    f->line = code + 382;
+    f->lineno = 52;
+L393: /* STRING */
+    tp_aot_op(tp, f, code + 393);
+L397: /* METHOD */
+    tp_aot_op(tp, f, code + 397);
+L399: /* GET */
+    regs[9] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[9]);
+L400: /* CALLM */
+    return code + 400;
+L401: /* LINE */
+    f->line = code + 401;
+    f->lineno = 53;
+L408: /* NUMBER */
+    tp_aot_op(tp, f, code + 408);
+L411: /* ADD */
+    if (TP_BOTH(regs[1], regs[7], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 411);
+    }
+L412: /* LINE */
+    f->line = code + 412;
+    f->lineno = 54;
+L427: /* GGET */
+    tp_aot_op(tp, f, code + 427);
+L430: /* MOVE */
+    regs[9] = regs[0];
+L431: /* CALLP */
+    return code + 431;
+L432: /* LT */
+    if (TP_BOTH(regs[1], regs[7], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[1].nint < regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 432);
+    }
+L433: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L435;
+    }
+L434: /* JUMP */
+    goto L445;
+L435: /* GET */
+    regs[6] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[6]);
+L436: /* NUMBER */
+    tp_aot_op(tp, f, code + 436);
+L439: /* GET */
+    regs[6] = tp_get(tp, regs[6], regs[7]);
+    tp_grey(tp, regs[6]);
+L440: /* STRING */
+    tp_aot_op(tp, f, code + 440);
+L444: /* EQ */
+    if (TP_BOTH(regs[6], regs[7], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[6].nint == regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 444);
+    }
+L445: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L447;
+    }
+L446: /* JUMP */
+    goto L478;
+L447: /* LINE */
+    f->line = code + 447;
+    f->lineno = 55;
+L458: /* STRING */
+    tp_aot_op(tp, f, code + 458);
+L462: /* METHOD */
+    tp_aot_op(tp, f, code + 462);
+L464: /* GET */
+    regs[9] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[9]);
+L465: /* CALLM */
+    return code + 465;
+L466: /* LINE */
+    f->line = code + 466;
+    f->lineno = 56;
+L473: /* NUMBER */
+    tp_aot_op(tp, f, code + 473);
+L476: /* ADD */
+    if (TP_BOTH(regs[1], regs[7], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 476);
+    }
+L477: /* JUMP */
+    tp_aot_safepoint(tp, 50);
+    goto L427;
+L478: /* LINE */
+    f->line = code + 478;
+    f->lineno = 57;
+L499: /* STRING */
+    tp_aot_op(tp, f, code + 499);
+L503: /* METHOD */
+    tp_aot_op(tp, f, code + 503);
+L505: /* STRING */
+    tp_aot_op(tp, f, code + 505);
+L509: /* NUMBER */
+    tp_aot_op(tp, f, code + 509);
+L512: /* GET */
+    regs[11] = tp_get(tp, regs[14], regs[5]);
+    tp_grey(tp, regs[11]);
+L513: /* NUMBER */
+    tp_aot_op(tp, f, code + 513);
+L516: /* GET */
+    regs[12] = tp_get(tp, regs[14], regs[5]);
+    tp_grey(tp, regs[12]);
+L517: /* NUMBER */
+    tp_aot_op(tp, f, code + 517);
+L520: /* GET */
+    regs[13] = tp_get(tp, regs[14], regs[5]);
+    tp_grey(tp, regs[13]);
+L521: /* NUMBER */
+    tp_aot_op(tp, f, code + 521);
+L524: /* GET */
+    regs[14] = tp_get(tp, regs[14], regs[5]);
+    tp_grey(tp, regs[14]);
+L525: /* MOVE */
+    regs[15] = regs[4];
+L526: /* LIST */
+    tp_aot_op(tp, f, code + 526);
+L527: /* CALLM */
+    return code + 527;
+L528: /* JUMP */
+    tp_aot_safepoint(tp, 482);
+    goto L46;
+L529: /* LINE */
+    f->line = code + 529;
+    f->lineno = 58;
+L535: /* MOVE */
+    regs[7] = regs[3];
+L536: /* MOVE */
+    regs[8] = regs[1];
+L537: /* LIST */
+    tp_aot_op(tp, f, code + 537);
+L538: /* RETURN */
+    return code + 538;
+L539: /* EOF */
+    return code + 539;
+}
+
+static tpd_code * _tp_tinypy_compiler_peephole_1009(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 10: goto L10;
+        case 13: goto L13;
+        case 15: goto L15;
+        case 24: goto L24;
+        case 25: goto L25;
+        case 29: goto L29;
+        case 30: goto L30;
+        case 36: goto L36;
+        case 39: goto L39;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 50: goto L50;
+        case 53: goto L53;
+        case 56: goto L56;
+        case 57: goto L57;
+        case 65: goto L65;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 72: goto L72;
+        case 88: goto L88;
+        case 92: goto L92;
+        case 94: goto L94;
+        case 98: goto L98;
+        case 101: goto L101;
+        case 102: goto L102;
+        case 105: goto L105;
+        case 106: goto L106;
+        case 109: goto L109;
+        case 110: goto L110;
+        case 113: goto L113;
+        case 114: goto L114;
+        case 115: goto L115;
+        case 116: goto L116;
+        case 125: goto L125;
+        case 129: goto L129;
+        case 131: goto L131;
+        case 134: goto L134;
+        case 135: goto L135;
+        case 136: goto L136;
+        case 137: goto L137;
+        case 146: goto L146;
+        case 150: goto L150;
+        case 151: goto L151;
+        case 152: goto L152;
+        case 153: goto L153;
+        case 162: goto L162;
+        case 166: goto L166;
+        case 168: goto L168;
+        case 171: goto L171;
+        case 172: goto L172;
+        case 173: goto L173;
+        case 174: goto L174;
+        case 182: goto L182;
+        case 185: goto L185;
+        case 186: goto L186;
+        case 187: goto L187;
+        case 188: goto L188;
+        case 200: goto L200;
+        case 204: goto L204;
+        case 206: goto L206;
+        case 209: goto L209;
+        case 212: goto L212;
+        case 213: goto L213;
+        case 216: goto L216;
+        case 217: goto L217;
+        case 218: goto L218;
+        case 219: goto L219;
+        case 228: goto L228;
+        case 232: goto L232;
+        case 235: goto L235;
+        case 236: goto L236;
+        case 237: goto L237;
+        case 238: goto L238;
+        case 249: goto L249;
+        case 253: goto L253;
+        case 255: goto L255;
+        case 258: goto L258;
+        case 261: goto L261;
+        case 262: goto L262;
+        case 263: goto L263;
+        case 264: goto L264;
+        case 265: goto L265;
+        case 276: goto L276;
+        case 280: goto L280;
+        case 282: goto L282;
+        case 283: goto L283;
+        case 286: goto L286;
+        case 287: goto L287;
+        case 288: goto L288;
+        case 289: goto L289;
+        case 290: goto L290;
+        case 295: goto L295;
+        case 296: goto L296;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 60;
+L10: /* VAR */
+L13: /* VAR */
+L15: /* STRING */
+    tp_aot_op(tp, f, code + 15);
+L24: /* FILE */
+    f->fname = regs[2];
+L25: /* STRING */
+    tp_aot_op(tp, f, code + 25);
+L29: /* NAME */
+    f->name = regs[2];
+L30: /* LINE */
+    f->line = code + 30;
+    f->lineno = 61;
+L36: /* NUMBER */
+    tp_aot_op(tp, f, code + 36);
+L39: /* ITER */
+    if (tp_iter_next(tp, &regs[2], regs[0], &regs[3])) {
+        goto L41;
+    }
+L40: /* JUMP */
+    goto L290;
+L41: /* VAR */
+L43: /* MOVE */
+    regs[4] = regs[2];
+L44: /* LINE */
+    f->line = code + 44;
+    f->lineno = 62;
+L50: /* VAR */
+L53: /* NUMBER */
+    tp_aot_op(tp, f, code + 53);
+L56: /* GET */
+    regs[2] = tp_get(tp, regs[4], regs[5]);
+    tp_grey(tp, regs[2]);
+L57: /* LINE */
+    f->line = code + 57;
+    f->lineno = 63;
+L65: /* STRING */
+    tp_aot_op(tp, f, code + 65);
+L69: /* EQ */
+    if (TP_BOTH(regs[2], regs[5], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[2].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 69);
+    }
+L70: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L72;
+    }
+L71: /* JUMP */
+    goto L137;
+L72: /* LINE */
+    f->line = code + 72;
+    f->lineno = 64;
+L88: /* STRING */
+    tp_aot_op(tp, f, code + 88);
+L92: /* METHOD */
+    tp_aot_op(tp, f, code + 92);
+L94: /* STRING */
+    tp_aot_op(tp, f, code + 94);
+L98: /* NUMBER */
+    tp_aot_op(tp, f, code + 98);
+L101: /* GET */
+    regs[8] = tp_get(tp, regs[4], regs[11]);
+    tp_grey(tp, regs[8]);
+L102: /* NUMBER */
+    tp_aot_op(tp, f, code + 102);
+L105: /* GET */
+    regs[9] = tp_get(tp, regs[4], regs[11]);
+    tp_grey(tp, regs[9]);
+L106: /* NUMBER */
+    tp_aot_op(tp, f, code + 106);
+L109: /* GET */
+    regs[10] = tp_get(tp, regs[4], regs[11]);
+    tp_grey(tp, regs[10]);
+L110: /* NUMBER */
+    tp_aot_op(tp, f, code + 110);
+L113: /* GET */
+    regs[11] = tp_get(tp, regs[4], regs[11]);
+    tp_grey(tp, regs[11]);
+L114: /* LIST */
+    tp_aot_op(tp, f, code + 114);
+L115: /* CALLM */
+    return code + 115;
+L116: /* LINE */
+    f->line = code + 116;
+    f->lineno = 65;
+L125: /* STRING */
+    tp_aot_op(tp, f, code + 125);
+L129: /* METHOD */
+    tp_aot_op(tp, f, code + 129);
+L131: /* NUMBER */
+    tp_aot_op(tp, f, code + 131);
+L134: /* GET */
+    regs[7] = tp_get(tp, regs[4], regs[7]);
+    tp_grey(tp, regs[7]);
+L135: /* CALLM */
+    return code + 135;
+L136: /* JUMP */
+    tp_aot_safepoint(tp, 97);
+    goto L39;
+L137: /* LINE */
+    f->line = code + 137;
+    f->lineno = 66;
+L146: /* STRING */
+    tp_aot_op(tp, f, code + 146);
+L150: /* EQ */
+    if (TP_BOTH(regs[2], regs[5], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[2].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 150);
+    }
+L151: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L153;
+    }
+L152: /* JUMP */
+    goto L174;
+L153: /* LINE */
+    f->line = code + 153;
+    f->lineno = 67;
+L162: /* STRING */
+    tp_aot_op(tp, f, code + 162);
+L166: /* METHOD */
+    tp_aot_op(tp, f, code + 166);
+L168: /* NUMBER */
+    tp_aot_op(tp, f, code + 168);
+L171: /* GET */
+    regs[7] = tp_get(tp, regs[4], regs[7]);
+    tp_grey(tp, regs[7]);
+L172: /* CALLM */
+    return code + 172;
+L173: /* JUMP */
+    tp_aot_safepoint(tp, 134);
+    goto L39;
+L174: /* LINE */
+    f->line = code + 174;
+    f->lineno = 68;
+L182: /* STRING */
+    tp_aot_op(tp, f, code + 182);
+L185: /* EQ */
+    if (TP_BOTH(regs[2], regs[5], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[2].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 185);
+    }
+L186: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L188;
+    }
+L187: /* JUMP */
+    goto L265;
+L188: /* LINE */
+    f->line = code + 188;
+    f->lineno = 69;
+L200: /* STRING */
+    tp_aot_op(tp, f, code + 200);
+L204: /* METHOD */
+    tp_aot_op(tp, f, code + 204);
+L206: /* STRING */
+    tp_aot_op(tp, f, code + 206);
+L209: /* NUMBER */
+    tp_aot_op(tp, f, code + 209);
+L212: /* GET */
+    regs[8] = tp_get(tp, regs[4], regs[10]);
+    tp_grey(tp, regs[8]);
+L213: /* NUMBER */
+    tp_aot_op(tp, f, code + 213);
+L216: /* GET */
+    regs[9] = tp_get(tp, regs[4], regs[10]);
+    tp_grey(tp, regs[9]);
+L217: /* LIST */
+    tp_aot_op(tp, f, code + 217);
+L218: /* CALLM */
+    return code + 218;
+L219: /* LINE */
+    f->line = code + 219;
+    f->lineno = 70;
+L228: /* GGET */
+    tp_aot_op(tp, f, code + 228);
+L232: /* NUMBER */
+    tp_aot_op(tp, f, code + 232);
+L235: /* GET */
+    regs[6] = tp_get(tp, regs[4], regs[7]);
+    tp_grey(tp, regs[6]);
+L236: /* MOVE */
+    regs[7] = regs[1];
+L237: /* CALLP */
+    return code + 237;
+L238: /* LINE */
+    f->line = code + 238;
+    f->lineno = 71;
+L249: /* STRING */
+    tp_aot_op(tp, f, code + 249);
+L253: /* METHOD */
+    tp_aot_op(tp, f, code + 253);
+L255: /* STRING */
+    tp_aot_op(tp, f, code + 255);
+L258: /* NUMBER */
+    tp_aot_op(tp, f, code + 258);
+L261: /* GET */
+    regs[8] = tp_get(tp, regs[4], regs[9]);
+    tp_grey(tp, regs[8]);
+L262: /* LIST */
+    tp_aot_op(tp, f, code + 262);
+L263: /* CALLM */
+    return code + 263;
+L264: /* JUMP */
+    tp_aot_safepoint(tp, 225);
+    goto L39;
+L265: /* LINE */
+    f->line = code + 265;
+    f->lineno = 73;
+L276: /* STRING */
+    tp_aot_op(tp, f, code + 276);
+L280: /* METHOD */
+    tp_aot_op(tp, f, code + 280);
+L282: /* MOVE */
+    regs[7] = regs[2];
+L283: /* NUMBER */
+    tp_aot_op(tp, f, code + 283);
+L286: /* GET */
+    regs[8] = tp_get(tp, regs[4], regs[9]);
+    tp_grey(tp, regs[8]);
+L287: /* LIST */
+    tp_aot_op(tp, f, code + 287);
+L288: /* CALLM */
+    return code + 288;
+L289: /* JUMP */
+    tp_aot_safepoint(tp, 250);
+    goto L39;
+L290: /* LINE */
+    f->line = code + 290;
+    f->lineno = 74;
+L295: /* RETURN */
+    return code + 295;
+L296: /* EOF */
+    return code + 296;
+}
+
+static tpd_code * _tp_tinypy_compiler_peephole_1329(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 11: goto L11;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 30: goto L30;
+        case 32: goto L32;
+        case 35: goto L35;
+        case 36: goto L36;
+        case 43: goto L43;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 51: goto L51;
+        case 52: goto L52;
+        case 61: goto L61;
+        case 64: goto L64;
+        case 65: goto L65;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 81: goto L81;
+        case 84: goto L84;
+        case 88: goto L88;
+        case 91: goto L91;
+        case 92: goto L92;
+        case 93: goto L93;
+        case 94: goto L94;
+        case 95: goto L95;
+        case 96: goto L96;
+        case 97: goto L97;
+        case 112: goto L112;
+        case 115: goto L115;
+        case 116: goto L116;
+        case 119: goto L119;
+        case 120: goto L120;
+        case 121: goto L121;
+        case 122: goto L122;
+        case 125: goto L125;
+        case 126: goto L126;
+        case 130: goto L130;
+        case 131: goto L131;
+        case 132: goto L132;
+        case 133: goto L133;
+        case 139: goto L139;
+        case 142: goto L142;
+        case 143: goto L143;
+        case 144: goto L144;
+        case 145: goto L145;
+        case 150: goto L150;
+        case 151: goto L151;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 76;
+L8: /* VAR */
+L11: /* STRING */
+    tp_aot_op(tp, f, code + 11);
+L20: /* FILE */
+    f->fname = regs[1];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 77;
+L30: /* VAR */
+L32: /* NUMBER */
+    tp_aot_op(tp, f, code + 32);
+L35: /* MOVE */
+    regs[1] = regs[2];
+L36: /* LINE */
+    f->line = code + 36;
+    f->lineno = 78;
+L43: /* NUMBER */
+    tp_aot_op(tp, f, code + 43);
+L46: /* ITER */
+    if (tp_iter_next(tp, &regs[2], regs[0], &regs[3])) {
+        goto L48;
+    }
+L47: /* JUMP */
+    goto L145;
+L48: /* VAR */
+L51: /* MOVE */
+    regs[4] = regs[2];
+L52: /* LINE */
+    f->line = code + 52;
+    f->lineno = 79;
+L61: /* NUMBER */
+    tp_aot_op(tp, f, code + 61);
+L64: /* GET */
+    regs[2] = tp_get(tp, regs[4], regs[5]);
+    tp_grey(tp, regs[2]);
+L65: /* STRING */
+    tp_aot_op(tp, f, code + 65);
+L68: /* EQ */
+    if (TP_BOTH(regs[2], regs[5], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 68);
+    }
+L69: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L71;
+    }
+L70: /* JUMP */
+    goto L97;
+L71: /* LINE */
+    f->line = code + 71;
+    f->lineno = 80;
+L81: /* NUMBER */
+    tp_aot_op(tp, f, code + 81);
+L84: /* GGET */
+    tp_aot_op(tp, f, code + 84);
+L88: /* NUMBER */
+    tp_aot_op(tp, f, code + 88);
+L91: /* GET */
+    regs[7] = tp_get(tp, regs[4], regs[2]);
+    tp_grey(tp, regs[7]);
+L92: /* CALLP */
+    return code + 92;
+L93: /* ADD */
+    if (TP_BOTH(regs[5], regs[2], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[5].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 93);
+    }
+L94: /* ADD */
+    if (TP_BOTH(regs[1], regs[5], TP_NUMBER_INT)) {
+        regs[2] = tp_int(regs[1].nint + regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 94);
+    }
+L95: /* MOVE */
+    regs[1] = regs[2];
+L96: /* JUMP */
+    tp_aot_safepoint(tp, 50);
+    goto L46;
+L97: /* LINE */
+    f->line = code + 97;
+    f->lineno = 81;
+L112: /* NUMBER */
+    tp_aot_op(tp, f, code + 112);
+L115: /* GET */
+    regs[2] = tp_get(tp, regs[4], regs[5]);
+    tp_grey(tp, regs[2]);
+L116: /* STRING */
+    tp_aot_op(tp, f, code + 116);
+L119: /* NE */
+    if (TP_BOTH(regs[2], regs[5], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint != regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 119);
+    }
+L120: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L122;
+    }
+L121: /* JUMP */
+    goto L131;
+L122: /* NUMBER */
+    tp_aot_op(tp, f, code + 122);
+L125: /* GET */
+    regs[2] = tp_get(tp, regs[4], regs[5]);
+    tp_grey(tp, regs[2]);
+L126: /* STRING */
+    tp_aot_op(tp, f, code + 126);
+L130: /* NE */
+    if (TP_BOTH(regs[2], regs[5], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint != regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 130);
+    }
+L131: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L133;
+    }
+L132: /* JUMP */
+    tp_aot_safepoint(tp, 86);
+    goto L46;
+L133: /* LINE */
+    f->line = code + 133;
+    f->lineno = 82;
+L139: /* NUMBER */
+    tp_aot_op(tp, f, code + 139);
+L142: /* ADD */
+    if (TP_BOTH(regs[1], regs[5], TP_NUMBER_INT)) {
+        regs[2] = tp_int(regs[1].nint + regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 142);
+    }
+L143: /* MOVE */
+    regs[1] = regs[2];
+L144: /* JUMP */
+    tp_aot_safepoint(tp, 98);
+    goto L46;
+L145: /* LINE */
+    f->line = code + 145;
+    f->lineno = 83;
+L150: /* RETURN */
+    return code + 150;
+L151: /* EOF */
+    return code + 151;
+}
+
+static tpd_code * _tp_tinypy_compiler_peephole_1505(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 30: goto L30;
+        case 32: goto L32;
+        case 33: goto L33;
+        case 34: goto L34;
+        case 43: goto L43;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 51: goto L51;
+        case 52: goto L52;
+        case 54: goto L54;
+        case 55: goto L55;
+        case 61: goto L61;
+        case 65: goto L65;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 75: goto L75;
+        case 76: goto L76;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 85;
+L7: /* VAR */
+L9: /* VAR */
+L11: /* STRING */
+    tp_aot_op(tp, f, code + 11);
+L20: /* FILE */
+    f->fname = regs[2];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L25: /* NAME */
+    f->name = regs[2];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 86;
+L30: /* VAR */
+L32: /* LIST */
+    tp_aot_op(tp, f, code + 32);
+L33: /* MOVE */
+    regs[2] = regs[3];
+L34: /* LINE */
+    f->line = code + 34;
+    f->lineno = 87;
+L43: /* GGET */
+    tp_aot_op(tp, f, code + 43);
+L47: /* MOVE */
+    regs[5] = regs[0];
+L48: /* ADD */
+    if (TP_BOTH(regs[0], regs[1], TP_NUMBER_INT)) {
+        regs[6] = tp_int(regs[0].nint + regs[1].nint);
+    } else {
+        tp_aot_op(tp, f, code + 48);
+    }
+L49: /* RANGE */
+    tp_aot_op(tp, f, code + 49);
+L50: /* FOR */
+    if (regs[9].type.typeid == TP_NUMBER) {
+        if (regs[10].nint > 0 ? regs[8].nint < regs[9].nint : regs[8].nint > regs[9].nint) {
+            regs[3] = regs[8];
+            regs[8].nint += regs[10].nint;
+            goto L52;
+        }
+    } else if (tp_iter_next(tp, &regs[3], regs[8], &regs[10])) {
+        goto L52;
+    }
+L51: /* JUMP */
+    goto L70;
+L52: /* VAR */
+L54: /* MOVE */
+    regs[4] = regs[3];
+L55: /* LINE */
+    f->line = code + 55;
+    f->lineno = 88;
+L61: /* STRING */
+    tp_aot_op(tp, f, code + 61);
+L65: /* METHOD */
+    tp_aot_op(tp, f, code + 65);
+L67: /* MOVE */
+    regs[7] = regs[4];
+L68: /* CALLM */
+    return code + 68;
+L69: /* JUMP */
+    tp_aot_safepoint(tp, 19);
+    goto L50;
+L70: /* LINE */
+    f->line = code + 70;
+    f->lineno = 89;
+L75: /* RETURN */
+    return code + 75;
+L76: /* EOF */
+    return code + 76;
+}
+
+static tpd_code * _tp_tinypy_compiler_peephole_1603(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 37: goto L37;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 44: goto L44;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 51: goto L51;
+        case 54: goto L54;
+        case 55: goto L55;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 74: goto L74;
+        case 77: goto L77;
+        case 78: goto L78;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 85: goto L85;
+        case 86: goto L86;
+        case 87: goto L87;
+        case 98: goto L98;
+        case 101: goto L101;
+        case 102: goto L102;
+        case 105: goto L105;
+        case 106: goto L106;
+        case 109: goto L109;
+        case 110: goto L110;
+        case 113: goto L113;
+        case 114: goto L114;
+        case 116: goto L116;
+        case 117: goto L117;
+        case 119: goto L119;
+        case 120: goto L120;
+        case 122: goto L122;
+        case 123: goto L123;
+        case 125: goto L125;
+        case 126: goto L126;
+        case 136: goto L136;
+        case 140: goto L140;
+        case 141: goto L141;
+        case 142: goto L142;
+        case 143: goto L143;
+        case 144: goto L144;
+        case 145: goto L145;
+        case 146: goto L146;
+        case 147: goto L147;
+        case 156: goto L156;
+        case 160: goto L160;
+        case 161: goto L161;
+        case 162: goto L162;
+        case 163: goto L163;
+        case 164: goto L164;
+        case 165: goto L165;
+        case 166: goto L166;
+        case 186: goto L186;
+        case 190: goto L190;
+        case 191: goto L191;
+        case 192: goto L192;
+        case 193: goto L193;
+        case 197: goto L197;
+        case 200: goto L200;
+        case 204: goto L204;
+        case 208: goto L208;
+        case 212: goto L212;
+        case 216: goto L216;
+        case 217: goto L217;
+        case 218: goto L218;
+        case 219: goto L219;
+        case 220: goto L220;
+        case 221: goto L221;
+        case 222: goto L222;
+        case 240: goto L240;
+        case 244: goto L244;
+        case 248: goto L248;
+        case 252: goto L252;
+        case 256: goto L256;
+        case 260: goto L260;
+        case 261: goto L261;
+        case 262: goto L262;
+        case 263: goto L263;
+        case 264: goto L264;
+        case 268: goto L268;
+        case 269: goto L269;
+        case 270: goto L270;
+        case 271: goto L271;
+        case 272: goto L272;
+        case 283: goto L283;
+        case 287: goto L287;
+        case 288: goto L288;
+        case 289: goto L289;
+        case 290: goto L290;
+        case 291: goto L291;
+        case 292: goto L292;
+        case 295: goto L295;
+        case 296: goto L296;
+        case 297: goto L297;
+        case 298: goto L298;
+        case 310: goto L310;
+        case 313: goto L313;
+        case 314: goto L314;
+        case 315: goto L315;
+        case 316: goto L316;
+        case 317: goto L317;
+        case 320: goto L320;
+        case 321: goto L321;
+        case 324: goto L324;
+        case 325: goto L325;
+        case 326: goto L326;
+        case 327: goto L327;
+        case 337: goto L337;
+        case 341: goto L341;
+        case 342: goto L342;
+        case 343: goto L343;
+        case 344: goto L344;
+        case 345: goto L345;
+        case 346: goto L346;
+        case 347: goto L347;
+        case 348: goto L348;
+        case 366: goto L366;
+        case 369: goto L369;
+        case 372: goto L372;
+        case 376: goto L376;
+        case 380: goto L380;
+        case 383: goto L383;
+        case 387: goto L387;
+        case 391: goto L391;
+        case 392: goto L392;
+        case 393: goto L393;
+        case 394: goto L394;
+        case 395: goto L395;
+        case 396: goto L396;
+        case 397: goto L397;
+        case 398: goto L398;
+        case 407: goto L407;
+        case 411: goto L411;
+        case 412: goto L412;
+        case 413: goto L413;
+        case 414: goto L414;
+        case 415: goto L415;
+        case 416: goto L416;
+        case 417: goto L417;
+        case 418: goto L418;
+        case 431: goto L431;
+        case 434: goto L434;
+        case 438: goto L438;
+        case 442: goto L442;
+        case 443: goto L443;
+        case 444: goto L444;
+        case 445: goto L445;
+        case 446: goto L446;
+        case 447: goto L447;
+        case 448: goto L448;
+        case 449: goto L449;
+        case 450: goto L450;
+        case 457: goto L457;
+        case 458: goto L458;
+        case 459: goto L459;
+        case 460: goto L460;
+        case 461: goto L461;
+        case 462: goto L462;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 91;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 93;
+L37: /* NUMBER */
+    tp_aot_op(tp, f, code + 37);
+L40: /* GET */
+    regs[1] = tp_get(tp, regs[0], regs[2]);
+    tp_grey(tp, regs[1]);
+L41: /* STRING */
+    tp_aot_op(tp, f, code + 41);
+L44: /* EQ */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[1].nint == regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 44);
+    }
+L45: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L47;
+    }
+L46: /* JUMP */
+    goto L64;
+L47: /* GGET */
+    tp_aot_op(tp, f, code + 47);
+L51: /* NUMBER */
+    tp_aot_op(tp, f, code + 51);
+L54: /* GET */
+    regs[3] = tp_get(tp, regs[0], regs[5]);
+    tp_grey(tp, regs[3]);
+L55: /* NUMBER */
+    tp_aot_op(tp, f, code + 55);
+L58: /* ADD */
+    if (TP_BOTH(regs[3], regs[5], TP_NUMBER_INT)) {
+        regs[3] = tp_int(regs[3].nint + regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 58);
+    }
+L59: /* NUMBER */
+    tp_aot_op(tp, f, code + 59);
+L62: /* CALLP */
+    return code + 62;
+L63: /* RETURN */
+    return code + 63;
+L64: /* LINE */
+    f->line = code + 64;
+    f->lineno = 94;
+L74: /* NUMBER */
+    tp_aot_op(tp, f, code + 74);
+L77: /* GET */
+    regs[1] = tp_get(tp, regs[0], regs[2]);
+    tp_grey(tp, regs[1]);
+L78: /* STRING */
+    tp_aot_op(tp, f, code + 78);
+L82: /* NE */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[1].nint != regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 82);
+    }
+L83: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L85;
+    }
+L84: /* JUMP */
+    goto L87;
+L85: /* LIST */
+    tp_aot_op(tp, f, code + 85);
+L86: /* RETURN */
+    return code + 86;
+L87: /* LINE */
+    f->line = code + 87;
+    f->lineno = 95;
+L98: /* NUMBER */
+    tp_aot_op(tp, f, code + 98);
+L101: /* GET */
+    regs[1] = tp_get(tp, regs[0], regs[3]);
+    tp_grey(tp, regs[1]);
+L102: /* NUMBER */
+    tp_aot_op(tp, f, code + 102);
+L105: /* GET */
+    regs[2] = tp_get(tp, regs[0], regs[4]);
+    tp_grey(tp, regs[2]);
+L106: /* NUMBER */
+    tp_aot_op(tp, f, code + 106);
+L109: /* GET */
+    regs[3] = tp_get(tp, regs[0], regs[5]);
+    tp_grey(tp, regs[3]);
+L110: /* NUMBER */
+    tp_aot_op(tp, f, code + 110);
+L113: /* GET */
+    regs[4] = tp_get(tp, regs[0], regs[6]);
+    tp_grey(tp, regs[4]);
+L114: /* VAR */
+L116: /* MOVE */
+    regs[5] = regs[1];
+L117: /* VAR */
+L119: /* MOVE */
+    regs[1] = regs[2];
+L120: /* VAR */
+L122: /* MOVE */
+    regs[2] = regs[3];
+L123: /* VAR */
+L125: /* MOVE */
+    regs[3] = regs[4];
+L126: /* LINE */
+    f->line = code + 126;
+    f->lineno = 96;
+L136: /* GGET */
+    tp_aot_op(tp, f, code + 136);
+L140: /* IN */
+    regs[4] = tp_has(tp, regs[6], regs[5]);
+L141: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L143;
+    }
+L142: /* JUMP */
+    goto L147;
+L143: /* MOVE */
+    regs[6] = regs[2];
+L144: /* MOVE */
+    regs[7] = regs[3];
+L145: /* LIST */
+    tp_aot_op(tp, f, code + 145);
+L146: /* RETURN */
+    return code + 146;
+L147: /* LINE */
+    f->line = code + 147;
+    f->lineno = 97;
+L156: /* GGET */
+    tp_aot_op(tp, f, code + 156);
+L160: /* IN */
+    regs[4] = tp_has(tp, regs[6], regs[5]);
+L161: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L163;
+    }
+L162: /* JUMP */
+    goto L166;
+L163: /* MOVE */
+    regs[6] = regs[2];
+L164: /* LIST */
+    tp_aot_op(tp, f, code + 164);
+L165: /* RETURN */
+    return code + 165;
+L166: /* LINE */
+    f->line = code + 166;
+    f->lineno = 98;
+L186: /* GGET */
+    tp_aot_op(tp, f, code + 186);
+L190: /* IN */
+    regs[4] = tp_has(tp, regs[6], regs[5]);
+L191: /* IFN */
+    if (!(TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4]))) {
+        goto L193;
+    }
+L192: /* JUMP */
+    goto L218;
+L193: /* GGET */
+    tp_aot_op(tp, f, code + 193);
+L197: /* GGET */
+    tp_aot_op(tp, f, code + 197);
+L200: /* GGET */
+    tp_aot_op(tp, f, code + 200);
+L204: /* GGET */
+    tp_aot_op(tp, f, code + 204);
+L208: /* GGET */
+    tp_aot_op(tp, f, code + 208);
+L212: /* GGET */
+    tp_aot_op(tp, f, code + 212);
+L216: /* LIST */
+    tp_aot_op(tp, f, code + 216);
+L217: /* IN */
+    regs[4] = tp_has(tp, regs[6], regs[5]);
+L218: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L220;
+    }
+L219: /* JUMP */
+    goto L222;
+L220: /* LIST */
+    tp_aot_op(tp, f, code + 220);
+L221: /* RETURN */
+    return code + 221;
+L222: /* LINE */
+    f->line = code + 222;
+    f->lineno = 99;
+L240: /* GGET */
+    tp_aot_op(tp, f, code + 240);
+L244: /* GGET */
+    tp_aot_op(tp, f, code + 244);
+L248: /* GGET */
+    tp_aot_op(tp, f, code + 248);
+L252: /* GGET */
+    tp_aot_op(tp, f, code + 252);
+L256: /* GGET */
+    tp_aot_op(tp, f, code + 256);
+L260: /* LIST */
+    tp_aot_op(tp, f, code + 260);
+L261: /* IN */
+    regs[4] = tp_has(tp, regs[6], regs[5]);
+L262: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L264;
+    }
+L263: /* JUMP */
+    goto L272;
+L264: /* GGET */
+    tp_aot_op(tp, f, code + 264);
+L268: /* MOVE */
+    regs[7] = regs[2];
+L269: /* MOVE */
+    regs[8] = regs[3];
+L270: /* CALLP */
+    return code + 270;
+L271: /* RETURN */
+    return code + 271;
+L272: /* LINE */
+    f->line = code + 272;
+    f->lineno = 100;
+L283: /* GGET */
+    tp_aot_op(tp, f, code + 283);
+L287: /* EQ */
+    if (TP_BOTH(regs[5], regs[6], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[5].nint == regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 287);
+    }
+L288: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L290;
+    }
+L289: /* JUMP */
+    goto L298;
+L290: /* MOVE */
+    regs[6] = regs[2];
+L291: /* MOVE */
+    regs[7] = regs[3];
+L292: /* NUMBER */
+    tp_aot_op(tp, f, code + 292);
+L295: /* ADD */
+    if (TP_BOTH(regs[3], regs[9], TP_NUMBER_INT)) {
+        regs[8] = tp_int(regs[3].nint + regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 295);
+    }
+L296: /* LIST */
+    tp_aot_op(tp, f, code + 296);
+L297: /* RETURN */
+    return code + 297;
+L298: /* LINE */
+    f->line = code + 298;
+    f->lineno = 101;
+L310: /* GGET */
+    tp_aot_op(tp, f, code + 310);
+L313: /* EQ */
+    if (TP_BOTH(regs[5], regs[6], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[5].nint == regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 313);
+    }
+L314: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L316;
+    }
+L315: /* JUMP */
+    goto L327;
+L316: /* MOVE */
+    regs[6] = regs[2];
+L317: /* NUMBER */
+    tp_aot_op(tp, f, code + 317);
+L320: /* ADD */
+    if (TP_BOTH(regs[2], regs[9], TP_NUMBER_INT)) {
+        regs[7] = tp_int(regs[2].nint + regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 320);
+    }
+L321: /* NUMBER */
+    tp_aot_op(tp, f, code + 321);
+L324: /* ADD */
+    if (TP_BOTH(regs[2], regs[9], TP_NUMBER_INT)) {
+        regs[8] = tp_int(regs[2].nint + regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 324);
+    }
+L325: /* LIST */
+    tp_aot_op(tp, f, code + 325);
+L326: /* RETURN */
+    return code + 326;
+L327: /* LINE */
+    f->line = code + 327;
+    f->lineno = 102;
+L337: /* GGET */
+    tp_aot_op(tp, f, code + 337);
+L341: /* EQ */
+    if (TP_BOTH(regs[5], regs[6], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[5].nint == regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 341);
+    }
+L342: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L344;
+    }
+L343: /* JUMP */
+    goto L348;
+L344: /* MOVE */
+    regs[6] = regs[2];
+L345: /* MOVE */
+    regs[7] = regs[3];
+L346: /* LIST */
+    tp_aot_op(tp, f, code + 346);
+L347: /* RETURN */
+    return code + 347;
+L348: /* LINE */
+    f->line = code + 348;
+    f->lineno = 103;
+L366: /* GGET */
+    tp_aot_op(tp, f, code + 366);
+L369: /* GGET */
+    tp_aot_op(tp, f, code + 369);
+L372: /* GGET */
+    tp_aot_op(tp, f, code + 372);
+L376: /* GGET */
+    tp_aot_op(tp, f, code + 376);
+L380: /* GGET */
+    tp_aot_op(tp, f, code + 380);
+L383: /* GGET */
+    tp_aot_op(tp, f, code + 383);
+L387: /* GGET */
+    tp_aot_op(tp, f, code + 387);
+L391: /* LIST */
+    tp_aot_op(tp, f, code + 391);
+L392: /* IN */
+    regs[4] = tp_has(tp, regs[6], regs[5]);
+L393: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L395;
+    }
+L394: /* JUMP */
+    goto L398;
+L395: /* MOVE */
+    regs[6] = regs[1];
+L396: /* LIST */
+    tp_aot_op(tp, f, code + 396);
+L397: /* RETURN */
+    return code + 397;
+L398: /* LINE */
+    f->line = code + 398;
+    f->lineno = 104;
+L407: /* GGET */
+    tp_aot_op(tp, f, code + 407);
+L411: /* EQ */
+    if (TP_BOTH(regs[5], regs[6], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[5].nint == regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 411);
+    }
+L412: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L414;
+    }
+L413: /* JUMP */
+    goto L418;
+L414: /* MOVE */
+    regs[6] = regs[2];
+L415: /* MOVE */
+    regs[7] = regs[3];
+L416: /* LIST */
+    tp_aot_op(tp, f, code + 416);
+L417: /* RETURN */
+    return code + 417;
+L418: /* LINE */
+    f->line = code + 418;
+    f->lineno = 105;
+L431: /* GGET */
+    tp_aot_op(tp, f, code + 431);
+L434: /* GGET */
+    tp_aot_op(tp, f, code + 434);
+L438: /* GGET */
+    tp_aot_op(tp, f, code + 438);
+L442: /* LIST */
+    tp_aot_op(tp, f, code + 442);
+L443: /* IN */
+    regs[4] = tp_has(tp, regs[6], regs[5]);
+L444: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L446;
+    }
+L445: /* JUMP */
+    goto L450;
+L446: /* MOVE */
+    regs[6] = regs[1];
+L447: /* MOVE */
+    regs[7] = regs[2];
+L448: /* LIST */
+    tp_aot_op(tp, f, code + 448);
+L449: /* RETURN */
+    return code + 449;
+L450: /* LINE */
+    f->line = code + 450;
+    f->lineno = 106;
+L457: /* MOVE */
+    regs[6] = regs[1];
+L458: /* MOVE */
+    regs[7] = regs[2];
+L459: /* MOVE */
+    regs[8] = regs[3];
+L460: /* LIST */
+    tp_aot_op(tp, f, code + 460);
+L461: /* RETURN */
+    return code + 461;
+L462: /* EOF */
+    return code + 462;
+}
+
+static tpd_code * _tp_tinypy_compiler_peephole_2087(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 34: goto L34;
+        case 37: goto L37;
+        case 38: goto L38;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 60: goto L60;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 72: goto L72;
+        case 73: goto L73;
+        case 78: goto L78;
+        case 80: goto L80;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 94: goto L94;
+        case 99: goto L99;
+        case 100: goto L100;
+        case 101: goto L101;
+        case 102: goto L102;
+        case 105: goto L105;
+        case 106: goto L106;
+        case 107: goto L107;
+        case 108: goto L108;
+        case 120: goto L120;
+        case 124: goto L124;
+        case 125: goto L125;
+        case 126: goto L126;
+        case 127: goto L127;
+        case 130: goto L130;
+        case 131: goto L131;
+        case 134: goto L134;
+        case 135: goto L135;
+        case 138: goto L138;
+        case 139: goto L139;
+        case 140: goto L140;
+        case 141: goto L141;
+        case 152: goto L152;
+        case 156: goto L156;
+        case 157: goto L157;
+        case 158: goto L158;
+        case 159: goto L159;
+        case 163: goto L163;
+        case 166: goto L166;
+        case 167: goto L167;
+        case 170: goto L170;
+        case 171: goto L171;
+        case 172: goto L172;
+        case 177: goto L177;
+        case 178: goto L178;
+        case 179: goto L179;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 108;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 110;
+L34: /* NUMBER */
+    tp_aot_op(tp, f, code + 34);
+L37: /* GET */
+    regs[1] = tp_get(tp, regs[0], regs[2]);
+    tp_grey(tp, regs[1]);
+L38: /* STRING */
+    tp_aot_op(tp, f, code + 38);
+L41: /* EQ */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[1].nint == regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 41);
+    }
+L42: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L44;
+    }
+L43: /* JUMP */
+    goto L50;
+L44: /* NUMBER */
+    tp_aot_op(tp, f, code + 44);
+L47: /* GET */
+    regs[2] = tp_get(tp, regs[0], regs[2]);
+    tp_grey(tp, regs[2]);
+L48: /* LIST */
+    tp_aot_op(tp, f, code + 48);
+L49: /* RETURN */
+    return code + 49;
+L50: /* LINE */
+    f->line = code + 50;
+    f->lineno = 111;
+L60: /* NUMBER */
+    tp_aot_op(tp, f, code + 60);
+L63: /* GET */
+    regs[1] = tp_get(tp, regs[0], regs[2]);
+    tp_grey(tp, regs[1]);
+L64: /* STRING */
+    tp_aot_op(tp, f, code + 64);
+L68: /* NE */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[1].nint != regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 68);
+    }
+L69: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L71;
+    }
+L70: /* JUMP */
+    goto L73;
+L71: /* LIST */
+    tp_aot_op(tp, f, code + 71);
+L72: /* RETURN */
+    return code + 72;
+L73: /* LINE */
+    f->line = code + 73;
+    f->lineno = 112;
+L78: /* VAR */
+L80: /* NUMBER */
+    tp_aot_op(tp, f, code + 80);
+L83: /* GET */
+    regs[1] = tp_get(tp, regs[0], regs[2]);
+    tp_grey(tp, regs[1]);
+L84: /* LINE */
+    f->line = code + 84;
+    f->lineno = 113;
+L94: /* GGET */
+    tp_aot_op(tp, f, code + 94);
+L99: /* IN */
+    regs[2] = tp_has(tp, regs[2], regs[1]);
+L100: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L102;
+    }
+L101: /* JUMP */
+    goto L108;
+L102: /* NUMBER */
+    tp_aot_op(tp, f, code + 102);
+L105: /* GET */
+    regs[2] = tp_get(tp, regs[0], regs[3]);
+    tp_grey(tp, regs[2]);
+L106: /* LIST */
+    tp_aot_op(tp, f, code + 106);
+L107: /* RETURN */
+    return code + 107;
+L108: /* LINE */
+    f->line = code + 108;
+    f->lineno = 114;
+L120: /* GGET */
+    tp_aot_op(tp, f, code + 120);
+L124: /* EQ */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[1].nint == regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 124);
+    }
+L125: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L127;
+    }
+L126: /* JUMP */
+    goto L141;
+L127: /* NUMBER */
+    tp_aot_op(tp, f, code + 127);
+L130: /* GET */
+    regs[2] = tp_get(tp, regs[0], regs[4]);
+    tp_grey(tp, regs[2]);
+L131: /* NUMBER */
+    tp_aot_op(tp, f, code + 131);
+L134: /* GET */
+    regs[3] = tp_get(tp, regs[0], regs[4]);
+    tp_grey(tp, regs[3]);
+L135: /* NUMBER */
+    tp_aot_op(tp, f, code + 135);
+L138: /* ADD */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[3] = tp_int(regs[3].nint + regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 138);
+    }
+L139: /* LIST */
+    tp_aot_op(tp, f, code + 139);
+L140: /* RETURN */
+    return code + 140;
+L141: /* LINE */
+    f->line = code + 141;
+    f->lineno = 115;
+L152: /* GGET */
+    tp_aot_op(tp, f, code + 152);
+L156: /* EQ */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[1].nint == regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 156);
+    }
+L157: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L159;
+    }
+L158: /* JUMP */
+    goto L172;
+L159: /* GGET */
+    tp_aot_op(tp, f, code + 159);
+L163: /* NUMBER */
+    tp_aot_op(tp, f, code + 163);
+L166: /* GET */
+    regs[3] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[3]);
+L167: /* NUMBER */
+    tp_aot_op(tp, f, code + 167);
+L170: /* CALLP */
+    return code + 170;
+L171: /* RETURN */
+    return code + 171;
+L172: /* LINE */
+    f->line = code + 172;
+    f->lineno = 116;
+L177: /* LIST */
+    tp_aot_op(tp, f, code + 177);
+L178: /* RETURN */
+    return code + 178;
+L179: /* EOF */
+    return code + 179;
+}
+
+static tpd_code * _tp_tinypy_compiler_peephole_2291(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 33: goto L33;
+        case 36: goto L36;
+        case 37: goto L37;
+        case 38: goto L38;
+        case 47: goto L47;
+        case 51: goto L51;
+        case 54: goto L54;
+        case 55: goto L55;
+        case 56: goto L56;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 72: goto L72;
+        case 73: goto L73;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 93: goto L93;
+        case 94: goto L94;
+        case 97: goto L97;
+        case 98: goto L98;
+        case 99: goto L99;
+        case 100: goto L100;
+        case 105: goto L105;
+        case 106: goto L106;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 118;
+L9: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[1];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L27: /* NAME */
+    f->name = regs[1];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 119;
+L33: /* VAR */
+L36: /* DICT */
+    tp_aot_op(tp, f, code + 36);
+L37: /* MOVE */
+    regs[1] = regs[2];
+L38: /* LINE */
+    f->line = code + 38;
+    f->lineno = 120;
+L47: /* GGET */
+    tp_aot_op(tp, f, code + 47);
+L51: /* GGET */
+    tp_aot_op(tp, f, code + 51);
+L54: /* MOVE */
+    regs[5] = regs[0];
+L55: /* CALLP */
+    return code + 55;
+L56: /* RANGE */
+    tp_aot_op(tp, f, code + 56);
+L57: /* FOR */
+    if (regs[6].type.typeid == TP_NUMBER) {
+        if (regs[7].nint > 0 ? regs[5].nint < regs[6].nint : regs[5].nint > regs[6].nint) {
+            regs[2] = regs[5];
+            regs[5].nint += regs[7].nint;
+            goto L59;
+        }
+    } else if (tp_iter_next(tp, &regs[2], regs[5], &regs[7])) {
+        goto L59;
+    }
+L58: /* JUMP */
+    goto L100;
+L59: /* VAR */
+L61: /* MOVE */
+    regs[3] = regs[2];
+L62: /* LINE */
+    f->line = code + 62;
+    f->lineno = 121;
+L72: /* GET */
+    regs[2] = tp_get(tp, regs[0], regs[3]);
+    tp_grey(tp, regs[2]);
+L73: /* NUMBER */
+    tp_aot_op(tp, f, code + 73);
+L76: /* GET */
+    regs[2] = tp_get(tp, regs[2], regs[4]);
+    tp_grey(tp, regs[2]);
+L77: /* STRING */
+    tp_aot_op(tp, f, code + 77);
+L80: /* EQ */
+    if (TP_BOTH(regs[2], regs[4], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint == regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 80);
+    }
+L81: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L83;
+    }
+L82: /* JUMP */
+    tp_aot_safepoint(tp, 25);
+    goto L57;
+L83: /* LINE */
+    f->line = code + 83;
+    f->lineno = 122;
+L93: /* GET */
+    regs[2] = tp_get(tp, regs[0], regs[3]);
+    tp_grey(tp, regs[2]);
+L94: /* NUMBER */
+    tp_aot_op(tp, f, code + 94);
+L97: /* GET */
+    regs[2] = tp_get(tp, regs[2], regs[4]);
+    tp_grey(tp, regs[2]);
+L98: /* SET */
+    tp_set(tp, regs[1], regs[2], regs[3]);
+L99: /* JUMP */
+    tp_aot_safepoint(tp, 42);
+    goto L57;
+L100: /* LINE */
+    f->line = code + 100;
+    f->lineno = 123;
+L105: /* RETURN */
+    return code + 105;
+L106: /* EOF */
+    return code + 106;
+}
+
+static tpd_code * _tp_tinypy_compiler_peephole_2427(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 10: goto L10;
+        case 13: goto L13;
+        case 15: goto L15;
+        case 24: goto L24;
+        case 25: goto L25;
+        case 30: goto L30;
+        case 31: goto L31;
+        case 45: goto L45;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 51: goto L51;
+        case 52: goto L52;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 69: goto L69;
+        case 72: goto L72;
+        case 73: goto L73;
+        case 74: goto L74;
+        case 79: goto L79;
+        case 80: goto L80;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 125;
+L10: /* VAR */
+L13: /* VAR */
+L15: /* STRING */
+    tp_aot_op(tp, f, code + 15);
+L24: /* FILE */
+    f->fname = regs[2];
+L25: /* STRING */
+    tp_aot_op(tp, f, code + 25);
+L30: /* NAME */
+    f->name = regs[2];
+L31: /* LINE */
+    f->line = code + 31;
+    f->lineno = 127;
+L45: /* GGET */
+    tp_aot_op(tp, f, code + 45);
+L48: /* MOVE */
+    regs[3] = regs[0];
+L49: /* CALLP */
+    return code + 49;
+L50: /* LT */
+    if (TP_BOTH(regs[1], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[1].nint < regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 50);
+    }
+L51: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L53;
+    }
+L52: /* JUMP */
+    goto L62;
+L53: /* GET */
+    regs[2] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[2]);
+L54: /* NUMBER */
+    tp_aot_op(tp, f, code + 54);
+L57: /* GET */
+    regs[2] = tp_get(tp, regs[2], regs[3]);
+    tp_grey(tp, regs[2]);
+L58: /* STRING */
+    tp_aot_op(tp, f, code + 58);
+L61: /* EQ */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint == regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 61);
+    }
+L62: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L64;
+    }
+L63: /* JUMP */
+    goto L74;
+L64: /* LINE */
+    f->line = code + 64;
+    f->lineno = 128;
+L69: /* NUMBER */
+    tp_aot_op(tp, f, code + 69);
+L72: /* ADD */
+    if (TP_BOTH(regs[1], regs[3], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 72);
+    }
+L73: /* JUMP */
+    tp_aot_safepoint(tp, 28);
+    goto L45;
+L74: /* LINE */
+    f->line = code + 74;
+    f->lineno = 129;
+L79: /* RETURN */
+    return code + 79;
+L80: /* EOF */
+    return code + 80;
+}
+
+static tpd_code * _tp_tinypy_compiler_peephole_2537(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 10: goto L10;
+        case 13: goto L13;
+        case 15: goto L15;
+        case 24: goto L24;
+        case 25: goto L25;
+        case 30: goto L30;
+        case 31: goto L31;
+        case 35: goto L35;
+        case 38: goto L38;
+        case 39: goto L39;
+        case 51: goto L51;
+        case 54: goto L54;
+        case 55: goto L55;
+        case 56: goto L56;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 65: goto L65;
+        case 66: goto L66;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 73: goto L73;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 78: goto L78;
+        case 97: goto L97;
+        case 100: goto L100;
+        case 101: goto L101;
+        case 102: goto L102;
+        case 103: goto L103;
+        case 104: goto L104;
+        case 107: goto L107;
+        case 108: goto L108;
+        case 112: goto L112;
+        case 113: goto L113;
+        case 114: goto L114;
+        case 115: goto L115;
+        case 116: goto L116;
+        case 119: goto L119;
+        case 120: goto L120;
+        case 124: goto L124;
+        case 125: goto L125;
+        case 126: goto L126;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 131;
+L10: /* VAR */
+L13: /* VAR */
+L15: /* STRING */
+    tp_aot_op(tp, f, code + 15);
+L24: /* FILE */
+    f->fname = regs[2];
+L25: /* STRING */
+    tp_aot_op(tp, f, code + 25);
+L30: /* NAME */
+    f->name = regs[2];
+L31: /* LINE */
+    f->line = code + 31;
+    f->lineno = 133;
+L35: /* NUMBER */
+    tp_aot_op(tp, f, code + 35);
+L38: /* SUB */
+    if (TP_BOTH(regs[1], regs[3], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint - regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 38);
+    }
+L39: /* LINE */
+    f->line = code + 39;
+    f->lineno = 134;
+L51: /* NUMBER */
+    tp_aot_op(tp, f, code + 51);
+L54: /* GE */
+    if (TP_BOTH(regs[1], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[1].nint >= regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 54);
+    }
+L55: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L57;
+    }
+L56: /* JUMP */
+    goto L66;
+L57: /* GET */
+    regs[2] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[2]);
+L58: /* NUMBER */
+    tp_aot_op(tp, f, code + 58);
+L61: /* GET */
+    regs[2] = tp_get(tp, regs[2], regs[3]);
+    tp_grey(tp, regs[2]);
+L62: /* STRING */
+    tp_aot_op(tp, f, code + 62);
+L65: /* EQ */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint == regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 65);
+    }
+L66: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L68;
+    }
+L67: /* JUMP */
+    goto L78;
+L68: /* LINE */
+    f->line = code + 68;
+    f->lineno = 135;
+L73: /* NUMBER */
+    tp_aot_op(tp, f, code + 73);
+L76: /* SUB */
+    if (TP_BOTH(regs[1], regs[3], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint - regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 76);
+    }
+L77: /* JUMP */
+    tp_aot_safepoint(tp, 26);
+    goto L51;
+L78: /* LINE */
+    f->line = code + 78;
+    f->lineno = 136;
+L97: /* NUMBER */
+    tp_aot_op(tp, f, code + 97);
+L100: /* GE */
+    if (TP_BOTH(regs[1], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[1].nint >= regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 100);
+    }
+L101: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L103;
+    }
+L102: /* JUMP */
+    goto L113;
+L103: /* GET */
+    regs[2] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[2]);
+L104: /* NUMBER */
+    tp_aot_op(tp, f, code + 104);
+L107: /* GET */
+    regs[2] = tp_get(tp, regs[2], regs[3]);
+    tp_grey(tp, regs[2]);
+L108: /* STRING */
+    tp_aot_op(tp, f, code + 108);
+L112: /* EQ */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint == regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 112);
+    }
+L113: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L115;
+    }
+L114: /* JUMP */
+    goto L125;
+L115: /* GET */
+    regs[2] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[2]);
+L116: /* NUMBER */
+    tp_aot_op(tp, f, code + 116);
+L119: /* GET */
+    regs[2] = tp_get(tp, regs[2], regs[3]);
+    tp_grey(tp, regs[2]);
+L120: /* GGET */
+    tp_aot_op(tp, f, code + 120);
+L124: /* IN */
+    regs[2] = tp_has(tp, regs[3], regs[2]);
+L125: /* RETURN */
+    return code + 125;
+L126: /* EOF */
+    return code + 126;
+}
+
+static tpd_code * _tp_tinypy_compiler_peephole_2698(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 11: goto L11;
+        case 14: goto L14;
+        case 17: goto L17;
+        case 19: goto L19;
+        case 28: goto L28;
+        case 29: goto L29;
+        case 34: goto L34;
+        case 35: goto L35;
+        case 41: goto L41;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 51: goto L51;
+        case 54: goto L54;
+        case 55: goto L55;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 70: goto L70;
+        case 73: goto L73;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 84: goto L84;
+        case 87: goto L87;
+        case 88: goto L88;
+        case 92: goto L92;
+        case 93: goto L93;
+        case 94: goto L94;
+        case 95: goto L95;
+        case 107: goto L107;
+        case 110: goto L110;
+        case 111: goto L111;
+        case 115: goto L115;
+        case 119: goto L119;
+        case 122: goto L122;
+        case 123: goto L123;
+        case 124: goto L124;
+        case 125: goto L125;
+        case 126: goto L126;
+        case 133: goto L133;
+        case 134: goto L134;
+        case 135: goto L135;
+        case 143: goto L143;
+        case 146: goto L146;
+        case 147: goto L147;
+        case 151: goto L151;
+        case 152: goto L152;
+        case 153: goto L153;
+        case 154: goto L154;
+        case 166: goto L166;
+        case 168: goto L168;
+        case 173: goto L173;
+        case 174: goto L174;
+        case 177: goto L177;
+        case 178: goto L178;
+        case 179: goto L179;
+        case 189: goto L189;
+        case 192: goto L192;
+        case 193: goto L193;
+        case 196: goto L196;
+        case 197: goto L197;
+        case 198: goto L198;
+        case 199: goto L199;
+        case 205: goto L205;
+        case 208: goto L208;
+        case 209: goto L209;
+        case 210: goto L210;
+        case 211: goto L211;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 138;
+L11: /* VAR */
+L14: /* VAR */
+L17: /* VAR */
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L28: /* FILE */
+    f->fname = regs[3];
+L29: /* STRING */
+    tp_aot_op(tp, f, code + 29);
+L34: /* NAME */
+    f->name = regs[3];
+L35: /* LINE */
+    f->line = code + 35;
+    f->lineno = 139;
+L41: /* VAR */
+L43: /* GET */
+    regs[3] = tp_get(tp, regs[0], regs[2]);
+    tp_grey(tp, regs[3]);
+L44: /* LINE */
+    f->line = code + 44;
+    f->lineno = 140;
+L51: /* NUMBER */
+    tp_aot_op(tp, f, code + 51);
+L54: /* GET */
+    regs[5] = tp_get(tp, regs[3], regs[4]);
+    tp_grey(tp, regs[5]);
+L55: /* STRING */
+    tp_aot_op(tp, f, code + 55);
+L59: /* EQ */
+    if (TP_BOTH(regs[5], regs[4], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[5].nint == regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 59);
+    }
+L60: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L62;
+    }
+L61: /* JUMP */
+    goto L77;
+L62: /* LINE */
+    f->line = code + 62;
+    f->lineno = 141;
+L70: /* NUMBER */
+    tp_aot_op(tp, f, code + 70);
+L73: /* GET */
+    regs[6] = tp_get(tp, regs[3], regs[7]);
+    tp_grey(tp, regs[6]);
+L74: /* GET */
+    regs[4] = tp_get(tp, regs[1], regs[6]);
+    tp_grey(tp, regs[4]);
+L75: /* LIST */
+    tp_aot_op(tp, f, code + 75);
+L76: /* RETURN */
+    return code + 76;
+L77: /* LINE */
+    f->line = code + 77;
+    f->lineno = 142;
+L84: /* NUMBER */
+    tp_aot_op(tp, f, code + 84);
+L87: /* GET */
+    regs[5] = tp_get(tp, regs[3], regs[4]);
+    tp_grey(tp, regs[5]);
+L88: /* STRING */
+    tp_aot_op(tp, f, code + 88);
+L92: /* EQ */
+    if (TP_BOTH(regs[5], regs[4], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[5].nint == regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 92);
+    }
+L93: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L95;
+    }
+L94: /* JUMP */
+    goto L199;
+L95: /* LINE */
+    f->line = code + 95;
+    f->lineno = 143;
+L107: /* NUMBER */
+    tp_aot_op(tp, f, code + 107);
+L110: /* GET */
+    regs[5] = tp_get(tp, regs[3], regs[4]);
+    tp_grey(tp, regs[5]);
+L111: /* GGET */
+    tp_aot_op(tp, f, code + 111);
+L115: /* GGET */
+    tp_aot_op(tp, f, code + 115);
+L119: /* GGET */
+    tp_aot_op(tp, f, code + 119);
+L122: /* LIST */
+    tp_aot_op(tp, f, code + 122);
+L123: /* IN */
+    regs[5] = tp_has(tp, regs[4], regs[5]);
+L124: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L126;
+    }
+L125: /* JUMP */
+    goto L135;
+L126: /* LINE */
+    f->line = code + 126;
+    f->lineno = 144;
+L133: /* LIST */
+    tp_aot_op(tp, f, code + 133);
+L134: /* RETURN */
+    return code + 134;
+L135: /* LINE */
+    f->line = code + 135;
+    f->lineno = 145;
+L143: /* NUMBER */
+    tp_aot_op(tp, f, code + 143);
+L146: /* GET */
+    regs[5] = tp_get(tp, regs[3], regs[4]);
+    tp_grey(tp, regs[5]);
+L147: /* GGET */
+    tp_aot_op(tp, f, code + 147);
+L151: /* IN */
+    regs[5] = tp_has(tp, regs[4], regs[5]);
+L152: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L154;
+    }
+L153: /* JUMP */
+    goto L199;
+L154: /* LINE */
+    f->line = code + 154;
+    f->lineno = 146;
+L166: /* VAR */
+L168: /* GGET */
+    tp_aot_op(tp, f, code + 168);
+L173: /* MOVE */
+    regs[7] = regs[0];
+L174: /* NUMBER */
+    tp_aot_op(tp, f, code + 174);
+L177: /* ADD */
+    if (TP_BOTH(regs[2], regs[0], TP_NUMBER_INT)) {
+        regs[8] = tp_int(regs[2].nint + regs[0].nint);
+    } else {
+        tp_aot_op(tp, f, code + 177);
+    }
+L178: /* CALLP */
+    return code + 178;
+L179: /* LINE */
+    f->line = code + 179;
+    f->lineno = 147;
+L189: /* NUMBER */
+    tp_aot_op(tp, f, code + 189);
+L192: /* ADD */
+    if (TP_BOTH(regs[2], regs[8], TP_NUMBER_INT)) {
+        regs[6] = tp_int(regs[2].nint + regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 192);
+    }
+L193: /* NUMBER */
+    tp_aot_op(tp, f, code + 193);
+L196: /* ADD */
+    if (TP_BOTH(regs[5], regs[8], TP_NUMBER_INT)) {
+        regs[7] = tp_int(regs[5].nint + regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 196);
+    }
+L197: /* LIST */
+    tp_aot_op(tp, f, code + 197);
+L198: /* RETURN */
+    return code + 198;
+L199: /* LINE */
+    f->line = code + 199;
+    f->lineno = 148;
+L205: /* NUMBER */
+    tp_aot_op(tp, f, code + 205);
+L208: /* ADD */
+    if (TP_BOTH(regs[2], regs[7], TP_NUMBER_INT)) {
+        regs[6] = tp_int(regs[2].nint + regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 208);
+    }
+L209: /* LIST */
+    tp_aot_op(tp, f, code + 209);
+L210: /* RETURN */
+    return code + 210;
+L211: /* EOF */
+    return code + 211;
+}
+
+static tpd_code * _tp_tinypy_compiler_peephole_2956(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 14: goto L14;
+        case 17: goto L17;
+        case 20: goto L20;
+        case 24: goto L24;
+        case 27: goto L27;
+        case 29: goto L29;
+        case 38: goto L38;
+        case 39: goto L39;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 53: goto L53;
+        case 56: goto L56;
+        case 57: goto L57;
+        case 62: goto L62;
+        case 65: goto L65;
+        case 66: goto L66;
+        case 73: goto L73;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 78: goto L78;
+        case 79: goto L79;
+        case 80: goto L80;
+        case 87: goto L87;
+        case 89: goto L89;
+        case 92: goto L92;
+        case 94: goto L94;
+        case 95: goto L95;
+        case 107: goto L107;
+        case 110: goto L110;
+        case 111: goto L111;
+        case 112: goto L112;
+        case 113: goto L113;
+        case 114: goto L114;
+        case 115: goto L115;
+        case 116: goto L116;
+        case 117: goto L117;
+        case 118: goto L118;
+        case 125: goto L125;
+        case 126: goto L126;
+        case 133: goto L133;
+        case 136: goto L136;
+        case 137: goto L137;
+        case 144: goto L144;
+        case 146: goto L146;
+        case 147: goto L147;
+        case 155: goto L155;
+        case 159: goto L159;
+        case 160: goto L160;
+        case 161: goto L161;
+        case 162: goto L162;
+        case 163: goto L163;
+        case 164: goto L164;
+        case 171: goto L171;
+        case 174: goto L174;
+        case 175: goto L175;
+        case 183: goto L183;
+        case 187: goto L187;
+        case 188: goto L188;
+        case 189: goto L189;
+        case 190: goto L190;
+        case 191: goto L191;
+        case 192: goto L192;
+        case 199: goto L199;
+        case 200: goto L200;
+        case 213: goto L213;
+        case 217: goto L217;
+        case 219: goto L219;
+        case 224: goto L224;
+        case 225: goto L225;
+        case 226: goto L226;
+        case 227: goto L227;
+        case 228: goto L228;
+        case 229: goto L229;
+        case 230: goto L230;
+        case 236: goto L236;
+        case 239: goto L239;
+        case 240: goto L240;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 150;
+L14: /* VAR */
+L17: /* VAR */
+L20: /* VAR */
+L24: /* VAR */
+L27: /* VAR */
+L29: /* STRING */
+    tp_aot_op(tp, f, code + 29);
+L38: /* FILE */
+    f->fname = regs[5];
+L39: /* STRING */
+    tp_aot_op(tp, f, code + 39);
+L43: /* NAME */
+    f->name = regs[5];
+L44: /* LINE */
+    f->line = code + 44;
+    f->lineno = 153;
+L53: /* VAR */
+L56: /* ADD */
+    if (TP_BOTH(regs[3], regs[2], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[3].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 56);
+    }
+L57: /* LINE */
+    f->line = code + 57;
+    f->lineno = 154;
+L62: /* VAR */
+L65: /* DICT */
+    tp_aot_op(tp, f, code + 65);
+L66: /* LINE */
+    f->line = code + 66;
+    f->lineno = 155;
+L73: /* GGET */
+    tp_aot_op(tp, f, code + 73);
+L76: /* MOVE */
+    regs[7] = regs[5];
+L77: /* CALLP */
+    return code + 77;
+L78: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L80;
+    }
+L79: /* JUMP */
+    goto L230;
+L80: /* LINE */
+    f->line = code + 80;
+    f->lineno = 156;
+L87: /* VAR */
+L89: /* STRING */
+    tp_aot_op(tp, f, code + 89);
+L92: /* METHOD */
+    tp_aot_op(tp, f, code + 92);
+L94: /* CALLM */
+    return code + 94;
+L95: /* LINE */
+    f->line = code + 95;
+    f->lineno = 157;
+L107: /* GGET */
+    tp_aot_op(tp, f, code + 107);
+L110: /* MOVE */
+    regs[9] = regs[0];
+L111: /* CALLP */
+    return code + 111;
+L112: /* GE */
+    if (TP_BOTH(regs[3], regs[7], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[3].nint >= regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 112);
+    }
+L113: /* IFN */
+    if (!(TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6]))) {
+        goto L115;
+    }
+L114: /* JUMP */
+    goto L116;
+L115: /* IN */
+    regs[6] = tp_has(tp, regs[2], regs[3]);
+L116: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L118;
+    }
+L117: /* JUMP */
+    goto L126;
+L118: /* LINE */
+    f->line = code + 118;
+    f->lineno = 158;
+L125: /* JUMP */
+    tp_aot_safepoint(tp, 52);
+    goto L73;
+L126: /* LINE */
+    f->line = code + 126;
+    f->lineno = 159;
+L133: /* NUMBER */
+    tp_aot_op(tp, f, code + 133);
+L136: /* SET */
+    tp_set(tp, regs[2], regs[3], regs[6]);
+L137: /* LINE */
+    f->line = code + 137;
+    f->lineno = 160;
+L144: /* VAR */
+L146: /* GET */
+    regs[6] = tp_get(tp, regs[0], regs[3]);
+    tp_grey(tp, regs[6]);
+L147: /* LINE */
+    f->line = code + 147;
+    f->lineno = 161;
+L155: /* GGET */
+    tp_aot_op(tp, f, code + 155);
+L159: /* MOVE */
+    regs[10] = regs[6];
+L160: /* CALLP */
+    return code + 160;
+L161: /* IN */
+    regs[7] = tp_has(tp, regs[8], regs[4]);
+L162: /* IF */
+    if (TP_IS_INT(regs[7]) ? regs[7].nint != 0 : tp_true(tp, regs[7])) {
+        goto L164;
+    }
+L163: /* JUMP */
+    goto L175;
+L164: /* LINE */
+    f->line = code + 164;
+    f->lineno = 162;
+L171: /* NUMBER */
+    tp_aot_op(tp, f, code + 171);
+L174: /* RETURN */
+    return code + 174;
+L175: /* LINE */
+    f->line = code + 175;
+    f->lineno = 163;
+L183: /* GGET */
+    tp_aot_op(tp, f, code + 183);
+L187: /* MOVE */
+    regs[10] = regs[6];
+L188: /* CALLP */
+    return code + 188;
+L189: /* IN */
+    regs[7] = tp_has(tp, regs[8], regs[4]);
+L190: /* IF */
+    if (TP_IS_INT(regs[7]) ? regs[7].nint != 0 : tp_true(tp, regs[7])) {
+        goto L192;
+    }
+L191: /* JUMP */
+    goto L200;
+L192: /* LINE */
+    f->line = code + 192;
+    f->lineno = 164;
+L199: /* JUMP */
+    tp_aot_safepoint(tp, 126);
+    goto L73;
+L200: /* LINE */
+    f->line = code + 200;
+    f->lineno = 165;
+L213: /* STRING */
+    tp_aot_op(tp, f, code + 213);
+L217: /* METHOD */
+    tp_aot_op(tp, f, code + 217);
+L219: /* GGET */
+    tp_aot_op(tp, f, code + 219);
+L224: /* MOVE */
+    regs[11] = regs[0];
+L225: /* MOVE */
+    regs[12] = regs[1];
+L226: /* MOVE */
+    regs[13] = regs[3];
+L227: /* CALLP */
+    return code + 227;
+L228: /* CALLM */
+    return code + 228;
+L229: /* JUMP */
+    tp_aot_safepoint(tp, 156);
+    goto L73;
+L230: /* LINE */
+    f->line = code + 230;
+    f->lineno = 166;
+L236: /* NUMBER */
+    tp_aot_op(tp, f, code + 236);
+L239: /* RETURN */
+    return code + 239;
+L240: /* EOF */
+    return code + 240;
+}
+
+static tpd_code * _tp_tinypy_compiler_peephole_3222(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 26: goto L26;
+        case 27: goto L27;
+        case 38: goto L38;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 52: goto L52;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 55: goto L55;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 168;
+L8: /* VAR */
+L10: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[2];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L26: /* NAME */
+    f->name = regs[2];
+L27: /* LINE */
+    f->line = code + 27;
+    f->lineno = 169;
+L38: /* NUMBER */
+    tp_aot_op(tp, f, code + 38);
+L41: /* GET */
+    regs[2] = tp_get(tp, regs[0], regs[3]);
+    tp_grey(tp, regs[2]);
+L42: /* STRING */
+    tp_aot_op(tp, f, code + 42);
+L46: /* EQ */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint == regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 46);
+    }
+L47: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L49;
+    }
+L48: /* JUMP */
+    goto L54;
+L49: /* NUMBER */
+    tp_aot_op(tp, f, code + 49);
+L52: /* GET */
+    regs[2] = tp_get(tp, regs[0], regs[3]);
+    tp_grey(tp, regs[2]);
+L53: /* EQ */
+    if (TP_BOTH(regs[2], regs[1], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint == regs[1].nint);
+    } else {
+        tp_aot_op(tp, f, code + 53);
+    }
+L54: /* RETURN */
+    return code + 54;
+L55: /* EOF */
+    return code + 55;
+}
+
+static tpd_code * _tp_tinypy_compiler_peephole_3302(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 34: goto L34;
+        case 37: goto L37;
+        case 40: goto L40;
+        case 44: goto L44;
+        case 46: goto L46;
+        case 49: goto L49;
+        case 57: goto L57;
+        case 60: goto L60;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 65: goto L65;
+        case 72: goto L72;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 80: goto L80;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 104: goto L104;
+        case 107: goto L107;
+        case 108: goto L108;
+        case 112: goto L112;
+        case 113: goto L113;
+        case 114: goto L114;
+        case 115: goto L115;
+        case 119: goto L119;
+        case 123: goto L123;
+        case 124: goto L124;
+        case 125: goto L125;
+        case 126: goto L126;
+        case 130: goto L130;
+        case 134: goto L134;
+        case 135: goto L135;
+        case 136: goto L136;
+        case 137: goto L137;
+        case 144: goto L144;
+        case 145: goto L145;
+        case 156: goto L156;
+        case 161: goto L161;
+        case 162: goto L162;
+        case 165: goto L165;
+        case 166: goto L166;
+        case 167: goto L167;
+        case 168: goto L168;
+        case 169: goto L169;
+        case 176: goto L176;
+        case 177: goto L177;
+        case 192: goto L192;
+        case 195: goto L195;
+        case 196: goto L196;
+        case 197: goto L197;
+        case 198: goto L198;
+        case 199: goto L199;
+        case 200: goto L200;
+        case 201: goto L201;
+        case 204: goto L204;
+        case 205: goto L205;
+        case 208: goto L208;
+        case 209: goto L209;
+        case 210: goto L210;
+        case 211: goto L211;
+        case 219: goto L219;
+        case 221: goto L221;
+        case 222: goto L222;
+        case 242: goto L242;
+        case 246: goto L246;
+        case 249: goto L249;
+        case 250: goto L250;
+        case 251: goto L251;
+        case 252: goto L252;
+        case 256: goto L256;
+        case 259: goto L259;
+        case 260: goto L260;
+        case 261: goto L261;
+        case 262: goto L262;
+        case 265: goto L265;
+        case 266: goto L266;
+        case 270: goto L270;
+        case 271: goto L271;
+        case 272: goto L272;
+        case 273: goto L273;
+        case 283: goto L283;
+        case 287: goto L287;
+        case 288: goto L288;
+        case 289: goto L289;
+        case 298: goto L298;
+        case 301: goto L301;
+        case 307: goto L307;
+        case 310: goto L310;
+        case 311: goto L311;
+        case 312: goto L312;
+        case 318: goto L318;
+        case 319: goto L319;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 171;
+L9: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[1];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L27: /* NAME */
+    f->name = regs[1];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 174;
+L34: /* VAR */
+L37: /* NUMBER */
+    tp_aot_op(tp, f, code + 37);
+L40: /* LINE */
+    f->line = code + 40;
+    f->lineno = 175;
+L44: /* VAR */
+L46: /* NUMBER */
+    tp_aot_op(tp, f, code + 46);
+L49: /* LINE */
+    f->line = code + 49;
+    f->lineno = 176;
+L57: /* GGET */
+    tp_aot_op(tp, f, code + 57);
+L60: /* MOVE */
+    regs[4] = regs[0];
+L61: /* CALLP */
+    return code + 61;
+L62: /* LT */
+    if (TP_BOTH(regs[2], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[2].nint < regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 62);
+    }
+L63: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L65;
+    }
+L64: /* JUMP */
+    goto L312;
+L65: /* LINE */
+    f->line = code + 65;
+    f->lineno = 177;
+L72: /* VAR */
+L74: /* GET */
+    regs[5] = tp_get(tp, regs[0], regs[2]);
+    tp_grey(tp, regs[5]);
+L75: /* LINE */
+    f->line = code + 75;
+    f->lineno = 178;
+L80: /* NUMBER */
+    tp_aot_op(tp, f, code + 80);
+L83: /* ADD */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_int(regs[2].nint + regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 83);
+    }
+L84: /* LINE */
+    f->line = code + 84;
+    f->lineno = 179;
+L104: /* NUMBER */
+    tp_aot_op(tp, f, code + 104);
+L107: /* GET */
+    regs[3] = tp_get(tp, regs[5], regs[4]);
+    tp_grey(tp, regs[3]);
+L108: /* STRING */
+    tp_aot_op(tp, f, code + 108);
+L112: /* EQ */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[3] = tp_bool(regs[3].nint == regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 112);
+    }
+L113: /* IFN */
+    if (!(TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3]))) {
+        goto L115;
+    }
+L114: /* JUMP */
+    goto L124;
+L115: /* GGET */
+    tp_aot_op(tp, f, code + 115);
+L119: /* GGET */
+    tp_aot_op(tp, f, code + 119);
+L123: /* CALLP */
+    return code + 123;
+L124: /* IFN */
+    if (!(TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3]))) {
+        goto L126;
+    }
+L125: /* JUMP */
+    goto L135;
+L126: /* GGET */
+    tp_aot_op(tp, f, code + 126);
+L130: /* GGET */
+    tp_aot_op(tp, f, code + 130);
+L134: /* CALLP */
+    return code + 134;
+L135: /* IFN */
+    if (!(TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3]))) {
+        goto L137;
+    }
+L136: /* JUMP */
+    goto L145;
+L137: /* LINE */
+    f->line = code + 137;
+    f->lineno = 180;
+L144: /* JUMP */
+    tp_aot_safepoint(tp, 87);
+    goto L57;
+L145: /* LINE */
+    f->line = code + 145;
+    f->lineno = 181;
+L156: /* GGET */
+    tp_aot_op(tp, f, code + 156);
+L161: /* MOVE */
+    regs[4] = regs[0];
+L162: /* NUMBER */
+    tp_aot_op(tp, f, code + 162);
+L165: /* SUB */
+    if (TP_BOTH(regs[2], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[2].nint - regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 165);
+    }
+L166: /* CALLP */
+    return code + 166;
+L167: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L169;
+    }
+L168: /* JUMP */
+    goto L177;
+L169: /* LINE */
+    f->line = code + 169;
+    f->lineno = 182;
+L176: /* JUMP */
+    tp_aot_safepoint(tp, 119);
+    goto L57;
+L177: /* LINE */
+    f->line = code + 177;
+    f->lineno = 183;
+L192: /* GGET */
+    tp_aot_op(tp, f, code + 192);
+L195: /* MOVE */
+    regs[5] = regs[0];
+L196: /* CALLP */
+    return code + 196;
+L197: /* LT */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[2].nint < regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 197);
+    }
+L198: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L200;
+    }
+L199: /* JUMP */
+    goto L209;
+L200: /* GET */
+    regs[6] = tp_get(tp, regs[0], regs[2]);
+    tp_grey(tp, regs[6]);
+L201: /* NUMBER */
+    tp_aot_op(tp, f, code + 201);
+L204: /* GET */
+    regs[6] = tp_get(tp, regs[6], regs[3]);
+    tp_grey(tp, regs[6]);
+L205: /* STRING */
+    tp_aot_op(tp, f, code + 205);
+L208: /* NE */
+    if (TP_BOTH(regs[6], regs[3], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[6].nint != regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 208);
+    }
+L209: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L211;
+    }
+L210: /* JUMP */
+    tp_aot_safepoint(tp, 153);
+    goto L57;
+L211: /* LINE */
+    f->line = code + 211;
+    f->lineno = 184;
+L219: /* VAR */
+L221: /* GET */
+    regs[6] = tp_get(tp, regs[0], regs[2]);
+    tp_grey(tp, regs[6]);
+L222: /* LINE */
+    f->line = code + 222;
+    f->lineno = 185;
+L242: /* GGET */
+    tp_aot_op(tp, f, code + 242);
+L246: /* GGET */
+    tp_aot_op(tp, f, code + 246);
+L249: /* CALLP */
+    return code + 249;
+L250: /* IFN */
+    if (!(TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4]))) {
+        goto L252;
+    }
+L251: /* JUMP */
+    goto L260;
+L252: /* GGET */
+    tp_aot_op(tp, f, code + 252);
+L256: /* GGET */
+    tp_aot_op(tp, f, code + 256);
+L259: /* CALLP */
+    return code + 259;
+L260: /* IFN */
+    if (!(TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4]))) {
+        goto L262;
+    }
+L261: /* JUMP */
+    goto L271;
+L262: /* NUMBER */
+    tp_aot_op(tp, f, code + 262);
+L265: /* GET */
+    regs[4] = tp_get(tp, regs[6], regs[5]);
+    tp_grey(tp, regs[4]);
+L266: /* STRING */
+    tp_aot_op(tp, f, code + 266);
+L270: /* EQ */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[4].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 270);
+    }
+L271: /* IFN */
+    if (!(TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4]))) {
+        goto L273;
+    }
+L272: /* JUMP */
+    goto L301;
+L273: /* LINE */
+    f->line = code + 273;
+    f->lineno = 186;
+L283: /* STRING */
+    tp_aot_op(tp, f, code + 283);
+L287: /* LIST */
+    tp_aot_op(tp, f, code + 287);
+L288: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[3]);
+L289: /* LINE */
+    f->line = code + 289;
+    f->lineno = 187;
+L298: /* NUMBER */
+    tp_aot_op(tp, f, code + 298);
+L301: /* LINE */
+    f->line = code + 301;
+    f->lineno = 188;
+L307: /* NUMBER */
+    tp_aot_op(tp, f, code + 307);
+L310: /* ADD */
+    if (TP_BOTH(regs[2], regs[4], TP_NUMBER_INT)) {
+        regs[2] = tp_int(regs[2].nint + regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 310);
+    }
+L311: /* JUMP */
+    tp_aot_safepoint(tp, 119);
+    goto L192;
+L312: /* LINE */
+    f->line = code + 312;
+    f->lineno = 189;
+L318: /* RETURN */
+    return code + 318;
+L319: /* EOF */
+    return code + 319;
+}
+
+static tpd_code * _tp_tinypy_compiler_peephole_3647(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 33: goto L33;
+        case 36: goto L36;
+        case 37: goto L37;
+        case 38: goto L38;
+        case 44: goto L44;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 51: goto L51;
+        case 52: goto L52;
+        case 65: goto L65;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 73: goto L73;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 79: goto L79;
+        case 80: goto L80;
+        case 84: goto L84;
+        case 85: goto L85;
+        case 86: goto L86;
+        case 87: goto L87;
+        case 96: goto L96;
+        case 99: goto L99;
+        case 102: goto L102;
+        case 103: goto L103;
+        case 104: goto L104;
+        case 105: goto L105;
+        case 111: goto L111;
+        case 114: goto L114;
+        case 117: goto L117;
+        case 118: goto L118;
+        case 127: goto L127;
+        case 131: goto L131;
+        case 134: goto L134;
+        case 135: goto L135;
+        case 136: goto L136;
+        case 137: goto L137;
+        case 138: goto L138;
+        case 139: goto L139;
+        case 141: goto L141;
+        case 142: goto L142;
+        case 159: goto L159;
+        case 160: goto L160;
+        case 163: goto L163;
+        case 164: goto L164;
+        case 167: goto L167;
+        case 168: goto L168;
+        case 169: goto L169;
+        case 170: goto L170;
+        case 171: goto L171;
+        case 174: goto L174;
+        case 175: goto L175;
+        case 176: goto L176;
+        case 177: goto L177;
+        case 178: goto L178;
+        case 187: goto L187;
+        case 191: goto L191;
+        case 192: goto L192;
+        case 193: goto L193;
+        case 201: goto L201;
+        case 204: goto L204;
+        case 205: goto L205;
+        case 206: goto L206;
+        case 212: goto L212;
+        case 213: goto L213;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 191;
+L9: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[1];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L27: /* NAME */
+    f->name = regs[1];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 192;
+L33: /* VAR */
+L36: /* DICT */
+    tp_aot_op(tp, f, code + 36);
+L37: /* MOVE */
+    regs[1] = regs[2];
+L38: /* LINE */
+    f->line = code + 38;
+    f->lineno = 193;
+L44: /* NUMBER */
+    tp_aot_op(tp, f, code + 44);
+L47: /* ITER */
+    if (tp_iter_next(tp, &regs[2], regs[0], &regs[3])) {
+        goto L49;
+    }
+L48: /* JUMP */
+    goto L105;
+L49: /* VAR */
+L51: /* MOVE */
+    regs[4] = regs[2];
+L52: /* LINE */
+    f->line = code + 52;
+    f->lineno = 194;
+L65: /* NUMBER */
+    tp_aot_op(tp, f, code + 65);
+L68: /* GET */
+    regs[2] = tp_get(tp, regs[4], regs[5]);
+    tp_grey(tp, regs[2]);
+L69: /* STRING */
+    tp_aot_op(tp, f, code + 69);
+L73: /* EQ */
+    if (TP_BOTH(regs[2], regs[5], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 73);
+    }
+L74: /* IFN */
+    if (!(TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2]))) {
+        goto L76;
+    }
+L75: /* JUMP */
+    goto L85;
+L76: /* NUMBER */
+    tp_aot_op(tp, f, code + 76);
+L79: /* GET */
+    regs[2] = tp_get(tp, regs[4], regs[5]);
+    tp_grey(tp, regs[2]);
+L80: /* STRING */
+    tp_aot_op(tp, f, code + 80);
+L84: /* EQ */
+    if (TP_BOTH(regs[2], regs[5], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 84);
+    }
+L85: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L87;
+    }
+L86: /* JUMP */
+    tp_aot_safepoint(tp, 39);
+    goto L47;
+L87: /* LINE */
+    f->line = code + 87;
+    f->lineno = 195;
+L96: /* NUMBER */
+    tp_aot_op(tp, f, code + 96);
+L99: /* NUMBER */
+    tp_aot_op(tp, f, code + 99);
+L102: /* GET */
+    regs[5] = tp_get(tp, regs[4], regs[6]);
+    tp_grey(tp, regs[5]);
+L103: /* SET */
+    tp_set(tp, regs[1], regs[5], regs[2]);
+L104: /* JUMP */
+    tp_aot_safepoint(tp, 57);
+    goto L47;
+L105: /* LINE */
+    f->line = code + 105;
+    f->lineno = 196;
+L111: /* VAR */
+L114: /* NUMBER */
+    tp_aot_op(tp, f, code + 114);
+L117: /* MOVE */
+    regs[2] = regs[3];
+L118: /* LINE */
+    f->line = code + 118;
+    f->lineno = 197;
+L127: /* GGET */
+    tp_aot_op(tp, f, code + 127);
+L131: /* GGET */
+    tp_aot_op(tp, f, code + 131);
+L134: /* MOVE */
+    regs[5] = regs[0];
+L135: /* CALLP */
+    return code + 135;
+L136: /* RANGE */
+    tp_aot_op(tp, f, code + 136);
+L137: /* FOR */
+    if (regs[6].type.typeid == TP_NUMBER) {
+        if (regs[7].nint > 0 ? regs[5].nint < regs[6].nint : regs[5].nint > regs[6].nint) {
+            regs[3] = regs[5];
+            regs[5].nint += regs[7].nint;
+            goto L139;
+        }
+    } else if (tp_iter_next(tp, &regs[3], regs[5], &regs[7])) {
+        goto L139;
+    }
+L138: /* JUMP */
+    goto L206;
+L139: /* VAR */
+L141: /* MOVE */
+    regs[8] = regs[3];
+L142: /* LINE */
+    f->line = code + 142;
+    f->lineno = 198;
+L159: /* GET */
+    regs[3] = tp_get(tp, regs[0], regs[8]);
+    tp_grey(tp, regs[3]);
+L160: /* NUMBER */
+    tp_aot_op(tp, f, code + 160);
+L163: /* GET */
+    regs[3] = tp_get(tp, regs[3], regs[9]);
+    tp_grey(tp, regs[3]);
+L164: /* STRING */
+    tp_aot_op(tp, f, code + 164);
+L167: /* EQ */
+    if (TP_BOTH(regs[3], regs[9], TP_NUMBER_INT)) {
+        regs[3] = tp_bool(regs[3].nint == regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 167);
+    }
+L168: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L170;
+    }
+L169: /* JUMP */
+    goto L176;
+L170: /* GET */
+    regs[3] = tp_get(tp, regs[0], regs[8]);
+    tp_grey(tp, regs[3]);
+L171: /* NUMBER */
+    tp_aot_op(tp, f, code + 171);
+L174: /* GET */
+    regs[3] = tp_get(tp, regs[3], regs[9]);
+    tp_grey(tp, regs[3]);
+L175: /* NOTIN */
+    regs[3] = tp_bool(!tp_true(tp, tp_has(tp, regs[1], regs[3])));
+L176: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L178;
+    }
+L177: /* JUMP */
+    tp_aot_safepoint(tp, 40);
+    goto L137;
+L178: /* LINE */
+    f->line = code + 178;
+    f->lineno = 199;
+L187: /* STRING */
+    tp_aot_op(tp, f, code + 187);
+L191: /* LIST */
+    tp_aot_op(tp, f, code + 191);
+L192: /* SET */
+    tp_set(tp, regs[0], regs[8], regs[3]);
+L193: /* LINE */
+    f->line = code + 193;
+    f->lineno = 200;
+L201: /* NUMBER */
+    tp_aot_op(tp, f, code + 201);
+L204: /* MOVE */
+    regs[2] = regs[3];
+L205: /* JUMP */
+    tp_aot_safepoint(tp, 68);
+    goto L137;
+L206: /* LINE */
+    f->line = code + 206;
+    f->lineno = 201;
+L212: /* RETURN */
+    return code + 212;
+L213: /* EOF */
+    return code + 213;
+}
+
+static tpd_code * _tp_tinypy_compiler_peephole_3892(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 11: goto L11;
+        case 14: goto L14;
+        case 17: goto L17;
+        case 26: goto L26;
+        case 27: goto L27;
+        case 33: goto L33;
+        case 34: goto L34;
+        case 40: goto L40;
+        case 43: goto L43;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 56: goto L56;
+        case 60: goto L60;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 65: goto L65;
+        case 66: goto L66;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 78: goto L78;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 89: goto L89;
+        case 92: goto L92;
+        case 93: goto L93;
+        case 97: goto L97;
+        case 98: goto L98;
+        case 99: goto L99;
+        case 100: goto L100;
+        case 107: goto L107;
+        case 108: goto L108;
+        case 114: goto L114;
+        case 117: goto L117;
+        case 118: goto L118;
+        case 130: goto L130;
+        case 132: goto L132;
+        case 137: goto L137;
+        case 138: goto L138;
+        case 141: goto L141;
+        case 142: goto L142;
+        case 143: goto L143;
+        case 144: goto L144;
+        case 164: goto L164;
+        case 167: goto L167;
+        case 168: goto L168;
+        case 169: goto L169;
+        case 170: goto L170;
+        case 171: goto L171;
+        case 172: goto L172;
+        case 173: goto L173;
+        case 176: goto L176;
+        case 177: goto L177;
+        case 181: goto L181;
+        case 182: goto L182;
+        case 183: goto L183;
+        case 184: goto L184;
+        case 185: goto L185;
+        case 186: goto L186;
+        case 187: goto L187;
+        case 195: goto L195;
+        case 198: goto L198;
+        case 199: goto L199;
+        case 209: goto L209;
+        case 210: goto L210;
+        case 213: goto L213;
+        case 214: goto L214;
+        case 217: goto L217;
+        case 218: goto L218;
+        case 219: goto L219;
+        case 220: goto L220;
+        case 221: goto L221;
+        case 228: goto L228;
+        case 229: goto L229;
+        case 238: goto L238;
+        case 239: goto L239;
+        case 242: goto L242;
+        case 243: goto L243;
+        case 246: goto L246;
+        case 247: goto L247;
+        case 255: goto L255;
+        case 258: goto L258;
+        case 271: goto L271;
+        case 276: goto L276;
+        case 277: goto L277;
+        case 280: goto L280;
+        case 281: goto L281;
+        case 282: goto L282;
+        case 283: goto L283;
+        case 284: goto L284;
+        case 308: goto L308;
+        case 313: goto L313;
+        case 314: goto L314;
+        case 317: goto L317;
+        case 318: goto L318;
+        case 319: goto L319;
+        case 320: goto L320;
+        case 321: goto L321;
+        case 322: goto L322;
+        case 325: goto L325;
+        case 326: goto L326;
+        case 327: goto L327;
+        case 328: goto L328;
+        case 329: goto L329;
+        case 330: goto L330;
+        case 335: goto L335;
+        case 336: goto L336;
+        case 337: goto L337;
+        case 338: goto L338;
+        case 339: goto L339;
+        case 340: goto L340;
+        case 341: goto L341;
+        case 350: goto L350;
+        case 354: goto L354;
+        case 355: goto L355;
+        case 356: goto L356;
+        case 364: goto L364;
+        case 367: goto L367;
+        case 368: goto L368;
+        case 374: goto L374;
+        case 375: goto L375;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 203;
+L11: /* VAR */
+L14: /* VAR */
+L17: /* STRING */
+    tp_aot_op(tp, f, code + 17);
+L26: /* FILE */
+    f->fname = regs[2];
+L27: /* STRING */
+    tp_aot_op(tp, f, code + 27);
+L33: /* NAME */
+    f->name = regs[2];
+L34: /* LINE */
+    f->line = code + 34;
+    f->lineno = 204;
+L40: /* VAR */
+L43: /* NUMBER */
+    tp_aot_op(tp, f, code + 43);
+L46: /* MOVE */
+    regs[2] = regs[3];
+L47: /* LINE */
+    f->line = code + 47;
+    f->lineno = 205;
+L56: /* GGET */
+    tp_aot_op(tp, f, code + 56);
+L60: /* GGET */
+    tp_aot_op(tp, f, code + 60);
+L63: /* MOVE */
+    regs[7] = regs[0];
+L64: /* CALLP */
+    return code + 64;
+L65: /* RANGE */
+    tp_aot_op(tp, f, code + 65);
+L66: /* FOR */
+    if (regs[9].type.typeid == TP_NUMBER) {
+        if (regs[10].nint > 0 ? regs[8].nint < regs[9].nint : regs[8].nint > regs[9].nint) {
+            regs[3] = regs[8];
+            regs[8].nint += regs[10].nint;
+            goto L68;
+        }
+    } else if (tp_iter_next(tp, &regs[3], regs[8], &regs[10])) {
+        goto L68;
+    }
+L67: /* JUMP */
+    goto L368;
+L68: /* VAR */
+L70: /* MOVE */
+    regs[4] = regs[3];
+L71: /* LINE */
+    f->line = code + 71;
+    f->lineno = 206;
+L78: /* VAR */
+L80: /* GET */
+    regs[3] = tp_get(tp, regs[0], regs[4]);
+    tp_grey(tp, regs[3]);
+L81: /* LINE */
+    f->line = code + 81;
+    f->lineno = 207;
+L89: /* NUMBER */
+    tp_aot_op(tp, f, code + 89);
+L92: /* GET */
+    regs[5] = tp_get(tp, regs[3], regs[6]);
+    tp_grey(tp, regs[5]);
+L93: /* STRING */
+    tp_aot_op(tp, f, code + 93);
+L97: /* NE */
+    if (TP_BOTH(regs[5], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[5].nint != regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 97);
+    }
+L98: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L100;
+    }
+L99: /* JUMP */
+    goto L108;
+L100: /* LINE */
+    f->line = code + 100;
+    f->lineno = 208;
+L107: /* JUMP */
+    tp_aot_safepoint(tp, 41);
+    goto L66;
+L108: /* LINE */
+    f->line = code + 108;
+    f->lineno = 210;
+L114: /* VAR */
+L117: /* DICT */
+    tp_aot_op(tp, f, code + 117);
+L118: /* LINE */
+    f->line = code + 118;
+    f->lineno = 211;
+L130: /* VAR */
+L132: /* GGET */
+    tp_aot_op(tp, f, code + 132);
+L137: /* MOVE */
+    regs[12] = regs[0];
+L138: /* NUMBER */
+    tp_aot_op(tp, f, code + 138);
+L141: /* GET */
+    regs[14] = tp_get(tp, regs[3], regs[7]);
+    tp_grey(tp, regs[14]);
+L142: /* GET */
+    regs[13] = tp_get(tp, regs[1], regs[14]);
+    tp_grey(tp, regs[13]);
+L143: /* CALLP */
+    return code + 143;
+L144: /* LINE */
+    f->line = code + 144;
+    f->lineno = 212;
+L164: /* GGET */
+    tp_aot_op(tp, f, code + 164);
+L167: /* MOVE */
+    regs[13] = regs[0];
+L168: /* CALLP */
+    return code + 168;
+L169: /* LT */
+    if (TP_BOTH(regs[6], regs[11], TP_NUMBER_INT)) {
+        regs[7] = tp_bool(regs[6].nint < regs[11].nint);
+    } else {
+        tp_aot_op(tp, f, code + 169);
+    }
+L170: /* IF */
+    if (TP_IS_INT(regs[7]) ? regs[7].nint != 0 : tp_true(tp, regs[7])) {
+        goto L172;
+    }
+L171: /* JUMP */
+    goto L182;
+L172: /* GET */
+    regs[7] = tp_get(tp, regs[0], regs[6]);
+    tp_grey(tp, regs[7]);
+L173: /* NUMBER */
+    tp_aot_op(tp, f, code + 173);
+L176: /* GET */
+    regs[7] = tp_get(tp, regs[7], regs[11]);
+    tp_grey(tp, regs[7]);
+L177: /* STRING */
+    tp_aot_op(tp, f, code + 177);
+L181: /* EQ */
+    if (TP_BOTH(regs[7], regs[11], TP_NUMBER_INT)) {
+        regs[7] = tp_bool(regs[7].nint == regs[11].nint);
+    } else {
+        tp_aot_op(tp, f, code + 181);
+    }
+L182: /* IF */
+    if (TP_IS_INT(regs[7]) ? regs[7].nint != 0 : tp_true(tp, regs[7])) {
+        goto L184;
+    }
+L183: /* JUMP */
+    goto L185;
+L184: /* NOTIN */
+    regs[7] = tp_bool(!tp_true(tp, tp_has(tp, regs[5], regs[6])));
+L185: /* IF */
+    if (TP_IS_INT(regs[7]) ? regs[7].nint != 0 : tp_true(tp, regs[7])) {
+        goto L187;
+    }
+L186: /* JUMP */
+    goto L284;
+L187: /* LINE */
+    f->line = code + 187;
+    f->lineno = 213;
+L195: /* NUMBER */
+    tp_aot_op(tp, f, code + 195);
+L198: /* SET */
+    tp_set(tp, regs[5], regs[6], regs[7]);
+L199: /* LINE */
+    f->line = code + 199;
+    f->lineno = 214;
+L209: /* GET */
+    regs[7] = tp_get(tp, regs[0], regs[6]);
+    tp_grey(tp, regs[7]);
+L210: /* NUMBER */
+    tp_aot_op(tp, f, code + 210);
+L213: /* GET */
+    regs[7] = tp_get(tp, regs[7], regs[11]);
+    tp_grey(tp, regs[7]);
+L214: /* NUMBER */
+    tp_aot_op(tp, f, code + 214);
+L217: /* GET */
+    regs[11] = tp_get(tp, regs[3], regs[12]);
+    tp_grey(tp, regs[11]);
+L218: /* EQ */
+    if (TP_BOTH(regs[7], regs[11], TP_NUMBER_INT)) {
+        regs[7] = tp_bool(regs[7].nint == regs[11].nint);
+    } else {
+        tp_aot_op(tp, f, code + 218);
+    }
+L219: /* IF */
+    if (TP_IS_INT(regs[7]) ? regs[7].nint != 0 : tp_true(tp, regs[7])) {
+        goto L221;
+    }
+L220: /* JUMP */
+    goto L229;
+L221: /* LINE */
+    f->line = code + 221;
+    f->lineno = 215;
+L228: /* JUMP */
+    goto L284;
+L229: /* LINE */
+    f->line = code + 229;
+    f->lineno = 216;
+L238: /* GET */
+    regs[7] = tp_get(tp, regs[0], regs[6]);
+    tp_grey(tp, regs[7]);
+L239: /* NUMBER */
+    tp_aot_op(tp, f, code + 239);
+L242: /* GET */
+    regs[7] = tp_get(tp, regs[7], regs[11]);
+    tp_grey(tp, regs[7]);
+L243: /* NUMBER */
+    tp_aot_op(tp, f, code + 243);
+L246: /* SET */
+    tp_set(tp, regs[3], regs[11], regs[7]);
+L247: /* LINE */
+    f->line = code + 247;
+    f->lineno = 217;
+L255: /* NUMBER */
+    tp_aot_op(tp, f, code + 255);
+L258: /* LINE */
+    f->line = code + 258;
+    f->lineno = 218;
+L271: /* GGET */
+    tp_aot_op(tp, f, code + 271);
+L276: /* MOVE */
+    regs[12] = regs[0];
+L277: /* NUMBER */
+    tp_aot_op(tp, f, code + 277);
+L280: /* GET */
+    regs[14] = tp_get(tp, regs[3], regs[7]);
+    tp_grey(tp, regs[14]);
+L281: /* GET */
+    regs[13] = tp_get(tp, regs[1], regs[14]);
+    tp_grey(tp, regs[13]);
+L282: /* CALLP */
+    return code + 282;
+L283: /* JUMP */
+    tp_aot_safepoint(tp, 119);
+    goto L164;
+L284: /* LINE */
+    f->line = code + 284;
+    f->lineno = 220;
+L308: /* GGET */
+    tp_aot_op(tp, f, code + 308);
+L313: /* MOVE */
+    regs[13] = regs[0];
+L314: /* NUMBER */
+    tp_aot_op(tp, f, code + 314);
+L317: /* ADD */
+    if (TP_BOTH(regs[4], regs[7], TP_NUMBER_INT)) {
+        regs[14] = tp_int(regs[4].nint + regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 317);
+    }
+L318: /* CALLP */
+    return code + 318;
+L319: /* EQ */
+    if (TP_BOTH(regs[6], regs[11], TP_NUMBER_INT)) {
+        regs[7] = tp_bool(regs[6].nint == regs[11].nint);
+    } else {
+        tp_aot_op(tp, f, code + 319);
+    }
+L320: /* IF */
+    if (TP_IS_INT(regs[7]) ? regs[7].nint != 0 : tp_true(tp, regs[7])) {
+        goto L322;
+    }
+L321: /* JUMP */
+    goto L328;
+L322: /* NUMBER */
+    tp_aot_op(tp, f, code + 322);
+L325: /* GET */
+    regs[11] = tp_get(tp, regs[3], regs[12]);
+    tp_grey(tp, regs[11]);
+L326: /* GET */
+    regs[7] = tp_get(tp, regs[1], regs[11]);
+    tp_grey(tp, regs[7]);
+L327: /* GT */
+    if (TP_BOTH(regs[7], regs[4], TP_NUMBER_INT)) {
+        regs[7] = tp_bool(regs[7].nint > regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 327);
+    }
+L328: /* IF */
+    if (TP_IS_INT(regs[7]) ? regs[7].nint != 0 : tp_true(tp, regs[7])) {
+        goto L330;
+    }
+L329: /* JUMP */
+    goto L339;
+L330: /* GGET */
+    tp_aot_op(tp, f, code + 330);
+L335: /* MOVE */
+    regs[13] = regs[0];
+L336: /* MOVE */
+    regs[14] = regs[4];
+L337: /* CALLP */
+    return code + 337;
+L338: /* NOT */
+    regs[7] = tp_bool(!tp_true(tp, regs[11]));
+L339: /* IF */
+    if (TP_IS_INT(regs[7]) ? regs[7].nint != 0 : tp_true(tp, regs[7])) {
+        goto L341;
+    }
+L340: /* JUMP */
+    tp_aot_safepoint(tp, 274);
+    goto L66;
+L341: /* LINE */
+    f->line = code + 341;
+    f->lineno = 221;
+L350: /* STRING */
+    tp_aot_op(tp, f, code + 350);
+L354: /* LIST */
+    tp_aot_op(tp, f, code + 354);
+L355: /* SET */
+    tp_set(tp, regs[0], regs[4], regs[7]);
+L356: /* LINE */
+    f->line = code + 356;
+    f->lineno = 222;
+L364: /* NUMBER */
+    tp_aot_op(tp, f, code + 364);
+L367: /* JUMP */
+    tp_aot_safepoint(tp, 301);
+    goto L66;
+L368: /* LINE */
+    f->line = code + 368;
+    f->lineno = 223;
+L374: /* RETURN */
+    return code + 374;
+L375: /* EOF */
+    return code + 375;
+}
+
+static tpd_code * _tp_tinypy_compiler_peephole_4306(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 12: goto L12;
+        case 15: goto L15;
+        case 18: goto L18;
+        case 22: goto L22;
+        case 31: goto L31;
+        case 32: goto L32;
+        case 36: goto L36;
+        case 37: goto L37;
+        case 43: goto L43;
+        case 46: goto L46;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 60: goto L60;
+        case 64: goto L64;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 72: goto L72;
+        case 73: goto L73;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 78: goto L78;
+        case 79: goto L79;
+        case 86: goto L86;
+        case 88: goto L88;
+        case 89: goto L89;
+        case 103: goto L103;
+        case 106: goto L106;
+        case 107: goto L107;
+        case 111: goto L111;
+        case 112: goto L112;
+        case 113: goto L113;
+        case 114: goto L114;
+        case 119: goto L119;
+        case 120: goto L120;
+        case 121: goto L121;
+        case 122: goto L122;
+        case 123: goto L123;
+        case 124: goto L124;
+        case 131: goto L131;
+        case 132: goto L132;
+        case 138: goto L138;
+        case 140: goto L140;
+        case 143: goto L143;
+        case 144: goto L144;
+        case 159: goto L159;
+        case 163: goto L163;
+        case 164: goto L164;
+        case 165: goto L165;
+        case 166: goto L166;
+        case 170: goto L170;
+        case 171: goto L171;
+        case 172: goto L172;
+        case 173: goto L173;
+        case 176: goto L176;
+        case 177: goto L177;
+        case 180: goto L180;
+        case 181: goto L181;
+        case 182: goto L182;
+        case 183: goto L183;
+        case 184: goto L184;
+        case 193: goto L193;
+        case 197: goto L197;
+        case 198: goto L198;
+        case 199: goto L199;
+        case 207: goto L207;
+        case 210: goto L210;
+        case 217: goto L217;
+        case 218: goto L218;
+        case 224: goto L224;
+        case 226: goto L226;
+        case 229: goto L229;
+        case 230: goto L230;
+        case 246: goto L246;
+        case 249: goto L249;
+        case 250: goto L250;
+        case 251: goto L251;
+        case 252: goto L252;
+        case 253: goto L253;
+        case 254: goto L254;
+        case 258: goto L258;
+        case 259: goto L259;
+        case 262: goto L262;
+        case 263: goto L263;
+        case 264: goto L264;
+        case 265: goto L265;
+        case 271: goto L271;
+        case 274: goto L274;
+        case 275: goto L275;
+        case 276: goto L276;
+        case 291: goto L291;
+        case 294: goto L294;
+        case 295: goto L295;
+        case 296: goto L296;
+        case 297: goto L297;
+        case 298: goto L298;
+        case 299: goto L299;
+        case 300: goto L300;
+        case 303: goto L303;
+        case 304: goto L304;
+        case 308: goto L308;
+        case 309: goto L309;
+        case 310: goto L310;
+        case 311: goto L311;
+        case 318: goto L318;
+        case 319: goto L319;
+        case 326: goto L326;
+        case 328: goto L328;
+        case 329: goto L329;
+        case 335: goto L335;
+        case 337: goto L337;
+        case 340: goto L340;
+        case 341: goto L341;
+        case 363: goto L363;
+        case 366: goto L366;
+        case 367: goto L367;
+        case 368: goto L368;
+        case 369: goto L369;
+        case 372: goto L372;
+        case 373: goto L373;
+        case 376: goto L376;
+        case 377: goto L377;
+        case 378: goto L378;
+        case 379: goto L379;
+        case 382: goto L382;
+        case 383: goto L383;
+        case 386: goto L386;
+        case 387: goto L387;
+        case 388: goto L388;
+        case 389: goto L389;
+        case 392: goto L392;
+        case 393: goto L393;
+        case 394: goto L394;
+        case 395: goto L395;
+        case 396: goto L396;
+        case 399: goto L399;
+        case 400: goto L400;
+        case 401: goto L401;
+        case 402: goto L402;
+        case 403: goto L403;
+        case 424: goto L424;
+        case 428: goto L428;
+        case 429: goto L429;
+        case 430: goto L430;
+        case 431: goto L431;
+        case 436: goto L436;
+        case 437: goto L437;
+        case 438: goto L438;
+        case 439: goto L439;
+        case 440: goto L440;
+        case 441: goto L441;
+        case 442: goto L442;
+        case 443: goto L443;
+        case 444: goto L444;
+        case 456: goto L456;
+        case 459: goto L459;
+        case 460: goto L460;
+        case 463: goto L463;
+        case 464: goto L464;
+        case 465: goto L465;
+        case 466: goto L466;
+        case 469: goto L469;
+        case 472: goto L472;
+        case 473: goto L473;
+        case 474: goto L474;
+        case 483: goto L483;
+        case 486: goto L486;
+        case 489: goto L489;
+        case 490: goto L490;
+        case 498: goto L498;
+        case 501: goto L501;
+        case 502: goto L502;
+        case 505: goto L505;
+        case 506: goto L506;
+        case 516: goto L516;
+        case 520: goto L520;
+        case 521: goto L521;
+        case 522: goto L522;
+        case 531: goto L531;
+        case 534: goto L534;
+        case 541: goto L541;
+        case 542: goto L542;
+        case 561: goto L561;
+        case 566: goto L566;
+        case 567: goto L567;
+        case 568: goto L568;
+        case 569: goto L569;
+        case 572: goto L572;
+        case 573: goto L573;
+        case 577: goto L577;
+        case 578: goto L578;
+        case 579: goto L579;
+        case 580: goto L580;
+        case 583: goto L583;
+        case 584: goto L584;
+        case 585: goto L585;
+        case 586: goto L586;
+        case 587: goto L587;
+        case 590: goto L590;
+        case 591: goto L591;
+        case 592: goto L592;
+        case 593: goto L593;
+        case 594: goto L594;
+        case 615: goto L615;
+        case 619: goto L619;
+        case 620: goto L620;
+        case 621: goto L621;
+        case 622: goto L622;
+        case 627: goto L627;
+        case 628: goto L628;
+        case 629: goto L629;
+        case 630: goto L630;
+        case 631: goto L631;
+        case 632: goto L632;
+        case 633: goto L633;
+        case 634: goto L634;
+        case 635: goto L635;
+        case 643: goto L643;
+        case 646: goto L646;
+        case 647: goto L647;
+        case 650: goto L650;
+        case 651: goto L651;
+        case 662: goto L662;
+        case 666: goto L666;
+        case 667: goto L667;
+        case 668: goto L668;
+        case 677: goto L677;
+        case 680: goto L680;
+        case 681: goto L681;
+        case 687: goto L687;
+        case 688: goto L688;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 225;
+L12: /* VAR */
+L15: /* VAR */
+L18: /* VAR */
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L31: /* FILE */
+    f->fname = regs[3];
+L32: /* STRING */
+    tp_aot_op(tp, f, code + 32);
+L36: /* NAME */
+    f->name = regs[3];
+L37: /* LINE */
+    f->line = code + 37;
+    f->lineno = 226;
+L43: /* VAR */
+L46: /* NUMBER */
+    tp_aot_op(tp, f, code + 46);
+L49: /* MOVE */
+    regs[3] = regs[4];
+L50: /* LINE */
+    f->line = code + 50;
+    f->lineno = 227;
+L60: /* GGET */
+    tp_aot_op(tp, f, code + 60);
+L64: /* GGET */
+    tp_aot_op(tp, f, code + 64);
+L67: /* MOVE */
+    regs[8] = regs[0];
+L68: /* CALLP */
+    return code + 68;
+L69: /* NUMBER */
+    tp_aot_op(tp, f, code + 69);
+L72: /* SUB */
+    if (TP_BOTH(regs[6], regs[7], TP_NUMBER_INT)) {
+        regs[6] = tp_int(regs[6].nint - regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 72);
+    }
+L73: /* RANGE */
+    tp_aot_op(tp, f, code + 73);
+L74: /* FOR */
+    if (regs[13].type.typeid == TP_NUMBER) {
+        if (regs[14].nint > 0 ? regs[12].nint < regs[13].nint : regs[12].nint > regs[13].nint) {
+            regs[4] = regs[12];
+            regs[12].nint += regs[14].nint;
+            goto L76;
+        }
+    } else if (tp_iter_next(tp, &regs[4], regs[12], &regs[14])) {
+        goto L76;
+    }
+L75: /* JUMP */
+    goto L681;
+L76: /* VAR */
+L78: /* MOVE */
+    regs[5] = regs[4];
+L79: /* LINE */
+    f->line = code + 79;
+    f->lineno = 228;
+L86: /* VAR */
+L88: /* GET */
+    regs[4] = tp_get(tp, regs[0], regs[5]);
+    tp_grey(tp, regs[4]);
+L89: /* LINE */
+    f->line = code + 89;
+    f->lineno = 229;
+L103: /* NUMBER */
+    tp_aot_op(tp, f, code + 103);
+L106: /* GET */
+    regs[6] = tp_get(tp, regs[4], regs[7]);
+    tp_grey(tp, regs[6]);
+L107: /* STRING */
+    tp_aot_op(tp, f, code + 107);
+L111: /* NE */
+    if (TP_BOTH(regs[6], regs[7], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[6].nint != regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 111);
+    }
+L112: /* IFN */
+    if (!(TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6]))) {
+        goto L114;
+    }
+L113: /* JUMP */
+    goto L122;
+L114: /* GGET */
+    tp_aot_op(tp, f, code + 114);
+L119: /* MOVE */
+    regs[8] = regs[0];
+L120: /* MOVE */
+    regs[9] = regs[5];
+L121: /* CALLP */
+    return code + 121;
+L122: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L124;
+    }
+L123: /* JUMP */
+    goto L132;
+L124: /* LINE */
+    f->line = code + 124;
+    f->lineno = 230;
+L131: /* JUMP */
+    tp_aot_safepoint(tp, 57);
+    goto L74;
+L132: /* LINE */
+    f->line = code + 132;
+    f->lineno = 231;
+L138: /* VAR */
+L140: /* NUMBER */
+    tp_aot_op(tp, f, code + 140);
+L143: /* GET */
+    regs[6] = tp_get(tp, regs[4], regs[8]);
+    tp_grey(tp, regs[6]);
+L144: /* LINE */
+    f->line = code + 144;
+    f->lineno = 232;
+L159: /* GGET */
+    tp_aot_op(tp, f, code + 159);
+L163: /* EQ */
+    if (TP_BOTH(regs[6], regs[8], TP_NUMBER_INT)) {
+        regs[7] = tp_bool(regs[6].nint == regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 163);
+    }
+L164: /* IFN */
+    if (!(TP_IS_INT(regs[7]) ? regs[7].nint != 0 : tp_true(tp, regs[7]))) {
+        goto L166;
+    }
+L165: /* JUMP */
+    goto L182;
+L166: /* GGET */
+    tp_aot_op(tp, f, code + 166);
+L170: /* EQ */
+    if (TP_BOTH(regs[6], regs[8], TP_NUMBER_INT)) {
+        regs[7] = tp_bool(regs[6].nint == regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 170);
+    }
+L171: /* IF */
+    if (TP_IS_INT(regs[7]) ? regs[7].nint != 0 : tp_true(tp, regs[7])) {
+        goto L173;
+    }
+L172: /* JUMP */
+    goto L182;
+L173: /* NUMBER */
+    tp_aot_op(tp, f, code + 173);
+L176: /* GET */
+    regs[7] = tp_get(tp, regs[4], regs[8]);
+    tp_grey(tp, regs[7]);
+L177: /* NUMBER */
+    tp_aot_op(tp, f, code + 177);
+L180: /* GET */
+    regs[8] = tp_get(tp, regs[4], regs[9]);
+    tp_grey(tp, regs[8]);
+L181: /* EQ */
+    if (TP_BOTH(regs[7], regs[8], TP_NUMBER_INT)) {
+        regs[7] = tp_bool(regs[7].nint == regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 181);
+    }
+L182: /* IF */
+    if (TP_IS_INT(regs[7]) ? regs[7].nint != 0 : tp_true(tp, regs[7])) {
+        goto L184;
+    }
+L183: /* JUMP */
+    goto L218;
+L184: /* LINE */
+    f->line = code + 184;
+    f->lineno = 233;
+L193: /* STRING */
+    tp_aot_op(tp, f, code + 193);
+L197: /* LIST */
+    tp_aot_op(tp, f, code + 197);
+L198: /* SET */
+    tp_set(tp, regs[0], regs[5], regs[7]);
+L199: /* LINE */
+    f->line = code + 199;
+    f->lineno = 234;
+L207: /* NUMBER */
+    tp_aot_op(tp, f, code + 207);
+L210: /* LINE */
+    f->line = code + 210;
+    f->lineno = 235;
+L217: /* JUMP */
+    tp_aot_safepoint(tp, 143);
+    goto L74;
+L218: /* LINE */
+    f->line = code + 218;
+    f->lineno = 237;
+L224: /* VAR */
+L226: /* NUMBER */
+    tp_aot_op(tp, f, code + 226);
+L229: /* ADD */
+    if (TP_BOTH(regs[5], regs[9], TP_NUMBER_INT)) {
+        regs[7] = tp_int(regs[5].nint + regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 229);
+    }
+L230: /* LINE */
+    f->line = code + 230;
+    f->lineno = 238;
+L246: /* GGET */
+    tp_aot_op(tp, f, code + 246);
+L249: /* MOVE */
+    regs[11] = regs[0];
+L250: /* CALLP */
+    return code + 250;
+L251: /* LT */
+    if (TP_BOTH(regs[7], regs[9], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[7].nint < regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 251);
+    }
+L252: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L254;
+    }
+L253: /* JUMP */
+    goto L263;
+L254: /* GGET */
+    tp_aot_op(tp, f, code + 254);
+L258: /* GET */
+    regs[10] = tp_get(tp, regs[0], regs[7]);
+    tp_grey(tp, regs[10]);
+L259: /* GGET */
+    tp_aot_op(tp, f, code + 259);
+L262: /* CALLP */
+    return code + 262;
+L263: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L265;
+    }
+L264: /* JUMP */
+    goto L276;
+L265: /* LINE */
+    f->line = code + 265;
+    f->lineno = 239;
+L271: /* NUMBER */
+    tp_aot_op(tp, f, code + 271);
+L274: /* ADD */
+    if (TP_BOTH(regs[7], regs[9], TP_NUMBER_INT)) {
+        regs[7] = tp_int(regs[7].nint + regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 274);
+    }
+L275: /* JUMP */
+    tp_aot_safepoint(tp, 29);
+    goto L246;
+L276: /* LINE */
+    f->line = code + 276;
+    f->lineno = 240;
+L291: /* GGET */
+    tp_aot_op(tp, f, code + 291);
+L294: /* MOVE */
+    regs[11] = regs[0];
+L295: /* CALLP */
+    return code + 295;
+L296: /* EQ */
+    if (TP_BOTH(regs[7], regs[9], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[7].nint == regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 296);
+    }
+L297: /* IFN */
+    if (!(TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8]))) {
+        goto L299;
+    }
+L298: /* JUMP */
+    goto L309;
+L299: /* GET */
+    regs[8] = tp_get(tp, regs[0], regs[7]);
+    tp_grey(tp, regs[8]);
+L300: /* NUMBER */
+    tp_aot_op(tp, f, code + 300);
+L303: /* GET */
+    regs[8] = tp_get(tp, regs[8], regs[9]);
+    tp_grey(tp, regs[8]);
+L304: /* STRING */
+    tp_aot_op(tp, f, code + 304);
+L308: /* NE */
+    if (TP_BOTH(regs[8], regs[9], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[8].nint != regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 308);
+    }
+L309: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L311;
+    }
+L310: /* JUMP */
+    goto L319;
+L311: /* LINE */
+    f->line = code + 311;
+    f->lineno = 241;
+L318: /* JUMP */
+    tp_aot_safepoint(tp, 244);
+    goto L74;
+L319: /* LINE */
+    f->line = code + 319;
+    f->lineno = 242;
+L326: /* VAR */
+L328: /* GET */
+    regs[8] = tp_get(tp, regs[0], regs[7]);
+    tp_grey(tp, regs[8]);
+L329: /* LINE */
+    f->line = code + 329;
+    f->lineno = 243;
+L335: /* VAR */
+L337: /* NUMBER */
+    tp_aot_op(tp, f, code + 337);
+L340: /* GET */
+    regs[9] = tp_get(tp, regs[4], regs[11]);
+    tp_grey(tp, regs[9]);
+L341: /* LINE */
+    f->line = code + 341;
+    f->lineno = 245;
+L363: /* GGET */
+    tp_aot_op(tp, f, code + 363);
+L366: /* EQ */
+    if (TP_BOTH(regs[6], regs[11], TP_NUMBER_INT)) {
+        regs[10] = tp_bool(regs[6].nint == regs[11].nint);
+    } else {
+        tp_aot_op(tp, f, code + 366);
+    }
+L367: /* IF */
+    if (TP_IS_INT(regs[10]) ? regs[10].nint != 0 : tp_true(tp, regs[10])) {
+        goto L369;
+    }
+L368: /* JUMP */
+    goto L387;
+L369: /* NUMBER */
+    tp_aot_op(tp, f, code + 369);
+L372: /* GET */
+    regs[10] = tp_get(tp, regs[8], regs[11]);
+    tp_grey(tp, regs[10]);
+L373: /* GGET */
+    tp_aot_op(tp, f, code + 373);
+L376: /* EQ */
+    if (TP_BOTH(regs[10], regs[11], TP_NUMBER_INT)) {
+        regs[10] = tp_bool(regs[10].nint == regs[11].nint);
+    } else {
+        tp_aot_op(tp, f, code + 376);
+    }
+L377: /* IFN */
+    if (!(TP_IS_INT(regs[10]) ? regs[10].nint != 0 : tp_true(tp, regs[10]))) {
+        goto L379;
+    }
+L378: /* JUMP */
+    goto L387;
+L379: /* NUMBER */
+    tp_aot_op(tp, f, code + 379);
+L382: /* GET */
+    regs[10] = tp_get(tp, regs[8], regs[11]);
+    tp_grey(tp, regs[10]);
+L383: /* GGET */
+    tp_aot_op(tp, f, code + 383);
+L386: /* EQ */
+    if (TP_BOTH(regs[10], regs[11], TP_NUMBER_INT)) {
+        regs[10] = tp_bool(regs[10].nint == regs[11].nint);
+    } else {
+        tp_aot_op(tp, f, code + 386);
+    }
+L387: /* IF */
+    if (TP_IS_INT(regs[10]) ? regs[10].nint != 0 : tp_true(tp, regs[10])) {
+        goto L389;
+    }
+L388: /* JUMP */
+    goto L394;
+L389: /* NUMBER */
+    tp_aot_op(tp, f, code + 389);
+L392: /* GET */
+    regs[10] = tp_get(tp, regs[8], regs[11]);
+    tp_grey(tp, regs[10]);
+L393: /* EQ */
+    if (TP_BOTH(regs[10], regs[9], TP_NUMBER_INT)) {
+        regs[10] = tp_bool(regs[10].nint == regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 393);
+    }
+L394: /* IF */
+    if (TP_IS_INT(regs[10]) ? regs[10].nint != 0 : tp_true(tp, regs[10])) {
+        goto L396;
+    }
+L395: /* JUMP */
+    goto L401;
+L396: /* NUMBER */
+    tp_aot_op(tp, f, code + 396);
+L399: /* ADD */
+    if (TP_BOTH(regs[5], regs[15], TP_NUMBER_INT)) {
+        regs[11] = tp_int(regs[5].nint + regs[15].nint);
+    } else {
+        tp_aot_op(tp, f, code + 399);
+    }
+L400: /* EQ */
+    if (TP_BOTH(regs[7], regs[11], TP_NUMBER_INT)) {
+        regs[10] = tp_bool(regs[7].nint == regs[11].nint);
+    } else {
+        tp_aot_op(tp, f, code + 400);
+    }
+L401: /* IF */
+    if (TP_IS_INT(regs[10]) ? regs[10].nint != 0 : tp_true(tp, regs[10])) {
+        goto L403;
+    }
+L402: /* JUMP */
+    goto L542;
+L403: /* LINE */
+    f->line = code + 403;
+    f->lineno = 246;
+L424: /* GGET */
+    tp_aot_op(tp, f, code + 424);
+L428: /* MOVE */
+    regs[16] = regs[0];
+L429: /* MOVE */
+    regs[17] = regs[1];
+L430: /* MOVE */
+    regs[18] = regs[2];
+L431: /* GGET */
+    tp_aot_op(tp, f, code + 431);
+L436: /* MOVE */
+    regs[20] = regs[0];
+L437: /* MOVE */
+    regs[21] = regs[1];
+L438: /* MOVE */
+    regs[22] = regs[7];
+L439: /* CALLP */
+    return code + 439;
+L440: /* MOVE */
+    regs[20] = regs[9];
+L441: /* CALLP */
+    return code + 441;
+L442: /* IFN */
+    if (!(TP_IS_INT(regs[11]) ? regs[11].nint != 0 : tp_true(tp, regs[11]))) {
+        goto L444;
+    }
+L443: /* JUMP */
+    goto L534;
+L444: /* LINE */
+    f->line = code + 444;
+    f->lineno = 247;
+L456: /* NUMBER */
+    tp_aot_op(tp, f, code + 456);
+L459: /* GET */
+    regs[10] = tp_get(tp, regs[8], regs[11]);
+    tp_grey(tp, regs[10]);
+L460: /* GGET */
+    tp_aot_op(tp, f, code + 460);
+L463: /* EQ */
+    if (TP_BOTH(regs[10], regs[11], TP_NUMBER_INT)) {
+        regs[10] = tp_bool(regs[10].nint == regs[11].nint);
+    } else {
+        tp_aot_op(tp, f, code + 463);
+    }
+L464: /* IF */
+    if (TP_IS_INT(regs[10]) ? regs[10].nint != 0 : tp_true(tp, regs[10])) {
+        goto L466;
+    }
+L465: /* JUMP */
+    goto L474;
+L466: /* GGET */
+    tp_aot_op(tp, f, code + 466);
+L469: /* NUMBER */
+    tp_aot_op(tp, f, code + 469);
+L472: /* SET */
+    tp_set(tp, regs[8], regs[11], regs[10]);
+L473: /* JUMP */
+    goto L490;
+L474: /* LINE */
+    f->line = code + 474;
+    f->lineno = 248;
+L483: /* GGET */
+    tp_aot_op(tp, f, code + 483);
+L486: /* NUMBER */
+    tp_aot_op(tp, f, code + 486);
+L489: /* SET */
+    tp_set(tp, regs[8], regs[11], regs[10]);
+L490: /* LINE */
+    f->line = code + 490;
+    f->lineno = 249;
+L498: /* NUMBER */
+    tp_aot_op(tp, f, code + 498);
+L501: /* GET */
+    regs[10] = tp_get(tp, regs[4], regs[11]);
+    tp_grey(tp, regs[10]);
+L502: /* NUMBER */
+    tp_aot_op(tp, f, code + 502);
+L505: /* SET */
+    tp_set(tp, regs[8], regs[11], regs[10]);
+L506: /* LINE */
+    f->line = code + 506;
+    f->lineno = 250;
+L516: /* STRING */
+    tp_aot_op(tp, f, code + 516);
+L520: /* LIST */
+    tp_aot_op(tp, f, code + 520);
+L521: /* SET */
+    tp_set(tp, regs[0], regs[5], regs[10]);
+L522: /* LINE */
+    f->line = code + 522;
+    f->lineno = 251;
+L531: /* NUMBER */
+    tp_aot_op(tp, f, code + 531);
+L534: /* LINE */
+    f->line = code + 534;
+    f->lineno = 252;
+L541: /* JUMP */
+    tp_aot_safepoint(tp, 467);
+    goto L74;
+L542: /* LINE */
+    f->line = code + 542;
+    f->lineno = 254;
+L561: /* GGET */
+    tp_aot_op(tp, f, code + 561);
+L566: /* IN */
+    regs[10] = tp_has(tp, regs[11], regs[6]);
+L567: /* IF */
+    if (TP_IS_INT(regs[10]) ? regs[10].nint != 0 : tp_true(tp, regs[10])) {
+        goto L569;
+    }
+L568: /* JUMP */
+    goto L578;
+L569: /* NUMBER */
+    tp_aot_op(tp, f, code + 569);
+L572: /* GET */
+    regs[10] = tp_get(tp, regs[8], regs[11]);
+    tp_grey(tp, regs[10]);
+L573: /* GGET */
+    tp_aot_op(tp, f, code + 573);
+L577: /* EQ */
+    if (TP_BOTH(regs[10], regs[11], TP_NUMBER_INT)) {
+        regs[10] = tp_bool(regs[10].nint == regs[11].nint);
+    } else {
+        tp_aot_op(tp, f, code + 577);
+    }
+L578: /* IF */
+    if (TP_IS_INT(regs[10]) ? regs[10].nint != 0 : tp_true(tp, regs[10])) {
+        goto L580;
+    }
+L579: /* JUMP */
+    goto L585;
+L580: /* NUMBER */
+    tp_aot_op(tp, f, code + 580);
+L583: /* GET */
+    regs[10] = tp_get(tp, regs[8], regs[11]);
+    tp_grey(tp, regs[10]);
+L584: /* EQ */
+    if (TP_BOTH(regs[10], regs[9], TP_NUMBER_INT)) {
+        regs[10] = tp_bool(regs[10].nint == regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 584);
+    }
+L585: /* IF */
+    if (TP_IS_INT(regs[10]) ? regs[10].nint != 0 : tp_true(tp, regs[10])) {
+        goto L587;
+    }
+L586: /* JUMP */
+    goto L592;
+L587: /* NUMBER */
+    tp_aot_op(tp, f, code + 587);
+L590: /* GET */
+    regs[10] = tp_get(tp, regs[8], regs[11]);
+    tp_grey(tp, regs[10]);
+L591: /* NE */
+    if (TP_BOTH(regs[10], regs[9], TP_NUMBER_INT)) {
+        regs[10] = tp_bool(regs[10].nint != regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 591);
+    }
+L592: /* IF */
+    if (TP_IS_INT(regs[10]) ? regs[10].nint != 0 : tp_true(tp, regs[10])) {
+        goto L594;
+    }
+L593: /* JUMP */
+    tp_aot_safepoint(tp, 519);
+    goto L74;
+L594: /* LINE */
+    f->line = code + 594;
+    f->lineno = 255;
+L615: /* GGET */
+    tp_aot_op(tp, f, code + 615);
+L619: /* MOVE */
+    regs[16] = regs[0];
+L620: /* MOVE */
+    regs[17] = regs[1];
+L621: /* MOVE */
+    regs[18] = regs[2];
+L622: /* GGET */
+    tp_aot_op(tp, f, code + 622);
+L627: /* MOVE */
+    regs[20] = regs[0];
+L628: /* MOVE */
+    regs[21] = regs[1];
+L629: /* MOVE */
+    regs[22] = regs[7];
+L630: /* CALLP */
+    return code + 630;
+L631: /* MOVE */
+    regs[20] = regs[9];
+L632: /* CALLP */
+    return code + 632;
+L633: /* IFN */
+    if (!(TP_IS_INT(regs[11]) ? regs[11].nint != 0 : tp_true(tp, regs[11]))) {
+        goto L635;
+    }
+L634: /* JUMP */
+    tp_aot_safepoint(tp, 560);
+    goto L74;
+L635: /* LINE */
+    f->line = code + 635;
+    f->lineno = 256;
+L643: /* NUMBER */
+    tp_aot_op(tp, f, code + 643);
+L646: /* GET */
+    regs[10] = tp_get(tp, regs[8], regs[11]);
+    tp_grey(tp, regs[10]);
+L647: /* NUMBER */
+    tp_aot_op(tp, f, code + 647);
+L650: /* SET */
+    tp_set(tp, regs[4], regs[11], regs[10]);
+L651: /* LINE */
+    f->line = code + 651;
+    f->lineno = 257;
+L662: /* STRING */
+    tp_aot_op(tp, f, code + 662);
+L666: /* LIST */
+    tp_aot_op(tp, f, code + 666);
+L667: /* SET */
+    tp_set(tp, regs[0], regs[7], regs[10]);
+L668: /* LINE */
+    f->line = code + 668;
+    f->lineno = 258;
+L677: /* NUMBER */
+    tp_aot_op(tp, f, code + 677);
+L680: /* JUMP */
+    tp_aot_safepoint(tp, 606);
+    goto L74;
+L681: /* LINE */
+    f->line = code + 681;
+    f->lineno = 259;
+L687: /* RETURN */
+    return code + 687;
+L688: /* EOF */
+    return code + 688;
+}
+
+static tpd_code * _tp_tinypy_compiler_peephole_5024(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 10: goto L10;
+        case 13: goto L13;
+        case 16: goto L16;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 30: goto L30;
+        case 31: goto L31;
+        case 37: goto L37;
+        case 40: goto L40;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 54: goto L54;
+        case 58: goto L58;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 66: goto L66;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 72: goto L72;
+        case 73: goto L73;
+        case 80: goto L80;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 97: goto L97;
+        case 101: goto L101;
+        case 102: goto L102;
+        case 105: goto L105;
+        case 106: goto L106;
+        case 107: goto L107;
+        case 108: goto L108;
+        case 112: goto L112;
+        case 113: goto L113;
+        case 116: goto L116;
+        case 117: goto L117;
+        case 118: goto L118;
+        case 119: goto L119;
+        case 126: goto L126;
+        case 127: goto L127;
+        case 139: goto L139;
+        case 142: goto L142;
+        case 143: goto L143;
+        case 144: goto L144;
+        case 147: goto L147;
+        case 148: goto L148;
+        case 149: goto L149;
+        case 151: goto L151;
+        case 152: goto L152;
+        case 154: goto L154;
+        case 155: goto L155;
+        case 168: goto L168;
+        case 171: goto L171;
+        case 172: goto L172;
+        case 176: goto L176;
+        case 177: goto L177;
+        case 178: goto L178;
+        case 179: goto L179;
+        case 182: goto L182;
+        case 183: goto L183;
+        case 187: goto L187;
+        case 188: goto L188;
+        case 189: goto L189;
+        case 190: goto L190;
+        case 197: goto L197;
+        case 198: goto L198;
+        case 222: goto L222;
+        case 227: goto L227;
+        case 228: goto L228;
+        case 231: goto L231;
+        case 232: goto L232;
+        case 233: goto L233;
+        case 238: goto L238;
+        case 239: goto L239;
+        case 242: goto L242;
+        case 243: goto L243;
+        case 244: goto L244;
+        case 245: goto L245;
+        case 246: goto L246;
+        case 247: goto L247;
+        case 248: goto L248;
+        case 251: goto L251;
+        case 252: goto L252;
+        case 253: goto L253;
+        case 256: goto L256;
+        case 257: goto L257;
+        case 258: goto L258;
+        case 259: goto L259;
+        case 260: goto L260;
+        case 267: goto L267;
+        case 268: goto L268;
+        case 278: goto L278;
+        case 281: goto L281;
+        case 282: goto L282;
+        case 285: goto L285;
+        case 286: goto L286;
+        case 287: goto L287;
+        case 288: goto L288;
+        case 291: goto L291;
+        case 294: goto L294;
+        case 295: goto L295;
+        case 296: goto L296;
+        case 303: goto L303;
+        case 306: goto L306;
+        case 309: goto L309;
+        case 310: goto L310;
+        case 318: goto L318;
+        case 321: goto L321;
+        case 322: goto L322;
+        case 323: goto L323;
+        case 332: goto L332;
+        case 336: goto L336;
+        case 337: goto L337;
+        case 340: goto L340;
+        case 341: goto L341;
+        case 342: goto L342;
+        case 349: goto L349;
+        case 352: goto L352;
+        case 353: goto L353;
+        case 359: goto L359;
+        case 360: goto L360;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 261;
+L10: /* VAR */
+L13: /* VAR */
+L16: /* STRING */
+    tp_aot_op(tp, f, code + 16);
+L25: /* FILE */
+    f->fname = regs[2];
+L26: /* STRING */
+    tp_aot_op(tp, f, code + 26);
+L30: /* NAME */
+    f->name = regs[2];
+L31: /* LINE */
+    f->line = code + 31;
+    f->lineno = 263;
+L37: /* VAR */
+L40: /* NUMBER */
+    tp_aot_op(tp, f, code + 40);
+L43: /* MOVE */
+    regs[2] = regs[3];
+L44: /* LINE */
+    f->line = code + 44;
+    f->lineno = 264;
+L54: /* GGET */
+    tp_aot_op(tp, f, code + 54);
+L58: /* GGET */
+    tp_aot_op(tp, f, code + 58);
+L61: /* MOVE */
+    regs[7] = regs[0];
+L62: /* CALLP */
+    return code + 62;
+L63: /* NUMBER */
+    tp_aot_op(tp, f, code + 63);
+L66: /* SUB */
+    if (TP_BOTH(regs[5], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[5].nint - regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 66);
+    }
+L67: /* RANGE */
+    tp_aot_op(tp, f, code + 67);
+L68: /* FOR */
+    if (regs[13].type.typeid == TP_NUMBER) {
+        if (regs[14].nint > 0 ? regs[12].nint < regs[13].nint : regs[12].nint > regs[13].nint) {
+            regs[3] = regs[12];
+            regs[12].nint += regs[14].nint;
+            goto L70;
+        }
+    } else if (tp_iter_next(tp, &regs[3], regs[12], &regs[14])) {
+        goto L70;
+    }
+L69: /* JUMP */
+    goto L353;
+L70: /* VAR */
+L72: /* MOVE */
+    regs[4] = regs[3];
+L73: /* LINE */
+    f->line = code + 73;
+    f->lineno = 265;
+L80: /* VAR */
+L82: /* GET */
+    regs[3] = tp_get(tp, regs[0], regs[4]);
+    tp_grey(tp, regs[3]);
+L83: /* LINE */
+    f->line = code + 83;
+    f->lineno = 266;
+L97: /* GGET */
+    tp_aot_op(tp, f, code + 97);
+L101: /* MOVE */
+    regs[8] = regs[3];
+L102: /* GGET */
+    tp_aot_op(tp, f, code + 102);
+L105: /* CALLP */
+    return code + 105;
+L106: /* IFN */
+    if (!(TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6]))) {
+        goto L108;
+    }
+L107: /* JUMP */
+    goto L117;
+L108: /* GGET */
+    tp_aot_op(tp, f, code + 108);
+L112: /* MOVE */
+    regs[8] = regs[3];
+L113: /* GGET */
+    tp_aot_op(tp, f, code + 113);
+L116: /* CALLP */
+    return code + 116;
+L117: /* IFN */
+    if (!(TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6]))) {
+        goto L119;
+    }
+L118: /* JUMP */
+    goto L127;
+L119: /* LINE */
+    f->line = code + 119;
+    f->lineno = 267;
+L126: /* JUMP */
+    tp_aot_safepoint(tp, 58);
+    goto L68;
+L127: /* LINE */
+    f->line = code + 127;
+    f->lineno = 268;
+L139: /* NUMBER */
+    tp_aot_op(tp, f, code + 139);
+L142: /* ADD */
+    if (TP_BOTH(regs[4], regs[8], TP_NUMBER_INT)) {
+        regs[7] = tp_int(regs[4].nint + regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 142);
+    }
+L143: /* GET */
+    regs[5] = tp_get(tp, regs[0], regs[7]);
+    tp_grey(tp, regs[5]);
+L144: /* NUMBER */
+    tp_aot_op(tp, f, code + 144);
+L147: /* ADD */
+    if (TP_BOTH(regs[4], regs[9], TP_NUMBER_INT)) {
+        regs[8] = tp_int(regs[4].nint + regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 147);
+    }
+L148: /* GET */
+    regs[6] = tp_get(tp, regs[0], regs[8]);
+    tp_grey(tp, regs[6]);
+L149: /* VAR */
+L151: /* MOVE */
+    regs[7] = regs[5];
+L152: /* VAR */
+L154: /* MOVE */
+    regs[5] = regs[6];
+L155: /* LINE */
+    f->line = code + 155;
+    f->lineno = 269;
+L168: /* NUMBER */
+    tp_aot_op(tp, f, code + 168);
+L171: /* GET */
+    regs[6] = tp_get(tp, regs[7], regs[8]);
+    tp_grey(tp, regs[6]);
+L172: /* STRING */
+    tp_aot_op(tp, f, code + 172);
+L176: /* NE */
+    if (TP_BOTH(regs[6], regs[8], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[6].nint != regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 176);
+    }
+L177: /* IFN */
+    if (!(TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6]))) {
+        goto L179;
+    }
+L178: /* JUMP */
+    goto L188;
+L179: /* NUMBER */
+    tp_aot_op(tp, f, code + 179);
+L182: /* GET */
+    regs[6] = tp_get(tp, regs[5], regs[8]);
+    tp_grey(tp, regs[6]);
+L183: /* STRING */
+    tp_aot_op(tp, f, code + 183);
+L187: /* NE */
+    if (TP_BOTH(regs[6], regs[8], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[6].nint != regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 187);
+    }
+L188: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L190;
+    }
+L189: /* JUMP */
+    goto L198;
+L190: /* LINE */
+    f->line = code + 190;
+    f->lineno = 270;
+L197: /* JUMP */
+    tp_aot_safepoint(tp, 129);
+    goto L68;
+L198: /* LINE */
+    f->line = code + 198;
+    f->lineno = 271;
+L222: /* GGET */
+    tp_aot_op(tp, f, code + 222);
+L227: /* MOVE */
+    regs[9] = regs[0];
+L228: /* NUMBER */
+    tp_aot_op(tp, f, code + 228);
+L231: /* ADD */
+    if (TP_BOTH(regs[4], regs[11], TP_NUMBER_INT)) {
+        regs[10] = tp_int(regs[4].nint + regs[11].nint);
+    } else {
+        tp_aot_op(tp, f, code + 231);
+    }
+L232: /* CALLP */
+    return code + 232;
+L233: /* GGET */
+    tp_aot_op(tp, f, code + 233);
+L238: /* MOVE */
+    regs[10] = regs[0];
+L239: /* NUMBER */
+    tp_aot_op(tp, f, code + 239);
+L242: /* GET */
+    regs[8] = tp_get(tp, regs[7], regs[8]);
+    tp_grey(tp, regs[8]);
+L243: /* GET */
+    regs[11] = tp_get(tp, regs[1], regs[8]);
+    tp_grey(tp, regs[11]);
+L244: /* CALLP */
+    return code + 244;
+L245: /* NE */
+    if (TP_BOTH(regs[6], regs[8], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[6].nint != regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 245);
+    }
+L246: /* IFN */
+    if (!(TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6]))) {
+        goto L248;
+    }
+L247: /* JUMP */
+    goto L258;
+L248: /* NUMBER */
+    tp_aot_op(tp, f, code + 248);
+L251: /* GET */
+    regs[8] = tp_get(tp, regs[7], regs[9]);
+    tp_grey(tp, regs[8]);
+L252: /* GET */
+    regs[6] = tp_get(tp, regs[1], regs[8]);
+    tp_grey(tp, regs[6]);
+L253: /* NUMBER */
+    tp_aot_op(tp, f, code + 253);
+L256: /* ADD */
+    if (TP_BOTH(regs[4], regs[9], TP_NUMBER_INT)) {
+        regs[8] = tp_int(regs[4].nint + regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 256);
+    }
+L257: /* LT */
+    if (TP_BOTH(regs[6], regs[8], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[6].nint < regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 257);
+    }
+L258: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L260;
+    }
+L259: /* JUMP */
+    goto L268;
+L260: /* LINE */
+    f->line = code + 260;
+    f->lineno = 272;
+L267: /* JUMP */
+    tp_aot_safepoint(tp, 199);
+    goto L68;
+L268: /* LINE */
+    f->line = code + 268;
+    f->lineno = 273;
+L278: /* NUMBER */
+    tp_aot_op(tp, f, code + 278);
+L281: /* GET */
+    regs[6] = tp_get(tp, regs[3], regs[8]);
+    tp_grey(tp, regs[6]);
+L282: /* GGET */
+    tp_aot_op(tp, f, code + 282);
+L285: /* EQ */
+    if (TP_BOTH(regs[6], regs[8], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[6].nint == regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 285);
+    }
+L286: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L288;
+    }
+L287: /* JUMP */
+    goto L296;
+L288: /* GGET */
+    tp_aot_op(tp, f, code + 288);
+L291: /* NUMBER */
+    tp_aot_op(tp, f, code + 291);
+L294: /* SET */
+    tp_set(tp, regs[3], regs[8], regs[6]);
+L295: /* JUMP */
+    goto L310;
+L296: /* LINE */
+    f->line = code + 296;
+    f->lineno = 274;
+L303: /* GGET */
+    tp_aot_op(tp, f, code + 303);
+L306: /* NUMBER */
+    tp_aot_op(tp, f, code + 306);
+L309: /* SET */
+    tp_set(tp, regs[3], regs[8], regs[6]);
+L310: /* LINE */
+    f->line = code + 310;
+    f->lineno = 275;
+L318: /* NUMBER */
+    tp_aot_op(tp, f, code + 318);
+L321: /* ADD */
+    if (TP_BOTH(regs[4], regs[8], TP_NUMBER_INT)) {
+        regs[6] = tp_int(regs[4].nint + regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 321);
+    }
+L322: /* SET */
+    tp_set(tp, regs[0], regs[6], regs[5]);
+L323: /* LINE */
+    f->line = code + 323;
+    f->lineno = 276;
+L332: /* STRING */
+    tp_aot_op(tp, f, code + 332);
+L336: /* LIST */
+    tp_aot_op(tp, f, code + 336);
+L337: /* NUMBER */
+    tp_aot_op(tp, f, code + 337);
+L340: /* ADD */
+    if (TP_BOTH(regs[4], regs[9], TP_NUMBER_INT)) {
+        regs[8] = tp_int(regs[4].nint + regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 340);
+    }
+L341: /* SET */
+    tp_set(tp, regs[0], regs[8], regs[6]);
+L342: /* LINE */
+    f->line = code + 342;
+    f->lineno = 277;
+L349: /* NUMBER */
+    tp_aot_op(tp, f, code + 349);
+L352: /* JUMP */
+    tp_aot_safepoint(tp, 284);
+    goto L68;
+L353: /* LINE */
+    f->line = code + 353;
+    f->lineno = 278;
+L359: /* RETURN */
+    return code + 359;
+L360: /* EOF */
+    return code + 360;
+}
+
+static tpd_code * _tp_tinypy_compiler_peephole_5408(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 11: goto L11;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 30: goto L30;
+        case 32: goto L32;
+        case 33: goto L33;
+        case 34: goto L34;
+        case 40: goto L40;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 45: goto L45;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 56: goto L56;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 64: goto L64;
+        case 65: goto L65;
+        case 66: goto L66;
+        case 67: goto L67;
+        case 74: goto L74;
+        case 78: goto L78;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 88: goto L88;
+        case 89: goto L89;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 280;
+L8: /* VAR */
+L11: /* STRING */
+    tp_aot_op(tp, f, code + 11);
+L20: /* FILE */
+    f->fname = regs[1];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 281;
+L30: /* VAR */
+L32: /* LIST */
+    tp_aot_op(tp, f, code + 32);
+L33: /* MOVE */
+    regs[1] = regs[2];
+L34: /* LINE */
+    f->line = code + 34;
+    f->lineno = 282;
+L40: /* NUMBER */
+    tp_aot_op(tp, f, code + 40);
+L43: /* ITER */
+    if (tp_iter_next(tp, &regs[2], regs[0], &regs[3])) {
+        goto L45;
+    }
+L44: /* JUMP */
+    goto L83;
+L45: /* VAR */
+L47: /* MOVE */
+    regs[4] = regs[2];
+L48: /* LINE */
+    f->line = code + 48;
+    f->lineno = 283;
+L56: /* NUMBER */
+    tp_aot_op(tp, f, code + 56);
+L59: /* GET */
+    regs[2] = tp_get(tp, regs[4], regs[5]);
+    tp_grey(tp, regs[2]);
+L60: /* STRING */
+    tp_aot_op(tp, f, code + 60);
+L64: /* NE */
+    if (TP_BOTH(regs[2], regs[5], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint != regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 64);
+    }
+L65: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L67;
+    }
+L66: /* JUMP */
+    tp_aot_safepoint(tp, 23);
+    goto L43;
+L67: /* LINE */
+    f->line = code + 67;
+    f->lineno = 284;
+L74: /* STRING */
+    tp_aot_op(tp, f, code + 74);
+L78: /* METHOD */
+    tp_aot_op(tp, f, code + 78);
+L80: /* MOVE */
+    regs[7] = regs[4];
+L81: /* CALLM */
+    return code + 81;
+L82: /* JUMP */
+    tp_aot_safepoint(tp, 39);
+    goto L43;
+L83: /* LINE */
+    f->line = code + 83;
+    f->lineno = 285;
+L88: /* RETURN */
+    return code + 88;
+L89: /* EOF */
+    return code + 89;
+}
+
+static tpd_code * _tp_tinypy_compiler_peephole_5522(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 34: goto L34;
+        case 37: goto L37;
+        case 38: goto L38;
+        case 39: goto L39;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 50: goto L50;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 70: goto L70;
+        case 75: goto L75;
+        case 78: goto L78;
+        case 79: goto L79;
+        case 80: goto L80;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 85: goto L85;
+        case 91: goto L91;
+        case 94: goto L94;
+        case 97: goto L97;
+        case 103: goto L103;
+        case 104: goto L104;
+        case 105: goto L105;
+        case 115: goto L115;
+        case 118: goto L118;
+        case 123: goto L123;
+        case 124: goto L124;
+        case 125: goto L125;
+        case 137: goto L137;
+        case 143: goto L143;
+        case 144: goto L144;
+        case 145: goto L145;
+        case 146: goto L146;
+        case 155: goto L155;
+        case 159: goto L159;
+        case 160: goto L160;
+        case 161: goto L161;
+        case 171: goto L171;
+        case 176: goto L176;
+        case 177: goto L177;
+        case 178: goto L178;
+        case 187: goto L187;
+        case 191: goto L191;
+        case 192: goto L192;
+        case 193: goto L193;
+        case 194: goto L194;
+        case 195: goto L195;
+        case 196: goto L196;
+        case 204: goto L204;
+        case 207: goto L207;
+        case 217: goto L217;
+        case 221: goto L221;
+        case 222: goto L222;
+        case 223: goto L223;
+        case 234: goto L234;
+        case 239: goto L239;
+        case 240: goto L240;
+        case 241: goto L241;
+        case 248: goto L248;
+        case 252: goto L252;
+        case 253: goto L253;
+        case 254: goto L254;
+        case 261: goto L261;
+        case 264: goto L264;
+        case 265: goto L265;
+        case 266: goto L266;
+        case 267: goto L267;
+        case 277: goto L277;
+        case 280: goto L280;
+        case 281: goto L281;
+        case 285: goto L285;
+        case 286: goto L286;
+        case 287: goto L287;
+        case 288: goto L288;
+        case 300: goto L300;
+        case 304: goto L304;
+        case 306: goto L306;
+        case 309: goto L309;
+        case 310: goto L310;
+        case 311: goto L311;
+        case 312: goto L312;
+        case 313: goto L313;
+        case 324: goto L324;
+        case 328: goto L328;
+        case 329: goto L329;
+        case 330: goto L330;
+        case 331: goto L331;
+        case 332: goto L332;
+        case 333: goto L333;
+        case 334: goto L334;
+        case 342: goto L342;
+        case 345: goto L345;
+        case 355: goto L355;
+        case 359: goto L359;
+        case 360: goto L360;
+        case 361: goto L361;
+        case 370: goto L370;
+        case 375: goto L375;
+        case 376: goto L376;
+        case 377: goto L377;
+        case 378: goto L378;
+        case 379: goto L379;
+        case 387: goto L387;
+        case 390: goto L390;
+        case 400: goto L400;
+        case 404: goto L404;
+        case 405: goto L405;
+        case 406: goto L406;
+        case 415: goto L415;
+        case 420: goto L420;
+        case 421: goto L421;
+        case 422: goto L422;
+        case 423: goto L423;
+        case 424: goto L424;
+        case 432: goto L432;
+        case 435: goto L435;
+        case 445: goto L445;
+        case 449: goto L449;
+        case 450: goto L450;
+        case 451: goto L451;
+        case 452: goto L452;
+        case 458: goto L458;
+        case 459: goto L459;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 287;
+L9: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[1];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L27: /* NAME */
+    f->name = regs[1];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 288;
+L34: /* NUMBER */
+    tp_aot_op(tp, f, code + 34);
+L37: /* ITER */
+    if (tp_iter_next(tp, &regs[1], regs[0], &regs[2])) {
+        goto L39;
+    }
+L38: /* JUMP */
+    goto L85;
+L39: /* VAR */
+L41: /* MOVE */
+    regs[3] = regs[1];
+L42: /* LINE */
+    f->line = code + 42;
+    f->lineno = 289;
+L50: /* NUMBER */
+    tp_aot_op(tp, f, code + 50);
+L53: /* GET */
+    regs[1] = tp_get(tp, regs[3], regs[4]);
+    tp_grey(tp, regs[1]);
+L54: /* STRING */
+    tp_aot_op(tp, f, code + 54);
+L57: /* EQ */
+    if (TP_BOTH(regs[1], regs[4], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[1].nint == regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 57);
+    }
+L58: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L60;
+    }
+L59: /* JUMP */
+    tp_aot_safepoint(tp, 22);
+    goto L37;
+L60: /* LINE */
+    f->line = code + 60;
+    f->lineno = 290;
+L70: /* GGET */
+    tp_aot_op(tp, f, code + 70);
+L75: /* NUMBER */
+    tp_aot_op(tp, f, code + 75);
+L78: /* GET */
+    regs[5] = tp_get(tp, regs[3], regs[6]);
+    tp_grey(tp, regs[5]);
+L79: /* CALLP */
+    return code + 79;
+L80: /* NUMBER */
+    tp_aot_op(tp, f, code + 80);
+L83: /* SET */
+    tp_set(tp, regs[3], regs[4], regs[1]);
+L84: /* JUMP */
+    tp_aot_safepoint(tp, 47);
+    goto L37;
+L85: /* LINE */
+    f->line = code + 85;
+    f->lineno = 291;
+L91: /* VAR */
+L94: /* NUMBER */
+    tp_aot_op(tp, f, code + 94);
+L97: /* LINE */
+    f->line = code + 97;
+    f->lineno = 292;
+L103: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L105;
+    }
+L104: /* JUMP */
+    goto L452;
+L105: /* LINE */
+    f->line = code + 105;
+    f->lineno = 293;
+L115: /* VAR */
+L118: /* GGET */
+    tp_aot_op(tp, f, code + 118);
+L123: /* MOVE */
+    regs[6] = regs[0];
+L124: /* CALLP */
+    return code + 124;
+L125: /* LINE */
+    f->line = code + 125;
+    f->lineno = 294;
+L137: /* GGET */
+    tp_aot_op(tp, f, code + 137);
+L143: /* MOVE */
+    regs[6] = regs[0];
+L144: /* MOVE */
+    regs[7] = regs[2];
+L145: /* CALLP */
+    return code + 145;
+L146: /* LINE */
+    f->line = code + 146;
+    f->lineno = 295;
+L155: /* GGET */
+    tp_aot_op(tp, f, code + 155);
+L159: /* MOVE */
+    regs[6] = regs[0];
+L160: /* CALLP */
+    return code + 160;
+L161: /* LINE */
+    f->line = code + 161;
+    f->lineno = 296;
+L171: /* GGET */
+    tp_aot_op(tp, f, code + 171);
+L176: /* MOVE */
+    regs[6] = regs[0];
+L177: /* CALLP */
+    return code + 177;
+L178: /* LINE */
+    f->line = code + 178;
+    f->lineno = 297;
+L187: /* GGET */
+    tp_aot_op(tp, f, code + 187);
+L191: /* MOVE */
+    regs[6] = regs[0];
+L192: /* MOVE */
+    regs[7] = regs[2];
+L193: /* CALLP */
+    return code + 193;
+L194: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L196;
+    }
+L195: /* JUMP */
+    goto L241;
+L196: /* LINE */
+    f->line = code + 196;
+    f->lineno = 298;
+L204: /* NUMBER */
+    tp_aot_op(tp, f, code + 204);
+L207: /* LINE */
+    f->line = code + 207;
+    f->lineno = 299;
+L217: /* GGET */
+    tp_aot_op(tp, f, code + 217);
+L221: /* MOVE */
+    regs[6] = regs[0];
+L222: /* CALLP */
+    return code + 222;
+L223: /* LINE */
+    f->line = code + 223;
+    f->lineno = 300;
+L234: /* GGET */
+    tp_aot_op(tp, f, code + 234);
+L239: /* MOVE */
+    regs[6] = regs[0];
+L240: /* CALLP */
+    return code + 240;
+L241: /* LINE */
+    f->line = code + 241;
+    f->lineno = 301;
+L248: /* VAR */
+L252: /* LIST */
+    tp_aot_op(tp, f, code + 252);
+L253: /* MOVE */
+    regs[4] = regs[5];
+L254: /* LINE */
+    f->line = code + 254;
+    f->lineno = 302;
+L261: /* NUMBER */
+    tp_aot_op(tp, f, code + 261);
+L264: /* ITER */
+    if (tp_iter_next(tp, &regs[5], regs[0], &regs[6])) {
+        goto L266;
+    }
+L265: /* JUMP */
+    goto L313;
+L266: /* MOVE */
+    regs[3] = regs[5];
+L267: /* LINE */
+    f->line = code + 267;
+    f->lineno = 303;
+L277: /* NUMBER */
+    tp_aot_op(tp, f, code + 277);
+L280: /* GET */
+    regs[5] = tp_get(tp, regs[3], regs[7]);
+    tp_grey(tp, regs[5]);
+L281: /* STRING */
+    tp_aot_op(tp, f, code + 281);
+L285: /* EQ */
+    if (TP_BOTH(regs[5], regs[7], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[5].nint == regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 285);
+    }
+L286: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L288;
+    }
+L287: /* JUMP */
+    tp_aot_safepoint(tp, 23);
+    goto L264;
+L288: /* LINE */
+    f->line = code + 288;
+    f->lineno = 304;
+L300: /* STRING */
+    tp_aot_op(tp, f, code + 300);
+L304: /* METHOD */
+    tp_aot_op(tp, f, code + 304);
+L306: /* NUMBER */
+    tp_aot_op(tp, f, code + 306);
+L309: /* GET */
+    regs[5] = tp_get(tp, regs[3], regs[5]);
+    tp_grey(tp, regs[5]);
+L310: /* GET */
+    regs[9] = tp_get(tp, regs[2], regs[5]);
+    tp_grey(tp, regs[9]);
+L311: /* CALLM */
+    return code + 311;
+L312: /* JUMP */
+    tp_aot_safepoint(tp, 48);
+    goto L264;
+L313: /* LINE */
+    f->line = code + 313;
+    f->lineno = 305;
+L324: /* GGET */
+    tp_aot_op(tp, f, code + 324);
+L328: /* MOVE */
+    regs[7] = regs[0];
+L329: /* MOVE */
+    regs[8] = regs[2];
+L330: /* MOVE */
+    regs[9] = regs[4];
+L331: /* CALLP */
+    return code + 331;
+L332: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L334;
+    }
+L333: /* JUMP */
+    goto L361;
+L334: /* LINE */
+    f->line = code + 334;
+    f->lineno = 306;
+L342: /* NUMBER */
+    tp_aot_op(tp, f, code + 342);
+L345: /* LINE */
+    f->line = code + 345;
+    f->lineno = 307;
+L355: /* GGET */
+    tp_aot_op(tp, f, code + 355);
+L359: /* MOVE */
+    regs[7] = regs[0];
+L360: /* CALLP */
+    return code + 360;
+L361: /* LINE */
+    f->line = code + 361;
+    f->lineno = 308;
+L370: /* GGET */
+    tp_aot_op(tp, f, code + 370);
+L375: /* MOVE */
+    regs[7] = regs[0];
+L376: /* CALLP */
+    return code + 376;
+L377: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L379;
+    }
+L378: /* JUMP */
+    goto L406;
+L379: /* LINE */
+    f->line = code + 379;
+    f->lineno = 309;
+L387: /* NUMBER */
+    tp_aot_op(tp, f, code + 387);
+L390: /* LINE */
+    f->line = code + 390;
+    f->lineno = 310;
+L400: /* GGET */
+    tp_aot_op(tp, f, code + 400);
+L404: /* MOVE */
+    regs[7] = regs[0];
+L405: /* CALLP */
+    return code + 405;
+L406: /* LINE */
+    f->line = code + 406;
+    f->lineno = 311;
+L415: /* GGET */
+    tp_aot_op(tp, f, code + 415);
+L420: /* MOVE */
+    regs[7] = regs[0];
+L421: /* CALLP */
+    return code + 421;
+L422: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L424;
+    }
+L423: /* JUMP */
+    tp_aot_safepoint(tp, 320);
+    goto L103;
+L424: /* LINE */
+    f->line = code + 424;
+    f->lineno = 312;
+L432: /* NUMBER */
+    tp_aot_op(tp, f, code + 432);
+L435: /* LINE */
+    f->line = code + 435;
+    f->lineno = 313;
+L445: /* GGET */
+    tp_aot_op(tp, f, code + 445);
+L449: /* MOVE */
+    regs[7] = regs[0];
+L450: /* CALLP */
+    return code + 450;
+L451: /* JUMP */
+    tp_aot_safepoint(tp, 348);
+    goto L103;
+L452: /* LINE */
+    f->line = code + 452;
+    f->lineno = 314;
+L458: /* RETURN */
+    return code + 458;
+L459: /* EOF */
+    return code + 459;
+}
+
+static tpd_code * _tp_tinypy_compiler_peephole_6005(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 36: goto L36;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 44: goto L44;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 48: goto L48;
+        case 51: goto L51;
+        case 54: goto L54;
+        case 55: goto L55;
+        case 57: goto L57;
+        case 60: goto L60;
+        case 61: goto L61;
+        case 71: goto L71;
+        case 75: goto L75;
+        case 79: goto L79;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 88: goto L88;
+        case 89: goto L89;
+        case 90: goto L90;
+        case 91: goto L91;
+        case 95: goto L95;
+        case 96: goto L96;
+        case 104: goto L104;
+        case 109: goto L109;
+        case 110: goto L110;
+        case 111: goto L111;
+        case 121: goto L121;
+        case 125: goto L125;
+        case 129: goto L129;
+        case 133: goto L133;
+        case 134: goto L134;
+        case 138: goto L138;
+        case 139: goto L139;
+        case 140: goto L140;
+        case 141: goto L141;
+        case 145: goto L145;
+        case 146: goto L146;
+        case 155: goto L155;
+        case 159: goto L159;
+        case 160: goto L160;
+        case 161: goto L161;
+        case 162: goto L162;
+        case 163: goto L163;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 316;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 318;
+L36: /* GGET */
+    tp_aot_op(tp, f, code + 36);
+L40: /* MOVE */
+    regs[3] = regs[0];
+L41: /* NUMBER */
+    tp_aot_op(tp, f, code + 41);
+L44: /* NONE */
+    regs[5] = tp_None;
+L45: /* CALLP */
+    return code + 45;
+L46: /* VAR */
+L48: /* VAR */
+L51: /* NUMBER */
+    tp_aot_op(tp, f, code + 51);
+L54: /* GET */
+    regs[2] = tp_get(tp, regs[1], regs[4]);
+    tp_grey(tp, regs[2]);
+L55: /* VAR */
+L57: /* NUMBER */
+    tp_aot_op(tp, f, code + 57);
+L60: /* GET */
+    regs[3] = tp_get(tp, regs[1], regs[5]);
+    tp_grey(tp, regs[3]);
+L61: /* LINE */
+    f->line = code + 61;
+    f->lineno = 319;
+L71: /* GGET */
+    tp_aot_op(tp, f, code + 71);
+L75: /* GGET */
+    tp_aot_op(tp, f, code + 75);
+L79: /* STRING */
+    tp_aot_op(tp, f, code + 79);
+L83: /* GET */
+    regs[4] = tp_get(tp, regs[4], regs[5]);
+    tp_grey(tp, regs[4]);
+L84: /* GGET */
+    tp_aot_op(tp, f, code + 84);
+L88: /* MOVE */
+    regs[7] = regs[2];
+L89: /* CALLP */
+    return code + 89;
+L90: /* ADD */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[4] = tp_int(regs[4].nint + regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 90);
+    }
+L91: /* STRING */
+    tp_aot_op(tp, f, code + 91);
+L95: /* SET */
+    tp_set(tp, regs[1], regs[5], regs[4]);
+L96: /* LINE */
+    f->line = code + 96;
+    f->lineno = 320;
+L104: /* GGET */
+    tp_aot_op(tp, f, code + 104);
+L109: /* MOVE */
+    regs[5] = regs[2];
+L110: /* CALLP */
+    return code + 110;
+L111: /* LINE */
+    f->line = code + 111;
+    f->lineno = 321;
+L121: /* GGET */
+    tp_aot_op(tp, f, code + 121);
+L125: /* GGET */
+    tp_aot_op(tp, f, code + 125);
+L129: /* STRING */
+    tp_aot_op(tp, f, code + 129);
+L133: /* GET */
+    regs[4] = tp_get(tp, regs[4], regs[5]);
+    tp_grey(tp, regs[4]);
+L134: /* GGET */
+    tp_aot_op(tp, f, code + 134);
+L138: /* MOVE */
+    regs[7] = regs[2];
+L139: /* CALLP */
+    return code + 139;
+L140: /* ADD */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[4] = tp_int(regs[4].nint + regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 140);
+    }
+L141: /* STRING */
+    tp_aot_op(tp, f, code + 141);
+L145: /* SET */
+    tp_set(tp, regs[1], regs[5], regs[4]);
+L146: /* LINE */
+    f->line = code + 146;
+    f->lineno = 322;
+L155: /* GGET */
+    tp_aot_op(tp, f, code + 155);
+L159: /* MOVE */
+    regs[5] = regs[2];
+L160: /* LIST */
+    tp_aot_op(tp, f, code + 160);
+L161: /* CALLP */
+    return code + 161;
+L162: /* RETURN */
+    return code + 162;
+L163: /* EOF */
+    return code + 163;
+}
+
+static const tpd_aot _tp_tinypy_compiler_peephole_aot[] = {
+    {0, _tp_tinypy_compiler_peephole_0},
+    {441, _tp_tinypy_compiler_peephole_441},
+    {1009, _tp_tinypy_compiler_peephole_1009},
+    {1329, _tp_tinypy_compiler_peephole_1329},
+    {1505, _tp_tinypy_compiler_peephole_1505},
+    {1603, _tp_tinypy_compiler_peephole_1603},
+    {2087, _tp_tinypy_compiler_peephole_2087},
+    {2291, _tp_tinypy_compiler_peephole_2291},
+    {2427, _tp_tinypy_compiler_peephole_2427},
+    {2537, _tp_tinypy_compiler_peephole_2537},
+    {2698, _tp_tinypy_compiler_peephole_2698},
+    {2956, _tp_tinypy_compiler_peephole_2956},
+    {3222, _tp_tinypy_compiler_peephole_3222},
+    {3302, _tp_tinypy_compiler_peephole_3302},
+    {3647, _tp_tinypy_compiler_peephole_3647},
+    {3892, _tp_tinypy_compiler_peephole_3892},
+    {4306, _tp_tinypy_compiler_peephole_4306},
+    {5024, _tp_tinypy_compiler_peephole_5024},
+    {5408, _tp_tinypy_compiler_peephole_5408},
+    {5522, _tp_tinypy_compiler_peephole_5522},
+    {6005, _tp_tinypy_compiler_peephole_6005},
+};
+
+void tinypy_compiler_peephole_init(TP) {
+    tp_aot_import(tp, "tinypy.compiler.peephole", _tp_tinypy_compiler_peephole_tpc, sizeof(_tp_tinypy_compiler_peephole_tpc),
+        _tp_tinypy_compiler_peephole_aot, 21);
+}
@@ -0,0 +1,322 @@
+from tinypy.compiler.boot import *
+from tinypy.compiler.opcodes import *
+
+# A peephole pass over the code of encode.py, after the whole module is
+# encoded and before map_tags lays it out, so jumps still go to tags.
+#
+# Every function body is split into nodes, one per instruction or tag:
+#   ['code', i, a, b, c, extra] -- extra are the words that follow it;
+#   ['jump', tag], ['setjmp', tag], ['tag', tag];
+#   ['fnc', r, tag, body] -- a DEF and the nodes of its body;
+#   ['regs', item] -- the preamble.
+# The pass removes or rewrites nodes and puts the items back together.
+#
+# IF, IFN, ITER and FOR skip the next instruction, which must stay where
+# it is and one word long.
+
+SKIPS = [IF, IFN, ITER, FOR]
+# instructions whose next word is an operand.
+OPERANDS = [STRING, GGET, NUMBER, MGET, METHOD]
+BINARY = [ADD, SUB, MUL, DIV, POW, MOD, LSH, RSH, BITAND, BITOR, BITXOR,
+    EQ, NE, LE, LT, GE, GT, IN, NOTIN, GET, MGET]
+UNARY = [NOT, BITNOT, LEN, MOVE]
+LOADS = [NUMBER, STRING, GGET, NONE, CLASS]
+# their only effect on registers is to set a, after reading the others.
+RETARGET = BINARY + UNARY + LOADS + [LIST, DICT, CALL, CALLP, CALLM]
+
+# instructions in and out, for -s of tpc.
+stats = {'before':0, 'after':0}
+
+def parse(out, i, end):
+    # the nodes of out from i up to the tag end; returns them and where
+    # parsing stopped.
+    nodes = []
+    while i < len(out):
+        item = out[i]
+        i += 1
+        kind = item[0]
+        if kind == 'tag':
+            if item[1] == end:
+                return nodes, i
+            nodes.append(['tag', item[1]])
+        elif kind == 'regs':
+            nodes.append(['regs', item])
+        elif kind == 'jump' or kind == 'setjmp':
+            nodes.append([kind, item[1]])
+        elif kind == 'fnc':
+            body, i = parse(out, i, item[2])
+            nodes.append(['fnc', item[1], item[2], body])
+        else:
+            extra = []
+            if item[1] in OPERANDS:
+                extra.append(out[i])
+                i += 1
+            while i < len(out) and out[i][0] == 'data':
+                extra.append(out[i])
+                i += 1
+            nodes.append(['code', item[1], item[2], item[3], item[4], extra])
+    return nodes, i
+
+def unparse(nodes, out):
+    for n in nodes:
+        kind = n[0]
+        if kind == 'code':
+            out.append(('code', n[1], n[2], n[3], n[4]))
+            out.extend(n[5])
+        elif kind == 'regs':
+            out.append(n[1])
+        elif kind == 'fnc':
+            out.append(('fnc', n[1], n[2]))
+            unparse(n[3], out)
+            out.append(('tag', n[2]))
+        else:
+            out.append((kind, n[1]))
+    return out
+
+def count(nodes):
+    n = 0
+    for node in nodes:
+        if node[0] == 'fnc':
+            n += 1 + count(node[3])
+        elif node[0] != 'tag' and node[0] != 'regs':
+            n += 1
+    return n
+
+def span(a, n):
+    r = []
+    for k in range(a, a + n):
+        r.append(k)
+    return r
+
+def uses(n):
+    # the registers n reads.
+    if n[0] == 'fnc': return span(n[1] + 1, 4)
+    if n[0] != 'code': return []
+    i, a, b, c = n[1], n[2], n[3], n[4]
+    if i in BINARY: return [b, c]
+    if i in UNARY: return [b]
+    if i in LOADS or i in [LINE, VAR, PASS, REGS, SETJMP, JUMP]: return []
+    if i in [LIST, DICT, CALLP, CALLM, RANGE]: return span(b, c)
+    if i == CALL: return [b, c, c + 1]
+    if i == FOR: return [b, b + 1, b + 2]
+    if i == METHOD: return [b, c]
+    if i in [IF, IFN, RETURN, RAISE, EOF, FILE, NAME]: return [a]
+    if i == ITER: return [b, c]
+    if i in [DEL, UPDATE, GSET]: return [a, b]
+    return [a, b, c]
+
+def kills(n):
+    # the registers n always sets; FOR and ITER may not.
+    if n[0] == 'fnc': return [n[1]]
+    if n[0] != 'code': return []
+    i = n[1]
+    if i in RETARGET: return [n[2]]
+    if i == METHOD: return [n[2], n[2] + 1]
+    if i == RANGE: return span(n[2], 3)
+    return []
+
+def index_tags(nodes):
+    tags = {}
+    for k in range(len(nodes)):
+        if nodes[k][0] == 'tag':
+            tags[nodes[k][1]] = k
+    return tags
+
+def next_node(nodes, k):
+    # the first node from k that is not a tag.
+    while k < len(nodes) and nodes[k][0] == 'tag':
+        k += 1
+    return k
+
+def after_skip(nodes, k):
+    # whether the node at k is the one a SKIPS instruction may skip.
+    k -= 1
+    while k >= 0 and nodes[k][0] == 'tag':
+        k -= 1
+    return k >= 0 and nodes[k][0] == 'code' and nodes[k][1] in SKIPS
+
+def successors(nodes, tags, k):
+    n = nodes[k]
+    if n[0] == 'jump':
+        return [tags[n[1]]]
+    if n[0] == 'code':
+        if n[1] in [RETURN, RAISE, EOF]:
+            return []
+        if n[1] in SKIPS:
+            k2 = next_node(nodes, k + 1)
+            return [k + 1, k2 + 1]
+    return [k + 1]
+
+def live(nodes, tags, handlers, starts, r):
+    # whether r may be read before it is set, starting at any of starts.
+    # An exception may go to any handler of the function.
+    todo = starts + handlers
+    seen = {}
+    while len(todo):
+        k = todo.pop()
+        if k >= len(nodes) or k in seen:
+            continue
+        seen[k] = True
+        n = nodes[k]
+        if r in uses(n):
+            return True
+        if r in kills(n):
+            continue
+        todo.extend(successors(nodes, tags, k))
+    return False
+
+def is_code(n, i):
+    return n[0] == 'code' and n[1] == i
+
+def remove_dead(nodes):
+    # code after a jump, a return or a raise up to the next tag; a DEF
+    # goes with its body. EOF stays last, VAR only names a register.
+    changed = False
+    k = 0
+    while k < len(nodes):
+        n = nodes[k]
+        k += 1
+        if not (n[0] == 'jump' or is_code(n, RETURN) or is_code(n, RAISE)):
+            continue
+        if after_skip(nodes, k - 1):
+            continue
+        while k < len(nodes) and nodes[k][0] != 'tag':
+            m = nodes[k]
+            if not (is_code(m, EOF) or is_code(m, VAR) or m[0] == 'dead'):
+                nodes[k] = ['dead']
+                changed = True
+            k += 1
+    return changed
+
+def remove_tags(nodes):
+    used = {}
+    for n in nodes:
+        if n[0] == 'jump' or n[0] == 'setjmp':
+            used[n[1]] = True
+    changed = False
+    for k in range(len(nodes)):
+        if nodes[k][0] == 'tag' and nodes[k][1] not in used:
+            nodes[k] = ['dead']
+            changed = True
+    return changed
+
+def thread_jumps(nodes, tags):
+    changed = False
+    for k in range(len(nodes)):
+        n = nodes[k]
+        if n[0] != 'jump':
+            continue
+        # a jump to a jump goes to where that one goes.
+        seen = {}
+        t = next_node(nodes, tags[n[1]])
+        while t < len(nodes) and nodes[t][0] == 'jump' and t not in seen:
+            seen[t] = True
+            if nodes[t][1] == n[1]:
+                break
+            n[1] = nodes[t][1]
+            changed = True
+            t = next_node(nodes, tags[n[1]])
+        # a jump to the next instruction goes.
+        if t == next_node(nodes, k + 1) and tags[n[1]] > k and not after_skip(nodes, k):
+            nodes[k] = ['dead']
+            changed = True
+    return changed
+
+def fold(nodes, tags, handlers):
+    changed = False
+    for k in range(len(nodes) - 1):
+        n = nodes[k]
+        if n[0] != 'code' or after_skip(nodes, k):
+            continue
+        i = n[1]
+        if i == PASS or (i == MOVE and n[2] == n[3]):
+            nodes[k] = ['dead']
+            changed = True
+            continue
+        # the next instruction; a VAR in between does nothing.
+        k2 = k + 1
+        while k2 < len(nodes) and is_code(nodes[k2], VAR):
+            k2 += 1
+        if k2 == len(nodes) or nodes[k2][0] != 'code':
+            continue
+        m = nodes[k2]
+        t = n[2]
+        # NOT t, x; IF t -> IFN x, if t is not read after.
+        if i == NOT and (m[1] == IF or m[1] == IFN) and m[2] == t and k2 == k + 1:
+            if not live(nodes, tags, handlers, successors(nodes, tags, k2), t):
+                if m[1] == IF: m[1] = IFN
+                else: m[1] = IF
+                m[2] = n[3]
+                nodes[k] = ['dead']
+                changed = True
+            continue
+        # X t, ...; MOVE r, t -> X r, ..., if t is not read after.
+        if i in RETARGET and m[1] == MOVE and m[3] == t and m[2] != t:
+            if not live(nodes, tags, handlers, successors(nodes, tags, k2), t):
+                n[2] = m[2]
+                nodes[k2] = ['dead']
+                changed = True
+    return changed
+
+def invert(nodes, tags):
+    # IF r; JUMP a; JUMP b; a: -> IFN r; JUMP b; a:
+    changed = False
+    for k in range(len(nodes) - 3):
+        n = nodes[k]
+        if not (is_code(n, IF) or is_code(n, IFN)):
+            continue
+        j1, j2 = nodes[k + 1], nodes[k + 2]
+        if j1[0] != 'jump' or j2[0] != 'jump':
+            continue
+        if next_node(nodes, k + 3) != next_node(nodes, tags[j1[1]]) or tags[j1[1]] < k + 3:
+            continue
+        if n[1] == IF: n[1] = IFN
+        else: n[1] = IF
+        nodes[k + 1] = j2
+        nodes[k + 2] = ['dead']
+        changed = True
+    return changed
+
+def sweep(nodes):
+    r = []
+    for n in nodes:
+        if n[0] != 'dead':
+            r.append(n)
+    return r
+
+def optimize(nodes):
+    for n in nodes:
+        if n[0] == 'fnc':
+            n[3] = optimize(n[3])
+    changed = True
+    while changed:
+        tags = index_tags(nodes)
+        changed = thread_jumps(nodes, tags)
+        nodes = sweep(nodes)
+        tags = index_tags(nodes)
+        if invert(nodes, tags):
+            changed = True
+            nodes = sweep(nodes)
+            tags = index_tags(nodes)
+        handlers = []
+        for n in nodes:
+            if n[0] == 'setjmp':
+                handlers.append(tags[n[1]])
+        if fold(nodes, tags, handlers):
+            changed = True
+            nodes = sweep(nodes)
+        if remove_dead(nodes):
+            changed = True
+            nodes = sweep(nodes)
+        if remove_tags(nodes):
+            changed = True
+            nodes = sweep(nodes)
+    return nodes
+
+def peephole(out):
+    # out are the items of encode.py; returns them optimized.
+    nodes, i = parse(out, 0, None)
+    stats['before'] += count(nodes)
+    nodes = optimize(nodes)
+    stats['after'] += count(nodes)
+    return unparse(nodes, [])
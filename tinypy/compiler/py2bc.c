@@ -0,0 +1,490 @@
+/* Generated from tinypy/compiler/py2bc.py with tpc -a. Do not modify. */
+#include <tinypy/tp.h>
+
+static unsigned char _tp_tinypy_compiler_py2bc_tpc[] = {
+0x2d,0x08,0x00,0x14,0x00,0x00,0x00,0x00,0x1f,0x09,0x00,0x01,0x66,0x72,0x6f,0x6d,
+0x20,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,
+0x2e,0x62,0x6f,0x6f,0x74,0x20,0x69,0x6d,0x70,0x6f,0x72,0x74,0x20,0x2a,0x00,0x00,
+0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x79,0x32,0x62,0x63,0x2e,0x70,0x79,
+0x00,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x0d,0x00,0x00,0x01,0x00,0x00,0x00,0x01,
+0x3f,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x0a,
+0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,0x5f,0x5f,0x00,0x00,0x0d,0x02,0x00,0x03,
+0x00,0x00,0x00,0x14,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2e,0x62,0x6f,0x6f,0x74,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x04,
+0x00,0x00,0x00,0x01,0x2a,0x00,0x00,0x00,0x37,0x00,0x01,0x03,0x0e,0x01,0x00,0x05,
+0x00,0x00,0x00,0x08,0x5f,0x5f,0x64,0x69,0x63,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,
+0x32,0x01,0x00,0x00,0x1f,0x0b,0x00,0x02,0x69,0x6d,0x70,0x6f,0x72,0x74,0x20,0x74,
+0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2e,0x74,
+0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x20,0x61,0x73,0x20,0x74,0x6f,0x6b,0x65,0x6e,
+0x69,0x7a,0x65,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x0a,0x5f,0x5f,0x69,0x6d,
+0x70,0x6f,0x72,0x74,0x5f,0x5f,0x00,0x00,0x0d,0x02,0x00,0x06,0x00,0x00,0x00,0x18,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2e,
+0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x1d,0x03,0x00,0x00,
+0x37,0x00,0x01,0x03,0x0d,0x01,0x00,0x07,0x00,0x00,0x00,0x08,0x74,0x6f,0x6b,0x65,
+0x6e,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x0f,0x01,0x00,0x00,0x1f,0x0a,0x00,0x03,
+0x69,0x6d,0x70,0x6f,0x72,0x74,0x20,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,
+0x6d,0x70,0x69,0x6c,0x65,0x72,0x2e,0x70,0x61,0x72,0x73,0x65,0x20,0x61,0x73,0x20,
+0x70,0x61,0x72,0x73,0x65,0x00,0x00,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x0a,
+0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,0x5f,0x5f,0x00,0x00,0x0d,0x02,0x00,0x08,
+0x00,0x00,0x00,0x15,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2e,0x70,0x61,0x72,0x73,0x65,0x00,0x00,0x00,0x1d,0x03,0x00,0x00,
+0x37,0x00,0x01,0x03,0x0d,0x01,0x00,0x09,0x00,0x00,0x00,0x05,0x70,0x61,0x72,0x73,
+0x65,0x00,0x00,0x00,0x0f,0x01,0x00,0x00,0x1f,0x0a,0x00,0x04,0x69,0x6d,0x70,0x6f,
+0x72,0x74,0x20,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,
+0x65,0x72,0x2e,0x65,0x6e,0x63,0x6f,0x64,0x65,0x20,0x61,0x73,0x20,0x65,0x6e,0x63,
+0x6f,0x64,0x65,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x0a,0x5f,0x5f,0x69,0x6d,
+0x70,0x6f,0x72,0x74,0x5f,0x5f,0x00,0x00,0x0d,0x02,0x00,0x0a,0x00,0x00,0x00,0x16,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2e,
+0x65,0x6e,0x63,0x6f,0x64,0x65,0x00,0x00,0x1d,0x03,0x00,0x00,0x37,0x00,0x01,0x03,
+0x0d,0x01,0x00,0x0b,0x00,0x00,0x00,0x06,0x65,0x6e,0x63,0x6f,0x64,0x65,0x00,0x00,
+0x0f,0x01,0x00,0x00,0x1f,0x0a,0x00,0x06,0x64,0x65,0x66,0x20,0x63,0x6f,0x6d,0x70,
+0x69,0x6c,0x65,0x28,0x73,0x2c,0x20,0x66,0x6e,0x61,0x6d,0x65,0x2c,0x20,0x6f,0x70,
+0x74,0x69,0x6d,0x69,0x7a,0x65,0x3d,0x54,0x72,0x75,0x65,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x00,0x00,0x04,0x2a,0x24,0x32,0x32,0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x0c,
+0x00,0x00,0x00,0x01,0x73,0x00,0x00,0x00,0x0d,0x06,0x00,0x0d,0x00,0x00,0x00,0x05,
+0x66,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x0d,0x07,0x00,0x0e,0x00,0x00,0x00,0x08,
+0x6f,0x70,0x74,0x69,0x6d,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x1c,0x01,0x05,0x03,
+0x0c,0x05,0x00,0x0f,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x1c,0x02,0x05,0x01,
+0x1d,0x03,0x00,0x00,0x1d,0x04,0x00,0x00,0x11,0x00,0x00,0x7c,0x2d,0x0b,0x00,0x05,
+0x00,0x00,0x00,0x03,0x1f,0x0a,0x00,0x06,0x64,0x65,0x66,0x20,0x63,0x6f,0x6d,0x70,
+0x69,0x6c,0x65,0x28,0x73,0x2c,0x20,0x66,0x6e,0x61,0x6d,0x65,0x2c,0x20,0x6f,0x70,
+0x74,0x69,0x6d,0x69,0x7a,0x65,0x3d,0x54,0x72,0x75,0x65,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x73,0x00,0x00,0x00,0x33,0x01,0x00,0x05,0x66,0x6e,0x61,0x6d,
+0x65,0x00,0x00,0x00,0x33,0x02,0x00,0x08,0x6f,0x70,0x74,0x69,0x6d,0x69,0x7a,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x00,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x70,0x79,0x32,0x62,
+0x63,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,0x22,0x03,0x00,0x00,0x0d,0x03,0x00,0x01,
+0x00,0x00,0x00,0x07,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x00,0x23,0x03,0x00,0x00,
+0x1f,0x09,0x00,0x07,0x20,0x20,0x20,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x73,0x20,0x3d,
+0x20,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x2e,0x74,0x6f,0x6b,0x65,0x6e,0x69,
+0x7a,0x65,0x28,0x73,0x29,0x00,0x00,0x00,0x33,0x03,0x00,0x06,0x74,0x6f,0x6b,0x65,
+0x6e,0x73,0x00,0x00,0x0e,0x06,0x00,0x02,0x00,0x00,0x00,0x08,0x74,0x6f,0x6b,0x65,
+0x6e,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x0d,0x07,0x00,0x02,0x00,0x00,0x00,0x08,
+0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x38,0x03,0x06,0x07,
+0x00,0x00,0x00,0x00,0x10,0x05,0x00,0x00,0x39,0x03,0x03,0x03,0x1f,0x08,0x00,0x08,
+0x20,0x20,0x20,0x20,0x74,0x20,0x3d,0x20,0x70,0x61,0x72,0x73,0x65,0x2e,0x70,0x61,
+0x72,0x73,0x65,0x28,0x73,0x2c,0x74,0x6f,0x6b,0x65,0x6e,0x73,0x29,0x00,0x00,0x00,
+0x33,0x09,0x00,0x01,0x74,0x00,0x00,0x00,0x0e,0x08,0x00,0x03,0x00,0x00,0x00,0x05,
+0x70,0x61,0x72,0x73,0x65,0x00,0x00,0x00,0x0d,0x09,0x00,0x03,0x00,0x00,0x00,0x05,
+0x70,0x61,0x72,0x73,0x65,0x00,0x00,0x00,0x38,0x04,0x08,0x09,0x00,0x00,0x00,0x01,
+0x10,0x06,0x00,0x00,0x10,0x07,0x03,0x00,0x39,0x09,0x04,0x04,0x1f,0x0b,0x00,0x09,
+0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x65,0x6e,0x63,0x6f,0x64,0x65,0x2e,0x65,
+0x6e,0x63,0x6f,0x64,0x65,0x28,0x66,0x6e,0x61,0x6d,0x65,0x2c,0x73,0x2c,0x74,0x2c,
+0x6f,0x70,0x74,0x69,0x6d,0x69,0x7a,0x65,0x29,0x00,0x00,0x00,0x33,0x03,0x00,0x01,
+0x72,0x00,0x00,0x00,0x0e,0x03,0x00,0x04,0x00,0x00,0x00,0x06,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x00,0x00,0x0d,0x04,0x00,0x04,0x00,0x00,0x00,0x06,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x00,0x00,0x38,0x05,0x03,0x04,0x00,0x00,0x00,0x02,0x10,0x07,0x01,0x00,
+0x10,0x08,0x00,0x00,0x10,0x0a,0x02,0x00,0x39,0x03,0x05,0x06,0x1f,0x04,0x00,0x0a,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,
+0x15,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x10,0x00,0x00,0x00,0x07,
+0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x00,0x0f,0x01,0x00,0x00,0x1f,0x06,0x00,0x0c,
+0x64,0x65,0x66,0x20,0x6d,0x61,0x69,0x6e,0x28,0x73,0x72,0x63,0x2c,0x20,0x64,0x65,
+0x73,0x74,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x04,0x2a,0x24,0x33,0x32,
+0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x11,0x00,0x00,0x00,0x03,0x73,0x72,0x63,0x00,
+0x0d,0x07,0x00,0x12,0x00,0x00,0x00,0x04,0x64,0x65,0x73,0x74,0x00,0x00,0x00,0x00,
+0x1c,0x02,0x06,0x02,0x1c,0x03,0x00,0x00,0x1d,0x04,0x00,0x00,0x1d,0x05,0x00,0x00,
+0x11,0x01,0x00,0x49,0x2d,0x06,0x00,0x05,0x00,0x00,0x00,0x00,0x1f,0x06,0x00,0x0c,
+0x64,0x65,0x66,0x20,0x6d,0x61,0x69,0x6e,0x28,0x73,0x72,0x63,0x2c,0x20,0x64,0x65,
+0x73,0x74,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x03,0x73,0x72,0x63,0x00,
+0x33,0x01,0x00,0x04,0x64,0x65,0x73,0x74,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,
+0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x70,0x79,0x32,0x62,0x63,0x2e,0x70,0x79,0x00,0x00,0x00,0x00,
+0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x04,0x6d,0x61,0x69,0x6e,
+0x00,0x00,0x00,0x00,0x23,0x02,0x00,0x00,0x1f,0x05,0x00,0x0d,0x20,0x20,0x20,0x20,
+0x73,0x20,0x3d,0x20,0x72,0x65,0x61,0x64,0x28,0x73,0x72,0x63,0x29,0x00,0x00,0x00,
+0x33,0x02,0x00,0x01,0x73,0x00,0x00,0x00,0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x04,
+0x72,0x65,0x61,0x64,0x00,0x00,0x00,0x00,0x10,0x03,0x00,0x00,0x37,0x02,0x02,0x02,
+0x1f,0x06,0x00,0x0e,0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6d,0x70,
+0x69,0x6c,0x65,0x28,0x73,0x2c,0x73,0x72,0x63,0x29,0x00,0x00,0x33,0x05,0x00,0x01,
+0x72,0x00,0x00,0x00,0x0e,0x03,0x00,0x03,0x00,0x00,0x00,0x07,0x63,0x6f,0x6d,0x70,
+0x69,0x6c,0x65,0x00,0x10,0x04,0x02,0x00,0x10,0x05,0x00,0x00,0x37,0x05,0x03,0x03,
+0x1f,0x05,0x00,0x0f,0x20,0x20,0x20,0x20,0x73,0x61,0x76,0x65,0x28,0x64,0x65,0x73,
+0x74,0x2c,0x20,0x72,0x29,0x00,0x00,0x00,0x0e,0x03,0x00,0x04,0x00,0x00,0x00,0x04,
+0x73,0x61,0x76,0x65,0x00,0x00,0x00,0x00,0x10,0x04,0x01,0x00,0x37,0x02,0x03,0x03,
+0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x13,0x00,0x00,0x00,0x04,0x6d,0x61,0x69,0x6e,
+0x00,0x00,0x00,0x00,0x0f,0x02,0x01,0x00,0x00,0x00,0x00,0x00,
+};
+
+static tpd_code * _tp_tinypy_compiler_py2bc_0(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 31: goto L31;
+        case 39: goto L39;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 61: goto L61;
+        case 66: goto L66;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 94: goto L94;
+        case 99: goto L99;
+        case 107: goto L107;
+        case 108: goto L108;
+        case 109: goto L109;
+        case 113: goto L113;
+        case 114: goto L114;
+        case 125: goto L125;
+        case 130: goto L130;
+        case 138: goto L138;
+        case 139: goto L139;
+        case 140: goto L140;
+        case 144: goto L144;
+        case 145: goto L145;
+        case 156: goto L156;
+        case 159: goto L159;
+        case 162: goto L162;
+        case 166: goto L166;
+        case 171: goto L171;
+        case 172: goto L172;
+        case 175: goto L175;
+        case 176: goto L176;
+        case 177: goto L177;
+        case 178: goto L178;
+        case 302: goto L302;
+        case 306: goto L306;
+        case 307: goto L307;
+        case 314: goto L314;
+        case 317: goto L317;
+        case 320: goto L320;
+        case 324: goto L324;
+        case 325: goto L325;
+        case 326: goto L326;
+        case 327: goto L327;
+        case 328: goto L328;
+        case 401: goto L401;
+        case 405: goto L405;
+        case 406: goto L406;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 1;
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[0];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L25: /* NAME */
+    f->name = regs[0];
+L26: /* GGET */
+    tp_aot_op(tp, f, code + 26);
+L31: /* STRING */
+    tp_aot_op(tp, f, code + 31);
+L39: /* STRING */
+    tp_aot_op(tp, f, code + 39);
+L42: /* CALLP */
+    return code + 42;
+L43: /* GGET */
+    tp_aot_op(tp, f, code + 43);
+L48: /* UPDATE */
+    tp_aot_op(tp, f, code + 48);
+L49: /* LINE */
+    f->line = code + 49;
+    f->lineno = 2;
+L61: /* GGET */
+    tp_aot_op(tp, f, code + 61);
+L66: /* STRING */
+    tp_aot_op(tp, f, code + 66);
+L75: /* NONE */
+    regs[3] = tp_None;
+L76: /* CALLP */
+    return code + 76;
+L77: /* STRING */
+    tp_aot_op(tp, f, code + 77);
+L82: /* GSET */
+    tp_set(tp, f->globals, regs[1], regs[0]);
+L83: /* LINE */
+    f->line = code + 83;
+    f->lineno = 3;
+L94: /* GGET */
+    tp_aot_op(tp, f, code + 94);
+L99: /* STRING */
+    tp_aot_op(tp, f, code + 99);
+L107: /* NONE */
+    regs[3] = tp_None;
+L108: /* CALLP */
+    return code + 108;
+L109: /* STRING */
+    tp_aot_op(tp, f, code + 109);
+L113: /* GSET */
+    tp_set(tp, f->globals, regs[1], regs[0]);
+L114: /* LINE */
+    f->line = code + 114;
+    f->lineno = 4;
+L125: /* GGET */
+    tp_aot_op(tp, f, code + 125);
+L130: /* STRING */
+    tp_aot_op(tp, f, code + 130);
+L138: /* NONE */
+    regs[3] = tp_None;
+L139: /* CALLP */
+    return code + 139;
+L140: /* STRING */
+    tp_aot_op(tp, f, code + 140);
+L144: /* GSET */
+    tp_set(tp, f->globals, regs[1], regs[0]);
+L145: /* LINE */
+    f->line = code + 145;
+    f->lineno = 6;
+L156: /* VAR */
+L159: /* STRING */
+    tp_aot_op(tp, f, code + 159);
+L162: /* STRING */
+    tp_aot_op(tp, f, code + 162);
+L166: /* STRING */
+    tp_aot_op(tp, f, code + 166);
+L171: /* LIST */
+    tp_aot_op(tp, f, code + 171);
+L172: /* NUMBER */
+    tp_aot_op(tp, f, code + 172);
+L175: /* LIST */
+    tp_aot_op(tp, f, code + 175);
+L176: /* NONE */
+    regs[3] = tp_None;
+L177: /* NONE */
+    regs[4] = tp_None;
+L178: /* DEF */
+    tp_aot_op(tp, f, code + 178);
+L302: /* STRING */
+    tp_aot_op(tp, f, code + 302);
+L306: /* GSET */
+    tp_set(tp, f->globals, regs[1], regs[0]);
+L307: /* LINE */
+    f->line = code + 307;
+    f->lineno = 12;
+L314: /* VAR */
+L317: /* STRING */
+    tp_aot_op(tp, f, code + 317);
+L320: /* STRING */
+    tp_aot_op(tp, f, code + 320);
+L324: /* LIST */
+    tp_aot_op(tp, f, code + 324);
+L325: /* LIST */
+    tp_aot_op(tp, f, code + 325);
+L326: /* NONE */
+    regs[4] = tp_None;
+L327: /* NONE */
+    regs[5] = tp_None;
+L328: /* DEF */
+    tp_aot_op(tp, f, code + 328);
+L401: /* STRING */
+    tp_aot_op(tp, f, code + 401);
+L405: /* GSET */
+    tp_set(tp, f->globals, regs[2], regs[1]);
+L406: /* EOF */
+    return code + 406;
+}
+
+static tpd_code * _tp_tinypy_compiler_py2bc_179(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 13: goto L13;
+        case 15: goto L15;
+        case 18: goto L18;
+        case 22: goto L22;
+        case 31: goto L31;
+        case 32: goto L32;
+        case 36: goto L36;
+        case 37: goto L37;
+        case 47: goto L47;
+        case 50: goto L50;
+        case 55: goto L55;
+        case 60: goto L60;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 73: goto L73;
+        case 75: goto L75;
+        case 79: goto L79;
+        case 83: goto L83;
+        case 85: goto L85;
+        case 86: goto L86;
+        case 87: goto L87;
+        case 88: goto L88;
+        case 100: goto L100;
+        case 102: goto L102;
+        case 106: goto L106;
+        case 110: goto L110;
+        case 112: goto L112;
+        case 113: goto L113;
+        case 114: goto L114;
+        case 115: goto L115;
+        case 116: goto L116;
+        case 121: goto L121;
+        case 122: goto L122;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 6;
+L13: /* VAR */
+L15: /* VAR */
+L18: /* VAR */
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L31: /* FILE */
+    f->fname = regs[3];
+L32: /* STRING */
+    tp_aot_op(tp, f, code + 32);
+L36: /* NAME */
+    f->name = regs[3];
+L37: /* LINE */
+    f->line = code + 37;
+    f->lineno = 7;
+L47: /* VAR */
+L50: /* GGET */
+    tp_aot_op(tp, f, code + 50);
+L55: /* STRING */
+    tp_aot_op(tp, f, code + 55);
+L60: /* METHOD */
+    tp_aot_op(tp, f, code + 60);
+L62: /* MOVE */
+    regs[5] = regs[0];
+L63: /* CALLM */
+    return code + 63;
+L64: /* LINE */
+    f->line = code + 64;
+    f->lineno = 8;
+L73: /* VAR */
+L75: /* GGET */
+    tp_aot_op(tp, f, code + 75);
+L79: /* STRING */
+    tp_aot_op(tp, f, code + 79);
+L83: /* METHOD */
+    tp_aot_op(tp, f, code + 83);
+L85: /* MOVE */
+    regs[6] = regs[0];
+L86: /* MOVE */
+    regs[7] = regs[3];
+L87: /* CALLM */
+    return code + 87;
+L88: /* LINE */
+    f->line = code + 88;
+    f->lineno = 9;
+L100: /* VAR */
+L102: /* GGET */
+    tp_aot_op(tp, f, code + 102);
+L106: /* STRING */
+    tp_aot_op(tp, f, code + 106);
+L110: /* METHOD */
+    tp_aot_op(tp, f, code + 110);
+L112: /* MOVE */
+    regs[7] = regs[1];
+L113: /* MOVE */
+    regs[8] = regs[0];
+L114: /* MOVE */
+    regs[10] = regs[2];
+L115: /* CALLM */
+    return code + 115;
+L116: /* LINE */
+    f->line = code + 116;
+    f->lineno = 10;
+L121: /* RETURN */
+    return code + 121;
+L122: /* EOF */
+    return code + 122;
+}
+
+static tpd_code * _tp_tinypy_compiler_py2bc_329(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 14: goto L14;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 28: goto L28;
+        case 29: goto L29;
+        case 35: goto L35;
+        case 37: goto L37;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 50: goto L50;
+        case 52: goto L52;
+        case 56: goto L56;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 65: goto L65;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 71: goto L71;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 12;
+L9: /* VAR */
+L11: /* VAR */
+L14: /* STRING */
+    tp_aot_op(tp, f, code + 14);
+L23: /* FILE */
+    f->fname = regs[2];
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L28: /* NAME */
+    f->name = regs[2];
+L29: /* LINE */
+    f->line = code + 29;
+    f->lineno = 13;
+L35: /* VAR */
+L37: /* GGET */
+    tp_aot_op(tp, f, code + 37);
+L41: /* MOVE */
+    regs[3] = regs[0];
+L42: /* CALLP */
+    return code + 42;
+L43: /* LINE */
+    f->line = code + 43;
+    f->lineno = 14;
+L50: /* VAR */
+L52: /* GGET */
+    tp_aot_op(tp, f, code + 52);
+L56: /* MOVE */
+    regs[4] = regs[2];
+L57: /* MOVE */
+    regs[5] = regs[0];
+L58: /* CALLP */
+    return code + 58;
+L59: /* LINE */
+    f->line = code + 59;
+    f->lineno = 15;
+L65: /* GGET */
+    tp_aot_op(tp, f, code + 65);
+L69: /* MOVE */
+    regs[4] = regs[1];
+L70: /* CALLP */
+    return code + 70;
+L71: /* EOF */
+    return code + 71;
+}
+
+static const tpd_aot _tp_tinypy_compiler_py2bc_aot[] = {
+    {0, _tp_tinypy_compiler_py2bc_0},
+    {179, _tp_tinypy_compiler_py2bc_179},
+    {329, _tp_tinypy_compiler_py2bc_329},
+};
+
+void tinypy_compiler_py2bc_init(TP) {
+    tp_aot_import(tp, "tinypy.compiler.py2bc", _tp_tinypy_compiler_py2bc_tpc, sizeof(_tp_tinypy_compiler_py2bc_tpc),
+        _tp_tinypy_compiler_py2bc_aot, 3);
+}
@@ -3,10 +3,10 @@ import tinypy.compiler.tokenize as tokenize
 import tinypy.compiler.parse as parse
 import tinypy.compiler.encode as encode
 
-def compile(s, fname):
+def compile(s, fname, optimize=True):
     tokens = tokenize.tokenize(s)
     t = parse.parse(s,tokens)
-    r = encode.encode(fname,s,t)
+    r = encode.encode(fname,s,t,optimize)
     return r
 
 def main(src, dest):
@@ -0,0 +1,5932 @@
+/* Generated from tinypy/compiler/regalloc.py with tpc -a. Do not modify. */
+#include <tinypy/tp.h>
+
+static unsigned char _tp_tinypy_compiler_regalloc_tpc[] = {
+0x2d,0x0e,0x00,0x20,0x00,0x00,0x00,0x00,0x1f,0x09,0x00,0x01,0x66,0x72,0x6f,0x6d,
+0x20,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,
+0x2e,0x62,0x6f,0x6f,0x74,0x20,0x69,0x6d,0x70,0x6f,0x72,0x74,0x20,0x2a,0x00,0x00,
+0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x72,0x65,0x67,0x61,0x6c,0x6c,0x6f,0x63,
+0x2e,0x70,0x79,0x00,0x22,0x00,0x00,0x00,0x0d,0x00,0x00,0x01,0x00,0x00,0x00,0x01,
+0x3f,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x0a,
+0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,0x5f,0x5f,0x00,0x00,0x0d,0x02,0x00,0x03,
+0x00,0x00,0x00,0x14,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2e,0x62,0x6f,0x6f,0x74,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x04,
+0x00,0x00,0x00,0x01,0x2a,0x00,0x00,0x00,0x37,0x00,0x01,0x03,0x0e,0x01,0x00,0x05,
+0x00,0x00,0x00,0x08,0x5f,0x5f,0x64,0x69,0x63,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,
+0x32,0x01,0x00,0x00,0x1f,0x0a,0x00,0x02,0x66,0x72,0x6f,0x6d,0x20,0x74,0x69,0x6e,
+0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2e,0x6f,0x70,0x63,
+0x6f,0x64,0x65,0x73,0x20,0x69,0x6d,0x70,0x6f,0x72,0x74,0x20,0x2a,0x00,0x00,0x00,
+0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x0a,0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,
+0x5f,0x5f,0x00,0x00,0x0d,0x02,0x00,0x06,0x00,0x00,0x00,0x17,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2e,0x6f,0x70,0x63,0x6f,
+0x64,0x65,0x73,0x00,0x0d,0x03,0x00,0x04,0x00,0x00,0x00,0x01,0x2a,0x00,0x00,0x00,
+0x37,0x00,0x01,0x03,0x0e,0x01,0x00,0x05,0x00,0x00,0x00,0x08,0x5f,0x5f,0x64,0x69,
+0x63,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,0x32,0x01,0x00,0x00,0x1f,0x0b,0x00,0x03,
+0x69,0x6d,0x70,0x6f,0x72,0x74,0x20,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,
+0x6d,0x70,0x69,0x6c,0x65,0x72,0x2e,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x20,
+0x61,0x73,0x20,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x00,0x0e,0x01,0x00,0x02,
+0x00,0x00,0x00,0x0a,0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,0x5f,0x5f,0x00,0x00,
+0x0d,0x02,0x00,0x07,0x00,0x00,0x00,0x18,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2e,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,
+0x00,0x00,0x00,0x00,0x1d,0x03,0x00,0x00,0x37,0x00,0x01,0x03,0x0d,0x01,0x00,0x08,
+0x00,0x00,0x00,0x08,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x00,0x00,0x00,0x00,
+0x0f,0x01,0x00,0x00,0x1f,0x08,0x00,0x14,0x73,0x74,0x61,0x74,0x73,0x20,0x3d,0x20,
+0x7b,0x27,0x62,0x65,0x66,0x6f,0x72,0x65,0x27,0x3a,0x30,0x2c,0x20,0x27,0x61,0x66,
+0x74,0x65,0x72,0x27,0x3a,0x30,0x7d,0x00,0x0d,0x00,0x00,0x09,0x00,0x00,0x00,0x05,
+0x73,0x74,0x61,0x74,0x73,0x00,0x00,0x00,0x0d,0x02,0x00,0x0a,0x00,0x00,0x00,0x06,
+0x62,0x65,0x66,0x6f,0x72,0x65,0x00,0x00,0x0c,0x03,0x00,0x0b,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x0c,0x00,0x00,0x00,0x05,0x61,0x66,0x74,0x65,
+0x72,0x00,0x00,0x00,0x0c,0x05,0x00,0x0b,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x1b,0x01,0x02,0x04,0x0f,0x00,0x01,0x00,0x1f,0x04,0x00,0x16,0x64,0x65,0x66,0x20,
+0x66,0x69,0x65,0x6c,0x64,0x73,0x28,0x6e,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x04,
+0x2a,0x24,0x32,0x33,0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x0d,0x00,0x00,0x00,0x01,
+0x6e,0x00,0x00,0x00,0x1c,0x01,0x05,0x01,0x1c,0x02,0x00,0x00,0x1d,0x03,0x00,0x00,
+0x1d,0x04,0x00,0x00,0x11,0x00,0x01,0x7e,0x2d,0x0c,0x00,0x24,0x00,0x00,0x00,0x03,
+0x1f,0x04,0x00,0x16,0x64,0x65,0x66,0x20,0x66,0x69,0x65,0x6c,0x64,0x73,0x28,0x6e,
+0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x01,0x6e,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x72,0x65,0x67,0x61,0x6c,0x6c,0x6f,0x63,0x2e,0x70,0x79,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x06,0x66,0x69,0x65,0x6c,
+0x64,0x73,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x09,0x00,0x18,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x6e,0x5b,0x30,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x66,0x6e,0x63,0x27,
+0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,0x31,0x5d,0x00,0x00,0x00,0x00,
+0x0c,0x02,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x01,0x00,0x02,
+0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x66,0x6e,0x63,0x00,0x18,0x01,0x01,0x02,
+0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x06,0x0c,0x02,0x00,0x04,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x1c,0x01,0x02,0x01,0x15,0x01,0x00,0x00,0x1f,0x09,0x00,0x19,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,0x5b,0x30,0x5d,0x20,0x21,0x3d,0x20,0x27,
+0x63,0x6f,0x64,0x65,0x27,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,0x5d,
+0x00,0x00,0x00,0x00,0x0c,0x02,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x01,0x00,0x02,0x0d,0x02,0x00,0x05,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,
+0x00,0x00,0x00,0x00,0x24,0x01,0x01,0x02,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x03,
+0x1c,0x01,0x00,0x00,0x15,0x01,0x00,0x00,0x1f,0x04,0x00,0x1a,0x20,0x20,0x20,0x20,
+0x69,0x20,0x3d,0x20,0x6e,0x5b,0x31,0x5d,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x01,
+0x69,0x00,0x00,0x00,0x0c,0x03,0x00,0x04,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x01,0x00,0x03,0x1f,0x0c,0x00,0x1b,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,
+0x20,0x69,0x6e,0x20,0x5b,0x4c,0x49,0x53,0x54,0x2c,0x20,0x44,0x49,0x43,0x54,0x2c,
+0x20,0x43,0x41,0x4c,0x4c,0x50,0x2c,0x20,0x43,0x41,0x4c,0x4c,0x4d,0x2c,0x20,0x52,
+0x41,0x4e,0x47,0x45,0x5d,0x3a,0x00,0x00,0x0e,0x04,0x00,0x06,0x00,0x00,0x00,0x04,
+0x4c,0x49,0x53,0x54,0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x07,0x00,0x00,0x00,0x04,
+0x44,0x49,0x43,0x54,0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x08,0x00,0x00,0x00,0x05,
+0x43,0x41,0x4c,0x4c,0x50,0x00,0x00,0x00,0x0e,0x07,0x00,0x09,0x00,0x00,0x00,0x05,
+0x43,0x41,0x4c,0x4c,0x4d,0x00,0x00,0x00,0x0e,0x08,0x00,0x0a,0x00,0x00,0x00,0x05,
+0x52,0x41,0x4e,0x47,0x45,0x00,0x00,0x00,0x1c,0x03,0x04,0x05,0x25,0x02,0x01,0x03,
+0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x29,0x1f,0x09,0x00,0x1c,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,0x5b,0x34,0x5d,0x20,0x3d,0x3d,0x20,0x30,
+0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,0x32,0x5d,0x00,0x00,0x00,0x00,
+0x0c,0x03,0x00,0x0b,0x00,0x00,0x69,0x04,0x04,0x00,0x00,0x00,0x0a,0x02,0x00,0x03,
+0x0c,0x03,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x18,0x02,0x02,0x03,
+0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x06,0x0c,0x03,0x00,0x0c,0x00,0x00,0x69,0x04,
+0x02,0x00,0x00,0x00,0x1c,0x02,0x03,0x01,0x15,0x02,0x00,0x00,0x1f,0x06,0x00,0x1d,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,
+0x32,0x2c,0x20,0x33,0x5d,0x00,0x00,0x00,0x0c,0x03,0x00,0x0c,0x00,0x00,0x69,0x04,
+0x02,0x00,0x00,0x00,0x0c,0x04,0x00,0x0d,0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,
+0x1c,0x02,0x03,0x02,0x15,0x02,0x00,0x00,0x1f,0x18,0x00,0x1e,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x69,0x20,0x69,0x6e,0x20,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,
+0x2e,0x42,0x49,0x4e,0x41,0x52,0x59,0x20,0x6f,0x72,0x20,0x69,0x20,0x69,0x6e,0x20,
+0x5b,0x43,0x41,0x4c,0x4c,0x2c,0x20,0x4d,0x45,0x54,0x48,0x4f,0x44,0x2c,0x20,0x49,
+0x54,0x45,0x52,0x2c,0x20,0x49,0x47,0x45,0x54,0x2c,0x20,0x53,0x45,0x54,0x2c,0x20,
+0x41,0x53,0x53,0x45,0x52,0x54,0x5d,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+0x5b,0x32,0x2c,0x20,0x33,0x2c,0x20,0x34,0x5d,0x00,0x00,0x00,0x0e,0x03,0x00,0x0e,
+0x00,0x00,0x00,0x08,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x00,0x00,0x00,0x00,
+0x0d,0x04,0x00,0x0f,0x00,0x00,0x00,0x06,0x42,0x49,0x4e,0x41,0x52,0x59,0x00,0x00,
+0x09,0x03,0x03,0x04,0x00,0x00,0x00,0x00,0x25,0x02,0x01,0x03,0x2f,0x02,0x00,0x00,
+0x13,0x00,0x00,0x1a,0x0e,0x04,0x00,0x10,0x00,0x00,0x00,0x04,0x43,0x41,0x4c,0x4c,
+0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x11,0x00,0x00,0x00,0x06,0x4d,0x45,0x54,0x48,
+0x4f,0x44,0x00,0x00,0x0e,0x06,0x00,0x12,0x00,0x00,0x00,0x04,0x49,0x54,0x45,0x52,
+0x00,0x00,0x00,0x00,0x0e,0x07,0x00,0x13,0x00,0x00,0x00,0x04,0x49,0x47,0x45,0x54,
+0x00,0x00,0x00,0x00,0x0e,0x08,0x00,0x14,0x00,0x00,0x00,0x03,0x53,0x45,0x54,0x00,
+0x0e,0x09,0x00,0x15,0x00,0x00,0x00,0x06,0x41,0x53,0x53,0x45,0x52,0x54,0x00,0x00,
+0x1c,0x03,0x04,0x06,0x25,0x02,0x01,0x03,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x0c,
+0x0c,0x03,0x00,0x0c,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x0c,0x04,0x00,0x0d,
+0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,0x0c,0x05,0x00,0x0b,0x00,0x00,0x69,0x04,
+0x04,0x00,0x00,0x00,0x1c,0x02,0x03,0x03,0x15,0x02,0x00,0x00,0x1f,0x13,0x00,0x1f,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,0x20,0x69,0x6e,0x20,0x70,0x65,0x65,0x70,
+0x68,0x6f,0x6c,0x65,0x2e,0x55,0x4e,0x41,0x52,0x59,0x20,0x6f,0x72,0x20,0x69,0x20,
+0x69,0x6e,0x20,0x5b,0x46,0x4f,0x52,0x2c,0x20,0x44,0x45,0x4c,0x2c,0x20,0x55,0x50,
+0x44,0x41,0x54,0x45,0x2c,0x20,0x47,0x53,0x45,0x54,0x5d,0x3a,0x20,0x72,0x65,0x74,
+0x75,0x72,0x6e,0x20,0x5b,0x32,0x2c,0x20,0x33,0x5d,0x00,0x00,0x0e,0x03,0x00,0x0e,
+0x00,0x00,0x00,0x08,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x00,0x00,0x00,0x00,
+0x0d,0x04,0x00,0x16,0x00,0x00,0x00,0x05,0x55,0x4e,0x41,0x52,0x59,0x00,0x00,0x00,
+0x09,0x03,0x03,0x04,0x00,0x00,0x00,0x01,0x25,0x02,0x01,0x03,0x2f,0x02,0x00,0x00,
+0x13,0x00,0x00,0x11,0x0e,0x04,0x00,0x17,0x00,0x00,0x00,0x03,0x46,0x4f,0x52,0x00,
+0x0e,0x05,0x00,0x18,0x00,0x00,0x00,0x03,0x44,0x45,0x4c,0x00,0x0e,0x06,0x00,0x19,
+0x00,0x00,0x00,0x06,0x55,0x50,0x44,0x41,0x54,0x45,0x00,0x00,0x0e,0x07,0x00,0x1a,
+0x00,0x00,0x00,0x04,0x47,0x53,0x45,0x54,0x00,0x00,0x00,0x00,0x1c,0x03,0x04,0x04,
+0x25,0x02,0x01,0x03,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x09,0x0c,0x03,0x00,0x0c,
+0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x0c,0x04,0x00,0x0d,0x00,0x00,0x69,0x04,
+0x03,0x00,0x00,0x00,0x1c,0x02,0x03,0x02,0x15,0x02,0x00,0x00,0x1f,0x18,0x00,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,0x20,0x69,0x6e,0x20,0x70,0x65,0x65,0x70,
+0x68,0x6f,0x6c,0x65,0x2e,0x4c,0x4f,0x41,0x44,0x53,0x20,0x6f,0x72,0x20,0x69,0x20,
+0x69,0x6e,0x20,0x5b,0x49,0x46,0x2c,0x20,0x49,0x46,0x4e,0x2c,0x20,0x52,0x45,0x54,
+0x55,0x52,0x4e,0x2c,0x20,0x52,0x41,0x49,0x53,0x45,0x2c,0x20,0x45,0x4f,0x46,0x2c,
+0x20,0x46,0x49,0x4c,0x45,0x2c,0x20,0x4e,0x41,0x4d,0x45,0x2c,0x20,0x56,0x41,0x52,
+0x5d,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,0x32,0x5d,0x00,0x00,0x00,
+0x0e,0x03,0x00,0x0e,0x00,0x00,0x00,0x08,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x1b,0x00,0x00,0x00,0x05,0x4c,0x4f,0x41,0x44,
+0x53,0x00,0x00,0x00,0x09,0x03,0x03,0x04,0x00,0x00,0x00,0x02,0x25,0x02,0x01,0x03,
+0x2f,0x02,0x00,0x00,0x13,0x00,0x00,0x1f,0x0e,0x04,0x00,0x1c,0x00,0x00,0x00,0x02,
+0x49,0x46,0x00,0x00,0x0e,0x05,0x00,0x1d,0x00,0x00,0x00,0x03,0x49,0x46,0x4e,0x00,
+0x0e,0x06,0x00,0x1e,0x00,0x00,0x00,0x06,0x52,0x45,0x54,0x55,0x52,0x4e,0x00,0x00,
+0x0e,0x07,0x00,0x1f,0x00,0x00,0x00,0x05,0x52,0x41,0x49,0x53,0x45,0x00,0x00,0x00,
+0x0e,0x08,0x00,0x20,0x00,0x00,0x00,0x03,0x45,0x4f,0x46,0x00,0x0e,0x09,0x00,0x21,
+0x00,0x00,0x00,0x04,0x46,0x49,0x4c,0x45,0x00,0x00,0x00,0x00,0x0e,0x0a,0x00,0x22,
+0x00,0x00,0x00,0x04,0x4e,0x41,0x4d,0x45,0x00,0x00,0x00,0x00,0x0e,0x0b,0x00,0x23,
+0x00,0x00,0x00,0x03,0x56,0x41,0x52,0x00,0x1c,0x03,0x04,0x08,0x25,0x02,0x01,0x03,
+0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x06,0x0c,0x03,0x00,0x0c,0x00,0x00,0x69,0x04,
+0x02,0x00,0x00,0x00,0x1c,0x02,0x03,0x01,0x15,0x02,0x00,0x00,0x1f,0x04,0x00,0x21,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,0x5d,0x00,0x00,0x00,
+0x1c,0x02,0x00,0x00,0x15,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x0e,
+0x00,0x00,0x00,0x06,0x66,0x69,0x65,0x6c,0x64,0x73,0x00,0x00,0x0f,0x01,0x00,0x00,
+0x1f,0x04,0x00,0x23,0x64,0x65,0x66,0x20,0x77,0x72,0x69,0x74,0x65,0x73,0x28,0x6e,
+0x29,0x3a,0x00,0x00,0x33,0x01,0x00,0x04,0x2a,0x24,0x33,0x30,0x00,0x00,0x00,0x00,
+0x0d,0x06,0x00,0x0d,0x00,0x00,0x00,0x01,0x6e,0x00,0x00,0x00,0x1c,0x02,0x06,0x01,
+0x1c,0x03,0x00,0x00,0x1d,0x04,0x00,0x00,0x1d,0x05,0x00,0x00,0x11,0x01,0x00,0xb2,
+0x2d,0x08,0x00,0x0d,0x00,0x00,0x00,0x01,0x1f,0x04,0x00,0x23,0x64,0x65,0x66,0x20,
+0x77,0x72,0x69,0x74,0x65,0x73,0x28,0x6e,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x01,
+0x6e,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x72,0x65,0x67,0x61,
+0x6c,0x6c,0x6f,0x63,0x2e,0x70,0x79,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,
+0x00,0x00,0x00,0x06,0x77,0x72,0x69,0x74,0x65,0x73,0x00,0x00,0x23,0x01,0x00,0x00,
+0x1f,0x07,0x00,0x25,0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x70,0x65,0x65,0x70,
+0x68,0x6f,0x6c,0x65,0x2e,0x6b,0x69,0x6c,0x6c,0x73,0x28,0x6e,0x29,0x00,0x00,0x00,
+0x33,0x01,0x00,0x01,0x72,0x00,0x00,0x00,0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x08,
+0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x03,
+0x00,0x00,0x00,0x05,0x6b,0x69,0x6c,0x6c,0x73,0x00,0x00,0x00,0x38,0x04,0x02,0x03,
+0x00,0x00,0x00,0x00,0x10,0x06,0x00,0x00,0x39,0x01,0x04,0x03,0x1f,0x08,0x00,0x26,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,0x5b,0x30,0x5d,0x20,0x21,0x3d,0x20,0x27,
+0x63,0x6f,0x64,0x65,0x27,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x00,
+0x0c,0x04,0x00,0x04,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x07,0x00,0x04,
+0x0d,0x04,0x00,0x05,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,
+0x24,0x07,0x07,0x04,0x16,0x07,0x00,0x00,0x13,0x00,0x00,0x02,0x15,0x01,0x00,0x00,
+0x1f,0x0a,0x00,0x27,0x20,0x20,0x20,0x20,0x69,0x2c,0x20,0x61,0x2c,0x20,0x62,0x2c,
+0x20,0x63,0x20,0x3d,0x20,0x6e,0x5b,0x31,0x5d,0x2c,0x20,0x6e,0x5b,0x32,0x5d,0x2c,
+0x20,0x6e,0x5b,0x33,0x5d,0x2c,0x20,0x6e,0x5b,0x34,0x5d,0x00,0x0c,0x05,0x00,0x06,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x07,0x00,0x05,0x0c,0x06,0x00,0x07,
+0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x0a,0x04,0x00,0x06,0x0c,0x02,0x00,0x08,
+0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,0x0a,0x05,0x00,0x02,0x0c,0x03,0x00,0x09,
+0x00,0x00,0x69,0x04,0x04,0x00,0x00,0x00,0x0a,0x06,0x00,0x03,0x33,0x02,0x00,0x01,
+0x69,0x00,0x00,0x00,0x10,0x02,0x07,0x00,0x33,0x07,0x00,0x01,0x61,0x00,0x00,0x00,
+0x10,0x07,0x04,0x00,0x33,0x04,0x00,0x01,0x62,0x00,0x00,0x00,0x10,0x04,0x05,0x00,
+0x33,0x05,0x00,0x01,0x63,0x00,0x00,0x00,0x10,0x05,0x06,0x00,0x1f,0x0a,0x00,0x28,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,0x20,0x3d,0x3d,0x20,0x46,0x4f,0x52,0x3a,
+0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,0x61,0x2c,0x20,0x62,0x2c,0x20,0x62,
+0x20,0x2b,0x20,0x32,0x5d,0x00,0x00,0x00,0x0e,0x03,0x00,0x0a,0x00,0x00,0x00,0x03,
+0x46,0x4f,0x52,0x00,0x18,0x06,0x02,0x03,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x08,
+0x10,0x03,0x07,0x00,0x0c,0x00,0x00,0x07,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,
+0x01,0x05,0x04,0x00,0x1c,0x06,0x03,0x03,0x15,0x06,0x00,0x00,0x1f,0x08,0x00,0x29,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,0x20,0x3d,0x3d,0x20,0x49,0x54,0x45,0x52,
+0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,0x61,0x2c,0x20,0x63,0x5d,0x00,
+0x0e,0x03,0x00,0x0b,0x00,0x00,0x00,0x04,0x49,0x54,0x45,0x52,0x00,0x00,0x00,0x00,
+0x18,0x06,0x02,0x03,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x05,0x10,0x03,0x07,0x00,
+0x10,0x04,0x05,0x00,0x1c,0x06,0x03,0x02,0x15,0x06,0x00,0x00,0x1f,0x08,0x00,0x2a,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,0x20,0x3d,0x3d,0x20,0x49,0x47,0x45,0x54,
+0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,0x61,0x5d,0x00,0x00,0x00,0x00,
+0x0e,0x03,0x00,0x0c,0x00,0x00,0x00,0x04,0x49,0x47,0x45,0x54,0x00,0x00,0x00,0x00,
+0x18,0x06,0x02,0x03,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x04,0x10,0x03,0x07,0x00,
+0x1c,0x06,0x03,0x01,0x15,0x06,0x00,0x00,0x1f,0x04,0x00,0x2b,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,0x15,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x0f,0x00,0x00,0x00,0x06,0x77,0x72,0x69,0x74,
+0x65,0x73,0x00,0x00,0x0f,0x02,0x01,0x00,0x1f,0x04,0x00,0x2d,0x64,0x65,0x66,0x20,
+0x72,0x75,0x6e,0x73,0x28,0x6e,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x02,0x00,0x04,
+0x2a,0x24,0x33,0x37,0x00,0x00,0x00,0x00,0x0d,0x07,0x00,0x0d,0x00,0x00,0x00,0x01,
+0x6e,0x00,0x00,0x00,0x1c,0x03,0x07,0x01,0x1c,0x04,0x00,0x00,0x1d,0x05,0x00,0x00,
+0x1d,0x06,0x00,0x00,0x11,0x02,0x01,0x35,0x2d,0x0c,0x00,0x13,0x00,0x00,0x00,0x05,
+0x1f,0x04,0x00,0x2d,0x64,0x65,0x66,0x20,0x72,0x75,0x6e,0x73,0x28,0x6e,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x6e,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x72,0x65,0x67,0x61,0x6c,0x6c,0x6f,0x63,0x2e,0x70,0x79,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x04,0x72,0x75,0x6e,0x73,
+0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x0b,0x00,0x2f,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x6e,0x5b,0x30,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x66,0x6e,0x63,0x27,
+0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,0x5b,0x6e,0x5b,0x31,0x5d,0x2c,
+0x20,0x35,0x5d,0x5d,0x00,0x00,0x00,0x00,0x0c,0x02,0x00,0x02,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x01,0x00,0x02,0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x03,
+0x66,0x6e,0x63,0x00,0x18,0x01,0x01,0x02,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x0b,
+0x0c,0x03,0x00,0x04,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x04,0x00,0x03,
+0x0c,0x05,0x00,0x05,0x00,0x00,0x69,0x04,0x05,0x00,0x00,0x00,0x1c,0x02,0x04,0x02,
+0x1c,0x01,0x02,0x01,0x15,0x01,0x00,0x00,0x1f,0x09,0x00,0x30,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x6e,0x5b,0x30,0x5d,0x20,0x21,0x3d,0x20,0x27,0x63,0x6f,0x64,0x65,
+0x27,0x3a,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5b,0x5d,0x00,0x00,0x00,0x00,
+0x0c,0x02,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x01,0x00,0x02,
+0x0d,0x02,0x00,0x06,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,
+0x24,0x01,0x01,0x02,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x03,0x1c,0x01,0x00,0x00,
+0x15,0x01,0x00,0x00,0x1f,0x0a,0x00,0x31,0x20,0x20,0x20,0x20,0x69,0x2c,0x20,0x61,
+0x2c,0x20,0x62,0x2c,0x20,0x63,0x20,0x3d,0x20,0x6e,0x5b,0x31,0x5d,0x2c,0x20,0x6e,
+0x5b,0x32,0x5d,0x2c,0x20,0x6e,0x5b,0x33,0x5d,0x2c,0x20,0x6e,0x5b,0x34,0x5d,0x00,
+0x0c,0x04,0x00,0x04,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x01,0x00,0x04,
+0x0c,0x05,0x00,0x07,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x0a,0x02,0x00,0x05,
+0x0c,0x03,0x00,0x08,0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,0x0a,0x04,0x00,0x03,
+0x0c,0x06,0x00,0x09,0x00,0x00,0x69,0x04,0x04,0x00,0x00,0x00,0x0a,0x05,0x00,0x06,
+0x33,0x03,0x00,0x01,0x69,0x00,0x00,0x00,0x10,0x03,0x01,0x00,0x33,0x01,0x00,0x01,
+0x61,0x00,0x00,0x00,0x10,0x01,0x02,0x00,0x33,0x02,0x00,0x01,0x62,0x00,0x00,0x00,
+0x10,0x02,0x04,0x00,0x33,0x04,0x00,0x01,0x63,0x00,0x00,0x00,0x10,0x04,0x05,0x00,
+0x1f,0x03,0x00,0x32,0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x5b,0x5d,0x00,0x00,
+0x33,0x05,0x00,0x01,0x72,0x00,0x00,0x00,0x1c,0x05,0x00,0x00,0x1f,0x13,0x00,0x33,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,0x20,0x69,0x6e,0x20,0x5b,0x4c,0x49,0x53,
+0x54,0x2c,0x20,0x44,0x49,0x43,0x54,0x2c,0x20,0x43,0x41,0x4c,0x4c,0x50,0x2c,0x20,
+0x43,0x41,0x4c,0x4c,0x4d,0x2c,0x20,0x52,0x41,0x4e,0x47,0x45,0x5d,0x20,0x61,0x6e,
+0x64,0x20,0x63,0x20,0x3e,0x20,0x30,0x3a,0x20,0x72,0x2e,0x61,0x70,0x70,0x65,0x6e,
+0x64,0x28,0x5b,0x62,0x2c,0x20,0x63,0x5d,0x29,0x00,0x00,0x00,0x0e,0x07,0x00,0x0a,
+0x00,0x00,0x00,0x04,0x4c,0x49,0x53,0x54,0x00,0x00,0x00,0x00,0x0e,0x08,0x00,0x0b,
+0x00,0x00,0x00,0x04,0x44,0x49,0x43,0x54,0x00,0x00,0x00,0x00,0x0e,0x09,0x00,0x0c,
+0x00,0x00,0x00,0x05,0x43,0x41,0x4c,0x4c,0x50,0x00,0x00,0x00,0x0e,0x0a,0x00,0x0d,
+0x00,0x00,0x00,0x05,0x43,0x41,0x4c,0x4c,0x4d,0x00,0x00,0x00,0x0e,0x0b,0x00,0x0e,
+0x00,0x00,0x00,0x05,0x52,0x41,0x4e,0x47,0x45,0x00,0x00,0x00,0x1c,0x06,0x07,0x05,
+0x25,0x06,0x03,0x06,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x05,0x0c,0x06,0x00,0x02,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x36,0x06,0x04,0x06,0x16,0x06,0x00,0x00,
+0x13,0x00,0x00,0x0b,0x0d,0x09,0x00,0x0f,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x06,0x05,0x09,0x00,0x00,0x00,0x00,0x10,0x09,0x02,0x00,
+0x10,0x0a,0x04,0x00,0x1c,0x08,0x09,0x02,0x39,0x06,0x06,0x03,0x1f,0x09,0x00,0x34,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,0x20,0x3d,0x3d,0x20,0x52,0x41,0x4e,0x47,
+0x45,0x3a,0x20,0x72,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x5b,0x61,0x2c,0x20,
+0x33,0x5d,0x29,0x00,0x0e,0x06,0x00,0x0e,0x00,0x00,0x00,0x05,0x52,0x41,0x4e,0x47,
+0x45,0x00,0x00,0x00,0x18,0x06,0x03,0x06,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x0d,
+0x0d,0x09,0x00,0x0f,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x06,0x05,0x09,0x00,0x00,0x00,0x01,0x10,0x09,0x01,0x00,0x0c,0x0a,0x00,0x08,
+0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,0x1c,0x08,0x09,0x02,0x39,0x06,0x06,0x03,
+0x1f,0x09,0x00,0x35,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,0x20,0x3d,0x3d,0x20,
+0x43,0x41,0x4c,0x4c,0x3a,0x20,0x72,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x5b,
+0x63,0x2c,0x20,0x32,0x5d,0x29,0x00,0x00,0x0e,0x06,0x00,0x10,0x00,0x00,0x00,0x04,
+0x43,0x41,0x4c,0x4c,0x00,0x00,0x00,0x00,0x18,0x06,0x03,0x06,0x16,0x06,0x00,0x00,
+0x13,0x00,0x00,0x0d,0x0d,0x09,0x00,0x0f,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x06,0x05,0x09,0x00,0x00,0x00,0x02,0x10,0x09,0x04,0x00,
+0x0c,0x0a,0x00,0x07,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x1c,0x08,0x09,0x02,
+0x39,0x06,0x06,0x03,0x1f,0x09,0x00,0x36,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,
+0x20,0x3d,0x3d,0x20,0x46,0x4f,0x52,0x3a,0x20,0x72,0x2e,0x61,0x70,0x70,0x65,0x6e,
+0x64,0x28,0x5b,0x62,0x2c,0x20,0x33,0x5d,0x29,0x00,0x00,0x00,0x0e,0x06,0x00,0x11,
+0x00,0x00,0x00,0x03,0x46,0x4f,0x52,0x00,0x18,0x06,0x03,0x06,0x16,0x06,0x00,0x00,
+0x13,0x00,0x00,0x0d,0x0d,0x09,0x00,0x0f,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x06,0x05,0x09,0x00,0x00,0x00,0x03,0x10,0x09,0x02,0x00,
+0x0c,0x0a,0x00,0x08,0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,0x1c,0x08,0x09,0x02,
+0x39,0x06,0x06,0x03,0x1f,0x0a,0x00,0x37,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x69,
+0x20,0x3d,0x3d,0x20,0x4d,0x45,0x54,0x48,0x4f,0x44,0x3a,0x20,0x72,0x2e,0x61,0x70,
+0x70,0x65,0x6e,0x64,0x28,0x5b,0x61,0x2c,0x20,0x32,0x5d,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x06,0x00,0x12,0x00,0x00,0x00,0x06,0x4d,0x45,0x54,0x48,0x4f,0x44,0x00,0x00,
+0x18,0x06,0x03,0x06,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x0d,0x0d,0x09,0x00,0x0f,
+0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x06,0x05,0x09,
+0x00,0x00,0x00,0x04,0x10,0x09,0x01,0x00,0x0c,0x0a,0x00,0x07,0x00,0x00,0x69,0x04,
+0x02,0x00,0x00,0x00,0x1c,0x08,0x09,0x02,0x39,0x06,0x06,0x03,0x1f,0x04,0x00,0x38,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,
+0x15,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x10,0x00,0x00,0x00,0x04,
+0x72,0x75,0x6e,0x73,0x00,0x00,0x00,0x00,0x0f,0x03,0x02,0x00,0x1f,0x07,0x00,0x3a,
+0x64,0x65,0x66,0x20,0x6c,0x69,0x76,0x65,0x6e,0x65,0x73,0x73,0x28,0x6e,0x6f,0x64,
+0x65,0x73,0x2c,0x20,0x74,0x61,0x67,0x73,0x29,0x3a,0x00,0x00,0x33,0x03,0x00,0x04,
+0x2a,0x24,0x34,0x34,0x00,0x00,0x00,0x00,0x0d,0x08,0x00,0x11,0x00,0x00,0x00,0x05,
+0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x0d,0x09,0x00,0x12,0x00,0x00,0x00,0x04,
+0x74,0x61,0x67,0x73,0x00,0x00,0x00,0x00,0x1c,0x04,0x08,0x02,0x1c,0x05,0x00,0x00,
+0x1d,0x06,0x00,0x00,0x1d,0x07,0x00,0x00,0x11,0x03,0x02,0x10,0x2d,0x15,0x00,0x0e,
+0x00,0x00,0x00,0x07,0x1f,0x07,0x00,0x3a,0x64,0x65,0x66,0x20,0x6c,0x69,0x76,0x65,
+0x6e,0x65,0x73,0x73,0x28,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x74,0x61,0x67,0x73,
+0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x05,0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,
+0x33,0x01,0x00,0x04,0x74,0x61,0x67,0x73,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,
+0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x72,0x65,0x67,0x61,0x6c,0x6c,0x6f,0x63,0x2e,0x70,0x79,0x00,
+0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x08,0x6c,0x69,0x76,0x65,
+0x6e,0x65,0x73,0x73,0x00,0x00,0x00,0x00,0x23,0x02,0x00,0x00,0x1f,0x05,0x00,0x3d,
+0x20,0x20,0x20,0x20,0x68,0x61,0x6e,0x64,0x6c,0x65,0x72,0x73,0x20,0x3d,0x20,0x5b,
+0x5d,0x00,0x00,0x00,0x33,0x02,0x00,0x08,0x68,0x61,0x6e,0x64,0x6c,0x65,0x72,0x73,
+0x00,0x00,0x00,0x00,0x1c,0x03,0x00,0x00,0x10,0x02,0x03,0x00,0x1f,0x05,0x00,0x3e,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x6e,0x20,0x69,0x6e,0x20,0x6e,0x6f,0x64,
+0x65,0x73,0x3a,0x00,0x0c,0x04,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x2b,0x03,0x00,0x04,0x13,0x00,0x00,0x30,0x33,0x05,0x00,0x01,0x6e,0x00,0x00,0x00,
+0x10,0x05,0x03,0x00,0x1f,0x08,0x00,0x3f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x6e,0x5b,0x30,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x73,0x65,0x74,0x6a,
+0x6d,0x70,0x27,0x3a,0x00,0x00,0x00,0x00,0x0c,0x06,0x00,0x02,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x03,0x05,0x06,0x0d,0x06,0x00,0x03,0x00,0x00,0x00,0x06,
+0x73,0x65,0x74,0x6a,0x6d,0x70,0x00,0x00,0x18,0x03,0x03,0x06,0x16,0x03,0x00,0x00,
+0x13,0x00,0xff,0xe8,0x1f,0x0a,0x00,0x40,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x68,0x61,0x6e,0x64,0x6c,0x65,0x72,0x73,0x2e,0x61,0x70,0x70,
+0x65,0x6e,0x64,0x28,0x74,0x61,0x67,0x73,0x5b,0x6e,0x5b,0x31,0x5d,0x5d,0x29,0x00,
+0x0d,0x09,0x00,0x04,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x06,0x02,0x09,0x00,0x00,0x00,0x00,0x0c,0x0a,0x00,0x05,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x09,0x05,0x0a,0x0a,0x08,0x01,0x09,0x39,0x03,0x06,0x03,
+0x13,0x00,0xff,0xd0,0x1f,0x08,0x00,0x41,0x20,0x20,0x20,0x20,0x6c,0x69,0x76,0x65,
+0x5f,0x69,0x6e,0x2c,0x20,0x6c,0x69,0x76,0x65,0x5f,0x6f,0x75,0x74,0x20,0x3d,0x20,
+0x5b,0x5d,0x2c,0x20,0x5b,0x5d,0x00,0x00,0x1c,0x03,0x00,0x00,0x1c,0x04,0x00,0x00,
+0x33,0x06,0x00,0x07,0x6c,0x69,0x76,0x65,0x5f,0x69,0x6e,0x00,0x10,0x06,0x03,0x00,
+0x33,0x03,0x00,0x08,0x6c,0x69,0x76,0x65,0x5f,0x6f,0x75,0x74,0x00,0x00,0x00,0x00,
+0x10,0x03,0x04,0x00,0x1f,0x05,0x00,0x42,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,
+0x6e,0x20,0x69,0x6e,0x20,0x6e,0x6f,0x64,0x65,0x73,0x3a,0x00,0x0c,0x07,0x00,0x02,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x04,0x00,0x07,0x13,0x00,0x00,0x23,
+0x10,0x05,0x04,0x00,0x1f,0x07,0x00,0x43,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6c,0x69,0x76,0x65,0x5f,0x69,0x6e,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x7b,
+0x7d,0x29,0x00,0x00,0x0d,0x0b,0x00,0x04,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x08,0x06,0x0b,0x00,0x00,0x00,0x01,0x1b,0x0a,0x00,0x00,
+0x39,0x04,0x08,0x03,0x1f,0x07,0x00,0x44,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6c,0x69,0x76,0x65,0x5f,0x6f,0x75,0x74,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,
+0x7b,0x7d,0x29,0x00,0x0d,0x0b,0x00,0x04,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x08,0x03,0x0b,0x00,0x00,0x00,0x02,0x1b,0x0a,0x00,0x00,
+0x39,0x04,0x08,0x03,0x13,0x00,0xff,0xdd,0x1f,0x05,0x00,0x45,0x20,0x20,0x20,0x20,
+0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x20,0x3d,0x20,0x54,0x72,0x75,0x65,0x00,0x00,
+0x33,0x04,0x00,0x07,0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x00,0x0c,0x04,0x00,0x05,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x1f,0x05,0x00,0x46,0x20,0x20,0x20,0x20,
+0x77,0x68,0x69,0x6c,0x65,0x20,0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x3a,0x00,0x00,
+0x16,0x04,0x00,0x00,0x13,0x00,0x01,0x47,0x1f,0x06,0x00,0x47,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x20,0x3d,0x20,0x46,0x61,
+0x6c,0x73,0x65,0x00,0x0c,0x07,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x10,0x04,0x07,0x00,0x1f,0x0c,0x00,0x48,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x66,0x6f,0x72,0x20,0x6b,0x20,0x69,0x6e,0x20,0x72,0x61,0x6e,0x67,0x65,0x28,0x6c,
+0x65,0x6e,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,0x20,0x2d,0x20,0x31,0x2c,0x20,0x2d,
+0x31,0x2c,0x20,0x2d,0x31,0x29,0x3a,0x00,0x0e,0x0b,0x00,0x06,0x00,0x00,0x00,0x05,
+0x72,0x61,0x6e,0x67,0x65,0x00,0x00,0x00,0x0e,0x0f,0x00,0x07,0x00,0x00,0x00,0x03,
+0x6c,0x65,0x6e,0x00,0x10,0x10,0x00,0x00,0x37,0x0c,0x0f,0x02,0x0c,0x0f,0x00,0x05,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x02,0x0c,0x0c,0x0f,0x0c,0x0d,0x00,0x08,
+0x00,0x00,0x69,0x04,0xff,0xff,0xff,0xff,0x0c,0x0e,0x00,0x08,0x00,0x00,0x69,0x04,
+0xff,0xff,0xff,0xff,0x3a,0x08,0x0b,0x04,0x3b,0x07,0x08,0x00,0x13,0x00,0xff,0xd1,
+0x33,0x0b,0x00,0x01,0x6b,0x00,0x00,0x00,0x10,0x0b,0x07,0x00,0x1f,0x08,0x00,0x49,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x20,
+0x3d,0x20,0x6c,0x69,0x76,0x65,0x5f,0x6f,0x75,0x74,0x5b,0x6b,0x5d,0x00,0x00,0x00,
+0x33,0x07,0x00,0x03,0x6f,0x75,0x74,0x00,0x0a,0x0c,0x03,0x0b,0x10,0x07,0x0c,0x00,
+0x1f,0x12,0x00,0x4a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x66,0x6f,0x72,0x20,0x73,0x20,0x69,0x6e,0x20,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,
+0x65,0x2e,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x6f,0x72,0x73,0x28,0x6e,0x6f,0x64,
+0x65,0x73,0x2c,0x20,0x74,0x61,0x67,0x73,0x2c,0x20,0x6b,0x29,0x20,0x2b,0x20,0x68,
+0x61,0x6e,0x64,0x6c,0x65,0x72,0x73,0x3a,0x00,0x00,0x00,0x00,0x0e,0x13,0x00,0x09,
+0x00,0x00,0x00,0x08,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x00,0x00,0x00,0x00,
+0x0d,0x14,0x00,0x0a,0x00,0x00,0x00,0x0a,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x6f,
+0x72,0x73,0x00,0x00,0x38,0x0e,0x13,0x14,0x00,0x00,0x00,0x03,0x10,0x10,0x00,0x00,
+0x10,0x11,0x01,0x00,0x10,0x12,0x0b,0x00,0x39,0x0d,0x0e,0x05,0x01,0x0d,0x0d,0x02,
+0x0c,0x0e,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x0c,0x0d,0x0e,
+0x13,0x00,0x00,0x2b,0x33,0x0f,0x00,0x01,0x73,0x00,0x00,0x00,0x10,0x0f,0x0c,0x00,
+0x1f,0x09,0x00,0x4b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x73,0x20,0x3c,0x20,0x6c,0x65,0x6e,0x28,0x6e,
+0x6f,0x64,0x65,0x73,0x29,0x3a,0x00,0x00,0x0e,0x11,0x00,0x07,0x00,0x00,0x00,0x03,
+0x6c,0x65,0x6e,0x00,0x10,0x12,0x00,0x00,0x37,0x10,0x11,0x02,0x1a,0x0c,0x0f,0x10,
+0x16,0x0c,0x00,0x00,0x13,0x00,0xff,0xea,0x1f,0x0b,0x00,0x4c,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6f,0x75,0x74,0x2e,0x75,0x70,0x64,0x61,0x74,0x65,0x28,0x6c,0x69,0x76,0x65,0x5f,
+0x69,0x6e,0x5b,0x73,0x5d,0x29,0x00,0x00,0x0d,0x13,0x00,0x0b,0x00,0x00,0x00,0x06,
+0x75,0x70,0x64,0x61,0x74,0x65,0x00,0x00,0x38,0x10,0x07,0x13,0x00,0x00,0x00,0x04,
+0x0a,0x12,0x06,0x0f,0x39,0x0c,0x10,0x03,0x13,0x00,0xff,0xd5,0x1f,0x07,0x00,0x4d,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x20,0x3d,0x20,
+0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,0x5d,0x00,0x00,0x00,0x00,0x0a,0x05,0x00,0x0b,
+0x1f,0x09,0x00,0x4e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6b,0x6c,0x20,0x3d,0x20,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x2e,0x6b,0x69,
+0x6c,0x6c,0x73,0x28,0x6e,0x29,0x00,0x00,0x33,0x0c,0x00,0x02,0x6b,0x6c,0x00,0x00,
+0x0e,0x0e,0x00,0x09,0x00,0x00,0x00,0x08,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x13,0x00,0x0c,0x00,0x00,0x00,0x05,0x6b,0x69,0x6c,0x6c,
+0x73,0x00,0x00,0x00,0x38,0x10,0x0e,0x13,0x00,0x00,0x00,0x05,0x10,0x12,0x05,0x00,
+0x39,0x0c,0x10,0x03,0x1f,0x06,0x00,0x4f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x6e,0x6e,0x20,0x3d,0x20,0x7b,0x7d,0x00,0x00,0x00,0x00,
+0x33,0x0d,0x00,0x03,0x69,0x6e,0x6e,0x00,0x1b,0x0e,0x00,0x00,0x10,0x0d,0x0e,0x00,
+0x1f,0x07,0x00,0x50,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x66,0x6f,0x72,0x20,0x72,0x20,0x69,0x6e,0x20,0x6f,0x75,0x74,0x3a,0x00,0x00,0x00,
+0x0c,0x10,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x0e,0x07,0x10,
+0x13,0x00,0x00,0x1f,0x33,0x11,0x00,0x01,0x72,0x00,0x00,0x00,0x10,0x11,0x0e,0x00,
+0x1f,0x08,0x00,0x51,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x72,0x20,0x6e,0x6f,0x74,0x20,0x69,0x6e,0x20,
+0x6b,0x6c,0x3a,0x00,0x08,0x0e,0x11,0x0c,0x16,0x0e,0x00,0x00,0x13,0x00,0xff,0xf0,
+0x1f,0x09,0x00,0x52,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x6e,0x5b,0x72,0x5d,0x20,0x3d,
+0x20,0x54,0x72,0x75,0x65,0x00,0x00,0x00,0x0c,0x0e,0x00,0x05,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0b,0x0d,0x11,0x0e,0x13,0x00,0xff,0xe1,0x1f,0x0a,0x00,0x53,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,
+0x72,0x20,0x69,0x6e,0x20,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x2e,0x75,0x73,
+0x65,0x73,0x28,0x6e,0x29,0x3a,0x00,0x00,0x0e,0x0c,0x00,0x09,0x00,0x00,0x00,0x08,
+0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x00,0x00,0x00,0x00,0x0d,0x0f,0x00,0x0d,
+0x00,0x00,0x00,0x04,0x75,0x73,0x65,0x73,0x00,0x00,0x00,0x00,0x38,0x12,0x0c,0x0f,
+0x00,0x00,0x00,0x06,0x10,0x14,0x05,0x00,0x39,0x10,0x12,0x03,0x0c,0x12,0x00,0x02,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x0e,0x10,0x12,0x13,0x00,0x00,0x10,
+0x10,0x11,0x0e,0x00,0x1f,0x08,0x00,0x54,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x6e,0x5b,0x72,0x5d,0x20,0x3d,
+0x20,0x54,0x72,0x75,0x65,0x00,0x00,0x00,0x0c,0x0e,0x00,0x05,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0b,0x0d,0x11,0x0e,0x13,0x00,0xff,0xf0,0x1f,0x0b,0x00,0x55,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6c,
+0x65,0x6e,0x28,0x69,0x6e,0x6e,0x29,0x20,0x21,0x3d,0x20,0x6c,0x65,0x6e,0x28,0x6c,
+0x69,0x76,0x65,0x5f,0x69,0x6e,0x5b,0x6b,0x5d,0x29,0x3a,0x00,0x0e,0x12,0x00,0x07,
+0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x10,0x13,0x0d,0x00,0x37,0x0e,0x12,0x02,
+0x0e,0x12,0x00,0x07,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x0a,0x13,0x06,0x0b,
+0x37,0x10,0x12,0x02,0x24,0x0e,0x0e,0x10,0x16,0x0e,0x00,0x00,0x13,0x00,0xfe,0xff,
+0x1f,0x09,0x00,0x56,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6c,0x69,0x76,0x65,0x5f,0x69,0x6e,0x5b,0x6b,0x5d,0x20,0x3d,
+0x20,0x69,0x6e,0x6e,0x00,0x00,0x00,0x00,0x0b,0x06,0x0b,0x0d,0x1f,0x08,0x00,0x57,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x20,0x3d,0x20,0x54,0x72,0x75,0x65,0x00,0x00,
+0x0c,0x04,0x00,0x05,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x13,0x00,0xfe,0xe7,
+0x1f,0x08,0x00,0x58,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6c,
+0x69,0x76,0x65,0x5f,0x69,0x6e,0x2c,0x20,0x6c,0x69,0x76,0x65,0x5f,0x6f,0x75,0x74,
+0x00,0x00,0x00,0x00,0x10,0x09,0x06,0x00,0x10,0x0a,0x03,0x00,0x1c,0x08,0x09,0x02,
+0x15,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x13,0x00,0x00,0x00,0x08,
+0x6c,0x69,0x76,0x65,0x6e,0x65,0x73,0x73,0x00,0x00,0x00,0x00,0x0f,0x04,0x03,0x00,
+0x1f,0x06,0x00,0x5a,0x64,0x65,0x66,0x20,0x66,0x69,0x6e,0x64,0x28,0x70,0x61,0x72,
+0x65,0x6e,0x74,0x2c,0x20,0x72,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x04,0x00,0x04,
+0x2a,0x24,0x35,0x32,0x00,0x00,0x00,0x00,0x0d,0x09,0x00,0x14,0x00,0x00,0x00,0x06,
+0x70,0x61,0x72,0x65,0x6e,0x74,0x00,0x00,0x0d,0x0a,0x00,0x15,0x00,0x00,0x00,0x01,
+0x72,0x00,0x00,0x00,0x1c,0x05,0x09,0x02,0x1c,0x06,0x00,0x00,0x1d,0x07,0x00,0x00,
+0x1d,0x08,0x00,0x00,0x11,0x04,0x00,0x3a,0x2d,0x04,0x00,0x02,0x00,0x00,0x00,0x00,
+0x1f,0x06,0x00,0x5a,0x64,0x65,0x66,0x20,0x66,0x69,0x6e,0x64,0x28,0x70,0x61,0x72,
+0x65,0x6e,0x74,0x2c,0x20,0x72,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x06,
+0x70,0x61,0x72,0x65,0x6e,0x74,0x00,0x00,0x33,0x01,0x00,0x01,0x72,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x72,0x65,0x67,0x61,0x6c,0x6c,0x6f,0x63,
+0x2e,0x70,0x79,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x04,
+0x66,0x69,0x6e,0x64,0x00,0x00,0x00,0x00,0x23,0x02,0x00,0x00,0x1f,0x07,0x00,0x5b,
+0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x70,0x61,0x72,0x65,0x6e,0x74,
+0x5b,0x72,0x5d,0x20,0x21,0x3d,0x20,0x72,0x3a,0x00,0x00,0x00,0x0a,0x02,0x00,0x01,
+0x24,0x02,0x02,0x01,0x16,0x02,0x00,0x00,0x13,0x00,0x00,0x0a,0x1f,0x06,0x00,0x5c,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x70,0x61,0x72,0x65,
+0x6e,0x74,0x5b,0x72,0x5d,0x00,0x00,0x00,0x0a,0x01,0x00,0x01,0x13,0x00,0xff,0xf4,
+0x1f,0x04,0x00,0x5d,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,
+0x00,0x00,0x00,0x00,0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x16,
+0x00,0x00,0x00,0x04,0x66,0x69,0x6e,0x64,0x00,0x00,0x00,0x00,0x0f,0x05,0x04,0x00,
+0x1f,0x06,0x00,0x5f,0x64,0x65,0x66,0x20,0x65,0x64,0x67,0x65,0x28,0x61,0x64,0x6a,
+0x2c,0x20,0x72,0x2c,0x20,0x73,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x05,0x00,0x04,
+0x2a,0x24,0x36,0x30,0x00,0x00,0x00,0x00,0x0d,0x0a,0x00,0x17,0x00,0x00,0x00,0x03,
+0x61,0x64,0x6a,0x00,0x0d,0x0b,0x00,0x15,0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,
+0x0d,0x0c,0x00,0x18,0x00,0x00,0x00,0x01,0x73,0x00,0x00,0x00,0x1c,0x06,0x0a,0x03,
+0x1c,0x07,0x00,0x00,0x1d,0x08,0x00,0x00,0x1d,0x09,0x00,0x00,0x11,0x05,0x00,0x38,
+0x2d,0x05,0x00,0x03,0x00,0x00,0x00,0x00,0x1f,0x06,0x00,0x5f,0x64,0x65,0x66,0x20,
+0x65,0x64,0x67,0x65,0x28,0x61,0x64,0x6a,0x2c,0x20,0x72,0x2c,0x20,0x73,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x03,0x61,0x64,0x6a,0x00,0x33,0x01,0x00,0x01,
+0x72,0x00,0x00,0x00,0x33,0x02,0x00,0x01,0x73,0x00,0x00,0x00,0x0d,0x03,0x00,0x00,
+0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x72,0x65,0x67,0x61,0x6c,0x6c,0x6f,0x63,0x2e,0x70,0x79,0x00,
+0x22,0x03,0x00,0x00,0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x04,0x65,0x64,0x67,0x65,
+0x00,0x00,0x00,0x00,0x23,0x03,0x00,0x00,0x1f,0x06,0x00,0x60,0x20,0x20,0x20,0x20,
+0x61,0x64,0x6a,0x5b,0x72,0x5d,0x5b,0x73,0x5d,0x20,0x3d,0x20,0x54,0x72,0x75,0x65,
+0x00,0x00,0x00,0x00,0x0a,0x03,0x00,0x01,0x0c,0x04,0x00,0x02,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0b,0x03,0x02,0x04,0x1f,0x06,0x00,0x61,0x20,0x20,0x20,0x20,
+0x61,0x64,0x6a,0x5b,0x73,0x5d,0x5b,0x72,0x5d,0x20,0x3d,0x20,0x54,0x72,0x75,0x65,
+0x00,0x00,0x00,0x00,0x0a,0x03,0x00,0x02,0x0c,0x04,0x00,0x02,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0b,0x03,0x01,0x04,0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x19,
+0x00,0x00,0x00,0x04,0x65,0x64,0x67,0x65,0x00,0x00,0x00,0x00,0x0f,0x06,0x05,0x00,
+0x1f,0x0a,0x00,0x63,0x64,0x65,0x66,0x20,0x61,0x6c,0x6c,0x6f,0x63,0x61,0x74,0x65,
+0x28,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x6e,0x72,0x65,0x67,0x73,0x2c,0x20,0x6e,
+0x70,0x61,0x72,0x61,0x6d,0x73,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x06,0x00,0x04,
+0x2a,0x24,0x36,0x39,0x00,0x00,0x00,0x00,0x0d,0x0b,0x00,0x11,0x00,0x00,0x00,0x05,
+0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x0d,0x0c,0x00,0x1a,0x00,0x00,0x00,0x05,
+0x6e,0x72,0x65,0x67,0x73,0x00,0x00,0x00,0x0d,0x0d,0x00,0x1b,0x00,0x00,0x00,0x07,
+0x6e,0x70,0x61,0x72,0x61,0x6d,0x73,0x00,0x1c,0x07,0x0b,0x03,0x1c,0x08,0x00,0x00,
+0x1d,0x09,0x00,0x00,0x1d,0x0a,0x00,0x00,0x11,0x06,0x06,0xf4,0x2d,0x26,0x00,0x1d,
+0x00,0x00,0x00,0x11,0x1f,0x0a,0x00,0x63,0x64,0x65,0x66,0x20,0x61,0x6c,0x6c,0x6f,
+0x63,0x61,0x74,0x65,0x28,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x6e,0x72,0x65,0x67,
+0x73,0x2c,0x20,0x6e,0x70,0x61,0x72,0x61,0x6d,0x73,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x00,0x00,0x05,0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x33,0x01,0x00,0x05,
+0x6e,0x72,0x65,0x67,0x73,0x00,0x00,0x00,0x33,0x02,0x00,0x07,0x6e,0x70,0x61,0x72,
+0x61,0x6d,0x73,0x00,0x0d,0x03,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x72,0x65,0x67,0x61,
+0x6c,0x6c,0x6f,0x63,0x2e,0x70,0x79,0x00,0x22,0x03,0x00,0x00,0x0d,0x03,0x00,0x01,
+0x00,0x00,0x00,0x08,0x61,0x6c,0x6c,0x6f,0x63,0x61,0x74,0x65,0x00,0x00,0x00,0x00,
+0x23,0x03,0x00,0x00,0x1f,0x0a,0x00,0x65,0x20,0x20,0x20,0x20,0x74,0x61,0x67,0x73,
+0x20,0x3d,0x20,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x2e,0x69,0x6e,0x64,0x65,
+0x78,0x5f,0x74,0x61,0x67,0x73,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,0x00,0x00,0x00,
+0x33,0x03,0x00,0x04,0x74,0x61,0x67,0x73,0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x02,
+0x00,0x00,0x00,0x08,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x00,0x00,0x00,0x00,
+0x0d,0x04,0x00,0x03,0x00,0x00,0x00,0x0a,0x69,0x6e,0x64,0x65,0x78,0x5f,0x74,0x61,
+0x67,0x73,0x00,0x00,0x38,0x05,0x03,0x04,0x00,0x00,0x00,0x00,0x10,0x07,0x00,0x00,
+0x39,0x03,0x05,0x03,0x1f,0x0c,0x00,0x66,0x20,0x20,0x20,0x20,0x6c,0x69,0x76,0x65,
+0x5f,0x69,0x6e,0x2c,0x20,0x6c,0x69,0x76,0x65,0x5f,0x6f,0x75,0x74,0x20,0x3d,0x20,
+0x6c,0x69,0x76,0x65,0x6e,0x65,0x73,0x73,0x28,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,
+0x74,0x61,0x67,0x73,0x29,0x00,0x00,0x00,0x0e,0x05,0x00,0x04,0x00,0x00,0x00,0x08,
+0x6c,0x69,0x76,0x65,0x6e,0x65,0x73,0x73,0x00,0x00,0x00,0x00,0x10,0x06,0x00,0x00,
+0x10,0x07,0x03,0x00,0x37,0x08,0x05,0x03,0x33,0x08,0x00,0x03,0x2a,0x24,0x38,0x00,
+0x33,0x05,0x00,0x07,0x6c,0x69,0x76,0x65,0x5f,0x69,0x6e,0x00,0x0c,0x07,0x00,0x05,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x05,0x08,0x07,0x33,0x06,0x00,0x08,
+0x6c,0x69,0x76,0x65,0x5f,0x6f,0x75,0x74,0x00,0x00,0x00,0x00,0x0c,0x03,0x00,0x06,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x06,0x08,0x03,0x1f,0x04,0x00,0x6b,
+0x20,0x20,0x20,0x20,0x61,0x64,0x6a,0x20,0x3d,0x20,0x7b,0x7d,0x00,0x00,0x00,0x00,
+0x33,0x08,0x00,0x03,0x61,0x64,0x6a,0x00,0x1b,0x08,0x00,0x00,0x1f,0x04,0x00,0x6c,
+0x20,0x20,0x20,0x20,0x6f,0x72,0x64,0x65,0x72,0x20,0x3d,0x20,0x5b,0x5d,0x00,0x00,
+0x33,0x07,0x00,0x05,0x6f,0x72,0x64,0x65,0x72,0x00,0x00,0x00,0x1c,0x03,0x00,0x00,
+0x10,0x07,0x03,0x00,0x1f,0x05,0x00,0x6d,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,
+0x6e,0x20,0x69,0x6e,0x20,0x6e,0x6f,0x64,0x65,0x73,0x3a,0x00,0x0c,0x04,0x00,0x05,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x03,0x00,0x04,0x13,0x00,0x00,0x55,
+0x33,0x09,0x00,0x01,0x6e,0x00,0x00,0x00,0x10,0x09,0x03,0x00,0x1f,0x0c,0x00,0x6e,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x72,0x20,0x69,0x6e,
+0x20,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x2e,0x75,0x73,0x65,0x73,0x28,0x6e,
+0x29,0x20,0x2b,0x20,0x77,0x72,0x69,0x74,0x65,0x73,0x28,0x6e,0x29,0x3a,0x00,0x00,
+0x0e,0x0e,0x00,0x02,0x00,0x00,0x00,0x08,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x0f,0x00,0x07,0x00,0x00,0x00,0x04,0x75,0x73,0x65,0x73,
+0x00,0x00,0x00,0x00,0x38,0x0b,0x0e,0x0f,0x00,0x00,0x00,0x01,0x10,0x0d,0x09,0x00,
+0x39,0x0a,0x0b,0x03,0x0e,0x0c,0x00,0x08,0x00,0x00,0x00,0x06,0x77,0x72,0x69,0x74,
+0x65,0x73,0x00,0x00,0x10,0x0d,0x09,0x00,0x37,0x0b,0x0c,0x02,0x01,0x0a,0x0a,0x0b,
+0x0c,0x0b,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x03,0x0a,0x0b,
+0x13,0x00,0xff,0xd6,0x33,0x0c,0x00,0x01,0x72,0x00,0x00,0x00,0x10,0x0c,0x03,0x00,
+0x1f,0x08,0x00,0x6f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x72,0x20,0x6e,0x6f,0x74,0x20,0x69,0x6e,0x20,0x61,0x64,0x6a,0x3a,
+0x00,0x00,0x00,0x00,0x08,0x03,0x0c,0x08,0x16,0x03,0x00,0x00,0x13,0x00,0xff,0xf0,
+0x1f,0x07,0x00,0x70,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x61,0x64,0x6a,0x5b,0x72,0x5d,0x20,0x3d,0x20,0x7b,0x7d,0x00,
+0x1b,0x03,0x00,0x00,0x0b,0x08,0x0c,0x03,0x1f,0x08,0x00,0x71,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x72,0x64,0x65,
+0x72,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x72,0x29,0x00,0x0d,0x10,0x00,0x09,
+0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x0d,0x07,0x10,
+0x00,0x00,0x00,0x02,0x10,0x0f,0x0c,0x00,0x39,0x03,0x0d,0x03,0x13,0x00,0xff,0xd4,
+0x1f,0x04,0x00,0x72,0x20,0x20,0x20,0x20,0x70,0x72,0x65,0x66,0x65,0x72,0x20,0x3d,
+0x20,0x7b,0x7d,0x00,0x33,0x03,0x00,0x06,0x70,0x72,0x65,0x66,0x65,0x72,0x00,0x00,
+0x1b,0x04,0x00,0x00,0x10,0x03,0x04,0x00,0x1f,0x05,0x00,0x73,0x20,0x20,0x20,0x20,
+0x66,0x6f,0x72,0x20,0x72,0x20,0x69,0x6e,0x20,0x61,0x64,0x6a,0x3a,0x00,0x00,0x00,
+0x0c,0x0a,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x04,0x08,0x0a,
+0x13,0x00,0x00,0x0c,0x10,0x0c,0x04,0x00,0x1f,0x06,0x00,0x74,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x70,0x72,0x65,0x66,0x65,0x72,0x5b,0x72,0x5d,0x20,0x3d,0x20,
+0x5b,0x5d,0x00,0x00,0x1c,0x04,0x00,0x00,0x0b,0x03,0x0c,0x04,0x13,0x00,0xff,0xf4,
+0x1f,0x08,0x00,0x75,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x6b,0x20,0x69,0x6e,
+0x20,0x72,0x61,0x6e,0x67,0x65,0x28,0x6c,0x65,0x6e,0x28,0x6e,0x6f,0x64,0x65,0x73,
+0x29,0x29,0x3a,0x00,0x0e,0x0a,0x00,0x0a,0x00,0x00,0x00,0x05,0x72,0x61,0x6e,0x67,
+0x65,0x00,0x00,0x00,0x0e,0x10,0x00,0x0b,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,
+0x10,0x11,0x00,0x00,0x37,0x0b,0x10,0x02,0x3a,0x0d,0x0a,0x02,0x3b,0x04,0x0d,0x00,
+0x13,0x00,0x01,0x59,0x33,0x0a,0x00,0x01,0x6b,0x00,0x00,0x00,0x10,0x0a,0x04,0x00,
+0x1f,0x06,0x00,0x76,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x20,0x3d,0x20,
+0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,0x5d,0x00,0x00,0x00,0x00,0x0a,0x09,0x00,0x0a,
+0x1f,0x05,0x00,0x77,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x72,0x63,0x20,
+0x3d,0x20,0x4e,0x6f,0x6e,0x65,0x00,0x00,0x33,0x04,0x00,0x03,0x73,0x72,0x63,0x00,
+0x1d,0x04,0x00,0x00,0x1f,0x0a,0x00,0x78,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x2e,0x69,0x73,0x5f,0x63,
+0x6f,0x64,0x65,0x28,0x6e,0x2c,0x20,0x4d,0x4f,0x56,0x45,0x29,0x3a,0x00,0x00,0x00,
+0x0e,0x14,0x00,0x02,0x00,0x00,0x00,0x08,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x15,0x00,0x0c,0x00,0x00,0x00,0x07,0x69,0x73,0x5f,0x63,
+0x6f,0x64,0x65,0x00,0x38,0x10,0x14,0x15,0x00,0x00,0x00,0x03,0x10,0x12,0x09,0x00,
+0x0e,0x13,0x00,0x0d,0x00,0x00,0x00,0x04,0x4d,0x4f,0x56,0x45,0x00,0x00,0x00,0x00,
+0x39,0x0b,0x10,0x04,0x16,0x0b,0x00,0x00,0x13,0x00,0x00,0x3b,0x1f,0x06,0x00,0x79,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x72,0x63,0x20,
+0x3d,0x20,0x6e,0x5b,0x33,0x5d,0x00,0x00,0x0c,0x10,0x00,0x0e,0x00,0x00,0x69,0x04,
+0x03,0x00,0x00,0x00,0x0a,0x04,0x09,0x10,0x1f,0x0a,0x00,0x7a,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x65,0x66,0x65,0x72,0x5b,0x6e,
+0x5b,0x32,0x5d,0x5d,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x73,0x72,0x63,0x29,
+0x00,0x00,0x00,0x00,0x0c,0x15,0x00,0x0f,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,
+0x0a,0x14,0x09,0x15,0x0a,0x13,0x03,0x14,0x0d,0x14,0x00,0x09,0x00,0x00,0x00,0x06,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x10,0x13,0x14,0x00,0x00,0x00,0x04,
+0x10,0x12,0x04,0x00,0x39,0x0b,0x10,0x03,0x1f,0x0a,0x00,0x7b,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x72,0x65,0x66,0x65,0x72,0x5b,0x73,
+0x72,0x63,0x5d,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x6e,0x5b,0x32,0x5d,0x29,
+0x00,0x00,0x00,0x00,0x0a,0x13,0x03,0x04,0x0d,0x14,0x00,0x09,0x00,0x00,0x00,0x06,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x10,0x13,0x14,0x00,0x00,0x00,0x05,
+0x0c,0x13,0x00,0x0f,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x0a,0x12,0x09,0x13,
+0x39,0x0b,0x10,0x03,0x1f,0x06,0x00,0x7c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x77,0x20,0x3d,0x20,0x77,0x72,0x69,0x74,0x65,0x73,0x28,0x6e,0x29,0x00,0x00,0x00,
+0x33,0x0b,0x00,0x01,0x77,0x00,0x00,0x00,0x0e,0x11,0x00,0x08,0x00,0x00,0x00,0x06,
+0x77,0x72,0x69,0x74,0x65,0x73,0x00,0x00,0x10,0x12,0x09,0x00,0x37,0x10,0x11,0x02,
+0x10,0x0b,0x10,0x00,0x1f,0x05,0x00,0x7d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x66,0x6f,0x72,0x20,0x72,0x20,0x69,0x6e,0x20,0x77,0x3a,0x00,0x0c,0x11,0x00,0x05,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x10,0x0b,0x11,0x13,0x00,0xff,0x78,
+0x10,0x0c,0x10,0x00,0x1f,0x09,0x00,0x7e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x73,0x20,0x69,0x6e,0x20,0x6c,0x69,0x76,
+0x65,0x5f,0x6f,0x75,0x74,0x5b,0x6b,0x5d,0x3a,0x00,0x00,0x00,0x0a,0x12,0x06,0x0a,
+0x0c,0x13,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x10,0x12,0x13,
+0x13,0x00,0x00,0x28,0x33,0x14,0x00,0x01,0x73,0x00,0x00,0x00,0x10,0x14,0x10,0x00,
+0x1f,0x0a,0x00,0x7f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x73,0x20,0x21,0x3d,0x20,0x72,0x20,0x61,0x6e,
+0x64,0x20,0x73,0x20,0x21,0x3d,0x20,0x73,0x72,0x63,0x3a,0x00,0x24,0x10,0x14,0x0c,
+0x16,0x10,0x00,0x00,0x13,0x00,0x00,0x02,0x24,0x10,0x14,0x04,0x16,0x10,0x00,0x00,
+0x13,0x00,0xff,0xeb,0x1f,0x09,0x00,0x80,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x64,0x67,0x65,
+0x28,0x61,0x64,0x6a,0x2c,0x20,0x72,0x2c,0x20,0x73,0x29,0x00,0x0e,0x15,0x00,0x10,
+0x00,0x00,0x00,0x04,0x65,0x64,0x67,0x65,0x00,0x00,0x00,0x00,0x10,0x16,0x08,0x00,
+0x10,0x17,0x0c,0x00,0x10,0x18,0x14,0x00,0x37,0x10,0x15,0x04,0x13,0x00,0xff,0xd8,
+0x1f,0x06,0x00,0x81,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x66,0x6f,0x72,0x20,0x73,0x20,0x69,0x6e,0x20,0x77,0x3a,0x00,0x0c,0x12,0x00,0x05,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x10,0x0b,0x12,0x13,0x00,0x00,0x20,
+0x10,0x14,0x10,0x00,0x1f,0x07,0x00,0x82,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x73,0x20,0x21,0x3d,0x20,
+0x72,0x3a,0x00,0x00,0x24,0x10,0x14,0x0c,0x16,0x10,0x00,0x00,0x13,0x00,0xff,0xf3,
+0x1f,0x09,0x00,0x83,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x64,0x67,0x65,0x28,0x61,0x64,0x6a,
+0x2c,0x20,0x72,0x2c,0x20,0x73,0x29,0x00,0x0e,0x15,0x00,0x10,0x00,0x00,0x00,0x04,
+0x65,0x64,0x67,0x65,0x00,0x00,0x00,0x00,0x10,0x16,0x08,0x00,0x10,0x17,0x0c,0x00,
+0x10,0x18,0x14,0x00,0x37,0x10,0x15,0x04,0x13,0x00,0xff,0xe0,0x1f,0x10,0x00,0x84,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,
+0x5b,0x30,0x5d,0x20,0x21,0x3d,0x20,0x27,0x63,0x6f,0x64,0x65,0x27,0x20,0x6f,0x72,
+0x20,0x6e,0x5b,0x31,0x5d,0x20,0x6e,0x6f,0x74,0x20,0x69,0x6e,0x20,0x70,0x65,0x65,
+0x70,0x68,0x6f,0x6c,0x65,0x2e,0x52,0x45,0x54,0x41,0x52,0x47,0x45,0x54,0x3a,0x00,
+0x0c,0x12,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x10,0x09,0x12,
+0x0d,0x12,0x00,0x11,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,0x00,0x00,0x00,0x00,
+0x24,0x10,0x10,0x12,0x2f,0x10,0x00,0x00,0x13,0x00,0x00,0x12,0x0c,0x12,0x00,0x06,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x10,0x09,0x12,0x0e,0x12,0x00,0x02,
+0x00,0x00,0x00,0x08,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x00,0x00,0x00,0x00,
+0x0d,0x13,0x00,0x12,0x00,0x00,0x00,0x08,0x52,0x45,0x54,0x41,0x52,0x47,0x45,0x54,
+0x00,0x00,0x00,0x00,0x09,0x12,0x12,0x13,0x00,0x00,0x00,0x06,0x08,0x10,0x10,0x12,
+0x16,0x10,0x00,0x00,0x13,0x00,0xff,0x6d,0x1f,0x0b,0x00,0x85,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,
+0x73,0x20,0x69,0x6e,0x20,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x2e,0x75,0x73,
+0x65,0x73,0x28,0x6e,0x29,0x3a,0x00,0x00,0x0e,0x13,0x00,0x02,0x00,0x00,0x00,0x08,
+0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x00,0x00,0x00,0x00,0x0d,0x18,0x00,0x07,
+0x00,0x00,0x00,0x04,0x75,0x73,0x65,0x73,0x00,0x00,0x00,0x00,0x38,0x15,0x13,0x18,
+0x00,0x00,0x00,0x07,0x10,0x17,0x09,0x00,0x39,0x12,0x15,0x03,0x0c,0x13,0x00,0x05,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x10,0x12,0x13,0x13,0x00,0xff,0x4f,
+0x10,0x14,0x10,0x00,0x1f,0x08,0x00,0x86,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x73,
+0x20,0x21,0x3d,0x20,0x72,0x3a,0x00,0x00,0x24,0x10,0x14,0x0c,0x16,0x10,0x00,0x00,
+0x13,0x00,0xff,0xf2,0x1f,0x0a,0x00,0x87,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x65,0x64,0x67,0x65,0x28,0x61,0x64,0x6a,0x2c,0x20,0x72,0x2c,0x20,0x73,0x29,0x00,
+0x0e,0x15,0x00,0x10,0x00,0x00,0x00,0x04,0x65,0x64,0x67,0x65,0x00,0x00,0x00,0x00,
+0x10,0x16,0x08,0x00,0x10,0x17,0x0c,0x00,0x10,0x18,0x14,0x00,0x37,0x10,0x15,0x04,
+0x13,0x00,0xff,0xde,0x1f,0x04,0x00,0x8a,0x20,0x20,0x20,0x20,0x70,0x61,0x72,0x65,
+0x6e,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x00,0x33,0x0d,0x00,0x06,0x70,0x61,0x72,0x65,
+0x6e,0x74,0x00,0x00,0x1b,0x0e,0x00,0x00,0x10,0x0d,0x0e,0x00,0x1f,0x05,0x00,0x8b,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x72,0x20,0x69,0x6e,0x20,0x6f,0x72,0x64,
+0x65,0x72,0x3a,0x00,0x0c,0x0f,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x2b,0x0e,0x07,0x0f,0x13,0x00,0x00,0x0b,0x10,0x0c,0x0e,0x00,0x1f,0x06,0x00,0x8c,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x61,0x72,0x65,0x6e,0x74,0x5b,0x72,
+0x5d,0x20,0x3d,0x20,0x72,0x00,0x00,0x00,0x0b,0x0d,0x0c,0x0c,0x13,0x00,0xff,0xf5,
+0x1f,0x05,0x00,0x8d,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x6e,0x20,0x69,0x6e,
+0x20,0x6e,0x6f,0x64,0x65,0x73,0x3a,0x00,0x0c,0x0f,0x00,0x05,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x2b,0x0e,0x00,0x0f,0x13,0x00,0x00,0x80,0x10,0x09,0x0e,0x00,
+0x1f,0x07,0x00,0x8e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,
+0x72,0x75,0x6e,0x20,0x69,0x6e,0x20,0x72,0x75,0x6e,0x73,0x28,0x6e,0x29,0x3a,0x00,
+0x0e,0x11,0x00,0x13,0x00,0x00,0x00,0x04,0x72,0x75,0x6e,0x73,0x00,0x00,0x00,0x00,
+0x10,0x12,0x09,0x00,0x37,0x10,0x11,0x02,0x0c,0x11,0x00,0x05,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x2b,0x0e,0x10,0x11,0x13,0x00,0xff,0xeb,0x33,0x12,0x00,0x03,
+0x72,0x75,0x6e,0x00,0x10,0x12,0x0e,0x00,0x1f,0x0f,0x00,0x8f,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x72,0x20,0x69,0x6e,
+0x20,0x72,0x61,0x6e,0x67,0x65,0x28,0x72,0x75,0x6e,0x5b,0x30,0x5d,0x20,0x2b,0x20,
+0x31,0x2c,0x20,0x72,0x75,0x6e,0x5b,0x30,0x5d,0x20,0x2b,0x20,0x72,0x75,0x6e,0x5b,
+0x31,0x5d,0x29,0x3a,0x00,0x00,0x00,0x00,0x0e,0x18,0x00,0x0a,0x00,0x00,0x00,0x05,
+0x72,0x61,0x6e,0x67,0x65,0x00,0x00,0x00,0x0c,0x13,0x00,0x05,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x19,0x12,0x13,0x0c,0x13,0x00,0x06,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x01,0x19,0x19,0x13,0x0c,0x13,0x00,0x05,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x1a,0x12,0x13,0x0c,0x1b,0x00,0x06,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x13,0x12,0x1b,0x01,0x1a,0x1a,0x13,0x3a,0x15,0x18,0x03,
+0x3b,0x0e,0x15,0x00,0x13,0x00,0xff,0xd4,0x10,0x0c,0x0e,0x00,0x1f,0x10,0x00,0x90,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x78,0x2c,0x20,0x79,0x20,0x3d,0x20,0x66,0x69,0x6e,0x64,0x28,0x70,0x61,0x72,0x65,
+0x6e,0x74,0x2c,0x20,0x72,0x75,0x6e,0x5b,0x30,0x5d,0x29,0x2c,0x20,0x66,0x69,0x6e,
+0x64,0x28,0x70,0x61,0x72,0x65,0x6e,0x74,0x2c,0x20,0x72,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x18,0x00,0x14,0x00,0x00,0x00,0x04,0x66,0x69,0x6e,0x64,0x00,0x00,0x00,0x00,
+0x10,0x19,0x0d,0x00,0x0c,0x1b,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x1a,0x12,0x1b,0x37,0x0e,0x18,0x03,0x0e,0x19,0x00,0x14,0x00,0x00,0x00,0x04,
+0x66,0x69,0x6e,0x64,0x00,0x00,0x00,0x00,0x10,0x1a,0x0d,0x00,0x10,0x1b,0x0c,0x00,
+0x37,0x13,0x19,0x03,0x33,0x18,0x00,0x01,0x78,0x00,0x00,0x00,0x10,0x18,0x0e,0x00,
+0x33,0x0e,0x00,0x01,0x79,0x00,0x00,0x00,0x10,0x0e,0x13,0x00,0x1f,0x07,0x00,0x91,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x78,0x20,0x21,0x3d,0x20,0x79,0x3a,0x00,0x00,0x24,0x13,0x18,0x0e,
+0x16,0x13,0x00,0x00,0x13,0x00,0xff,0xcb,0x1f,0x09,0x00,0x92,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x70,0x61,0x72,0x65,0x6e,0x74,0x5b,0x79,0x5d,0x20,0x3d,0x20,0x78,0x00,0x00,0x00,
+0x0b,0x0d,0x0e,0x18,0x13,0x00,0xff,0xbf,0x1f,0x04,0x00,0x93,0x20,0x20,0x20,0x20,
+0x62,0x6c,0x6f,0x63,0x6b,0x73,0x20,0x3d,0x20,0x7b,0x7d,0x00,0x33,0x0f,0x00,0x06,
+0x62,0x6c,0x6f,0x63,0x6b,0x73,0x00,0x00,0x1b,0x0f,0x00,0x00,0x1f,0x04,0x00,0x94,
+0x20,0x20,0x20,0x20,0x66,0x69,0x72,0x73,0x74,0x20,0x3d,0x20,0x5b,0x5d,0x00,0x00,
+0x33,0x10,0x00,0x05,0x66,0x69,0x72,0x73,0x74,0x00,0x00,0x00,0x1c,0x11,0x00,0x00,
+0x10,0x10,0x11,0x00,0x1f,0x05,0x00,0x95,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,
+0x72,0x20,0x69,0x6e,0x20,0x6f,0x72,0x64,0x65,0x72,0x3a,0x00,0x0c,0x13,0x00,0x05,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x11,0x07,0x13,0x13,0x00,0x00,0x48,
+0x10,0x0c,0x11,0x00,0x1f,0x07,0x00,0x96,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x78,0x20,0x3d,0x20,0x66,0x69,0x6e,0x64,0x28,0x70,0x61,0x72,0x65,0x6e,0x74,0x2c,
+0x20,0x72,0x29,0x00,0x0e,0x15,0x00,0x14,0x00,0x00,0x00,0x04,0x66,0x69,0x6e,0x64,
+0x00,0x00,0x00,0x00,0x10,0x16,0x0d,0x00,0x10,0x17,0x0c,0x00,0x37,0x18,0x15,0x03,
+0x1f,0x07,0x00,0x97,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x78,
+0x20,0x6e,0x6f,0x74,0x20,0x69,0x6e,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x73,0x3a,0x00,
+0x08,0x11,0x18,0x0f,0x16,0x11,0x00,0x00,0x13,0x00,0x00,0x1b,0x1f,0x07,0x00,0x98,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x6c,0x6f,0x63,
+0x6b,0x73,0x5b,0x78,0x5d,0x20,0x3d,0x20,0x5b,0x5d,0x00,0x00,0x1c,0x11,0x00,0x00,
+0x0b,0x0f,0x18,0x11,0x1f,0x07,0x00,0x99,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x66,0x69,0x72,0x73,0x74,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,
+0x28,0x78,0x29,0x00,0x0d,0x19,0x00,0x09,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x15,0x10,0x19,0x00,0x00,0x00,0x08,0x10,0x17,0x18,0x00,
+0x39,0x11,0x15,0x03,0x1f,0x07,0x00,0x9a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x62,0x6c,0x6f,0x63,0x6b,0x73,0x5b,0x78,0x5d,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,
+0x28,0x72,0x29,0x00,0x0a,0x19,0x0f,0x18,0x0d,0x1a,0x00,0x09,0x00,0x00,0x00,0x06,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x15,0x19,0x1a,0x00,0x00,0x00,0x09,
+0x10,0x17,0x0c,0x00,0x39,0x11,0x15,0x03,0x13,0x00,0xff,0xb8,0x1f,0x04,0x00,0x9c,
+0x20,0x20,0x20,0x20,0x70,0x69,0x6e,0x6e,0x65,0x64,0x20,0x3d,0x20,0x7b,0x7d,0x00,
+0x33,0x11,0x00,0x06,0x70,0x69,0x6e,0x6e,0x65,0x64,0x00,0x00,0x1b,0x11,0x00,0x00,
+0x1f,0x05,0x00,0x9d,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6c,0x65,0x6e,0x28,0x6e,
+0x6f,0x64,0x65,0x73,0x29,0x3a,0x00,0x00,0x0e,0x15,0x00,0x0b,0x00,0x00,0x00,0x03,
+0x6c,0x65,0x6e,0x00,0x10,0x16,0x00,0x00,0x37,0x13,0x15,0x02,0x16,0x13,0x00,0x00,
+0x13,0x00,0x00,0x2c,0x1f,0x08,0x00,0x9e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x66,0x6f,0x72,0x20,0x72,0x20,0x69,0x6e,0x20,0x6c,0x69,0x76,0x65,0x5f,0x69,0x6e,
+0x5b,0x30,0x5d,0x3a,0x00,0x00,0x00,0x00,0x0c,0x16,0x00,0x05,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x15,0x05,0x16,0x0c,0x16,0x00,0x05,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x2b,0x13,0x15,0x16,0x13,0x00,0x00,0x1a,0x10,0x0c,0x13,0x00,
+0x1f,0x0b,0x00,0x9f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x70,0x69,0x6e,0x6e,0x65,0x64,0x5b,0x66,0x69,0x6e,0x64,0x28,0x70,0x61,0x72,0x65,
+0x6e,0x74,0x2c,0x20,0x72,0x29,0x5d,0x20,0x3d,0x20,0x54,0x72,0x75,0x65,0x00,0x00,
+0x0c,0x13,0x00,0x06,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0e,0x19,0x00,0x14,
+0x00,0x00,0x00,0x04,0x66,0x69,0x6e,0x64,0x00,0x00,0x00,0x00,0x10,0x1a,0x0d,0x00,
+0x10,0x1b,0x0c,0x00,0x37,0x17,0x19,0x03,0x0b,0x11,0x17,0x13,0x13,0x00,0xff,0xe6,
+0x1f,0x04,0x00,0xa1,0x20,0x20,0x20,0x20,0x6e,0x65,0x77,0x20,0x3d,0x20,0x7b,0x7d,
+0x00,0x00,0x00,0x00,0x33,0x13,0x00,0x03,0x6e,0x65,0x77,0x00,0x1b,0x13,0x00,0x00,
+0x1f,0x04,0x00,0xa2,0x20,0x20,0x20,0x20,0x74,0x6f,0x64,0x6f,0x20,0x3d,0x20,0x5b,
+0x5d,0x00,0x00,0x00,0x33,0x15,0x00,0x04,0x74,0x6f,0x64,0x6f,0x00,0x00,0x00,0x00,
+0x1c,0x16,0x00,0x00,0x10,0x15,0x16,0x00,0x1f,0x05,0x00,0xa3,0x20,0x20,0x20,0x20,
+0x66,0x6f,0x72,0x20,0x78,0x20,0x69,0x6e,0x20,0x66,0x69,0x72,0x73,0x74,0x3a,0x00,
+0x0c,0x17,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x16,0x10,0x17,
+0x13,0x00,0x00,0x19,0x10,0x18,0x16,0x00,0x1f,0x0a,0x00,0xa4,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x78,0x20,0x69,0x6e,0x20,0x70,0x69,0x6e,0x6e,
+0x65,0x64,0x3a,0x20,0x74,0x6f,0x64,0x6f,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,
+0x78,0x29,0x00,0x00,0x25,0x16,0x18,0x11,0x16,0x16,0x00,0x00,0x13,0x00,0xff,0xf0,
+0x0d,0x04,0x00,0x09,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x19,0x15,0x04,0x00,0x00,0x00,0x0a,0x10,0x1b,0x18,0x00,0x39,0x16,0x19,0x03,
+0x13,0x00,0xff,0xe7,0x1f,0x05,0x00,0xa5,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,
+0x78,0x20,0x69,0x6e,0x20,0x66,0x69,0x72,0x73,0x74,0x3a,0x00,0x0c,0x17,0x00,0x05,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x16,0x10,0x17,0x13,0x00,0x00,0x1a,
+0x10,0x18,0x16,0x00,0x1f,0x0b,0x00,0xa6,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x78,0x20,0x6e,0x6f,0x74,0x20,0x69,0x6e,0x20,0x70,0x69,0x6e,0x6e,
+0x65,0x64,0x3a,0x20,0x74,0x6f,0x64,0x6f,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,
+0x78,0x29,0x00,0x00,0x08,0x16,0x18,0x11,0x16,0x16,0x00,0x00,0x13,0x00,0xff,0xef,
+0x0d,0x04,0x00,0x09,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x19,0x15,0x04,0x00,0x00,0x00,0x0b,0x10,0x1b,0x18,0x00,0x39,0x16,0x19,0x03,
+0x13,0x00,0xff,0xe6,0x1f,0x05,0x00,0xa7,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,
+0x78,0x20,0x69,0x6e,0x20,0x74,0x6f,0x64,0x6f,0x3a,0x00,0x00,0x0c,0x17,0x00,0x05,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x16,0x15,0x17,0x13,0x00,0x01,0xb1,
+0x10,0x18,0x16,0x00,0x1f,0x07,0x00,0xa8,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x62,0x6c,0x6f,0x63,0x6b,0x20,0x3d,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x73,0x5b,0x78,
+0x5d,0x00,0x00,0x00,0x33,0x16,0x00,0x05,0x62,0x6c,0x6f,0x63,0x6b,0x00,0x00,0x00,
+0x0a,0x16,0x0f,0x18,0x1f,0x06,0x00,0xa9,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6c,0x6f,0x20,0x3d,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x5b,0x30,0x5d,0x00,0x00,0x00,
+0x33,0x19,0x00,0x02,0x6c,0x6f,0x00,0x00,0x0c,0x1b,0x00,0x05,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x1a,0x16,0x1b,0x10,0x19,0x1a,0x00,0x1f,0x06,0x00,0xaa,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x72,0x20,0x69,0x6e,
+0x20,0x62,0x6c,0x6f,0x63,0x6b,0x3a,0x00,0x0c,0x1b,0x00,0x05,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x2b,0x1a,0x16,0x1b,0x13,0x00,0x00,0x12,0x10,0x0c,0x1a,0x00,
+0x1f,0x07,0x00,0xab,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6c,0x6f,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x6c,0x6f,0x2c,0x20,0x72,0x29,0x00,
+0x0e,0x04,0x00,0x15,0x00,0x00,0x00,0x03,0x6d,0x69,0x6e,0x00,0x10,0x05,0x19,0x00,
+0x10,0x06,0x0c,0x00,0x37,0x1a,0x04,0x03,0x10,0x19,0x1a,0x00,0x13,0x00,0xff,0xee,
+0x1f,0x06,0x00,0xac,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x78,
+0x20,0x69,0x6e,0x20,0x70,0x69,0x6e,0x6e,0x65,0x64,0x3a,0x00,0x25,0x1a,0x18,0x11,
+0x16,0x1a,0x00,0x00,0x13,0x00,0x00,0x10,0x1f,0x07,0x00,0xad,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x61,0x73,0x65,0x73,0x20,0x3d,0x20,
+0x5b,0x6c,0x6f,0x5d,0x00,0x00,0x00,0x00,0x33,0x1a,0x00,0x05,0x62,0x61,0x73,0x65,
+0x73,0x00,0x00,0x00,0x10,0x04,0x19,0x00,0x1c,0x1b,0x04,0x01,0x10,0x1a,0x1b,0x00,
+0x13,0x00,0x00,0x8e,0x1f,0x04,0x00,0xae,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x65,0x6c,0x73,0x65,0x3a,0x00,0x00,0x00,0x1f,0x06,0x00,0xb0,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x61,0x73,0x65,0x73,0x20,0x3d,0x20,
+0x5b,0x5d,0x00,0x00,0x1c,0x1b,0x00,0x00,0x10,0x1a,0x1b,0x00,0x1f,0x07,0x00,0xb1,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,
+0x72,0x20,0x69,0x6e,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x3a,0x00,0x0c,0x04,0x00,0x05,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x1b,0x16,0x04,0x13,0x00,0x00,0x44,
+0x10,0x0c,0x1b,0x00,0x1f,0x09,0x00,0xb2,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x73,0x20,0x69,0x6e,
+0x20,0x70,0x72,0x65,0x66,0x65,0x72,0x5b,0x72,0x5d,0x3a,0x00,0x0a,0x05,0x03,0x0c,
+0x0c,0x06,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x1b,0x05,0x06,
+0x13,0x00,0xff,0xee,0x10,0x14,0x1b,0x00,0x1f,0x0e,0x00,0xb3,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x73,0x20,0x69,0x6e,0x20,0x6e,0x65,0x77,0x20,0x61,0x6e,0x64,0x20,
+0x6e,0x65,0x77,0x5b,0x73,0x5d,0x20,0x3e,0x3d,0x20,0x72,0x20,0x2d,0x20,0x6c,0x6f,
+0x3a,0x00,0x00,0x00,0x25,0x1b,0x14,0x13,0x16,0x1b,0x00,0x00,0x13,0x00,0x00,0x04,
+0x0a,0x1b,0x13,0x14,0x02,0x22,0x0c,0x19,0x35,0x1b,0x1b,0x22,0x16,0x1b,0x00,0x00,
+0x13,0x00,0xff,0xe7,0x1f,0x0e,0x00,0xb4,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x62,0x61,0x73,0x65,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x6e,0x65,0x77,
+0x5b,0x73,0x5d,0x20,0x2d,0x20,0x28,0x72,0x20,0x2d,0x20,0x6c,0x6f,0x29,0x29,0x00,
+0x0d,0x25,0x00,0x09,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x22,0x1a,0x25,0x00,0x00,0x00,0x0c,0x0a,0x24,0x13,0x14,0x02,0x25,0x0c,0x19,
+0x02,0x24,0x24,0x25,0x39,0x1b,0x22,0x03,0x13,0x00,0xff,0xcd,0x1f,0x0a,0x00,0xb5,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,
+0x62,0x61,0x73,0x65,0x20,0x69,0x6e,0x20,0x72,0x61,0x6e,0x67,0x65,0x28,0x30,0x2c,
+0x20,0x32,0x35,0x36,0x29,0x3a,0x00,0x00,0x0e,0x22,0x00,0x0a,0x00,0x00,0x00,0x05,
+0x72,0x61,0x6e,0x67,0x65,0x00,0x00,0x00,0x0c,0x23,0x00,0x05,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0c,0x24,0x00,0x16,0x00,0x00,0x69,0x04,0x00,0x01,0x00,0x00,
+0x3a,0x04,0x22,0x03,0x3b,0x1b,0x04,0x00,0x13,0x00,0x00,0x18,0x33,0x22,0x00,0x04,
+0x62,0x61,0x73,0x65,0x00,0x00,0x00,0x00,0x10,0x22,0x1b,0x00,0x1f,0x09,0x00,0xb6,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x62,0x61,0x73,0x65,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x62,0x61,0x73,
+0x65,0x29,0x00,0x00,0x0d,0x0b,0x00,0x09,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x23,0x1a,0x0b,0x00,0x00,0x00,0x0d,0x10,0x25,0x22,0x00,
+0x39,0x1b,0x23,0x03,0x13,0x00,0xff,0xe8,0x1f,0x07,0x00,0xb7,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x62,0x61,0x73,0x65,0x20,0x69,0x6e,0x20,
+0x62,0x61,0x73,0x65,0x73,0x3a,0x00,0x00,0x0c,0x04,0x00,0x05,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x2b,0x1b,0x1a,0x04,0x13,0x00,0x00,0xab,0x10,0x22,0x1b,0x00,
+0x1f,0x06,0x00,0xb8,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6f,0x6b,0x20,0x3d,0x20,0x54,0x72,0x75,0x65,0x00,0x00,0x00,0x33,0x1b,0x00,0x02,
+0x6f,0x6b,0x00,0x00,0x0c,0x05,0x00,0x06,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x10,0x1b,0x05,0x00,0x1f,0x07,0x00,0xb9,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x72,0x20,0x69,0x6e,0x20,0x62,0x6c,0x6f,
+0x63,0x6b,0x3a,0x00,0x0c,0x06,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x2b,0x05,0x16,0x06,0x13,0x00,0x00,0x81,0x10,0x0c,0x05,0x00,0x1f,0x09,0x00,0xba,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x76,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x72,0x20,0x2d,0x20,0x6c,
+0x6f,0x00,0x00,0x00,0x33,0x05,0x00,0x01,0x76,0x00,0x00,0x00,0x01,0x23,0x22,0x0c,
+0x02,0x05,0x23,0x19,0x1f,0x07,0x00,0xbb,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x76,0x20,0x3e,0x20,0x32,
+0x35,0x35,0x3a,0x00,0x0c,0x24,0x00,0x17,0x00,0x00,0x69,0x04,0xff,0x00,0x00,0x00,
+0x36,0x23,0x05,0x24,0x16,0x23,0x00,0x00,0x13,0x00,0x00,0x16,0x1f,0x08,0x00,0xbc,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6f,0x6b,0x20,0x3d,0x20,0x46,0x61,0x6c,0x73,0x65,0x00,0x00,
+0x0c,0x1b,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x1f,0x07,0x00,0xbd,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x62,0x72,0x65,0x61,0x6b,0x00,0x00,0x00,0x13,0x00,0x00,0x4f,
+0x1f,0x09,0x00,0xbe,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x73,0x20,0x69,0x6e,0x20,0x61,0x64,0x6a,
+0x5b,0x72,0x5d,0x3a,0x00,0x00,0x00,0x00,0x0a,0x24,0x08,0x0c,0x0c,0x25,0x00,0x05,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x23,0x24,0x25,0x13,0x00,0x00,0x2d,
+0x10,0x14,0x23,0x00,0x1f,0x0d,0x00,0xbf,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x73,
+0x20,0x69,0x6e,0x20,0x6e,0x65,0x77,0x20,0x61,0x6e,0x64,0x20,0x6e,0x65,0x77,0x5b,
+0x73,0x5d,0x20,0x3d,0x3d,0x20,0x76,0x3a,0x00,0x00,0x00,0x00,0x25,0x23,0x14,0x13,
+0x16,0x23,0x00,0x00,0x13,0x00,0x00,0x03,0x0a,0x23,0x13,0x14,0x18,0x23,0x23,0x05,
+0x16,0x23,0x00,0x00,0x13,0x00,0xff,0xe9,0x1f,0x09,0x00,0xc0,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6f,0x6b,0x20,0x3d,0x20,0x46,0x61,0x6c,0x73,0x65,0x00,0x00,
+0x0c,0x1b,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x1f,0x08,0x00,0xc1,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x72,0x65,0x61,0x6b,0x00,0x00,0x00,
+0x1f,0x07,0x00,0xc2,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,0x6f,0x74,0x20,0x6f,0x6b,0x3a,0x00,0x00,
+0x2f,0x1b,0x00,0x00,0x13,0x00,0xff,0x87,0x1f,0x07,0x00,0xc3,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x62,0x72,0x65,0x61,0x6b,0x00,0x00,0x00,0x1f,0x05,0x00,0xc4,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6f,0x6b,0x3a,0x00,0x00,
+0x16,0x1b,0x00,0x00,0x13,0x00,0xff,0x5c,0x1f,0x06,0x00,0xc5,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x72,0x65,0x61,
+0x6b,0x00,0x00,0x00,0x1f,0x06,0x00,0xc6,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x66,0x6f,0x72,0x20,0x72,0x20,0x69,0x6e,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x3a,0x00,
+0x0c,0x06,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x04,0x16,0x06,
+0x13,0x00,0xfe,0x5e,0x10,0x0c,0x04,0x00,0x1f,0x09,0x00,0xc7,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x65,0x77,0x5b,0x72,0x5d,0x20,0x3d,
+0x20,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x72,0x20,0x2d,0x20,0x6c,0x6f,0x00,0x00,
+0x01,0x04,0x22,0x0c,0x02,0x04,0x04,0x19,0x0b,0x13,0x0c,0x04,0x13,0x00,0xff,0xf0,
+0x1f,0x07,0x00,0xc9,0x20,0x20,0x20,0x20,0x73,0x69,0x7a,0x65,0x20,0x3d,0x20,0x6d,
+0x61,0x78,0x28,0x32,0x2c,0x20,0x6e,0x70,0x61,0x72,0x61,0x6d,0x73,0x29,0x00,0x00,
+0x33,0x17,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x0e,0x23,0x00,0x18,
+0x00,0x00,0x00,0x03,0x6d,0x61,0x78,0x00,0x0c,0x24,0x00,0x0f,0x00,0x00,0x69,0x04,
+0x02,0x00,0x00,0x00,0x10,0x25,0x02,0x00,0x37,0x04,0x23,0x03,0x10,0x17,0x04,0x00,
+0x1f,0x05,0x00,0xca,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x72,0x20,0x69,0x6e,
+0x20,0x6e,0x65,0x77,0x3a,0x00,0x00,0x00,0x0c,0x06,0x00,0x05,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x2b,0x04,0x13,0x06,0x13,0x00,0x00,0x19,0x10,0x0c,0x04,0x00,
+0x1f,0x0a,0x00,0xcb,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x69,0x7a,0x65,
+0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x73,0x69,0x7a,0x65,0x2c,0x20,0x6e,0x65,0x77,
+0x5b,0x72,0x5d,0x20,0x2b,0x20,0x31,0x29,0x00,0x00,0x00,0x00,0x0e,0x23,0x00,0x18,
+0x00,0x00,0x00,0x03,0x6d,0x61,0x78,0x00,0x10,0x24,0x17,0x00,0x0a,0x25,0x13,0x0c,
+0x0c,0x0b,0x00,0x06,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x25,0x25,0x0b,
+0x37,0x04,0x23,0x03,0x10,0x17,0x04,0x00,0x13,0x00,0xff,0xe7,0x1f,0x06,0x00,0xcc,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x73,0x69,0x7a,0x65,0x20,0x3e,0x20,0x6e,0x72,
+0x65,0x67,0x73,0x3a,0x00,0x00,0x00,0x00,0x36,0x04,0x17,0x01,0x16,0x04,0x00,0x00,
+0x13,0x00,0x00,0x09,0x1f,0x06,0x00,0xce,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6e,0x72,0x65,0x67,0x73,0x00,0x00,0x00,0x00,
+0x15,0x01,0x00,0x00,0x1f,0x08,0x00,0xcf,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,
+0x6b,0x20,0x69,0x6e,0x20,0x72,0x61,0x6e,0x67,0x65,0x28,0x6c,0x65,0x6e,0x28,0x6e,
+0x6f,0x64,0x65,0x73,0x29,0x29,0x3a,0x00,0x0e,0x0b,0x00,0x0a,0x00,0x00,0x00,0x05,
+0x72,0x61,0x6e,0x67,0x65,0x00,0x00,0x00,0x0e,0x0d,0x00,0x0b,0x00,0x00,0x00,0x03,
+0x6c,0x65,0x6e,0x00,0x10,0x0e,0x00,0x00,0x37,0x0c,0x0d,0x02,0x3a,0x23,0x0b,0x02,
+0x3b,0x04,0x23,0x00,0x13,0x00,0x00,0xc6,0x10,0x0a,0x04,0x00,0x1f,0x06,0x00,0xd0,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x20,0x3d,0x20,0x6e,0x6f,0x64,0x65,
+0x73,0x5b,0x6b,0x5d,0x00,0x00,0x00,0x00,0x0a,0x09,0x00,0x0a,0x1f,0x0f,0x00,0xd1,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x70,0x65,0x65,0x70,0x68,
+0x6f,0x6c,0x65,0x2e,0x69,0x73,0x5f,0x63,0x6f,0x64,0x65,0x28,0x6e,0x2c,0x20,0x56,
+0x41,0x52,0x29,0x20,0x61,0x6e,0x64,0x20,0x6e,0x5b,0x32,0x5d,0x20,0x6e,0x6f,0x74,
+0x20,0x69,0x6e,0x20,0x6e,0x65,0x77,0x3a,0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x02,
+0x00,0x00,0x00,0x08,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x00,0x00,0x00,0x00,
+0x0d,0x0f,0x00,0x0c,0x00,0x00,0x00,0x07,0x69,0x73,0x5f,0x63,0x6f,0x64,0x65,0x00,
+0x38,0x0b,0x06,0x0f,0x00,0x00,0x00,0x0e,0x10,0x0d,0x09,0x00,0x0e,0x0e,0x00,0x19,
+0x00,0x00,0x00,0x03,0x56,0x41,0x52,0x00,0x39,0x04,0x0b,0x04,0x16,0x04,0x00,0x00,
+0x13,0x00,0x00,0x06,0x0c,0x06,0x00,0x0f,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,
+0x0a,0x04,0x09,0x06,0x08,0x04,0x04,0x13,0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x18,
+0x1f,0x08,0x00,0xd3,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6e,0x6f,0x64,0x65,0x73,0x5b,0x6b,0x5d,0x20,0x3d,0x20,0x5b,0x27,0x64,0x65,0x61,
+0x64,0x27,0x5d,0x00,0x0d,0x06,0x00,0x1a,0x00,0x00,0x00,0x04,0x64,0x65,0x61,0x64,
+0x00,0x00,0x00,0x00,0x1c,0x04,0x06,0x01,0x0b,0x00,0x0a,0x04,0x1f,0x06,0x00,0xd4,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,
+0x69,0x6e,0x75,0x65,0x00,0x00,0x00,0x00,0x13,0x00,0xff,0xb6,0x1f,0x07,0x00,0xd5,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x66,0x20,0x69,0x6e,
+0x20,0x66,0x69,0x65,0x6c,0x64,0x73,0x28,0x6e,0x29,0x3a,0x00,0x0e,0x0b,0x00,0x1b,
+0x00,0x00,0x00,0x06,0x66,0x69,0x65,0x6c,0x64,0x73,0x00,0x00,0x10,0x0c,0x09,0x00,
+0x37,0x06,0x0b,0x02,0x0c,0x0b,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x2b,0x04,0x06,0x0b,0x13,0x00,0x00,0x11,0x33,0x0c,0x00,0x01,0x66,0x00,0x00,0x00,
+0x10,0x0c,0x04,0x00,0x1f,0x08,0x00,0xd6,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6e,0x5b,0x66,0x5d,0x20,0x3d,0x20,0x6e,0x65,0x77,0x5b,0x6e,
+0x5b,0x66,0x5d,0x5d,0x00,0x00,0x00,0x00,0x0a,0x0d,0x09,0x0c,0x0a,0x04,0x13,0x0d,
+0x0b,0x09,0x0c,0x04,0x13,0x00,0xff,0xef,0x1f,0x18,0x00,0xd7,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x2e,
+0x69,0x73,0x5f,0x63,0x6f,0x64,0x65,0x28,0x6e,0x2c,0x20,0x4d,0x4f,0x56,0x45,0x29,
+0x20,0x61,0x6e,0x64,0x20,0x6e,0x5b,0x32,0x5d,0x20,0x3d,0x3d,0x20,0x6e,0x5b,0x33,
+0x5d,0x20,0x61,0x6e,0x64,0x20,0x6e,0x6f,0x74,0x20,0x70,0x65,0x65,0x70,0x68,0x6f,
+0x6c,0x65,0x2e,0x61,0x66,0x74,0x65,0x72,0x5f,0x73,0x6b,0x69,0x70,0x28,0x6e,0x6f,
+0x64,0x65,0x73,0x2c,0x20,0x6b,0x29,0x3a,0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x02,
+0x00,0x00,0x00,0x08,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x00,0x00,0x00,0x00,
+0x0d,0x0b,0x00,0x0c,0x00,0x00,0x00,0x07,0x69,0x73,0x5f,0x63,0x6f,0x64,0x65,0x00,
+0x38,0x0d,0x06,0x0b,0x00,0x00,0x00,0x0f,0x10,0x0f,0x09,0x00,0x0e,0x10,0x00,0x0d,
+0x00,0x00,0x00,0x04,0x4d,0x4f,0x56,0x45,0x00,0x00,0x00,0x00,0x39,0x04,0x0d,0x04,
+0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x0a,0x0c,0x06,0x00,0x0f,0x00,0x00,0x69,0x04,
+0x02,0x00,0x00,0x00,0x0a,0x04,0x09,0x06,0x0c,0x0b,0x00,0x0e,0x00,0x00,0x69,0x04,
+0x03,0x00,0x00,0x00,0x0a,0x06,0x09,0x0b,0x18,0x04,0x04,0x06,0x16,0x04,0x00,0x00,
+0x13,0x00,0x00,0x11,0x0e,0x0b,0x00,0x02,0x00,0x00,0x00,0x08,0x70,0x65,0x65,0x70,
+0x68,0x6f,0x6c,0x65,0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x1c,0x00,0x00,0x00,0x0a,
+0x61,0x66,0x74,0x65,0x72,0x5f,0x73,0x6b,0x69,0x70,0x00,0x00,0x38,0x0d,0x0b,0x01,
+0x00,0x00,0x00,0x10,0x10,0x0f,0x00,0x00,0x10,0x10,0x0a,0x00,0x39,0x06,0x0d,0x04,
+0x30,0x04,0x06,0x00,0x16,0x04,0x00,0x00,0x13,0x00,0xff,0x4a,0x1f,0x08,0x00,0xd8,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x6f,0x64,0x65,
+0x73,0x5b,0x6b,0x5d,0x20,0x3d,0x20,0x5b,0x27,0x64,0x65,0x61,0x64,0x27,0x5d,0x00,
+0x0d,0x06,0x00,0x1a,0x00,0x00,0x00,0x04,0x64,0x65,0x61,0x64,0x00,0x00,0x00,0x00,
+0x1c,0x04,0x06,0x01,0x0b,0x00,0x0a,0x04,0x13,0x00,0xff,0x3a,0x1f,0x04,0x00,0xd9,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x69,0x7a,0x65,0x00,
+0x15,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x07,0x00,0x1c,0x00,0x00,0x00,0x08,
+0x61,0x6c,0x6c,0x6f,0x63,0x61,0x74,0x65,0x00,0x00,0x00,0x00,0x0f,0x07,0x06,0x00,
+0x1f,0x06,0x00,0xdb,0x64,0x65,0x66,0x20,0x6f,0x70,0x74,0x69,0x6d,0x69,0x7a,0x65,
+0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x07,0x00,0x04,
+0x2a,0x24,0x37,0x38,0x00,0x00,0x00,0x00,0x0d,0x0c,0x00,0x11,0x00,0x00,0x00,0x05,
+0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x1c,0x08,0x0c,0x01,0x1c,0x09,0x00,0x00,
+0x1d,0x0a,0x00,0x00,0x1d,0x0b,0x00,0x00,0x11,0x07,0x01,0x30,0x2d,0x0a,0x00,0x0f,
+0x00,0x00,0x00,0x01,0x1f,0x06,0x00,0xdb,0x64,0x65,0x66,0x20,0x6f,0x70,0x74,0x69,
+0x6d,0x69,0x7a,0x65,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x00,0x00,0x05,0x6e,0x6f,0x64,0x65,0x73,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x72,0x65,0x67,0x61,0x6c,0x6c,0x6f,0x63,0x2e,0x70,0x79,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x08,0x6f,0x70,0x74,0x69,
+0x6d,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x05,0x00,0xdc,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x6e,0x20,0x69,0x6e,0x20,0x6e,0x6f,0x64,
+0x65,0x73,0x3a,0x00,0x0c,0x02,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x2b,0x01,0x00,0x02,0x13,0x00,0x00,0x2f,0x33,0x03,0x00,0x01,0x6e,0x00,0x00,0x00,
+0x10,0x03,0x01,0x00,0x1f,0x07,0x00,0xdd,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x6e,0x5b,0x30,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x66,0x6e,0x63,0x27,
+0x3a,0x00,0x00,0x00,0x0c,0x04,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x01,0x03,0x04,0x0d,0x04,0x00,0x03,0x00,0x00,0x00,0x03,0x66,0x6e,0x63,0x00,
+0x18,0x01,0x01,0x04,0x16,0x01,0x00,0x00,0x13,0x00,0xff,0xea,0x1f,0x09,0x00,0xde,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x5b,0x33,0x5d,
+0x20,0x3d,0x20,0x6f,0x70,0x74,0x69,0x6d,0x69,0x7a,0x65,0x28,0x6e,0x5b,0x33,0x5d,
+0x29,0x00,0x00,0x00,0x0e,0x04,0x00,0x01,0x00,0x00,0x00,0x08,0x6f,0x70,0x74,0x69,
+0x6d,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x0c,0x06,0x00,0x04,0x00,0x00,0x69,0x04,
+0x03,0x00,0x00,0x00,0x0a,0x05,0x03,0x06,0x37,0x01,0x04,0x02,0x0c,0x04,0x00,0x04,
+0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,0x0b,0x03,0x04,0x01,0x13,0x00,0xff,0xd1,
+0x1f,0x05,0x00,0xdf,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x6e,0x20,0x69,0x6e,
+0x20,0x6e,0x6f,0x64,0x65,0x73,0x3a,0x00,0x0c,0x02,0x00,0x02,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x2b,0x01,0x00,0x02,0x13,0x00,0x00,0xb7,0x10,0x03,0x01,0x00,
+0x1f,0x07,0x00,0xe0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,
+0x5b,0x30,0x5d,0x20,0x21,0x3d,0x20,0x27,0x72,0x65,0x67,0x73,0x27,0x3a,0x00,0x00,
+0x0c,0x04,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x01,0x03,0x04,
+0x0d,0x04,0x00,0x05,0x00,0x00,0x00,0x04,0x72,0x65,0x67,0x73,0x00,0x00,0x00,0x00,
+0x24,0x01,0x01,0x04,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x09,0x1f,0x06,0x00,0xe1,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,
+0x69,0x6e,0x75,0x65,0x00,0x00,0x00,0x00,0x13,0x00,0xff,0xe3,0x1f,0x05,0x00,0xe2,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x6d,0x20,0x3d,0x20,0x6e,
+0x5b,0x31,0x5d,0x00,0x33,0x01,0x00,0x04,0x69,0x74,0x65,0x6d,0x00,0x00,0x00,0x00,
+0x0c,0x05,0x00,0x06,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x01,0x03,0x05,
+0x1f,0x05,0x00,0xe5,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x70,0x61,0x72,
+0x61,0x6d,0x73,0x20,0x3d,0x20,0x30,0x00,0x33,0x04,0x00,0x07,0x6e,0x70,0x61,0x72,
+0x61,0x6d,0x73,0x00,0x0c,0x04,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x1f,0x07,0x00,0xe6,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6c,
+0x65,0x6e,0x28,0x69,0x74,0x65,0x6d,0x29,0x20,0x3e,0x20,0x34,0x3a,0x00,0x00,0x00,
+0x0e,0x06,0x00,0x07,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x10,0x07,0x01,0x00,
+0x37,0x05,0x06,0x02,0x0c,0x06,0x00,0x08,0x00,0x00,0x69,0x04,0x04,0x00,0x00,0x00,
+0x36,0x05,0x05,0x06,0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x0e,0x1f,0x08,0x00,0xe7,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x70,0x61,0x72,
+0x61,0x6d,0x73,0x20,0x3d,0x20,0x69,0x74,0x65,0x6d,0x5b,0x34,0x5d,0x00,0x00,0x00,
+0x0c,0x06,0x00,0x08,0x00,0x00,0x69,0x04,0x04,0x00,0x00,0x00,0x0a,0x04,0x01,0x06,
+0x1f,0x09,0x00,0xe8,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x74,
+0x73,0x5b,0x27,0x62,0x65,0x66,0x6f,0x72,0x65,0x27,0x5d,0x20,0x2b,0x3d,0x20,0x69,
+0x74,0x65,0x6d,0x5b,0x31,0x5d,0x00,0x00,0x0e,0x05,0x00,0x09,0x00,0x00,0x00,0x05,
+0x73,0x74,0x61,0x74,0x73,0x00,0x00,0x00,0x0e,0x06,0x00,0x09,0x00,0x00,0x00,0x05,
+0x73,0x74,0x61,0x74,0x73,0x00,0x00,0x00,0x0d,0x07,0x00,0x0a,0x00,0x00,0x00,0x06,
+0x62,0x65,0x66,0x6f,0x72,0x65,0x00,0x00,0x0a,0x06,0x06,0x07,0x0c,0x08,0x00,0x06,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x07,0x01,0x08,0x01,0x06,0x06,0x07,
+0x0d,0x07,0x00,0x0a,0x00,0x00,0x00,0x06,0x62,0x65,0x66,0x6f,0x72,0x65,0x00,0x00,
+0x0b,0x05,0x07,0x06,0x1f,0x0d,0x00,0xe9,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x74,0x65,0x6d,0x5b,0x31,0x5d,0x20,0x3d,0x20,0x61,0x6c,0x6c,0x6f,0x63,0x61,
+0x74,0x65,0x28,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x69,0x74,0x65,0x6d,0x5b,0x31,
+0x5d,0x2c,0x20,0x6e,0x70,0x61,0x72,0x61,0x6d,0x73,0x29,0x00,0x0e,0x06,0x00,0x0b,
+0x00,0x00,0x00,0x08,0x61,0x6c,0x6c,0x6f,0x63,0x61,0x74,0x65,0x00,0x00,0x00,0x00,
+0x10,0x07,0x00,0x00,0x0c,0x03,0x00,0x06,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0a,0x08,0x01,0x03,0x10,0x09,0x04,0x00,0x37,0x05,0x06,0x04,0x0c,0x06,0x00,0x06,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0b,0x01,0x06,0x05,0x1f,0x09,0x00,0xea,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x74,0x73,0x5b,0x27,0x61,
+0x66,0x74,0x65,0x72,0x27,0x5d,0x20,0x2b,0x3d,0x20,0x69,0x74,0x65,0x6d,0x5b,0x31,
+0x5d,0x00,0x00,0x00,0x0e,0x05,0x00,0x09,0x00,0x00,0x00,0x05,0x73,0x74,0x61,0x74,
+0x73,0x00,0x00,0x00,0x0e,0x06,0x00,0x09,0x00,0x00,0x00,0x05,0x73,0x74,0x61,0x74,
+0x73,0x00,0x00,0x00,0x0d,0x07,0x00,0x0c,0x00,0x00,0x00,0x05,0x61,0x66,0x74,0x65,
+0x72,0x00,0x00,0x00,0x0a,0x06,0x06,0x07,0x0c,0x08,0x00,0x06,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x0a,0x07,0x01,0x08,0x01,0x06,0x06,0x07,0x0d,0x07,0x00,0x0c,
+0x00,0x00,0x00,0x05,0x61,0x66,0x74,0x65,0x72,0x00,0x00,0x00,0x0b,0x05,0x07,0x06,
+0x13,0x00,0xff,0x49,0x1f,0x09,0x00,0xeb,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x2e,0x73,0x77,0x65,0x65,
+0x70,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,0x00,0x00,0x00,0x00,0x0e,0x08,0x00,0x0d,
+0x00,0x00,0x00,0x08,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x00,0x00,0x00,0x00,
+0x0d,0x09,0x00,0x0e,0x00,0x00,0x00,0x05,0x73,0x77,0x65,0x65,0x70,0x00,0x00,0x00,
+0x38,0x05,0x08,0x09,0x00,0x00,0x00,0x00,0x10,0x07,0x00,0x00,0x39,0x02,0x05,0x03,
+0x15,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x08,0x00,0x1d,0x00,0x00,0x00,0x08,
+0x6f,0x70,0x74,0x69,0x6d,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x0f,0x08,0x07,0x00,
+0x1f,0x05,0x00,0xed,0x64,0x65,0x66,0x20,0x72,0x65,0x67,0x61,0x6c,0x6c,0x6f,0x63,
+0x28,0x6f,0x75,0x74,0x29,0x3a,0x00,0x00,0x33,0x08,0x00,0x04,0x2a,0x24,0x38,0x35,
+0x00,0x00,0x00,0x00,0x0d,0x0d,0x00,0x1e,0x00,0x00,0x00,0x03,0x6f,0x75,0x74,0x00,
+0x1c,0x09,0x0d,0x01,0x1c,0x0a,0x00,0x00,0x1d,0x0b,0x00,0x00,0x1d,0x0c,0x00,0x00,
+0x11,0x08,0x00,0x71,0x2d,0x08,0x00,0x08,0x00,0x00,0x00,0x02,0x1f,0x05,0x00,0xed,
+0x64,0x65,0x66,0x20,0x72,0x65,0x67,0x61,0x6c,0x6c,0x6f,0x63,0x28,0x6f,0x75,0x74,
+0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x03,0x6f,0x75,0x74,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x72,0x65,0x67,0x61,0x6c,0x6c,0x6f,0x63,0x2e,0x70,0x79,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x08,0x72,0x65,0x67,0x61,
+0x6c,0x6c,0x6f,0x63,0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x0b,0x00,0xef,
+0x20,0x20,0x20,0x20,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x69,0x20,0x3d,0x20,0x70,
+0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x2e,0x70,0x61,0x72,0x73,0x65,0x28,0x6f,0x75,
+0x74,0x2c,0x20,0x30,0x2c,0x20,0x4e,0x6f,0x6e,0x65,0x29,0x00,0x0e,0x07,0x00,0x02,
+0x00,0x00,0x00,0x08,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x00,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x70,0x61,0x72,0x73,0x65,0x00,0x00,0x00,
+0x38,0x02,0x07,0x01,0x00,0x00,0x00,0x00,0x10,0x04,0x00,0x00,0x0c,0x05,0x00,0x04,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x1d,0x06,0x00,0x00,0x39,0x01,0x02,0x05,
+0x33,0x01,0x00,0x03,0x2a,0x24,0x32,0x00,0x33,0x02,0x00,0x05,0x6e,0x6f,0x64,0x65,
+0x73,0x00,0x00,0x00,0x0c,0x04,0x00,0x04,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0a,0x02,0x01,0x04,0x33,0x03,0x00,0x01,0x69,0x00,0x00,0x00,0x0c,0x05,0x00,0x05,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x03,0x01,0x05,0x1f,0x07,0x00,0xf0,
+0x20,0x20,0x20,0x20,0x6e,0x6f,0x64,0x65,0x73,0x20,0x3d,0x20,0x6f,0x70,0x74,0x69,
+0x6d,0x69,0x7a,0x65,0x28,0x6e,0x6f,0x64,0x65,0x73,0x29,0x00,0x0e,0x04,0x00,0x06,
+0x00,0x00,0x00,0x08,0x6f,0x70,0x74,0x69,0x6d,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,
+0x10,0x05,0x02,0x00,0x37,0x02,0x04,0x02,0x1f,0x0a,0x00,0xf1,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x70,0x65,0x65,0x70,0x68,0x6f,0x6c,0x65,0x2e,
+0x75,0x6e,0x70,0x61,0x72,0x73,0x65,0x28,0x6e,0x6f,0x64,0x65,0x73,0x2c,0x20,0x5b,
+0x5d,0x29,0x00,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x08,0x70,0x65,0x65,0x70,
+0x68,0x6f,0x6c,0x65,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x07,0x00,0x00,0x00,0x07,
+0x75,0x6e,0x70,0x61,0x72,0x73,0x65,0x00,0x38,0x04,0x01,0x00,0x00,0x00,0x00,0x01,
+0x10,0x06,0x02,0x00,0x1c,0x07,0x00,0x00,0x39,0x01,0x04,0x04,0x15,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x09,0x00,0x1f,0x00,0x00,0x00,0x08,0x72,0x65,0x67,0x61,
+0x6c,0x6c,0x6f,0x63,0x00,0x00,0x00,0x00,0x0f,0x09,0x08,0x00,0x00,0x00,0x00,0x00,
+};
+
+static tpd_code * _tp_tinypy_compiler_regalloc_0(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 31: goto L31;
+        case 39: goto L39;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 60: goto L60;
+        case 65: goto L65;
+        case 73: goto L73;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 95: goto L95;
+        case 100: goto L100;
+        case 109: goto L109;
+        case 110: goto L110;
+        case 111: goto L111;
+        case 116: goto L116;
+        case 117: goto L117;
+        case 126: goto L126;
+        case 130: goto L130;
+        case 134: goto L134;
+        case 137: goto L137;
+        case 141: goto L141;
+        case 144: goto L144;
+        case 145: goto L145;
+        case 146: goto L146;
+        case 151: goto L151;
+        case 154: goto L154;
+        case 157: goto L157;
+        case 158: goto L158;
+        case 159: goto L159;
+        case 160: goto L160;
+        case 161: goto L161;
+        case 543: goto L543;
+        case 547: goto L547;
+        case 548: goto L548;
+        case 553: goto L553;
+        case 556: goto L556;
+        case 559: goto L559;
+        case 560: goto L560;
+        case 561: goto L561;
+        case 562: goto L562;
+        case 563: goto L563;
+        case 741: goto L741;
+        case 745: goto L745;
+        case 746: goto L746;
+        case 751: goto L751;
+        case 754: goto L754;
+        case 757: goto L757;
+        case 758: goto L758;
+        case 759: goto L759;
+        case 760: goto L760;
+        case 761: goto L761;
+        case 1070: goto L1070;
+        case 1074: goto L1074;
+        case 1075: goto L1075;
+        case 1083: goto L1083;
+        case 1086: goto L1086;
+        case 1090: goto L1090;
+        case 1094: goto L1094;
+        case 1095: goto L1095;
+        case 1096: goto L1096;
+        case 1097: goto L1097;
+        case 1098: goto L1098;
+        case 1626: goto L1626;
+        case 1631: goto L1631;
+        case 1632: goto L1632;
+        case 1639: goto L1639;
+        case 1642: goto L1642;
+        case 1646: goto L1646;
+        case 1649: goto L1649;
+        case 1650: goto L1650;
+        case 1651: goto L1651;
+        case 1652: goto L1652;
+        case 1653: goto L1653;
+        case 1711: goto L1711;
+        case 1715: goto L1715;
+        case 1716: goto L1716;
+        case 1723: goto L1723;
+        case 1726: goto L1726;
+        case 1729: goto L1729;
+        case 1732: goto L1732;
+        case 1735: goto L1735;
+        case 1736: goto L1736;
+        case 1737: goto L1737;
+        case 1738: goto L1738;
+        case 1739: goto L1739;
+        case 1795: goto L1795;
+        case 1799: goto L1799;
+        case 1800: goto L1800;
+        case 1811: goto L1811;
+        case 1814: goto L1814;
+        case 1818: goto L1818;
+        case 1822: goto L1822;
+        case 1826: goto L1826;
+        case 1827: goto L1827;
+        case 1828: goto L1828;
+        case 1829: goto L1829;
+        case 1830: goto L1830;
+        case 3610: goto L3610;
+        case 3615: goto L3615;
+        case 3616: goto L3616;
+        case 3623: goto L3623;
+        case 3626: goto L3626;
+        case 3630: goto L3630;
+        case 3631: goto L3631;
+        case 3632: goto L3632;
+        case 3633: goto L3633;
+        case 3634: goto L3634;
+        case 3938: goto L3938;
+        case 3943: goto L3943;
+        case 3944: goto L3944;
+        case 3950: goto L3950;
+        case 3953: goto L3953;
+        case 3956: goto L3956;
+        case 3957: goto L3957;
+        case 3958: goto L3958;
+        case 3959: goto L3959;
+        case 3960: goto L3960;
+        case 4073: goto L4073;
+        case 4078: goto L4078;
+        case 4079: goto L4079;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 1;
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[0];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L25: /* NAME */
+    f->name = regs[0];
+L26: /* GGET */
+    tp_aot_op(tp, f, code + 26);
+L31: /* STRING */
+    tp_aot_op(tp, f, code + 31);
+L39: /* STRING */
+    tp_aot_op(tp, f, code + 39);
+L42: /* CALLP */
+    return code + 42;
+L43: /* GGET */
+    tp_aot_op(tp, f, code + 43);
+L48: /* UPDATE */
+    tp_aot_op(tp, f, code + 48);
+L49: /* LINE */
+    f->line = code + 49;
+    f->lineno = 2;
+L60: /* GGET */
+    tp_aot_op(tp, f, code + 60);
+L65: /* STRING */
+    tp_aot_op(tp, f, code + 65);
+L73: /* STRING */
+    tp_aot_op(tp, f, code + 73);
+L76: /* CALLP */
+    return code + 76;
+L77: /* GGET */
+    tp_aot_op(tp, f, code + 77);
+L82: /* UPDATE */
+    tp_aot_op(tp, f, code + 82);
+L83: /* LINE */
+    f->line = code + 83;
+    f->lineno = 3;
+L95: /* GGET */
+    tp_aot_op(tp, f, code + 95);
+L100: /* STRING */
+    tp_aot_op(tp, f, code + 100);
+L109: /* NONE */
+    regs[3] = tp_None;
+L110: /* CALLP */
+    return code + 110;
+L111: /* STRING */
+    tp_aot_op(tp, f, code + 111);
+L116: /* GSET */
+    tp_set(tp, f->globals, regs[1], regs[0]);
+L117: /* LINE */
+    f->line = code + 117;
+    f->lineno = 20;
+L126: /* STRING */
+    tp_aot_op(tp, f, code + 126);
+L130: /* STRING */
+    tp_aot_op(tp, f, code + 130);
+L134: /* NUMBER */
+    tp_aot_op(tp, f, code + 134);
+L137: /* STRING */
+    tp_aot_op(tp, f, code + 137);
+L141: /* NUMBER */
+    tp_aot_op(tp, f, code + 141);
+L144: /* DICT */
+    tp_aot_op(tp, f, code + 144);
+L145: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L146: /* LINE */
+    f->line = code + 146;
+    f->lineno = 22;
+L151: /* VAR */
+L154: /* STRING */
+    tp_aot_op(tp, f, code + 154);
+L157: /* LIST */
+    tp_aot_op(tp, f, code + 157);
+L158: /* LIST */
+    tp_aot_op(tp, f, code + 158);
+L159: /* NONE */
+    regs[3] = tp_None;
+L160: /* NONE */
+    regs[4] = tp_None;
+L161: /* DEF */
+    tp_aot_op(tp, f, code + 161);
+L543: /* STRING */
+    tp_aot_op(tp, f, code + 543);
+L547: /* GSET */
+    tp_set(tp, f->globals, regs[1], regs[0]);
+L548: /* LINE */
+    f->line = code + 548;
+    f->lineno = 35;
+L553: /* VAR */
+L556: /* STRING */
+    tp_aot_op(tp, f, code + 556);
+L559: /* LIST */
+    tp_aot_op(tp, f, code + 559);
+L560: /* LIST */
+    tp_aot_op(tp, f, code + 560);
+L561: /* NONE */
+    regs[4] = tp_None;
+L562: /* NONE */
+    regs[5] = tp_None;
+L563: /* DEF */
+    tp_aot_op(tp, f, code + 563);
+L741: /* STRING */
+    tp_aot_op(tp, f, code + 741);
+L745: /* GSET */
+    tp_set(tp, f->globals, regs[2], regs[1]);
+L746: /* LINE */
+    f->line = code + 746;
+    f->lineno = 45;
+L751: /* VAR */
+L754: /* STRING */
+    tp_aot_op(tp, f, code + 754);
+L757: /* LIST */
+    tp_aot_op(tp, f, code + 757);
+L758: /* LIST */
+    tp_aot_op(tp, f, code + 758);
+L759: /* NONE */
+    regs[5] = tp_None;
+L760: /* NONE */
+    regs[6] = tp_None;
+L761: /* DEF */
+    tp_aot_op(tp, f, code + 761);
+L1070: /* STRING */
+    tp_aot_op(tp, f, code + 1070);
+L1074: /* GSET */
+    tp_set(tp, f->globals, regs[3], regs[2]);
+L1075: /* LINE */
+    f->line = code + 1075;
+    f->lineno = 58;
+L1083: /* VAR */
+L1086: /* STRING */
+    tp_aot_op(tp, f, code + 1086);
+L1090: /* STRING */
+    tp_aot_op(tp, f, code + 1090);
+L1094: /* LIST */
+    tp_aot_op(tp, f, code + 1094);
+L1095: /* LIST */
+    tp_aot_op(tp, f, code + 1095);
+L1096: /* NONE */
+    regs[6] = tp_None;
+L1097: /* NONE */
+    regs[7] = tp_None;
+L1098: /* DEF */
+    tp_aot_op(tp, f, code + 1098);
+L1626: /* STRING */
+    tp_aot_op(tp, f, code + 1626);
+L1631: /* GSET */
+    tp_set(tp, f->globals, regs[4], regs[3]);
+L1632: /* LINE */
+    f->line = code + 1632;
+    f->lineno = 90;
+L1639: /* VAR */
+L1642: /* STRING */
+    tp_aot_op(tp, f, code + 1642);
+L1646: /* STRING */
+    tp_aot_op(tp, f, code + 1646);
+L1649: /* LIST */
+    tp_aot_op(tp, f, code + 1649);
+L1650: /* LIST */
+    tp_aot_op(tp, f, code + 1650);
+L1651: /* NONE */
+    regs[7] = tp_None;
+L1652: /* NONE */
+    regs[8] = tp_None;
+L1653: /* DEF */
+    tp_aot_op(tp, f, code + 1653);
+L1711: /* STRING */
+    tp_aot_op(tp, f, code + 1711);
+L1715: /* GSET */
+    tp_set(tp, f->globals, regs[5], regs[4]);
+L1716: /* LINE */
+    f->line = code + 1716;
+    f->lineno = 95;
+L1723: /* VAR */
+L1726: /* STRING */
+    tp_aot_op(tp, f, code + 1726);
+L1729: /* STRING */
+    tp_aot_op(tp, f, code + 1729);
+L1732: /* STRING */
+    tp_aot_op(tp, f, code + 1732);
+L1735: /* LIST */
+    tp_aot_op(tp, f, code + 1735);
+L1736: /* LIST */
+    tp_aot_op(tp, f, code + 1736);
+L1737: /* NONE */
+    regs[8] = tp_None;
+L1738: /* NONE */
+    regs[9] = tp_None;
+L1739: /* DEF */
+    tp_aot_op(tp, f, code + 1739);
+L1795: /* STRING */
+    tp_aot_op(tp, f, code + 1795);
+L1799: /* GSET */
+    tp_set(tp, f->globals, regs[6], regs[5]);
+L1800: /* LINE */
+    f->line = code + 1800;
+    f->lineno = 99;
+L1811: /* VAR */
+L1814: /* STRING */
+    tp_aot_op(tp, f, code + 1814);
+L1818: /* STRING */
+    tp_aot_op(tp, f, code + 1818);
+L1822: /* STRING */
+    tp_aot_op(tp, f, code + 1822);
+L1826: /* LIST */
+    tp_aot_op(tp, f, code + 1826);
+L1827: /* LIST */
+    tp_aot_op(tp, f, code + 1827);
+L1828: /* NONE */
+    regs[9] = tp_None;
+L1829: /* NONE */
+    regs[10] = tp_None;
+L1830: /* DEF */
+    tp_aot_op(tp, f, code + 1830);
+L3610: /* STRING */
+    tp_aot_op(tp, f, code + 3610);
+L3615: /* GSET */
+    tp_set(tp, f->globals, regs[7], regs[6]);
+L3616: /* LINE */
+    f->line = code + 3616;
+    f->lineno = 219;
+L3623: /* VAR */
+L3626: /* STRING */
+    tp_aot_op(tp, f, code + 3626);
+L3630: /* LIST */
+    tp_aot_op(tp, f, code + 3630);
+L3631: /* LIST */
+    tp_aot_op(tp, f, code + 3631);
+L3632: /* NONE */
+    regs[10] = tp_None;
+L3633: /* NONE */
+    regs[11] = tp_None;
+L3634: /* DEF */
+    tp_aot_op(tp, f, code + 3634);
+L3938: /* STRING */
+    tp_aot_op(tp, f, code + 3938);
+L3943: /* GSET */
+    tp_set(tp, f->globals, regs[8], regs[7]);
+L3944: /* LINE */
+    f->line = code + 3944;
+    f->lineno = 237;
+L3950: /* VAR */
+L3953: /* STRING */
+    tp_aot_op(tp, f, code + 3953);
+L3956: /* LIST */
+    tp_aot_op(tp, f, code + 3956);
+L3957: /* LIST */
+    tp_aot_op(tp, f, code + 3957);
+L3958: /* NONE */
+    regs[11] = tp_None;
+L3959: /* NONE */
+    regs[12] = tp_None;
+L3960: /* DEF */
+    tp_aot_op(tp, f, code + 3960);
+L4073: /* STRING */
+    tp_aot_op(tp, f, code + 4073);
+L4078: /* GSET */
+    tp_set(tp, f->globals, regs[9], regs[8]);
+L4079: /* EOF */
+    return code + 4079;
+}
+
+static tpd_code * _tp_tinypy_compiler_regalloc_162(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 34: goto L34;
+        case 37: goto L37;
+        case 38: goto L38;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 59: goto L59;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 72: goto L72;
+        case 77: goto L77;
+        case 79: goto L79;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 96: goto L96;
+        case 100: goto L100;
+        case 104: goto L104;
+        case 108: goto L108;
+        case 112: goto L112;
+        case 116: goto L116;
+        case 117: goto L117;
+        case 118: goto L118;
+        case 119: goto L119;
+        case 120: goto L120;
+        case 130: goto L130;
+        case 133: goto L133;
+        case 134: goto L134;
+        case 137: goto L137;
+        case 138: goto L138;
+        case 139: goto L139;
+        case 140: goto L140;
+        case 143: goto L143;
+        case 144: goto L144;
+        case 145: goto L145;
+        case 152: goto L152;
+        case 155: goto L155;
+        case 158: goto L158;
+        case 159: goto L159;
+        case 160: goto L160;
+        case 185: goto L185;
+        case 190: goto L190;
+        case 194: goto L194;
+        case 196: goto L196;
+        case 197: goto L197;
+        case 198: goto L198;
+        case 199: goto L199;
+        case 203: goto L203;
+        case 207: goto L207;
+        case 211: goto L211;
+        case 215: goto L215;
+        case 218: goto L218;
+        case 222: goto L222;
+        case 223: goto L223;
+        case 224: goto L224;
+        case 225: goto L225;
+        case 226: goto L226;
+        case 229: goto L229;
+        case 232: goto L232;
+        case 235: goto L235;
+        case 236: goto L236;
+        case 237: goto L237;
+        case 257: goto L257;
+        case 262: goto L262;
+        case 266: goto L266;
+        case 268: goto L268;
+        case 269: goto L269;
+        case 270: goto L270;
+        case 271: goto L271;
+        case 274: goto L274;
+        case 277: goto L277;
+        case 281: goto L281;
+        case 285: goto L285;
+        case 286: goto L286;
+        case 287: goto L287;
+        case 288: goto L288;
+        case 289: goto L289;
+        case 292: goto L292;
+        case 295: goto L295;
+        case 296: goto L296;
+        case 297: goto L297;
+        case 322: goto L322;
+        case 327: goto L327;
+        case 331: goto L331;
+        case 333: goto L333;
+        case 334: goto L334;
+        case 335: goto L335;
+        case 336: goto L336;
+        case 339: goto L339;
+        case 342: goto L342;
+        case 346: goto L346;
+        case 350: goto L350;
+        case 353: goto L353;
+        case 357: goto L357;
+        case 361: goto L361;
+        case 364: goto L364;
+        case 365: goto L365;
+        case 366: goto L366;
+        case 367: goto L367;
+        case 368: goto L368;
+        case 371: goto L371;
+        case 372: goto L372;
+        case 373: goto L373;
+        case 378: goto L378;
+        case 379: goto L379;
+        case 380: goto L380;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 22;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 24;
+L34: /* NUMBER */
+    tp_aot_op(tp, f, code + 34);
+L37: /* GET */
+    regs[1] = tp_get(tp, regs[0], regs[2]);
+    tp_grey(tp, regs[1]);
+L38: /* STRING */
+    tp_aot_op(tp, f, code + 38);
+L41: /* EQ */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[1].nint == regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 41);
+    }
+L42: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L44;
+    }
+L43: /* JUMP */
+    goto L49;
+L44: /* NUMBER */
+    tp_aot_op(tp, f, code + 44);
+L47: /* LIST */
+    tp_aot_op(tp, f, code + 47);
+L48: /* RETURN */
+    return code + 48;
+L49: /* LINE */
+    f->line = code + 49;
+    f->lineno = 25;
+L59: /* NUMBER */
+    tp_aot_op(tp, f, code + 59);
+L62: /* GET */
+    regs[1] = tp_get(tp, regs[0], regs[2]);
+    tp_grey(tp, regs[1]);
+L63: /* STRING */
+    tp_aot_op(tp, f, code + 63);
+L67: /* NE */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[1].nint != regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 67);
+    }
+L68: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L70;
+    }
+L69: /* JUMP */
+    goto L72;
+L70: /* LIST */
+    tp_aot_op(tp, f, code + 70);
+L71: /* RETURN */
+    return code + 71;
+L72: /* LINE */
+    f->line = code + 72;
+    f->lineno = 26;
+L77: /* VAR */
+L79: /* NUMBER */
+    tp_aot_op(tp, f, code + 79);
+L82: /* GET */
+    regs[1] = tp_get(tp, regs[0], regs[3]);
+    tp_grey(tp, regs[1]);
+L83: /* LINE */
+    f->line = code + 83;
+    f->lineno = 27;
+L96: /* GGET */
+    tp_aot_op(tp, f, code + 96);
+L100: /* GGET */
+    tp_aot_op(tp, f, code + 100);
+L104: /* GGET */
+    tp_aot_op(tp, f, code + 104);
+L108: /* GGET */
+    tp_aot_op(tp, f, code + 108);
+L112: /* GGET */
+    tp_aot_op(tp, f, code + 112);
+L116: /* LIST */
+    tp_aot_op(tp, f, code + 116);
+L117: /* IN */
+    regs[2] = tp_has(tp, regs[3], regs[1]);
+L118: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L120;
+    }
+L119: /* JUMP */
+    goto L160;
+L120: /* LINE */
+    f->line = code + 120;
+    f->lineno = 28;
+L130: /* NUMBER */
+    tp_aot_op(tp, f, code + 130);
+L133: /* GET */
+    regs[2] = tp_get(tp, regs[0], regs[3]);
+    tp_grey(tp, regs[2]);
+L134: /* NUMBER */
+    tp_aot_op(tp, f, code + 134);
+L137: /* EQ */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint == regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 137);
+    }
+L138: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L140;
+    }
+L139: /* JUMP */
+    goto L145;
+L140: /* NUMBER */
+    tp_aot_op(tp, f, code + 140);
+L143: /* LIST */
+    tp_aot_op(tp, f, code + 143);
+L144: /* RETURN */
+    return code + 144;
+L145: /* LINE */
+    f->line = code + 145;
+    f->lineno = 29;
+L152: /* NUMBER */
+    tp_aot_op(tp, f, code + 152);
+L155: /* NUMBER */
+    tp_aot_op(tp, f, code + 155);
+L158: /* LIST */
+    tp_aot_op(tp, f, code + 158);
+L159: /* RETURN */
+    return code + 159;
+L160: /* LINE */
+    f->line = code + 160;
+    f->lineno = 30;
+L185: /* GGET */
+    tp_aot_op(tp, f, code + 185);
+L190: /* STRING */
+    tp_aot_op(tp, f, code + 190);
+L194: /* MGET */
+    tp_aot_op(tp, f, code + 194);
+L196: /* IN */
+    regs[2] = tp_has(tp, regs[3], regs[1]);
+L197: /* IFN */
+    if (!(TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2]))) {
+        goto L199;
+    }
+L198: /* JUMP */
+    goto L224;
+L199: /* GGET */
+    tp_aot_op(tp, f, code + 199);
+L203: /* GGET */
+    tp_aot_op(tp, f, code + 203);
+L207: /* GGET */
+    tp_aot_op(tp, f, code + 207);
+L211: /* GGET */
+    tp_aot_op(tp, f, code + 211);
+L215: /* GGET */
+    tp_aot_op(tp, f, code + 215);
+L218: /* GGET */
+    tp_aot_op(tp, f, code + 218);
+L222: /* LIST */
+    tp_aot_op(tp, f, code + 222);
+L223: /* IN */
+    regs[2] = tp_has(tp, regs[3], regs[1]);
+L224: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L226;
+    }
+L225: /* JUMP */
+    goto L237;
+L226: /* NUMBER */
+    tp_aot_op(tp, f, code + 226);
+L229: /* NUMBER */
+    tp_aot_op(tp, f, code + 229);
+L232: /* NUMBER */
+    tp_aot_op(tp, f, code + 232);
+L235: /* LIST */
+    tp_aot_op(tp, f, code + 235);
+L236: /* RETURN */
+    return code + 236;
+L237: /* LINE */
+    f->line = code + 237;
+    f->lineno = 31;
+L257: /* GGET */
+    tp_aot_op(tp, f, code + 257);
+L262: /* STRING */
+    tp_aot_op(tp, f, code + 262);
+L266: /* MGET */
+    tp_aot_op(tp, f, code + 266);
+L268: /* IN */
+    regs[2] = tp_has(tp, regs[3], regs[1]);
+L269: /* IFN */
+    if (!(TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2]))) {
+        goto L271;
+    }
+L270: /* JUMP */
+    goto L287;
+L271: /* GGET */
+    tp_aot_op(tp, f, code + 271);
+L274: /* GGET */
+    tp_aot_op(tp, f, code + 274);
+L277: /* GGET */
+    tp_aot_op(tp, f, code + 277);
+L281: /* GGET */
+    tp_aot_op(tp, f, code + 281);
+L285: /* LIST */
+    tp_aot_op(tp, f, code + 285);
+L286: /* IN */
+    regs[2] = tp_has(tp, regs[3], regs[1]);
+L287: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L289;
+    }
+L288: /* JUMP */
+    goto L297;
+L289: /* NUMBER */
+    tp_aot_op(tp, f, code + 289);
+L292: /* NUMBER */
+    tp_aot_op(tp, f, code + 292);
+L295: /* LIST */
+    tp_aot_op(tp, f, code + 295);
+L296: /* RETURN */
+    return code + 296;
+L297: /* LINE */
+    f->line = code + 297;
+    f->lineno = 32;
+L322: /* GGET */
+    tp_aot_op(tp, f, code + 322);
+L327: /* STRING */
+    tp_aot_op(tp, f, code + 327);
+L331: /* MGET */
+    tp_aot_op(tp, f, code + 331);
+L333: /* IN */
+    regs[2] = tp_has(tp, regs[3], regs[1]);
+L334: /* IFN */
+    if (!(TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2]))) {
+        goto L336;
+    }
+L335: /* JUMP */
+    goto L366;
+L336: /* GGET */
+    tp_aot_op(tp, f, code + 336);
+L339: /* GGET */
+    tp_aot_op(tp, f, code + 339);
+L342: /* GGET */
+    tp_aot_op(tp, f, code + 342);
+L346: /* GGET */
+    tp_aot_op(tp, f, code + 346);
+L350: /* GGET */
+    tp_aot_op(tp, f, code + 350);
+L353: /* GGET */
+    tp_aot_op(tp, f, code + 353);
+L357: /* GGET */
+    tp_aot_op(tp, f, code + 357);
+L361: /* GGET */
+    tp_aot_op(tp, f, code + 361);
+L364: /* LIST */
+    tp_aot_op(tp, f, code + 364);
+L365: /* IN */
+    regs[2] = tp_has(tp, regs[3], regs[1]);
+L366: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L368;
+    }
+L367: /* JUMP */
+    goto L373;
+L368: /* NUMBER */
+    tp_aot_op(tp, f, code + 368);
+L371: /* LIST */
+    tp_aot_op(tp, f, code + 371);
+L372: /* RETURN */
+    return code + 372;
+L373: /* LINE */
+    f->line = code + 373;
+    f->lineno = 33;
+L378: /* LIST */
+    tp_aot_op(tp, f, code + 378);
+L379: /* RETURN */
+    return code + 379;
+L380: /* EOF */
+    return code + 380;
+}
+
+static tpd_code * _tp_tinypy_compiler_regalloc_564(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 32: goto L32;
+        case 34: goto L34;
+        case 39: goto L39;
+        case 43: goto L43;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 56: goto L56;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 64: goto L64;
+        case 65: goto L65;
+        case 66: goto L66;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 79: goto L79;
+        case 82: goto L82;
+        case 83: goto L83;
+        case 86: goto L86;
+        case 87: goto L87;
+        case 90: goto L90;
+        case 91: goto L91;
+        case 94: goto L94;
+        case 95: goto L95;
+        case 97: goto L97;
+        case 98: goto L98;
+        case 100: goto L100;
+        case 101: goto L101;
+        case 103: goto L103;
+        case 104: goto L104;
+        case 106: goto L106;
+        case 107: goto L107;
+        case 118: goto L118;
+        case 121: goto L121;
+        case 122: goto L122;
+        case 123: goto L123;
+        case 124: goto L124;
+        case 125: goto L125;
+        case 128: goto L128;
+        case 129: goto L129;
+        case 130: goto L130;
+        case 131: goto L131;
+        case 140: goto L140;
+        case 144: goto L144;
+        case 145: goto L145;
+        case 146: goto L146;
+        case 147: goto L147;
+        case 148: goto L148;
+        case 149: goto L149;
+        case 150: goto L150;
+        case 151: goto L151;
+        case 160: goto L160;
+        case 164: goto L164;
+        case 165: goto L165;
+        case 166: goto L166;
+        case 167: goto L167;
+        case 168: goto L168;
+        case 169: goto L169;
+        case 170: goto L170;
+        case 175: goto L175;
+        case 176: goto L176;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 35;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 37;
+L32: /* VAR */
+L34: /* GGET */
+    tp_aot_op(tp, f, code + 34);
+L39: /* STRING */
+    tp_aot_op(tp, f, code + 39);
+L43: /* METHOD */
+    tp_aot_op(tp, f, code + 43);
+L45: /* MOVE */
+    regs[6] = regs[0];
+L46: /* CALLM */
+    return code + 46;
+L47: /* LINE */
+    f->line = code + 47;
+    f->lineno = 38;
+L56: /* NUMBER */
+    tp_aot_op(tp, f, code + 56);
+L59: /* GET */
+    regs[7] = tp_get(tp, regs[0], regs[4]);
+    tp_grey(tp, regs[7]);
+L60: /* STRING */
+    tp_aot_op(tp, f, code + 60);
+L64: /* NE */
+    if (TP_BOTH(regs[7], regs[4], TP_NUMBER_INT)) {
+        regs[7] = tp_bool(regs[7].nint != regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 64);
+    }
+L65: /* IF */
+    if (TP_IS_INT(regs[7]) ? regs[7].nint != 0 : tp_true(tp, regs[7])) {
+        goto L67;
+    }
+L66: /* JUMP */
+    goto L68;
+L67: /* RETURN */
+    return code + 67;
+L68: /* LINE */
+    f->line = code + 68;
+    f->lineno = 39;
+L79: /* NUMBER */
+    tp_aot_op(tp, f, code + 79);
+L82: /* GET */
+    regs[7] = tp_get(tp, regs[0], regs[5]);
+    tp_grey(tp, regs[7]);
+L83: /* NUMBER */
+    tp_aot_op(tp, f, code + 83);
+L86: /* GET */
+    regs[4] = tp_get(tp, regs[0], regs[6]);
+    tp_grey(tp, regs[4]);
+L87: /* NUMBER */
+    tp_aot_op(tp, f, code + 87);
+L90: /* GET */
+    regs[5] = tp_get(tp, regs[0], regs[2]);
+    tp_grey(tp, regs[5]);
+L91: /* NUMBER */
+    tp_aot_op(tp, f, code + 91);
+L94: /* GET */
+    regs[6] = tp_get(tp, regs[0], regs[3]);
+    tp_grey(tp, regs[6]);
+L95: /* VAR */
+L97: /* MOVE */
+    regs[2] = regs[7];
+L98: /* VAR */
+L100: /* MOVE */
+    regs[7] = regs[4];
+L101: /* VAR */
+L103: /* MOVE */
+    regs[4] = regs[5];
+L104: /* VAR */
+L106: /* MOVE */
+    regs[5] = regs[6];
+L107: /* LINE */
+    f->line = code + 107;
+    f->lineno = 40;
+L118: /* GGET */
+    tp_aot_op(tp, f, code + 118);
+L121: /* EQ */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[2].nint == regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 121);
+    }
+L122: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L124;
+    }
+L123: /* JUMP */
+    goto L131;
+L124: /* MOVE */
+    regs[3] = regs[7];
+L125: /* NUMBER */
+    tp_aot_op(tp, f, code + 125);
+L128: /* ADD */
+    if (TP_BOTH(regs[4], regs[0], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[4].nint + regs[0].nint);
+    } else {
+        tp_aot_op(tp, f, code + 128);
+    }
+L129: /* LIST */
+    tp_aot_op(tp, f, code + 129);
+L130: /* RETURN */
+    return code + 130;
+L131: /* LINE */
+    f->line = code + 131;
+    f->lineno = 41;
+L140: /* GGET */
+    tp_aot_op(tp, f, code + 140);
+L144: /* EQ */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[2].nint == regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 144);
+    }
+L145: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L147;
+    }
+L146: /* JUMP */
+    goto L151;
+L147: /* MOVE */
+    regs[3] = regs[7];
+L148: /* MOVE */
+    regs[4] = regs[5];
+L149: /* LIST */
+    tp_aot_op(tp, f, code + 149);
+L150: /* RETURN */
+    return code + 150;
+L151: /* LINE */
+    f->line = code + 151;
+    f->lineno = 42;
+L160: /* GGET */
+    tp_aot_op(tp, f, code + 160);
+L164: /* EQ */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[2].nint == regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 164);
+    }
+L165: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L167;
+    }
+L166: /* JUMP */
+    goto L170;
+L167: /* MOVE */
+    regs[3] = regs[7];
+L168: /* LIST */
+    tp_aot_op(tp, f, code + 168);
+L169: /* RETURN */
+    return code + 169;
+L170: /* LINE */
+    f->line = code + 170;
+    f->lineno = 43;
+L175: /* RETURN */
+    return code + 175;
+L176: /* EOF */
+    return code + 176;
+}
+
+static tpd_code * _tp_tinypy_compiler_regalloc_762(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 36: goto L36;
+        case 39: goto L39;
+        case 40: goto L40;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 55: goto L55;
+        case 56: goto L56;
+        case 66: goto L66;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 78: goto L78;
+        case 79: goto L79;
+        case 90: goto L90;
+        case 93: goto L93;
+        case 94: goto L94;
+        case 97: goto L97;
+        case 98: goto L98;
+        case 101: goto L101;
+        case 102: goto L102;
+        case 105: goto L105;
+        case 106: goto L106;
+        case 108: goto L108;
+        case 109: goto L109;
+        case 111: goto L111;
+        case 112: goto L112;
+        case 114: goto L114;
+        case 115: goto L115;
+        case 117: goto L117;
+        case 118: goto L118;
+        case 122: goto L122;
+        case 124: goto L124;
+        case 125: goto L125;
+        case 145: goto L145;
+        case 149: goto L149;
+        case 153: goto L153;
+        case 157: goto L157;
+        case 161: goto L161;
+        case 165: goto L165;
+        case 166: goto L166;
+        case 167: goto L167;
+        case 168: goto L168;
+        case 169: goto L169;
+        case 172: goto L172;
+        case 173: goto L173;
+        case 174: goto L174;
+        case 175: goto L175;
+        case 179: goto L179;
+        case 181: goto L181;
+        case 182: goto L182;
+        case 183: goto L183;
+        case 184: goto L184;
+        case 185: goto L185;
+        case 195: goto L195;
+        case 199: goto L199;
+        case 200: goto L200;
+        case 201: goto L201;
+        case 202: goto L202;
+        case 206: goto L206;
+        case 208: goto L208;
+        case 209: goto L209;
+        case 212: goto L212;
+        case 213: goto L213;
+        case 214: goto L214;
+        case 224: goto L224;
+        case 228: goto L228;
+        case 229: goto L229;
+        case 230: goto L230;
+        case 231: goto L231;
+        case 235: goto L235;
+        case 237: goto L237;
+        case 238: goto L238;
+        case 241: goto L241;
+        case 242: goto L242;
+        case 243: goto L243;
+        case 253: goto L253;
+        case 256: goto L256;
+        case 257: goto L257;
+        case 258: goto L258;
+        case 259: goto L259;
+        case 263: goto L263;
+        case 265: goto L265;
+        case 266: goto L266;
+        case 269: goto L269;
+        case 270: goto L270;
+        case 271: goto L271;
+        case 282: goto L282;
+        case 286: goto L286;
+        case 287: goto L287;
+        case 288: goto L288;
+        case 289: goto L289;
+        case 293: goto L293;
+        case 295: goto L295;
+        case 296: goto L296;
+        case 299: goto L299;
+        case 300: goto L300;
+        case 301: goto L301;
+        case 306: goto L306;
+        case 307: goto L307;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 45;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 47;
+L36: /* NUMBER */
+    tp_aot_op(tp, f, code + 36);
+L39: /* GET */
+    regs[1] = tp_get(tp, regs[0], regs[2]);
+    tp_grey(tp, regs[1]);
+L40: /* STRING */
+    tp_aot_op(tp, f, code + 40);
+L43: /* EQ */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[1].nint == regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 43);
+    }
+L44: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L46;
+    }
+L45: /* JUMP */
+    goto L56;
+L46: /* NUMBER */
+    tp_aot_op(tp, f, code + 46);
+L49: /* GET */
+    regs[4] = tp_get(tp, regs[0], regs[3]);
+    tp_grey(tp, regs[4]);
+L50: /* NUMBER */
+    tp_aot_op(tp, f, code + 50);
+L53: /* LIST */
+    tp_aot_op(tp, f, code + 53);
+L54: /* LIST */
+    tp_aot_op(tp, f, code + 54);
+L55: /* RETURN */
+    return code + 55;
+L56: /* LINE */
+    f->line = code + 56;
+    f->lineno = 48;
+L66: /* NUMBER */
+    tp_aot_op(tp, f, code + 66);
+L69: /* GET */
+    regs[1] = tp_get(tp, regs[0], regs[2]);
+    tp_grey(tp, regs[1]);
+L70: /* STRING */
+    tp_aot_op(tp, f, code + 70);
+L74: /* NE */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[1].nint != regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 74);
+    }
+L75: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L77;
+    }
+L76: /* JUMP */
+    goto L79;
+L77: /* LIST */
+    tp_aot_op(tp, f, code + 77);
+L78: /* RETURN */
+    return code + 78;
+L79: /* LINE */
+    f->line = code + 79;
+    f->lineno = 49;
+L90: /* NUMBER */
+    tp_aot_op(tp, f, code + 90);
+L93: /* GET */
+    regs[1] = tp_get(tp, regs[0], regs[4]);
+    tp_grey(tp, regs[1]);
+L94: /* NUMBER */
+    tp_aot_op(tp, f, code + 94);
+L97: /* GET */
+    regs[2] = tp_get(tp, regs[0], regs[5]);
+    tp_grey(tp, regs[2]);
+L98: /* NUMBER */
+    tp_aot_op(tp, f, code + 98);
+L101: /* GET */
+    regs[4] = tp_get(tp, regs[0], regs[3]);
+    tp_grey(tp, regs[4]);
+L102: /* NUMBER */
+    tp_aot_op(tp, f, code + 102);
+L105: /* GET */
+    regs[5] = tp_get(tp, regs[0], regs[6]);
+    tp_grey(tp, regs[5]);
+L106: /* VAR */
+L108: /* MOVE */
+    regs[3] = regs[1];
+L109: /* VAR */
+L111: /* MOVE */
+    regs[1] = regs[2];
+L112: /* VAR */
+L114: /* MOVE */
+    regs[2] = regs[4];
+L115: /* VAR */
+L117: /* MOVE */
+    regs[4] = regs[5];
+L118: /* LINE */
+    f->line = code + 118;
+    f->lineno = 50;
+L122: /* VAR */
+L124: /* LIST */
+    tp_aot_op(tp, f, code + 124);
+L125: /* LINE */
+    f->line = code + 125;
+    f->lineno = 51;
+L145: /* GGET */
+    tp_aot_op(tp, f, code + 145);
+L149: /* GGET */
+    tp_aot_op(tp, f, code + 149);
+L153: /* GGET */
+    tp_aot_op(tp, f, code + 153);
+L157: /* GGET */
+    tp_aot_op(tp, f, code + 157);
+L161: /* GGET */
+    tp_aot_op(tp, f, code + 161);
+L165: /* LIST */
+    tp_aot_op(tp, f, code + 165);
+L166: /* IN */
+    regs[6] = tp_has(tp, regs[6], regs[3]);
+L167: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L169;
+    }
+L168: /* JUMP */
+    goto L173;
+L169: /* NUMBER */
+    tp_aot_op(tp, f, code + 169);
+L172: /* GT */
+    if (TP_BOTH(regs[4], regs[6], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[4].nint > regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 172);
+    }
+L173: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L175;
+    }
+L174: /* JUMP */
+    goto L185;
+L175: /* STRING */
+    tp_aot_op(tp, f, code + 175);
+L179: /* METHOD */
+    tp_aot_op(tp, f, code + 179);
+L181: /* MOVE */
+    regs[9] = regs[2];
+L182: /* MOVE */
+    regs[10] = regs[4];
+L183: /* LIST */
+    tp_aot_op(tp, f, code + 183);
+L184: /* CALLM */
+    return code + 184;
+L185: /* LINE */
+    f->line = code + 185;
+    f->lineno = 52;
+L195: /* GGET */
+    tp_aot_op(tp, f, code + 195);
+L199: /* EQ */
+    if (TP_BOTH(regs[3], regs[6], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[3].nint == regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 199);
+    }
+L200: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L202;
+    }
+L201: /* JUMP */
+    goto L214;
+L202: /* STRING */
+    tp_aot_op(tp, f, code + 202);
+L206: /* METHOD */
+    tp_aot_op(tp, f, code + 206);
+L208: /* MOVE */
+    regs[9] = regs[1];
+L209: /* NUMBER */
+    tp_aot_op(tp, f, code + 209);
+L212: /* LIST */
+    tp_aot_op(tp, f, code + 212);
+L213: /* CALLM */
+    return code + 213;
+L214: /* LINE */
+    f->line = code + 214;
+    f->lineno = 53;
+L224: /* GGET */
+    tp_aot_op(tp, f, code + 224);
+L228: /* EQ */
+    if (TP_BOTH(regs[3], regs[6], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[3].nint == regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 228);
+    }
+L229: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L231;
+    }
+L230: /* JUMP */
+    goto L243;
+L231: /* STRING */
+    tp_aot_op(tp, f, code + 231);
+L235: /* METHOD */
+    tp_aot_op(tp, f, code + 235);
+L237: /* MOVE */
+    regs[9] = regs[4];
+L238: /* NUMBER */
+    tp_aot_op(tp, f, code + 238);
+L241: /* LIST */
+    tp_aot_op(tp, f, code + 241);
+L242: /* CALLM */
+    return code + 242;
+L243: /* LINE */
+    f->line = code + 243;
+    f->lineno = 54;
+L253: /* GGET */
+    tp_aot_op(tp, f, code + 253);
+L256: /* EQ */
+    if (TP_BOTH(regs[3], regs[6], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[3].nint == regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 256);
+    }
+L257: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L259;
+    }
+L258: /* JUMP */
+    goto L271;
+L259: /* STRING */
+    tp_aot_op(tp, f, code + 259);
+L263: /* METHOD */
+    tp_aot_op(tp, f, code + 263);
+L265: /* MOVE */
+    regs[9] = regs[2];
+L266: /* NUMBER */
+    tp_aot_op(tp, f, code + 266);
+L269: /* LIST */
+    tp_aot_op(tp, f, code + 269);
+L270: /* CALLM */
+    return code + 270;
+L271: /* LINE */
+    f->line = code + 271;
+    f->lineno = 55;
+L282: /* GGET */
+    tp_aot_op(tp, f, code + 282);
+L286: /* EQ */
+    if (TP_BOTH(regs[3], regs[6], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[3].nint == regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 286);
+    }
+L287: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L289;
+    }
+L288: /* JUMP */
+    goto L301;
+L289: /* STRING */
+    tp_aot_op(tp, f, code + 289);
+L293: /* METHOD */
+    tp_aot_op(tp, f, code + 293);
+L295: /* MOVE */
+    regs[9] = regs[1];
+L296: /* NUMBER */
+    tp_aot_op(tp, f, code + 296);
+L299: /* LIST */
+    tp_aot_op(tp, f, code + 299);
+L300: /* CALLM */
+    return code + 300;
+L301: /* LINE */
+    f->line = code + 301;
+    f->lineno = 56;
+L306: /* RETURN */
+    return code + 306;
+L307: /* EOF */
+    return code + 307;
+}
+
+static tpd_code * _tp_tinypy_compiler_regalloc_1099(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 10: goto L10;
+        case 13: goto L13;
+        case 16: goto L16;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 31: goto L31;
+        case 32: goto L32;
+        case 38: goto L38;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 50: goto L50;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 55: goto L55;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 67: goto L67;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 78: goto L78;
+        case 89: goto L89;
+        case 93: goto L93;
+        case 95: goto L95;
+        case 98: goto L98;
+        case 99: goto L99;
+        case 100: goto L100;
+        case 101: goto L101;
+        case 102: goto L102;
+        case 111: goto L111;
+        case 112: goto L112;
+        case 113: goto L113;
+        case 116: goto L116;
+        case 117: goto L117;
+        case 121: goto L121;
+        case 122: goto L122;
+        case 128: goto L128;
+        case 131: goto L131;
+        case 132: goto L132;
+        case 133: goto L133;
+        case 134: goto L134;
+        case 142: goto L142;
+        case 146: goto L146;
+        case 148: goto L148;
+        case 149: goto L149;
+        case 150: goto L150;
+        case 158: goto L158;
+        case 162: goto L162;
+        case 164: goto L164;
+        case 165: goto L165;
+        case 166: goto L166;
+        case 167: goto L167;
+        case 173: goto L173;
+        case 176: goto L176;
+        case 179: goto L179;
+        case 185: goto L185;
+        case 186: goto L186;
+        case 187: goto L187;
+        case 194: goto L194;
+        case 197: goto L197;
+        case 198: goto L198;
+        case 211: goto L211;
+        case 215: goto L215;
+        case 218: goto L218;
+        case 219: goto L219;
+        case 220: goto L220;
+        case 223: goto L223;
+        case 224: goto L224;
+        case 227: goto L227;
+        case 230: goto L230;
+        case 231: goto L231;
+        case 232: goto L232;
+        case 233: goto L233;
+        case 235: goto L235;
+        case 236: goto L236;
+        case 245: goto L245;
+        case 247: goto L247;
+        case 248: goto L248;
+        case 249: goto L249;
+        case 268: goto L268;
+        case 273: goto L273;
+        case 278: goto L278;
+        case 280: goto L280;
+        case 281: goto L281;
+        case 282: goto L282;
+        case 283: goto L283;
+        case 284: goto L284;
+        case 285: goto L285;
+        case 288: goto L288;
+        case 289: goto L289;
+        case 290: goto L290;
+        case 292: goto L292;
+        case 293: goto L293;
+        case 303: goto L303;
+        case 306: goto L306;
+        case 307: goto L307;
+        case 308: goto L308;
+        case 309: goto L309;
+        case 310: goto L310;
+        case 311: goto L311;
+        case 323: goto L323;
+        case 327: goto L327;
+        case 329: goto L329;
+        case 330: goto L330;
+        case 331: goto L331;
+        case 332: goto L332;
+        case 340: goto L340;
+        case 341: goto L341;
+        case 351: goto L351;
+        case 353: goto L353;
+        case 358: goto L358;
+        case 362: goto L362;
+        case 364: goto L364;
+        case 365: goto L365;
+        case 366: goto L366;
+        case 373: goto L373;
+        case 375: goto L375;
+        case 376: goto L376;
+        case 377: goto L377;
+        case 385: goto L385;
+        case 388: goto L388;
+        case 389: goto L389;
+        case 390: goto L390;
+        case 392: goto L392;
+        case 393: goto L393;
+        case 402: goto L402;
+        case 403: goto L403;
+        case 404: goto L404;
+        case 405: goto L405;
+        case 415: goto L415;
+        case 418: goto L418;
+        case 419: goto L419;
+        case 420: goto L420;
+        case 431: goto L431;
+        case 436: goto L436;
+        case 440: goto L440;
+        case 442: goto L442;
+        case 443: goto L443;
+        case 444: goto L444;
+        case 447: goto L447;
+        case 448: goto L448;
+        case 449: goto L449;
+        case 450: goto L450;
+        case 459: goto L459;
+        case 462: goto L462;
+        case 463: goto L463;
+        case 464: goto L464;
+        case 476: goto L476;
+        case 479: goto L479;
+        case 480: goto L480;
+        case 481: goto L481;
+        case 484: goto L484;
+        case 485: goto L485;
+        case 486: goto L486;
+        case 487: goto L487;
+        case 488: goto L488;
+        case 489: goto L489;
+        case 499: goto L499;
+        case 500: goto L500;
+        case 509: goto L509;
+        case 512: goto L512;
+        case 513: goto L513;
+        case 522: goto L522;
+        case 523: goto L523;
+        case 524: goto L524;
+        case 525: goto L525;
+        case 526: goto L526;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 58;
+L10: /* VAR */
+L13: /* VAR */
+L16: /* STRING */
+    tp_aot_op(tp, f, code + 16);
+L25: /* FILE */
+    f->fname = regs[2];
+L26: /* STRING */
+    tp_aot_op(tp, f, code + 26);
+L31: /* NAME */
+    f->name = regs[2];
+L32: /* LINE */
+    f->line = code + 32;
+    f->lineno = 61;
+L38: /* VAR */
+L42: /* LIST */
+    tp_aot_op(tp, f, code + 42);
+L43: /* MOVE */
+    regs[2] = regs[3];
+L44: /* LINE */
+    f->line = code + 44;
+    f->lineno = 62;
+L50: /* NUMBER */
+    tp_aot_op(tp, f, code + 50);
+L53: /* ITER */
+    if (tp_iter_next(tp, &regs[3], regs[0], &regs[4])) {
+        goto L55;
+    }
+L54: /* JUMP */
+    goto L102;
+L55: /* VAR */
+L57: /* MOVE */
+    regs[5] = regs[3];
+L58: /* LINE */
+    f->line = code + 58;
+    f->lineno = 63;
+L67: /* NUMBER */
+    tp_aot_op(tp, f, code + 67);
+L70: /* GET */
+    regs[3] = tp_get(tp, regs[5], regs[6]);
+    tp_grey(tp, regs[3]);
+L71: /* STRING */
+    tp_aot_op(tp, f, code + 71);
+L75: /* EQ */
+    if (TP_BOTH(regs[3], regs[6], TP_NUMBER_INT)) {
+        regs[3] = tp_bool(regs[3].nint == regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 75);
+    }
+L76: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L78;
+    }
+L77: /* JUMP */
+    tp_aot_safepoint(tp, 24);
+    goto L53;
+L78: /* LINE */
+    f->line = code + 78;
+    f->lineno = 64;
+L89: /* STRING */
+    tp_aot_op(tp, f, code + 89);
+L93: /* METHOD */
+    tp_aot_op(tp, f, code + 93);
+L95: /* NUMBER */
+    tp_aot_op(tp, f, code + 95);
+L98: /* GET */
+    regs[9] = tp_get(tp, regs[5], regs[10]);
+    tp_grey(tp, regs[9]);
+L99: /* GET */
+    regs[8] = tp_get(tp, regs[1], regs[9]);
+    tp_grey(tp, regs[8]);
+L100: /* CALLM */
+    return code + 100;
+L101: /* JUMP */
+    tp_aot_safepoint(tp, 48);
+    goto L53;
+L102: /* LINE */
+    f->line = code + 102;
+    f->lineno = 65;
+L111: /* LIST */
+    tp_aot_op(tp, f, code + 111);
+L112: /* LIST */
+    tp_aot_op(tp, f, code + 112);
+L113: /* VAR */
+L116: /* MOVE */
+    regs[6] = regs[3];
+L117: /* VAR */
+L121: /* MOVE */
+    regs[3] = regs[4];
+L122: /* LINE */
+    f->line = code + 122;
+    f->lineno = 66;
+L128: /* NUMBER */
+    tp_aot_op(tp, f, code + 128);
+L131: /* ITER */
+    if (tp_iter_next(tp, &regs[4], regs[0], &regs[7])) {
+        goto L133;
+    }
+L132: /* JUMP */
+    goto L167;
+L133: /* MOVE */
+    regs[5] = regs[4];
+L134: /* LINE */
+    f->line = code + 134;
+    f->lineno = 67;
+L142: /* STRING */
+    tp_aot_op(tp, f, code + 142);
+L146: /* METHOD */
+    tp_aot_op(tp, f, code + 146);
+L148: /* DICT */
+    tp_aot_op(tp, f, code + 148);
+L149: /* CALLM */
+    return code + 149;
+L150: /* LINE */
+    f->line = code + 150;
+    f->lineno = 68;
+L158: /* STRING */
+    tp_aot_op(tp, f, code + 158);
+L162: /* METHOD */
+    tp_aot_op(tp, f, code + 162);
+L164: /* DICT */
+    tp_aot_op(tp, f, code + 164);
+L165: /* CALLM */
+    return code + 165;
+L166: /* JUMP */
+    tp_aot_safepoint(tp, 35);
+    goto L131;
+L167: /* LINE */
+    f->line = code + 167;
+    f->lineno = 69;
+L173: /* VAR */
+L176: /* NUMBER */
+    tp_aot_op(tp, f, code + 176);
+L179: /* LINE */
+    f->line = code + 179;
+    f->lineno = 70;
+L185: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L187;
+    }
+L186: /* JUMP */
+    goto L513;
+L187: /* LINE */
+    f->line = code + 187;
+    f->lineno = 71;
+L194: /* NUMBER */
+    tp_aot_op(tp, f, code + 194);
+L197: /* MOVE */
+    regs[4] = regs[7];
+L198: /* LINE */
+    f->line = code + 198;
+    f->lineno = 72;
+L211: /* GGET */
+    tp_aot_op(tp, f, code + 211);
+L215: /* GGET */
+    tp_aot_op(tp, f, code + 215);
+L218: /* MOVE */
+    regs[16] = regs[0];
+L219: /* CALLP */
+    return code + 219;
+L220: /* NUMBER */
+    tp_aot_op(tp, f, code + 220);
+L223: /* SUB */
+    if (TP_BOTH(regs[12], regs[15], TP_NUMBER_INT)) {
+        regs[12] = tp_int(regs[12].nint - regs[15].nint);
+    } else {
+        tp_aot_op(tp, f, code + 223);
+    }
+L224: /* NUMBER */
+    tp_aot_op(tp, f, code + 224);
+L227: /* NUMBER */
+    tp_aot_op(tp, f, code + 227);
+L230: /* RANGE */
+    tp_aot_op(tp, f, code + 230);
+L231: /* FOR */
+    if (regs[9].type.typeid == TP_NUMBER) {
+        if (regs[10].nint > 0 ? regs[8].nint < regs[9].nint : regs[8].nint > regs[9].nint) {
+            regs[7] = regs[8];
+            regs[8].nint += regs[10].nint;
+            goto L233;
+        }
+    } else if (tp_iter_next(tp, &regs[7], regs[8], &regs[10])) {
+        goto L233;
+    }
+L232: /* JUMP */
+    tp_aot_safepoint(tp, 47);
+    goto L185;
+L233: /* VAR */
+L235: /* MOVE */
+    regs[11] = regs[7];
+L236: /* LINE */
+    f->line = code + 236;
+    f->lineno = 73;
+L245: /* VAR */
+L247: /* GET */
+    regs[12] = tp_get(tp, regs[3], regs[11]);
+    tp_grey(tp, regs[12]);
+L248: /* MOVE */
+    regs[7] = regs[12];
+L249: /* LINE */
+    f->line = code + 249;
+    f->lineno = 74;
+L268: /* GGET */
+    tp_aot_op(tp, f, code + 268);
+L273: /* STRING */
+    tp_aot_op(tp, f, code + 273);
+L278: /* METHOD */
+    tp_aot_op(tp, f, code + 278);
+L280: /* MOVE */
+    regs[16] = regs[0];
+L281: /* MOVE */
+    regs[17] = regs[1];
+L282: /* MOVE */
+    regs[18] = regs[11];
+L283: /* CALLM */
+    return code + 283;
+L284: /* ADD */
+    if (TP_BOTH(regs[13], regs[2], TP_NUMBER_INT)) {
+        regs[13] = tp_int(regs[13].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 284);
+    }
+L285: /* NUMBER */
+    tp_aot_op(tp, f, code + 285);
+L288: /* ITER */
+    if (tp_iter_next(tp, &regs[12], regs[13], &regs[14])) {
+        goto L290;
+    }
+L289: /* JUMP */
+    goto L332;
+L290: /* VAR */
+L292: /* MOVE */
+    regs[15] = regs[12];
+L293: /* LINE */
+    f->line = code + 293;
+    f->lineno = 75;
+L303: /* GGET */
+    tp_aot_op(tp, f, code + 303);
+L306: /* MOVE */
+    regs[18] = regs[0];
+L307: /* CALLP */
+    return code + 307;
+L308: /* LT */
+    if (TP_BOTH(regs[15], regs[16], TP_NUMBER_INT)) {
+        regs[12] = tp_bool(regs[15].nint < regs[16].nint);
+    } else {
+        tp_aot_op(tp, f, code + 308);
+    }
+L309: /* IF */
+    if (TP_IS_INT(regs[12]) ? regs[12].nint != 0 : tp_true(tp, regs[12])) {
+        goto L311;
+    }
+L310: /* JUMP */
+    tp_aot_safepoint(tp, 22);
+    goto L288;
+L311: /* LINE */
+    f->line = code + 311;
+    f->lineno = 76;
+L323: /* STRING */
+    tp_aot_op(tp, f, code + 323);
+L327: /* METHOD */
+    tp_aot_op(tp, f, code + 327);
+L329: /* GET */
+    regs[18] = tp_get(tp, regs[6], regs[15]);
+    tp_grey(tp, regs[18]);
+L330: /* CALLM */
+    return code + 330;
+L331: /* JUMP */
+    tp_aot_safepoint(tp, 43);
+    goto L288;
+L332: /* LINE */
+    f->line = code + 332;
+    f->lineno = 77;
+L340: /* GET */
+    regs[5] = tp_get(tp, regs[0], regs[11]);
+    tp_grey(tp, regs[5]);
+L341: /* LINE */
+    f->line = code + 341;
+    f->lineno = 78;
+L351: /* VAR */
+L353: /* GGET */
+    tp_aot_op(tp, f, code + 353);
+L358: /* STRING */
+    tp_aot_op(tp, f, code + 358);
+L362: /* METHOD */
+    tp_aot_op(tp, f, code + 362);
+L364: /* MOVE */
+    regs[18] = regs[5];
+L365: /* CALLM */
+    return code + 365;
+L366: /* LINE */
+    f->line = code + 366;
+    f->lineno = 79;
+L373: /* VAR */
+L375: /* DICT */
+    tp_aot_op(tp, f, code + 375);
+L376: /* MOVE */
+    regs[13] = regs[14];
+L377: /* LINE */
+    f->line = code + 377;
+    f->lineno = 80;
+L385: /* NUMBER */
+    tp_aot_op(tp, f, code + 385);
+L388: /* ITER */
+    if (tp_iter_next(tp, &regs[14], regs[7], &regs[16])) {
+        goto L390;
+    }
+L389: /* JUMP */
+    goto L420;
+L390: /* VAR */
+L392: /* MOVE */
+    regs[17] = regs[14];
+L393: /* LINE */
+    f->line = code + 393;
+    f->lineno = 81;
+L402: /* NOTIN */
+    regs[14] = tp_bool(!tp_true(tp, tp_has(tp, regs[12], regs[17])));
+L403: /* IF */
+    if (TP_IS_INT(regs[14]) ? regs[14].nint != 0 : tp_true(tp, regs[14])) {
+        goto L405;
+    }
+L404: /* JUMP */
+    tp_aot_safepoint(tp, 16);
+    goto L388;
+L405: /* LINE */
+    f->line = code + 405;
+    f->lineno = 82;
+L415: /* NUMBER */
+    tp_aot_op(tp, f, code + 415);
+L418: /* SET */
+    tp_set(tp, regs[13], regs[17], regs[14]);
+L419: /* JUMP */
+    tp_aot_safepoint(tp, 31);
+    goto L388;
+L420: /* LINE */
+    f->line = code + 420;
+    f->lineno = 83;
+L431: /* GGET */
+    tp_aot_op(tp, f, code + 431);
+L436: /* STRING */
+    tp_aot_op(tp, f, code + 436);
+L440: /* METHOD */
+    tp_aot_op(tp, f, code + 440);
+L442: /* MOVE */
+    regs[20] = regs[5];
+L443: /* CALLM */
+    return code + 443;
+L444: /* NUMBER */
+    tp_aot_op(tp, f, code + 444);
+L447: /* ITER */
+    if (tp_iter_next(tp, &regs[14], regs[16], &regs[18])) {
+        goto L449;
+    }
+L448: /* JUMP */
+    goto L464;
+L449: /* MOVE */
+    regs[17] = regs[14];
+L450: /* LINE */
+    f->line = code + 450;
+    f->lineno = 84;
+L459: /* NUMBER */
+    tp_aot_op(tp, f, code + 459);
+L462: /* SET */
+    tp_set(tp, regs[13], regs[17], regs[14]);
+L463: /* JUMP */
+    tp_aot_safepoint(tp, 16);
+    goto L447;
+L464: /* LINE */
+    f->line = code + 464;
+    f->lineno = 85;
+L476: /* GGET */
+    tp_aot_op(tp, f, code + 476);
+L479: /* MOVE */
+    regs[19] = regs[13];
+L480: /* CALLP */
+    return code + 480;
+L481: /* GGET */
+    tp_aot_op(tp, f, code + 481);
+L484: /* GET */
+    regs[19] = tp_get(tp, regs[6], regs[11]);
+    tp_grey(tp, regs[19]);
+L485: /* CALLP */
+    return code + 485;
+L486: /* NE */
+    if (TP_BOTH(regs[14], regs[16], TP_NUMBER_INT)) {
+        regs[14] = tp_bool(regs[14].nint != regs[16].nint);
+    } else {
+        tp_aot_op(tp, f, code + 486);
+    }
+L487: /* IF */
+    if (TP_IS_INT(regs[14]) ? regs[14].nint != 0 : tp_true(tp, regs[14])) {
+        goto L489;
+    }
+L488: /* JUMP */
+    tp_aot_safepoint(tp, 257);
+    goto L231;
+L489: /* LINE */
+    f->line = code + 489;
+    f->lineno = 86;
+L499: /* SET */
+    tp_set(tp, regs[6], regs[11], regs[13]);
+L500: /* LINE */
+    f->line = code + 500;
+    f->lineno = 87;
+L509: /* NUMBER */
+    tp_aot_op(tp, f, code + 509);
+L512: /* JUMP */
+    tp_aot_safepoint(tp, 281);
+    goto L231;
+L513: /* LINE */
+    f->line = code + 513;
+    f->lineno = 88;
+L522: /* MOVE */
+    regs[9] = regs[6];
+L523: /* MOVE */
+    regs[10] = regs[3];
+L524: /* LIST */
+    tp_aot_op(tp, f, code + 524);
+L525: /* RETURN */
+    return code + 525;
+L526: /* EOF */
+    return code + 526;
+}
+
+static tpd_code * _tp_tinypy_compiler_regalloc_1654(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 12: goto L12;
+        case 14: goto L14;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 28: goto L28;
+        case 29: goto L29;
+        case 37: goto L37;
+        case 38: goto L38;
+        case 39: goto L39;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 55: goto L55;
+        case 56: goto L56;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 90;
+L9: /* VAR */
+L12: /* VAR */
+L14: /* STRING */
+    tp_aot_op(tp, f, code + 14);
+L23: /* FILE */
+    f->fname = regs[2];
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L28: /* NAME */
+    f->name = regs[2];
+L29: /* LINE */
+    f->line = code + 29;
+    f->lineno = 91;
+L37: /* GET */
+    regs[2] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[2]);
+L38: /* NE */
+    if (TP_BOTH(regs[2], regs[1], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint != regs[1].nint);
+    } else {
+        tp_aot_op(tp, f, code + 38);
+    }
+L39: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L41;
+    }
+L40: /* JUMP */
+    goto L50;
+L41: /* LINE */
+    f->line = code + 41;
+    f->lineno = 92;
+L48: /* GET */
+    regs[1] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[1]);
+L49: /* JUMP */
+    tp_aot_safepoint(tp, 12);
+    goto L37;
+L50: /* LINE */
+    f->line = code + 50;
+    f->lineno = 93;
+L55: /* RETURN */
+    return code + 55;
+L56: /* EOF */
+    return code + 56;
+}
+
+static tpd_code * _tp_tinypy_compiler_regalloc_1740(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 15: goto L15;
+        case 24: goto L24;
+        case 25: goto L25;
+        case 29: goto L29;
+        case 30: goto L30;
+        case 37: goto L37;
+        case 38: goto L38;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 53: goto L53;
+        case 54: goto L54;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 95;
+L9: /* VAR */
+L11: /* VAR */
+L13: /* VAR */
+L15: /* STRING */
+    tp_aot_op(tp, f, code + 15);
+L24: /* FILE */
+    f->fname = regs[3];
+L25: /* STRING */
+    tp_aot_op(tp, f, code + 25);
+L29: /* NAME */
+    f->name = regs[3];
+L30: /* LINE */
+    f->line = code + 30;
+    f->lineno = 96;
+L37: /* GET */
+    regs[3] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[3]);
+L38: /* NUMBER */
+    tp_aot_op(tp, f, code + 38);
+L41: /* SET */
+    tp_set(tp, regs[3], regs[2], regs[4]);
+L42: /* LINE */
+    f->line = code + 42;
+    f->lineno = 97;
+L49: /* GET */
+    regs[3] = tp_get(tp, regs[0], regs[2]);
+    tp_grey(tp, regs[3]);
+L50: /* NUMBER */
+    tp_aot_op(tp, f, code + 50);
+L53: /* SET */
+    tp_set(tp, regs[3], regs[1], regs[4]);
+L54: /* EOF */
+    return code + 54;
+}
+
+static tpd_code * _tp_tinypy_compiler_regalloc_1831(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 13: goto L13;
+        case 16: goto L16;
+        case 19: goto L19;
+        case 22: goto L22;
+        case 31: goto L31;
+        case 32: goto L32;
+        case 37: goto L37;
+        case 38: goto L38;
+        case 49: goto L49;
+        case 52: goto L52;
+        case 57: goto L57;
+        case 62: goto L62;
+        case 64: goto L64;
+        case 65: goto L65;
+        case 66: goto L66;
+        case 79: goto L79;
+        case 84: goto L84;
+        case 85: goto L85;
+        case 86: goto L86;
+        case 87: goto L87;
+        case 89: goto L89;
+        case 92: goto L92;
+        case 95: goto L95;
+        case 96: goto L96;
+        case 100: goto L100;
+        case 103: goto L103;
+        case 104: goto L104;
+        case 109: goto L109;
+        case 111: goto L111;
+        case 112: goto L112;
+        case 117: goto L117;
+        case 120: goto L120;
+        case 121: goto L121;
+        case 122: goto L122;
+        case 128: goto L128;
+        case 131: goto L131;
+        case 132: goto L132;
+        case 133: goto L133;
+        case 135: goto L135;
+        case 136: goto L136;
+        case 149: goto L149;
+        case 154: goto L154;
+        case 158: goto L158;
+        case 160: goto L160;
+        case 161: goto L161;
+        case 162: goto L162;
+        case 166: goto L166;
+        case 167: goto L167;
+        case 168: goto L168;
+        case 169: goto L169;
+        case 172: goto L172;
+        case 173: goto L173;
+        case 174: goto L174;
+        case 176: goto L176;
+        case 177: goto L177;
+        case 186: goto L186;
+        case 187: goto L187;
+        case 188: goto L188;
+        case 189: goto L189;
+        case 197: goto L197;
+        case 198: goto L198;
+        case 199: goto L199;
+        case 208: goto L208;
+        case 212: goto L212;
+        case 214: goto L214;
+        case 215: goto L215;
+        case 216: goto L216;
+        case 217: goto L217;
+        case 222: goto L222;
+        case 225: goto L225;
+        case 226: goto L226;
+        case 227: goto L227;
+        case 233: goto L233;
+        case 236: goto L236;
+        case 237: goto L237;
+        case 238: goto L238;
+        case 239: goto L239;
+        case 246: goto L246;
+        case 247: goto L247;
+        case 248: goto L248;
+        case 249: goto L249;
+        case 258: goto L258;
+        case 262: goto L262;
+        case 265: goto L265;
+        case 266: goto L266;
+        case 267: goto L267;
+        case 268: goto L268;
+        case 269: goto L269;
+        case 270: goto L270;
+        case 272: goto L272;
+        case 273: goto L273;
+        case 280: goto L280;
+        case 281: goto L281;
+        case 287: goto L287;
+        case 289: goto L289;
+        case 290: goto L290;
+        case 301: goto L301;
+        case 306: goto L306;
+        case 310: goto L310;
+        case 312: goto L312;
+        case 313: goto L313;
+        case 317: goto L317;
+        case 318: goto L318;
+        case 319: goto L319;
+        case 320: goto L320;
+        case 327: goto L327;
+        case 330: goto L330;
+        case 331: goto L331;
+        case 342: goto L342;
+        case 345: goto L345;
+        case 346: goto L346;
+        case 347: goto L347;
+        case 351: goto L351;
+        case 353: goto L353;
+        case 354: goto L354;
+        case 355: goto L355;
+        case 366: goto L366;
+        case 367: goto L367;
+        case 371: goto L371;
+        case 373: goto L373;
+        case 376: goto L376;
+        case 377: goto L377;
+        case 378: goto L378;
+        case 385: goto L385;
+        case 387: goto L387;
+        case 391: goto L391;
+        case 392: goto L392;
+        case 393: goto L393;
+        case 394: goto L394;
+        case 400: goto L400;
+        case 403: goto L403;
+        case 404: goto L404;
+        case 405: goto L405;
+        case 406: goto L406;
+        case 416: goto L416;
+        case 417: goto L417;
+        case 420: goto L420;
+        case 421: goto L421;
+        case 422: goto L422;
+        case 424: goto L424;
+        case 425: goto L425;
+        case 436: goto L436;
+        case 437: goto L437;
+        case 438: goto L438;
+        case 439: goto L439;
+        case 440: goto L440;
+        case 441: goto L441;
+        case 442: goto L442;
+        case 452: goto L452;
+        case 456: goto L456;
+        case 457: goto L457;
+        case 458: goto L458;
+        case 459: goto L459;
+        case 460: goto L460;
+        case 461: goto L461;
+        case 468: goto L468;
+        case 471: goto L471;
+        case 472: goto L472;
+        case 473: goto L473;
+        case 474: goto L474;
+        case 482: goto L482;
+        case 483: goto L483;
+        case 484: goto L484;
+        case 485: goto L485;
+        case 495: goto L495;
+        case 499: goto L499;
+        case 500: goto L500;
+        case 501: goto L501;
+        case 502: goto L502;
+        case 503: goto L503;
+        case 504: goto L504;
+        case 521: goto L521;
+        case 524: goto L524;
+        case 525: goto L525;
+        case 529: goto L529;
+        case 530: goto L530;
+        case 531: goto L531;
+        case 532: goto L532;
+        case 535: goto L535;
+        case 536: goto L536;
+        case 541: goto L541;
+        case 546: goto L546;
+        case 548: goto L548;
+        case 549: goto L549;
+        case 550: goto L550;
+        case 551: goto L551;
+        case 563: goto L563;
+        case 568: goto L568;
+        case 572: goto L572;
+        case 574: goto L574;
+        case 575: goto L575;
+        case 576: goto L576;
+        case 579: goto L579;
+        case 580: goto L580;
+        case 581: goto L581;
+        case 582: goto L582;
+        case 591: goto L591;
+        case 592: goto L592;
+        case 593: goto L593;
+        case 594: goto L594;
+        case 605: goto L605;
+        case 609: goto L609;
+        case 610: goto L610;
+        case 611: goto L611;
+        case 612: goto L612;
+        case 613: goto L613;
+        case 614: goto L614;
+        case 619: goto L619;
+        case 622: goto L622;
+        case 623: goto L623;
+        case 624: goto L624;
+        case 630: goto L630;
+        case 633: goto L633;
+        case 634: goto L634;
+        case 635: goto L635;
+        case 636: goto L636;
+        case 643: goto L643;
+        case 644: goto L644;
+        case 645: goto L645;
+        case 651: goto L651;
+        case 654: goto L654;
+        case 655: goto L655;
+        case 656: goto L656;
+        case 657: goto L657;
+        case 665: goto L665;
+        case 669: goto L669;
+        case 670: goto L670;
+        case 671: goto L671;
+        case 674: goto L674;
+        case 675: goto L675;
+        case 676: goto L676;
+        case 678: goto L678;
+        case 679: goto L679;
+        case 695: goto L695;
+        case 699: goto L699;
+        case 702: goto L702;
+        case 703: goto L703;
+        case 706: goto L706;
+        case 707: goto L707;
+        case 710: goto L710;
+        case 711: goto L711;
+        case 714: goto L714;
+        case 715: goto L715;
+        case 716: goto L716;
+        case 717: goto L717;
+        case 718: goto L718;
+        case 719: goto L719;
+        case 720: goto L720;
+        case 737: goto L737;
+        case 741: goto L741;
+        case 742: goto L742;
+        case 745: goto L745;
+        case 746: goto L746;
+        case 747: goto L747;
+        case 751: goto L751;
+        case 752: goto L752;
+        case 753: goto L753;
+        case 754: goto L754;
+        case 756: goto L756;
+        case 757: goto L757;
+        case 759: goto L759;
+        case 760: goto L760;
+        case 768: goto L768;
+        case 769: goto L769;
+        case 770: goto L770;
+        case 771: goto L771;
+        case 781: goto L781;
+        case 782: goto L782;
+        case 783: goto L783;
+        case 788: goto L788;
+        case 791: goto L791;
+        case 792: goto L792;
+        case 797: goto L797;
+        case 800: goto L800;
+        case 801: goto L801;
+        case 802: goto L802;
+        case 808: goto L808;
+        case 811: goto L811;
+        case 812: goto L812;
+        case 813: goto L813;
+        case 814: goto L814;
+        case 822: goto L822;
+        case 826: goto L826;
+        case 827: goto L827;
+        case 828: goto L828;
+        case 829: goto L829;
+        case 837: goto L837;
+        case 838: goto L838;
+        case 839: goto L839;
+        case 840: goto L840;
+        case 848: goto L848;
+        case 849: goto L849;
+        case 850: goto L850;
+        case 858: goto L858;
+        case 862: goto L862;
+        case 864: goto L864;
+        case 865: goto L865;
+        case 866: goto L866;
+        case 874: goto L874;
+        case 875: goto L875;
+        case 879: goto L879;
+        case 881: goto L881;
+        case 882: goto L882;
+        case 883: goto L883;
+        case 884: goto L884;
+        case 889: goto L889;
+        case 892: goto L892;
+        case 893: goto L893;
+        case 899: goto L899;
+        case 902: goto L902;
+        case 903: goto L903;
+        case 904: goto L904;
+        case 905: goto L905;
+        case 906: goto L906;
+        case 915: goto L915;
+        case 918: goto L918;
+        case 919: goto L919;
+        case 922: goto L922;
+        case 923: goto L923;
+        case 924: goto L924;
+        case 925: goto L925;
+        case 937: goto L937;
+        case 940: goto L940;
+        case 944: goto L944;
+        case 945: goto L945;
+        case 946: goto L946;
+        case 947: goto L947;
+        case 948: goto L948;
+        case 949: goto L949;
+        case 954: goto L954;
+        case 956: goto L956;
+        case 957: goto L957;
+        case 962: goto L962;
+        case 965: goto L965;
+        case 966: goto L966;
+        case 967: goto L967;
+        case 973: goto L973;
+        case 976: goto L976;
+        case 977: goto L977;
+        case 978: goto L978;
+        case 979: goto L979;
+        case 990: goto L990;
+        case 991: goto L991;
+        case 992: goto L992;
+        case 993: goto L993;
+        case 997: goto L997;
+        case 999: goto L999;
+        case 1000: goto L1000;
+        case 1001: goto L1001;
+        case 1002: goto L1002;
+        case 1008: goto L1008;
+        case 1011: goto L1011;
+        case 1012: goto L1012;
+        case 1013: goto L1013;
+        case 1014: goto L1014;
+        case 1026: goto L1026;
+        case 1027: goto L1027;
+        case 1028: goto L1028;
+        case 1029: goto L1029;
+        case 1033: goto L1033;
+        case 1035: goto L1035;
+        case 1036: goto L1036;
+        case 1037: goto L1037;
+        case 1038: goto L1038;
+        case 1044: goto L1044;
+        case 1047: goto L1047;
+        case 1048: goto L1048;
+        case 1049: goto L1049;
+        case 1050: goto L1050;
+        case 1058: goto L1058;
+        case 1061: goto L1061;
+        case 1062: goto L1062;
+        case 1069: goto L1069;
+        case 1071: goto L1071;
+        case 1074: goto L1074;
+        case 1075: goto L1075;
+        case 1076: goto L1076;
+        case 1083: goto L1083;
+        case 1086: goto L1086;
+        case 1087: goto L1087;
+        case 1088: goto L1088;
+        case 1089: goto L1089;
+        case 1097: goto L1097;
+        case 1100: goto L1100;
+        case 1101: goto L1101;
+        case 1102: goto L1102;
+        case 1103: goto L1103;
+        case 1104: goto L1104;
+        case 1105: goto L1105;
+        case 1112: goto L1112;
+        case 1113: goto L1113;
+        case 1114: goto L1114;
+        case 1115: goto L1115;
+        case 1123: goto L1123;
+        case 1126: goto L1126;
+        case 1127: goto L1127;
+        case 1128: goto L1128;
+        case 1129: goto L1129;
+        case 1130: goto L1130;
+        case 1135: goto L1135;
+        case 1142: goto L1142;
+        case 1143: goto L1143;
+        case 1144: goto L1144;
+        case 1152: goto L1152;
+        case 1155: goto L1155;
+        case 1156: goto L1156;
+        case 1157: goto L1157;
+        case 1158: goto L1158;
+        case 1168: goto L1168;
+        case 1169: goto L1169;
+        case 1172: goto L1172;
+        case 1173: goto L1173;
+        case 1174: goto L1174;
+        case 1175: goto L1175;
+        case 1190: goto L1190;
+        case 1191: goto L1191;
+        case 1192: goto L1192;
+        case 1193: goto L1193;
+        case 1194: goto L1194;
+        case 1195: goto L1195;
+        case 1196: goto L1196;
+        case 1197: goto L1197;
+        case 1198: goto L1198;
+        case 1213: goto L1213;
+        case 1217: goto L1217;
+        case 1219: goto L1219;
+        case 1220: goto L1220;
+        case 1221: goto L1221;
+        case 1222: goto L1222;
+        case 1223: goto L1223;
+        case 1224: goto L1224;
+        case 1235: goto L1235;
+        case 1239: goto L1239;
+        case 1242: goto L1242;
+        case 1245: goto L1245;
+        case 1246: goto L1246;
+        case 1247: goto L1247;
+        case 1248: goto L1248;
+        case 1251: goto L1251;
+        case 1252: goto L1252;
+        case 1262: goto L1262;
+        case 1266: goto L1266;
+        case 1268: goto L1268;
+        case 1269: goto L1269;
+        case 1270: goto L1270;
+        case 1271: goto L1271;
+        case 1279: goto L1279;
+        case 1282: goto L1282;
+        case 1283: goto L1283;
+        case 1284: goto L1284;
+        case 1285: goto L1285;
+        case 1292: goto L1292;
+        case 1294: goto L1294;
+        case 1297: goto L1297;
+        case 1298: goto L1298;
+        case 1306: goto L1306;
+        case 1309: goto L1309;
+        case 1310: goto L1310;
+        case 1311: goto L1311;
+        case 1312: goto L1312;
+        case 1322: goto L1322;
+        case 1324: goto L1324;
+        case 1325: goto L1325;
+        case 1326: goto L1326;
+        case 1334: goto L1334;
+        case 1337: goto L1337;
+        case 1338: goto L1338;
+        case 1339: goto L1339;
+        case 1340: goto L1340;
+        case 1349: goto L1349;
+        case 1352: goto L1352;
+        case 1360: goto L1360;
+        case 1361: goto L1361;
+        case 1371: goto L1371;
+        case 1372: goto L1372;
+        case 1375: goto L1375;
+        case 1376: goto L1376;
+        case 1377: goto L1377;
+        case 1378: goto L1378;
+        case 1392: goto L1392;
+        case 1393: goto L1393;
+        case 1394: goto L1394;
+        case 1395: goto L1395;
+        case 1396: goto L1396;
+        case 1397: goto L1397;
+        case 1398: goto L1398;
+        case 1399: goto L1399;
+        case 1409: goto L1409;
+        case 1412: goto L1412;
+        case 1421: goto L1421;
+        case 1429: goto L1429;
+        case 1430: goto L1430;
+        case 1431: goto L1431;
+        case 1439: goto L1439;
+        case 1445: goto L1445;
+        case 1446: goto L1446;
+        case 1447: goto L1447;
+        case 1454: goto L1454;
+        case 1461: goto L1461;
+        case 1464: goto L1464;
+        case 1465: goto L1465;
+        case 1466: goto L1466;
+        case 1467: goto L1467;
+        case 1477: goto L1477;
+        case 1478: goto L1478;
+        case 1479: goto L1479;
+        case 1480: goto L1480;
+        case 1481: goto L1481;
+        case 1489: goto L1489;
+        case 1492: goto L1492;
+        case 1495: goto L1495;
+        case 1498: goto L1498;
+        case 1499: goto L1499;
+        case 1500: goto L1500;
+        case 1501: goto L1501;
+        case 1507: goto L1507;
+        case 1510: goto L1510;
+        case 1511: goto L1511;
+        case 1512: goto L1512;
+        case 1513: goto L1513;
+        case 1524: goto L1524;
+        case 1527: goto L1527;
+        case 1528: goto L1528;
+        case 1529: goto L1529;
+        case 1532: goto L1532;
+        case 1533: goto L1533;
+        case 1534: goto L1534;
+        case 1535: goto L1535;
+        case 1536: goto L1536;
+        case 1543: goto L1543;
+        case 1544: goto L1544;
+        case 1545: goto L1545;
+        case 1546: goto L1546;
+        case 1553: goto L1553;
+        case 1554: goto L1554;
+        case 1563: goto L1563;
+        case 1567: goto L1567;
+        case 1570: goto L1570;
+        case 1571: goto L1571;
+        case 1572: goto L1572;
+        case 1573: goto L1573;
+        case 1574: goto L1574;
+        case 1575: goto L1575;
+        case 1576: goto L1576;
+        case 1583: goto L1583;
+        case 1584: goto L1584;
+        case 1600: goto L1600;
+        case 1605: goto L1605;
+        case 1609: goto L1609;
+        case 1611: goto L1611;
+        case 1612: goto L1612;
+        case 1615: goto L1615;
+        case 1616: goto L1616;
+        case 1617: goto L1617;
+        case 1618: goto L1618;
+        case 1621: goto L1621;
+        case 1622: goto L1622;
+        case 1623: goto L1623;
+        case 1624: goto L1624;
+        case 1625: goto L1625;
+        case 1634: goto L1634;
+        case 1638: goto L1638;
+        case 1639: goto L1639;
+        case 1640: goto L1640;
+        case 1647: goto L1647;
+        case 1648: goto L1648;
+        case 1656: goto L1656;
+        case 1660: goto L1660;
+        case 1661: goto L1661;
+        case 1662: goto L1662;
+        case 1665: goto L1665;
+        case 1666: goto L1666;
+        case 1667: goto L1667;
+        case 1669: goto L1669;
+        case 1670: goto L1670;
+        case 1679: goto L1679;
+        case 1680: goto L1680;
+        case 1681: goto L1681;
+        case 1682: goto L1682;
+        case 1683: goto L1683;
+        case 1708: goto L1708;
+        case 1713: goto L1713;
+        case 1717: goto L1717;
+        case 1719: goto L1719;
+        case 1720: goto L1720;
+        case 1724: goto L1724;
+        case 1725: goto L1725;
+        case 1726: goto L1726;
+        case 1727: goto L1727;
+        case 1730: goto L1730;
+        case 1731: goto L1731;
+        case 1734: goto L1734;
+        case 1735: goto L1735;
+        case 1736: goto L1736;
+        case 1737: goto L1737;
+        case 1738: goto L1738;
+        case 1743: goto L1743;
+        case 1748: goto L1748;
+        case 1750: goto L1750;
+        case 1751: goto L1751;
+        case 1752: goto L1752;
+        case 1753: goto L1753;
+        case 1754: goto L1754;
+        case 1755: goto L1755;
+        case 1756: goto L1756;
+        case 1765: goto L1765;
+        case 1769: goto L1769;
+        case 1770: goto L1770;
+        case 1771: goto L1771;
+        case 1772: goto L1772;
+        case 1777: goto L1777;
+        case 1778: goto L1778;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 99;
+L13: /* VAR */
+L16: /* VAR */
+L19: /* VAR */
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L31: /* FILE */
+    f->fname = regs[3];
+L32: /* STRING */
+    tp_aot_op(tp, f, code + 32);
+L37: /* NAME */
+    f->name = regs[3];
+L38: /* LINE */
+    f->line = code + 38;
+    f->lineno = 101;
+L49: /* VAR */
+L52: /* GGET */
+    tp_aot_op(tp, f, code + 52);
+L57: /* STRING */
+    tp_aot_op(tp, f, code + 57);
+L62: /* METHOD */
+    tp_aot_op(tp, f, code + 62);
+L64: /* MOVE */
+    regs[7] = regs[0];
+L65: /* CALLM */
+    return code + 65;
+L66: /* LINE */
+    f->line = code + 66;
+    f->lineno = 102;
+L79: /* GGET */
+    tp_aot_op(tp, f, code + 79);
+L84: /* MOVE */
+    regs[6] = regs[0];
+L85: /* MOVE */
+    regs[7] = regs[3];
+L86: /* CALLP */
+    return code + 86;
+L87: /* VAR */
+L89: /* VAR */
+L92: /* NUMBER */
+    tp_aot_op(tp, f, code + 92);
+L95: /* GET */
+    regs[5] = tp_get(tp, regs[8], regs[7]);
+    tp_grey(tp, regs[5]);
+L96: /* VAR */
+L100: /* NUMBER */
+    tp_aot_op(tp, f, code + 100);
+L103: /* GET */
+    regs[6] = tp_get(tp, regs[8], regs[3]);
+    tp_grey(tp, regs[6]);
+L104: /* LINE */
+    f->line = code + 104;
+    f->lineno = 107;
+L109: /* VAR */
+L111: /* DICT */
+    tp_aot_op(tp, f, code + 111);
+L112: /* LINE */
+    f->line = code + 112;
+    f->lineno = 108;
+L117: /* VAR */
+L120: /* LIST */
+    tp_aot_op(tp, f, code + 120);
+L121: /* MOVE */
+    regs[7] = regs[3];
+L122: /* LINE */
+    f->line = code + 122;
+    f->lineno = 109;
+L128: /* NUMBER */
+    tp_aot_op(tp, f, code + 128);
+L131: /* ITER */
+    if (tp_iter_next(tp, &regs[3], regs[0], &regs[4])) {
+        goto L133;
+    }
+L132: /* JUMP */
+    goto L217;
+L133: /* VAR */
+L135: /* MOVE */
+    regs[9] = regs[3];
+L136: /* LINE */
+    f->line = code + 136;
+    f->lineno = 110;
+L149: /* GGET */
+    tp_aot_op(tp, f, code + 149);
+L154: /* STRING */
+    tp_aot_op(tp, f, code + 154);
+L158: /* METHOD */
+    tp_aot_op(tp, f, code + 158);
+L160: /* MOVE */
+    regs[13] = regs[9];
+L161: /* CALLM */
+    return code + 161;
+L162: /* GGET */
+    tp_aot_op(tp, f, code + 162);
+L166: /* MOVE */
+    regs[13] = regs[9];
+L167: /* CALLP */
+    return code + 167;
+L168: /* ADD */
+    if (TP_BOTH(regs[10], regs[11], TP_NUMBER_INT)) {
+        regs[10] = tp_int(regs[10].nint + regs[11].nint);
+    } else {
+        tp_aot_op(tp, f, code + 168);
+    }
+L169: /* NUMBER */
+    tp_aot_op(tp, f, code + 169);
+L172: /* ITER */
+    if (tp_iter_next(tp, &regs[3], regs[10], &regs[11])) {
+        goto L174;
+    }
+L173: /* JUMP */
+    tp_aot_safepoint(tp, 42);
+    goto L131;
+L174: /* VAR */
+L176: /* MOVE */
+    regs[12] = regs[3];
+L177: /* LINE */
+    f->line = code + 177;
+    f->lineno = 111;
+L186: /* NOTIN */
+    regs[3] = tp_bool(!tp_true(tp, tp_has(tp, regs[8], regs[12])));
+L187: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L189;
+    }
+L188: /* JUMP */
+    tp_aot_safepoint(tp, 16);
+    goto L172;
+L189: /* LINE */
+    f->line = code + 189;
+    f->lineno = 112;
+L197: /* DICT */
+    tp_aot_op(tp, f, code + 197);
+L198: /* SET */
+    tp_set(tp, regs[8], regs[12], regs[3]);
+L199: /* LINE */
+    f->line = code + 199;
+    f->lineno = 113;
+L208: /* STRING */
+    tp_aot_op(tp, f, code + 208);
+L212: /* METHOD */
+    tp_aot_op(tp, f, code + 212);
+L214: /* MOVE */
+    regs[15] = regs[12];
+L215: /* CALLM */
+    return code + 215;
+L216: /* JUMP */
+    tp_aot_safepoint(tp, 44);
+    goto L172;
+L217: /* LINE */
+    f->line = code + 217;
+    f->lineno = 114;
+L222: /* VAR */
+L225: /* DICT */
+    tp_aot_op(tp, f, code + 225);
+L226: /* MOVE */
+    regs[3] = regs[4];
+L227: /* LINE */
+    f->line = code + 227;
+    f->lineno = 115;
+L233: /* NUMBER */
+    tp_aot_op(tp, f, code + 233);
+L236: /* ITER */
+    if (tp_iter_next(tp, &regs[4], regs[8], &regs[10])) {
+        goto L238;
+    }
+L237: /* JUMP */
+    goto L249;
+L238: /* MOVE */
+    regs[12] = regs[4];
+L239: /* LINE */
+    f->line = code + 239;
+    f->lineno = 116;
+L246: /* LIST */
+    tp_aot_op(tp, f, code + 246);
+L247: /* SET */
+    tp_set(tp, regs[3], regs[12], regs[4]);
+L248: /* JUMP */
+    tp_aot_safepoint(tp, 12);
+    goto L236;
+L249: /* LINE */
+    f->line = code + 249;
+    f->lineno = 117;
+L258: /* GGET */
+    tp_aot_op(tp, f, code + 258);
+L262: /* GGET */
+    tp_aot_op(tp, f, code + 262);
+L265: /* MOVE */
+    regs[17] = regs[0];
+L266: /* CALLP */
+    return code + 266;
+L267: /* RANGE */
+    tp_aot_op(tp, f, code + 267);
+L268: /* FOR */
+    if (regs[14].type.typeid == TP_NUMBER) {
+        if (regs[15].nint > 0 ? regs[13].nint < regs[14].nint : regs[13].nint > regs[14].nint) {
+            regs[4] = regs[13];
+            regs[13].nint += regs[15].nint;
+            goto L270;
+        }
+    } else if (tp_iter_next(tp, &regs[4], regs[13], &regs[15])) {
+        goto L270;
+    }
+L269: /* JUMP */
+    goto L614;
+L270: /* VAR */
+L272: /* MOVE */
+    regs[10] = regs[4];
+L273: /* LINE */
+    f->line = code + 273;
+    f->lineno = 118;
+L280: /* GET */
+    regs[9] = tp_get(tp, regs[0], regs[10]);
+    tp_grey(tp, regs[9]);
+L281: /* LINE */
+    f->line = code + 281;
+    f->lineno = 119;
+L287: /* VAR */
+L289: /* NONE */
+    regs[4] = tp_None;
+L290: /* LINE */
+    f->line = code + 290;
+    f->lineno = 120;
+L301: /* GGET */
+    tp_aot_op(tp, f, code + 301);
+L306: /* STRING */
+    tp_aot_op(tp, f, code + 306);
+L310: /* METHOD */
+    tp_aot_op(tp, f, code + 310);
+L312: /* MOVE */
+    regs[18] = regs[9];
+L313: /* GGET */
+    tp_aot_op(tp, f, code + 313);
+L317: /* CALLM */
+    return code + 317;
+L318: /* IF */
+    if (TP_IS_INT(regs[11]) ? regs[11].nint != 0 : tp_true(tp, regs[11])) {
+        goto L320;
+    }
+L319: /* JUMP */
+    goto L378;
+L320: /* LINE */
+    f->line = code + 320;
+    f->lineno = 121;
+L327: /* NUMBER */
+    tp_aot_op(tp, f, code + 327);
+L330: /* GET */
+    regs[4] = tp_get(tp, regs[9], regs[16]);
+    tp_grey(tp, regs[4]);
+L331: /* LINE */
+    f->line = code + 331;
+    f->lineno = 122;
+L342: /* NUMBER */
+    tp_aot_op(tp, f, code + 342);
+L345: /* GET */
+    regs[20] = tp_get(tp, regs[9], regs[21]);
+    tp_grey(tp, regs[20]);
+L346: /* GET */
+    regs[19] = tp_get(tp, regs[3], regs[20]);
+    tp_grey(tp, regs[19]);
+L347: /* STRING */
+    tp_aot_op(tp, f, code + 347);
+L351: /* METHOD */
+    tp_aot_op(tp, f, code + 351);
+L353: /* MOVE */
+    regs[18] = regs[4];
+L354: /* CALLM */
+    return code + 354;
+L355: /* LINE */
+    f->line = code + 355;
+    f->lineno = 123;
+L366: /* GET */
+    regs[19] = tp_get(tp, regs[3], regs[4]);
+    tp_grey(tp, regs[19]);
+L367: /* STRING */
+    tp_aot_op(tp, f, code + 367);
+L371: /* METHOD */
+    tp_aot_op(tp, f, code + 371);
+L373: /* NUMBER */
+    tp_aot_op(tp, f, code + 373);
+L376: /* GET */
+    regs[18] = tp_get(tp, regs[9], regs[19]);
+    tp_grey(tp, regs[18]);
+L377: /* CALLM */
+    return code + 377;
+L378: /* LINE */
+    f->line = code + 378;
+    f->lineno = 124;
+L385: /* VAR */
+L387: /* GGET */
+    tp_aot_op(tp, f, code + 387);
+L391: /* MOVE */
+    regs[18] = regs[9];
+L392: /* CALLP */
+    return code + 392;
+L393: /* MOVE */
+    regs[11] = regs[16];
+L394: /* LINE */
+    f->line = code + 394;
+    f->lineno = 125;
+L400: /* NUMBER */
+    tp_aot_op(tp, f, code + 400);
+L403: /* ITER */
+    if (tp_iter_next(tp, &regs[16], regs[11], &regs[17])) {
+        goto L405;
+    }
+L404: /* JUMP */
+    tp_aot_safepoint(tp, 136);
+    goto L268;
+L405: /* MOVE */
+    regs[12] = regs[16];
+L406: /* LINE */
+    f->line = code + 406;
+    f->lineno = 126;
+L416: /* GET */
+    regs[18] = tp_get(tp, regs[6], regs[10]);
+    tp_grey(tp, regs[18]);
+L417: /* NUMBER */
+    tp_aot_op(tp, f, code + 417);
+L420: /* ITER */
+    if (tp_iter_next(tp, &regs[16], regs[18], &regs[19])) {
+        goto L422;
+    }
+L421: /* JUMP */
+    goto L461;
+L422: /* VAR */
+L424: /* MOVE */
+    regs[20] = regs[16];
+L425: /* LINE */
+    f->line = code + 425;
+    f->lineno = 127;
+L436: /* NE */
+    if (TP_BOTH(regs[20], regs[12], TP_NUMBER_INT)) {
+        regs[16] = tp_bool(regs[20].nint != regs[12].nint);
+    } else {
+        tp_aot_op(tp, f, code + 436);
+    }
+L437: /* IF */
+    if (TP_IS_INT(regs[16]) ? regs[16].nint != 0 : tp_true(tp, regs[16])) {
+        goto L439;
+    }
+L438: /* JUMP */
+    goto L440;
+L439: /* NE */
+    if (TP_BOTH(regs[20], regs[4], TP_NUMBER_INT)) {
+        regs[16] = tp_bool(regs[20].nint != regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 439);
+    }
+L440: /* IF */
+    if (TP_IS_INT(regs[16]) ? regs[16].nint != 0 : tp_true(tp, regs[16])) {
+        goto L442;
+    }
+L441: /* JUMP */
+    tp_aot_safepoint(tp, 21);
+    goto L420;
+L442: /* LINE */
+    f->line = code + 442;
+    f->lineno = 128;
+L452: /* GGET */
+    tp_aot_op(tp, f, code + 452);
+L456: /* MOVE */
+    regs[22] = regs[8];
+L457: /* MOVE */
+    regs[23] = regs[12];
+L458: /* MOVE */
+    regs[24] = regs[20];
+L459: /* CALLP */
+    return code + 459;
+L460: /* JUMP */
+    tp_aot_safepoint(tp, 40);
+    goto L420;
+L461: /* LINE */
+    f->line = code + 461;
+    f->lineno = 129;
+L468: /* NUMBER */
+    tp_aot_op(tp, f, code + 468);
+L471: /* ITER */
+    if (tp_iter_next(tp, &regs[16], regs[11], &regs[18])) {
+        goto L473;
+    }
+L472: /* JUMP */
+    goto L504;
+L473: /* MOVE */
+    regs[20] = regs[16];
+L474: /* LINE */
+    f->line = code + 474;
+    f->lineno = 130;
+L482: /* NE */
+    if (TP_BOTH(regs[20], regs[12], TP_NUMBER_INT)) {
+        regs[16] = tp_bool(regs[20].nint != regs[12].nint);
+    } else {
+        tp_aot_op(tp, f, code + 482);
+    }
+L483: /* IF */
+    if (TP_IS_INT(regs[16]) ? regs[16].nint != 0 : tp_true(tp, regs[16])) {
+        goto L485;
+    }
+L484: /* JUMP */
+    tp_aot_safepoint(tp, 13);
+    goto L471;
+L485: /* LINE */
+    f->line = code + 485;
+    f->lineno = 131;
+L495: /* GGET */
+    tp_aot_op(tp, f, code + 495);
+L499: /* MOVE */
+    regs[22] = regs[8];
+L500: /* MOVE */
+    regs[23] = regs[12];
+L501: /* MOVE */
+    regs[24] = regs[20];
+L502: /* CALLP */
+    return code + 502;
+L503: /* JUMP */
+    tp_aot_safepoint(tp, 32);
+    goto L471;
+L504: /* LINE */
+    f->line = code + 504;
+    f->lineno = 132;
+L521: /* NUMBER */
+    tp_aot_op(tp, f, code + 521);
+L524: /* GET */
+    regs[16] = tp_get(tp, regs[9], regs[18]);
+    tp_grey(tp, regs[16]);
+L525: /* STRING */
+    tp_aot_op(tp, f, code + 525);
+L529: /* NE */
+    if (TP_BOTH(regs[16], regs[18], TP_NUMBER_INT)) {
+        regs[16] = tp_bool(regs[16].nint != regs[18].nint);
+    } else {
+        tp_aot_op(tp, f, code + 529);
+    }
+L530: /* IFN */
+    if (!(TP_IS_INT(regs[16]) ? regs[16].nint != 0 : tp_true(tp, regs[16]))) {
+        goto L532;
+    }
+L531: /* JUMP */
+    goto L549;
+L532: /* NUMBER */
+    tp_aot_op(tp, f, code + 532);
+L535: /* GET */
+    regs[16] = tp_get(tp, regs[9], regs[18]);
+    tp_grey(tp, regs[16]);
+L536: /* GGET */
+    tp_aot_op(tp, f, code + 536);
+L541: /* STRING */
+    tp_aot_op(tp, f, code + 541);
+L546: /* MGET */
+    tp_aot_op(tp, f, code + 546);
+L548: /* NOTIN */
+    regs[16] = tp_bool(!tp_true(tp, tp_has(tp, regs[18], regs[16])));
+L549: /* IF */
+    if (TP_IS_INT(regs[16]) ? regs[16].nint != 0 : tp_true(tp, regs[16])) {
+        goto L551;
+    }
+L550: /* JUMP */
+    tp_aot_safepoint(tp, 147);
+    goto L403;
+L551: /* LINE */
+    f->line = code + 551;
+    f->lineno = 133;
+L563: /* GGET */
+    tp_aot_op(tp, f, code + 563);
+L568: /* STRING */
+    tp_aot_op(tp, f, code + 568);
+L572: /* METHOD */
+    tp_aot_op(tp, f, code + 572);
+L574: /* MOVE */
+    regs[23] = regs[9];
+L575: /* CALLM */
+    return code + 575;
+L576: /* NUMBER */
+    tp_aot_op(tp, f, code + 576);
+L579: /* ITER */
+    if (tp_iter_next(tp, &regs[16], regs[18], &regs[19])) {
+        goto L581;
+    }
+L580: /* JUMP */
+    tp_aot_safepoint(tp, 177);
+    goto L403;
+L581: /* MOVE */
+    regs[20] = regs[16];
+L582: /* LINE */
+    f->line = code + 582;
+    f->lineno = 134;
+L591: /* NE */
+    if (TP_BOTH(regs[20], regs[12], TP_NUMBER_INT)) {
+        regs[16] = tp_bool(regs[20].nint != regs[12].nint);
+    } else {
+        tp_aot_op(tp, f, code + 591);
+    }
+L592: /* IF */
+    if (TP_IS_INT(regs[16]) ? regs[16].nint != 0 : tp_true(tp, regs[16])) {
+        goto L594;
+    }
+L593: /* JUMP */
+    tp_aot_safepoint(tp, 14);
+    goto L579;
+L594: /* LINE */
+    f->line = code + 594;
+    f->lineno = 135;
+L605: /* GGET */
+    tp_aot_op(tp, f, code + 605);
+L609: /* MOVE */
+    regs[22] = regs[8];
+L610: /* MOVE */
+    regs[23] = regs[12];
+L611: /* MOVE */
+    regs[24] = regs[20];
+L612: /* CALLP */
+    return code + 612;
+L613: /* JUMP */
+    tp_aot_safepoint(tp, 34);
+    goto L579;
+L614: /* LINE */
+    f->line = code + 614;
+    f->lineno = 138;
+L619: /* VAR */
+L622: /* DICT */
+    tp_aot_op(tp, f, code + 622);
+L623: /* MOVE */
+    regs[13] = regs[14];
+L624: /* LINE */
+    f->line = code + 624;
+    f->lineno = 139;
+L630: /* NUMBER */
+    tp_aot_op(tp, f, code + 630);
+L633: /* ITER */
+    if (tp_iter_next(tp, &regs[14], regs[7], &regs[15])) {
+        goto L635;
+    }
+L634: /* JUMP */
+    goto L645;
+L635: /* MOVE */
+    regs[12] = regs[14];
+L636: /* LINE */
+    f->line = code + 636;
+    f->lineno = 140;
+L643: /* SET */
+    tp_set(tp, regs[13], regs[12], regs[12]);
+L644: /* JUMP */
+    tp_aot_safepoint(tp, 11);
+    goto L633;
+L645: /* LINE */
+    f->line = code + 645;
+    f->lineno = 141;
+L651: /* NUMBER */
+    tp_aot_op(tp, f, code + 651);
+L654: /* ITER */
+    if (tp_iter_next(tp, &regs[14], regs[0], &regs[15])) {
+        goto L656;
+    }
+L655: /* JUMP */
+    goto L783;
+L656: /* MOVE */
+    regs[9] = regs[14];
+L657: /* LINE */
+    f->line = code + 657;
+    f->lineno = 142;
+L665: /* GGET */
+    tp_aot_op(tp, f, code + 665);
+L669: /* MOVE */
+    regs[18] = regs[9];
+L670: /* CALLP */
+    return code + 670;
+L671: /* NUMBER */
+    tp_aot_op(tp, f, code + 671);
+L674: /* ITER */
+    if (tp_iter_next(tp, &regs[14], regs[16], &regs[17])) {
+        goto L676;
+    }
+L675: /* JUMP */
+    tp_aot_safepoint(tp, 21);
+    goto L654;
+L676: /* VAR */
+L678: /* MOVE */
+    regs[18] = regs[14];
+L679: /* LINE */
+    f->line = code + 679;
+    f->lineno = 143;
+L695: /* GGET */
+    tp_aot_op(tp, f, code + 695);
+L699: /* NUMBER */
+    tp_aot_op(tp, f, code + 699);
+L702: /* GET */
+    regs[25] = tp_get(tp, regs[18], regs[19]);
+    tp_grey(tp, regs[25]);
+L703: /* NUMBER */
+    tp_aot_op(tp, f, code + 703);
+L706: /* ADD */
+    if (TP_BOTH(regs[25], regs[19], TP_NUMBER_INT)) {
+        regs[25] = tp_int(regs[25].nint + regs[19].nint);
+    } else {
+        tp_aot_op(tp, f, code + 706);
+    }
+L707: /* NUMBER */
+    tp_aot_op(tp, f, code + 707);
+L710: /* GET */
+    regs[26] = tp_get(tp, regs[18], regs[19]);
+    tp_grey(tp, regs[26]);
+L711: /* NUMBER */
+    tp_aot_op(tp, f, code + 711);
+L714: /* GET */
+    regs[19] = tp_get(tp, regs[18], regs[27]);
+    tp_grey(tp, regs[19]);
+L715: /* ADD */
+    if (TP_BOTH(regs[26], regs[19], TP_NUMBER_INT)) {
+        regs[26] = tp_int(regs[26].nint + regs[19].nint);
+    } else {
+        tp_aot_op(tp, f, code + 715);
+    }
+L716: /* RANGE */
+    tp_aot_op(tp, f, code + 716);
+L717: /* FOR */
+    if (regs[22].type.typeid == TP_NUMBER) {
+        if (regs[23].nint > 0 ? regs[21].nint < regs[22].nint : regs[21].nint > regs[22].nint) {
+            regs[14] = regs[21];
+            regs[21].nint += regs[23].nint;
+            goto L719;
+        }
+    } else if (tp_iter_next(tp, &regs[14], regs[21], &regs[23])) {
+        goto L719;
+    }
+L718: /* JUMP */
+    tp_aot_safepoint(tp, 44);
+    goto L674;
+L719: /* MOVE */
+    regs[12] = regs[14];
+L720: /* LINE */
+    f->line = code + 720;
+    f->lineno = 144;
+L737: /* GGET */
+    tp_aot_op(tp, f, code + 737);
+L741: /* MOVE */
+    regs[25] = regs[13];
+L742: /* NUMBER */
+    tp_aot_op(tp, f, code + 742);
+L745: /* GET */
+    regs[26] = tp_get(tp, regs[18], regs[27]);
+    tp_grey(tp, regs[26]);
+L746: /* CALLP */
+    return code + 746;
+L747: /* GGET */
+    tp_aot_op(tp, f, code + 747);
+L751: /* MOVE */
+    regs[26] = regs[13];
+L752: /* MOVE */
+    regs[27] = regs[12];
+L753: /* CALLP */
+    return code + 753;
+L754: /* VAR */
+L756: /* MOVE */
+    regs[24] = regs[14];
+L757: /* VAR */
+L759: /* MOVE */
+    regs[14] = regs[19];
+L760: /* LINE */
+    f->line = code + 760;
+    f->lineno = 145;
+L768: /* NE */
+    if (TP_BOTH(regs[24], regs[14], TP_NUMBER_INT)) {
+        regs[19] = tp_bool(regs[24].nint != regs[14].nint);
+    } else {
+        tp_aot_op(tp, f, code + 768);
+    }
+L769: /* IF */
+    if (TP_IS_INT(regs[19]) ? regs[19].nint != 0 : tp_true(tp, regs[19])) {
+        goto L771;
+    }
+L770: /* JUMP */
+    tp_aot_safepoint(tp, 53);
+    goto L717;
+L771: /* LINE */
+    f->line = code + 771;
+    f->lineno = 146;
+L781: /* SET */
+    tp_set(tp, regs[13], regs[14], regs[24]);
+L782: /* JUMP */
+    tp_aot_safepoint(tp, 65);
+    goto L717;
+L783: /* LINE */
+    f->line = code + 783;
+    f->lineno = 147;
+L788: /* VAR */
+L791: /* DICT */
+    tp_aot_op(tp, f, code + 791);
+L792: /* LINE */
+    f->line = code + 792;
+    f->lineno = 148;
+L797: /* VAR */
+L800: /* LIST */
+    tp_aot_op(tp, f, code + 800);
+L801: /* MOVE */
+    regs[16] = regs[17];
+L802: /* LINE */
+    f->line = code + 802;
+    f->lineno = 149;
+L808: /* NUMBER */
+    tp_aot_op(tp, f, code + 808);
+L811: /* ITER */
+    if (tp_iter_next(tp, &regs[17], regs[7], &regs[19])) {
+        goto L813;
+    }
+L812: /* JUMP */
+    goto L884;
+L813: /* MOVE */
+    regs[12] = regs[17];
+L814: /* LINE */
+    f->line = code + 814;
+    f->lineno = 150;
+L822: /* GGET */
+    tp_aot_op(tp, f, code + 822);
+L826: /* MOVE */
+    regs[22] = regs[13];
+L827: /* MOVE */
+    regs[23] = regs[12];
+L828: /* CALLP */
+    return code + 828;
+L829: /* LINE */
+    f->line = code + 829;
+    f->lineno = 151;
+L837: /* NOTIN */
+    regs[17] = tp_bool(!tp_true(tp, tp_has(tp, regs[15], regs[24])));
+L838: /* IF */
+    if (TP_IS_INT(regs[17]) ? regs[17].nint != 0 : tp_true(tp, regs[17])) {
+        goto L840;
+    }
+L839: /* JUMP */
+    goto L866;
+L840: /* LINE */
+    f->line = code + 840;
+    f->lineno = 152;
+L848: /* LIST */
+    tp_aot_op(tp, f, code + 848);
+L849: /* SET */
+    tp_set(tp, regs[15], regs[24], regs[17]);
+L850: /* LINE */
+    f->line = code + 850;
+    f->lineno = 153;
+L858: /* STRING */
+    tp_aot_op(tp, f, code + 858);
+L862: /* METHOD */
+    tp_aot_op(tp, f, code + 862);
+L864: /* MOVE */
+    regs[23] = regs[24];
+L865: /* CALLM */
+    return code + 865;
+L866: /* LINE */
+    f->line = code + 866;
+    f->lineno = 154;
+L874: /* GET */
+    regs[25] = tp_get(tp, regs[15], regs[24]);
+    tp_grey(tp, regs[25]);
+L875: /* STRING */
+    tp_aot_op(tp, f, code + 875);
+L879: /* METHOD */
+    tp_aot_op(tp, f, code + 879);
+L881: /* MOVE */
+    regs[23] = regs[12];
+L882: /* CALLM */
+    return code + 882;
+L883: /* JUMP */
+    tp_aot_safepoint(tp, 72);
+    goto L811;
+L884: /* LINE */
+    f->line = code + 884;
+    f->lineno = 156;
+L889: /* VAR */
+L892: /* DICT */
+    tp_aot_op(tp, f, code + 892);
+L893: /* LINE */
+    f->line = code + 893;
+    f->lineno = 157;
+L899: /* GGET */
+    tp_aot_op(tp, f, code + 899);
+L902: /* MOVE */
+    regs[22] = regs[0];
+L903: /* CALLP */
+    return code + 903;
+L904: /* IF */
+    if (TP_IS_INT(regs[19]) ? regs[19].nint != 0 : tp_true(tp, regs[19])) {
+        goto L906;
+    }
+L905: /* JUMP */
+    goto L949;
+L906: /* LINE */
+    f->line = code + 906;
+    f->lineno = 158;
+L915: /* NUMBER */
+    tp_aot_op(tp, f, code + 915);
+L918: /* GET */
+    regs[21] = tp_get(tp, regs[5], regs[22]);
+    tp_grey(tp, regs[21]);
+L919: /* NUMBER */
+    tp_aot_op(tp, f, code + 919);
+L922: /* ITER */
+    if (tp_iter_next(tp, &regs[19], regs[21], &regs[22])) {
+        goto L924;
+    }
+L923: /* JUMP */
+    goto L949;
+L924: /* MOVE */
+    regs[12] = regs[19];
+L925: /* LINE */
+    f->line = code + 925;
+    f->lineno = 159;
+L937: /* NUMBER */
+    tp_aot_op(tp, f, code + 937);
+L940: /* GGET */
+    tp_aot_op(tp, f, code + 940);
+L944: /* MOVE */
+    regs[26] = regs[13];
+L945: /* MOVE */
+    regs[27] = regs[12];
+L946: /* CALLP */
+    return code + 946;
+L947: /* SET */
+    tp_set(tp, regs[17], regs[23], regs[19]);
+L948: /* JUMP */
+    tp_aot_safepoint(tp, 26);
+    goto L922;
+L949: /* LINE */
+    f->line = code + 949;
+    f->lineno = 161;
+L954: /* VAR */
+L956: /* DICT */
+    tp_aot_op(tp, f, code + 956);
+L957: /* LINE */
+    f->line = code + 957;
+    f->lineno = 162;
+L962: /* VAR */
+L965: /* LIST */
+    tp_aot_op(tp, f, code + 965);
+L966: /* MOVE */
+    regs[21] = regs[22];
+L967: /* LINE */
+    f->line = code + 967;
+    f->lineno = 163;
+L973: /* NUMBER */
+    tp_aot_op(tp, f, code + 973);
+L976: /* ITER */
+    if (tp_iter_next(tp, &regs[22], regs[16], &regs[23])) {
+        goto L978;
+    }
+L977: /* JUMP */
+    goto L1002;
+L978: /* MOVE */
+    regs[24] = regs[22];
+L979: /* LINE */
+    f->line = code + 979;
+    f->lineno = 164;
+L990: /* IN */
+    regs[22] = tp_has(tp, regs[17], regs[24]);
+L991: /* IF */
+    if (TP_IS_INT(regs[22]) ? regs[22].nint != 0 : tp_true(tp, regs[22])) {
+        goto L993;
+    }
+L992: /* JUMP */
+    tp_aot_safepoint(tp, 16);
+    goto L976;
+L993: /* STRING */
+    tp_aot_op(tp, f, code + 993);
+L997: /* METHOD */
+    tp_aot_op(tp, f, code + 997);
+L999: /* MOVE */
+    regs[27] = regs[24];
+L1000: /* CALLM */
+    return code + 1000;
+L1001: /* JUMP */
+    tp_aot_safepoint(tp, 25);
+    goto L976;
+L1002: /* LINE */
+    f->line = code + 1002;
+    f->lineno = 165;
+L1008: /* NUMBER */
+    tp_aot_op(tp, f, code + 1008);
+L1011: /* ITER */
+    if (tp_iter_next(tp, &regs[22], regs[16], &regs[23])) {
+        goto L1013;
+    }
+L1012: /* JUMP */
+    goto L1038;
+L1013: /* MOVE */
+    regs[24] = regs[22];
+L1014: /* LINE */
+    f->line = code + 1014;
+    f->lineno = 166;
+L1026: /* NOTIN */
+    regs[22] = tp_bool(!tp_true(tp, tp_has(tp, regs[17], regs[24])));
+L1027: /* IF */
+    if (TP_IS_INT(regs[22]) ? regs[22].nint != 0 : tp_true(tp, regs[22])) {
+        goto L1029;
+    }
+L1028: /* JUMP */
+    tp_aot_safepoint(tp, 17);
+    goto L1011;
+L1029: /* STRING */
+    tp_aot_op(tp, f, code + 1029);
+L1033: /* METHOD */
+    tp_aot_op(tp, f, code + 1033);
+L1035: /* MOVE */
+    regs[27] = regs[24];
+L1036: /* CALLM */
+    return code + 1036;
+L1037: /* JUMP */
+    tp_aot_safepoint(tp, 26);
+    goto L1011;
+L1038: /* LINE */
+    f->line = code + 1038;
+    f->lineno = 167;
+L1044: /* NUMBER */
+    tp_aot_op(tp, f, code + 1044);
+L1047: /* ITER */
+    if (tp_iter_next(tp, &regs[22], regs[21], &regs[23])) {
+        goto L1049;
+    }
+L1048: /* JUMP */
+    goto L1481;
+L1049: /* MOVE */
+    regs[24] = regs[22];
+L1050: /* LINE */
+    f->line = code + 1050;
+    f->lineno = 168;
+L1058: /* VAR */
+L1061: /* GET */
+    regs[22] = tp_get(tp, regs[15], regs[24]);
+    tp_grey(tp, regs[22]);
+L1062: /* LINE */
+    f->line = code + 1062;
+    f->lineno = 169;
+L1069: /* VAR */
+L1071: /* NUMBER */
+    tp_aot_op(tp, f, code + 1071);
+L1074: /* GET */
+    regs[26] = tp_get(tp, regs[22], regs[27]);
+    tp_grey(tp, regs[26]);
+L1075: /* MOVE */
+    regs[25] = regs[26];
+L1076: /* LINE */
+    f->line = code + 1076;
+    f->lineno = 170;
+L1083: /* NUMBER */
+    tp_aot_op(tp, f, code + 1083);
+L1086: /* ITER */
+    if (tp_iter_next(tp, &regs[26], regs[22], &regs[27])) {
+        goto L1088;
+    }
+L1087: /* JUMP */
+    goto L1105;
+L1088: /* MOVE */
+    regs[12] = regs[26];
+L1089: /* LINE */
+    f->line = code + 1089;
+    f->lineno = 171;
+L1097: /* GGET */
+    tp_aot_op(tp, f, code + 1097);
+L1100: /* MOVE */
+    regs[5] = regs[25];
+L1101: /* MOVE */
+    regs[6] = regs[12];
+L1102: /* CALLP */
+    return code + 1102;
+L1103: /* MOVE */
+    regs[25] = regs[26];
+L1104: /* JUMP */
+    tp_aot_safepoint(tp, 18);
+    goto L1086;
+L1105: /* LINE */
+    f->line = code + 1105;
+    f->lineno = 172;
+L1112: /* IN */
+    regs[26] = tp_has(tp, regs[17], regs[24]);
+L1113: /* IF */
+    if (TP_IS_INT(regs[26]) ? regs[26].nint != 0 : tp_true(tp, regs[26])) {
+        goto L1115;
+    }
+L1114: /* JUMP */
+    goto L1130;
+L1115: /* LINE */
+    f->line = code + 1115;
+    f->lineno = 173;
+L1123: /* VAR */
+L1126: /* MOVE */
+    regs[4] = regs[25];
+L1127: /* LIST */
+    tp_aot_op(tp, f, code + 1127);
+L1128: /* MOVE */
+    regs[26] = regs[27];
+L1129: /* JUMP */
+    goto L1271;
+L1130: /* LINE */
+    f->line = code + 1130;
+    f->lineno = 174;
+L1135: /* LINE */
+    f->line = code + 1135;
+    f->lineno = 176;
+L1142: /* LIST */
+    tp_aot_op(tp, f, code + 1142);
+L1143: /* MOVE */
+    regs[26] = regs[27];
+L1144: /* LINE */
+    f->line = code + 1144;
+    f->lineno = 177;
+L1152: /* NUMBER */
+    tp_aot_op(tp, f, code + 1152);
+L1155: /* ITER */
+    if (tp_iter_next(tp, &regs[27], regs[22], &regs[4])) {
+        goto L1157;
+    }
+L1156: /* JUMP */
+    goto L1224;
+L1157: /* MOVE */
+    regs[12] = regs[27];
+L1158: /* LINE */
+    f->line = code + 1158;
+    f->lineno = 178;
+L1168: /* GET */
+    regs[5] = tp_get(tp, regs[3], regs[12]);
+    tp_grey(tp, regs[5]);
+L1169: /* NUMBER */
+    tp_aot_op(tp, f, code + 1169);
+L1172: /* ITER */
+    if (tp_iter_next(tp, &regs[27], regs[5], &regs[6])) {
+        goto L1174;
+    }
+L1173: /* JUMP */
+    tp_aot_safepoint(tp, 18);
+    goto L1155;
+L1174: /* MOVE */
+    regs[20] = regs[27];
+L1175: /* LINE */
+    f->line = code + 1175;
+    f->lineno = 179;
+L1190: /* IN */
+    regs[27] = tp_has(tp, regs[19], regs[20]);
+L1191: /* IF */
+    if (TP_IS_INT(regs[27]) ? regs[27].nint != 0 : tp_true(tp, regs[27])) {
+        goto L1193;
+    }
+L1192: /* JUMP */
+    goto L1196;
+L1193: /* GET */
+    regs[27] = tp_get(tp, regs[19], regs[20]);
+    tp_grey(tp, regs[27]);
+L1194: /* SUB */
+    if (TP_BOTH(regs[12], regs[25], TP_NUMBER_INT)) {
+        regs[34] = tp_int(regs[12].nint - regs[25].nint);
+    } else {
+        tp_aot_op(tp, f, code + 1194);
+    }
+L1195: /* GE */
+    if (TP_BOTH(regs[27], regs[34], TP_NUMBER_INT)) {
+        regs[27] = tp_bool(regs[27].nint >= regs[34].nint);
+    } else {
+        tp_aot_op(tp, f, code + 1195);
+    }
+L1196: /* IF */
+    if (TP_IS_INT(regs[27]) ? regs[27].nint != 0 : tp_true(tp, regs[27])) {
+        goto L1198;
+    }
+L1197: /* JUMP */
+    tp_aot_safepoint(tp, 25);
+    goto L1172;
+L1198: /* LINE */
+    f->line = code + 1198;
+    f->lineno = 180;
+L1213: /* STRING */
+    tp_aot_op(tp, f, code + 1213);
+L1217: /* METHOD */
+    tp_aot_op(tp, f, code + 1217);
+L1219: /* GET */
+    regs[36] = tp_get(tp, regs[19], regs[20]);
+    tp_grey(tp, regs[36]);
+L1220: /* SUB */
+    if (TP_BOTH(regs[12], regs[25], TP_NUMBER_INT)) {
+        regs[37] = tp_int(regs[12].nint - regs[25].nint);
+    } else {
+        tp_aot_op(tp, f, code + 1220);
+    }
+L1221: /* SUB */
+    if (TP_BOTH(regs[36], regs[37], TP_NUMBER_INT)) {
+        regs[36] = tp_int(regs[36].nint - regs[37].nint);
+    } else {
+        tp_aot_op(tp, f, code + 1221);
+    }
+L1222: /* CALLM */
+    return code + 1222;
+L1223: /* JUMP */
+    tp_aot_safepoint(tp, 51);
+    goto L1172;
+L1224: /* LINE */
+    f->line = code + 1224;
+    f->lineno = 181;
+L1235: /* GGET */
+    tp_aot_op(tp, f, code + 1235);
+L1239: /* NUMBER */
+    tp_aot_op(tp, f, code + 1239);
+L1242: /* NUMBER */
+    tp_aot_op(tp, f, code + 1242);
+L1245: /* RANGE */
+    tp_aot_op(tp, f, code + 1245);
+L1246: /* FOR */
+    if (regs[5].type.typeid == TP_NUMBER) {
+        if (regs[6].nint > 0 ? regs[4].nint < regs[5].nint : regs[4].nint > regs[5].nint) {
+            regs[27] = regs[4];
+            regs[4].nint += regs[6].nint;
+            goto L1248;
+        }
+    } else if (tp_iter_next(tp, &regs[27], regs[4], &regs[6])) {
+        goto L1248;
+    }
+L1247: /* JUMP */
+    goto L1271;
+L1248: /* VAR */
+L1251: /* MOVE */
+    regs[34] = regs[27];
+L1252: /* LINE */
+    f->line = code + 1252;
+    f->lineno = 182;
+L1262: /* STRING */
+    tp_aot_op(tp, f, code + 1262);
+L1266: /* METHOD */
+    tp_aot_op(tp, f, code + 1266);
+L1268: /* MOVE */
+    regs[37] = regs[34];
+L1269: /* CALLM */
+    return code + 1269;
+L1270: /* JUMP */
+    tp_aot_safepoint(tp, 24);
+    goto L1246;
+L1271: /* LINE */
+    f->line = code + 1271;
+    f->lineno = 183;
+L1279: /* NUMBER */
+    tp_aot_op(tp, f, code + 1279);
+L1282: /* ITER */
+    if (tp_iter_next(tp, &regs[27], regs[26], &regs[4])) {
+        goto L1284;
+    }
+L1283: /* JUMP */
+    goto L1454;
+L1284: /* MOVE */
+    regs[34] = regs[27];
+L1285: /* LINE */
+    f->line = code + 1285;
+    f->lineno = 184;
+L1292: /* VAR */
+L1294: /* NUMBER */
+    tp_aot_op(tp, f, code + 1294);
+L1297: /* MOVE */
+    regs[27] = regs[5];
+L1298: /* LINE */
+    f->line = code + 1298;
+    f->lineno = 185;
+L1306: /* NUMBER */
+    tp_aot_op(tp, f, code + 1306);
+L1309: /* ITER */
+    if (tp_iter_next(tp, &regs[5], regs[22], &regs[6])) {
+        goto L1311;
+    }
+L1310: /* JUMP */
+    goto L1439;
+L1311: /* MOVE */
+    regs[12] = regs[5];
+L1312: /* LINE */
+    f->line = code + 1312;
+    f->lineno = 186;
+L1322: /* VAR */
+L1324: /* ADD */
+    if (TP_BOTH(regs[34], regs[12], TP_NUMBER_INT)) {
+        regs[35] = tp_int(regs[34].nint + regs[12].nint);
+    } else {
+        tp_aot_op(tp, f, code + 1324);
+    }
+L1325: /* SUB */
+    if (TP_BOTH(regs[35], regs[25], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[35].nint - regs[25].nint);
+    } else {
+        tp_aot_op(tp, f, code + 1325);
+    }
+L1326: /* LINE */
+    f->line = code + 1326;
+    f->lineno = 187;
+L1334: /* NUMBER */
+    tp_aot_op(tp, f, code + 1334);
+L1337: /* GT */
+    if (TP_BOTH(regs[5], regs[36], TP_NUMBER_INT)) {
+        regs[35] = tp_bool(regs[5].nint > regs[36].nint);
+    } else {
+        tp_aot_op(tp, f, code + 1337);
+    }
+L1338: /* IF */
+    if (TP_IS_INT(regs[35]) ? regs[35].nint != 0 : tp_true(tp, regs[35])) {
+        goto L1340;
+    }
+L1339: /* JUMP */
+    goto L1361;
+L1340: /* LINE */
+    f->line = code + 1340;
+    f->lineno = 188;
+L1349: /* NUMBER */
+    tp_aot_op(tp, f, code + 1349);
+L1352: /* LINE */
+    f->line = code + 1352;
+    f->lineno = 189;
+L1360: /* JUMP */
+    goto L1439;
+L1361: /* LINE */
+    f->line = code + 1361;
+    f->lineno = 190;
+L1371: /* GET */
+    regs[36] = tp_get(tp, regs[8], regs[12]);
+    tp_grey(tp, regs[36]);
+L1372: /* NUMBER */
+    tp_aot_op(tp, f, code + 1372);
+L1375: /* ITER */
+    if (tp_iter_next(tp, &regs[35], regs[36], &regs[37])) {
+        goto L1377;
+    }
+L1376: /* JUMP */
+    goto L1421;
+L1377: /* MOVE */
+    regs[20] = regs[35];
+L1378: /* LINE */
+    f->line = code + 1378;
+    f->lineno = 191;
+L1392: /* IN */
+    regs[35] = tp_has(tp, regs[19], regs[20]);
+L1393: /* IF */
+    if (TP_IS_INT(regs[35]) ? regs[35].nint != 0 : tp_true(tp, regs[35])) {
+        goto L1395;
+    }
+L1394: /* JUMP */
+    goto L1397;
+L1395: /* GET */
+    regs[35] = tp_get(tp, regs[19], regs[20]);
+    tp_grey(tp, regs[35]);
+L1396: /* EQ */
+    if (TP_BOTH(regs[35], regs[5], TP_NUMBER_INT)) {
+        regs[35] = tp_bool(regs[35].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 1396);
+    }
+L1397: /* IF */
+    if (TP_IS_INT(regs[35]) ? regs[35].nint != 0 : tp_true(tp, regs[35])) {
+        goto L1399;
+    }
+L1398: /* JUMP */
+    tp_aot_safepoint(tp, 23);
+    goto L1375;
+L1399: /* LINE */
+    f->line = code + 1399;
+    f->lineno = 192;
+L1409: /* NUMBER */
+    tp_aot_op(tp, f, code + 1409);
+L1412: /* LINE */
+    f->line = code + 1412;
+    f->lineno = 193;
+L1421: /* LINE */
+    f->line = code + 1421;
+    f->lineno = 194;
+L1429: /* IFN */
+    if (!(TP_IS_INT(regs[27]) ? regs[27].nint != 0 : tp_true(tp, regs[27]))) {
+        goto L1431;
+    }
+L1430: /* JUMP */
+    tp_aot_safepoint(tp, 121);
+    goto L1309;
+L1431: /* LINE */
+    f->line = code + 1431;
+    f->lineno = 195;
+L1439: /* LINE */
+    f->line = code + 1439;
+    f->lineno = 196;
+L1445: /* IF */
+    if (TP_IS_INT(regs[27]) ? regs[27].nint != 0 : tp_true(tp, regs[27])) {
+        goto L1447;
+    }
+L1446: /* JUMP */
+    tp_aot_safepoint(tp, 164);
+    goto L1282;
+L1447: /* LINE */
+    f->line = code + 1447;
+    f->lineno = 197;
+L1454: /* LINE */
+    f->line = code + 1454;
+    f->lineno = 198;
+L1461: /* NUMBER */
+    tp_aot_op(tp, f, code + 1461);
+L1464: /* ITER */
+    if (tp_iter_next(tp, &regs[4], regs[22], &regs[6])) {
+        goto L1466;
+    }
+L1465: /* JUMP */
+    tp_aot_safepoint(tp, 418);
+    goto L1047;
+L1466: /* MOVE */
+    regs[12] = regs[4];
+L1467: /* LINE */
+    f->line = code + 1467;
+    f->lineno = 199;
+L1477: /* ADD */
+    if (TP_BOTH(regs[34], regs[12], TP_NUMBER_INT)) {
+        regs[4] = tp_int(regs[34].nint + regs[12].nint);
+    } else {
+        tp_aot_op(tp, f, code + 1477);
+    }
+L1478: /* SUB */
+    if (TP_BOTH(regs[4], regs[25], TP_NUMBER_INT)) {
+        regs[4] = tp_int(regs[4].nint - regs[25].nint);
+    } else {
+        tp_aot_op(tp, f, code + 1478);
+    }
+L1479: /* SET */
+    tp_set(tp, regs[19], regs[12], regs[4]);
+L1480: /* JUMP */
+    tp_aot_safepoint(tp, 16);
+    goto L1464;
+L1481: /* LINE */
+    f->line = code + 1481;
+    f->lineno = 201;
+L1489: /* VAR */
+L1492: /* GGET */
+    tp_aot_op(tp, f, code + 1492);
+L1495: /* NUMBER */
+    tp_aot_op(tp, f, code + 1495);
+L1498: /* MOVE */
+    regs[37] = regs[2];
+L1499: /* CALLP */
+    return code + 1499;
+L1500: /* MOVE */
+    regs[23] = regs[4];
+L1501: /* LINE */
+    f->line = code + 1501;
+    f->lineno = 202;
+L1507: /* NUMBER */
+    tp_aot_op(tp, f, code + 1507);
+L1510: /* ITER */
+    if (tp_iter_next(tp, &regs[4], regs[19], &regs[6])) {
+        goto L1512;
+    }
+L1511: /* JUMP */
+    goto L1536;
+L1512: /* MOVE */
+    regs[12] = regs[4];
+L1513: /* LINE */
+    f->line = code + 1513;
+    f->lineno = 203;
+L1524: /* GGET */
+    tp_aot_op(tp, f, code + 1524);
+L1527: /* MOVE */
+    regs[36] = regs[23];
+L1528: /* GET */
+    regs[37] = tp_get(tp, regs[19], regs[12]);
+    tp_grey(tp, regs[37]);
+L1529: /* NUMBER */
+    tp_aot_op(tp, f, code + 1529);
+L1532: /* ADD */
+    if (TP_BOTH(regs[37], regs[11], TP_NUMBER_INT)) {
+        regs[37] = tp_int(regs[37].nint + regs[11].nint);
+    } else {
+        tp_aot_op(tp, f, code + 1532);
+    }
+L1533: /* CALLP */
+    return code + 1533;
+L1534: /* MOVE */
+    regs[23] = regs[4];
+L1535: /* JUMP */
+    tp_aot_safepoint(tp, 25);
+    goto L1510;
+L1536: /* LINE */
+    f->line = code + 1536;
+    f->lineno = 204;
+L1543: /* GT */
+    if (TP_BOTH(regs[23], regs[1], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[23].nint > regs[1].nint);
+    } else {
+        tp_aot_op(tp, f, code + 1543);
+    }
+L1544: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L1546;
+    }
+L1545: /* JUMP */
+    goto L1554;
+L1546: /* LINE */
+    f->line = code + 1546;
+    f->lineno = 206;
+L1553: /* RETURN */
+    return code + 1553;
+L1554: /* LINE */
+    f->line = code + 1554;
+    f->lineno = 207;
+L1563: /* GGET */
+    tp_aot_op(tp, f, code + 1563);
+L1567: /* GGET */
+    tp_aot_op(tp, f, code + 1567);
+L1570: /* MOVE */
+    regs[14] = regs[0];
+L1571: /* CALLP */
+    return code + 1571;
+L1572: /* RANGE */
+    tp_aot_op(tp, f, code + 1572);
+L1573: /* FOR */
+    if (regs[36].type.typeid == TP_NUMBER) {
+        if (regs[37].nint > 0 ? regs[35].nint < regs[36].nint : regs[35].nint > regs[36].nint) {
+            regs[4] = regs[35];
+            regs[35].nint += regs[37].nint;
+            goto L1575;
+        }
+    } else if (tp_iter_next(tp, &regs[4], regs[35], &regs[37])) {
+        goto L1575;
+    }
+L1574: /* JUMP */
+    goto L1772;
+L1575: /* MOVE */
+    regs[10] = regs[4];
+L1576: /* LINE */
+    f->line = code + 1576;
+    f->lineno = 208;
+L1583: /* GET */
+    regs[9] = tp_get(tp, regs[0], regs[10]);
+    tp_grey(tp, regs[9]);
+L1584: /* LINE */
+    f->line = code + 1584;
+    f->lineno = 209;
+L1600: /* GGET */
+    tp_aot_op(tp, f, code + 1600);
+L1605: /* STRING */
+    tp_aot_op(tp, f, code + 1605);
+L1609: /* METHOD */
+    tp_aot_op(tp, f, code + 1609);
+L1611: /* MOVE */
+    regs[13] = regs[9];
+L1612: /* GGET */
+    tp_aot_op(tp, f, code + 1612);
+L1615: /* CALLM */
+    return code + 1615;
+L1616: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L1618;
+    }
+L1617: /* JUMP */
+    goto L1623;
+L1618: /* NUMBER */
+    tp_aot_op(tp, f, code + 1618);
+L1621: /* GET */
+    regs[4] = tp_get(tp, regs[9], regs[6]);
+    tp_grey(tp, regs[4]);
+L1622: /* NOTIN */
+    regs[4] = tp_bool(!tp_true(tp, tp_has(tp, regs[19], regs[4])));
+L1623: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L1625;
+    }
+L1624: /* JUMP */
+    goto L1648;
+L1625: /* LINE */
+    f->line = code + 1625;
+    f->lineno = 211;
+L1634: /* STRING */
+    tp_aot_op(tp, f, code + 1634);
+L1638: /* LIST */
+    tp_aot_op(tp, f, code + 1638);
+L1639: /* SET */
+    tp_set(tp, regs[0], regs[10], regs[4]);
+L1640: /* LINE */
+    f->line = code + 1640;
+    f->lineno = 212;
+L1647: /* JUMP */
+    tp_aot_safepoint(tp, 74);
+    goto L1573;
+L1648: /* LINE */
+    f->line = code + 1648;
+    f->lineno = 213;
+L1656: /* GGET */
+    tp_aot_op(tp, f, code + 1656);
+L1660: /* MOVE */
+    regs[12] = regs[9];
+L1661: /* CALLP */
+    return code + 1661;
+L1662: /* NUMBER */
+    tp_aot_op(tp, f, code + 1662);
+L1665: /* ITER */
+    if (tp_iter_next(tp, &regs[4], regs[6], &regs[11])) {
+        goto L1667;
+    }
+L1666: /* JUMP */
+    goto L1683;
+L1667: /* VAR */
+L1669: /* MOVE */
+    regs[12] = regs[4];
+L1670: /* LINE */
+    f->line = code + 1670;
+    f->lineno = 214;
+L1679: /* GET */
+    regs[13] = tp_get(tp, regs[9], regs[12]);
+    tp_grey(tp, regs[13]);
+L1680: /* GET */
+    regs[4] = tp_get(tp, regs[19], regs[13]);
+    tp_grey(tp, regs[4]);
+L1681: /* SET */
+    tp_set(tp, regs[9], regs[12], regs[4]);
+L1682: /* JUMP */
+    tp_aot_safepoint(tp, 17);
+    goto L1665;
+L1683: /* LINE */
+    f->line = code + 1683;
+    f->lineno = 215;
+L1708: /* GGET */
+    tp_aot_op(tp, f, code + 1708);
+L1713: /* STRING */
+    tp_aot_op(tp, f, code + 1713);
+L1717: /* METHOD */
+    tp_aot_op(tp, f, code + 1717);
+L1719: /* MOVE */
+    regs[15] = regs[9];
+L1720: /* GGET */
+    tp_aot_op(tp, f, code + 1720);
+L1724: /* CALLM */
+    return code + 1724;
+L1725: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L1727;
+    }
+L1726: /* JUMP */
+    goto L1736;
+L1727: /* NUMBER */
+    tp_aot_op(tp, f, code + 1727);
+L1730: /* GET */
+    regs[4] = tp_get(tp, regs[9], regs[6]);
+    tp_grey(tp, regs[4]);
+L1731: /* NUMBER */
+    tp_aot_op(tp, f, code + 1731);
+L1734: /* GET */
+    regs[6] = tp_get(tp, regs[9], regs[11]);
+    tp_grey(tp, regs[6]);
+L1735: /* EQ */
+    if (TP_BOTH(regs[4], regs[6], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[4].nint == regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 1735);
+    }
+L1736: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L1738;
+    }
+L1737: /* JUMP */
+    goto L1754;
+L1738: /* GGET */
+    tp_aot_op(tp, f, code + 1738);
+L1743: /* STRING */
+    tp_aot_op(tp, f, code + 1743);
+L1748: /* METHOD */
+    tp_aot_op(tp, f, code + 1748);
+L1750: /* MOVE */
+    regs[15] = regs[0];
+L1751: /* MOVE */
+    regs[16] = regs[10];
+L1752: /* CALLM */
+    return code + 1752;
+L1753: /* NOT */
+    regs[4] = tp_bool(!tp_true(tp, regs[6]));
+L1754: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L1756;
+    }
+L1755: /* JUMP */
+    tp_aot_safepoint(tp, 182);
+    goto L1573;
+L1756: /* LINE */
+    f->line = code + 1756;
+    f->lineno = 216;
+L1765: /* STRING */
+    tp_aot_op(tp, f, code + 1765);
+L1769: /* LIST */
+    tp_aot_op(tp, f, code + 1769);
+L1770: /* SET */
+    tp_set(tp, regs[0], regs[10], regs[4]);
+L1771: /* JUMP */
+    tp_aot_safepoint(tp, 198);
+    goto L1573;
+L1772: /* LINE */
+    f->line = code + 1772;
+    f->lineno = 217;
+L1777: /* RETURN */
+    return code + 1777;
+L1778: /* EOF */
+    return code + 1778;
+}
+
+static tpd_code * _tp_tinypy_compiler_regalloc_3635(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 34: goto L34;
+        case 37: goto L37;
+        case 38: goto L38;
+        case 39: goto L39;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 50: goto L50;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 70: goto L70;
+        case 75: goto L75;
+        case 78: goto L78;
+        case 79: goto L79;
+        case 80: goto L80;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 85: goto L85;
+        case 91: goto L91;
+        case 94: goto L94;
+        case 95: goto L95;
+        case 96: goto L96;
+        case 97: goto L97;
+        case 105: goto L105;
+        case 108: goto L108;
+        case 109: goto L109;
+        case 113: goto L113;
+        case 114: goto L114;
+        case 115: goto L115;
+        case 116: goto L116;
+        case 123: goto L123;
+        case 124: goto L124;
+        case 130: goto L130;
+        case 133: goto L133;
+        case 136: goto L136;
+        case 137: goto L137;
+        case 143: goto L143;
+        case 146: goto L146;
+        case 149: goto L149;
+        case 157: goto L157;
+        case 160: goto L160;
+        case 161: goto L161;
+        case 162: goto L162;
+        case 165: goto L165;
+        case 166: goto L166;
+        case 167: goto L167;
+        case 168: goto L168;
+        case 177: goto L177;
+        case 180: goto L180;
+        case 181: goto L181;
+        case 191: goto L191;
+        case 195: goto L195;
+        case 199: goto L199;
+        case 203: goto L203;
+        case 204: goto L204;
+        case 207: goto L207;
+        case 208: goto L208;
+        case 209: goto L209;
+        case 213: goto L213;
+        case 214: goto L214;
+        case 228: goto L228;
+        case 233: goto L233;
+        case 234: goto L234;
+        case 237: goto L237;
+        case 238: goto L238;
+        case 239: goto L239;
+        case 240: goto L240;
+        case 243: goto L243;
+        case 244: goto L244;
+        case 254: goto L254;
+        case 258: goto L258;
+        case 262: goto L262;
+        case 266: goto L266;
+        case 267: goto L267;
+        case 270: goto L270;
+        case 271: goto L271;
+        case 272: goto L272;
+        case 276: goto L276;
+        case 277: goto L277;
+        case 278: goto L278;
+        case 288: goto L288;
+        case 293: goto L293;
+        case 297: goto L297;
+        case 299: goto L299;
+        case 300: goto L300;
+        case 301: goto L301;
+        case 302: goto L302;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 219;
+L9: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[1];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L27: /* NAME */
+    f->name = regs[1];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 220;
+L34: /* NUMBER */
+    tp_aot_op(tp, f, code + 34);
+L37: /* ITER */
+    if (tp_iter_next(tp, &regs[1], regs[0], &regs[2])) {
+        goto L39;
+    }
+L38: /* JUMP */
+    goto L85;
+L39: /* VAR */
+L41: /* MOVE */
+    regs[3] = regs[1];
+L42: /* LINE */
+    f->line = code + 42;
+    f->lineno = 221;
+L50: /* NUMBER */
+    tp_aot_op(tp, f, code + 50);
+L53: /* GET */
+    regs[1] = tp_get(tp, regs[3], regs[4]);
+    tp_grey(tp, regs[1]);
+L54: /* STRING */
+    tp_aot_op(tp, f, code + 54);
+L57: /* EQ */
+    if (TP_BOTH(regs[1], regs[4], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[1].nint == regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 57);
+    }
+L58: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L60;
+    }
+L59: /* JUMP */
+    tp_aot_safepoint(tp, 22);
+    goto L37;
+L60: /* LINE */
+    f->line = code + 60;
+    f->lineno = 222;
+L70: /* GGET */
+    tp_aot_op(tp, f, code + 70);
+L75: /* NUMBER */
+    tp_aot_op(tp, f, code + 75);
+L78: /* GET */
+    regs[5] = tp_get(tp, regs[3], regs[6]);
+    tp_grey(tp, regs[5]);
+L79: /* CALLP */
+    return code + 79;
+L80: /* NUMBER */
+    tp_aot_op(tp, f, code + 80);
+L83: /* SET */
+    tp_set(tp, regs[3], regs[4], regs[1]);
+L84: /* JUMP */
+    tp_aot_safepoint(tp, 47);
+    goto L37;
+L85: /* LINE */
+    f->line = code + 85;
+    f->lineno = 223;
+L91: /* NUMBER */
+    tp_aot_op(tp, f, code + 91);
+L94: /* ITER */
+    if (tp_iter_next(tp, &regs[1], regs[0], &regs[2])) {
+        goto L96;
+    }
+L95: /* JUMP */
+    goto L278;
+L96: /* MOVE */
+    regs[3] = regs[1];
+L97: /* LINE */
+    f->line = code + 97;
+    f->lineno = 224;
+L105: /* NUMBER */
+    tp_aot_op(tp, f, code + 105);
+L108: /* GET */
+    regs[1] = tp_get(tp, regs[3], regs[4]);
+    tp_grey(tp, regs[1]);
+L109: /* STRING */
+    tp_aot_op(tp, f, code + 109);
+L113: /* NE */
+    if (TP_BOTH(regs[1], regs[4], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[1].nint != regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 113);
+    }
+L114: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L116;
+    }
+L115: /* JUMP */
+    goto L124;
+L116: /* LINE */
+    f->line = code + 116;
+    f->lineno = 225;
+L123: /* JUMP */
+    tp_aot_safepoint(tp, 29);
+    goto L94;
+L124: /* LINE */
+    f->line = code + 124;
+    f->lineno = 226;
+L130: /* VAR */
+L133: /* NUMBER */
+    tp_aot_op(tp, f, code + 133);
+L136: /* GET */
+    regs[1] = tp_get(tp, regs[3], regs[5]);
+    tp_grey(tp, regs[1]);
+L137: /* LINE */
+    f->line = code + 137;
+    f->lineno = 229;
+L143: /* VAR */
+L146: /* NUMBER */
+    tp_aot_op(tp, f, code + 146);
+L149: /* LINE */
+    f->line = code + 149;
+    f->lineno = 230;
+L157: /* GGET */
+    tp_aot_op(tp, f, code + 157);
+L160: /* MOVE */
+    regs[7] = regs[1];
+L161: /* CALLP */
+    return code + 161;
+L162: /* NUMBER */
+    tp_aot_op(tp, f, code + 162);
+L165: /* GT */
+    if (TP_BOTH(regs[5], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[5].nint > regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 165);
+    }
+L166: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L168;
+    }
+L167: /* JUMP */
+    goto L181;
+L168: /* LINE */
+    f->line = code + 168;
+    f->lineno = 231;
+L177: /* NUMBER */
+    tp_aot_op(tp, f, code + 177);
+L180: /* GET */
+    regs[4] = tp_get(tp, regs[1], regs[6]);
+    tp_grey(tp, regs[4]);
+L181: /* LINE */
+    f->line = code + 181;
+    f->lineno = 232;
+L191: /* GGET */
+    tp_aot_op(tp, f, code + 191);
+L195: /* GGET */
+    tp_aot_op(tp, f, code + 195);
+L199: /* STRING */
+    tp_aot_op(tp, f, code + 199);
+L203: /* GET */
+    regs[6] = tp_get(tp, regs[6], regs[7]);
+    tp_grey(tp, regs[6]);
+L204: /* NUMBER */
+    tp_aot_op(tp, f, code + 204);
+L207: /* GET */
+    regs[7] = tp_get(tp, regs[1], regs[8]);
+    tp_grey(tp, regs[7]);
+L208: /* ADD */
+    if (TP_BOTH(regs[6], regs[7], TP_NUMBER_INT)) {
+        regs[6] = tp_int(regs[6].nint + regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 208);
+    }
+L209: /* STRING */
+    tp_aot_op(tp, f, code + 209);
+L213: /* SET */
+    tp_set(tp, regs[5], regs[7], regs[6]);
+L214: /* LINE */
+    f->line = code + 214;
+    f->lineno = 233;
+L228: /* GGET */
+    tp_aot_op(tp, f, code + 228);
+L233: /* MOVE */
+    regs[7] = regs[0];
+L234: /* NUMBER */
+    tp_aot_op(tp, f, code + 234);
+L237: /* GET */
+    regs[8] = tp_get(tp, regs[1], regs[3]);
+    tp_grey(tp, regs[8]);
+L238: /* MOVE */
+    regs[9] = regs[4];
+L239: /* CALLP */
+    return code + 239;
+L240: /* NUMBER */
+    tp_aot_op(tp, f, code + 240);
+L243: /* SET */
+    tp_set(tp, regs[1], regs[6], regs[5]);
+L244: /* LINE */
+    f->line = code + 244;
+    f->lineno = 234;
+L254: /* GGET */
+    tp_aot_op(tp, f, code + 254);
+L258: /* GGET */
+    tp_aot_op(tp, f, code + 258);
+L262: /* STRING */
+    tp_aot_op(tp, f, code + 262);
+L266: /* GET */
+    regs[6] = tp_get(tp, regs[6], regs[7]);
+    tp_grey(tp, regs[6]);
+L267: /* NUMBER */
+    tp_aot_op(tp, f, code + 267);
+L270: /* GET */
+    regs[7] = tp_get(tp, regs[1], regs[8]);
+    tp_grey(tp, regs[7]);
+L271: /* ADD */
+    if (TP_BOTH(regs[6], regs[7], TP_NUMBER_INT)) {
+        regs[6] = tp_int(regs[6].nint + regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 271);
+    }
+L272: /* STRING */
+    tp_aot_op(tp, f, code + 272);
+L276: /* SET */
+    tp_set(tp, regs[5], regs[7], regs[6]);
+L277: /* JUMP */
+    tp_aot_safepoint(tp, 183);
+    goto L94;
+L278: /* LINE */
+    f->line = code + 278;
+    f->lineno = 235;
+L288: /* GGET */
+    tp_aot_op(tp, f, code + 288);
+L293: /* STRING */
+    tp_aot_op(tp, f, code + 293);
+L297: /* METHOD */
+    tp_aot_op(tp, f, code + 297);
+L299: /* MOVE */
+    regs[7] = regs[0];
+L300: /* CALLM */
+    return code + 300;
+L301: /* RETURN */
+    return code + 301;
+L302: /* EOF */
+    return code + 302;
+}
+
+static tpd_code * _tp_tinypy_compiler_regalloc_3961(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 38: goto L38;
+        case 43: goto L43;
+        case 47: goto L47;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 55: goto L55;
+        case 57: goto L57;
+        case 60: goto L60;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 66: goto L66;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 78: goto L78;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 85: goto L85;
+        case 96: goto L96;
+        case 101: goto L101;
+        case 105: goto L105;
+        case 107: goto L107;
+        case 108: goto L108;
+        case 109: goto L109;
+        case 110: goto L110;
+        case 111: goto L111;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 237;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 239;
+L38: /* GGET */
+    tp_aot_op(tp, f, code + 38);
+L43: /* STRING */
+    tp_aot_op(tp, f, code + 43);
+L47: /* METHOD */
+    tp_aot_op(tp, f, code + 47);
+L49: /* MOVE */
+    regs[4] = regs[0];
+L50: /* NUMBER */
+    tp_aot_op(tp, f, code + 50);
+L53: /* NONE */
+    regs[6] = tp_None;
+L54: /* CALLM */
+    return code + 54;
+L55: /* VAR */
+L57: /* VAR */
+L60: /* NUMBER */
+    tp_aot_op(tp, f, code + 60);
+L63: /* GET */
+    regs[2] = tp_get(tp, regs[1], regs[4]);
+    tp_grey(tp, regs[2]);
+L64: /* VAR */
+L66: /* NUMBER */
+    tp_aot_op(tp, f, code + 66);
+L69: /* GET */
+    regs[3] = tp_get(tp, regs[1], regs[5]);
+    tp_grey(tp, regs[3]);
+L70: /* LINE */
+    f->line = code + 70;
+    f->lineno = 240;
+L78: /* GGET */
+    tp_aot_op(tp, f, code + 78);
+L83: /* MOVE */
+    regs[5] = regs[2];
+L84: /* CALLP */
+    return code + 84;
+L85: /* LINE */
+    f->line = code + 85;
+    f->lineno = 241;
+L96: /* GGET */
+    tp_aot_op(tp, f, code + 96);
+L101: /* STRING */
+    tp_aot_op(tp, f, code + 101);
+L105: /* METHOD */
+    tp_aot_op(tp, f, code + 105);
+L107: /* MOVE */
+    regs[6] = regs[2];
+L108: /* LIST */
+    tp_aot_op(tp, f, code + 108);
+L109: /* CALLM */
+    return code + 109;
+L110: /* RETURN */
+    return code + 110;
+L111: /* EOF */
+    return code + 111;
+}
+
+static const tpd_aot _tp_tinypy_compiler_regalloc_aot[] = {
+    {0, _tp_tinypy_compiler_regalloc_0},
+    {162, _tp_tinypy_compiler_regalloc_162},
+    {564, _tp_tinypy_compiler_regalloc_564},
+    {762, _tp_tinypy_compiler_regalloc_762},
+    {1099, _tp_tinypy_compiler_regalloc_1099},
+    {1654, _tp_tinypy_compiler_regalloc_1654},
+    {1740, _tp_tinypy_compiler_regalloc_1740},
+    {1831, _tp_tinypy_compiler_regalloc_1831},
+    {3635, _tp_tinypy_compiler_regalloc_3635},
+    {3961, _tp_tinypy_compiler_regalloc_3961},
+};
+
+void tinypy_compiler_regalloc_init(TP) {
+    tp_aot_import(tp, "tinypy.compiler.regalloc", _tp_tinypy_compiler_regalloc_tpc, sizeof(_tp_tinypy_compiler_regalloc_tpc),
+        _tp_tinypy_compiler_regalloc_aot, 10);
+}
@@ -0,0 +1,241 @@
+from tinypy.compiler.boot import *
+from tinypy.compiler.opcodes import *
+import tinypy.compiler.peephole as peephole
+
+# A register allocator over the nodes of peephole.py, run after the
+# peephole pass. encode.py gives every local a register of its own for the
+# whole function and tmps the lowest free one; here every register is
+# renumbered by liveness, so values that are never live at the same time
+# share one, and the REGS of the function asks for fewer. The VM clears and
+# the GC scans fewer registers per call, and recursion goes deeper before
+# the stack runs out.
+#
+# Registers an instruction reads or sets as a run -- the arguments of a
+# call, the state of FOR, the method and receiver of METHOD, the operands
+# of DEF -- move together as a block, keeping their offsets. A register
+# read before it is set, such as a parameter, keeps its number: the VM put
+# the value there.
+
+# registers in and out, for -s of tpc.
+stats = {'before':0, 'after':0}
+
+def fields(n):
+    # the fields of n that hold registers.
+    if n[0] == 'fnc': return [1]
+    if n[0] != 'code': return []
+    i = n[1]
+    if i in [LIST, DICT, CALLP, CALLM, RANGE]:
+        if n[4] == 0: return [2]
+        return [2, 3]
+    if i in peephole.BINARY or i in [CALL, METHOD, ITER, IGET, SET, ASSERT]: return [2, 3, 4]
+    if i in peephole.UNARY or i in [FOR, DEL, UPDATE, GSET]: return [2, 3]
+    if i in peephole.LOADS or i in [IF, IFN, RETURN, RAISE, EOF, FILE, NAME, VAR]: return [2]
+    return []
+
+def writes(n):
+    # the registers n may set; peephole.kills are those it always sets.
+    r = peephole.kills(n)
+    if n[0] != 'code': return r
+    i, a, b, c = n[1], n[2], n[3], n[4]
+    if i == FOR: return [a, b, b + 2]
+    if i == ITER: return [a, c]
+    if i == IGET: return [a]
+    return r
+
+def runs(n):
+    # the runs of registers in n, as [first, count].
+    if n[0] == 'fnc': return [[n[1], 5]]
+    if n[0] != 'code': return []
+    i, a, b, c = n[1], n[2], n[3], n[4]
+    r = []
+    if i in [LIST, DICT, CALLP, CALLM, RANGE] and c > 0: r.append([b, c])
+    if i == RANGE: r.append([a, 3])
+    if i == CALL: r.append([c, 2])
+    if i == FOR: r.append([b, 3])
+    if i == METHOD: r.append([a, 2])
+    return r
+
+def liveness(nodes, tags):
+    # the registers live after each node. An exception may go to any
+    # handler of the function, so what those read is live everywhere.
+    handlers = []
+    for n in nodes:
+        if n[0] == 'setjmp':
+            handlers.append(tags[n[1]])
+    live_in, live_out = [], []
+    for n in nodes:
+        live_in.append({})
+        live_out.append({})
+    changed = True
+    while changed:
+        changed = False
+        for k in range(len(nodes) - 1, -1, -1):
+            out = live_out[k]
+            for s in peephole.successors(nodes, tags, k) + handlers:
+                if s < len(nodes):
+                    out.update(live_in[s])
+            n = nodes[k]
+            kl = peephole.kills(n)
+            inn = {}
+            for r in out:
+                if r not in kl:
+                    inn[r] = True
+            for r in peephole.uses(n):
+                inn[r] = True
+            if len(inn) != len(live_in[k]):
+                live_in[k] = inn
+                changed = True
+    return live_in, live_out
+
+def find(parent, r):
+    while parent[r] != r:
+        r = parent[r]
+    return r
+
+def edge(adj, r, s):
+    adj[r][s] = True
+    adj[s][r] = True
+
+def allocate(nodes, nregs, nparams):
+    # renumbers the registers of one function; returns how many it needs.
+    tags = peephole.index_tags(nodes)
+    live_in, live_out = liveness(nodes, tags)
+
+    # which registers may not share a number: one set and one live after.
+    # A MOVE leaves its source and target equal, so they may. Only the
+    # instructions of RETARGET read everything before they set a.
+    adj = {}
+    order = []
+    for n in nodes:
+        for r in peephole.uses(n) + writes(n):
+            if r not in adj:
+                adj[r] = {}
+                order.append(r)
+    prefer = {}
+    for r in adj:
+        prefer[r] = []
+    for k in range(len(nodes)):
+        n = nodes[k]
+        src = None
+        if peephole.is_code(n, MOVE):
+            src = n[3]
+            prefer[n[2]].append(src)
+            prefer[src].append(n[2])
+        w = writes(n)
+        for r in w:
+            for s in live_out[k]:
+                if s != r and s != src:
+                    edge(adj, r, s)
+            for s in w:
+                if s != r:
+                    edge(adj, r, s)
+            if n[0] != 'code' or n[1] not in peephole.RETARGET:
+                for s in peephole.uses(n):
+                    if s != r:
+                        edge(adj, r, s)
+
+    # the blocks: runs that overlap are one block.
+    parent = {}
+    for r in order:
+        parent[r] = r
+    for n in nodes:
+        for run in runs(n):
+            for r in range(run[0] + 1, run[0] + run[1]):
+                x, y = find(parent, run[0]), find(parent, r)
+                if x != y:
+                    parent[y] = x
+    blocks = {}
+    first = []
+    for r in order:
+        x = find(parent, r)
+        if x not in blocks:
+            blocks[x] = []
+            first.append(x)
+        blocks[x].append(r)
+
+    pinned = {}
+    if len(nodes):
+        for r in live_in[0]:
+            pinned[find(parent, r)] = True
+
+    new = {}
+    todo = []
+    for x in first:
+        if x in pinned: todo.append(x)
+    for x in first:
+        if x not in pinned: todo.append(x)
+    for x in todo:
+        block = blocks[x]
+        lo = block[0]
+        for r in block:
+            lo = min(lo, r)
+        if x in pinned:
+            bases = [lo]
+        else:
+            # a MOVE partner first, so the MOVE goes.
+            bases = []
+            for r in block:
+                for s in prefer[r]:
+                    if s in new and new[s] >= r - lo:
+                        bases.append(new[s] - (r - lo))
+            for base in range(0, 256):
+                bases.append(base)
+        for base in bases:
+            ok = True
+            for r in block:
+                v = base + r - lo
+                if v > 255:
+                    ok = False
+                    break
+                for s in adj[r]:
+                    if s in new and new[s] == v:
+                        ok = False
+                        break
+                if not ok:
+                    break
+            if ok:
+                break
+        for r in block:
+            new[r] = base + r - lo
+
+    size = max(2, nparams)
+    for r in new:
+        size = max(size, new[r] + 1)
+    if size > nregs:
+        # no better than encode.py; keep its numbers.
+        return nregs
+    for k in range(len(nodes)):
+        n = nodes[k]
+        if peephole.is_code(n, VAR) and n[2] not in new:
+            # names a register no instruction uses.
+            nodes[k] = ['dead']
+            continue
+        for f in fields(n):
+            n[f] = new[n[f]]
+        if peephole.is_code(n, MOVE) and n[2] == n[3] and not peephole.after_skip(nodes, k):
+            nodes[k] = ['dead']
+    return size
+
+def optimize(nodes):
+    for n in nodes:
+        if n[0] == 'fnc':
+            n[3] = optimize(n[3])
+    for n in nodes:
+        if n[0] != 'regs':
+            continue
+        item = n[1]
+        # a def stores its number of parameters after the preamble; see
+        # do_def.
+        nparams = 0
+        if len(item) > 4:
+            nparams = item[4]
+        stats['before'] += item[1]
+        item[1] = allocate(nodes, item[1], nparams)
+        stats['after'] += item[1]
+    return peephole.sweep(nodes)
+
+def regalloc(out):
+    # out are the items of encode.py; returns them with registers renumbered.
+    nodes, i = peephole.parse(out, 0, None)
+    nodes = optimize(nodes)
+    return peephole.unparse(nodes, [])
@@ -0,0 +1,7342 @@
+/* Generated from tinypy/compiler/tokenize.py with tpc -a. Do not modify. */
+#include <tinypy/tp.h>
+
+static unsigned char _tp_tinypy_compiler_tokenize_tpc[] = {
+0x2d,0x46,0x00,0x61,0x00,0x00,0x00,0x00,0x1f,0x09,0x00,0x01,0x66,0x72,0x6f,0x6d,
+0x20,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,
+0x2e,0x62,0x6f,0x6f,0x74,0x20,0x69,0x6d,0x70,0x6f,0x72,0x74,0x20,0x2a,0x00,0x00,
+0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,
+0x2e,0x70,0x79,0x00,0x22,0x00,0x00,0x00,0x0d,0x00,0x00,0x01,0x00,0x00,0x00,0x01,
+0x3f,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x0a,
+0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,0x5f,0x5f,0x00,0x00,0x0d,0x02,0x00,0x03,
+0x00,0x00,0x00,0x14,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2e,0x62,0x6f,0x6f,0x74,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x04,
+0x00,0x00,0x00,0x01,0x2a,0x00,0x00,0x00,0x37,0x00,0x01,0x03,0x0e,0x01,0x00,0x05,
+0x00,0x00,0x00,0x08,0x5f,0x5f,0x64,0x69,0x63,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,
+0x32,0x01,0x00,0x00,0x1f,0x04,0x00,0x03,0x63,0x6c,0x61,0x73,0x73,0x20,0x54,0x6f,
+0x6b,0x65,0x6e,0x3a,0x00,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0x33,0x00,0x00,0x03,
+0x2a,0x24,0x37,0x00,0x0d,0x01,0x00,0x06,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x0f,0x01,0x00,0x00,0x0e,0x02,0x00,0x07,0x00,0x00,0x00,0x07,
+0x73,0x65,0x74,0x6d,0x65,0x74,0x61,0x00,0x10,0x03,0x00,0x00,0x0e,0x04,0x00,0x08,
+0x00,0x00,0x00,0x06,0x6f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x37,0x01,0x02,0x03,
+0x33,0x00,0x00,0x04,0x2a,0x24,0x31,0x33,0x00,0x00,0x00,0x00,0x1c,0x01,0x00,0x00,
+0x1c,0x02,0x00,0x00,0x1d,0x03,0x00,0x00,0x1d,0x04,0x00,0x00,0x11,0x00,0x02,0xaa,
+0x2d,0x0d,0x00,0x0e,0x00,0x00,0x00,0x00,0x1f,0x04,0x00,0x03,0x63,0x6c,0x61,0x73,
+0x73,0x20,0x54,0x6f,0x6b,0x65,0x6e,0x3a,0x00,0x00,0x00,0x00,0x1f,0x11,0x00,0x04,
+0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,
+0x28,0x73,0x65,0x6c,0x66,0x2c,0x70,0x6f,0x73,0x3d,0x28,0x30,0x2c,0x30,0x29,0x2c,
+0x74,0x79,0x70,0x65,0x3d,0x27,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x27,0x2c,0x76,0x61,
+0x6c,0x3d,0x4e,0x6f,0x6e,0x65,0x2c,0x69,0x74,0x65,0x6d,0x73,0x3d,0x4e,0x6f,0x6e,
+0x65,0x29,0x3a,0x00,0x33,0x00,0x00,0x03,0x2a,0x24,0x30,0x00,0x0d,0x05,0x00,0x00,
+0x00,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x01,
+0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x0d,0x07,0x00,0x02,0x00,0x00,0x00,0x04,
+0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x0d,0x08,0x00,0x03,0x00,0x00,0x00,0x03,
+0x76,0x61,0x6c,0x00,0x0d,0x09,0x00,0x04,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x1c,0x01,0x05,0x05,0x0c,0x09,0x00,0x05,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0c,0x0a,0x00,0x05,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x1c,0x05,0x09,0x02,0x0d,0x06,0x00,0x06,0x00,0x00,0x00,0x06,0x73,0x79,0x6d,0x62,
+0x6f,0x6c,0x00,0x00,0x1d,0x07,0x00,0x00,0x1d,0x08,0x00,0x00,0x1c,0x02,0x05,0x04,
+0x1d,0x03,0x00,0x00,0x1d,0x04,0x00,0x00,0x11,0x00,0x00,0x58,0x2d,0x07,0x00,0x06,
+0x00,0x00,0x00,0x00,0x1f,0x11,0x00,0x04,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,
+0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,0x28,0x73,0x65,0x6c,0x66,0x2c,0x70,0x6f,
+0x73,0x3d,0x28,0x30,0x2c,0x30,0x29,0x2c,0x74,0x79,0x70,0x65,0x3d,0x27,0x73,0x79,
+0x6d,0x62,0x6f,0x6c,0x27,0x2c,0x76,0x61,0x6c,0x3d,0x4e,0x6f,0x6e,0x65,0x2c,0x69,
+0x74,0x65,0x6d,0x73,0x3d,0x4e,0x6f,0x6e,0x65,0x29,0x3a,0x00,0x33,0x00,0x00,0x04,
+0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x03,0x70,0x6f,0x73,0x00,
+0x33,0x02,0x00,0x04,0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x33,0x03,0x00,0x03,
+0x76,0x61,0x6c,0x00,0x33,0x04,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x0d,0x05,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,
+0x2e,0x70,0x79,0x00,0x22,0x05,0x00,0x00,0x0d,0x05,0x00,0x01,0x00,0x00,0x00,0x08,
+0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,0x23,0x05,0x00,0x00,
+0x1f,0x11,0x00,0x05,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,
+0x2e,0x70,0x6f,0x73,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x74,0x79,0x70,0x65,0x2c,0x73,
+0x65,0x6c,0x66,0x2e,0x76,0x61,0x6c,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x69,0x74,0x65,
+0x6d,0x73,0x3d,0x70,0x6f,0x73,0x2c,0x74,0x79,0x70,0x65,0x2c,0x76,0x61,0x6c,0x2c,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x10,0x05,0x01,0x00,0x0d,0x01,0x00,0x02,
+0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,0x0b,0x00,0x01,0x05,0x0d,0x05,0x00,0x03,
+0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,0x00,0x00,0x00,0x00,0x0b,0x00,0x05,0x02,
+0x0d,0x05,0x00,0x04,0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x0b,0x00,0x05,0x03,
+0x0d,0x05,0x00,0x05,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,
+0x0b,0x00,0x05,0x04,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x08,0x5f,0x5f,0x69,0x6e,
+0x69,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,0x10,0x01,0x00,0x00,0x1f,0x06,0x00,0x07,
+0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x5f,0x66,0x6f,0x72,0x6d,0x61,0x74,0x28,
+0x73,0x65,0x6c,0x66,0x29,0x3a,0x00,0x00,0x33,0x02,0x00,0x04,0x2a,0x24,0x31,0x36,
+0x00,0x00,0x00,0x00,0x0d,0x07,0x00,0x00,0x00,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,
+0x00,0x00,0x00,0x00,0x1c,0x03,0x07,0x01,0x1c,0x04,0x00,0x00,0x1d,0x05,0x00,0x00,
+0x1d,0x06,0x00,0x00,0x11,0x02,0x00,0xab,0x2d,0x0a,0x00,0x0c,0x00,0x00,0x00,0x07,
+0x1f,0x06,0x00,0x07,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x5f,0x66,0x6f,0x72,
+0x6d,0x61,0x74,0x28,0x73,0x65,0x6c,0x66,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x04,
+0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x1b,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x2e,0x70,0x79,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x07,0x5f,0x66,0x6f,0x72,0x6d,0x61,0x74,0x00,
+0x23,0x01,0x00,0x00,0x1f,0x09,0x00,0x08,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x73,0x65,0x6c,0x66,0x2e,0x69,0x74,0x65,0x6d,0x73,0x20,0x69,0x73,
+0x20,0x6e,0x6f,0x74,0x20,0x4e,0x6f,0x6e,0x65,0x3a,0x00,0x00,0x0d,0x02,0x00,0x02,
+0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x01,0x00,0x02,
+0x00,0x00,0x00,0x00,0x1d,0x02,0x00,0x00,0x24,0x01,0x01,0x02,0x16,0x01,0x00,0x00,
+0x13,0x00,0x00,0x53,0x1f,0x18,0x00,0x09,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x72,0x28,0x73,
+0x65,0x6c,0x66,0x2e,0x74,0x79,0x70,0x65,0x29,0x20,0x2b,0x20,0x27,0x3a,0x5b,0x27,
+0x20,0x2b,0x20,0x27,0x2c,0x20,0x27,0x2e,0x6a,0x6f,0x69,0x6e,0x28,0x5b,0x69,0x2e,
+0x5f,0x66,0x6f,0x72,0x6d,0x61,0x74,0x28,0x29,0x20,0x66,0x6f,0x72,0x20,0x69,0x20,
+0x69,0x6e,0x20,0x73,0x65,0x6c,0x66,0x2e,0x69,0x74,0x65,0x6d,0x73,0x5d,0x29,0x20,
+0x2b,0x20,0x27,0x5d,0x27,0x00,0x00,0x00,0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x03,
+0x73,0x74,0x72,0x00,0x0d,0x04,0x00,0x04,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,
+0x00,0x00,0x00,0x00,0x09,0x03,0x00,0x04,0x00,0x00,0x00,0x01,0x37,0x01,0x02,0x02,
+0x0d,0x02,0x00,0x05,0x00,0x00,0x00,0x02,0x3a,0x5b,0x00,0x00,0x01,0x01,0x01,0x02,
+0x0d,0x05,0x00,0x06,0x00,0x00,0x00,0x02,0x2c,0x20,0x00,0x00,0x0d,0x02,0x00,0x07,
+0x00,0x00,0x00,0x04,0x6a,0x6f,0x69,0x6e,0x00,0x00,0x00,0x00,0x38,0x03,0x05,0x02,
+0x00,0x00,0x00,0x02,0x33,0x05,0x00,0x06,0x63,0x6f,0x6d,0x70,0x3a,0x34,0x00,0x00,
+0x1c,0x05,0x00,0x00,0x0d,0x06,0x00,0x02,0x00,0x00,0x00,0x05,0x69,0x74,0x65,0x6d,
+0x73,0x00,0x00,0x00,0x09,0x00,0x00,0x06,0x00,0x00,0x00,0x03,0x0c,0x06,0x00,0x08,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x02,0x00,0x06,0x13,0x00,0x00,0x0d,
+0x33,0x02,0x00,0x01,0x69,0x00,0x00,0x00,0x0d,0x07,0x00,0x01,0x00,0x00,0x00,0x07,
+0x5f,0x66,0x6f,0x72,0x6d,0x61,0x74,0x00,0x38,0x08,0x02,0x07,0x00,0x00,0x00,0x04,
+0x39,0x02,0x08,0x02,0x1d,0x08,0x00,0x00,0x0b,0x05,0x08,0x02,0x13,0x00,0xff,0xf3,
+0x39,0x02,0x03,0x03,0x01,0x01,0x01,0x02,0x0d,0x02,0x00,0x09,0x00,0x00,0x00,0x01,
+0x5d,0x00,0x00,0x00,0x01,0x01,0x01,0x02,0x15,0x01,0x00,0x00,0x1f,0x0e,0x00,0x0b,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x73,0x74,0x72,0x28,0x73,0x65,0x6c,0x66,0x2e,0x74,0x79,0x70,0x65,
+0x29,0x20,0x2b,0x20,0x27,0x3a,0x27,0x20,0x2b,0x20,0x73,0x74,0x72,0x28,0x73,0x65,
+0x6c,0x66,0x2e,0x76,0x61,0x6c,0x29,0x00,0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x03,
+0x73,0x74,0x72,0x00,0x0d,0x04,0x00,0x04,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,
+0x00,0x00,0x00,0x00,0x09,0x03,0x00,0x04,0x00,0x00,0x00,0x05,0x37,0x01,0x02,0x02,
+0x0d,0x02,0x00,0x0a,0x00,0x00,0x00,0x01,0x3a,0x00,0x00,0x00,0x01,0x01,0x01,0x02,
+0x0e,0x03,0x00,0x03,0x00,0x00,0x00,0x03,0x73,0x74,0x72,0x00,0x0d,0x05,0x00,0x0b,
+0x00,0x00,0x00,0x03,0x76,0x61,0x6c,0x00,0x09,0x04,0x00,0x05,0x00,0x00,0x00,0x06,
+0x37,0x02,0x03,0x02,0x01,0x01,0x01,0x02,0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+0x33,0x03,0x00,0x07,0x5f,0x66,0x6f,0x72,0x6d,0x61,0x74,0x00,0x10,0x03,0x02,0x00,
+0x1f,0x06,0x00,0x0c,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x5f,0x5f,0x72,0x65,
+0x70,0x72,0x5f,0x5f,0x28,0x73,0x65,0x6c,0x66,0x29,0x3a,0x00,0x33,0x04,0x00,0x04,
+0x2a,0x24,0x32,0x32,0x00,0x00,0x00,0x00,0x0d,0x09,0x00,0x00,0x00,0x00,0x00,0x04,
+0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,0x1c,0x05,0x09,0x01,0x1c,0x06,0x00,0x00,
+0x1d,0x07,0x00,0x00,0x1d,0x08,0x00,0x00,0x11,0x04,0x00,0x2f,0x2d,0x04,0x00,0x03,
+0x00,0x00,0x00,0x01,0x1f,0x06,0x00,0x0c,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,
+0x5f,0x5f,0x72,0x65,0x70,0x72,0x5f,0x5f,0x28,0x73,0x65,0x6c,0x66,0x29,0x3a,0x00,
+0x33,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x2e,0x70,0x79,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x08,0x5f,0x5f,0x72,0x65,
+0x70,0x72,0x5f,0x5f,0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x08,0x00,0x0d,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,
+0x65,0x6c,0x66,0x2e,0x5f,0x66,0x6f,0x72,0x6d,0x61,0x74,0x28,0x29,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x02,0x00,0x00,0x00,0x07,0x5f,0x66,0x6f,0x72,0x6d,0x61,0x74,0x00,
+0x38,0x02,0x00,0x01,0x00,0x00,0x00,0x00,0x39,0x01,0x02,0x02,0x15,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x33,0x05,0x00,0x08,0x5f,0x5f,0x72,0x65,0x70,0x72,0x5f,0x5f,
+0x00,0x00,0x00,0x00,0x10,0x05,0x04,0x00,0x1f,0x07,0x00,0x0f,0x20,0x20,0x20,0x20,
+0x64,0x65,0x66,0x20,0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x28,0x73,0x65,
+0x6c,0x66,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x06,0x00,0x04,0x2a,0x24,0x32,0x38,
+0x00,0x00,0x00,0x00,0x0d,0x0b,0x00,0x00,0x00,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,
+0x00,0x00,0x00,0x00,0x1c,0x07,0x0b,0x01,0x1c,0x08,0x00,0x00,0x1d,0x09,0x00,0x00,
+0x1d,0x0a,0x00,0x00,0x11,0x06,0x00,0x72,0x2d,0x08,0x00,0x09,0x00,0x00,0x00,0x05,
+0x1f,0x07,0x00,0x0f,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x61,0x73,0x5f,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x28,0x73,0x65,0x6c,0x66,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x2e,0x70,0x79,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x09,0x61,0x73,0x5f,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x09,0x00,0x10,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x73,0x65,0x6c,0x66,0x2e,
+0x74,0x79,0x70,0x65,0x20,0x3d,0x3d,0x20,0x27,0x73,0x74,0x72,0x69,0x6e,0x67,0x27,
+0x3a,0x00,0x00,0x00,0x0d,0x02,0x00,0x02,0x00,0x00,0x00,0x04,0x74,0x79,0x70,0x65,
+0x00,0x00,0x00,0x00,0x09,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x03,
+0x00,0x00,0x00,0x06,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x18,0x01,0x01,0x02,
+0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x09,0x1f,0x05,0x00,0x11,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x00,
+0x1d,0x01,0x00,0x00,0x26,0x01,0x00,0x00,0x1f,0x12,0x00,0x13,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x54,0x6f,0x6b,0x65,0x6e,
+0x28,0x73,0x65,0x6c,0x66,0x2e,0x70,0x6f,0x73,0x2c,0x20,0x27,0x73,0x74,0x72,0x69,
+0x6e,0x67,0x27,0x2c,0x20,0x73,0x65,0x6c,0x66,0x2e,0x76,0x61,0x6c,0x2e,0x65,0x6e,
+0x63,0x6f,0x64,0x65,0x28,0x29,0x2c,0x20,0x73,0x65,0x6c,0x66,0x2e,0x69,0x74,0x65,
+0x6d,0x73,0x29,0x00,0x0e,0x02,0x00,0x04,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x0d,0x06,0x00,0x05,0x00,0x00,0x00,0x03,0x70,0x6f,0x73,0x00,
+0x09,0x03,0x00,0x06,0x00,0x00,0x00,0x01,0x0d,0x04,0x00,0x03,0x00,0x00,0x00,0x06,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x0d,0x01,0x00,0x06,0x00,0x00,0x00,0x03,
+0x76,0x61,0x6c,0x00,0x09,0x05,0x00,0x01,0x00,0x00,0x00,0x02,0x0d,0x01,0x00,0x07,
+0x00,0x00,0x00,0x06,0x65,0x6e,0x63,0x6f,0x64,0x65,0x00,0x00,0x38,0x06,0x05,0x01,
+0x00,0x00,0x00,0x03,0x39,0x05,0x06,0x02,0x0d,0x06,0x00,0x08,0x00,0x00,0x00,0x05,
+0x69,0x74,0x65,0x6d,0x73,0x00,0x00,0x00,0x09,0x06,0x00,0x06,0x00,0x00,0x00,0x04,
+0x37,0x01,0x02,0x05,0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x07,0x00,0x09,
+0x61,0x73,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,0x10,0x07,0x06,0x00,
+0x1f,0x08,0x00,0x15,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x75,0x70,0x64,0x61,
+0x74,0x65,0x28,0x73,0x65,0x6c,0x66,0x2c,0x20,0x6f,0x74,0x68,0x65,0x72,0x29,0x3a,
+0x00,0x00,0x00,0x00,0x33,0x08,0x00,0x04,0x2a,0x24,0x33,0x34,0x00,0x00,0x00,0x00,
+0x0d,0x08,0x00,0x00,0x00,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,
+0x0d,0x09,0x00,0x07,0x00,0x00,0x00,0x05,0x6f,0x74,0x68,0x65,0x72,0x00,0x00,0x00,
+0x1c,0x09,0x08,0x02,0x1c,0x0a,0x00,0x00,0x1d,0x0b,0x00,0x00,0x1d,0x0c,0x00,0x00,
+0x11,0x08,0x00,0x3d,0x2d,0x05,0x00,0x03,0x00,0x00,0x00,0x00,0x1f,0x08,0x00,0x15,
+0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x28,0x73,
+0x65,0x6c,0x66,0x2c,0x20,0x6f,0x74,0x68,0x65,0x72,0x29,0x3a,0x00,0x00,0x00,0x00,
+0x33,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x05,
+0x6f,0x74,0x68,0x65,0x72,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x1b,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x2e,0x70,0x79,0x00,0x22,0x02,0x00,0x00,
+0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x06,0x75,0x70,0x64,0x61,0x74,0x65,0x00,0x00,
+0x23,0x02,0x00,0x00,0x1f,0x06,0x00,0x16,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x66,0x6f,0x72,0x20,0x6b,0x20,0x69,0x6e,0x20,0x6f,0x74,0x68,0x65,0x72,0x3a,0x00,
+0x0c,0x03,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x02,0x01,0x03,
+0x13,0x00,0x00,0x10,0x33,0x04,0x00,0x01,0x6b,0x00,0x00,0x00,0x10,0x04,0x02,0x00,
+0x1f,0x08,0x00,0x17,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x73,0x65,0x6c,0x66,0x5b,0x6b,0x5d,0x20,0x3d,0x20,0x6f,0x74,0x68,0x65,0x72,0x5b,
+0x6b,0x5d,0x00,0x00,0x0a,0x02,0x01,0x04,0x0b,0x00,0x04,0x02,0x13,0x00,0xff,0xf0,
+0x00,0x00,0x00,0x00,0x33,0x09,0x00,0x06,0x75,0x70,0x64,0x61,0x74,0x65,0x00,0x00,
+0x10,0x09,0x08,0x00,0x0e,0x0a,0x00,0x08,0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,
+0x6e,0x00,0x00,0x00,0x33,0x0a,0x00,0x04,0x2a,0x24,0x34,0x31,0x00,0x00,0x00,0x00,
+0x0d,0x0b,0x00,0x09,0x00,0x00,0x00,0x08,0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,
+0x00,0x00,0x00,0x00,0x0b,0x0a,0x0b,0x01,0x0d,0x0b,0x00,0x0a,0x00,0x00,0x00,0x07,
+0x5f,0x66,0x6f,0x72,0x6d,0x61,0x74,0x00,0x0b,0x0a,0x0b,0x03,0x0d,0x0b,0x00,0x0b,
+0x00,0x00,0x00,0x08,0x5f,0x5f,0x72,0x65,0x70,0x72,0x5f,0x5f,0x00,0x00,0x00,0x00,
+0x0b,0x0a,0x0b,0x05,0x0d,0x0b,0x00,0x0c,0x00,0x00,0x00,0x09,0x61,0x73,0x5f,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,0x0b,0x0a,0x0b,0x07,0x0d,0x0b,0x00,0x0d,
+0x00,0x00,0x00,0x06,0x75,0x70,0x64,0x61,0x74,0x65,0x00,0x00,0x0b,0x0a,0x0b,0x09,
+0x00,0x00,0x00,0x00,0x1d,0x02,0x00,0x00,0x1d,0x03,0x00,0x00,0x14,0x01,0x00,0x02,
+0x1f,0x06,0x00,0x19,0x64,0x65,0x66,0x20,0x75,0x5f,0x65,0x72,0x72,0x6f,0x72,0x28,
+0x63,0x74,0x78,0x2c,0x73,0x2c,0x69,0x29,0x3a,0x00,0x00,0x00,0x33,0x01,0x00,0x04,
+0x2a,0x24,0x32,0x31,0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x09,0x00,0x00,0x00,0x03,
+0x63,0x74,0x78,0x00,0x0d,0x07,0x00,0x0a,0x00,0x00,0x00,0x01,0x73,0x00,0x00,0x00,
+0x0d,0x08,0x00,0x0b,0x00,0x00,0x00,0x01,0x69,0x00,0x00,0x00,0x1c,0x02,0x06,0x03,
+0x1c,0x03,0x00,0x00,0x1d,0x04,0x00,0x00,0x1d,0x05,0x00,0x00,0x11,0x01,0x00,0xce,
+0x2d,0x0b,0x00,0x11,0x00,0x00,0x00,0x01,0x1f,0x06,0x00,0x19,0x64,0x65,0x66,0x20,
+0x75,0x5f,0x65,0x72,0x72,0x6f,0x72,0x28,0x63,0x74,0x78,0x2c,0x73,0x2c,0x69,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x03,0x63,0x74,0x78,0x00,0x33,0x01,0x00,0x01,
+0x73,0x00,0x00,0x00,0x33,0x02,0x00,0x01,0x69,0x00,0x00,0x00,0x0d,0x03,0x00,0x00,
+0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x2e,0x70,0x79,0x00,
+0x22,0x03,0x00,0x00,0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x07,0x75,0x5f,0x65,0x72,
+0x72,0x6f,0x72,0x00,0x23,0x03,0x00,0x00,0x1f,0x03,0x00,0x1a,0x20,0x20,0x20,0x20,
+0x79,0x2c,0x78,0x20,0x3d,0x20,0x69,0x00,0x33,0x02,0x00,0x02,0x2a,0x69,0x00,0x00,
+0x33,0x03,0x00,0x01,0x79,0x00,0x00,0x00,0x0c,0x04,0x00,0x02,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x03,0x02,0x04,0x33,0x0a,0x00,0x01,0x78,0x00,0x00,0x00,
+0x0c,0x05,0x00,0x03,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x0a,0x02,0x05,
+0x1f,0x08,0x00,0x1b,0x20,0x20,0x20,0x20,0x6c,0x69,0x6e,0x65,0x20,0x3d,0x20,0x73,
+0x2e,0x73,0x70,0x6c,0x69,0x74,0x28,0x27,0x5c,0x6e,0x27,0x29,0x5b,0x79,0x2d,0x31,
+0x5d,0x00,0x00,0x00,0x33,0x02,0x00,0x04,0x6c,0x69,0x6e,0x65,0x00,0x00,0x00,0x00,
+0x0d,0x08,0x00,0x04,0x00,0x00,0x00,0x05,0x73,0x70,0x6c,0x69,0x74,0x00,0x00,0x00,
+0x38,0x05,0x01,0x08,0x00,0x00,0x00,0x00,0x0d,0x07,0x00,0x05,0x00,0x00,0x00,0x01,
+0x0a,0x00,0x00,0x00,0x39,0x04,0x05,0x03,0x0c,0x06,0x00,0x03,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x02,0x05,0x03,0x06,0x0a,0x02,0x04,0x05,0x1f,0x03,0x00,0x1c,
+0x20,0x20,0x20,0x20,0x70,0x20,0x3d,0x20,0x27,0x27,0x00,0x00,0x33,0x04,0x00,0x01,
+0x70,0x00,0x00,0x00,0x0d,0x04,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x1f,0x06,0x00,0x1d,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x79,0x20,0x3c,0x20,0x31,
+0x30,0x3a,0x20,0x70,0x20,0x2b,0x3d,0x20,0x27,0x20,0x27,0x00,0x0c,0x06,0x00,0x07,
+0x00,0x00,0x69,0x04,0x0a,0x00,0x00,0x00,0x1a,0x05,0x03,0x06,0x16,0x05,0x00,0x00,
+0x13,0x00,0x00,0x05,0x0d,0x06,0x00,0x08,0x00,0x00,0x00,0x01,0x20,0x00,0x00,0x00,
+0x01,0x04,0x04,0x06,0x1f,0x07,0x00,0x1e,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x79,
+0x20,0x3c,0x20,0x31,0x30,0x30,0x3a,0x20,0x70,0x20,0x2b,0x3d,0x20,0x27,0x20,0x20,
+0x27,0x00,0x00,0x00,0x0c,0x06,0x00,0x09,0x00,0x00,0x69,0x04,0x64,0x00,0x00,0x00,
+0x1a,0x05,0x03,0x06,0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x05,0x0d,0x06,0x00,0x0a,
+0x00,0x00,0x00,0x02,0x20,0x20,0x00,0x00,0x01,0x04,0x04,0x06,0x1f,0x0a,0x00,0x1f,
+0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x70,0x20,0x2b,0x20,0x73,0x74,0x72,0x28,
+0x79,0x29,0x20,0x2b,0x20,0x22,0x3a,0x20,0x22,0x20,0x2b,0x20,0x6c,0x69,0x6e,0x65,
+0x20,0x2b,0x20,0x22,0x5c,0x6e,0x22,0x00,0x33,0x05,0x00,0x01,0x72,0x00,0x00,0x00,
+0x0e,0x08,0x00,0x0b,0x00,0x00,0x00,0x03,0x73,0x74,0x72,0x00,0x10,0x09,0x03,0x00,
+0x37,0x07,0x08,0x02,0x01,0x06,0x04,0x07,0x0d,0x07,0x00,0x0c,0x00,0x00,0x00,0x02,
+0x3a,0x20,0x00,0x00,0x01,0x06,0x06,0x07,0x01,0x06,0x06,0x02,0x0d,0x07,0x00,0x05,
+0x00,0x00,0x00,0x01,0x0a,0x00,0x00,0x00,0x01,0x05,0x06,0x07,0x1f,0x09,0x00,0x20,
+0x20,0x20,0x20,0x20,0x72,0x20,0x2b,0x3d,0x20,0x22,0x20,0x20,0x20,0x20,0x20,0x22,
+0x2b,0x22,0x20,0x22,0x2a,0x78,0x2b,0x22,0x5e,0x22,0x20,0x2b,0x27,0x5c,0x6e,0x27,
+0x00,0x00,0x00,0x00,0x0d,0x07,0x00,0x0d,0x00,0x00,0x00,0x05,0x20,0x20,0x20,0x20,
+0x20,0x00,0x00,0x00,0x0d,0x08,0x00,0x08,0x00,0x00,0x00,0x01,0x20,0x00,0x00,0x00,
+0x03,0x08,0x08,0x0a,0x01,0x07,0x07,0x08,0x0d,0x08,0x00,0x0e,0x00,0x00,0x00,0x01,
+0x5e,0x00,0x00,0x00,0x01,0x07,0x07,0x08,0x0d,0x08,0x00,0x05,0x00,0x00,0x00,0x01,
+0x0a,0x00,0x00,0x00,0x01,0x07,0x07,0x08,0x01,0x05,0x05,0x07,0x1f,0x0b,0x00,0x21,
+0x20,0x20,0x20,0x20,0x72,0x61,0x69,0x73,0x65,0x20,0x45,0x78,0x63,0x65,0x70,0x74,
+0x69,0x6f,0x6e,0x28,0x27,0x65,0x72,0x72,0x6f,0x72,0x3a,0x20,0x27,0x2b,0x63,0x74,
+0x78,0x2b,0x27,0x5c,0x6e,0x27,0x2b,0x72,0x29,0x00,0x00,0x00,0x0e,0x07,0x00,0x0f,
+0x00,0x00,0x00,0x09,0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x00,0x00,0x00,
+0x0d,0x08,0x00,0x10,0x00,0x00,0x00,0x07,0x65,0x72,0x72,0x6f,0x72,0x3a,0x20,0x00,
+0x01,0x08,0x08,0x00,0x0d,0x09,0x00,0x05,0x00,0x00,0x00,0x01,0x0a,0x00,0x00,0x00,
+0x01,0x08,0x08,0x09,0x01,0x08,0x08,0x05,0x37,0x06,0x07,0x02,0x26,0x06,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x0c,0x00,0x00,0x00,0x07,0x75,0x5f,0x65,0x72,
+0x72,0x6f,0x72,0x00,0x0f,0x02,0x01,0x00,0x1f,0x0b,0x00,0x23,0x49,0x53,0x59,0x4d,
+0x42,0x4f,0x4c,0x53,0x20,0x3d,0x20,0x27,0x60,0x2d,0x3d,0x5b,0x5d,0x3b,0x2c,0x2e,
+0x2f,0x7e,0x21,0x40,0x24,0x25,0x5e,0x26,0x2a,0x28,0x29,0x2b,0x7b,0x7d,0x3a,0x3c,
+0x3e,0x3f,0x7c,0x27,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x0d,0x00,0x00,0x00,0x08,
+0x49,0x53,0x59,0x4d,0x42,0x4f,0x4c,0x53,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x0e,
+0x00,0x00,0x00,0x1b,0x60,0x2d,0x3d,0x5b,0x5d,0x3b,0x2c,0x2e,0x2f,0x7e,0x21,0x40,
+0x24,0x25,0x5e,0x26,0x2a,0x28,0x29,0x2b,0x7b,0x7d,0x3a,0x3c,0x3e,0x3f,0x7c,0x00,
+0x0f,0x02,0x03,0x00,0x1f,0x03,0x00,0x24,0x53,0x59,0x4d,0x42,0x4f,0x4c,0x53,0x20,
+0x3d,0x20,0x5b,0x00,0x0d,0x02,0x00,0x0f,0x00,0x00,0x00,0x07,0x53,0x59,0x4d,0x42,
+0x4f,0x4c,0x53,0x00,0x1f,0x16,0x00,0x25,0x20,0x20,0x20,0x20,0x27,0x64,0x65,0x66,
+0x27,0x2c,0x27,0x63,0x6c,0x61,0x73,0x73,0x27,0x2c,0x27,0x79,0x69,0x65,0x6c,0x64,
+0x27,0x2c,0x27,0x72,0x65,0x74,0x75,0x72,0x6e,0x27,0x2c,0x27,0x70,0x61,0x73,0x73,
+0x27,0x2c,0x27,0x61,0x6e,0x64,0x27,0x2c,0x27,0x6f,0x72,0x27,0x2c,0x27,0x6e,0x6f,
+0x74,0x27,0x2c,0x27,0x69,0x6e,0x27,0x2c,0x27,0x61,0x73,0x27,0x2c,0x20,0x27,0x77,
+0x69,0x74,0x68,0x27,0x2c,0x20,0x27,0x69,0x6d,0x70,0x6f,0x72,0x74,0x27,0x2c,0x00,
+0x0d,0x04,0x00,0x10,0x00,0x00,0x00,0x03,0x64,0x65,0x66,0x00,0x0d,0x05,0x00,0x11,
+0x00,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x0d,0x06,0x00,0x12,
+0x00,0x00,0x00,0x05,0x79,0x69,0x65,0x6c,0x64,0x00,0x00,0x00,0x0d,0x07,0x00,0x13,
+0x00,0x00,0x00,0x06,0x72,0x65,0x74,0x75,0x72,0x6e,0x00,0x00,0x0d,0x08,0x00,0x14,
+0x00,0x00,0x00,0x04,0x70,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x0d,0x09,0x00,0x15,
+0x00,0x00,0x00,0x03,0x61,0x6e,0x64,0x00,0x0d,0x0a,0x00,0x16,0x00,0x00,0x00,0x02,
+0x6f,0x72,0x00,0x00,0x0d,0x0b,0x00,0x17,0x00,0x00,0x00,0x03,0x6e,0x6f,0x74,0x00,
+0x0d,0x0c,0x00,0x18,0x00,0x00,0x00,0x02,0x69,0x6e,0x00,0x00,0x0d,0x0d,0x00,0x19,
+0x00,0x00,0x00,0x02,0x61,0x73,0x00,0x00,0x0d,0x0e,0x00,0x1a,0x00,0x00,0x00,0x04,
+0x77,0x69,0x74,0x68,0x00,0x00,0x00,0x00,0x0d,0x0f,0x00,0x1b,0x00,0x00,0x00,0x06,
+0x69,0x6d,0x70,0x6f,0x72,0x74,0x00,0x00,0x1f,0x11,0x00,0x26,0x20,0x20,0x20,0x20,
+0x27,0x69,0x73,0x27,0x2c,0x27,0x77,0x68,0x69,0x6c,0x65,0x27,0x2c,0x27,0x62,0x72,
+0x65,0x61,0x6b,0x27,0x2c,0x27,0x66,0x6f,0x72,0x27,0x2c,0x27,0x63,0x6f,0x6e,0x74,
+0x69,0x6e,0x75,0x65,0x27,0x2c,0x27,0x69,0x66,0x27,0x2c,0x27,0x65,0x6c,0x73,0x65,
+0x27,0x2c,0x27,0x65,0x6c,0x69,0x66,0x27,0x2c,0x27,0x74,0x72,0x79,0x27,0x2c,0x00,
+0x0d,0x10,0x00,0x1c,0x00,0x00,0x00,0x02,0x69,0x73,0x00,0x00,0x0d,0x11,0x00,0x1d,
+0x00,0x00,0x00,0x05,0x77,0x68,0x69,0x6c,0x65,0x00,0x00,0x00,0x0d,0x12,0x00,0x1e,
+0x00,0x00,0x00,0x05,0x62,0x72,0x65,0x61,0x6b,0x00,0x00,0x00,0x0d,0x13,0x00,0x1f,
+0x00,0x00,0x00,0x03,0x66,0x6f,0x72,0x00,0x0d,0x14,0x00,0x20,0x00,0x00,0x00,0x08,
+0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x00,0x00,0x00,0x00,0x0d,0x15,0x00,0x21,
+0x00,0x00,0x00,0x02,0x69,0x66,0x00,0x00,0x0d,0x16,0x00,0x22,0x00,0x00,0x00,0x04,
+0x65,0x6c,0x73,0x65,0x00,0x00,0x00,0x00,0x0d,0x17,0x00,0x23,0x00,0x00,0x00,0x04,
+0x65,0x6c,0x69,0x66,0x00,0x00,0x00,0x00,0x0d,0x18,0x00,0x24,0x00,0x00,0x00,0x03,
+0x74,0x72,0x79,0x00,0x1f,0x13,0x00,0x27,0x20,0x20,0x20,0x20,0x27,0x65,0x78,0x63,
+0x65,0x70,0x74,0x27,0x2c,0x27,0x72,0x61,0x69,0x73,0x65,0x27,0x2c,0x27,0x61,0x73,
+0x73,0x65,0x72,0x74,0x27,0x2c,0x27,0x54,0x72,0x75,0x65,0x27,0x2c,0x27,0x46,0x61,
+0x6c,0x73,0x65,0x27,0x2c,0x27,0x4e,0x6f,0x6e,0x65,0x27,0x2c,0x27,0x67,0x6c,0x6f,
+0x62,0x61,0x6c,0x27,0x2c,0x27,0x64,0x65,0x6c,0x27,0x2c,0x27,0x66,0x72,0x6f,0x6d,
+0x27,0x2c,0x00,0x00,0x0d,0x19,0x00,0x25,0x00,0x00,0x00,0x06,0x65,0x78,0x63,0x65,
+0x70,0x74,0x00,0x00,0x0d,0x1a,0x00,0x26,0x00,0x00,0x00,0x05,0x72,0x61,0x69,0x73,
+0x65,0x00,0x00,0x00,0x0d,0x1b,0x00,0x27,0x00,0x00,0x00,0x06,0x61,0x73,0x73,0x65,
+0x72,0x74,0x00,0x00,0x0d,0x1c,0x00,0x28,0x00,0x00,0x00,0x04,0x54,0x72,0x75,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x1d,0x00,0x29,0x00,0x00,0x00,0x05,0x46,0x61,0x6c,0x73,
+0x65,0x00,0x00,0x00,0x0d,0x1e,0x00,0x2a,0x00,0x00,0x00,0x04,0x4e,0x6f,0x6e,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x1f,0x00,0x2b,0x00,0x00,0x00,0x06,0x67,0x6c,0x6f,0x62,
+0x61,0x6c,0x00,0x00,0x0d,0x20,0x00,0x2c,0x00,0x00,0x00,0x03,0x64,0x65,0x6c,0x00,
+0x0d,0x21,0x00,0x2d,0x00,0x00,0x00,0x04,0x66,0x72,0x6f,0x6d,0x00,0x00,0x00,0x00,
+0x1f,0x0a,0x00,0x28,0x20,0x20,0x20,0x20,0x27,0x2d,0x27,0x2c,0x27,0x2b,0x27,0x2c,
+0x27,0x2a,0x27,0x2c,0x27,0x2a,0x2a,0x27,0x2c,0x27,0x2f,0x27,0x2c,0x27,0x25,0x27,
+0x2c,0x27,0x3c,0x3c,0x27,0x2c,0x27,0x3e,0x3e,0x27,0x2c,0x00,0x0d,0x22,0x00,0x2e,
+0x00,0x00,0x00,0x01,0x2d,0x00,0x00,0x00,0x0d,0x23,0x00,0x2f,0x00,0x00,0x00,0x01,
+0x2b,0x00,0x00,0x00,0x0d,0x24,0x00,0x04,0x00,0x00,0x00,0x01,0x2a,0x00,0x00,0x00,
+0x0d,0x25,0x00,0x30,0x00,0x00,0x00,0x02,0x2a,0x2a,0x00,0x00,0x0d,0x26,0x00,0x31,
+0x00,0x00,0x00,0x01,0x2f,0x00,0x00,0x00,0x0d,0x27,0x00,0x32,0x00,0x00,0x00,0x01,
+0x25,0x00,0x00,0x00,0x0d,0x28,0x00,0x33,0x00,0x00,0x00,0x02,0x3c,0x3c,0x00,0x00,
+0x0d,0x29,0x00,0x34,0x00,0x00,0x00,0x02,0x3e,0x3e,0x00,0x00,0x1f,0x11,0x00,0x29,
+0x20,0x20,0x20,0x20,0x27,0x2d,0x3d,0x27,0x2c,0x27,0x2b,0x3d,0x27,0x2c,0x27,0x2a,
+0x3d,0x27,0x2c,0x27,0x2f,0x3d,0x27,0x2c,0x27,0x3d,0x27,0x2c,0x27,0x3d,0x3d,0x27,
+0x2c,0x27,0x21,0x3d,0x27,0x2c,0x27,0x3c,0x27,0x2c,0x27,0x3e,0x27,0x2c,0x20,0x27,
+0x7c,0x3d,0x27,0x2c,0x20,0x27,0x26,0x3d,0x27,0x2c,0x20,0x27,0x5e,0x3d,0x27,0x2c,
+0x00,0x00,0x00,0x00,0x0d,0x2a,0x00,0x35,0x00,0x00,0x00,0x02,0x2d,0x3d,0x00,0x00,
+0x0d,0x2b,0x00,0x36,0x00,0x00,0x00,0x02,0x2b,0x3d,0x00,0x00,0x0d,0x2c,0x00,0x37,
+0x00,0x00,0x00,0x02,0x2a,0x3d,0x00,0x00,0x0d,0x2d,0x00,0x38,0x00,0x00,0x00,0x02,
+0x2f,0x3d,0x00,0x00,0x0d,0x2e,0x00,0x39,0x00,0x00,0x00,0x01,0x3d,0x00,0x00,0x00,
+0x0d,0x2f,0x00,0x3a,0x00,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x0d,0x30,0x00,0x3b,
+0x00,0x00,0x00,0x02,0x21,0x3d,0x00,0x00,0x0d,0x31,0x00,0x3c,0x00,0x00,0x00,0x01,
+0x3c,0x00,0x00,0x00,0x0d,0x32,0x00,0x3d,0x00,0x00,0x00,0x01,0x3e,0x00,0x00,0x00,
+0x0d,0x33,0x00,0x3e,0x00,0x00,0x00,0x02,0x7c,0x3d,0x00,0x00,0x0d,0x34,0x00,0x3f,
+0x00,0x00,0x00,0x02,0x26,0x3d,0x00,0x00,0x0d,0x35,0x00,0x40,0x00,0x00,0x00,0x02,
+0x5e,0x3d,0x00,0x00,0x1f,0x12,0x00,0x2a,0x20,0x20,0x20,0x20,0x27,0x3c,0x3d,0x27,
+0x2c,0x27,0x3e,0x3d,0x27,0x2c,0x27,0x5b,0x27,0x2c,0x27,0x5d,0x27,0x2c,0x27,0x7b,
+0x27,0x2c,0x27,0x7d,0x27,0x2c,0x27,0x28,0x27,0x2c,0x27,0x29,0x27,0x2c,0x27,0x2e,
+0x27,0x2c,0x27,0x3a,0x27,0x2c,0x27,0x2c,0x27,0x2c,0x27,0x3b,0x27,0x2c,0x27,0x26,
+0x27,0x2c,0x27,0x7c,0x27,0x2c,0x27,0x21,0x27,0x2c,0x20,0x27,0x5e,0x27,0x00,0x00,
+0x0d,0x36,0x00,0x41,0x00,0x00,0x00,0x02,0x3c,0x3d,0x00,0x00,0x0d,0x37,0x00,0x42,
+0x00,0x00,0x00,0x02,0x3e,0x3d,0x00,0x00,0x0d,0x38,0x00,0x43,0x00,0x00,0x00,0x01,
+0x5b,0x00,0x00,0x00,0x0d,0x39,0x00,0x44,0x00,0x00,0x00,0x01,0x5d,0x00,0x00,0x00,
+0x0d,0x3a,0x00,0x45,0x00,0x00,0x00,0x01,0x7b,0x00,0x00,0x00,0x0d,0x3b,0x00,0x46,
+0x00,0x00,0x00,0x01,0x7d,0x00,0x00,0x00,0x0d,0x3c,0x00,0x47,0x00,0x00,0x00,0x01,
+0x28,0x00,0x00,0x00,0x0d,0x3d,0x00,0x48,0x00,0x00,0x00,0x01,0x29,0x00,0x00,0x00,
+0x0d,0x3e,0x00,0x49,0x00,0x00,0x00,0x01,0x2e,0x00,0x00,0x00,0x0d,0x3f,0x00,0x4a,
+0x00,0x00,0x00,0x01,0x3a,0x00,0x00,0x00,0x0d,0x40,0x00,0x4b,0x00,0x00,0x00,0x01,
+0x2c,0x00,0x00,0x00,0x0d,0x41,0x00,0x4c,0x00,0x00,0x00,0x01,0x3b,0x00,0x00,0x00,
+0x0d,0x42,0x00,0x4d,0x00,0x00,0x00,0x01,0x26,0x00,0x00,0x00,0x0d,0x43,0x00,0x4e,
+0x00,0x00,0x00,0x01,0x7c,0x00,0x00,0x00,0x0d,0x44,0x00,0x4f,0x00,0x00,0x00,0x01,
+0x21,0x00,0x00,0x00,0x0d,0x45,0x00,0x50,0x00,0x00,0x00,0x01,0x5e,0x00,0x00,0x00,
+0x1c,0x03,0x04,0x42,0x0f,0x02,0x03,0x00,0x1f,0x0b,0x00,0x2c,0x42,0x5f,0x42,0x45,
+0x47,0x49,0x4e,0x2c,0x42,0x5f,0x45,0x4e,0x44,0x20,0x3d,0x20,0x5b,0x27,0x5b,0x27,
+0x2c,0x27,0x28,0x27,0x2c,0x27,0x7b,0x27,0x5d,0x2c,0x5b,0x27,0x5d,0x27,0x2c,0x27,
+0x29,0x27,0x2c,0x27,0x7d,0x27,0x5d,0x00,0x0d,0x04,0x00,0x43,0x00,0x00,0x00,0x01,
+0x5b,0x00,0x00,0x00,0x0d,0x05,0x00,0x47,0x00,0x00,0x00,0x01,0x28,0x00,0x00,0x00,
+0x0d,0x06,0x00,0x45,0x00,0x00,0x00,0x01,0x7b,0x00,0x00,0x00,0x1c,0x02,0x04,0x03,
+0x0d,0x05,0x00,0x44,0x00,0x00,0x00,0x01,0x5d,0x00,0x00,0x00,0x0d,0x06,0x00,0x48,
+0x00,0x00,0x00,0x01,0x29,0x00,0x00,0x00,0x0d,0x07,0x00,0x46,0x00,0x00,0x00,0x01,
+0x7d,0x00,0x00,0x00,0x1c,0x03,0x05,0x03,0x0d,0x04,0x00,0x51,0x00,0x00,0x00,0x07,
+0x42,0x5f,0x42,0x45,0x47,0x49,0x4e,0x00,0x0f,0x04,0x02,0x00,0x0d,0x02,0x00,0x52,
+0x00,0x00,0x00,0x05,0x42,0x5f,0x45,0x4e,0x44,0x00,0x00,0x00,0x0f,0x02,0x03,0x00,
+0x1f,0x04,0x00,0x2e,0x63,0x6c,0x61,0x73,0x73,0x20,0x54,0x44,0x61,0x74,0x61,0x3a,
+0x00,0x00,0x00,0x00,0x34,0x02,0x00,0x00,0x33,0x02,0x00,0x05,0x2a,0x24,0x31,0x31,
+0x32,0x00,0x00,0x00,0x0d,0x03,0x00,0x53,0x00,0x00,0x00,0x05,0x54,0x44,0x61,0x74,
+0x61,0x00,0x00,0x00,0x0f,0x03,0x02,0x00,0x0e,0x04,0x00,0x07,0x00,0x00,0x00,0x07,
+0x73,0x65,0x74,0x6d,0x65,0x74,0x61,0x00,0x10,0x05,0x02,0x00,0x0e,0x06,0x00,0x08,
+0x00,0x00,0x00,0x06,0x6f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x37,0x03,0x04,0x03,
+0x33,0x02,0x00,0x05,0x2a,0x24,0x31,0x31,0x38,0x00,0x00,0x00,0x1c,0x03,0x00,0x00,
+0x1c,0x04,0x00,0x00,0x1d,0x05,0x00,0x00,0x1d,0x06,0x00,0x00,0x11,0x02,0x00,0xf7,
+0x2d,0x07,0x00,0x06,0x00,0x00,0x00,0x00,0x1f,0x04,0x00,0x2e,0x63,0x6c,0x61,0x73,
+0x73,0x20,0x54,0x44,0x61,0x74,0x61,0x3a,0x00,0x00,0x00,0x00,0x1f,0x06,0x00,0x2f,
+0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,
+0x28,0x73,0x65,0x6c,0x66,0x29,0x3a,0x00,0x33,0x00,0x00,0x03,0x2a,0x24,0x30,0x00,
+0x0d,0x05,0x00,0x00,0x00,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,
+0x1c,0x01,0x05,0x01,0x1c,0x02,0x00,0x00,0x1d,0x03,0x00,0x00,0x1d,0x04,0x00,0x00,
+0x11,0x00,0x00,0x63,0x2d,0x05,0x00,0x0a,0x00,0x00,0x00,0x00,0x1f,0x06,0x00,0x2f,
+0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,
+0x28,0x73,0x65,0x6c,0x66,0x29,0x3a,0x00,0x33,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,
+0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x74,0x6f,0x6b,0x65,
+0x6e,0x69,0x7a,0x65,0x2e,0x70,0x79,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,
+0x00,0x00,0x00,0x08,0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,
+0x23,0x01,0x00,0x00,0x1f,0x0b,0x00,0x30,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x73,0x65,0x6c,0x66,0x2e,0x79,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x79,0x69,0x2c,0x73,
+0x65,0x6c,0x66,0x2e,0x6e,0x6c,0x20,0x3d,0x20,0x31,0x2c,0x30,0x2c,0x54,0x72,0x75,
+0x65,0x00,0x00,0x00,0x0c,0x01,0x00,0x02,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x0c,0x02,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0c,0x03,0x00,0x02,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0d,0x04,0x00,0x04,0x00,0x00,0x00,0x01,
+0x79,0x00,0x00,0x00,0x0b,0x00,0x04,0x01,0x0d,0x01,0x00,0x05,0x00,0x00,0x00,0x02,
+0x79,0x69,0x00,0x00,0x0b,0x00,0x01,0x02,0x0d,0x01,0x00,0x06,0x00,0x00,0x00,0x02,
+0x6e,0x6c,0x00,0x00,0x0b,0x00,0x01,0x03,0x1f,0x0d,0x00,0x31,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,0x2e,0x72,0x65,0x73,0x2c,0x73,0x65,0x6c,
+0x66,0x2e,0x69,0x6e,0x64,0x65,0x6e,0x74,0x2c,0x73,0x65,0x6c,0x66,0x2e,0x62,0x72,
+0x61,0x63,0x65,0x73,0x20,0x3d,0x20,0x5b,0x5d,0x2c,0x5b,0x30,0x5d,0x2c,0x30,0x00,
+0x1c,0x01,0x00,0x00,0x0c,0x04,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x1c,0x02,0x04,0x01,0x0c,0x03,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x0d,0x04,0x00,0x07,0x00,0x00,0x00,0x03,0x72,0x65,0x73,0x00,0x0b,0x00,0x04,0x01,
+0x0d,0x01,0x00,0x08,0x00,0x00,0x00,0x06,0x69,0x6e,0x64,0x65,0x6e,0x74,0x00,0x00,
+0x0b,0x00,0x01,0x02,0x0d,0x01,0x00,0x09,0x00,0x00,0x00,0x06,0x62,0x72,0x61,0x63,
+0x65,0x73,0x00,0x00,0x0b,0x00,0x01,0x03,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x08,
+0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,0x10,0x01,0x00,0x00,
+0x1f,0x0f,0x00,0x32,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x61,0x64,0x64,0x28,
+0x73,0x65,0x6c,0x66,0x2c,0x74,0x2c,0x76,0x29,0x3a,0x20,0x73,0x65,0x6c,0x66,0x2e,
+0x72,0x65,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x54,0x6f,0x6b,0x65,0x6e,
+0x28,0x73,0x65,0x6c,0x66,0x2e,0x66,0x2c,0x74,0x2c,0x76,0x29,0x29,0x00,0x00,0x00,
+0x33,0x02,0x00,0x03,0x2a,0x24,0x36,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x04,
+0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x01,
+0x74,0x00,0x00,0x00,0x0d,0x04,0x00,0x02,0x00,0x00,0x00,0x01,0x76,0x00,0x00,0x00,
+0x1c,0x03,0x02,0x03,0x1c,0x04,0x00,0x00,0x1d,0x05,0x00,0x00,0x1d,0x06,0x00,0x00,
+0x11,0x02,0x00,0x41,0x2d,0x0a,0x00,0x06,0x00,0x00,0x00,0x03,0x1f,0x0f,0x00,0x32,
+0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x61,0x64,0x64,0x28,0x73,0x65,0x6c,0x66,
+0x2c,0x74,0x2c,0x76,0x29,0x3a,0x20,0x73,0x65,0x6c,0x66,0x2e,0x72,0x65,0x73,0x2e,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x54,0x6f,0x6b,0x65,0x6e,0x28,0x73,0x65,0x6c,
+0x66,0x2e,0x66,0x2c,0x74,0x2c,0x76,0x29,0x29,0x00,0x00,0x00,0x33,0x00,0x00,0x04,
+0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x74,0x00,0x00,0x00,
+0x33,0x02,0x00,0x01,0x76,0x00,0x00,0x00,0x0d,0x03,0x00,0x00,0x00,0x00,0x00,0x1b,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x2e,0x70,0x79,0x00,0x22,0x03,0x00,0x00,
+0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x03,0x61,0x64,0x64,0x00,0x23,0x03,0x00,0x00,
+0x0d,0x04,0x00,0x02,0x00,0x00,0x00,0x03,0x72,0x65,0x73,0x00,0x09,0x03,0x00,0x04,
+0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x03,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x07,0x03,0x04,0x00,0x00,0x00,0x01,0x0e,0x03,0x00,0x04,
+0x00,0x00,0x00,0x05,0x54,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x00,0x0d,0x04,0x00,0x05,
+0x00,0x00,0x00,0x01,0x66,0x00,0x00,0x00,0x09,0x04,0x00,0x04,0x00,0x00,0x00,0x02,
+0x10,0x05,0x01,0x00,0x10,0x06,0x02,0x00,0x37,0x09,0x03,0x04,0x39,0x03,0x07,0x03,
+0x00,0x00,0x00,0x00,0x33,0x03,0x00,0x03,0x61,0x64,0x64,0x00,0x10,0x03,0x02,0x00,
+0x0e,0x04,0x00,0x03,0x00,0x00,0x00,0x05,0x54,0x44,0x61,0x74,0x61,0x00,0x00,0x00,
+0x33,0x04,0x00,0x04,0x2a,0x24,0x31,0x34,0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x04,
+0x00,0x00,0x00,0x08,0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,
+0x0b,0x04,0x05,0x01,0x0d,0x05,0x00,0x05,0x00,0x00,0x00,0x03,0x61,0x64,0x64,0x00,
+0x0b,0x04,0x05,0x03,0x00,0x00,0x00,0x00,0x1d,0x04,0x00,0x00,0x1d,0x05,0x00,0x00,
+0x14,0x03,0x02,0x04,0x1f,0x04,0x00,0x34,0x64,0x65,0x66,0x20,0x63,0x6c,0x65,0x61,
+0x6e,0x28,0x73,0x29,0x3a,0x00,0x00,0x00,0x33,0x03,0x00,0x05,0x2a,0x24,0x31,0x32,
+0x36,0x00,0x00,0x00,0x0d,0x08,0x00,0x0a,0x00,0x00,0x00,0x01,0x73,0x00,0x00,0x00,
+0x1c,0x04,0x08,0x01,0x1c,0x05,0x00,0x00,0x1d,0x06,0x00,0x00,0x1d,0x07,0x00,0x00,
+0x11,0x03,0x00,0x4c,0x2d,0x06,0x00,0x06,0x00,0x00,0x00,0x02,0x1f,0x04,0x00,0x34,
+0x64,0x65,0x66,0x20,0x63,0x6c,0x65,0x61,0x6e,0x28,0x73,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x73,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x1b,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x2e,0x70,0x79,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x05,0x63,0x6c,0x65,0x61,0x6e,0x00,0x00,0x00,
+0x23,0x01,0x00,0x00,0x1f,0x08,0x00,0x35,0x20,0x20,0x20,0x20,0x73,0x20,0x3d,0x20,
+0x73,0x2e,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x28,0x27,0x5c,0x72,0x5c,0x6e,0x27,
+0x2c,0x27,0x5c,0x6e,0x27,0x29,0x00,0x00,0x0d,0x01,0x00,0x02,0x00,0x00,0x00,0x07,
+0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x00,0x38,0x02,0x00,0x01,0x00,0x00,0x00,0x00,
+0x0d,0x04,0x00,0x03,0x00,0x00,0x00,0x02,0x0d,0x0a,0x00,0x00,0x0d,0x05,0x00,0x04,
+0x00,0x00,0x00,0x01,0x0a,0x00,0x00,0x00,0x39,0x00,0x02,0x04,0x1f,0x08,0x00,0x36,
+0x20,0x20,0x20,0x20,0x73,0x20,0x3d,0x20,0x73,0x2e,0x72,0x65,0x70,0x6c,0x61,0x63,
+0x65,0x28,0x27,0x5c,0x72,0x27,0x2c,0x27,0x5c,0x6e,0x27,0x29,0x00,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x02,0x00,0x00,0x00,0x07,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x00,
+0x38,0x02,0x00,0x01,0x00,0x00,0x00,0x01,0x0d,0x04,0x00,0x05,0x00,0x00,0x00,0x01,
+0x0d,0x00,0x00,0x00,0x0d,0x05,0x00,0x04,0x00,0x00,0x00,0x01,0x0a,0x00,0x00,0x00,
+0x39,0x00,0x02,0x04,0x1f,0x04,0x00,0x37,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x73,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x04,0x00,0x54,0x00,0x00,0x00,0x05,0x63,0x6c,0x65,0x61,0x6e,0x00,0x00,0x00,
+0x0f,0x04,0x03,0x00,0x1f,0x05,0x00,0x39,0x64,0x65,0x66,0x20,0x74,0x6f,0x6b,0x65,
+0x6e,0x69,0x7a,0x65,0x28,0x73,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x04,0x00,0x05,
+0x2a,0x24,0x31,0x33,0x33,0x00,0x00,0x00,0x0d,0x09,0x00,0x0a,0x00,0x00,0x00,0x01,
+0x73,0x00,0x00,0x00,0x1c,0x05,0x09,0x01,0x1c,0x06,0x00,0x00,0x1d,0x07,0x00,0x00,
+0x1d,0x08,0x00,0x00,0x11,0x04,0x00,0x83,0x2d,0x08,0x00,0x0a,0x00,0x00,0x00,0x01,
+0x1f,0x05,0x00,0x39,0x64,0x65,0x66,0x20,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,
+0x28,0x73,0x29,0x3a,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x73,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,
+0x2e,0x70,0x79,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x08,
+0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,
+0x1f,0x04,0x00,0x3a,0x20,0x20,0x20,0x20,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x20,0x54,
+0x00,0x00,0x00,0x00,0x1f,0x05,0x00,0x3b,0x20,0x20,0x20,0x20,0x73,0x20,0x3d,0x20,
+0x63,0x6c,0x65,0x61,0x6e,0x28,0x73,0x29,0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x02,
+0x00,0x00,0x00,0x05,0x63,0x6c,0x65,0x61,0x6e,0x00,0x00,0x00,0x10,0x03,0x00,0x00,
+0x37,0x00,0x02,0x02,0x1f,0x08,0x00,0x3c,0x20,0x20,0x20,0x20,0x54,0x2c,0x69,0x2c,
+0x6c,0x20,0x3d,0x20,0x54,0x44,0x61,0x74,0x61,0x28,0x29,0x2c,0x30,0x2c,0x6c,0x65,
+0x6e,0x28,0x73,0x29,0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x03,0x00,0x00,0x00,0x05,
+0x54,0x44,0x61,0x74,0x61,0x00,0x00,0x00,0x37,0x01,0x03,0x01,0x0c,0x02,0x00,0x04,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0e,0x05,0x00,0x05,0x00,0x00,0x00,0x03,
+0x6c,0x65,0x6e,0x00,0x10,0x06,0x00,0x00,0x37,0x03,0x05,0x02,0x0d,0x04,0x00,0x06,
+0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,0x0f,0x04,0x01,0x00,0x33,0x01,0x00,0x01,
+0x69,0x00,0x00,0x00,0x10,0x01,0x02,0x00,0x33,0x02,0x00,0x01,0x6c,0x00,0x00,0x00,
+0x10,0x02,0x03,0x00,0x1f,0x03,0x00,0x3d,0x20,0x20,0x20,0x20,0x74,0x72,0x79,0x3a,
+0x00,0x00,0x00,0x00,0x27,0x00,0x00,0x15,0x1f,0x09,0x00,0x3e,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x64,0x6f,0x5f,0x74,0x6f,
+0x6b,0x65,0x6e,0x69,0x7a,0x65,0x28,0x73,0x2c,0x69,0x2c,0x6c,0x29,0x00,0x00,0x00,
+0x0e,0x04,0x00,0x07,0x00,0x00,0x00,0x0b,0x64,0x6f,0x5f,0x74,0x6f,0x6b,0x65,0x6e,
+0x69,0x7a,0x65,0x00,0x10,0x05,0x00,0x00,0x10,0x06,0x01,0x00,0x10,0x07,0x02,0x00,
+0x37,0x03,0x04,0x04,0x15,0x03,0x00,0x00,0x1f,0x09,0x00,0x40,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x75,0x5f,0x65,0x72,0x72,0x6f,0x72,0x28,0x27,0x74,0x6f,0x6b,
+0x65,0x6e,0x69,0x7a,0x65,0x27,0x2c,0x73,0x2c,0x54,0x2e,0x66,0x29,0x00,0x00,0x00,
+0x0e,0x04,0x00,0x08,0x00,0x00,0x00,0x07,0x75,0x5f,0x65,0x72,0x72,0x6f,0x72,0x00,
+0x0d,0x05,0x00,0x01,0x00,0x00,0x00,0x08,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,
+0x00,0x00,0x00,0x00,0x10,0x06,0x00,0x00,0x0e,0x07,0x00,0x06,0x00,0x00,0x00,0x01,
+0x54,0x00,0x00,0x00,0x0d,0x01,0x00,0x09,0x00,0x00,0x00,0x01,0x66,0x00,0x00,0x00,
+0x09,0x07,0x07,0x01,0x00,0x00,0x00,0x00,0x37,0x03,0x04,0x04,0x00,0x00,0x00,0x00,
+0x0d,0x05,0x00,0x55,0x00,0x00,0x00,0x08,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,
+0x00,0x00,0x00,0x00,0x0f,0x05,0x04,0x00,0x1f,0x06,0x00,0x42,0x64,0x65,0x66,0x20,
+0x64,0x6f,0x5f,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x28,0x73,0x2c,0x69,0x2c,
+0x6c,0x29,0x3a,0x00,0x33,0x05,0x00,0x05,0x2a,0x24,0x31,0x34,0x30,0x00,0x00,0x00,
+0x0d,0x0a,0x00,0x0a,0x00,0x00,0x00,0x01,0x73,0x00,0x00,0x00,0x0d,0x0b,0x00,0x0b,
+0x00,0x00,0x00,0x01,0x69,0x00,0x00,0x00,0x0d,0x0c,0x00,0x56,0x00,0x00,0x00,0x01,
+0x6c,0x00,0x00,0x00,0x1c,0x06,0x0a,0x03,0x1c,0x07,0x00,0x00,0x1d,0x08,0x00,0x00,
+0x1d,0x09,0x00,0x00,0x11,0x05,0x02,0x9c,0x2d,0x0a,0x00,0x25,0x00,0x00,0x00,0x08,
+0x1f,0x06,0x00,0x42,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x74,0x6f,0x6b,0x65,0x6e,
+0x69,0x7a,0x65,0x28,0x73,0x2c,0x69,0x2c,0x6c,0x29,0x3a,0x00,0x33,0x00,0x00,0x01,
+0x73,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x69,0x00,0x00,0x00,0x33,0x02,0x00,0x01,
+0x6c,0x00,0x00,0x00,0x0d,0x03,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x74,0x6f,0x6b,0x65,
+0x6e,0x69,0x7a,0x65,0x2e,0x70,0x79,0x00,0x22,0x03,0x00,0x00,0x0d,0x03,0x00,0x01,
+0x00,0x00,0x00,0x0b,0x64,0x6f,0x5f,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x00,
+0x23,0x03,0x00,0x00,0x1f,0x04,0x00,0x43,0x20,0x20,0x20,0x20,0x67,0x6c,0x6f,0x62,
+0x61,0x6c,0x20,0x54,0x00,0x00,0x00,0x00,0x1f,0x07,0x00,0x44,0x20,0x20,0x20,0x20,
+0x54,0x2e,0x66,0x20,0x3d,0x20,0x28,0x54,0x2e,0x79,0x2c,0x69,0x2d,0x54,0x2e,0x79,
+0x69,0x2b,0x31,0x29,0x00,0x00,0x00,0x00,0x0e,0x03,0x00,0x02,0x00,0x00,0x00,0x01,
+0x54,0x00,0x00,0x00,0x0e,0x04,0x00,0x02,0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,
+0x0d,0x06,0x00,0x03,0x00,0x00,0x00,0x01,0x79,0x00,0x00,0x00,0x09,0x04,0x04,0x06,
+0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x02,0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,
+0x0d,0x07,0x00,0x04,0x00,0x00,0x00,0x02,0x79,0x69,0x00,0x00,0x09,0x06,0x06,0x07,
+0x00,0x00,0x00,0x01,0x02,0x05,0x01,0x06,0x0c,0x06,0x00,0x05,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x01,0x05,0x05,0x06,0x1c,0x08,0x04,0x02,0x0d,0x04,0x00,0x06,
+0x00,0x00,0x00,0x01,0x66,0x00,0x00,0x00,0x0b,0x03,0x04,0x08,0x1f,0x05,0x00,0x45,
+0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x69,0x20,0x3c,0x20,0x6c,0x3a,
+0x00,0x00,0x00,0x00,0x1a,0x03,0x01,0x02,0x16,0x03,0x00,0x00,0x13,0x00,0x02,0x20,
+0x1f,0x0a,0x00,0x46,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,
+0x73,0x5b,0x69,0x5d,0x3b,0x20,0x54,0x2e,0x66,0x20,0x3d,0x20,0x28,0x54,0x2e,0x79,
+0x2c,0x69,0x2d,0x54,0x2e,0x79,0x69,0x2b,0x31,0x29,0x00,0x00,0x33,0x03,0x00,0x01,
+0x63,0x00,0x00,0x00,0x0a,0x03,0x00,0x01,0x0e,0x08,0x00,0x02,0x00,0x00,0x00,0x01,
+0x54,0x00,0x00,0x00,0x0e,0x05,0x00,0x02,0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,
+0x0d,0x07,0x00,0x03,0x00,0x00,0x00,0x01,0x79,0x00,0x00,0x00,0x09,0x05,0x05,0x07,
+0x00,0x00,0x00,0x02,0x0e,0x07,0x00,0x02,0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,
+0x0d,0x09,0x00,0x04,0x00,0x00,0x00,0x02,0x79,0x69,0x00,0x00,0x09,0x07,0x07,0x09,
+0x00,0x00,0x00,0x03,0x02,0x06,0x01,0x07,0x0c,0x07,0x00,0x05,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x01,0x06,0x06,0x07,0x1c,0x04,0x05,0x02,0x0d,0x05,0x00,0x06,
+0x00,0x00,0x00,0x01,0x66,0x00,0x00,0x00,0x0b,0x08,0x05,0x04,0x1f,0x0d,0x00,0x47,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x54,0x2e,0x6e,0x6c,0x3a,
+0x20,0x54,0x2e,0x6e,0x6c,0x20,0x3d,0x20,0x46,0x61,0x6c,0x73,0x65,0x3b,0x20,0x69,
+0x20,0x3d,0x20,0x64,0x6f,0x5f,0x69,0x6e,0x64,0x65,0x6e,0x74,0x28,0x73,0x2c,0x69,
+0x2c,0x6c,0x29,0x00,0x0e,0x08,0x00,0x02,0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,
+0x0d,0x04,0x00,0x07,0x00,0x00,0x00,0x02,0x6e,0x6c,0x00,0x00,0x09,0x08,0x08,0x04,
+0x00,0x00,0x00,0x04,0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x15,0x0e,0x08,0x00,0x02,
+0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,0x0c,0x04,0x00,0x08,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x07,0x00,0x00,0x00,0x02,0x6e,0x6c,0x00,0x00,
+0x0b,0x08,0x05,0x04,0x0e,0x04,0x00,0x09,0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x69,
+0x6e,0x64,0x65,0x6e,0x74,0x00,0x00,0x00,0x10,0x05,0x00,0x00,0x10,0x06,0x01,0x00,
+0x10,0x07,0x02,0x00,0x37,0x01,0x04,0x04,0x13,0x00,0xff,0xa7,0x1f,0x0b,0x00,0x48,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x63,0x20,0x3d,
+0x3d,0x20,0x27,0x5c,0x6e,0x27,0x3a,0x20,0x69,0x20,0x3d,0x20,0x64,0x6f,0x5f,0x6e,
+0x6c,0x28,0x73,0x2c,0x69,0x2c,0x6c,0x29,0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x0a,
+0x00,0x00,0x00,0x01,0x0a,0x00,0x00,0x00,0x18,0x08,0x03,0x04,0x16,0x08,0x00,0x00,
+0x13,0x00,0x00,0x0a,0x0e,0x04,0x00,0x0b,0x00,0x00,0x00,0x05,0x64,0x6f,0x5f,0x6e,
+0x6c,0x00,0x00,0x00,0x10,0x05,0x00,0x00,0x10,0x06,0x01,0x00,0x10,0x07,0x02,0x00,
+0x37,0x01,0x04,0x04,0x13,0x00,0xff,0x8c,0x1f,0x0d,0x00,0x49,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x63,0x20,0x69,0x6e,0x20,0x49,0x53,
+0x59,0x4d,0x42,0x4f,0x4c,0x53,0x3a,0x20,0x69,0x20,0x3d,0x20,0x64,0x6f,0x5f,0x73,
+0x79,0x6d,0x62,0x6f,0x6c,0x28,0x73,0x2c,0x69,0x2c,0x6c,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x04,0x00,0x0c,0x00,0x00,0x00,0x08,0x49,0x53,0x59,0x4d,0x42,0x4f,0x4c,0x53,
+0x00,0x00,0x00,0x00,0x25,0x08,0x03,0x04,0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x0b,
+0x0e,0x04,0x00,0x0d,0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x73,0x79,0x6d,0x62,0x6f,
+0x6c,0x00,0x00,0x00,0x10,0x05,0x00,0x00,0x10,0x06,0x01,0x00,0x10,0x07,0x02,0x00,
+0x37,0x01,0x04,0x04,0x13,0x00,0xff,0x6c,0x1f,0x0f,0x00,0x4a,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x63,0x20,0x3e,0x3d,0x20,0x27,0x30,
+0x27,0x20,0x61,0x6e,0x64,0x20,0x63,0x20,0x3c,0x3d,0x20,0x27,0x39,0x27,0x3a,0x20,
+0x69,0x20,0x3d,0x20,0x64,0x6f,0x5f,0x6e,0x75,0x6d,0x62,0x65,0x72,0x28,0x73,0x2c,
+0x69,0x2c,0x6c,0x29,0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x0e,0x00,0x00,0x00,0x01,
+0x30,0x00,0x00,0x00,0x35,0x08,0x03,0x04,0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x05,
+0x0d,0x04,0x00,0x0f,0x00,0x00,0x00,0x01,0x39,0x00,0x00,0x00,0x19,0x08,0x03,0x04,
+0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x0b,0x0e,0x04,0x00,0x10,0x00,0x00,0x00,0x09,
+0x64,0x6f,0x5f,0x6e,0x75,0x6d,0x62,0x65,0x72,0x00,0x00,0x00,0x10,0x05,0x00,0x00,
+0x10,0x06,0x01,0x00,0x10,0x07,0x02,0x00,0x37,0x01,0x04,0x04,0x13,0x00,0xff,0x46,
+0x1f,0x0f,0x00,0x4b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,
+0x20,0x63,0x20,0x69,0x6e,0x20,0x27,0x62,0x27,0x20,0x61,0x6e,0x64,0x20,0x28,0x73,
+0x5b,0x69,0x2b,0x31,0x5d,0x20,0x3d,0x3d,0x27,0x22,0x27,0x20,0x6f,0x72,0x20,0x73,
+0x5b,0x69,0x2b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x22,0x27,0x22,0x29,0x3a,0x00,0x00,
+0x0d,0x04,0x00,0x11,0x00,0x00,0x00,0x01,0x62,0x00,0x00,0x00,0x25,0x08,0x03,0x04,
+0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x15,0x0c,0x05,0x00,0x05,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x01,0x04,0x01,0x05,0x0a,0x08,0x00,0x04,0x0d,0x04,0x00,0x12,
+0x00,0x00,0x00,0x01,0x22,0x00,0x00,0x00,0x18,0x08,0x08,0x04,0x2f,0x08,0x00,0x00,
+0x13,0x00,0x00,0x0a,0x0c,0x05,0x00,0x05,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x01,0x04,0x01,0x05,0x0a,0x08,0x00,0x04,0x0d,0x04,0x00,0x13,0x00,0x00,0x00,0x01,
+0x27,0x00,0x00,0x00,0x18,0x08,0x08,0x04,0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x1f,
+0x1f,0x05,0x00,0x4c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x20,0x2b,0x3d,0x20,0x31,0x00,0x00,0x0c,0x04,0x00,0x05,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x04,0x1f,0x09,0x00,0x4d,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x20,0x3d,0x20,0x64,0x6f,0x5f,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x28,0x73,0x2c,0x69,0x2c,0x6c,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x04,0x00,0x14,0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x00,0x00,0x00,0x10,0x05,0x00,0x00,0x10,0x06,0x01,0x00,0x10,0x07,0x02,0x00,
+0x37,0x01,0x04,0x04,0x13,0x00,0xfe,0xfc,0x1f,0x0d,0x00,0x4e,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x63,0x3d,0x3d,0x27,0x22,0x27,0x20,
+0x6f,0x72,0x20,0x63,0x3d,0x3d,0x22,0x27,0x22,0x3a,0x20,0x69,0x20,0x3d,0x20,0x64,
+0x6f,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x28,0x73,0x2c,0x69,0x2c,0x6c,0x29,0x00,
+0x0d,0x04,0x00,0x12,0x00,0x00,0x00,0x01,0x22,0x00,0x00,0x00,0x18,0x08,0x03,0x04,
+0x2f,0x08,0x00,0x00,0x13,0x00,0x00,0x05,0x0d,0x04,0x00,0x13,0x00,0x00,0x00,0x01,
+0x27,0x00,0x00,0x00,0x18,0x08,0x03,0x04,0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x0b,
+0x0e,0x04,0x00,0x14,0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x00,0x00,0x00,0x10,0x05,0x00,0x00,0x10,0x06,0x01,0x00,0x10,0x07,0x02,0x00,
+0x37,0x01,0x04,0x04,0x13,0x00,0xfe,0xd8,0x1f,0x12,0x00,0x50,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x28,0x63,0x20,0x3e,0x3d,0x20,0x27,0x41,
+0x27,0x20,0x61,0x6e,0x64,0x20,0x63,0x20,0x3c,0x3d,0x20,0x27,0x5a,0x27,0x29,0x20,
+0x6f,0x72,0x20,0x63,0x20,0x3d,0x3d,0x20,0x27,0x5f,0x27,0x3a,0x20,0x20,0x69,0x20,
+0x3d,0x20,0x64,0x6f,0x5f,0x6e,0x61,0x6d,0x65,0x28,0x73,0x2c,0x69,0x2c,0x6c,0x29,
+0x00,0x00,0x00,0x00,0x1f,0x0b,0x00,0x4f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x65,0x6c,0x69,0x66,0x20,0x28,0x63,0x20,0x3e,0x3d,0x20,0x27,0x61,0x27,0x20,0x61,
+0x6e,0x64,0x20,0x63,0x20,0x3c,0x3d,0x20,0x27,0x7a,0x27,0x29,0x20,0x6f,0x72,0x20,
+0x5c,0x00,0x00,0x00,0x0d,0x04,0x00,0x15,0x00,0x00,0x00,0x01,0x61,0x00,0x00,0x00,
+0x35,0x08,0x03,0x04,0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x05,0x0d,0x04,0x00,0x16,
+0x00,0x00,0x00,0x01,0x7a,0x00,0x00,0x00,0x19,0x08,0x03,0x04,0x2f,0x08,0x00,0x00,
+0x13,0x00,0x00,0x1e,0x1f,0x12,0x00,0x50,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x28,0x63,0x20,0x3e,0x3d,0x20,0x27,0x41,0x27,0x20,0x61,0x6e,
+0x64,0x20,0x63,0x20,0x3c,0x3d,0x20,0x27,0x5a,0x27,0x29,0x20,0x6f,0x72,0x20,0x63,
+0x20,0x3d,0x3d,0x20,0x27,0x5f,0x27,0x3a,0x20,0x20,0x69,0x20,0x3d,0x20,0x64,0x6f,
+0x5f,0x6e,0x61,0x6d,0x65,0x28,0x73,0x2c,0x69,0x2c,0x6c,0x29,0x00,0x00,0x00,0x00,
+0x0d,0x04,0x00,0x17,0x00,0x00,0x00,0x01,0x41,0x00,0x00,0x00,0x35,0x08,0x03,0x04,
+0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x05,0x0d,0x04,0x00,0x18,0x00,0x00,0x00,0x01,
+0x5a,0x00,0x00,0x00,0x19,0x08,0x03,0x04,0x2f,0x08,0x00,0x00,0x13,0x00,0x00,0x05,
+0x0d,0x04,0x00,0x19,0x00,0x00,0x00,0x01,0x5f,0x00,0x00,0x00,0x18,0x08,0x03,0x04,
+0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x0a,0x0e,0x04,0x00,0x1a,0x00,0x00,0x00,0x07,
+0x64,0x6f,0x5f,0x6e,0x61,0x6d,0x65,0x00,0x10,0x05,0x00,0x00,0x10,0x06,0x01,0x00,
+0x10,0x07,0x02,0x00,0x37,0x01,0x04,0x04,0x13,0x00,0xfe,0x7f,0x1f,0x0b,0x00,0x51,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x63,0x3d,0x3d,
+0x27,0x23,0x27,0x3a,0x20,0x69,0x20,0x3d,0x20,0x64,0x6f,0x5f,0x63,0x6f,0x6d,0x6d,
+0x65,0x6e,0x74,0x28,0x73,0x2c,0x69,0x2c,0x6c,0x29,0x00,0x00,0x0d,0x04,0x00,0x1b,
+0x00,0x00,0x00,0x01,0x23,0x00,0x00,0x00,0x18,0x08,0x03,0x04,0x16,0x08,0x00,0x00,
+0x13,0x00,0x00,0x0b,0x0e,0x04,0x00,0x1c,0x00,0x00,0x00,0x0a,0x64,0x6f,0x5f,0x63,
+0x6f,0x6d,0x6d,0x65,0x6e,0x74,0x00,0x00,0x10,0x05,0x00,0x00,0x10,0x06,0x01,0x00,
+0x10,0x07,0x02,0x00,0x37,0x01,0x04,0x04,0x13,0x00,0xfe,0x63,0x1f,0x0b,0x00,0x52,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x63,0x20,0x3d,
+0x3d,0x20,0x27,0x5c,0x5c,0x27,0x20,0x61,0x6e,0x64,0x20,0x73,0x5b,0x69,0x2b,0x31,
+0x5d,0x20,0x3d,0x3d,0x20,0x27,0x5c,0x6e,0x27,0x3a,0x00,0x00,0x0d,0x04,0x00,0x1d,
+0x00,0x00,0x00,0x01,0x5c,0x00,0x00,0x00,0x18,0x08,0x03,0x04,0x16,0x08,0x00,0x00,
+0x13,0x00,0x00,0x0a,0x0c,0x05,0x00,0x05,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x01,0x04,0x01,0x05,0x0a,0x08,0x00,0x04,0x0d,0x04,0x00,0x0a,0x00,0x00,0x00,0x01,
+0x0a,0x00,0x00,0x00,0x18,0x08,0x08,0x04,0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x2c,
+0x1f,0x0a,0x00,0x53,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x20,0x2b,0x3d,0x20,0x32,0x3b,0x20,0x54,0x2e,0x79,0x2c,0x54,0x2e,0x79,0x69,
+0x20,0x3d,0x20,0x54,0x2e,0x79,0x2b,0x31,0x2c,0x69,0x00,0x00,0x0c,0x04,0x00,0x1e,
+0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x01,0x01,0x01,0x04,0x0e,0x04,0x00,0x02,
+0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,0x0d,0x05,0x00,0x03,0x00,0x00,0x00,0x01,
+0x79,0x00,0x00,0x00,0x09,0x04,0x04,0x05,0x00,0x00,0x00,0x05,0x0c,0x05,0x00,0x05,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x08,0x04,0x05,0x10,0x04,0x01,0x00,
+0x0e,0x05,0x00,0x02,0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,0x0d,0x06,0x00,0x03,
+0x00,0x00,0x00,0x01,0x79,0x00,0x00,0x00,0x0b,0x05,0x06,0x08,0x0e,0x08,0x00,0x02,
+0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,0x0d,0x05,0x00,0x04,0x00,0x00,0x00,0x02,
+0x79,0x69,0x00,0x00,0x0b,0x08,0x05,0x04,0x13,0x00,0xfe,0x1b,0x1f,0x0b,0x00,0x54,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x63,0x20,0x3d,
+0x3d,0x20,0x27,0x20,0x27,0x20,0x6f,0x72,0x20,0x63,0x20,0x3d,0x3d,0x20,0x27,0x5c,
+0x74,0x27,0x3a,0x20,0x69,0x20,0x2b,0x3d,0x20,0x31,0x00,0x00,0x0d,0x04,0x00,0x1f,
+0x00,0x00,0x00,0x01,0x20,0x00,0x00,0x00,0x18,0x08,0x03,0x04,0x2f,0x08,0x00,0x00,
+0x13,0x00,0x00,0x05,0x0d,0x04,0x00,0x20,0x00,0x00,0x00,0x01,0x09,0x00,0x00,0x00,
+0x18,0x08,0x03,0x04,0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x06,0x0c,0x04,0x00,0x05,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x04,0x13,0x00,0xfd,0xfe,
+0x1f,0x0a,0x00,0x55,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,
+0x3a,0x20,0x75,0x5f,0x65,0x72,0x72,0x6f,0x72,0x28,0x27,0x74,0x6f,0x6b,0x65,0x6e,
+0x69,0x7a,0x65,0x27,0x2c,0x73,0x2c,0x54,0x2e,0x66,0x29,0x00,0x0e,0x04,0x00,0x21,
+0x00,0x00,0x00,0x07,0x75,0x5f,0x65,0x72,0x72,0x6f,0x72,0x00,0x0d,0x05,0x00,0x22,
+0x00,0x00,0x00,0x08,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,
+0x10,0x06,0x00,0x00,0x0e,0x07,0x00,0x02,0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,
+0x0d,0x09,0x00,0x06,0x00,0x00,0x00,0x01,0x66,0x00,0x00,0x00,0x09,0x07,0x07,0x09,
+0x00,0x00,0x00,0x06,0x37,0x08,0x04,0x04,0x13,0x00,0xfd,0xdf,0x1f,0x04,0x00,0x56,
+0x20,0x20,0x20,0x20,0x69,0x6e,0x64,0x65,0x6e,0x74,0x28,0x30,0x29,0x00,0x00,0x00,
+0x0e,0x04,0x00,0x23,0x00,0x00,0x00,0x06,0x69,0x6e,0x64,0x65,0x6e,0x74,0x00,0x00,
+0x0c,0x05,0x00,0x08,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x37,0x08,0x04,0x02,
+0x1f,0x06,0x00,0x57,0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x54,0x2e,0x72,0x65,
+0x73,0x3b,0x20,0x54,0x20,0x3d,0x20,0x4e,0x6f,0x6e,0x65,0x00,0x33,0x08,0x00,0x01,
+0x72,0x00,0x00,0x00,0x0e,0x04,0x00,0x02,0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,
+0x0d,0x05,0x00,0x24,0x00,0x00,0x00,0x03,0x72,0x65,0x73,0x00,0x09,0x08,0x04,0x05,
+0x00,0x00,0x00,0x07,0x0d,0x04,0x00,0x02,0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,
+0x1d,0x05,0x00,0x00,0x0f,0x04,0x05,0x00,0x1f,0x04,0x00,0x5a,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,0x15,0x08,0x00,0x00,
+0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x57,0x00,0x00,0x00,0x0b,0x64,0x6f,0x5f,0x74,
+0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x00,0x0f,0x06,0x05,0x00,0x1f,0x05,0x00,0x5c,
+0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x6e,0x6c,0x28,0x73,0x2c,0x69,0x2c,0x6c,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x06,0x00,0x05,0x2a,0x24,0x31,0x34,0x39,0x00,0x00,0x00,
+0x0d,0x0b,0x00,0x0a,0x00,0x00,0x00,0x01,0x73,0x00,0x00,0x00,0x0d,0x0c,0x00,0x0b,
+0x00,0x00,0x00,0x01,0x69,0x00,0x00,0x00,0x0d,0x0d,0x00,0x56,0x00,0x00,0x00,0x01,
+0x6c,0x00,0x00,0x00,0x1c,0x07,0x0b,0x03,0x1c,0x08,0x00,0x00,0x1d,0x09,0x00,0x00,
+0x1d,0x0a,0x00,0x00,0x11,0x06,0x00,0x82,0x2d,0x06,0x00,0x09,0x00,0x00,0x00,0x03,
+0x1f,0x05,0x00,0x5c,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x6e,0x6c,0x28,0x73,0x2c,
+0x69,0x2c,0x6c,0x29,0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x73,0x00,0x00,0x00,
+0x33,0x01,0x00,0x01,0x69,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x2e,0x70,0x79,0x00,0x22,0x00,0x00,0x00,
+0x0d,0x00,0x00,0x01,0x00,0x00,0x00,0x05,0x64,0x6f,0x5f,0x6e,0x6c,0x00,0x00,0x00,
+0x23,0x00,0x00,0x00,0x1f,0x06,0x00,0x5d,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,
+0x6f,0x74,0x20,0x54,0x2e,0x62,0x72,0x61,0x63,0x65,0x73,0x3a,0x00,0x00,0x00,0x00,
+0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,0x0d,0x03,0x00,0x03,
+0x00,0x00,0x00,0x06,0x62,0x72,0x61,0x63,0x65,0x73,0x00,0x00,0x09,0x02,0x02,0x03,
+0x00,0x00,0x00,0x00,0x2f,0x02,0x00,0x00,0x13,0x00,0x00,0x16,0x1f,0x07,0x00,0x5e,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x54,0x2e,0x61,0x64,0x64,0x28,0x27,0x6e,
+0x6c,0x27,0x2c,0x4e,0x6f,0x6e,0x65,0x29,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x02,
+0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,0x0d,0x04,0x00,0x04,0x00,0x00,0x00,0x03,
+0x61,0x64,0x64,0x00,0x38,0x02,0x00,0x04,0x00,0x00,0x00,0x01,0x0d,0x04,0x00,0x05,
+0x00,0x00,0x00,0x02,0x6e,0x6c,0x00,0x00,0x1d,0x05,0x00,0x00,0x39,0x00,0x02,0x04,
+0x1f,0x06,0x00,0x5f,0x20,0x20,0x20,0x20,0x69,0x2c,0x54,0x2e,0x6e,0x6c,0x20,0x3d,
+0x20,0x69,0x2b,0x31,0x2c,0x54,0x72,0x75,0x65,0x00,0x00,0x00,0x0c,0x03,0x00,0x06,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x00,0x01,0x03,0x0c,0x02,0x00,0x06,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x10,0x01,0x00,0x00,0x0e,0x00,0x00,0x02,
+0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,0x0d,0x03,0x00,0x05,0x00,0x00,0x00,0x02,
+0x6e,0x6c,0x00,0x00,0x0b,0x00,0x03,0x02,0x1f,0x06,0x00,0x60,0x20,0x20,0x20,0x20,
+0x54,0x2e,0x79,0x2c,0x54,0x2e,0x79,0x69,0x20,0x3d,0x20,0x54,0x2e,0x79,0x2b,0x31,
+0x2c,0x69,0x00,0x00,0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x07,0x00,0x00,0x00,0x01,0x79,0x00,0x00,0x00,0x09,0x02,0x02,0x03,
+0x00,0x00,0x00,0x02,0x0c,0x03,0x00,0x06,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x01,0x00,0x02,0x03,0x10,0x02,0x01,0x00,0x0e,0x03,0x00,0x02,0x00,0x00,0x00,0x01,
+0x54,0x00,0x00,0x00,0x0d,0x04,0x00,0x07,0x00,0x00,0x00,0x01,0x79,0x00,0x00,0x00,
+0x0b,0x03,0x04,0x00,0x0e,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x08,0x00,0x00,0x00,0x02,0x79,0x69,0x00,0x00,0x0b,0x00,0x03,0x02,
+0x1f,0x04,0x00,0x61,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x69,
+0x00,0x00,0x00,0x00,0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x07,0x00,0x58,
+0x00,0x00,0x00,0x05,0x64,0x6f,0x5f,0x6e,0x6c,0x00,0x00,0x00,0x0f,0x07,0x06,0x00,
+0x1f,0x06,0x00,0x63,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x69,0x6e,0x64,0x65,0x6e,
+0x74,0x28,0x73,0x2c,0x69,0x2c,0x6c,0x29,0x3a,0x00,0x00,0x00,0x33,0x07,0x00,0x05,
+0x2a,0x24,0x31,0x35,0x38,0x00,0x00,0x00,0x0d,0x0c,0x00,0x0a,0x00,0x00,0x00,0x01,
+0x73,0x00,0x00,0x00,0x0d,0x0d,0x00,0x0b,0x00,0x00,0x00,0x01,0x69,0x00,0x00,0x00,
+0x0d,0x0e,0x00,0x56,0x00,0x00,0x00,0x01,0x6c,0x00,0x00,0x00,0x1c,0x08,0x0c,0x03,
+0x1c,0x09,0x00,0x00,0x1d,0x0a,0x00,0x00,0x1d,0x0b,0x00,0x00,0x11,0x07,0x00,0x99,
+0x2d,0x07,0x00,0x0b,0x00,0x00,0x00,0x01,0x1f,0x06,0x00,0x63,0x64,0x65,0x66,0x20,
+0x64,0x6f,0x5f,0x69,0x6e,0x64,0x65,0x6e,0x74,0x28,0x73,0x2c,0x69,0x2c,0x6c,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x73,0x00,0x00,0x00,0x33,0x01,0x00,0x01,
+0x69,0x00,0x00,0x00,0x33,0x02,0x00,0x01,0x6c,0x00,0x00,0x00,0x0d,0x03,0x00,0x00,
+0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x2e,0x70,0x79,0x00,
+0x22,0x03,0x00,0x00,0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x69,
+0x6e,0x64,0x65,0x6e,0x74,0x00,0x00,0x00,0x23,0x03,0x00,0x00,0x1f,0x03,0x00,0x64,
+0x20,0x20,0x20,0x20,0x76,0x20,0x3d,0x20,0x30,0x00,0x00,0x00,0x33,0x03,0x00,0x01,
+0x76,0x00,0x00,0x00,0x0c,0x03,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x1f,0x04,0x00,0x65,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x69,0x3c,
+0x6c,0x3a,0x00,0x00,0x1a,0x04,0x01,0x02,0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x34,
+0x1f,0x05,0x00,0x66,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,
+0x73,0x5b,0x69,0x5d,0x00,0x00,0x00,0x00,0x33,0x04,0x00,0x01,0x63,0x00,0x00,0x00,
+0x0a,0x04,0x00,0x01,0x1f,0x0b,0x00,0x67,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x63,0x20,0x21,0x3d,0x20,0x27,0x20,0x27,0x20,0x61,0x6e,0x64,0x20,
+0x63,0x20,0x21,0x3d,0x20,0x27,0x5c,0x74,0x27,0x3a,0x20,0x62,0x72,0x65,0x61,0x6b,
+0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x03,0x00,0x00,0x00,0x01,0x20,0x00,0x00,0x00,
+0x24,0x06,0x04,0x05,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x05,0x0d,0x05,0x00,0x04,
+0x00,0x00,0x00,0x01,0x09,0x00,0x00,0x00,0x24,0x06,0x04,0x05,0x2f,0x06,0x00,0x00,
+0x13,0x00,0x00,0x13,0x1f,0x06,0x00,0x68,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x2c,0x76,0x20,0x3d,0x20,0x69,0x2b,0x31,0x2c,0x76,0x2b,0x31,0x00,0x00,0x00,
+0x0c,0x06,0x00,0x05,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x06,0x01,0x06,
+0x0c,0x01,0x00,0x05,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x05,0x03,0x01,
+0x10,0x01,0x06,0x00,0x10,0x03,0x05,0x00,0x13,0x00,0xff,0xcb,0x1f,0x0f,0x00,0x69,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x63,0x20,0x21,0x3d,0x20,0x27,0x5c,0x6e,0x27,
+0x20,0x61,0x6e,0x64,0x20,0x63,0x20,0x21,0x3d,0x20,0x27,0x23,0x27,0x20,0x61,0x6e,
+0x64,0x20,0x6e,0x6f,0x74,0x20,0x54,0x2e,0x62,0x72,0x61,0x63,0x65,0x73,0x3a,0x20,
+0x69,0x6e,0x64,0x65,0x6e,0x74,0x28,0x76,0x29,0x00,0x00,0x00,0x0d,0x05,0x00,0x06,
+0x00,0x00,0x00,0x01,0x0a,0x00,0x00,0x00,0x24,0x06,0x04,0x05,0x16,0x06,0x00,0x00,
+0x13,0x00,0x00,0x05,0x0d,0x05,0x00,0x07,0x00,0x00,0x00,0x01,0x23,0x00,0x00,0x00,
+0x24,0x06,0x04,0x05,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x0b,0x0e,0x05,0x00,0x08,
+0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,0x0d,0x06,0x00,0x09,0x00,0x00,0x00,0x06,
+0x62,0x72,0x61,0x63,0x65,0x73,0x00,0x00,0x09,0x05,0x05,0x06,0x00,0x00,0x00,0x00,
+0x30,0x06,0x05,0x00,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x07,0x0e,0x05,0x00,0x0a,
+0x00,0x00,0x00,0x06,0x69,0x6e,0x64,0x65,0x6e,0x74,0x00,0x00,0x10,0x06,0x03,0x00,
+0x37,0x06,0x05,0x02,0x1f,0x04,0x00,0x6a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x69,0x00,0x00,0x00,0x00,0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x08,0x00,0x59,0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x69,0x6e,0x64,0x65,0x6e,
+0x74,0x00,0x00,0x00,0x0f,0x08,0x07,0x00,0x1f,0x04,0x00,0x6c,0x64,0x65,0x66,0x20,
+0x69,0x6e,0x64,0x65,0x6e,0x74,0x28,0x76,0x29,0x3a,0x00,0x00,0x33,0x08,0x00,0x05,
+0x2a,0x24,0x31,0x36,0x37,0x00,0x00,0x00,0x0d,0x0d,0x00,0x5a,0x00,0x00,0x00,0x01,
+0x76,0x00,0x00,0x00,0x1c,0x09,0x0d,0x01,0x1c,0x0a,0x00,0x00,0x1d,0x0b,0x00,0x00,
+0x1d,0x0c,0x00,0x00,0x11,0x08,0x00,0xfd,0x2d,0x07,0x00,0x0b,0x00,0x00,0x00,0x0c,
+0x1f,0x04,0x00,0x6c,0x64,0x65,0x66,0x20,0x69,0x6e,0x64,0x65,0x6e,0x74,0x28,0x76,
+0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x01,0x76,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,
+0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x72,0x2f,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x2e,0x70,0x79,0x00,
+0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x06,0x69,0x6e,0x64,0x65,
+0x6e,0x74,0x00,0x00,0x23,0x01,0x00,0x00,0x1f,0x08,0x00,0x6d,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x76,0x20,0x3d,0x3d,0x20,0x54,0x2e,0x69,0x6e,0x64,0x65,0x6e,0x74,
+0x5b,0x2d,0x31,0x5d,0x3a,0x20,0x70,0x61,0x73,0x73,0x00,0x00,0x0e,0x02,0x00,0x02,
+0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x06,
+0x69,0x6e,0x64,0x65,0x6e,0x74,0x00,0x00,0x09,0x02,0x02,0x03,0x00,0x00,0x00,0x00,
+0x0c,0x03,0x00,0x03,0x00,0x00,0x69,0x04,0xff,0xff,0xff,0xff,0x0a,0x02,0x02,0x03,
+0x18,0x01,0x00,0x02,0x2f,0x01,0x00,0x00,0x13,0x00,0x00,0xcb,0x1f,0x07,0x00,0x6e,
+0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x76,0x20,0x3e,0x20,0x54,0x2e,0x69,
+0x6e,0x64,0x65,0x6e,0x74,0x5b,0x2d,0x31,0x5d,0x3a,0x00,0x00,0x0e,0x02,0x00,0x02,
+0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x06,
+0x69,0x6e,0x64,0x65,0x6e,0x74,0x00,0x00,0x09,0x02,0x02,0x03,0x00,0x00,0x00,0x01,
+0x0c,0x03,0x00,0x03,0x00,0x00,0x69,0x04,0xff,0xff,0xff,0xff,0x0a,0x02,0x02,0x03,
+0x36,0x01,0x00,0x02,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x31,0x1f,0x07,0x00,0x6f,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x54,0x2e,0x69,0x6e,0x64,0x65,0x6e,0x74,
+0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x76,0x29,0x00,0x00,0x0e,0x05,0x00,0x02,
+0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,0x0d,0x06,0x00,0x01,0x00,0x00,0x00,0x06,
+0x69,0x6e,0x64,0x65,0x6e,0x74,0x00,0x00,0x09,0x05,0x05,0x06,0x00,0x00,0x00,0x02,
+0x0d,0x06,0x00,0x04,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x02,0x05,0x06,0x00,0x00,0x00,0x03,0x10,0x04,0x00,0x00,0x39,0x01,0x02,0x03,
+0x1f,0x07,0x00,0x70,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x54,0x2e,0x61,0x64,
+0x64,0x28,0x27,0x69,0x6e,0x64,0x65,0x6e,0x74,0x27,0x2c,0x76,0x29,0x00,0x00,0x00,
+0x0e,0x06,0x00,0x02,0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,0x0d,0x05,0x00,0x05,
+0x00,0x00,0x00,0x03,0x61,0x64,0x64,0x00,0x38,0x02,0x06,0x05,0x00,0x00,0x00,0x04,
+0x0d,0x04,0x00,0x01,0x00,0x00,0x00,0x06,0x69,0x6e,0x64,0x65,0x6e,0x74,0x00,0x00,
+0x10,0x05,0x00,0x00,0x39,0x01,0x02,0x04,0x13,0x00,0x00,0x83,0x1f,0x07,0x00,0x71,
+0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x76,0x20,0x3c,0x20,0x54,0x2e,0x69,
+0x6e,0x64,0x65,0x6e,0x74,0x5b,0x2d,0x31,0x5d,0x3a,0x00,0x00,0x0e,0x02,0x00,0x02,
+0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x06,
+0x69,0x6e,0x64,0x65,0x6e,0x74,0x00,0x00,0x09,0x02,0x02,0x03,0x00,0x00,0x00,0x05,
+0x0c,0x03,0x00,0x03,0x00,0x00,0x69,0x04,0xff,0xff,0xff,0xff,0x0a,0x02,0x02,0x03,
+0x1a,0x01,0x00,0x02,0x16,0x01,0x00,0x00,0x13,0x00,0x00,0x6b,0x1f,0x08,0x00,0x72,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x20,0x3d,0x20,0x54,0x2e,0x69,0x6e,
+0x64,0x65,0x6e,0x74,0x2e,0x69,0x6e,0x64,0x65,0x78,0x28,0x76,0x29,0x00,0x00,0x00,
+0x33,0x01,0x00,0x01,0x6e,0x00,0x00,0x00,0x0e,0x06,0x00,0x02,0x00,0x00,0x00,0x01,
+0x54,0x00,0x00,0x00,0x0d,0x05,0x00,0x01,0x00,0x00,0x00,0x06,0x69,0x6e,0x64,0x65,
+0x6e,0x74,0x00,0x00,0x09,0x06,0x06,0x05,0x00,0x00,0x00,0x06,0x0d,0x05,0x00,0x06,
+0x00,0x00,0x00,0x05,0x69,0x6e,0x64,0x65,0x78,0x00,0x00,0x00,0x38,0x03,0x06,0x05,
+0x00,0x00,0x00,0x07,0x10,0x05,0x00,0x00,0x39,0x01,0x03,0x03,0x1f,0x09,0x00,0x73,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x6c,0x65,
+0x6e,0x28,0x54,0x2e,0x69,0x6e,0x64,0x65,0x6e,0x74,0x29,0x20,0x3e,0x20,0x6e,0x2b,
+0x31,0x3a,0x00,0x00,0x0e,0x03,0x00,0x07,0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,
+0x0e,0x04,0x00,0x02,0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,0x0d,0x05,0x00,0x01,
+0x00,0x00,0x00,0x06,0x69,0x6e,0x64,0x65,0x6e,0x74,0x00,0x00,0x09,0x04,0x04,0x05,
+0x00,0x00,0x00,0x08,0x37,0x02,0x03,0x02,0x0c,0x04,0x00,0x08,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x01,0x03,0x01,0x04,0x36,0x02,0x02,0x03,0x16,0x02,0x00,0x00,
+0x13,0x00,0x00,0x31,0x1f,0x08,0x00,0x74,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x76,0x20,0x3d,0x20,0x54,0x2e,0x69,0x6e,0x64,0x65,0x6e,0x74,
+0x2e,0x70,0x6f,0x70,0x28,0x29,0x00,0x00,0x0e,0x05,0x00,0x02,0x00,0x00,0x00,0x01,
+0x54,0x00,0x00,0x00,0x0d,0x06,0x00,0x01,0x00,0x00,0x00,0x06,0x69,0x6e,0x64,0x65,
+0x6e,0x74,0x00,0x00,0x09,0x05,0x05,0x06,0x00,0x00,0x00,0x09,0x0d,0x06,0x00,0x09,
+0x00,0x00,0x00,0x03,0x70,0x6f,0x70,0x00,0x38,0x03,0x05,0x06,0x00,0x00,0x00,0x0a,
+0x39,0x00,0x03,0x02,0x1f,0x08,0x00,0x75,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x54,0x2e,0x61,0x64,0x64,0x28,0x27,0x64,0x65,0x64,0x65,0x6e,
+0x74,0x27,0x2c,0x76,0x29,0x00,0x00,0x00,0x0e,0x05,0x00,0x02,0x00,0x00,0x00,0x01,
+0x54,0x00,0x00,0x00,0x0d,0x02,0x00,0x05,0x00,0x00,0x00,0x03,0x61,0x64,0x64,0x00,
+0x38,0x03,0x05,0x02,0x00,0x00,0x00,0x0b,0x0d,0x05,0x00,0x0a,0x00,0x00,0x00,0x06,
+0x64,0x65,0x64,0x65,0x6e,0x74,0x00,0x00,0x10,0x06,0x00,0x00,0x39,0x02,0x03,0x04,
+0x13,0x00,0xff,0xbd,0x00,0x00,0x00,0x00,0x0d,0x09,0x00,0x5b,0x00,0x00,0x00,0x06,
+0x69,0x6e,0x64,0x65,0x6e,0x74,0x00,0x00,0x0f,0x09,0x08,0x00,0x1f,0x06,0x00,0x77,
+0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x28,0x73,0x2c,
+0x69,0x2c,0x6c,0x29,0x3a,0x00,0x00,0x00,0x33,0x09,0x00,0x05,0x2a,0x24,0x31,0x37,
+0x34,0x00,0x00,0x00,0x0d,0x0e,0x00,0x0a,0x00,0x00,0x00,0x01,0x73,0x00,0x00,0x00,
+0x0d,0x0f,0x00,0x0b,0x00,0x00,0x00,0x01,0x69,0x00,0x00,0x00,0x0d,0x10,0x00,0x56,
+0x00,0x00,0x00,0x01,0x6c,0x00,0x00,0x00,0x1c,0x0a,0x0e,0x03,0x1c,0x0b,0x00,0x00,
+0x1d,0x0c,0x00,0x00,0x1d,0x0d,0x00,0x00,0x11,0x09,0x01,0x26,0x2d,0x0b,0x00,0x0e,
+0x00,0x00,0x00,0x06,0x1f,0x06,0x00,0x77,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x73,
+0x79,0x6d,0x62,0x6f,0x6c,0x28,0x73,0x2c,0x69,0x2c,0x6c,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x73,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x69,0x00,0x00,0x00,
+0x33,0x02,0x00,0x01,0x6c,0x00,0x00,0x00,0x0d,0x03,0x00,0x00,0x00,0x00,0x00,0x1b,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,
+0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,0x2e,0x70,0x79,0x00,0x22,0x03,0x00,0x00,
+0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x73,0x79,0x6d,0x62,0x6f,
+0x6c,0x00,0x00,0x00,0x23,0x03,0x00,0x00,0x1f,0x05,0x00,0x78,0x20,0x20,0x20,0x20,
+0x73,0x79,0x6d,0x62,0x6f,0x6c,0x73,0x20,0x3d,0x20,0x5b,0x5d,0x00,0x00,0x00,0x00,
+0x33,0x03,0x00,0x07,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x73,0x00,0x1c,0x03,0x00,0x00,
+0x1f,0x06,0x00,0x79,0x20,0x20,0x20,0x20,0x76,0x2c,0x66,0x2c,0x69,0x20,0x3d,0x20,
+0x73,0x5b,0x69,0x5d,0x2c,0x69,0x2c,0x69,0x2b,0x31,0x00,0x00,0x0a,0x04,0x00,0x01,
+0x10,0x05,0x01,0x00,0x0c,0x06,0x00,0x02,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x01,0x09,0x01,0x06,0x33,0x0a,0x00,0x01,0x76,0x00,0x00,0x00,0x10,0x0a,0x04,0x00,
+0x33,0x04,0x00,0x01,0x66,0x00,0x00,0x00,0x10,0x04,0x05,0x00,0x10,0x01,0x09,0x00,
+0x1f,0x0a,0x00,0x7a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x76,0x20,0x69,0x6e,0x20,
+0x53,0x59,0x4d,0x42,0x4f,0x4c,0x53,0x3a,0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x73,
+0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x76,0x29,0x00,0x00,0x0e,0x09,0x00,0x03,
+0x00,0x00,0x00,0x07,0x53,0x59,0x4d,0x42,0x4f,0x4c,0x53,0x00,0x25,0x05,0x0a,0x09,
+0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x09,0x0d,0x09,0x00,0x04,0x00,0x00,0x00,0x06,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x06,0x03,0x09,0x00,0x00,0x00,0x00,
+0x10,0x08,0x0a,0x00,0x39,0x05,0x06,0x03,0x1f,0x04,0x00,0x7b,0x20,0x20,0x20,0x20,
+0x77,0x68,0x69,0x6c,0x65,0x20,0x69,0x3c,0x6c,0x3a,0x00,0x00,0x1a,0x05,0x01,0x02,
+0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x46,0x1f,0x05,0x00,0x7c,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x5b,0x69,0x5d,0x00,0x00,0x00,0x00,
+0x33,0x05,0x00,0x01,0x63,0x00,0x00,0x00,0x0a,0x05,0x00,0x01,0x1f,0x09,0x00,0x7d,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,0x6f,0x74,0x20,0x63,
+0x20,0x69,0x6e,0x20,0x49,0x53,0x59,0x4d,0x42,0x4f,0x4c,0x53,0x3a,0x20,0x62,0x72,
+0x65,0x61,0x6b,0x00,0x0e,0x07,0x00,0x05,0x00,0x00,0x00,0x08,0x49,0x53,0x59,0x4d,
+0x42,0x4f,0x4c,0x53,0x00,0x00,0x00,0x00,0x25,0x06,0x05,0x07,0x16,0x06,0x00,0x00,
+0x13,0x00,0x00,0x2b,0x1f,0x06,0x00,0x7e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x76,0x2c,0x69,0x20,0x3d,0x20,0x76,0x2b,0x63,0x2c,0x69,0x2b,0x31,0x00,0x00,0x00,
+0x01,0x09,0x0a,0x05,0x0c,0x08,0x00,0x02,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x01,0x06,0x01,0x08,0x10,0x0a,0x09,0x00,0x10,0x01,0x06,0x00,0x1f,0x0b,0x00,0x7f,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x76,0x20,0x69,0x6e,0x20,
+0x53,0x59,0x4d,0x42,0x4f,0x4c,0x53,0x3a,0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x73,
+0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x76,0x29,0x00,0x00,0x0e,0x06,0x00,0x03,
+0x00,0x00,0x00,0x07,0x53,0x59,0x4d,0x42,0x4f,0x4c,0x53,0x00,0x25,0x09,0x0a,0x06,
+0x16,0x09,0x00,0x00,0x13,0x00,0xff,0xc2,0x0d,0x09,0x00,0x04,0x00,0x00,0x00,0x06,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x06,0x03,0x09,0x00,0x00,0x00,0x01,
+0x10,0x08,0x0a,0x00,0x39,0x09,0x06,0x03,0x13,0x00,0xff,0xb9,0x1f,0x0b,0x00,0x80,
+0x20,0x20,0x20,0x20,0x76,0x20,0x3d,0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x73,0x2e,
+0x70,0x6f,0x70,0x28,0x29,0x3b,0x20,0x6e,0x20,0x3d,0x20,0x6c,0x65,0x6e,0x28,0x76,
+0x29,0x3b,0x20,0x69,0x20,0x3d,0x20,0x66,0x2b,0x6e,0x00,0x00,0x0d,0x08,0x00,0x06,
+0x00,0x00,0x00,0x03,0x70,0x6f,0x70,0x00,0x38,0x06,0x03,0x08,0x00,0x00,0x00,0x02,
+0x39,0x0a,0x06,0x02,0x33,0x09,0x00,0x01,0x6e,0x00,0x00,0x00,0x0e,0x07,0x00,0x07,
+0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x10,0x08,0x0a,0x00,0x37,0x09,0x07,0x02,
+0x01,0x01,0x04,0x09,0x1f,0x06,0x00,0x81,0x20,0x20,0x20,0x20,0x54,0x2e,0x61,0x64,
+0x64,0x28,0x27,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x27,0x2c,0x76,0x29,0x00,0x00,0x00,
+0x0e,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,0x0d,0x02,0x00,0x09,
+0x00,0x00,0x00,0x03,0x61,0x64,0x64,0x00,0x38,0x07,0x00,0x02,0x00,0x00,0x00,0x03,
+0x0d,0x09,0x00,0x0a,0x00,0x00,0x00,0x06,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x00,0x00,
+0x39,0x06,0x07,0x04,0x1f,0x09,0x00,0x82,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x76,
+0x20,0x69,0x6e,0x20,0x42,0x5f,0x42,0x45,0x47,0x49,0x4e,0x3a,0x20,0x54,0x2e,0x62,
+0x72,0x61,0x63,0x65,0x73,0x20,0x2b,0x3d,0x20,0x31,0x00,0x00,0x0e,0x07,0x00,0x0b,
+0x00,0x00,0x00,0x07,0x42,0x5f,0x42,0x45,0x47,0x49,0x4e,0x00,0x25,0x06,0x0a,0x07,
+0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x16,0x0e,0x06,0x00,0x08,0x00,0x00,0x00,0x01,
+0x54,0x00,0x00,0x00,0x0e,0x07,0x00,0x08,0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,
+0x0d,0x08,0x00,0x0c,0x00,0x00,0x00,0x06,0x62,0x72,0x61,0x63,0x65,0x73,0x00,0x00,
+0x09,0x07,0x07,0x08,0x00,0x00,0x00,0x04,0x0c,0x08,0x00,0x02,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x01,0x07,0x07,0x08,0x0d,0x08,0x00,0x0c,0x00,0x00,0x00,0x06,
+0x62,0x72,0x61,0x63,0x65,0x73,0x00,0x00,0x0b,0x06,0x08,0x07,0x1f,0x09,0x00,0x83,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x76,0x20,0x69,0x6e,0x20,0x42,0x5f,0x45,0x4e,
+0x44,0x3a,0x20,0x54,0x2e,0x62,0x72,0x61,0x63,0x65,0x73,0x20,0x2d,0x3d,0x20,0x31,
+0x00,0x00,0x00,0x00,0x0e,0x07,0x00,0x0d,0x00,0x00,0x00,0x05,0x42,0x5f,0x45,0x4e,
+0x44,0x00,0x00,0x00,0x25,0x06,0x0a,0x07,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x16,
+0x0e,0x06,0x00,0x08,0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,0x0e,0x07,0x00,0x08,
+0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,0x0d,0x08,0x00,0x0c,0x00,0x00,0x00,0x06,
+0x62,0x72,0x61,0x63,0x65,0x73,0x00,0x00,0x09,0x07,0x07,0x08,0x00,0x00,0x00,0x05,
+0x0c,0x08,0x00,0x02,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x02,0x07,0x07,0x08,
+0x0d,0x08,0x00,0x0c,0x00,0x00,0x00,0x06,0x62,0x72,0x61,0x63,0x65,0x73,0x00,0x00,
+0x0b,0x06,0x08,0x07,0x1f,0x04,0x00,0x84,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x69,0x00,0x00,0x00,0x00,0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x0a,0x00,0x5c,0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x73,0x79,0x6d,0x62,0x6f,
+0x6c,0x00,0x00,0x00,0x0f,0x0a,0x09,0x00,0x1f,0x06,0x00,0x86,0x64,0x65,0x66,0x20,
+0x64,0x6f,0x5f,0x6e,0x75,0x6d,0x62,0x65,0x72,0x28,0x73,0x2c,0x69,0x2c,0x6c,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x0a,0x00,0x05,0x2a,0x24,0x31,0x38,0x33,0x00,0x00,0x00,
+0x0d,0x0f,0x00,0x0a,0x00,0x00,0x00,0x01,0x73,0x00,0x00,0x00,0x0d,0x10,0x00,0x0b,
+0x00,0x00,0x00,0x01,0x69,0x00,0x00,0x00,0x0d,0x11,0x00,0x56,0x00,0x00,0x00,0x01,
+0x6c,0x00,0x00,0x00,0x1c,0x0b,0x0f,0x03,0x1c,0x0c,0x00,0x00,0x1d,0x0d,0x00,0x00,
+0x1d,0x0e,0x00,0x00,0x11,0x0a,0x01,0x0d,0x2d,0x0b,0x00,0x0d,0x00,0x00,0x00,0x02,
+0x1f,0x06,0x00,0x86,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x6e,0x75,0x6d,0x62,0x65,
+0x72,0x28,0x73,0x2c,0x69,0x2c,0x6c,0x29,0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x01,
+0x73,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x69,0x00,0x00,0x00,0x33,0x02,0x00,0x01,
+0x6c,0x00,0x00,0x00,0x0d,0x03,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x74,0x6f,0x6b,0x65,
+0x6e,0x69,0x7a,0x65,0x2e,0x70,0x79,0x00,0x22,0x03,0x00,0x00,0x0d,0x03,0x00,0x01,
+0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x6e,0x75,0x6d,0x62,0x65,0x72,0x00,0x00,0x00,
+0x23,0x03,0x00,0x00,0x1f,0x07,0x00,0x87,0x20,0x20,0x20,0x20,0x76,0x2c,0x69,0x2c,
+0x63,0x20,0x3d,0x73,0x5b,0x69,0x5d,0x2c,0x69,0x2b,0x31,0x2c,0x73,0x5b,0x69,0x5d,
+0x00,0x00,0x00,0x00,0x0a,0x03,0x00,0x01,0x0c,0x04,0x00,0x02,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x01,0x05,0x01,0x04,0x0a,0x06,0x00,0x01,0x33,0x04,0x00,0x01,
+0x76,0x00,0x00,0x00,0x10,0x04,0x03,0x00,0x10,0x01,0x05,0x00,0x33,0x03,0x00,0x01,
+0x63,0x00,0x00,0x00,0x10,0x03,0x06,0x00,0x1f,0x04,0x00,0x88,0x20,0x20,0x20,0x20,
+0x77,0x68,0x69,0x6c,0x65,0x20,0x69,0x3c,0x6c,0x3a,0x00,0x00,0x1a,0x05,0x01,0x02,
+0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x4a,0x1f,0x05,0x00,0x89,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x5b,0x69,0x5d,0x00,0x00,0x00,0x00,
+0x0a,0x03,0x00,0x01,0x1f,0x14,0x00,0x8a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x28,0x63,0x20,0x3c,0x20,0x27,0x30,0x27,0x20,0x6f,0x72,0x20,0x63,
+0x20,0x3e,0x20,0x27,0x39,0x27,0x29,0x20,0x61,0x6e,0x64,0x20,0x28,0x63,0x20,0x3c,
+0x20,0x27,0x61,0x27,0x20,0x6f,0x72,0x20,0x63,0x20,0x3e,0x20,0x27,0x66,0x27,0x29,
+0x20,0x61,0x6e,0x64,0x20,0x63,0x20,0x21,0x3d,0x20,0x27,0x78,0x27,0x3a,0x20,0x62,
+0x72,0x65,0x61,0x6b,0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x03,0x00,0x00,0x00,0x01,
+0x30,0x00,0x00,0x00,0x1a,0x05,0x03,0x06,0x2f,0x05,0x00,0x00,0x13,0x00,0x00,0x05,
+0x0d,0x06,0x00,0x04,0x00,0x00,0x00,0x01,0x39,0x00,0x00,0x00,0x36,0x05,0x03,0x06,
+0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x0b,0x0d,0x06,0x00,0x05,0x00,0x00,0x00,0x01,
+0x61,0x00,0x00,0x00,0x1a,0x05,0x03,0x06,0x2f,0x05,0x00,0x00,0x13,0x00,0x00,0x05,
+0x0d,0x06,0x00,0x06,0x00,0x00,0x00,0x01,0x66,0x00,0x00,0x00,0x36,0x05,0x03,0x06,
+0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x05,0x0d,0x06,0x00,0x07,0x00,0x00,0x00,0x01,
+0x78,0x00,0x00,0x00,0x24,0x05,0x03,0x06,0x2f,0x05,0x00,0x00,0x13,0x00,0x00,0x10,
+0x1f,0x06,0x00,0x8b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x2c,0x69,0x20,
+0x3d,0x20,0x76,0x2b,0x63,0x2c,0x69,0x2b,0x31,0x00,0x00,0x00,0x01,0x05,0x04,0x03,
+0x0c,0x08,0x00,0x02,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x06,0x01,0x08,
+0x10,0x04,0x05,0x00,0x10,0x01,0x06,0x00,0x13,0x00,0xff,0xb5,0x1f,0x05,0x00,0x8c,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x63,0x20,0x3d,0x3d,0x20,0x27,0x2e,0x27,0x3a,
+0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x08,0x00,0x00,0x00,0x01,0x2e,0x00,0x00,0x00,
+0x18,0x05,0x03,0x06,0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x5f,0x1f,0x06,0x00,0x8d,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x2c,0x69,0x20,0x3d,0x20,0x76,0x2b,
+0x63,0x2c,0x69,0x2b,0x31,0x00,0x00,0x00,0x01,0x05,0x04,0x03,0x0c,0x08,0x00,0x02,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x06,0x01,0x08,0x10,0x04,0x05,0x00,
+0x10,0x01,0x06,0x00,0x1f,0x05,0x00,0x8e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x77,0x68,0x69,0x6c,0x65,0x20,0x69,0x3c,0x6c,0x3a,0x00,0x00,0x1a,0x05,0x01,0x02,
+0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x31,0x1f,0x06,0x00,0x8f,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x5b,0x69,0x5d,
+0x00,0x00,0x00,0x00,0x0a,0x03,0x00,0x01,0x1f,0x0b,0x00,0x90,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x63,0x20,0x3c,0x20,0x27,
+0x30,0x27,0x20,0x6f,0x72,0x20,0x63,0x20,0x3e,0x20,0x27,0x39,0x27,0x3a,0x20,0x62,
+0x72,0x65,0x61,0x6b,0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x03,0x00,0x00,0x00,0x01,
+0x30,0x00,0x00,0x00,0x1a,0x05,0x03,0x06,0x2f,0x05,0x00,0x00,0x13,0x00,0x00,0x05,
+0x0d,0x06,0x00,0x04,0x00,0x00,0x00,0x01,0x39,0x00,0x00,0x00,0x36,0x05,0x03,0x06,
+0x2f,0x05,0x00,0x00,0x13,0x00,0x00,0x11,0x1f,0x07,0x00,0x91,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x2c,0x69,0x20,0x3d,0x20,0x76,0x2b,
+0x63,0x2c,0x69,0x2b,0x31,0x00,0x00,0x00,0x01,0x05,0x04,0x03,0x0c,0x08,0x00,0x02,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x06,0x01,0x08,0x10,0x04,0x05,0x00,
+0x10,0x01,0x06,0x00,0x13,0x00,0xff,0xce,0x1f,0x07,0x00,0x92,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x54,0x2e,0x61,0x64,0x64,0x28,0x27,0x66,0x6c,0x6f,0x61,0x74,
+0x27,0x2c,0x76,0x29,0x00,0x00,0x00,0x00,0x0e,0x06,0x00,0x09,0x00,0x00,0x00,0x01,
+0x54,0x00,0x00,0x00,0x0d,0x00,0x00,0x0a,0x00,0x00,0x00,0x03,0x61,0x64,0x64,0x00,
+0x38,0x07,0x06,0x00,0x00,0x00,0x00,0x00,0x0d,0x09,0x00,0x0b,0x00,0x00,0x00,0x05,
+0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,0x00,0x10,0x0a,0x04,0x00,0x39,0x05,0x07,0x04,
+0x13,0x00,0x00,0x17,0x1f,0x07,0x00,0x94,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x54,0x2e,0x61,0x64,0x64,0x28,0x27,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x27,0x2c,
+0x76,0x29,0x00,0x00,0x0e,0x06,0x00,0x09,0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,
+0x0d,0x00,0x00,0x0a,0x00,0x00,0x00,0x03,0x61,0x64,0x64,0x00,0x38,0x07,0x06,0x00,
+0x00,0x00,0x00,0x01,0x0d,0x09,0x00,0x0c,0x00,0x00,0x00,0x07,0x69,0x6e,0x74,0x65,
+0x67,0x65,0x72,0x00,0x10,0x0a,0x04,0x00,0x39,0x05,0x07,0x04,0x1f,0x04,0x00,0x95,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x69,0x00,0x00,0x00,0x00,
+0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x0b,0x00,0x5d,0x00,0x00,0x00,0x09,
+0x64,0x6f,0x5f,0x6e,0x75,0x6d,0x62,0x65,0x72,0x00,0x00,0x00,0x0f,0x0b,0x0a,0x00,
+0x1f,0x05,0x00,0x97,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x6e,0x61,0x6d,0x65,0x28,
+0x73,0x2c,0x69,0x2c,0x6c,0x29,0x3a,0x00,0x33,0x0b,0x00,0x05,0x2a,0x24,0x31,0x39,
+0x32,0x00,0x00,0x00,0x0d,0x10,0x00,0x0a,0x00,0x00,0x00,0x01,0x73,0x00,0x00,0x00,
+0x0d,0x11,0x00,0x0b,0x00,0x00,0x00,0x01,0x69,0x00,0x00,0x00,0x0d,0x12,0x00,0x56,
+0x00,0x00,0x00,0x01,0x6c,0x00,0x00,0x00,0x1c,0x0c,0x10,0x03,0x1c,0x0d,0x00,0x00,
+0x1d,0x0e,0x00,0x00,0x1d,0x0f,0x00,0x00,0x11,0x0b,0x00,0xce,0x2d,0x08,0x00,0x0f,
+0x00,0x00,0x00,0x02,0x1f,0x05,0x00,0x97,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x6e,
+0x61,0x6d,0x65,0x28,0x73,0x2c,0x69,0x2c,0x6c,0x29,0x3a,0x00,0x33,0x00,0x00,0x01,
+0x73,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x69,0x00,0x00,0x00,0x33,0x02,0x00,0x01,
+0x6c,0x00,0x00,0x00,0x0d,0x03,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x74,0x6f,0x6b,0x65,
+0x6e,0x69,0x7a,0x65,0x2e,0x70,0x79,0x00,0x22,0x03,0x00,0x00,0x0d,0x03,0x00,0x01,
+0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x6e,0x61,0x6d,0x65,0x00,0x23,0x03,0x00,0x00,
+0x1f,0x05,0x00,0x98,0x20,0x20,0x20,0x20,0x76,0x2c,0x69,0x20,0x3d,0x73,0x5b,0x69,
+0x5d,0x2c,0x69,0x2b,0x31,0x00,0x00,0x00,0x0a,0x03,0x00,0x01,0x0c,0x04,0x00,0x02,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x05,0x01,0x04,0x33,0x07,0x00,0x01,
+0x76,0x00,0x00,0x00,0x10,0x07,0x03,0x00,0x10,0x01,0x05,0x00,0x1f,0x04,0x00,0x99,
+0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x69,0x3c,0x6c,0x3a,0x00,0x00,
+0x1a,0x03,0x01,0x02,0x16,0x03,0x00,0x00,0x13,0x00,0x00,0x5e,0x1f,0x05,0x00,0x9a,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x5b,0x69,0x5d,
+0x00,0x00,0x00,0x00,0x33,0x03,0x00,0x01,0x63,0x00,0x00,0x00,0x0a,0x03,0x00,0x01,
+0x1f,0x1a,0x00,0x9b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+0x63,0x20,0x3c,0x20,0x27,0x61,0x27,0x20,0x6f,0x72,0x20,0x63,0x20,0x3e,0x20,0x27,
+0x7a,0x27,0x29,0x20,0x61,0x6e,0x64,0x20,0x28,0x63,0x20,0x3c,0x20,0x27,0x41,0x27,
+0x20,0x6f,0x72,0x20,0x63,0x20,0x3e,0x20,0x27,0x5a,0x27,0x29,0x20,0x61,0x6e,0x64,
+0x20,0x28,0x63,0x20,0x3c,0x20,0x27,0x30,0x27,0x20,0x6f,0x72,0x20,0x63,0x20,0x3e,
+0x20,0x27,0x39,0x27,0x29,0x20,0x61,0x6e,0x64,0x20,0x63,0x20,0x21,0x3d,0x20,0x27,
+0x5f,0x27,0x3a,0x20,0x62,0x72,0x65,0x61,0x6b,0x00,0x00,0x00,0x0d,0x04,0x00,0x03,
+0x00,0x00,0x00,0x01,0x61,0x00,0x00,0x00,0x1a,0x05,0x03,0x04,0x2f,0x05,0x00,0x00,
+0x13,0x00,0x00,0x05,0x0d,0x04,0x00,0x04,0x00,0x00,0x00,0x01,0x7a,0x00,0x00,0x00,
+0x36,0x05,0x03,0x04,0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x0b,0x0d,0x04,0x00,0x05,
+0x00,0x00,0x00,0x01,0x41,0x00,0x00,0x00,0x1a,0x05,0x03,0x04,0x2f,0x05,0x00,0x00,
+0x13,0x00,0x00,0x05,0x0d,0x04,0x00,0x06,0x00,0x00,0x00,0x01,0x5a,0x00,0x00,0x00,
+0x36,0x05,0x03,0x04,0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x0b,0x0d,0x04,0x00,0x07,
+0x00,0x00,0x00,0x01,0x30,0x00,0x00,0x00,0x1a,0x05,0x03,0x04,0x2f,0x05,0x00,0x00,
+0x13,0x00,0x00,0x05,0x0d,0x04,0x00,0x08,0x00,0x00,0x00,0x01,0x39,0x00,0x00,0x00,
+0x36,0x05,0x03,0x04,0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x05,0x0d,0x04,0x00,0x09,
+0x00,0x00,0x00,0x01,0x5f,0x00,0x00,0x00,0x24,0x05,0x03,0x04,0x2f,0x05,0x00,0x00,
+0x13,0x00,0x00,0x10,0x1f,0x06,0x00,0x9c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x76,0x2c,0x69,0x20,0x3d,0x20,0x76,0x2b,0x63,0x2c,0x69,0x2b,0x31,0x00,0x00,0x00,
+0x01,0x05,0x07,0x03,0x0c,0x06,0x00,0x02,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x01,0x04,0x01,0x06,0x10,0x07,0x05,0x00,0x10,0x01,0x04,0x00,0x13,0x00,0xff,0xa1,
+0x1f,0x0a,0x00,0x9d,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x76,0x20,0x69,0x6e,0x20,
+0x53,0x59,0x4d,0x42,0x4f,0x4c,0x53,0x3a,0x20,0x54,0x2e,0x61,0x64,0x64,0x28,0x27,
+0x73,0x79,0x6d,0x62,0x6f,0x6c,0x27,0x2c,0x76,0x29,0x00,0x00,0x0e,0x04,0x00,0x0a,
+0x00,0x00,0x00,0x07,0x53,0x59,0x4d,0x42,0x4f,0x4c,0x53,0x00,0x25,0x05,0x07,0x04,
+0x16,0x05,0x00,0x00,0x13,0x00,0x00,0x0f,0x0e,0x00,0x00,0x0b,0x00,0x00,0x00,0x01,
+0x54,0x00,0x00,0x00,0x0d,0x02,0x00,0x0c,0x00,0x00,0x00,0x03,0x61,0x64,0x64,0x00,
+0x38,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x0d,0x06,0x00,0x0d,0x00,0x00,0x00,0x06,
+0x73,0x79,0x6d,0x62,0x6f,0x6c,0x00,0x00,0x39,0x05,0x04,0x04,0x13,0x00,0x00,0x16,
+0x1f,0x07,0x00,0x9e,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x3a,0x20,0x54,0x2e,
+0x61,0x64,0x64,0x28,0x27,0x6e,0x61,0x6d,0x65,0x27,0x2c,0x76,0x29,0x00,0x00,0x00,
+0x0e,0x00,0x00,0x0b,0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,0x0d,0x02,0x00,0x0c,
+0x00,0x00,0x00,0x03,0x61,0x64,0x64,0x00,0x38,0x04,0x00,0x02,0x00,0x00,0x00,0x01,
+0x0d,0x06,0x00,0x0e,0x00,0x00,0x00,0x04,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,
+0x39,0x05,0x04,0x04,0x1f,0x04,0x00,0x9f,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x69,0x00,0x00,0x00,0x00,0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x0c,0x00,0x5e,0x00,0x00,0x00,0x07,0x64,0x6f,0x5f,0x6e,0x61,0x6d,0x65,0x00,
+0x0f,0x0c,0x0b,0x00,0x1f,0x06,0x00,0xa1,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x28,0x73,0x2c,0x69,0x2c,0x6c,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x0c,0x00,0x05,0x2a,0x24,0x32,0x30,0x31,0x00,0x00,0x00,0x0d,0x11,0x00,0x0a,
+0x00,0x00,0x00,0x01,0x73,0x00,0x00,0x00,0x0d,0x12,0x00,0x0b,0x00,0x00,0x00,0x01,
+0x69,0x00,0x00,0x00,0x0d,0x13,0x00,0x56,0x00,0x00,0x00,0x01,0x6c,0x00,0x00,0x00,
+0x1c,0x0d,0x11,0x03,0x1c,0x0e,0x00,0x00,0x1d,0x0f,0x00,0x00,0x1d,0x10,0x00,0x00,
+0x11,0x0c,0x02,0x87,0x2d,0x0c,0x00,0x1d,0x00,0x00,0x00,0x06,0x1f,0x06,0x00,0xa1,
+0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x28,0x73,0x2c,
+0x69,0x2c,0x6c,0x29,0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x01,0x73,0x00,0x00,0x00,
+0x33,0x01,0x00,0x01,0x69,0x00,0x00,0x00,0x33,0x02,0x00,0x01,0x6c,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,
+0x2e,0x70,0x79,0x00,0x22,0x03,0x00,0x00,0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x09,
+0x64,0x6f,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,0x23,0x03,0x00,0x00,
+0x1f,0x07,0x00,0xa2,0x20,0x20,0x20,0x20,0x76,0x2c,0x71,0x2c,0x69,0x20,0x3d,0x20,
+0x62,0x27,0x27,0x2c,0x73,0x5b,0x69,0x5d,0x2c,0x69,0x2b,0x31,0x00,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0x04,0x00,0x01,
+0x0c,0x05,0x00,0x03,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x08,0x01,0x05,
+0x33,0x0b,0x00,0x01,0x76,0x00,0x00,0x00,0x10,0x0b,0x03,0x00,0x33,0x03,0x00,0x01,
+0x71,0x00,0x00,0x00,0x10,0x03,0x04,0x00,0x10,0x01,0x08,0x00,0x1f,0x0e,0x00,0xa3,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6c,0x2d,0x69,0x29,0x20,0x3e,0x3d,0x20,
+0x35,0x20,0x61,0x6e,0x64,0x20,0x73,0x5b,0x69,0x5d,0x20,0x3d,0x3d,0x20,0x71,0x20,
+0x61,0x6e,0x64,0x20,0x73,0x5b,0x69,0x2b,0x31,0x5d,0x20,0x3d,0x3d,0x20,0x71,0x3a,
+0x20,0x23,0x20,0x22,0x22,0x22,0x00,0x00,0x02,0x04,0x02,0x01,0x0c,0x08,0x00,0x04,
+0x00,0x00,0x69,0x04,0x05,0x00,0x00,0x00,0x35,0x04,0x04,0x08,0x16,0x04,0x00,0x00,
+0x13,0x00,0x00,0x03,0x0a,0x04,0x00,0x01,0x18,0x04,0x04,0x03,0x16,0x04,0x00,0x00,
+0x13,0x00,0x00,0x07,0x0c,0x05,0x00,0x03,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x01,0x08,0x01,0x05,0x0a,0x04,0x00,0x08,0x18,0x04,0x04,0x03,0x16,0x04,0x00,0x00,
+0x13,0x00,0x00,0xbe,0x1f,0x04,0x00,0xa4,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x20,0x2b,0x3d,0x20,0x32,0x00,0x00,0x0c,0x08,0x00,0x05,0x00,0x00,0x69,0x04,
+0x02,0x00,0x00,0x00,0x01,0x01,0x01,0x08,0x1f,0x06,0x00,0xa5,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x69,0x3c,0x6c,0x2d,0x32,0x3a,
+0x00,0x00,0x00,0x00,0x0c,0x05,0x00,0x05,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,
+0x02,0x08,0x02,0x05,0x1a,0x04,0x01,0x08,0x16,0x04,0x00,0x00,0x13,0x00,0x02,0x11,
+0x1f,0x06,0x00,0xa6,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x63,0x20,0x3d,0x20,0x73,0x5b,0x69,0x5d,0x00,0x00,0x00,0x00,0x33,0x04,0x00,0x01,
+0x63,0x00,0x00,0x00,0x0a,0x04,0x00,0x01,0x1f,0x0e,0x00,0xa7,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x63,0x20,0x3d,0x3d,0x20,
+0x71,0x20,0x61,0x6e,0x64,0x20,0x73,0x5b,0x69,0x2b,0x31,0x5d,0x20,0x3d,0x3d,0x20,
+0x71,0x20,0x61,0x6e,0x64,0x20,0x73,0x5b,0x69,0x2b,0x32,0x5d,0x20,0x3d,0x3d,0x20,
+0x71,0x3a,0x00,0x00,0x18,0x08,0x04,0x03,0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x07,
+0x0c,0x06,0x00,0x03,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x05,0x01,0x06,
+0x0a,0x08,0x00,0x05,0x18,0x08,0x08,0x03,0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x07,
+0x0c,0x06,0x00,0x05,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x01,0x05,0x01,0x06,
+0x0a,0x08,0x00,0x05,0x18,0x08,0x08,0x03,0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x2c,
+0x1f,0x06,0x00,0xa8,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x20,0x2b,0x3d,0x20,0x33,0x00,0x00,0x0c,0x05,0x00,0x06,
+0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,0x01,0x01,0x01,0x05,0x1f,0x09,0x00,0xa9,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x54,0x2e,0x61,0x64,0x64,0x28,0x27,0x73,0x74,0x72,0x69,0x6e,0x67,0x27,0x2c,0x76,
+0x29,0x00,0x00,0x00,0x0e,0x09,0x00,0x07,0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,
+0x0d,0x0a,0x00,0x08,0x00,0x00,0x00,0x03,0x61,0x64,0x64,0x00,0x38,0x05,0x09,0x0a,
+0x00,0x00,0x00,0x00,0x0d,0x07,0x00,0x09,0x00,0x00,0x00,0x06,0x73,0x74,0x72,0x69,
+0x6e,0x67,0x00,0x00,0x10,0x08,0x0b,0x00,0x39,0x08,0x05,0x04,0x1f,0x06,0x00,0xaa,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x62,0x72,0x65,0x61,0x6b,0x00,0x00,0x00,0x13,0x00,0x01,0xba,0x1f,0x05,0x00,0xab,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,
+0x3a,0x00,0x00,0x00,0x1f,0x0a,0x00,0xac,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x2c,0x69,0x20,0x3d,0x20,0x76,0x2b,
+0x63,0x2e,0x65,0x6e,0x63,0x6f,0x64,0x65,0x28,0x29,0x2c,0x69,0x2b,0x31,0x00,0x00,
+0x0d,0x09,0x00,0x0a,0x00,0x00,0x00,0x06,0x65,0x6e,0x63,0x6f,0x64,0x65,0x00,0x00,
+0x38,0x07,0x04,0x09,0x00,0x00,0x00,0x01,0x39,0x06,0x07,0x02,0x01,0x08,0x0b,0x06,
+0x0c,0x07,0x00,0x03,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x05,0x01,0x07,
+0x10,0x0b,0x08,0x00,0x10,0x01,0x05,0x00,0x1f,0x0d,0x00,0xad,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x63,
+0x20,0x3d,0x3d,0x20,0x27,0x5c,0x6e,0x27,0x3a,0x20,0x54,0x2e,0x79,0x2c,0x54,0x2e,
+0x79,0x69,0x20,0x3d,0x20,0x54,0x2e,0x79,0x2b,0x31,0x2c,0x69,0x00,0x00,0x00,0x00,
+0x0d,0x05,0x00,0x0b,0x00,0x00,0x00,0x01,0x0a,0x00,0x00,0x00,0x18,0x08,0x04,0x05,
+0x16,0x08,0x00,0x00,0x13,0x00,0xff,0x70,0x0e,0x05,0x00,0x07,0x00,0x00,0x00,0x01,
+0x54,0x00,0x00,0x00,0x0d,0x06,0x00,0x0c,0x00,0x00,0x00,0x01,0x79,0x00,0x00,0x00,
+0x09,0x05,0x05,0x06,0x00,0x00,0x00,0x02,0x0c,0x06,0x00,0x03,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x01,0x08,0x05,0x06,0x10,0x05,0x01,0x00,0x0e,0x06,0x00,0x07,
+0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,0x0d,0x07,0x00,0x0c,0x00,0x00,0x00,0x01,
+0x79,0x00,0x00,0x00,0x0b,0x06,0x07,0x08,0x0e,0x08,0x00,0x07,0x00,0x00,0x00,0x01,
+0x54,0x00,0x00,0x00,0x0d,0x06,0x00,0x0d,0x00,0x00,0x00,0x02,0x79,0x69,0x00,0x00,
+0x0b,0x08,0x06,0x05,0x13,0x00,0xff,0x54,0x1f,0x05,0x00,0xaf,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x69,0x3c,0x6c,0x3a,0x00,0x00,
+0x1a,0x08,0x01,0x02,0x16,0x08,0x00,0x00,0x13,0x00,0x01,0x62,0x1f,0x06,0x00,0xb0,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,
+0x73,0x5b,0x69,0x5d,0x00,0x00,0x00,0x00,0x0a,0x04,0x00,0x01,0x1f,0x07,0x00,0xb1,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x63,
+0x20,0x3d,0x3d,0x20,0x22,0x5c,0x5c,0x22,0x3a,0x00,0x00,0x00,0x0d,0x05,0x00,0x0e,
+0x00,0x00,0x00,0x01,0x5c,0x00,0x00,0x00,0x18,0x08,0x04,0x05,0x16,0x08,0x00,0x00,
+0x13,0x00,0x00,0xfc,0x1f,0x09,0x00,0xb2,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x20,0x3d,0x20,0x69,0x2b,0x31,0x3b,
+0x20,0x63,0x20,0x3d,0x20,0x73,0x5b,0x69,0x5d,0x00,0x00,0x00,0x0c,0x05,0x00,0x03,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x05,0x0a,0x04,0x00,0x01,
+0x1f,0x0a,0x00,0xb3,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x63,0x20,0x3d,0x3d,0x20,0x22,0x6e,0x22,0x3a,
+0x20,0x63,0x20,0x3d,0x20,0x62,0x27,0x5c,0x6e,0x27,0x00,0x00,0x0d,0x05,0x00,0x0f,
+0x00,0x00,0x00,0x01,0x6e,0x00,0x00,0x00,0x18,0x08,0x04,0x05,0x16,0x08,0x00,0x00,
+0x13,0x00,0x00,0x05,0x0d,0x04,0x00,0x0b,0x00,0x00,0x00,0x01,0x0a,0x00,0x00,0x00,
+0x13,0x00,0x00,0xc7,0x1f,0x0b,0x00,0xb4,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x63,0x20,0x3d,
+0x3d,0x20,0x22,0x72,0x22,0x3a,0x20,0x63,0x20,0x3d,0x20,0x62,0x27,0x5c,0x72,0x27,
+0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x10,0x00,0x00,0x00,0x01,0x72,0x00,0x00,0x00,
+0x18,0x08,0x04,0x05,0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x05,0x0d,0x04,0x00,0x11,
+0x00,0x00,0x00,0x01,0x0d,0x00,0x00,0x00,0x13,0x00,0x00,0xb1,0x1f,0x0b,0x00,0xb5,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x65,0x6c,0x69,0x66,0x20,0x63,0x20,0x3d,0x3d,0x20,0x22,0x74,0x22,0x3a,0x20,0x63,
+0x20,0x3d,0x20,0x62,0x27,0x5c,0x74,0x27,0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x12,
+0x00,0x00,0x00,0x01,0x74,0x00,0x00,0x00,0x18,0x08,0x04,0x05,0x16,0x08,0x00,0x00,
+0x13,0x00,0x00,0x05,0x0d,0x04,0x00,0x13,0x00,0x00,0x00,0x01,0x09,0x00,0x00,0x00,
+0x13,0x00,0x00,0x9b,0x1f,0x0b,0x00,0xb6,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x63,0x20,0x3d,
+0x3d,0x20,0x22,0x30,0x22,0x3a,0x20,0x63,0x20,0x3d,0x20,0x62,0x27,0x5c,0x30,0x27,
+0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x14,0x00,0x00,0x00,0x01,0x30,0x00,0x00,0x00,
+0x18,0x08,0x04,0x05,0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x05,0x0d,0x04,0x00,0x15,
+0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x13,0x00,0x00,0x85,0x1f,0x0c,0x00,0xb7,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x65,0x6c,0x69,0x66,0x20,0x63,0x20,0x3d,0x3d,0x20,0x22,0x78,0x22,0x20,0x61,0x6e,
+0x64,0x20,0x69,0x20,0x2b,0x20,0x33,0x20,0x3c,0x20,0x6c,0x3a,0x00,0x00,0x00,0x00,
+0x0d,0x05,0x00,0x16,0x00,0x00,0x00,0x01,0x78,0x00,0x00,0x00,0x18,0x08,0x04,0x05,
+0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x06,0x0c,0x05,0x00,0x06,0x00,0x00,0x69,0x04,
+0x03,0x00,0x00,0x00,0x01,0x08,0x01,0x05,0x1a,0x08,0x08,0x02,0x16,0x08,0x00,0x00,
+0x13,0x00,0x00,0x35,0x1f,0x0e,0x00,0xb8,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,
+0x62,0x79,0x74,0x65,0x73,0x28,0x5b,0x69,0x6e,0x74,0x28,0x73,0x5b,0x69,0x2b,0x31,
+0x3a,0x69,0x2b,0x33,0x5d,0x2c,0x20,0x31,0x36,0x29,0x5d,0x29,0x00,0x00,0x00,0x00,
+0x0e,0x05,0x00,0x17,0x00,0x00,0x00,0x05,0x62,0x79,0x74,0x65,0x73,0x00,0x00,0x00,
+0x0e,0x08,0x00,0x18,0x00,0x00,0x00,0x03,0x69,0x6e,0x74,0x00,0x0c,0x04,0x00,0x03,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x06,0x01,0x04,0x0c,0x04,0x00,0x06,
+0x00,0x00,0x69,0x04,0x03,0x00,0x00,0x00,0x01,0x07,0x01,0x04,0x1c,0x04,0x06,0x02,
+0x0a,0x09,0x00,0x04,0x0c,0x0a,0x00,0x19,0x00,0x00,0x69,0x04,0x10,0x00,0x00,0x00,
+0x37,0x07,0x08,0x03,0x1c,0x06,0x07,0x01,0x37,0x04,0x05,0x02,0x1f,0x08,0x00,0xb9,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x20,0x3d,0x20,0x69,0x20,0x2b,0x20,0x32,0x00,0x00,0x00,
+0x0c,0x05,0x00,0x05,0x00,0x00,0x69,0x04,0x02,0x00,0x00,0x00,0x01,0x01,0x01,0x05,
+0x13,0x00,0x00,0x37,0x1f,0x0b,0x00,0xba,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,0x20,0x63,0x20,0x3d,
+0x3d,0x20,0x22,0x5c,0x5c,0x22,0x3a,0x20,0x63,0x20,0x3d,0x20,0x62,0x27,0x5c,0x5c,
+0x27,0x00,0x00,0x00,0x0d,0x05,0x00,0x0e,0x00,0x00,0x00,0x01,0x5c,0x00,0x00,0x00,
+0x18,0x08,0x04,0x05,0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x05,0x0d,0x04,0x00,0x0e,
+0x00,0x00,0x00,0x01,0x5c,0x00,0x00,0x00,0x13,0x00,0x00,0x21,0x1f,0x0c,0x00,0xbc,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x75,0x5f,0x65,0x72,0x72,0x6f,0x72,0x28,0x27,0x74,0x6f,0x6b,
+0x65,0x6e,0x69,0x7a,0x65,0x27,0x2c,0x73,0x2c,0x54,0x2e,0x66,0x29,0x00,0x00,0x00,
+0x0e,0x05,0x00,0x1a,0x00,0x00,0x00,0x07,0x75,0x5f,0x65,0x72,0x72,0x6f,0x72,0x00,
+0x0d,0x06,0x00,0x1b,0x00,0x00,0x00,0x08,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,
+0x00,0x00,0x00,0x00,0x10,0x07,0x00,0x00,0x0e,0x08,0x00,0x07,0x00,0x00,0x00,0x01,
+0x54,0x00,0x00,0x00,0x0d,0x09,0x00,0x1c,0x00,0x00,0x00,0x01,0x66,0x00,0x00,0x00,
+0x09,0x08,0x08,0x09,0x00,0x00,0x00,0x03,0x37,0x08,0x05,0x04,0x1f,0x08,0x00,0xbd,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x76,0x2c,0x69,0x20,0x3d,0x20,0x76,0x20,0x2b,0x20,0x63,0x2c,0x69,0x2b,0x31,0x00,
+0x01,0x08,0x0b,0x04,0x0c,0x07,0x00,0x03,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x01,0x05,0x01,0x07,0x10,0x0b,0x08,0x00,0x10,0x01,0x05,0x00,0x13,0x00,0xfe,0xed,
+0x1f,0x07,0x00,0xbe,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x65,0x6c,0x69,0x66,0x20,0x63,0x20,0x3d,0x3d,0x20,0x71,0x3a,0x00,0x00,0x00,0x00,
+0x18,0x08,0x04,0x03,0x16,0x08,0x00,0x00,0x13,0x00,0x00,0x2c,0x1f,0x06,0x00,0xbf,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x20,0x2b,0x3d,0x20,0x31,0x00,0x00,0x0c,0x05,0x00,0x03,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x05,0x1f,0x09,0x00,0xc0,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x54,0x2e,0x61,0x64,
+0x64,0x28,0x27,0x73,0x74,0x72,0x69,0x6e,0x67,0x27,0x2c,0x76,0x29,0x00,0x00,0x00,
+0x0e,0x09,0x00,0x07,0x00,0x00,0x00,0x01,0x54,0x00,0x00,0x00,0x0d,0x0a,0x00,0x08,
+0x00,0x00,0x00,0x03,0x61,0x64,0x64,0x00,0x38,0x05,0x09,0x0a,0x00,0x00,0x00,0x04,
+0x0d,0x07,0x00,0x09,0x00,0x00,0x00,0x06,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,
+0x10,0x08,0x0b,0x00,0x39,0x08,0x05,0x04,0x1f,0x06,0x00,0xc1,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x72,0x65,0x61,
+0x6b,0x00,0x00,0x00,0x13,0x00,0x00,0x1b,0x1f,0x0a,0x00,0xc3,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x2c,0x69,0x20,
+0x3d,0x20,0x76,0x2b,0x63,0x2e,0x65,0x6e,0x63,0x6f,0x64,0x65,0x28,0x29,0x2c,0x69,
+0x2b,0x31,0x00,0x00,0x0d,0x09,0x00,0x0a,0x00,0x00,0x00,0x06,0x65,0x6e,0x63,0x6f,
+0x64,0x65,0x00,0x00,0x38,0x07,0x04,0x09,0x00,0x00,0x00,0x05,0x39,0x06,0x07,0x02,
+0x01,0x08,0x0b,0x06,0x0c,0x07,0x00,0x03,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x01,0x05,0x01,0x07,0x10,0x0b,0x08,0x00,0x10,0x01,0x05,0x00,0x13,0x00,0xfe,0x9d,
+0x1f,0x04,0x00,0xc4,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x69,
+0x00,0x00,0x00,0x00,0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x0d,0x00,0x5f,
+0x00,0x00,0x00,0x09,0x64,0x6f,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x00,
+0x0f,0x0d,0x0c,0x00,0x1f,0x06,0x00,0xc6,0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x63,
+0x6f,0x6d,0x6d,0x65,0x6e,0x74,0x28,0x73,0x2c,0x69,0x2c,0x6c,0x29,0x3a,0x00,0x00,
+0x33,0x0d,0x00,0x05,0x2a,0x24,0x32,0x31,0x30,0x00,0x00,0x00,0x0d,0x12,0x00,0x0a,
+0x00,0x00,0x00,0x01,0x73,0x00,0x00,0x00,0x0d,0x13,0x00,0x0b,0x00,0x00,0x00,0x01,
+0x69,0x00,0x00,0x00,0x0d,0x14,0x00,0x56,0x00,0x00,0x00,0x01,0x6c,0x00,0x00,0x00,
+0x1c,0x0e,0x12,0x03,0x1c,0x0f,0x00,0x00,0x1d,0x10,0x00,0x00,0x1d,0x11,0x00,0x00,
+0x11,0x0d,0x00,0x58,0x2d,0x05,0x00,0x04,0x00,0x00,0x00,0x00,0x1f,0x06,0x00,0xc6,
+0x64,0x65,0x66,0x20,0x64,0x6f,0x5f,0x63,0x6f,0x6d,0x6d,0x65,0x6e,0x74,0x28,0x73,
+0x2c,0x69,0x2c,0x6c,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x01,0x73,0x00,0x00,0x00,
+0x33,0x01,0x00,0x01,0x69,0x00,0x00,0x00,0x33,0x02,0x00,0x01,0x6c,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x00,0x00,0x00,0x00,0x1b,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x2f,0x74,0x6f,0x6b,0x65,0x6e,0x69,0x7a,0x65,
+0x2e,0x70,0x79,0x00,0x22,0x03,0x00,0x00,0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x0a,
+0x64,0x6f,0x5f,0x63,0x6f,0x6d,0x6d,0x65,0x6e,0x74,0x00,0x00,0x23,0x03,0x00,0x00,
+0x1f,0x03,0x00,0xc7,0x20,0x20,0x20,0x20,0x69,0x20,0x2b,0x3d,0x20,0x31,0x00,0x00,
+0x0c,0x03,0x00,0x02,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x03,
+0x1f,0x04,0x00,0xc8,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x69,0x3c,
+0x6c,0x3a,0x00,0x00,0x1a,0x03,0x01,0x02,0x16,0x03,0x00,0x00,0x13,0x00,0x00,0x22,
+0x1f,0x05,0x00,0xc9,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,
+0x73,0x5b,0x69,0x5d,0x00,0x00,0x00,0x00,0x33,0x03,0x00,0x01,0x63,0x00,0x00,0x00,
+0x0a,0x03,0x00,0x01,0x1f,0x07,0x00,0xca,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x63,0x20,0x3d,0x3d,0x20,0x27,0x5c,0x6e,0x27,0x3a,0x20,0x62,0x72,
+0x65,0x61,0x6b,0x00,0x0d,0x04,0x00,0x03,0x00,0x00,0x00,0x01,0x0a,0x00,0x00,0x00,
+0x18,0x03,0x03,0x04,0x2f,0x03,0x00,0x00,0x13,0x00,0x00,0x0b,0x1f,0x04,0x00,0xcb,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x20,0x2b,0x3d,0x20,0x31,0x00,0x00,
+0x0c,0x04,0x00,0x02,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x04,
+0x13,0x00,0xff,0xdd,0x1f,0x04,0x00,0xcc,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x69,0x00,0x00,0x00,0x00,0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x0e,0x00,0x60,0x00,0x00,0x00,0x0a,0x64,0x6f,0x5f,0x63,0x6f,0x6d,0x6d,0x65,
+0x6e,0x74,0x00,0x00,0x0f,0x0e,0x0d,0x00,0x00,0x00,0x00,0x00,
+};
+
+static tpd_code * _tp_tinypy_compiler_tokenize_0(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 31: goto L31;
+        case 39: goto L39;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 54: goto L54;
+        case 55: goto L55;
+        case 57: goto L57;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 66: goto L66;
+        case 67: goto L67;
+        case 71: goto L71;
+        case 72: goto L72;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 78: goto L78;
+        case 79: goto L79;
+        case 761: goto L761;
+        case 762: goto L762;
+        case 763: goto L763;
+        case 764: goto L764;
+        case 771: goto L771;
+        case 774: goto L774;
+        case 777: goto L777;
+        case 780: goto L780;
+        case 783: goto L783;
+        case 784: goto L784;
+        case 785: goto L785;
+        case 786: goto L786;
+        case 787: goto L787;
+        case 993: goto L993;
+        case 997: goto L997;
+        case 998: goto L998;
+        case 1010: goto L1010;
+        case 1015: goto L1015;
+        case 1024: goto L1024;
+        case 1025: goto L1025;
+        case 1029: goto L1029;
+        case 1033: goto L1033;
+        case 1056: goto L1056;
+        case 1059: goto L1059;
+        case 1063: goto L1063;
+        case 1067: goto L1067;
+        case 1071: goto L1071;
+        case 1075: goto L1075;
+        case 1078: goto L1078;
+        case 1081: goto L1081;
+        case 1084: goto L1084;
+        case 1087: goto L1087;
+        case 1090: goto L1090;
+        case 1094: goto L1094;
+        case 1098: goto L1098;
+        case 1116: goto L1116;
+        case 1119: goto L1119;
+        case 1123: goto L1123;
+        case 1127: goto L1127;
+        case 1130: goto L1130;
+        case 1135: goto L1135;
+        case 1138: goto L1138;
+        case 1142: goto L1142;
+        case 1146: goto L1146;
+        case 1149: goto L1149;
+        case 1169: goto L1169;
+        case 1173: goto L1173;
+        case 1177: goto L1177;
+        case 1181: goto L1181;
+        case 1185: goto L1185;
+        case 1189: goto L1189;
+        case 1193: goto L1193;
+        case 1197: goto L1197;
+        case 1200: goto L1200;
+        case 1204: goto L1204;
+        case 1215: goto L1215;
+        case 1218: goto L1218;
+        case 1221: goto L1221;
+        case 1224: goto L1224;
+        case 1227: goto L1227;
+        case 1230: goto L1230;
+        case 1233: goto L1233;
+        case 1236: goto L1236;
+        case 1239: goto L1239;
+        case 1257: goto L1257;
+        case 1260: goto L1260;
+        case 1263: goto L1263;
+        case 1266: goto L1266;
+        case 1269: goto L1269;
+        case 1272: goto L1272;
+        case 1275: goto L1275;
+        case 1278: goto L1278;
+        case 1281: goto L1281;
+        case 1284: goto L1284;
+        case 1287: goto L1287;
+        case 1290: goto L1290;
+        case 1293: goto L1293;
+        case 1312: goto L1312;
+        case 1315: goto L1315;
+        case 1318: goto L1318;
+        case 1321: goto L1321;
+        case 1324: goto L1324;
+        case 1327: goto L1327;
+        case 1330: goto L1330;
+        case 1333: goto L1333;
+        case 1336: goto L1336;
+        case 1339: goto L1339;
+        case 1342: goto L1342;
+        case 1345: goto L1345;
+        case 1348: goto L1348;
+        case 1351: goto L1351;
+        case 1354: goto L1354;
+        case 1357: goto L1357;
+        case 1360: goto L1360;
+        case 1361: goto L1361;
+        case 1362: goto L1362;
+        case 1374: goto L1374;
+        case 1377: goto L1377;
+        case 1380: goto L1380;
+        case 1383: goto L1383;
+        case 1384: goto L1384;
+        case 1387: goto L1387;
+        case 1390: goto L1390;
+        case 1393: goto L1393;
+        case 1394: goto L1394;
+        case 1398: goto L1398;
+        case 1399: goto L1399;
+        case 1403: goto L1403;
+        case 1404: goto L1404;
+        case 1409: goto L1409;
+        case 1410: goto L1410;
+        case 1413: goto L1413;
+        case 1417: goto L1417;
+        case 1418: goto L1418;
+        case 1422: goto L1422;
+        case 1423: goto L1423;
+        case 1427: goto L1427;
+        case 1428: goto L1428;
+        case 1431: goto L1431;
+        case 1432: goto L1432;
+        case 1433: goto L1433;
+        case 1434: goto L1434;
+        case 1435: goto L1435;
+        case 1682: goto L1682;
+        case 1683: goto L1683;
+        case 1684: goto L1684;
+        case 1685: goto L1685;
+        case 1690: goto L1690;
+        case 1693: goto L1693;
+        case 1696: goto L1696;
+        case 1697: goto L1697;
+        case 1698: goto L1698;
+        case 1699: goto L1699;
+        case 1700: goto L1700;
+        case 1776: goto L1776;
+        case 1780: goto L1780;
+        case 1781: goto L1781;
+        case 1787: goto L1787;
+        case 1790: goto L1790;
+        case 1793: goto L1793;
+        case 1794: goto L1794;
+        case 1795: goto L1795;
+        case 1796: goto L1796;
+        case 1797: goto L1797;
+        case 1928: goto L1928;
+        case 1933: goto L1933;
+        case 1934: goto L1934;
+        case 1941: goto L1941;
+        case 1944: goto L1944;
+        case 1947: goto L1947;
+        case 1950: goto L1950;
+        case 1953: goto L1953;
+        case 1954: goto L1954;
+        case 1955: goto L1955;
+        case 1956: goto L1956;
+        case 1957: goto L1957;
+        case 2625: goto L2625;
+        case 2630: goto L2630;
+        case 2631: goto L2631;
+        case 2637: goto L2637;
+        case 2640: goto L2640;
+        case 2643: goto L2643;
+        case 2646: goto L2646;
+        case 2649: goto L2649;
+        case 2650: goto L2650;
+        case 2651: goto L2651;
+        case 2652: goto L2652;
+        case 2653: goto L2653;
+        case 2783: goto L2783;
+        case 2787: goto L2787;
+        case 2788: goto L2788;
+        case 2795: goto L2795;
+        case 2798: goto L2798;
+        case 2801: goto L2801;
+        case 2804: goto L2804;
+        case 2807: goto L2807;
+        case 2808: goto L2808;
+        case 2809: goto L2809;
+        case 2810: goto L2810;
+        case 2811: goto L2811;
+        case 2964: goto L2964;
+        case 2969: goto L2969;
+        case 2970: goto L2970;
+        case 2975: goto L2975;
+        case 2978: goto L2978;
+        case 2981: goto L2981;
+        case 2982: goto L2982;
+        case 2983: goto L2983;
+        case 2984: goto L2984;
+        case 2985: goto L2985;
+        case 3238: goto L3238;
+        case 3242: goto L3242;
+        case 3243: goto L3243;
+        case 3250: goto L3250;
+        case 3253: goto L3253;
+        case 3256: goto L3256;
+        case 3259: goto L3259;
+        case 3262: goto L3262;
+        case 3263: goto L3263;
+        case 3264: goto L3264;
+        case 3265: goto L3265;
+        case 3266: goto L3266;
+        case 3560: goto L3560;
+        case 3565: goto L3565;
+        case 3566: goto L3566;
+        case 3573: goto L3573;
+        case 3576: goto L3576;
+        case 3579: goto L3579;
+        case 3582: goto L3582;
+        case 3585: goto L3585;
+        case 3586: goto L3586;
+        case 3587: goto L3587;
+        case 3588: goto L3588;
+        case 3589: goto L3589;
+        case 3858: goto L3858;
+        case 3863: goto L3863;
+        case 3864: goto L3864;
+        case 3870: goto L3870;
+        case 3873: goto L3873;
+        case 3876: goto L3876;
+        case 3879: goto L3879;
+        case 3882: goto L3882;
+        case 3883: goto L3883;
+        case 3884: goto L3884;
+        case 3885: goto L3885;
+        case 3886: goto L3886;
+        case 4092: goto L4092;
+        case 4096: goto L4096;
+        case 4097: goto L4097;
+        case 4104: goto L4104;
+        case 4107: goto L4107;
+        case 4110: goto L4110;
+        case 4113: goto L4113;
+        case 4116: goto L4116;
+        case 4117: goto L4117;
+        case 4118: goto L4118;
+        case 4119: goto L4119;
+        case 4120: goto L4120;
+        case 4767: goto L4767;
+        case 4772: goto L4772;
+        case 4773: goto L4773;
+        case 4780: goto L4780;
+        case 4783: goto L4783;
+        case 4786: goto L4786;
+        case 4789: goto L4789;
+        case 4792: goto L4792;
+        case 4793: goto L4793;
+        case 4794: goto L4794;
+        case 4795: goto L4795;
+        case 4796: goto L4796;
+        case 4884: goto L4884;
+        case 4889: goto L4889;
+        case 4890: goto L4890;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 1;
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[0];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L25: /* NAME */
+    f->name = regs[0];
+L26: /* GGET */
+    tp_aot_op(tp, f, code + 26);
+L31: /* STRING */
+    tp_aot_op(tp, f, code + 31);
+L39: /* STRING */
+    tp_aot_op(tp, f, code + 39);
+L42: /* CALLP */
+    return code + 42;
+L43: /* GGET */
+    tp_aot_op(tp, f, code + 43);
+L48: /* UPDATE */
+    tp_aot_op(tp, f, code + 48);
+L49: /* LINE */
+    f->line = code + 49;
+    f->lineno = 3;
+L54: /* CLASS */
+    regs[0] = tp_class(tp);
+L55: /* VAR */
+L57: /* STRING */
+    tp_aot_op(tp, f, code + 57);
+L61: /* GSET */
+    tp_set(tp, f->globals, regs[1], regs[0]);
+L62: /* GGET */
+    tp_aot_op(tp, f, code + 62);
+L66: /* MOVE */
+    regs[3] = regs[0];
+L67: /* GGET */
+    tp_aot_op(tp, f, code + 67);
+L71: /* CALLP */
+    return code + 71;
+L72: /* VAR */
+L75: /* LIST */
+    tp_aot_op(tp, f, code + 75);
+L76: /* LIST */
+    tp_aot_op(tp, f, code + 76);
+L77: /* NONE */
+    regs[3] = tp_None;
+L78: /* NONE */
+    regs[4] = tp_None;
+L79: /* DEF */
+    tp_aot_op(tp, f, code + 79);
+L761: /* NONE */
+    regs[2] = tp_None;
+L762: /* NONE */
+    regs[3] = tp_None;
+L763: /* CALL */
+    return code + 763;
+L764: /* LINE */
+    f->line = code + 764;
+    f->lineno = 25;
+L771: /* VAR */
+L774: /* STRING */
+    tp_aot_op(tp, f, code + 774);
+L777: /* STRING */
+    tp_aot_op(tp, f, code + 777);
+L780: /* STRING */
+    tp_aot_op(tp, f, code + 780);
+L783: /* LIST */
+    tp_aot_op(tp, f, code + 783);
+L784: /* LIST */
+    tp_aot_op(tp, f, code + 784);
+L785: /* NONE */
+    regs[4] = tp_None;
+L786: /* NONE */
+    regs[5] = tp_None;
+L787: /* DEF */
+    tp_aot_op(tp, f, code + 787);
+L993: /* STRING */
+    tp_aot_op(tp, f, code + 993);
+L997: /* GSET */
+    tp_set(tp, f->globals, regs[2], regs[1]);
+L998: /* LINE */
+    f->line = code + 998;
+    f->lineno = 35;
+L1010: /* STRING */
+    tp_aot_op(tp, f, code + 1010);
+L1015: /* STRING */
+    tp_aot_op(tp, f, code + 1015);
+L1024: /* GSET */
+    tp_set(tp, f->globals, regs[2], regs[3]);
+L1025: /* LINE */
+    f->line = code + 1025;
+    f->lineno = 36;
+L1029: /* STRING */
+    tp_aot_op(tp, f, code + 1029);
+L1033: /* LINE */
+    f->line = code + 1033;
+    f->lineno = 37;
+L1056: /* STRING */
+    tp_aot_op(tp, f, code + 1056);
+L1059: /* STRING */
+    tp_aot_op(tp, f, code + 1059);
+L1063: /* STRING */
+    tp_aot_op(tp, f, code + 1063);
+L1067: /* STRING */
+    tp_aot_op(tp, f, code + 1067);
+L1071: /* STRING */
+    tp_aot_op(tp, f, code + 1071);
+L1075: /* STRING */
+    tp_aot_op(tp, f, code + 1075);
+L1078: /* STRING */
+    tp_aot_op(tp, f, code + 1078);
+L1081: /* STRING */
+    tp_aot_op(tp, f, code + 1081);
+L1084: /* STRING */
+    tp_aot_op(tp, f, code + 1084);
+L1087: /* STRING */
+    tp_aot_op(tp, f, code + 1087);
+L1090: /* STRING */
+    tp_aot_op(tp, f, code + 1090);
+L1094: /* STRING */
+    tp_aot_op(tp, f, code + 1094);
+L1098: /* LINE */
+    f->line = code + 1098;
+    f->lineno = 38;
+L1116: /* STRING */
+    tp_aot_op(tp, f, code + 1116);
+L1119: /* STRING */
+    tp_aot_op(tp, f, code + 1119);
+L1123: /* STRING */
+    tp_aot_op(tp, f, code + 1123);
+L1127: /* STRING */
+    tp_aot_op(tp, f, code + 1127);
+L1130: /* STRING */
+    tp_aot_op(tp, f, code + 1130);
+L1135: /* STRING */
+    tp_aot_op(tp, f, code + 1135);
+L1138: /* STRING */
+    tp_aot_op(tp, f, code + 1138);
+L1142: /* STRING */
+    tp_aot_op(tp, f, code + 1142);
+L1146: /* STRING */
+    tp_aot_op(tp, f, code + 1146);
+L1149: /* LINE */
+    f->line = code + 1149;
+    f->lineno = 39;
+L1169: /* STRING */
+    tp_aot_op(tp, f, code + 1169);
+L1173: /* STRING */
+    tp_aot_op(tp, f, code + 1173);
+L1177: /* STRING */
+    tp_aot_op(tp, f, code + 1177);
+L1181: /* STRING */
+    tp_aot_op(tp, f, code + 1181);
+L1185: /* STRING */
+    tp_aot_op(tp, f, code + 1185);
+L1189: /* STRING */
+    tp_aot_op(tp, f, code + 1189);
+L1193: /* STRING */
+    tp_aot_op(tp, f, code + 1193);
+L1197: /* STRING */
+    tp_aot_op(tp, f, code + 1197);
+L1200: /* STRING */
+    tp_aot_op(tp, f, code + 1200);
+L1204: /* LINE */
+    f->line = code + 1204;
+    f->lineno = 40;
+L1215: /* STRING */
+    tp_aot_op(tp, f, code + 1215);
+L1218: /* STRING */
+    tp_aot_op(tp, f, code + 1218);
+L1221: /* STRING */
+    tp_aot_op(tp, f, code + 1221);
+L1224: /* STRING */
+    tp_aot_op(tp, f, code + 1224);
+L1227: /* STRING */
+    tp_aot_op(tp, f, code + 1227);
+L1230: /* STRING */
+    tp_aot_op(tp, f, code + 1230);
+L1233: /* STRING */
+    tp_aot_op(tp, f, code + 1233);
+L1236: /* STRING */
+    tp_aot_op(tp, f, code + 1236);
+L1239: /* LINE */
+    f->line = code + 1239;
+    f->lineno = 41;
+L1257: /* STRING */
+    tp_aot_op(tp, f, code + 1257);
+L1260: /* STRING */
+    tp_aot_op(tp, f, code + 1260);
+L1263: /* STRING */
+    tp_aot_op(tp, f, code + 1263);
+L1266: /* STRING */
+    tp_aot_op(tp, f, code + 1266);
+L1269: /* STRING */
+    tp_aot_op(tp, f, code + 1269);
+L1272: /* STRING */
+    tp_aot_op(tp, f, code + 1272);
+L1275: /* STRING */
+    tp_aot_op(tp, f, code + 1275);
+L1278: /* STRING */
+    tp_aot_op(tp, f, code + 1278);
+L1281: /* STRING */
+    tp_aot_op(tp, f, code + 1281);
+L1284: /* STRING */
+    tp_aot_op(tp, f, code + 1284);
+L1287: /* STRING */
+    tp_aot_op(tp, f, code + 1287);
+L1290: /* STRING */
+    tp_aot_op(tp, f, code + 1290);
+L1293: /* LINE */
+    f->line = code + 1293;
+    f->lineno = 42;
+L1312: /* STRING */
+    tp_aot_op(tp, f, code + 1312);
+L1315: /* STRING */
+    tp_aot_op(tp, f, code + 1315);
+L1318: /* STRING */
+    tp_aot_op(tp, f, code + 1318);
+L1321: /* STRING */
+    tp_aot_op(tp, f, code + 1321);
+L1324: /* STRING */
+    tp_aot_op(tp, f, code + 1324);
+L1327: /* STRING */
+    tp_aot_op(tp, f, code + 1327);
+L1330: /* STRING */
+    tp_aot_op(tp, f, code + 1330);
+L1333: /* STRING */
+    tp_aot_op(tp, f, code + 1333);
+L1336: /* STRING */
+    tp_aot_op(tp, f, code + 1336);
+L1339: /* STRING */
+    tp_aot_op(tp, f, code + 1339);
+L1342: /* STRING */
+    tp_aot_op(tp, f, code + 1342);
+L1345: /* STRING */
+    tp_aot_op(tp, f, code + 1345);
+L1348: /* STRING */
+    tp_aot_op(tp, f, code + 1348);
+L1351: /* STRING */
+    tp_aot_op(tp, f, code + 1351);
+L1354: /* STRING */
+    tp_aot_op(tp, f, code + 1354);
+L1357: /* STRING */
+    tp_aot_op(tp, f, code + 1357);
+L1360: /* LIST */
+    tp_aot_op(tp, f, code + 1360);
+L1361: /* GSET */
+    tp_set(tp, f->globals, regs[2], regs[3]);
+L1362: /* LINE */
+    f->line = code + 1362;
+    f->lineno = 44;
+L1374: /* STRING */
+    tp_aot_op(tp, f, code + 1374);
+L1377: /* STRING */
+    tp_aot_op(tp, f, code + 1377);
+L1380: /* STRING */
+    tp_aot_op(tp, f, code + 1380);
+L1383: /* LIST */
+    tp_aot_op(tp, f, code + 1383);
+L1384: /* STRING */
+    tp_aot_op(tp, f, code + 1384);
+L1387: /* STRING */
+    tp_aot_op(tp, f, code + 1387);
+L1390: /* STRING */
+    tp_aot_op(tp, f, code + 1390);
+L1393: /* LIST */
+    tp_aot_op(tp, f, code + 1393);
+L1394: /* STRING */
+    tp_aot_op(tp, f, code + 1394);
+L1398: /* GSET */
+    tp_set(tp, f->globals, regs[4], regs[2]);
+L1399: /* STRING */
+    tp_aot_op(tp, f, code + 1399);
+L1403: /* GSET */
+    tp_set(tp, f->globals, regs[2], regs[3]);
+L1404: /* LINE */
+    f->line = code + 1404;
+    f->lineno = 46;
+L1409: /* CLASS */
+    regs[2] = tp_class(tp);
+L1410: /* VAR */
+L1413: /* STRING */
+    tp_aot_op(tp, f, code + 1413);
+L1417: /* GSET */
+    tp_set(tp, f->globals, regs[3], regs[2]);
+L1418: /* GGET */
+    tp_aot_op(tp, f, code + 1418);
+L1422: /* MOVE */
+    regs[5] = regs[2];
+L1423: /* GGET */
+    tp_aot_op(tp, f, code + 1423);
+L1427: /* CALLP */
+    return code + 1427;
+L1428: /* VAR */
+L1431: /* LIST */
+    tp_aot_op(tp, f, code + 1431);
+L1432: /* LIST */
+    tp_aot_op(tp, f, code + 1432);
+L1433: /* NONE */
+    regs[5] = tp_None;
+L1434: /* NONE */
+    regs[6] = tp_None;
+L1435: /* DEF */
+    tp_aot_op(tp, f, code + 1435);
+L1682: /* NONE */
+    regs[4] = tp_None;
+L1683: /* NONE */
+    regs[5] = tp_None;
+L1684: /* CALL */
+    return code + 1684;
+L1685: /* LINE */
+    f->line = code + 1685;
+    f->lineno = 52;
+L1690: /* VAR */
+L1693: /* STRING */
+    tp_aot_op(tp, f, code + 1693);
+L1696: /* LIST */
+    tp_aot_op(tp, f, code + 1696);
+L1697: /* LIST */
+    tp_aot_op(tp, f, code + 1697);
+L1698: /* NONE */
+    regs[6] = tp_None;
+L1699: /* NONE */
+    regs[7] = tp_None;
+L1700: /* DEF */
+    tp_aot_op(tp, f, code + 1700);
+L1776: /* STRING */
+    tp_aot_op(tp, f, code + 1776);
+L1780: /* GSET */
+    tp_set(tp, f->globals, regs[4], regs[3]);
+L1781: /* LINE */
+    f->line = code + 1781;
+    f->lineno = 57;
+L1787: /* VAR */
+L1790: /* STRING */
+    tp_aot_op(tp, f, code + 1790);
+L1793: /* LIST */
+    tp_aot_op(tp, f, code + 1793);
+L1794: /* LIST */
+    tp_aot_op(tp, f, code + 1794);
+L1795: /* NONE */
+    regs[7] = tp_None;
+L1796: /* NONE */
+    regs[8] = tp_None;
+L1797: /* DEF */
+    tp_aot_op(tp, f, code + 1797);
+L1928: /* STRING */
+    tp_aot_op(tp, f, code + 1928);
+L1933: /* GSET */
+    tp_set(tp, f->globals, regs[5], regs[4]);
+L1934: /* LINE */
+    f->line = code + 1934;
+    f->lineno = 66;
+L1941: /* VAR */
+L1944: /* STRING */
+    tp_aot_op(tp, f, code + 1944);
+L1947: /* STRING */
+    tp_aot_op(tp, f, code + 1947);
+L1950: /* STRING */
+    tp_aot_op(tp, f, code + 1950);
+L1953: /* LIST */
+    tp_aot_op(tp, f, code + 1953);
+L1954: /* LIST */
+    tp_aot_op(tp, f, code + 1954);
+L1955: /* NONE */
+    regs[8] = tp_None;
+L1956: /* NONE */
+    regs[9] = tp_None;
+L1957: /* DEF */
+    tp_aot_op(tp, f, code + 1957);
+L2625: /* STRING */
+    tp_aot_op(tp, f, code + 2625);
+L2630: /* GSET */
+    tp_set(tp, f->globals, regs[6], regs[5]);
+L2631: /* LINE */
+    f->line = code + 2631;
+    f->lineno = 92;
+L2637: /* VAR */
+L2640: /* STRING */
+    tp_aot_op(tp, f, code + 2640);
+L2643: /* STRING */
+    tp_aot_op(tp, f, code + 2643);
+L2646: /* STRING */
+    tp_aot_op(tp, f, code + 2646);
+L2649: /* LIST */
+    tp_aot_op(tp, f, code + 2649);
+L2650: /* LIST */
+    tp_aot_op(tp, f, code + 2650);
+L2651: /* NONE */
+    regs[9] = tp_None;
+L2652: /* NONE */
+    regs[10] = tp_None;
+L2653: /* DEF */
+    tp_aot_op(tp, f, code + 2653);
+L2783: /* STRING */
+    tp_aot_op(tp, f, code + 2783);
+L2787: /* GSET */
+    tp_set(tp, f->globals, regs[7], regs[6]);
+L2788: /* LINE */
+    f->line = code + 2788;
+    f->lineno = 99;
+L2795: /* VAR */
+L2798: /* STRING */
+    tp_aot_op(tp, f, code + 2798);
+L2801: /* STRING */
+    tp_aot_op(tp, f, code + 2801);
+L2804: /* STRING */
+    tp_aot_op(tp, f, code + 2804);
+L2807: /* LIST */
+    tp_aot_op(tp, f, code + 2807);
+L2808: /* LIST */
+    tp_aot_op(tp, f, code + 2808);
+L2809: /* NONE */
+    regs[10] = tp_None;
+L2810: /* NONE */
+    regs[11] = tp_None;
+L2811: /* DEF */
+    tp_aot_op(tp, f, code + 2811);
+L2964: /* STRING */
+    tp_aot_op(tp, f, code + 2964);
+L2969: /* GSET */
+    tp_set(tp, f->globals, regs[8], regs[7]);
+L2970: /* LINE */
+    f->line = code + 2970;
+    f->lineno = 108;
+L2975: /* VAR */
+L2978: /* STRING */
+    tp_aot_op(tp, f, code + 2978);
+L2981: /* LIST */
+    tp_aot_op(tp, f, code + 2981);
+L2982: /* LIST */
+    tp_aot_op(tp, f, code + 2982);
+L2983: /* NONE */
+    regs[11] = tp_None;
+L2984: /* NONE */
+    regs[12] = tp_None;
+L2985: /* DEF */
+    tp_aot_op(tp, f, code + 2985);
+L3238: /* STRING */
+    tp_aot_op(tp, f, code + 3238);
+L3242: /* GSET */
+    tp_set(tp, f->globals, regs[9], regs[8]);
+L3243: /* LINE */
+    f->line = code + 3243;
+    f->lineno = 119;
+L3250: /* VAR */
+L3253: /* STRING */
+    tp_aot_op(tp, f, code + 3253);
+L3256: /* STRING */
+    tp_aot_op(tp, f, code + 3256);
+L3259: /* STRING */
+    tp_aot_op(tp, f, code + 3259);
+L3262: /* LIST */
+    tp_aot_op(tp, f, code + 3262);
+L3263: /* LIST */
+    tp_aot_op(tp, f, code + 3263);
+L3264: /* NONE */
+    regs[12] = tp_None;
+L3265: /* NONE */
+    regs[13] = tp_None;
+L3266: /* DEF */
+    tp_aot_op(tp, f, code + 3266);
+L3560: /* STRING */
+    tp_aot_op(tp, f, code + 3560);
+L3565: /* GSET */
+    tp_set(tp, f->globals, regs[10], regs[9]);
+L3566: /* LINE */
+    f->line = code + 3566;
+    f->lineno = 134;
+L3573: /* VAR */
+L3576: /* STRING */
+    tp_aot_op(tp, f, code + 3576);
+L3579: /* STRING */
+    tp_aot_op(tp, f, code + 3579);
+L3582: /* STRING */
+    tp_aot_op(tp, f, code + 3582);
+L3585: /* LIST */
+    tp_aot_op(tp, f, code + 3585);
+L3586: /* LIST */
+    tp_aot_op(tp, f, code + 3586);
+L3587: /* NONE */
+    regs[13] = tp_None;
+L3588: /* NONE */
+    regs[14] = tp_None;
+L3589: /* DEF */
+    tp_aot_op(tp, f, code + 3589);
+L3858: /* STRING */
+    tp_aot_op(tp, f, code + 3858);
+L3863: /* GSET */
+    tp_set(tp, f->globals, regs[11], regs[10]);
+L3864: /* LINE */
+    f->line = code + 3864;
+    f->lineno = 151;
+L3870: /* VAR */
+L3873: /* STRING */
+    tp_aot_op(tp, f, code + 3873);
+L3876: /* STRING */
+    tp_aot_op(tp, f, code + 3876);
+L3879: /* STRING */
+    tp_aot_op(tp, f, code + 3879);
+L3882: /* LIST */
+    tp_aot_op(tp, f, code + 3882);
+L3883: /* LIST */
+    tp_aot_op(tp, f, code + 3883);
+L3884: /* NONE */
+    regs[14] = tp_None;
+L3885: /* NONE */
+    regs[15] = tp_None;
+L3886: /* DEF */
+    tp_aot_op(tp, f, code + 3886);
+L4092: /* STRING */
+    tp_aot_op(tp, f, code + 4092);
+L4096: /* GSET */
+    tp_set(tp, f->globals, regs[12], regs[11]);
+L4097: /* LINE */
+    f->line = code + 4097;
+    f->lineno = 161;
+L4104: /* VAR */
+L4107: /* STRING */
+    tp_aot_op(tp, f, code + 4107);
+L4110: /* STRING */
+    tp_aot_op(tp, f, code + 4110);
+L4113: /* STRING */
+    tp_aot_op(tp, f, code + 4113);
+L4116: /* LIST */
+    tp_aot_op(tp, f, code + 4116);
+L4117: /* LIST */
+    tp_aot_op(tp, f, code + 4117);
+L4118: /* NONE */
+    regs[15] = tp_None;
+L4119: /* NONE */
+    regs[16] = tp_None;
+L4120: /* DEF */
+    tp_aot_op(tp, f, code + 4120);
+L4767: /* STRING */
+    tp_aot_op(tp, f, code + 4767);
+L4772: /* GSET */
+    tp_set(tp, f->globals, regs[13], regs[12]);
+L4773: /* LINE */
+    f->line = code + 4773;
+    f->lineno = 198;
+L4780: /* VAR */
+L4783: /* STRING */
+    tp_aot_op(tp, f, code + 4783);
+L4786: /* STRING */
+    tp_aot_op(tp, f, code + 4786);
+L4789: /* STRING */
+    tp_aot_op(tp, f, code + 4789);
+L4792: /* LIST */
+    tp_aot_op(tp, f, code + 4792);
+L4793: /* LIST */
+    tp_aot_op(tp, f, code + 4793);
+L4794: /* NONE */
+    regs[16] = tp_None;
+L4795: /* NONE */
+    regs[17] = tp_None;
+L4796: /* DEF */
+    tp_aot_op(tp, f, code + 4796);
+L4884: /* STRING */
+    tp_aot_op(tp, f, code + 4884);
+L4889: /* GSET */
+    tp_set(tp, f->globals, regs[14], regs[13]);
+L4890: /* EOF */
+    return code + 4890;
+}
+
+static tpd_code * _tp_tinypy_compiler_tokenize_80(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 25: goto L25;
+        case 27: goto L27;
+        case 31: goto L31;
+        case 34: goto L34;
+        case 38: goto L38;
+        case 41: goto L41;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 49: goto L49;
+        case 52: goto L52;
+        case 53: goto L53;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 150: goto L150;
+        case 154: goto L154;
+        case 155: goto L155;
+        case 162: goto L162;
+        case 165: goto L165;
+        case 169: goto L169;
+        case 170: goto L170;
+        case 171: goto L171;
+        case 172: goto L172;
+        case 173: goto L173;
+        case 344: goto L344;
+        case 347: goto L347;
+        case 348: goto L348;
+        case 355: goto L355;
+        case 358: goto L358;
+        case 362: goto L362;
+        case 363: goto L363;
+        case 364: goto L364;
+        case 365: goto L365;
+        case 366: goto L366;
+        case 413: goto L413;
+        case 417: goto L417;
+        case 418: goto L418;
+        case 426: goto L426;
+        case 429: goto L429;
+        case 433: goto L433;
+        case 434: goto L434;
+        case 435: goto L435;
+        case 436: goto L436;
+        case 437: goto L437;
+        case 551: goto L551;
+        case 555: goto L555;
+        case 556: goto L556;
+        case 565: goto L565;
+        case 568: goto L568;
+        case 572: goto L572;
+        case 576: goto L576;
+        case 577: goto L577;
+        case 578: goto L578;
+        case 579: goto L579;
+        case 580: goto L580;
+        case 641: goto L641;
+        case 644: goto L644;
+        case 645: goto L645;
+        case 649: goto L649;
+        case 652: goto L652;
+        case 657: goto L657;
+        case 658: goto L658;
+        case 662: goto L662;
+        case 663: goto L663;
+        case 668: goto L668;
+        case 669: goto L669;
+        case 674: goto L674;
+        case 675: goto L675;
+        case 679: goto L679;
+        case 680: goto L680;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 3;
+L7: /* LINE */
+    f->line = code + 7;
+    f->lineno = 4;
+L25: /* VAR */
+L27: /* STRING */
+    tp_aot_op(tp, f, code + 27);
+L31: /* STRING */
+    tp_aot_op(tp, f, code + 31);
+L34: /* STRING */
+    tp_aot_op(tp, f, code + 34);
+L38: /* STRING */
+    tp_aot_op(tp, f, code + 38);
+L41: /* STRING */
+    tp_aot_op(tp, f, code + 41);
+L45: /* LIST */
+    tp_aot_op(tp, f, code + 45);
+L46: /* NUMBER */
+    tp_aot_op(tp, f, code + 46);
+L49: /* NUMBER */
+    tp_aot_op(tp, f, code + 49);
+L52: /* LIST */
+    tp_aot_op(tp, f, code + 52);
+L53: /* STRING */
+    tp_aot_op(tp, f, code + 53);
+L57: /* NONE */
+    regs[7] = tp_None;
+L58: /* NONE */
+    regs[8] = tp_None;
+L59: /* LIST */
+    tp_aot_op(tp, f, code + 59);
+L60: /* NONE */
+    regs[3] = tp_None;
+L61: /* NONE */
+    regs[4] = tp_None;
+L62: /* DEF */
+    tp_aot_op(tp, f, code + 62);
+L150: /* VAR */
+L154: /* MOVE */
+    regs[1] = regs[0];
+L155: /* LINE */
+    f->line = code + 155;
+    f->lineno = 7;
+L162: /* VAR */
+L165: /* STRING */
+    tp_aot_op(tp, f, code + 165);
+L169: /* LIST */
+    tp_aot_op(tp, f, code + 169);
+L170: /* LIST */
+    tp_aot_op(tp, f, code + 170);
+L171: /* NONE */
+    regs[5] = tp_None;
+L172: /* NONE */
+    regs[6] = tp_None;
+L173: /* DEF */
+    tp_aot_op(tp, f, code + 173);
+L344: /* VAR */
+L347: /* MOVE */
+    regs[3] = regs[2];
+L348: /* LINE */
+    f->line = code + 348;
+    f->lineno = 12;
+L355: /* VAR */
+L358: /* STRING */
+    tp_aot_op(tp, f, code + 358);
+L362: /* LIST */
+    tp_aot_op(tp, f, code + 362);
+L363: /* LIST */
+    tp_aot_op(tp, f, code + 363);
+L364: /* NONE */
+    regs[7] = tp_None;
+L365: /* NONE */
+    regs[8] = tp_None;
+L366: /* DEF */
+    tp_aot_op(tp, f, code + 366);
+L413: /* VAR */
+L417: /* MOVE */
+    regs[5] = regs[4];
+L418: /* LINE */
+    f->line = code + 418;
+    f->lineno = 15;
+L426: /* VAR */
+L429: /* STRING */
+    tp_aot_op(tp, f, code + 429);
+L433: /* LIST */
+    tp_aot_op(tp, f, code + 433);
+L434: /* LIST */
+    tp_aot_op(tp, f, code + 434);
+L435: /* NONE */
+    regs[9] = tp_None;
+L436: /* NONE */
+    regs[10] = tp_None;
+L437: /* DEF */
+    tp_aot_op(tp, f, code + 437);
+L551: /* VAR */
+L555: /* MOVE */
+    regs[7] = regs[6];
+L556: /* LINE */
+    f->line = code + 556;
+    f->lineno = 21;
+L565: /* VAR */
+L568: /* STRING */
+    tp_aot_op(tp, f, code + 568);
+L572: /* STRING */
+    tp_aot_op(tp, f, code + 572);
+L576: /* LIST */
+    tp_aot_op(tp, f, code + 576);
+L577: /* LIST */
+    tp_aot_op(tp, f, code + 577);
+L578: /* NONE */
+    regs[11] = tp_None;
+L579: /* NONE */
+    regs[12] = tp_None;
+L580: /* DEF */
+    tp_aot_op(tp, f, code + 580);
+L641: /* VAR */
+L644: /* MOVE */
+    regs[9] = regs[8];
+L645: /* GGET */
+    tp_aot_op(tp, f, code + 645);
+L649: /* VAR */
+L652: /* STRING */
+    tp_aot_op(tp, f, code + 652);
+L657: /* SET */
+    tp_set(tp, regs[10], regs[11], regs[1]);
+L658: /* STRING */
+    tp_aot_op(tp, f, code + 658);
+L662: /* SET */
+    tp_set(tp, regs[10], regs[11], regs[3]);
+L663: /* STRING */
+    tp_aot_op(tp, f, code + 663);
+L668: /* SET */
+    tp_set(tp, regs[10], regs[11], regs[5]);
+L669: /* STRING */
+    tp_aot_op(tp, f, code + 669);
+L674: /* SET */
+    tp_set(tp, regs[10], regs[11], regs[7]);
+L675: /* STRING */
+    tp_aot_op(tp, f, code + 675);
+L679: /* SET */
+    tp_set(tp, regs[10], regs[11], regs[9]);
+L680: /* EOF */
+    return code + 680;
+}
+
+static tpd_code * _tp_tinypy_compiler_tokenize_788(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 15: goto L15;
+        case 24: goto L24;
+        case 25: goto L25;
+        case 29: goto L29;
+        case 30: goto L30;
+        case 34: goto L34;
+        case 36: goto L36;
+        case 38: goto L38;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 44: goto L44;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 57: goto L57;
+        case 60: goto L60;
+        case 64: goto L64;
+        case 66: goto L66;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 73: goto L73;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 79: goto L79;
+        case 81: goto L81;
+        case 84: goto L84;
+        case 91: goto L91;
+        case 94: goto L94;
+        case 95: goto L95;
+        case 96: goto L96;
+        case 97: goto L97;
+        case 100: goto L100;
+        case 101: goto L101;
+        case 109: goto L109;
+        case 112: goto L112;
+        case 113: goto L113;
+        case 114: goto L114;
+        case 115: goto L115;
+        case 118: goto L118;
+        case 119: goto L119;
+        case 130: goto L130;
+        case 132: goto L132;
+        case 135: goto L135;
+        case 136: goto L136;
+        case 137: goto L137;
+        case 138: goto L138;
+        case 141: goto L141;
+        case 142: goto L142;
+        case 143: goto L143;
+        case 146: goto L146;
+        case 147: goto L147;
+        case 157: goto L157;
+        case 161: goto L161;
+        case 164: goto L164;
+        case 165: goto L165;
+        case 166: goto L166;
+        case 169: goto L169;
+        case 170: goto L170;
+        case 173: goto L173;
+        case 174: goto L174;
+        case 175: goto L175;
+        case 187: goto L187;
+        case 192: goto L192;
+        case 196: goto L196;
+        case 197: goto L197;
+        case 200: goto L200;
+        case 201: goto L201;
+        case 202: goto L202;
+        case 203: goto L203;
+        case 204: goto L204;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 25;
+L9: /* VAR */
+L11: /* VAR */
+L13: /* VAR */
+L15: /* STRING */
+    tp_aot_op(tp, f, code + 15);
+L24: /* FILE */
+    f->fname = regs[3];
+L25: /* STRING */
+    tp_aot_op(tp, f, code + 25);
+L29: /* NAME */
+    f->name = regs[3];
+L30: /* LINE */
+    f->line = code + 30;
+    f->lineno = 26;
+L34: /* VAR */
+L36: /* VAR */
+L38: /* NUMBER */
+    tp_aot_op(tp, f, code + 38);
+L41: /* GET */
+    regs[3] = tp_get(tp, regs[2], regs[4]);
+    tp_grey(tp, regs[3]);
+L42: /* VAR */
+L44: /* NUMBER */
+    tp_aot_op(tp, f, code + 44);
+L47: /* GET */
+    regs[10] = tp_get(tp, regs[2], regs[5]);
+    tp_grey(tp, regs[10]);
+L48: /* LINE */
+    f->line = code + 48;
+    f->lineno = 27;
+L57: /* VAR */
+L60: /* STRING */
+    tp_aot_op(tp, f, code + 60);
+L64: /* METHOD */
+    tp_aot_op(tp, f, code + 64);
+L66: /* STRING */
+    tp_aot_op(tp, f, code + 66);
+L69: /* CALLM */
+    return code + 69;
+L70: /* NUMBER */
+    tp_aot_op(tp, f, code + 70);
+L73: /* SUB */
+    if (TP_BOTH(regs[3], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[3].nint - regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 73);
+    }
+L74: /* GET */
+    regs[2] = tp_get(tp, regs[4], regs[5]);
+    tp_grey(tp, regs[2]);
+L75: /* LINE */
+    f->line = code + 75;
+    f->lineno = 28;
+L79: /* VAR */
+L81: /* STRING */
+    tp_aot_op(tp, f, code + 81);
+L84: /* LINE */
+    f->line = code + 84;
+    f->lineno = 29;
+L91: /* NUMBER */
+    tp_aot_op(tp, f, code + 91);
+L94: /* LT */
+    if (TP_BOTH(regs[3], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[3].nint < regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 94);
+    }
+L95: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L97;
+    }
+L96: /* JUMP */
+    goto L101;
+L97: /* STRING */
+    tp_aot_op(tp, f, code + 97);
+L100: /* ADD */
+    if (TP_BOTH(regs[4], regs[6], TP_NUMBER_INT)) {
+        regs[4] = tp_int(regs[4].nint + regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 100);
+    }
+L101: /* LINE */
+    f->line = code + 101;
+    f->lineno = 30;
+L109: /* NUMBER */
+    tp_aot_op(tp, f, code + 109);
+L112: /* LT */
+    if (TP_BOTH(regs[3], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[3].nint < regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 112);
+    }
+L113: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L115;
+    }
+L114: /* JUMP */
+    goto L119;
+L115: /* STRING */
+    tp_aot_op(tp, f, code + 115);
+L118: /* ADD */
+    if (TP_BOTH(regs[4], regs[6], TP_NUMBER_INT)) {
+        regs[4] = tp_int(regs[4].nint + regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 118);
+    }
+L119: /* LINE */
+    f->line = code + 119;
+    f->lineno = 31;
+L130: /* VAR */
+L132: /* GGET */
+    tp_aot_op(tp, f, code + 132);
+L135: /* MOVE */
+    regs[9] = regs[3];
+L136: /* CALLP */
+    return code + 136;
+L137: /* ADD */
+    if (TP_BOTH(regs[4], regs[7], TP_NUMBER_INT)) {
+        regs[6] = tp_int(regs[4].nint + regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 137);
+    }
+L138: /* STRING */
+    tp_aot_op(tp, f, code + 138);
+L141: /* ADD */
+    if (TP_BOTH(regs[6], regs[7], TP_NUMBER_INT)) {
+        regs[6] = tp_int(regs[6].nint + regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 141);
+    }
+L142: /* ADD */
+    if (TP_BOTH(regs[6], regs[2], TP_NUMBER_INT)) {
+        regs[6] = tp_int(regs[6].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 142);
+    }
+L143: /* STRING */
+    tp_aot_op(tp, f, code + 143);
+L146: /* ADD */
+    if (TP_BOTH(regs[6], regs[7], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[6].nint + regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 146);
+    }
+L147: /* LINE */
+    f->line = code + 147;
+    f->lineno = 32;
+L157: /* STRING */
+    tp_aot_op(tp, f, code + 157);
+L161: /* STRING */
+    tp_aot_op(tp, f, code + 161);
+L164: /* MUL */
+    if (TP_BOTH(regs[8], regs[10], TP_NUMBER_INT)) {
+        regs[8] = tp_int(regs[8].nint * regs[10].nint);
+    } else {
+        tp_aot_op(tp, f, code + 164);
+    }
+L165: /* ADD */
+    if (TP_BOTH(regs[7], regs[8], TP_NUMBER_INT)) {
+        regs[7] = tp_int(regs[7].nint + regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 165);
+    }
+L166: /* STRING */
+    tp_aot_op(tp, f, code + 166);
+L169: /* ADD */
+    if (TP_BOTH(regs[7], regs[8], TP_NUMBER_INT)) {
+        regs[7] = tp_int(regs[7].nint + regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 169);
+    }
+L170: /* STRING */
+    tp_aot_op(tp, f, code + 170);
+L173: /* ADD */
+    if (TP_BOTH(regs[7], regs[8], TP_NUMBER_INT)) {
+        regs[7] = tp_int(regs[7].nint + regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 173);
+    }
+L174: /* ADD */
+    if (TP_BOTH(regs[5], regs[7], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[5].nint + regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 174);
+    }
+L175: /* LINE */
+    f->line = code + 175;
+    f->lineno = 33;
+L187: /* GGET */
+    tp_aot_op(tp, f, code + 187);
+L192: /* STRING */
+    tp_aot_op(tp, f, code + 192);
+L196: /* ADD */
+    if (TP_BOTH(regs[8], regs[0], TP_NUMBER_INT)) {
+        regs[8] = tp_int(regs[8].nint + regs[0].nint);
+    } else {
+        tp_aot_op(tp, f, code + 196);
+    }
+L197: /* STRING */
+    tp_aot_op(tp, f, code + 197);
+L200: /* ADD */
+    if (TP_BOTH(regs[8], regs[9], TP_NUMBER_INT)) {
+        regs[8] = tp_int(regs[8].nint + regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 200);
+    }
+L201: /* ADD */
+    if (TP_BOTH(regs[8], regs[5], TP_NUMBER_INT)) {
+        regs[8] = tp_int(regs[8].nint + regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 201);
+    }
+L202: /* CALLP */
+    return code + 202;
+L203: /* RAISE */
+    return code + 203;
+L204: /* EOF */
+    return code + 204;
+}
+
+static tpd_code * _tp_tinypy_compiler_tokenize_1436(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 14: goto L14;
+        case 16: goto L16;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 123: goto L123;
+        case 127: goto L127;
+        case 128: goto L128;
+        case 144: goto L144;
+        case 146: goto L146;
+        case 150: goto L150;
+        case 153: goto L153;
+        case 156: goto L156;
+        case 157: goto L157;
+        case 158: goto L158;
+        case 159: goto L159;
+        case 160: goto L160;
+        case 225: goto L225;
+        case 227: goto L227;
+        case 228: goto L228;
+        case 232: goto L232;
+        case 235: goto L235;
+        case 240: goto L240;
+        case 241: goto L241;
+        case 244: goto L244;
+        case 245: goto L245;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 46;
+L7: /* LINE */
+    f->line = code + 7;
+    f->lineno = 47;
+L14: /* VAR */
+L16: /* STRING */
+    tp_aot_op(tp, f, code + 16);
+L20: /* LIST */
+    tp_aot_op(tp, f, code + 20);
+L21: /* LIST */
+    tp_aot_op(tp, f, code + 21);
+L22: /* NONE */
+    regs[3] = tp_None;
+L23: /* NONE */
+    regs[4] = tp_None;
+L24: /* DEF */
+    tp_aot_op(tp, f, code + 24);
+L123: /* VAR */
+L127: /* MOVE */
+    regs[1] = regs[0];
+L128: /* LINE */
+    f->line = code + 128;
+    f->lineno = 50;
+L144: /* VAR */
+L146: /* STRING */
+    tp_aot_op(tp, f, code + 146);
+L150: /* STRING */
+    tp_aot_op(tp, f, code + 150);
+L153: /* STRING */
+    tp_aot_op(tp, f, code + 153);
+L156: /* LIST */
+    tp_aot_op(tp, f, code + 156);
+L157: /* LIST */
+    tp_aot_op(tp, f, code + 157);
+L158: /* NONE */
+    regs[5] = tp_None;
+L159: /* NONE */
+    regs[6] = tp_None;
+L160: /* DEF */
+    tp_aot_op(tp, f, code + 160);
+L225: /* VAR */
+L227: /* MOVE */
+    regs[3] = regs[2];
+L228: /* GGET */
+    tp_aot_op(tp, f, code + 228);
+L232: /* VAR */
+L235: /* STRING */
+    tp_aot_op(tp, f, code + 235);
+L240: /* SET */
+    tp_set(tp, regs[4], regs[5], regs[1]);
+L241: /* STRING */
+    tp_aot_op(tp, f, code + 241);
+L244: /* SET */
+    tp_set(tp, regs[4], regs[5], regs[3]);
+L245: /* EOF */
+    return code + 245;
+}
+
+static tpd_code * _tp_tinypy_compiler_tokenize_1701(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 33: goto L33;
+        case 37: goto L37;
+        case 39: goto L39;
+        case 42: goto L42;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 55: goto L55;
+        case 59: goto L59;
+        case 61: goto L61;
+        case 64: goto L64;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 73: goto L73;
+        case 74: goto L74;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 52;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 53;
+L33: /* STRING */
+    tp_aot_op(tp, f, code + 33);
+L37: /* METHOD */
+    tp_aot_op(tp, f, code + 37);
+L39: /* STRING */
+    tp_aot_op(tp, f, code + 39);
+L42: /* STRING */
+    tp_aot_op(tp, f, code + 42);
+L45: /* CALLM */
+    return code + 45;
+L46: /* LINE */
+    f->line = code + 46;
+    f->lineno = 54;
+L55: /* STRING */
+    tp_aot_op(tp, f, code + 55);
+L59: /* METHOD */
+    tp_aot_op(tp, f, code + 59);
+L61: /* STRING */
+    tp_aot_op(tp, f, code + 61);
+L64: /* STRING */
+    tp_aot_op(tp, f, code + 64);
+L67: /* CALLM */
+    return code + 67;
+L68: /* LINE */
+    f->line = code + 68;
+    f->lineno = 55;
+L73: /* RETURN */
+    return code + 73;
+L74: /* EOF */
+    return code + 74;
+}
+
+static tpd_code * _tp_tinypy_compiler_tokenize_1798(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 31: goto L31;
+        case 37: goto L37;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 52: goto L52;
+        case 56: goto L56;
+        case 57: goto L57;
+        case 60: goto L60;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 65: goto L65;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 71: goto L71;
+        case 72: goto L72;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 79: goto L79;
+        case 80: goto L80;
+        case 90: goto L90;
+        case 95: goto L95;
+        case 96: goto L96;
+        case 97: goto L97;
+        case 98: goto L98;
+        case 99: goto L99;
+        case 100: goto L100;
+        case 110: goto L110;
+        case 114: goto L114;
+        case 119: goto L119;
+        case 120: goto L120;
+        case 123: goto L123;
+        case 126: goto L126;
+        case 128: goto L128;
+        case 129: goto L129;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 57;
+L8: /* VAR */
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L19: /* FILE */
+    f->fname = regs[1];
+L20: /* STRING */
+    tp_aot_op(tp, f, code + 20);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 58;
+L31: /* LINE */
+    f->line = code + 31;
+    f->lineno = 59;
+L37: /* GGET */
+    tp_aot_op(tp, f, code + 37);
+L41: /* MOVE */
+    regs[3] = regs[0];
+L42: /* CALLP */
+    return code + 42;
+L43: /* LINE */
+    f->line = code + 43;
+    f->lineno = 60;
+L52: /* GGET */
+    tp_aot_op(tp, f, code + 52);
+L56: /* CALLP */
+    return code + 56;
+L57: /* NUMBER */
+    tp_aot_op(tp, f, code + 57);
+L60: /* GGET */
+    tp_aot_op(tp, f, code + 60);
+L63: /* MOVE */
+    regs[6] = regs[0];
+L64: /* CALLP */
+    return code + 64;
+L65: /* STRING */
+    tp_aot_op(tp, f, code + 65);
+L68: /* GSET */
+    tp_set(tp, f->globals, regs[4], regs[1]);
+L69: /* VAR */
+L71: /* MOVE */
+    regs[1] = regs[2];
+L72: /* VAR */
+L74: /* MOVE */
+    regs[2] = regs[3];
+L75: /* LINE */
+    f->line = code + 75;
+    f->lineno = 61;
+L79: /* SETJMP */
+    f->jmp = code + 100;
+L80: /* LINE */
+    f->line = code + 80;
+    f->lineno = 62;
+L90: /* GGET */
+    tp_aot_op(tp, f, code + 90);
+L95: /* MOVE */
+    regs[5] = regs[0];
+L96: /* MOVE */
+    regs[6] = regs[1];
+L97: /* MOVE */
+    regs[7] = regs[2];
+L98: /* CALLP */
+    return code + 98;
+L99: /* RETURN */
+    return code + 99;
+L100: /* LINE */
+    f->line = code + 100;
+    f->lineno = 64;
+L110: /* GGET */
+    tp_aot_op(tp, f, code + 110);
+L114: /* STRING */
+    tp_aot_op(tp, f, code + 114);
+L119: /* MOVE */
+    regs[6] = regs[0];
+L120: /* GGET */
+    tp_aot_op(tp, f, code + 120);
+L123: /* STRING */
+    tp_aot_op(tp, f, code + 123);
+L126: /* MGET */
+    tp_aot_op(tp, f, code + 126);
+L128: /* CALLP */
+    return code + 128;
+L129: /* EOF */
+    return code + 129;
+}
+
+static tpd_code * _tp_tinypy_compiler_tokenize_1958(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 15: goto L15;
+        case 24: goto L24;
+        case 25: goto L25;
+        case 30: goto L30;
+        case 31: goto L31;
+        case 36: goto L36;
+        case 44: goto L44;
+        case 47: goto L47;
+        case 50: goto L50;
+        case 53: goto L53;
+        case 55: goto L55;
+        case 58: goto L58;
+        case 61: goto L61;
+        case 63: goto L63;
+        case 64: goto L64;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 72: goto L72;
+        case 73: goto L73;
+        case 79: goto L79;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 93: goto L93;
+        case 95: goto L95;
+        case 96: goto L96;
+        case 99: goto L99;
+        case 102: goto L102;
+        case 105: goto L105;
+        case 107: goto L107;
+        case 110: goto L110;
+        case 113: goto L113;
+        case 115: goto L115;
+        case 116: goto L116;
+        case 119: goto L119;
+        case 120: goto L120;
+        case 121: goto L121;
+        case 124: goto L124;
+        case 125: goto L125;
+        case 139: goto L139;
+        case 142: goto L142;
+        case 145: goto L145;
+        case 147: goto L147;
+        case 148: goto L148;
+        case 149: goto L149;
+        case 152: goto L152;
+        case 155: goto L155;
+        case 158: goto L158;
+        case 159: goto L159;
+        case 164: goto L164;
+        case 165: goto L165;
+        case 166: goto L166;
+        case 167: goto L167;
+        case 168: goto L168;
+        case 169: goto L169;
+        case 181: goto L181;
+        case 184: goto L184;
+        case 185: goto L185;
+        case 186: goto L186;
+        case 187: goto L187;
+        case 191: goto L191;
+        case 192: goto L192;
+        case 193: goto L193;
+        case 194: goto L194;
+        case 195: goto L195;
+        case 196: goto L196;
+        case 210: goto L210;
+        case 215: goto L215;
+        case 216: goto L216;
+        case 217: goto L217;
+        case 218: goto L218;
+        case 223: goto L223;
+        case 224: goto L224;
+        case 225: goto L225;
+        case 226: goto L226;
+        case 227: goto L227;
+        case 228: goto L228;
+        case 244: goto L244;
+        case 247: goto L247;
+        case 248: goto L248;
+        case 249: goto L249;
+        case 250: goto L250;
+        case 253: goto L253;
+        case 254: goto L254;
+        case 255: goto L255;
+        case 256: goto L256;
+        case 261: goto L261;
+        case 262: goto L262;
+        case 263: goto L263;
+        case 264: goto L264;
+        case 265: goto L265;
+        case 266: goto L266;
+        case 282: goto L282;
+        case 285: goto L285;
+        case 286: goto L286;
+        case 287: goto L287;
+        case 288: goto L288;
+        case 291: goto L291;
+        case 292: goto L292;
+        case 293: goto L293;
+        case 296: goto L296;
+        case 297: goto L297;
+        case 298: goto L298;
+        case 299: goto L299;
+        case 302: goto L302;
+        case 303: goto L303;
+        case 304: goto L304;
+        case 307: goto L307;
+        case 308: goto L308;
+        case 309: goto L309;
+        case 310: goto L310;
+        case 316: goto L316;
+        case 319: goto L319;
+        case 320: goto L320;
+        case 330: goto L330;
+        case 335: goto L335;
+        case 336: goto L336;
+        case 337: goto L337;
+        case 338: goto L338;
+        case 339: goto L339;
+        case 340: goto L340;
+        case 354: goto L354;
+        case 357: goto L357;
+        case 358: goto L358;
+        case 359: goto L359;
+        case 360: goto L360;
+        case 363: goto L363;
+        case 364: goto L364;
+        case 365: goto L365;
+        case 366: goto L366;
+        case 371: goto L371;
+        case 372: goto L372;
+        case 373: goto L373;
+        case 374: goto L374;
+        case 375: goto L375;
+        case 376: goto L376;
+        case 395: goto L395;
+        case 407: goto L407;
+        case 410: goto L410;
+        case 411: goto L411;
+        case 412: goto L412;
+        case 413: goto L413;
+        case 416: goto L416;
+        case 417: goto L417;
+        case 418: goto L418;
+        case 419: goto L419;
+        case 438: goto L438;
+        case 441: goto L441;
+        case 442: goto L442;
+        case 443: goto L443;
+        case 444: goto L444;
+        case 447: goto L447;
+        case 448: goto L448;
+        case 449: goto L449;
+        case 450: goto L450;
+        case 453: goto L453;
+        case 454: goto L454;
+        case 455: goto L455;
+        case 456: goto L456;
+        case 460: goto L460;
+        case 461: goto L461;
+        case 462: goto L462;
+        case 463: goto L463;
+        case 464: goto L464;
+        case 465: goto L465;
+        case 477: goto L477;
+        case 480: goto L480;
+        case 481: goto L481;
+        case 482: goto L482;
+        case 483: goto L483;
+        case 488: goto L488;
+        case 489: goto L489;
+        case 490: goto L490;
+        case 491: goto L491;
+        case 492: goto L492;
+        case 493: goto L493;
+        case 505: goto L505;
+        case 508: goto L508;
+        case 509: goto L509;
+        case 510: goto L510;
+        case 511: goto L511;
+        case 514: goto L514;
+        case 515: goto L515;
+        case 516: goto L516;
+        case 519: goto L519;
+        case 520: goto L520;
+        case 521: goto L521;
+        case 522: goto L522;
+        case 533: goto L533;
+        case 536: goto L536;
+        case 537: goto L537;
+        case 540: goto L540;
+        case 543: goto L543;
+        case 545: goto L545;
+        case 548: goto L548;
+        case 549: goto L549;
+        case 550: goto L550;
+        case 553: goto L553;
+        case 556: goto L556;
+        case 557: goto L557;
+        case 560: goto L560;
+        case 563: goto L563;
+        case 564: goto L564;
+        case 565: goto L565;
+        case 577: goto L577;
+        case 580: goto L580;
+        case 581: goto L581;
+        case 582: goto L582;
+        case 583: goto L583;
+        case 586: goto L586;
+        case 587: goto L587;
+        case 588: goto L588;
+        case 589: goto L589;
+        case 592: goto L592;
+        case 593: goto L593;
+        case 594: goto L594;
+        case 605: goto L605;
+        case 609: goto L609;
+        case 614: goto L614;
+        case 615: goto L615;
+        case 618: goto L618;
+        case 621: goto L621;
+        case 623: goto L623;
+        case 624: goto L624;
+        case 625: goto L625;
+        case 630: goto L630;
+        case 634: goto L634;
+        case 637: goto L637;
+        case 638: goto L638;
+        case 645: goto L645;
+        case 647: goto L647;
+        case 650: goto L650;
+        case 653: goto L653;
+        case 655: goto L655;
+        case 658: goto L658;
+        case 659: goto L659;
+        case 660: goto L660;
+        case 665: goto L665;
+        case 666: goto L666;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 66;
+L9: /* VAR */
+L11: /* VAR */
+L13: /* VAR */
+L15: /* STRING */
+    tp_aot_op(tp, f, code + 15);
+L24: /* FILE */
+    f->fname = regs[3];
+L25: /* STRING */
+    tp_aot_op(tp, f, code + 25);
+L30: /* NAME */
+    f->name = regs[3];
+L31: /* LINE */
+    f->line = code + 31;
+    f->lineno = 67;
+L36: /* LINE */
+    f->line = code + 36;
+    f->lineno = 68;
+L44: /* GGET */
+    tp_aot_op(tp, f, code + 44);
+L47: /* GGET */
+    tp_aot_op(tp, f, code + 47);
+L50: /* STRING */
+    tp_aot_op(tp, f, code + 50);
+L53: /* MGET */
+    tp_aot_op(tp, f, code + 53);
+L55: /* GGET */
+    tp_aot_op(tp, f, code + 55);
+L58: /* STRING */
+    tp_aot_op(tp, f, code + 58);
+L61: /* MGET */
+    tp_aot_op(tp, f, code + 61);
+L63: /* SUB */
+    if (TP_BOTH(regs[1], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[1].nint - regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 63);
+    }
+L64: /* NUMBER */
+    tp_aot_op(tp, f, code + 64);
+L67: /* ADD */
+    if (TP_BOTH(regs[5], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[5].nint + regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 67);
+    }
+L68: /* LIST */
+    tp_aot_op(tp, f, code + 68);
+L69: /* STRING */
+    tp_aot_op(tp, f, code + 69);
+L72: /* SET */
+    tp_set(tp, regs[3], regs[4], regs[8]);
+L73: /* LINE */
+    f->line = code + 73;
+    f->lineno = 69;
+L79: /* LT */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[3] = tp_bool(regs[1].nint < regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 79);
+    }
+L80: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L82;
+    }
+L81: /* JUMP */
+    goto L625;
+L82: /* LINE */
+    f->line = code + 82;
+    f->lineno = 70;
+L93: /* VAR */
+L95: /* GET */
+    regs[3] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[3]);
+L96: /* GGET */
+    tp_aot_op(tp, f, code + 96);
+L99: /* GGET */
+    tp_aot_op(tp, f, code + 99);
+L102: /* STRING */
+    tp_aot_op(tp, f, code + 102);
+L105: /* MGET */
+    tp_aot_op(tp, f, code + 105);
+L107: /* GGET */
+    tp_aot_op(tp, f, code + 107);
+L110: /* STRING */
+    tp_aot_op(tp, f, code + 110);
+L113: /* MGET */
+    tp_aot_op(tp, f, code + 113);
+L115: /* SUB */
+    if (TP_BOTH(regs[1], regs[7], TP_NUMBER_INT)) {
+        regs[6] = tp_int(regs[1].nint - regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 115);
+    }
+L116: /* NUMBER */
+    tp_aot_op(tp, f, code + 116);
+L119: /* ADD */
+    if (TP_BOTH(regs[6], regs[7], TP_NUMBER_INT)) {
+        regs[6] = tp_int(regs[6].nint + regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 119);
+    }
+L120: /* LIST */
+    tp_aot_op(tp, f, code + 120);
+L121: /* STRING */
+    tp_aot_op(tp, f, code + 121);
+L124: /* SET */
+    tp_set(tp, regs[8], regs[5], regs[4]);
+L125: /* LINE */
+    f->line = code + 125;
+    f->lineno = 71;
+L139: /* GGET */
+    tp_aot_op(tp, f, code + 139);
+L142: /* STRING */
+    tp_aot_op(tp, f, code + 142);
+L145: /* MGET */
+    tp_aot_op(tp, f, code + 145);
+L147: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L149;
+    }
+L148: /* JUMP */
+    goto L169;
+L149: /* GGET */
+    tp_aot_op(tp, f, code + 149);
+L152: /* NUMBER */
+    tp_aot_op(tp, f, code + 152);
+L155: /* STRING */
+    tp_aot_op(tp, f, code + 155);
+L158: /* SET */
+    tp_set(tp, regs[8], regs[5], regs[4]);
+L159: /* GGET */
+    tp_aot_op(tp, f, code + 159);
+L164: /* MOVE */
+    regs[5] = regs[0];
+L165: /* MOVE */
+    regs[6] = regs[1];
+L166: /* MOVE */
+    regs[7] = regs[2];
+L167: /* CALLP */
+    return code + 167;
+L168: /* JUMP */
+    tp_aot_safepoint(tp, 89);
+    goto L79;
+L169: /* LINE */
+    f->line = code + 169;
+    f->lineno = 72;
+L181: /* STRING */
+    tp_aot_op(tp, f, code + 181);
+L184: /* EQ */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[3].nint == regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 184);
+    }
+L185: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L187;
+    }
+L186: /* JUMP */
+    goto L196;
+L187: /* GGET */
+    tp_aot_op(tp, f, code + 187);
+L191: /* MOVE */
+    regs[5] = regs[0];
+L192: /* MOVE */
+    regs[6] = regs[1];
+L193: /* MOVE */
+    regs[7] = regs[2];
+L194: /* CALLP */
+    return code + 194;
+L195: /* JUMP */
+    tp_aot_safepoint(tp, 116);
+    goto L79;
+L196: /* LINE */
+    f->line = code + 196;
+    f->lineno = 73;
+L210: /* GGET */
+    tp_aot_op(tp, f, code + 210);
+L215: /* IN */
+    regs[8] = tp_has(tp, regs[4], regs[3]);
+L216: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L218;
+    }
+L217: /* JUMP */
+    goto L228;
+L218: /* GGET */
+    tp_aot_op(tp, f, code + 218);
+L223: /* MOVE */
+    regs[5] = regs[0];
+L224: /* MOVE */
+    regs[6] = regs[1];
+L225: /* MOVE */
+    regs[7] = regs[2];
+L226: /* CALLP */
+    return code + 226;
+L227: /* JUMP */
+    tp_aot_safepoint(tp, 148);
+    goto L79;
+L228: /* LINE */
+    f->line = code + 228;
+    f->lineno = 74;
+L244: /* STRING */
+    tp_aot_op(tp, f, code + 244);
+L247: /* GE */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[3].nint >= regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 247);
+    }
+L248: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L250;
+    }
+L249: /* JUMP */
+    goto L254;
+L250: /* STRING */
+    tp_aot_op(tp, f, code + 250);
+L253: /* LE */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[3].nint <= regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 253);
+    }
+L254: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L256;
+    }
+L255: /* JUMP */
+    goto L266;
+L256: /* GGET */
+    tp_aot_op(tp, f, code + 256);
+L261: /* MOVE */
+    regs[5] = regs[0];
+L262: /* MOVE */
+    regs[6] = regs[1];
+L263: /* MOVE */
+    regs[7] = regs[2];
+L264: /* CALLP */
+    return code + 264;
+L265: /* JUMP */
+    tp_aot_safepoint(tp, 186);
+    goto L79;
+L266: /* LINE */
+    f->line = code + 266;
+    f->lineno = 75;
+L282: /* STRING */
+    tp_aot_op(tp, f, code + 282);
+L285: /* IN */
+    regs[8] = tp_has(tp, regs[4], regs[3]);
+L286: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L288;
+    }
+L287: /* JUMP */
+    goto L308;
+L288: /* NUMBER */
+    tp_aot_op(tp, f, code + 288);
+L291: /* ADD */
+    if (TP_BOTH(regs[1], regs[5], TP_NUMBER_INT)) {
+        regs[4] = tp_int(regs[1].nint + regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 291);
+    }
+L292: /* GET */
+    regs[8] = tp_get(tp, regs[0], regs[4]);
+    tp_grey(tp, regs[8]);
+L293: /* STRING */
+    tp_aot_op(tp, f, code + 293);
+L296: /* EQ */
+    if (TP_BOTH(regs[8], regs[4], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[8].nint == regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 296);
+    }
+L297: /* IFN */
+    if (!(TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8]))) {
+        goto L299;
+    }
+L298: /* JUMP */
+    goto L308;
+L299: /* NUMBER */
+    tp_aot_op(tp, f, code + 299);
+L302: /* ADD */
+    if (TP_BOTH(regs[1], regs[5], TP_NUMBER_INT)) {
+        regs[4] = tp_int(regs[1].nint + regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 302);
+    }
+L303: /* GET */
+    regs[8] = tp_get(tp, regs[0], regs[4]);
+    tp_grey(tp, regs[8]);
+L304: /* STRING */
+    tp_aot_op(tp, f, code + 304);
+L307: /* EQ */
+    if (TP_BOTH(regs[8], regs[4], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[8].nint == regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 307);
+    }
+L308: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L310;
+    }
+L309: /* JUMP */
+    goto L340;
+L310: /* LINE */
+    f->line = code + 310;
+    f->lineno = 76;
+L316: /* NUMBER */
+    tp_aot_op(tp, f, code + 316);
+L319: /* ADD */
+    if (TP_BOTH(regs[1], regs[4], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 319);
+    }
+L320: /* LINE */
+    f->line = code + 320;
+    f->lineno = 77;
+L330: /* GGET */
+    tp_aot_op(tp, f, code + 330);
+L335: /* MOVE */
+    regs[5] = regs[0];
+L336: /* MOVE */
+    regs[6] = regs[1];
+L337: /* MOVE */
+    regs[7] = regs[2];
+L338: /* CALLP */
+    return code + 338;
+L339: /* JUMP */
+    tp_aot_safepoint(tp, 260);
+    goto L79;
+L340: /* LINE */
+    f->line = code + 340;
+    f->lineno = 78;
+L354: /* STRING */
+    tp_aot_op(tp, f, code + 354);
+L357: /* EQ */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[3].nint == regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 357);
+    }
+L358: /* IFN */
+    if (!(TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8]))) {
+        goto L360;
+    }
+L359: /* JUMP */
+    goto L364;
+L360: /* STRING */
+    tp_aot_op(tp, f, code + 360);
+L363: /* EQ */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[3].nint == regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 363);
+    }
+L364: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L366;
+    }
+L365: /* JUMP */
+    goto L376;
+L366: /* GGET */
+    tp_aot_op(tp, f, code + 366);
+L371: /* MOVE */
+    regs[5] = regs[0];
+L372: /* MOVE */
+    regs[6] = regs[1];
+L373: /* MOVE */
+    regs[7] = regs[2];
+L374: /* CALLP */
+    return code + 374;
+L375: /* JUMP */
+    tp_aot_safepoint(tp, 296);
+    goto L79;
+L376: /* LINE */
+    f->line = code + 376;
+    f->lineno = 80;
+L395: /* LINE */
+    f->line = code + 395;
+    f->lineno = 79;
+L407: /* STRING */
+    tp_aot_op(tp, f, code + 407);
+L410: /* GE */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[3].nint >= regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 410);
+    }
+L411: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L413;
+    }
+L412: /* JUMP */
+    goto L417;
+L413: /* STRING */
+    tp_aot_op(tp, f, code + 413);
+L416: /* LE */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[3].nint <= regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 416);
+    }
+L417: /* IFN */
+    if (!(TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8]))) {
+        goto L419;
+    }
+L418: /* JUMP */
+    goto L448;
+L419: /* LINE */
+    f->line = code + 419;
+    f->lineno = 80;
+L438: /* STRING */
+    tp_aot_op(tp, f, code + 438);
+L441: /* GE */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[3].nint >= regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 441);
+    }
+L442: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L444;
+    }
+L443: /* JUMP */
+    goto L448;
+L444: /* STRING */
+    tp_aot_op(tp, f, code + 444);
+L447: /* LE */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[3].nint <= regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 447);
+    }
+L448: /* IFN */
+    if (!(TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8]))) {
+        goto L450;
+    }
+L449: /* JUMP */
+    goto L454;
+L450: /* STRING */
+    tp_aot_op(tp, f, code + 450);
+L453: /* EQ */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[3].nint == regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 453);
+    }
+L454: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L456;
+    }
+L455: /* JUMP */
+    goto L465;
+L456: /* GGET */
+    tp_aot_op(tp, f, code + 456);
+L460: /* MOVE */
+    regs[5] = regs[0];
+L461: /* MOVE */
+    regs[6] = regs[1];
+L462: /* MOVE */
+    regs[7] = regs[2];
+L463: /* CALLP */
+    return code + 463;
+L464: /* JUMP */
+    tp_aot_safepoint(tp, 385);
+    goto L79;
+L465: /* LINE */
+    f->line = code + 465;
+    f->lineno = 81;
+L477: /* STRING */
+    tp_aot_op(tp, f, code + 477);
+L480: /* EQ */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[3].nint == regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 480);
+    }
+L481: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L483;
+    }
+L482: /* JUMP */
+    goto L493;
+L483: /* GGET */
+    tp_aot_op(tp, f, code + 483);
+L488: /* MOVE */
+    regs[5] = regs[0];
+L489: /* MOVE */
+    regs[6] = regs[1];
+L490: /* MOVE */
+    regs[7] = regs[2];
+L491: /* CALLP */
+    return code + 491;
+L492: /* JUMP */
+    tp_aot_safepoint(tp, 413);
+    goto L79;
+L493: /* LINE */
+    f->line = code + 493;
+    f->lineno = 82;
+L505: /* STRING */
+    tp_aot_op(tp, f, code + 505);
+L508: /* EQ */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[3].nint == regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 508);
+    }
+L509: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L511;
+    }
+L510: /* JUMP */
+    goto L520;
+L511: /* NUMBER */
+    tp_aot_op(tp, f, code + 511);
+L514: /* ADD */
+    if (TP_BOTH(regs[1], regs[5], TP_NUMBER_INT)) {
+        regs[4] = tp_int(regs[1].nint + regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 514);
+    }
+L515: /* GET */
+    regs[8] = tp_get(tp, regs[0], regs[4]);
+    tp_grey(tp, regs[8]);
+L516: /* STRING */
+    tp_aot_op(tp, f, code + 516);
+L519: /* EQ */
+    if (TP_BOTH(regs[8], regs[4], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[8].nint == regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 519);
+    }
+L520: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L522;
+    }
+L521: /* JUMP */
+    goto L565;
+L522: /* LINE */
+    f->line = code + 522;
+    f->lineno = 83;
+L533: /* NUMBER */
+    tp_aot_op(tp, f, code + 533);
+L536: /* ADD */
+    if (TP_BOTH(regs[1], regs[4], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 536);
+    }
+L537: /* GGET */
+    tp_aot_op(tp, f, code + 537);
+L540: /* STRING */
+    tp_aot_op(tp, f, code + 540);
+L543: /* MGET */
+    tp_aot_op(tp, f, code + 543);
+L545: /* NUMBER */
+    tp_aot_op(tp, f, code + 545);
+L548: /* ADD */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[8] = tp_int(regs[4].nint + regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 548);
+    }
+L549: /* MOVE */
+    regs[4] = regs[1];
+L550: /* GGET */
+    tp_aot_op(tp, f, code + 550);
+L553: /* STRING */
+    tp_aot_op(tp, f, code + 553);
+L556: /* SET */
+    tp_set(tp, regs[5], regs[6], regs[8]);
+L557: /* GGET */
+    tp_aot_op(tp, f, code + 557);
+L560: /* STRING */
+    tp_aot_op(tp, f, code + 560);
+L563: /* SET */
+    tp_set(tp, regs[8], regs[5], regs[4]);
+L564: /* JUMP */
+    tp_aot_safepoint(tp, 485);
+    goto L79;
+L565: /* LINE */
+    f->line = code + 565;
+    f->lineno = 84;
+L577: /* STRING */
+    tp_aot_op(tp, f, code + 577);
+L580: /* EQ */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[3].nint == regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 580);
+    }
+L581: /* IFN */
+    if (!(TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8]))) {
+        goto L583;
+    }
+L582: /* JUMP */
+    goto L587;
+L583: /* STRING */
+    tp_aot_op(tp, f, code + 583);
+L586: /* EQ */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[3].nint == regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 586);
+    }
+L587: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L589;
+    }
+L588: /* JUMP */
+    goto L594;
+L589: /* NUMBER */
+    tp_aot_op(tp, f, code + 589);
+L592: /* ADD */
+    if (TP_BOTH(regs[1], regs[4], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 592);
+    }
+L593: /* JUMP */
+    tp_aot_safepoint(tp, 514);
+    goto L79;
+L594: /* LINE */
+    f->line = code + 594;
+    f->lineno = 85;
+L605: /* GGET */
+    tp_aot_op(tp, f, code + 605);
+L609: /* STRING */
+    tp_aot_op(tp, f, code + 609);
+L614: /* MOVE */
+    regs[6] = regs[0];
+L615: /* GGET */
+    tp_aot_op(tp, f, code + 615);
+L618: /* STRING */
+    tp_aot_op(tp, f, code + 618);
+L621: /* MGET */
+    tp_aot_op(tp, f, code + 621);
+L623: /* CALLP */
+    return code + 623;
+L624: /* JUMP */
+    tp_aot_safepoint(tp, 545);
+    goto L79;
+L625: /* LINE */
+    f->line = code + 625;
+    f->lineno = 86;
+L630: /* GGET */
+    tp_aot_op(tp, f, code + 630);
+L634: /* NUMBER */
+    tp_aot_op(tp, f, code + 634);
+L637: /* CALLP */
+    return code + 637;
+L638: /* LINE */
+    f->line = code + 638;
+    f->lineno = 87;
+L645: /* VAR */
+L647: /* GGET */
+    tp_aot_op(tp, f, code + 647);
+L650: /* STRING */
+    tp_aot_op(tp, f, code + 650);
+L653: /* MGET */
+    tp_aot_op(tp, f, code + 653);
+L655: /* STRING */
+    tp_aot_op(tp, f, code + 655);
+L658: /* NONE */
+    regs[5] = tp_None;
+L659: /* GSET */
+    tp_set(tp, f->globals, regs[4], regs[5]);
+L660: /* LINE */
+    f->line = code + 660;
+    f->lineno = 90;
+L665: /* RETURN */
+    return code + 665;
+L666: /* EOF */
+    return code + 666;
+}
+
+static tpd_code * _tp_tinypy_compiler_tokenize_2654(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 26: goto L26;
+        case 27: goto L27;
+        case 34: goto L34;
+        case 37: goto L37;
+        case 41: goto L41;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 45: goto L45;
+        case 53: goto L53;
+        case 56: goto L56;
+        case 59: goto L59;
+        case 61: goto L61;
+        case 64: goto L64;
+        case 65: goto L65;
+        case 66: goto L66;
+        case 73: goto L73;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 84: goto L84;
+        case 87: goto L87;
+        case 88: goto L88;
+        case 95: goto L95;
+        case 98: goto L98;
+        case 101: goto L101;
+        case 103: goto L103;
+        case 106: goto L106;
+        case 107: goto L107;
+        case 108: goto L108;
+        case 111: goto L111;
+        case 114: goto L114;
+        case 115: goto L115;
+        case 118: goto L118;
+        case 121: goto L121;
+        case 122: goto L122;
+        case 127: goto L127;
+        case 128: goto L128;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 92;
+L8: /* VAR */
+L10: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[0];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L26: /* NAME */
+    f->name = regs[0];
+L27: /* LINE */
+    f->line = code + 27;
+    f->lineno = 93;
+L34: /* GGET */
+    tp_aot_op(tp, f, code + 34);
+L37: /* STRING */
+    tp_aot_op(tp, f, code + 37);
+L41: /* MGET */
+    tp_aot_op(tp, f, code + 41);
+L43: /* IFN */
+    if (!(TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2]))) {
+        goto L45;
+    }
+L44: /* JUMP */
+    goto L66;
+L45: /* LINE */
+    f->line = code + 45;
+    f->lineno = 94;
+L53: /* GGET */
+    tp_aot_op(tp, f, code + 53);
+L56: /* STRING */
+    tp_aot_op(tp, f, code + 56);
+L59: /* METHOD */
+    tp_aot_op(tp, f, code + 59);
+L61: /* STRING */
+    tp_aot_op(tp, f, code + 61);
+L64: /* NONE */
+    regs[5] = tp_None;
+L65: /* CALLM */
+    return code + 65;
+L66: /* LINE */
+    f->line = code + 66;
+    f->lineno = 95;
+L73: /* NUMBER */
+    tp_aot_op(tp, f, code + 73);
+L76: /* ADD */
+    if (TP_BOTH(regs[1], regs[3], TP_NUMBER_INT)) {
+        regs[0] = tp_int(regs[1].nint + regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 76);
+    }
+L77: /* NUMBER */
+    tp_aot_op(tp, f, code + 77);
+L80: /* MOVE */
+    regs[1] = regs[0];
+L81: /* GGET */
+    tp_aot_op(tp, f, code + 81);
+L84: /* STRING */
+    tp_aot_op(tp, f, code + 84);
+L87: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[2]);
+L88: /* LINE */
+    f->line = code + 88;
+    f->lineno = 96;
+L95: /* GGET */
+    tp_aot_op(tp, f, code + 95);
+L98: /* STRING */
+    tp_aot_op(tp, f, code + 98);
+L101: /* MGET */
+    tp_aot_op(tp, f, code + 101);
+L103: /* NUMBER */
+    tp_aot_op(tp, f, code + 103);
+L106: /* ADD */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[0] = tp_int(regs[2].nint + regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 106);
+    }
+L107: /* MOVE */
+    regs[2] = regs[1];
+L108: /* GGET */
+    tp_aot_op(tp, f, code + 108);
+L111: /* STRING */
+    tp_aot_op(tp, f, code + 111);
+L114: /* SET */
+    tp_set(tp, regs[3], regs[4], regs[0]);
+L115: /* GGET */
+    tp_aot_op(tp, f, code + 115);
+L118: /* STRING */
+    tp_aot_op(tp, f, code + 118);
+L121: /* SET */
+    tp_set(tp, regs[0], regs[3], regs[2]);
+L122: /* LINE */
+    f->line = code + 122;
+    f->lineno = 97;
+L127: /* RETURN */
+    return code + 127;
+L128: /* EOF */
+    return code + 128;
+}
+
+static tpd_code * _tp_tinypy_compiler_tokenize_2812(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 15: goto L15;
+        case 24: goto L24;
+        case 25: goto L25;
+        case 30: goto L30;
+        case 31: goto L31;
+        case 35: goto L35;
+        case 37: goto L37;
+        case 40: goto L40;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 54: goto L54;
+        case 56: goto L56;
+        case 57: goto L57;
+        case 69: goto L69;
+        case 72: goto L72;
+        case 73: goto L73;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 78: goto L78;
+        case 79: goto L79;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 88: goto L88;
+        case 91: goto L91;
+        case 92: goto L92;
+        case 95: goto L95;
+        case 96: goto L96;
+        case 97: goto L97;
+        case 98: goto L98;
+        case 99: goto L99;
+        case 115: goto L115;
+        case 118: goto L118;
+        case 119: goto L119;
+        case 120: goto L120;
+        case 121: goto L121;
+        case 124: goto L124;
+        case 125: goto L125;
+        case 126: goto L126;
+        case 127: goto L127;
+        case 130: goto L130;
+        case 134: goto L134;
+        case 136: goto L136;
+        case 137: goto L137;
+        case 138: goto L138;
+        case 139: goto L139;
+        case 143: goto L143;
+        case 144: goto L144;
+        case 145: goto L145;
+        case 150: goto L150;
+        case 151: goto L151;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 99;
+L9: /* VAR */
+L11: /* VAR */
+L13: /* VAR */
+L15: /* STRING */
+    tp_aot_op(tp, f, code + 15);
+L24: /* FILE */
+    f->fname = regs[3];
+L25: /* STRING */
+    tp_aot_op(tp, f, code + 25);
+L30: /* NAME */
+    f->name = regs[3];
+L31: /* LINE */
+    f->line = code + 31;
+    f->lineno = 100;
+L35: /* VAR */
+L37: /* NUMBER */
+    tp_aot_op(tp, f, code + 37);
+L40: /* LINE */
+    f->line = code + 40;
+    f->lineno = 101;
+L45: /* LT */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[1].nint < regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 45);
+    }
+L46: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L48;
+    }
+L47: /* JUMP */
+    goto L99;
+L48: /* LINE */
+    f->line = code + 48;
+    f->lineno = 102;
+L54: /* VAR */
+L56: /* GET */
+    regs[4] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[4]);
+L57: /* LINE */
+    f->line = code + 57;
+    f->lineno = 103;
+L69: /* STRING */
+    tp_aot_op(tp, f, code + 69);
+L72: /* NE */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[4].nint != regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 72);
+    }
+L73: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L75;
+    }
+L74: /* JUMP */
+    goto L79;
+L75: /* STRING */
+    tp_aot_op(tp, f, code + 75);
+L78: /* NE */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[4].nint != regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 78);
+    }
+L79: /* IFN */
+    if (!(TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6]))) {
+        goto L81;
+    }
+L80: /* JUMP */
+    goto L99;
+L81: /* LINE */
+    f->line = code + 81;
+    f->lineno = 104;
+L88: /* NUMBER */
+    tp_aot_op(tp, f, code + 88);
+L91: /* ADD */
+    if (TP_BOTH(regs[1], regs[6], TP_NUMBER_INT)) {
+        regs[6] = tp_int(regs[1].nint + regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 91);
+    }
+L92: /* NUMBER */
+    tp_aot_op(tp, f, code + 92);
+L95: /* ADD */
+    if (TP_BOTH(regs[3], regs[1], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[3].nint + regs[1].nint);
+    } else {
+        tp_aot_op(tp, f, code + 95);
+    }
+L96: /* MOVE */
+    regs[1] = regs[6];
+L97: /* MOVE */
+    regs[3] = regs[5];
+L98: /* JUMP */
+    tp_aot_safepoint(tp, 53);
+    goto L45;
+L99: /* LINE */
+    f->line = code + 99;
+    f->lineno = 105;
+L115: /* STRING */
+    tp_aot_op(tp, f, code + 115);
+L118: /* NE */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[4].nint != regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 118);
+    }
+L119: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L121;
+    }
+L120: /* JUMP */
+    goto L125;
+L121: /* STRING */
+    tp_aot_op(tp, f, code + 121);
+L124: /* NE */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[4].nint != regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 124);
+    }
+L125: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L127;
+    }
+L126: /* JUMP */
+    goto L137;
+L127: /* GGET */
+    tp_aot_op(tp, f, code + 127);
+L130: /* STRING */
+    tp_aot_op(tp, f, code + 130);
+L134: /* MGET */
+    tp_aot_op(tp, f, code + 134);
+L136: /* NOT */
+    regs[6] = tp_bool(!tp_true(tp, regs[5]));
+L137: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L139;
+    }
+L138: /* JUMP */
+    goto L145;
+L139: /* GGET */
+    tp_aot_op(tp, f, code + 139);
+L143: /* MOVE */
+    regs[6] = regs[3];
+L144: /* CALLP */
+    return code + 144;
+L145: /* LINE */
+    f->line = code + 145;
+    f->lineno = 106;
+L150: /* RETURN */
+    return code + 150;
+L151: /* EOF */
+    return code + 151;
+}
+
+static tpd_code * _tp_tinypy_compiler_tokenize_2986(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 9: goto L9;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 33: goto L33;
+        case 36: goto L36;
+        case 40: goto L40;
+        case 42: goto L42;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 57: goto L57;
+        case 60: goto L60;
+        case 64: goto L64;
+        case 66: goto L66;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 72: goto L72;
+        case 73: goto L73;
+        case 81: goto L81;
+        case 84: goto L84;
+        case 88: goto L88;
+        case 90: goto L90;
+        case 94: goto L94;
+        case 96: goto L96;
+        case 97: goto L97;
+        case 98: goto L98;
+        case 106: goto L106;
+        case 109: goto L109;
+        case 112: goto L112;
+        case 114: goto L114;
+        case 118: goto L118;
+        case 119: goto L119;
+        case 120: goto L120;
+        case 121: goto L121;
+        case 129: goto L129;
+        case 132: goto L132;
+        case 136: goto L136;
+        case 138: goto L138;
+        case 141: goto L141;
+        case 142: goto L142;
+        case 143: goto L143;
+        case 144: goto L144;
+        case 145: goto L145;
+        case 154: goto L154;
+        case 156: goto L156;
+        case 159: goto L159;
+        case 163: goto L163;
+        case 165: goto L165;
+        case 169: goto L169;
+        case 171: goto L171;
+        case 172: goto L172;
+        case 173: goto L173;
+        case 183: goto L183;
+        case 186: goto L186;
+        case 189: goto L189;
+        case 193: goto L193;
+        case 195: goto L195;
+        case 196: goto L196;
+        case 199: goto L199;
+        case 200: goto L200;
+        case 201: goto L201;
+        case 202: goto L202;
+        case 203: goto L203;
+        case 212: goto L212;
+        case 215: goto L215;
+        case 219: goto L219;
+        case 221: goto L221;
+        case 224: goto L224;
+        case 226: goto L226;
+        case 227: goto L227;
+        case 236: goto L236;
+        case 239: goto L239;
+        case 242: goto L242;
+        case 244: goto L244;
+        case 248: goto L248;
+        case 249: goto L249;
+        case 250: goto L250;
+        case 251: goto L251;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 108;
+L7: /* VAR */
+L9: /* STRING */
+    tp_aot_op(tp, f, code + 9);
+L18: /* FILE */
+    f->fname = regs[1];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* NAME */
+    f->name = regs[1];
+L24: /* LINE */
+    f->line = code + 24;
+    f->lineno = 109;
+L33: /* GGET */
+    tp_aot_op(tp, f, code + 33);
+L36: /* STRING */
+    tp_aot_op(tp, f, code + 36);
+L40: /* MGET */
+    tp_aot_op(tp, f, code + 40);
+L42: /* NUMBER */
+    tp_aot_op(tp, f, code + 42);
+L45: /* GET */
+    regs[2] = tp_get(tp, regs[2], regs[3]);
+    tp_grey(tp, regs[2]);
+L46: /* EQ */
+    if (TP_BOTH(regs[0], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[0].nint == regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 46);
+    }
+L47: /* IFN */
+    if (!(TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1]))) {
+        goto L49;
+    }
+L48: /* JUMP */
+    goto L251;
+L49: /* LINE */
+    f->line = code + 49;
+    f->lineno = 110;
+L57: /* GGET */
+    tp_aot_op(tp, f, code + 57);
+L60: /* STRING */
+    tp_aot_op(tp, f, code + 60);
+L64: /* MGET */
+    tp_aot_op(tp, f, code + 64);
+L66: /* NUMBER */
+    tp_aot_op(tp, f, code + 66);
+L69: /* GET */
+    regs[2] = tp_get(tp, regs[2], regs[3]);
+    tp_grey(tp, regs[2]);
+L70: /* GT */
+    if (TP_BOTH(regs[0], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[0].nint > regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 70);
+    }
+L71: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L73;
+    }
+L72: /* JUMP */
+    goto L121;
+L73: /* LINE */
+    f->line = code + 73;
+    f->lineno = 111;
+L81: /* GGET */
+    tp_aot_op(tp, f, code + 81);
+L84: /* STRING */
+    tp_aot_op(tp, f, code + 84);
+L88: /* MGET */
+    tp_aot_op(tp, f, code + 88);
+L90: /* STRING */
+    tp_aot_op(tp, f, code + 90);
+L94: /* METHOD */
+    tp_aot_op(tp, f, code + 94);
+L96: /* MOVE */
+    regs[4] = regs[0];
+L97: /* CALLM */
+    return code + 97;
+L98: /* LINE */
+    f->line = code + 98;
+    f->lineno = 112;
+L106: /* GGET */
+    tp_aot_op(tp, f, code + 106);
+L109: /* STRING */
+    tp_aot_op(tp, f, code + 109);
+L112: /* METHOD */
+    tp_aot_op(tp, f, code + 112);
+L114: /* STRING */
+    tp_aot_op(tp, f, code + 114);
+L118: /* MOVE */
+    regs[5] = regs[0];
+L119: /* CALLM */
+    return code + 119;
+L120: /* JUMP */
+    goto L251;
+L121: /* LINE */
+    f->line = code + 121;
+    f->lineno = 113;
+L129: /* GGET */
+    tp_aot_op(tp, f, code + 129);
+L132: /* STRING */
+    tp_aot_op(tp, f, code + 132);
+L136: /* MGET */
+    tp_aot_op(tp, f, code + 136);
+L138: /* NUMBER */
+    tp_aot_op(tp, f, code + 138);
+L141: /* GET */
+    regs[2] = tp_get(tp, regs[2], regs[3]);
+    tp_grey(tp, regs[2]);
+L142: /* LT */
+    if (TP_BOTH(regs[0], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[0].nint < regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 142);
+    }
+L143: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L145;
+    }
+L144: /* JUMP */
+    goto L251;
+L145: /* LINE */
+    f->line = code + 145;
+    f->lineno = 114;
+L154: /* VAR */
+L156: /* GGET */
+    tp_aot_op(tp, f, code + 156);
+L159: /* STRING */
+    tp_aot_op(tp, f, code + 159);
+L163: /* MGET */
+    tp_aot_op(tp, f, code + 163);
+L165: /* STRING */
+    tp_aot_op(tp, f, code + 165);
+L169: /* METHOD */
+    tp_aot_op(tp, f, code + 169);
+L171: /* MOVE */
+    regs[5] = regs[0];
+L172: /* CALLM */
+    return code + 172;
+L173: /* LINE */
+    f->line = code + 173;
+    f->lineno = 115;
+L183: /* GGET */
+    tp_aot_op(tp, f, code + 183);
+L186: /* GGET */
+    tp_aot_op(tp, f, code + 186);
+L189: /* STRING */
+    tp_aot_op(tp, f, code + 189);
+L193: /* MGET */
+    tp_aot_op(tp, f, code + 193);
+L195: /* CALLP */
+    return code + 195;
+L196: /* NUMBER */
+    tp_aot_op(tp, f, code + 196);
+L199: /* ADD */
+    if (TP_BOTH(regs[1], regs[4], TP_NUMBER_INT)) {
+        regs[3] = tp_int(regs[1].nint + regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 199);
+    }
+L200: /* GT */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint > regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 200);
+    }
+L201: /* IF */
+    if (TP_IS_INT(regs[2]) ? regs[2].nint != 0 : tp_true(tp, regs[2])) {
+        goto L203;
+    }
+L202: /* JUMP */
+    goto L251;
+L203: /* LINE */
+    f->line = code + 203;
+    f->lineno = 116;
+L212: /* GGET */
+    tp_aot_op(tp, f, code + 212);
+L215: /* STRING */
+    tp_aot_op(tp, f, code + 215);
+L219: /* MGET */
+    tp_aot_op(tp, f, code + 219);
+L221: /* STRING */
+    tp_aot_op(tp, f, code + 221);
+L224: /* METHOD */
+    tp_aot_op(tp, f, code + 224);
+L226: /* CALLM */
+    return code + 226;
+L227: /* LINE */
+    f->line = code + 227;
+    f->lineno = 117;
+L236: /* GGET */
+    tp_aot_op(tp, f, code + 236);
+L239: /* STRING */
+    tp_aot_op(tp, f, code + 239);
+L242: /* METHOD */
+    tp_aot_op(tp, f, code + 242);
+L244: /* STRING */
+    tp_aot_op(tp, f, code + 244);
+L248: /* MOVE */
+    regs[6] = regs[0];
+L249: /* CALLM */
+    return code + 249;
+L250: /* JUMP */
+    tp_aot_safepoint(tp, 67);
+    goto L183;
+L251: /* EOF */
+    return code + 251;
+}
+
+static tpd_code * _tp_tinypy_compiler_tokenize_3267(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 15: goto L15;
+        case 24: goto L24;
+        case 25: goto L25;
+        case 30: goto L30;
+        case 31: goto L31;
+        case 37: goto L37;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 56: goto L56;
+        case 57: goto L57;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 61: goto L61;
+        case 72: goto L72;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 78: goto L78;
+        case 79: goto L79;
+        case 83: goto L83;
+        case 85: goto L85;
+        case 86: goto L86;
+        case 87: goto L87;
+        case 92: goto L92;
+        case 93: goto L93;
+        case 94: goto L94;
+        case 95: goto L95;
+        case 101: goto L101;
+        case 103: goto L103;
+        case 104: goto L104;
+        case 114: goto L114;
+        case 119: goto L119;
+        case 120: goto L120;
+        case 121: goto L121;
+        case 122: goto L122;
+        case 129: goto L129;
+        case 130: goto L130;
+        case 133: goto L133;
+        case 134: goto L134;
+        case 135: goto L135;
+        case 136: goto L136;
+        case 148: goto L148;
+        case 152: goto L152;
+        case 153: goto L153;
+        case 154: goto L154;
+        case 155: goto L155;
+        case 159: goto L159;
+        case 161: goto L161;
+        case 162: goto L162;
+        case 163: goto L163;
+        case 164: goto L164;
+        case 176: goto L176;
+        case 179: goto L179;
+        case 181: goto L181;
+        case 182: goto L182;
+        case 184: goto L184;
+        case 187: goto L187;
+        case 188: goto L188;
+        case 189: goto L189;
+        case 190: goto L190;
+        case 197: goto L197;
+        case 200: goto L200;
+        case 203: goto L203;
+        case 205: goto L205;
+        case 209: goto L209;
+        case 210: goto L210;
+        case 220: goto L220;
+        case 224: goto L224;
+        case 225: goto L225;
+        case 226: goto L226;
+        case 227: goto L227;
+        case 230: goto L230;
+        case 233: goto L233;
+        case 237: goto L237;
+        case 239: goto L239;
+        case 242: goto L242;
+        case 243: goto L243;
+        case 247: goto L247;
+        case 248: goto L248;
+        case 258: goto L258;
+        case 262: goto L262;
+        case 263: goto L263;
+        case 264: goto L264;
+        case 265: goto L265;
+        case 268: goto L268;
+        case 271: goto L271;
+        case 275: goto L275;
+        case 277: goto L277;
+        case 280: goto L280;
+        case 281: goto L281;
+        case 285: goto L285;
+        case 286: goto L286;
+        case 291: goto L291;
+        case 292: goto L292;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 119;
+L9: /* VAR */
+L11: /* VAR */
+L13: /* VAR */
+L15: /* STRING */
+    tp_aot_op(tp, f, code + 15);
+L24: /* FILE */
+    f->fname = regs[3];
+L25: /* STRING */
+    tp_aot_op(tp, f, code + 25);
+L30: /* NAME */
+    f->name = regs[3];
+L31: /* LINE */
+    f->line = code + 31;
+    f->lineno = 120;
+L37: /* VAR */
+L40: /* LIST */
+    tp_aot_op(tp, f, code + 40);
+L41: /* LINE */
+    f->line = code + 41;
+    f->lineno = 121;
+L48: /* GET */
+    regs[4] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[4]);
+L49: /* MOVE */
+    regs[5] = regs[1];
+L50: /* NUMBER */
+    tp_aot_op(tp, f, code + 50);
+L53: /* ADD */
+    if (TP_BOTH(regs[1], regs[6], TP_NUMBER_INT)) {
+        regs[9] = tp_int(regs[1].nint + regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 53);
+    }
+L54: /* VAR */
+L56: /* MOVE */
+    regs[10] = regs[4];
+L57: /* VAR */
+L59: /* MOVE */
+    regs[4] = regs[5];
+L60: /* MOVE */
+    regs[1] = regs[9];
+L61: /* LINE */
+    f->line = code + 61;
+    f->lineno = 122;
+L72: /* GGET */
+    tp_aot_op(tp, f, code + 72);
+L76: /* IN */
+    regs[5] = tp_has(tp, regs[9], regs[10]);
+L77: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L79;
+    }
+L78: /* JUMP */
+    goto L87;
+L79: /* STRING */
+    tp_aot_op(tp, f, code + 79);
+L83: /* METHOD */
+    tp_aot_op(tp, f, code + 83);
+L85: /* MOVE */
+    regs[8] = regs[10];
+L86: /* CALLM */
+    return code + 86;
+L87: /* LINE */
+    f->line = code + 87;
+    f->lineno = 123;
+L92: /* LT */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[1].nint < regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 92);
+    }
+L93: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L95;
+    }
+L94: /* JUMP */
+    goto L164;
+L95: /* LINE */
+    f->line = code + 95;
+    f->lineno = 124;
+L101: /* VAR */
+L103: /* GET */
+    regs[5] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[5]);
+L104: /* LINE */
+    f->line = code + 104;
+    f->lineno = 125;
+L114: /* GGET */
+    tp_aot_op(tp, f, code + 114);
+L119: /* IN */
+    regs[6] = tp_has(tp, regs[7], regs[5]);
+L120: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L122;
+    }
+L121: /* JUMP */
+    goto L164;
+L122: /* LINE */
+    f->line = code + 122;
+    f->lineno = 126;
+L129: /* ADD */
+    if (TP_BOTH(regs[10], regs[5], TP_NUMBER_INT)) {
+        regs[9] = tp_int(regs[10].nint + regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 129);
+    }
+L130: /* NUMBER */
+    tp_aot_op(tp, f, code + 130);
+L133: /* ADD */
+    if (TP_BOTH(regs[1], regs[8], TP_NUMBER_INT)) {
+        regs[6] = tp_int(regs[1].nint + regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 133);
+    }
+L134: /* MOVE */
+    regs[10] = regs[9];
+L135: /* MOVE */
+    regs[1] = regs[6];
+L136: /* LINE */
+    f->line = code + 136;
+    f->lineno = 127;
+L148: /* GGET */
+    tp_aot_op(tp, f, code + 148);
+L152: /* IN */
+    regs[9] = tp_has(tp, regs[6], regs[10]);
+L153: /* IF */
+    if (TP_IS_INT(regs[9]) ? regs[9].nint != 0 : tp_true(tp, regs[9])) {
+        goto L155;
+    }
+L154: /* JUMP */
+    tp_aot_safepoint(tp, 62);
+    goto L92;
+L155: /* STRING */
+    tp_aot_op(tp, f, code + 155);
+L159: /* METHOD */
+    tp_aot_op(tp, f, code + 159);
+L161: /* MOVE */
+    regs[8] = regs[10];
+L162: /* CALLM */
+    return code + 162;
+L163: /* JUMP */
+    tp_aot_safepoint(tp, 71);
+    goto L92;
+L164: /* LINE */
+    f->line = code + 164;
+    f->lineno = 128;
+L176: /* STRING */
+    tp_aot_op(tp, f, code + 176);
+L179: /* METHOD */
+    tp_aot_op(tp, f, code + 179);
+L181: /* CALLM */
+    return code + 181;
+L182: /* VAR */
+L184: /* GGET */
+    tp_aot_op(tp, f, code + 184);
+L187: /* MOVE */
+    regs[8] = regs[10];
+L188: /* CALLP */
+    return code + 188;
+L189: /* ADD */
+    if (TP_BOTH(regs[4], regs[9], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[4].nint + regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 189);
+    }
+L190: /* LINE */
+    f->line = code + 190;
+    f->lineno = 129;
+L197: /* GGET */
+    tp_aot_op(tp, f, code + 197);
+L200: /* STRING */
+    tp_aot_op(tp, f, code + 200);
+L203: /* METHOD */
+    tp_aot_op(tp, f, code + 203);
+L205: /* STRING */
+    tp_aot_op(tp, f, code + 205);
+L209: /* CALLM */
+    return code + 209;
+L210: /* LINE */
+    f->line = code + 210;
+    f->lineno = 130;
+L220: /* GGET */
+    tp_aot_op(tp, f, code + 220);
+L224: /* IN */
+    regs[6] = tp_has(tp, regs[7], regs[10]);
+L225: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L227;
+    }
+L226: /* JUMP */
+    goto L248;
+L227: /* GGET */
+    tp_aot_op(tp, f, code + 227);
+L230: /* GGET */
+    tp_aot_op(tp, f, code + 230);
+L233: /* STRING */
+    tp_aot_op(tp, f, code + 233);
+L237: /* MGET */
+    tp_aot_op(tp, f, code + 237);
+L239: /* NUMBER */
+    tp_aot_op(tp, f, code + 239);
+L242: /* ADD */
+    if (TP_BOTH(regs[7], regs[8], TP_NUMBER_INT)) {
+        regs[7] = tp_int(regs[7].nint + regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 242);
+    }
+L243: /* STRING */
+    tp_aot_op(tp, f, code + 243);
+L247: /* SET */
+    tp_set(tp, regs[6], regs[8], regs[7]);
+L248: /* LINE */
+    f->line = code + 248;
+    f->lineno = 131;
+L258: /* GGET */
+    tp_aot_op(tp, f, code + 258);
+L262: /* IN */
+    regs[6] = tp_has(tp, regs[7], regs[10]);
+L263: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L265;
+    }
+L264: /* JUMP */
+    goto L286;
+L265: /* GGET */
+    tp_aot_op(tp, f, code + 265);
+L268: /* GGET */
+    tp_aot_op(tp, f, code + 268);
+L271: /* STRING */
+    tp_aot_op(tp, f, code + 271);
+L275: /* MGET */
+    tp_aot_op(tp, f, code + 275);
+L277: /* NUMBER */
+    tp_aot_op(tp, f, code + 277);
+L280: /* SUB */
+    if (TP_BOTH(regs[7], regs[8], TP_NUMBER_INT)) {
+        regs[7] = tp_int(regs[7].nint - regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 280);
+    }
+L281: /* STRING */
+    tp_aot_op(tp, f, code + 281);
+L285: /* SET */
+    tp_set(tp, regs[6], regs[8], regs[7]);
+L286: /* LINE */
+    f->line = code + 286;
+    f->lineno = 132;
+L291: /* RETURN */
+    return code + 291;
+L292: /* EOF */
+    return code + 292;
+}
+
+static tpd_code * _tp_tinypy_compiler_tokenize_3590(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 15: goto L15;
+        case 24: goto L24;
+        case 25: goto L25;
+        case 30: goto L30;
+        case 31: goto L31;
+        case 39: goto L39;
+        case 40: goto L40;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 45: goto L45;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 51: goto L51;
+        case 52: goto L52;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 66: goto L66;
+        case 67: goto L67;
+        case 88: goto L88;
+        case 91: goto L91;
+        case 92: goto L92;
+        case 93: goto L93;
+        case 94: goto L94;
+        case 97: goto L97;
+        case 98: goto L98;
+        case 99: goto L99;
+        case 100: goto L100;
+        case 103: goto L103;
+        case 104: goto L104;
+        case 105: goto L105;
+        case 106: goto L106;
+        case 109: goto L109;
+        case 110: goto L110;
+        case 111: goto L111;
+        case 112: goto L112;
+        case 115: goto L115;
+        case 116: goto L116;
+        case 117: goto L117;
+        case 118: goto L118;
+        case 125: goto L125;
+        case 126: goto L126;
+        case 129: goto L129;
+        case 130: goto L130;
+        case 131: goto L131;
+        case 132: goto L132;
+        case 133: goto L133;
+        case 139: goto L139;
+        case 142: goto L142;
+        case 143: goto L143;
+        case 144: goto L144;
+        case 145: goto L145;
+        case 152: goto L152;
+        case 153: goto L153;
+        case 156: goto L156;
+        case 157: goto L157;
+        case 158: goto L158;
+        case 159: goto L159;
+        case 165: goto L165;
+        case 166: goto L166;
+        case 167: goto L167;
+        case 168: goto L168;
+        case 175: goto L175;
+        case 176: goto L176;
+        case 188: goto L188;
+        case 191: goto L191;
+        case 192: goto L192;
+        case 193: goto L193;
+        case 194: goto L194;
+        case 197: goto L197;
+        case 198: goto L198;
+        case 199: goto L199;
+        case 200: goto L200;
+        case 208: goto L208;
+        case 209: goto L209;
+        case 212: goto L212;
+        case 213: goto L213;
+        case 214: goto L214;
+        case 215: goto L215;
+        case 216: goto L216;
+        case 224: goto L224;
+        case 227: goto L227;
+        case 230: goto L230;
+        case 232: goto L232;
+        case 236: goto L236;
+        case 237: goto L237;
+        case 238: goto L238;
+        case 239: goto L239;
+        case 247: goto L247;
+        case 250: goto L250;
+        case 253: goto L253;
+        case 255: goto L255;
+        case 259: goto L259;
+        case 260: goto L260;
+        case 261: goto L261;
+        case 266: goto L266;
+        case 267: goto L267;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 134;
+L9: /* VAR */
+L11: /* VAR */
+L13: /* VAR */
+L15: /* STRING */
+    tp_aot_op(tp, f, code + 15);
+L24: /* FILE */
+    f->fname = regs[3];
+L25: /* STRING */
+    tp_aot_op(tp, f, code + 25);
+L30: /* NAME */
+    f->name = regs[3];
+L31: /* LINE */
+    f->line = code + 31;
+    f->lineno = 135;
+L39: /* GET */
+    regs[3] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[3]);
+L40: /* NUMBER */
+    tp_aot_op(tp, f, code + 40);
+L43: /* ADD */
+    if (TP_BOTH(regs[1], regs[4], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[1].nint + regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 43);
+    }
+L44: /* GET */
+    regs[6] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[6]);
+L45: /* VAR */
+L47: /* MOVE */
+    regs[4] = regs[3];
+L48: /* MOVE */
+    regs[1] = regs[5];
+L49: /* VAR */
+L51: /* MOVE */
+    regs[3] = regs[6];
+L52: /* LINE */
+    f->line = code + 52;
+    f->lineno = 136;
+L57: /* LT */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[1].nint < regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 57);
+    }
+L58: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L60;
+    }
+L59: /* JUMP */
+    goto L133;
+L60: /* LINE */
+    f->line = code + 60;
+    f->lineno = 137;
+L66: /* GET */
+    regs[3] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[3]);
+L67: /* LINE */
+    f->line = code + 67;
+    f->lineno = 138;
+L88: /* STRING */
+    tp_aot_op(tp, f, code + 88);
+L91: /* LT */
+    if (TP_BOTH(regs[3], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[3].nint < regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 91);
+    }
+L92: /* IFN */
+    if (!(TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5]))) {
+        goto L94;
+    }
+L93: /* JUMP */
+    goto L98;
+L94: /* STRING */
+    tp_aot_op(tp, f, code + 94);
+L97: /* GT */
+    if (TP_BOTH(regs[3], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[3].nint > regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 97);
+    }
+L98: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L100;
+    }
+L99: /* JUMP */
+    goto L110;
+L100: /* STRING */
+    tp_aot_op(tp, f, code + 100);
+L103: /* LT */
+    if (TP_BOTH(regs[3], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[3].nint < regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 103);
+    }
+L104: /* IFN */
+    if (!(TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5]))) {
+        goto L106;
+    }
+L105: /* JUMP */
+    goto L110;
+L106: /* STRING */
+    tp_aot_op(tp, f, code + 106);
+L109: /* GT */
+    if (TP_BOTH(regs[3], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[3].nint > regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 109);
+    }
+L110: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L112;
+    }
+L111: /* JUMP */
+    goto L116;
+L112: /* STRING */
+    tp_aot_op(tp, f, code + 112);
+L115: /* NE */
+    if (TP_BOTH(regs[3], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[3].nint != regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 115);
+    }
+L116: /* IFN */
+    if (!(TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5]))) {
+        goto L118;
+    }
+L117: /* JUMP */
+    goto L133;
+L118: /* LINE */
+    f->line = code + 118;
+    f->lineno = 139;
+L125: /* ADD */
+    if (TP_BOTH(regs[4], regs[3], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[4].nint + regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 125);
+    }
+L126: /* NUMBER */
+    tp_aot_op(tp, f, code + 126);
+L129: /* ADD */
+    if (TP_BOTH(regs[1], regs[8], TP_NUMBER_INT)) {
+        regs[6] = tp_int(regs[1].nint + regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 129);
+    }
+L130: /* MOVE */
+    regs[4] = regs[5];
+L131: /* MOVE */
+    regs[1] = regs[6];
+L132: /* JUMP */
+    tp_aot_safepoint(tp, 75);
+    goto L57;
+L133: /* LINE */
+    f->line = code + 133;
+    f->lineno = 140;
+L139: /* STRING */
+    tp_aot_op(tp, f, code + 139);
+L142: /* EQ */
+    if (TP_BOTH(regs[3], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[3].nint == regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 142);
+    }
+L143: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L145;
+    }
+L144: /* JUMP */
+    goto L239;
+L145: /* LINE */
+    f->line = code + 145;
+    f->lineno = 141;
+L152: /* ADD */
+    if (TP_BOTH(regs[4], regs[3], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[4].nint + regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 152);
+    }
+L153: /* NUMBER */
+    tp_aot_op(tp, f, code + 153);
+L156: /* ADD */
+    if (TP_BOTH(regs[1], regs[8], TP_NUMBER_INT)) {
+        regs[6] = tp_int(regs[1].nint + regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 156);
+    }
+L157: /* MOVE */
+    regs[4] = regs[5];
+L158: /* MOVE */
+    regs[1] = regs[6];
+L159: /* LINE */
+    f->line = code + 159;
+    f->lineno = 142;
+L165: /* LT */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[1].nint < regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 165);
+    }
+L166: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L168;
+    }
+L167: /* JUMP */
+    goto L216;
+L168: /* LINE */
+    f->line = code + 168;
+    f->lineno = 143;
+L175: /* GET */
+    regs[3] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[3]);
+L176: /* LINE */
+    f->line = code + 176;
+    f->lineno = 144;
+L188: /* STRING */
+    tp_aot_op(tp, f, code + 188);
+L191: /* LT */
+    if (TP_BOTH(regs[3], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[3].nint < regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 191);
+    }
+L192: /* IFN */
+    if (!(TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5]))) {
+        goto L194;
+    }
+L193: /* JUMP */
+    goto L198;
+L194: /* STRING */
+    tp_aot_op(tp, f, code + 194);
+L197: /* GT */
+    if (TP_BOTH(regs[3], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[3].nint > regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 197);
+    }
+L198: /* IFN */
+    if (!(TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5]))) {
+        goto L200;
+    }
+L199: /* JUMP */
+    goto L216;
+L200: /* LINE */
+    f->line = code + 200;
+    f->lineno = 145;
+L208: /* ADD */
+    if (TP_BOTH(regs[4], regs[3], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[4].nint + regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 208);
+    }
+L209: /* NUMBER */
+    tp_aot_op(tp, f, code + 209);
+L212: /* ADD */
+    if (TP_BOTH(regs[1], regs[8], TP_NUMBER_INT)) {
+        regs[6] = tp_int(regs[1].nint + regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 212);
+    }
+L213: /* MOVE */
+    regs[4] = regs[5];
+L214: /* MOVE */
+    regs[1] = regs[6];
+L215: /* JUMP */
+    tp_aot_safepoint(tp, 50);
+    goto L165;
+L216: /* LINE */
+    f->line = code + 216;
+    f->lineno = 146;
+L224: /* GGET */
+    tp_aot_op(tp, f, code + 224);
+L227: /* STRING */
+    tp_aot_op(tp, f, code + 227);
+L230: /* METHOD */
+    tp_aot_op(tp, f, code + 230);
+L232: /* STRING */
+    tp_aot_op(tp, f, code + 232);
+L236: /* MOVE */
+    regs[10] = regs[4];
+L237: /* CALLM */
+    return code + 237;
+L238: /* JUMP */
+    goto L261;
+L239: /* LINE */
+    f->line = code + 239;
+    f->lineno = 148;
+L247: /* GGET */
+    tp_aot_op(tp, f, code + 247);
+L250: /* STRING */
+    tp_aot_op(tp, f, code + 250);
+L253: /* METHOD */
+    tp_aot_op(tp, f, code + 253);
+L255: /* STRING */
+    tp_aot_op(tp, f, code + 255);
+L259: /* MOVE */
+    regs[10] = regs[4];
+L260: /* CALLM */
+    return code + 260;
+L261: /* LINE */
+    f->line = code + 261;
+    f->lineno = 149;
+L266: /* RETURN */
+    return code + 266;
+L267: /* EOF */
+    return code + 267;
+}
+
+static tpd_code * _tp_tinypy_compiler_tokenize_3887(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 12: goto L12;
+        case 14: goto L14;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 28: goto L28;
+        case 29: goto L29;
+        case 35: goto L35;
+        case 36: goto L36;
+        case 39: goto L39;
+        case 40: goto L40;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 51: goto L51;
+        case 52: goto L52;
+        case 58: goto L58;
+        case 60: goto L60;
+        case 61: goto L61;
+        case 88: goto L88;
+        case 91: goto L91;
+        case 92: goto L92;
+        case 93: goto L93;
+        case 94: goto L94;
+        case 97: goto L97;
+        case 98: goto L98;
+        case 99: goto L99;
+        case 100: goto L100;
+        case 103: goto L103;
+        case 104: goto L104;
+        case 105: goto L105;
+        case 106: goto L106;
+        case 109: goto L109;
+        case 110: goto L110;
+        case 111: goto L111;
+        case 112: goto L112;
+        case 115: goto L115;
+        case 116: goto L116;
+        case 117: goto L117;
+        case 118: goto L118;
+        case 121: goto L121;
+        case 122: goto L122;
+        case 123: goto L123;
+        case 124: goto L124;
+        case 127: goto L127;
+        case 128: goto L128;
+        case 129: goto L129;
+        case 130: goto L130;
+        case 137: goto L137;
+        case 138: goto L138;
+        case 141: goto L141;
+        case 142: goto L142;
+        case 143: goto L143;
+        case 144: goto L144;
+        case 145: goto L145;
+        case 156: goto L156;
+        case 160: goto L160;
+        case 161: goto L161;
+        case 162: goto L162;
+        case 163: goto L163;
+        case 166: goto L166;
+        case 169: goto L169;
+        case 171: goto L171;
+        case 175: goto L175;
+        case 176: goto L176;
+        case 177: goto L177;
+        case 185: goto L185;
+        case 188: goto L188;
+        case 191: goto L191;
+        case 193: goto L193;
+        case 197: goto L197;
+        case 198: goto L198;
+        case 203: goto L203;
+        case 204: goto L204;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 151;
+L8: /* VAR */
+L10: /* VAR */
+L12: /* VAR */
+L14: /* STRING */
+    tp_aot_op(tp, f, code + 14);
+L23: /* FILE */
+    f->fname = regs[3];
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L28: /* NAME */
+    f->name = regs[3];
+L29: /* LINE */
+    f->line = code + 29;
+    f->lineno = 152;
+L35: /* GET */
+    regs[3] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[3]);
+L36: /* NUMBER */
+    tp_aot_op(tp, f, code + 36);
+L39: /* ADD */
+    if (TP_BOTH(regs[1], regs[4], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[1].nint + regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 39);
+    }
+L40: /* VAR */
+L42: /* MOVE */
+    regs[7] = regs[3];
+L43: /* MOVE */
+    regs[1] = regs[5];
+L44: /* LINE */
+    f->line = code + 44;
+    f->lineno = 153;
+L49: /* LT */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[3] = tp_bool(regs[1].nint < regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 49);
+    }
+L50: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L52;
+    }
+L51: /* JUMP */
+    goto L145;
+L52: /* LINE */
+    f->line = code + 52;
+    f->lineno = 154;
+L58: /* VAR */
+L60: /* GET */
+    regs[3] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[3]);
+L61: /* LINE */
+    f->line = code + 61;
+    f->lineno = 155;
+L88: /* STRING */
+    tp_aot_op(tp, f, code + 88);
+L91: /* LT */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[3].nint < regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 91);
+    }
+L92: /* IFN */
+    if (!(TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5]))) {
+        goto L94;
+    }
+L93: /* JUMP */
+    goto L98;
+L94: /* STRING */
+    tp_aot_op(tp, f, code + 94);
+L97: /* GT */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[3].nint > regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 97);
+    }
+L98: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L100;
+    }
+L99: /* JUMP */
+    goto L110;
+L100: /* STRING */
+    tp_aot_op(tp, f, code + 100);
+L103: /* LT */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[3].nint < regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 103);
+    }
+L104: /* IFN */
+    if (!(TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5]))) {
+        goto L106;
+    }
+L105: /* JUMP */
+    goto L110;
+L106: /* STRING */
+    tp_aot_op(tp, f, code + 106);
+L109: /* GT */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[3].nint > regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 109);
+    }
+L110: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L112;
+    }
+L111: /* JUMP */
+    goto L122;
+L112: /* STRING */
+    tp_aot_op(tp, f, code + 112);
+L115: /* LT */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[3].nint < regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 115);
+    }
+L116: /* IFN */
+    if (!(TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5]))) {
+        goto L118;
+    }
+L117: /* JUMP */
+    goto L122;
+L118: /* STRING */
+    tp_aot_op(tp, f, code + 118);
+L121: /* GT */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[3].nint > regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 121);
+    }
+L122: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L124;
+    }
+L123: /* JUMP */
+    goto L128;
+L124: /* STRING */
+    tp_aot_op(tp, f, code + 124);
+L127: /* NE */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[5] = tp_bool(regs[3].nint != regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 127);
+    }
+L128: /* IFN */
+    if (!(TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5]))) {
+        goto L130;
+    }
+L129: /* JUMP */
+    goto L145;
+L130: /* LINE */
+    f->line = code + 130;
+    f->lineno = 156;
+L137: /* ADD */
+    if (TP_BOTH(regs[7], regs[3], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[7].nint + regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 137);
+    }
+L138: /* NUMBER */
+    tp_aot_op(tp, f, code + 138);
+L141: /* ADD */
+    if (TP_BOTH(regs[1], regs[6], TP_NUMBER_INT)) {
+        regs[4] = tp_int(regs[1].nint + regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 141);
+    }
+L142: /* MOVE */
+    regs[7] = regs[5];
+L143: /* MOVE */
+    regs[1] = regs[4];
+L144: /* JUMP */
+    tp_aot_safepoint(tp, 95);
+    goto L49;
+L145: /* LINE */
+    f->line = code + 145;
+    f->lineno = 157;
+L156: /* GGET */
+    tp_aot_op(tp, f, code + 156);
+L160: /* IN */
+    regs[5] = tp_has(tp, regs[4], regs[7]);
+L161: /* IF */
+    if (TP_IS_INT(regs[5]) ? regs[5].nint != 0 : tp_true(tp, regs[5])) {
+        goto L163;
+    }
+L162: /* JUMP */
+    goto L177;
+L163: /* GGET */
+    tp_aot_op(tp, f, code + 163);
+L166: /* STRING */
+    tp_aot_op(tp, f, code + 166);
+L169: /* METHOD */
+    tp_aot_op(tp, f, code + 169);
+L171: /* STRING */
+    tp_aot_op(tp, f, code + 171);
+L175: /* CALLM */
+    return code + 175;
+L176: /* JUMP */
+    goto L198;
+L177: /* LINE */
+    f->line = code + 177;
+    f->lineno = 158;
+L185: /* GGET */
+    tp_aot_op(tp, f, code + 185);
+L188: /* STRING */
+    tp_aot_op(tp, f, code + 188);
+L191: /* METHOD */
+    tp_aot_op(tp, f, code + 191);
+L193: /* STRING */
+    tp_aot_op(tp, f, code + 193);
+L197: /* CALLM */
+    return code + 197;
+L198: /* LINE */
+    f->line = code + 198;
+    f->lineno = 159;
+L203: /* RETURN */
+    return code + 203;
+L204: /* EOF */
+    return code + 204;
+}
+
+static tpd_code * _tp_tinypy_compiler_tokenize_4121(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 15: goto L15;
+        case 24: goto L24;
+        case 25: goto L25;
+        case 30: goto L30;
+        case 31: goto L31;
+        case 39: goto L39;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 52: goto L52;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 73: goto L73;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 78: goto L78;
+        case 79: goto L79;
+        case 80: goto L80;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 85: goto L85;
+        case 86: goto L86;
+        case 87: goto L87;
+        case 88: goto L88;
+        case 93: goto L93;
+        case 96: goto L96;
+        case 97: goto L97;
+        case 104: goto L104;
+        case 107: goto L107;
+        case 108: goto L108;
+        case 109: goto L109;
+        case 110: goto L110;
+        case 111: goto L111;
+        case 118: goto L118;
+        case 120: goto L120;
+        case 121: goto L121;
+        case 136: goto L136;
+        case 137: goto L137;
+        case 138: goto L138;
+        case 139: goto L139;
+        case 142: goto L142;
+        case 143: goto L143;
+        case 144: goto L144;
+        case 145: goto L145;
+        case 146: goto L146;
+        case 147: goto L147;
+        case 150: goto L150;
+        case 151: goto L151;
+        case 152: goto L152;
+        case 153: goto L153;
+        case 154: goto L154;
+        case 155: goto L155;
+        case 162: goto L162;
+        case 165: goto L165;
+        case 166: goto L166;
+        case 176: goto L176;
+        case 179: goto L179;
+        case 182: goto L182;
+        case 184: goto L184;
+        case 188: goto L188;
+        case 189: goto L189;
+        case 190: goto L190;
+        case 197: goto L197;
+        case 198: goto L198;
+        case 204: goto L204;
+        case 215: goto L215;
+        case 219: goto L219;
+        case 221: goto L221;
+        case 222: goto L222;
+        case 223: goto L223;
+        case 226: goto L226;
+        case 227: goto L227;
+        case 228: goto L228;
+        case 229: goto L229;
+        case 243: goto L243;
+        case 246: goto L246;
+        case 247: goto L247;
+        case 248: goto L248;
+        case 249: goto L249;
+        case 252: goto L252;
+        case 255: goto L255;
+        case 257: goto L257;
+        case 260: goto L260;
+        case 261: goto L261;
+        case 262: goto L262;
+        case 265: goto L265;
+        case 268: goto L268;
+        case 269: goto L269;
+        case 272: goto L272;
+        case 275: goto L275;
+        case 276: goto L276;
+        case 277: goto L277;
+        case 283: goto L283;
+        case 284: goto L284;
+        case 285: goto L285;
+        case 286: goto L286;
+        case 293: goto L293;
+        case 294: goto L294;
+        case 302: goto L302;
+        case 305: goto L305;
+        case 306: goto L306;
+        case 307: goto L307;
+        case 308: goto L308;
+        case 318: goto L318;
+        case 321: goto L321;
+        case 322: goto L322;
+        case 323: goto L323;
+        case 334: goto L334;
+        case 337: goto L337;
+        case 338: goto L338;
+        case 339: goto L339;
+        case 340: goto L340;
+        case 343: goto L343;
+        case 344: goto L344;
+        case 356: goto L356;
+        case 359: goto L359;
+        case 360: goto L360;
+        case 361: goto L361;
+        case 362: goto L362;
+        case 365: goto L365;
+        case 366: goto L366;
+        case 378: goto L378;
+        case 381: goto L381;
+        case 382: goto L382;
+        case 383: goto L383;
+        case 384: goto L384;
+        case 387: goto L387;
+        case 388: goto L388;
+        case 400: goto L400;
+        case 403: goto L403;
+        case 404: goto L404;
+        case 405: goto L405;
+        case 406: goto L406;
+        case 409: goto L409;
+        case 410: goto L410;
+        case 423: goto L423;
+        case 426: goto L426;
+        case 427: goto L427;
+        case 428: goto L428;
+        case 429: goto L429;
+        case 432: goto L432;
+        case 433: goto L433;
+        case 434: goto L434;
+        case 435: goto L435;
+        case 436: goto L436;
+        case 451: goto L451;
+        case 455: goto L455;
+        case 458: goto L458;
+        case 461: goto L461;
+        case 462: goto L462;
+        case 465: goto L465;
+        case 466: goto L466;
+        case 467: goto L467;
+        case 468: goto L468;
+        case 471: goto L471;
+        case 472: goto L472;
+        case 473: goto L473;
+        case 474: goto L474;
+        case 483: goto L483;
+        case 486: goto L486;
+        case 487: goto L487;
+        case 488: goto L488;
+        case 500: goto L500;
+        case 503: goto L503;
+        case 504: goto L504;
+        case 505: goto L505;
+        case 506: goto L506;
+        case 509: goto L509;
+        case 510: goto L510;
+        case 523: goto L523;
+        case 527: goto L527;
+        case 532: goto L532;
+        case 533: goto L533;
+        case 536: goto L536;
+        case 539: goto L539;
+        case 541: goto L541;
+        case 542: goto L542;
+        case 551: goto L551;
+        case 552: goto L552;
+        case 555: goto L555;
+        case 556: goto L556;
+        case 557: goto L557;
+        case 558: goto L558;
+        case 559: goto L559;
+        case 567: goto L567;
+        case 568: goto L568;
+        case 569: goto L569;
+        case 570: goto L570;
+        case 577: goto L577;
+        case 580: goto L580;
+        case 581: goto L581;
+        case 591: goto L591;
+        case 594: goto L594;
+        case 597: goto L597;
+        case 599: goto L599;
+        case 603: goto L603;
+        case 604: goto L604;
+        case 605: goto L605;
+        case 612: goto L612;
+        case 613: goto L613;
+        case 624: goto L624;
+        case 628: goto L628;
+        case 630: goto L630;
+        case 631: goto L631;
+        case 632: goto L632;
+        case 635: goto L635;
+        case 636: goto L636;
+        case 637: goto L637;
+        case 638: goto L638;
+        case 639: goto L639;
+        case 644: goto L644;
+        case 645: goto L645;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 161;
+L9: /* VAR */
+L11: /* VAR */
+L13: /* VAR */
+L15: /* STRING */
+    tp_aot_op(tp, f, code + 15);
+L24: /* FILE */
+    f->fname = regs[3];
+L25: /* STRING */
+    tp_aot_op(tp, f, code + 25);
+L30: /* NAME */
+    f->name = regs[3];
+L31: /* LINE */
+    f->line = code + 31;
+    f->lineno = 162;
+L39: /* STRING */
+    tp_aot_op(tp, f, code + 39);
+L42: /* GET */
+    regs[4] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[4]);
+L43: /* NUMBER */
+    tp_aot_op(tp, f, code + 43);
+L46: /* ADD */
+    if (TP_BOTH(regs[1], regs[5], TP_NUMBER_INT)) {
+        regs[8] = tp_int(regs[1].nint + regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 46);
+    }
+L47: /* VAR */
+L49: /* MOVE */
+    regs[11] = regs[3];
+L50: /* VAR */
+L52: /* MOVE */
+    regs[3] = regs[4];
+L53: /* MOVE */
+    regs[1] = regs[8];
+L54: /* LINE */
+    f->line = code + 54;
+    f->lineno = 163;
+L69: /* SUB */
+    if (TP_BOTH(regs[2], regs[1], TP_NUMBER_INT)) {
+        regs[4] = tp_int(regs[2].nint - regs[1].nint);
+    } else {
+        tp_aot_op(tp, f, code + 69);
+    }
+L70: /* NUMBER */
+    tp_aot_op(tp, f, code + 70);
+L73: /* GE */
+    if (TP_BOTH(regs[4], regs[8], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[4].nint >= regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 73);
+    }
+L74: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L76;
+    }
+L75: /* JUMP */
+    goto L78;
+L76: /* GET */
+    regs[4] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[4]);
+L77: /* EQ */
+    if (TP_BOTH(regs[4], regs[3], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[4].nint == regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 77);
+    }
+L78: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L80;
+    }
+L79: /* JUMP */
+    goto L86;
+L80: /* NUMBER */
+    tp_aot_op(tp, f, code + 80);
+L83: /* ADD */
+    if (TP_BOTH(regs[1], regs[5], TP_NUMBER_INT)) {
+        regs[8] = tp_int(regs[1].nint + regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 83);
+    }
+L84: /* GET */
+    regs[4] = tp_get(tp, regs[0], regs[8]);
+    tp_grey(tp, regs[4]);
+L85: /* EQ */
+    if (TP_BOTH(regs[4], regs[3], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[4].nint == regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 85);
+    }
+L86: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L88;
+    }
+L87: /* JUMP */
+    goto L277;
+L88: /* LINE */
+    f->line = code + 88;
+    f->lineno = 164;
+L93: /* NUMBER */
+    tp_aot_op(tp, f, code + 93);
+L96: /* ADD */
+    if (TP_BOTH(regs[1], regs[8], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 96);
+    }
+L97: /* LINE */
+    f->line = code + 97;
+    f->lineno = 165;
+L104: /* NUMBER */
+    tp_aot_op(tp, f, code + 104);
+L107: /* SUB */
+    if (TP_BOTH(regs[2], regs[5], TP_NUMBER_INT)) {
+        regs[8] = tp_int(regs[2].nint - regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 107);
+    }
+L108: /* LT */
+    if (TP_BOTH(regs[1], regs[8], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[1].nint < regs[8].nint);
+    } else {
+        tp_aot_op(tp, f, code + 108);
+    }
+L109: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L111;
+    }
+L110: /* JUMP */
+    goto L639;
+L111: /* LINE */
+    f->line = code + 111;
+    f->lineno = 166;
+L118: /* VAR */
+L120: /* GET */
+    regs[4] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[4]);
+L121: /* LINE */
+    f->line = code + 121;
+    f->lineno = 167;
+L136: /* EQ */
+    if (TP_BOTH(regs[4], regs[3], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[4].nint == regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 136);
+    }
+L137: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L139;
+    }
+L138: /* JUMP */
+    goto L145;
+L139: /* NUMBER */
+    tp_aot_op(tp, f, code + 139);
+L142: /* ADD */
+    if (TP_BOTH(regs[1], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[1].nint + regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 142);
+    }
+L143: /* GET */
+    regs[8] = tp_get(tp, regs[0], regs[5]);
+    tp_grey(tp, regs[8]);
+L144: /* EQ */
+    if (TP_BOTH(regs[8], regs[3], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[8].nint == regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 144);
+    }
+L145: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L147;
+    }
+L146: /* JUMP */
+    goto L153;
+L147: /* NUMBER */
+    tp_aot_op(tp, f, code + 147);
+L150: /* ADD */
+    if (TP_BOTH(regs[1], regs[6], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[1].nint + regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 150);
+    }
+L151: /* GET */
+    regs[8] = tp_get(tp, regs[0], regs[5]);
+    tp_grey(tp, regs[8]);
+L152: /* EQ */
+    if (TP_BOTH(regs[8], regs[3], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[8].nint == regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 152);
+    }
+L153: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L155;
+    }
+L154: /* JUMP */
+    goto L198;
+L155: /* LINE */
+    f->line = code + 155;
+    f->lineno = 168;
+L162: /* NUMBER */
+    tp_aot_op(tp, f, code + 162);
+L165: /* ADD */
+    if (TP_BOTH(regs[1], regs[5], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 165);
+    }
+L166: /* LINE */
+    f->line = code + 166;
+    f->lineno = 169;
+L176: /* GGET */
+    tp_aot_op(tp, f, code + 176);
+L179: /* STRING */
+    tp_aot_op(tp, f, code + 179);
+L182: /* METHOD */
+    tp_aot_op(tp, f, code + 182);
+L184: /* STRING */
+    tp_aot_op(tp, f, code + 184);
+L188: /* MOVE */
+    regs[8] = regs[11];
+L189: /* CALLM */
+    return code + 189;
+L190: /* LINE */
+    f->line = code + 190;
+    f->lineno = 170;
+L197: /* JUMP */
+    goto L639;
+L198: /* LINE */
+    f->line = code + 198;
+    f->lineno = 171;
+L204: /* LINE */
+    f->line = code + 204;
+    f->lineno = 172;
+L215: /* STRING */
+    tp_aot_op(tp, f, code + 215);
+L219: /* METHOD */
+    tp_aot_op(tp, f, code + 219);
+L221: /* CALLM */
+    return code + 221;
+L222: /* ADD */
+    if (TP_BOTH(regs[11], regs[6], TP_NUMBER_INT)) {
+        regs[8] = tp_int(regs[11].nint + regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 222);
+    }
+L223: /* NUMBER */
+    tp_aot_op(tp, f, code + 223);
+L226: /* ADD */
+    if (TP_BOTH(regs[1], regs[7], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[1].nint + regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 226);
+    }
+L227: /* MOVE */
+    regs[11] = regs[8];
+L228: /* MOVE */
+    regs[1] = regs[5];
+L229: /* LINE */
+    f->line = code + 229;
+    f->lineno = 173;
+L243: /* STRING */
+    tp_aot_op(tp, f, code + 243);
+L246: /* EQ */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[4].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 246);
+    }
+L247: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L249;
+    }
+L248: /* JUMP */
+    tp_aot_safepoint(tp, 144);
+    goto L104;
+L249: /* GGET */
+    tp_aot_op(tp, f, code + 249);
+L252: /* STRING */
+    tp_aot_op(tp, f, code + 252);
+L255: /* MGET */
+    tp_aot_op(tp, f, code + 255);
+L257: /* NUMBER */
+    tp_aot_op(tp, f, code + 257);
+L260: /* ADD */
+    if (TP_BOTH(regs[5], regs[6], TP_NUMBER_INT)) {
+        regs[8] = tp_int(regs[5].nint + regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 260);
+    }
+L261: /* MOVE */
+    regs[5] = regs[1];
+L262: /* GGET */
+    tp_aot_op(tp, f, code + 262);
+L265: /* STRING */
+    tp_aot_op(tp, f, code + 265);
+L268: /* SET */
+    tp_set(tp, regs[6], regs[7], regs[8]);
+L269: /* GGET */
+    tp_aot_op(tp, f, code + 269);
+L272: /* STRING */
+    tp_aot_op(tp, f, code + 272);
+L275: /* SET */
+    tp_set(tp, regs[8], regs[6], regs[5]);
+L276: /* JUMP */
+    tp_aot_safepoint(tp, 172);
+    goto L104;
+L277: /* LINE */
+    f->line = code + 277;
+    f->lineno = 175;
+L283: /* LT */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[1].nint < regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 283);
+    }
+L284: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L286;
+    }
+L285: /* JUMP */
+    goto L639;
+L286: /* LINE */
+    f->line = code + 286;
+    f->lineno = 176;
+L293: /* GET */
+    regs[4] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[4]);
+L294: /* LINE */
+    f->line = code + 294;
+    f->lineno = 177;
+L302: /* STRING */
+    tp_aot_op(tp, f, code + 302);
+L305: /* EQ */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[4].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 305);
+    }
+L306: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L308;
+    }
+L307: /* JUMP */
+    goto L559;
+L308: /* LINE */
+    f->line = code + 308;
+    f->lineno = 178;
+L318: /* NUMBER */
+    tp_aot_op(tp, f, code + 318);
+L321: /* ADD */
+    if (TP_BOTH(regs[1], regs[5], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 321);
+    }
+L322: /* GET */
+    regs[4] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[4]);
+L323: /* LINE */
+    f->line = code + 323;
+    f->lineno = 179;
+L334: /* STRING */
+    tp_aot_op(tp, f, code + 334);
+L337: /* EQ */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[4].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 337);
+    }
+L338: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L340;
+    }
+L339: /* JUMP */
+    goto L344;
+L340: /* STRING */
+    tp_aot_op(tp, f, code + 340);
+L343: /* JUMP */
+    goto L542;
+L344: /* LINE */
+    f->line = code + 344;
+    f->lineno = 180;
+L356: /* STRING */
+    tp_aot_op(tp, f, code + 356);
+L359: /* EQ */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[4].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 359);
+    }
+L360: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L362;
+    }
+L361: /* JUMP */
+    goto L366;
+L362: /* STRING */
+    tp_aot_op(tp, f, code + 362);
+L365: /* JUMP */
+    goto L542;
+L366: /* LINE */
+    f->line = code + 366;
+    f->lineno = 181;
+L378: /* STRING */
+    tp_aot_op(tp, f, code + 378);
+L381: /* EQ */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[4].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 381);
+    }
+L382: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L384;
+    }
+L383: /* JUMP */
+    goto L388;
+L384: /* STRING */
+    tp_aot_op(tp, f, code + 384);
+L387: /* JUMP */
+    goto L542;
+L388: /* LINE */
+    f->line = code + 388;
+    f->lineno = 182;
+L400: /* STRING */
+    tp_aot_op(tp, f, code + 400);
+L403: /* EQ */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[4].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 403);
+    }
+L404: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L406;
+    }
+L405: /* JUMP */
+    goto L410;
+L406: /* STRING */
+    tp_aot_op(tp, f, code + 406);
+L409: /* JUMP */
+    goto L542;
+L410: /* LINE */
+    f->line = code + 410;
+    f->lineno = 183;
+L423: /* STRING */
+    tp_aot_op(tp, f, code + 423);
+L426: /* EQ */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[4].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 426);
+    }
+L427: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L429;
+    }
+L428: /* JUMP */
+    goto L434;
+L429: /* NUMBER */
+    tp_aot_op(tp, f, code + 429);
+L432: /* ADD */
+    if (TP_BOTH(regs[1], regs[5], TP_NUMBER_INT)) {
+        regs[8] = tp_int(regs[1].nint + regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 432);
+    }
+L433: /* LT */
+    if (TP_BOTH(regs[8], regs[2], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[8].nint < regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 433);
+    }
+L434: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L436;
+    }
+L435: /* JUMP */
+    goto L488;
+L436: /* LINE */
+    f->line = code + 436;
+    f->lineno = 184;
+L451: /* GGET */
+    tp_aot_op(tp, f, code + 451);
+L455: /* GGET */
+    tp_aot_op(tp, f, code + 455);
+L458: /* NUMBER */
+    tp_aot_op(tp, f, code + 458);
+L461: /* ADD */
+    if (TP_BOTH(regs[1], regs[4], TP_NUMBER_INT)) {
+        regs[6] = tp_int(regs[1].nint + regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 461);
+    }
+L462: /* NUMBER */
+    tp_aot_op(tp, f, code + 462);
+L465: /* ADD */
+    if (TP_BOTH(regs[1], regs[4], TP_NUMBER_INT)) {
+        regs[7] = tp_int(regs[1].nint + regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 465);
+    }
+L466: /* LIST */
+    tp_aot_op(tp, f, code + 466);
+L467: /* GET */
+    regs[9] = tp_get(tp, regs[0], regs[4]);
+    tp_grey(tp, regs[9]);
+L468: /* NUMBER */
+    tp_aot_op(tp, f, code + 468);
+L471: /* CALLP */
+    return code + 471;
+L472: /* LIST */
+    tp_aot_op(tp, f, code + 472);
+L473: /* CALLP */
+    return code + 473;
+L474: /* LINE */
+    f->line = code + 474;
+    f->lineno = 185;
+L483: /* NUMBER */
+    tp_aot_op(tp, f, code + 483);
+L486: /* ADD */
+    if (TP_BOTH(regs[1], regs[5], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 486);
+    }
+L487: /* JUMP */
+    goto L542;
+L488: /* LINE */
+    f->line = code + 488;
+    f->lineno = 186;
+L500: /* STRING */
+    tp_aot_op(tp, f, code + 500);
+L503: /* EQ */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[4].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 503);
+    }
+L504: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L506;
+    }
+L505: /* JUMP */
+    goto L510;
+L506: /* STRING */
+    tp_aot_op(tp, f, code + 506);
+L509: /* JUMP */
+    goto L542;
+L510: /* LINE */
+    f->line = code + 510;
+    f->lineno = 188;
+L523: /* GGET */
+    tp_aot_op(tp, f, code + 523);
+L527: /* STRING */
+    tp_aot_op(tp, f, code + 527);
+L532: /* MOVE */
+    regs[7] = regs[0];
+L533: /* GGET */
+    tp_aot_op(tp, f, code + 533);
+L536: /* STRING */
+    tp_aot_op(tp, f, code + 536);
+L539: /* MGET */
+    tp_aot_op(tp, f, code + 539);
+L541: /* CALLP */
+    return code + 541;
+L542: /* LINE */
+    f->line = code + 542;
+    f->lineno = 189;
+L551: /* ADD */
+    if (TP_BOTH(regs[11], regs[4], TP_NUMBER_INT)) {
+        regs[8] = tp_int(regs[11].nint + regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 551);
+    }
+L552: /* NUMBER */
+    tp_aot_op(tp, f, code + 552);
+L555: /* ADD */
+    if (TP_BOTH(regs[1], regs[7], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[1].nint + regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 555);
+    }
+L556: /* MOVE */
+    regs[11] = regs[8];
+L557: /* MOVE */
+    regs[1] = regs[5];
+L558: /* JUMP */
+    tp_aot_safepoint(tp, 275);
+    goto L283;
+L559: /* LINE */
+    f->line = code + 559;
+    f->lineno = 190;
+L567: /* EQ */
+    if (TP_BOTH(regs[4], regs[3], TP_NUMBER_INT)) {
+        regs[8] = tp_bool(regs[4].nint == regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 567);
+    }
+L568: /* IF */
+    if (TP_IS_INT(regs[8]) ? regs[8].nint != 0 : tp_true(tp, regs[8])) {
+        goto L570;
+    }
+L569: /* JUMP */
+    goto L613;
+L570: /* LINE */
+    f->line = code + 570;
+    f->lineno = 191;
+L577: /* NUMBER */
+    tp_aot_op(tp, f, code + 577);
+L580: /* ADD */
+    if (TP_BOTH(regs[1], regs[5], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 580);
+    }
+L581: /* LINE */
+    f->line = code + 581;
+    f->lineno = 192;
+L591: /* GGET */
+    tp_aot_op(tp, f, code + 591);
+L594: /* STRING */
+    tp_aot_op(tp, f, code + 594);
+L597: /* METHOD */
+    tp_aot_op(tp, f, code + 597);
+L599: /* STRING */
+    tp_aot_op(tp, f, code + 599);
+L603: /* MOVE */
+    regs[8] = regs[11];
+L604: /* CALLM */
+    return code + 604;
+L605: /* LINE */
+    f->line = code + 605;
+    f->lineno = 193;
+L612: /* JUMP */
+    goto L639;
+L613: /* LINE */
+    f->line = code + 613;
+    f->lineno = 195;
+L624: /* STRING */
+    tp_aot_op(tp, f, code + 624);
+L628: /* METHOD */
+    tp_aot_op(tp, f, code + 628);
+L630: /* CALLM */
+    return code + 630;
+L631: /* ADD */
+    if (TP_BOTH(regs[11], regs[6], TP_NUMBER_INT)) {
+        regs[8] = tp_int(regs[11].nint + regs[6].nint);
+    } else {
+        tp_aot_op(tp, f, code + 631);
+    }
+L632: /* NUMBER */
+    tp_aot_op(tp, f, code + 632);
+L635: /* ADD */
+    if (TP_BOTH(regs[1], regs[7], TP_NUMBER_INT)) {
+        regs[5] = tp_int(regs[1].nint + regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 635);
+    }
+L636: /* MOVE */
+    regs[11] = regs[8];
+L637: /* MOVE */
+    regs[1] = regs[5];
+L638: /* JUMP */
+    tp_aot_safepoint(tp, 355);
+    goto L283;
+L639: /* LINE */
+    f->line = code + 639;
+    f->lineno = 196;
+L644: /* RETURN */
+    return code + 644;
+L645: /* EOF */
+    return code + 645;
+}
+
+static tpd_code * _tp_tinypy_compiler_tokenize_4797(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 11: goto L11;
+        case 13: goto L13;
+        case 15: goto L15;
+        case 24: goto L24;
+        case 25: goto L25;
+        case 30: goto L30;
+        case 31: goto L31;
+        case 35: goto L35;
+        case 38: goto L38;
+        case 39: goto L39;
+        case 44: goto L44;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 53: goto L53;
+        case 55: goto L55;
+        case 56: goto L56;
+        case 64: goto L64;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 75: goto L75;
+        case 78: goto L78;
+        case 79: goto L79;
+        case 80: goto L80;
+        case 85: goto L85;
+        case 86: goto L86;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 198;
+L9: /* VAR */
+L11: /* VAR */
+L13: /* VAR */
+L15: /* STRING */
+    tp_aot_op(tp, f, code + 15);
+L24: /* FILE */
+    f->fname = regs[3];
+L25: /* STRING */
+    tp_aot_op(tp, f, code + 25);
+L30: /* NAME */
+    f->name = regs[3];
+L31: /* LINE */
+    f->line = code + 31;
+    f->lineno = 199;
+L35: /* NUMBER */
+    tp_aot_op(tp, f, code + 35);
+L38: /* ADD */
+    if (TP_BOTH(regs[1], regs[3], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 38);
+    }
+L39: /* LINE */
+    f->line = code + 39;
+    f->lineno = 200;
+L44: /* LT */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[3] = tp_bool(regs[1].nint < regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 44);
+    }
+L45: /* IF */
+    if (TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3])) {
+        goto L47;
+    }
+L46: /* JUMP */
+    goto L80;
+L47: /* LINE */
+    f->line = code + 47;
+    f->lineno = 201;
+L53: /* VAR */
+L55: /* GET */
+    regs[3] = tp_get(tp, regs[0], regs[1]);
+    tp_grey(tp, regs[3]);
+L56: /* LINE */
+    f->line = code + 56;
+    f->lineno = 202;
+L64: /* STRING */
+    tp_aot_op(tp, f, code + 64);
+L67: /* EQ */
+    if (TP_BOTH(regs[3], regs[4], TP_NUMBER_INT)) {
+        regs[3] = tp_bool(regs[3].nint == regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 67);
+    }
+L68: /* IFN */
+    if (!(TP_IS_INT(regs[3]) ? regs[3].nint != 0 : tp_true(tp, regs[3]))) {
+        goto L70;
+    }
+L69: /* JUMP */
+    goto L80;
+L70: /* LINE */
+    f->line = code + 70;
+    f->lineno = 203;
+L75: /* NUMBER */
+    tp_aot_op(tp, f, code + 75);
+L78: /* ADD */
+    if (TP_BOTH(regs[1], regs[4], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[4].nint);
+    } else {
+        tp_aot_op(tp, f, code + 78);
+    }
+L79: /* JUMP */
+    tp_aot_safepoint(tp, 35);
+    goto L44;
+L80: /* LINE */
+    f->line = code + 80;
+    f->lineno = 204;
+L85: /* RETURN */
+    return code + 85;
+L86: /* EOF */
+    return code + 86;
+}
+
+static tpd_code * _tp_tinypy_compiler_tokenize_143(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 20: goto L20;
+        case 23: goto L23;
+        case 25: goto L25;
+        case 28: goto L28;
+        case 30: goto L30;
+        case 33: goto L33;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 67: goto L67;
+        case 68: goto L68;
+        case 71: goto L71;
+        case 72: goto L72;
+        case 76: goto L76;
+        case 77: goto L77;
+        case 80: goto L80;
+        case 81: goto L81;
+        case 85: goto L85;
+        case 86: goto L86;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 4;
+L20: /* VAR */
+L23: /* VAR */
+L25: /* VAR */
+L28: /* VAR */
+L30: /* VAR */
+L33: /* STRING */
+    tp_aot_op(tp, f, code + 33);
+L42: /* FILE */
+    f->fname = regs[5];
+L43: /* STRING */
+    tp_aot_op(tp, f, code + 43);
+L48: /* NAME */
+    f->name = regs[5];
+L49: /* LINE */
+    f->line = code + 49;
+    f->lineno = 5;
+L67: /* MOVE */
+    regs[5] = regs[1];
+L68: /* STRING */
+    tp_aot_op(tp, f, code + 68);
+L71: /* SET */
+    tp_set(tp, regs[0], regs[1], regs[5]);
+L72: /* STRING */
+    tp_aot_op(tp, f, code + 72);
+L76: /* SET */
+    tp_set(tp, regs[0], regs[5], regs[2]);
+L77: /* STRING */
+    tp_aot_op(tp, f, code + 77);
+L80: /* SET */
+    tp_set(tp, regs[0], regs[5], regs[3]);
+L81: /* STRING */
+    tp_aot_op(tp, f, code + 81);
+L85: /* SET */
+    tp_set(tp, regs[0], regs[5], regs[4]);
+L86: /* EOF */
+    return code + 86;
+}
+
+static tpd_code * _tp_tinypy_compiler_tokenize_254(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 26: goto L26;
+        case 27: goto L27;
+        case 37: goto L37;
+        case 41: goto L41;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 72: goto L72;
+        case 75: goto L75;
+        case 79: goto L79;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 85: goto L85;
+        case 86: goto L86;
+        case 89: goto L89;
+        case 93: goto L93;
+        case 95: goto L95;
+        case 98: goto L98;
+        case 99: goto L99;
+        case 103: goto L103;
+        case 105: goto L105;
+        case 108: goto L108;
+        case 109: goto L109;
+        case 110: goto L110;
+        case 112: goto L112;
+        case 116: goto L116;
+        case 118: goto L118;
+        case 119: goto L119;
+        case 120: goto L120;
+        case 121: goto L121;
+        case 122: goto L122;
+        case 123: goto L123;
+        case 124: goto L124;
+        case 127: goto L127;
+        case 128: goto L128;
+        case 129: goto L129;
+        case 144: goto L144;
+        case 147: goto L147;
+        case 151: goto L151;
+        case 153: goto L153;
+        case 154: goto L154;
+        case 157: goto L157;
+        case 158: goto L158;
+        case 161: goto L161;
+        case 164: goto L164;
+        case 166: goto L166;
+        case 167: goto L167;
+        case 168: goto L168;
+        case 169: goto L169;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 7;
+L9: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[1];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L26: /* NAME */
+    f->name = regs[1];
+L27: /* LINE */
+    f->line = code + 27;
+    f->lineno = 8;
+L37: /* STRING */
+    tp_aot_op(tp, f, code + 37);
+L41: /* MGET */
+    tp_aot_op(tp, f, code + 41);
+L43: /* NONE */
+    regs[2] = tp_None;
+L44: /* NE */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[1].nint != regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 44);
+    }
+L45: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L47;
+    }
+L46: /* JUMP */
+    goto L129;
+L47: /* LINE */
+    f->line = code + 47;
+    f->lineno = 9;
+L72: /* GGET */
+    tp_aot_op(tp, f, code + 72);
+L75: /* STRING */
+    tp_aot_op(tp, f, code + 75);
+L79: /* MGET */
+    tp_aot_op(tp, f, code + 79);
+L81: /* CALLP */
+    return code + 81;
+L82: /* STRING */
+    tp_aot_op(tp, f, code + 82);
+L85: /* ADD */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 85);
+    }
+L86: /* STRING */
+    tp_aot_op(tp, f, code + 86);
+L89: /* STRING */
+    tp_aot_op(tp, f, code + 89);
+L93: /* METHOD */
+    tp_aot_op(tp, f, code + 93);
+L95: /* VAR */
+L98: /* LIST */
+    tp_aot_op(tp, f, code + 98);
+L99: /* STRING */
+    tp_aot_op(tp, f, code + 99);
+L103: /* MGET */
+    tp_aot_op(tp, f, code + 103);
+L105: /* NUMBER */
+    tp_aot_op(tp, f, code + 105);
+L108: /* ITER */
+    if (tp_iter_next(tp, &regs[2], regs[0], &regs[6])) {
+        goto L110;
+    }
+L109: /* JUMP */
+    goto L122;
+L110: /* VAR */
+L112: /* STRING */
+    tp_aot_op(tp, f, code + 112);
+L116: /* METHOD */
+    tp_aot_op(tp, f, code + 116);
+L118: /* CALLM */
+    return code + 118;
+L119: /* NONE */
+    regs[8] = tp_None;
+L120: /* SET */
+    tp_set(tp, regs[5], regs[8], regs[2]);
+L121: /* JUMP */
+    tp_aot_safepoint(tp, 13);
+    goto L108;
+L122: /* CALLM */
+    return code + 122;
+L123: /* ADD */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 123);
+    }
+L124: /* STRING */
+    tp_aot_op(tp, f, code + 124);
+L127: /* ADD */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 127);
+    }
+L128: /* RETURN */
+    return code + 128;
+L129: /* LINE */
+    f->line = code + 129;
+    f->lineno = 11;
+L144: /* GGET */
+    tp_aot_op(tp, f, code + 144);
+L147: /* STRING */
+    tp_aot_op(tp, f, code + 147);
+L151: /* MGET */
+    tp_aot_op(tp, f, code + 151);
+L153: /* CALLP */
+    return code + 153;
+L154: /* STRING */
+    tp_aot_op(tp, f, code + 154);
+L157: /* ADD */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 157);
+    }
+L158: /* GGET */
+    tp_aot_op(tp, f, code + 158);
+L161: /* STRING */
+    tp_aot_op(tp, f, code + 161);
+L164: /* MGET */
+    tp_aot_op(tp, f, code + 164);
+L166: /* CALLP */
+    return code + 166;
+L167: /* ADD */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 167);
+    }
+L168: /* RETURN */
+    return code + 168;
+L169: /* EOF */
+    return code + 169;
+}
+
+static tpd_code * _tp_tinypy_compiler_tokenize_447(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 37: goto L37;
+        case 41: goto L41;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 45: goto L45;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 12;
+L9: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[1];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L27: /* NAME */
+    f->name = regs[1];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 13;
+L37: /* STRING */
+    tp_aot_op(tp, f, code + 37);
+L41: /* METHOD */
+    tp_aot_op(tp, f, code + 41);
+L43: /* CALLM */
+    return code + 43;
+L44: /* RETURN */
+    return code + 44;
+L45: /* EOF */
+    return code + 45;
+}
+
+static tpd_code * _tp_tinypy_compiler_tokenize_518(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 10: goto L10;
+        case 13: goto L13;
+        case 22: goto L22;
+        case 23: goto L23;
+        case 28: goto L28;
+        case 29: goto L29;
+        case 39: goto L39;
+        case 43: goto L43;
+        case 45: goto L45;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 51: goto L51;
+        case 52: goto L52;
+        case 58: goto L58;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 79: goto L79;
+        case 83: goto L83;
+        case 86: goto L86;
+        case 88: goto L88;
+        case 92: goto L92;
+        case 95: goto L95;
+        case 97: goto L97;
+        case 101: goto L101;
+        case 103: goto L103;
+        case 104: goto L104;
+        case 108: goto L108;
+        case 110: goto L110;
+        case 111: goto L111;
+        case 112: goto L112;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 15;
+L10: /* VAR */
+L13: /* STRING */
+    tp_aot_op(tp, f, code + 13);
+L22: /* FILE */
+    f->fname = regs[1];
+L23: /* STRING */
+    tp_aot_op(tp, f, code + 23);
+L28: /* NAME */
+    f->name = regs[1];
+L29: /* LINE */
+    f->line = code + 29;
+    f->lineno = 16;
+L39: /* STRING */
+    tp_aot_op(tp, f, code + 39);
+L43: /* MGET */
+    tp_aot_op(tp, f, code + 43);
+L45: /* STRING */
+    tp_aot_op(tp, f, code + 45);
+L49: /* EQ */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_bool(regs[1].nint == regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 49);
+    }
+L50: /* IF */
+    if (TP_IS_INT(regs[1]) ? regs[1].nint != 0 : tp_true(tp, regs[1])) {
+        goto L52;
+    }
+L51: /* JUMP */
+    goto L60;
+L52: /* LINE */
+    f->line = code + 52;
+    f->lineno = 17;
+L58: /* NONE */
+    regs[1] = tp_None;
+L59: /* RAISE */
+    return code + 59;
+L60: /* LINE */
+    f->line = code + 60;
+    f->lineno = 19;
+L79: /* GGET */
+    tp_aot_op(tp, f, code + 79);
+L83: /* STRING */
+    tp_aot_op(tp, f, code + 83);
+L86: /* MGET */
+    tp_aot_op(tp, f, code + 86);
+L88: /* STRING */
+    tp_aot_op(tp, f, code + 88);
+L92: /* STRING */
+    tp_aot_op(tp, f, code + 92);
+L95: /* MGET */
+    tp_aot_op(tp, f, code + 95);
+L97: /* STRING */
+    tp_aot_op(tp, f, code + 97);
+L101: /* METHOD */
+    tp_aot_op(tp, f, code + 101);
+L103: /* CALLM */
+    return code + 103;
+L104: /* STRING */
+    tp_aot_op(tp, f, code + 104);
+L108: /* MGET */
+    tp_aot_op(tp, f, code + 108);
+L110: /* CALLP */
+    return code + 110;
+L111: /* RETURN */
+    return code + 111;
+L112: /* EOF */
+    return code + 112;
+}
+
+static tpd_code * _tp_tinypy_compiler_tokenize_661(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 11: goto L11;
+        case 14: goto L14;
+        case 17: goto L17;
+        case 26: goto L26;
+        case 27: goto L27;
+        case 31: goto L31;
+        case 32: goto L32;
+        case 39: goto L39;
+        case 42: goto L42;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 56: goto L56;
+        case 57: goto L57;
+        case 58: goto L58;
+        case 59: goto L59;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 21;
+L11: /* VAR */
+L14: /* VAR */
+L17: /* STRING */
+    tp_aot_op(tp, f, code + 17);
+L26: /* FILE */
+    f->fname = regs[2];
+L27: /* STRING */
+    tp_aot_op(tp, f, code + 27);
+L31: /* NAME */
+    f->name = regs[2];
+L32: /* LINE */
+    f->line = code + 32;
+    f->lineno = 22;
+L39: /* NUMBER */
+    tp_aot_op(tp, f, code + 39);
+L42: /* ITER */
+    if (tp_iter_next(tp, &regs[2], regs[1], &regs[3])) {
+        goto L44;
+    }
+L43: /* JUMP */
+    goto L59;
+L44: /* VAR */
+L46: /* MOVE */
+    regs[4] = regs[2];
+L47: /* LINE */
+    f->line = code + 47;
+    f->lineno = 23;
+L56: /* GET */
+    regs[2] = tp_get(tp, regs[1], regs[4]);
+    tp_grey(tp, regs[2]);
+L57: /* SET */
+    tp_set(tp, regs[0], regs[4], regs[2]);
+L58: /* JUMP */
+    tp_aot_safepoint(tp, 16);
+    goto L42;
+L59: /* EOF */
+    return code + 59;
+}
+
+static tpd_code * _tp_tinypy_compiler_tokenize_1461(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 40: goto L40;
+        case 43: goto L43;
+        case 46: goto L46;
+        case 49: goto L49;
+        case 52: goto L52;
+        case 53: goto L53;
+        case 56: goto L56;
+        case 57: goto L57;
+        case 60: goto L60;
+        case 61: goto L61;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 79: goto L79;
+        case 80: goto L80;
+        case 83: goto L83;
+        case 86: goto L86;
+        case 87: goto L87;
+        case 91: goto L91;
+        case 92: goto L92;
+        case 96: goto L96;
+        case 97: goto L97;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 47;
+L9: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[1];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L27: /* NAME */
+    f->name = regs[1];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 48;
+L40: /* NUMBER */
+    tp_aot_op(tp, f, code + 40);
+L43: /* NUMBER */
+    tp_aot_op(tp, f, code + 43);
+L46: /* NUMBER */
+    tp_aot_op(tp, f, code + 46);
+L49: /* STRING */
+    tp_aot_op(tp, f, code + 49);
+L52: /* SET */
+    tp_set(tp, regs[0], regs[4], regs[1]);
+L53: /* STRING */
+    tp_aot_op(tp, f, code + 53);
+L56: /* SET */
+    tp_set(tp, regs[0], regs[1], regs[2]);
+L57: /* STRING */
+    tp_aot_op(tp, f, code + 57);
+L60: /* SET */
+    tp_set(tp, regs[0], regs[1], regs[3]);
+L61: /* LINE */
+    f->line = code + 61;
+    f->lineno = 49;
+L75: /* LIST */
+    tp_aot_op(tp, f, code + 75);
+L76: /* NUMBER */
+    tp_aot_op(tp, f, code + 76);
+L79: /* LIST */
+    tp_aot_op(tp, f, code + 79);
+L80: /* NUMBER */
+    tp_aot_op(tp, f, code + 80);
+L83: /* STRING */
+    tp_aot_op(tp, f, code + 83);
+L86: /* SET */
+    tp_set(tp, regs[0], regs[4], regs[1]);
+L87: /* STRING */
+    tp_aot_op(tp, f, code + 87);
+L91: /* SET */
+    tp_set(tp, regs[0], regs[1], regs[2]);
+L92: /* STRING */
+    tp_aot_op(tp, f, code + 92);
+L96: /* SET */
+    tp_set(tp, regs[0], regs[1], regs[3]);
+L97: /* EOF */
+    return code + 97;
+}
+
+static tpd_code * _tp_tinypy_compiler_tokenize_1597(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 18: goto L18;
+        case 21: goto L21;
+        case 23: goto L23;
+        case 25: goto L25;
+        case 34: goto L34;
+        case 35: goto L35;
+        case 38: goto L38;
+        case 39: goto L39;
+        case 42: goto L42;
+        case 44: goto L44;
+        case 48: goto L48;
+        case 50: goto L50;
+        case 54: goto L54;
+        case 57: goto L57;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 63: goto L63;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 50;
+L18: /* VAR */
+L21: /* VAR */
+L23: /* VAR */
+L25: /* STRING */
+    tp_aot_op(tp, f, code + 25);
+L34: /* FILE */
+    f->fname = regs[3];
+L35: /* STRING */
+    tp_aot_op(tp, f, code + 35);
+L38: /* NAME */
+    f->name = regs[3];
+L39: /* STRING */
+    tp_aot_op(tp, f, code + 39);
+L42: /* MGET */
+    tp_aot_op(tp, f, code + 42);
+L44: /* STRING */
+    tp_aot_op(tp, f, code + 44);
+L48: /* METHOD */
+    tp_aot_op(tp, f, code + 48);
+L50: /* GGET */
+    tp_aot_op(tp, f, code + 50);
+L54: /* STRING */
+    tp_aot_op(tp, f, code + 54);
+L57: /* MGET */
+    tp_aot_op(tp, f, code + 57);
+L59: /* MOVE */
+    regs[5] = regs[1];
+L60: /* MOVE */
+    regs[6] = regs[2];
+L61: /* CALLP */
+    return code + 61;
+L62: /* CALLM */
+    return code + 62;
+L63: /* EOF */
+    return code + 63;
+}
+
+static const tpd_aot _tp_tinypy_compiler_tokenize_aot[] = {
+    {0, _tp_tinypy_compiler_tokenize_0},
+    {80, _tp_tinypy_compiler_tokenize_80},
+    {788, _tp_tinypy_compiler_tokenize_788},
+    {1436, _tp_tinypy_compiler_tokenize_1436},
+    {1701, _tp_tinypy_compiler_tokenize_1701},
+    {1798, _tp_tinypy_compiler_tokenize_1798},
+    {1958, _tp_tinypy_compiler_tokenize_1958},
+    {2654, _tp_tinypy_compiler_tokenize_2654},
+    {2812, _tp_tinypy_compiler_tokenize_2812},
+    {2986, _tp_tinypy_compiler_tokenize_2986},
+    {3267, _tp_tinypy_compiler_tokenize_3267},
+    {3590, _tp_tinypy_compiler_tokenize_3590},
+    {3887, _tp_tinypy_compiler_tokenize_3887},
+    {4121, _tp_tinypy_compiler_tokenize_4121},
+    {4797, _tp_tinypy_compiler_tokenize_4797},
+    {143, _tp_tinypy_compiler_tokenize_143},
+    {254, _tp_tinypy_compiler_tokenize_254},
+    {447, _tp_tinypy_compiler_tokenize_447},
+    {518, _tp_tinypy_compiler_tokenize_518},
+    {661, _tp_tinypy_compiler_tokenize_661},
+    {1461, _tp_tinypy_compiler_tokenize_1461},
+    {1597, _tp_tinypy_compiler_tokenize_1597},
+};
+
+void tinypy_compiler_tokenize_init(TP) {
+    tp_aot_import(tp, "tinypy.compiler.tokenize", _tp_tinypy_compiler_tokenize_tpc, sizeof(_tp_tinypy_compiler_tokenize_tpc),
+        _tp_tinypy_compiler_tokenize_aot, 22);
+}
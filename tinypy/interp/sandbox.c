@@ -1,97 +1,159 @@
+/* File: Sandbox
+ * Limits on the time, memory and instructions of untrusted scripts.
+ *
+ * Nothing here runs per instruction. The VM charges the instruction budget
+ * at loop back-edges and calls (see TP_SAFEPOINT in tp_vm.c); the
+ * allocator and the interval timer only set tp->interrupt; the next charge
+ * then calls tp_sandbox_check, which raises the SandboxError. A limit that
+ * has been hit stays hit, so catching the error does not buy more time. One
+ * long instruction, e.g. a native call, may overshoot the limits.
+ */
+#include <sys/time.h>
+
+/* the VM the interval timer runs for; there is one timer per process. */
+static tp_vm * volatile tp_sandbox_timed = NULL;
+
+static void tp_sandbox_alarm(int sig) {
+    tp_vm * tp = tp_sandbox_timed;
+    if (tp) {
+        tp->timed_out = 1;
+        tp->interrupt = 1;
+    }
+}
+
+/* Function: tp_sandbox
+ * Sets the limits of a VM; TP_NO_LIMIT turns a limit off.
+ *
+ * Parameters:
+ * time_limit - wall clock milliseconds from now.
+ * mem_limit - bytes allocated by the VM.
+ * insn_limit - instructions from now.
+ */
+void tp_sandbox(TP, double time_limit, unsigned long mem_limit, long insn_limit) {
+    struct itimerval t;
 
-void tp_sandbox(TP, double time_limit, unsigned long mem_limit) {
     tp->time_limit = time_limit;
     tp->mem_limit = mem_limit;
-}
+    tp->insn_limit = insn_limit;
+    tp->insn_left = insn_limit > 0 ? insn_limit : LONG_MAX;
+    tp->timed_out = 0;
+    tp->interrupt = 1;
 
-void tp_mem_update(TP) {
-/*    static long maxmem = 0;
-    if (tp->mem_used/1024 > maxmem) {
-        maxmem = tp->mem_used/1024; 
-        fprintf(stderr,"%ld k\n",maxmem);
-    }*/
-    if((!tp->mem_exceeded) &&
-       (tp->mem_used > tp->mem_limit) && 
-       (tp->mem_limit != TP_NO_LIMIT)) {
-        tp->mem_exceeded = 1;
-        tp_raise(,tp_string_atom(tp, "(tp_mem_update) SandboxError: memory limit exceeded"));
+    memset(&t, 0, sizeof(t));
+    if (time_limit > 0) {
+        t.it_value.tv_sec = (long) (time_limit / 1000);
+        t.it_value.tv_usec = (long) (fmod(time_limit, 1000) * 1000) + 1;
+        tp_sandbox_timed = tp;
+        signal(SIGALRM, tp_sandbox_alarm);
+        setitimer(ITIMER_REAL, &t, NULL);
+    } else if (tp_sandbox_timed == tp) {
+        setitimer(ITIMER_REAL, &t, NULL);
+        tp_sandbox_timed = NULL;
     }
-} 
+}
 
-void tp_time_update(TP) {
-    clock_t tmp = tp->clocks;
-    if(tp->time_limit != TP_NO_LIMIT)
-    {
-        tp->clocks = clock();
-        tp->time_elapsed += ((double) (tp->clocks - tmp) / CLOCKS_PER_SEC) * 1000.0;
-        if(tp->time_elapsed >= tp->time_limit)
-            tp_raise(,tp_string_atom(tp, "(tp_time_update) SandboxError: time limit exceeded"));
+/* Function: tp_sandbox_check
+ * Raises a SandboxError if a limit has been hit.
+ *
+ * Called by the VM at a gc safepoint once the instruction budget runs out
+ * or tp->interrupt is set.
+ */
+void tp_sandbox_check(TP) {
+    tp->interrupt = 0;
+    if (tp->mem_limit != TP_NO_LIMIT && tp->mem_used > tp->mem_limit) {
+        /* some of it may be garbage. */
+        tp_gc_run(tp);
+        if (tp->mem_used > tp->mem_limit) {
+            tp->interrupt = 1;
+            tp_raise(, tp_string_atom(tp, "(tp_sandbox_check) SandboxError: memory limit exceeded"));
+        }
+    }
+    if (tp->timed_out) {
+        tp->interrupt = 1;
+        tp_raise(, tp_string_atom(tp, "(tp_sandbox_check) SandboxError: time limit exceeded"));
+    }
+    if (tp->insn_left < 0) {
+        tp->insn_left = -1;
+        tp_raise(, tp_string_atom(tp, "(tp_sandbox_check) SandboxError: instruction limit exceeded"));
     }
 }
 
-#ifdef TP_SANDBOX
+/* count an allocation; past the limit, ask the VM to check at the next
+ * safepoint rather than raise from inside the allocator. */
+static void tp_mem_update(TP) {
+    if (tp->mem_limit != TP_NO_LIMIT && tp->mem_used > tp->mem_limit) {
+        tp->interrupt = 1;
+    }
+}
 
+/* each block carries its size in front of it, for tp_free. */
 void *tp_malloc(TP, unsigned long bytes) {
     unsigned long *ptr = (unsigned long *) calloc(bytes + sizeof(unsigned long), 1);
-    if(ptr) {
-        *ptr = bytes;
-        tp->mem_used += bytes + sizeof(unsigned long);
+    if (!ptr) {
+        return NULL;
     }
+    *ptr = bytes;
+    tp->mem_used += bytes + sizeof(unsigned long);
+    tp->gc_allocated += bytes;
     tp_mem_update(tp);
-    return ptr+1;
+    return ptr + 1;
 }
 
 void tp_free(TP, void *ptr) {
     unsigned long *temp = (unsigned long *) ptr;
-    if(temp) {
+    if (temp) {
         --temp;
-        tp->mem_used -= (*temp + sizeof(unsigned long));
+        tp->mem_used -= *temp + sizeof(unsigned long);
         free(temp);
     }
-    tp_mem_update(tp);
 }
 
 void *tp_realloc(TP, void *ptr, unsigned long bytes) {
     unsigned long *temp = (unsigned long *) ptr;
-    int diff;
-    if(temp && bytes) {
-        --temp;
-        diff = bytes - *temp;
-        *temp = bytes;
-        tp->mem_used += diff;
-        temp = (unsigned long *) realloc(temp, bytes+sizeof(unsigned long));
-        return temp+1;
+    unsigned long old;
+    if (!temp) {
+        return tp_malloc(tp, bytes);
     }
-    else if(temp && !bytes) {
+    if (!bytes) {
         tp_free(tp, temp);
         return NULL;
     }
-    else if(!temp && bytes) {
-        return tp_malloc(tp, bytes);
-    }
-    else {
+    --temp;
+    old = *temp;
+    temp = (unsigned long *) realloc(temp, bytes + sizeof(unsigned long));
+    if (!temp) {
         return NULL;
     }
+    *temp = bytes;
+    tp->mem_used = tp->mem_used - old + bytes;
+    /* only what the block grew by is new to the gc. */
+    if (bytes > old) {
+        tp->gc_allocated += bytes - old;
+    }
+    tp_mem_update(tp);
+    return temp + 1;
 }
 
-#endif
-
-tp_obj tp_sandbox_(TP) {
-    tp_num time = TP_PARAMS_FLOAT();
-    tp_num mem = TP_PARAMS_FLOAT();
-    tp_sandbox(tp, time, mem);
+/* sandbox(time, mem, insns=0): limits this VM for the rest of the script,
+ * see tp_sandbox, and takes away the builtins that reach outside it. */
+tp_obj tpy_sandbox(TP) {
+    static const char * names[] = {"exists", "read", "load", "save", "system", "mtime", 0};
+    double time = TPN_AS_FLOAT(tp_number_cast(tp, TP_PARAMS_TYPE(TP_NUMBER), TP_NUMBER_FLOAT));
+    unsigned long mem = TPN_AS_INT(tp_number_cast(tp, TP_PARAMS_TYPE(TP_NUMBER), TP_NUMBER_INT));
+    long insns = TPN_AS_INT(tp_number_cast(tp,
+        tp_check_type(tp, TP_NUMBER, TP_PARAMS_DEFAULT(tp_int(TP_NO_LIMIT))), TP_NUMBER_INT));
+    tp_obj os;
+    int i;
+    tp_sandbox(tp, time, mem, insns);
     tp_del(tp, tp->builtins, tp_string_atom(tp, "sandbox"));
-    tp_del(tp, tp->builtins, tp_string_atom(tp, "mtime"));
-    tp_del(tp, tp->builtins, tp_string_atom(tp, "load"));
-    tp_del(tp, tp->builtins, tp_string_atom(tp, "save"));
-    tp_del(tp, tp->builtins, tp_string_atom(tp, "system"));
-    return tp_None;
-}
-
-void tp_bounds(TP, tpd_code *cur, int n) {
-    char *s = (char *)(cur + n);
-    tp_obj code = tp->frames[tp->cur].code;
-    if (s < code.string.info->s || s > (code.string.info->s+tp_string_len(code))) {
-        tp_raise(,tp_string_atom(tp, "(tp_bounds) SandboxError: bytecode bounds reached"));
+    if (tp_iget(tp, &os, tp->modules, tp_string_atom(tp, "os"))) {
+        for (i = 0; names[i]; i++) {
+            tp_obj k = tp_string_atom(tp, names[i]);
+            tp_obj v;
+            if (tp_iget(tp, &v, os, k)) {
+                tp_del(tp, os, k);
+            }
+        }
     }
+    return tp_None;
 }
@@ -100,7 +100,8 @@ void tp_module_corelib_init(TP, int enable_py_runtime) {
     tp_module_os_init(tp);
 
     if(enable_py_runtime) {
-        tp_import_from_buffer(tp, 0, "tinypy.runtime.types", _tp_types_tpc,  sizeof(_tp_types_tpc));
-        tp_import_from_buffer(tp, 0, "tinypy.runtime.testing", _tp_testing_tpc,  sizeof(_tp_testing_tpc));
+        /* compiled to C with tpc -a, see tp_aot.c. */
+        tinypy_runtime_types_init(tp);
+        tinypy_runtime_testing_init(tp);
     }
 }
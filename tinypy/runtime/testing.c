@@ -0,0 +1,2537 @@
+/* Generated from tinypy/runtime/testing.py with tpc -a. Do not modify. */
+#include <tinypy/tp.h>
+
+static unsigned char _tp_tinypy_runtime_testing_tpc[] = {
+0x2d,0x08,0x00,0x0e,0x00,0x00,0x00,0x00,0x1f,0x03,0x00,0x01,0x69,0x6d,0x70,0x6f,
+0x72,0x74,0x20,0x73,0x79,0x73,0x00,0x00,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x72,0x75,0x6e,0x74,0x69,0x6d,0x65,0x2f,0x74,
+0x65,0x73,0x74,0x69,0x6e,0x67,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x00,0x00,0x00,
+0x0d,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x3f,0x00,0x00,0x00,0x23,0x00,0x00,0x00,
+0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x0a,0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,
+0x5f,0x5f,0x00,0x00,0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x73,0x79,0x73,0x00,
+0x1d,0x03,0x00,0x00,0x37,0x00,0x01,0x03,0x0d,0x01,0x00,0x03,0x00,0x00,0x00,0x03,
+0x73,0x79,0x73,0x00,0x0f,0x01,0x00,0x00,0x1f,0x0b,0x00,0x02,0x66,0x72,0x6f,0x6d,
+0x20,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x72,0x75,0x6e,0x74,0x69,0x6d,0x65,0x2e,
+0x74,0x79,0x70,0x65,0x73,0x20,0x69,0x6d,0x70,0x6f,0x72,0x74,0x20,0x45,0x78,0x63,
+0x65,0x70,0x74,0x69,0x6f,0x6e,0x00,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x0a,
+0x5f,0x5f,0x69,0x6d,0x70,0x6f,0x72,0x74,0x5f,0x5f,0x00,0x00,0x0d,0x02,0x00,0x04,
+0x00,0x00,0x00,0x14,0x74,0x69,0x6e,0x79,0x70,0x79,0x2e,0x72,0x75,0x6e,0x74,0x69,
+0x6d,0x65,0x2e,0x74,0x79,0x70,0x65,0x73,0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x05,
+0x00,0x00,0x00,0x09,0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x00,0x00,0x00,
+0x1c,0x03,0x04,0x01,0x37,0x00,0x01,0x03,0x0e,0x01,0x00,0x06,0x00,0x00,0x00,0x08,
+0x5f,0x5f,0x64,0x69,0x63,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,0x32,0x01,0x00,0x00,
+0x1f,0x05,0x00,0x04,0x64,0x65,0x66,0x20,0x66,0x67,0x63,0x6f,0x6c,0x6f,0x72,0x28,
+0x63,0x6f,0x64,0x65,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x04,0x2a,0x24,0x31,0x33,
+0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x07,0x00,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,
+0x00,0x00,0x00,0x00,0x1c,0x01,0x05,0x01,0x1c,0x02,0x00,0x00,0x1d,0x03,0x00,0x00,
+0x1d,0x04,0x00,0x00,0x11,0x00,0x00,0x5b,0x2d,0x05,0x00,0x08,0x00,0x00,0x00,0x00,
+0x1f,0x05,0x00,0x04,0x64,0x65,0x66,0x20,0x66,0x67,0x63,0x6f,0x6c,0x6f,0x72,0x28,
+0x63,0x6f,0x64,0x65,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x04,0x63,0x6f,0x64,0x65,
+0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x72,0x75,0x6e,0x74,0x69,0x6d,0x65,0x2f,0x74,0x65,0x73,0x74,0x69,
+0x6e,0x67,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,
+0x00,0x00,0x00,0x07,0x66,0x67,0x63,0x6f,0x6c,0x6f,0x72,0x00,0x23,0x01,0x00,0x00,
+0x1f,0x05,0x00,0x05,0x20,0x20,0x20,0x20,0x45,0x53,0x43,0x20,0x3d,0x20,0x63,0x68,
+0x72,0x28,0x32,0x37,0x29,0x00,0x00,0x00,0x33,0x01,0x00,0x03,0x45,0x53,0x43,0x00,
+0x0e,0x02,0x00,0x02,0x00,0x00,0x00,0x03,0x63,0x68,0x72,0x00,0x0c,0x03,0x00,0x03,
+0x00,0x00,0x69,0x04,0x1b,0x00,0x00,0x00,0x37,0x01,0x02,0x02,0x1f,0x04,0x00,0x06,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x63,0x6f,0x64,0x65,0x3a,0x00,0x00,0x00,0x00,
+0x16,0x00,0x00,0x00,0x13,0x00,0x00,0x1d,0x1f,0x0c,0x00,0x07,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x45,0x53,0x43,0x20,0x2b,
+0x20,0x22,0x5b,0x31,0x3b,0x22,0x20,0x2b,0x20,0x73,0x74,0x72,0x28,0x63,0x6f,0x64,
+0x65,0x29,0x20,0x2b,0x20,0x22,0x6d,0x22,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x04,
+0x00,0x00,0x00,0x03,0x5b,0x31,0x3b,0x00,0x01,0x01,0x01,0x02,0x0e,0x03,0x00,0x05,
+0x00,0x00,0x00,0x03,0x73,0x74,0x72,0x00,0x10,0x04,0x00,0x00,0x37,0x02,0x03,0x02,
+0x01,0x01,0x01,0x02,0x0d,0x02,0x00,0x06,0x00,0x00,0x00,0x01,0x6d,0x00,0x00,0x00,
+0x01,0x01,0x01,0x02,0x15,0x01,0x00,0x00,0x1f,0x07,0x00,0x09,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x45,0x53,0x43,0x20,0x2b,
+0x20,0x22,0x5b,0x30,0x6d,0x22,0x00,0x00,0x0d,0x02,0x00,0x07,0x00,0x00,0x00,0x03,
+0x5b,0x30,0x6d,0x00,0x01,0x01,0x01,0x02,0x15,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x08,0x00,0x00,0x00,0x07,0x66,0x67,0x63,0x6f,0x6c,0x6f,0x72,0x00,
+0x0f,0x01,0x00,0x00,0x1f,0x05,0x00,0x0b,0x63,0x6c,0x61,0x73,0x73,0x20,0x54,0x65,
+0x73,0x74,0x52,0x65,0x73,0x75,0x6c,0x74,0x3a,0x00,0x00,0x00,0x34,0x01,0x00,0x00,
+0x33,0x01,0x00,0x04,0x2a,0x24,0x32,0x30,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x09,
+0x00,0x00,0x00,0x0a,0x54,0x65,0x73,0x74,0x52,0x65,0x73,0x75,0x6c,0x74,0x00,0x00,
+0x0f,0x02,0x01,0x00,0x0e,0x03,0x00,0x0a,0x00,0x00,0x00,0x07,0x73,0x65,0x74,0x6d,
+0x65,0x74,0x61,0x00,0x10,0x04,0x01,0x00,0x0e,0x05,0x00,0x0b,0x00,0x00,0x00,0x06,
+0x6f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x37,0x02,0x03,0x03,0x33,0x01,0x00,0x04,
+0x2a,0x24,0x32,0x36,0x00,0x00,0x00,0x00,0x1c,0x02,0x00,0x00,0x1c,0x03,0x00,0x00,
+0x1d,0x04,0x00,0x00,0x1d,0x05,0x00,0x00,0x11,0x01,0x00,0xa7,0x2d,0x05,0x00,0x07,
+0x00,0x00,0x00,0x00,0x1f,0x05,0x00,0x0b,0x63,0x6c,0x61,0x73,0x73,0x20,0x54,0x65,
+0x73,0x74,0x52,0x65,0x73,0x75,0x6c,0x74,0x3a,0x00,0x00,0x00,0x1f,0x0d,0x00,0x0c,
+0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,
+0x28,0x73,0x65,0x6c,0x66,0x2c,0x20,0x6e,0x61,0x6d,0x65,0x2c,0x20,0x70,0x61,0x73,
+0x73,0x65,0x64,0x2c,0x20,0x65,0x78,0x63,0x2c,0x20,0x73,0x74,0x61,0x63,0x6b,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x03,0x2a,0x24,0x30,0x00,0x0d,0x00,0x00,0x00,
+0x00,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x01,
+0x00,0x00,0x00,0x04,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x02,
+0x00,0x00,0x00,0x06,0x70,0x61,0x73,0x73,0x65,0x64,0x00,0x00,0x0d,0x03,0x00,0x03,
+0x00,0x00,0x00,0x03,0x65,0x78,0x63,0x00,0x0d,0x04,0x00,0x04,0x00,0x00,0x00,0x05,
+0x73,0x74,0x61,0x63,0x6b,0x00,0x00,0x00,0x1c,0x01,0x00,0x05,0x1c,0x02,0x00,0x00,
+0x1d,0x03,0x00,0x00,0x1d,0x04,0x00,0x00,0x11,0x00,0x00,0x63,0x2d,0x07,0x00,0x06,
+0x00,0x00,0x00,0x00,0x1f,0x0d,0x00,0x0c,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,
+0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,0x28,0x73,0x65,0x6c,0x66,0x2c,0x20,0x6e,
+0x61,0x6d,0x65,0x2c,0x20,0x70,0x61,0x73,0x73,0x65,0x64,0x2c,0x20,0x65,0x78,0x63,
+0x2c,0x20,0x73,0x74,0x61,0x63,0x6b,0x29,0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x04,
+0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x04,0x6e,0x61,0x6d,0x65,
+0x00,0x00,0x00,0x00,0x33,0x02,0x00,0x06,0x70,0x61,0x73,0x73,0x65,0x64,0x00,0x00,
+0x33,0x03,0x00,0x03,0x65,0x78,0x63,0x00,0x33,0x04,0x00,0x05,0x73,0x74,0x61,0x63,
+0x6b,0x00,0x00,0x00,0x0d,0x05,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x72,0x75,0x6e,0x74,0x69,0x6d,0x65,0x2f,0x74,0x65,0x73,0x74,0x69,
+0x6e,0x67,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x05,0x00,0x00,0x0d,0x05,0x00,0x01,
+0x00,0x00,0x00,0x08,0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,
+0x23,0x05,0x00,0x00,0x1f,0x08,0x00,0x0d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x73,0x65,0x6c,0x66,0x2e,0x70,0x61,0x73,0x73,0x65,0x64,0x20,0x3d,0x20,0x70,0x61,
+0x73,0x73,0x65,0x64,0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x02,0x00,0x00,0x00,0x06,
+0x70,0x61,0x73,0x73,0x65,0x64,0x00,0x00,0x0b,0x00,0x05,0x02,0x1f,0x07,0x00,0x0e,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,0x2e,0x6e,0x61,0x6d,
+0x65,0x20,0x3d,0x20,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x03,
+0x00,0x00,0x00,0x04,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,0x0b,0x00,0x05,0x01,
+0x1f,0x06,0x00,0x0f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,
+0x2e,0x65,0x78,0x63,0x20,0x3d,0x20,0x65,0x78,0x63,0x00,0x00,0x0d,0x05,0x00,0x04,
+0x00,0x00,0x00,0x03,0x65,0x78,0x63,0x00,0x0b,0x00,0x05,0x03,0x1f,0x07,0x00,0x10,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,0x2e,0x73,0x74,0x61,
+0x63,0x6b,0x20,0x3d,0x20,0x73,0x74,0x61,0x63,0x6b,0x00,0x00,0x0d,0x05,0x00,0x05,
+0x00,0x00,0x00,0x05,0x73,0x74,0x61,0x63,0x6b,0x00,0x00,0x00,0x0b,0x00,0x05,0x04,
+0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x08,0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,
+0x00,0x00,0x00,0x00,0x10,0x01,0x00,0x00,0x0e,0x02,0x00,0x05,0x00,0x00,0x00,0x0a,
+0x54,0x65,0x73,0x74,0x52,0x65,0x73,0x75,0x6c,0x74,0x00,0x00,0x33,0x02,0x00,0x04,
+0x2a,0x24,0x31,0x30,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x06,0x00,0x00,0x00,0x08,
+0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,0x0b,0x02,0x03,0x01,
+0x00,0x00,0x00,0x00,0x1d,0x03,0x00,0x00,0x1d,0x04,0x00,0x00,0x14,0x02,0x01,0x03,
+0x1f,0x07,0x00,0x12,0x63,0x6c,0x61,0x73,0x73,0x20,0x54,0x65,0x73,0x74,0x45,0x72,
+0x72,0x6f,0x72,0x28,0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x29,0x3a,0x00,
+0x34,0x02,0x00,0x00,0x33,0x02,0x00,0x04,0x2a,0x24,0x33,0x34,0x00,0x00,0x00,0x00,
+0x0d,0x03,0x00,0x0c,0x00,0x00,0x00,0x09,0x54,0x65,0x73,0x74,0x45,0x72,0x72,0x6f,
+0x72,0x00,0x00,0x00,0x0f,0x03,0x02,0x00,0x0e,0x04,0x00,0x0a,0x00,0x00,0x00,0x07,
+0x73,0x65,0x74,0x6d,0x65,0x74,0x61,0x00,0x10,0x05,0x02,0x00,0x0e,0x06,0x00,0x05,
+0x00,0x00,0x00,0x09,0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x00,0x00,0x00,
+0x37,0x03,0x04,0x03,0x33,0x02,0x00,0x04,0x2a,0x24,0x34,0x30,0x00,0x00,0x00,0x00,
+0x1c,0x03,0x00,0x00,0x1c,0x04,0x00,0x00,0x1d,0x05,0x00,0x00,0x1d,0x06,0x00,0x00,
+0x11,0x02,0x00,0x17,0x2d,0x02,0x00,0x01,0x00,0x00,0x00,0x00,0x1f,0x07,0x00,0x12,
+0x63,0x6c,0x61,0x73,0x73,0x20,0x54,0x65,0x73,0x74,0x45,0x72,0x72,0x6f,0x72,0x28,
+0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x29,0x3a,0x00,0x1f,0x03,0x00,0x13,
+0x20,0x20,0x20,0x20,0x70,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,
+0x00,0x00,0x00,0x09,0x54,0x65,0x73,0x74,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,
+0x33,0x00,0x00,0x03,0x2a,0x24,0x30,0x00,0x00,0x00,0x00,0x00,0x1d,0x04,0x00,0x00,
+0x1d,0x05,0x00,0x00,0x14,0x03,0x02,0x04,0x1f,0x04,0x00,0x15,0x63,0x6c,0x61,0x73,
+0x73,0x20,0x55,0x6e,0x69,0x74,0x54,0x65,0x73,0x74,0x3a,0x00,0x34,0x03,0x00,0x00,
+0x33,0x03,0x00,0x04,0x2a,0x24,0x34,0x38,0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x0d,
+0x00,0x00,0x00,0x08,0x55,0x6e,0x69,0x74,0x54,0x65,0x73,0x74,0x00,0x00,0x00,0x00,
+0x0f,0x04,0x03,0x00,0x0e,0x05,0x00,0x0a,0x00,0x00,0x00,0x07,0x73,0x65,0x74,0x6d,
+0x65,0x74,0x61,0x00,0x10,0x06,0x03,0x00,0x0e,0x07,0x00,0x0b,0x00,0x00,0x00,0x06,
+0x6f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x37,0x04,0x05,0x03,0x33,0x03,0x00,0x04,
+0x2a,0x24,0x35,0x34,0x00,0x00,0x00,0x00,0x1c,0x04,0x00,0x00,0x1c,0x05,0x00,0x00,
+0x1d,0x06,0x00,0x00,0x1d,0x07,0x00,0x00,0x11,0x03,0x06,0x77,0x2d,0x0f,0x00,0x0f,
+0x00,0x00,0x00,0x00,0x1f,0x04,0x00,0x15,0x63,0x6c,0x61,0x73,0x73,0x20,0x55,0x6e,
+0x69,0x74,0x54,0x65,0x73,0x74,0x3a,0x00,0x1f,0x06,0x00,0x16,0x20,0x20,0x20,0x20,
+0x64,0x65,0x66,0x20,0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,0x28,0x73,0x65,0x6c,
+0x66,0x29,0x3a,0x00,0x33,0x00,0x00,0x03,0x2a,0x24,0x30,0x00,0x0d,0x05,0x00,0x00,
+0x00,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,0x1c,0x01,0x05,0x01,
+0x1c,0x02,0x00,0x00,0x1d,0x03,0x00,0x00,0x1d,0x04,0x00,0x00,0x11,0x00,0x00,0x53,
+0x2d,0x03,0x00,0x06,0x00,0x00,0x00,0x00,0x1f,0x06,0x00,0x16,0x20,0x20,0x20,0x20,
+0x64,0x65,0x66,0x20,0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,0x28,0x73,0x65,0x6c,
+0x66,0x29,0x3a,0x00,0x33,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x72,
+0x75,0x6e,0x74,0x69,0x6d,0x65,0x2f,0x74,0x65,0x73,0x74,0x69,0x6e,0x67,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x08,
+0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,
+0x1f,0x0f,0x00,0x17,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,
+0x2e,0x5f,0x6b,0x6e,0x6f,0x77,0x6e,0x5f,0x66,0x61,0x69,0x6c,0x75,0x72,0x65,0x5f,
+0x70,0x72,0x65,0x66,0x69,0x78,0x20,0x3d,0x20,0x27,0x6b,0x6e,0x6f,0x77,0x6e,0x5f,
+0x66,0x61,0x69,0x6c,0x75,0x72,0x65,0x5f,0x74,0x65,0x73,0x74,0x27,0x00,0x00,0x00,
+0x0d,0x01,0x00,0x02,0x00,0x00,0x00,0x12,0x6b,0x6e,0x6f,0x77,0x6e,0x5f,0x66,0x61,
+0x69,0x6c,0x75,0x72,0x65,0x5f,0x74,0x65,0x73,0x74,0x00,0x00,0x0d,0x02,0x00,0x03,
+0x00,0x00,0x00,0x15,0x5f,0x6b,0x6e,0x6f,0x77,0x6e,0x5f,0x66,0x61,0x69,0x6c,0x75,
+0x72,0x65,0x5f,0x70,0x72,0x65,0x66,0x69,0x78,0x00,0x00,0x00,0x0b,0x00,0x02,0x01,
+0x1f,0x09,0x00,0x18,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,
+0x2e,0x5f,0x74,0x65,0x73,0x74,0x5f,0x70,0x72,0x65,0x66,0x69,0x78,0x20,0x3d,0x20,
+0x27,0x74,0x65,0x73,0x74,0x5f,0x27,0x00,0x0d,0x01,0x00,0x04,0x00,0x00,0x00,0x05,
+0x74,0x65,0x73,0x74,0x5f,0x00,0x00,0x00,0x0d,0x02,0x00,0x05,0x00,0x00,0x00,0x0c,
+0x5f,0x74,0x65,0x73,0x74,0x5f,0x70,0x72,0x65,0x66,0x69,0x78,0x00,0x00,0x00,0x00,
+0x0b,0x00,0x02,0x01,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x08,0x5f,0x5f,0x69,0x6e,
+0x69,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,0x10,0x01,0x00,0x00,0x1f,0x0f,0x00,0x1a,
+0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x64,0x69,0x73,0x63,0x6f,0x76,0x65,0x72,
+0x28,0x73,0x65,0x6c,0x66,0x2c,0x20,0x74,0x65,0x73,0x74,0x5f,0x70,0x72,0x65,0x66,
+0x69,0x78,0x2c,0x20,0x6b,0x6e,0x6f,0x77,0x6e,0x5f,0x66,0x61,0x69,0x6c,0x75,0x72,
+0x65,0x5f,0x70,0x72,0x65,0x66,0x69,0x78,0x29,0x3a,0x00,0x00,0x33,0x02,0x00,0x03,
+0x2a,0x24,0x36,0x00,0x0d,0x07,0x00,0x00,0x00,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,
+0x00,0x00,0x00,0x00,0x0d,0x08,0x00,0x01,0x00,0x00,0x00,0x0b,0x74,0x65,0x73,0x74,
+0x5f,0x70,0x72,0x65,0x66,0x69,0x78,0x00,0x0d,0x09,0x00,0x02,0x00,0x00,0x00,0x14,
+0x6b,0x6e,0x6f,0x77,0x6e,0x5f,0x66,0x61,0x69,0x6c,0x75,0x72,0x65,0x5f,0x70,0x72,
+0x65,0x66,0x69,0x78,0x00,0x00,0x00,0x00,0x1c,0x03,0x07,0x03,0x1c,0x04,0x00,0x00,
+0x1d,0x05,0x00,0x00,0x1d,0x06,0x00,0x00,0x11,0x02,0x00,0xbf,0x2d,0x0a,0x00,0x06,
+0x00,0x00,0x00,0x04,0x1f,0x0f,0x00,0x1a,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,
+0x64,0x69,0x73,0x63,0x6f,0x76,0x65,0x72,0x28,0x73,0x65,0x6c,0x66,0x2c,0x20,0x74,
+0x65,0x73,0x74,0x5f,0x70,0x72,0x65,0x66,0x69,0x78,0x2c,0x20,0x6b,0x6e,0x6f,0x77,
+0x6e,0x5f,0x66,0x61,0x69,0x6c,0x75,0x72,0x65,0x5f,0x70,0x72,0x65,0x66,0x69,0x78,
+0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,
+0x33,0x01,0x00,0x0b,0x74,0x65,0x73,0x74,0x5f,0x70,0x72,0x65,0x66,0x69,0x78,0x00,
+0x33,0x02,0x00,0x14,0x6b,0x6e,0x6f,0x77,0x6e,0x5f,0x66,0x61,0x69,0x6c,0x75,0x72,
+0x65,0x5f,0x70,0x72,0x65,0x66,0x69,0x78,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x00,
+0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x72,0x75,0x6e,0x74,0x69,
+0x6d,0x65,0x2f,0x74,0x65,0x73,0x74,0x69,0x6e,0x67,0x2e,0x70,0x79,0x00,0x00,0x00,
+0x22,0x03,0x00,0x00,0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x08,0x64,0x69,0x73,0x63,
+0x6f,0x76,0x65,0x72,0x00,0x00,0x00,0x00,0x23,0x03,0x00,0x00,0x1f,0x04,0x00,0x1b,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x5b,0x5d,0x00,0x00,
+0x33,0x03,0x00,0x01,0x72,0x00,0x00,0x00,0x1c,0x03,0x00,0x00,0x1f,0x08,0x00,0x1c,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x65,0x74,0x61,0x20,0x3d,0x20,0x67,
+0x65,0x74,0x6d,0x65,0x74,0x61,0x28,0x73,0x65,0x6c,0x66,0x29,0x00,0x00,0x00,0x00,
+0x33,0x06,0x00,0x04,0x6d,0x65,0x74,0x61,0x00,0x00,0x00,0x00,0x0e,0x04,0x00,0x02,
+0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x6d,0x65,0x74,0x61,0x00,0x10,0x05,0x00,0x00,
+0x37,0x00,0x04,0x02,0x10,0x06,0x00,0x00,0x1f,0x07,0x00,0x1d,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x6e,0x61,0x6d,0x65,0x20,0x69,0x6e,0x20,
+0x6d,0x65,0x74,0x61,0x3a,0x00,0x00,0x00,0x0c,0x04,0x00,0x03,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x2b,0x00,0x06,0x04,0x13,0x00,0x00,0x5f,0x33,0x05,0x00,0x04,
+0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,0x10,0x05,0x00,0x00,0x1f,0x0e,0x00,0x1e,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,
+0x61,0x6d,0x65,0x2e,0x66,0x69,0x6e,0x64,0x28,0x6b,0x6e,0x6f,0x77,0x6e,0x5f,0x66,
+0x61,0x69,0x6c,0x75,0x72,0x65,0x5f,0x70,0x72,0x65,0x66,0x69,0x78,0x29,0x20,0x3d,
+0x3d,0x20,0x30,0x3a,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x04,0x00,0x00,0x00,0x04,
+0x66,0x69,0x6e,0x64,0x00,0x00,0x00,0x00,0x38,0x07,0x05,0x00,0x00,0x00,0x00,0x00,
+0x10,0x09,0x02,0x00,0x39,0x00,0x07,0x03,0x0c,0x07,0x00,0x03,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x07,0x16,0x00,0x00,0x00,0x13,0x00,0x00,0x12,
+0x1f,0x08,0x00,0x1f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x6e,0x61,0x6d,
+0x65,0x29,0x00,0x00,0x0d,0x00,0x00,0x05,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x07,0x03,0x00,0x00,0x00,0x00,0x01,0x10,0x09,0x05,0x00,
+0x39,0x00,0x07,0x03,0x1f,0x0b,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,0x61,0x6d,0x65,0x2e,0x66,0x69,0x6e,0x64,
+0x28,0x74,0x65,0x73,0x74,0x5f,0x70,0x72,0x65,0x66,0x69,0x78,0x29,0x20,0x3d,0x3d,
+0x20,0x30,0x3a,0x00,0x0d,0x00,0x00,0x04,0x00,0x00,0x00,0x04,0x66,0x69,0x6e,0x64,
+0x00,0x00,0x00,0x00,0x38,0x07,0x05,0x00,0x00,0x00,0x00,0x02,0x10,0x09,0x01,0x00,
+0x39,0x00,0x07,0x03,0x0c,0x07,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x18,0x00,0x00,0x07,0x16,0x00,0x00,0x00,0x13,0x00,0xff,0xb3,0x1f,0x08,0x00,0x21,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x72,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x6e,0x61,0x6d,0x65,0x29,0x00,0x00,
+0x0d,0x00,0x00,0x05,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x07,0x03,0x00,0x00,0x00,0x00,0x03,0x10,0x09,0x05,0x00,0x39,0x00,0x07,0x03,
+0x13,0x00,0xff,0xa1,0x1f,0x05,0x00,0x22,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x00,0x00,0x00,0x00,0x15,0x03,0x00,0x00,
+0x00,0x00,0x00,0x00,0x33,0x03,0x00,0x08,0x64,0x69,0x73,0x63,0x6f,0x76,0x65,0x72,
+0x00,0x00,0x00,0x00,0x10,0x03,0x02,0x00,0x1f,0x08,0x00,0x24,0x20,0x20,0x20,0x20,
+0x64,0x65,0x66,0x20,0x73,0x65,0x74,0x75,0x70,0x28,0x73,0x65,0x6c,0x66,0x2c,0x20,
+0x74,0x65,0x73,0x74,0x6e,0x61,0x6d,0x65,0x29,0x3a,0x00,0x00,0x33,0x04,0x00,0x04,
+0x2a,0x24,0x31,0x34,0x00,0x00,0x00,0x00,0x0d,0x09,0x00,0x00,0x00,0x00,0x00,0x04,
+0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,0x0d,0x0a,0x00,0x03,0x00,0x00,0x00,0x08,
+0x74,0x65,0x73,0x74,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,0x1c,0x05,0x09,0x02,
+0x1c,0x06,0x00,0x00,0x1d,0x07,0x00,0x00,0x1d,0x08,0x00,0x00,0x11,0x04,0x00,0x24,
+0x2d,0x04,0x00,0x02,0x00,0x00,0x00,0x00,0x1f,0x08,0x00,0x24,0x20,0x20,0x20,0x20,
+0x64,0x65,0x66,0x20,0x73,0x65,0x74,0x75,0x70,0x28,0x73,0x65,0x6c,0x66,0x2c,0x20,
+0x74,0x65,0x73,0x74,0x6e,0x61,0x6d,0x65,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x04,
+0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x72,0x75,0x6e,0x74,0x69,0x6d,0x65,0x2f,0x74,
+0x65,0x73,0x74,0x69,0x6e,0x67,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x05,0x73,0x65,0x74,0x75,0x70,0x00,0x00,0x00,
+0x23,0x01,0x00,0x00,0x1f,0x04,0x00,0x25,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x70,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x05,0x00,0x05,
+0x73,0x65,0x74,0x75,0x70,0x00,0x00,0x00,0x10,0x05,0x04,0x00,0x1f,0x09,0x00,0x27,
+0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x74,0x65,0x61,0x72,0x64,0x6f,0x77,0x6e,
+0x28,0x73,0x65,0x6c,0x66,0x2c,0x20,0x74,0x65,0x73,0x74,0x6e,0x61,0x6d,0x65,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x06,0x00,0x04,0x2a,0x24,0x32,0x31,0x00,0x00,0x00,0x00,
+0x0d,0x0b,0x00,0x00,0x00,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,
+0x0d,0x0c,0x00,0x03,0x00,0x00,0x00,0x08,0x74,0x65,0x73,0x74,0x6e,0x61,0x6d,0x65,
+0x00,0x00,0x00,0x00,0x1c,0x07,0x0b,0x02,0x1c,0x08,0x00,0x00,0x1d,0x09,0x00,0x00,
+0x1d,0x0a,0x00,0x00,0x11,0x06,0x00,0x26,0x2d,0x04,0x00,0x02,0x00,0x00,0x00,0x00,
+0x1f,0x09,0x00,0x27,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x74,0x65,0x61,0x72,
+0x64,0x6f,0x77,0x6e,0x28,0x73,0x65,0x6c,0x66,0x2c,0x20,0x74,0x65,0x73,0x74,0x6e,
+0x61,0x6d,0x65,0x29,0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,
+0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x72,0x75,0x6e,0x74,0x69,0x6d,0x65,0x2f,0x74,0x65,0x73,0x74,0x69,
+0x6e,0x67,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,
+0x00,0x00,0x00,0x08,0x74,0x65,0x61,0x72,0x64,0x6f,0x77,0x6e,0x00,0x00,0x00,0x00,
+0x23,0x01,0x00,0x00,0x1f,0x04,0x00,0x28,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x70,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x07,0x00,0x08,
+0x74,0x65,0x61,0x72,0x64,0x6f,0x77,0x6e,0x00,0x00,0x00,0x00,0x10,0x07,0x06,0x00,
+0x1f,0x09,0x00,0x2a,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x72,0x75,0x6e,0x28,
+0x73,0x65,0x6c,0x66,0x2c,0x20,0x6d,0x6f,0x6e,0x69,0x74,0x6f,0x72,0x3d,0x70,0x72,
+0x69,0x6e,0x74,0x29,0x3a,0x00,0x00,0x00,0x33,0x08,0x00,0x04,0x2a,0x24,0x32,0x38,
+0x00,0x00,0x00,0x00,0x0d,0x0d,0x00,0x00,0x00,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,
+0x00,0x00,0x00,0x00,0x0d,0x0e,0x00,0x04,0x00,0x00,0x00,0x07,0x6d,0x6f,0x6e,0x69,
+0x74,0x6f,0x72,0x00,0x1c,0x09,0x0d,0x02,0x0e,0x0d,0x00,0x05,0x00,0x00,0x00,0x05,
+0x70,0x72,0x69,0x6e,0x74,0x00,0x00,0x00,0x1c,0x0a,0x0d,0x01,0x1d,0x0b,0x00,0x00,
+0x1d,0x0c,0x00,0x00,0x11,0x08,0x03,0x7e,0x2d,0x12,0x00,0x27,0x00,0x00,0x00,0x11,
+0x1f,0x09,0x00,0x2a,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x72,0x75,0x6e,0x28,
+0x73,0x65,0x6c,0x66,0x2c,0x20,0x6d,0x6f,0x6e,0x69,0x74,0x6f,0x72,0x3d,0x70,0x72,
+0x69,0x6e,0x74,0x29,0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,
+0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x07,0x6d,0x6f,0x6e,0x69,0x74,0x6f,0x72,0x00,
+0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x72,
+0x75,0x6e,0x74,0x69,0x6d,0x65,0x2f,0x74,0x65,0x73,0x74,0x69,0x6e,0x67,0x2e,0x70,
+0x79,0x00,0x00,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x03,
+0x72,0x75,0x6e,0x00,0x23,0x02,0x00,0x00,0x1f,0x14,0x00,0x2b,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x74,0x65,0x73,0x74,0x73,0x20,0x3d,0x20,0x73,0x65,0x6c,0x66,
+0x2e,0x64,0x69,0x73,0x63,0x6f,0x76,0x65,0x72,0x28,0x73,0x65,0x6c,0x66,0x2e,0x5f,
+0x74,0x65,0x73,0x74,0x5f,0x70,0x72,0x65,0x66,0x69,0x78,0x2c,0x20,0x73,0x65,0x6c,
+0x66,0x2e,0x5f,0x6b,0x6e,0x6f,0x77,0x6e,0x5f,0x66,0x61,0x69,0x6c,0x75,0x72,0x65,
+0x5f,0x70,0x72,0x65,0x66,0x69,0x78,0x29,0x00,0x00,0x00,0x00,0x33,0x02,0x00,0x05,
+0x74,0x65,0x73,0x74,0x73,0x00,0x00,0x00,0x0d,0x03,0x00,0x02,0x00,0x00,0x00,0x08,
+0x64,0x69,0x73,0x63,0x6f,0x76,0x65,0x72,0x00,0x00,0x00,0x00,0x38,0x06,0x00,0x03,
+0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x03,0x00,0x00,0x00,0x0c,0x5f,0x74,0x65,0x73,
+0x74,0x5f,0x70,0x72,0x65,0x66,0x69,0x78,0x00,0x00,0x00,0x00,0x09,0x08,0x00,0x03,
+0x00,0x00,0x00,0x01,0x0d,0x03,0x00,0x04,0x00,0x00,0x00,0x15,0x5f,0x6b,0x6e,0x6f,
+0x77,0x6e,0x5f,0x66,0x61,0x69,0x6c,0x75,0x72,0x65,0x5f,0x70,0x72,0x65,0x66,0x69,
+0x78,0x00,0x00,0x00,0x09,0x09,0x00,0x03,0x00,0x00,0x00,0x02,0x39,0x02,0x06,0x04,
+0x1f,0x06,0x00,0x2c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x73,0x74,
+0x73,0x2e,0x73,0x6f,0x72,0x74,0x28,0x29,0x00,0x00,0x00,0x00,0x0d,0x08,0x00,0x05,
+0x00,0x00,0x00,0x04,0x73,0x6f,0x72,0x74,0x00,0x00,0x00,0x00,0x38,0x06,0x02,0x08,
+0x00,0x00,0x00,0x03,0x39,0x07,0x06,0x02,0x1f,0x0f,0x00,0x2e,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x73,0x75,0x62,0x73,0x74,0x20,0x3d,0x20,0x64,0x69,0x63,0x74,
+0x28,0x73,0x63,0x72,0x69,0x70,0x74,0x3d,0x73,0x79,0x73,0x2e,0x61,0x72,0x67,0x76,
+0x5b,0x30,0x5d,0x2c,0x20,0x74,0x6f,0x74,0x61,0x6c,0x3d,0x6c,0x65,0x6e,0x28,0x74,
+0x65,0x73,0x74,0x73,0x29,0x29,0x00,0x00,0x33,0x07,0x00,0x05,0x73,0x75,0x62,0x73,
+0x74,0x00,0x00,0x00,0x0e,0x06,0x00,0x06,0x00,0x00,0x00,0x04,0x64,0x69,0x63,0x74,
+0x00,0x00,0x00,0x00,0x1b,0x07,0x00,0x00,0x33,0x07,0x00,0x04,0x2a,0x24,0x31,0x35,
+0x00,0x00,0x00,0x00,0x0d,0x08,0x00,0x07,0x00,0x00,0x00,0x06,0x73,0x63,0x72,0x69,
+0x70,0x74,0x00,0x00,0x0e,0x09,0x00,0x08,0x00,0x00,0x00,0x03,0x73,0x79,0x73,0x00,
+0x0d,0x03,0x00,0x09,0x00,0x00,0x00,0x04,0x61,0x72,0x67,0x76,0x00,0x00,0x00,0x00,
+0x09,0x09,0x09,0x03,0x00,0x00,0x00,0x04,0x0c,0x03,0x00,0x0a,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x0a,0x09,0x09,0x03,0x0b,0x07,0x08,0x09,0x0d,0x08,0x00,0x0b,
+0x00,0x00,0x00,0x05,0x74,0x6f,0x74,0x61,0x6c,0x00,0x00,0x00,0x0e,0x03,0x00,0x0c,
+0x00,0x00,0x00,0x03,0x6c,0x65,0x6e,0x00,0x10,0x04,0x02,0x00,0x37,0x09,0x03,0x02,
+0x0b,0x07,0x08,0x09,0x1c,0x08,0x00,0x00,0x10,0x09,0x07,0x00,0x14,0x07,0x06,0x08,
+0x1f,0x09,0x00,0x30,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x75,0x62,0x73,
+0x74,0x5b,0x27,0x52,0x45,0x44,0x27,0x5d,0x20,0x3d,0x20,0x66,0x67,0x63,0x6f,0x6c,
+0x6f,0x72,0x28,0x33,0x31,0x29,0x00,0x00,0x0e,0x08,0x00,0x0d,0x00,0x00,0x00,0x07,
+0x66,0x67,0x63,0x6f,0x6c,0x6f,0x72,0x00,0x0c,0x09,0x00,0x0e,0x00,0x00,0x69,0x04,
+0x1f,0x00,0x00,0x00,0x37,0x06,0x08,0x02,0x0d,0x08,0x00,0x0f,0x00,0x00,0x00,0x03,
+0x52,0x45,0x44,0x00,0x0b,0x07,0x08,0x06,0x1f,0x0a,0x00,0x31,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x73,0x75,0x62,0x73,0x74,0x5b,0x27,0x47,0x52,0x45,0x45,0x4e,
+0x27,0x5d,0x20,0x3d,0x20,0x66,0x67,0x63,0x6f,0x6c,0x6f,0x72,0x28,0x33,0x32,0x29,
+0x00,0x00,0x00,0x00,0x0e,0x08,0x00,0x0d,0x00,0x00,0x00,0x07,0x66,0x67,0x63,0x6f,
+0x6c,0x6f,0x72,0x00,0x0c,0x09,0x00,0x10,0x00,0x00,0x69,0x04,0x20,0x00,0x00,0x00,
+0x37,0x06,0x08,0x02,0x0d,0x08,0x00,0x11,0x00,0x00,0x00,0x05,0x47,0x52,0x45,0x45,
+0x4e,0x00,0x00,0x00,0x0b,0x07,0x08,0x06,0x1f,0x09,0x00,0x32,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x73,0x75,0x62,0x73,0x74,0x5b,0x27,0x52,0x45,0x53,0x45,0x54,
+0x27,0x5d,0x20,0x3d,0x20,0x66,0x67,0x63,0x6f,0x6c,0x6f,0x72,0x28,0x30,0x29,0x00,
+0x0e,0x08,0x00,0x0d,0x00,0x00,0x00,0x07,0x66,0x67,0x63,0x6f,0x6c,0x6f,0x72,0x00,
+0x0c,0x09,0x00,0x0a,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x37,0x06,0x08,0x02,
+0x0d,0x08,0x00,0x12,0x00,0x00,0x00,0x05,0x52,0x45,0x53,0x45,0x54,0x00,0x00,0x00,
+0x0b,0x07,0x08,0x06,0x1f,0x15,0x00,0x34,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6d,0x6f,0x6e,0x69,0x74,0x6f,0x72,0x28,0x22,0x7b,0x47,0x52,0x45,0x45,0x4e,0x7d,
+0x5b,0x20,0x53,0x54,0x41,0x52,0x54,0x45,0x44,0x20,0x5d,0x7b,0x52,0x45,0x53,0x45,
+0x54,0x7d,0x20,0x7b,0x73,0x63,0x72,0x69,0x70,0x74,0x7d,0x20,0x7b,0x74,0x6f,0x74,
+0x61,0x6c,0x7d,0x20,0x63,0x61,0x73,0x65,0x73,0x2e,0x22,0x2e,0x66,0x6f,0x72,0x6d,
+0x61,0x74,0x28,0x73,0x75,0x62,0x73,0x74,0x29,0x29,0x00,0x00,0x10,0x08,0x01,0x00,
+0x0d,0x0a,0x00,0x13,0x00,0x00,0x00,0x31,0x7b,0x47,0x52,0x45,0x45,0x4e,0x7d,0x5b,
+0x20,0x53,0x54,0x41,0x52,0x54,0x45,0x44,0x20,0x5d,0x7b,0x52,0x45,0x53,0x45,0x54,
+0x7d,0x20,0x7b,0x73,0x63,0x72,0x69,0x70,0x74,0x7d,0x20,0x7b,0x74,0x6f,0x74,0x61,
+0x6c,0x7d,0x20,0x63,0x61,0x73,0x65,0x73,0x2e,0x00,0x00,0x00,0x0d,0x0b,0x00,0x14,
+0x00,0x00,0x00,0x06,0x66,0x6f,0x72,0x6d,0x61,0x74,0x00,0x00,0x38,0x03,0x0a,0x0b,
+0x00,0x00,0x00,0x05,0x10,0x05,0x07,0x00,0x39,0x09,0x03,0x03,0x37,0x06,0x08,0x02,
+0x1f,0x05,0x00,0x36,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x66,0x61,0x69,
+0x6c,0x20,0x3d,0x20,0x30,0x00,0x00,0x00,0x33,0x06,0x00,0x05,0x6e,0x66,0x61,0x69,
+0x6c,0x00,0x00,0x00,0x0c,0x06,0x00,0x0a,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x1f,0x06,0x00,0x37,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6e,0x6b,0x6e,0x6f,
+0x77,0x6e,0x66,0x61,0x69,0x6c,0x20,0x3d,0x20,0x30,0x00,0x00,0x33,0x08,0x00,0x0a,
+0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x66,0x61,0x69,0x6c,0x00,0x00,0x0c,0x08,0x00,0x0a,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x1f,0x05,0x00,0x38,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x73,0x74,0x20,0x3d,0x20,0x30,0x00,0x00,0x00,
+0x33,0x09,0x00,0x05,0x69,0x74,0x65,0x73,0x74,0x00,0x00,0x00,0x0c,0x03,0x00,0x0a,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x10,0x09,0x03,0x00,0x1f,0x07,0x00,0x39,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x74,0x65,0x73,0x74,
+0x20,0x69,0x6e,0x20,0x74,0x65,0x73,0x74,0x73,0x3a,0x00,0x00,0x0c,0x04,0x00,0x0a,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x2b,0x03,0x02,0x04,0x13,0x00,0x01,0x59,
+0x33,0x05,0x00,0x04,0x74,0x65,0x73,0x74,0x00,0x00,0x00,0x00,0x10,0x05,0x03,0x00,
+0x1f,0x09,0x00,0x3a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x74,0x65,0x73,0x74,0x66,0x75,0x6e,0x63,0x20,0x3d,0x20,0x73,0x65,0x6c,0x66,0x5b,
+0x74,0x65,0x73,0x74,0x5d,0x00,0x00,0x00,0x33,0x03,0x00,0x08,0x74,0x65,0x73,0x74,
+0x66,0x75,0x6e,0x63,0x00,0x00,0x00,0x00,0x0a,0x03,0x00,0x05,0x1f,0x0d,0x00,0x3b,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,
+0x6c,0x74,0x20,0x3d,0x20,0x73,0x65,0x6c,0x66,0x2e,0x72,0x75,0x6e,0x6f,0x6e,0x65,
+0x28,0x74,0x65,0x73,0x74,0x2c,0x20,0x74,0x65,0x73,0x74,0x66,0x75,0x6e,0x63,0x29,
+0x00,0x00,0x00,0x00,0x33,0x0a,0x00,0x06,0x72,0x65,0x73,0x75,0x6c,0x74,0x00,0x00,
+0x0d,0x10,0x00,0x15,0x00,0x00,0x00,0x06,0x72,0x75,0x6e,0x6f,0x6e,0x65,0x00,0x00,
+0x38,0x0c,0x00,0x10,0x00,0x00,0x00,0x06,0x10,0x0e,0x05,0x00,0x10,0x0f,0x03,0x00,
+0x39,0x0a,0x0c,0x04,0x1f,0x09,0x00,0x3c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x73,0x75,0x62,0x73,0x74,0x5b,0x27,0x6e,0x61,0x6d,0x65,0x27,
+0x5d,0x20,0x3d,0x20,0x74,0x65,0x73,0x74,0x00,0x00,0x00,0x00,0x0d,0x0b,0x00,0x16,
+0x00,0x00,0x00,0x04,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,0x0b,0x07,0x0b,0x05,
+0x1f,0x08,0x00,0x3d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x66,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x2e,0x70,0x61,0x73,0x73,0x65,0x64,
+0x3a,0x00,0x00,0x00,0x0d,0x0c,0x00,0x17,0x00,0x00,0x00,0x06,0x70,0x61,0x73,0x73,
+0x65,0x64,0x00,0x00,0x09,0x0b,0x0a,0x0c,0x00,0x00,0x00,0x07,0x16,0x0b,0x00,0x00,
+0x13,0x00,0x00,0x17,0x1f,0x0b,0x00,0x3e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x75,0x62,0x73,0x74,0x5b,0x27,0x73,
+0x74,0x61,0x74,0x75,0x73,0x27,0x5d,0x20,0x3d,0x20,0x22,0x50,0x41,0x53,0x53,0x22,
+0x00,0x00,0x00,0x00,0x0d,0x0b,0x00,0x18,0x00,0x00,0x00,0x04,0x50,0x41,0x53,0x53,
+0x00,0x00,0x00,0x00,0x0d,0x0c,0x00,0x19,0x00,0x00,0x00,0x06,0x73,0x74,0x61,0x74,
+0x75,0x73,0x00,0x00,0x0b,0x07,0x0c,0x0b,0x13,0x00,0x00,0x75,0x1f,0x10,0x00,0x3f,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x69,0x66,
+0x20,0x74,0x65,0x73,0x74,0x2e,0x73,0x74,0x61,0x72,0x74,0x73,0x77,0x69,0x74,0x68,
+0x28,0x73,0x65,0x6c,0x66,0x2e,0x5f,0x6b,0x6e,0x6f,0x77,0x6e,0x5f,0x66,0x61,0x69,
+0x6c,0x75,0x72,0x65,0x5f,0x70,0x72,0x65,0x66,0x69,0x78,0x29,0x3a,0x00,0x00,0x00,
+0x0d,0x0f,0x00,0x1a,0x00,0x00,0x00,0x0a,0x73,0x74,0x61,0x72,0x74,0x73,0x77,0x69,
+0x74,0x68,0x00,0x00,0x38,0x0c,0x05,0x0f,0x00,0x00,0x00,0x08,0x0d,0x0f,0x00,0x04,
+0x00,0x00,0x00,0x15,0x5f,0x6b,0x6e,0x6f,0x77,0x6e,0x5f,0x66,0x61,0x69,0x6c,0x75,
+0x72,0x65,0x5f,0x70,0x72,0x65,0x66,0x69,0x78,0x00,0x00,0x00,0x09,0x0e,0x00,0x0f,
+0x00,0x00,0x00,0x09,0x39,0x0b,0x0c,0x03,0x16,0x0b,0x00,0x00,0x13,0x00,0x00,0x27,
+0x1f,0x0b,0x00,0x40,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x66,0x61,0x69,0x6c,0x20,0x3d,
+0x20,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x66,0x61,0x69,0x6c,0x20,0x2b,0x20,0x31,0x00,
+0x0c,0x0c,0x00,0x1b,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x08,0x08,0x0c,
+0x1f,0x0b,0x00,0x41,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x73,0x75,0x62,0x73,0x74,0x5b,0x27,0x73,0x74,0x61,0x74,0x75,
+0x73,0x27,0x5d,0x20,0x3d,0x20,0x22,0x4b,0x4e,0x4f,0x57,0x4e,0x22,0x00,0x00,0x00,
+0x0d,0x0b,0x00,0x1c,0x00,0x00,0x00,0x05,0x4b,0x4e,0x4f,0x57,0x4e,0x00,0x00,0x00,
+0x0d,0x0c,0x00,0x19,0x00,0x00,0x00,0x06,0x73,0x74,0x61,0x74,0x75,0x73,0x00,0x00,
+0x0b,0x07,0x0c,0x0b,0x13,0x00,0x00,0x2a,0x1f,0x05,0x00,0x42,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x3a,0x00,0x00,0x00,
+0x1f,0x09,0x00,0x43,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6e,0x66,0x61,0x69,0x6c,0x20,0x3d,0x20,0x6e,0x66,0x61,0x69,
+0x6c,0x20,0x2b,0x20,0x31,0x00,0x00,0x00,0x0c,0x0c,0x00,0x1b,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x01,0x06,0x06,0x0c,0x1f,0x0b,0x00,0x44,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x75,0x62,0x73,
+0x74,0x5b,0x27,0x73,0x74,0x61,0x74,0x75,0x73,0x27,0x5d,0x20,0x3d,0x20,0x22,0x46,
+0x41,0x49,0x4c,0x22,0x00,0x00,0x00,0x00,0x0d,0x0b,0x00,0x1d,0x00,0x00,0x00,0x04,
+0x46,0x41,0x49,0x4c,0x00,0x00,0x00,0x00,0x0d,0x0c,0x00,0x19,0x00,0x00,0x00,0x06,
+0x73,0x74,0x61,0x74,0x75,0x73,0x00,0x00,0x0b,0x07,0x0c,0x0b,0x1f,0x08,0x00,0x45,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x75,0x62,0x73,
+0x74,0x5b,0x27,0x69,0x64,0x27,0x5d,0x20,0x3d,0x20,0x69,0x74,0x65,0x73,0x74,0x00,
+0x0d,0x0b,0x00,0x1e,0x00,0x00,0x00,0x02,0x69,0x64,0x00,0x00,0x0b,0x07,0x0b,0x09,
+0x1f,0x0f,0x00,0x46,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6d,0x73,0x67,0x20,0x3d,0x20,0x22,0x5b,0x20,0x7b,0x73,0x74,0x61,0x74,0x75,0x73,
+0x7d,0x20,0x5d,0x20,0x7b,0x69,0x64,0x7d,0x3a,0x20,0x7b,0x6e,0x61,0x6d,0x65,0x7d,
+0x22,0x2e,0x66,0x6f,0x72,0x6d,0x61,0x74,0x28,0x73,0x75,0x62,0x73,0x74,0x29,0x00,
+0x33,0x0b,0x00,0x03,0x6d,0x73,0x67,0x00,0x0d,0x10,0x00,0x1f,0x00,0x00,0x00,0x19,
+0x5b,0x20,0x7b,0x73,0x74,0x61,0x74,0x75,0x73,0x7d,0x20,0x5d,0x20,0x7b,0x69,0x64,
+0x7d,0x3a,0x20,0x7b,0x6e,0x61,0x6d,0x65,0x7d,0x00,0x00,0x00,0x0d,0x11,0x00,0x14,
+0x00,0x00,0x00,0x06,0x66,0x6f,0x72,0x6d,0x61,0x74,0x00,0x00,0x38,0x0d,0x10,0x11,
+0x00,0x00,0x00,0x0a,0x10,0x0f,0x07,0x00,0x39,0x0b,0x0d,0x03,0x1f,0x08,0x00,0x47,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x74,0x65,0x73,
+0x74,0x20,0x3d,0x20,0x69,0x74,0x65,0x73,0x74,0x20,0x2b,0x20,0x31,0x00,0x00,0x00,
+0x0c,0x0d,0x00,0x1b,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x09,0x09,0x0d,
+0x1f,0x07,0x00,0x48,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6d,0x6f,0x6e,0x69,0x74,0x6f,0x72,0x28,0x6d,0x73,0x67,0x29,0x00,0x00,0x00,0x00,
+0x10,0x0d,0x01,0x00,0x10,0x0e,0x0b,0x00,0x37,0x0c,0x0d,0x02,0x1f,0x09,0x00,0x49,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,
+0x6f,0x74,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x2e,0x70,0x61,0x73,0x73,0x65,0x64,
+0x3a,0x00,0x00,0x00,0x0d,0x0e,0x00,0x17,0x00,0x00,0x00,0x06,0x70,0x61,0x73,0x73,
+0x65,0x64,0x00,0x00,0x09,0x0d,0x0a,0x0e,0x00,0x00,0x00,0x0b,0x2f,0x0d,0x00,0x00,
+0x13,0x00,0xfe,0xce,0x1f,0x12,0x00,0x4a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x6f,0x6e,0x69,0x74,0x6f,0x72,0x28,
+0x22,0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x3a,0x5c,0x6e,0x7b,0x65,0x78,
+0x63,0x7d,0x5c,0x6e,0x7b,0x73,0x74,0x61,0x63,0x6b,0x7d,0x22,0x2e,0x66,0x6f,0x72,
+0x6d,0x61,0x74,0x28,0x72,0x65,0x73,0x75,0x6c,0x74,0x29,0x29,0x00,0x00,0x00,0x00,
+0x10,0x0d,0x01,0x00,0x0d,0x05,0x00,0x20,0x00,0x00,0x00,0x18,0x45,0x78,0x63,0x65,
+0x70,0x74,0x69,0x6f,0x6e,0x3a,0x0a,0x7b,0x65,0x78,0x63,0x7d,0x0a,0x7b,0x73,0x74,
+0x61,0x63,0x6b,0x7d,0x00,0x00,0x00,0x00,0x0d,0x0b,0x00,0x14,0x00,0x00,0x00,0x06,
+0x66,0x6f,0x72,0x6d,0x61,0x74,0x00,0x00,0x38,0x0f,0x05,0x0b,0x00,0x00,0x00,0x0c,
+0x10,0x11,0x0a,0x00,0x39,0x0e,0x0f,0x03,0x37,0x0c,0x0d,0x02,0x13,0x00,0xfe,0xa7,
+0x1f,0x08,0x00,0x4c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x75,0x62,0x73,
+0x74,0x5b,0x27,0x6e,0x66,0x61,0x69,0x6c,0x27,0x5d,0x20,0x3d,0x20,0x6e,0x66,0x61,
+0x69,0x6c,0x00,0x00,0x0d,0x04,0x00,0x21,0x00,0x00,0x00,0x05,0x6e,0x66,0x61,0x69,
+0x6c,0x00,0x00,0x00,0x0b,0x07,0x04,0x06,0x1f,0x0b,0x00,0x4d,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x73,0x75,0x62,0x73,0x74,0x5b,0x27,0x6e,0x6b,0x6e,0x6f,0x77,
+0x6e,0x66,0x61,0x69,0x6c,0x27,0x5d,0x20,0x3d,0x20,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,
+0x66,0x61,0x69,0x6c,0x00,0x00,0x00,0x00,0x0d,0x04,0x00,0x22,0x00,0x00,0x00,0x0a,
+0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x66,0x61,0x69,0x6c,0x00,0x00,0x0b,0x07,0x04,0x08,
+0x1f,0x06,0x00,0x4e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,
+0x66,0x61,0x69,0x6c,0x20,0x3e,0x20,0x30,0x3a,0x00,0x00,0x00,0x0c,0x0c,0x00,0x0a,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x36,0x04,0x06,0x0c,0x16,0x04,0x00,0x00,
+0x13,0x00,0x00,0x2d,0x1f,0x14,0x00,0x4f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6d,0x73,0x67,0x20,0x3d,0x20,0x22,0x7b,0x52,0x45,0x44,0x7d,
+0x5b,0x20,0x46,0x41,0x49,0x4c,0x20,0x5d,0x7b,0x52,0x45,0x53,0x45,0x54,0x7d,0x20,
+0x7b,0x73,0x63,0x72,0x69,0x70,0x74,0x7d,0x20,0x7b,0x6e,0x66,0x61,0x69,0x6c,0x7d,
+0x20,0x46,0x61,0x69,0x6c,0x65,0x64,0x2e,0x22,0x2e,0x66,0x6f,0x72,0x6d,0x61,0x74,
+0x28,0x73,0x75,0x62,0x73,0x74,0x29,0x00,0x0d,0x0f,0x00,0x23,0x00,0x00,0x00,0x2d,
+0x7b,0x52,0x45,0x44,0x7d,0x5b,0x20,0x46,0x41,0x49,0x4c,0x20,0x5d,0x7b,0x52,0x45,
+0x53,0x45,0x54,0x7d,0x20,0x7b,0x73,0x63,0x72,0x69,0x70,0x74,0x7d,0x20,0x7b,0x6e,
+0x66,0x61,0x69,0x6c,0x7d,0x20,0x46,0x61,0x69,0x6c,0x65,0x64,0x2e,0x00,0x00,0x00,
+0x0d,0x10,0x00,0x14,0x00,0x00,0x00,0x06,0x66,0x6f,0x72,0x6d,0x61,0x74,0x00,0x00,
+0x38,0x0c,0x0f,0x10,0x00,0x00,0x00,0x0d,0x10,0x0e,0x07,0x00,0x39,0x0b,0x0c,0x03,
+0x13,0x00,0x00,0x35,0x1f,0x19,0x00,0x51,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x6d,0x73,0x67,0x20,0x3d,0x20,0x22,0x7b,0x47,0x52,0x45,0x45,
+0x4e,0x7d,0x5b,0x20,0x48,0x45,0x41,0x4c,0x54,0x48,0x59,0x20,0x5d,0x7b,0x52,0x45,
+0x53,0x45,0x54,0x7d,0x20,0x7b,0x73,0x63,0x72,0x69,0x70,0x74,0x7d,0x20,0x7b,0x6e,
+0x6b,0x6e,0x6f,0x77,0x6e,0x66,0x61,0x69,0x6c,0x7d,0x20,0x4b,0x6e,0x6f,0x77,0x6e,
+0x20,0x46,0x61,0x69,0x6c,0x75,0x72,0x65,0x73,0x2e,0x22,0x2e,0x66,0x6f,0x72,0x6d,
+0x61,0x74,0x28,0x73,0x75,0x62,0x73,0x74,0x29,0x00,0x00,0x00,0x0d,0x0f,0x00,0x24,
+0x00,0x00,0x00,0x3f,0x7b,0x47,0x52,0x45,0x45,0x4e,0x7d,0x5b,0x20,0x48,0x45,0x41,
+0x4c,0x54,0x48,0x59,0x20,0x5d,0x7b,0x52,0x45,0x53,0x45,0x54,0x7d,0x20,0x7b,0x73,
+0x63,0x72,0x69,0x70,0x74,0x7d,0x20,0x7b,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x66,0x61,
+0x69,0x6c,0x7d,0x20,0x4b,0x6e,0x6f,0x77,0x6e,0x20,0x46,0x61,0x69,0x6c,0x75,0x72,
+0x65,0x73,0x2e,0x00,0x0d,0x10,0x00,0x14,0x00,0x00,0x00,0x06,0x66,0x6f,0x72,0x6d,
+0x61,0x74,0x00,0x00,0x38,0x0c,0x0f,0x10,0x00,0x00,0x00,0x0e,0x10,0x0e,0x07,0x00,
+0x39,0x0b,0x0c,0x03,0x1f,0x06,0x00,0x53,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x6d,0x6f,0x6e,0x69,0x74,0x6f,0x72,0x28,0x6d,0x73,0x67,0x29,0x00,0x00,0x00,0x00,
+0x10,0x0c,0x01,0x00,0x10,0x0d,0x0b,0x00,0x37,0x04,0x0c,0x02,0x1f,0x06,0x00,0x54,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x6e,0x66,0x61,0x69,0x6c,
+0x20,0x3e,0x20,0x30,0x3a,0x00,0x00,0x00,0x0c,0x0c,0x00,0x0a,0x00,0x00,0x69,0x04,
+0x00,0x00,0x00,0x00,0x36,0x04,0x06,0x0c,0x16,0x04,0x00,0x00,0x13,0x00,0x00,0x22,
+0x1f,0x07,0x00,0x55,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x73,0x79,0x73,0x2e,0x65,0x78,0x69,0x74,0x28,0x32,0x35,0x35,0x29,0x00,0x00,0x00,
+0x0e,0x0f,0x00,0x08,0x00,0x00,0x00,0x03,0x73,0x79,0x73,0x00,0x0d,0x10,0x00,0x25,
+0x00,0x00,0x00,0x04,0x65,0x78,0x69,0x74,0x00,0x00,0x00,0x00,0x38,0x0c,0x0f,0x10,
+0x00,0x00,0x00,0x0f,0x0c,0x0e,0x00,0x26,0x00,0x00,0x69,0x04,0xff,0x00,0x00,0x00,
+0x39,0x04,0x0c,0x03,0x1f,0x07,0x00,0x56,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x46,0x61,0x6c,0x73,0x65,
+0x00,0x00,0x00,0x00,0x0c,0x04,0x00,0x0a,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x15,0x04,0x00,0x00,0x1f,0x05,0x00,0x57,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x73,0x79,0x73,0x2e,0x65,0x78,0x69,0x74,0x28,0x30,0x29,0x00,0x0e,0x0f,0x00,0x08,
+0x00,0x00,0x00,0x03,0x73,0x79,0x73,0x00,0x0d,0x10,0x00,0x25,0x00,0x00,0x00,0x04,
+0x65,0x78,0x69,0x74,0x00,0x00,0x00,0x00,0x38,0x0c,0x0f,0x10,0x00,0x00,0x00,0x10,
+0x0c,0x0e,0x00,0x0a,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x39,0x04,0x0c,0x03,
+0x1f,0x05,0x00,0x58,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x54,0x72,0x75,0x65,0x00,0x0c,0x04,0x00,0x1b,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x15,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x09,0x00,0x03,
+0x72,0x75,0x6e,0x00,0x10,0x09,0x08,0x00,0x1f,0x0a,0x00,0x5a,0x20,0x20,0x20,0x20,
+0x64,0x65,0x66,0x20,0x72,0x75,0x6e,0x6f,0x6e,0x65,0x28,0x73,0x65,0x6c,0x66,0x2c,
+0x20,0x74,0x65,0x73,0x74,0x2c,0x20,0x74,0x65,0x73,0x74,0x66,0x75,0x6e,0x63,0x29,
+0x3a,0x00,0x00,0x00,0x33,0x0a,0x00,0x04,0x2a,0x24,0x33,0x36,0x00,0x00,0x00,0x00,
+0x0d,0x0a,0x00,0x00,0x00,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,
+0x0d,0x0b,0x00,0x06,0x00,0x00,0x00,0x04,0x74,0x65,0x73,0x74,0x00,0x00,0x00,0x00,
+0x0d,0x0c,0x00,0x07,0x00,0x00,0x00,0x08,0x74,0x65,0x73,0x74,0x66,0x75,0x6e,0x63,
+0x00,0x00,0x00,0x00,0x1c,0x0b,0x0a,0x03,0x1c,0x0c,0x00,0x00,0x1d,0x0d,0x00,0x00,
+0x1d,0x0e,0x00,0x00,0x11,0x0a,0x00,0xab,0x2d,0x0b,0x00,0x09,0x00,0x00,0x00,0x03,
+0x1f,0x0a,0x00,0x5a,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x72,0x75,0x6e,0x6f,
+0x6e,0x65,0x28,0x73,0x65,0x6c,0x66,0x2c,0x20,0x74,0x65,0x73,0x74,0x2c,0x20,0x74,
+0x65,0x73,0x74,0x66,0x75,0x6e,0x63,0x29,0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x04,
+0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x04,0x74,0x65,0x73,0x74,
+0x00,0x00,0x00,0x00,0x33,0x02,0x00,0x08,0x74,0x65,0x73,0x74,0x66,0x75,0x6e,0x63,
+0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x00,0x00,0x00,0x00,0x19,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x72,0x75,0x6e,0x74,0x69,0x6d,0x65,0x2f,0x74,0x65,0x73,0x74,0x69,
+0x6e,0x67,0x2e,0x70,0x79,0x00,0x00,0x00,0x22,0x03,0x00,0x00,0x0d,0x03,0x00,0x01,
+0x00,0x00,0x00,0x06,0x72,0x75,0x6e,0x6f,0x6e,0x65,0x00,0x00,0x23,0x03,0x00,0x00,
+0x1f,0x07,0x00,0x5b,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,
+0x2e,0x73,0x65,0x74,0x75,0x70,0x28,0x74,0x65,0x73,0x74,0x29,0x00,0x00,0x00,0x00,
+0x0d,0x07,0x00,0x02,0x00,0x00,0x00,0x05,0x73,0x65,0x74,0x75,0x70,0x00,0x00,0x00,
+0x38,0x04,0x00,0x07,0x00,0x00,0x00,0x00,0x10,0x06,0x01,0x00,0x39,0x03,0x04,0x03,
+0x1f,0x04,0x00,0x5c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x72,0x79,0x3a,
+0x00,0x00,0x00,0x00,0x27,0x00,0x00,0x28,0x1f,0x07,0x00,0x5d,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x73,0x74,0x66,0x75,0x6e,0x63,
+0x28,0x73,0x65,0x6c,0x66,0x29,0x00,0x00,0x10,0x04,0x02,0x00,0x10,0x05,0x00,0x00,
+0x37,0x03,0x04,0x02,0x1f,0x0e,0x00,0x5e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x54,0x65,0x73,0x74,0x52,
+0x65,0x73,0x75,0x6c,0x74,0x28,0x74,0x65,0x73,0x74,0x2c,0x20,0x54,0x72,0x75,0x65,
+0x2c,0x20,0x4e,0x6f,0x6e,0x65,0x2c,0x20,0x4e,0x6f,0x6e,0x65,0x29,0x00,0x00,0x00,
+0x0e,0x04,0x00,0x03,0x00,0x00,0x00,0x0a,0x54,0x65,0x73,0x74,0x52,0x65,0x73,0x75,
+0x6c,0x74,0x00,0x00,0x10,0x05,0x01,0x00,0x0c,0x06,0x00,0x04,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x1d,0x07,0x00,0x00,0x1d,0x08,0x00,0x00,0x37,0x03,0x04,0x05,
+0x15,0x03,0x00,0x00,0x1f,0x04,0x00,0x5f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x65,0x78,0x63,0x65,0x70,0x74,0x3a,0x00,0x1f,0x0a,0x00,0x60,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x78,0x63,0x2c,0x20,0x73,0x74,0x61,
+0x63,0x6b,0x20,0x3d,0x20,0x73,0x79,0x73,0x2e,0x67,0x65,0x74,0x5f,0x65,0x78,0x63,
+0x28,0x29,0x00,0x00,0x0e,0x06,0x00,0x05,0x00,0x00,0x00,0x03,0x73,0x79,0x73,0x00,
+0x0d,0x07,0x00,0x06,0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x5f,0x65,0x78,0x63,0x00,
+0x38,0x04,0x06,0x07,0x00,0x00,0x00,0x01,0x39,0x03,0x04,0x02,0x33,0x03,0x00,0x04,
+0x2a,0x24,0x31,0x36,0x00,0x00,0x00,0x00,0x33,0x04,0x00,0x03,0x65,0x78,0x63,0x00,
+0x0c,0x06,0x00,0x07,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x0a,0x04,0x03,0x06,
+0x33,0x05,0x00,0x05,0x73,0x74,0x61,0x63,0x6b,0x00,0x00,0x00,0x0c,0x07,0x00,0x04,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x0a,0x05,0x03,0x07,0x1f,0x0e,0x00,0x61,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x54,0x65,0x73,0x74,0x52,0x65,0x73,0x75,0x6c,0x74,0x28,0x74,0x65,
+0x73,0x74,0x2c,0x20,0x46,0x61,0x6c,0x73,0x65,0x2c,0x20,0x65,0x78,0x63,0x2c,0x20,
+0x73,0x74,0x61,0x63,0x6b,0x29,0x00,0x00,0x0e,0x06,0x00,0x03,0x00,0x00,0x00,0x0a,
+0x54,0x65,0x73,0x74,0x52,0x65,0x73,0x75,0x6c,0x74,0x00,0x00,0x10,0x07,0x01,0x00,
+0x0c,0x08,0x00,0x07,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x10,0x09,0x04,0x00,
+0x10,0x0a,0x05,0x00,0x37,0x03,0x06,0x05,0x15,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+0x33,0x0b,0x00,0x06,0x72,0x75,0x6e,0x6f,0x6e,0x65,0x00,0x00,0x10,0x0b,0x0a,0x00,
+0x0e,0x0c,0x00,0x08,0x00,0x00,0x00,0x08,0x55,0x6e,0x69,0x74,0x54,0x65,0x73,0x74,
+0x00,0x00,0x00,0x00,0x33,0x0c,0x00,0x04,0x2a,0x24,0x34,0x34,0x00,0x00,0x00,0x00,
+0x0d,0x0d,0x00,0x09,0x00,0x00,0x00,0x08,0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,
+0x00,0x00,0x00,0x00,0x0b,0x0c,0x0d,0x01,0x0d,0x0d,0x00,0x0a,0x00,0x00,0x00,0x08,
+0x64,0x69,0x73,0x63,0x6f,0x76,0x65,0x72,0x00,0x00,0x00,0x00,0x0b,0x0c,0x0d,0x03,
+0x0d,0x0d,0x00,0x0b,0x00,0x00,0x00,0x05,0x73,0x65,0x74,0x75,0x70,0x00,0x00,0x00,
+0x0b,0x0c,0x0d,0x05,0x0d,0x0d,0x00,0x0c,0x00,0x00,0x00,0x08,0x74,0x65,0x61,0x72,
+0x64,0x6f,0x77,0x6e,0x00,0x00,0x00,0x00,0x0b,0x0c,0x0d,0x07,0x0d,0x0d,0x00,0x0d,
+0x00,0x00,0x00,0x03,0x72,0x75,0x6e,0x00,0x0b,0x0c,0x0d,0x09,0x0d,0x0d,0x00,0x0e,
+0x00,0x00,0x00,0x06,0x72,0x75,0x6e,0x6f,0x6e,0x65,0x00,0x00,0x0b,0x0c,0x0d,0x0b,
+0x00,0x00,0x00,0x00,0x1d,0x05,0x00,0x00,0x1d,0x06,0x00,0x00,0x14,0x04,0x03,0x05,
+0x00,0x00,0x00,0x00,
+};
+
+static tpd_code * _tp_tinypy_runtime_testing_0(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 6: goto L6;
+        case 15: goto L15;
+        case 16: goto L16;
+        case 19: goto L19;
+        case 20: goto L20;
+        case 25: goto L25;
+        case 28: goto L28;
+        case 29: goto L29;
+        case 30: goto L30;
+        case 33: goto L33;
+        case 34: goto L34;
+        case 46: goto L46;
+        case 51: goto L51;
+        case 59: goto L59;
+        case 64: goto L64;
+        case 65: goto L65;
+        case 66: goto L66;
+        case 71: goto L71;
+        case 72: goto L72;
+        case 78: goto L78;
+        case 81: goto L81;
+        case 85: goto L85;
+        case 86: goto L86;
+        case 87: goto L87;
+        case 88: goto L88;
+        case 89: goto L89;
+        case 180: goto L180;
+        case 184: goto L184;
+        case 185: goto L185;
+        case 191: goto L191;
+        case 192: goto L192;
+        case 195: goto L195;
+        case 200: goto L200;
+        case 201: goto L201;
+        case 205: goto L205;
+        case 206: goto L206;
+        case 210: goto L210;
+        case 211: goto L211;
+        case 214: goto L214;
+        case 215: goto L215;
+        case 216: goto L216;
+        case 217: goto L217;
+        case 218: goto L218;
+        case 385: goto L385;
+        case 386: goto L386;
+        case 387: goto L387;
+        case 388: goto L388;
+        case 396: goto L396;
+        case 397: goto L397;
+        case 400: goto L400;
+        case 405: goto L405;
+        case 406: goto L406;
+        case 410: goto L410;
+        case 411: goto L411;
+        case 416: goto L416;
+        case 417: goto L417;
+        case 420: goto L420;
+        case 421: goto L421;
+        case 422: goto L422;
+        case 423: goto L423;
+        case 424: goto L424;
+        case 447: goto L447;
+        case 448: goto L448;
+        case 449: goto L449;
+        case 450: goto L450;
+        case 455: goto L455;
+        case 456: goto L456;
+        case 459: goto L459;
+        case 464: goto L464;
+        case 465: goto L465;
+        case 469: goto L469;
+        case 470: goto L470;
+        case 474: goto L474;
+        case 475: goto L475;
+        case 478: goto L478;
+        case 479: goto L479;
+        case 480: goto L480;
+        case 481: goto L481;
+        case 482: goto L482;
+        case 2137: goto L2137;
+        case 2138: goto L2138;
+        case 2139: goto L2139;
+        case 2140: goto L2140;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 1;
+L6: /* STRING */
+    tp_aot_op(tp, f, code + 6);
+L15: /* FILE */
+    f->fname = regs[0];
+L16: /* STRING */
+    tp_aot_op(tp, f, code + 16);
+L19: /* NAME */
+    f->name = regs[0];
+L20: /* GGET */
+    tp_aot_op(tp, f, code + 20);
+L25: /* STRING */
+    tp_aot_op(tp, f, code + 25);
+L28: /* NONE */
+    regs[3] = tp_None;
+L29: /* CALLP */
+    return code + 29;
+L30: /* STRING */
+    tp_aot_op(tp, f, code + 30);
+L33: /* GSET */
+    tp_set(tp, f->globals, regs[1], regs[0]);
+L34: /* LINE */
+    f->line = code + 34;
+    f->lineno = 2;
+L46: /* GGET */
+    tp_aot_op(tp, f, code + 46);
+L51: /* STRING */
+    tp_aot_op(tp, f, code + 51);
+L59: /* STRING */
+    tp_aot_op(tp, f, code + 59);
+L64: /* LIST */
+    tp_aot_op(tp, f, code + 64);
+L65: /* CALLP */
+    return code + 65;
+L66: /* GGET */
+    tp_aot_op(tp, f, code + 66);
+L71: /* UPDATE */
+    tp_aot_op(tp, f, code + 71);
+L72: /* LINE */
+    f->line = code + 72;
+    f->lineno = 4;
+L78: /* VAR */
+L81: /* STRING */
+    tp_aot_op(tp, f, code + 81);
+L85: /* LIST */
+    tp_aot_op(tp, f, code + 85);
+L86: /* LIST */
+    tp_aot_op(tp, f, code + 86);
+L87: /* NONE */
+    regs[3] = tp_None;
+L88: /* NONE */
+    regs[4] = tp_None;
+L89: /* DEF */
+    tp_aot_op(tp, f, code + 89);
+L180: /* STRING */
+    tp_aot_op(tp, f, code + 180);
+L184: /* GSET */
+    tp_set(tp, f->globals, regs[1], regs[0]);
+L185: /* LINE */
+    f->line = code + 185;
+    f->lineno = 11;
+L191: /* CLASS */
+    regs[1] = tp_class(tp);
+L192: /* VAR */
+L195: /* STRING */
+    tp_aot_op(tp, f, code + 195);
+L200: /* GSET */
+    tp_set(tp, f->globals, regs[2], regs[1]);
+L201: /* GGET */
+    tp_aot_op(tp, f, code + 201);
+L205: /* MOVE */
+    regs[4] = regs[1];
+L206: /* GGET */
+    tp_aot_op(tp, f, code + 206);
+L210: /* CALLP */
+    return code + 210;
+L211: /* VAR */
+L214: /* LIST */
+    tp_aot_op(tp, f, code + 214);
+L215: /* LIST */
+    tp_aot_op(tp, f, code + 215);
+L216: /* NONE */
+    regs[4] = tp_None;
+L217: /* NONE */
+    regs[5] = tp_None;
+L218: /* DEF */
+    tp_aot_op(tp, f, code + 218);
+L385: /* NONE */
+    regs[3] = tp_None;
+L386: /* NONE */
+    regs[4] = tp_None;
+L387: /* CALL */
+    return code + 387;
+L388: /* LINE */
+    f->line = code + 388;
+    f->lineno = 18;
+L396: /* CLASS */
+    regs[2] = tp_class(tp);
+L397: /* VAR */
+L400: /* STRING */
+    tp_aot_op(tp, f, code + 400);
+L405: /* GSET */
+    tp_set(tp, f->globals, regs[3], regs[2]);
+L406: /* GGET */
+    tp_aot_op(tp, f, code + 406);
+L410: /* MOVE */
+    regs[5] = regs[2];
+L411: /* GGET */
+    tp_aot_op(tp, f, code + 411);
+L416: /* CALLP */
+    return code + 416;
+L417: /* VAR */
+L420: /* LIST */
+    tp_aot_op(tp, f, code + 420);
+L421: /* LIST */
+    tp_aot_op(tp, f, code + 421);
+L422: /* NONE */
+    regs[5] = tp_None;
+L423: /* NONE */
+    regs[6] = tp_None;
+L424: /* DEF */
+    tp_aot_op(tp, f, code + 424);
+L447: /* NONE */
+    regs[4] = tp_None;
+L448: /* NONE */
+    regs[5] = tp_None;
+L449: /* CALL */
+    return code + 449;
+L450: /* LINE */
+    f->line = code + 450;
+    f->lineno = 21;
+L455: /* CLASS */
+    regs[3] = tp_class(tp);
+L456: /* VAR */
+L459: /* STRING */
+    tp_aot_op(tp, f, code + 459);
+L464: /* GSET */
+    tp_set(tp, f->globals, regs[4], regs[3]);
+L465: /* GGET */
+    tp_aot_op(tp, f, code + 465);
+L469: /* MOVE */
+    regs[6] = regs[3];
+L470: /* GGET */
+    tp_aot_op(tp, f, code + 470);
+L474: /* CALLP */
+    return code + 474;
+L475: /* VAR */
+L478: /* LIST */
+    tp_aot_op(tp, f, code + 478);
+L479: /* LIST */
+    tp_aot_op(tp, f, code + 479);
+L480: /* NONE */
+    regs[6] = tp_None;
+L481: /* NONE */
+    regs[7] = tp_None;
+L482: /* DEF */
+    tp_aot_op(tp, f, code + 482);
+L2137: /* NONE */
+    regs[5] = tp_None;
+L2138: /* NONE */
+    regs[6] = tp_None;
+L2139: /* CALL */
+    return code + 2139;
+L2140: /* EOF */
+    return code + 2140;
+}
+
+static tpd_code * _tp_tinypy_runtime_testing_90(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 11: goto L11;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 32: goto L32;
+        case 34: goto L34;
+        case 37: goto L37;
+        case 40: goto L40;
+        case 41: goto L41;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 61: goto L61;
+        case 64: goto L64;
+        case 65: goto L65;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 76: goto L76;
+        case 84: goto L84;
+        case 87: goto L87;
+        case 88: goto L88;
+        case 89: goto L89;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 4;
+L8: /* VAR */
+L11: /* STRING */
+    tp_aot_op(tp, f, code + 11);
+L20: /* FILE */
+    f->fname = regs[1];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L25: /* NAME */
+    f->name = regs[1];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 5;
+L32: /* VAR */
+L34: /* GGET */
+    tp_aot_op(tp, f, code + 34);
+L37: /* NUMBER */
+    tp_aot_op(tp, f, code + 37);
+L40: /* CALLP */
+    return code + 40;
+L41: /* LINE */
+    f->line = code + 41;
+    f->lineno = 6;
+L46: /* IF */
+    if (TP_IS_INT(regs[0]) ? regs[0].nint != 0 : tp_true(tp, regs[0])) {
+        goto L48;
+    }
+L47: /* JUMP */
+    goto L76;
+L48: /* LINE */
+    f->line = code + 48;
+    f->lineno = 7;
+L61: /* STRING */
+    tp_aot_op(tp, f, code + 61);
+L64: /* ADD */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 64);
+    }
+L65: /* GGET */
+    tp_aot_op(tp, f, code + 65);
+L68: /* MOVE */
+    regs[4] = regs[0];
+L69: /* CALLP */
+    return code + 69;
+L70: /* ADD */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 70);
+    }
+L71: /* STRING */
+    tp_aot_op(tp, f, code + 71);
+L74: /* ADD */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 74);
+    }
+L75: /* RETURN */
+    return code + 75;
+L76: /* LINE */
+    f->line = code + 76;
+    f->lineno = 9;
+L84: /* STRING */
+    tp_aot_op(tp, f, code + 84);
+L87: /* ADD */
+    if (TP_BOTH(regs[1], regs[2], TP_NUMBER_INT)) {
+        regs[1] = tp_int(regs[1].nint + regs[2].nint);
+    } else {
+        tp_aot_op(tp, f, code + 87);
+    }
+L88: /* RETURN */
+    return code + 88;
+L89: /* EOF */
+    return code + 89;
+}
+
+static tpd_code * _tp_tinypy_runtime_testing_219(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 22: goto L22;
+        case 24: goto L24;
+        case 28: goto L28;
+        case 32: goto L32;
+        case 36: goto L36;
+        case 39: goto L39;
+        case 43: goto L43;
+        case 44: goto L44;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 47: goto L47;
+        case 146: goto L146;
+        case 150: goto L150;
+        case 151: goto L151;
+        case 156: goto L156;
+        case 159: goto L159;
+        case 164: goto L164;
+        case 165: goto L165;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 11;
+L8: /* LINE */
+    f->line = code + 8;
+    f->lineno = 12;
+L22: /* VAR */
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L28: /* STRING */
+    tp_aot_op(tp, f, code + 28);
+L32: /* STRING */
+    tp_aot_op(tp, f, code + 32);
+L36: /* STRING */
+    tp_aot_op(tp, f, code + 36);
+L39: /* STRING */
+    tp_aot_op(tp, f, code + 39);
+L43: /* LIST */
+    tp_aot_op(tp, f, code + 43);
+L44: /* LIST */
+    tp_aot_op(tp, f, code + 44);
+L45: /* NONE */
+    regs[3] = tp_None;
+L46: /* NONE */
+    regs[4] = tp_None;
+L47: /* DEF */
+    tp_aot_op(tp, f, code + 47);
+L146: /* VAR */
+L150: /* MOVE */
+    regs[1] = regs[0];
+L151: /* GGET */
+    tp_aot_op(tp, f, code + 151);
+L156: /* VAR */
+L159: /* STRING */
+    tp_aot_op(tp, f, code + 159);
+L164: /* SET */
+    tp_set(tp, regs[2], regs[3], regs[1]);
+L165: /* EOF */
+    return code + 165;
+}
+
+static tpd_code * _tp_tinypy_runtime_testing_425(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    switch (cur - code) {
+        case 2: goto L2;
+        case 10: goto L10;
+        case 14: goto L14;
+        case 19: goto L19;
+        case 21: goto L21;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 18;
+L10: /* LINE */
+    f->line = code + 10;
+    f->lineno = 19;
+L14: /* GGET */
+    tp_aot_op(tp, f, code + 14);
+L19: /* VAR */
+L21: /* EOF */
+    return code + 21;
+}
+
+static tpd_code * _tp_tinypy_runtime_testing_483(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 7: goto L7;
+        case 14: goto L14;
+        case 16: goto L16;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 107: goto L107;
+        case 111: goto L111;
+        case 112: goto L112;
+        case 128: goto L128;
+        case 130: goto L130;
+        case 134: goto L134;
+        case 139: goto L139;
+        case 147: goto L147;
+        case 148: goto L148;
+        case 149: goto L149;
+        case 150: goto L150;
+        case 151: goto L151;
+        case 342: goto L342;
+        case 346: goto L346;
+        case 347: goto L347;
+        case 356: goto L356;
+        case 359: goto L359;
+        case 363: goto L363;
+        case 368: goto L368;
+        case 369: goto L369;
+        case 370: goto L370;
+        case 371: goto L371;
+        case 372: goto L372;
+        case 408: goto L408;
+        case 411: goto L411;
+        case 412: goto L412;
+        case 422: goto L422;
+        case 425: goto L425;
+        case 429: goto L429;
+        case 434: goto L434;
+        case 435: goto L435;
+        case 436: goto L436;
+        case 437: goto L437;
+        case 438: goto L438;
+        case 476: goto L476;
+        case 480: goto L480;
+        case 481: goto L481;
+        case 491: goto L491;
+        case 494: goto L494;
+        case 498: goto L498;
+        case 502: goto L502;
+        case 503: goto L503;
+        case 507: goto L507;
+        case 508: goto L508;
+        case 509: goto L509;
+        case 510: goto L510;
+        case 1404: goto L1404;
+        case 1406: goto L1406;
+        case 1407: goto L1407;
+        case 1418: goto L1418;
+        case 1421: goto L1421;
+        case 1425: goto L1425;
+        case 1429: goto L1429;
+        case 1434: goto L1434;
+        case 1435: goto L1435;
+        case 1436: goto L1436;
+        case 1437: goto L1437;
+        case 1438: goto L1438;
+        case 1609: goto L1609;
+        case 1612: goto L1612;
+        case 1613: goto L1613;
+        case 1618: goto L1618;
+        case 1621: goto L1621;
+        case 1626: goto L1626;
+        case 1627: goto L1627;
+        case 1632: goto L1632;
+        case 1633: goto L1633;
+        case 1637: goto L1637;
+        case 1638: goto L1638;
+        case 1643: goto L1643;
+        case 1644: goto L1644;
+        case 1647: goto L1647;
+        case 1648: goto L1648;
+        case 1652: goto L1652;
+        case 1653: goto L1653;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 21;
+L7: /* LINE */
+    f->line = code + 7;
+    f->lineno = 22;
+L14: /* VAR */
+L16: /* STRING */
+    tp_aot_op(tp, f, code + 16);
+L20: /* LIST */
+    tp_aot_op(tp, f, code + 20);
+L21: /* LIST */
+    tp_aot_op(tp, f, code + 21);
+L22: /* NONE */
+    regs[3] = tp_None;
+L23: /* NONE */
+    regs[4] = tp_None;
+L24: /* DEF */
+    tp_aot_op(tp, f, code + 24);
+L107: /* VAR */
+L111: /* MOVE */
+    regs[1] = regs[0];
+L112: /* LINE */
+    f->line = code + 112;
+    f->lineno = 26;
+L128: /* VAR */
+L130: /* STRING */
+    tp_aot_op(tp, f, code + 130);
+L134: /* STRING */
+    tp_aot_op(tp, f, code + 134);
+L139: /* STRING */
+    tp_aot_op(tp, f, code + 139);
+L147: /* LIST */
+    tp_aot_op(tp, f, code + 147);
+L148: /* LIST */
+    tp_aot_op(tp, f, code + 148);
+L149: /* NONE */
+    regs[5] = tp_None;
+L150: /* NONE */
+    regs[6] = tp_None;
+L151: /* DEF */
+    tp_aot_op(tp, f, code + 151);
+L342: /* VAR */
+L346: /* MOVE */
+    regs[3] = regs[2];
+L347: /* LINE */
+    f->line = code + 347;
+    f->lineno = 36;
+L356: /* VAR */
+L359: /* STRING */
+    tp_aot_op(tp, f, code + 359);
+L363: /* STRING */
+    tp_aot_op(tp, f, code + 363);
+L368: /* LIST */
+    tp_aot_op(tp, f, code + 368);
+L369: /* LIST */
+    tp_aot_op(tp, f, code + 369);
+L370: /* NONE */
+    regs[7] = tp_None;
+L371: /* NONE */
+    regs[8] = tp_None;
+L372: /* DEF */
+    tp_aot_op(tp, f, code + 372);
+L408: /* VAR */
+L411: /* MOVE */
+    regs[5] = regs[4];
+L412: /* LINE */
+    f->line = code + 412;
+    f->lineno = 39;
+L422: /* VAR */
+L425: /* STRING */
+    tp_aot_op(tp, f, code + 425);
+L429: /* STRING */
+    tp_aot_op(tp, f, code + 429);
+L434: /* LIST */
+    tp_aot_op(tp, f, code + 434);
+L435: /* LIST */
+    tp_aot_op(tp, f, code + 435);
+L436: /* NONE */
+    regs[9] = tp_None;
+L437: /* NONE */
+    regs[10] = tp_None;
+L438: /* DEF */
+    tp_aot_op(tp, f, code + 438);
+L476: /* VAR */
+L480: /* MOVE */
+    regs[7] = regs[6];
+L481: /* LINE */
+    f->line = code + 481;
+    f->lineno = 42;
+L491: /* VAR */
+L494: /* STRING */
+    tp_aot_op(tp, f, code + 494);
+L498: /* STRING */
+    tp_aot_op(tp, f, code + 498);
+L502: /* LIST */
+    tp_aot_op(tp, f, code + 502);
+L503: /* GGET */
+    tp_aot_op(tp, f, code + 503);
+L507: /* LIST */
+    tp_aot_op(tp, f, code + 507);
+L508: /* NONE */
+    regs[11] = tp_None;
+L509: /* NONE */
+    regs[12] = tp_None;
+L510: /* DEF */
+    tp_aot_op(tp, f, code + 510);
+L1404: /* VAR */
+L1406: /* MOVE */
+    regs[9] = regs[8];
+L1407: /* LINE */
+    f->line = code + 1407;
+    f->lineno = 90;
+L1418: /* VAR */
+L1421: /* STRING */
+    tp_aot_op(tp, f, code + 1421);
+L1425: /* STRING */
+    tp_aot_op(tp, f, code + 1425);
+L1429: /* STRING */
+    tp_aot_op(tp, f, code + 1429);
+L1434: /* LIST */
+    tp_aot_op(tp, f, code + 1434);
+L1435: /* LIST */
+    tp_aot_op(tp, f, code + 1435);
+L1436: /* NONE */
+    regs[13] = tp_None;
+L1437: /* NONE */
+    regs[14] = tp_None;
+L1438: /* DEF */
+    tp_aot_op(tp, f, code + 1438);
+L1609: /* VAR */
+L1612: /* MOVE */
+    regs[11] = regs[10];
+L1613: /* GGET */
+    tp_aot_op(tp, f, code + 1613);
+L1618: /* VAR */
+L1621: /* STRING */
+    tp_aot_op(tp, f, code + 1621);
+L1626: /* SET */
+    tp_set(tp, regs[12], regs[13], regs[1]);
+L1627: /* STRING */
+    tp_aot_op(tp, f, code + 1627);
+L1632: /* SET */
+    tp_set(tp, regs[12], regs[13], regs[3]);
+L1633: /* STRING */
+    tp_aot_op(tp, f, code + 1633);
+L1637: /* SET */
+    tp_set(tp, regs[12], regs[13], regs[5]);
+L1638: /* STRING */
+    tp_aot_op(tp, f, code + 1638);
+L1643: /* SET */
+    tp_set(tp, regs[12], regs[13], regs[7]);
+L1644: /* STRING */
+    tp_aot_op(tp, f, code + 1644);
+L1647: /* SET */
+    tp_set(tp, regs[12], regs[13], regs[9]);
+L1648: /* STRING */
+    tp_aot_op(tp, f, code + 1648);
+L1652: /* SET */
+    tp_set(tp, regs[12], regs[13], regs[11]);
+L1653: /* EOF */
+    return code + 1653;
+}
+
+static tpd_code * _tp_tinypy_runtime_testing_267(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 16: goto L16;
+        case 19: goto L19;
+        case 22: goto L22;
+        case 25: goto L25;
+        case 27: goto L27;
+        case 30: goto L30;
+        case 39: goto L39;
+        case 40: goto L40;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 55: goto L55;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 68: goto L68;
+        case 72: goto L72;
+        case 73: goto L73;
+        case 80: goto L80;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 92: goto L92;
+        case 96: goto L96;
+        case 97: goto L97;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 12;
+L16: /* VAR */
+L19: /* VAR */
+L22: /* VAR */
+L25: /* VAR */
+L27: /* VAR */
+L30: /* STRING */
+    tp_aot_op(tp, f, code + 30);
+L39: /* FILE */
+    f->fname = regs[5];
+L40: /* STRING */
+    tp_aot_op(tp, f, code + 40);
+L45: /* NAME */
+    f->name = regs[5];
+L46: /* LINE */
+    f->line = code + 46;
+    f->lineno = 13;
+L55: /* STRING */
+    tp_aot_op(tp, f, code + 55);
+L59: /* SET */
+    tp_set(tp, regs[0], regs[5], regs[2]);
+L60: /* LINE */
+    f->line = code + 60;
+    f->lineno = 14;
+L68: /* STRING */
+    tp_aot_op(tp, f, code + 68);
+L72: /* SET */
+    tp_set(tp, regs[0], regs[5], regs[1]);
+L73: /* LINE */
+    f->line = code + 73;
+    f->lineno = 15;
+L80: /* STRING */
+    tp_aot_op(tp, f, code + 80);
+L83: /* SET */
+    tp_set(tp, regs[0], regs[5], regs[3]);
+L84: /* LINE */
+    f->line = code + 84;
+    f->lineno = 16;
+L92: /* STRING */
+    tp_aot_op(tp, f, code + 92);
+L96: /* SET */
+    tp_set(tp, regs[0], regs[5], regs[4]);
+L97: /* EOF */
+    return code + 97;
+}
+
+static tpd_code * _tp_tinypy_runtime_testing_508(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 12: goto L12;
+        case 21: goto L21;
+        case 22: goto L22;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 44: goto L44;
+        case 51: goto L51;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 70: goto L70;
+        case 74: goto L74;
+        case 80: goto L80;
+        case 81: goto L81;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 22;
+L9: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L21: /* FILE */
+    f->fname = regs[1];
+L22: /* STRING */
+    tp_aot_op(tp, f, code + 22);
+L27: /* NAME */
+    f->name = regs[1];
+L28: /* LINE */
+    f->line = code + 28;
+    f->lineno = 23;
+L44: /* STRING */
+    tp_aot_op(tp, f, code + 44);
+L51: /* STRING */
+    tp_aot_op(tp, f, code + 51);
+L59: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[1]);
+L60: /* LINE */
+    f->line = code + 60;
+    f->lineno = 24;
+L70: /* STRING */
+    tp_aot_op(tp, f, code + 70);
+L74: /* STRING */
+    tp_aot_op(tp, f, code + 74);
+L80: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[1]);
+L81: /* EOF */
+    return code + 81;
+}
+
+static tpd_code * _tp_tinypy_runtime_testing_635(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 18: goto L18;
+        case 21: goto L21;
+        case 25: goto L25;
+        case 32: goto L32;
+        case 41: goto L41;
+        case 42: goto L42;
+        case 47: goto L47;
+        case 48: goto L48;
+        case 53: goto L53;
+        case 55: goto L55;
+        case 56: goto L56;
+        case 65: goto L65;
+        case 68: goto L68;
+        case 72: goto L72;
+        case 73: goto L73;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 83: goto L83;
+        case 86: goto L86;
+        case 87: goto L87;
+        case 88: goto L88;
+        case 91: goto L91;
+        case 92: goto L92;
+        case 107: goto L107;
+        case 111: goto L111;
+        case 113: goto L113;
+        case 114: goto L114;
+        case 115: goto L115;
+        case 118: goto L118;
+        case 119: goto L119;
+        case 120: goto L120;
+        case 121: goto L121;
+        case 130: goto L130;
+        case 134: goto L134;
+        case 136: goto L136;
+        case 137: goto L137;
+        case 138: goto L138;
+        case 150: goto L150;
+        case 154: goto L154;
+        case 156: goto L156;
+        case 157: goto L157;
+        case 158: goto L158;
+        case 161: goto L161;
+        case 162: goto L162;
+        case 163: goto L163;
+        case 164: goto L164;
+        case 173: goto L173;
+        case 177: goto L177;
+        case 179: goto L179;
+        case 180: goto L180;
+        case 181: goto L181;
+        case 182: goto L182;
+        case 188: goto L188;
+        case 189: goto L189;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 26;
+L18: /* VAR */
+L21: /* VAR */
+L25: /* VAR */
+L32: /* STRING */
+    tp_aot_op(tp, f, code + 32);
+L41: /* FILE */
+    f->fname = regs[3];
+L42: /* STRING */
+    tp_aot_op(tp, f, code + 42);
+L47: /* NAME */
+    f->name = regs[3];
+L48: /* LINE */
+    f->line = code + 48;
+    f->lineno = 27;
+L53: /* VAR */
+L55: /* LIST */
+    tp_aot_op(tp, f, code + 55);
+L56: /* LINE */
+    f->line = code + 56;
+    f->lineno = 28;
+L65: /* VAR */
+L68: /* GGET */
+    tp_aot_op(tp, f, code + 68);
+L72: /* MOVE */
+    regs[5] = regs[0];
+L73: /* CALLP */
+    return code + 73;
+L74: /* MOVE */
+    regs[6] = regs[0];
+L75: /* LINE */
+    f->line = code + 75;
+    f->lineno = 29;
+L83: /* NUMBER */
+    tp_aot_op(tp, f, code + 83);
+L86: /* ITER */
+    if (tp_iter_next(tp, &regs[0], regs[6], &regs[4])) {
+        goto L88;
+    }
+L87: /* JUMP */
+    goto L182;
+L88: /* VAR */
+L91: /* MOVE */
+    regs[5] = regs[0];
+L92: /* LINE */
+    f->line = code + 92;
+    f->lineno = 30;
+L107: /* STRING */
+    tp_aot_op(tp, f, code + 107);
+L111: /* METHOD */
+    tp_aot_op(tp, f, code + 111);
+L113: /* MOVE */
+    regs[9] = regs[2];
+L114: /* CALLM */
+    return code + 114;
+L115: /* NUMBER */
+    tp_aot_op(tp, f, code + 115);
+L118: /* EQ */
+    if (TP_BOTH(regs[0], regs[7], TP_NUMBER_INT)) {
+        regs[0] = tp_bool(regs[0].nint == regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 118);
+    }
+L119: /* IF */
+    if (TP_IS_INT(regs[0]) ? regs[0].nint != 0 : tp_true(tp, regs[0])) {
+        goto L121;
+    }
+L120: /* JUMP */
+    goto L138;
+L121: /* LINE */
+    f->line = code + 121;
+    f->lineno = 31;
+L130: /* STRING */
+    tp_aot_op(tp, f, code + 130);
+L134: /* METHOD */
+    tp_aot_op(tp, f, code + 134);
+L136: /* MOVE */
+    regs[9] = regs[5];
+L137: /* CALLM */
+    return code + 137;
+L138: /* LINE */
+    f->line = code + 138;
+    f->lineno = 32;
+L150: /* STRING */
+    tp_aot_op(tp, f, code + 150);
+L154: /* METHOD */
+    tp_aot_op(tp, f, code + 154);
+L156: /* MOVE */
+    regs[9] = regs[1];
+L157: /* CALLM */
+    return code + 157;
+L158: /* NUMBER */
+    tp_aot_op(tp, f, code + 158);
+L161: /* EQ */
+    if (TP_BOTH(regs[0], regs[7], TP_NUMBER_INT)) {
+        regs[0] = tp_bool(regs[0].nint == regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 161);
+    }
+L162: /* IF */
+    if (TP_IS_INT(regs[0]) ? regs[0].nint != 0 : tp_true(tp, regs[0])) {
+        goto L164;
+    }
+L163: /* JUMP */
+    tp_aot_safepoint(tp, 77);
+    goto L86;
+L164: /* LINE */
+    f->line = code + 164;
+    f->lineno = 33;
+L173: /* STRING */
+    tp_aot_op(tp, f, code + 173);
+L177: /* METHOD */
+    tp_aot_op(tp, f, code + 177);
+L179: /* MOVE */
+    regs[9] = regs[5];
+L180: /* CALLM */
+    return code + 180;
+L181: /* JUMP */
+    tp_aot_safepoint(tp, 95);
+    goto L86;
+L182: /* LINE */
+    f->line = code + 182;
+    f->lineno = 34;
+L188: /* RETURN */
+    return code + 188;
+L189: /* EOF */
+    return code + 189;
+}
+
+static tpd_code * _tp_tinypy_runtime_testing_856(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 11: goto L11;
+        case 14: goto L14;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 28: goto L28;
+        case 29: goto L29;
+        case 34: goto L34;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 36;
+L11: /* VAR */
+L14: /* STRING */
+    tp_aot_op(tp, f, code + 14);
+L23: /* FILE */
+    f->fname = regs[1];
+L24: /* STRING */
+    tp_aot_op(tp, f, code + 24);
+L28: /* NAME */
+    f->name = regs[1];
+L29: /* LINE */
+    f->line = code + 29;
+    f->lineno = 37;
+L34: /* EOF */
+    return code + 34;
+}
+
+static tpd_code * _tp_tinypy_runtime_testing_922(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 12: goto L12;
+        case 15: goto L15;
+        case 24: goto L24;
+        case 25: goto L25;
+        case 30: goto L30;
+        case 31: goto L31;
+        case 36: goto L36;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 39;
+L12: /* VAR */
+L15: /* STRING */
+    tp_aot_op(tp, f, code + 15);
+L24: /* FILE */
+    f->fname = regs[1];
+L25: /* STRING */
+    tp_aot_op(tp, f, code + 25);
+L30: /* NAME */
+    f->name = regs[1];
+L31: /* LINE */
+    f->line = code + 31;
+    f->lineno = 40;
+L36: /* EOF */
+    return code + 36;
+}
+
+static tpd_code * _tp_tinypy_runtime_testing_994(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 12: goto L12;
+        case 15: goto L15;
+        case 18: goto L18;
+        case 27: goto L27;
+        case 28: goto L28;
+        case 31: goto L31;
+        case 32: goto L32;
+        case 53: goto L53;
+        case 56: goto L56;
+        case 61: goto L61;
+        case 63: goto L63;
+        case 69: goto L69;
+        case 71: goto L71;
+        case 79: goto L79;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 89: goto L89;
+        case 93: goto L93;
+        case 95: goto L95;
+        case 96: goto L96;
+        case 112: goto L112;
+        case 115: goto L115;
+        case 119: goto L119;
+        case 120: goto L120;
+        case 123: goto L123;
+        case 127: goto L127;
+        case 130: goto L130;
+        case 134: goto L134;
+        case 136: goto L136;
+        case 139: goto L139;
+        case 140: goto L140;
+        case 141: goto L141;
+        case 145: goto L145;
+        case 148: goto L148;
+        case 149: goto L149;
+        case 150: goto L150;
+        case 151: goto L151;
+        case 152: goto L152;
+        case 153: goto L153;
+        case 154: goto L154;
+        case 164: goto L164;
+        case 168: goto L168;
+        case 171: goto L171;
+        case 172: goto L172;
+        case 175: goto L175;
+        case 176: goto L176;
+        case 187: goto L187;
+        case 191: goto L191;
+        case 194: goto L194;
+        case 195: goto L195;
+        case 199: goto L199;
+        case 200: goto L200;
+        case 210: goto L210;
+        case 214: goto L214;
+        case 217: goto L217;
+        case 218: goto L218;
+        case 222: goto L222;
+        case 223: goto L223;
+        case 245: goto L245;
+        case 246: goto L246;
+        case 261: goto L261;
+        case 265: goto L265;
+        case 267: goto L267;
+        case 268: goto L268;
+        case 269: goto L269;
+        case 270: goto L270;
+        case 276: goto L276;
+        case 279: goto L279;
+        case 282: goto L282;
+        case 289: goto L289;
+        case 293: goto L293;
+        case 296: goto L296;
+        case 302: goto L302;
+        case 305: goto L305;
+        case 308: goto L308;
+        case 309: goto L309;
+        case 317: goto L317;
+        case 320: goto L320;
+        case 321: goto L321;
+        case 322: goto L322;
+        case 325: goto L325;
+        case 326: goto L326;
+        case 336: goto L336;
+        case 340: goto L340;
+        case 341: goto L341;
+        case 355: goto L355;
+        case 358: goto L358;
+        case 362: goto L362;
+        case 364: goto L364;
+        case 365: goto L365;
+        case 366: goto L366;
+        case 367: goto L367;
+        case 377: goto L377;
+        case 381: goto L381;
+        case 382: goto L382;
+        case 391: goto L391;
+        case 395: goto L395;
+        case 397: goto L397;
+        case 398: goto L398;
+        case 399: goto L399;
+        case 411: goto L411;
+        case 415: goto L415;
+        case 419: goto L419;
+        case 420: goto L420;
+        case 421: goto L421;
+        case 438: goto L438;
+        case 443: goto L443;
+        case 445: goto L445;
+        case 453: goto L453;
+        case 455: goto L455;
+        case 456: goto L456;
+        case 457: goto L457;
+        case 458: goto L458;
+        case 470: goto L470;
+        case 473: goto L473;
+        case 474: goto L474;
+        case 486: goto L486;
+        case 490: goto L490;
+        case 494: goto L494;
+        case 495: goto L495;
+        case 496: goto L496;
+        case 502: goto L502;
+        case 512: goto L512;
+        case 515: goto L515;
+        case 516: goto L516;
+        case 528: goto L528;
+        case 532: goto L532;
+        case 536: goto L536;
+        case 537: goto L537;
+        case 546: goto L546;
+        case 549: goto L549;
+        case 550: goto L550;
+        case 566: goto L566;
+        case 568: goto L568;
+        case 577: goto L577;
+        case 581: goto L581;
+        case 583: goto L583;
+        case 584: goto L584;
+        case 585: goto L585;
+        case 594: goto L594;
+        case 597: goto L597;
+        case 598: goto L598;
+        case 606: goto L606;
+        case 607: goto L607;
+        case 608: goto L608;
+        case 609: goto L609;
+        case 619: goto L619;
+        case 623: goto L623;
+        case 625: goto L625;
+        case 626: goto L626;
+        case 627: goto L627;
+        case 646: goto L646;
+        case 647: goto L647;
+        case 656: goto L656;
+        case 660: goto L660;
+        case 662: goto L662;
+        case 663: goto L663;
+        case 664: goto L664;
+        case 665: goto L665;
+        case 666: goto L666;
+        case 675: goto L675;
+        case 679: goto L679;
+        case 680: goto L680;
+        case 692: goto L692;
+        case 697: goto L697;
+        case 698: goto L698;
+        case 705: goto L705;
+        case 708: goto L708;
+        case 709: goto L709;
+        case 710: goto L710;
+        case 711: goto L711;
+        case 732: goto L732;
+        case 746: goto L746;
+        case 750: goto L750;
+        case 752: goto L752;
+        case 753: goto L753;
+        case 754: goto L754;
+        case 755: goto L755;
+        case 781: goto L781;
+        case 799: goto L799;
+        case 803: goto L803;
+        case 805: goto L805;
+        case 806: goto L806;
+        case 807: goto L807;
+        case 814: goto L814;
+        case 815: goto L815;
+        case 816: goto L816;
+        case 817: goto L817;
+        case 824: goto L824;
+        case 827: goto L827;
+        case 828: goto L828;
+        case 829: goto L829;
+        case 830: goto L830;
+        case 838: goto L838;
+        case 841: goto L841;
+        case 845: goto L845;
+        case 847: goto L847;
+        case 850: goto L850;
+        case 851: goto L851;
+        case 859: goto L859;
+        case 862: goto L862;
+        case 863: goto L863;
+        case 869: goto L869;
+        case 872: goto L872;
+        case 876: goto L876;
+        case 878: goto L878;
+        case 881: goto L881;
+        case 882: goto L882;
+        case 888: goto L888;
+        case 891: goto L891;
+        case 892: goto L892;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 42;
+L12: /* VAR */
+L15: /* VAR */
+L18: /* STRING */
+    tp_aot_op(tp, f, code + 18);
+L27: /* FILE */
+    f->fname = regs[2];
+L28: /* STRING */
+    tp_aot_op(tp, f, code + 28);
+L31: /* NAME */
+    f->name = regs[2];
+L32: /* LINE */
+    f->line = code + 32;
+    f->lineno = 43;
+L53: /* VAR */
+L56: /* STRING */
+    tp_aot_op(tp, f, code + 56);
+L61: /* METHOD */
+    tp_aot_op(tp, f, code + 61);
+L63: /* STRING */
+    tp_aot_op(tp, f, code + 63);
+L69: /* MGET */
+    tp_aot_op(tp, f, code + 69);
+L71: /* STRING */
+    tp_aot_op(tp, f, code + 71);
+L79: /* MGET */
+    tp_aot_op(tp, f, code + 79);
+L81: /* CALLM */
+    return code + 81;
+L82: /* LINE */
+    f->line = code + 82;
+    f->lineno = 44;
+L89: /* STRING */
+    tp_aot_op(tp, f, code + 89);
+L93: /* METHOD */
+    tp_aot_op(tp, f, code + 93);
+L95: /* CALLM */
+    return code + 95;
+L96: /* LINE */
+    f->line = code + 96;
+    f->lineno = 46;
+L112: /* VAR */
+L115: /* GGET */
+    tp_aot_op(tp, f, code + 115);
+L119: /* DICT */
+    tp_aot_op(tp, f, code + 119);
+L120: /* VAR */
+L123: /* STRING */
+    tp_aot_op(tp, f, code + 123);
+L127: /* GGET */
+    tp_aot_op(tp, f, code + 127);
+L130: /* STRING */
+    tp_aot_op(tp, f, code + 130);
+L134: /* MGET */
+    tp_aot_op(tp, f, code + 134);
+L136: /* NUMBER */
+    tp_aot_op(tp, f, code + 136);
+L139: /* GET */
+    regs[9] = tp_get(tp, regs[9], regs[3]);
+    tp_grey(tp, regs[9]);
+L140: /* SET */
+    tp_set(tp, regs[7], regs[8], regs[9]);
+L141: /* STRING */
+    tp_aot_op(tp, f, code + 141);
+L145: /* GGET */
+    tp_aot_op(tp, f, code + 145);
+L148: /* MOVE */
+    regs[4] = regs[2];
+L149: /* CALLP */
+    return code + 149;
+L150: /* SET */
+    tp_set(tp, regs[7], regs[8], regs[9]);
+L151: /* LIST */
+    tp_aot_op(tp, f, code + 151);
+L152: /* MOVE */
+    regs[9] = regs[7];
+L153: /* CALL */
+    return code + 153;
+L154: /* LINE */
+    f->line = code + 154;
+    f->lineno = 48;
+L164: /* GGET */
+    tp_aot_op(tp, f, code + 164);
+L168: /* NUMBER */
+    tp_aot_op(tp, f, code + 168);
+L171: /* CALLP */
+    return code + 171;
+L172: /* STRING */
+    tp_aot_op(tp, f, code + 172);
+L175: /* SET */
+    tp_set(tp, regs[7], regs[8], regs[6]);
+L176: /* LINE */
+    f->line = code + 176;
+    f->lineno = 49;
+L187: /* GGET */
+    tp_aot_op(tp, f, code + 187);
+L191: /* NUMBER */
+    tp_aot_op(tp, f, code + 191);
+L194: /* CALLP */
+    return code + 194;
+L195: /* STRING */
+    tp_aot_op(tp, f, code + 195);
+L199: /* SET */
+    tp_set(tp, regs[7], regs[8], regs[6]);
+L200: /* LINE */
+    f->line = code + 200;
+    f->lineno = 50;
+L210: /* GGET */
+    tp_aot_op(tp, f, code + 210);
+L214: /* NUMBER */
+    tp_aot_op(tp, f, code + 214);
+L217: /* CALLP */
+    return code + 217;
+L218: /* STRING */
+    tp_aot_op(tp, f, code + 218);
+L222: /* SET */
+    tp_set(tp, regs[7], regs[8], regs[6]);
+L223: /* LINE */
+    f->line = code + 223;
+    f->lineno = 52;
+L245: /* MOVE */
+    regs[8] = regs[1];
+L246: /* STRING */
+    tp_aot_op(tp, f, code + 246);
+L261: /* STRING */
+    tp_aot_op(tp, f, code + 261);
+L265: /* METHOD */
+    tp_aot_op(tp, f, code + 265);
+L267: /* MOVE */
+    regs[5] = regs[7];
+L268: /* CALLM */
+    return code + 268;
+L269: /* CALLP */
+    return code + 269;
+L270: /* LINE */
+    f->line = code + 270;
+    f->lineno = 54;
+L276: /* VAR */
+L279: /* NUMBER */
+    tp_aot_op(tp, f, code + 279);
+L282: /* LINE */
+    f->line = code + 282;
+    f->lineno = 55;
+L289: /* VAR */
+L293: /* NUMBER */
+    tp_aot_op(tp, f, code + 293);
+L296: /* LINE */
+    f->line = code + 296;
+    f->lineno = 56;
+L302: /* VAR */
+L305: /* NUMBER */
+    tp_aot_op(tp, f, code + 305);
+L308: /* MOVE */
+    regs[9] = regs[3];
+L309: /* LINE */
+    f->line = code + 309;
+    f->lineno = 57;
+L317: /* NUMBER */
+    tp_aot_op(tp, f, code + 317);
+L320: /* ITER */
+    if (tp_iter_next(tp, &regs[3], regs[2], &regs[4])) {
+        goto L322;
+    }
+L321: /* JUMP */
+    goto L666;
+L322: /* VAR */
+L325: /* MOVE */
+    regs[5] = regs[3];
+L326: /* LINE */
+    f->line = code + 326;
+    f->lineno = 58;
+L336: /* VAR */
+L340: /* GET */
+    regs[3] = tp_get(tp, regs[0], regs[5]);
+    tp_grey(tp, regs[3]);
+L341: /* LINE */
+    f->line = code + 341;
+    f->lineno = 59;
+L355: /* VAR */
+L358: /* STRING */
+    tp_aot_op(tp, f, code + 358);
+L362: /* METHOD */
+    tp_aot_op(tp, f, code + 362);
+L364: /* MOVE */
+    regs[14] = regs[5];
+L365: /* MOVE */
+    regs[15] = regs[3];
+L366: /* CALLM */
+    return code + 366;
+L367: /* LINE */
+    f->line = code + 367;
+    f->lineno = 60;
+L377: /* STRING */
+    tp_aot_op(tp, f, code + 377);
+L381: /* SET */
+    tp_set(tp, regs[7], regs[11], regs[5]);
+L382: /* LINE */
+    f->line = code + 382;
+    f->lineno = 61;
+L391: /* STRING */
+    tp_aot_op(tp, f, code + 391);
+L395: /* MGET */
+    tp_aot_op(tp, f, code + 395);
+L397: /* IF */
+    if (TP_IS_INT(regs[11]) ? regs[11].nint != 0 : tp_true(tp, regs[11])) {
+        goto L399;
+    }
+L398: /* JUMP */
+    goto L421;
+L399: /* LINE */
+    f->line = code + 399;
+    f->lineno = 62;
+L411: /* STRING */
+    tp_aot_op(tp, f, code + 411);
+L415: /* STRING */
+    tp_aot_op(tp, f, code + 415);
+L419: /* SET */
+    tp_set(tp, regs[7], regs[12], regs[11]);
+L420: /* JUMP */
+    goto L537;
+L421: /* LINE */
+    f->line = code + 421;
+    f->lineno = 63;
+L438: /* STRING */
+    tp_aot_op(tp, f, code + 438);
+L443: /* METHOD */
+    tp_aot_op(tp, f, code + 443);
+L445: /* STRING */
+    tp_aot_op(tp, f, code + 445);
+L453: /* MGET */
+    tp_aot_op(tp, f, code + 453);
+L455: /* CALLM */
+    return code + 455;
+L456: /* IF */
+    if (TP_IS_INT(regs[11]) ? regs[11].nint != 0 : tp_true(tp, regs[11])) {
+        goto L458;
+    }
+L457: /* JUMP */
+    goto L496;
+L458: /* LINE */
+    f->line = code + 458;
+    f->lineno = 64;
+L470: /* NUMBER */
+    tp_aot_op(tp, f, code + 470);
+L473: /* ADD */
+    if (TP_BOTH(regs[8], regs[12], TP_NUMBER_INT)) {
+        regs[8] = tp_int(regs[8].nint + regs[12].nint);
+    } else {
+        tp_aot_op(tp, f, code + 473);
+    }
+L474: /* LINE */
+    f->line = code + 474;
+    f->lineno = 65;
+L486: /* STRING */
+    tp_aot_op(tp, f, code + 486);
+L490: /* STRING */
+    tp_aot_op(tp, f, code + 490);
+L494: /* SET */
+    tp_set(tp, regs[7], regs[12], regs[11]);
+L495: /* JUMP */
+    goto L537;
+L496: /* LINE */
+    f->line = code + 496;
+    f->lineno = 66;
+L502: /* LINE */
+    f->line = code + 502;
+    f->lineno = 67;
+L512: /* NUMBER */
+    tp_aot_op(tp, f, code + 512);
+L515: /* ADD */
+    if (TP_BOTH(regs[6], regs[12], TP_NUMBER_INT)) {
+        regs[6] = tp_int(regs[6].nint + regs[12].nint);
+    } else {
+        tp_aot_op(tp, f, code + 515);
+    }
+L516: /* LINE */
+    f->line = code + 516;
+    f->lineno = 68;
+L528: /* STRING */
+    tp_aot_op(tp, f, code + 528);
+L532: /* STRING */
+    tp_aot_op(tp, f, code + 532);
+L536: /* SET */
+    tp_set(tp, regs[7], regs[12], regs[11]);
+L537: /* LINE */
+    f->line = code + 537;
+    f->lineno = 69;
+L546: /* STRING */
+    tp_aot_op(tp, f, code + 546);
+L549: /* SET */
+    tp_set(tp, regs[7], regs[11], regs[9]);
+L550: /* LINE */
+    f->line = code + 550;
+    f->lineno = 70;
+L566: /* VAR */
+L568: /* STRING */
+    tp_aot_op(tp, f, code + 568);
+L577: /* STRING */
+    tp_aot_op(tp, f, code + 577);
+L581: /* METHOD */
+    tp_aot_op(tp, f, code + 581);
+L583: /* MOVE */
+    regs[15] = regs[7];
+L584: /* CALLM */
+    return code + 584;
+L585: /* LINE */
+    f->line = code + 585;
+    f->lineno = 71;
+L594: /* NUMBER */
+    tp_aot_op(tp, f, code + 594);
+L597: /* ADD */
+    if (TP_BOTH(regs[9], regs[13], TP_NUMBER_INT)) {
+        regs[9] = tp_int(regs[9].nint + regs[13].nint);
+    } else {
+        tp_aot_op(tp, f, code + 597);
+    }
+L598: /* LINE */
+    f->line = code + 598;
+    f->lineno = 72;
+L606: /* MOVE */
+    regs[13] = regs[1];
+L607: /* MOVE */
+    regs[14] = regs[11];
+L608: /* CALLP */
+    return code + 608;
+L609: /* LINE */
+    f->line = code + 609;
+    f->lineno = 73;
+L619: /* STRING */
+    tp_aot_op(tp, f, code + 619);
+L623: /* MGET */
+    tp_aot_op(tp, f, code + 623);
+L625: /* IFN */
+    if (!(TP_IS_INT(regs[13]) ? regs[13].nint != 0 : tp_true(tp, regs[13]))) {
+        goto L627;
+    }
+L626: /* JUMP */
+    tp_aot_safepoint(tp, 306);
+    goto L320;
+L627: /* LINE */
+    f->line = code + 627;
+    f->lineno = 74;
+L646: /* MOVE */
+    regs[13] = regs[1];
+L647: /* STRING */
+    tp_aot_op(tp, f, code + 647);
+L656: /* STRING */
+    tp_aot_op(tp, f, code + 656);
+L660: /* METHOD */
+    tp_aot_op(tp, f, code + 660);
+L662: /* MOVE */
+    regs[17] = regs[10];
+L663: /* CALLM */
+    return code + 663;
+L664: /* CALLP */
+    return code + 664;
+L665: /* JUMP */
+    tp_aot_safepoint(tp, 345);
+    goto L320;
+L666: /* LINE */
+    f->line = code + 666;
+    f->lineno = 76;
+L675: /* STRING */
+    tp_aot_op(tp, f, code + 675);
+L679: /* SET */
+    tp_set(tp, regs[7], regs[4], regs[6]);
+L680: /* LINE */
+    f->line = code + 680;
+    f->lineno = 77;
+L692: /* STRING */
+    tp_aot_op(tp, f, code + 692);
+L697: /* SET */
+    tp_set(tp, regs[7], regs[4], regs[8]);
+L698: /* LINE */
+    f->line = code + 698;
+    f->lineno = 78;
+L705: /* NUMBER */
+    tp_aot_op(tp, f, code + 705);
+L708: /* GT */
+    if (TP_BOTH(regs[6], regs[12], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[6].nint > regs[12].nint);
+    } else {
+        tp_aot_op(tp, f, code + 708);
+    }
+L709: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L711;
+    }
+L710: /* JUMP */
+    goto L755;
+L711: /* LINE */
+    f->line = code + 711;
+    f->lineno = 79;
+L732: /* STRING */
+    tp_aot_op(tp, f, code + 732);
+L746: /* STRING */
+    tp_aot_op(tp, f, code + 746);
+L750: /* METHOD */
+    tp_aot_op(tp, f, code + 750);
+L752: /* MOVE */
+    regs[14] = regs[7];
+L753: /* CALLM */
+    return code + 753;
+L754: /* JUMP */
+    goto L807;
+L755: /* LINE */
+    f->line = code + 755;
+    f->lineno = 81;
+L781: /* STRING */
+    tp_aot_op(tp, f, code + 781);
+L799: /* STRING */
+    tp_aot_op(tp, f, code + 799);
+L803: /* METHOD */
+    tp_aot_op(tp, f, code + 803);
+L805: /* MOVE */
+    regs[14] = regs[7];
+L806: /* CALLM */
+    return code + 806;
+L807: /* LINE */
+    f->line = code + 807;
+    f->lineno = 83;
+L814: /* MOVE */
+    regs[12] = regs[1];
+L815: /* MOVE */
+    regs[13] = regs[11];
+L816: /* CALLP */
+    return code + 816;
+L817: /* LINE */
+    f->line = code + 817;
+    f->lineno = 84;
+L824: /* NUMBER */
+    tp_aot_op(tp, f, code + 824);
+L827: /* GT */
+    if (TP_BOTH(regs[6], regs[12], TP_NUMBER_INT)) {
+        regs[4] = tp_bool(regs[6].nint > regs[12].nint);
+    } else {
+        tp_aot_op(tp, f, code + 827);
+    }
+L828: /* IF */
+    if (TP_IS_INT(regs[4]) ? regs[4].nint != 0 : tp_true(tp, regs[4])) {
+        goto L830;
+    }
+L829: /* JUMP */
+    goto L863;
+L830: /* LINE */
+    f->line = code + 830;
+    f->lineno = 85;
+L838: /* GGET */
+    tp_aot_op(tp, f, code + 838);
+L841: /* STRING */
+    tp_aot_op(tp, f, code + 841);
+L845: /* METHOD */
+    tp_aot_op(tp, f, code + 845);
+L847: /* NUMBER */
+    tp_aot_op(tp, f, code + 847);
+L850: /* CALLM */
+    return code + 850;
+L851: /* LINE */
+    f->line = code + 851;
+    f->lineno = 86;
+L859: /* NUMBER */
+    tp_aot_op(tp, f, code + 859);
+L862: /* RETURN */
+    return code + 862;
+L863: /* LINE */
+    f->line = code + 863;
+    f->lineno = 87;
+L869: /* GGET */
+    tp_aot_op(tp, f, code + 869);
+L872: /* STRING */
+    tp_aot_op(tp, f, code + 872);
+L876: /* METHOD */
+    tp_aot_op(tp, f, code + 876);
+L878: /* NUMBER */
+    tp_aot_op(tp, f, code + 878);
+L881: /* CALLM */
+    return code + 881;
+L882: /* LINE */
+    f->line = code + 882;
+    f->lineno = 88;
+L888: /* NUMBER */
+    tp_aot_op(tp, f, code + 888);
+L891: /* RETURN */
+    return code + 891;
+L892: /* EOF */
+    return code + 892;
+}
+
+static tpd_code * _tp_tinypy_runtime_testing_1922(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 13: goto L13;
+        case 16: goto L16;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 32: goto L32;
+        case 33: goto L33;
+        case 37: goto L37;
+        case 38: goto L38;
+        case 46: goto L46;
+        case 50: goto L50;
+        case 52: goto L52;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 59: goto L59;
+        case 60: goto L60;
+        case 68: goto L68;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 86: goto L86;
+        case 91: goto L91;
+        case 92: goto L92;
+        case 95: goto L95;
+        case 96: goto L96;
+        case 97: goto L97;
+        case 98: goto L98;
+        case 99: goto L99;
+        case 104: goto L104;
+        case 115: goto L115;
+        case 118: goto L118;
+        case 122: goto L122;
+        case 124: goto L124;
+        case 125: goto L125;
+        case 128: goto L128;
+        case 130: goto L130;
+        case 133: goto L133;
+        case 134: goto L134;
+        case 137: goto L137;
+        case 140: goto L140;
+        case 141: goto L141;
+        case 156: goto L156;
+        case 161: goto L161;
+        case 162: goto L162;
+        case 165: goto L165;
+        case 166: goto L166;
+        case 167: goto L167;
+        case 168: goto L168;
+        case 169: goto L169;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 90;
+L13: /* VAR */
+L16: /* VAR */
+L19: /* VAR */
+L23: /* STRING */
+    tp_aot_op(tp, f, code + 23);
+L32: /* FILE */
+    f->fname = regs[3];
+L33: /* STRING */
+    tp_aot_op(tp, f, code + 33);
+L37: /* NAME */
+    f->name = regs[3];
+L38: /* LINE */
+    f->line = code + 38;
+    f->lineno = 91;
+L46: /* STRING */
+    tp_aot_op(tp, f, code + 46);
+L50: /* METHOD */
+    tp_aot_op(tp, f, code + 50);
+L52: /* MOVE */
+    regs[6] = regs[1];
+L53: /* CALLM */
+    return code + 53;
+L54: /* LINE */
+    f->line = code + 54;
+    f->lineno = 92;
+L59: /* SETJMP */
+    f->jmp = code + 99;
+L60: /* LINE */
+    f->line = code + 60;
+    f->lineno = 93;
+L68: /* MOVE */
+    regs[4] = regs[2];
+L69: /* MOVE */
+    regs[5] = regs[0];
+L70: /* CALLP */
+    return code + 70;
+L71: /* LINE */
+    f->line = code + 71;
+    f->lineno = 94;
+L86: /* GGET */
+    tp_aot_op(tp, f, code + 86);
+L91: /* MOVE */
+    regs[5] = regs[1];
+L92: /* NUMBER */
+    tp_aot_op(tp, f, code + 92);
+L95: /* NONE */
+    regs[7] = tp_None;
+L96: /* NONE */
+    regs[8] = tp_None;
+L97: /* CALLP */
+    return code + 97;
+L98: /* RETURN */
+    return code + 98;
+L99: /* LINE */
+    f->line = code + 99;
+    f->lineno = 95;
+L104: /* LINE */
+    f->line = code + 104;
+    f->lineno = 96;
+L115: /* GGET */
+    tp_aot_op(tp, f, code + 115);
+L118: /* STRING */
+    tp_aot_op(tp, f, code + 118);
+L122: /* METHOD */
+    tp_aot_op(tp, f, code + 122);
+L124: /* CALLM */
+    return code + 124;
+L125: /* VAR */
+L128: /* VAR */
+L130: /* NUMBER */
+    tp_aot_op(tp, f, code + 130);
+L133: /* GET */
+    regs[4] = tp_get(tp, regs[3], regs[6]);
+    tp_grey(tp, regs[4]);
+L134: /* VAR */
+L137: /* NUMBER */
+    tp_aot_op(tp, f, code + 137);
+L140: /* GET */
+    regs[5] = tp_get(tp, regs[3], regs[7]);
+    tp_grey(tp, regs[5]);
+L141: /* LINE */
+    f->line = code + 141;
+    f->lineno = 97;
+L156: /* GGET */
+    tp_aot_op(tp, f, code + 156);
+L161: /* MOVE */
+    regs[7] = regs[1];
+L162: /* NUMBER */
+    tp_aot_op(tp, f, code + 162);
+L165: /* MOVE */
+    regs[9] = regs[4];
+L166: /* MOVE */
+    regs[10] = regs[5];
+L167: /* CALLP */
+    return code + 167;
+L168: /* RETURN */
+    return code + 168;
+L169: /* EOF */
+    return code + 169;
+}
+
+static const tpd_aot _tp_tinypy_runtime_testing_aot[] = {
+    {0, _tp_tinypy_runtime_testing_0},
+    {90, _tp_tinypy_runtime_testing_90},
+    {219, _tp_tinypy_runtime_testing_219},
+    {425, _tp_tinypy_runtime_testing_425},
+    {483, _tp_tinypy_runtime_testing_483},
+    {267, _tp_tinypy_runtime_testing_267},
+    {508, _tp_tinypy_runtime_testing_508},
+    {635, _tp_tinypy_runtime_testing_635},
+    {856, _tp_tinypy_runtime_testing_856},
+    {922, _tp_tinypy_runtime_testing_922},
+    {994, _tp_tinypy_runtime_testing_994},
+    {1922, _tp_tinypy_runtime_testing_1922},
+};
+
+void tinypy_runtime_testing_init(TP) {
+    tp_aot_import(tp, "tinypy.runtime.testing", _tp_tinypy_runtime_testing_tpc, sizeof(_tp_tinypy_runtime_testing_tpc),
+        _tp_tinypy_runtime_testing_aot, 12);
+}
@@ -0,0 +1,1150 @@
+/* Generated from tinypy/runtime/types.py with tpc -a. Do not modify. */
+#include <tinypy/tp.h>
+
+static unsigned char _tp_tinypy_runtime_types_tpc[] = {
+0x2d,0x0a,0x00,0x11,0x00,0x00,0x00,0x00,0x1f,0x07,0x00,0x01,0x53,0x74,0x72,0x69,
+0x6e,0x67,0x54,0x79,0x70,0x65,0x20,0x3d,0x20,0x67,0x65,0x74,0x6d,0x65,0x74,0x61,
+0x28,0x22,0x22,0x29,0x00,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x17,
+0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x72,0x75,0x6e,0x74,0x69,0x6d,0x65,0x2f,0x74,
+0x79,0x70,0x65,0x73,0x2e,0x70,0x79,0x00,0x22,0x00,0x00,0x00,0x0d,0x00,0x00,0x01,
+0x00,0x00,0x00,0x01,0x3f,0x00,0x00,0x00,0x23,0x00,0x00,0x00,0x0d,0x00,0x00,0x02,
+0x00,0x00,0x00,0x0a,0x53,0x74,0x72,0x69,0x6e,0x67,0x54,0x79,0x70,0x65,0x00,0x00,
+0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x6d,0x65,0x74,0x61,0x00,
+0x0d,0x03,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x01,0x02,0x02,
+0x0f,0x00,0x01,0x00,0x1f,0x06,0x00,0x02,0x4c,0x69,0x73,0x74,0x54,0x79,0x70,0x65,
+0x20,0x3d,0x20,0x67,0x65,0x74,0x6d,0x65,0x74,0x61,0x28,0x5b,0x5d,0x29,0x00,0x00,
+0x0d,0x00,0x00,0x05,0x00,0x00,0x00,0x08,0x4c,0x69,0x73,0x74,0x54,0x79,0x70,0x65,
+0x00,0x00,0x00,0x00,0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x6d,
+0x65,0x74,0x61,0x00,0x1c,0x03,0x00,0x00,0x37,0x01,0x02,0x02,0x0f,0x00,0x01,0x00,
+0x1f,0x06,0x00,0x03,0x44,0x69,0x63,0x74,0x54,0x79,0x70,0x65,0x20,0x3d,0x20,0x67,
+0x65,0x74,0x6d,0x65,0x74,0x61,0x28,0x7b,0x7d,0x29,0x00,0x00,0x0d,0x00,0x00,0x06,
+0x00,0x00,0x00,0x08,0x44,0x69,0x63,0x74,0x54,0x79,0x70,0x65,0x00,0x00,0x00,0x00,
+0x0e,0x02,0x00,0x03,0x00,0x00,0x00,0x07,0x67,0x65,0x74,0x6d,0x65,0x74,0x61,0x00,
+0x1b,0x03,0x00,0x00,0x37,0x01,0x02,0x02,0x0f,0x00,0x01,0x00,0x1f,0x05,0x00,0x05,
+0x63,0x6c,0x61,0x73,0x73,0x20,0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x3a,
+0x00,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0x33,0x00,0x00,0x04,0x2a,0x24,0x31,0x34,
+0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x07,0x00,0x00,0x00,0x09,0x45,0x78,0x63,0x65,
+0x70,0x74,0x69,0x6f,0x6e,0x00,0x00,0x00,0x0f,0x01,0x00,0x00,0x0e,0x02,0x00,0x08,
+0x00,0x00,0x00,0x07,0x73,0x65,0x74,0x6d,0x65,0x74,0x61,0x00,0x10,0x03,0x00,0x00,
+0x0e,0x04,0x00,0x09,0x00,0x00,0x00,0x06,0x6f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,
+0x37,0x01,0x02,0x03,0x33,0x00,0x00,0x04,0x2a,0x24,0x32,0x30,0x00,0x00,0x00,0x00,
+0x1c,0x01,0x00,0x00,0x1c,0x02,0x00,0x00,0x1d,0x03,0x00,0x00,0x1d,0x04,0x00,0x00,
+0x11,0x00,0x00,0xaf,0x2d,0x07,0x00,0x05,0x00,0x00,0x00,0x00,0x1f,0x05,0x00,0x05,
+0x63,0x6c,0x61,0x73,0x73,0x20,0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x3a,
+0x00,0x00,0x00,0x00,0x1f,0x08,0x00,0x06,0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,
+0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,0x28,0x73,0x65,0x6c,0x66,0x2c,0x20,0x2a,
+0x61,0x72,0x67,0x73,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x03,0x2a,0x24,0x30,0x00,
+0x0d,0x05,0x00,0x00,0x00,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,
+0x1c,0x01,0x05,0x01,0x1c,0x02,0x00,0x00,0x0d,0x03,0x00,0x01,0x00,0x00,0x00,0x04,
+0x61,0x72,0x67,0x73,0x00,0x00,0x00,0x00,0x1d,0x04,0x00,0x00,0x11,0x00,0x00,0x2f,
+0x2d,0x03,0x00,0x03,0x00,0x00,0x00,0x00,0x1f,0x08,0x00,0x06,0x20,0x20,0x20,0x20,
+0x64,0x65,0x66,0x20,0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,0x28,0x73,0x65,0x6c,
+0x66,0x2c,0x20,0x2a,0x61,0x72,0x67,0x73,0x29,0x3a,0x00,0x00,0x33,0x00,0x00,0x04,
+0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x04,0x61,0x72,0x67,0x73,
+0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x17,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x72,0x75,0x6e,0x74,0x69,0x6d,0x65,0x2f,0x74,0x79,0x70,0x65,0x73,
+0x2e,0x70,0x79,0x00,0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x08,
+0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,0x23,0x02,0x00,0x00,
+0x1f,0x07,0x00,0x07,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x6c,0x66,
+0x2e,0x61,0x72,0x67,0x73,0x20,0x3d,0x20,0x61,0x72,0x67,0x73,0x00,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x02,0x00,0x00,0x00,0x04,0x61,0x72,0x67,0x73,0x00,0x00,0x00,0x00,
+0x0b,0x00,0x02,0x01,0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x08,0x5f,0x5f,0x69,0x6e,
+0x69,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,0x10,0x01,0x00,0x00,0x1f,0x06,0x00,0x08,
+0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x5f,0x5f,0x72,0x65,0x70,0x72,0x5f,0x5f,
+0x28,0x73,0x65,0x6c,0x66,0x29,0x3a,0x00,0x33,0x02,0x00,0x03,0x2a,0x24,0x36,0x00,
+0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,
+0x1c,0x03,0x02,0x01,0x1c,0x04,0x00,0x00,0x1d,0x05,0x00,0x00,0x1d,0x06,0x00,0x00,
+0x11,0x02,0x00,0x31,0x2d,0x03,0x00,0x04,0x00,0x00,0x00,0x01,0x1f,0x06,0x00,0x08,
+0x20,0x20,0x20,0x20,0x64,0x65,0x66,0x20,0x5f,0x5f,0x72,0x65,0x70,0x72,0x5f,0x5f,
+0x28,0x73,0x65,0x6c,0x66,0x29,0x3a,0x00,0x33,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,
+0x00,0x00,0x00,0x00,0x0d,0x01,0x00,0x00,0x00,0x00,0x00,0x17,0x74,0x69,0x6e,0x79,
+0x70,0x79,0x2f,0x72,0x75,0x6e,0x74,0x69,0x6d,0x65,0x2f,0x74,0x79,0x70,0x65,0x73,
+0x2e,0x70,0x79,0x00,0x22,0x01,0x00,0x00,0x0d,0x01,0x00,0x01,0x00,0x00,0x00,0x08,
+0x5f,0x5f,0x72,0x65,0x70,0x72,0x5f,0x5f,0x00,0x00,0x00,0x00,0x23,0x01,0x00,0x00,
+0x1f,0x08,0x00,0x09,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+0x72,0x6e,0x20,0x73,0x74,0x72,0x28,0x73,0x65,0x6c,0x66,0x2e,0x61,0x72,0x67,0x73,
+0x29,0x00,0x00,0x00,0x0e,0x01,0x00,0x02,0x00,0x00,0x00,0x03,0x73,0x74,0x72,0x00,
+0x0d,0x02,0x00,0x03,0x00,0x00,0x00,0x04,0x61,0x72,0x67,0x73,0x00,0x00,0x00,0x00,
+0x09,0x02,0x00,0x02,0x00,0x00,0x00,0x00,0x37,0x01,0x01,0x02,0x15,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x33,0x03,0x00,0x08,0x5f,0x5f,0x72,0x65,0x70,0x72,0x5f,0x5f,
+0x00,0x00,0x00,0x00,0x10,0x03,0x02,0x00,0x0e,0x04,0x00,0x02,0x00,0x00,0x00,0x09,
+0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x00,0x00,0x00,0x33,0x04,0x00,0x04,
+0x2a,0x24,0x31,0x32,0x00,0x00,0x00,0x00,0x0d,0x05,0x00,0x03,0x00,0x00,0x00,0x08,
+0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,0x5f,0x00,0x00,0x00,0x00,0x0b,0x04,0x05,0x01,
+0x0d,0x05,0x00,0x04,0x00,0x00,0x00,0x08,0x5f,0x5f,0x72,0x65,0x70,0x72,0x5f,0x5f,
+0x00,0x00,0x00,0x00,0x0b,0x04,0x05,0x03,0x00,0x00,0x00,0x00,0x1d,0x02,0x00,0x00,
+0x1d,0x03,0x00,0x00,0x14,0x01,0x00,0x02,0x1f,0x08,0x00,0x0b,0x63,0x6c,0x61,0x73,
+0x73,0x20,0x49,0x6d,0x70,0x6f,0x72,0x74,0x45,0x72,0x72,0x6f,0x72,0x28,0x45,0x78,
+0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x29,0x3a,0x00,0x00,0x00,0x34,0x01,0x00,0x00,
+0x33,0x01,0x00,0x04,0x2a,0x24,0x32,0x38,0x00,0x00,0x00,0x00,0x0d,0x02,0x00,0x0a,
+0x00,0x00,0x00,0x0b,0x49,0x6d,0x70,0x6f,0x72,0x74,0x45,0x72,0x72,0x6f,0x72,0x00,
+0x0f,0x02,0x01,0x00,0x0e,0x03,0x00,0x08,0x00,0x00,0x00,0x07,0x73,0x65,0x74,0x6d,
+0x65,0x74,0x61,0x00,0x10,0x04,0x01,0x00,0x0e,0x05,0x00,0x07,0x00,0x00,0x00,0x09,
+0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x00,0x00,0x00,0x37,0x02,0x03,0x03,
+0x33,0x01,0x00,0x04,0x2a,0x24,0x33,0x34,0x00,0x00,0x00,0x00,0x1c,0x02,0x00,0x00,
+0x1c,0x03,0x00,0x00,0x1d,0x04,0x00,0x00,0x1d,0x05,0x00,0x00,0x11,0x01,0x00,0x18,
+0x2d,0x02,0x00,0x01,0x00,0x00,0x00,0x00,0x1f,0x08,0x00,0x0b,0x63,0x6c,0x61,0x73,
+0x73,0x20,0x49,0x6d,0x70,0x6f,0x72,0x74,0x45,0x72,0x72,0x6f,0x72,0x28,0x45,0x78,
+0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x29,0x3a,0x00,0x00,0x00,0x1f,0x03,0x00,0x0c,
+0x20,0x20,0x20,0x20,0x70,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,
+0x00,0x00,0x00,0x0b,0x49,0x6d,0x70,0x6f,0x72,0x74,0x45,0x72,0x72,0x6f,0x72,0x00,
+0x33,0x00,0x00,0x03,0x2a,0x24,0x30,0x00,0x00,0x00,0x00,0x00,0x1d,0x03,0x00,0x00,
+0x1d,0x04,0x00,0x00,0x14,0x02,0x01,0x03,0x1f,0x08,0x00,0x0e,0x64,0x65,0x66,0x20,
+0x73,0x74,0x61,0x72,0x74,0x73,0x77,0x69,0x74,0x68,0x28,0x73,0x65,0x6c,0x66,0x2c,
+0x20,0x70,0x72,0x65,0x66,0x69,0x78,0x29,0x3a,0x00,0x00,0x00,0x33,0x02,0x00,0x04,
+0x2a,0x24,0x34,0x32,0x00,0x00,0x00,0x00,0x0d,0x07,0x00,0x0b,0x00,0x00,0x00,0x04,
+0x73,0x65,0x6c,0x66,0x00,0x00,0x00,0x00,0x0d,0x08,0x00,0x0c,0x00,0x00,0x00,0x06,
+0x70,0x72,0x65,0x66,0x69,0x78,0x00,0x00,0x1c,0x03,0x07,0x02,0x1c,0x04,0x00,0x00,
+0x1d,0x05,0x00,0x00,0x1d,0x06,0x00,0x00,0x11,0x02,0x00,0x39,0x2d,0x06,0x00,0x04,
+0x00,0x00,0x00,0x01,0x1f,0x08,0x00,0x0e,0x64,0x65,0x66,0x20,0x73,0x74,0x61,0x72,
+0x74,0x73,0x77,0x69,0x74,0x68,0x28,0x73,0x65,0x6c,0x66,0x2c,0x20,0x70,0x72,0x65,
+0x66,0x69,0x78,0x29,0x3a,0x00,0x00,0x00,0x33,0x00,0x00,0x04,0x73,0x65,0x6c,0x66,
+0x00,0x00,0x00,0x00,0x33,0x01,0x00,0x06,0x70,0x72,0x65,0x66,0x69,0x78,0x00,0x00,
+0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x17,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x72,
+0x75,0x6e,0x74,0x69,0x6d,0x65,0x2f,0x74,0x79,0x70,0x65,0x73,0x2e,0x70,0x79,0x00,
+0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x0a,0x73,0x74,0x61,0x72,
+0x74,0x73,0x77,0x69,0x74,0x68,0x00,0x00,0x23,0x02,0x00,0x00,0x1f,0x09,0x00,0x0f,
+0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x65,0x6c,0x66,0x2e,
+0x66,0x69,0x6e,0x64,0x28,0x70,0x72,0x65,0x66,0x69,0x78,0x29,0x20,0x3d,0x3d,0x20,
+0x30,0x00,0x00,0x00,0x0d,0x02,0x00,0x02,0x00,0x00,0x00,0x04,0x66,0x69,0x6e,0x64,
+0x00,0x00,0x00,0x00,0x38,0x03,0x00,0x02,0x00,0x00,0x00,0x00,0x10,0x05,0x01,0x00,
+0x39,0x02,0x03,0x03,0x0c,0x03,0x00,0x03,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,
+0x18,0x02,0x02,0x03,0x15,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x03,0x00,0x0d,
+0x00,0x00,0x00,0x0a,0x73,0x74,0x61,0x72,0x74,0x73,0x77,0x69,0x74,0x68,0x00,0x00,
+0x0f,0x03,0x02,0x00,0x1f,0x0a,0x00,0x11,0x53,0x74,0x72,0x69,0x6e,0x67,0x54,0x79,
+0x70,0x65,0x5b,0x27,0x73,0x74,0x61,0x72,0x74,0x73,0x77,0x69,0x74,0x68,0x27,0x5d,
+0x20,0x3d,0x20,0x73,0x74,0x61,0x72,0x74,0x73,0x77,0x69,0x74,0x68,0x00,0x00,0x00,
+0x0e,0x03,0x00,0x02,0x00,0x00,0x00,0x0a,0x53,0x74,0x72,0x69,0x6e,0x67,0x54,0x79,
+0x70,0x65,0x00,0x00,0x0e,0x04,0x00,0x0d,0x00,0x00,0x00,0x0a,0x73,0x74,0x61,0x72,
+0x74,0x73,0x77,0x69,0x74,0x68,0x00,0x00,0x0d,0x05,0x00,0x0d,0x00,0x00,0x00,0x0a,
+0x73,0x74,0x61,0x72,0x74,0x73,0x77,0x69,0x74,0x68,0x00,0x00,0x0b,0x03,0x05,0x04,
+0x1f,0x05,0x00,0x13,0x64,0x65,0x66,0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,0x28,0x73,
+0x2c,0x20,0x64,0x29,0x3a,0x00,0x00,0x00,0x33,0x03,0x00,0x04,0x2a,0x24,0x35,0x33,
+0x00,0x00,0x00,0x00,0x0d,0x08,0x00,0x0e,0x00,0x00,0x00,0x01,0x73,0x00,0x00,0x00,
+0x0d,0x09,0x00,0x0f,0x00,0x00,0x00,0x01,0x64,0x00,0x00,0x00,0x1c,0x04,0x08,0x02,
+0x1c,0x05,0x00,0x00,0x1d,0x06,0x00,0x00,0x1d,0x07,0x00,0x00,0x11,0x03,0x01,0x2d,
+0x2d,0x0d,0x00,0x0b,0x00,0x00,0x00,0x04,0x1f,0x05,0x00,0x13,0x64,0x65,0x66,0x20,
+0x66,0x6f,0x72,0x6d,0x61,0x74,0x28,0x73,0x2c,0x20,0x64,0x29,0x3a,0x00,0x00,0x00,
+0x33,0x00,0x00,0x01,0x73,0x00,0x00,0x00,0x33,0x01,0x00,0x01,0x64,0x00,0x00,0x00,
+0x0d,0x02,0x00,0x00,0x00,0x00,0x00,0x17,0x74,0x69,0x6e,0x79,0x70,0x79,0x2f,0x72,
+0x75,0x6e,0x74,0x69,0x6d,0x65,0x2f,0x74,0x79,0x70,0x65,0x73,0x2e,0x70,0x79,0x00,
+0x22,0x02,0x00,0x00,0x0d,0x02,0x00,0x01,0x00,0x00,0x00,0x06,0x66,0x6f,0x72,0x6d,
+0x61,0x74,0x00,0x00,0x23,0x02,0x00,0x00,0x1f,0x03,0x00,0x14,0x20,0x20,0x20,0x20,
+0x72,0x20,0x3d,0x20,0x5b,0x5d,0x00,0x00,0x33,0x02,0x00,0x01,0x72,0x00,0x00,0x00,
+0x1c,0x02,0x00,0x00,0x1f,0x03,0x00,0x15,0x20,0x20,0x20,0x20,0x69,0x20,0x3d,0x20,
+0x30,0x00,0x00,0x00,0x33,0x03,0x00,0x01,0x69,0x00,0x00,0x00,0x0c,0x03,0x00,0x02,
+0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x1f,0x03,0x00,0x16,0x20,0x20,0x20,0x20,
+0x6a,0x20,0x3d,0x20,0x30,0x00,0x00,0x00,0x33,0x04,0x00,0x01,0x6a,0x00,0x00,0x00,
+0x0c,0x04,0x00,0x02,0x00,0x00,0x69,0x04,0x00,0x00,0x00,0x00,0x1f,0x04,0x00,0x17,
+0x20,0x20,0x20,0x20,0x6e,0x20,0x3d,0x20,0x6c,0x65,0x6e,0x28,0x73,0x29,0x00,0x00,
+0x33,0x0c,0x00,0x01,0x6e,0x00,0x00,0x00,0x0e,0x05,0x00,0x03,0x00,0x00,0x00,0x03,
+0x6c,0x65,0x6e,0x00,0x10,0x06,0x00,0x00,0x37,0x0c,0x05,0x02,0x1f,0x05,0x00,0x18,
+0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x69,0x20,0x3c,0x20,0x6e,0x3a,
+0x00,0x00,0x00,0x00,0x1a,0x06,0x03,0x0c,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0xbf,
+0x1f,0x06,0x00,0x19,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x73,
+0x5b,0x69,0x5d,0x20,0x3d,0x3d,0x20,0x27,0x7b,0x27,0x3a,0x00,0x0a,0x06,0x00,0x03,
+0x0d,0x05,0x00,0x04,0x00,0x00,0x00,0x01,0x7b,0x00,0x00,0x00,0x18,0x06,0x06,0x05,
+0x16,0x06,0x00,0x00,0x13,0x00,0x00,0xa6,0x1f,0x08,0x00,0x1a,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,
+0x28,0x73,0x5b,0x6a,0x3a,0x69,0x5d,0x29,0x00,0x00,0x00,0x00,0x0d,0x08,0x00,0x05,
+0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,0x38,0x05,0x02,0x08,
+0x00,0x00,0x00,0x00,0x10,0x09,0x04,0x00,0x10,0x0a,0x03,0x00,0x1c,0x08,0x09,0x02,
+0x0a,0x07,0x00,0x08,0x39,0x06,0x05,0x03,0x1f,0x05,0x00,0x1b,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6a,0x20,0x3d,0x20,0x69,0x00,0x00,0x00,
+0x10,0x04,0x03,0x00,0x1f,0x07,0x00,0x1c,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x6a,0x20,0x3c,0x20,0x6e,0x3a,
+0x00,0x00,0x00,0x00,0x1a,0x06,0x04,0x0c,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x34,
+0x1f,0x08,0x00,0x1d,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x73,0x5b,0x6a,0x5d,0x20,0x3d,0x3d,0x20,0x27,
+0x7d,0x27,0x3a,0x00,0x0a,0x06,0x00,0x04,0x0d,0x05,0x00,0x06,0x00,0x00,0x00,0x01,
+0x7d,0x00,0x00,0x00,0x18,0x06,0x06,0x05,0x16,0x06,0x00,0x00,0x13,0x00,0x00,0x17,
+0x1f,0x08,0x00,0x1e,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6a,0x20,0x3d,0x20,0x6a,0x20,0x2b,0x20,
+0x31,0x00,0x00,0x00,0x0c,0x05,0x00,0x07,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x01,0x04,0x04,0x05,0x1f,0x07,0x00,0x1f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x72,0x65,0x61,
+0x6b,0x00,0x00,0x00,0x13,0x00,0x00,0x0e,0x1f,0x07,0x00,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6a,0x20,0x3d,0x20,
+0x6a,0x20,0x2b,0x20,0x31,0x00,0x00,0x00,0x0c,0x05,0x00,0x07,0x00,0x00,0x69,0x04,
+0x01,0x00,0x00,0x00,0x01,0x04,0x04,0x05,0x13,0x00,0xff,0xcb,0x1f,0x08,0x00,0x22,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x70,0x65,0x63,
+0x20,0x3d,0x20,0x73,0x5b,0x69,0x2b,0x31,0x3a,0x6a,0x2d,0x31,0x5d,0x00,0x00,0x00,
+0x33,0x06,0x00,0x04,0x73,0x70,0x65,0x63,0x00,0x00,0x00,0x00,0x0c,0x09,0x00,0x07,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x01,0x07,0x03,0x09,0x0c,0x09,0x00,0x07,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x02,0x08,0x04,0x09,0x1c,0x06,0x07,0x02,
+0x0a,0x06,0x00,0x06,0x1f,0x12,0x00,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x20,0x20,0x20,0x20,0x66,0x6f,0x6f,0x20,0x3d,0x20,0x64,0x5b,0x73,0x70,0x65,0x63,
+0x5d,0x20,0x20,0x23,0x20,0x65,0x76,0x61,0x6c,0x20,0x72,0x65,0x71,0x75,0x69,0x72,
+0x65,0x73,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x72,0x3a,
+0x20,0x65,0x76,0x61,0x6c,0x28,0x73,0x70,0x65,0x63,0x2c,0x20,0x64,0x29,0x00,0x00,
+0x33,0x05,0x00,0x03,0x66,0x6f,0x6f,0x00,0x0a,0x05,0x01,0x06,0x1f,0x08,0x00,0x27,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x2e,0x61,0x70,
+0x70,0x65,0x6e,0x64,0x28,0x73,0x74,0x72,0x28,0x66,0x6f,0x6f,0x29,0x29,0x00,0x00,
+0x0d,0x0a,0x00,0x05,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,0x6e,0x64,0x00,0x00,
+0x38,0x07,0x02,0x0a,0x00,0x00,0x00,0x01,0x0e,0x0a,0x00,0x08,0x00,0x00,0x00,0x03,
+0x73,0x74,0x72,0x00,0x10,0x0b,0x05,0x00,0x37,0x09,0x0a,0x02,0x39,0x06,0x07,0x03,
+0x1f,0x06,0x00,0x28,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x69,0x20,0x3d,0x20,0x6a,0x20,0x2d,0x20,0x31,0x00,0x00,0x00,0x0c,0x07,0x00,0x07,
+0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,0x02,0x03,0x04,0x07,0x1f,0x05,0x00,0x29,
+0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x20,0x3d,0x20,0x69,0x20,0x2b,0x20,
+0x31,0x00,0x00,0x00,0x0c,0x07,0x00,0x07,0x00,0x00,0x69,0x04,0x01,0x00,0x00,0x00,
+0x01,0x03,0x03,0x07,0x13,0x00,0xff,0x40,0x1f,0x06,0x00,0x2a,0x20,0x20,0x20,0x20,
+0x72,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x73,0x5b,0x6a,0x3a,0x69,0x5d,0x29,
+0x00,0x00,0x00,0x00,0x0d,0x0a,0x00,0x05,0x00,0x00,0x00,0x06,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x00,0x00,0x38,0x07,0x02,0x0a,0x00,0x00,0x00,0x02,0x10,0x0b,0x04,0x00,
+0x10,0x0c,0x03,0x00,0x1c,0x0a,0x0b,0x02,0x0a,0x09,0x00,0x0a,0x39,0x06,0x07,0x03,
+0x1f,0x06,0x00,0x2b,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x27,
+0x27,0x2e,0x6a,0x6f,0x69,0x6e,0x28,0x72,0x29,0x00,0x00,0x00,0x0d,0x0a,0x00,0x09,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0x0b,0x00,0x0a,0x00,0x00,0x00,0x04,
+0x6a,0x6f,0x69,0x6e,0x00,0x00,0x00,0x00,0x38,0x07,0x0a,0x0b,0x00,0x00,0x00,0x03,
+0x10,0x09,0x02,0x00,0x39,0x06,0x07,0x03,0x15,0x06,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0d,0x04,0x00,0x10,0x00,0x00,0x00,0x06,0x66,0x6f,0x72,0x6d,0x61,0x74,0x00,0x00,
+0x0f,0x04,0x03,0x00,0x1f,0x08,0x00,0x2d,0x53,0x74,0x72,0x69,0x6e,0x67,0x54,0x79,
+0x70,0x65,0x5b,0x27,0x66,0x6f,0x72,0x6d,0x61,0x74,0x27,0x5d,0x20,0x3d,0x20,0x66,
+0x6f,0x72,0x6d,0x61,0x74,0x00,0x00,0x00,0x0e,0x04,0x00,0x02,0x00,0x00,0x00,0x0a,
+0x53,0x74,0x72,0x69,0x6e,0x67,0x54,0x79,0x70,0x65,0x00,0x00,0x0e,0x05,0x00,0x10,
+0x00,0x00,0x00,0x06,0x66,0x6f,0x72,0x6d,0x61,0x74,0x00,0x00,0x0d,0x06,0x00,0x10,
+0x00,0x00,0x00,0x06,0x66,0x6f,0x72,0x6d,0x61,0x74,0x00,0x00,0x0b,0x04,0x06,0x05,
+0x00,0x00,0x00,0x00,
+};
+
+static tpd_code * _tp_tinypy_runtime_types_0(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 10: goto L10;
+        case 18: goto L18;
+        case 19: goto L19;
+        case 22: goto L22;
+        case 23: goto L23;
+        case 28: goto L28;
+        case 32: goto L32;
+        case 35: goto L35;
+        case 36: goto L36;
+        case 37: goto L37;
+        case 44: goto L44;
+        case 49: goto L49;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 55: goto L55;
+        case 56: goto L56;
+        case 63: goto L63;
+        case 68: goto L68;
+        case 72: goto L72;
+        case 73: goto L73;
+        case 74: goto L74;
+        case 75: goto L75;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 85: goto L85;
+        case 90: goto L90;
+        case 91: goto L91;
+        case 95: goto L95;
+        case 96: goto L96;
+        case 100: goto L100;
+        case 101: goto L101;
+        case 104: goto L104;
+        case 105: goto L105;
+        case 106: goto L106;
+        case 107: goto L107;
+        case 108: goto L108;
+        case 283: goto L283;
+        case 284: goto L284;
+        case 285: goto L285;
+        case 286: goto L286;
+        case 295: goto L295;
+        case 296: goto L296;
+        case 299: goto L299;
+        case 304: goto L304;
+        case 305: goto L305;
+        case 309: goto L309;
+        case 310: goto L310;
+        case 315: goto L315;
+        case 316: goto L316;
+        case 319: goto L319;
+        case 320: goto L320;
+        case 321: goto L321;
+        case 322: goto L322;
+        case 323: goto L323;
+        case 347: goto L347;
+        case 348: goto L348;
+        case 349: goto L349;
+        case 350: goto L350;
+        case 359: goto L359;
+        case 362: goto L362;
+        case 366: goto L366;
+        case 370: goto L370;
+        case 371: goto L371;
+        case 372: goto L372;
+        case 373: goto L373;
+        case 374: goto L374;
+        case 431: goto L431;
+        case 436: goto L436;
+        case 437: goto L437;
+        case 448: goto L448;
+        case 453: goto L453;
+        case 458: goto L458;
+        case 463: goto L463;
+        case 464: goto L464;
+        case 470: goto L470;
+        case 473: goto L473;
+        case 476: goto L476;
+        case 479: goto L479;
+        case 480: goto L480;
+        case 481: goto L481;
+        case 482: goto L482;
+        case 483: goto L483;
+        case 784: goto L784;
+        case 788: goto L788;
+        case 789: goto L789;
+        case 798: goto L798;
+        case 803: goto L803;
+        case 807: goto L807;
+        case 811: goto L811;
+        case 812: goto L812;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 1;
+L10: /* STRING */
+    tp_aot_op(tp, f, code + 10);
+L18: /* FILE */
+    f->fname = regs[0];
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L22: /* NAME */
+    f->name = regs[0];
+L23: /* STRING */
+    tp_aot_op(tp, f, code + 23);
+L28: /* GGET */
+    tp_aot_op(tp, f, code + 28);
+L32: /* STRING */
+    tp_aot_op(tp, f, code + 32);
+L35: /* CALLP */
+    return code + 35;
+L36: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L37: /* LINE */
+    f->line = code + 37;
+    f->lineno = 2;
+L44: /* STRING */
+    tp_aot_op(tp, f, code + 44);
+L49: /* GGET */
+    tp_aot_op(tp, f, code + 49);
+L53: /* LIST */
+    tp_aot_op(tp, f, code + 53);
+L54: /* CALLP */
+    return code + 54;
+L55: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L56: /* LINE */
+    f->line = code + 56;
+    f->lineno = 3;
+L63: /* STRING */
+    tp_aot_op(tp, f, code + 63);
+L68: /* GGET */
+    tp_aot_op(tp, f, code + 68);
+L72: /* DICT */
+    tp_aot_op(tp, f, code + 72);
+L73: /* CALLP */
+    return code + 73;
+L74: /* GSET */
+    tp_set(tp, f->globals, regs[0], regs[1]);
+L75: /* LINE */
+    f->line = code + 75;
+    f->lineno = 5;
+L81: /* CLASS */
+    regs[0] = tp_class(tp);
+L82: /* VAR */
+L85: /* STRING */
+    tp_aot_op(tp, f, code + 85);
+L90: /* GSET */
+    tp_set(tp, f->globals, regs[1], regs[0]);
+L91: /* GGET */
+    tp_aot_op(tp, f, code + 91);
+L95: /* MOVE */
+    regs[3] = regs[0];
+L96: /* GGET */
+    tp_aot_op(tp, f, code + 96);
+L100: /* CALLP */
+    return code + 100;
+L101: /* VAR */
+L104: /* LIST */
+    tp_aot_op(tp, f, code + 104);
+L105: /* LIST */
+    tp_aot_op(tp, f, code + 105);
+L106: /* NONE */
+    regs[3] = tp_None;
+L107: /* NONE */
+    regs[4] = tp_None;
+L108: /* DEF */
+    tp_aot_op(tp, f, code + 108);
+L283: /* NONE */
+    regs[2] = tp_None;
+L284: /* NONE */
+    regs[3] = tp_None;
+L285: /* CALL */
+    return code + 285;
+L286: /* LINE */
+    f->line = code + 286;
+    f->lineno = 11;
+L295: /* CLASS */
+    regs[1] = tp_class(tp);
+L296: /* VAR */
+L299: /* STRING */
+    tp_aot_op(tp, f, code + 299);
+L304: /* GSET */
+    tp_set(tp, f->globals, regs[2], regs[1]);
+L305: /* GGET */
+    tp_aot_op(tp, f, code + 305);
+L309: /* MOVE */
+    regs[4] = regs[1];
+L310: /* GGET */
+    tp_aot_op(tp, f, code + 310);
+L315: /* CALLP */
+    return code + 315;
+L316: /* VAR */
+L319: /* LIST */
+    tp_aot_op(tp, f, code + 319);
+L320: /* LIST */
+    tp_aot_op(tp, f, code + 320);
+L321: /* NONE */
+    regs[4] = tp_None;
+L322: /* NONE */
+    regs[5] = tp_None;
+L323: /* DEF */
+    tp_aot_op(tp, f, code + 323);
+L347: /* NONE */
+    regs[3] = tp_None;
+L348: /* NONE */
+    regs[4] = tp_None;
+L349: /* CALL */
+    return code + 349;
+L350: /* LINE */
+    f->line = code + 350;
+    f->lineno = 14;
+L359: /* VAR */
+L362: /* STRING */
+    tp_aot_op(tp, f, code + 362);
+L366: /* STRING */
+    tp_aot_op(tp, f, code + 366);
+L370: /* LIST */
+    tp_aot_op(tp, f, code + 370);
+L371: /* LIST */
+    tp_aot_op(tp, f, code + 371);
+L372: /* NONE */
+    regs[5] = tp_None;
+L373: /* NONE */
+    regs[6] = tp_None;
+L374: /* DEF */
+    tp_aot_op(tp, f, code + 374);
+L431: /* STRING */
+    tp_aot_op(tp, f, code + 431);
+L436: /* GSET */
+    tp_set(tp, f->globals, regs[3], regs[2]);
+L437: /* LINE */
+    f->line = code + 437;
+    f->lineno = 17;
+L448: /* GGET */
+    tp_aot_op(tp, f, code + 448);
+L453: /* GGET */
+    tp_aot_op(tp, f, code + 453);
+L458: /* STRING */
+    tp_aot_op(tp, f, code + 458);
+L463: /* SET */
+    tp_set(tp, regs[3], regs[5], regs[4]);
+L464: /* LINE */
+    f->line = code + 464;
+    f->lineno = 19;
+L470: /* VAR */
+L473: /* STRING */
+    tp_aot_op(tp, f, code + 473);
+L476: /* STRING */
+    tp_aot_op(tp, f, code + 476);
+L479: /* LIST */
+    tp_aot_op(tp, f, code + 479);
+L480: /* LIST */
+    tp_aot_op(tp, f, code + 480);
+L481: /* NONE */
+    regs[6] = tp_None;
+L482: /* NONE */
+    regs[7] = tp_None;
+L483: /* DEF */
+    tp_aot_op(tp, f, code + 483);
+L784: /* STRING */
+    tp_aot_op(tp, f, code + 784);
+L788: /* GSET */
+    tp_set(tp, f->globals, regs[4], regs[3]);
+L789: /* LINE */
+    f->line = code + 789;
+    f->lineno = 45;
+L798: /* GGET */
+    tp_aot_op(tp, f, code + 798);
+L803: /* GGET */
+    tp_aot_op(tp, f, code + 803);
+L807: /* STRING */
+    tp_aot_op(tp, f, code + 807);
+L811: /* SET */
+    tp_set(tp, regs[4], regs[6], regs[5]);
+L812: /* EOF */
+    return code + 812;
+}
+
+static tpd_code * _tp_tinypy_runtime_types_109(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 17: goto L17;
+        case 19: goto L19;
+        case 23: goto L23;
+        case 24: goto L24;
+        case 25: goto L25;
+        case 29: goto L29;
+        case 30: goto L30;
+        case 77: goto L77;
+        case 81: goto L81;
+        case 82: goto L82;
+        case 89: goto L89;
+        case 91: goto L91;
+        case 95: goto L95;
+        case 96: goto L96;
+        case 97: goto L97;
+        case 98: goto L98;
+        case 99: goto L99;
+        case 148: goto L148;
+        case 152: goto L152;
+        case 153: goto L153;
+        case 158: goto L158;
+        case 161: goto L161;
+        case 166: goto L166;
+        case 167: goto L167;
+        case 172: goto L172;
+        case 173: goto L173;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 5;
+L8: /* LINE */
+    f->line = code + 8;
+    f->lineno = 6;
+L17: /* VAR */
+L19: /* STRING */
+    tp_aot_op(tp, f, code + 19);
+L23: /* LIST */
+    tp_aot_op(tp, f, code + 23);
+L24: /* LIST */
+    tp_aot_op(tp, f, code + 24);
+L25: /* STRING */
+    tp_aot_op(tp, f, code + 25);
+L29: /* NONE */
+    regs[4] = tp_None;
+L30: /* DEF */
+    tp_aot_op(tp, f, code + 30);
+L77: /* VAR */
+L81: /* MOVE */
+    regs[1] = regs[0];
+L82: /* LINE */
+    f->line = code + 82;
+    f->lineno = 8;
+L89: /* VAR */
+L91: /* STRING */
+    tp_aot_op(tp, f, code + 91);
+L95: /* LIST */
+    tp_aot_op(tp, f, code + 95);
+L96: /* LIST */
+    tp_aot_op(tp, f, code + 96);
+L97: /* NONE */
+    regs[5] = tp_None;
+L98: /* NONE */
+    regs[6] = tp_None;
+L99: /* DEF */
+    tp_aot_op(tp, f, code + 99);
+L148: /* VAR */
+L152: /* MOVE */
+    regs[3] = regs[2];
+L153: /* GGET */
+    tp_aot_op(tp, f, code + 153);
+L158: /* VAR */
+L161: /* STRING */
+    tp_aot_op(tp, f, code + 161);
+L166: /* SET */
+    tp_set(tp, regs[4], regs[5], regs[1]);
+L167: /* STRING */
+    tp_aot_op(tp, f, code + 167);
+L172: /* SET */
+    tp_set(tp, regs[4], regs[5], regs[3]);
+L173: /* EOF */
+    return code + 173;
+}
+
+static tpd_code * _tp_tinypy_runtime_types_324(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    switch (cur - code) {
+        case 2: goto L2;
+        case 11: goto L11;
+        case 15: goto L15;
+        case 20: goto L20;
+        case 22: goto L22;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 11;
+L11: /* LINE */
+    f->line = code + 11;
+    f->lineno = 12;
+L15: /* GGET */
+    tp_aot_op(tp, f, code + 15);
+L20: /* VAR */
+L22: /* EOF */
+    return code + 22;
+}
+
+static tpd_code * _tp_tinypy_runtime_types_375(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 11: goto L11;
+        case 14: goto L14;
+        case 17: goto L17;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 31: goto L31;
+        case 32: goto L32;
+        case 42: goto L42;
+        case 46: goto L46;
+        case 48: goto L48;
+        case 49: goto L49;
+        case 50: goto L50;
+        case 53: goto L53;
+        case 54: goto L54;
+        case 55: goto L55;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 14;
+L11: /* VAR */
+L14: /* VAR */
+L17: /* STRING */
+    tp_aot_op(tp, f, code + 17);
+L25: /* FILE */
+    f->fname = regs[2];
+L26: /* STRING */
+    tp_aot_op(tp, f, code + 26);
+L31: /* NAME */
+    f->name = regs[2];
+L32: /* LINE */
+    f->line = code + 32;
+    f->lineno = 15;
+L42: /* STRING */
+    tp_aot_op(tp, f, code + 42);
+L46: /* METHOD */
+    tp_aot_op(tp, f, code + 46);
+L48: /* MOVE */
+    regs[5] = regs[1];
+L49: /* CALLM */
+    return code + 49;
+L50: /* NUMBER */
+    tp_aot_op(tp, f, code + 50);
+L53: /* EQ */
+    if (TP_BOTH(regs[2], regs[3], TP_NUMBER_INT)) {
+        regs[2] = tp_bool(regs[2].nint == regs[3].nint);
+    } else {
+        tp_aot_op(tp, f, code + 53);
+    }
+L54: /* RETURN */
+    return code + 54;
+L55: /* EOF */
+    return code + 55;
+}
+
+static tpd_code * _tp_tinypy_runtime_types_484(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 8: goto L8;
+        case 10: goto L10;
+        case 12: goto L12;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 30: goto L30;
+        case 32: goto L32;
+        case 33: goto L33;
+        case 37: goto L37;
+        case 39: goto L39;
+        case 42: goto L42;
+        case 46: goto L46;
+        case 48: goto L48;
+        case 51: goto L51;
+        case 56: goto L56;
+        case 58: goto L58;
+        case 61: goto L61;
+        case 62: goto L62;
+        case 63: goto L63;
+        case 69: goto L69;
+        case 70: goto L70;
+        case 71: goto L71;
+        case 72: goto L72;
+        case 79: goto L79;
+        case 80: goto L80;
+        case 83: goto L83;
+        case 84: goto L84;
+        case 85: goto L85;
+        case 86: goto L86;
+        case 95: goto L95;
+        case 99: goto L99;
+        case 101: goto L101;
+        case 102: goto L102;
+        case 103: goto L103;
+        case 104: goto L104;
+        case 105: goto L105;
+        case 106: goto L106;
+        case 112: goto L112;
+        case 113: goto L113;
+        case 121: goto L121;
+        case 122: goto L122;
+        case 123: goto L123;
+        case 124: goto L124;
+        case 133: goto L133;
+        case 134: goto L134;
+        case 137: goto L137;
+        case 138: goto L138;
+        case 139: goto L139;
+        case 140: goto L140;
+        case 149: goto L149;
+        case 152: goto L152;
+        case 153: goto L153;
+        case 161: goto L161;
+        case 162: goto L162;
+        case 170: goto L170;
+        case 173: goto L173;
+        case 174: goto L174;
+        case 175: goto L175;
+        case 184: goto L184;
+        case 187: goto L187;
+        case 190: goto L190;
+        case 191: goto L191;
+        case 194: goto L194;
+        case 195: goto L195;
+        case 196: goto L196;
+        case 197: goto L197;
+        case 216: goto L216;
+        case 218: goto L218;
+        case 219: goto L219;
+        case 228: goto L228;
+        case 232: goto L232;
+        case 234: goto L234;
+        case 237: goto L237;
+        case 238: goto L238;
+        case 239: goto L239;
+        case 240: goto L240;
+        case 247: goto L247;
+        case 250: goto L250;
+        case 251: goto L251;
+        case 257: goto L257;
+        case 260: goto L260;
+        case 261: goto L261;
+        case 262: goto L262;
+        case 269: goto L269;
+        case 273: goto L273;
+        case 275: goto L275;
+        case 276: goto L276;
+        case 277: goto L277;
+        case 278: goto L278;
+        case 279: goto L279;
+        case 280: goto L280;
+        case 287: goto L287;
+        case 290: goto L290;
+        case 294: goto L294;
+        case 296: goto L296;
+        case 297: goto L297;
+        case 298: goto L298;
+        case 299: goto L299;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 19;
+L8: /* VAR */
+L10: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L20: /* FILE */
+    f->fname = regs[2];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L25: /* NAME */
+    f->name = regs[2];
+L26: /* LINE */
+    f->line = code + 26;
+    f->lineno = 20;
+L30: /* VAR */
+L32: /* LIST */
+    tp_aot_op(tp, f, code + 32);
+L33: /* LINE */
+    f->line = code + 33;
+    f->lineno = 21;
+L37: /* VAR */
+L39: /* NUMBER */
+    tp_aot_op(tp, f, code + 39);
+L42: /* LINE */
+    f->line = code + 42;
+    f->lineno = 22;
+L46: /* VAR */
+L48: /* NUMBER */
+    tp_aot_op(tp, f, code + 48);
+L51: /* LINE */
+    f->line = code + 51;
+    f->lineno = 23;
+L56: /* VAR */
+L58: /* GGET */
+    tp_aot_op(tp, f, code + 58);
+L61: /* MOVE */
+    regs[6] = regs[0];
+L62: /* CALLP */
+    return code + 62;
+L63: /* LINE */
+    f->line = code + 63;
+    f->lineno = 24;
+L69: /* LT */
+    if (TP_BOTH(regs[3], regs[12], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[3].nint < regs[12].nint);
+    } else {
+        tp_aot_op(tp, f, code + 69);
+    }
+L70: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L72;
+    }
+L71: /* JUMP */
+    goto L262;
+L72: /* LINE */
+    f->line = code + 72;
+    f->lineno = 25;
+L79: /* GET */
+    regs[6] = tp_get(tp, regs[0], regs[3]);
+    tp_grey(tp, regs[6]);
+L80: /* STRING */
+    tp_aot_op(tp, f, code + 80);
+L83: /* EQ */
+    if (TP_BOTH(regs[6], regs[5], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[6].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 83);
+    }
+L84: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L86;
+    }
+L85: /* JUMP */
+    goto L251;
+L86: /* LINE */
+    f->line = code + 86;
+    f->lineno = 26;
+L95: /* STRING */
+    tp_aot_op(tp, f, code + 95);
+L99: /* METHOD */
+    tp_aot_op(tp, f, code + 99);
+L101: /* MOVE */
+    regs[9] = regs[4];
+L102: /* MOVE */
+    regs[10] = regs[3];
+L103: /* LIST */
+    tp_aot_op(tp, f, code + 103);
+L104: /* GET */
+    regs[7] = tp_get(tp, regs[0], regs[8]);
+    tp_grey(tp, regs[7]);
+L105: /* CALLM */
+    return code + 105;
+L106: /* LINE */
+    f->line = code + 106;
+    f->lineno = 27;
+L112: /* MOVE */
+    regs[4] = regs[3];
+L113: /* LINE */
+    f->line = code + 113;
+    f->lineno = 28;
+L121: /* LT */
+    if (TP_BOTH(regs[4], regs[12], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[4].nint < regs[12].nint);
+    } else {
+        tp_aot_op(tp, f, code + 121);
+    }
+L122: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L124;
+    }
+L123: /* JUMP */
+    goto L175;
+L124: /* LINE */
+    f->line = code + 124;
+    f->lineno = 29;
+L133: /* GET */
+    regs[6] = tp_get(tp, regs[0], regs[4]);
+    tp_grey(tp, regs[6]);
+L134: /* STRING */
+    tp_aot_op(tp, f, code + 134);
+L137: /* EQ */
+    if (TP_BOTH(regs[6], regs[5], TP_NUMBER_INT)) {
+        regs[6] = tp_bool(regs[6].nint == regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 137);
+    }
+L138: /* IF */
+    if (TP_IS_INT(regs[6]) ? regs[6].nint != 0 : tp_true(tp, regs[6])) {
+        goto L140;
+    }
+L139: /* JUMP */
+    goto L162;
+L140: /* LINE */
+    f->line = code + 140;
+    f->lineno = 30;
+L149: /* NUMBER */
+    tp_aot_op(tp, f, code + 149);
+L152: /* ADD */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[4] = tp_int(regs[4].nint + regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 152);
+    }
+L153: /* LINE */
+    f->line = code + 153;
+    f->lineno = 31;
+L161: /* JUMP */
+    goto L175;
+L162: /* LINE */
+    f->line = code + 162;
+    f->lineno = 32;
+L170: /* NUMBER */
+    tp_aot_op(tp, f, code + 170);
+L173: /* ADD */
+    if (TP_BOTH(regs[4], regs[5], TP_NUMBER_INT)) {
+        regs[4] = tp_int(regs[4].nint + regs[5].nint);
+    } else {
+        tp_aot_op(tp, f, code + 173);
+    }
+L174: /* JUMP */
+    tp_aot_safepoint(tp, 53);
+    goto L121;
+L175: /* LINE */
+    f->line = code + 175;
+    f->lineno = 34;
+L184: /* VAR */
+L187: /* NUMBER */
+    tp_aot_op(tp, f, code + 187);
+L190: /* ADD */
+    if (TP_BOTH(regs[3], regs[9], TP_NUMBER_INT)) {
+        regs[7] = tp_int(regs[3].nint + regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 190);
+    }
+L191: /* NUMBER */
+    tp_aot_op(tp, f, code + 191);
+L194: /* SUB */
+    if (TP_BOTH(regs[4], regs[9], TP_NUMBER_INT)) {
+        regs[8] = tp_int(regs[4].nint - regs[9].nint);
+    } else {
+        tp_aot_op(tp, f, code + 194);
+    }
+L195: /* LIST */
+    tp_aot_op(tp, f, code + 195);
+L196: /* GET */
+    regs[6] = tp_get(tp, regs[0], regs[6]);
+    tp_grey(tp, regs[6]);
+L197: /* LINE */
+    f->line = code + 197;
+    f->lineno = 36;
+L216: /* VAR */
+L218: /* GET */
+    regs[5] = tp_get(tp, regs[1], regs[6]);
+    tp_grey(tp, regs[5]);
+L219: /* LINE */
+    f->line = code + 219;
+    f->lineno = 39;
+L228: /* STRING */
+    tp_aot_op(tp, f, code + 228);
+L232: /* METHOD */
+    tp_aot_op(tp, f, code + 232);
+L234: /* GGET */
+    tp_aot_op(tp, f, code + 234);
+L237: /* MOVE */
+    regs[11] = regs[5];
+L238: /* CALLP */
+    return code + 238;
+L239: /* CALLM */
+    return code + 239;
+L240: /* LINE */
+    f->line = code + 240;
+    f->lineno = 40;
+L247: /* NUMBER */
+    tp_aot_op(tp, f, code + 247);
+L250: /* SUB */
+    if (TP_BOTH(regs[4], regs[7], TP_NUMBER_INT)) {
+        regs[3] = tp_int(regs[4].nint - regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 250);
+    }
+L251: /* LINE */
+    f->line = code + 251;
+    f->lineno = 41;
+L257: /* NUMBER */
+    tp_aot_op(tp, f, code + 257);
+L260: /* ADD */
+    if (TP_BOTH(regs[3], regs[7], TP_NUMBER_INT)) {
+        regs[3] = tp_int(regs[3].nint + regs[7].nint);
+    } else {
+        tp_aot_op(tp, f, code + 260);
+    }
+L261: /* JUMP */
+    tp_aot_safepoint(tp, 192);
+    goto L69;
+L262: /* LINE */
+    f->line = code + 262;
+    f->lineno = 42;
+L269: /* STRING */
+    tp_aot_op(tp, f, code + 269);
+L273: /* METHOD */
+    tp_aot_op(tp, f, code + 273);
+L275: /* MOVE */
+    regs[11] = regs[4];
+L276: /* MOVE */
+    regs[12] = regs[3];
+L277: /* LIST */
+    tp_aot_op(tp, f, code + 277);
+L278: /* GET */
+    regs[9] = tp_get(tp, regs[0], regs[10]);
+    tp_grey(tp, regs[9]);
+L279: /* CALLM */
+    return code + 279;
+L280: /* LINE */
+    f->line = code + 280;
+    f->lineno = 43;
+L287: /* STRING */
+    tp_aot_op(tp, f, code + 287);
+L290: /* STRING */
+    tp_aot_op(tp, f, code + 290);
+L294: /* METHOD */
+    tp_aot_op(tp, f, code + 294);
+L296: /* MOVE */
+    regs[9] = regs[2];
+L297: /* CALLM */
+    return code + 297;
+L298: /* RETURN */
+    return code + 298;
+L299: /* EOF */
+    return code + 299;
+}
+
+static tpd_code * _tp_tinypy_runtime_types_140(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 11: goto L11;
+        case 14: goto L14;
+        case 17: goto L17;
+        case 25: goto L25;
+        case 26: goto L26;
+        case 31: goto L31;
+        case 32: goto L32;
+        case 40: goto L40;
+        case 44: goto L44;
+        case 45: goto L45;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 6;
+L11: /* VAR */
+L14: /* VAR */
+L17: /* STRING */
+    tp_aot_op(tp, f, code + 17);
+L25: /* FILE */
+    f->fname = regs[2];
+L26: /* STRING */
+    tp_aot_op(tp, f, code + 26);
+L31: /* NAME */
+    f->name = regs[2];
+L32: /* LINE */
+    f->line = code + 32;
+    f->lineno = 7;
+L40: /* STRING */
+    tp_aot_op(tp, f, code + 40);
+L44: /* SET */
+    tp_set(tp, regs[0], regs[2], regs[1]);
+L45: /* EOF */
+    return code + 45;
+}
+
+static tpd_code * _tp_tinypy_runtime_types_209(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code * code = (tpd_code *) tp_string_getptr(f->code);
+    tp_obj * regs = f->regs;
+    switch (cur - code) {
+        case 2: goto L2;
+        case 9: goto L9;
+        case 12: goto L12;
+        case 20: goto L20;
+        case 21: goto L21;
+        case 26: goto L26;
+        case 27: goto L27;
+        case 36: goto L36;
+        case 39: goto L39;
+        case 43: goto L43;
+        case 45: goto L45;
+        case 46: goto L46;
+        case 47: goto L47;
+    }
+    return cur;
+L2: /* LINE */
+    f->line = code + 2;
+    f->lineno = 8;
+L9: /* VAR */
+L12: /* STRING */
+    tp_aot_op(tp, f, code + 12);
+L20: /* FILE */
+    f->fname = regs[1];
+L21: /* STRING */
+    tp_aot_op(tp, f, code + 21);
+L26: /* NAME */
+    f->name = regs[1];
+L27: /* LINE */
+    f->line = code + 27;
+    f->lineno = 9;
+L36: /* GGET */
+    tp_aot_op(tp, f, code + 36);
+L39: /* STRING */
+    tp_aot_op(tp, f, code + 39);
+L43: /* MGET */
+    tp_aot_op(tp, f, code + 43);
+L45: /* CALLP */
+    return code + 45;
+L46: /* RETURN */
+    return code + 46;
+L47: /* EOF */
+    return code + 47;
+}
+
+static const tpd_aot _tp_tinypy_runtime_types_aot[] = {
+    {0, _tp_tinypy_runtime_types_0},
+    {109, _tp_tinypy_runtime_types_109},
+    {324, _tp_tinypy_runtime_types_324},
+    {375, _tp_tinypy_runtime_types_375},
+    {484, _tp_tinypy_runtime_types_484},
+    {140, _tp_tinypy_runtime_types_140},
+    {209, _tp_tinypy_runtime_types_209},
+};
+
+void tinypy_runtime_types_init(TP) {
+    tp_aot_import(tp, "tinypy.runtime.types", _tp_tinypy_runtime_types_tpc, sizeof(_tp_tinypy_runtime_types_tpc),
+        _tp_tinypy_runtime_types_aot, 7);
+}
@@ -5,6 +5,7 @@ tp_obj tp_None = {TP_NONE};
 tp_obj tp_True = {.type = {TP_NUMBER, TP_NUMBER_INT}, .nint = 1};
 tp_obj tp_False = {.type = {TP_NUMBER, TP_NUMBER_INT}, .nint = 0};
 
+#include "tp_slab.c"
 #include "tpd_list.c"
 #include "tpd_dict.c"
 
@@ -15,6 +16,7 @@ tp_obj tp_False = {.type = {TP_NUMBER, TP_NUMBER_INT}, .nint = 0};
 #include "tp_hash.c"
 #include "tp_number.c"
 #include "tp_list.c"
+#include "tp_range.c"
 #include "tp_dict.c"
 #include "tp_string.c"
 
@@ -30,6 +32,14 @@ tp_obj tp_False = {.type = {TP_NUMBER, TP_NUMBER_INT}, .nint = 0};
 #include "tpy_list.c"
 
 #include "tp_vm.c"
+#include "tp_verify.c"
+#include "tp_quicken.c"
+#include "tp_aot.c"
+#ifdef TP_JIT
+#include "tp_jit.c"
+#endif
+#include "tp_profile.c"
+#include "tp_sample.c"
 
 /* FIXME: after string / dict gets a meta, register these methods
  * to the meta in tpy_builtin
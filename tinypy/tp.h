@@ -15,6 +15,8 @@
 #include <stdarg.h>
 #include <math.h>
 #include <time.h>
+#include <limits.h>
+#include <signal.h>
 
 #ifdef __GNUC__
 #define tp_inline __inline__
@@ -37,6 +39,13 @@
 #error "Unsuported compiler"
 #endif
 
+/* tp_step uses the threaded (computed goto) dispatch engine if the compiler
+ * supports labels as values. Define TP_DISPATCH_SWITCH to build the portable
+ * switch engine instead. */
+#if defined(__GNUC__) && !defined(TP_DISPATCH_SWITCH)
+#define TP_DISPATCH_THREADED
+#endif
+
 /*  #define tp_malloc(x) calloc((x),1)
     #define tp_realloc(x,y) realloc(x,y)
     #define tp_free(x) free(x) */
@@ -56,7 +65,7 @@ enum TP_PACKED TPTypeID {
     TP_GC_TRACKED = 9,
     TP_FUNC = 10,
     TP_DATA = 11,
-    TP_FRAME = 12,
+    TP_RANGE = 12,
 
     TP_STRING = 100,
     TP_DICT = 101,
@@ -90,12 +99,12 @@ typedef struct TPTypeInfo {
     enum TPTypeMask mask;
 } TPTypeInfo;
 
-typedef union {
-    struct {
-        unsigned int grey : 1;
-        unsigned int black : 1;
-    };
-    int i;
+/* the gc's part of every object header; see tp_gc.c */
+typedef struct TPGCMask {
+    unsigned int grey : 1;
+    unsigned int black : 1;
+    unsigned int young : 1; /* in tp->young */
+    TPTypeInfo type; /* as tracked; the gc's lists hold headers only */
     } TPGCMask;
 
 /* Type: tp_obj
@@ -139,11 +148,19 @@ typedef struct tpd_obj {
 } tpd_obj;
 #define TPD_OBJ(v) ((tpd_obj*) (v).info)
 
+/* a list of tracked objects, by header; see tp_gc.c */
+typedef struct tpd_gc_list {
+    tpd_obj ** items;
+    int len;
+    int alloc;
+} tpd_gc_list;
+
 typedef struct tpd_string {
     TPGCMask gci;
     tp_obj base;
-    char * s;
+    char * s; /* for most normal strings, right after the header */
     int len;
+    int verified; /* code that tp_verify has passed */
 } tpd_string;
 #define TPD_STRING(v) ((tpd_string*) (v).info)
 
@@ -155,6 +172,14 @@ typedef struct tpd_list {
 } tpd_list;
 #define TPD_LIST(v) ((tpd_list*) (v).info)
 
+typedef struct tpd_range {
+    TPGCMask gci;
+    long start;
+    long stop;
+    long step;
+} tpd_range;
+#define TPD_RANGE(v) ((tpd_range*) (v).info)
+
 typedef struct tpd_item {
     int used;
     int hash;
@@ -171,6 +196,7 @@ typedef struct tpd_dict {
     int cur;
     int mask;
     int used;
+    unsigned long version; /* unique to this dict and its content, see tpd_dict_touch */
 } tpd_dict;
 #define TPD_DICT(v) ((tpd_dict*) (v).info)
 
@@ -179,6 +205,7 @@ typedef struct tpd_func {
     tp_obj instance;
     tp_obj globals;
     tp_obj code;
+    tp_obj consts; /* decoded literals of code, shared by bound copies */
     tp_obj args;
     tp_obj defaults;
     tp_obj varargs;
@@ -192,30 +219,74 @@ typedef union tpd_code {
     struct { char val[0]; } string;
 } tpd_code;
 
+struct tpd_frame;
+/* the C function tpc -a writes for a body: runs frame f from cur on, and
+ * returns the instruction tp_step goes on from; see tp_aot.c. */
+typedef tpd_code * (*tp_aot_fn)(tp_vm *, struct tpd_frame *, tpd_code *);
+
+/* a body of a module compiled to C, by the word of its REGS. */
+typedef struct tpd_aot {
+    int start;
+    tp_aot_fn fn;
+} tpd_aot;
+
+/* inline cache of a GGET instruction; valid while both dicts still
+ * carry the versions it was filled at. */
+typedef struct tpd_gcache {
+    unsigned long globals;
+    unsigned long builtins;
+    tp_obj val;
+} tpd_gcache;
+
+/* inline cache of an MGET instruction. Each way remembers a class, the
+ * attribute found depth levels up its meta chain, and the dict version
+ * counter at the time; it is valid while no dict on the way up to the
+ * attribute has been touched since. */
+#define TP_MCACHE_WAYS 4
+typedef struct tpd_mcache {
+    int state; /* 0: new; 1: hash is set; -1: not cached */
+    int hash;
+    int next; /* way to replace on the next miss */
+    struct {
+        tpd_dict * meta;
+        unsigned long version;
+        int depth;
+        tp_obj val;
+    } ways[TP_MCACHE_WAYS];
+} tpd_mcache;
+
+/* frames live in tp->frames and are not gc objects; the gc greys what
+ * the active ones refer to at the start of every cycle. */
 typedef struct tpd_frame {
-/*    tpd_code *codes; */
-    TPGCMask gci;
     tp_obj code;
+    tp_obj consts; /* list of decoded NUMBER and STRING literals */
+    tpd_gcache *gcache; /* GGET caches, by constant slot of the name */
+    tpd_mcache *mcache; /* MGET caches, by site */
     tpd_code *cur;
     tpd_code *jmp;
     tp_obj *regs;  /* regs is allocated after an IREG byte-code.*/
     tp_obj *ret_dest;
     tp_obj fname;
     tp_obj name;
-    tp_obj line;
+    tpd_code *line; /* LINE instruction of the current line; the text follows it */
     tp_obj globals;
     tp_obj lparams;
     tp_obj dparams;
     tp_obj args;
     tp_obj defaults;
+    tp_obj *argv; /* positional arguments in the caller registers, see tp_enter_call_regs */
+    tp_obj *argself; /* the instance of a bound method, which goes before argv */
+    int argc;
     int lineno;
     int cregs;
+    struct tpd_jit * jit; /* native code of code, see tp_jit.c */
+    tp_aot_fn aot; /* the C of code, see tp_aot.c */
 } tpd_frame;
-#define TPD_FRAME(v) ((tpd_frame*) (v).info)
 
 typedef struct tpd_data {
     TPGCMask gci;
     void (*free)(TP,tp_obj);
+    void * val; /* as given to tp_data_t, for free */
 } tpd_data;
 #define TPD_DATA(v) ((tpd_data*) v.info)
 
@@ -238,7 +309,7 @@ typedef struct tpd_data {
  * builtins - A dictionary containing all builtin objects.
  * modules - A dictionary with all loaded modules.
  * params - A list of parameters for the current function call.
- * frames - A list of all call frames. list frame is the current frame.
+ * frames - The pool of call frames. frames[nframes - 1] is the current frame.
  * frames[n].globals - A dictionary of global sybmols in callframe n.
  */
 typedef struct tp_vm {
@@ -255,36 +326,67 @@ typedef struct tp_vm {
     tpd_list * stack;
 
     /* call */
-    tpd_list * frames;
+    tpd_frame frames[TP_FRAMES];
+    int nframes;
     tp_obj * lparams;
     tp_obj * dparams;
     tp_obj * last_result;
 
     /* exception */
-    jmp_buf buf;
+    jmp_buf * buf; /* handler of the innermost C level entry into the VM */
 #ifdef CPYTHON_MOD
     jmp_buf nextexpr;
 #endif
-    int jmp;
+    int jmp; /* number of C level entries into the VM */
+    int jmp_base; /* first frame of the innermost entry */
     tp_obj * exc;
     tp_obj * exc_stack;
 
     /* gc */
-    int gcmax;
+    double gcgrowth;
+    unsigned long gc_allocated; /* bytes allocated since the last cycle, minor or major */
+    unsigned long gc_nursery; /* run a minor cycle once gc_allocated reaches this */
+    unsigned long gc_threshold; /* run a major cycle once gc_promoted reaches this */
+    unsigned long gc_promoted; /* bytes promoted since the last major cycle */
+    unsigned long gc_live; /* bytes that survived the last major cycle */
+    unsigned long gc_tracked; /* objects handed to the gc so far */
+    unsigned long gc_born; /* objects put in the young generation so far */
+    unsigned long gc_held; /* gc_born on entering the innermost tp_continue_frame */
+    unsigned long dict_version; /* last version handed to a dict */
     tp_obj root;
-    tpd_list *white;
-    tpd_list *grey;
-    tpd_list *black;
-    int steps;
+    tpd_gc_list old; /* the old generation */
+    tpd_gc_list grey;
+    tpd_gc_list young; /* the young generation, in the order it was tracked */
+    tpd_gc_list remembered; /* young objects stored in old ones */
+    int steps; /* number of major gc cycles */
+    int minor_steps; /* number of minor gc cycles */
     /* cached objects */
     tp_obj chars[256];
-    /* sandbox */
-    clock_t clocks;
-    double time_elapsed;
-    double time_limit;
-    unsigned long mem_limit;
+    /* sandbox, see interp/sandbox.c */
+    double time_limit; /* milliseconds */
+    unsigned long mem_limit; /* bytes */
     unsigned long mem_used;
-    int mem_exceeded;
+    long insn_limit;
+    long insn_left; /* instructions left; charged at back-edges and calls */
+    volatile sig_atomic_t interrupt; /* call tp_interrupt at the next safepoint */
+    volatile sig_atomic_t timed_out;
+    /* profiler, see tp_profile.c */
+    struct tpd_profile * profile;
+    int profiling;
+    /* quickening, see tp_quicken.c */
+    int quickening;
+    unsigned long quickened[256]; /* sites rewritten to each opcode */
+    unsigned long quick_failed[256]; /* and those that failed its guard */
+    /* baseline JIT, see tp_jit.c */
+    int jit_mode;
+    struct tpd_jits * jits;
+    /* bodies compiled to C, see tp_aot.c */
+    struct tpd_aot_body * aot;
+    struct tpd_slab * slab; /* see tp_slab.c */
+    int naot;
+    /* sampling profiler, see tp_sample.c */
+    tp_obj samples; /* collapsed stack: ticks */
+    volatile sig_atomic_t sample_ticks; /* ticks since the last sample */
 
     void (*echo)(const char* data, int length);
 } tp_vm;
@@ -295,17 +397,59 @@ void *tp_malloc(TP, unsigned long);
 void *tp_realloc(TP, void *, unsigned long);
 void tp_free(TP, void *);
 #else
-#define tp_malloc(TP,x) calloc((x),1)
-#define tp_realloc(TP,x,y) realloc(x,y)
+/* allocations are counted to pace the gc, see tp_gc_safepoint. */
+#define tp_malloc(TP,x) ((TP)->gc_allocated += (x), calloc((x),1))
+#define tp_realloc(TP,x,y) ((TP)->gc_allocated += (y), realloc(x,y))
 #define tp_free(TP,x) free(x)
 #endif
 
-void tp_sandbox(TP, double, unsigned long);
-void tp_time_update(TP);
-void tp_mem_update(TP);
+void * tp_slab_alloc(TP, unsigned long);
+void tp_slab_free(TP, void *, unsigned long);
+void tp_slab_init(TP);
+void tp_slab_deinit(TP);
+tp_obj tp_slab_table(TP);
+
+void tp_sandbox(TP, double, unsigned long, long);
+void tp_sandbox_check(TP);
+
+void tp_verify(TP, tp_obj);
+
+int tp_quicken_base(int);
+void tp_quicken(TP, union tpd_code *, tp_obj *);
+tp_obj tp_quicken_table(TP);
+
+tp_obj tp_aot_import(TP, const char * name, void * codes, int len, const tpd_aot * bodies, int n);
+tp_aot_fn tp_aot_get(TP, tp_obj);
+void tp_aot_op(TP, tpd_frame *, union tpd_code *);
+void tp_aot_safepoint(TP, int);
+void tp_aot_deinit(TP);
+
+#ifdef TP_JIT
+struct tpd_jit * tp_jit_get(TP, tp_obj);
+union tpd_code * tp_jit_enter(TP, tpd_frame *, union tpd_code *, int);
+void tp_jit_forget(TP, tp_obj);
+void tp_jit_deinit(TP);
+#endif
+
+void tp_profile_set(TP, int);
+void tp_profile_op(TP, union tpd_code *);
+tp_obj tp_profile_table(TP);
+tp_obj tp_profile_sites(TP, tp_obj);
+
+void tp_interrupt(TP);
+void tp_sample_start(TP, double);
+void tp_sample_stop(TP);
+void tp_sample(TP);
+tp_obj tp_sample_collapsed(TP);
 
 tp_obj tp_track(TP, tp_obj);
 void   tp_grey(TP,tp_obj);
+void   tp_gc_remember(TP, tp_obj);
+
+/* Macro: TP_GC_WRITE
+ * The write barrier: v was stored in the object whose gc mask is owner.
+ * Only a store into the old generation needs telling; see tp_gc.c. */
+#define TP_GC_WRITE(TP, owner, v) { if (!(owner)->young) { tp_gc_remember(TP, v); } }
 
 /* __func__ __VA_ARGS__ __FILE__ __LINE__ */
 
@@ -339,7 +483,9 @@ void   _tp_raise(TP,tp_obj);
  * manages storage for you.
  */
 tp_obj tp_string_atom(TP, const char * v);
-#define tp_string_equal_atom(a, cstr) (0 == tp_string_cmp_const((a), (cstr), sizeof(cstr) - 1))
+/* a may be any object; only a string can be equal. */
+#define tp_string_equal_atom(a, cstr) ((a).type.typeid == TP_STRING \
+    && 0 == tp_string_cmp_const((a), (cstr), sizeof(cstr) - 1))
 tp_inline static
 tp_obj tp_string_from_const(TP, char const * v, int n);
 
@@ -425,6 +571,7 @@ tp_obj tp_compile(TP, tp_obj text, tp_obj fname);
 tp_obj tp_data_t(TP, int magic, void *v);
 tp_obj tp_list_t(TP);
 tp_obj tp_list_nt(TP);
+tp_obj tp_range(TP, long start, long stop, long step);
 tp_obj tp_dict_t(TP);
 tp_obj tp_dict_nt(TP);
 tp_obj tp_object(TP);
@@ -0,0 +1,145 @@
+/* File: AOT
+ * Runs modules that tpc -a compiled to C.
+ *
+ * tpc -a writes a module as C: its bytecode, as tpc -c does, and a C
+ * function for every body in it -- the module's and each function's --
+ * with a block of statements per instruction, in the order of the
+ * bytecode, and gotos for the jumps. MOVE, NONE, the tests, FOR over a
+ * counter and the arithmetic and comparisons of two ints are done inline;
+ * the rest call the tp_* functions of the runtime, or tp_aot_op for the
+ * instructions that need the state of the VM. The init function of the
+ * module hands the functions and the bytecode to tp_aot_import.
+ *
+ * The bytecode is still what the VM knows the module by: it is verified
+ * and imported as any other, its frames are VM frames and its functions VM
+ * functions, so compiled and interpreted code call each other and share
+ * classes freely. When REGS sets up a frame whose body has a C function,
+ * tp_step calls it; the function runs up to a call, a return, RAISE or
+ * the EOF and returns that instruction to tp_step, which runs it and calls
+ * the function again on its next step of the frame -- after the call
+ * returns, or at the handler of an exception. LINE sets the line of the
+ * frame as tp_step does, so tracebacks read the same.
+ *
+ * The C keeps no values of its own: everything is in the registers of the
+ * frame, so the gc sees all of it, and an exception unwinds it by longjmp
+ * as it does tp_step. The JIT runs the same helpers; see tp_jit.c.
+ */
+
+typedef struct tpd_aot_body {
+    tpd_code * code; /* the REGS of the body */
+    tp_aot_fn fn;
+} tpd_aot_body;
+
+/* the first body in tp->aot, which is sorted, at or after code. */
+static int tpd_aot_find(TP, tpd_code * code) {
+    int lo = 0, hi = tp->naot;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (tp->aot[mid].code < code) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/* Function: tp_aot_import
+ * Imports the module name from the bytecode codes, len bytes, with the n
+ * bodies that were compiled to C; the init function tpc -a writes calls
+ * it.
+ */
+tp_obj tp_aot_import(TP, const char * name, void * codes, int len, const tpd_aot * bodies, int n) {
+    int i, k;
+    tp->aot = (tpd_aot_body *) tp_realloc(tp, tp->aot, (tp->naot + n) * sizeof(tpd_aot_body));
+    for (i = 0; i < n; i++) {
+        tpd_code * code = (tpd_code *) codes + bodies[i].start;
+        k = tpd_aot_find(tp, code);
+        if (k == tp->naot || tp->aot[k].code != code) {
+            memmove(&tp->aot[k + 1], &tp->aot[k], (tp->naot - k) * sizeof(tpd_aot_body));
+            tp->aot[k].code = code;
+            tp->naot++;
+        }
+        tp->aot[k].fn = bodies[i].fn;
+    }
+    return tp_import_from_buffer(tp, 0, name, codes, len);
+}
+
+/* Function: tp_aot_get
+ * The C function of the body code, or NULL; REGS calls it.
+ */
+tp_aot_fn tp_aot_get(TP, tp_obj code) {
+    tpd_code * start = (tpd_code *) tp_string_getptr(code);
+    int k = tpd_aot_find(tp, start);
+    return k < tp->naot && tp->aot[k].code == start ? tp->aot[k].fn : NULL;
+}
+
+void tp_aot_deinit(TP) {
+    tp_free(tp, tp->aot);
+    tp->aot = NULL;
+    tp->naot = 0;
+}
+
+/* The helpers compiled code calls. */
+
+/* Function: tp_aot_op
+ * Runs the instruction at cur of frame f as tp_step would; the caller goes
+ * on to the next one.
+ */
+void tp_aot_op(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code e = *cur;
+    switch (tp_quicken_base(e.i)) {
+        case TP_IADD: TP_ARITH(+, tp_add); break;
+        case TP_ISUB: TP_ARITH(-, tp_sub); break;
+        case TP_IMUL: TP_ARITH(*, tp_mul); break;
+        case TP_IDIV: RA = tp_div(tp,RB,RC); break;
+        case TP_IPOW: RA = tp_pow(tp,RB,RC); break;
+        case TP_IBITAND: RA = tp_bitwise_and(tp,RB,RC); break;
+        case TP_IBITOR: RA = tp_bitwise_or(tp,RB,RC); break;
+        case TP_IBITXOR: RA = tp_bitwise_xor(tp,RB,RC); break;
+        case TP_IMOD: RA = tp_mod(tp,RB,RC); break;
+        case TP_ILSH: RA = tp_lsh(tp,RB,RC); break;
+        case TP_IRSH: RA = tp_rsh(tp,RB,RC); break;
+        case TP_INE: TP_COMPARE(!=, !tp_equal(tp, b, c)); break;
+        case TP_IEQ: TP_COMPARE(==, tp_equal(tp, b, c)); break;
+        case TP_ILE: TP_COMPARE(<=, tp_cmp(tp, b, c) <= 0); break;
+        case TP_ILT: TP_COMPARE(<, tp_cmp(tp, b, c) < 0); break;
+        case TP_IGE: TP_COMPARE(>=, tp_cmp(tp, c, b) <= 0); break;
+        case TP_IGT: TP_COMPARE(>, tp_cmp(tp, c, b) < 0); break;
+        case TP_IBITNOT: RA = tp_bitwise_not(tp,RB); break;
+        case TP_INOT: RA = tp_bool(!tp_true(tp,RB)); break;
+        case TP_IGET: RA = tp_get(tp,RB,RC); GA; break;
+        case TP_IMGET:
+            RA = tp_mget_cached(tp,RB,RC,&f->mcache[((cur+1)->regs.b << 8) + (cur+1)->regs.c]); GA;
+            break;
+        case TP_IMETHOD: tpd_frame_method(tp, f, cur); break;
+        case TP_IGGET: tpd_frame_gget(tp, f, cur); break;
+        case TP_IGSET: tp_set(tp,f->globals,RA,RB); break;
+        case TP_ISET: tp_set(tp,RA,RB,RC); break;
+        case TP_IIN: RA = tp_has(tp,RC,RB); break;
+        case TP_INOTIN: RA = tp_bool(!tp_true(tp, tp_has(tp,RC,RB))); break;
+        case TP_IIGET: tp_iget(tp,&RA,RB,RC); break;
+        case TP_IDEL: tp_del(tp,RA,RB); break;
+        case TP_IUPDATE:
+            tp_dict_update(tp, tp_check_type(tp, TP_DICT, RA), tp_check_type(tp, TP_DICT, RB));
+            break;
+        case TP_INUMBER: case TP_ISTRING: RA = TP_CONST(); break;
+        case TP_IDICT: RA = tp_dict_from_items(tp, VC/2, &RB); break;
+        case TP_ICLASS: RA = tp_class(tp); break;
+        case TP_ILIST: RA = tp_list_from_items(tp, VC, &RB); break;
+        case TP_ILEN: RA = tp_len(tp,RB); break;
+        case TP_IRANGE: tpd_frame_range(tp, f, e); break;
+        case TP_IDEF: tpd_frame_def(tp, f, cur); break;
+        case TP_ISETJMP: f->jmp = SVBC?cur+SVBC:0; break;
+        case TP_IASSERT: tp_assert(tp, RA, RB, RC); break;
+        case TP_IFILE: f->fname = RA; break;
+        case TP_INAME: f->name = RA; break;
+    }
+}
+
+/* Function: tp_aot_safepoint
+ * A loop back-edge of n words; see TP_SAFEPOINT.
+ */
+void tp_aot_safepoint(TP, int n) {
+    TP_SAFEPOINT(n);
+}
@@ -31,7 +31,8 @@
  */
 tp_obj tp_data_t(TP, int magic, void *v) {
     tp_obj r = {TP_DATA};
-    r.info = (tpd_data*)tp_malloc(tp, sizeof(tpd_data));
+    r.info = (tpd_data*)tp_slab_alloc(tp, sizeof(tpd_data));
+    TPD_DATA(r)->val = v;
     r.ptr = v;
     r.type.magic = magic;
     return tp_track(tp,r);
@@ -89,8 +89,8 @@ void tp_dict_del(TP, tp_obj self, tp_obj k) {
 
 void tp_dict_set(TP, tp_obj self, tp_obj k, tp_obj v) {
     tpd_dict_hashsetx(tp, TPD_DICT(self), tp_hash(tp, k), k, v);
-    tp_grey(tp, k);
-    tp_grey(tp, v);
+    TP_GC_WRITE(tp, &TPD_DICT(self)->gci, k);
+    TP_GC_WRITE(tp, &TPD_DICT(self)->gci, v);
 }
 
 tp_obj tp_dict_copy(TP, tp_obj rr) {
@@ -101,6 +101,7 @@ tp_obj tp_dict_copy(TP, tp_obj rr) {
     *r = *o;
     r->items = (tpd_item*) tp_malloc(tp, sizeof(tpd_item)*o->alloc);
     memcpy(r->items, o->items, sizeof(tpd_item)*o->alloc);
+    tpd_dict_touch(tp, r);
     return tp_track(tp, obj);
 }
 
@@ -1,12 +1,17 @@
-tp_obj tp_frame_t(TP, tp_obj lparams, tp_obj dparams,
-        tp_obj globals, tp_obj code,
+/* Function: tpd_frame_init
+ * Sets up a frame of the frame pool to run code.
+ *
+ * Frames are recycled, so every field is reset here.
+ */
+void tpd_frame_init(TP, tpd_frame * f, tp_obj lparams, tp_obj dparams,
+        tp_obj globals, tp_obj code, tp_obj consts,
         tp_obj args, tp_obj defaults, tp_obj * ret_dest) {
-    tp_obj r = {TP_FRAME};
-    r.info = tp_malloc(tp, sizeof(tpd_frame));
-    tpd_frame * f = TPD_FRAME(r);
-
     f->globals = globals;
     f->code = code;
+    /* module code runs once, so its literals get a pool of their own. */
+    f->consts = tp_none(consts)?tp_list_t(tp):consts;
+    f->gcache = NULL;
+    f->mcache = NULL;
     f->cur = (tpd_code*) tp_string_getptr(f->code);
     f->jmp = 0;
     f->ret_dest = ret_dest;
@@ -15,15 +20,20 @@ tp_obj tp_frame_t(TP, tp_obj lparams, tp_obj dparams,
     f->dparams = dparams;
     f->args = args;
     f->defaults = defaults;
-    f->line = tp->chars['?'];
+    f->argv = NULL;
+    f->argself = NULL;
+    f->argc = 0;
+    f->line = NULL;
     f->name = tp->chars['?'];
     f->fname = tp->chars['?'];
+    f->regs = NULL;
     f->cregs = 0;
-    return tp_track(tp, r);
+    f->jit = NULL;
+    f->aot = NULL;
 }
 
 void tpd_frame_alloc(TP, tpd_frame * f, tp_obj * regs, int cregs) {
-    /*  call convention requires 1 reg for __params__.*/
+    /* the arguments, then varargs and varkw. */
     f->regs = regs;
 
     int nargs = tp_none(f->args)?0:TPD_LIST(f->args)->len;
@@ -33,6 +43,29 @@ void tpd_frame_alloc(TP, tpd_frame * f, tp_obj * regs, int cregs) {
     tp_obj * defaults = tp_none(f->defaults)?NULL:TPD_LIST(f->defaults)->items;
     int i;
     int nrequired = nargs - ndefaults;
+
+    if(cregs < nargs + 2) {
+        tp_raise(, tp_string_atom(tp, "(tpd_frame_alloc) RuntimeError: too few registers for the arguments"));
+    }
+    if (f->argv) {
+        /* from tp_enter_call_regs, which checked the argument count. */
+        int k = 0;
+        if (f->argself) {
+            f->regs[k++] = *f->argself;
+        }
+        for(i = 0; i < f->argc; i ++) {
+            f->regs[k++] = f->argv[i];
+        }
+        for(; k < nargs; k ++) {
+            f->regs[k] = defaults[k - nrequired];
+        }
+        f->regs[nargs] = tp_None;
+        f->regs[nargs + 1] = tp_None;
+        f->argv = NULL;
+        f->argself = NULL;
+        f->cregs = cregs;
+        return;
+    }
     int nlparams = tp_none(f->lparams)?0:TPD_LIST(f->lparams)->len;
 
     tp_obj varkw = tp_none(f->dparams)?tp_dict_t(tp):tp_dict_copy(tp, f->dparams);
@@ -63,9 +96,6 @@ void tpd_frame_alloc(TP, tpd_frame * f, tp_obj * regs, int cregs) {
 
     f->regs[nargs + 1] = varkw;
 
-    if(cregs < nargs + 1) {
-        abort();
-    }
     #if 0
     printf("nargs = %d f->args = %s\n", nargs, tp_cstr(tp, tp_str(tp, f->args)));
     for(i = 0; i < cregs; i ++) {
@@ -3,7 +3,7 @@ tp_obj tp_call_extern(TP, tp_obj func) {
 
 tp_obj tp_func_nt(TP, int t, void *ptr) {
     tp_obj r = {TP_FUNC};
-    tpd_func *info = (tpd_func*)tp_malloc(tp, sizeof(tpd_func));
+    tpd_func *info = (tpd_func*)tp_slab_alloc(tp, sizeof(tpd_func));
     r.type.mask = t;
     r.info = info;
     r.ptr = ptr;
@@ -32,6 +32,15 @@ tp_obj tp_staticmethod(TP, tp_obj function) {
     return tp_track(tp, r);
 }
 
+/* args and defaults of a function are lists or None; calls index them
+ * without looking. */
+static tp_obj tp_func_params(TP, tp_obj v) {
+    if (!tp_none(v) && v.type.typeid != TP_LIST) {
+        tp_raise(tp_None, tp_string_atom(tp, "(tp_func_params) TypeError: expecting a list"));
+    }
+    return v;
+}
+
 tp_obj tp_def(TP, tp_obj code, tp_obj g,
     tp_obj args,
     tp_obj defaults,
@@ -39,10 +48,11 @@ tp_obj tp_def(TP, tp_obj code, tp_obj g,
     tp_obj varkw) {
     tp_obj r = tp_func_t(tp, 0, NULL);
     TPD_FUNC(r)->code = code;
+    TPD_FUNC(r)->consts = tp_list_t(tp);
     TPD_FUNC(r)->globals = g;
     TPD_FUNC(r)->instance = tp_None;
-    TPD_FUNC(r)->args = args;
-    TPD_FUNC(r)->defaults = defaults;
+    TPD_FUNC(r)->args = tp_func_params(tp, args);
+    TPD_FUNC(r)->defaults = tp_func_params(tp, defaults);
     TPD_FUNC(r)->varargs = varargs;
     TPD_FUNC(r)->varkw = varkw;
     return r;
@@ -57,6 +67,7 @@ tp_obj tp_def(TP, tp_obj code, tp_obj g,
 tp_obj tp_function(TP, tp_obj v(TP)) {
     tp_obj r = tp_func_t(tp, 0, v);
     TPD_FUNC(r)->code = tp_None;
+    TPD_FUNC(r)->consts = tp_None;
     TPD_FUNC(r)->globals = tp_None;
     TPD_FUNC(r)->instance = tp_None;
     TPD_FUNC(r)->args = tp_None;
@@ -16,109 +16,231 @@
  * Invariant: No black object reference white objects.
  * Therefore if grey is empty, white objects are all unreachable.
  *
+ * The sets are kept as bits in gci: grey is set once an object is put to
+ * the grey list, black once it is followed. The white ones are those of
+ * tp->old with neither. tp_collect sweeps tp->old in place, deleting the
+ * white objects and clearing the bits of the rest. The lists hold object
+ * headers; gci.type says what they are the header of.
+ *
+ * Generations:
+ *
+ * - Objects start young: tp_track appends them to tp->young. A minor cycle
+ *   runs every gc_nursery bytes allocated; it follows young objects only,
+ *   from the frames, the registers and tp->remembered, deletes the young
+ *   objects it does not reach and promotes the rest to tp->old, the old
+ *   generation. Most objects die young and never see a major cycle.
+ *
+ * - Objects cannot move -- a tp_obj is a raw pointer, and C code holds
+ *   them -- so the nursery is a list of the young objects, not a region,
+ *   and promotion only flips gci.young.
+ *
+ * - A minor cycle does not look inside old objects, so a young object
+ *   stored in one must be remembered: every store into a list, a dict, a
+ *   meta or a function goes through TP_GC_WRITE.
+ *
+ * - C code below the innermost tp_continue_frame may hold young objects
+ *   in locals; those tracked before it was entered are roots too.
+ *
+ * - The major cycle, tp_gc_run, marks and collects both generations. It
+ *   runs once the bytes promoted since the last one reach gc_threshold.
+ *
  **/
 
 #define TP_GC_TRACE 0
-#define TP_GC_ASSERT_LISTS_ARE_DISJOINT 0    /* Assert no white object is on the black list. Very slow. */
+#define TP_GC_MIN_THRESHOLD (256 * 1024) /* bytes to promote before the first major cycle. */
+#define TP_GC_NURSERY (256 * 1024) /* bytes to allocate between minor cycles. */
+
+/* append o to l. */
+static void tp_gc_append(TP, tpd_gc_list * l, tpd_obj * o) {
+    if (l->len == l->alloc) {
+        l->alloc = l->alloc ? l->alloc * 2 : 256;
+        l->items = (tpd_obj **) tp_realloc(tp, l->items, l->alloc * sizeof(tpd_obj *));
+    }
+    l->items[l->len++] = o;
+}
+
+/* size tp->old for its objects and for as many more as the next major
+ * cycle may promote: gc_threshold bytes, and one nursery over, of the
+ * smallest object tp_gc_sizeof counts, an empty list; so that no minor
+ * cycle until then grows it. */
+static void tp_gc_reserve(TP) {
+    tpd_gc_list * old = &tp->old;
+    int n = old->len + 256 + (tp->gc_threshold + tp->gc_nursery) / sizeof(tpd_list);
+    if (n > old->alloc || n < old->alloc / 4) {
+        old->alloc = n;
+        old->items = (tpd_obj **) tp_realloc(tp, old->items, old->alloc * sizeof(tpd_obj *));
+    }
+}
+
+/* the object of a header on a list. */
+static tp_inline tp_obj tp_gc_obj(tpd_obj * o) {
+    tp_obj v;
+    v.type = o->gci.type;
+    v.info = o;
+    v.ptr = v.type.typeid == TP_DATA ? ((tpd_data*) o)->val : NULL;
+    return v;
+}
 
 /* tp_grey: ensure an object to the grey list, if the object is already
- * marked grey, then do nothing. */
+ * marked grey, then do nothing. Objects that refer to none are black at
+ * once. */
 void tp_grey(TP, tp_obj v) {
     if (v.type.typeid < TP_GC_TRACKED || !TPD_OBJ(v)) { return; }
+    /* the next cycle finds young objects from the roots. */
+    if (TPD_OBJ(v)->gci.young) { return; }
     if (TPD_OBJ(v)->gci.grey) { return; }
     if (v.type.typeid == TP_STRING && v.type.magic == TP_STRING_ATOM) { return; }
     if (v.type.typeid == TP_STRING && v.type.magic == TP_STRING_EXTERN) { return; }
-    int i;
     TPD_OBJ(v)->gci.grey = 1;
     TPD_OBJ(v)->gci.black = 0;
     /* terminal types, no need to follow */
-    if (v.type.typeid == TP_DATA) {
+    if (v.type.typeid == TP_DATA || v.type.typeid == TP_RANGE) {
         TPD_OBJ(v)->gci.black = 1;
         #if TP_GC_TRACE
-        printf("[%04d] adding to black, %p\n", tp->steps, v.info);
+        printf("[%04d] marking black, %p\n", tp->steps, v.info);
         #endif
-        tpd_list_appendx(tp, tp->black, v);
         return;
     }
     if (v.type.typeid == TP_STRING && v.type.magic != TP_STRING_VIEW) {
         TPD_OBJ(v)->gci.black = 1;
         #if TP_GC_TRACE
-        printf("[%04d] adding to black, %p\n", tp->steps, v.info);
+        printf("[%04d] marking black, %p\n", tp->steps, v.info);
         #endif
-        tpd_list_appendx(tp, tp->black, v);
         return;
     }
 
     #if TP_GC_TRACE
     printf("[%04d] adding to grey, %p\n", tp->steps, v.info);
     #endif
-    tpd_list_appendx(tp, tp->grey, v);
+    tp_gc_append(tp, &tp->grey, TPD_OBJ(v));
 }
 
-static void tp_grey_trace(TP, tp_obj p, tp_obj v, char * tag) {
+/* tp_grey_young: tp_grey of a minor cycle; young objects that are not
+ * yet grey go to tp->remembered, which is its grey list. */
+static void tp_grey_young(TP, tp_obj v) {
+    if (v.type.typeid < TP_GC_TRACKED || !TPD_OBJ(v)) { return; }
+    if (!TPD_OBJ(v)->gci.young || TPD_OBJ(v)->gci.grey) { return; }
+    TPD_OBJ(v)->gci.grey = 1;
+    tp_gc_append(tp, &tp->remembered, TPD_OBJ(v));
+}
+
+/* tp_gc_remember: v was stored in an old object; if v is young, the next
+ * minor cycle takes it for a root. See TP_GC_WRITE. */
+void tp_gc_remember(TP, tp_obj v) {
+    tp_grey_young(tp, v);
+}
+
+typedef void (*tp_gc_grey)(TP, tp_obj);
+
+static tp_inline void tp_grey_trace(TP, tp_gc_grey grey, tp_obj p, tp_obj v, char * tag) {
     #if TP_GC_TRACE
     printf("[%04d] follow %p (%d) %s -> %p (%d)\n", tp->steps, p.info, p.type.typeid, tag, v.info, v.type.typeid);
     #endif
-    tp_grey(tp, v);
+    grey(tp, v);
 }
-void tp_follow(TP,tp_obj v) {
+
+/* grey the children of v with grey: tp_grey, or tp_grey_young. */
+static tp_inline void tp_follow_with(TP, tp_obj v, tp_gc_grey grey) {
     int type = v.type.typeid;
     if (type == TP_STRING && v.type.magic == TP_STRING_VIEW) {
-        tp_grey_trace(tp, v, TPD_STRING(v)->base, "base");
+        tp_grey_trace(tp, grey, v, TPD_STRING(v)->base, "base");
     }
     if (type == TP_LIST) {
         int n;
         for (n=0; n<TPD_LIST(v)->len; n++) {
-            tp_grey_trace(tp, v, TPD_LIST(v)->items[n], "item");
+            tp_grey_trace(tp, grey, v, TPD_LIST(v)->items[n], "item");
         }
     }
     if (type == TP_DICT) {
         int i;
         for (i=0; i<TPD_DICT(v)->len; i++) {
             int n = tpd_dict_next(tp,TPD_DICT(v));
-            tp_grey_trace(tp, v, TPD_DICT(v)->items[n].key, "key");
-            tp_grey_trace(tp, v, TPD_DICT(v)->items[n].val, "val");
+            tp_grey_trace(tp, grey, v, TPD_DICT(v)->items[n].key, "key");
+            tp_grey_trace(tp, grey, v, TPD_DICT(v)->items[n].val, "val");
         }
+        /* whether a dict is a class or an object is in the tp_obj, not in
+         * gci.type; the meta is followed either way. */
+        tp_grey_trace(tp, grey, v, TPD_DICT(v)->meta, "meta");
+    } else {
+        tp_grey_trace(tp, grey, v, tp_get_meta(tp, v), "meta");
     }
-    tp_grey_trace(tp, v, tp_get_meta(tp, v), "meta");
 
     if (type == TP_FUNC) {
-        tp_grey_trace(tp, v, TPD_FUNC(v)->instance, "instance");
-        tp_grey_trace(tp, v, TPD_FUNC(v)->globals, "globals");
-        tp_grey_trace(tp, v, TPD_FUNC(v)->code, "code");
-        tp_grey_trace(tp, v, TPD_FUNC(v)->args, "args");
-        tp_grey_trace(tp, v, TPD_FUNC(v)->defaults, "defaults");
-        tp_grey_trace(tp, v, TPD_FUNC(v)->varargs, "varargs");
-        tp_grey_trace(tp, v, TPD_FUNC(v)->varkw, "varkw");
+        tp_grey_trace(tp, grey, v, TPD_FUNC(v)->instance, "instance");
+        tp_grey_trace(tp, grey, v, TPD_FUNC(v)->globals, "globals");
+        tp_grey_trace(tp, grey, v, TPD_FUNC(v)->code, "code");
+        tp_grey_trace(tp, grey, v, TPD_FUNC(v)->consts, "consts");
+        tp_grey_trace(tp, grey, v, TPD_FUNC(v)->args, "args");
+        tp_grey_trace(tp, grey, v, TPD_FUNC(v)->defaults, "defaults");
+        tp_grey_trace(tp, grey, v, TPD_FUNC(v)->varargs, "varargs");
+        tp_grey_trace(tp, grey, v, TPD_FUNC(v)->varkw, "varkw");
     }
-    if (type == TP_FRAME) {
-        int i;
-        for(i = 0; i < TPD_FRAME(v)->cregs; i ++) {
-            tp_grey_trace(tp, v, TPD_FRAME(v)->regs[i], "reg");
-        }
-        tp_grey_trace(tp, v, TPD_FRAME(v)->line, "line");
-        tp_grey_trace(tp, v, TPD_FRAME(v)->name, "name");
-        tp_grey_trace(tp, v, TPD_FRAME(v)->fname, "fname");
-        tp_grey_trace(tp, v, TPD_FRAME(v)->code, "code");
-        tp_grey_trace(tp, v, TPD_FRAME(v)->globals, "globals");
-        tp_grey_trace(tp, v, TPD_FRAME(v)->lparams, "lparams");
-        tp_grey_trace(tp, v, TPD_FRAME(v)->dparams, "dparams");
-        tp_grey_trace(tp, v, TPD_FRAME(v)->args, "args");
-        tp_grey_trace(tp, v, TPD_FRAME(v)->defaults, "defaults");
+}
+
+void tp_follow(TP,tp_obj v) {
+    tp_follow_with(tp, v, tp_grey);
+}
+
+/* frames are not gc objects; grey what the active ones refer to. Their
+ * registers are on tp->stack, which is a root. */
+static void tp_grey_frames(TP, tp_gc_grey grey) {
+    int i;
+    for (i = 0; i < tp->nframes; i++) {
+        tpd_frame * f = &tp->frames[i];
+        grey(tp, f->name);
+        grey(tp, f->fname);
+        grey(tp, f->code);
+        grey(tp, f->consts);
+        grey(tp, f->globals);
+        grey(tp, f->lparams);
+        grey(tp, f->dparams);
+        grey(tp, f->args);
+        grey(tp, f->defaults);
     }
 }
 
 void tp_gc_init(TP) {
     tp->root = tp_list_nt(tp);
-    tp->white = tpd_list_new(tp);
-    tp->grey = tpd_list_new(tp);
-    tp->black = tpd_list_new(tp);
+    memset(&tp->old, 0, sizeof(tpd_gc_list));
+    memset(&tp->grey, 0, sizeof(tpd_gc_list));
+    memset(&tp->young, 0, sizeof(tpd_gc_list));
+    memset(&tp->remembered, 0, sizeof(tpd_gc_list));
     tp->steps = 0;
+    tp->minor_steps = 0;
+    tp->gc_allocated = 0;
+    tp->gc_promoted = 0;
+    tp->gc_live = 0;
+    tp->gc_tracked = 0;
+    tp->gc_born = 0;
+    tp->gc_held = 0;
     #ifdef TPVM_DEBUG
-    tp->gcmax = 0;
+    /* collect both generations at every safepoint. */
+    tp->gcgrowth = 1.0;
+    tp->gc_nursery = 0;
+    tp->gc_threshold = 0;
     #else
-    tp->gcmax = 4096;
+    tp->gcgrowth = 2.0;
+    tp->gc_nursery = TP_GC_NURSERY;
+    tp->gc_threshold = TP_GC_MIN_THRESHOLD;
     #endif
+    tp_gc_reserve(tp);
+}
+
+/* approximate number of bytes owned by a tracked object. */
+static unsigned long tp_gc_sizeof(tpd_obj * o) {
+    switch(o->gci.type.typeid) {
+        case TP_LIST: return sizeof(tpd_list) + ((tpd_list*) o)->alloc * sizeof(tp_obj);
+        case TP_DICT: return sizeof(tpd_dict) + ((tpd_dict*) o)->alloc * sizeof(tpd_item);
+        case TP_STRING:
+            if (o->gci.type.magic == TP_STRING_NORMAL) {
+                return sizeof(tpd_string) + ((tpd_string*) o)->len;
+            }
+            return sizeof(tpd_string);
+        case TP_FUNC: return sizeof(tpd_func);
+        case TP_DATA: return sizeof(tpd_data);
+        case TP_RANGE: return sizeof(tpd_range);
+        default: return 0;
+    }
 }
 
 /* Add a reachable object to the gc root. */
@@ -126,99 +248,97 @@ void tp_gc_set_reachable(TP, tp_obj v) {
     tp_set(tp, tp->root, tp_None, v);
 }
 
-void tp_delete(TP, tp_obj v) {
+/* free a tracked object, by its header. */
+void tp_delete(TP, tpd_obj * o) {
     #if TP_GC_TRACE
-    printf("[%04d] deleting object %p\n", tp->steps, v.info);
+    printf("[%04d] deleting object %p\n", tp->steps, o);
     #endif
-    int type = v.type.typeid;
+    int type = o->gci.type.typeid;
     if (type == TP_LIST) {
-        tpd_list_free(tp, TPD_LIST(v));
+        tpd_list_free(tp, (tpd_list*) o);
         return;
     } else if (type == TP_DICT) {
-        tpd_dict_free(tp, v.info);
+        tpd_dict_free(tp, (tpd_dict*) o);
         return;
     } else if (type == TP_STRING) {
-        if(v.type.magic == TP_STRING_NORMAL) {
-            tp_free(tp, TPD_STRING(v)->s);
+        tpd_string * str = (tpd_string*) o;
+#ifdef TP_JIT
+        /* code that ran; its native code goes too. */
+        if (str->verified) {
+            tp_jit_forget(tp, tp_gc_obj(o));
+        }
+#endif
+        if(o->gci.type.magic == TP_STRING_NORMAL) {
+            /* the bytes follow the header, unless taken from a builder. */
+            if(str->s == (char*) (str + 1)) {
+                tp_slab_free(tp, o, sizeof(tpd_string) + str->len);
+                return;
+            }
+            tp_free(tp, str->s);
         }
-        tp_free(tp, v.info);
+        tp_slab_free(tp, o, sizeof(tpd_string));
         return;
     } else if (type == TP_DATA) {
-        if (v.info && TPD_DATA(v)->free) {
-            TPD_DATA(v)->free(tp,v);
+        if (((tpd_data*) o)->free) {
+            ((tpd_data*) o)->free(tp, tp_gc_obj(o));
         }
-        tp_free(tp, v.info);
+        tp_slab_free(tp, o, sizeof(tpd_data));
         return;
     } else if (type == TP_FUNC) {
-        tp_free(tp, v.info);
+        tp_slab_free(tp, o, sizeof(tpd_func));
         return;
-    } else if (type == TP_FRAME) {
-        tp_free(tp, v.info);
+    } else if (type == TP_RANGE) {
+        tp_slab_free(tp, o, sizeof(tpd_range));
         return;
     }
     tp_raise(, tp_string_atom(tp, "(tp_delete) TypeError: ?"));
 }
 
+/* delete the old objects the mark did not reach, and make the rest white
+ * again, keeping their order in tp->old. */
 void tp_collect(TP) {
-    int n;
-
-    for (n=0; n<tp->white->len; n++) {
-        tp_obj r = tp->white->items[n];
-        if (TPD_OBJ(r)->gci.black) { continue; }
-        #if TP_GC_ASSERT_LISTS_ARE_DISJOINT
-        int i;
-        for (i = 0; i < tp->black->len; i ++) {
-            if(TPD_OBJ(tp->black->items[i]) == TPD_OBJ(r)) {
-                abort();
-            }
-        }
-        #endif
-        tp_delete(tp,r);
-    }
-    tp->white->len = 0;
+    tpd_gc_list * old = &tp->old;
+    int n, live = 0;
 
-    /* put all objects to the white list, without duplicates. */
-    for (n=0; n<tp->black->len; n++) {
-        TPD_OBJ(tp->black->items[n])->gci.black = 1;
-    }
-    for (n=0; n<tp->black->len; n++) {
-        tp_obj v = tp->black->items[n];
-        if(TPD_OBJ(v)->gci.black == 0) {
-            abort();
+    tp->gc_live = 0;
+    for (n=0; n<old->len; n++) {
+        tpd_obj * o = old->items[n];
+        if (!o->gci.black) {
+            tp_delete(tp, o);
+            continue;
         }
         #if TP_GC_TRACE
-        printf("[%04d] adding to white, %p\n", tp->steps, v.info);
+        printf("[%04d] marking white, %p\n", tp->steps, o);
         #endif
-        tpd_list_appendx(tp, tp->white, v);
-        TPD_OBJ(v)->gci.black = 0;
-        TPD_OBJ(v)->gci.grey = 0;
+        tp->gc_live += tp_gc_sizeof(o);
+        o->gci.black = 0;
+        o->gci.grey = 0;
+        old->items[live++] = o;
     }
-    tp->black->len = 0;
+    old->len = live;
 }
 
+/* mark up to max grey objects; all of them if max < 0. */
 void tp_mark(TP, int max) {
-    while (tp->grey->len && max > 0) {
-        tp_obj v;
+    while (tp->grey.len && max != 0) {
         /* pick a grey object */
-        v = tpd_list_pop(tp, tp->grey, tp->grey->len-1, "_tp_gcinc");
-        if(TPD_OBJ(v)->gci.black) {
+        tpd_obj * o = tp->grey.items[--tp->grey.len];
+        if(o->gci.black) {
             abort();
         }
         /* color it as black. */
-        TPD_OBJ(v)->gci.black = 1;
-        TPD_OBJ(v)->gci.grey = 1;
+        o->gci.black = 1;
         #if TP_GC_TRACE
-        printf("[%04d] adding to black, %p\n", tp->steps, v.info);
+        printf("[%04d] marking black, %p\n", tp->steps, o);
         #endif
-        tpd_list_appendx(tp, tp->black, v);
 
         /* put children to grey. */
-        tp_follow(tp,v);
+        tp_follow_with(tp, tp_gc_obj(o), tp_grey);
         if(max > 0) max--;
     }
 }
 
-void tp_gc_dump(TP, tpd_list * l, int name, int mark) {
+void tp_gc_dump(TP, tpd_gc_list * l, int name, int mark) {
     /* FIXME: add tp_string_builder_printf, and write to a string builder. */
     #if 1
         return;
@@ -227,12 +347,12 @@ void tp_gc_dump(TP, tpd_list * l, int name, int mark) {
     char step[20];
     sprintf(step, "%c[%06d]%c", mark, tp->steps, name);
     for(i = 0; i < l->len; i ++) {
-        tp_obj v = l->items[i];
+        tpd_obj * o = l->items[i];
         printf("%s%p:%d%d%c",
         i % 6 == 0?step:"",
-        TPD_OBJ(v),
-        TPD_OBJ(v)->gci.black,
-        TPD_OBJ(v)->gci.grey,
+        o,
+        o->gci.black,
+        o->gci.grey,
         (i + 1) % 6 == 0?'\n':' '
         );
     }
@@ -240,36 +360,119 @@ void tp_gc_dump(TP, tpd_list * l, int name, int mark) {
     fflush(stdout);
 }
 
-void tp_gc_run(TP, int full) {
-    if (full || tp->gcmax == 0 || (tp->steps % tp->gcmax == 0)) {
-        tp_mark(tp, -1);
-    } else {
-        /* mark 2 items from the grey list every step */
-        tp_mark(tp, 8);
+/* the number of young objects, from the first, that C code below the
+ * innermost tp_continue_frame may hold: those tracked before it was
+ * entered. */
+static int tp_gc_held(TP) {
+    unsigned long first = tp->gc_born - tp->young.len;
+    return tp->gc_held > first ? tp->gc_held - first : 0;
+}
+
+/* move a young object to the old generation, white. One C code may hold
+ * is greyed, so that it survives the next major cycle as well. */
+static void tp_gc_promote(TP, tpd_obj * o, int held) {
+    o->gci.young = 0;
+    o->gci.grey = 0;
+    o->gci.black = 0;
+    tp_gc_append(tp, &tp->old, o);
+    tp->gc_promoted += tp_gc_sizeof(o);
+    if (held) { tp_grey(tp, tp_gc_obj(o)); }
+}
+
+/* tp_gc_minor: run a minor cycle; mark the young objects reachable from
+ * the frames, the registers, tp->remembered and the held ones, promote
+ * them and delete the rest of the young generation. */
+void tp_gc_minor(TP) {
+    tpd_gc_list * young = &tp->young;
+    int n, held = tp_gc_held(tp);
+    tp_grey_frames(tp, tp_grey_young);
+    for (n = 0; n < tp->stack->len; n++) {
+        tp_grey_young(tp, tp->stack->items[n]);
+    }
+    tp_grey_young(tp, tp->samples);
+    for (n = 0; n < held; n++) {
+        tp_grey_young(tp, tp_gc_obj(young->items[n]));
+    }
+    while (tp->remembered.len) {
+        tpd_obj * o = tp->remembered.items[--tp->remembered.len];
+        tp_follow_with(tp, tp_gc_obj(o), tp_grey_young);
+    }
+    for (n = 0; n < young->len; n++) {
+        tpd_obj * o = young->items[n];
+        if (o->gci.grey) {
+            tp_gc_promote(tp, o, n < held);
+        } else {
+            tp_delete(tp, o);
+        }
+    }
+    young->len = 0;
+    tp->gc_allocated = 0;
+    tp->minor_steps += 1;
+}
+
+/* tp_gc_run: run a major cycle; mark everything reachable, young or old,
+ * delete the rest, then pace the next one: it starts once the old
+ * generation has grown by a factor of gcgrowth, counted in bytes promoted
+ * since this cycle. */
+void tp_gc_run(TP) {
+    int n, held = tp_gc_held(tp);
+    for (n = 0; n < tp->young.len; n++) {
+        tp_gc_promote(tp, tp->young.items[n], n < held);
     }
+    tp->young.len = 0;
+    tp->remembered.len = 0;
+
+    tp_follow(tp, tp->root);
+    tp_grey_frames(tp, tp_grey);
+    tp_grey(tp, tp->samples);
+    tp_mark(tp, -1);
+
+    tp_gc_dump(tp, &tp->old, 'O', 'M');
+    tp_collect(tp);
+    tp_gc_dump(tp, &tp->old, 'O', 'C');
 
-    /* grey list is empty, we can run a collection */
-    if(tp->grey->len == 0) {
-        tp_gc_dump(tp, tp->white, 'W', 'M');
-        /*FIXME: should we do this every time grey drops to zero? */
-        tp_collect(tp);
-        tp_gc_dump(tp, tp->white, 'W', 'C');
-        tp_follow(tp, tp->root);
-        tp_gc_dump(tp, tp->grey, 'G', 'F');
+    tp->gc_threshold = tp->gc_live * (tp->gcgrowth - 1.0);
+    if (tp->gcgrowth > 1.0 && tp->gc_threshold < TP_GC_MIN_THRESHOLD) {
+        tp->gc_threshold = TP_GC_MIN_THRESHOLD;
     }
+    tp_gc_reserve(tp);
+    tp->gc_allocated = 0;
+    tp->gc_promoted = 0;
     tp->steps += 1;
 }
 
-/* tp_track: put an object to the grey list.
+/* tp_gc_safepoint: run a minor cycle if enough has been allocated, and a
+ * major one if enough has been promoted.
+ *
+ * The VM calls this only between instructions -- on entering tp_step and on
+ * loop back-edges -- where every live object is reachable from the roots,
+ * or held by C code below the innermost tp_continue_frame; see tp_gc_held. */
+tp_inline static void tp_gc_safepoint(TP) {
+    if (tp->gc_allocated >= tp->gc_nursery) {
+        tp_gc_minor(tp);
+        if (tp->gc_promoted >= tp->gc_threshold) {
+            tp_gc_run(tp);
+        }
+    }
+}
+
+/* tp_track: put a new object to the young generation.
  * Use tp_track if the object is definitely new.*/
 tp_obj tp_track(TP,tp_obj v) {
-    /* force greying the object */
     if (v.type.typeid >= TP_GC_TRACKED && TPD_OBJ(v)) {
+        tp->gc_tracked++;
         TPD_OBJ(v)->gci.grey = 0;
-        /* NOTE(rainwoodman): I don't think we need to set the following flags */
         TPD_OBJ(v)->gci.black = 0;
+        /* atoms and external strings are not the gc's to delete. */
+        if (v.type.typeid == TP_STRING && (v.type.magic == TP_STRING_ATOM
+                    || v.type.magic == TP_STRING_EXTERN)) {
+            return v;
+        }
+        TPD_OBJ(v)->gci.young = 1;
+        TPD_OBJ(v)->gci.type = v.type;
+        tp_gc_append(tp, &tp->young, TPD_OBJ(v));
+        tp->gc_born++;
     }
-    tp_grey(tp,v);
     return v;
 }
 
@@ -277,11 +480,12 @@ void tp_gc_deinit(TP) {
     while (TPD_LIST(tp->root)->len) {
         tpd_list_pop(tp, TPD_LIST(tp->root), 0, "tp_deinit");
     }
-    tp_gc_run(tp, 1);
-    tp_delete(tp, tp->root);
-    tpd_list_free(tp, tp->white);
-    tpd_list_free(tp, tp->grey);
-    tpd_list_free(tp, tp->black);
+    tp_gc_run(tp);
+    tpd_list_free(tp, TPD_LIST(tp->root));
+    tp_free(tp, tp->old.items);
+    tp_free(tp, tp->grey.items);
+    tp_free(tp, tp->young.items);
+    tp_free(tp, tp->remembered.items);
 }
 
 
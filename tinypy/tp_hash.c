@@ -38,6 +38,7 @@ int tp_hash(TP, tp_obj v) {
         }
         case TP_FUNC: return tpd_lua_hash(&v.info, sizeof(void*));
         case TP_DATA: return tpd_lua_hash(&v.ptr, sizeof(void*));
+        case TP_RANGE: return tpd_lua_hash(&TPD_RANGE(v)->start, 3 * sizeof(long));
     }
     tp_raise(0, tp_string_atom(tp, "(tp_hash) TypeError: value unhashable"));
 }
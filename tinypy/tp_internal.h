@@ -20,8 +20,8 @@
 
 tp_inline static int _tp_min(int a, int b) { return (a<b?a:b); }
 tp_inline static int _tp_max(int a, int b) { return (a>b?a:b); }
-tp_inline static tpd_frame * tp_get_frame(TP, int i) { return TPD_FRAME(tp->frames->items[i]); }
-tp_inline static tpd_frame * tp_get_cur_frame(TP) { return tp_get_frame(tp, tp->frames->len - 1); }
+tp_inline static tpd_frame * tp_get_frame(TP, int i) { return &tp->frames[i]; }
+tp_inline static tpd_frame * tp_get_cur_frame(TP) { return tp_get_frame(tp, tp->nframes - 1); }
 
 /* Detect unintended size changes. Update as needed. */
 STATIC_ASSERT(sizeof(tpd_code) == 4, "size of tpd_code must be 4");
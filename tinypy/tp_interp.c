@@ -30,9 +30,27 @@ tp_obj tp_args(TP, int argc, char *argv[]) {
 tp_obj tp_conf_set(TP) {
     tp_obj o = TP_PARAMS_OBJ();
     tp_obj k = TP_PARAMS_STR();
-    int v = TP_PARAMS_INT();
-    if(tp_string_equal_atom(k, "gcmax")) {
-        tp->gcmax = v;
+    tp_obj v = TP_PARAMS_TYPE(TP_NUMBER);
+    if(tp_string_equal_atom(k, "gcgrowth")) {
+        double growth = TPN_AS_FLOAT(tp_number_cast(tp, v, TP_NUMBER_FLOAT));
+        if (growth < 1.0) {
+            tp_raise_printf(tp_None, "(tp_conf_set) ValueError: gcgrowth must be >= 1, got %O", &v);
+        }
+        tp->gcgrowth = growth;
+    } else if(tp_string_equal_atom(k, "slabmadvise")) {
+        tp->slab->madvise = TPN_AS_INT(tp_number_cast(tp, v, TP_NUMBER_INT)) != 0;
+    } else if(tp_string_equal_atom(k, "profile")) {
+        tp_profile_set(tp, TPN_AS_INT(tp_number_cast(tp, v, TP_NUMBER_INT)));
+    } else if(tp_string_equal_atom(k, "quicken")) {
+        tp->quickening = TPN_AS_INT(tp_number_cast(tp, v, TP_NUMBER_INT)) != 0;
+    } else if(tp_string_equal_atom(k, "jit")) {
+#ifdef TP_JIT
+        tp->jit_mode = TPN_AS_INT(tp_number_cast(tp, v, TP_NUMBER_INT));
+#else
+        if (TPN_AS_INT(tp_number_cast(tp, v, TP_NUMBER_INT))) {
+            tp_raise_printf(tp_None, "(tp_conf_set) ValueError: built without TP_JIT");
+        }
+#endif
     } else {
         tp_raise_printf(tp_None, "(tp_conf_set) unknown key %O", &k);
     }
@@ -42,8 +60,30 @@ tp_obj tp_conf_set(TP) {
 tp_obj tp_conf_get(TP) {
     tp_obj o = TP_PARAMS_OBJ();
     tp_obj k = TP_PARAMS_STR();
-    if(tp_string_equal_atom(k, "gcmax")) {
-        return tp_int(tp->gcmax);
+    if(tp_string_equal_atom(k, "gcgrowth")) {
+        return tp_float(tp->gcgrowth);
+    } else if(tp_string_equal_atom(k, "gctracked")) {
+        return tp_int(tp->gc_tracked);
+    } else if(tp_string_equal_atom(k, "gcminor")) {
+        return tp_int(tp->minor_steps);
+    } else if(tp_string_equal_atom(k, "gcmajor")) {
+        return tp_int(tp->steps);
+    } else if(tp_string_equal_atom(k, "slabmadvise")) {
+        return tp_int(tp->slab->madvise);
+    } else if(tp_string_equal_atom(k, "profile")) {
+        return tp_int(tp->profiling);
+    } else if(tp_string_equal_atom(k, "quicken")) {
+        return tp_int(tp->quickening);
+    } else if(tp_string_equal_atom(k, "jit")) {
+        return tp_int(tp->jit_mode);
+    } else if(tp_string_equal_atom(k, "jitted")) {
+#ifdef TP_JIT
+        return tp_int(tp->jits ? tp->jits->compiled : 0);
+#else
+        return tp_int(0);
+#endif
+    } else if(tp_string_equal_atom(k, "aot")) {
+        return tp_int(tp->naot);
     } else {
         tp_raise_printf(tp_None, "(tp_conf_get) unknown key %O", &k);
     }
@@ -55,6 +95,39 @@ tp_obj tp_get_exc(TP) {
     return tp_list_from_items(tp, 2, elems);
 }
 
+/* profile() is the table of the counts; profile(code) the count of
+ * each word of code. See tp_profile.c. */
+tp_obj tpy_profile(TP) {
+    if (TP_NPARAMS()) {
+        return tp_profile_sites(tp, TP_PARAMS_STR());
+    }
+    return tp_profile_table(tp);
+}
+
+/* quicken() is the table of the sites rewritten; see tp_quicken.c. */
+tp_obj tpy_quicken(TP) {
+    return tp_quicken_table(tp);
+}
+
+/* slab() is the state of the allocator of object headers; see
+ * tp_slab.c. */
+tp_obj tpy_slab(TP) {
+    return tp_slab_table(tp);
+}
+
+/* sample_start(ms=1) starts the sampling profiler; sample_stop() stops
+ * it and returns the collapsed stacks. See tp_sample.c. */
+tp_obj tpy_sample_start(TP) {
+    tp_obj ms = TP_PARAMS_DEFAULT(tp_int(1));
+    tp_sample_start(tp, TPN_AS_FLOAT(tp_number_cast(tp, tp_check_type(tp, TP_NUMBER, ms), TP_NUMBER_FLOAT)));
+    return tp_None;
+}
+
+tp_obj tpy_sample_stop(TP) {
+    tp_sample_stop(tp);
+    return tp_sample_collapsed(tp);
+}
+
 tp_obj tpy_exit(TP) {
     int code = TP_PARAMS_INT();
     exit(code);
@@ -76,6 +149,11 @@ void tp_module_sys_init (TP, int argc, char * argv[]) {
     tp_set(tp, sys, tp_string_atom(tp, "conf"), conf);
     tp_set(tp, sys, tp_string_atom(tp, "exit"), tp_function(tp, tpy_exit));
     tp_set(tp, sys, tp_string_atom(tp, "get_exc"), tp_function(tp, tp_get_exc));
+    tp_set(tp, sys, tp_string_atom(tp, "profile"), tp_function(tp, tpy_profile));
+    tp_set(tp, sys, tp_string_atom(tp, "quicken"), tp_function(tp, tpy_quicken));
+    tp_set(tp, sys, tp_string_atom(tp, "slab"), tp_function(tp, tpy_slab));
+    tp_set(tp, sys, tp_string_atom(tp, "sample_start"), tp_function(tp, tpy_sample_start));
+    tp_set(tp, sys, tp_string_atom(tp, "sample_stop"), tp_function(tp, tpy_sample_stop));
     tp_set(tp, tp->modules, tp_string_atom(tp, "sys"), sys);
 }
 
@@ -106,7 +184,18 @@ tp_vm * tp_init(int argc, char *argv[], int enable_py_runtime) {
  * may be good practice to call this function on shutdown.
  */
 void tp_deinit(TP) {
+#ifdef TP_SANDBOX
+    /* stop the timer */
+    tp_sandbox(tp, TP_NO_LIMIT, TP_NO_LIMIT, TP_NO_LIMIT);
+#endif
+    tp_sample_stop(tp);
+    tp_profile_deinit(tp);
+#ifdef TP_JIT
+    tp_jit_deinit(tp);
+#endif
+    tp_aot_deinit(tp);
     tp_gc_deinit(tp);
+    tp_slab_deinit(tp);
     tp->mem_used -= sizeof(tp_vm); 
     free(tp);
 }
@@ -0,0 +1,516 @@
+/* File: JIT
+ * A baseline JIT for x86-64 Linux, built with TP_JIT.
+ *
+ * A code body that gets hot -- called, or round a loop, TP_JIT_HOT times
+ * -- is translated into native code, one template per instruction. MOVE,
+ * NONE, the jumps and tests, and the arithmetic and comparisons of two
+ * ints are done inline; the other instructions call tp_aot_op, which runs
+ * them with the helpers tp_step uses. Calls, returns, RAISE, RANGE and
+ * DEF have no template: the native code returns to tp_step there, which
+ * runs the instruction and enters the native code again on its next step
+ * of the frame -- after the call returns, or an exception is caught -- or
+ * at the next loop back-edge.
+ *
+ * The native code keeps no values of its own: everything is in the
+ * registers of the frame, so the gc sees all of it, and an exception
+ * unwinds native code by longjmp as it does tp_step.
+ *
+ * sys.conf.jit = 0 stops compiling and entering native code, 1 compiles
+ * hot code, 2 compiles every body the first time it runs. sys.conf.jitted
+ * is the number of bodies compiled. The native code of a body goes with
+ * the code string it came from.
+ */
+
+#if defined(__x86_64__) && defined(__linux__)
+#include <stddef.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define TP_JIT_NATIVE
+#endif
+
+/* calls and back-edges of a body before it is compiled. */
+#define TP_JIT_HOT 100
+/* bytes of native code a word of bytecode takes at most. */
+#define TP_JIT_WORD 160
+
+/* the entry: runs native code from target; returns the instruction to
+ * go on from in tp_step. */
+typedef tpd_code * (*tp_jit_fn)(TP, tpd_frame * f, void * target);
+
+typedef struct tpd_jit {
+    tpd_code * code; /* the body, from its REGS */
+    int n; /* words */
+    long count; /* calls and back-edges so far */
+    int failed; /* not compiled and never will be */
+    tp_jit_fn native;
+    unsigned char * mem;
+    unsigned long size;
+    void ** entry; /* native code of each instruction, or NULL if none */
+} tpd_jit;
+
+typedef struct tpd_jits {
+    /* open addressing on code; alloc is a power of 2. */
+    tpd_jit ** items;
+    int len;
+    int alloc;
+    int compiled;
+} tpd_jits;
+
+static tpd_jit ** tpd_jits_find(tpd_jit ** items, int alloc, tpd_code * code) {
+    unsigned long i = ((unsigned long) code >> 2) * 2654435761UL;
+    for (i &= alloc - 1; items[i] && items[i]->code != code; i = (i + 1) & (alloc - 1)) { }
+    return &items[i];
+}
+
+static void tpd_jits_resize(TP, tpd_jits * t, int alloc) {
+    tpd_jit ** items = (tpd_jit **) tp_malloc(tp, alloc * sizeof(tpd_jit *));
+    int i;
+    for (i = 0; i < t->alloc; i++) {
+        if (t->items[i]) {
+            *tpd_jits_find(items, alloc, t->items[i]->code) = t->items[i];
+        }
+    }
+    tp_free(tp, t->items);
+    t->items = items;
+    t->alloc = alloc;
+}
+
+/* Function: tp_jit_get
+ * The native code of the body code, compiled or not yet; REGS calls it.
+ */
+tpd_jit * tp_jit_get(TP, tp_obj code) {
+    tpd_jits * t = tp->jits;
+    tpd_code * start = (tpd_code *) tp_string_getptr(code);
+    tpd_jit ** slot;
+    if (!t) {
+        t = tp->jits = (tpd_jits *) tp_malloc(tp, sizeof(tpd_jits));
+        t->alloc = 64;
+        t->items = (tpd_jit **) tp_malloc(tp, t->alloc * sizeof(tpd_jit *));
+    }
+    slot = tpd_jits_find(t->items, t->alloc, start);
+    if (*slot) {
+        return *slot;
+    }
+    if ((t->len + 1) * 2 > t->alloc) {
+        tpd_jits_resize(tp, t, t->alloc * 2);
+        slot = tpd_jits_find(t->items, t->alloc, start);
+    }
+    *slot = (tpd_jit *) tp_malloc(tp, sizeof(tpd_jit));
+    (*slot)->code = start;
+    (*slot)->n = tp_string_len(code) / sizeof(tpd_code);
+    t->len++;
+    return *slot;
+}
+
+static void tpd_jit_free(TP, tpd_jit * j) {
+#ifdef TP_JIT_NATIVE
+    if (j->mem) {
+        munmap(j->mem, j->size);
+    }
+#endif
+    tp_free(tp, j->entry);
+    tp_free(tp, j);
+}
+
+/* Function: tp_jit_forget
+ * Drops the native code of the bodies in the code string code, which the
+ * gc is about to free.
+ */
+void tp_jit_forget(TP, tp_obj code) {
+    tpd_jits * t = tp->jits;
+    tpd_code * start = (tpd_code *) tp_string_getptr(code);
+    tpd_code * end = start + tp_string_len(code) / sizeof(tpd_code);
+    int i;
+    if (!t) {
+        return;
+    }
+    for (i = 0; i < t->alloc; i++) {
+        tpd_jit * j = t->items[i];
+        if (j && j->code >= start && j->code < end) {
+            tpd_jit_free(tp, j);
+            t->items[i] = NULL;
+            t->len--;
+        }
+    }
+    /* put the others back where a probe finds them. */
+    tpd_jits_resize(tp, t, t->alloc);
+}
+
+void tp_jit_deinit(TP) {
+    tpd_jits * t = tp->jits;
+    int i;
+    if (!t) {
+        return;
+    }
+    for (i = 0; i < t->alloc; i++) {
+        if (t->items[i]) {
+            tpd_jit_free(tp, t->items[i]);
+        }
+    }
+    tp_free(tp, t->items);
+    tp_free(tp, t);
+    tp->jits = NULL;
+}
+
+/* The helpers native code calls, with tp_aot_op and tp_aot_safepoint;
+ * see tp_aot.c. */
+
+/* ITER and FOR: whether a got the next item. */
+static int tp_jit_next(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code e = *cur;
+    if (e.i == TP_IFOR) {
+        return tpd_frame_for(tp, f, e);
+    }
+    return tp_iter_next(tp, &RA, RB, &RC);
+}
+
+static int tp_jit_true(TP, tp_obj * v) {
+    return tp_true(tp, *v);
+}
+
+#ifdef TP_JIT_NATIVE
+
+/* The assembler. rbx holds tp, r12 the frame and r13 its registers; rax,
+ * rcx, rdx, rsi and rdi are scratch. */
+typedef struct tpd_jit_asm {
+    unsigned char * p;
+    int len;
+    int * at; /* offset of the code of each word, or -1 */
+    int * fix; /* offset of a rel32, and the word it jumps to */
+    int nfix;
+} tpd_jit_asm;
+
+/* tp_obj fields */
+#define TP_JIT_REG(r) ((int) ((r) * sizeof(tp_obj)))
+#define TP_JIT_INFO ((int) offsetof(tp_obj, info))
+#define TP_JIT_VAL ((int) offsetof(tp_obj, nint))
+
+static void tpd_asm_byte(tpd_jit_asm * a, int v) {
+    a->p[a->len++] = v;
+}
+
+static void tpd_asm_bytes(tpd_jit_asm * a, const char * s, int n) {
+    memcpy(a->p + a->len, s, n);
+    a->len += n;
+}
+
+static void tpd_asm_u32(tpd_jit_asm * a, unsigned int v) {
+    memcpy(a->p + a->len, &v, 4);
+    a->len += 4;
+}
+
+static void tpd_asm_u64(tpd_jit_asm * a, const void * v) {
+    memcpy(a->p + a->len, &v, 8);
+    a->len += 8;
+}
+
+/* the type tag of an int: typeid and magic, as the low 16 bits of a
+ * tp_obj read; zero above, as tp_int leaves them. */
+static int tpd_asm_int_tag(void) {
+    tp_obj v = tp_int(0);
+    unsigned short tag;
+    memcpy(&tag, &v.type, sizeof(tag));
+    return tag;
+}
+
+/* op [r13 + d] with the ModRM reg field r and the rest of the opcode s. */
+static void tpd_asm_r13(tpd_jit_asm * a, const char * s, int n, int r, int d) {
+    tpd_asm_bytes(a, s, n);
+    tpd_asm_byte(a, 0x85 | (r << 3));
+    tpd_asm_u32(a, d);
+}
+
+/* jumps: to word w, through a rel32 patched once all the words are in. */
+static void tpd_asm_jump_word(tpd_jit_asm * a, int cc, int w) {
+    if (cc) {
+        tpd_asm_byte(a, 0x0f);
+        tpd_asm_byte(a, cc);
+    } else {
+        tpd_asm_byte(a, 0xe9);
+    }
+    a->fix[a->nfix * 2] = a->len;
+    a->fix[a->nfix * 2 + 1] = w;
+    a->nfix++;
+    tpd_asm_u32(a, 0);
+}
+
+/* a jump to a label of the template not emitted yet; see tpd_asm_here. */
+static int tpd_asm_jump_ahead(tpd_jit_asm * a, int cc) {
+    tpd_asm_byte(a, 0x0f);
+    tpd_asm_byte(a, cc);
+    tpd_asm_u32(a, 0);
+    return a->len;
+}
+
+static void tpd_asm_here(tpd_jit_asm * a, int from) {
+    unsigned int rel = a->len - from;
+    memcpy(a->p + from - 4, &rel, 4);
+}
+
+/* call fn(tp, f, cur) */
+static void tpd_asm_call_op(tpd_jit_asm * a, const void * fn, tpd_code * cur) {
+    tpd_asm_bytes(a, "\x48\x89\xdf", 3); /* mov rdi, rbx */
+    tpd_asm_bytes(a, "\x4c\x89\xe6", 3); /* mov rsi, r12 */
+    tpd_asm_bytes(a, "\x48\xba", 2); /* mov rdx, cur */
+    tpd_asm_u64(a, cur);
+    tpd_asm_bytes(a, "\x48\xb8", 2); /* mov rax, fn */
+    tpd_asm_u64(a, fn);
+    tpd_asm_bytes(a, "\xff\xd0", 2); /* call rax */
+}
+
+/* jne ahead unless register r holds an int */
+static int tpd_asm_guard_int(tpd_jit_asm * a, int r) {
+    tpd_asm_r13(a, "\x41\x0f\xb7", 3, 0, TP_JIT_REG(r)); /* movzx eax, word [r] */
+    tpd_asm_byte(a, 0x3d); /* cmp eax, tag */
+    tpd_asm_u32(a, tpd_asm_int_tag());
+    return tpd_asm_jump_ahead(a, 0x85);
+}
+
+/* register r = the int in rax */
+static void tpd_asm_set_int(tpd_jit_asm * a, int r) {
+    tpd_asm_r13(a, "\x49\xc7", 2, 0, TP_JIT_REG(r)); /* mov qword [r], tag */
+    tpd_asm_u32(a, tpd_asm_int_tag());
+    tpd_asm_r13(a, "\x49\xc7", 2, 0, TP_JIT_REG(r) + TP_JIT_INFO); /* mov qword [r].info, 0 */
+    tpd_asm_u32(a, 0);
+    tpd_asm_r13(a, "\x49\x89", 2, 0, TP_JIT_REG(r) + TP_JIT_VAL); /* mov [r].nint, rax */
+}
+
+/* the setcc of each comparison of ints; the jcc is 0x10 less. */
+static int tpd_asm_setcc(int op) {
+    switch (op) {
+        case TP_IEQ: return 0x94;
+        case TP_INE: return 0x95;
+        case TP_ILT: return 0x9c;
+        case TP_IGE: return 0x9d;
+        case TP_ILE: return 0x9e;
+        case TP_IGT: return 0x9f;
+    }
+    return 0;
+}
+
+/* emits the template of the instruction at word k of the body; returns 0
+ * if it has none, and native code returns to tp_step there. */
+static int tpd_jit_emit(tpd_jit_asm * a, tpd_code * code, int k, int size, int epilogue) {
+    tpd_code * cur = code + k;
+    tpd_code e = *cur;
+    int op = tp_quicken_base(e.i);
+    int i, slow[2];
+    switch (op) {
+        case TP_IADD: case TP_ISUB: case TP_IMUL:
+        case TP_IEQ: case TP_INE: case TP_ILT: case TP_ILE: case TP_IGT: case TP_IGE:
+            /* ints inline, the rest through tp_aot_op. */
+            slow[0] = tpd_asm_guard_int(a, VB);
+            slow[1] = tpd_asm_guard_int(a, VC);
+            tpd_asm_r13(a, "\x49\x8b", 2, 0, TP_JIT_REG(VB) + TP_JIT_VAL); /* mov rax, [b].nint */
+            if (op == TP_IADD) {
+                tpd_asm_r13(a, "\x49\x03", 2, 0, TP_JIT_REG(VC) + TP_JIT_VAL); /* add */
+            } else if (op == TP_ISUB) {
+                tpd_asm_r13(a, "\x49\x2b", 2, 0, TP_JIT_REG(VC) + TP_JIT_VAL); /* sub */
+            } else if (op == TP_IMUL) {
+                tpd_asm_r13(a, "\x49\x0f\xaf", 3, 0, TP_JIT_REG(VC) + TP_JIT_VAL); /* imul */
+            } else {
+                tpd_asm_r13(a, "\x49\x3b", 2, 0, TP_JIT_REG(VC) + TP_JIT_VAL); /* cmp */
+                tpd_asm_byte(a, 0x0f); /* setcc al */
+                tpd_asm_byte(a, tpd_asm_setcc(op));
+                tpd_asm_byte(a, 0xc0);
+                tpd_asm_bytes(a, "\x0f\xb6\xc0", 3); /* movzx eax, al */
+            }
+            tpd_asm_set_int(a, VA);
+            tpd_asm_jump_word(a, 0, k + size);
+            tpd_asm_here(a, slow[0]);
+            tpd_asm_here(a, slow[1]);
+            tpd_asm_call_op(a, tp_aot_op, cur);
+            return 1;
+        case TP_IMOVE:
+            for (i = 0; i < (int) sizeof(tp_obj); i += 8) {
+                tpd_asm_r13(a, "\x49\x8b", 2, 0, TP_JIT_REG(VB) + i); /* mov rax, [b] */
+                tpd_asm_r13(a, "\x49\x89", 2, 0, TP_JIT_REG(VA) + i); /* mov [a], rax */
+            }
+            return 1;
+        case TP_INONE:
+            tpd_asm_bytes(a, "\x31\xc0", 2); /* xor eax, eax */
+            for (i = 0; i < (int) sizeof(tp_obj); i += 8) {
+                tpd_asm_r13(a, "\x49\x89", 2, 0, TP_JIT_REG(VA) + i);
+            }
+            return 1;
+        case TP_IPASS: case TP_IVAR:
+            return 1;
+        case TP_ILINE:
+            tpd_asm_bytes(a, "\x48\xb8", 2); /* mov rax, cur */
+            tpd_asm_u64(a, cur);
+            tpd_asm_bytes(a, "\x49\x89\x84\x24", 4); /* mov [r12].line, rax */
+            tpd_asm_u32(a, offsetof(tpd_frame, line));
+            tpd_asm_bytes(a, "\x41\xc7\x84\x24", 4); /* mov dword [r12].lineno, b c */
+            tpd_asm_u32(a, offsetof(tpd_frame, lineno));
+            tpd_asm_u32(a, UVBC);
+            return 1;
+        case TP_IJUMP:
+            if (SVBC < 0) {
+                /* a back-edge is a safepoint. */
+                tpd_asm_bytes(a, "\x48\x89\xdf", 3); /* mov rdi, rbx */
+                tpd_asm_byte(a, 0xbe); /* mov esi, n */
+                tpd_asm_u32(a, -SVBC);
+                tpd_asm_bytes(a, "\x48\xb8", 2); /* mov rax, tp_aot_safepoint */
+                tpd_asm_u64(a, tp_aot_safepoint);
+                tpd_asm_bytes(a, "\xff\xd0", 2); /* call rax */
+            }
+            tpd_asm_jump_word(a, 0, k + SVBC);
+            return 1;
+        case TP_IIF: case TP_IIFN:
+            /* skip the next instruction if a is true (IF) or false (IFN). */
+            slow[0] = tpd_asm_guard_int(a, VA);
+            tpd_asm_r13(a, "\x49\x83", 2, 7, TP_JIT_REG(VA) + TP_JIT_VAL); /* cmp qword [a].nint, 0 */
+            tpd_asm_byte(a, 0);
+            tpd_asm_jump_word(a, op == TP_IIF ? 0x85 : 0x84, k + 2);
+            tpd_asm_jump_word(a, 0, k + 1);
+            tpd_asm_here(a, slow[0]);
+            tpd_asm_bytes(a, "\x48\x89\xdf", 3); /* mov rdi, rbx */
+            tpd_asm_r13(a, "\x49\x8d", 2, 6, TP_JIT_REG(VA)); /* lea rsi, [a] */
+            tpd_asm_bytes(a, "\x48\xb8", 2); /* mov rax, tp_jit_true */
+            tpd_asm_u64(a, tp_jit_true);
+            tpd_asm_bytes(a, "\xff\xd0", 2); /* call rax */
+            tpd_asm_bytes(a, "\x85\xc0", 2); /* test eax, eax */
+            tpd_asm_jump_word(a, op == TP_IIF ? 0x85 : 0x84, k + 2);
+            return 1;
+        case TP_IITER: case TP_IFOR:
+            tpd_asm_call_op(a, tp_jit_next, cur);
+            tpd_asm_bytes(a, "\x85\xc0", 2); /* test eax, eax */
+            tpd_asm_jump_word(a, 0x85, k + 2);
+            return 1;
+        case TP_IDIV: case TP_IPOW: case TP_IBITAND: case TP_IBITOR: case TP_IBITXOR:
+        case TP_IMOD: case TP_ILSH: case TP_IRSH: case TP_IBITNOT: case TP_INOT:
+        case TP_IGET: case TP_IMGET: case TP_IMETHOD: case TP_IGGET: case TP_IGSET:
+        case TP_ISET: case TP_IIN: case TP_INOTIN: case TP_IIGET: case TP_IDEL:
+        case TP_IUPDATE: case TP_INUMBER: case TP_ISTRING: case TP_IDICT: case TP_ICLASS:
+        case TP_ILIST: case TP_ILEN: case TP_ISETJMP: case TP_IASSERT: case TP_IFILE:
+        case TP_INAME:
+            tpd_asm_call_op(a, tp_aot_op, cur);
+            return 1;
+    }
+    /* back to tp_step, at cur. */
+    tpd_asm_bytes(a, "\x48\xb8", 2); /* mov rax, cur */
+    tpd_asm_u64(a, cur);
+    tpd_asm_byte(a, 0xe9); /* jmp epilogue */
+    tpd_asm_u32(a, epilogue - (a->len + 4));
+    return 0;
+}
+
+static void tp_jit_compile(TP, tpd_jit * j) {
+    tpd_jit_asm a[1];
+    int * native = (int *) tp_malloc(tp, j->n * sizeof(int));
+    int k, size, epilogue;
+    unsigned long page = sysconf(_SC_PAGESIZE);
+    void * mem;
+
+    j->failed = 1;
+    a->p = (unsigned char *) tp_malloc(tp, j->n * TP_JIT_WORD + 64);
+    a->len = 0;
+    a->at = (int *) tp_malloc(tp, j->n * sizeof(int));
+    /* at most three jumps to words per template, in IF and IFN; two ints
+     * each. */
+    a->fix = (int *) tp_malloc(tp, j->n * 3 * 2 * sizeof(int));
+    a->nfix = 0;
+    for (k = 0; k < j->n; k++) {
+        a->at[k] = -1;
+    }
+
+    /* the entry: save the registers the ABI wants kept, keep the stack
+     * 16 byte aligned for the calls, load tp, f and f->regs and jump to
+     * the target. */
+    tpd_asm_bytes(a, "\x55\x53\x41\x54\x41\x55\x41\x56\x41\x57", 10); /* push rbp, rbx, r12-r15 */
+    tpd_asm_bytes(a, "\x48\x83\xec\x08", 4); /* sub rsp, 8 */
+    tpd_asm_bytes(a, "\x48\x89\xfb", 3); /* mov rbx, rdi */
+    tpd_asm_bytes(a, "\x49\x89\xf4", 3); /* mov r12, rsi */
+    tpd_asm_bytes(a, "\x4c\x8b\xae", 3); /* mov r13, [rsi].regs */
+    tpd_asm_u32(a, offsetof(tpd_frame, regs));
+    tpd_asm_bytes(a, "\xff\xe2", 2); /* jmp rdx */
+    epilogue = a->len;
+    tpd_asm_bytes(a, "\x48\x83\xc4\x08", 4); /* add rsp, 8 */
+    tpd_asm_bytes(a, "\x41\x5f\x41\x5e\x41\x5d\x41\x5c\x5b\x5d\xc3", 11); /* pop, ret */
+
+    for (k = 0; k < j->n; k += size) {
+        size = tp_verify_size(j->code, k, j->n);
+        if (!size) {
+            goto done;
+        }
+        a->at[k] = a->len;
+        native[k] = tpd_jit_emit(a, j->code, k, size, epilogue);
+    }
+    for (k = 0; k < a->nfix; k++) {
+        int from = a->fix[k * 2], to = a->fix[k * 2 + 1];
+        unsigned int rel;
+        if (to < 0 || to >= j->n || a->at[to] < 0) {
+            goto done;
+        }
+        rel = a->at[to] - (from + 4);
+        memcpy(a->p + from, &rel, 4);
+    }
+
+    /* written, then made executable; never both. */
+    j->size = (a->len + page - 1) / page * page;
+    mem = mmap(NULL, j->size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) {
+        goto done;
+    }
+    memcpy(mem, a->p, a->len);
+    if (mprotect(mem, j->size, PROT_READ | PROT_EXEC) != 0) {
+        munmap(mem, j->size);
+        goto done;
+    }
+    j->mem = (unsigned char *) mem;
+    j->native = (tp_jit_fn) mem;
+    j->entry = (void **) tp_malloc(tp, j->n * sizeof(void *));
+    for (k = 0; k < j->n; k++) {
+        if (a->at[k] >= 0 && native[k]) {
+            j->entry[k] = j->mem + a->at[k];
+        }
+    }
+    j->failed = 0;
+    tp->jits->compiled++;
+done:
+    tp_free(tp, a->fix);
+    tp_free(tp, a->at);
+    tp_free(tp, a->p);
+    tp_free(tp, native);
+}
+
+#else
+
+/* no native code for this machine; tp_step runs everything. */
+static void tp_jit_compile(TP, tpd_jit * j) {
+    j->failed = 1;
+}
+
+#endif
+
+/* Function: tp_jit_enter
+ * Runs the native code of the frame from cur, compiling it first if it
+ * got hot; counts hot more calls and back-edges. Returns the instruction
+ * tp_step goes on from: cur if there is no native code for it.
+ */
+tpd_code * tp_jit_enter(TP, tpd_frame * f, tpd_code * cur, int hot) {
+    tpd_jit * j = f->jit;
+    long k = cur - j->code;
+    void * target;
+    /* the profiler sees every instruction in tp_step. */
+    if (!tp->jit_mode || tp->profiling) {
+        return cur;
+    }
+    if (!j->native) {
+        if (j->failed) {
+            return cur;
+        }
+        j->count += hot;
+        if (j->count < (tp->jit_mode > 1 ? 1 : TP_JIT_HOT)) {
+            return cur;
+        }
+        tp_jit_compile(tp, j);
+        if (!j->native) {
+            return cur;
+        }
+    }
+    if (k < 0 || k >= j->n || !(target = j->entry[k])) {
+        return cur;
+    }
+    return j->native(tp, f, target);
+}
@@ -76,18 +76,14 @@ int tp_list_equal(TP, tp_obj a, tp_obj b)
     return 1;
 }
 
-int tp_list_lessthan(TP, tp_obj a, tp_obj b)
+int tp_list_cmp(TP, tp_obj a, tp_obj b)
 {
     int n, v;
     for(n=0; n<_tp_min(TPD_LIST(a)->len, TPD_LIST(b)->len); n++) {
         tp_obj aa = TPD_LIST(a)->items[n];
         tp_obj bb = TPD_LIST(b)->items[n];
-        if(tp_equal(tp, aa, bb)) continue;
-        if(tp_lessthan(tp, aa, bb)) {
-            return 1;
-        } else {
-            return 0;
-        }
+        v = tp_cmp(tp, aa, bb);
+        if(v != 0) return v;
     }
-    return TPD_LIST(a)->len < TPD_LIST(b)->len;
+    return (TPD_LIST(a)->len > TPD_LIST(b)->len) - (TPD_LIST(a)->len < TPD_LIST(b)->len);
 }
@@ -4,6 +4,9 @@ void tp_set_meta(TP, tp_obj self, tp_obj meta) {
             tp_string_atom(tp, "(tp_check_type) TypeError: type does not support meta."));
     }
     TPD_DICT(self)->meta = meta;
+    TP_GC_WRITE(tp, &TPD_DICT(self)->gci, meta);
+    /* the meta chain is part of what an MGET cache depends on. */
+    tpd_dict_touch(tp, TPD_DICT(self));
 }
 tp_obj tp_get_meta(TP, tp_obj self) {
     if(self.type.typeid == TP_STRING) {
@@ -28,7 +28,7 @@ tp_obj tp_pack(TP, char *format, tp_obj v) {
             *(uint64_t*) tp_string_getptr(r) = TPN_AS_INT(v);
             break;
         default:
-            abort();
+            tp_raise(tp_None, tp_string_atom(tp, "pack ValueError: unknown format."));
     }
     return r;
 }
@@ -55,7 +55,7 @@ tp_obj tp_unpack(TP, char * format, tp_obj v) {
             if (tp_string_len(v) != sizeof(uint64_t)) goto ex_len;
             return tp_int(*((uint64_t*) tp_string_getptr(v)));
         default:
-            abort();
+            tp_raise(tp_None, tp_string_atom(tp, "unpack ValueError: unknown format."));
     }
     return r;
 
@@ -36,6 +36,9 @@ tp_inline static tp_obj tp_number_cast(TP, tp_obj v, enum TPTypeMagic kind) {
 
 tp_inline static enum TPTypeMagic tp_number_upcast(TP, tp_obj *a, tp_obj *b) {
     enum TPTypeMagic kind = a->type.magic;
+    if(b->type.magic == kind) {
+        return kind;
+    }
     if(b->type.magic > kind) {
         kind = b->type.magic;
     }
@@ -61,6 +64,12 @@ tp_inline static double tp_number_as_float(TP, tp_obj v) {
 }
 #define TPN_AS_FLOAT(v) tp_number_as_float(tp, v)
 
+/* the type tests of the fast paths for numbers, in tp_step and in the C
+ * of tpc -a. */
+#define TP_IS_INT(v) ((v).type.typeid == TP_NUMBER && (v).type.magic == TP_NUMBER_INT)
+#define TP_BOTH(b, c, kind) ((b).type.typeid == TP_NUMBER && (c).type.typeid == TP_NUMBER && \
+    (b).type.magic == (kind) && (c).type.magic == (kind))
+
 tp_inline static tp_obj tp_bool(int v) {
     return v?tp_True:tp_False;
 }
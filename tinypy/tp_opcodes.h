@@ -0,0 +1,215 @@
+/* Generated from opcodes.py with tpc -x. Do not modify. */
+
+#define TP_IEOF 0 
+#define TP_IADD 1 
+#define TP_ISUB 2 
+#define TP_IMUL 3 
+#define TP_IDIV 4 
+#define TP_IPOW 5 
+#define TP_IMOD 40 
+#define TP_ILSH 41 
+#define TP_IRSH 42 
+#define TP_IBITAND 6 
+#define TP_IBITOR 7 
+#define TP_IBITXOR 46 
+#define TP_INOT 48 
+#define TP_IBITNOT 49 
+#define TP_IMOVE 16 
+#define TP_IMGET 9 
+#define TP_IMETHOD 56 
+#define TP_IGET 10 
+#define TP_ISET 11 
+#define TP_IITER 43 
+#define TP_IRANGE 58 
+#define TP_IFOR 59 
+#define TP_ILEN 30 
+#define TP_IGGET 14 
+#define TP_IGSET 15 
+#define TP_IIGET 33 
+#define TP_IDEL 44 
+#define TP_IUPDATE 50 
+#define TP_IDEF 17 
+#define TP_IPASS 18 
+#define TP_IJUMP 19 
+#define TP_ICALL 20 
+#define TP_ICALLP 55 
+#define TP_ICALLM 57 
+#define TP_IRETURN 21 
+#define TP_IIF 22 
+#define TP_IIFN 47 
+#define TP_IRAISE 38 
+#define TP_ISETJMP 39 
+#define TP_IASSERT 23 
+#define TP_INOTIN 8 
+#define TP_IEQ 24 
+#define TP_ILE 25 
+#define TP_ILT 26 
+#define TP_IGE 53 
+#define TP_IGT 54 
+#define TP_INE 36 
+#define TP_IIN 37 
+#define TP_IPARAMS 32 
+#define TP_INUMBER 12 
+#define TP_ISTRING 13 
+#define TP_IDICT 27 
+#define TP_ILIST 28 
+#define TP_INONE 29 
+#define TP_ICLASS 52 
+#define TP_ILINE 31 
+#define TP_IFILE 34 
+#define TP_INAME 35 
+#define TP_IREGS 45 
+#define TP_IVAR 51 
+#define TP_IGET_LIST 60 
+#define TP_IGET_DICT 61 
+#define TP_IGET_ANY 62 
+#define TP_IADD_INT 63 
+#define TP_IADD_FLOAT 64 
+#define TP_IADD_ANY 65 
+#define TP_IITER_LIST 66 
+#define TP_IITER_ANY 67 
+char * tp_get_opcode_name(int opcode) {
+switch(opcode) {
+case TP_IEOF: return "EOF";
+case TP_IADD: return "ADD";
+case TP_ISUB: return "SUB";
+case TP_IMUL: return "MUL";
+case TP_IDIV: return "DIV";
+case TP_IPOW: return "POW";
+case TP_IMOD: return "MOD";
+case TP_ILSH: return "LSH";
+case TP_IRSH: return "RSH";
+case TP_IBITAND: return "BITAND";
+case TP_IBITOR: return "BITOR";
+case TP_IBITXOR: return "BITXOR";
+case TP_INOT: return "NOT";
+case TP_IBITNOT: return "BITNOT";
+case TP_IMOVE: return "MOVE";
+case TP_IMGET: return "MGET";
+case TP_IMETHOD: return "METHOD";
+case TP_IGET: return "GET";
+case TP_ISET: return "SET";
+case TP_IITER: return "ITER";
+case TP_IRANGE: return "RANGE";
+case TP_IFOR: return "FOR";
+case TP_ILEN: return "LEN";
+case TP_IGGET: return "GGET";
+case TP_IGSET: return "GSET";
+case TP_IIGET: return "IGET";
+case TP_IDEL: return "DEL";
+case TP_IUPDATE: return "UPDATE";
+case TP_IDEF: return "DEF";
+case TP_IPASS: return "PASS";
+case TP_IJUMP: return "JUMP";
+case TP_ICALL: return "CALL";
+case TP_ICALLP: return "CALLP";
+case TP_ICALLM: return "CALLM";
+case TP_IRETURN: return "RETURN";
+case TP_IIF: return "IF";
+case TP_IIFN: return "IFN";
+case TP_IRAISE: return "RAISE";
+case TP_ISETJMP: return "SETJMP";
+case TP_IASSERT: return "ASSERT";
+case TP_INOTIN: return "NOTIN";
+case TP_IEQ: return "EQ";
+case TP_ILE: return "LE";
+case TP_ILT: return "LT";
+case TP_IGE: return "GE";
+case TP_IGT: return "GT";
+case TP_INE: return "NE";
+case TP_IIN: return "IN";
+case TP_IPARAMS: return "PARAMS";
+case TP_INUMBER: return "NUMBER";
+case TP_ISTRING: return "STRING";
+case TP_IDICT: return "DICT";
+case TP_ILIST: return "LIST";
+case TP_INONE: return "NONE";
+case TP_ICLASS: return "CLASS";
+case TP_ILINE: return "LINE";
+case TP_IFILE: return "FILE";
+case TP_INAME: return "NAME";
+case TP_IREGS: return "REGS";
+case TP_IVAR: return "VAR";
+case TP_IGET_LIST: return "GET_LIST";
+case TP_IGET_DICT: return "GET_DICT";
+case TP_IGET_ANY: return "GET_ANY";
+case TP_IADD_INT: return "ADD_INT";
+case TP_IADD_FLOAT: return "ADD_FLOAT";
+case TP_IADD_ANY: return "ADD_ANY";
+case TP_IITER_LIST: return "ITER_LIST";
+case TP_IITER_ANY: return "ITER_ANY";
+default : return NULL;
+}
+}
+
+#define TP_DISPATCH_TABLE(L, DEFAULT) { \
+    [0 ... 255] = DEFAULT, \
+    [TP_IEOF] = L(EOF), \
+    [TP_IADD] = L(ADD), \
+    [TP_ISUB] = L(SUB), \
+    [TP_IMUL] = L(MUL), \
+    [TP_IDIV] = L(DIV), \
+    [TP_IPOW] = L(POW), \
+    [TP_IMOD] = L(MOD), \
+    [TP_ILSH] = L(LSH), \
+    [TP_IRSH] = L(RSH), \
+    [TP_IBITAND] = L(BITAND), \
+    [TP_IBITOR] = L(BITOR), \
+    [TP_IBITXOR] = L(BITXOR), \
+    [TP_INOT] = L(NOT), \
+    [TP_IBITNOT] = L(BITNOT), \
+    [TP_IMOVE] = L(MOVE), \
+    [TP_IMGET] = L(MGET), \
+    [TP_IMETHOD] = L(METHOD), \
+    [TP_IGET] = L(GET), \
+    [TP_ISET] = L(SET), \
+    [TP_IITER] = L(ITER), \
+    [TP_IRANGE] = L(RANGE), \
+    [TP_IFOR] = L(FOR), \
+    [TP_ILEN] = L(LEN), \
+    [TP_IGGET] = L(GGET), \
+    [TP_IGSET] = L(GSET), \
+    [TP_IIGET] = L(IGET), \
+    [TP_IDEL] = L(DEL), \
+    [TP_IUPDATE] = L(UPDATE), \
+    [TP_IDEF] = L(DEF), \
+    [TP_IPASS] = L(PASS), \
+    [TP_IJUMP] = L(JUMP), \
+    [TP_ICALL] = L(CALL), \
+    [TP_ICALLP] = L(CALLP), \
+    [TP_ICALLM] = L(CALLM), \
+    [TP_IRETURN] = L(RETURN), \
+    [TP_IIF] = L(IF), \
+    [TP_IIFN] = L(IFN), \
+    [TP_IRAISE] = L(RAISE), \
+    [TP_ISETJMP] = L(SETJMP), \
+    [TP_IASSERT] = L(ASSERT), \
+    [TP_INOTIN] = L(NOTIN), \
+    [TP_IEQ] = L(EQ), \
+    [TP_ILE] = L(LE), \
+    [TP_ILT] = L(LT), \
+    [TP_IGE] = L(GE), \
+    [TP_IGT] = L(GT), \
+    [TP_INE] = L(NE), \
+    [TP_IIN] = L(IN), \
+    [TP_IPARAMS] = L(PARAMS), \
+    [TP_INUMBER] = L(NUMBER), \
+    [TP_ISTRING] = L(STRING), \
+    [TP_IDICT] = L(DICT), \
+    [TP_ILIST] = L(LIST), \
+    [TP_INONE] = L(NONE), \
+    [TP_ICLASS] = L(CLASS), \
+    [TP_ILINE] = L(LINE), \
+    [TP_IFILE] = L(FILE), \
+    [TP_INAME] = L(NAME), \
+    [TP_IREGS] = L(REGS), \
+    [TP_IVAR] = L(VAR), \
+    [TP_IGET_LIST] = L(GET_LIST), \
+    [TP_IGET_DICT] = L(GET_DICT), \
+    [TP_IGET_ANY] = L(GET_ANY), \
+    [TP_IADD_INT] = L(ADD_INT), \
+    [TP_IADD_FLOAT] = L(ADD_FLOAT), \
+    [TP_IADD_ANY] = L(ADD_ANY), \
+    [TP_IITER_LIST] = L(ITER_LIST), \
+    [TP_IITER_ANY] = L(ITER_ANY), \
+}
@@ -22,6 +22,7 @@ int tp_true(TP, tp_obj v) {
         case TP_STRING: return tp_string_len(v) != 0;
         case TP_LIST: return TPD_LIST(v)->len != 0;
         case TP_DICT: return TPD_DICT(v)->len != 0;
+        case TP_RANGE: return tpd_range_len(TPD_RANGE(v)) != 0;
     }
     return 1;
 }
@@ -46,6 +47,14 @@ tp_obj tp_has(TP,tp_obj self, tp_obj k) {
         return tp_bool(tp_str_index(self,k)!=-1);
     } else if (type == TP_LIST) {
         return tp_bool(tpd_list_find(tp, TPD_LIST(self), k, tp_equal)!=-1);
+    } else if (type == TP_RANGE) {
+        tpd_range * r = TPD_RANGE(self);
+        long n;
+        if (k.type.typeid != TP_NUMBER || k.type.magic != TP_NUMBER_INT || r->step == 0) {
+            return tp_False;
+        }
+        n = (k.nint - r->start) / r->step;
+        return tp_bool((k.nint - r->start) % r->step == 0 && n >= 0 && n < tpd_range_len(r));
     }
     tp_raise(tp_None,tp_string_atom(tp, "(tp_has) TypeError: iterable argument required"));
 }
@@ -91,7 +100,7 @@ void tp_del(TP, tp_obj self, tp_obj k) {
  */
 tp_obj tp_iter(TP,tp_obj self, tp_obj k) {
     int type = self.type.typeid;
-    if (type == TP_LIST || type == TP_STRING) { return tp_get(tp,self,k); }
+    if (type == TP_LIST || type == TP_STRING || type == TP_RANGE) { return tp_get(tp,self,k); }
     if (type == TP_DICT && k.type.typeid == TP_NUMBER) {
         return TPD_DICT(self)->items[tpd_dict_next(tp,TPD_DICT(self))].key;
     }
@@ -99,6 +108,34 @@ tp_obj tp_iter(TP,tp_obj self, tp_obj k) {
 }
 
 
+/* Function: tp_iter_next
+ * One step of a for loop over self.
+ *
+ * Stores item k to *r and advances k. Lists and ranges are read directly,
+ * without <tp_len>.
+ *
+ * Returns:
+ * 0 if there are no more items.
+ */
+int tp_iter_next(TP, tp_obj * r, tp_obj self, tp_obj * k) {
+    long n = TPN_AS_INT(*k);
+    /* only code tp_verify cannot see through starts below 0. */
+    if (n < 0) { return 0; }
+    if (self.type.typeid == TP_LIST) {
+        if (n >= TPD_LIST(self)->len) { return 0; }
+        *r = TPD_LIST(self)->items[n];
+    } else if (self.type.typeid == TP_RANGE) {
+        if (n >= tpd_range_len(TPD_RANGE(self))) { return 0; }
+        *r = tp_int(TPD_RANGE(self)->start + n * TPD_RANGE(self)->step);
+    } else {
+        if (n >= TPN_AS_INT(tp_len(tp, self))) { return 0; }
+        *r = tp_iter(tp, self, *k);
+    }
+    tp_grey(tp, *r);
+    *k = tp_int(n + 1);
+    return 1;
+}
+
 /* Function: tp_get
  * Attribute lookup.
  * 
@@ -121,6 +158,108 @@ tp_obj tp_mget(TP, tp_obj self, tp_obj k) {
     return _tp_get(tp, self, k, 1);
 }
 
+/* whether a way of an MGET cache still holds for the class meta. */
+static int tp_mcache_valid(TP, tp_obj meta, tpd_mcache * c, int i) {
+    int depth;
+    for (depth = 0; depth <= c->ways[i].depth; depth++) {
+        if (TPD_DICT(meta)->version > c->ways[i].version) { return 0; }
+        meta = TPD_DICT(meta)->meta;
+    }
+    return 1;
+}
+
+/* Function: tp_mget_method
+ * Looks up by "." like <tp_mget>, with the inline cache c of the site,
+ * but does not bind methods.
+ *
+ * An attribute of the object itself is probed for as usual; one found on
+ * the meta chain is remembered per class, so the next lookup on an object
+ * of that class skips the walk. The key of a site never changes.
+ *
+ * Returns:
+ * 1 if *r is a method that is to be called with self prepended; 0 if *r
+ * is the attribute itself.
+ */
+int tp_mget_method(TP, tp_obj self, tp_obj k, tpd_mcache * c, tp_obj * r) {
+    tp_obj meta;
+    int i, depth;
+    if (c->state == 0) {
+        c->hash = tp_hash(tp, k);
+        /* _tp_get special cases __dict__ before the meta chain. */
+        c->state = tp_string_equal_atom(k, "__dict__")?-1:1;
+    }
+    if (c->state < 0) {
+        *r = tp_mget(tp, self, k);
+        return 0;
+    }
+    if (self.type.typeid == TP_DICT && self.type.magic != TP_DICT_RAW) {
+        int n = tpd_dict_hashfind(tp, TPD_DICT(self), c->hash, k);
+        if (n != -1) {
+            *r = TPD_DICT(self)->items[n].val;
+            return 0;
+        }
+    } else if (self.type.typeid != TP_LIST && self.type.typeid != TP_STRING) {
+        *r = tp_mget(tp, self, k);
+        return 0;
+    }
+    meta = tp_get_meta(tp, self);
+    if (meta.type.typeid != TP_DICT || meta.type.magic == TP_DICT_RAW) {
+        *r = tp_mget(tp, self, k);
+        return 0;
+    }
+    for (i = 0; i < TP_MCACHE_WAYS; i++) {
+        if (c->ways[i].meta == TPD_DICT(meta) && tp_mcache_valid(tp, meta, c, i)) {
+            break;
+        }
+    }
+    if (i == TP_MCACHE_WAYS) {
+        /* walk the meta chain as _tp_lookup_ does. */
+        tp_obj m = meta;
+        int n = -1;
+        for (depth = 0; depth < 7; depth++) {
+            if (m.type.typeid != TP_DICT || m.type.magic == TP_DICT_RAW) { break; }
+            n = tpd_dict_hashfind(tp, TPD_DICT(m), c->hash, k);
+            if (n != -1) { break; }
+            m = TPD_DICT(m)->meta;
+        }
+        if (n == -1) {
+            /* getter, error, or too deep. */
+            *r = tp_mget(tp, self, k);
+            return 0;
+        }
+        i = c->next;
+        c->next = (c->next + 1) % TP_MCACHE_WAYS;
+        c->ways[i].meta = TPD_DICT(meta);
+        c->ways[i].version = tp->dict_version;
+        c->ways[i].depth = depth;
+        /* the dict holds val as long as the way is valid. */
+        c->ways[i].val = TPD_DICT(m)->items[n].val;
+    }
+    *r = c->ways[i].val;
+    if (r->type.typeid != TP_FUNC || (r->type.mask & TP_FUNC_MASK_STATIC)
+        || (self.type.typeid == TP_DICT && self.type.magic == TP_DICT_CLASS)) {
+        return 0;
+    }
+    if (r->type.mask & TP_FUNC_MASK_METHOD) {
+        /* a bound method in a class is bound again, to self. */
+        *r = tp_bind(tp, *r, self);
+        return 0;
+    }
+    return 1;
+}
+
+/* Function: tp_mget_cached
+ * Looks up by "." like <tp_mget>, with the inline cache c of the site.
+ * See <tp_mget_method>; methods are bound.
+ */
+tp_obj tp_mget_cached(TP, tp_obj self, tp_obj k, tpd_mcache * c) {
+    tp_obj r;
+    if (tp_mget_method(tp, self, k, c, &r)) {
+        r = tp_bind(tp, r, self);
+    }
+    return r;
+}
+
 tp_obj tp_getraw(TP, tp_obj self) {
     tp_obj r = self;
     r.type.magic = TP_DICT_RAW;
@@ -216,6 +355,14 @@ _tp_get(TP, tp_obj self, tp_obj k, int mget)
             tp_slice_get_indices(tp, k, self, &a, &b);
             return tp_string_view(tp,self,a,b);
         }
+    } else if (type == TP_RANGE) {
+        if (k.type.typeid == TP_NUMBER) {
+            return tp_range_get(tp, self, TPN_AS_INT(k));
+        } else if (k.type.typeid == TP_LIST) {
+            int a, b;
+            tp_slice_get_indices(tp, k, self, &a, &b);
+            return tp_range_to_list(tp, self, a, b);
+        }
     } else if (type == TP_FUNC) {
         if (k.type.typeid == TP_STRING) {
             if(tp_string_equal_atom(k, "__args__")) {
@@ -241,7 +388,7 @@ _tp_get(TP, tp_obj self, tp_obj k, int mget)
  * */
 tp_obj tp_copy(TP, tp_obj self) {
     int type = self.type.typeid;
-    if (type == TP_NUMBER) {
+    if (type == TP_NUMBER || type == TP_RANGE) {
         return self;
     }
     if (type == TP_STRING) {
@@ -330,16 +477,20 @@ void tp_set(TP,tp_obj self, tp_obj k, tp_obj v) {
     } else if (type == TP_FUNC) {
         if (k.type.typeid == TP_STRING) {
             if(tp_string_equal_atom(k, "__args__")) {
-                TPD_FUNC(self)->args = v;
+                TPD_FUNC(self)->args = tp_func_params(tp, v);
+                TP_GC_WRITE(tp, &TPD_FUNC(self)->gci, TPD_FUNC(self)->args);
                 return;
             } else if(tp_string_equal_atom(k, "__defaults__")) {
-                TPD_FUNC(self)->defaults = v;
+                TPD_FUNC(self)->defaults = tp_func_params(tp, v);
+                TP_GC_WRITE(tp, &TPD_FUNC(self)->gci, TPD_FUNC(self)->defaults);
                 return;
             } else if(tp_string_equal_atom(k, "__varargs__")) {
                 TPD_FUNC(self)->varargs = v;
+                TP_GC_WRITE(tp, &TPD_FUNC(self)->gci, TPD_FUNC(self)->varargs);
                 return;
             } else if(tp_string_equal_atom(k, "__varkw__")) {
                 TPD_FUNC(self)->varkw = v;
+                TP_GC_WRITE(tp, &TPD_FUNC(self)->gci, TPD_FUNC(self)->varkw);
                 return;
             }
         }
@@ -460,6 +611,8 @@ tp_obj tp_len(TP,tp_obj self) {
         return tp_int(TPD_DICT(self)->len);
     } else if (type == TP_LIST) {
         return tp_int(TPD_LIST(self)->len);
+    } else if (type == TP_RANGE) {
+        return tp_int(tpd_range_len(TPD_RANGE(self)));
     }
     
     tp_raise(tp_None,tp_string_atom(tp, "(tp_len) TypeError: len() of unsized object"));
@@ -482,33 +635,59 @@ int tp_equal(TP, tp_obj a, tp_obj b) {
         case TP_DICT: return tp_dict_equal(tp, a, b);
         case TP_FUNC: return TPD_FUNC(a) == TPD_FUNC(b);
         case TP_DATA: return (char*)a.ptr == (char*)b.ptr;
+        case TP_RANGE: return TPD_RANGE(a)->start == TPD_RANGE(b)->start
+            && TPD_RANGE(a)->stop == TPD_RANGE(b)->stop
+            && TPD_RANGE(a)->step == TPD_RANGE(b)->step;
     }
     tp_raise(0,tp_string_atom(tp, "(tp_equal) TypeError: Unknown types."));
 }
 
-int tp_lessthan(TP, tp_obj a, tp_obj b) {
+/* Function: tp_cmp
+ * Three-way comparison of two objects of the same type.
+ *
+ * Returns a negative value if a < b, zero if a == b and a positive value
+ * if a > b. Floats that are unordered (NaN) compare as TP_CMP_UNORDERED,
+ * which is positive so that both tp_cmp(a, b) < 0 and tp_cmp(b, a) < 0
+ * are false.
+ */
+int tp_cmp(TP, tp_obj a, tp_obj b) {
     if (a.type.typeid != b.type.typeid) { 
-        tp_raise(0,tp_string_atom(tp, "(tp_lessthan) TypeError: Cannot compare different types."));
+        tp_raise(0,tp_string_atom(tp, "(tp_cmp) TypeError: Cannot compare different types."));
     }
     switch(a.type.typeid) {
         case TP_NONE: return 0;
         case TP_NUMBER:
             switch(tp_number_upcast(tp, &a, &b)) {
                 case TP_NUMBER_INT:
-                    return TPN_AS_INT(a) < TPN_AS_INT(b);
+                    return (a.nint > b.nint) - (a.nint < b.nint);
                 case TP_NUMBER_FLOAT:
-                    return TPN_AS_FLOAT(a) < TPN_AS_FLOAT(b);
+                    if (a.nfloat < b.nfloat) return -1;
+                    if (a.nfloat > b.nfloat) return 1;
+                    if (a.nfloat == b.nfloat) return 0;
+                    return TP_CMP_UNORDERED;
                 default: abort();
             }
-        case TP_STRING: return tp_string_cmp(a, b) < 0;
-        case TP_LIST: return tp_list_lessthan(tp, a, b);
+        case TP_STRING: return tp_string_cmp(a, b);
+        case TP_LIST: return tp_list_cmp(tp, a, b);
         case TP_DICT: {
-            tp_raise(0,tp_string_atom(tp, "(tp_lessthan) TypeError: Cannot compare dict."));
+            /* equal dicts may still appear as items of compared lists. */
+            if (tp_dict_equal(tp, a, b)) return 0;
+            tp_raise(0,tp_string_atom(tp, "(tp_cmp) TypeError: Cannot compare dict."));
+        }
+        case TP_FUNC: return (TPD_FUNC(a) > TPD_FUNC(b)) - (TPD_FUNC(a) < TPD_FUNC(b));
+        case TP_DATA: return ((char*) a.ptr > (char*) b.ptr) - ((char*) a.ptr < (char*) b.ptr);
+        case TP_RANGE: {
+            /* ranges have no order; equal ones, like dicts, compare as 0. */
+            if (tp_equal(tp, a, b)) return 0;
+            tp_raise(0,tp_string_atom(tp, "(tp_cmp) TypeError: Cannot compare range."));
         }
-        case TP_FUNC: return TPD_FUNC(a) < TPD_FUNC(b);
-        case TP_DATA: return (char*) a.ptr < (char*) b.ptr;
+        default: break;
     }
-    tp_raise(0,tp_string_atom(tp, "(tp_lessthan) TypeError: Unknown types."));
+    tp_raise(0,tp_string_atom(tp, "(tp_cmp) TypeError: Unknown types."));
+}
+
+int tp_lessthan(TP, tp_obj a, tp_obj b) {
+    return tp_cmp(tp, a, b) < 0;
 }
 
 
@@ -566,6 +745,13 @@ tp_obj tp_call(TP, tp_obj self, tp_obj lparams, tp_obj dparams) {
     }
 
     if (self.type.typeid == TP_FUNC) {
+        if(self.ptr == NULL) {
+            /* compiled Python function */
+            tp_obj dest = tp_None;
+            tp_enter_call(tp, self, lparams, dparams, &dest);
+            tp_run_frame(tp);
+            return dest;
+        }
         if (self.type.mask & TP_FUNC_MASK_METHOD) {
             if (lparams.type.typeid == TP_NONE) {
                 lparams = tp_list_t(tp);
@@ -573,33 +759,104 @@ tp_obj tp_call(TP, tp_obj self, tp_obj lparams, tp_obj dparams) {
             /* method, add instance */
             tpd_list_insert(tp, TPD_LIST(lparams), 0, TPD_FUNC(self)->instance);
         }
-        if(self.ptr != NULL) {
-            /* C func, set tp->lparams for the CAPI calling convention. */
-            *tp->lparams = lparams;
-            *tp->dparams = dparams;
-
-            tp_obj (* cfunc)(tp_vm *);
-            cfunc = self.ptr;
-            tp_obj r = cfunc(tp);
-            tp_grey(tp, r);
-            return r;
-        } else {
-            /* compiled Python function */
-            tp_obj dest = tp_None;
-            tp_enter_frame(tp, lparams, dparams,
-                           TPD_FUNC(self)->globals,
-                           TPD_FUNC(self)->code,
-                           TPD_FUNC(self)->args,
-                           TPD_FUNC(self)->defaults,
-                           &dest);
-            tp_run_frame(tp);
-            return dest;
-        }
+        /* C func, set tp->lparams for the CAPI calling convention. */
+        *tp->lparams = lparams;
+        *tp->dparams = dparams;
+
+        tp_obj (* cfunc)(tp_vm *);
+        cfunc = self.ptr;
+        tp_obj r = cfunc(tp);
+        tp_grey(tp, r);
+        return r;
     }
     tp_echo(tp, self);
     tp_raise(tp_None,tp_string_atom(tp, "(tp_call) TypeError: object is not callable"));
 }
 
+/* Function: tp_enter_call
+ * Enters the frame of a call without running it.
+ *
+ * The frame runs in the VM loop that is already going, so a Python call
+ * from Python neither recurses in C nor sets up another exception handler.
+ * The result is stored to *dest when the frame returns.
+ *
+ * Returns:
+ * 1 if self is a compiled Python function and its frame was entered; 0 if
+ * self has to be called with <tp_call>.
+ */
+int tp_enter_call(TP, tp_obj self, tp_obj lparams, tp_obj dparams, tp_obj * dest) {
+    if (self.type.typeid != TP_FUNC || self.ptr != NULL) {
+        return 0;
+    }
+    if (self.type.mask & TP_FUNC_MASK_METHOD) {
+        if (lparams.type.typeid == TP_NONE) {
+            lparams = tp_list_t(tp);
+        }
+        /* method, add instance */
+        tpd_list_insert(tp, TPD_LIST(lparams), 0, TPD_FUNC(self)->instance);
+    }
+    tp_enter_frame(tp, lparams, dparams,
+                   TPD_FUNC(self)->globals,
+                   TPD_FUNC(self)->code,
+                   TPD_FUNC(self)->consts,
+                   TPD_FUNC(self)->args,
+                   TPD_FUNC(self)->defaults,
+                   dest);
+    return 1;
+}
+
+/* Function: tp_enter_call_regs
+ * Enters the frame of a call to self with the argc positional arguments
+ * in argv[0] ... argv[argc - 1], without running it.
+ *
+ * This is the CALLP calling convention. A compiled function without **kw
+ * that takes this many arguments gets them copied from argv into its own
+ * registers, after the instance if self is a bound method; no params list
+ * or kwargs dict is made. The registers of the caller are not written.
+ *
+ * Returns:
+ * 1 if the frame was entered; 0 if the call has to go through <tp_call>.
+ */
+int tp_enter_call_regs(TP, tp_obj self, tp_obj * argv, int argc, tp_obj * dest) {
+    if (self.type.typeid != TP_FUNC || self.ptr != NULL || !tp_none(TPD_FUNC(self)->varkw)) {
+        return 0;
+    }
+    tpd_func * func = TPD_FUNC(self);
+    int method = (self.type.mask & TP_FUNC_MASK_METHOD) != 0;
+    int nargs = tp_none(func->args)?0:TPD_LIST(func->args)->len;
+    int ndefaults = tp_none(func->defaults)?0:TPD_LIST(func->defaults)->len;
+    if (argc + method > nargs || argc + method < nargs - ndefaults) {
+        return 0;
+    }
+    tp_enter_frame(tp, tp_None, tp_None,
+                   func->globals,
+                   func->code,
+                   func->consts,
+                   func->args,
+                   func->defaults,
+                   dest);
+    /* the instance goes right before the arguments. */
+    tp_get_cur_frame(tp)->argself = method?&func->instance:NULL;
+    tp_get_cur_frame(tp)->argv = argv;
+    tp_get_cur_frame(tp)->argc = argc;
+    return 1;
+}
+
+/* Function: tp_call_regs
+ * Calls regs[0] with the argc positional arguments in regs[1] ... regs[argc].
+ *
+ * See <tp_enter_call_regs>; anything it does not take goes through
+ * <tp_call>.
+ */
+tp_obj tp_call_regs(TP, tp_obj * regs, int argc) {
+    tp_obj dest = tp_None;
+    if (tp_enter_call_regs(tp, regs[0], regs + 1, argc, &dest)) {
+        tp_run_frame(tp);
+        return dest;
+    }
+    return tp_call(tp, regs[0], tp_list_from_items(tp, argc, regs + 1), tp_None);
+}
+
 void tp_assert(TP, tp_obj r, tp_obj b, tp_obj c)
 {
     if (tp_true(tp, r)) { return; }
@@ -4,10 +4,16 @@ int    tp_iget(TP,tp_obj *r, tp_obj self, tp_obj k);
 
 tp_obj tp_mget(TP, tp_obj, tp_obj);
 tp_obj tp_get(TP, tp_obj, tp_obj);
+tp_obj tp_mget_cached(TP, tp_obj self, tp_obj k, tpd_mcache * c);
+int    tp_mget_method(TP, tp_obj self, tp_obj k, tpd_mcache * c, tp_obj * r);
 tp_obj tp_has(TP, tp_obj self, tp_obj k);
 tp_obj tp_len(TP, tp_obj);
 tp_obj tp_call(TP, tp_obj func, tp_obj lparams, tp_obj dparams);
+tp_obj tp_call_regs(TP, tp_obj * regs, int argc);
+int    tp_enter_call(TP, tp_obj func, tp_obj lparams, tp_obj dparams, tp_obj * dest);
+int    tp_enter_call_regs(TP, tp_obj self, tp_obj * argv, int argc, tp_obj * dest);
 tp_obj tp_iter(TP, tp_obj self, tp_obj k);
+int    tp_iter_next(TP, tp_obj * r, tp_obj self, tp_obj * k);
 
 void   tp_del(TP, tp_obj, tp_obj);
 tp_obj tp_str(TP, tp_obj);
@@ -15,6 +21,8 @@ tp_obj tp_repr(TP, tp_obj);
 int    tp_true(TP, tp_obj);
 int    tp_equal(TP, tp_obj, tp_obj);
 int    tp_lessthan(TP, tp_obj, tp_obj);
+int    tp_cmp(TP, tp_obj, tp_obj);
+#define TP_CMP_UNORDERED 2
 tp_obj tp_add(TP,tp_obj a, tp_obj b) ;
 tp_obj tp_mul(TP, tp_obj a, tp_obj b);
 int    tp_hash(TP, tp_obj v);
@@ -0,0 +1,235 @@
+/* File: Profile
+ * Counts the instructions the VM runs: per opcode, per pair of opcodes run
+ * one after the other, and per instruction; optionally times a sample of
+ * them in cycles. Use it to find the hot opcodes, the pairs worth a
+ * superinstruction, and regressions.
+ *
+ * sys.conf.profile = 1 counts, 2 also times, 0 stops; it takes effect at the
+ * next call or return. Switching it on starts the counts from zero.
+ * sys.profile() formats them as a table; sys.profile(code) gives the count
+ * of each word of code, which tpc -d -p puts next to the disassembly.
+ */
+
+/* time one instruction in this many, on average. The gaps are random, or
+ * a loop whose length divides the interval would only ever have the same
+ * few instructions timed. */
+#define TP_PROFILE_SAMPLE 16
+/* rows of the pair table. */
+#define TP_PROFILE_PAIRS 20
+
+#if defined(__x86_64__) || defined(__i386__)
+#define tp_profile_cycles() __builtin_ia32_rdtsc()
+#else
+/* no cycle counter; nanoseconds will do for comparing opcodes. */
+static unsigned long long tp_profile_cycles(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000000000ULL + t.tv_nsec;
+}
+#endif
+
+typedef struct tpd_profile_site {
+    tpd_code * cur;
+    unsigned long count;
+} tpd_profile_site;
+
+typedef struct tpd_profile {
+    unsigned long ops[256];
+    unsigned long pairs[256][256]; /* [previous][current] */
+    unsigned long long cycles[256];
+    unsigned long samples[256];
+    int prev; /* the opcode run last, or -1 */
+    int timed; /* the opcode being timed, or -1 */
+    unsigned long long t0;
+    unsigned long gap; /* instructions until the next one to time */
+    unsigned long seed;
+    /* counts by instruction; open addressing, alloc is a power of 2. */
+    tpd_profile_site * sites;
+    int nsites;
+    int asites;
+} tpd_profile;
+
+static tpd_profile_site * tpd_profile_find(tpd_profile_site * sites, int alloc, tpd_code * cur) {
+    unsigned long i = ((unsigned long) cur >> 2) * 2654435761UL;
+    for (i &= alloc - 1; sites[i].cur && sites[i].cur != cur; i = (i + 1) & (alloc - 1)) { }
+    return &sites[i];
+}
+
+static tpd_profile_site * tpd_profile_lookup(TP, tpd_profile * p, tpd_code * cur) {
+    tpd_profile_site * s = tpd_profile_find(p->sites, p->asites, cur);
+    if (s->cur) {
+        return s;
+    }
+    if ((p->nsites + 1) * 2 > p->asites) {
+        int i, alloc = p->asites * 2;
+        tpd_profile_site * sites = (tpd_profile_site *) tp_malloc(tp, alloc * sizeof(tpd_profile_site));
+        for (i = 0; i < p->asites; i++) {
+            if (p->sites[i].cur) {
+                *tpd_profile_find(sites, alloc, p->sites[i].cur) = p->sites[i];
+            }
+        }
+        tp_free(tp, p->sites);
+        p->sites = sites;
+        p->asites = alloc;
+        s = tpd_profile_find(p->sites, p->asites, cur);
+    }
+    s->cur = cur;
+    p->nsites++;
+    return s;
+}
+
+/* Function: tp_profile_op
+ * Counts the instruction at cur; the VM calls it before running one while
+ * profiling.
+ */
+void tp_profile_op(TP, tpd_code * cur) {
+    tpd_profile * p = tp->profile;
+    int op = cur->i;
+    if (p->timed >= 0) {
+        p->cycles[p->timed] += tp_profile_cycles() - p->t0;
+        p->samples[p->timed]++;
+        p->timed = -1;
+    }
+    p->ops[op]++;
+    if (p->prev >= 0) {
+        p->pairs[p->prev][op]++;
+    }
+    p->prev = op;
+    tpd_profile_lookup(tp, p, cur)->count++;
+    if (tp->profiling > 1 && p->gap-- == 0) {
+        /* xorshift */
+        p->seed ^= p->seed << 13;
+        p->seed ^= p->seed >> 7;
+        p->seed ^= p->seed << 17;
+        p->gap = p->seed % (2 * TP_PROFILE_SAMPLE);
+        p->timed = op;
+        /* last, so the bookkeeping above is not in the sample. */
+        p->t0 = tp_profile_cycles();
+    }
+}
+
+/* Function: tp_profile_set
+ * Sets the profiling mode: 0 off, 1 counts, 2 counts and cycles.
+ */
+void tp_profile_set(TP, int mode) {
+    if (mode && !tp->profiling) {
+        tpd_profile * p = tp->profile;
+        if (!p) {
+            p = tp->profile = (tpd_profile *) tp_malloc(tp, sizeof(tpd_profile));
+        } else {
+            tp_free(tp, p->sites);
+            memset(p, 0, sizeof(tpd_profile));
+        }
+        p->prev = -1;
+        p->timed = -1;
+        p->seed = 88172645463325252UL;
+        p->asites = 1024;
+        p->sites = (tpd_profile_site *) tp_malloc(tp, p->asites * sizeof(tpd_profile_site));
+    }
+    if (!mode && tp->profile) {
+        tp->profile->timed = -1;
+    }
+    tp->profiling = mode;
+}
+
+void tp_profile_deinit(TP) {
+    if (tp->profile) {
+        tp_free(tp, tp->profile->sites);
+        tp_free(tp, tp->profile);
+        tp->profile = NULL;
+    }
+}
+
+typedef struct tpd_profile_row {
+    int a, b;
+    unsigned long n;
+} tpd_profile_row;
+
+static int tpd_profile_row_cmp(const void * x, const void * y) {
+    unsigned long n = ((const tpd_profile_row *) x)->n, m = ((const tpd_profile_row *) y)->n;
+    return n < m ? 1 : n > m ? -1 : 0;
+}
+
+/* Function: tp_profile_table
+ * Formats the counts: opcodes by count, with the mean cycles of the timed
+ * ones, then the most frequent pairs.
+ */
+tp_obj tp_profile_table(TP) {
+    StringBuilder sb[1] = {tp};
+    tpd_profile * p = tp->profile;
+    tpd_profile_row * rows;
+    unsigned long total = 0;
+    char line[128];
+    int i, j, n = 0;
+
+    string_builder_write(sb, "opcode          count       %   cycles\n", -1);
+    if (!p) {
+        return tp_string_steal_from_builder(tp, sb);
+    }
+    rows = (tpd_profile_row *) tp_malloc(tp, 256 * 256 * sizeof(tpd_profile_row));
+    for (i = 0; i < 256; i++) {
+        total += p->ops[i];
+        if (p->ops[i]) {
+            rows[n].a = i;
+            rows[n].n = p->ops[i];
+            n++;
+        }
+    }
+    qsort(rows, n, sizeof(tpd_profile_row), tpd_profile_row_cmp);
+    for (i = 0; i < n; i++) {
+        int op = rows[i].a;
+        snprintf(line, sizeof(line), "%-8s %12lu %6.2f%%", tp_get_opcode_name(op),
+            rows[i].n, 100.0 * rows[i].n / total);
+        string_builder_write(sb, line, -1);
+        if (p->samples[op]) {
+            snprintf(line, sizeof(line), " %8.1f", (double) p->cycles[op] / p->samples[op]);
+            string_builder_write(sb, line, -1);
+        }
+        string_builder_write(sb, "\n", -1);
+    }
+
+    n = 0;
+    for (i = 0; i < 256; i++) {
+        for (j = 0; j < 256; j++) {
+            if (p->pairs[i][j]) {
+                rows[n].a = i;
+                rows[n].b = j;
+                rows[n].n = p->pairs[i][j];
+                n++;
+            }
+        }
+    }
+    qsort(rows, n, sizeof(tpd_profile_row), tpd_profile_row_cmp);
+    string_builder_write(sb, "\npair                   count       %\n", -1);
+    for (i = 0; i < n && i < TP_PROFILE_PAIRS; i++) {
+        snprintf(line, sizeof(line), "%-8s %-8s %12lu %6.2f%%\n",
+            tp_get_opcode_name(rows[i].a), tp_get_opcode_name(rows[i].b),
+            rows[i].n, 100.0 * rows[i].n / total);
+        string_builder_write(sb, line, -1);
+    }
+    tp_free(tp, rows);
+    return tp_string_steal_from_builder(tp, sb);
+}
+
+/* Function: tp_profile_sites
+ * Returns a list with the count of every word of code; the words that do
+ * not start an instruction, or never ran, count 0.
+ */
+tp_obj tp_profile_sites(TP, tp_obj code) {
+    tpd_code * base = (tpd_code *) tp_string_getptr(code);
+    int n = tp_string_len(code) / sizeof(tpd_code);
+    tp_obj r = tp_list_t(tp);
+    tpd_profile * p = tp->profile;
+    int i;
+    tpd_list_realloc(tp, TPD_LIST(r), n);
+    for (i = 0; i < n; i++) {
+        tpd_list_append(tp, TPD_LIST(r), tp_int(0));
+    }
+    for (i = 0; p && i < p->asites; i++) {
+        tpd_code * cur = p->sites[i].cur;
+        if (cur >= base && cur < base + n) {
+            TPD_LIST(r)->items[cur - base] = tp_int(p->sites[i].count);
+        }
+    }
+    return r;
+}
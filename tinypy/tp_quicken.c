@@ -0,0 +1,82 @@
+/* File: Quicken
+ * Rewrites instructions in place for the types they see.
+ *
+ * The first time a GET, ADD or ITER runs, tp_quicken looks at its operands
+ * and writes over its opcode one that handles only those types, with a
+ * guard for them: GET_LIST and GET_DICT, ADD_INT and ADD_FLOAT, ITER_LIST.
+ * When a guard fails, the VM writes the *_ANY form of the opcode, which
+ * runs the generic body and is never specialized again, so a site that
+ * sees mixed types does not flip back and forth. A site whose first
+ * operands fit no variant goes to *_ANY straight away.
+ *
+ * The rewritten forms do what the generic ones do, and tp_verify checks
+ * them as their base opcode, so code that was run can be run again, by
+ * this or another VM. sys.conf.quicken = 0 stops new rewrites; sites that
+ * are already specialized stay so. sys.quicken() formats the counts.
+ */
+
+/* Function: tp_quicken_base
+ * The opcode that op was rewritten from, or op itself.
+ */
+int tp_quicken_base(int op) {
+    switch (op) {
+        case TP_IGET_LIST: case TP_IGET_DICT: case TP_IGET_ANY: return TP_IGET;
+        case TP_IADD_INT: case TP_IADD_FLOAT: case TP_IADD_ANY: return TP_IADD;
+        case TP_IITER_LIST: case TP_IITER_ANY: return TP_IITER;
+    }
+    return op;
+}
+
+/* Function: tp_quicken
+ * Rewrites the GET, ADD or ITER at cur for the operands in regs.
+ */
+void tp_quicken(TP, tpd_code * cur, tp_obj * regs) {
+    tp_obj b = regs[cur->regs.b], c = regs[cur->regs.c];
+    int op = cur->i;
+    switch (cur->i) {
+        case TP_IGET:
+            op = TP_IGET_ANY;
+            if (b.type.typeid == TP_LIST && TP_IS_INT(c)) {
+                op = TP_IGET_LIST;
+            } else if (b.type.typeid == TP_DICT) {
+                op = TP_IGET_DICT;
+            }
+            break;
+        case TP_IADD:
+            op = TP_IADD_ANY;
+            if (TP_BOTH(b, c, TP_NUMBER_INT)) {
+                op = TP_IADD_INT;
+            } else if (TP_BOTH(b, c, TP_NUMBER_FLOAT)) {
+                op = TP_IADD_FLOAT;
+            }
+            break;
+        case TP_IITER:
+            op = TP_IITER_ANY;
+            if (b.type.typeid == TP_LIST && TP_IS_INT(c)) {
+                op = TP_IITER_LIST;
+            }
+            break;
+    }
+    tp->quickened[op]++;
+    cur->i = op;
+}
+
+/* Function: tp_quicken_table
+ * Formats the counts: for every opcode written, how many sites got it,
+ * and how many of those later failed its guard.
+ */
+tp_obj tp_quicken_table(TP) {
+    StringBuilder sb[1] = {tp};
+    char line[128];
+    int i;
+
+    string_builder_write(sb, "opcode             sites       failed\n", -1);
+    for (i = 0; i < 256; i++) {
+        if (tp->quickened[i]) {
+            snprintf(line, sizeof(line), "%-10s %12lu %12lu\n", tp_get_opcode_name(i),
+                tp->quickened[i], tp->quick_failed[i]);
+            string_builder_write(sb, line, -1);
+        }
+    }
+    return tp_string_steal_from_builder(tp, sb);
+}
@@ -0,0 +1,48 @@
+/* File: Range
+ * The lazy sequence returned by range().
+ *
+ * A range keeps its start, stop and step; items are computed when they
+ * are asked for, so range(n) takes the same memory for any n.
+ */
+
+tp_obj tp_range(TP, long start, long stop, long step) {
+    tp_obj r = {TP_RANGE};
+    r.info = tp_slab_alloc(tp, sizeof(tpd_range));
+    TPD_RANGE(r)->start = start;
+    TPD_RANGE(r)->stop = stop;
+    TPD_RANGE(r)->step = step;
+    return tp_track(tp, r);
+}
+
+/* number of items; a step of 0 gives none, like the old list. */
+long tpd_range_len(tpd_range * self) {
+    long n = 0;
+    if (self->step > 0 && self->stop > self->start) {
+        n = (self->stop - self->start + self->step - 1) / self->step;
+    } else if (self->step < 0 && self->stop < self->start) {
+        n = (self->start - self->stop - self->step - 1) / -self->step;
+    }
+    return n;
+}
+
+tp_obj tp_range_get(TP, tp_obj self, long n) {
+    long l = tpd_range_len(TPD_RANGE(self));
+    n = n<0?l+n:n;
+    if (n < 0 || n >= l) {
+        tp_raise(tp_None, tp_string_atom(tp, "(tp_range_get) IndexError: range index out of range"));
+    }
+    return tp_int(TPD_RANGE(self)->start + n * TPD_RANGE(self)->step);
+}
+
+/* items a to b as a list; for slices. */
+tp_obj tp_range_to_list(TP, tp_obj self, long a, long b) {
+    tp_obj r = tp_list_t(tp);
+    long n;
+    if (b > a) {
+        tpd_list_realloc(tp, TPD_LIST(r), b - a);
+    }
+    for (n = a; n < b; n++) {
+        tpd_list_append(tp, TPD_LIST(r), tp_int(TPD_RANGE(self)->start + n * TPD_RANGE(self)->step));
+    }
+    return r;
+}
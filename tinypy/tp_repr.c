@@ -8,12 +8,14 @@ void tp_str_internal(TP, tp_obj self, StringBuilder * sb, int mode) {
 }
 
 tp_obj tp_str(TP, tp_obj self) {
-    StringBuilder sb[1] = {tp};
+    char buffer[128];
+    StringBuilder sb[1] = {tp, buffer, sizeof(buffer), 0, 1};
     tp_str_internal(tp, self, sb, 1);
     return tp_string_steal_from_builder(tp, sb);
 }
 tp_obj tp_repr(TP, tp_obj self) {
-    StringBuilder sb[1] = {tp};
+    char buffer[128];
+    StringBuilder sb[1] = {tp, buffer, sizeof(buffer), 0, 1};
     tp_str_internal(tp, self, sb, 0);
     return tp_string_steal_from_builder(tp, sb);
 }
@@ -140,6 +142,11 @@ void tp_str_(TP, tp_obj self, tpd_list * visited, StringBuilder * sb, int mode)
         char buf[128];
         snprintf(buf, 120, "<func %p>", TPD_FUNC(self));
         string_builder_write(sb, buf, -1);
+    } else if (type == TP_RANGE) {
+        char buf[128];
+        snprintf(buf, 120, "range(%ld, %ld, %ld)",
+            TPD_RANGE(self)->start, TPD_RANGE(self)->stop, TPD_RANGE(self)->step);
+        string_builder_write(sb, buf, -1);
     } else {
         string_builder_write(sb, "<?>", -1);
     }
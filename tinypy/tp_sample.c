@@ -0,0 +1,118 @@
+/* File: Sample
+ * A sampling profiler of the tinypy call stack.
+ *
+ * A SIGPROF interval timer ticks in CPU time; its handler only counts the
+ * tick and sets tp->interrupt. At the next safepoint -- a call, a return or
+ * a loop back-edge, see TP_SAFEPOINT in tp_vm.c -- or when a function
+ * returns, tp_sample records the stack of tp->frames, so the ticks of a
+ * native call go to the function that made it. Nothing runs per
+ * instruction.
+ *
+ * The stacks are kept as collapsed-stack text, one line per distinct stack:
+ * the frames from the outermost as "name (file)" joined by ';', then the
+ * number of ticks. flamegraph.pl and speedscope read it as it is.
+ */
+#include <sys/time.h>
+
+/* the VM the timer samples; there is one timer per process. */
+static tp_vm * volatile tp_sample_vm = NULL;
+
+static void tp_sample_tick(int sig) {
+    tp_vm * tp = tp_sample_vm;
+    if (tp) {
+        tp->sample_ticks++;
+        tp->interrupt = 1;
+    }
+}
+
+/* Function: tp_sample_start
+ * Starts sampling the stack every interval_ms milliseconds of CPU time,
+ * dropping the samples taken so far.
+ */
+void tp_sample_start(TP, double interval_ms) {
+    struct itimerval t;
+    if (interval_ms <= 0) {
+        tp_raise(, tp_string_atom(tp, "(tp_sample_start) ValueError: interval must be > 0"));
+    }
+    tp->samples = tp_dict_t(tp);
+    tp->sample_ticks = 0;
+    tp_sample_vm = tp;
+    signal(SIGPROF, tp_sample_tick);
+    memset(&t, 0, sizeof(t));
+    t.it_interval.tv_sec = (long) (interval_ms / 1000);
+    t.it_interval.tv_usec = (long) (fmod(interval_ms, 1000) * 1000);
+    if (!t.it_interval.tv_sec && !t.it_interval.tv_usec) {
+        t.it_interval.tv_usec = 1;
+    }
+    t.it_value = t.it_interval;
+    setitimer(ITIMER_PROF, &t, NULL);
+}
+
+/* Function: tp_sample_stop
+ * Stops sampling; the samples are kept for tp_sample_collapsed.
+ */
+void tp_sample_stop(TP) {
+    struct itimerval t;
+    if (tp_sample_vm != tp) {
+        return;
+    }
+    memset(&t, 0, sizeof(t));
+    setitimer(ITIMER_PROF, &t, NULL);
+    signal(SIGPROF, SIG_IGN);
+    tp_sample_vm = NULL;
+    tp->sample_ticks = 0;
+}
+
+/* Function: tp_sample
+ * Charges the ticks counted since the last sample to the current stack.
+ * The VM calls it at a safepoint.
+ */
+void tp_sample(TP) {
+    StringBuilder sb[1] = {tp};
+    int ticks = tp->sample_ticks;
+    int i;
+    tp_obj k, n;
+    if (tp->samples.type.typeid != TP_DICT) {
+        return;
+    }
+    /* just called, the function has not run its FILE and NAME yet; try
+     * again at its next safepoint, or at its return, see tp_return. */
+    if (tp->nframes && tp_string_equal_atom(tp_get_cur_frame(tp)->fname, "?")) {
+        tp->interrupt = 1;
+        return;
+    }
+    tp->sample_ticks = 0;
+    for (i = 0; i < tp->nframes; i++) {
+        tpd_frame * f = tp_get_frame(tp, i);
+        if (i) {
+            string_builder_write(sb, ";", -1);
+        }
+        string_builder_echo(sb, f->name);
+        string_builder_write(sb, " (", -1);
+        string_builder_echo(sb, f->fname);
+        string_builder_write(sb, ")", -1);
+    }
+    k = tp_string_steal_from_builder(tp, sb);
+    if (tp_iget(tp, &n, tp->samples, k)) {
+        ticks += n.nint;
+    }
+    tp_set(tp, tp->samples, k, tp_int(ticks));
+}
+
+/* Function: tp_sample_collapsed
+ * Returns the samples as collapsed-stack text.
+ */
+tp_obj tp_sample_collapsed(TP) {
+    StringBuilder sb[1] = {tp};
+    int i;
+    if (tp->samples.type.typeid == TP_DICT) {
+        tpd_dict * d = TPD_DICT(tp->samples);
+        for (i = 0; i < d->alloc; i++) {
+            if (d->items[i].used > 0) {
+                string_builder_echo(sb, d->items[i].key);
+                string_builder_echo(sb, tp_printf(tp, " %d\n", (int) d->items[i].val.nint));
+            }
+        }
+    }
+    return tp_string_steal_from_builder(tp, sb);
+}
@@ -0,0 +1,248 @@
+/* File: Slab
+ * The allocator of the fixed-size parts of objects.
+ *
+ * Every string, list, dict, function, range and data object has a header
+ * of a size known where it is created and where tp_delete frees it. Those
+ * come from tp_slab_alloc instead of calloc: a size class per 16 bytes up
+ * to TP_SLAB_MAX, and for each class the pages with room. A page is
+ * TP_SLAB_PAGE bytes, aligned to its size, so the page of a block is its
+ * address rounded down, and holds blocks of one class. A block comes off
+ * the free list of its page, or off the part of the page not yet handed
+ * out; a freed block goes back on the free list.
+ *
+ * A page whose blocks are all free leaves its class. Up to TP_SLAB_KEEP
+ * such pages are kept for any class to take; the rest go back to libc.
+ * With sys.conf.slabmadvise set, the memory of the kept ones is returned
+ * to the system with madvise until they are used again.
+ *
+ * The sandbox counts every block against its limit, so under TP_SANDBOX
+ * the slab hands out tp_malloc blocks; so it does under AddressSanitizer,
+ * which then still sees a block used after it is freed. Larger sizes
+ * always come from tp_malloc.
+ */
+
+#if defined(TP_SANDBOX) || defined(__SANITIZE_ADDRESS__)
+#define TP_SLAB_MALLOC
+#endif
+
+#if defined(__linux__) && !defined(TP_SLAB_MALLOC)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#define TP_SLAB_PAGE (64 * 1024)
+#define TP_SLAB_ALIGN 16
+#define TP_SLAB_MAX 256
+#define TP_SLAB_CLASSES (TP_SLAB_MAX / TP_SLAB_ALIGN)
+#define TP_SLAB_KEEP 16 /* empty pages kept for reuse */
+
+typedef struct tpd_slab_page {
+    struct tpd_slab_page * next;
+    struct tpd_slab_page * prev;
+    void * free; /* freed blocks, linked through their first word */
+    char * fresh; /* blocks from here to the end were never handed out */
+    int size; /* of a block */
+    int live; /* blocks handed out */
+} tpd_slab_page;
+
+/* the first block of a page, past the header. */
+#define TP_SLAB_FIRST (((sizeof(tpd_slab_page) + TP_SLAB_ALIGN - 1) / TP_SLAB_ALIGN) * TP_SLAB_ALIGN)
+
+typedef struct tpd_slab {
+    tpd_slab_page * partial[TP_SLAB_CLASSES]; /* pages with room, by class */
+    tpd_slab_page * full; /* pages without */
+    tpd_slab_page * empty; /* pages with no block handed out */
+    int nempty;
+    int pages; /* pages held, empty ones included */
+    int madvise;
+    unsigned long allocs;
+    unsigned long frees;
+    unsigned long live[TP_SLAB_CLASSES]; /* blocks handed out, by class */
+} tpd_slab;
+
+void tp_slab_init(TP) {
+    tp->slab = (tpd_slab *) calloc(1, sizeof(tpd_slab));
+}
+
+#ifndef TP_SLAB_MALLOC
+
+static void tpd_slab_link(tpd_slab_page ** list, tpd_slab_page * p) {
+    p->prev = NULL;
+    p->next = *list;
+    if (p->next) { p->next->prev = p; }
+    *list = p;
+}
+
+static void tpd_slab_unlink(tpd_slab_page ** list, tpd_slab_page * p) {
+    if (p->prev) { p->prev->next = p->next; } else { *list = p->next; }
+    if (p->next) { p->next->prev = p->prev; }
+    p->next = p->prev = NULL;
+}
+
+/* a page for class c, on its partial list. */
+static tpd_slab_page * tpd_slab_page_new(TP, int c) {
+    tpd_slab * s = tp->slab;
+    tpd_slab_page * p = s->empty;
+    if (p) {
+        tpd_slab_unlink(&s->empty, p);
+        s->nempty--;
+    } else {
+        void * mem = NULL;
+        if (posix_memalign(&mem, TP_SLAB_PAGE, TP_SLAB_PAGE)) {
+            return NULL;
+        }
+        p = (tpd_slab_page *) mem;
+        s->pages++;
+    }
+    p->free = NULL;
+    p->fresh = (char *) p + TP_SLAB_FIRST;
+    p->size = (c + 1) * TP_SLAB_ALIGN;
+    p->live = 0;
+    tpd_slab_link(&s->partial[c], p);
+    return p;
+}
+
+/* p has no block handed out; keep it for any class, or give it back. */
+static void tpd_slab_page_free(TP, tpd_slab_page * p) {
+    tpd_slab * s = tp->slab;
+    if (s->nempty >= TP_SLAB_KEEP) {
+        free(p);
+        s->pages--;
+        return;
+    }
+#ifdef MADV_DONTNEED
+    /* the header is in the first system page; the rest may go. */
+    if (s->madvise) {
+        long sys = sysconf(_SC_PAGESIZE);
+        madvise((char *) p + sys, TP_SLAB_PAGE - sys, MADV_DONTNEED);
+    }
+#endif
+    tpd_slab_link(&s->empty, p);
+    s->nempty++;
+}
+
+static int tpd_slab_full(tpd_slab_page * p) {
+    return !p->free && p->fresh + p->size > (char *) p + TP_SLAB_PAGE;
+}
+
+#endif
+
+/* Function: tp_slab_alloc
+ * Allocates size bytes, zeroed, as tp_malloc does; free them with
+ * tp_slab_free and the same size.
+ */
+void * tp_slab_alloc(TP, unsigned long size) {
+#ifdef TP_SLAB_MALLOC
+    return tp_malloc(tp, size);
+#else
+    tpd_slab * s = tp->slab;
+    tpd_slab_page * p;
+    char * r;
+    int c;
+    if (size > TP_SLAB_MAX || !size) {
+        return tp_malloc(tp, size);
+    }
+    c = (size - 1) / TP_SLAB_ALIGN;
+    p = s->partial[c];
+    if (!p && !(p = tpd_slab_page_new(tp, c))) {
+        return NULL;
+    }
+    if (p->free) {
+        r = (char *) p->free;
+        p->free = *(void **) r;
+    } else {
+        r = p->fresh;
+        p->fresh += p->size;
+    }
+    p->live++;
+    if (tpd_slab_full(p)) {
+        tpd_slab_unlink(&s->partial[c], p);
+        tpd_slab_link(&s->full, p);
+    }
+    s->allocs++;
+    s->live[c]++;
+    tp->gc_allocated += size;
+    return memset(r, 0, size);
+#endif
+}
+
+/* Function: tp_slab_free
+ * Frees ptr, size bytes from tp_slab_alloc.
+ */
+void tp_slab_free(TP, void * ptr, unsigned long size) {
+#ifdef TP_SLAB_MALLOC
+    tp_free(tp, ptr);
+#else
+    tpd_slab * s = tp->slab;
+    tpd_slab_page * p;
+    int c;
+    if (size > TP_SLAB_MAX || !size || !ptr) {
+        tp_free(tp, ptr);
+        return;
+    }
+    c = (size - 1) / TP_SLAB_ALIGN;
+    p = (tpd_slab_page *) ((size_t) ptr & ~(size_t) (TP_SLAB_PAGE - 1));
+    if (tpd_slab_full(p)) {
+        tpd_slab_unlink(&s->full, p);
+        tpd_slab_link(&s->partial[c], p);
+    }
+    *(void **) ptr = p->free;
+    p->free = ptr;
+    p->live--;
+    s->frees++;
+    s->live[c]--;
+    if (!p->live) {
+        tpd_slab_unlink(&s->partial[c], p);
+        tpd_slab_page_free(tp, p);
+    }
+#endif
+}
+
+/* Function: tp_slab_table
+ * The state of the slab, as a dict: pages held and kept empty, bytes in
+ * them, blocks allocated and freed so far, and the blocks in use by block
+ * size.
+ */
+tp_obj tp_slab_table(TP) {
+    tpd_slab * s = tp->slab;
+    tp_obj r = tp_dict_t(tp);
+    tp_obj live = tp_dict_t(tp);
+    int c;
+    tp_set(tp, r, tp_string_atom(tp, "pages"), tp_int(s->pages));
+    tp_set(tp, r, tp_string_atom(tp, "empty"), tp_int(s->nempty));
+    tp_set(tp, r, tp_string_atom(tp, "bytes"), tp_int((long) s->pages * TP_SLAB_PAGE));
+    tp_set(tp, r, tp_string_atom(tp, "allocs"), tp_int(s->allocs));
+    tp_set(tp, r, tp_string_atom(tp, "frees"), tp_int(s->frees));
+    for (c = 0; c < TP_SLAB_CLASSES; c++) {
+        if (s->live[c]) {
+            tp_set(tp, live, tp_int((c + 1) * TP_SLAB_ALIGN), tp_int(s->live[c]));
+        }
+    }
+    tp_set(tp, r, tp_string_atom(tp, "live"), live);
+    return r;
+}
+
+#ifndef TP_SLAB_MALLOC
+static void tpd_slab_free_all(tpd_slab_page ** list) {
+    while (*list) {
+        tpd_slab_page * p = *list;
+        tpd_slab_unlink(list, p);
+        free(p);
+    }
+}
+#endif
+
+/* Gives back every page, with what is left in them. */
+void tp_slab_deinit(TP) {
+#ifndef TP_SLAB_MALLOC
+    tpd_slab * s = tp->slab;
+    int c;
+    for (c = 0; c < TP_SLAB_CLASSES; c++) {
+        tpd_slab_free_all(&s->partial[c]);
+    }
+    tpd_slab_free_all(&s->full);
+    tpd_slab_free_all(&s->empty);
+#endif
+    free(tp->slab);
+    tp->slab = NULL;
+}
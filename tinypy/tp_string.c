@@ -6,6 +6,7 @@ typedef struct {
     char * buffer;
     int size;
     int len;
+    int borrowed; /* buffer is the caller's, until it is outgrown */
 } StringBuilder;
 
 void string_builder_write(StringBuilder * sb, const char * s, int len)
@@ -19,7 +20,14 @@ void string_builder_write(StringBuilder * sb, const char * s, int len)
     if(len < 0) len = strlen(s);
     if(sb->len + len + 1 >= sb->size) {
         sb->size = (sb->len + len + 1) + sb->len / 2;
-        sb->buffer = tp_realloc(tp, sb->buffer, sb->size);
+        if(sb->borrowed) {
+            char * buffer = tp_malloc(tp, sb->size);
+            memcpy(buffer, sb->buffer, sb->len);
+            sb->buffer = buffer;
+            sb->borrowed = 0;
+        } else {
+            sb->buffer = tp_realloc(tp, sb->buffer, sb->size);
+        }
     }
     memcpy(sb->buffer + sb->len, s, len);
     sb->len += len;
@@ -40,14 +48,15 @@ void string_builder_echo(StringBuilder * sb, tp_obj o)
  
 /*
  * Create a new empty string of a certain size.
+ * The bytes follow the header, in the same block.
  */ 
 tp_obj tp_string_t(TP, int n) {
     tp_obj r;
     r.type.typeid = TP_STRING;
     r.type.magic = TP_STRING_NORMAL;
-    r.info = tp_malloc(tp, sizeof(tpd_string));
+    r.info = tp_slab_alloc(tp, sizeof(tpd_string) + n);
     TPD_STRING(r)->len = n;
-    TPD_STRING(r)->s = tp_malloc(tp, n);
+    TPD_STRING(r)->s = (char*) (TPD_STRING(r) + 1);
     return tp_track(tp, r);
 }
 
@@ -70,7 +79,7 @@ tp_obj tp_string_from_const_nt(TP, const char *s, int n) {
     if(n < 0) n = strlen(s);
     r.type.typeid = TP_STRING;
     r.type.magic = TP_STRING_EXTERN;
-    r.info = tp_malloc(tp, sizeof(tpd_string));
+    r.info = tp_slab_alloc(tp, sizeof(tpd_string));
     TPD_STRING(r)->base = tp_None;
     TPD_STRING(r)->s = (char*) s;
     TPD_STRING(r)->len = n;
@@ -92,12 +101,25 @@ tp_obj tp_string_from_buffer(TP, const char *s, int n) {
     return r;
 }
 
+/*
+ * Create a new string from what was written to sb, and empty sb. A short
+ * string is copied after its header; a long one takes the buffer.
+ */
 tp_obj tp_string_steal_from_builder(TP, StringBuilder * sb)
 {
     tp_obj r;
+    if(sb->borrowed || sizeof(tpd_string) + sb->len <= TP_SLAB_MAX) {
+        r = tp_string_from_buffer(tp, sb->buffer, sb->len);
+        if(!sb->borrowed) {
+            tp_free(tp, sb->buffer);
+        }
+        sb->buffer = NULL;
+        sb->len = 0;
+        return r;
+    }
     r.type.typeid = TP_STRING;
     r.type.magic = TP_STRING_NORMAL;
-    r.info = tp_malloc(tp, sizeof(tpd_string));
+    r.info = tp_slab_alloc(tp, sizeof(tpd_string));
     TPD_STRING(r)->len = sb->len;
     TPD_STRING(r)->s = sb->buffer;
     sb->buffer = NULL;
@@ -130,7 +152,7 @@ tp_obj tp_string_view(TP, tp_obj s, int a, int b) {
     tp_obj r;
     r.type.typeid = TP_STRING;
     r.type.magic = TP_STRING_VIEW;
-    r.info = tp_malloc(tp, sizeof(tpd_string));
+    r.info = tp_slab_alloc(tp, sizeof(tpd_string));
     TPD_STRING(r)->base = s;
     TPD_STRING(r)->s = tp_string_getptr(s) + a;
     TPD_STRING(r)->len = b - a;
@@ -164,7 +186,8 @@ tp_obj tp_printf(TP, char const *fmt,...) {
     va_list arg;
 
     mini_printf_set_handler(tp, _tp_printf_handler, _tp_printf_freeor);
-    StringBuilder sb[1] = {tp};
+    char buffer[128];
+    StringBuilder sb[1] = {tp, buffer, sizeof(buffer), 0, 1};
     va_start(arg, fmt);
     mini_vpprintf(_tp_printf_puts, sb, fmt, arg);
     va_end(arg);
@@ -0,0 +1,194 @@
+/* File: Verify
+ * Checks code once, when tp_exec first runs it, so the VM need not check
+ * it as it runs: registers are accessed without bounds checks, and
+ * operands are read without length checks.
+ *
+ * A module is verified as a whole, with the bodies of its functions; a
+ * function can only come from a DEF in verified code. A string of code
+ * that passed is marked, so running it again does not verify it again.
+ */
+
+/* the number of words of the instruction at code[i], or 0 if it runs past
+ * n words or is not an instruction at all. */
+static int tp_verify_size(tpd_code * code, int i, int n) {
+    tpd_code e = code[i];
+    e.i = tp_quicken_base(e.i);
+    int size = 1;
+    if (!tp_get_opcode_name(e.i) || e.i == TP_IPARAMS) {
+        return 0;
+    }
+    switch (e.i) {
+        case TP_ILINE: size = e.regs.a + 1; break;
+        case TP_IVAR: size = ((e.regs.b << 8) + e.regs.c) / 4 + 2; break;
+        case TP_IDEF: size = (short) ((e.regs.b << 8) + e.regs.c); break;
+        case TP_IREGS: case TP_IMGET: case TP_IMETHOD: size = 2; break;
+        case TP_INUMBER: case TP_ISTRING: case TP_IGGET:
+            if (i + 1 >= n) {
+                return 0;
+            }
+            if (e.i == TP_INUMBER) {
+                size = code[i + 1].regs.c / 4 + 2;
+            } else {
+                size = ((code[i + 1].regs.b << 8) + code[i + 1].regs.c) / 4 + 3;
+            }
+            break;
+    }
+    if (size < 1 || i + size > n) {
+        return 0;
+    }
+    return size;
+}
+
+/* the bytes of a NUMBER literal in format f, or 0 if tp_unpack does not
+ * know f. */
+static int tp_verify_number(int f) {
+    switch (f) {
+        case 'd': return sizeof(double);
+        case 'i': case 'I': return sizeof(int32_t);
+        case 'q': case 'Q': return sizeof(int64_t);
+    }
+    return 0;
+}
+
+/* the highest register e reads or sets, or -1; the runs of CALLP, LIST and
+ * the like count to their last register. */
+static int tp_verify_reg(tpd_code e) {
+    int a = e.regs.a, b = e.regs.b, c = e.regs.c;
+    int r = -1;
+    switch (e.i) {
+        case TP_ILINE: case TP_IVAR: case TP_IPASS: case TP_IREGS:
+        case TP_IJUMP: case TP_ISETJMP:
+            return -1;
+        case TP_INONE: case TP_ICLASS: case TP_INUMBER: case TP_ISTRING:
+        case TP_IGGET: case TP_IIF: case TP_IIFN: case TP_IRETURN:
+        case TP_IRAISE: case TP_IEOF: case TP_IFILE: case TP_INAME:
+            return a;
+        case TP_INOT: case TP_IBITNOT: case TP_ILEN: case TP_IMOVE:
+        case TP_IDEL: case TP_IUPDATE: case TP_IGSET:
+            return _tp_max(a, b);
+        case TP_ILIST: case TP_IDICT: case TP_ICALLP: case TP_ICALLM:
+            return c ? _tp_max(a, b + c - 1) : a;
+        case TP_IRANGE: return _tp_max(a + 2, b + c - 1);
+        case TP_IFOR: return _tp_max(a, b + 2);
+        case TP_IMETHOD: r = a + 1; break;
+        case TP_ICALL: r = c + 1; break;
+        case TP_IDEF: return a + 4;
+    }
+    /* the binary operations, GET, SET, IGET, ITER and ASSERT. */
+    return _tp_max(r, _tp_max(a, _tp_max(b, c)));
+}
+
+/* verify the body [start, end) of a module or a function; owner[i] is
+ * start + 1 for every instruction that starts at word i of it. */
+static void tp_verify_block(TP, tpd_code * code, int * owner, int start, int end) {
+    int i, size, last = start;
+    int cregs, nconsts, ncaches, target;
+    if (end - start < 3 || code[start].i != TP_IREGS) {
+        tp_raise(, tp_string_atom(tp, "(tp_verify) ValueError: no REGS in the preamble"));
+    }
+    cregs = code[start].regs.a;
+    nconsts = (code[start].regs.b << 8) + code[start].regs.c;
+    ncaches = (code[start + 1].regs.b << 8) + code[start + 1].regs.c;
+    /* the VM sets the varargs and varkw registers of every frame. */
+    if (cregs < 2) {
+        tp_raise(, tp_string_atom(tp, "(tp_verify) ValueError: too few registers"));
+    }
+    for (i = start; i < end; i += size) {
+        tpd_code e = code[i];
+        /* code that ran may hold rewritten instructions; see tp_quicken.c. */
+        e.i = tp_quicken_base(e.i);
+        size = tp_verify_size(code, i, end);
+        if (!size) {
+            tp_raise(, tp_string_atom(tp, "(tp_verify) ValueError: bad instruction"));
+        }
+        if (e.i == TP_IREGS && i != start) {
+            tp_raise(, tp_string_atom(tp, "(tp_verify) ValueError: REGS out of the preamble"));
+        }
+        if (tp_verify_reg(e) >= cregs) {
+            tp_raise(, tp_string_atom(tp, "(tp_verify) ValueError: register out of range"));
+        }
+        if ((e.i == TP_INUMBER || e.i == TP_ISTRING || e.i == TP_IGGET)
+            && (e.regs.b << 8) + e.regs.c >= nconsts) {
+            tp_raise(, tp_string_atom(tp, "(tp_verify) ValueError: constant slot out of range"));
+        }
+        if ((e.i == TP_IMGET || e.i == TP_IMETHOD)
+            && (code[i + 1].regs.b << 8) + code[i + 1].regs.c >= ncaches) {
+            tp_raise(, tp_string_atom(tp, "(tp_verify) ValueError: cache out of range"));
+        }
+        /* the callee and, for CALLM, the receiver come first. */
+        if (((e.i == TP_ICALLP || e.i == TP_IRANGE) && e.regs.c < 1)
+            || (e.i == TP_ICALLM && e.regs.c < 2)) {
+            tp_raise(, tp_string_atom(tp, "(tp_verify) ValueError: bad call"));
+        }
+        /* the header of a NUMBER has the format and the size of the data. */
+        if (e.i == TP_INUMBER && (!tp_verify_number(code[i + 1].regs.b)
+            || code[i + 1].regs.c != tp_verify_number(code[i + 1].regs.b))) {
+            tp_raise(, tp_string_atom(tp, "(tp_verify) ValueError: bad number"));
+        }
+        /* the text of a LINE ends within it; tp_format_stack prints it. */
+        if (e.i == TP_ILINE && (size < 2 || code[i + 1].string.val[0] == ';'
+            || ((char *) (code + i + size))[-1] != 0)) {
+            tp_raise(, tp_string_atom(tp, "(tp_verify) ValueError: bad line"));
+        }
+        if (e.i == TP_IDEF) {
+            tp_verify_block(tp, code, owner, i + 1, i + size);
+        }
+        owner[i] = start + 1;
+        last = i;
+    }
+    if (code[last].i != TP_IEOF) {
+        tp_raise(, tp_string_atom(tp, "(tp_verify) ValueError: no EOF at the end"));
+    }
+    /* jumps only land on instructions of the same block. */
+    for (i = start; i < end; i += tp_verify_size(code, i, end)) {
+        tpd_code e = code[i];
+        e.i = tp_quicken_base(e.i);
+        switch (e.i) {
+            case TP_IJUMP: case TP_ISETJMP:
+                target = i + (short) ((e.regs.b << 8) + e.regs.c);
+                if (e.i == TP_ISETJMP && target == i) {
+                    break;
+                }
+                if (target < start || target >= end || owner[target] != start + 1) {
+                    tp_raise(, tp_string_atom(tp, "(tp_verify) ValueError: jump out of the code"));
+                }
+                break;
+            /* these may skip the instruction that follows. */
+            case TP_IIF: case TP_IIFN: case TP_IITER: case TP_IFOR:
+                if (owner[i + 1] != start + 1 || i + 2 >= end || owner[i + 2] != start + 1) {
+                    tp_raise(, tp_string_atom(tp, "(tp_verify) ValueError: skip out of the code"));
+                }
+                break;
+        }
+    }
+}
+
+/* Function: tp_verify
+ * Checks code before it runs.
+ *
+ * Instructions and their operands must lie within the code; registers
+ * within what REGS asks for, constant slots and caches too; and jumps must
+ * land on instructions of the same function body. NUMBER literals must
+ * be in a format tp_unpack reads, and the text of a LINE must end in it.
+ * Raises a ValueError otherwise.
+ */
+void tp_verify(TP, tp_obj code) {
+    int n = tp_string_len(code) / sizeof(tpd_code);
+    tp_obj owner;
+    /* atoms share one tpd_string, so they are verified every time. */
+    int mark = code.type.magic != TP_STRING_ATOM;
+    if (mark && TPD_STRING(code)->verified) {
+        return;
+    }
+    if (tp_string_len(code) % sizeof(tpd_code) != 0) {
+        tp_raise(, tp_string_atom(tp, "(tp_verify) ValueError: bad code length"));
+    }
+    /* a string, so the gc takes it back if a check raises. */
+    owner = tp_string_t(tp, (n + 1) * sizeof(int));
+    memset(tp_string_getptr(owner), 0, (n + 1) * sizeof(int));
+    tp_verify_block(tp, (tpd_code *) tp_string_getptr(code),
+        (int *) tp_string_getptr(owner), 0, n);
+    if (mark) {
+        TPD_STRING(code)->verified = 1;
+    }
+}
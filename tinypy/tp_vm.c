@@ -29,13 +29,17 @@ tp_vm * tp_create_vm(void) {
     int i;
     tp_vm *tp = (tp_vm*)calloc(sizeof(tp_vm),1);
     tp->time_limit = TP_NO_LIMIT;
-    tp->clocks = clock();
-    tp->time_elapsed = 0.0;
     tp->mem_limit = TP_NO_LIMIT;
-    tp->mem_exceeded = 0;
     tp->mem_used = sizeof(tp_vm);
+    tp->insn_limit = TP_NO_LIMIT;
+    tp->insn_left = LONG_MAX;
+    tp->quickening = 1;
+#ifdef TP_JIT
+    tp->jit_mode = 1;
+#endif
     tp->jmp = 0;
 
+    tp_slab_init(tp);
     tp_gc_init(tp);
 
     /* gc initialized, can use tpy_ functions. */
@@ -75,13 +79,7 @@ tp_vm * tp_create_vm(void) {
 
     tp->echo = tp_default_echo;
 
-    tp_obj frames = tp_list_t(tp);
-    tp_gc_set_reachable(tp, frames);
-    for (i=0; i<TP_FRAMES; i++) {
-        tp_set(tp, frames, tp_None, tp_None);
-    }
-    tp->frames = TPD_LIST(frames);
-    tp->frames->len = 0;
+    tp->nframes = 0;
 
     tp_gc_set_reachable(tp, tp->builtins);
     tp_gc_set_reachable(tp, tp->modules);
@@ -92,17 +90,22 @@ tp_vm * tp_create_vm(void) {
     tp_gc_set_reachable(tp, tp->string_class);
 
     *tp->last_result = tp_None;
-    tp_gc_run(tp, 1);
+    tp_gc_run(tp);
     return tp;
 }
 
 void tp_enter_frame(TP, tp_obj lparams, tp_obj dparams,
         tp_obj globals,
         tp_obj code,
+        tp_obj consts,
         tp_obj args,
         tp_obj defaults,
         tp_obj * ret_dest) {
-    tpd_list_appendx(tp, tp->frames, tp_frame_t(tp, lparams, dparams, globals, code, args, defaults, ret_dest));
+    if (tp->nframes >= TP_FRAMES) {
+        tp_raise(, tp_string_atom(tp, "(tp_enter_frame) RuntimeError: maximum recursion depth exceeded"));
+    }
+    tpd_frame_init(tp, &tp->frames[tp->nframes], lparams, dparams, globals, code, consts, args, defaults, ret_dest);
+    tp->nframes += 1;
 }
 
 void _tp_raise(TP, tp_obj e) {
@@ -123,7 +126,7 @@ void _tp_raise(TP, tp_obj e) {
         *(tp->exc_stack) = tp_format_stack(tp);
     }
     tp_grey(tp,e);
-    longjmp(tp->buf,1);
+    longjmp(*tp->buf,1);
 }
 
 void tp_format_stack_internal(TP, StringBuilder * sb)
@@ -131,7 +134,7 @@ void tp_format_stack_internal(TP, StringBuilder * sb)
     int i;
     string_builder_write(sb, "\n", -1);
 
-    for (i=0; i< tp->frames->len; i++) {
+    for (i=0; i< tp->nframes; i++) {
         tpd_frame * f = tp_get_frame(tp, i);
         if (!f->lineno) { continue; }
         string_builder_write(sb, "File \"", -1);
@@ -140,7 +143,8 @@ void tp_format_stack_internal(TP, StringBuilder * sb)
         string_builder_echo(sb, tp_printf(tp, "line %d, in ", f->lineno));
         string_builder_echo(sb, f->name);
         string_builder_write(sb, "\n ", -1);
-        string_builder_echo(sb, f->line);
+        /* the text is nul padded in the bytecode; see TP_ILINE. */
+        string_builder_write(sb, f->line?(char*)(f->line + 1):"?", -1);
         string_builder_write(sb, "\n", -1);
     }
 }
@@ -152,9 +156,11 @@ tp_obj tp_format_stack(TP)
     return tp_string_steal_from_builder(tp, sb);
 }
 
+/* print the exception being raised, with the stack _tp_raise formatted;
+ * the frames it was raised in may have been dropped since. */
 void tp_print_exc(TP) {
     StringBuilder sb[1] = {tp};
-    tp_format_stack_internal(tp, sb);
+    string_builder_echo(sb, *(tp->exc_stack));
     string_builder_write(sb, "\nException:\n", -1);
     string_builder_echo(sb, *(tp->exc));
     string_builder_write(sb, "\n", -1);
@@ -162,245 +168,606 @@ void tp_print_exc(TP) {
     tp_free(tp, sb->buffer);
 }
 
-void tp_handle(TP) {
+/* Finds the innermost frame of the running C level entry into the VM
+ * with an exception handler and resumes it there. Returns 0 if there is
+ * none; the frames of the entry are then dropped. */
+int tp_handle(TP) {
     int i;
-    for (i=tp->frames->len - 1; i>=0; i--) {
+    for (i=tp->nframes - 1; i>=tp->jmp_base; i--) {
         tpd_frame * f = tp_get_frame(tp, i);
         if (f->jmp) { break; }
     }
-    if (i >= 0) {
+    if (i >= tp->jmp_base) {
         tpd_frame * f = tp_get_frame(tp, i);
-        tp->frames->len = i + 1;
+        tp->nframes = i + 1;
+        /* drop the registers of the unwound frames. */
+        tp->stack->len = (f->regs - tp->stack->items) + f->cregs;
         f->cur = f->jmp;
         f->jmp = 0;
-        return;
+        return 1;
     }
-#ifndef CPYTHON_MOD
-    tp_print_exc(tp);
-    abort();
-    exit(-1);
-#else
-    longjmp(tp->nextexpr,1);
-#endif
+    tp->nframes = tp->jmp_base;
+    return 0;
 }
 
 
 int tp_step(TP);
+tp_obj tpy_range(TP);
+/* Runs frames from cur on until the frame cur returns.
+ *
+ * This is the only place that calls setjmp: Python calls made by the VM
+ * enter their frame and keep running in this loop (see <tp_enter_call>),
+ * so there is one handler per C level entry into the VM, not per call.
+ * An exception not handled by the frames of this entry is passed on to
+ * the entry below it. */
 void tp_continue_frame(TP, int cur) {
-    jmp_buf tmp;
-    memcpy(tmp, tp->buf, sizeof(jmp_buf));
+    jmp_buf buf;
+    jmp_buf * prev_buf = tp->buf;
+    int prev_base = tp->jmp_base;
+    /* C code below may hold the young objects tracked so far; see tp_gc_held. */
+    unsigned long prev_held = tp->gc_held;
+    tp->buf = &buf;
+    tp->jmp_base = cur;
+    tp->gc_held = tp->gc_born;
     tp->jmp += 1;
-    if (setjmp(tp->buf)) {
-        tp_handle(tp);
+    if (setjmp(buf)) {
+        if (!tp_handle(tp)) {
+            tp->buf = prev_buf;
+            tp->jmp_base = prev_base;
+            tp->gc_held = prev_held;
+            tp->jmp -= 1;
+            if (tp->jmp) {
+                longjmp(*tp->buf, 1);
+            }
+#ifndef CPYTHON_MOD
+            tp_print_exc(tp);
+            /* abort does not flush stdout. */
+            fflush(stdout);
+            abort();
+            exit(-1);
+#else
+            longjmp(tp->nextexpr,1);
+#endif
+        }
     }
     /* keep runing till the frame drops back (aka function returns) */
-    while (tp->frames->len - 1 >= cur) {
+    while (tp->nframes - 1 >= cur) {
         if (tp_step(tp) == -1) break;
     }
 
+    tp->buf = prev_buf;
+    tp->jmp_base = prev_base;
+    tp->gc_held = prev_held;
     tp->jmp -= 1;
-    memcpy(tp->buf, tmp, sizeof(jmp_buf));
 }
 
 /* run the current frame till it returns */
 void tp_run_frame(TP) {
-    tp_continue_frame(tp, tp->frames->len - 1);
+    tp_continue_frame(tp, tp->nframes - 1);
 }
 
 void tp_return(TP, tp_obj v) {
     tpd_frame * f = tp_get_cur_frame(tp);
     tp_obj *dest = f->ret_dest;
+    /* the last chance to see f on the stack; see tp_sample. */
+    if (tp->sample_ticks) { tp_sample(tp); }
     if (dest) { *dest = v; tp_grey(tp,v); }
-    memset(f->regs,0,(f->cregs)*sizeof(tp_obj));
+    /* no need to clear the registers; tp_stack_alloc does on reuse. */
     tp_stack_free(tp, f->cregs);
-    tp->frames->len -= 1;
+    tp->nframes -= 1;
 }
 
 #include "tinypy/tp_opcodes.h"
 
-#define BOUND(x) (x)<f->cregs?(x):(abort(), 0)
+/* Grows the constant pool of the frame to the n slots its code uses.
+ * Slots hold None until the literal is first loaded. Slot n holds the
+ * inline caches: a GGET cache per slot before it, then m MGET caches. */
+void tpd_frame_consts(TP, tpd_frame * f, int n, int m) {
+    tpd_list * consts = TPD_LIST(f->consts);
+    if (consts->len < n + 1) {
+        if (consts->alloc < n + 1) {
+            tpd_list_realloc(tp, consts, n + 1);
+        }
+        while (consts->len < n) {
+            consts->items[consts->len++] = tp_None;
+        }
+        consts->items[consts->len++] = tp_string_t(tp,
+            n * sizeof(tpd_gcache) + m * sizeof(tpd_mcache));
+        TP_GC_WRITE(tp, &consts->gci, consts->items[n]);
+    }
+    f->gcache = (tpd_gcache*) tp_string_getptr(consts->items[n]);
+    f->mcache = (tpd_mcache*) (f->gcache + n);
+}
+
+/* Decodes the literal of the NUMBER or STRING instruction at cur and
+ * stores it in its constant pool slot. */
+static tp_obj tpd_frame_const(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code e = cur[0];
+    tpd_code h = cur[1];
+    int a = (char*) (cur + 2) - tp_string_getptr(f->code);
+    tp_obj r;
+    if (e.i == TP_INUMBER) {
+        char format[2];
+        format[0] = '=';
+        format[1] = h.regs.b;
+        r = tp_unpack(tp, format, tp_string_view(tp, f->code, a, a + h.regs.c));
+    } else {
+        r = tp_string_view(tp, f->code, a, a + ((h.regs.b << 8) + h.regs.c));
+    }
+    tpd_list_set(tp, TPD_LIST(f->consts), (e.regs.b << 8) + e.regs.c, r,
+        "(tpd_frame_const) constant slot out of range");
+    return r;
+}
+
+/* tp_verify has checked the registers against the REGS of the code. */
 #define VA ((int)e.regs.a)
 #define VB ((int)e.regs.b)
 #define VC ((int)e.regs.c)
-#define RA f->regs[BOUND(e.regs.a)]
-#define RB f->regs[BOUND(e.regs.b)]
-#define RC f->regs[BOUND(e.regs.c)]
+#define RA f->regs[e.regs.a]
+#define RB f->regs[e.regs.b]
+#define RC f->regs[e.regs.c]
 #define UVBC (unsigned short)(((VB<<8)+VC))
 #define SVBC (short)(((VB<<8)+VC))
 #define GA tp_grey(tp,RA)
 #define SR(v) f->cur = cur; return(v);
 
+/* Fast paths for numbers: int op int and float op float are computed in
+ * place; mixed numbers and every other type go to the generic tp_ops
+ * function, which also raises the errors. */
+#define TP_ARITH(op, slow) { \
+        tp_obj b = RB, c = RC; \
+        if (TP_BOTH(b, c, TP_NUMBER_INT)) { RA = tp_int(b.nint op c.nint); } \
+        else if (TP_BOTH(b, c, TP_NUMBER_FLOAT)) { RA = tp_float(b.nfloat op c.nfloat); } \
+        else { RA = slow(tp, b, c); } \
+    }
+#define TP_COMPARE(op, slow) { \
+        tp_obj b = RB, c = RC; \
+        if (TP_BOTH(b, c, TP_NUMBER_INT)) { RA = tp_bool(b.nint op c.nint); } \
+        else if (TP_BOTH(b, c, TP_NUMBER_FLOAT)) { RA = tp_bool(b.nfloat op c.nfloat); } \
+        else { RA = tp_bool(slow); } \
+    }
+#define TP_TRUE(v) (TP_IS_INT(v) ? (v).nint != 0 : tp_true(tp, (v)))
+
+/* the decoded literal of a NUMBER or STRING; decode on first use. */
+#define TP_CONST() (UVBC < TPD_LIST(f->consts)->len && \
+    TPD_LIST(f->consts)->items[UVBC].type.typeid != TP_NONE ? \
+    TPD_LIST(f->consts)->items[UVBC] : tpd_frame_const(tp, f, cur))
+
+/* Bodies of the instructions that native code also runs, through
+ * tp_aot_op or a helper of the JIT; see tp_aot.c and tp_jit.c. */
+
+/* GGET a, b c: the global named by constant slot b c, through the
+ * cache of the slot. */
+static tp_inline void tpd_frame_gget(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code e = *cur;
+    tpd_gcache * c = &f->gcache[UVBC];
+    if (c->globals == TPD_DICT(f->globals)->version
+     && c->builtins == TPD_DICT(tp->builtins)->version) {
+        RA = c->val;
+    } else {
+        tp_obj name = TP_CONST();
+        if (!tp_iget(tp,&RA,f->globals,name)) {
+            RA = tp_get(tp,tp->builtins,name); GA;
+        }
+        /* the dicts hold val as long as the versions match. */
+        c->globals = TPD_DICT(f->globals)->version;
+        c->builtins = TPD_DICT(tp->builtins)->version;
+        c->val = RA;
+    }
+}
+
+/* METHOD: a gets the method and a + 1 the receiver, or the attribute and
+ * None; see CALLM. The next word is the cache of the site. */
+static tp_inline void tpd_frame_method(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code e = *cur;
+    tp_obj self = RB;
+    if (tp_mget_method(tp,self,RC,&f->mcache[((cur+1)->regs.b << 8) + (cur+1)->regs.c],&RA)) {
+        *(&RA + 1) = self;
+    } else {
+        *(&RA + 1) = tp_None;
+    }
+    GA;
+}
+
+/* FOR: b, b + 1, b + 2 are the loop state set up by RANGE. Returns 1 if
+ * a got the next item. */
+static tp_inline int tpd_frame_for(TP, tpd_frame * f, tpd_code e) {
+    tp_obj * s = &RB;
+    if (s[1].type.typeid == TP_NUMBER) {
+        /* a counter: next, stop, step. */
+        if (s[2].nint > 0 ? s[0].nint < s[1].nint : s[0].nint > s[1].nint) {
+            RA = s[0];
+            s[0].nint += s[2].nint;
+            return 1;
+        }
+        return 0;
+    }
+    return tp_iter_next(tp, &RA, s[0], &s[2]);
+}
+
+/* RANGE: calls b with the c - 1 arguments after it, like CALLP, and sets
+ * up a FOR loop over the result in a, a + 1, a + 2. A range becomes a
+ * counter, so the builtin range() is not even called. */
+static tp_inline void tpd_frame_range(TP, tpd_frame * f, tpd_code e) {
+    tp_obj * s = &RA;
+    tp_obj * regs = &RB;
+    int argc = VC - 1, i;
+    tp_obj r;
+    for (i = 1; i <= argc; i++) {
+        if (regs[i].type.typeid != TP_NUMBER) { break; }
+    }
+    if (regs[0].type.typeid == TP_FUNC && regs[0].ptr == tpy_range
+        && argc >= 1 && argc <= 3 && i > argc) {
+        s[0] = tp_int(argc == 1 ? 0 : TPN_AS_INT(regs[1]));
+        s[1] = tp_int(TPN_AS_INT(regs[argc == 1 ? 1 : 2]));
+        s[2] = tp_int(argc == 3 ? TPN_AS_INT(regs[3]) : 1);
+    } else {
+        r = tp_call(tp, regs[0], tp_list_from_items(tp, argc, regs + 1), tp_None);
+        if (r.type.typeid == TP_RANGE) {
+            s[0] = tp_int(TPD_RANGE(r)->start);
+            s[1] = tp_int(TPD_RANGE(r)->stop);
+            s[2] = tp_int(TPD_RANGE(r)->step);
+        } else {
+            s[0] = r;
+            s[1] = tp_None;
+            s[2] = tp_int(0);
+            tp_grey(tp, r);
+        }
+    }
+    if (s[1].type.typeid == TP_NUMBER && s[2].nint == 0) {
+        /* a step of 0 gives no items. */
+        s[1] = s[0];
+        s[2].nint = 1;
+    }
+}
+
+/* DEF: a gets the function whose body follows, with the arguments,
+ * defaults, varargs and varkw in a + 1 to a + 4. */
+static tp_inline void tpd_frame_def(TP, tpd_frame * f, tpd_code * cur) {
+    tpd_code e = *cur;
+    int a = (*(cur+1)).string.val - tp_string_getptr(f->code);
+    if(tp_string_getptr(f->code)[a] == ';') abort();
+    RA = tp_def(tp,
+        tp_string_view(tp, f->code, a, a + (SVBC-1)*4),
+        f->globals,
+        *(&RA + 1),
+        *(&RA + 2),
+        *(&RA + 3),
+        *(&RA + 4)
+    );
+}
+
+/* Something outside the VM -- the sandbox timer or allocator, the
+ * sampling profiler -- sets tp->interrupt to be called back between
+ * instructions; see tp_interrupt. */
+void tp_interrupt(TP) {
+    tp->interrupt = 0;
+    if (tp->sample_ticks) {
+        tp_sample(tp);
+    }
+#ifdef TP_SANDBOX
+    tp_sandbox_check(tp);
+#endif
+}
+
+/* A safepoint is at a call, a return and a loop back-edge: the gc may run
+ * there, and tp->interrupt is looked at.
+ *
+ * The sandbox also charges the instruction budget there: a back-edge
+ * charges the length of the loop body, a call or a return 1. The limits
+ * are looked at when the budget runs out or when the timer or the
+ * allocator asks for it; see tp_sandbox_check. The code was checked by
+ * tp_verify, so the instructions are not. */
+#ifdef TP_SANDBOX
+#define TP_SAFEPOINT(n) { tp_gc_safepoint(tp); \
+    if ((tp->insn_left -= (n)) < 0 || tp->interrupt) { tp_interrupt(tp); } }
+#else
+#define TP_SAFEPOINT(n) { tp_gc_safepoint(tp); \
+    if (tp->interrupt) { tp_interrupt(tp); } }
+#endif
+
+/* The debug build collects garbage before every instruction. */
+#ifdef TPVM_DEBUG
+#define TP_DEBUG_SAFEPOINT() tp_gc_safepoint(tp)
+#else
+#define TP_DEBUG_SAFEPOINT()
+#endif
+
+/* The instruction bodies of tp_step are written once and expanded into
+ * one of two dispatch engines:
+ *
+ * - threaded (TP_DISPATCH_THREADED): every body ends with its own indirect
+ *   jump through a label table generated from opcodes.py, which gives the
+ *   branch predictor one jump site per opcode;
+ * - switch: the portable fallback, one `switch` in a loop.
+ *
+ * TP_NEXT() moves past the current instruction and runs the next one.
+ * TP_DISPATCH() runs the instruction at cur, for bodies that moved cur.
+ *
+ * While profiling, tp_profile_op sees every instruction first: the threaded
+ * engine dispatches through a table that leads there, the switch engine
+ * tests tp->profiling.
+ */
+#ifdef TP_DISPATCH_THREADED
+#define TP_OP(name) tp_op_##name
+#define TP_OP_ADDR(name) &&tp_op_##name
+#define TP_OP_DEFAULT tp_op_default
+#define TP_FETCH() TP_DEBUG_SAFEPOINT(); e = *cur
+#define TP_DISPATCH() { TP_FETCH(); goto *table[e.i]; }
+#else
+#define TP_OP(name) case TP_I##name
+#define TP_OP_DEFAULT default
+#define TP_FETCH() TP_DEBUG_SAFEPOINT(); e = *cur; \
+    if (tp->profiling) { tp_profile_op(tp, cur); }
+#define TP_DISPATCH() continue
+#endif
+
+#define TP_NEXT() { cur += 1; TP_DISPATCH(); }
+
+/* A generic GET, ADD or ITER is rewritten the first time it runs and then
+ * run again as what it became; with quickening off it falls through to
+ * its *_ANY form. A specialized one whose guard fails becomes *_ANY for
+ * good. See tp_quicken.c. */
+#define TP_QUICKEN() if (tp->quickening) { tp_quicken(tp, cur, f->regs); TP_DISPATCH(); }
+#define TP_UNQUICKEN(any) { tp->quick_failed[e.i]++; cur->i = (any); TP_DISPATCH(); }
 
 int tp_step(TP) {
     tpd_frame *f = tp_get_cur_frame(tp);
     tpd_code *cur = f->cur;
-    while(1) {
-    #ifdef TP_SANDBOX
-    tp_bounds(tp,cur,1);
-    #endif
-    tp_gc_run(tp, 0);
-    tpd_code e = *cur;
-    tpd_code *base = (tpd_code*) tp_string_getptr(f->code);
-    /* FIXME: convert this to a flag */
-#if 0
-    fprintf(stdout,"[%04d] %2d.%4d: %-6s %3d %3d %3d",tp->steps, tp->frames->len - 1, (cur - base) * 4,tp_get_opcode_name(e.i),VA,VB,VC);
-    if(e.i == TP_IFILE || e.i == TP_INAME) {
-        char * t = tp_cstr(tp, RA);
-        fprintf(stdout, "   %s", t);
-        free(t);
+    tpd_code e;
+    /* a call or a return just happened. */
+    TP_SAFEPOINT(1);
+    /* back from a call or at a handler: on in the C of the body; see
+     * tp_aot.c. The profiler sees every instruction in tp_step. */
+    if (f->aot && !tp->profiling) {
+        cur = f->aot(tp, f, cur);
     }
-    if(e.i == TP_ILINE) {
-        fprintf(stdout, "   %d", UVBC);
+#ifdef TP_JIT
+    /* back from a call or at a handler: on in native code; see tp_jit.c. */
+    if (f->jit) {
+        cur = tp_jit_enter(tp, f, cur, 0);
     }
-    fprintf(stdout, "\n");
-    fflush(stdout);
-//       int i; for(i=0;i<16;i++) { fprintf(stderr,"%d: %s\n",i,TP_xSTR(f->regs[i])); }
 #endif
+#ifdef TP_DISPATCH_THREADED
+    static void * dispatch[256] = TP_DISPATCH_TABLE(TP_OP_ADDR, &&tp_op_default);
+    /* while profiling, every opcode goes through tp_op_profile first. */
+    static void * profiled[256] = {[0 ... 255] = &&tp_op_profile};
+    void ** table = tp->profiling ? profiled : dispatch;
+    TP_DISPATCH();
+    {
+        tp_op_profile:
+            tp_profile_op(tp, cur);
+            goto *dispatch[e.i];
+#else
+    while(1) {
+    TP_FETCH();
     switch (e.i) {
-        case TP_ILINE: {
-            #ifdef TP_SANDBOX
-            tp_bounds(tp,cur,VA);
-            #endif
-            ;
-            int a = (*(cur+1)).string.val - tp_string_getptr(f->code);
-            if(tp_string_getptr(f->code)[a] == ';') abort();
-            f->line = tp_string_view(tp, f->code, a, a+VA*4-1);
+#endif
+        TP_OP(LINE): {
+            /* only remember where the text is; tp_format_stack reads it. */
+            f->line = cur;
             cur += VA; f->lineno = UVBC;
             }
-            break;
-        case TP_IREGS: /* allocate regs for the frame. must be in the preamble of the function body. */
+            TP_NEXT();
+        TP_OP(REGS): /* allocate regs for the frame. must be in the preamble of the function body. */
         {
             tpd_frame_alloc(tp, tp_get_cur_frame(tp),
                 tp_stack_alloc(tp, VA), VA);
-            break;
+            /* the next word is the number of MGET caches. */
+            tpd_frame_consts(tp, f, UVBC, (((cur+1)->regs.b << 8) + (cur+1)->regs.c));
+            if (tp->naot && (f->aot = tp_aot_get(tp, f->code)) && !tp->profiling) {
+                cur = f->aot(tp, f, cur + 2);
+                TP_DISPATCH();
+            }
+#ifdef TP_JIT
+            if (tp->jit_mode) {
+                f->jit = tp_jit_get(tp, f->code);
+                cur = tp_jit_enter(tp, f, cur + 2, 1);
+                TP_DISPATCH();
+            }
+#endif
+            cur += 1;
+            TP_NEXT();
+        }
+        TP_OP(EOF): *tp->last_result = RA; tp_return(tp,tp_None); SR(0);
+        TP_OP(ADD): TP_QUICKEN();
+        TP_OP(ADD_ANY): TP_ARITH(+, tp_add); TP_NEXT();
+        TP_OP(ADD_INT):
+            if (!TP_BOTH(RB, RC, TP_NUMBER_INT)) { TP_UNQUICKEN(TP_IADD_ANY); }
+            RA = tp_int(RB.nint + RC.nint);
+            TP_NEXT();
+        TP_OP(ADD_FLOAT):
+            if (!TP_BOTH(RB, RC, TP_NUMBER_FLOAT)) { TP_UNQUICKEN(TP_IADD_ANY); }
+            RA = tp_float(RB.nfloat + RC.nfloat);
+            TP_NEXT();
+        TP_OP(SUB): TP_ARITH(-, tp_sub); TP_NEXT();
+        TP_OP(MUL): TP_ARITH(*, tp_mul); TP_NEXT();
+        TP_OP(DIV): {
+            /* int division by zero is left to tp_div. */
+            tp_obj b = RB, c = RC;
+            if (TP_BOTH(b, c, TP_NUMBER_FLOAT)) { RA = tp_float(b.nfloat / c.nfloat); }
+            else { RA = tp_div(tp, b, c); }
+            TP_NEXT();
         }
-        case TP_IEOF: *tp->last_result = RA; tp_return(tp,tp_None); SR(0); break;
-        case TP_IADD: RA = tp_add(tp,RB,RC); break;
-        case TP_ISUB: RA = tp_sub(tp,RB,RC); break;
-        case TP_IMUL: RA = tp_mul(tp,RB,RC); break;
-        case TP_IDIV: RA = tp_div(tp,RB,RC); break;
-        case TP_IPOW: RA = tp_pow(tp,RB,RC); break;
-        case TP_IBITAND: RA = tp_bitwise_and(tp,RB,RC); break;
-        case TP_IBITOR:  RA = tp_bitwise_or(tp,RB,RC); break;
-        case TP_IBITXOR:  RA = tp_bitwise_xor(tp,RB,RC); break;
-        case TP_IMOD:  RA = tp_mod(tp,RB,RC); break;
-        case TP_ILSH:  RA = tp_lsh(tp,RB,RC); break;
-        case TP_IRSH:  RA = tp_rsh(tp,RB,RC); break;
-        case TP_INE: RA = tp_bool(!tp_equal(tp,RB,RC)); break;
-        case TP_IEQ: RA = tp_bool(tp_equal(tp,RB,RC)); break;
-        case TP_ILE: RA = tp_bool(tp_equal(tp,RB,RC) || tp_lessthan(tp, RB, RC)); break;
-        case TP_ILT: RA = tp_bool(tp_lessthan(tp,RB,RC)); break;
-        case TP_IBITNOT:  RA = tp_bitwise_not(tp,RB); break;
-        case TP_INOT: RA = tp_bool(!tp_true(tp,RB)); break;
-        case TP_IPASS: break;
-        case TP_IIF: if (tp_true(tp,RA)) { cur += 1; } break;
-        case TP_IIFN: if (!tp_true(tp,RA)) { cur += 1; } break;
-        case TP_IGET: RA = tp_get(tp,RB,RC); GA; break;
-        case TP_IMGET: RA = tp_mget(tp,RB,RC); GA; break;
-        case TP_IITER:
-            if (TPN_AS_INT(RC) < TPN_AS_INT(tp_len(tp,RB))) {
-                RA = tp_iter(tp,RB,RC); GA;
-                RC = tp_int(TPN_AS_INT(RC) + 1);
-                #ifdef TP_SANDBOX
-                tp_bounds(tp,cur,1);
-                #endif
+        TP_OP(POW): RA = tp_pow(tp,RB,RC); TP_NEXT();
+        TP_OP(BITAND): RA = tp_bitwise_and(tp,RB,RC); TP_NEXT();
+        TP_OP(BITOR):  RA = tp_bitwise_or(tp,RB,RC); TP_NEXT();
+        TP_OP(BITXOR):  RA = tp_bitwise_xor(tp,RB,RC); TP_NEXT();
+        TP_OP(MOD):  RA = tp_mod(tp,RB,RC); TP_NEXT();
+        TP_OP(LSH):  RA = tp_lsh(tp,RB,RC); TP_NEXT();
+        TP_OP(RSH):  RA = tp_rsh(tp,RB,RC); TP_NEXT();
+        TP_OP(NE): TP_COMPARE(!=, !tp_equal(tp, b, c)); TP_NEXT();
+        TP_OP(EQ): TP_COMPARE(==, tp_equal(tp, b, c)); TP_NEXT();
+        /* a > b is evaluated as b < a, so unordered operands are false
+         * either way round; see tp_cmp. */
+        TP_OP(LE): TP_COMPARE(<=, tp_cmp(tp, b, c) <= 0); TP_NEXT();
+        TP_OP(LT): TP_COMPARE(<, tp_cmp(tp, b, c) < 0); TP_NEXT();
+        TP_OP(GE): TP_COMPARE(>=, tp_cmp(tp, c, b) <= 0); TP_NEXT();
+        TP_OP(GT): TP_COMPARE(>, tp_cmp(tp, c, b) < 0); TP_NEXT();
+        TP_OP(BITNOT):  RA = tp_bitwise_not(tp,RB); TP_NEXT();
+        TP_OP(NOT): RA = tp_bool(!tp_true(tp,RB)); TP_NEXT();
+        TP_OP(PASS): TP_NEXT();
+        TP_OP(IF): if (TP_TRUE(RA)) { cur += 1; } TP_NEXT();
+        TP_OP(IFN): if (!TP_TRUE(RA)) { cur += 1; } TP_NEXT();
+        TP_OP(GET): TP_QUICKEN();
+        TP_OP(GET_ANY): RA = tp_get(tp,RB,RC); GA; TP_NEXT();
+        TP_OP(GET_LIST): {
+            tp_obj b = RB;
+            long n;
+            if (b.type.typeid != TP_LIST || !TP_IS_INT(RC)) { TP_UNQUICKEN(TP_IGET_ANY); }
+            n = RC.nint;
+            n = n < 0 ? TPD_LIST(b)->len + n : n;
+            /* out of range raises there. */
+            RA = n >= 0 && n < TPD_LIST(b)->len ? TPD_LIST(b)->items[n] : tp_get(tp,b,RC);
+            GA;
+            }
+            TP_NEXT();
+        TP_OP(GET_DICT): {
+            tp_obj b = RB;
+            int n;
+            if (b.type.typeid != TP_DICT) { TP_UNQUICKEN(TP_IGET_ANY); }
+            /* a miss may still be a method, a getter or a KeyError. */
+            n = tpd_dict_hashfind(tp, TPD_DICT(b), tp_hash(tp, RC), RC);
+            RA = n != -1 ? TPD_DICT(b)->items[n].val : tp_get(tp,b,RC);
+            GA;
+            }
+            TP_NEXT();
+        TP_OP(MGET):
+            /* the next word is the cache of the site. */
+            RA = tp_mget_cached(tp,RB,RC,&f->mcache[((cur+1)->regs.b << 8) + (cur+1)->regs.c]); GA;
+            cur += 1;
+            TP_NEXT();
+        TP_OP(METHOD):
+            tpd_frame_method(tp, f, cur);
+            cur += 1;
+            TP_NEXT();
+        TP_OP(ITER): TP_QUICKEN();
+        TP_OP(ITER_ANY):
+            if (tp_iter_next(tp, &RA, RB, &RC)) {
+                cur += 1;
+            }
+            TP_NEXT();
+        TP_OP(ITER_LIST): {
+            tp_obj b = RB;
+            long n;
+            if (b.type.typeid != TP_LIST || !TP_IS_INT(RC)) { TP_UNQUICKEN(TP_IITER_ANY); }
+            n = RC.nint;
+            if (n >= 0 && n < TPD_LIST(b)->len) {
+                RA = TPD_LIST(b)->items[n];
+                GA;
+                RC = tp_int(n + 1);
+                cur += 1;
+            }
+            }
+            TP_NEXT();
+        TP_OP(FOR):
+            if (tpd_frame_for(tp, f, e)) {
                 cur += 1;
             }
-            break;
-        case TP_IIN: RA = tp_has(tp,RC,RB); break;
-        case TP_INOTIN: RA = tp_bool(!tp_true(tp, tp_has(tp,RC,RB))); break;
-        case TP_IIGET: tp_iget(tp,&RA,RB,RC); break;
-        case TP_ISET: tp_set(tp,RA,RB,RC); break;
-        case TP_IDEL: tp_del(tp,RA,RB); break;
-        case TP_IUPDATE:
-            tp_dict_update(tp, RA, RB);
-            break;
-        case TP_IMOVE: RA = RB; break;
-        case TP_INUMBER:
-            #ifdef TP_SANDBOX
-            tp_bounds(tp,cur,VC/4);
-            #endif
-            {
-            cur++;
-            char format[2];
-            format[0] = '=';
-            format[1] = VB;
-            int a = (char*) cur - tp_string_getptr(f->code);
-            RA = tp_unpack(tp, format, tp_string_view(tp, f->code, a, a+VC));
-            cur+= VC / 4;
+            TP_NEXT();
+        TP_OP(RANGE): tpd_frame_range(tp, f, e); TP_NEXT();
+        TP_OP(IN): RA = tp_has(tp,RC,RB); TP_NEXT();
+        TP_OP(NOTIN): RA = tp_bool(!tp_true(tp, tp_has(tp,RC,RB))); TP_NEXT();
+        TP_OP(IGET): tp_iget(tp,&RA,RB,RC); TP_NEXT();
+        TP_OP(SET): tp_set(tp,RA,RB,RC); TP_NEXT();
+        TP_OP(DEL): tp_del(tp,RA,RB); TP_NEXT();
+        TP_OP(UPDATE):
+            tp_dict_update(tp, tp_check_type(tp, TP_DICT, RA), tp_check_type(tp, TP_DICT, RB));
+            TP_NEXT();
+        TP_OP(MOVE): RA = RB; TP_NEXT();
+        /* NUMBER and STRING: b, c is the constant slot; the next word
+         * holds the format and size (NUMBER) or the length (STRING),
+         * followed by the encoded literal. */
+        TP_OP(NUMBER): {
+            RA = TP_CONST();
+            cur += 2 + (cur+1)->regs.c / 4;
             }
-            continue;
-        case TP_ISTRING: {
-            #ifdef TP_SANDBOX
-            tp_bounds(tp,cur,(UVBC/4)+1);
-            #endif
-            int a = (*(cur+1)).string.val - tp_string_getptr(f->code);
-            RA = tp_string_view(tp, f->code, a, a+UVBC);
-            cur += (UVBC/4)+1;
+            TP_DISPATCH();
+        TP_OP(STRING): {
+            RA = TP_CONST();
+            cur += 2 + (((cur+1)->regs.b << 8) + (cur+1)->regs.c) / 4;
             }
-            break;
-        case TP_IDICT: RA = tp_dict_from_items(tp, VC/2, &RB); break;
-        case TP_ICLASS: RA = tp_class(tp); break;
-        case TP_ILIST: RA = tp_list_from_items(tp, VC, &RB); break;
-        case TP_ILEN: RA = tp_len(tp,RB); break;
-        case TP_IJUMP: cur += SVBC; continue; break;
-        case TP_ISETJMP: f->jmp = SVBC?cur+SVBC:0; break;
-        case TP_ICALL:
-            #ifdef TP_SANDBOX
-            tp_bounds(tp,cur,1);
-            #endif
+            TP_NEXT();
+        TP_OP(DICT): RA = tp_dict_from_items(tp, VC/2, &RB); TP_NEXT();
+        TP_OP(CLASS): RA = tp_class(tp); TP_NEXT();
+        TP_OP(LIST): RA = tp_list_from_items(tp, VC, &RB); TP_NEXT();
+        TP_OP(LEN): RA = tp_len(tp,RB); TP_NEXT();
+        TP_OP(JUMP):
+            cur += SVBC;
+            /* loop back-edge */
+            if (SVBC < 0) {
+                TP_SAFEPOINT(-SVBC);
+#ifdef TP_JIT
+                if (f->jit) {
+                    cur = tp_jit_enter(tp, f, cur, 1);
+                }
+#endif
+            }
+            TP_DISPATCH();
+        TP_OP(SETJMP): f->jmp = SVBC?cur+SVBC:0; TP_NEXT();
+        TP_OP(CALL):
             f->cur = cur + 1;
-            RA = tp_call(tp, RB, RC, *(&RC+1));
-            GA;
-            return 0; break;
-        case TP_IGGET:
-            if (!tp_iget(tp,&RA,f->globals,RB)) {
-                RA = tp_get(tp,tp->builtins,RB); GA;
+            if (!tp_enter_call(tp, RB, RC, *(&RC+1), &RA)) {
+                RA = tp_call(tp, RB, RC, *(&RC+1));
+                GA;
             }
-            break;
-        case TP_IGSET: tp_set(tp,f->globals,RA,RB); break;
-        case TP_IDEF: {
-            #ifdef TP_SANDBOX
-            tp_bounds(tp,cur,SVBC);
-            #endif
-            int a = (*(cur+1)).string.val - tp_string_getptr(f->code);
-            if(tp_string_getptr(f->code)[a] == ';') abort();
-            RA = tp_def(tp,
-                tp_string_view(tp, f->code, a, a + (SVBC-1)*4),
-                f->globals,
-                *(&RA + 1),
-                *(&RA + 2),
-                *(&RA + 3),
-                *(&RA + 4)
-            );
-            cur += SVBC; continue;
+            return 0;
+        TP_OP(CALLP):
+            f->cur = cur + 1;
+            if (!tp_enter_call_regs(tp, RB, &RB + 1, VC - 1, &RA)) {
+                RA = tp_call(tp, RB, tp_list_from_items(tp, VC - 1, &RB + 1), tp_None);
+                GA;
+            }
+            return 0;
+        /* GGET: b, c is the constant slot of the name, which follows as
+         * with STRING. */
+        TP_OP(CALLM): {
+            /* b is the method, b + 1 the receiver or None, as left by
+             * METHOD; the c - 2 arguments follow. */
+            tp_obj * regs = &RB;
+            tp_obj * argv = regs + 2;
+            int argc = VC - 2;
+            f->cur = cur + 1;
+            if (!tp_none(regs[1])) {
+                argv -= 1;
+                argc += 1;
             }
-            break;
-            
-        case TP_IRETURN: tp_return(tp,RA); SR(0); break;
-        case TP_IRAISE: _tp_raise(tp,RA); SR(0); break;
-        case TP_IASSERT:
+            if (!tp_enter_call_regs(tp, regs[0], argv, argc, &RA)) {
+                RA = tp_call(tp, regs[0], tp_list_from_items(tp, argc, argv), tp_None);
+                GA;
+            }
+            return 0;
+            }
+        TP_OP(GGET):
+            tpd_frame_gget(tp, f, cur);
+            cur += 2 + (((cur+1)->regs.b << 8) + (cur+1)->regs.c) / 4;
+            TP_NEXT();
+        TP_OP(GSET): tp_set(tp,f->globals,RA,RB); TP_NEXT();
+        TP_OP(DEF): tpd_frame_def(tp, f, cur); cur += SVBC; TP_DISPATCH();
+
+        TP_OP(RETURN): tp_return(tp,RA); SR(0);
+        TP_OP(RAISE): _tp_raise(tp,RA); SR(0);
+        TP_OP(ASSERT):
             tp_assert(tp, RA, RB, RC);
-            break;
-        case TP_INONE: RA = tp_None; break;
-        case TP_IFILE: f->fname = RA; break;
-        case TP_INAME: f->name = RA; break;
-        case TP_IVAR: {
+            TP_NEXT();
+        TP_OP(NONE): RA = tp_None; TP_NEXT();
+        TP_OP(FILE): f->fname = RA; TP_NEXT();
+        TP_OP(NAME): f->name = RA; TP_NEXT();
+        TP_OP(VAR): {
             cur += (UVBC/4) + 1;
             /* Watch out: crash if continue. */
-            break;
+            TP_NEXT();
         }
-        default:
+        TP_OP(PARAMS):
+        TP_OP_DEFAULT:
             tp_raise(0,tp_string_atom(tp, "(tp_step) RuntimeError: invalid instruction"));
-            break;
+            TP_NEXT();
+#ifdef TP_DISPATCH_THREADED
     }
-    #ifdef TP_SANDBOX
-    tp_time_update(tp);
-    tp_mem_update(tp);
-    tp_bounds(tp,cur,1);
-    #endif
-    cur += 1;
+#else
     }
+    }
+#endif
     SR(0);
 }
 
@@ -410,7 +777,8 @@ int tp_step(TP) {
  */
 tp_obj tp_exec(TP, tp_obj code, tp_obj globals) {
     tp_obj r = tp_None;
-    tp_enter_frame(tp, tp_None, tp_None, globals, code, tp_None, tp_None, &r);
+    tp_verify(tp, code);
+    tp_enter_frame(tp, tp_None, tp_None, globals, code, tp_None, tp_None, tp_None, &r);
     tp_run_frame(tp);
     return r;
 }
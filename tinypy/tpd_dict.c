@@ -1,6 +1,6 @@
 void tpd_dict_free(TP, tpd_dict *self) {
     tp_free(tp, self->items);
-    tp_free(tp, self);
+    tp_slab_free(tp, self, sizeof(tpd_dict));
 }
 
 /* void tpd_dict_reset(tpd_dict *self) {
@@ -10,6 +10,13 @@ void tpd_dict_free(TP, tpd_dict *self) {
        self->cur = 0;
    }*/
 
+/* Gives the dict a version no dict has had before. Every change to a dict
+ * touches it, so a cache filled from a dict is valid as long as the
+ * version is the same. */
+void tpd_dict_touch(TP, tpd_dict *self) {
+    self->version = ++tp->dict_version;
+}
+
 void tpd_dict_hashset(TP, tpd_dict *self, int hash, tp_obj k, tp_obj v) {
     tpd_item item;
     int i,idx = hash&self->mask;
@@ -23,6 +30,7 @@ void tpd_dict_hashset(TP, tpd_dict *self, int hash, tp_obj k, tp_obj v) {
         item.val = v;
         self->items[n] = item;
         self->len += 1;
+        tpd_dict_touch(tp, self);
         return;
     }
 }
@@ -57,7 +65,8 @@ int tpd_dict_hashfind(TP, tpd_dict * self, int hash, tp_obj k) {
 }
 
 tpd_dict *tpd_dict_new(TP) {
-    tpd_dict *self = (tpd_dict*) tp_malloc(tp, sizeof(tpd_dict));
+    tpd_dict *self = (tpd_dict*) tp_slab_alloc(tp, sizeof(tpd_dict));
+    tpd_dict_touch(tp, self);
     return self;
 }
 
@@ -74,6 +83,7 @@ void tpd_dict_hashsetx(TP, tpd_dict * self, int hash, tp_obj k, tp_obj v) {
         tpd_dict_hashset(tp, self, hash, k, v);
     } else {
         self->items[n].val = v;
+        tpd_dict_touch(tp, self);
     }
 }
 
@@ -96,4 +106,5 @@ tp_obj tpd_dict_get(TP, tpd_dict * self, int n) {
 void tpd_dict_del(TP, tpd_dict * self, int n) {
     self->items[n].used = -1;
     self->len -= 1;
+    tpd_dict_touch(tp, self);
 }
@@ -15,20 +15,20 @@ void tpd_list_set(TP, tpd_list *self,int k, tp_obj v, const char *error) {
         tp_raise(,tp_string_atom(tp, "(tpd_list_set) KeyError"));
     }
     self->items[k] = v;
-    tp_grey(tp, v);
+    TP_GC_WRITE(tp, &self->gci, v);
 }
 
 tpd_list *tpd_list_new(TP) {
-    return (tpd_list*) tp_malloc(tp, sizeof(tpd_list));
+    return (tpd_list*) tp_slab_alloc(tp, sizeof(tpd_list));
 }
 
 void tpd_list_free(TP, tpd_list *self) {
     tp_free(tp, self->items);
-    tp_free(tp, self);
+    tp_slab_free(tp, self, sizeof(tpd_list));
 }
 
 tp_obj tpd_list_get(TP, tpd_list *self, int k, const char *error) {
-    if (k >= self->len) {
+    if (k < 0 || k >= self->len) {
         tp_raise_printf(tp_None, "(tpd_list_get) KeyError : Index %d request, but length is %d", k, self->len);
     }
     return self->items[k];
@@ -46,7 +46,7 @@ void tpd_list_appendx(TP, tpd_list *self, tp_obj v) {
 }
 void tpd_list_insert(TP,tpd_list *self, int n, tp_obj v) {
     tpd_list_insertx(tp,self,n,v);
-    tp_grey(tp, v);
+    TP_GC_WRITE(tp, &self->gci, v);
 }
 void tpd_list_append(TP,tpd_list *self, tp_obj v) {
     tpd_list_insert(tp,self,self->len,v);
@@ -44,20 +44,14 @@ tp_obj tpy_len(TP) {
 }
 
 tp_obj tpy_range(TP) {
-    int a,b,c,i;
-    tp_obj r = tp_list_t(tp);
+    long a,b,c;
     switch (TP_NPARAMS()) {
         case 1: a = 0; b = TP_PARAMS_INT(); c = 1; break;
         case 2:
         case 3: a = TP_PARAMS_INT(); b = TP_PARAMS_INT(); c = TPN_AS_INT(TP_PARAMS_DEFAULT(tp_int(1))); break;
-        default: return r;
+        default: a = b = 0; c = 1; break;
     }
-    if (c != 0) {
-        for (i=a; (c>0) ? i<b : i>b; i+=c) {
-            tpd_list_append(tp, TPD_LIST(r), tp_int(i));
-        }
-    }
-    return r;
+    return tp_range(tp, a, b, c);
 }
 
 tp_obj tpy_istype(TP) {
@@ -434,7 +428,7 @@ void tp_module_builtins_init(TP) {
     {"module", tpy_module},
     {"repr", tpy_repr},
     #ifdef TP_SANDBOX
-    {"sandbox",tpy_sandbox_},
+    {"sandbox",tpy_sandbox},
     #endif
     {0,0},
     };
@@ -2,24 +2,13 @@
 tp_obj tpy_str_join(TP) {
     tp_obj delim = TP_PARAMS_OBJ();
     tp_obj val = TP_PARAMS_OBJ();
-    StringBuilder sb[1] = {tp};
-
-    int l=0,i;
-    tp_obj r;
-    char *s;
-    for (i=0; i<TPD_LIST(val)->len; i++) {
-        if (i!=0) { l += tp_string_len(delim); }
-        l += tp_string_len(tp_str(tp, TPD_LIST(val)->items[i]));
-    }
-    r = tp_string_t(tp,l);
-    s = tp_string_getptr(r);
-    l = 0;
+    char buffer[128];
+    StringBuilder sb[1] = {tp, buffer, sizeof(buffer), 0, 1};
+    int i;
     for (i=0; i<TPD_LIST(val)->len; i++) {
-        tp_obj e;
         if (i!=0) {
             string_builder_write(sb, tp_string_getptr(delim), tp_string_len(delim));
         }
-        e = tp_str(tp, TPD_LIST(val)->items[i]);
         tp_str_internal(tp, TPD_LIST(val)->items[i], sb, 1);
     }
     return tp_string_steal_from_builder(tp, sb);
@@ -5,17 +5,106 @@ void * _tp_import_modules(TP);
 /* from runtime */
 tp_obj tp_load(TP, const char*);
 
+/* TP_PROFILE=1 or 2 profiles the run and prints the table to stderr;
+ * TP_PROFILE_SITES=file also saves the count of every word of the code,
+ * for tpc -d -p file. See tp_profile.c. */
+static void tp_profile_dump(TP, tp_obj code) {
+    char * sites = getenv("TP_PROFILE_SITES");
+    tp_obj t = tp_profile_table(tp);
+    fwrite(tp_string_getptr(t), 1, tp_string_len(t), stderr);
+    if (sites) {
+        FILE * f = fopen(sites, "w");
+        tp_obj counts = tp_profile_sites(tp, code);
+        int i;
+        if (!f) {
+            perror(sites);
+            return;
+        }
+        for (i = 0; i < TPD_LIST(counts)->len; i++) {
+            fprintf(f, "%ld\n", TPD_LIST(counts)->items[i].nint);
+        }
+        fclose(f);
+    }
+}
+
+/* TP_SAMPLE=file samples the stack every millisecond of the run and
+ * saves the collapsed stacks, for flamegraph.pl. See tp_sample.c. */
+static void tp_sample_dump(TP, const char * fname) {
+    tp_obj t = tp_sample_collapsed(tp);
+    FILE * f = fopen(fname, "w");
+    if (!f) {
+        perror(fname);
+        return;
+    }
+    fwrite(tp_string_getptr(t), 1, tp_string_len(t), f);
+    fclose(f);
+}
+
+/* TP_QUICKEN=0 runs without rewriting instructions, 1 with; either way
+ * the table of the sites rewritten goes to stderr. See tp_quicken.c. */
+static void tp_quicken_dump(TP) {
+    tp_obj t = tp_quicken_table(tp);
+    fwrite(tp_string_getptr(t), 1, tp_string_len(t), stderr);
+}
+
+/* scripts may leave by sys.exit; the dumps are made then, or at the end. */
+static tp_vm * dump_vm = NULL;
+static tp_obj dump_code;
+
+static void tp_dump(void) {
+    tp_vm * tp = dump_vm;
+    char * sample = getenv("TP_SAMPLE");
+    if (!tp) {
+        return;
+    }
+    dump_vm = NULL;
+    if (getenv("TP_PROFILE")) {
+        tp_profile_dump(tp, dump_code);
+    }
+    if (getenv("TP_QUICKEN")) {
+        tp_quicken_dump(tp);
+    }
+    if (sample) {
+        tp_sample_stop(tp);
+        tp_sample_dump(tp, sample);
+    }
+}
+
 int main(int argc,  char *argv[]) {
     /* fixme: make this argc */
     char * p = getenv("TP_DISABLE_PY_RUNTIME");
     int enable_py_runtime = (p == NULL) || (*p == '0');
+    char * profile = getenv("TP_PROFILE");
+    char * sample = getenv("TP_SAMPLE");
+    char * quicken = getenv("TP_QUICKEN");
 
     tp_vm *tp = tp_init(argc, argv, enable_py_runtime);
 
     tp_obj fname = tp_string_atom(tp, argv[1]);
     tp_obj code = tp_load(tp, argv[1]);
 
+    if (profile) {
+        tp_profile_set(tp, atoi(profile));
+    }
+    if (sample) {
+        tp_sample_start(tp, 1);
+    }
+    if (quicken) {
+        tp->quickening = atoi(quicken) != 0;
+    }
+#ifdef TP_JIT
+    /* TP_JIT=0, 1 or 2 is sys.conf.jit; see tp_jit.c. */
+    if (getenv("TP_JIT")) {
+        tp->jit_mode = atoi(getenv("TP_JIT"));
+    }
+#endif
+    if (profile || sample || quicken) {
+        dump_vm = tp;
+        dump_code = code;
+        atexit(tp_dump);
+    }
     tp_obj module = tp_import(tp, tp_string_atom(tp, "__main__"), code, fname);
+    tp_dump();
 
     tp_deinit(tp);
     return(0);